@@ -0,0 +1,412 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <BenchmarkClass.h>
+#include <unicode/uclean.h>
+#include <stdlib.h>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+/*
+ * The global operator new has no way to get to the counter other than this
+ * pointer. This is the only global in the benchmarks; it is not allowed in
+ * the library.
+ */
+static AllocationCounterClass* InstalledCounter = NULL;
+
+// C++11 removed dynamic exception specifications; the replacement operators
+// must match the declarations in <new>
+#if __cplusplus >= 201103L
+#define PELET_NEW_THROW
+#define PELET_DELETE_THROW noexcept
+#else
+#define PELET_NEW_THROW throw(std::bad_alloc)
+#define PELET_DELETE_THROW throw()
+#endif
+
+/**
+ * adds one to the installed counter. The threaded benchmarks allocate from 
+ * several threads at once, so the counter is incremented atomically.
+ */
+static void CountAllocation() {
+	if (InstalledCounter) {
+#ifdef _WIN32
+		InterlockedIncrement64((volatile LONGLONG*)&InstalledCounter->Count);
+#else
+		__sync_add_and_fetch(&InstalledCounter->Count, 1);
+#endif
+	}
+}
+
+static void* CountedMalloc(size_t size) {
+	CountAllocation();
+	
+	// malloc(0) may return NULL but operator new must return a unique pointer
+	return malloc(size ? size : 1);
+}
+
+void* operator new(size_t size) PELET_NEW_THROW {
+	void* ptr = CountedMalloc(size);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new[](size_t size) PELET_NEW_THROW {
+	void* ptr = CountedMalloc(size);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void* ptr) PELET_DELETE_THROW {
+	free(ptr);
+}
+
+void operator delete[](void* ptr) PELET_DELETE_THROW {
+	free(ptr);
+}
+
+static void* U_CALLCONV IcuAlloc(const void* context, size_t size) {
+	return CountedMalloc(size);
+}
+
+static void* U_CALLCONV IcuRealloc(const void* context, void* ptr, size_t size) {
+	CountAllocation();
+	return realloc(ptr, size);
+}
+
+static void U_CALLCONV IcuFree(const void* context, void* ptr) {
+	free(ptr);
+}
+
+CorpusFileClass::CorpusFileClass()
+	: Name()
+	, Bytes(0)
+	, Tokens(0) {
+}
+
+BenchmarkResultClass::BenchmarkResultClass()
+	: Name()
+	, Buffer()
+	, Version()
+	, Files(0)
+	, Errors(0)
+	, Bytes(0)
+	, Tokens(0)
+	, Seconds(0.0)
+	, AllocationsPerFile(0.0)
+	, PeakRssKilobytes(0) {
+}
+
+double BenchmarkResultClass::MegabytesPerSecond() const {
+	if (Seconds <= 0.0) {
+		return 0.0;
+	}
+	return (Bytes / (1024.0 * 1024.0)) / Seconds;
+}
+
+double BenchmarkResultClass::TokensPerSecond() const {
+	if (Seconds <= 0.0) {
+		return 0.0;
+	}
+	return Tokens / Seconds;
+}
+
+AllocationCounterClass::AllocationCounterClass()
+	: Count(0) {
+}
+
+AllocationCounterClass::~AllocationCounterClass() {
+	if (InstalledCounter == this) {
+		InstalledCounter = NULL;
+	}
+}
+
+bool AllocationCounterClass::Install() {
+	Count = 0;
+	InstalledCounter = this;
+	UErrorCode status = U_ZERO_ERROR;
+	u_setMemoryFunctions(this, IcuAlloc, IcuRealloc, IcuFree, &status);
+	return U_SUCCESS(status) != 0;
+}
+
+BenchmarkClass::BenchmarkClass(const std::string& name)
+	: Name(name) {
+}
+
+BenchmarkClass::~BenchmarkClass() {
+}
+
+LexerBenchmarkClass::LexerBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType)
+	: BenchmarkClass("lex")
+	, Lexer() {
+	Lexer.SetVersion(version);
+	Lexer.SetFileBufferType(bufferType);
+}
+
+bool LexerBenchmarkClass::RunFile(const std::string& file) {
+	if (!Lexer.OpenFile(file)) {
+		return false;
+	}
+	int token = 0;
+	do {
+		token = Lexer.NextToken();
+	} while (!pelet::IsTerminatingToken(token));
+	Lexer.Close();
+	return pelet::T_END == token;
+}
+
+TokenizeBenchmarkClass::TokenizeBenchmarkClass(pelet::Versions version)
+	: BenchmarkClass("tokenize")
+	, Lexer()
+	, Table() {
+	Lexer.SetVersion(version);
+}
+
+bool TokenizeBenchmarkClass::RunFile(const std::string& file) {
+	if (!Lexer.TokenizeFile(file, Table)) {
+		return false;
+	}
+	return Table.GetCount() > 0 && pelet::T_END == Table.Tokens.back();
+}
+
+LintBenchmarkClass::LintBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType)
+	: BenchmarkClass("lint")
+	, Parser() {
+	Parser.SetVersion(version);
+	Parser.SetFileBufferType(bufferType);
+}
+
+bool LintBenchmarkClass::RunFile(const std::string& file) {
+	pelet::LintResultsClass results;
+	return Parser.LintFile(file, results);
+}
+
+/**
+ * @return the name that the given mode is reported as
+ */
+static std::string ScanModeName(ScanModes mode) {
+	switch (mode) {
+	case SCAN_FULL:
+		return "scan-full";
+	case SCAN_PIPELINE:
+		return "scan-pipeline";
+	case SCAN_FULL_PIPELINE:
+		return "scan-full-pipeline";
+	case SCAN_SESSION:
+		return "scan-session";
+	case SCAN_OUTLINE:
+		return "scan-outline";
+	case SCAN_DECLARATIONS:
+		return "scan-declarations";
+	case SCAN_LAZY:
+		return "scan-lazy";
+	default:
+		return "scan-resources";
+	}
+}
+
+ScanBenchmarkClass::ScanBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType, ScanModes mode)
+	: BenchmarkClass(ScanModeName(mode))
+	, Parser()
+	, Observer() {
+	Parser.SetVersion(version);
+	Parser.SetFileBufferType(bufferType);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.SetFunctionObserver(&Observer);
+	if (SCAN_FULL == mode || SCAN_FULL_PIPELINE == mode || SCAN_LAZY == mode) {
+		Parser.SetVariableObserver(&Observer);
+		Parser.SetExpressionObserver(&Observer);
+	}
+	Parser.SetPipelineMode(SCAN_PIPELINE == mode || SCAN_FULL_PIPELINE == mode);
+	Parser.SetSessionMode(SCAN_SESSION == mode);
+	Parser.SetOutlineMode(SCAN_OUTLINE == mode);
+	Parser.SetDeclarationScannerMode(SCAN_DECLARATIONS == mode);
+	Parser.SetLazyBodyMode(SCAN_LAZY == mode);
+}
+
+bool ScanBenchmarkClass::RunFile(const std::string& file) {
+	pelet::LintResultsClass results;
+	return Parser.ScanFile(file, results);
+}
+
+SplitScanBenchmarkClass::SplitScanBenchmarkClass(pelet::Versions version)
+	: BenchmarkClass("scan-split")
+	, Parser()
+	, Observer() {
+	Parser.SetVersion(version);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.SetFunctionObserver(&Observer);
+}
+
+bool SplitScanBenchmarkClass::RunFile(const std::string& file) {
+	pelet::LintResultsClass results;
+	return Parser.ScanFile(file, results);
+}
+
+ExpressionBenchmarkClass::ExpressionBenchmarkClass(pelet::Versions version, bool chain)
+	: Name(chain ? "expr-chain" : "expr-grammar")
+	, Parser()
+	, Expressions() {
+	Parser.SetVersion(version);
+	Parser.SetExpressionChainMode(chain);
+	Expressions.push_back(UNICODE_STRING_SIMPLE("$this->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("$user->getName()->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("$this->func1($a, $b)->propA->prop2->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("UserClass::"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("\\First\\Second\\UserClass::create('x')->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("parent::__construct($a)->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("new UserClass($name)"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("$rows[0]->name->"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("\\First\\"));
+	Expressions.push_back(UNICODE_STRING_SIMPLE("array_merge($a, $b)"));
+}
+
+void ExpressionBenchmarkClass::Run(int count, int iterations, AllocationCounterClass& counter, BenchmarkResultClass& result) {
+	pelet::ScopeClass scope;
+	pelet::VariableClass variable(scope);
+	result.Files = count;
+	result.Errors = 0;
+	result.Bytes = 0;
+	result.Tokens = 0;
+	for (int i = 0; i < count; ++i) {
+		result.Bytes += Expressions[i % Expressions.size()].length() * sizeof(UChar);
+	}
+	double best = -1.0;
+	unsigned long long allocations = 0;
+	for (int iteration = 0; iteration < iterations; ++iteration) {
+		int errors = 0;
+		unsigned long long startCount = counter.Count;
+		double start = BenchmarkSeconds();
+		for (int i = 0; i < count; ++i) {
+			Parser.ParseExpression(Expressions[i % Expressions.size()], variable);
+			if (variable.ChainList.empty()) {
+				errors++;
+			}
+		}
+		double elapsed = BenchmarkSeconds() - start;
+		allocations += counter.Count - startCount;
+		if (best < 0.0 || elapsed < best) {
+			best = elapsed;
+		}
+		result.Errors = errors;
+	}
+	result.Seconds = best;
+	if (count > 0 && iterations > 0) {
+		result.AllocationsPerFile = (double)allocations / ((double)iterations * count);
+	}
+	result.PeakRssKilobytes = PeakRssKilobytes();
+}
+
+BenchmarkRunnerClass::BenchmarkRunnerClass(const std::vector<CorpusFileClass>& corpus, AllocationCounterClass& counter)
+	: Corpus(corpus)
+	, Counter(counter)
+	, Iterations(3) {
+}
+
+void BenchmarkRunnerClass::SetIterations(int iterations) {
+	Iterations = iterations > 0 ? iterations : 1;
+}
+
+void BenchmarkRunnerClass::Run(BenchmarkClass& benchmark, BenchmarkResultClass& result) {
+	result.Files = (int)Corpus.size();
+	result.Errors = 0;
+	result.Bytes = 0;
+	result.Tokens = 0;
+	for (size_t i = 0; i < Corpus.size(); ++i) {
+		result.Bytes += Corpus[i].Bytes;
+		result.Tokens += Corpus[i].Tokens;
+	}
+	double best = -1.0;
+	unsigned long long allocations = 0;
+	for (int iteration = 0; iteration < Iterations; ++iteration) {
+		int errors = 0;
+		unsigned long long startCount = Counter.Count;
+		double start = BenchmarkSeconds();
+		for (size_t i = 0; i < Corpus.size(); ++i) {
+			if (!benchmark.RunFile(Corpus[i].Name)) {
+				errors++;
+			}
+		}
+		double elapsed = BenchmarkSeconds() - start;
+		allocations += Counter.Count - startCount;
+		if (best < 0.0 || elapsed < best) {
+			best = elapsed;
+		}
+		result.Errors = errors;
+	}
+	result.Seconds = best;
+	if (!Corpus.empty()) {
+		result.AllocationsPerFile = (double)allocations / ((double)Iterations * Corpus.size());
+	}
+	result.PeakRssKilobytes = PeakRssKilobytes();
+}
+
+double BenchmarkSeconds() {
+#ifdef _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1000000000.0;
+#endif
+}
+
+long PeakRssKilobytes() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return (long)(counters.PeakWorkingSetSize / 1024);
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#ifdef __APPLE__
+
+	// Mac OS X reports bytes, linux reports kilobytes
+	return (long)(usage.ru_maxrss / 1024);
+#else
+	return (long)usage.ru_maxrss;
+#endif
+#endif
+}
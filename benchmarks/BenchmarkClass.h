@@ -0,0 +1,408 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __benchmarkclass__
+#define __benchmarkclass__
+
+#include <pelet/LexicalAnalyzerClass.h>
+#include <pelet/ParserClass.h>
+#include <pelet/SplitFileParserClass.h>
+#include <pelet/TokenClass.h>
+#include <string>
+#include <vector>
+
+/**
+ * A file that the benchmarks will be run on. The token count is taken once, with
+ * the streaming buffer, so that every benchmark reports tokens per second over
+ * the same number of tokens.
+ */
+class CorpusFileClass {
+
+public:
+
+	std::string Name;
+
+	/**
+	 * the size of the file, in bytes
+	 */
+	long Bytes;
+
+	/**
+	 * the number of tokens in the file, including the terminating token
+	 */
+	long Tokens;
+
+	CorpusFileClass();
+};
+
+/**
+ * The measurements of one benchmark over the entire corpus.
+ */
+class BenchmarkResultClass {
+
+public:
+
+	/**
+	 * the name of the benchmark ie. "lex", "lint"
+	 */
+	std::string Name;
+
+	/**
+	 * the file buffer that the benchmark used ie. "streaming", "mapped"
+	 */
+	std::string Buffer;
+
+	/**
+	 * the PHP version that the benchmark used ie. "5.3", "5.4"
+	 */
+	std::string Version;
+
+	int Files;
+
+	/**
+	 * the number of files that the benchmark could not process (lexer or parser errors)
+	 */
+	int Errors;
+
+	long long Bytes;
+
+	long long Tokens;
+
+	/**
+	 * the fastest time, in seconds, that it took to process the entire corpus
+	 */
+	double Seconds;
+
+	/**
+	 * the average number of heap allocations (C++ and ICU) that were made for each file
+	 */
+	double AllocationsPerFile;
+
+	/**
+	 * the peak resident memory of the process, in kilobytes, after the benchmark ran. Since
+	 * this is a high water mark, it includes the memory used by any of the previous benchmarks.
+	 */
+	long PeakRssKilobytes;
+
+	BenchmarkResultClass();
+
+	/**
+	 * @return double throughput, in megabytes (2^20 bytes) per second
+	 */
+	double MegabytesPerSecond() const;
+
+	/**
+	 * @return double throughput, in tokens per second
+	 */
+	double TokensPerSecond() const;
+};
+
+/**
+ * Counts the heap allocations that are made by the process. C++ allocations are counted 
+ * by replacing the global operator new, ICU allocations are counted by giving 
+ * ICU our own memory functions (u_setMemoryFunctions). Memory mapped files are not counted.
+ */
+class AllocationCounterClass {
+
+public:
+
+	/**
+	 * the number of allocations since Install() was called. This is written by the 
+	 * memory functions, from any thread, with atomic increments; read it only 
+	 * when no benchmark threads are running.
+	 */
+	volatile unsigned long long Count;
+
+	AllocationCounterClass();
+
+	~AllocationCounterClass();
+
+	/**
+	 * Start counting allocations. This must be called before any ICU function, since ICU
+	 * does not allow its memory functions to be changed once it has been used.
+	 *
+	 * @return bool TRUE if ICU allocations will be counted.
+	 */
+	bool Install();
+};
+
+/**
+ * A benchmark is a piece of work that is done on a single file, ie. lexing all of 
+ * its tokens. Each benchmark is given the files of the corpus one at a time.
+ */
+class BenchmarkClass {
+
+public:
+
+	/**
+	 * the name that the benchmark is reported as
+	 */
+	std::string Name;
+
+	BenchmarkClass(const std::string& name);
+
+	virtual ~BenchmarkClass();
+
+	/**
+	 * Process the given file.
+	 *
+	 * @return bool FALSE if the file had an error
+	 */
+	virtual bool RunFile(const std::string& file) = 0;
+};
+
+/**
+ * Lexes the entire file with LexicalAnalyzerClass::NextToken()
+ */
+class LexerBenchmarkClass : public BenchmarkClass {
+
+public:
+
+	LexerBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType);
+
+	bool RunFile(const std::string& file);
+
+private:
+
+	pelet::LexicalAnalyzerClass Lexer;
+};
+
+/**
+ * Lexes the entire file into a token table with LexicalAnalyzerClass::TokenizeFile()
+ */
+class TokenizeBenchmarkClass : public BenchmarkClass {
+
+public:
+
+	TokenizeBenchmarkClass(pelet::Versions version);
+
+	bool RunFile(const std::string& file);
+
+private:
+
+	pelet::LexicalAnalyzerClass Lexer;
+
+	pelet::TokenTableClass Table;
+};
+
+/**
+ * Checks the file for syntax errors with ParserClass::LintFile()
+ */
+class LintBenchmarkClass : public BenchmarkClass {
+
+public:
+
+	LintBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType);
+
+	bool RunFile(const std::string& file);
+
+private:
+
+	pelet::ParserClass Parser;
+};
+
+/**
+ * An observer that does nothing; it is used so that the parser builds all 
+ * of the artifacts that would be given to a real observer.
+ */
+class NullObserverClass : 
+	public pelet::ClassObserverClass, 
+	public pelet::ClassMemberObserverClass, 
+	public pelet::FunctionObserverClass, 
+	public pelet::VariableObserverClass,
+	public pelet::ExpressionObserverClass {
+
+};
+
+/**
+ * The ways that ScanBenchmarkClass sets up the parser. Each one is reported under
+ * its own name.
+ */
+enum ScanModes {
+
+	/**
+	 * scan-resources: only the class, class member and function observers are set
+	 */
+	SCAN_RESOURCES,
+
+	/**
+	 * scan-full: the variable and expression observers are also set
+	 */
+	SCAN_FULL,
+
+	/**
+	 * scan-pipeline: like scan-resources, in pipeline mode. Files that are large
+	 * enough are lexed on a second thread while they are parsed, smaller files are
+	 * parsed the usual way. Compare with scan-resources on multi-megabyte files to
+	 * see the speedup, and on small files to see that nothing is lost.
+	 */
+	SCAN_PIPELINE,
+
+	/**
+	 * scan-full-pipeline: like scan-full, in pipeline mode
+	 */
+	SCAN_FULL_PIPELINE,
+
+	/**
+	 * scan-session: like scan-resources, in session mode; the lexer buffers and the
+	 * AST memory are kept between files
+	 */
+	SCAN_SESSION,
+
+	/**
+	 * scan-outline: like scan-resources, in outline mode; function bodies are skipped
+	 */
+	SCAN_OUTLINE,
+
+	/**
+	 * scan-declarations: like scan-resources, using the hand-written declaration 
+	 * scanner instead of the resource parser
+	 */
+	SCAN_DECLARATIONS,
+
+	/**
+	 * scan-lazy: like scan-full, in lazy body mode; function bodies are skipped and
+	 * only their locations are recorded
+	 */
+	SCAN_LAZY
+};
+
+/**
+ * Parses the file with ParserClass::ScanFile(), with the parser set up for one
+ * of the ScanModes.
+ */
+class ScanBenchmarkClass : public BenchmarkClass {
+
+public:
+
+	ScanBenchmarkClass(pelet::Versions version, pelet::FileBufferTypes bufferType, ScanModes mode);
+
+	bool RunFile(const std::string& file);
+
+private:
+
+	pelet::ParserClass Parser;
+
+	NullObserverClass Observer;
+};
+
+/**
+ * Parses the file with SplitFileParserClass; large files are split at the top-level
+ * declarations and the pieces are parsed on one thread per processor. Only the 
+ * class, class member and function observers are set; compare with scan-resources.
+ */
+class SplitScanBenchmarkClass : public BenchmarkClass {
+
+public:
+
+	SplitScanBenchmarkClass(pelet::Versions version);
+
+	bool RunFile(const std::string& file);
+
+private:
+
+	pelet::SplitFileParserClass Parser;
+
+	NullObserverClass Observer;
+};
+
+/**
+ * Measures the latency of ParserClass::ParseExpression() on the kind of expressions
+ * that an editor sends while the user types. The corpus is not used; a result's
+ * Files is the number of expressions parsed and AllocationsPerFile is the
+ * number of allocations per expression.
+ */
+class ExpressionBenchmarkClass {
+
+public:
+
+	/**
+	 * the name that the benchmark is reported as
+	 */
+	std::string Name;
+
+	/**
+	 * @param chain if TRUE, the expression chain parser is used; if FALSE
+	 *        every expression goes through the full grammar
+	 */
+	ExpressionBenchmarkClass(pelet::Versions version, bool chain);
+
+	/**
+	 * @param count the number of expressions to parse in each iteration
+	 * @param iterations the number of times that the expressions are parsed; the
+	 *        fastest time is reported
+	 * @param result the measurements will be written here. Name, Buffer and Version 
+	 *        are not touched.
+	 */
+	void Run(int count, int iterations, AllocationCounterClass& counter, BenchmarkResultClass& result);
+
+private:
+
+	pelet::ParserClass Parser;
+
+	std::vector<UnicodeString> Expressions;
+};
+
+/**
+ * Runs a benchmark over the entire corpus a number of times and takes the
+ * fastest run.
+ */
+class BenchmarkRunnerClass {
+
+public:
+
+	BenchmarkRunnerClass(const std::vector<CorpusFileClass>& corpus, AllocationCounterClass& counter);
+
+	/**
+	 * @param iterations the number of times that the corpus is processed
+	 */
+	void SetIterations(int iterations);
+
+	/**
+	 * @param benchmark the benchmark to run
+	 * @param result the measurements will be written here. Name, Buffer and Version 
+	 *        are not touched.
+	 */
+	void Run(BenchmarkClass& benchmark, BenchmarkResultClass& result);
+
+private:
+
+	const std::vector<CorpusFileClass>& Corpus;
+
+	AllocationCounterClass& Counter;
+
+	int Iterations;
+};
+
+/**
+ * @return double a monotonic time, in seconds
+ */
+double BenchmarkSeconds();
+
+/**
+ * @return long the peak resident memory of this process, in kilobytes
+ */
+long PeakRssKilobytes();
+
+#endif
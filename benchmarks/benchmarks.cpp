@@ -0,0 +1,487 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <BenchmarkClass.h>
+#include <pelet/ProjectScannerClass.h>
+#include <unicode/uclean.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+
+/**
+ * This program measures the throughput of the lexer and of the parsers. Usage:
+ *
+ *   benchmarks [options] [file or directory ...]
+ *
+ * Each given directory is searched recursively for *.php files. Unless disabled, a set of
+ * synthetic files is generated and added to the corpus; this way the benchmarks can always
+ * be compared across releases even when no real-world code is given.
+ *
+ * Options:
+ *   --format=text|csv|json    the output format, csv and json are meant to be read by scripts
+ *   --iterations=N            process the corpus N times and report the fastest run (default 3)
+ *   --version=5.3|5.4         the PHP version to lex and parse (default 5.4)
+ *   --buffer=streaming|mapped|utf8|all   the file buffers to use (default all)
+ *   --synthetic-files=N       the number of synthetic files to generate, 0 to disable (default 10)
+ *   --synthetic-kb=N          the approximate size of each synthetic file (default 200)
+ *   --expressions=N           the number of expressions to parse in the expression benchmarks,
+ *                             0 to disable (default 10000)
+ *
+ * Each benchmark (lex, lint, scan-resources, scan-pipeline, scan-session, scan-outline, scan-declarations, 
+ * scan-full, scan-full-pipeline, scan-lazy) is run once for each buffer, so that the 
+ * buffers can be compared. scan-split always reads the entire file into memory, it is run once. 
+ * The pipeline benchmarks only use a second thread for files of 512 KB or more, give a larger
+ * --synthetic-kb to see their speedup. The expression benchmarks
+ * (expr-chain, expr-grammar) parse editor-style expressions with ParserClass::ParseExpression()
+ * instead of the corpus; their files column is the number of expressions, and the text
+ * format also reports their latency in microseconds per expression.
+ */
+
+/**
+ * The command line options
+ */
+class OptionsClass {
+
+public:
+
+	std::vector<std::string> Paths;
+
+	std::string Format;
+
+	std::vector<pelet::FileBufferTypes> Buffers;
+
+	pelet::Versions Version;
+
+	int Iterations;
+
+	int SyntheticFiles;
+
+	int SyntheticKilobytes;
+
+	int Expressions;
+
+	OptionsClass();
+
+	/**
+	 * @return bool FALSE if an option is not valid
+	 */
+	bool Parse(int argc, char** argv);
+};
+
+OptionsClass::OptionsClass()
+	: Paths()
+	, Format("text")
+	, Buffers()
+	, Version(pelet::PHP_54)
+	, Iterations(3)
+	, SyntheticFiles(10)
+	, SyntheticKilobytes(200)
+	, Expressions(10000) {
+}
+
+/**
+ * @return bool TRUE if arg starts with the given option name; value will be set
+ *         to the rest of the argument.
+ */
+static bool IsOption(const char* arg, const char* name, std::string& value) {
+	size_t len = strlen(name);
+	if (strncmp(arg, name, len) == 0) {
+		value = arg + len;
+		return true;
+	}
+	return false;
+}
+
+bool OptionsClass::Parse(int argc, char** argv) {
+	std::string buffer = "all";
+	for (int i = 1; i < argc; ++i) {
+		std::string value;
+		if (IsOption(argv[i], "--format=", value)) {
+			if (value != "text" && value != "csv" && value != "json") {
+				return false;
+			}
+			Format = value;
+		}
+		else if (IsOption(argv[i], "--iterations=", value)) {
+			Iterations = atoi(value.c_str());
+		}
+		else if (IsOption(argv[i], "--version=", value)) {
+			if (value == "5.3") {
+				Version = pelet::PHP_53;
+			}
+			else if (value == "5.4") {
+				Version = pelet::PHP_54;
+			}
+			else {
+				return false;
+			}
+		}
+		else if (IsOption(argv[i], "--buffer=", value)) {
+			buffer = value;
+		}
+		else if (IsOption(argv[i], "--synthetic-files=", value)) {
+			SyntheticFiles = atoi(value.c_str());
+		}
+		else if (IsOption(argv[i], "--synthetic-kb=", value)) {
+			SyntheticKilobytes = atoi(value.c_str());
+		}
+		else if (IsOption(argv[i], "--expressions=", value)) {
+			Expressions = atoi(value.c_str());
+		}
+		else if (strncmp(argv[i], "--", 2) == 0) {
+			return false;
+		}
+		else {
+			Paths.push_back(argv[i]);
+		}
+	}
+	if (buffer == "streaming" || buffer == "all") {
+		Buffers.push_back(pelet::STREAMING_FILE_BUFFER);
+	}
+	if (buffer == "mapped" || buffer == "all") {
+		Buffers.push_back(pelet::MAPPED_UTF8_FILE_BUFFER);
+	}
+	if (buffer == "utf8" || buffer == "all") {
+		Buffers.push_back(pelet::UTF8_FILE_BUFFER);
+	}
+	return !Buffers.empty() && Iterations > 0 && SyntheticFiles >= 0 && SyntheticKilobytes > 0
+		&& Expressions >= 0;
+}
+
+static const char* BufferName(pelet::FileBufferTypes type) {
+	if (pelet::MAPPED_UTF8_FILE_BUFFER == type) {
+		return "mapped";
+	}
+	else if (pelet::UTF8_FILE_BUFFER == type) {
+		return "utf8";
+	}
+	return "streaming";
+}
+
+/**
+ * Writes one "unit" of synthetic code: a class with properties, methods,
+ * control structures, strings, heredocs, closures and comments, followed by a function
+ * and some inline HTML. Only PHP 5.3 syntax is used so that all versions can parse it.
+ */
+static void SyntheticUnit(std::ostringstream& code, int fileIndex, int unit) {
+	code << "/**\n"
+		<< " * Synthetic class " << unit << " of file " << fileIndex << "\n"
+		<< " * @author benchmarks\n"
+		<< " */\n"
+		<< "class Synthetic_" << fileIndex << "_" << unit << " extends ArrayObject implements Countable {\n"
+		<< "\tconst LIMIT = " << (unit * 7) << ";\n"
+		<< "\tprivate $name = 'synthetic';\n"
+		<< "\tprotected $items = array(1, 2.5, 'three', \"four\", null, true);\n"
+		<< "\tpublic static $instances = 0;\n\n"
+		<< "\t/** @return string */\n"
+		<< "\tpublic function getName($prefix = '', array $options = array()) {\n"
+		<< "\t\t$result = $prefix . $this->name . \"_{$this->name}_$prefix\";\n"
+		<< "\t\tforeach ($options as $key => $value) {\n"
+		<< "\t\t\tif (is_string($value) && strlen($value) > self::LIMIT) {\n"
+		<< "\t\t\t\t$result .= substr($value, 0, self::LIMIT) . '...';\n"
+		<< "\t\t\t} elseif ($key % 2 == 0) {\n"
+		<< "\t\t\t\t$result .= sprintf('%s=%d', $key, (int)$value);\n"
+		<< "\t\t\t} else {\n"
+		<< "\t\t\t\t$result = str_replace(array('a', 'b'), array('c', 'd'), $result);\n"
+		<< "\t\t\t}\n"
+		<< "\t\t}\n"
+		<< "\t\treturn $result;\n"
+		<< "\t}\n\n"
+		<< "\tpublic function count() {\n"
+		<< "\t\t// line comment\n"
+		<< "\t\t$total = 0;\n"
+		<< "\t\tfor ($i = 0; $i < count($this->items); $i++) {\n"
+		<< "\t\t\t$total += isset($this->items[$i]) ? 1 : 0;\n"
+		<< "\t\t}\n"
+		<< "\t\t$filter = function($item) use ($total) {\n"
+		<< "\t\t\treturn $item !== null && $total > 0;\n"
+		<< "\t\t};\n"
+		<< "\t\treturn count(array_filter($this->items, $filter)) + self::$instances;\n"
+		<< "\t}\n\n"
+		<< "\tprotected function render() {\n"
+		<< "\t\t$html = <<<EOT\n"
+		<< "<div class=\"{$this->name}\">\n"
+		<< "  <span>$this->name</span>\n"
+		<< "</div>\n"
+		<< "EOT;\n"
+		<< "\t\ttry {\n"
+		<< "\t\t\t$object = new Synthetic_" << fileIndex << "_" << unit << "();\n"
+		<< "\t\t\t$object->getName('x', array('key' => $html));\n"
+		<< "\t\t} catch (Exception $e) {\n"
+		<< "\t\t\tthrow new RuntimeException($e->getMessage(), 0);\n"
+		<< "\t\t}\n"
+		<< "\t\tswitch ($this->name) {\n"
+		<< "\t\t\tcase 'a': return 1;\n"
+		<< "\t\t\tdefault: return $html;\n"
+		<< "\t\t}\n"
+		<< "\t}\n"
+		<< "}\n\n"
+		<< "function synthetic_" << fileIndex << "_" << unit << "($a, &$b, $c = null) {\n"
+		<< "\tglobal $config;\n"
+		<< "\tstatic $calls = 0;\n"
+		<< "\t$calls++;\n"
+		<< "\t$b = $a * 2 + ($c ? $c : 1) - $calls / 3;\n"
+		<< "\tlist($x, $y) = array($a, $b);\n"
+		<< "\treturn $x instanceof Countable ? $x->count() : $y;\n"
+		<< "}\n"
+		<< "?>\n"
+		<< "<p>Inline HTML <?php echo synthetic_" << fileIndex << "_" << unit << "(1, $z); ?></p>\n"
+		<< "<?php\n\n";
+}
+
+/**
+ * Creates the synthetic files in the current directory.
+ */
+static bool CreateSyntheticFiles(const OptionsClass& options, std::vector<std::string>& files) {
+	for (int i = 0; i < options.SyntheticFiles; ++i) {
+		std::ostringstream code;
+		code << "<?php\n\n";
+		long target = options.SyntheticKilobytes * 1024L;
+		for (int unit = 0; (long)code.tellp() < target; ++unit) {
+			SyntheticUnit(code, i, unit);
+		}
+		std::ostringstream name;
+		name << "benchmark_synthetic_" << i << ".php";
+		std::ofstream file;
+		file.open(name.str().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			return false;
+		}
+		file << code.str();
+		file.close();
+		files.push_back(name.str());
+	}
+	return true;
+}
+
+/**
+ * Fills in the size and token count of each file. Files that cannot be read are
+ * not added to the corpus.
+ */
+static void BuildCorpus(const std::vector<std::string>& files, pelet::Versions version, std::vector<CorpusFileClass>& corpus) {
+	pelet::LexicalAnalyzerClass lexer;
+	lexer.SetVersion(version);
+	for (size_t i = 0; i < files.size(); ++i) {
+		FILE* fp = fopen(files[i].c_str(), "rb");
+		if (!fp) {
+			continue;
+		}
+		fseek(fp, 0, SEEK_END);
+		CorpusFileClass corpusFile;
+		corpusFile.Name = files[i];
+		corpusFile.Bytes = ftell(fp);
+		fclose(fp);
+		if (!lexer.OpenFile(files[i])) {
+			continue;
+		}
+		int token = 0;
+		do {
+			token = lexer.NextToken();
+			corpusFile.Tokens++;
+		} while (!pelet::IsTerminatingToken(token));
+		lexer.Close();
+		corpus.push_back(corpusFile);
+	}
+}
+
+static void PrintText(const std::vector<BenchmarkResultClass>& results) {
+	printf("%-18s %-10s %-4s %6s %6s %10s %12s %10s %14s %12s\n", "benchmark", "buffer", "php", 
+		"files", "errors", "seconds", "MB/s", "Mtokens/s", "allocs/file", "peak RSS KB");
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchmarkResultClass& result = results[i];
+		printf("%-18s %-10s %-4s %6d %6d %10.4f %12.2f %10.2f %14.1f %12ld\n", result.Name.c_str(),
+			result.Buffer.c_str(), result.Version.c_str(), result.Files, result.Errors, result.Seconds, 
+			result.MegabytesPerSecond(), result.TokensPerSecond() / 1000000.0, result.AllocationsPerFile,
+			result.PeakRssKilobytes);
+	}
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchmarkResultClass& result = results[i];
+		if (result.Name.compare(0, 5, "expr-") == 0 && result.Files > 0) {
+			printf("%s: %.2f microseconds per expression\n", result.Name.c_str(), 
+				result.Seconds * 1000000.0 / result.Files);
+		}
+	}
+}
+
+static void PrintCsv(const std::vector<BenchmarkResultClass>& results) {
+	printf("benchmark,buffer,version,files,errors,bytes,tokens,seconds,mb_per_second,tokens_per_second,allocations_per_file,peak_rss_kb\n");
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchmarkResultClass& result = results[i];
+		printf("%s,%s,%s,%d,%d,%lld,%lld,%.6f,%.3f,%.0f,%.1f,%ld\n", result.Name.c_str(),
+			result.Buffer.c_str(), result.Version.c_str(), result.Files, result.Errors, result.Bytes, 
+			result.Tokens, result.Seconds, result.MegabytesPerSecond(), result.TokensPerSecond(), 
+			result.AllocationsPerFile, result.PeakRssKilobytes);
+	}
+}
+
+static void PrintJson(const std::vector<BenchmarkResultClass>& results) {
+	printf("[\n");
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchmarkResultClass& result = results[i];
+		printf("  {\"benchmark\": \"%s\", \"buffer\": \"%s\", \"version\": \"%s\", \"files\": %d, \"errors\": %d, "
+			"\"bytes\": %lld, \"tokens\": %lld, \"seconds\": %.6f, \"mb_per_second\": %.3f, "
+			"\"tokens_per_second\": %.0f, \"allocations_per_file\": %.1f, \"peak_rss_kb\": %ld}%s\n",
+			result.Name.c_str(), result.Buffer.c_str(), result.Version.c_str(), result.Files, result.Errors, 
+			result.Bytes, result.Tokens, result.Seconds, result.MegabytesPerSecond(), result.TokensPerSecond(), 
+			result.AllocationsPerFile, result.PeakRssKilobytes, (i + 1) < results.size() ? "," : "");
+	}
+	printf("]\n");
+}
+
+static void RunBenchmark(BenchmarkRunnerClass& runner, BenchmarkClass& benchmark, const char* buffer, 
+		const OptionsClass& options, std::vector<BenchmarkResultClass>& results) {
+	BenchmarkResultClass result;
+	result.Name = benchmark.Name;
+	result.Buffer = buffer;
+	result.Version = pelet::PHP_53 == options.Version ? "5.3" : "5.4";
+	runner.Run(benchmark, result);
+	results.push_back(result);
+}
+
+int main(int argc, char** argv) {
+
+	// the counter must be installed before ICU is used
+	AllocationCounterClass counter;
+	if (!counter.Install()) {
+		fprintf(stderr, "ICU allocations will not be counted\n");
+	}
+	OptionsClass options;
+	if (!options.Parse(argc, argv)) {
+		fprintf(stderr, "usage: %s [--format=text|csv|json] [--iterations=N] [--version=5.3|5.4] "
+			"[--buffer=streaming|mapped|utf8|all] [--synthetic-files=N] [--synthetic-kb=N] [--expressions=N] "
+			"[file or directory ...]\n", argv[0]);
+		return 2;
+	}
+	std::vector<std::string> synthetic;
+	if (!CreateSyntheticFiles(options, synthetic)) {
+		fprintf(stderr, "could not create the synthetic files\n");
+		return 1;
+	}
+	pelet::ProjectScannerClass scanner;
+	std::vector<std::string> extensions;
+	extensions.push_back("php");
+	for (size_t i = 0; i < synthetic.size(); ++i) {
+		scanner.AddFile(synthetic[i]);
+	}
+	for (size_t i = 0; i < options.Paths.size(); ++i) {
+		if (scanner.AddDirectory(options.Paths[i], extensions) == 0) {
+			scanner.AddFile(options.Paths[i]);
+		}
+	}
+	std::vector<CorpusFileClass> corpus;
+	BuildCorpus(scanner.GetFiles(), options.Version, corpus);
+	if (corpus.empty()) {
+		fprintf(stderr, "no files to benchmark\n");
+		return 1;
+	}
+	
+	BenchmarkRunnerClass runner(corpus, counter);
+	runner.SetIterations(options.Iterations);
+	std::vector<BenchmarkResultClass> results;
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		LexerBenchmarkClass lexer(options.Version, type);
+		RunBenchmark(runner, lexer, BufferName(type), options, results);
+	}
+	TokenizeBenchmarkClass tokenize(options.Version);
+	RunBenchmark(runner, tokenize, BufferName(pelet::MAPPED_UTF8_FILE_BUFFER), options, results);
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		LintBenchmarkClass lint(options.Version, type);
+		RunBenchmark(runner, lint, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass scan(options.Version, type, SCAN_RESOURCES);
+		RunBenchmark(runner, scan, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass pipeline(options.Version, type, SCAN_PIPELINE);
+		RunBenchmark(runner, pipeline, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass session(options.Version, type, SCAN_SESSION);
+		RunBenchmark(runner, session, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass outline(options.Version, type, SCAN_OUTLINE);
+		RunBenchmark(runner, outline, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass declarations(options.Version, type, SCAN_DECLARATIONS);
+		RunBenchmark(runner, declarations, BufferName(type), options, results);
+	}
+	SplitScanBenchmarkClass split(options.Version);
+	RunBenchmark(runner, split, BufferName(pelet::MAPPED_UTF8_FILE_BUFFER), options, results);
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass scan(options.Version, type, SCAN_FULL);
+		RunBenchmark(runner, scan, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass pipeline(options.Version, type, SCAN_FULL_PIPELINE);
+		RunBenchmark(runner, pipeline, BufferName(type), options, results);
+	}
+	for (size_t i = 0; i < options.Buffers.size(); ++i) {
+		pelet::FileBufferTypes type = options.Buffers[i];
+		ScanBenchmarkClass lazy(options.Version, type, SCAN_LAZY);
+		RunBenchmark(runner, lazy, BufferName(type), options, results);
+	}
+	if (options.Expressions > 0) {
+		for (int chain = 1; chain >= 0; --chain) {
+			ExpressionBenchmarkClass expressions(options.Version, chain == 1);
+			BenchmarkResultClass result;
+			result.Name = expressions.Name;
+			result.Buffer = "string";
+			result.Version = pelet::PHP_53 == options.Version ? "5.3" : "5.4";
+			expressions.Run(options.Expressions, options.Iterations, counter, result);
+			results.push_back(result);
+		}
+	}
+
+	if (options.Format == "csv") {
+		PrintCsv(results);
+	}
+	else if (options.Format == "json") {
+		PrintJson(results);
+	}
+	else {
+		printf("corpus: %d files (%d synthetic)\n", (int)corpus.size(), (int)synthetic.size());
+		PrintText(results);
+	}
+	for (size_t i = 0; i < synthetic.size(); ++i) {
+		remove(synthetic[i].c_str());
+	}
+	
+	// so that the allocation counter is not used after it goes out of scope
+	u_cleanup();
+	return 0;
+}
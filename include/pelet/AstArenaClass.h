@@ -0,0 +1,182 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_ASTARENACLASS_H__
+#define __PELET_ASTARENACLASS_H__
+
+#include <pelet/Api.h>
+#include <vector>
+#include <stddef.h>
+
+namespace pelet {
+
+class AstItemClass;
+
+/**
+ * A bump allocator for the AST nodes that the full parser creates. Nodes are 
+ * carved out of large memory blocks instead of being individually allocated 
+ * on the heap; this makes creating nodes much cheaper and lays out the nodes
+ * of a single file contiguously.
+ *
+ * Usage: allocate a node with the placement new operator defined in AstItemClass,
+ * then give it to Adopt() so that its destructor gets called on Reset().
+ *
+ * @code
+ *   pelet::AstArenaClass arena;
+ *   pelet::VariableClass* var = new (arena) pelet::VariableClass(scope);
+ *   arena.Adopt(var);
+ *   ...
+ *   arena.Reset();
+ * @endcode
+ *
+ * AST nodes still hold ICU strings and vectors, so Reset() still needs to run each
+ * node's destructor; but the node memory itself is released all at once and the
+ * blocks are kept around so that the next file parsed re-uses them without
+ * touching the heap.
+ *
+ * This class is not thread-safe.
+ */
+class PELET_API AstArenaClass {
+
+public:
+
+	/**
+	 * @param blockSize the size, in bytes, of each memory block. Allocations larger
+	 *        than the block size get a block of their own.
+	 */
+	AstArenaClass(size_t blockSize = 64 * 1024);
+
+	/**
+	 * calls Release()
+	 */
+	~AstArenaClass();
+
+	/**
+	 * @return a pointer to size bytes of memory that is suitably aligned for any AST node.
+	 *         The memory is owned by this arena, do NOT delete it.
+	 */
+	void* Allocate(size_t size);
+
+	/**
+	 * Take ownership of the given item. The item may either have been allocated in this
+	 * arena (via the placement new operator) or on the heap (via regular new). On Reset(),
+	 * arena items get their destructor called and heap items get deleted.
+	 *
+	 * @param item the item to own.
+	 */
+	void Adopt(pelet::AstItemClass* item);
+
+	/**
+	 * @return TRUE if the given pointer lies inside one of this arena's memory blocks
+	 */
+	bool Contains(const void* ptr) const;
+
+	/**
+	 * Destroys all of the adopted items and rewinds the arena so that its memory is re-used
+	 * by the next allocations. Memory blocks are NOT released; any pointers returned by 
+	 * Allocate() are no longer valid after a call to this method.
+	 */
+	void Reset();
+
+	/**
+	 * Destroys all of the adopted items and frees all memory blocks.
+	 */
+	void Release();
+
+	/**
+	 * Exchanges the contents (items and memory blocks) of this arena with the given arena.
+	 * This is a constant time operation and is used to transfer ownership of an entire AST 
+	 * without copying it.
+	 */
+	void Swap(pelet::AstArenaClass& other);
+
+	/**
+	 * @return the number of items that are currently owned by this arena
+	 */
+	size_t ItemCount() const;
+
+	/**
+	 * @return the number of bytes handed out by Allocate() since the last Reset()
+	 */
+	size_t BytesUsed() const;
+
+	/**
+	 * @return the total number of bytes held by this arena's memory blocks
+	 */
+	size_t Capacity() const;
+
+private:
+
+	/**
+	 * disable copying, an arena cannot be shared.
+	 */
+	AstArenaClass(const AstArenaClass& other);
+
+	AstArenaClass& operator=(const AstArenaClass& other);
+
+	/**
+	 * the memory blocks; the arena owns these pointers
+	 */
+	std::vector<char*> Blocks;
+
+	/**
+	 * the size of each of the memory blocks; parallel to Blocks
+	 */
+	std::vector<size_t> BlockSizes;
+
+	/**
+	 * items that were allocated in this arena; their destructors will be called
+	 * but they will not be deleted
+	 */
+	std::vector<pelet::AstItemClass*> ArenaItems;
+
+	/**
+	 * items that were allocated on the heap; these will be deleted
+	 */
+	std::vector<pelet::AstItemClass*> HeapItems;
+
+	/**
+	 * the default size of new blocks
+	 */
+	size_t BlockSize;
+
+	/**
+	 * the index into Blocks where the next allocation will be attempted
+	 */
+	size_t CurrentBlock;
+
+	/**
+	 * the offset into the current block where the next allocation will be made
+	 */
+	size_t Offset;
+
+	/**
+	 * the number of bytes handed out since the last reset
+	 */
+	size_t Used;
+};
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_BODYWATCHERCLASS_H__
+#define __PELET_BODYWATCHERCLASS_H__
+
+#include <pelet/LexicalAnalyzerClass.h>
+
+namespace pelet {
+
+/**
+ * Looks at the tokens that are given to a parser in order to find the opening
+ * brace of a function body, so that the body can be skipped over instead of 
+ * being parsed. The watcher looks for 'function [&] [name] (params) [use (vars)] {'.
+ */
+class BodyWatcherClass {
+
+public:
+
+	/**
+	 * If TRUE, then only the bodies of named functions and methods are found; 
+	 * closure bodies are not. The default is FALSE.
+	 */
+	bool IsNamedOnly;
+
+	BodyWatcherClass();
+
+	/**
+	 * @param token the token that will be given to the parser
+	 */
+	void Watch(int token);
+
+	/**
+	 * @return bool TRUE if the last token given to the parser was the opening
+	 *         brace of a body
+	 */
+	bool IsBodyStart() const;
+
+private:
+
+	/**
+	 * where we are in a function declaration, one of the PELET_BODY_STATE_* values
+	 */
+	int State;
+
+	/**
+	 * the number of unclosed parenthesis in the parameter list or in the closure's 
+	 * lexical variables
+	 */
+	int ParenDepth;
+};
+
+/**
+ * Skips over a function body by matching braces. Strings, heredocs and comments 
+ * are single tokens so the braces inside of them are never counted.
+ *
+ * @param analyzer the lexer, the last token given out must be the opening brace of the body
+ * @param hasCallToFuncGetArg set to TRUE if the body has a call to func_get_arg or
+ *        func_get_args; left alone otherwise
+ * @return int the closing brace of the body, or a terminating token if the body is
+ *         not closed
+ */
+int SkipBody(pelet::LexicalAnalyzerClass& analyzer, bool& hasCallToFuncGetArg);
+
+}
+
+#endif
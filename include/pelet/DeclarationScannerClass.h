@@ -0,0 +1,297 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_DECLARATIONSCANNERCLASS_H__
+#define __PELET_DECLARATIONSCANNERCLASS_H__
+
+#include <pelet/ResourceParserObserverClass.h>
+#include <pelet/LexicalAnalyzerClass.h>
+
+namespace pelet {
+
+/**
+ * A hand-written alternative to the bison resource parsers. The scanner reads the
+ * token stream directly and builds the same AST items as the resource grammar (using
+ * the same ResourceParserObserverClass), so the observers get the same callbacks in
+ * the same order: namespaces, uses, classes / interfaces / traits and their members, 
+ * functions, define() calls, includes and the properties assigned via "$this->".
+ *
+ * Statements are recognized with a small recursive descent parser that only keeps
+ * track of the values that the resource grammar keeps track of; it does not check 
+ * operator precedence and it accepts some code that PHP does not (ie. a trailing
+ * comma in a function call).
+ */
+class DeclarationScannerClass {
+
+public:
+
+	/**
+	 * This object will NOT own the analyzer or the observers.
+	 * The analyzer must have been opened already.
+	 */
+	DeclarationScannerClass(pelet::LexicalAnalyzerClass& analyzer, pelet::ResourceParserObserverClass& observers);
+
+	/**
+	 * Scan the entire source and notify the observers.
+	 * 
+	 * @return bool TRUE if the source was scanned; FALSE if the source has a syntax error. 
+	 *         In this case the analyzer's ParserError is set and the observers are 
+	 *         not notified.
+	 */
+	bool Scan();
+
+private:
+
+	/**
+	 * advance to the next token, skipping open tags and comments like ResourceLex() does.
+	 */
+	void Next();
+
+	/**
+	 * advance past the current token, but only if it is the given token
+	 */
+	bool Expect(int token);
+
+	/**
+	 * @return the current token as a semantic value, along with the PHPDoc comment
+	 *         that came right before it. The observers own the returned pointer.
+	 */
+	pelet::SemanticValueClass* MakeLexeme();
+
+	void MakeToken(pelet::TokenPositionClass& token);
+
+	/**
+	 * sets the analyzer's error to the current token; only the first error is kept
+	 *
+	 * @return bool always FALSE
+	 */
+	bool Error();
+
+	/**
+	 * scans statements until the end of the source (when isBlock is FALSE) or until the
+	 * brace that closes a namespace block. namespace, use, and const statements are
+	 * allowed here.
+	 */
+	bool TopStatements(pelet::StatementListClass* statements, bool isBlock);
+
+	/**
+	 * scans statements until a closing brace, a case, or the keyword that ends an 
+	 * alternative syntax block (ie. endif)
+	 */
+	bool InnerStatements(pelet::StatementListClass* statements);
+
+	bool TopStatement(pelet::StatementListClass* statements);
+
+	bool Statement(pelet::StatementListClass* statements);
+
+	/**
+	 * the statement of a control structure; either a single statement or the alternative
+	 * syntax ':' statements endToken ';'
+	 */
+	bool ControlStatement(pelet::StatementListClass* statements, int endToken);
+
+	bool If(pelet::StatementListClass* statements);
+
+	bool Switch(pelet::StatementListClass* statements);
+
+	bool Try(pelet::StatementListClass* statements);
+
+	bool Namespace(pelet::StatementListClass* statements);
+
+	bool UseDeclarations(pelet::StatementListClass* statements);
+
+	bool ConstantDeclarations(pelet::StatementListClass* statements);
+
+	/**
+	 * the current token is the function name
+	 */
+	bool FunctionDeclaration(pelet::StatementListClass* statements, pelet::SemanticValueClass* functionValue, 
+		bool isReference);
+
+	/**
+	 * the current token is the opening parenthesis of the closure parameters
+	 */
+	bool Closure();
+
+	/**
+	 * scans a function body; the current token is the opening brace. When the observers
+	 * are told to skip bodies, the body is skipped with SkipBody().
+	 *
+	 * @param closeToken will be set to the closing brace, which is left as the current token
+	 */
+	bool Body(pelet::StatementListClass* statements, pelet::TokenPositionClass& closeToken);
+
+	bool ClassDeclaration(pelet::StatementListClass* statements);
+
+	bool InterfaceList(pelet::ClassSymbolClass*& interfaces);
+
+	bool ClassStatements(pelet::StatementListClass* statements);
+
+	bool ClassMember(pelet::StatementListClass* statements);
+
+	bool Method(pelet::StatementListClass* statements, pelet::ClassMemberSymbolClass* modifiers);
+
+	bool Properties(pelet::StatementListClass* statements, pelet::ClassMemberSymbolClass* modifiers);
+
+	bool ClassConstants(pelet::StatementListClass* statements);
+
+	bool TraitUse(pelet::StatementListClass* statements);
+
+	bool TraitAdaptation(pelet::StatementListClass* statements);
+
+	/**
+	 * parses the parameters of a function; the current token is the opening parenthesis
+	 * 
+	 * @param parameters will be set to the parameters, NULL if there are no parameters
+	 */
+	bool Parameters(pelet::ParametersListClass*& parameters);
+
+	/**
+	 * @param firstValue the first part of the name, which has already been consumed
+	 * @return the rest of the namespace name; NULL on a syntax error
+	 */
+	pelet::QualifiedNameClass* NamespaceName(pelet::SemanticValueClass* firstValue);
+
+	/**
+	 * @return the name at the current token (a namespace name, an absolute name, or 
+	 *         a name relative to the current namespace); NULL on a syntax error
+	 */
+	pelet::QualifiedNameClass* FullyQualifiedName();
+
+	/**
+	 * skips over a default value, ie. the value of a constant or a parameter.
+	 *
+	 * @return the line number that the resource grammar would have given to the
+	 *         declaration that has this value
+	 */
+	int SkipStaticScalar();
+
+	/**
+	 * The expression functions set value to the "value" of the expression, the one 
+	 * that the resource grammar propagates: a define() call, an include, a property
+	 * of "$this", or a scalar (only while scalars are being captured). All other
+	 * expressions have a NULL value.
+	 */
+	bool Expression(pelet::StatementClass*& value);
+
+	/**
+	 * an expression without the low precedence logical operators (and, or, xor)
+	 */
+	bool AssignmentExpression(pelet::StatementClass*& value);
+
+	/**
+	 * the assignments and operators after the first term of an expression
+	 */
+	bool Operators(pelet::StatementClass*& value, bool isVariable);
+
+	/**
+	 * the logical operators after an assignment expression
+	 */
+	bool LogicalOperators(pelet::StatementClass*& value);
+
+	/**
+	 * @param isVariable set to TRUE if the term can be assigned to
+	 */
+	bool Term(pelet::StatementClass*& value, bool& isVariable);
+
+	bool Variable(pelet::StatementClass*& value, bool& isVariable);
+
+	/**
+	 * @param isRelative TRUE if the namespace keyword was consumed, ie. "namespace\name"
+	 */
+	bool Name(pelet::StatementClass*& value, bool& isVariable, bool isRelative);
+
+	/**
+	 * the term after the static keyword; a static closure or a late static binding
+	 */
+	bool Static(pelet::StatementClass*& value, bool& isVariable);
+
+	bool Include(pelet::StatementClass*& value);
+
+	/**
+	 * the current token is '::'
+	 */
+	bool StaticMember(bool& isVariable);
+
+	/**
+	 * skips array accesses, properties and method calls
+	 */
+	bool Chain();
+
+	/**
+	 * skips array accesses of a variable or a property
+	 */
+	bool Dimensions();
+
+	bool PropertyName();
+
+	/**
+	 * skips the class name after new or instanceof
+	 */
+	bool ClassReference();
+
+	/**
+	 * parses function call arguments; the current token is the opening parenthesis
+	 * and the closing parenthesis is left as the current token.
+	 *
+	 * @param arguments the values of the arguments, only when call arguments are 
+	 *        being captured; NULL otherwise
+	 */
+	bool Arguments(pelet::StatementListClass*& arguments);
+
+	/**
+	 * skips over comma-separated expressions until the given token
+	 */
+	bool ExpressionList(int endToken);
+
+	/**
+	 * the current token is the opening token of an array
+	 */
+	bool ArrayPairs(int endToken);
+
+	pelet::LexicalAnalyzerClass& Analyzer;
+
+	pelet::ResourceParserObserverClass& Observers;
+
+	/**
+	 * the PHPDoc comment right before the current token
+	 */
+	UnicodeString Comment;
+
+	/**
+	 * used to look at identifiers without allocating a new string each time
+	 */
+	UnicodeString Lexeme;
+
+	/**
+	 * the current token and the token before it
+	 */
+	int Token;
+
+	int PreviousToken;
+};
+
+}
+
+#endif
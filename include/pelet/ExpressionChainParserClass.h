@@ -0,0 +1,132 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_EXPRESSIONCHAINPARSERCLASS_H__
+#define __PELET_EXPRESSIONCHAINPARSERCLASS_H__
+
+#include <pelet/ParserTypeClass.h>
+#include <pelet/LexicalAnalyzerClass.h>
+
+namespace pelet {
+
+/**
+ * A hand-written parser for the variable "chains" that ParserClass::ParseExpression()
+ * is given during code completion, ie.
+ *
+ *   $this->work()->another
+ *   MyClass::create()->prop
+ *   \First\Second\func()
+ *   (new Foo($a))->method()
+ *
+ * The chain is read straight from the token stream into a VariableClass, no statement
+ * AST is built and no observers are called. The result is the same as what the full
+ * grammar gives ParseExpression(); the arguments of calls and array accesses are 
+ * checked but not kept.
+ *
+ * Only a subset of PHP is handled: variables, properties, method and function calls,
+ * static members, class constants, array accesses and new instances; the call arguments 
+ * can only be scalars or other chains. Anything else (closures, operators, 
+ * "namespace\", "static::", variable variables, syntax errors) is rejected so that 
+ * the caller can fall back to the full grammar, which knows how to handle those.
+ * Operators at the end of the expression ("->", "::", "\") must be removed before 
+ * the expression is given to the lexer.
+ */
+class ExpressionChainParserClass {
+
+public:
+
+	/**
+	 * This object will NOT own the analyzer.
+	 * The analyzer must have been opened already; the code is pure PHP code (no 
+	 * open tag) like in LexicalAnalyzerClass::OpenString()
+	 *
+	 * @param version the PHP version decides whether calls can be dereferenced as arrays
+	 *        and whether new instances can be chained
+	 */
+	ExpressionChainParserClass(pelet::LexicalAnalyzerClass& analyzer, pelet::Versions version);
+
+	/**
+	 * Parse the expression; an optional ';' may end the expression.
+	 *
+	 * @param variable the chain will be appended to this variable. When the expression 
+	 *        is a new instance the variable's ExpressionType is set to NEW_CALL.
+	 * @return bool TRUE if the entire expression was parsed; FALSE if the expression 
+	 *         is not a chain that this parser handles. In this case the contents of 
+	 *         variable should not be used.
+	 */
+	bool Parse(pelet::VariableClass& variable);
+
+private:
+
+	/**
+	 * advance to the next token
+	 */
+	void Next();
+
+	/**
+	 * parses one chain, from its start until the first token that cannot continue it.
+	 *
+	 * @param variable the variable to append the chain to; NULL when the chain is an 
+	 *        argument that is checked but not kept
+	 */
+	bool Chain(pelet::VariableClass* variable);
+
+	/**
+	 * the current token is T_NEW; parses the class name and the constructor arguments
+	 */
+	bool New(pelet::VariableClass* variable);
+
+	/**
+	 * parses a (possibly qualified) name; the current token is T_STRING or T_NS_SEPARATOR.
+	 *
+	 * @param name will be set to the name, but only when isKept is TRUE
+	 */
+	bool Name(UnicodeString& name, bool isKept);
+
+	/**
+	 * the current token is '('; checks the arguments up to and including the closing 
+	 * parenthesis
+	 */
+	bool Arguments();
+
+	/**
+	 * a single call argument or array key: a scalar or a chain
+	 */
+	bool Argument();
+
+	/**
+	 * This object will NOT own the analyzer
+	 */
+	pelet::LexicalAnalyzerClass& Analyzer;
+
+	pelet::Versions Version;
+
+	/**
+	 * the current token
+	 */
+	int Token;
+};
+
+}
+#endif
@@ -29,6 +29,8 @@
 #include <pelet/LexicalAnalyzerClass.h>
 #include <pelet/Api.h>
 #include <pelet/ParserTypeClass.h>
+#include <pelet/AstArenaClass.h>
+#include <pelet/BodyWatcherClass.h>
 #include <unicode/unistr.h>
 
 #include <stack>
@@ -175,6 +177,24 @@ Php53ResourceParser.cpp and Php54ResourceParser.cpp.
 
 The full parser is the slowest, but it gathers all expressions; including local variables and function
 calls. These are defined in Php53FullParser.cpp and Php54FullParser.cpp.
+
+\section ParserImplementationDetailsErrors Error recovery
+The lint and full grammars have rules that use the bison "error" token at the statement and 
+class member level:
+
+@code
+statement:
+		unticked_statement
+	|	T_STRING ':'
+	|	error ';'					{ yyerrok; }
+;
+@endcode
+
+When a syntax error is found, bison discards tokens until the next ';' and then keeps on
+parsing, so that a single pass reports every error (see LexicalAnalyzerClass::ParserErrors)
+and the symbols after an error are still found. The resource grammars do not recover; they
+stop at the first error. Note that the generated parsers must be re-created with bison 
+whenever a grammar file is changed.
 */
 
 
@@ -190,17 +210,47 @@ calls. These are defined in Php53FullParser.cpp and Php54FullParser.cpp.
  * be deleted when ObserverQuadClass goes out of scope.  We do to simplify memory management
  * as the parser (1) may encounter ambigous code, in which case it has to execute rule, "back up"
  * to the previous rule, and execute another rule, or (2) source code  contains a syntax error
+ *
+ * All of the pointers are allocated from an AstArenaClass; the nodes of an entire file 
+ * are laid out in a few large blocks and released together.  When the caller gives an arena
+ * to the constructor, the arena's memory blocks are re-used from one file to the next.
  */
 class PELET_API FullParserObserverClass {
 
 public:
 
+	/**
+	 * If TRUE, then the bodies of functions and methods are not parsed; the lexer
+	 * will skip over them and their locations will be put in Bodies so that they
+	 * can be parsed later. The bodies of closures that are not inside of a 
+	 * function are still parsed. The default is FALSE.
+	 */
+	bool DoSkipBodies;
+
+	/**
+	 * The function and method bodies that were skipped, in the order in which they 
+	 * appear in the source. Only filled when DoSkipBodies is TRUE.
+	 */
+	std::vector<pelet::BodyRangeClass> Bodies;
+
+	/**
+	 * If TRUE, then FullLex() will attach PHPDoc comments to the semantic values. This
+	 * is turned off when none of the observers want comments nor return types (see 
+	 * ClassObserverClass::SymbolFields() and VariableObserverClass::SymbolFields()).
+	 */
+	bool DoCaptureComments;
+
 	/**
 	 * Each observer may be NULL. This class will NOT own the pointers.
+	 * 
+	 * @param arena the arena to allocate AST nodes from. This class will NOT own the 
+	 *        arena; the arena is Reset() when this object goes out of scope, keeping
+	 *        its memory for the next parse. If NULL, this class will
+	 *        create (and own) its own arena.
 	 */
 	FullParserObserverClass(ClassObserverClass* classObserver, ClassMemberObserverClass* memberObserver,
 		FunctionObserverClass* functionObserver, VariableObserverClass* variableObserver, 
-		ExpressionObserverClass* expressionObserver);
+		ExpressionObserverClass* expressionObserver, pelet::AstArenaClass* arena = NULL);
 
 	~FullParserObserverClass();
 
@@ -366,6 +416,67 @@ public:
 	 * useful to get the last good scope when a parse error occurs.
 	 */
 	pelet::ScopeClass CurrentScope();
+
+	/**
+	 * Remembers the current scope if this is the first syntax error. The parser
+	 * recovers from errors, so the scope at the end of parsing may not be the
+	 * scope of the error.
+	 */
+	void ErrorFound();
+
+	/**
+	 * @return Scope where the first syntax error was found, or the current scope 
+	 * if no errors were found.
+	 */
+	pelet::ScopeClass ErrorScope();
+
+	/**
+	 * Prepares this object to parse a single body that was skipped in a previous
+	 * parse. The scope and namespace will be set to the ones of the
+	 * body; once the closing brace of the body is seen FullLex() will return 
+	 * the end token.
+	 */
+	void SetBody(const pelet::BodyRangeClass& body);
+
+	/**
+	 * Looks at a token that will be given to the parser; it is used to find the 
+	 * bodies to skip and to find the end of the body given to SetBody()
+	 *
+	 * @param token the token
+	 * @param pos the position of the token
+	 * @param lineNumber the line of the token
+	 */
+	void WatchToken(int token, int pos, int lineNumber);
+
+	/**
+	 * Looks at an identifier that will be given to the parser; a call to func_get_arg
+	 * or func_get_args marks the current function as having variable arguments. The
+	 * lexemes are checked because the expression observer may not want the function
+	 * calls to be built.
+	 *
+	 * @param lexeme the identifier
+	 */
+	void WatchString(const UnicodeString& lexeme);
+
+	/**
+	 * @return bool TRUE if the parser is at the start of a body that should 
+	 *         be skipped
+	 */
+	bool IsBodyStart() const;
+
+	/**
+	 * @return bool TRUE if the body given to SetBody() has been completely 
+	 *         given to the parser
+	 */
+	bool IsBodyEnd() const;
+
+	/**
+	 * skips the body that the parser is at, and remembers its location in
+	 * Bodies.
+	 *
+	 * @return the token that ended the body (the closing brace)
+	 */
+	int SkipBody(pelet::LexicalAnalyzerClass& analyzer);
 	
 	/**
 	 * run through the class statements and create property declarations based out of
@@ -407,6 +518,19 @@ private:
 	 * This method will recurse down function / method statements.
 	 */
 	void RecurseAst(pelet::StatementListClass* statements);
+
+	/**
+	 * @return the UNKNOWN expression that takes the place of the expressions that
+	 *         no observer wants (see ExpressionObserverClass::ExpressionTypes())
+	 */
+	pelet::ExpressionClass* ExpressionUnknown();
+
+	/**
+	 * disable copying, we own the arena pointer
+	 */
+	FullParserObserverClass(const FullParserObserverClass& other);
+
+	FullParserObserverClass& operator=(const FullParserObserverClass& other);
 	
 	/**
 	 * the class, method, and namespace that are currently being parsed.
@@ -442,11 +566,41 @@ private:
 	 * This object will NOT own the pointer
 	 */
 	ExpressionObserverClass* ExpressionObserver;
+
+	/**
+	 * the SymbolFields wanted by the class, member, and function observers; 0 when
+	 * there is no observer
+	 */
+	int ClassFields;
+
+	int MemberFields;
+
+	int FunctionFields;
+
+	/**
+	 * the ExpressionTypeFlags of the expressions to build; the others are
+	 * replaced by UnknownExpression
+	 */
+	int ExpressionFlags;
+
+	/**
+	 * the UNKNOWN expression that is put in place of all of the expressions that are 
+	 * not built. It is shared, and it is owned by the arena like the other expressions.
+	 */
+	pelet::ExpressionClass* UnknownExpression;
 	
 	/**
-	 * keep track of all ParserTypes to delete them at the end
+	 * all ParserTypes are allocated from and owned by this arena. They get destroyed
+	 * at the end, unless the expression observer takes ownership of them.
+	 * This object will NOT own the pointer, unless it is the same as OwnedArena
+	 */
+	AstArenaClass* Arena;
+
+	/**
+	 * the arena created when the constructor was not given one.
+	 * This object will own the pointer
 	 */
-	std::vector<AstItemClass*> AllAstItems;
+	AstArenaClass* OwnedArena;
 	
 	/**
 	 * -1 scope is not anonymous
@@ -456,6 +610,45 @@ private:
 	 *  3+ ...
 	 */
 	int AnonymousFunctionCount;
+
+	/**
+	 * finds the start of function and method bodies when DoSkipBodies is TRUE
+	 */
+	pelet::BodyWatcherClass BodyWatcher;
+
+	/**
+	 * the position and line of the opening brace of the body that is about to 
+	 * be skipped
+	 */
+	int BodyStartPos;
+	int BodyStartLineNumber;
+
+	/**
+	 * TRUE if the skipped body of the current function has a call to
+	 * func_get_arg or func_get_args. Since the body is not parsed, the body
+	 * statements cannot be checked.
+	 */
+	bool HasCallToFuncGetArg;
+
+	/**
+	 * TRUE when parsing a single body (after SetBody() is called).
+	 */
+	bool IsBodyOnly;
+
+	/**
+	 * the number of unclosed braces in the body given to SetBody()
+	 */
+	int BodyDepth;
+
+	/**
+	 * the scope at the first syntax error
+	 */
+	ScopeClass FirstErrorScope;
+
+	/**
+	 * TRUE if a syntax error was found
+	 */
+	bool HasError;
 };
 
 /**
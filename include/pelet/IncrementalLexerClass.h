@@ -0,0 +1,221 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_INCREMENTALLEXERCLASS_H__
+#define __PELET_INCREMENTALLEXERCLASS_H__
+
+#include <pelet/TokenClass.h>
+#include <pelet/Api.h>
+#include <unicode/unistr.h>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * A token found by the IncrementalLexerClass. The end of each token is also a 
+ * checkpoint: the lexer can be restarted right after any token since the 
+ * position, line and condition are all that the lexer needs.
+ */
+class PELET_API LexedTokenClass {
+
+public:
+
+	/**
+	 * the token ID, one of the pelet::TokenClass::TokenIds or the ASCII value of a symbol
+	 */
+	int Token;
+
+	/**
+	 * the position of the first character of the token; 0-based
+	 */
+	int Start;
+
+	/**
+	 * the position right after the last character of the token. The lexer continues
+	 * from here when it asks for the next token.
+	 */
+	int End;
+
+	/**
+	 * the line that the lexer was on after the token, 1-based. This is the same line 
+	 * number that LexicalAnalyzerClass::GetLineNumber() gives right after NextToken().
+	 */
+	int LineNumber;
+
+	/**
+	 * the condition that the lexer was in after the token.
+	 */
+	YYCONDTYPE EndCondition;
+
+	LexedTokenClass();
+};
+
+/**
+ * The results of an edit
+ */
+class PELET_API RelexResultsClass {
+
+public:
+
+	/**
+	 * index of the first token that was re-lexed
+	 */
+	int FirstToken;
+
+	/**
+	 * the number of tokens, starting at FirstToken, that were removed from the token list
+	 */
+	int TokensRemoved;
+
+	/**
+	 * the number of tokens, starting at FirstToken, that replaced the removed tokens. 
+	 * All tokens after these are the same as before, only moved.
+	 */
+	int TokensAdded;
+
+	/**
+	 * the number of characters that went through the lexer.
+	 */
+	int CharactersLexed;
+
+	RelexResultsClass();
+};
+
+/**
+ * The IncrementalLexerClass keeps the tokens of a piece of source code and 
+ * re-tokenizes only what is necessary after the code is edited. The lexer is 
+ * restarted at a token boundary right before the edit, and it stops as soon as it 
+ * ends a token at the same place and in the same condition as a token from
+ * before the edit; from that point on the old tokens are still valid, only 
+ * their positions and lines are moved.
+ *
+ * @code
+ *   pelet::IncrementalLexerClass lexer;
+ *   lexer.Open(code);
+ *   pelet::RelexResultsClass results;
+ *
+ *   // user typed a character
+ *   lexer.Edit(pos, 0, UNICODE_STRING_SIMPLE("a"), results);
+ *   for (int i = results.FirstToken; i < results.FirstToken + results.TokensAdded; ++i) {
+ *     // re-highlight lexer.GetToken(i)
+ *   }
+ * @endcode
+ *
+ * Code is tokenized as a file; it starts as inline HTML.
+ * This class is not thread-safe.
+ */
+class PELET_API IncrementalLexerClass {
+
+public:
+
+	IncrementalLexerClass();
+
+	/**
+	 * Change the version that this lexer can handle. This needs to be called BEFORE Open().
+	 */
+	void SetVersion(Versions version);
+
+	/**
+	 * tokenize all of the given code. Any previous tokens are discarded.
+	 *
+	 * @param code the code to tokenize, this class keeps a copy of it
+	 */
+	void Open(const UnicodeString& code);
+
+	/**
+	 * Replace a part of the code and re-tokenize the affected tokens.
+	 *
+	 * @param position the position where the edit starts
+	 * @param removedLength the number of characters removed at position
+	 * @param text the characters inserted at position
+	 * @param results will be filled with the tokens that changed
+	 * @return bool FALSE if the edit is not inside the code; in this case nothing is changed.
+	 */
+	bool Edit(int position, int removedLength, const UnicodeString& text, RelexResultsClass& results);
+
+	/**
+	 * @return the code, with all of the edits applied
+	 */
+	const UnicodeString& GetCode() const;
+
+	/**
+	 * @return the number of tokens, including the last token (T_END or an
+	 *         unterminated error token)
+	 */
+	size_t GetTokenCount() const;
+
+	/**
+	 * @param i the index of the token
+	 * @return the token at the given index
+	 */
+	const LexedTokenClass& GetToken(size_t i) const;
+
+	/**
+	 * @param i the index of the token
+	 * @return the text of the token at the given index, exactly as it is in the 
+	 *         code (strings are not unescaped)
+	 */
+	UnicodeString GetLexeme(size_t i) const;
+
+private:
+
+	/**
+	 * tokenize from the given checkpoint. Tokens are added to newTokens until the lexer
+	 * re-synchronizes with the current tokens or reaches the end. 
+	 *
+	 * @param startPos the position to start lexing from
+	 * @param lineNumber the line at startPos
+	 * @param condition the lexer condition at startPos
+	 * @param syncPos new tokens that end at or after this position can be 
+	 *        re-synchronized with the current tokens
+	 * @param delta the amount of characters that the current tokens need to be
+	 *        moved by to match the code
+	 * @param firstOld the first current token that the lexer can re-synchronize
+	 *        with; the tokens before it end before the edit
+	 * @param newTokens the tokens that were lexed
+	 * @return the index of the current token that the lexer re-synchronized with, or 
+	 *         the number of current tokens if the lexer did not re-synchronize
+	 */
+	size_t Lex(int startPos, int lineNumber, YYCONDTYPE condition, int syncPos, int delta, size_t firstOld,
+		std::vector<LexedTokenClass>& newTokens);
+
+	/**
+	 * the code being tokenized
+	 */
+	UnicodeString Code;
+
+	/**
+	 * the tokens of Code, in order
+	 */
+	std::vector<LexedTokenClass> Tokens;
+
+	/**
+	 * The PHP version to handle
+	 */
+	Versions Version;
+};
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include <unicode/unistr.h>
 #include <pelet/UCharBufferedFileClass.h>
 #include <pelet/Api.h>
+#include <vector>
 
 namespace pelet {
 
@@ -75,6 +76,30 @@ public:
 	 */
 	bool Open(const UnicodeString& code);
 
+	/**
+	 * Initialize with the given code, in indexed mode. In indexed mode the code
+	 * is scanned only once; the positions where the language changes are kept
+	 * so that at() only needs a binary search.  The code is scanned lazily, only
+	 * up to the largest position given to at(). Use this mode when at() is called 
+	 * for many positions, ie. when highlighting.
+	 *
+	 * @return bool TRUE if code is not empty.
+	 */
+	bool OpenIndexed(const UnicodeString& code);
+
+	/**
+	 * Replace the code after an edit; the index is kept up to the edit and 
+	 * the rest of the code will be scanned again when at() is called. This 
+	 * only works in indexed mode; if the class is not in indexed mode then
+	 * this is the same as Open().
+	 *
+	 * @param code the new code
+	 * @param pos the position of the first changed character; the code before this 
+	 *        position must be the same as the previous code
+	 * @return bool TRUE if code is not empty.
+	 */
+	bool Update(const UnicodeString& code, int pos);
+
 	/**
 	 * Clean up any resources after lexing. This should be done so that
 	 * the string given in the Open() call can be released.
@@ -92,6 +117,63 @@ public:
 
 private:
 
+	/**
+	 * A position where the language changes
+	 */
+	class BoundaryClass {
+
+	public:
+
+		/**
+		 * the start of the token that changed the language
+		 */
+		int Start;
+
+		/**
+		 * the end of the token that changed the language
+		 */
+		int End;
+
+		/**
+		 * the language after the token
+		 */
+		Syntax NewSyntax;
+
+		/**
+		 * the HTML language to go back to when PHP ends
+		 */
+		Syntax LastCondition;
+	};
+
+	/**
+	 * Scans the code until the first token that ends at or after pos.
+	 * 
+	 * @param pos the position to scan up to
+	 * @param syntax the language at the start of the scan; will be set to the language 
+	 *        after the scan
+	 * @param lastCondition the HTML language to go back to when PHP ends; will be updated
+	 * @param currentPos the position to start the scan at (must be a token boundary); will be 
+	 *        set to the end of the last token scanned. if currentPos < pos after the scan
+	 *        then the end of the code was reached
+	 * @return the language after the scan
+	 */
+	Syntax Scan(int pos, Syntax& syntax, Syntax& lastCondition, int& currentPos);
+
+	/**
+	 * adds a boundary to the index, if the language changed
+	 */
+	void AddBoundary(int start, int end, Syntax syntax, Syntax lastCondition);
+
+	/**
+	 * @return the language at the given position, using only the index
+	 */
+	Syntax Find(int pos) const;
+
+	/**
+	 * the positions where the language changes, sorted by position. Only used in 
+	 * indexed mode.
+	 */
+	std::vector<BoundaryClass> Boundaries;
 
 	/**
 	 * Contains positions of the token currently being tokenized.
@@ -102,6 +184,31 @@ private:
 	 * The actual code being parsed
 	 */
 	UnicodeString Code;
+
+	/**
+	 * the language at ScanPos
+	 */
+	Syntax ScanSyntax;
+
+	/**
+	 * the HTML language to go back to when PHP ends, at ScanPos
+	 */
+	Syntax ScanLastCondition;
+
+	/**
+	 * how far the code has been indexed
+	 */
+	int ScanPos;
+
+	/**
+	 * TRUE if at() uses the index
+	 */
+	bool IsIndexed;
+
+	/**
+	 * TRUE if all of the code has been indexed
+	 */
+	bool IsScanFinished;
 };
 
 }
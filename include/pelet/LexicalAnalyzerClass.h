@@ -26,13 +26,71 @@
 #define LEXICALANALYZER_H
 
 #include <string>
+#include <vector>
 #include <unicode/unistr.h>
 #include <pelet/UCharBufferedFileClass.h>
+#include <pelet/Utf8BufferClass.h>
 #include <pelet/TokenClass.h>
+#include <pelet/TokenTableClass.h>
+#include <pelet/ThreadClass.h>
 #include <pelet/Api.h>
 
 namespace pelet {
 
+class UCharMappedFileClass;
+class TokenPipelineClass;
+
+/**
+ * The ways that LexicalAnalyzerClass::OpenFile() reads a file
+ */
+enum FileBufferTypes {
+
+	/**
+	 * read the file in small chunks (UCharBufferedFileClass). Uses the 
+	 * system's default codepage and only a small amount of memory.
+	 */
+	STREAMING_FILE_BUFFER,
+
+	/**
+	 * map the entire file and convert it from UTF-8 in a single pass (UCharMappedFileClass). 
+	 * This is faster but the file must be UTF-8 and it is held in memory while 
+	 * it is being lexed.
+	 */
+	MAPPED_UTF8_FILE_BUFFER,
+
+	/**
+	 * map the entire file and lex the UTF-8 bytes directly (Utf8BufferClass); the file is 
+	 * never converted to UTF-16, only the lexemes that are asked for in GetLexeme() are converted.
+	 * The file must be UTF-8 (or ASCII). In this mode, GetCharacterPosition() returns 
+	 * byte offsets instead of character offsets.
+	 */
+	UTF8_FILE_BUFFER
+};
+
+/**
+ * A syntax error found by one of the parsers.
+ */
+class PELET_API ParserErrorClass {
+
+public:
+
+	/**
+	 * A short description of the error; this is generated by the bison parser
+	 */
+	UnicodeString Error;
+
+	/**
+	 * The line in which the error ocurred. This is 1-based.
+	 */
+	int LineNumber;
+
+	/**
+	 * The character offset in which the error ocurred. This is 0-based.
+	 */
+	int CharacterPosition;
+
+	ParserErrorClass();
+};
 
 /** 
  * This class represents the lexical analyzer.  It turns source code into
@@ -48,6 +106,13 @@ class PELET_API LexicalAnalyzerClass {
 	 */
 	 UnicodeString ParserError;
 
+	/**
+	 * All of the parse errors, in the order that they were found. The lint and full 
+	 * parsers recover from syntax errors at the statement and class member level, so
+	 * there can be more than one. ParserError is always the first error.
+	 */
+	std::vector<pelet::ParserErrorClass> ParserErrors;
+
 	/**
 	 * constructor: opens the file with the name given, using PHP_53 as the version
 	 * 
@@ -91,18 +156,146 @@ class PELET_API LexicalAnalyzerClass {
 	 * @return bool true if source could be successfully turned to utf-16
 	 */
 	bool OpenString(const UnicodeString& code);
+
+	/**
+	 * prepares the given code to be analyzed starting in the middle of it. This is
+	 * used to resume lexing at a spot that was recorded during a previous pass
+	 * (for example a function body that was skipped). Character positions and
+	 * line numbers stay relative to the start of code.
+	 *
+	 * @param code the entire source
+	 * @param startPos the character position to start lexing at
+	 * @param lineNumber the line number of startPos
+	 * @param condition the lexer state at startPos
+	 * @return bool true if code is not empty and startPos is valid
+	 */
+	bool OpenStringAt(const UnicodeString& code, int startPos, int lineNumber, YYCONDTYPE condition);
+
+	/**
+	 * prepares the given code to be analyzed starting in the middle of it, without
+	 * copying the code. The lexer stops at the NULL at code[length], so a piece of 
+	 * a larger source can be lexed on its own by writing a NULL where the piece ends.
+	 * Character positions and line numbers stay relative to the start of code.
+	 *
+	 * @param code the source; code[length] must be NULL and code must outlive this 
+	 *        lexer (or the next Open / Close call)
+	 * @param length the number of characters to lex, not including the NULL
+	 * @param startPos the character position to start lexing at
+	 * @param lineNumber the line number of startPos
+	 * @param condition the lexer state at startPos
+	 * @return bool true if startPos is valid
+	 */
+	bool OpenView(const UChar* code, int length, int startPos, int lineNumber, YYCONDTYPE condition);
+
+	/**
+	 * prepares the lexer to be given the code in pieces with AppendChunk(). Like
+	 * OpenFile(), an open tag is required before the lexer starts lexing PHP code.
+	 * If another file/buffer is currently opened it will be closed.
+	 */
+	void OpenChunks();
+
+	/**
+	 * adds code to the end of the code given so far. OpenChunks() must have been called
+	 * first.
+	 *
+	 * @param chars the code to add; it is copied
+	 * @param length the number of characters in chars
+	 */
+	void AppendChunk(const UChar* chars, int length);
+
+	/**
+	 * signals that all of the code has been given to AppendChunk(); the lexer will 
+	 * return T_END once it reaches the end of the code.
+	 */
+	void FinishChunks();
+
+	/**
+	 * remembers the current position and lexer state so that the lexer can
+	 * go back to it with RestorePosition(). Only the chunk buffer (OpenChunks())
+	 * can save its position.
+	 */
+	void SavePosition();
+
+	/**
+	 * goes back to the position and lexer state that were remembered by
+	 * SavePosition()
+	 */
+	void RestorePosition();
+
+	/**
+	 * @return TRUE if the lexer reached the end of the code given to AppendChunk()
+	 *         before it could finish a token, since the last SavePosition() call. 
+	 *         The tokens found since then are not reliable.
+	 */
+	bool NeedsMoreInput() const;
 	
 	/**
 	 * Change the version that this lexer can handle. This needs to be called BEFORE OpenFile() or
 	 * OpenString()
 	 */
 	void SetVersion(Versions version);
+
+	/**
+	 * Change the way files are read. This needs to be called BEFORE OpenFile(); it has no
+	 * effect on OpenString(). The default is STREAMING_FILE_BUFFER.
+	 */
+	void SetFileBufferType(FileBufferTypes type);
+
+	/**
+	 * When keeping buffers, Close() does not free the buffer objects nor their
+	 * memory; the next OpenFile() / OpenString() reuses them. This is useful when many
+	 * files are lexed one after the other, the steady state does no allocation for
+	 * the source code. Turning this off frees the kept buffers.
+	 * Chunked code (OpenChunks()) is never kept.
+	 *
+	 * @param keep TRUE to keep the buffers between files
+	 */
+	void SetKeepBuffers(bool keep);
+
+	/**
+	 * In pipeline mode, large files and strings are lexed on a second thread 
+	 * (see TokenPipelineClass) while the caller parses the tokens that have already 
+	 * been lexed. Code that is smaller than the given length is lexed on the 
+	 * caller's thread as usual, since starting a thread costs more than it saves. 
+	 * The tokens, lexemes, line numbers and positions are the same in both modes.
+	 * Only OpenFile(const std::string&) and OpenString() use the pipeline.
+	 * This needs to be called BEFORE OpenFile() or OpenString()
+	 *
+	 * @param pipeline TRUE to lex large code on a second thread
+	 * @param minLength the smallest code to lex on a second thread, in characters
+	 *        for strings and in bytes for files. Zero means the default (512 KB).
+	 */
+	void SetPipelineMode(bool pipeline, int minLength = 0);
+
+	/**
+	 * Set the token that can stop the lexer. Every so many tokens NextToken() checks the
+	 * token; once it is cancelled NextToken() returns T_ERROR_CANCELLED and then T_END 
+	 * until the lexer is opened again. The parsers check WasCancelled() before they 
+	 * accept the source, so a cancelled parse fails and the observers are not given
+	 * the partial file. Memory management of this pointer should be done by the caller.
+	 *
+	 * @param cancelToken the token to check, can be NULL
+	 */
+	void SetCancelToken(CancelTokenClass* cancelToken);
+
+	/**
+	 * @return bool TRUE if the lexer stopped because its cancel token was cancelled
+	 */
+	bool WasCancelled() const;
 	
 	/**
 	 * Clean up any resources after lexing
 	 */
 	void Close();
 
+	/**
+	 * Records a parse error at the position of the current token. This is called by
+	 * the parsers' error functions.
+	 *
+	 * @param error the error message
+	 */
+	void AddParserError(const UnicodeString& error);
+
 	/**
 	 * gets the next token. Checking for the end is not as simple as checking for T_EOF, you will
 	 * need to call pelet::TokenClass::IsTerminatingToken() to ensure that the end of stream
@@ -122,6 +315,37 @@ class PELET_API LexicalAnalyzerClass {
 	 */
 	bool GetLexeme(UnicodeString& lexeme);
 
+	/**
+	 * @return int the length of the last token that was returned by NextToken(), including 
+	 *         any quotes. This is cheaper than GetLexeme() since the lexeme is not copied. 
+	 *         When the UTF8_FILE_BUFFER is used the length is in bytes.
+	 */
+	int GetTokenLength() const;
+
+	/**
+	 * Tokenizes all of the given code in one pass and stores the tokens in the given
+	 * table. This is independent of OpenFile() / OpenString(); the lexer assumes that
+	 * the code starts with pure PHP code, just like OpenString() does.
+	 *
+	 * @param code the code to tokenize
+	 * @param table will be filled with the tokens and a copy of the code; any previous
+	 *        contents are removed
+	 * @return bool true if code is not empty
+	 */
+	bool TokenizeAll(const UnicodeString& code, TokenTableClass& table);
+
+	/**
+	 * Tokenizes all of the given file in one pass and stores the tokens in the given 
+	 * table. The file is assumed to be UTF-8 and is read entirely into memory, no matter 
+	 * what SetFileBufferType() was given. The file starts as inline HTML.
+	 *
+	 * @param fileName the full path to the file to tokenize
+	 * @param table will be filled with the tokens and the file contents; any previous
+	 *        contents are removed
+	 * @return bool true if file could be read
+	 */
+	bool TokenizeFile(const std::string& fileName, TokenTableClass& table);
+
 	/**
 	 * returns the line number of the source file that the
 	 * Lexical Analyzer is currently working on. Handles various line endings correctly.
@@ -138,6 +362,11 @@ class PELET_API LexicalAnalyzerClass {
 	 * @return int
 	 */
 	int GetCharacterPosition() const;
+
+	/**
+	 * @return the state that the lexer is currently in (in script, in a heredoc, ...)
+	 */
+	YYCONDTYPE GetCondition() const;
 	
 	/**
 	 * Returns the name of the file being parsed.
@@ -182,6 +411,18 @@ private:
 	 * The buffer that holds the source code being tokenized.
 	 */
 	BufferClass* Buffer;
+
+	/**
+	 * The buffer that holds the source code being tokenized when the file is
+	 * opened as UTF8_FILE_BUFFER. At most one of Buffer and Utf8Buffer is set.
+	 */
+	Utf8BufferClass* Utf8Buffer;
+
+	/**
+	 * The buffer that holds the source code when the code is given in pieces. When this
+	 * is set, Buffer points to the same object.
+	 */
+	UCharChunkBufferClass* ChunkBuffer;
 	
 	/**
 	 * The file being parsed. Exactly what was given to OpenFile().
@@ -193,11 +434,86 @@ private:
 	 * rules properly.
 	 */
 	YYCONDTYPE Condition;
+
+	/**
+	 * The lexer state when SavePosition() was called
+	 */
+	YYCONDTYPE SavedCondition;
 	
 	/**
 	 * The PHP version to handle
 	 */
 	Versions Version;
+
+	/**
+	 * The buffer to create in OpenFile()
+	 */
+	FileBufferTypes FileBufferType;
+
+	/**
+	 * The token that can stop the lexer; this class does NOT own the pointer
+	 */
+	CancelTokenClass* CancelToken;
+
+	/**
+	 * The number of tokens to lex before looking at the cancel token again
+	 */
+	int TokensUntilCancelCheck;
+
+	/**
+	 * TRUE when the cancel token has been seen as cancelled
+	 */
+	bool Cancelled;
+
+	/**
+	 * The buffers kept from previous files when keeping buffers. These are NULL
+	 * until a file or string of that kind is opened. This class owns these pointers.
+	 */
+	UCharBufferedFileClass* KeptBufferedFile;
+	UCharMappedFileClass* KeptMappedFile;
+	UCharBufferClass* KeptStringBuffer;
+	Utf8BufferClass* KeptUtf8Buffer;
+
+	/**
+	 * TRUE when buffers are kept between files
+	 */
+	bool IsKeepingBuffers;
+
+	/**
+	 * the lexer thread, created the first time that code is lexed in 
+	 * pipeline mode. This class owns the pointer.
+	 */
+	TokenPipelineClass* Pipeline;
+
+	/**
+	 * the smallest code to lex on the pipeline
+	 */
+	int PipelineLength;
+
+	/**
+	 * TRUE when SetPipelineMode() was turned on
+	 */
+	bool IsPipelineMode;
+
+	/**
+	 * TRUE when the open code is being lexed by the pipeline; all of the tokens
+	 * come from Pipeline instead of the buffers
+	 */
+	bool IsPipelined;
+
+	/**
+	 * frees the buffers kept from previous files
+	 */
+	void DeleteKeptBuffers();
+
+	/**
+	 * starts the pipeline on the given file or code when pipeline mode is on and 
+	 * the code is large enough. 
+	 *
+	 * @return bool TRUE if the pipeline was started
+	 */
+	bool PipelineFile(const std::string& file);
+	bool PipelineString(const UnicodeString& code);
 	
 };
 
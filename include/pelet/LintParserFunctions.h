@@ -30,13 +30,13 @@
 
 /**
  * This macro will create the an instance of the given class on the heap
- * and will assign it to dest. Also, it will set the pointer to be owner
- * by the ResourceParserObserver instance, that way memory will be
- * cleaned up properly.
+ * (or in the observers' arena, when there is one) and will assign it to dest. 
+ * Also, it will set the pointer to be owner by the ResourceParserObserver 
+ * instance, that way memory will be cleaned up properly.
  *
  * The calling code must contain a variable observers of type pelet::ResourceParserObserverClass
  */
-#define AST_INIT(dest, clazz) dest = new clazz; observers.Adopt(dest);
+#define AST_INIT(dest, clazz) dest = observers.GetArena() ? new (*observers.GetArena()) clazz : new clazz; observers.Adopt(dest);
 
 /**
  * This macro will create the an instance of the given class on the heap
@@ -52,7 +52,7 @@
  *
  * The calling code must contain a variable observers of type pelet::ResourceParserObserverClass
  */
-#define AST_INIT_ARGS(dest, clazz, ...) dest = new clazz; dest->Init(__VA_ARGS__); observers.Adopt(dest);
+#define AST_INIT_ARGS(dest, clazz, ...) AST_INIT(dest, clazz); dest->Init(__VA_ARGS__);
 
 /**
  * This macro will create the an instance of the given class on the heap
@@ -69,7 +69,8 @@
  *
  * The calling code must contain a variable observers of type pelet::ResourceParserObserverClass
  */
-#define AST_INIT_CARGS(dest, clazz, cArg, ...) dest = new clazz(cArg); dest->Init(__VA_ARGS__); observers.Adopt(dest);
+#define AST_INIT_CARGS(dest, clazz, cArg, ...) dest = observers.GetArena() ? new (*observers.GetArena()) clazz(cArg) : new clazz(cArg); \
+	dest->Init(__VA_ARGS__); observers.Adopt(dest);
 
 /**
  * This macro *initializes* stmtListDest with all of the statements in stmtListSrc.
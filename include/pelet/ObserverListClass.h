@@ -0,0 +1,163 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_OBSERVERLISTCLASS_H__
+#define __PELET_OBSERVERLISTCLASS_H__
+
+#include <pelet/ParserTypeClass.h>
+#include <pelet/Api.h>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * The ObserverListClass lets any number of observers of the same kind be notified
+ * from one parse; each callback is given to all of the observers of its kind, in 
+ * the order that they were added. The ParserClass uses this class when more than 
+ * one observer of a kind is added; the parser tier (resource or full) is picked
+ * from all of the observers together.
+ *
+ * Since this object is given to the full parser as the expression observer, it is 
+ * this object (and not the observers in ExpressionObservers) that keeps the 
+ * expressions alive after the parse; see ExpressionObserverClass::StatementOwnership()
+ */
+class PELET_API ObserverListClass : public ClassObserverClass, public ClassMemberObserverClass, public FunctionObserverClass,
+	public VariableObserverClass, public ExpressionObserverClass {
+
+public:
+
+	/**
+	 * The observers of each kind. This class does NOT own the pointers.
+	 */
+	std::vector<ClassObserverClass*> ClassObservers;
+
+	std::vector<ClassMemberObserverClass*> ClassMemberObservers;
+
+	std::vector<FunctionObserverClass*> FunctionObservers;
+
+	std::vector<VariableObserverClass*> VariableObservers;
+
+	std::vector<ExpressionObserverClass*> ExpressionObservers;
+
+	ObserverListClass();
+
+	/**
+	 * @return the observer to give to the parser for class callbacks: NULL when
+	 *         there are no class observers, the observer itself when there is only
+	 *         one, or this list when there are more
+	 */
+	ClassObserverClass* GetClassObserver();
+
+	/**
+	 * @return same as GetClassObserver() but for class member observers
+	 */
+	ClassMemberObserverClass* GetClassMemberObserver();
+
+	/**
+	 * @return same as GetClassObserver() but for function observers
+	 */
+	FunctionObserverClass* GetFunctionObserver();
+
+	/**
+	 * @return same as GetClassObserver() but for variable observers
+	 */
+	VariableObserverClass* GetVariableObserver();
+
+	/**
+	 * @return same as GetClassObserver() but for expression observers
+	 */
+	ExpressionObserverClass* GetExpressionObserver();
+
+	/**
+	 * @return the fields wanted by any of the observers; since this list is given
+	 *         to the parser for all kinds of callbacks, it wants all of the fields 
+	 *         that any of its observers want.
+	 */
+	int SymbolFields() const;
+
+	/**
+	 * @return the expression types wanted by any of the expression observers
+	 */
+	int ExpressionTypes() const;
+
+	void ClassFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& signature,
+		const UnicodeString& baseClassName, const UnicodeString& implementInterfaceNames, 
+		const UnicodeString& comment, const int lineNumber);
+	void ClassEnd(const UnicodeString& namespaceName, const UnicodeString& className, int pos);
+	void DefineDeclarationFound(const UnicodeString& namespaceName, const UnicodeString& variableName, const UnicodeString& variableValue, 
+		const UnicodeString& comment, const int lineNumber);
+	void IncludeFound(const UnicodeString& filename, const int lineNumber);
+	void NamespaceDeclarationFound(const UnicodeString& namespaceName, int startingPos);
+	void NamespaceUseFound(const UnicodeString& namespaceName, const UnicodeString& alias, int lineNumber, int startingPos);
+
+	void MethodFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& methodName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, 
+		TokenClass::TokenIds visibility, bool isStatic, const int lineNumber,
+		bool hasVariableArguments);
+	void PropertyFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& propertyName, 
+		const UnicodeString& propertyType, const UnicodeString& comment, 
+		TokenClass::TokenIds visibility, bool isConst, bool isStatic, const int lineNumber);
+	void MethodScope(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& methodName, int startingPos, int endingPos);
+	void TraitUseFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& fullyQualifiedTraitName);
+	void TraitAliasFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, 
+		const UnicodeString& alias, TokenClass::TokenIds visibility);
+	void TraitInsteadOfFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, const std::vector<UnicodeString>& insteadOfList);
+
+	void FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+		bool hasVariableArguments);
+	void FunctionScope(const UnicodeString& namespaceName, const UnicodeString& functionName, int startingPos, int endingPos);
+
+	void VariableFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& methodName, 
+		const VariableClass& variable, pelet::ExpressionClass* expression, const UnicodeString& comment);
+
+	void ExpressionVariableFound(pelet::VariableClass* expression);
+	void ExpressionAssignmentFound(pelet::AssignmentExpressionClass* expression);
+	void ExpressionAssignmentListFound(pelet::AssignmentListExpressionClass* expression);
+	void ExpressionAssignmentCompoundFound(pelet::AssignmentCompoundExpressionClass* expression);
+	void ExpressionBinaryOperationFound(pelet::BinaryOperationClass* expression);
+	void ExpressionUnaryOperationFound(pelet::UnaryOperationClass* expression);
+	void ExpressionUnaryVariableOperationFound(pelet::UnaryVariableOperationClass* expression);
+	void ExpressionTernaryOperationFound(pelet::TernaryOperationClass* expression);
+	void ExpressionInstanceOfOperationFound(pelet::InstanceOfOperationClass* expression);
+	void ExpressionScalarFound(pelet::ScalarExpressionClass* expression);
+	void ExpressionNewInstanceFound(pelet::NewInstanceExpressionClass* expression);
+	void ExpressionFunctionArgumentFound(pelet::VariableClass* variable);
+	void StatementGlobalVariablesFound(pelet::GlobalVariableStatementClass* variables);
+	void StatementStaticVariablesFound(pelet::StaticVariableStatementClass* variables);
+	void ExpressionIncludeFound(pelet::IncludeExpressionClass* expr);
+	void ExpressionClosureFound(pelet::ClosureExpressionClass* expr);
+	void ExpressionIssetFound(pelet::IssetExpressionClass* expr);
+	void ExpressionArrayFound(pelet::ArrayExpressionClass* expression);
+	void ExpressionEvalFound(pelet::EvalExpressionClass* expression);
+};
+
+}
+
+#endif
@@ -28,8 +28,10 @@
 #include <pelet/LexicalAnalyzerClass.h>
 #include <pelet/TokenClass.h>
 #include <pelet/ParserTypeClass.h>
+#include <pelet/ObserverListClass.h>
 #include <unicode/unistr.h>
 #include <pelet/Api.h>
+#include <vector>
 
 /**
 \mainpage pelet: Php Easy LanguagE Toolkit. A C++ library for analyzing PHP source code
@@ -60,6 +62,10 @@ ParserClass::ScanFile does not return control until the entire file has been par
 been called before ParserClass::ScanFile returns.  For this reason, it is important that ParserClass::ScanFile
 should not be called within any of the observers.
 
+Code can also be given to the parser in pieces with ParserClass::Feed() and ParserClass::Finish(); this is
+useful when the code is not all available at once, for example while it is being downloaded. The parser 
+consumes all of the complete tokens of each piece and keeps the rest for the next one. 
+
 A word on concurrency: The pelet parser does not keep global state (it is a "pure" bison parser), but the pelet
 parser is not thread-safe.  If pelet is used on a multi-threaded app, each thread should have its own instance
 of pelet::ParserClass.
@@ -121,6 +127,27 @@ public:
 	 */
 	int CharacterPosition;
 
+	/**
+	 * All of the syntax errors that were found. The lint and full parsers recover from
+	 * errors in statements and class members so that one pass finds all of the errors 
+	 * (and the symbols after them). Error, LineNumber and CharacterPosition are 
+	 * those of the first error.
+	 */
+	std::vector<pelet::ParserErrorClass> Errors;
+
+	/**
+	 * The function and method bodies that were skipped when lazy body mode is on.
+	 * Any of these can be given to ParserClass::ScanBody() later on.
+	 */
+	std::vector<pelet::BodyRangeClass> Bodies;
+
+	/**
+	 * TRUE if the parse was stopped because the cancel token given to 
+	 * ParserClass::SetCancelToken() was cancelled. In this case Error and Errors are
+	 * empty and the observers may have been notified of only some of the items.
+	 */
+	bool IsCancelled;
+
 	LintResultsClass();
 
 	/**
@@ -134,6 +161,8 @@ public:
 	void Clear();
 };
 
+class PushParserStateClass;
+
 /**
  * The parser class is designed in a way that can utilized by different pieces of code.  The parser will analyze
  * given code and make calls to the different registered observers.  There are observers for classes, functions, and 
@@ -183,6 +212,8 @@ class PELET_API ParserClass {
 public:
 	
 	ParserClass();
+
+	~ParserClass();
 	
 	/**
 	 * Opens and scans the given file; This function will return once the entire
@@ -225,15 +256,190 @@ public:
 	 * @return bool if string could be parsed successfully
 	 */
 	bool ScanString(const UnicodeString& code, LintResultsClass& results);
+
+	/**
+	 * Parses a single function or method body that was skipped by a previous
+	 * ScanFile() or ScanString() call in lazy body mode. The variable and 
+	 * expression observers are notified of the items in the body, with the
+	 * same scope as if the entire file had been parsed; the function parameters
+	 * are NOT notified again.
+	 * 
+	 * @param code the same code that was given to ScanString()
+	 * @param body one of the items in LintResultsClass::Bodies
+	 * @param results any error message will be populated here
+	 * @return bool if the body could be parsed successfully
+	 */
+	bool ScanBody(const UnicodeString& code, const pelet::BodyRangeClass& body, LintResultsClass& results);
+
+	/**
+	 * Same as above, but the body is read from the given file. Body positions are 
+	 * character positions, so the file must have been scanned with a file buffer 
+	 * type other than UTF8_FILE_BUFFER.
+	 * 
+	 * @param file the same file that was given to ScanFile(). Must be a full path.
+	 * @param body one of the items in LintResultsClass::Bodies
+	 * @param results any error message will be populated here
+	 * @return bool if file was found and the body could be parsed successfully
+	 */
+	bool ScanBody(const std::string& file, const pelet::BodyRangeClass& body, LintResultsClass& results);
+
+	/**
+	 * Parses a piece of a file that starts at a top-level statement, as if the 
+	 * code before it had been parsed already: the namespace and the namespace aliases 
+	 * of the range are in effect from the start. Only the class, class member and
+	 * function observers are notified; this always uses the resource parser. 
+	 * The code is not copied; the parse stops at the NULL at code[range.EndPos],
+	 * so that the caller can split a file into ranges by writing NULLs into it
+	 * (see SplitFileParserClass).
+	 *
+	 * @param code the entire source; code[range.EndPos] must be NULL
+	 * @param range the start, end, line number, lexer state and scope of the piece
+	 * @param results any error message will be populated here
+	 * @return bool if the range could be parsed successfully
+	 */
+	bool ScanRange(const UChar* code, const pelet::BodyRangeClass& range, LintResultsClass& results);
+
+	/**
+	 * Gives the next piece of code to the parser. The first call starts a new parse; 
+	 * the code is expected to be the start of a file (an open tag is needed before any
+	 * PHP code). All of the complete tokens are parsed right away; since the resource 
+	 * parser notifies the observers as it parses, the class, member and function
+	 * observers are notified as soon as each item is complete. The full parser (used 
+	 * when there is a variable or expression observer) notifies at the end of the code.
+	 * Feed() may be called any number of times; Finish() must be called at the end. 
+	 * The declaration scanner is not used for code that is given in pieces.
+	 *
+	 * @param code the next piece of code; it is copied so it does not need to outlive this call.
+	 *        Pieces may end in the middle of a token.
+	 * @param length the number of characters in code
+	 * @return bool FALSE if the parser has stopped because of a syntax error; any 
+	 *         code given after that is ignored.
+	 */
+	bool Feed(const UChar* code, int length);
+
+	/**
+	 * Parses the rest of the code given to Feed() and ends the parse.  If Feed() was never
+	 * called, then the code is empty.
+	 *
+	 * @param results any error message will be populated here
+	 * @return bool if the code could be parsed successfully
+	 */
+	bool Finish(LintResultsClass& results);
 	
 	/**
 	 * Change the version that this parser can handle. This needs to be called BEFORE ScanFile() or
 	 * ScanString()
 	 */
 	void SetVersion(Versions version);
+
+	/**
+	 * Change the way that ScanFile() and LintFile() read files. Use MAPPED_UTF8_FILE_BUFFER
+	 * for faster reads of UTF-8 files. This needs to be called BEFORE ScanFile() or
+	 * LintFile()
+	 */
+	void SetFileBufferType(FileBufferTypes type);
+
+	/**
+	 * Turn on outline mode. In outline mode the bodies of functions, methods and closures
+	 * are skipped over by matching braces instead of being parsed, so only the declarations
+	 * are found. MethodScope() and FunctionScope() still get the start and end positions of 
+	 * the bodies. Note that define() calls, includes and properties that are only assigned 
+	 * inside of a method body are NOT found in outline mode. Outline mode only applies when
+	 * there are no variable or expression observers; otherwise the entire file is parsed.
+	 * The default is off.
+	 */
+	void SetOutlineMode(bool outline);
+
+	/**
+	 * Use the hand-written declaration scanner instead of the bison resource parser. The 
+	 * scanner notifies the class, member and function observers of the same items as the
+	 * resource parser does, but it is faster since it does not run the full grammar. 
+	 * The scanner is less strict than the grammar; it may accept code that has syntax 
+	 * errors and its error messages are worded differently. Like outline mode, this only
+	 * applies when there are no variable or expression observers; outline mode can be
+	 * turned on at the same time. The default is off.
+	 */
+	void SetDeclarationScannerMode(bool scanner);
+
+	/**
+	 * Turn on lazy body mode. In lazy body mode the full parser skips over the bodies
+	 * of functions and methods and records their locations in LintResultsClass::Bodies;
+	 * a body can then be parsed on demand with ScanBody(). Bodies of closures that are
+	 * not inside of a function are still parsed. Since bodies are not parsed, properties
+	 * that are only assigned inside of a method are NOT found, and calls to 
+	 * func_get_args() are found by looking at the tokens. This only applies when there
+	 * is a variable or expression observer; it has no effect on the resource parser
+	 * (see SetOutlineMode()). The default is off.
+	 */
+	void SetLazyBodyMode(bool lazy);
+
+	/**
+	 * Turn on streaming mode. In streaming mode the class, class member and function
+	 * observers are notified as soon as each top-level statement (a class, a function, 
+	 * a namespace block, ...) has been parsed instead of after the entire file has been
+	 * parsed, and the memory used by the statement is freed right after. This keeps 
+	 * memory use flat on very large files, and the first callbacks arrive sooner. If 
+	 * there is a syntax error, the observers will have been notified of the statements 
+	 * before the error. Like outline mode, this only applies when there are no variable or 
+	 * expression observers; the full parser keeps all of the nodes in its arena, since the
+	 * expression observer takes ownership of them at the end of the parse. Code given
+	 * with Feed() is always streamed. The default is off.
+	 */
+	void SetStreamingMode(bool streaming);
+
+	/**
+	 * Turn on session mode. Use this when many files are scanned one after the other
+	 * with the same parser. In session mode the lexer keeps its buffers between files
+	 * and the resource parser creates its AST nodes in the same arena that the full 
+	 * parser uses, so that once the largest file has been seen scanning another
+	 * file does not need to allocate buffers or node memory. The buffers are held until 
+	 * session mode is turned off or the parser is destroyed. The arena is not used
+	 * in streaming mode, that needs to own each node.
+	 * Session mode does not make a scan allocation-free; the members inside the 
+	 * nodes still use the heap: the statement lists of classes, functions and 
+	 * blocks, the name / type / default of each function parameter, the properties 
+	 * that the observer collects from constructor assignments, and any lexeme or 
+	 * comment that is too long for ICU's inline string buffer.
+	 * The default is off.
+	 */
+	void SetSessionMode(bool session);
+
+	/**
+	 * Turn on the expression chain parser for ParseExpression(). The chain parser reads
+	 * simple chains (variables, calls, static members, new instances) straight from the
+	 * tokens; expressions that it does not handle are parsed with the full grammar. Turn
+	 * this off to always use the full grammar. The default is on.
+	 */
+	void SetExpressionChainMode(bool chain);
+
+	/**
+	 * Turn on pipeline mode. In pipeline mode large files are lexed on a second thread
+	 * while this thread parses the tokens that have already been lexed; files that 
+	 * are smaller than minLength bytes (strings smaller than minLength characters) are 
+	 * parsed the usual way. The results are the same in both modes. This is only 
+	 * worth it on a machine with more than one processor. The default is off.
+	 *
+	 * @param pipeline TRUE to lex large files on a second thread
+	 * @param minLength the smallest file to lex on a second thread; zero 
+	 *        means the default (512 KB)
+	 * @see LexicalAnalyzerClass::SetPipelineMode()
+	 */
+	void SetPipelineMode(bool pipeline, int minLength = 0);
+
+	/**
+	 * Set the token that can stop a parse or lint that is running. When the token
+	 * is cancelled (or its deadline passes) the parse stops a short while later; the
+	 * Scan, Lint and Finish methods return FALSE and LintResultsClass::IsCancelled is set.
+	 * The parser can be used again right away. Memory management of this pointer should be
+	 * done by the caller.
+	 *
+	 * @param cancelToken the token, can be NULL to parse without one
+	 */
+	void SetCancelToken(CancelTokenClass* cancelToken);
 	
 	/**
 	 * Set the class observer.  The observer will get notified when a class is encountered.
+	 * This replaces any class observers that were added before; NULL removes them all.
 	 * Memory management of this pointer should be done by the caller.
 	 * 
 	 * @param ClassObserverClass* observer the object to sent notifications to 
@@ -277,6 +483,42 @@ public:
 	 * @param ExpressionObserverClass* observer the object to sent notifications to 
 	 */
 	void SetExpressionObserver(ExpressionObserverClass* expressionObserver);
+
+	/**
+	 * Add another class observer. All of the observers of a kind are notified from 
+	 * the same parse, in the order that they were added; this way many analyses 
+	 * can share one parse of a file. Same as the Set methods, the parser 
+	 * is picked from all of the observers: the full parser is used if there is
+	 * any variable or expression observer. Memory management of the pointers 
+	 * should be done by the caller.
+	 *
+	 * When there is more than one expression observer, the expressions given to 
+	 * them are kept alive by this parser until the next parse (instead of by the 
+	 * observer; see ExpressionObserverClass::StatementOwnership()).
+	 * 
+	 * @param observer the object to sent notifications to 
+	 */
+	void AddClassObserver(ClassObserverClass* observer);
+
+	/**
+	 * Add another class member observer. See AddClassObserver()
+	 */
+	void AddClassMemberObserver(ClassMemberObserverClass* observer);
+
+	/**
+	 * Add another function observer. See AddClassObserver()
+	 */
+	void AddFunctionObserver(FunctionObserverClass* observer);
+
+	/**
+	 * Add another variable observer. See AddClassObserver()
+	 */
+	void AddVariableObserver(VariableObserverClass* observer);
+
+	/**
+	 * Add another expression observer. See AddClassObserver()
+	 */
+	void AddExpressionObserver(ExpressionObserverClass* observer);
 	
 	/**
 	 * Perform a TRUE PHP syntax check on the entire file. This syntax check is based on PHP 5.3
@@ -415,6 +657,29 @@ private:
 	 */
 	void Close();
 
+	/**
+	 * Parses the code that the lexer has been opened with, using the engine that the
+	 * observers and modes call for: the full parser when there is a variable or
+	 * expression observer, the resource parser (or the declaration scanner) otherwise.
+	 * Fills in the scope and bodies of the results; the caller fills in the rest.
+	 *
+	 * @param results the scope and bodies are set here
+	 * @return bool TRUE if the parser accepted the code
+	 */
+	bool Parse(LintResultsClass& results);
+
+	/**
+	 * Parses the code that the lexer has been opened with using the resource parser,
+	 * or the declaration scanner when that mode is on. All of the resource parser 
+	 * modes (outline, streaming, session) are applied here.
+	 *
+	 * @param range if not NULL, the code is a piece of a file that starts in the 
+	 *        range's scope; the resource parser is always used for these
+	 * @param results the scope is set here
+	 * @return bool TRUE if the parser accepted the code
+	 */
+	bool ResourceParse(const BodyRangeClass* range, LintResultsClass& results);
+
 	/**
 	 * Used to tokenize code
 	 */
@@ -455,6 +720,61 @@ private:
 	 * The PHP version to handle
 	 */
 	Versions Version;
+
+	/**
+	 * if TRUE, function bodies are skipped when the resource parser is used
+	 */
+	bool IsOutline;
+
+	/**
+	 * if TRUE, the declaration scanner is used instead of the resource parser
+	 */
+	bool IsDeclarationScanner;
+
+	/**
+	 * if TRUE, function bodies are skipped when the full parser is used
+	 */
+	bool IsLazy;
+
+	/**
+	 * if TRUE, the resource parser notifies the observers after each top-level statement
+	 */
+	bool IsStreaming;
+
+	/**
+	 * if TRUE, buffers and AST memory are kept between files
+	 */
+	bool IsSession;
+
+	/**
+	 * if TRUE, ParseExpression() tries the expression chain parser first
+	 */
+	bool IsExpressionChain;
+
+	/**
+	 * The AST nodes created by the full parser are allocated here. Keeping the arena
+	 * in this object lets successive ScanFile() calls re-use the same memory blocks.
+	 */
+	AstArenaClass Arena;
+
+	/**
+	 * The state of the parse between Feed() calls; NULL when Feed() has not 
+	 * been called since the last Finish() call.
+	 */
+	PushParserStateClass* PushState;
+
+	/**
+	 * All of the observers that were set or added. The observer pointers above
+	 * point to the only observer of their kind, or to this list when there 
+	 * is more than one.
+	 */
+	ObserverListClass Observers;
+
+	/**
+	 * @return the arena that the resource parser should create its nodes in; NULL
+	 *         when the resource parser should own its nodes
+	 */
+	AstArenaClass* ResourceArena();
 };
 
 
@@ -27,6 +27,7 @@
 
 #include <pelet/Api.h>
 #include <pelet/TokenClass.h>
+#include <pelet/AstArenaClass.h>
 #include <unicode/unistr.h>
 #include <vector>
 #include <map>
@@ -62,6 +63,7 @@ class IncludeExpressionClass;
 class ClosureExpressionClass;
 class IssetExpressionClass;
 class EvalExpressionClass;
+class NamespaceAliasesClass;
 
 /**
  * Case-sensitive string comparator for use as STL Predicate
@@ -73,6 +75,69 @@ public:
 		}
 };
 
+/**
+ * The parts of a class, class member, or function notification that take the most work
+ * to build. An observer returns a combination of these flags from its SymbolFields()
+ * method; the parser will not build the parts that no observer wants, and will pass
+ * an empty string in their place.
+ */
+enum SymbolFields {
+
+	/**
+	 * the function / method signature, and the class signature and implements list
+	 */
+	SYMBOL_SIGNATURES = 1,
+
+	/**
+	 * the PHPDoc comments of classes, functions, methods and properties
+	 */
+	SYMBOL_COMMENTS = 2,
+
+	/**
+	 * the return types of functions and methods and the types of properties, as 
+	 * dictated by the PHPDoc comments
+	 */
+	SYMBOL_RETURN_TYPES = 4,
+
+	SYMBOL_ALL_FIELDS = SYMBOL_SIGNATURES | SYMBOL_COMMENTS | SYMBOL_RETURN_TYPES
+};
+
+/**
+ * One flag for each of the ExpressionClass::ExpressionTypes; the flag for a type is
+ * (1 << type). An expression observer returns a combination of these flags from its 
+ * ExpressionTypes() method; the full parser will not build the expressions
+ * that no observer wants, and will put an UNKNOWN expression in their place. 
+ * Variables, new instances, assignments, list assignments, closures and includes
+ * are always built; the parser itself needs them.
+ */
+enum ExpressionTypeFlags {
+	EXPRESSION_TYPE_SCALAR = 1 << 0,
+	EXPRESSION_TYPE_ARRAY = 1 << 1,
+	EXPRESSION_TYPE_VARIABLE = 1 << 2,
+	EXPRESSION_TYPE_NEW_CALL = 1 << 3,
+	EXPRESSION_TYPE_ASSIGNMENT_COMPOUND = 1 << 4,
+	EXPRESSION_TYPE_BINARY_OPERATION = 1 << 5,
+	EXPRESSION_TYPE_UNARY_OPERATION = 1 << 6,
+	EXPRESSION_TYPE_UNARY_VARIABLE_OPERATION = 1 << 7,
+	EXPRESSION_TYPE_TERNARY_OPERATION = 1 << 8,
+	EXPRESSION_TYPE_INSTANCEOF_OPERATION = 1 << 9,
+	EXPRESSION_TYPE_ARRAY_PAIR = 1 << 10,
+	EXPRESSION_TYPE_INCLUDE = 1 << 11,
+	EXPRESSION_TYPE_CLOSURE = 1 << 12,
+	EXPRESSION_TYPE_ASSIGNMENT = 1 << 13,
+	EXPRESSION_TYPE_ASSIGNMENT_LIST = 1 << 14,
+	EXPRESSION_TYPE_ISSET = 1 << 15,
+	EXPRESSION_TYPE_EVAL = 1 << 16,
+
+	/**
+	 * the types that are built regardless of what the observers want
+	 */
+	EXPRESSION_TYPE_REQUIRED = EXPRESSION_TYPE_VARIABLE | EXPRESSION_TYPE_NEW_CALL | EXPRESSION_TYPE_ASSIGNMENT
+		| EXPRESSION_TYPE_ASSIGNMENT_LIST | EXPRESSION_TYPE_CLOSURE | EXPRESSION_TYPE_INCLUDE,
+
+	EXPRESSION_ALL_TYPES = (1 << 17) - 1
+};
+
 /**
  * Interface to inherit from when needing to be notified when a class structure is encountered.
  * An object of this type will be passed to the ParserClass; the parser will call the appropriate
@@ -82,6 +147,19 @@ public:
 class PELET_API ClassObserverClass {
 
 public:
+
+	/**
+	 * Override this method to tell the parser which of the costly fields
+	 * this observer actually uses; see SymbolFields. Fields that no observer
+	 * wants are left empty. When neither comments nor return types are wanted,
+	 * the parser will not look at PHPDoc comments at all; this means that the magic
+	 * methods and properties declared in class comments (@method, @property) will not 
+	 * be reported either.
+	 *
+	 * @return int a combination of SymbolFields flags. By default, all fields are built.
+	 */
+	virtual int SymbolFields() const;
+
 	/**
 	 * Override this method to perform any custom logic when a class, interface, or trait is found.
 	 * 
@@ -177,6 +255,18 @@ class PELET_API ClassMemberObserverClass {
 
 public:
 
+	/**
+	 * Override this method to tell the parser which of the costly fields
+	 * this observer actually uses; see SymbolFields. Fields that no observer
+	 * wants are left empty. When neither comments nor return types are wanted,
+	 * the parser will not look at PHPDoc comments at all; this means that the magic
+	 * methods and properties declared in class comments (@method, @property) will not 
+	 * be reported either.
+	 *
+	 * @return int a combination of SymbolFields flags. By default, all fields are built.
+	 */
+	virtual int SymbolFields() const;
+
 	/**
 	 * Override this method to perform any custom logic when a class method is found.
 	 * 
@@ -285,6 +375,19 @@ public:
 class PELET_API FunctionObserverClass {
 
 public:
+
+	/**
+	 * Override this method to tell the parser which of the costly fields
+	 * this observer actually uses; see SymbolFields. Fields that no observer
+	 * wants are left empty. When neither comments nor return types are wanted,
+	 * the parser will not look at PHPDoc comments at all; this means that the magic
+	 * methods and properties declared in class comments (@method, @property) will not 
+	 * be reported either.
+	 *
+	 * @return int a combination of SymbolFields flags. By default, all fields are built.
+	 */
+	virtual int SymbolFields() const;
+
 	/**
 	 * Override this method to perform any custom logic when a function is found.
 	 * 
@@ -324,6 +427,16 @@ class PELET_API VariableObserverClass {
 
 public:
 
+	/**
+	 * Override this method to tell the parser which of the costly fields
+	 * this observer actually uses; see SymbolFields. Only SYMBOL_COMMENTS applies
+	 * to variables; when no observer wants comments the PHPDoc comment given
+	 * to VariableFound() is empty.
+	 *
+	 * @return int a combination of SymbolFields flags. By default, all fields are built.
+	 */
+	virtual int SymbolFields() const;
+
 	/**
 	 * Override this method to perform any custom logic when a variable assignment is found. Note that the same 
 	 * variable may be assigned different values at different times within the same function.
@@ -393,6 +506,30 @@ public:
 
 	virtual ~ExpressionObserverClass();
 
+	/**
+	 * Override this method to tell the parser which kinds of expressions this observer
+	 * looks at; see ExpressionTypeFlags. Expressions that no observer wants are
+	 * not built; an UNKNOWN expression takes their place, both at the top level and 
+	 * inside other expressions (the operands of a binary operation, the arguments of
+	 * a function call, etc...). An observer that recurses into expressions (like
+	 * AnyExpressionObserverClass) must ask for every type that can contain the
+	 * types that it looks for. This is ignored when there is a variable observer, since 
+	 * variable observers are given the right hand side of assignments.
+	 *
+	 * @return int a combination of ExpressionTypeFlags. By default, all types are built.
+	 */
+	virtual int ExpressionTypes() const;
+
+	/**
+	 * Override this method to tell the parser which of the costly fields
+	 * this observer actually uses; see SymbolFields. Only SYMBOL_COMMENTS applies
+	 * to expressions; when no observer wants comments the PHPDoc comments of the
+	 * variables in the expressions are empty.
+	 *
+	 * @return int a combination of SymbolFields flags. By default, all fields are built.
+	 */
+	virtual int SymbolFields() const;
+
 	/**
 	 * Override this method to get the pseudo-parse tree for a single variable expression.($x, $x->func())
 	 * This method only gets called when the top-level statement is a variable. See
@@ -593,6 +730,14 @@ public:
 	 */
 	void StatementOwnership(std::vector<pelet::AstItemClass*> statements);
 
+	/**
+	 * this method will take ownership of all of the items in the given arena. after a call
+	 * to this method, the given arena will be empty; it will receive the
+	 * memory blocks that this object used previously so that they can be re-used
+	 * by the next parse. This will usually be called by the parser.
+	 */
+	void StatementOwnership(pelet::AstArenaClass& arena);
+
 	/**
 	 * Cleanup (delete) the statements given to StatementOwnership() This will
 	 * be called when this object goes out of scope, but it can be called earlier if needed.
@@ -606,6 +751,11 @@ private:
 	 * This class will own the pointers.
 	 */
 	std::vector<pelet::AstItemClass*> Statements;
+
+	/**
+	 * the statements given by an arena. This class will own the arena's items.
+	 */
+	pelet::AstArenaClass Arena;
 };
 
 /**
@@ -695,6 +845,11 @@ public:
 		
 	void OnAnyExpression(pelet::ExpressionClass* expression);
 
+	/**
+	 * function calls may be inside of any expression except scalars
+	 */
+	int ExpressionTypes() const;
+
 private:
 
 	int Counter;
@@ -838,10 +993,18 @@ private:
 	/**
 	 * Using a pointer here; if a file does not use namespaces then this 
 	 * property will never get used.
-	 * This object will own this pointer; thus we need to make sure that it
-	 * gets copied when an instance of this object is copied.
+	 * The alias table is reference counted and shared between all copies of a 
+	 * scope; the parser copies the current scope into every expression it 
+	 * creates and a deep copy of the aliases for each expression would be
+	 * wasteful. The table is copied only when a scope that shares it adds 
+	 * an alias (copy-on-write).
+	 */
+	NamespaceAliasesClass* NamespaceAliases;
+
+	/**
+	 * gives up this scope's reference to the alias table.
 	 */
-	std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass>* NamespaceAliases;
+	void ReleaseAliases();
 	
 	/**
 	 * -1 scope is not anonymous
@@ -865,6 +1028,27 @@ class PELET_API AstItemClass {
 		AstItemClass();
 		
 		virtual ~AstItemClass();
+
+		/**
+		 * regular heap allocation; declared here because declaring the arena
+		 * operator new hides the global one
+		 */
+		static void* operator new(size_t size);
+
+		/**
+		 * allocate an item from the given arena. The arena's memory is 
+		 * released in bulk; items allocated this way must NOT be deleted,
+		 * they must be given to AstArenaClass::Adopt() instead.
+		 */
+		static void* operator new(size_t size, pelet::AstArenaClass& arena);
+
+		static void operator delete(void* ptr);
+
+		/**
+		 * only called when a constructor throws during arena allocation;
+		 * the memory stays in the arena.
+		 */
+		static void operator delete(void* ptr, pelet::AstArenaClass& arena);
 };
 
 /**
@@ -986,10 +1170,72 @@ public:
 
 private:
 
-	std::vector<UnicodeString> Namespaces;
+	/**
+	 * the names, separated by backslashes and without the leading backslash. 
+	 * The names are kept in one string instead of one string each so that the 
+	 * common case (a name with no namespace) does not need any heap memory.
+	 */
+	UnicodeString Names;
+
+	/**
+	 * the number of names in Names
+	 */
+	int NameCount;
 		
 };
 
+/**
+ * The location of a function or method body that was skipped over by the parser
+ * (see ParserClass::SetLazyBodyMode). The body can be parsed later on with
+ * ParserClass::ScanBody(). This class also describes a piece of a file that
+ * is parsed on its own with ParserClass::ScanRange(); in that case StartPos is the
+ * first character of the piece, EndPos is the position just after the piece and the 
+ * scope is the namespace scope that is in effect at the start of the piece.
+ */
+class PELET_API BodyRangeClass {
+
+public:
+
+	/**
+	 * the function or method that the body belongs to, including the 
+	 * namespace aliases that were in effect
+	 */
+	pelet::ScopeClass Scope;
+
+	/**
+	 * the namespace that the function or method was declared in
+	 */
+	pelet::QualifiedNameClass DeclaredNamespace;
+
+	/**
+	 * the position of the opening brace of the body. This number is zero based.
+	 */
+	int StartPos;
+
+	/**
+	 * the position of the closing brace of the body. This number is zero based.
+	 */
+	int EndPos;
+
+	/**
+	 * the line of the opening brace of the body. This number is 1-based.
+	 */
+	int LineNumber;
+
+	/**
+	 * the lexer condition right after the opening brace
+	 */
+	YYCONDTYPE Condition;
+
+	BodyRangeClass();
+
+	/**
+	 * @return bool TRUE if the given position is inside of this body, 
+	 *         including the braces
+	 */
+	bool Contains(int pos) const;
+};
+
 /**
  * The VariablePropertyClass represents a single object property of a variable.
  * For example, the variable $this->myFunct()->name->first will have 
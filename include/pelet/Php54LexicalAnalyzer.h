@@ -44,6 +44,17 @@ namespace pelet {
  */
 int Next54Token(BufferClass* buffer, YYCONDTYPE &condition);
 
+/**
+ * Same as above, but tokenizes UTF-8 bytes directly. Tokens are the same as 
+ * with a BufferClass; non-ASCII characters are allowed in the same places as PHP
+ * itself allows them (identifiers, strings, comments).
+ *
+ * @param Utf8BufferClass* buffer contains the code to be tokenized. This function will NOT own the pointer.
+ * @param YYCONDTYPE &condition the current state the the parser is in.
+ * @return int the next token.
+ */
+int Next54Token(Utf8BufferClass* buffer, YYCONDTYPE &condition);
+
 }
 
 #endif
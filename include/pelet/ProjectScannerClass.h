@@ -0,0 +1,225 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_PROJECTSCANNERCLASS_H__
+#define __PELET_PROJECTSCANNERCLASS_H__
+
+#include <pelet/ParserClass.h>
+#include <pelet/Api.h>
+#include <string>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * The ways in which ProjectScannerClass calls the observers
+ */
+enum ProjectScannerDeliveries {
+
+	/**
+	 * observers are called on the worker threads, as soon as the artifacts are found.
+	 * This is the fastest mode, but the observers are called from many threads at
+	 * the same time; the observers MUST be thread-safe.
+	 */
+	DELIVER_ON_WORKER_THREAD,
+
+	/**
+	 * class, class member, and function callbacks are recorded by the workers and 
+	 * replayed on the thread that called ProjectScannerClass::Scan(), one file at a time, 
+	 * in the order that the files finish parsing. The observers need not be thread-safe. 
+	 */
+	DELIVER_SERIALIZED,
+
+	/**
+	 * same as DELIVER_SERIALIZED, but the files are replayed in the same order 
+	 * that they were added to the scanner; the observers get exactly the same 
+	 * sequence of calls from one run to the next regardless of the number of threads.
+	 */
+	DELIVER_IN_ORDER
+};
+
+/**
+ * Gets notified when each file of a project starts and finishes. In the serialized
+ * modes, all of the callbacks for a single file happen between FileStarted() and FileScanned(); 
+ * in DELIVER_ON_WORKER_THREAD mode, these two methods are called on the worker thread 
+ * that parses the file (before and after the file's callbacks).
+ */
+class PELET_API ProjectScannerObserverClass {
+
+public:
+
+	/**
+	 * Called before any of the callbacks of the given file.
+	 *
+	 * @param file the full path of the file, as it was given to the scanner.
+	 */
+	virtual void FileStarted(const std::string& file) { }
+
+	/**
+	 * Called after all of the callbacks of the given file.
+	 *
+	 * @param file the full path of the file, as it was given to the scanner.
+	 * @param parsed TRUE if the file was parsed successfully
+	 * @param results the error (if any) of the file
+	 */
+	virtual void FileScanned(const std::string& file, bool parsed, const pelet::LintResultsClass& results) { }
+};
+
+/**
+ * The ProjectScannerClass parses many files at once; it distributes the files over a pool of
+ * worker threads. Each worker owns one ParserClass that it reuses for all of its files, and 
+ * a worker that runs out of files steals files from the other workers.
+ *
+ * @code
+ *   MyClassObserverClass classObserver;
+ *   pelet::ProjectScannerClass scanner;
+ *   std::vector<std::string> extensions;
+ *   extensions.push_back("php");
+ *   scanner.AddDirectory("/home/user/project", extensions);
+ *   scanner.SetClassObserver(&classObserver);
+ *   scanner.SetDelivery(pelet::DELIVER_IN_ORDER);
+ *   scanner.Scan();
+ * @endcode
+ *
+ * The variable and expression observers get AST objects that are only valid during
+ * the callback, so they cannot be recorded; they are always called on the worker thread
+ * (regardless of the delivery). The expression observer also takes ownership of the
+ * statements of each file, so it cannot be shared by many parsers; when a variable or
+ * expression observer is set, the scanner uses a single worker thread regardless of
+ * SetThreadCount().
+ *
+ * This class is not thread-safe; only one thread should call its methods.
+ */
+class PELET_API ProjectScannerClass {
+
+public:
+
+	ProjectScannerClass();
+
+	/**
+	 * add a file to be scanned.
+	 *
+	 * @param file full path to the file
+	 */
+	void AddFile(const std::string& file);
+
+	/**
+	 * recursively add all of the files in the given directory that have one of the 
+	 * given extensions. Files are added in a stable (sorted) order so that 
+	 * DELIVER_IN_ORDER gives the same results on all machines.
+	 *
+	 * @param rootDir the directory to look in
+	 * @param extensions the file extensions to add, without the dot (ie. "php"). The comparison 
+	 *        ignores case.
+	 * @return int the number of files that were added
+	 */
+	int AddDirectory(const std::string& rootDir, const std::vector<std::string>& extensions);
+
+	/**
+	 * remove all of the files to be scanned
+	 */
+	void ClearFiles();
+
+	/**
+	 * @return the files that will be scanned
+	 */
+	const std::vector<std::string>& GetFiles() const;
+
+	/**
+	 * @param count the number of worker threads to use. Zero (the default) means one thread
+	 *        per processor. Ignored when a variable or expression observer is set; those 
+	 *        scans always use one worker thread.
+	 */
+	void SetThreadCount(int count);
+
+	/**
+	 * Change the way the observers are called. The default is DELIVER_ON_WORKER_THREAD.
+	 */
+	void SetDelivery(ProjectScannerDeliveries delivery);
+
+	/**
+	 * Change the version that the parsers will handle.
+	 */
+	void SetVersion(Versions version);
+
+	/**
+	 * Change the way that the parsers read files.
+	 */
+	void SetFileBufferType(FileBufferTypes type);
+
+	void SetProjectObserver(ProjectScannerObserverClass* observer);
+
+	void SetClassObserver(ClassObserverClass* observer);
+
+	void SetClassMemberObserver(ClassMemberObserverClass* observer);
+
+	void SetFunctionObserver(FunctionObserverClass* observer);
+
+	void SetVariableObserver(VariableObserverClass* observer);
+
+	void SetExpressionObserver(ExpressionObserverClass* observer);
+
+	/**
+	 * Parse all of the files. This method will return once all of the files have been
+	 * parsed and all of the observers have been called.
+	 *
+	 * @return bool TRUE if all of the files were parsed successfully; the errors are given
+	 *         to ProjectScannerObserverClass::FileScanned()
+	 */
+	bool Scan();
+
+private:
+
+	/**
+	 * the files to scan, in the order they were added
+	 */
+	std::vector<std::string> Files;
+
+	ProjectScannerObserverClass* ProjectObserver;
+
+	ClassObserverClass* ClassObserver;
+
+	ClassMemberObserverClass* ClassMemberObserver;
+
+	FunctionObserverClass* FunctionObserver;
+
+	VariableObserverClass* VariableObserver;
+
+	ExpressionObserverClass* ExpressionObserver;
+
+	/**
+	 * the number of worker threads, zero for one per processor
+	 */
+	int ThreadCount;
+
+	ProjectScannerDeliveries Delivery;
+
+	Versions Version;
+
+	FileBufferTypes FileBufferType;
+};
+
+}
+
+#endif
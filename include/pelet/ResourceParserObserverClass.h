@@ -27,6 +27,7 @@
 
 #include <pelet/ParserTypeClass.h>
 #include <pelet/LexicalAnalyzerClass.h>
+#include <pelet/BodyWatcherClass.h>
 
 namespace pelet {
 
@@ -78,6 +79,32 @@ public:
 	 */
 	bool HasCallToFuncGetArg;
 
+	/**
+	 * If TRUE, then the bodies of functions, methods and closures are not parsed; ResourceLex()
+	 * skips over them by matching braces and gives the parser an empty body. This is the
+	 * "outline" mode; only declarations are found. func_get_args() calls are still detected,
+	 * but define() calls, includes, and properties assigned inside of bodies are not.
+	 */
+	bool DoSkipBodies;
+
+	/**
+	 * If TRUE, then the observers are notified as soon as each top-level statement has
+	 * been parsed instead of after the entire code has been parsed, and the AST items of
+	 * the statement are deleted right after (see ReleaseStatements()). This is used when the
+	 * code is given in pieces (ParserClass::Feed()) and in streaming mode; the observers 
+	 * may then be notified of the items before a syntax error, and memory use does not grow
+	 * with the size of the file. Statements inside of a namespace block are notified
+	 * when the block ends.
+	 */
+	bool DoNotifyEachStatement;
+
+	/**
+	 * If TRUE, then ResourceLex() will attach PHPDoc comments to the lexemes. This is 
+	 * turned off when none of the observers want comments nor return types 
+	 * (see ClassObserverClass::SymbolFields()), since both are read from the comments.
+	 */
+	bool DoCaptureComments;
+
 	/**
 	 * This object will NOT own the observer pointers.
 	 * pointers must not be NULL.
@@ -91,10 +118,58 @@ public:
 	/**
 	 * @param astItem the pointer to manager.  Once this method is called, this
 	 *        object will own the given pointer. The pointer will be deleted when
-	 *        this object goes out of scope.
+	 *        this object goes out of scope; or when the arena is reset if this
+	 *        object was given an arena.
 	 */
 	void Adopt(pelet::AstItemClass* astItem);
 
+	/**
+	 * Same as Adopt(), used for the lexemes that are given to the parser. The last
+	 * lexeme may be the parser's lookahead token, so it is kept by ReleaseStatements().
+	 */
+	void AdoptToken(pelet::SemanticValueClass* value);
+
+	/**
+	 * Deletes all of the AST items that have been adopted so far, except for the given 
+	 * list and the last token. This is called after a top-level statement has been 
+	 * given to the observers, when none of the other items are used by the parser anymore.
+	 *
+	 * @param keep the top statement list, it is still used by the parser. The list is
+	 *        emptied since its statements are deleted.
+	 */
+	void ReleaseStatements(pelet::StatementListClass* keep);
+
+	/**
+	 * The namespace block methods keep track of when the parser is inside of a
+	 * "namespace name { }" block; the statements inside of the block are notified
+	 * when the block ends, that way the namespace declaration is always notified first.
+	 */
+	void BeginNamespaceBlock();
+
+	void EndNamespaceBlock();
+
+	/**
+	 * @return bool TRUE if the parser is not inside of a namespace block
+	 */
+	bool IsAtTopLevel() const;
+
+	/**
+	 * When set, the AST items are created in the given arena and given to it 
+	 * instead of being owned by this object; the arena's owner is responsible for
+	 * resetting it after the parse. This saves a heap allocation for each item 
+	 * when many files are parsed with the same arena.
+	 * An arena cannot be used when each statement is released as it is parsed, since
+	 * that needs to own individual items.
+	 *
+	 * @param arena the arena to allocate from; this object will NOT own the pointer
+	 */
+	void SetArena(pelet::AstArenaClass* arena);
+
+	/**
+	 * @return the arena given to SetArena(); may be NULL
+	 */
+	pelet::AstArenaClass* GetArena() const;
+
 	/**
 	 * add an assigned property.
 	 */
@@ -126,11 +201,34 @@ public:
 	void SetCurrentMemberName(pelet::SemanticValueClass* value);
 	
 	void SetDeclaredNamespace(pelet::QualifiedNameClass* qualifiedName);
+
+	/**
+	 * Sets the namespace and the namespace aliases that are in effect at the start of
+	 * the code; used when parsing starts in the middle of a file (ParserClass::ScanRange()).
+	 *
+	 * @param scope the namespace name and aliases; the class and method names are ignored
+	 * @param declaredNamespace the namespace declared before the code
+	 */
+	void SetStartingScope(const pelet::ScopeClass& scope, const pelet::QualifiedNameClass& declaredNamespace);
 	
 	void IncrementAnonymousFunctionCount();
 	
 	void EndAnonymousFunction();
 
+	/**
+	 * Keeps track of the tokens that are given to the parser so that the start
+	 * of a function body can be found.  Only used when DoSkipBodies is set.
+	 *
+	 * @param token the token that will be given to the parser
+	 */
+	void WatchBodyToken(int token);
+
+	/**
+	 * @return bool TRUE if the last token given to the parser was the opening
+	 *         brace of a function, method or closure body
+	 */
+	bool IsBodyStart() const;
+
 	const pelet::ScopeClass& GetScope() const;
 
 	const pelet::QualifiedNameClass& GetDeclaredNamespace() const;
@@ -172,6 +270,31 @@ private:
 	 * This object will NOT own the pointer
 	 */
 	FunctionObserverClass* Function;
+
+	/**
+	 * the SymbolFields wanted by each of the observers; 0 when there is no observer
+	 */
+	int ClassFields;
+
+	int MemberFields;
+
+	int FunctionFields;
+
+	/**
+	 * This object will NOT own the pointer; may be NULL
+	 */
+	AstArenaClass* Arena;
+
+	/**
+	 * the last item given to AdoptToken(); it is owned by AllStatements
+	 */
+	pelet::AstItemClass* LastToken;
+
+	/**
+	 * the number of namespace blocks that the parser is in; this can only be 0 or 1
+	 * in valid code
+	 */
+	int NamespaceBlockDepth;
 	
 	/**
 	 * -1 scope is not anonymous
@@ -181,6 +304,11 @@ private:
 	 *  3+ ...
 	 */
 	int AnonymousFunctionCount;
+
+	/**
+	 * used to find the start of function bodies
+	 */
+	BodyWatcherClass BodyWatcher;
 };
 
 /**
@@ -0,0 +1,170 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_SPLITFILEPARSERCLASS_H__
+#define __PELET_SPLITFILEPARSERCLASS_H__
+
+#include <pelet/ParserClass.h>
+#include <pelet/Api.h>
+#include <string>
+
+namespace pelet {
+
+/**
+ * The SplitFileParserClass parses a single large file on many threads. The file is
+ * first lexed once (without being parsed) to find the top-level class, interface,
+ * trait and function declarations, ie. the ones that are at brace depth zero while
+ * the lexer is in the script state and that come right after a ';' or a '}'. The
+ * file is split into pieces right before some of those declarations, and each piece 
+ * is parsed by its own ParserClass on a worker thread, starting with the namespace
+ * and the namespace aliases that were declared in the pieces before it. 
+ *
+ * The callbacks of each piece are recorded and replayed on the thread that called
+ * ScanFile(), in the same order as a sequential parse would make them, so the 
+ * observers need not be thread-safe.
+ *
+ * The split points are guesses; a declaration can be at brace depth zero and still 
+ * be inside of a statement (for example the alternative "if (): endif;" syntax). When
+ * a piece does not parse, the pieces before it are kept and the rest of the file 
+ * is parsed sequentially, starting at the beginning of that piece; the errors are 
+ * then the errors of that parse. Files that use the braced namespace syntax are 
+ * always parsed sequentially.
+ *
+ * Only the class, class member and function observers are supported; the variable
+ * and expression observers need the full parser, which cannot start in the middle
+ * of a file.
+ *
+ * @code
+ *   MyClassObserverClass classObserver;
+ *   pelet::SplitFileParserClass parser;
+ *   parser.SetClassObserver(&classObserver);
+ *   pelet::LintResultsClass results;
+ *   parser.ScanFile("/home/user/project/vendor/big_generated_file.php", results);
+ * @endcode
+ *
+ * This class is not thread-safe; only one thread should call its methods.
+ */
+class PELET_API SplitFileParserClass {
+
+public:
+
+	SplitFileParserClass();
+
+	/**
+	 * @param count the number of worker threads to use. Zero (the default) means one thread
+	 *        per processor.
+	 */
+	void SetThreadCount(int count);
+
+	/**
+	 * @param length the smallest number of characters in a piece; pieces are made
+	 *        larger than this when the file is large so that there are a few
+	 *        pieces for each thread. Files shorter than twice this length are parsed 
+	 *        sequentially. The default is 64K characters.
+	 */
+	void SetChunkLength(int length);
+
+	/**
+	 * Change the version that the parsers will handle.
+	 */
+	void SetVersion(Versions version);
+
+	void SetClassObserver(ClassObserverClass* observer);
+
+	void SetClassMemberObserver(ClassMemberObserverClass* observer);
+
+	void SetFunctionObserver(FunctionObserverClass* observer);
+
+	/**
+	 * Parse the given file. The file is read entirely into memory. This method will 
+	 * return once all of the observers have been called.
+	 *
+	 * @param file the file to parse. Must be a full path.
+	 * @param results any error message will be populated here
+	 * @return bool if file was found and could be parsed successfully
+	 */
+	bool ScanFile(const std::string& file, LintResultsClass& results);
+
+	/**
+	 * Same as ScanFile() but parses the given code
+	 *
+	 * @param code the code to parse; like ParserClass::ScanFile() the code
+	 *        starts with inline HTML
+	 * @param results any error message will be populated here
+	 * @return bool if code could be parsed successfully
+	 */
+	bool ScanString(const UnicodeString& code, LintResultsClass& results);
+
+	/**
+	 * @return the number of pieces that the last file was split into; 1 when 
+	 *         the file was parsed sequentially
+	 */
+	int GetChunkCount() const;
+
+	/**
+	 * @return bool TRUE if one of the pieces of the last file did not parse and
+	 *         the rest of the file was parsed sequentially
+	 */
+	bool WasFallback() const;
+
+private:
+
+	/**
+	 * parses the given characters
+	 *
+	 * @param code the characters, code[length] must be NULL. The characters are
+	 *        modified during the parse and restored afterwards.
+	 * @param length the number of characters in code
+	 */
+	bool Scan(UChar* code, int length, LintResultsClass& results);
+
+	ClassObserverClass* ClassObserver;
+
+	ClassMemberObserverClass* ClassMemberObserver;
+
+	FunctionObserverClass* FunctionObserver;
+
+	/**
+	 * the number of worker threads, zero for one per processor
+	 */
+	int ThreadCount;
+
+	int ChunkLength;
+
+	Versions Version;
+
+	/**
+	 * the number of pieces of the last file
+	 */
+	int ChunkCount;
+
+	/**
+	 * TRUE if the last file was finished with a sequential parse
+	 */
+	bool IsFallback;
+};
+
+}
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_SYMBOLCACHECLASS_H__
+#define __PELET_SYMBOLCACHECLASS_H__
+
+#include <pelet/ParserClass.h>
+#include <pelet/SymbolRecorderClass.h>
+#include <pelet/Utf8BufferClass.h>
+#include <pelet/Api.h>
+#include <string>
+#include <map>
+
+namespace pelet {
+
+/**
+ * The SymbolCacheClass remembers the class, class member, and function callbacks 
+ * that the parser made for each file, and stores them in a cache file. When a file 
+ * has not changed since it was cached, ScanFile() replays the cached callbacks
+ * instead of parsing the file again.
+ *
+ * A file is considered unchanged when its size and modification time are the same 
+ * as when it was cached; when only the modification time is different (a version 
+ * control checkout, for example) the file contents are hashed and compared.
+ *
+ * The cache file is memory-mapped by Load() and the callbacks of a file are 
+ * only decoded when that file is scanned. Only files that parsed successfully are 
+ * cached; files with syntax errors are always parsed.
+ *
+ * @code
+ *   pelet::SymbolCacheClass cache;
+ *   cache.SetClassObserver(&classObserver);
+ *   cache.Load("/home/user/.ide/symbols.cache");
+ *   for (size_t i = 0; i < files.size(); ++i) {
+ *     pelet::LintResultsClass results;
+ *     cache.ScanFile(files[i], results);
+ *   }
+ *   cache.Save("/home/user/.ide/symbols.cache");
+ * @endcode
+ *
+ * This class is not thread-safe.
+ */
+class PELET_API SymbolCacheClass {
+
+public:
+
+	SymbolCacheClass();
+
+	/**
+	 * Change the version of PHP that files are parsed as. This needs to be called BEFORE Load(); 
+	 * a cache file that was saved for another version will not be loaded.
+	 */
+	void SetVersion(Versions version);
+
+	void SetClassObserver(ClassObserverClass* observer);
+
+	void SetClassMemberObserver(ClassMemberObserverClass* observer);
+
+	void SetFunctionObserver(FunctionObserverClass* observer);
+
+	/**
+	 * Loads the given cache file. Any files cached before this call are removed.
+	 *
+	 * @param cacheFile the full path to the cache file
+	 * @return bool FALSE if the cache file does not exist, is not valid, or was saved
+	 *         for another PHP version; in this case the cache is empty.
+	 */
+	bool Load(const std::string& cacheFile);
+
+	/**
+	 * Writes all of the cached files to the given cache file.
+	 *
+	 * @param cacheFile the full path to the cache file
+	 * @return bool FALSE if the file could not be written
+	 */
+	bool Save(const std::string& cacheFile);
+
+	/**
+	 * Removes all cached files. This does not touch any cache file.
+	 */
+	void Clear();
+
+	/**
+	 * Calls the observers with the classes, members, and functions of the given file; either 
+	 * from the cache when the file has not changed or by parsing it (and then caching the results). 
+	 * When the file is parsed the observers are called after the entire file has been parsed.
+	 *
+	 * @param file the full path of the file to scan
+	 * @param results the error, if the file could not be parsed
+	 * @return bool TRUE if the file was found in the cache or parsed successfully
+	 */
+	bool ScanFile(const std::string& file, LintResultsClass& results);
+
+	/**
+	 * @return the number of ScanFile() calls that used the cache
+	 */
+	int GetHitCount() const;
+
+	/**
+	 * @return the number of ScanFile() calls that parsed the file
+	 */
+	int GetMissCount() const;
+
+private:
+
+	/**
+	 * the cached callbacks of one file
+	 */
+	class EntryClass {
+
+	public:
+
+		/**
+		 * the file size when it was parsed
+		 */
+		long long Size;
+
+		/**
+		 * the file modification time when it was parsed
+		 */
+		long long ModifiedTime;
+
+		/**
+		 * hash of the file contents
+		 */
+		unsigned long long Hash;
+
+		/**
+		 * the callbacks, as written by SymbolRecorderClass::Write(); points to either
+		 * the memory-mapped cache file, Image, or Owned
+		 */
+		const char* Data;
+
+		/**
+		 * number of bytes in Data
+		 */
+		size_t Length;
+
+		/**
+		 * the callbacks of a file that was parsed since the cache was loaded 
+		 */
+		std::string Owned;
+
+		EntryClass();
+	};
+
+	/**
+	 * builds the file entries from the contents of a cache file
+	 *
+	 * @return bool FALSE if the contents are not valid
+	 */
+	bool Index(const char* bytes, size_t length);
+
+	/**
+	 * the cached files, keyed by full path
+	 */
+	std::map<std::string, EntryClass> Entries;
+
+	/**
+	 * the cache file given to Load()
+	 */
+	Utf8BufferClass Mapping;
+
+	/**
+	 * the contents of the cache file that was last saved
+	 */
+	std::string Image;
+
+	/**
+	 * used to parse files that are not cached
+	 */
+	ParserClass Parser;
+
+	/**
+	 * records the callbacks of a file when it is parsed and holds the 
+	 * callbacks of a file when it is replayed
+	 */
+	SymbolRecorderClass Recorder;
+
+	ClassObserverClass* ClassObserver;
+
+	ClassMemberObserverClass* ClassMemberObserver;
+
+	FunctionObserverClass* FunctionObserver;
+
+	Versions Version;
+
+	int HitCount;
+
+	int MissCount;
+};
+
+}
+
+#endif
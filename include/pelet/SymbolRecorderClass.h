@@ -0,0 +1,201 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_SYMBOLRECORDERCLASS_H__
+#define __PELET_SYMBOLRECORDERCLASS_H__
+
+#include <pelet/ParserTypeClass.h>
+#include <pelet/Api.h>
+#include <unicode/unistr.h>
+#include <string>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * A single observer callback, recorded by the SymbolRecorderClass. The string 
+ * arguments are stored in the recorder, in the same order as the callback's arguments.
+ */
+class PELET_API SymbolEventClass {
+
+public:
+
+	enum Types {
+		CLASS_FOUND,
+		CLASS_END,
+		DEFINE_DECLARATION_FOUND,
+		INCLUDE_FOUND,
+		NAMESPACE_DECLARATION_FOUND,
+		NAMESPACE_USE_FOUND,
+		METHOD_FOUND,
+		PROPERTY_FOUND,
+		METHOD_SCOPE,
+		TRAIT_USE_FOUND,
+		TRAIT_ALIAS_FOUND,
+		TRAIT_INSTEAD_OF_FOUND,
+		FUNCTION_FOUND,
+		FUNCTION_SCOPE
+	};
+
+	Types Type;
+
+	/**
+	 * index into SymbolRecorderClass::Strings of the first string argument
+	 */
+	size_t FirstString;
+
+	/**
+	 * line numbers, positions; for TRAIT_INSTEAD_OF_FOUND the first one is 
+	 * the number of strings in the insteadof list
+	 */
+	int Ints[2];
+
+	/**
+	 * isStatic, isConst, hasVariableArguments (depending on the Type)
+	 */
+	bool Flags[2];
+
+	TokenClass::TokenIds Visibility;
+
+	SymbolEventClass(Types type, size_t firstString);
+};
+
+/**
+ * The SymbolRecorderClass records the class, class member, and function 
+ * callbacks that the parser makes so that they can be replayed later, possibly
+ * on another thread or after being stored in a file.
+ *
+ * @code
+ *   pelet::SymbolRecorderClass recorder;
+ *   parser.SetClassObserver(&recorder);
+ *   parser.SetClassMemberObserver(&recorder);
+ *   parser.SetFunctionObserver(&recorder);
+ *   parser.ScanFile(file, results);
+ *
+ *   // later
+ *   recorder.Replay(&myClassObserver, &myMemberObserver, &myFunctionObserver);
+ * @endcode
+ */
+class PELET_API SymbolRecorderClass : public ClassObserverClass, public ClassMemberObserverClass, public FunctionObserverClass {
+
+public:
+
+	/**
+	 * the callbacks, in the order that they were made
+	 */
+	std::vector<SymbolEventClass> Events;
+
+	/**
+	 * the string arguments of all of the callbacks
+	 */
+	std::vector<UnicodeString> Strings;
+
+	SymbolRecorderClass();
+
+	/**
+	 * remove all recorded callbacks
+	 */
+	void Clear();
+
+	/**
+	 * call the observers with the recorded callbacks, in the same order that they 
+	 * were recorded.
+	 *
+	 * @param classObserver the observer for class callbacks; may be NULL
+	 * @param memberObserver the observer for class member callbacks; may be NULL
+	 * @param functionObserver the observer for function callbacks; may be NULL
+	 */
+	void Replay(ClassObserverClass* classObserver, ClassMemberObserverClass* memberObserver, 
+		FunctionObserverClass* functionObserver) const;
+
+	/**
+	 * Appends the recorded callbacks to the given bytes in a compact binary 
+	 * form; strings are stored as UTF-8 and numbers as little endian so the 
+	 * bytes can be read on any machine.
+	 *
+	 * @param bytes the string to append to
+	 */
+	void Write(std::string& bytes) const;
+
+	/**
+	 * Replaces the recorded callbacks with the ones in the given bytes.
+	 *
+	 * @param bytes the bytes that were created with Write(); they do not need to be aligned 
+	 * @param length the number of bytes
+	 * @return bool FALSE if the bytes are not valid; in this case the recorder is empty
+	 */
+	bool Read(const char* bytes, size_t length);
+
+	void ClassFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& signature, const UnicodeString& baseClassName, 
+		const UnicodeString& implementInterfaceNames, const UnicodeString& comment, const int lineNumber);
+
+	void ClassEnd(const UnicodeString& namespaceName, const UnicodeString& className, int pos);
+
+	void DefineDeclarationFound(const UnicodeString& namespaceName, const UnicodeString& variableName, 
+		const UnicodeString& variableValue, const UnicodeString& comment, const int lineNumber);
+
+	void IncludeFound(const UnicodeString& filename, const int lineNumber);
+
+	void NamespaceDeclarationFound(const UnicodeString& namespaceName, int startingPos);
+
+	void NamespaceUseFound(const UnicodeString& namespaceName, const UnicodeString& alias, int lineNumber, int startingPos);
+
+	void MethodFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& methodName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, 
+		TokenClass::TokenIds visibility, bool isStatic, const int lineNumber, bool hasVariableArguments);
+
+	void PropertyFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& propertyName, 
+		const UnicodeString& propertyType, const UnicodeString& comment, 
+		TokenClass::TokenIds visibility, bool isConst, bool isStatic, const int lineNumber);
+
+	void MethodScope(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& methodName, int startingPos, int endingPos);
+
+	void TraitUseFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& fullyQualifiedTraitName);
+
+	void TraitAliasFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, const UnicodeString& alias, TokenClass::TokenIds visibility);
+
+	void TraitInsteadOfFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, const std::vector<UnicodeString>& insteadOfList);
+
+	void FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+		bool hasVariableArguments);
+
+	void FunctionScope(const UnicodeString& namespaceName, const UnicodeString& functionName, int startingPos, int endingPos);
+
+private:
+
+	/**
+	 * adds an event whose strings will be the strings added after this call
+	 */
+	SymbolEventClass& Add(SymbolEventClass::Types type);
+};
+
+}
+
+#endif
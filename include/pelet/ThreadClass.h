@@ -0,0 +1,249 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_THREADCLASS_H__
+#define __PELET_THREADCLASS_H__
+
+#include <pelet/Api.h>
+
+namespace pelet {
+
+/**
+ * A thin wrapper around the native mutex (pthreads on POSIX, critical sections on 
+ * Windows). pelet does not depend on any threading library; these classes
+ * are all that the multi-threaded scanners need.
+ */
+class PELET_API MutexClass {
+
+public:
+
+	MutexClass();
+
+	~MutexClass();
+
+	void Lock();
+
+	void Unlock();
+
+private:
+
+	friend class ConditionClass;
+
+	/**
+	 * disable copying, a native mutex cannot be copied
+	 */
+	MutexClass(const MutexClass& other);
+
+	MutexClass& operator=(const MutexClass& other);
+
+	/**
+	 * the native mutex. This class owns the pointer.
+	 */
+	void* Handle;
+};
+
+/**
+ * Locks the given mutex for the lifetime of this object.
+ */
+class PELET_API MutexLockerClass {
+
+public:
+
+	MutexLockerClass(MutexClass& mutex);
+
+	~MutexLockerClass();
+
+private:
+
+	MutexLockerClass(const MutexLockerClass& other);
+
+	MutexLockerClass& operator=(const MutexLockerClass& other);
+
+	MutexClass& Mutex;
+};
+
+/**
+ * A wrapper around the native condition variable.
+ */
+class PELET_API ConditionClass {
+
+public:
+
+	ConditionClass();
+
+	~ConditionClass();
+
+	/**
+	 * Releases the given mutex and waits until the condition is signaled; the mutex 
+	 * is locked again before this method returns. As with any condition variable, 
+	 * the caller must re-check its predicate after waking up.
+	 *
+	 * @param mutex the mutex that the caller has locked
+	 */
+	void Wait(MutexClass& mutex);
+
+	/**
+	 * wake up one waiting thread
+	 */
+	void Signal();
+
+	/**
+	 * wake up all waiting threads
+	 */
+	void Broadcast();
+
+private:
+
+	ConditionClass(const ConditionClass& other);
+
+	ConditionClass& operator=(const ConditionClass& other);
+
+	/**
+	 * the native condition variable. This class owns the pointer.
+	 */
+	void* Handle;
+};
+
+/**
+ * A flag that one thread sets to ask a parse that is running in another thread
+ * to stop. The token can also cancel itself after a deadline. The lexer only 
+ * looks at the token every so many tokens, so a parse stops shortly after 
+ * the token is cancelled, not right away.
+ */
+class PELET_API CancelTokenClass {
+
+public:
+
+	CancelTokenClass();
+
+	/**
+	 * Ask the parse that uses this token to stop.
+	 */
+	void Cancel();
+
+	/**
+	 * Cancel this token once the given amount of time has passed.
+	 *
+	 * @param milliseconds the time from now; zero or less removes the deadline
+	 */
+	void SetDeadline(int milliseconds);
+
+	/**
+	 * Clears the cancel flag and the deadline so that the token can be used for 
+	 * another parse.
+	 */
+	void Reset();
+
+	/**
+	 * @return bool TRUE if Cancel() was called or the deadline has passed
+	 */
+	bool IsCancelled();
+
+private:
+
+	CancelTokenClass(const CancelTokenClass& other);
+
+	CancelTokenClass& operator=(const CancelTokenClass& other);
+
+	/**
+	 * guards the flag and the deadline
+	 */
+	MutexClass Mutex;
+
+	/**
+	 * the time, in milliseconds, at which this token is cancelled. Zero when
+	 * there is no deadline.
+	 */
+	double Deadline;
+
+	/**
+	 * TRUE after Cancel() is called
+	 */
+	bool Cancelled;
+};
+
+/**
+ * A native thread. Subclasses implement Run(); the thread starts running when
+ * Start() is called. Join() must be called before the object is destroyed.
+ */
+class PELET_API ThreadClass {
+
+public:
+
+	ThreadClass();
+
+	virtual ~ThreadClass();
+
+	/**
+	 * Start running Run() in a new thread.
+	 *
+	 * @return bool false if the thread could not be created
+	 */
+	bool Start();
+
+	/**
+	 * Wait for the thread to finish. It is safe to call this method when the 
+	 * thread was never started.
+	 */
+	void Join();
+
+	/**
+	 * @return the number of processors in this machine, at least 1
+	 */
+	static int ProcessorCount();
+
+	/**
+	 * Lets the other threads run; the calling thread is put at the back of the
+	 * queue of threads that are ready to run. Used by threads that wait for another
+	 * thread without a lock.
+	 */
+	static void GiveUpTimeSlice();
+
+protected:
+
+	/**
+	 * The work that the thread will do.
+	 */
+	virtual void Run() = 0;
+
+private:
+
+	/**
+	 * holds the entry point given to the native thread API
+	 */
+	friend class ThreadEntryClass;
+
+	ThreadClass(const ThreadClass& other);
+
+	ThreadClass& operator=(const ThreadClass& other);
+
+	/**
+	 * the native thread handle. This class owns the pointer.
+	 */
+	void* Handle;
+};
+
+}
+
+#endif
@@ -27,6 +27,7 @@
 
 #include <pelet/Api.h>
 #include <pelet/UCharBufferedFileClass.h>
+#include <pelet/Utf8BufferClass.h>
 #include <unicode/unistr.h>
 
 namespace pelet {
@@ -54,6 +55,11 @@ enum Tokens {
 	T_ERROR_UNTERMINATED_STRING = -2,
 	T_ERROR_UNTERMINATED_BACKTICK = -3,
 
+	/**
+	 * the cancel token given to the lexer was cancelled; see LexicalAnalyzerClass::SetCancelToken()
+	 */
+	T_ERROR_CANCELLED = -4,
+
 	/**
 	 * token the signifies the end of the input
 	 */
@@ -288,6 +294,11 @@ int SkipToIdentifier(BufferClass* buffer, UnicodeString identifier);
  */
 int HandleNowdoc(BufferClass* buffer);
 
+/**
+ * Same as above, for the UTF-8 lexers
+ */
+int HandleNowdoc(Utf8BufferClass* buffer);
+
 /**
  * This function will advance the current pointer of the buffer all the way until
  * it encounters the end of the nowdoc. It will leave the ending semicolon in the stream to be consumed
@@ -298,6 +309,11 @@ int HandleNowdoc(BufferClass* buffer);
  */
 int HandleHeredoc(BufferClass* buffer);
 
+/**
+ * Same as above, for the UTF-8 lexers
+ */
+int HandleHeredoc(Utf8BufferClass* buffer);
+
 }
 
 #endif
\ No newline at end of file
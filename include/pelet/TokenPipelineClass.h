@@ -0,0 +1,222 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_TOKENPIPELINECLASS_H__
+#define __PELET_TOKENPIPELINECLASS_H__
+
+#include <pelet/LexicalAnalyzerClass.h>
+#include <pelet/ThreadClass.h>
+#include <pelet/Api.h>
+#include <unicode/unistr.h>
+#include <string>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * A token that was lexed ahead of the parser, with everything that the parsers ask 
+ * the lexer about the token.
+ */
+class PELET_API TokenRecordClass {
+
+public:
+
+	/**
+	 * the lexeme, as given by LexicalAnalyzerClass::GetLexeme() (quotes removed and 
+	 * escapes handled)
+	 */
+	UnicodeString Lexeme;
+
+	/**
+	 * the token ID, see LexicalAnalyzerClass::NextToken()
+	 */
+	int Token;
+
+	/**
+	 * the character position that the lexer is at after the token, as given by 
+	 * LexicalAnalyzerClass::GetCharacterPosition(). This number is 0-based.
+	 */
+	int Pos;
+
+	/**
+	 * the number of characters in the token, as given by LexicalAnalyzerClass::GetTokenLength()
+	 */
+	int Length;
+
+	/**
+	 * the line that the lexer is at after the token. This number is 1-based.
+	 */
+	int LineNumber;
+
+	/**
+	 * the lexer state after the token
+	 */
+	YYCONDTYPE Condition;
+
+	/**
+	 * the value that LexicalAnalyzerClass::GetLexeme() returned
+	 */
+	bool HasLexeme;
+
+	TokenRecordClass();
+};
+
+/**
+ * The TokenPipelineClass lexes a file on its own thread, ahead of the parser. The 
+ * lexer thread puts the tokens in a fixed-size ring and the parser's thread takes 
+ * them out in order; there is exactly one thread on each side so the ring needs no
+ * locks, each side only writes its own counter. A side that finds the ring full (or
+ * empty) gives up its time slice until the other side catches up.
+ *
+ * This class is used by the LexicalAnalyzerClass in pipeline mode 
+ * (see LexicalAnalyzerClass::SetPipelineMode()); the parsers do not use it directly.
+ */
+class PELET_API TokenPipelineClass : public ThreadClass {
+
+public:
+
+	TokenPipelineClass();
+
+	~TokenPipelineClass();
+
+	/**
+	 * opens the given file and starts lexing it on the pipeline's thread.
+	 *
+	 * @param file the full path to the file
+	 * @param version the PHP version to lex
+	 * @param type the way to read the file
+	 * @return bool FALSE if the file could not be opened or the thread could not be started
+	 */
+	bool OpenFile(const std::string& file, Versions version, FileBufferTypes type);
+
+	/**
+	 * starts lexing the given code on the pipeline's thread; the lexer starts
+	 * in the script state, just like LexicalAnalyzerClass::OpenString().
+	 *
+	 * @param code the code to lex; it is copied
+	 * @param version the PHP version to lex
+	 * @return bool FALSE if the code is empty or the thread could not be started
+	 */
+	bool OpenString(const UnicodeString& code, Versions version);
+
+	/**
+	 * stops the pipeline's thread and releases the code.
+	 */
+	void Close();
+
+	/**
+	 * Gets the next token, waiting for the pipeline's thread if the token has
+	 * not been lexed yet. The previous token is given back to the ring. Once the
+	 * last token (a terminating token) has been reached, it is returned again
+	 * on each call.
+	 *
+	 * @return the next token
+	 */
+	const TokenRecordClass& Next();
+
+	/**
+	 * @return the token that was last returned by Next()
+	 */
+	const TokenRecordClass& Current() const;
+
+protected:
+
+	void Run();
+
+private:
+
+	/**
+	 * lexes into the ring until the last token or until the pipeline is closed
+	 */
+	void Produce();
+
+	/**
+	 * starts the thread on code that the lexer has opened
+	 */
+	bool StartLexing();
+
+	/**
+	 * the ring of tokens
+	 */
+	std::vector<TokenRecordClass> Records;
+
+	/**
+	 * the token returned before the first call to Next()
+	 */
+	TokenRecordClass Initial;
+
+	/**
+	 * the lexer that runs on the pipeline's thread
+	 */
+	LexicalAnalyzerClass Lexer;
+
+	/**
+	 * the number of tokens that have been put in the ring. Only written by 
+	 * the pipeline's thread.
+	 */
+	volatile long Written;
+
+	/**
+	 * the number of tokens that the parser is done with. Only written by the 
+	 * parser's thread.
+	 */
+	volatile long Read;
+
+	/**
+	 * set to 1 when the pipeline's thread needs to stop
+	 */
+	volatile long Stopping;
+
+	/**
+	 * the last value of Written that the parser's thread saw; saves looking at
+	 * the shared counter for every token
+	 */
+	long SeenWritten;
+
+	/**
+	 * the last value of Read that the pipeline's thread saw
+	 */
+	long SeenRead;
+
+	/**
+	 * the number of tokens that the parser is done with; the same as Read but
+	 * only used by the parser's thread
+	 */
+	long Released;
+
+	/**
+	 * the token last returned by Next(); it stays in the ring until the
+	 * following call to Next()
+	 */
+	const TokenRecordClass* CurrentRecord;
+
+	/**
+	 * TRUE when the thread has been started and not yet joined
+	 */
+	bool IsRunning;
+};
+
+}
+
+#endif
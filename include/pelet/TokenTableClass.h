@@ -0,0 +1,126 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_TOKENTABLECLASS_H__
+#define __PELET_TOKENTABLECLASS_H__
+
+#include <pelet/TokenClass.h>
+#include <pelet/Api.h>
+#include <unicode/unistr.h>
+#include <vector>
+
+namespace pelet {
+
+/**
+ * The TokenTableClass holds all of the tokens of a piece of source code, as
+ * filled in by LexicalAnalyzerClass::TokenizeAll(). Each token property is 
+ * stored in its own array; the arrays are parallel (the same index is the 
+ * same token) so that a tool that only needs token IDs only walks the Tokens
+ * array.
+ *
+ * The table keeps the source code; lexemes are views into it and are
+ * valid for as long as the table is not cleared or filled again.
+ *
+ * @code
+ *   pelet::LexicalAnalyzerClass lexer;
+ *   pelet::TokenTableClass table;
+ *   lexer.TokenizeFile("/home/user/index.php", table);
+ *   for (size_t i = 0; i < table.GetCount(); ++i) {
+ *     if (pelet::T_VARIABLE == table.Tokens[i]) {
+ *       UnicodeString name = table.GetLexeme(i);
+ *     }
+ *   }
+ * @endcode
+ */
+class PELET_API TokenTableClass {
+
+public:
+
+	/**
+	 * the token IDs, one of the pelet::TokenClass::TokenIds or the ASCII value of a symbol.
+	 * The last token is always a terminating token (T_END or an unterminated error).
+	 */
+	std::vector<int> Tokens;
+
+	/**
+	 * the position of the first character of each token in Source; 0-based
+	 */
+	std::vector<int> Starts;
+
+	/**
+	 * the number of characters in each token
+	 */
+	std::vector<int> Lengths;
+
+	/**
+	 * the line that each token starts on; 1-based
+	 */
+	std::vector<int> Lines;
+
+	/**
+	 * the lexer condition after each token; one of the YYCONDTYPE values
+	 */
+	std::vector<unsigned char> EndConditions;
+
+	/**
+	 * the source code that was tokenized
+	 */
+	UnicodeString Source;
+
+	TokenTableClass();
+
+	/**
+	 * removes all tokens and the source code
+	 */
+	void Clear();
+
+	/**
+	 * @return the number of tokens in the table
+	 */
+	size_t GetCount() const;
+
+	/**
+	 * @param i the index of the token
+	 * @return a read-only string that aliases the token text in Source; nothing is
+	 *         copied. The text is exactly as it is in the code (strings are not unescaped)
+	 */
+	UnicodeString GetLexeme(size_t i) const;
+
+	/**
+	 * @param i the index of the token
+	 * @return pointer to the first character of the token in Source; the token is
+	 *         Lengths[i] characters long
+	 */
+	const UChar* GetLexemeStart(size_t i) const;
+
+	/**
+	 * @param i the index of the token
+	 * @return the lexer condition after the token
+	 */
+	YYCONDTYPE GetEndCondition(size_t i) const;
+};
+
+}
+
+#endif
@@ -164,10 +164,18 @@ public:
 	~UCharBufferedFileClass();
 	
 	/**
-	 * cleans up the internal buffer
+	 * cleans up the internal buffer. When capacity is being kept, the buffer
+	 * memory is not freed; the next OpenFile() call will reuse it.
 	 */
 	void Close();
 
+	/**
+	 * @param keep if TRUE, Close() will hold on to the internal buffer so that
+	 *        a later OpenFile() does not need to allocate a new one. The
+	 *        buffer is always freed by the destructor.
+	 */
+	void SetKeepCapacity(bool keep);
+
 	/**
 	 * Opens the file and partially loads it into the buffer. InlineHtml starts at true; signaling the lexer
 	 * to start consuming the html (open tag in the stream will be required to start lexing as php).
@@ -281,6 +289,11 @@ private:
 	 * is also the end od the input.
 	 */
 	bool HasReachedEof;
+
+	/**
+	 * if TRUE, Close() will not free Buffer
+	 */
+	bool IsKeepingCapacity;
 };
 
 /**
@@ -296,17 +309,28 @@ public:
 	~UCharBufferClass();
 	
 	/**
-	 * Release any resources
+	 * Release any resources. When capacity is being kept, the copy of the
+	 * code is not freed; the next OpenString() will reuse it if it is large enough.
 	 */
 	void Close();
+
+	/**
+	 * @param keep if TRUE, Close() will hold on to the copy of the code so that
+	 *        opening a string that is no longer than the longest one seen so far
+	 *        does not allocate. The copy is always freed by the destructor.
+	 */
+	void SetKeepCapacity(bool keep);
 	
 	/**
 	 * prepares the given code to be anlyzed. It is assumed that code is all php source; the
 	 * open tag "<?php" is not required (InlineHtml starts at false)
 	 * @param const UnicodeString& code to analyze
+	 * @param int startPos the character position where lexing starts. Positions
+	 *        are still relative to the start of code
+	 * @param int lineNumber the line number of the character at startPos
 	 * @return bool true if code is not empty
 	 */
-	bool OpenString(const UnicodeString& code);
+	bool OpenString(const UnicodeString& code, int startPos = 0, int lineNumber = 1);
 	
 	/**
 	 * NO-OP will do nothing since all data is already in memory
@@ -344,7 +368,217 @@ private:
 	 * The string will NOT be NULL terminated. The current lexeme can be retrieved via
 	 * the GetLexeme() method.
 	 */
-	const UChar* Buffer;
+	UChar* Buffer;
+
+	/**
+	 * number of characters allocated for Buffer
+	 */
+	int Capacity;
+
+	/**
+	 * if TRUE, Close() will not free Buffer
+	 */
+	bool IsKeepingCapacity;
+};
+
+/**
+ * The UCharViewBufferClass points to a NULL-terminated array of UChars that
+ * is owned by someone else; nothing is copied. The lexer can be started at any 
+ * position of the code, which is useful when the lexer condition at that 
+ * position is known.
+ */
+class PELET_API UCharViewBufferClass : public BufferClass {
+
+public:
+
+	UCharViewBufferClass();
+
+	/**
+	 * prepares the given code to be analyzed. 
+	 *
+	 * @param code the code to analyze, must be NULL-terminated (ie. UnicodeString::getTerminatedBuffer())
+	 *        and must outlive this buffer
+	 * @param length the number of characters in code, not including the NULL terminator
+	 * @param startPos the position where the lexer will start
+	 * @param lineNumber the line number at startPos
+	 */
+	void Open(const UChar* code, int length, int startPos = 0, int lineNumber = 1);
+
+	/**
+	 * Release the code; this class does not own it so nothing is freed
+	 */
+	void Close();
+
+	/**
+	 * NO-OP will do nothing since all data is already in memory
+	 */
+	void AppendToLexeme(int charsToFill);
+
+	/**
+	 * Will reset the TokenStart to the Current pointer.
+	 */
+	void MarkTokenStart();
+
+	/**
+	 * @return TRUE if the Current pointer has reached the end of the input
+	 */
+	bool HasReachedEnd() const;
+
+	/**
+	 * @return the position of the start of the current token, zero-based
+	 */
+	int GetCharacterPosition() const;
+
+	/**
+	 * @return the position of the Current pointer, zero-based. Right after a token
+	 *         is lexed this is the position right after the token.
+	 */
+	int GetCurrentPosition() const;
+
+private:
+
+	/**
+	 * the start of the code
+	 */
+	const UChar* Start;
+};
+
+
+/**
+ * The UCharChunkBufferClass holds code that is given to it in pieces, for example
+ * as it arrives from a socket or from an editor. Characters that have been lexed
+ * are thrown away when a new piece is appended, so memory use depends on the
+ * size of the pieces and not on the size of the entire code.
+ *
+ * Until Finish() is called the lexer may run out of characters in the middle of
+ * a token; when that happens AppendToLexeme() is called and NeedsMoreInput() 
+ * will return TRUE. The caller should then go back to the position saved with
+ * SavePosition() and wait for more code. 
+ */
+class PELET_API UCharChunkBufferClass : public BufferClass {
+
+public:
+
+	UCharChunkBufferClass();
+
+	~UCharChunkBufferClass();
+
+	/**
+	 * prepares the buffer to receive code; the buffer starts out empty.
+	 */
+	void Open();
+
+	/**
+	 * adds code to the end of the buffer. Any characters before TokenStart are
+	 * discarded.
+	 *
+	 * @param chars the code to add, does not need to be NULL-terminated. The 
+	 *        characters are copied.
+	 * @param length the number of characters in chars
+	 */
+	void Append(const UChar* chars, int length);
+
+	/**
+	 * marks the end of the code; after this call the lexer will see the end of
+	 * the input once it reaches the last character.
+	 */
+	void Finish();
+
+	/**
+	 * Release any resources
+	 */
+	void Close();
+
+	/**
+	 * Does not read anything; since there is no more code in memory the
+	 * NeedsMoreInput flag is set when the code has not been finished.
+	 *
+	 * @param int the number of characters to get
+	 */
+	void AppendToLexeme(int charsToFill);
+
+	/**
+	 * Will reset the TokenStart to the Current pointer.
+	 */
+	void MarkTokenStart();
+
+	/**
+	 * @return TRUE if the Current pointer has reached the end of the input. This
+	 *         is never TRUE before Finish() is called.
+	 */
+	bool HasReachedEnd() const;
+
+	/**
+	 * @return the position of the start of the current token, zero-based and
+	 *         relative to the first character ever appended
+	 */
+	int GetCharacterPosition() const;
+
+	/**
+	 * remembers the current position and line number, and resets the
+	 * NeedsMoreInput flag.
+	 */
+	void SavePosition();
+
+	/**
+	 * goes back to the position that was remembered by SavePosition()
+	 */
+	void RestorePosition();
+
+	/**
+	 * @return TRUE if the lexer tried to read past the code that has been 
+	 *         appended since the last SavePosition() call
+	 */
+	bool NeedsMoreInput() const;
+
+private:
+
+	/**
+	 * Holds the code that has not been lexed yet. The code is always followed by
+	 * NULL characters so that the lexer can look ahead without reading past
+	 * the allocated memory.
+	 */
+	UChar* Buffer;
+
+	/**
+	 * This variable stores the total memory allocated to the buffer.
+	 */
+	int BufferCapacity;
+
+	/**
+	 * The number of characters of code in Buffer
+	 */
+	int Length;
+
+	/**
+	 * The offset of the first character in Buffer into the ENTIRE code. 
+	 */
+	int CharacterPos;
+
+	/**
+	 * The position of Current, relative to Buffer, when SavePosition() was called
+	 */
+	int SavedCurrent;
+
+	/**
+	 * The position of TokenStart, relative to Buffer, when SavePosition() was called
+	 */
+	int SavedTokenStart;
+
+	/**
+	 * The line number when SavePosition() was called
+	 */
+	int SavedLineNumber;
+
+	/**
+	 * TRUE when Finish() has been called
+	 */
+	bool IsFinished;
+
+	/**
+	 * TRUE when the lexer tried to read past the code
+	 */
+	bool NeedsMore;
 };
 
 }
@@ -0,0 +1,156 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_UCHARMAPPEDFILECLASS_H__
+#define __PELET_UCHARMAPPEDFILECLASS_H__
+
+#include <pelet/UCharBufferedFileClass.h>
+#include <pelet/Api.h>
+#include <stdio.h>
+
+namespace pelet {
+
+/**
+ * The UCharMappedFileClass reads an entire UTF-8 file in one go. The file is 
+ * memory-mapped and converted to UTF-16 in a single pass into one buffer, the
+ * lexer then runs through the buffer without ever needing to refill it; 
+ * AppendToLexeme() is a no-op.
+ *
+ * Compared to UCharBufferedFileClass, this class avoids the repeated buffer 
+ * growth, slack space removal and incremental codepage conversion; the trade-off
+ * is that the entire file is kept in memory and the file MUST be UTF-8 (or ASCII). 
+ * Invalid UTF-8 sequences are replaced with U+FFFD. A byte order mark is
+ * kept as-is, just like UCharBufferedFileClass does.
+ *
+ * Note that this class will only work with text files, as it interprets a null character as the end of file. 
+ */
+class PELET_API UCharMappedFileClass : public BufferClass {
+
+public:
+
+	UCharMappedFileClass();
+
+	~UCharMappedFileClass();
+
+	/**
+	 * Release the converted buffer. When capacity is being kept, the buffer
+	 * memory is not freed; the next open will reuse it if it is large enough.
+	 */
+	void Close();
+
+	/**
+	 * @param keep if TRUE, Close() will hold on to the converted buffer so that
+	 *        opening a file that is no bigger than the largest one seen so far
+	 *        does not allocate. The buffer is always freed by the destructor.
+	 */
+	void SetKeepCapacity(bool keep);
+
+	/**
+	 * Maps the file and converts it into the internal buffer. The file is unmapped 
+	 * and closed before this method returns. 
+	 * This method will NOT handle unicode file names.
+	 *
+	 * @param const char *newFile to open
+	 * @return bool true if file can be opened for reading
+	 */
+	bool OpenFile(const char* newFile);
+
+	/**
+	 * Maps the given file from its current position to its end. When the file cannot be 
+	 * mapped (for example, a pipe) then the file is read instead. 
+	 * This method is useful when, for example, a file with a unicode filename was opened 
+	 * by the caller of this method.
+	 *
+	 * @param FILE* *file opened file pointer, this class will NOT own the file pointer
+	 * @return bool true if file can be read
+	 */
+	bool OpenFile(FILE* file);
+
+	/**
+	 * converts the given UTF-8 bytes into the internal buffer.
+	 *
+	 * @param bytes the UTF-8 contents. This class will NOT own the pointer, the bytes can
+	 *        be deleted once this method returns.
+	 * @param length number of bytes
+	 * @return bool always true
+	 */
+	bool OpenBytes(const char* bytes, size_t length);
+
+	/**
+	 * NO-OP will do nothing since all data is already in memory
+	 * 
+	 * @param int the number of characters to get from the file.
+	 */
+	void AppendToLexeme(int charsToFill);
+
+	/**
+	 * Will reset the TokenStart to the Current pointer.
+	 */
+	void MarkTokenStart();
+
+	/**
+	 * @return TRUE if the Current pointer has reached the end of the input
+	 */
+	bool HasReachedEnd() const;
+
+	/**
+	 * Returns the position of Current in the context of this buffer
+	 * (the number of characters that have been consumed since the Open() call)
+	 * This number is zero based
+	 * @return int
+	 */
+	int GetCharacterPosition() const;
+
+	/**
+	 * @return the number of UTF-16 characters in the buffer (not including the
+	 *         terminating null)
+	 */
+	int GetLength() const;
+
+private:
+
+	/**
+	 * The entire file contents, converted to UTF-16 and NULL terminated.
+	 * This class owns the pointer.
+	 */
+	UChar* Buffer;
+
+	/**
+	 * number of characters in Buffer, not including the null terminator
+	 */
+	int Length;
+
+	/**
+	 * number of characters allocated for Buffer
+	 */
+	int Capacity;
+
+	/**
+	 * if TRUE, Close() will not free Buffer
+	 */
+	bool IsKeepingCapacity;
+};
+
+}
+#endif
@@ -0,0 +1,207 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#ifndef __PELET_UTF8BUFFERCLASS_H__
+#define __PELET_UTF8BUFFERCLASS_H__
+
+#include <pelet/Api.h>
+#include <stdio.h>
+#include <stddef.h>
+
+namespace pelet {
+
+/**
+ * The Utf8BufferClass holds PHP source as raw UTF-8 bytes; the bytes are lexed 
+ * as-is and are never converted to UTF-16. Files are memory-mapped and lexed
+ * straight from the mapping whenever possible, so the source is not even copied. 
+ * Lexemes are converted to UnicodeString only when LexicalAnalyzerClass::GetLexeme()
+ * is called.
+ *
+ * This class has the same pointers and methods that the lexers use from BufferClass, but
+ * the pointers are byte pointers, which is why it is not a BufferClass. Since all of 
+ * the input is in memory, AppendToLexeme() is a no-op. 
+ *
+ * Note that this class will only work with text files, as it interprets a null character as the end of file. 
+ */
+class PELET_API Utf8BufferClass {
+
+public:
+
+	Utf8BufferClass();
+
+	~Utf8BufferClass();
+
+	/**
+	 * The position of the current byte. 
+	 */
+	const unsigned char* Current;
+
+	/**
+	 * Points to the start of a token. 
+	 */
+	const unsigned char* TokenStart;
+
+	/**
+	 * Used for backtracking.
+	 */
+	const unsigned char* Marker;
+
+	/**
+	 * Marks the end of the input (one past the terminating null).
+	 */
+	const unsigned char* Limit;
+
+	/**
+	 * Maps the file. The file is closed before this method returns but it stays
+	 * mapped until Close() is called. 
+	 * This method will NOT handle unicode file names.
+	 *
+	 * @param const char *newFile to open
+	 * @return bool true if file can be opened for reading
+	 */
+	bool OpenFile(const char* newFile);
+
+	/**
+	 * Maps the given file from its current position to its end. When the file cannot be 
+	 * mapped (for example, a pipe) then the file is read instead. 
+	 *
+	 * @param FILE* *file opened file pointer, this class will NOT own the file pointer
+	 * @return bool true if file can be read
+	 */
+	bool OpenFile(FILE* file);
+
+	/**
+	 * copies the given UTF-8 bytes into the internal buffer.
+	 *
+	 * @param bytes the UTF-8 contents. This class will NOT own the pointer, the bytes can
+	 *        be deleted once this method returns.
+	 * @param length number of bytes
+	 * @return bool always true
+	 */
+	bool OpenBytes(const char* bytes, size_t length);
+
+	/**
+	 * NO-OP will do nothing since all data is already in memory
+	 * 
+	 * @param int the number of bytes to get from the file.
+	 */
+	void AppendToLexeme(int charsToFill);
+
+	/**
+	 * Will reset the TokenStart to the Current pointer.
+	 */
+	void MarkTokenStart();
+
+	/**
+	 * Adds to the line number count
+	 */
+	void IncrementLine();
+
+	/**
+	 *  the current line number
+	 * 
+	 * 	@return int 
+	 */
+	int GetLineNumber() const;
+
+	/**
+	 * @return TRUE if the Current pointer has reached the end of the input
+	 */
+	bool HasReachedEnd() const;
+
+	/**
+	 * Returns the position of the current token in the context of this buffer. Note
+	 * that this is a BYTE offset, not a character offset.
+	 * This number is zero based
+	 * @return int
+	 */
+	int GetCharacterPosition() const;
+
+	/**
+	 * @return the number of bytes in the buffer (not including the terminating null)
+	 */
+	int GetLength() const;
+
+	/**
+	 * Unmap the file / release the copied bytes
+	 */
+	void Close();
+
+private:
+
+	/**
+	 * disable copying, the mapping cannot be shared.
+	 */
+	Utf8BufferClass(const Utf8BufferClass& other);
+
+	Utf8BufferClass& operator=(const Utf8BufferClass& other);
+
+	/**
+	 * Lexes straight from the given mapped view of a file. When the view is not followed by
+	 * a null character (the file size is an exact multiple of the page size) the 
+	 * contents are copied and the view is unmapped right away.
+	 *
+	 * @param view the mapped file, this class will own it
+	 * @param viewLength the size of the view, in bytes
+	 * @param offset position in the view where the source starts
+	 * @param isTerminated true if the view is followed by a null character
+	 * @return bool always true
+	 */
+	bool Attach(void* view, size_t viewLength, size_t offset, bool isTerminated);
+
+	/**
+	 * The start of the source bytes; this points either to the mapped view or 
+	 * to Copy
+	 */
+	const unsigned char* Start;
+
+	/**
+	 * null terminated copy of the source; used when the source could not 
+	 * be mapped. This class owns the pointer.
+	 */
+	unsigned char* Copy;
+
+	/**
+	 * The mapped view of the file, NULL if the file is not mapped.
+	 */
+	void* View;
+
+	/**
+	 * the size of the View, in bytes
+	 */
+	size_t ViewLength;
+
+	/**
+	 * number of bytes in the source, not including the null terminator
+	 */
+	int Length;
+
+	/**
+	 * The current line number
+	 */
+	int LineNumber;
+};
+
+}
+#endif
@@ -152,6 +152,10 @@ solution "pelet"
 			icuconfiguration("Release", _ACTION)
 		configuration { "Debug" }
 			icuconfiguration("Debug", _ACTION)
+		configuration { "gmake or codelite" }
+		
+			-- ProjectScannerClass uses threads
+			links { "pthread" }
 								
 	project "tests"
 		language "C++"
@@ -180,6 +184,31 @@ solution "pelet"
 			icuconfiguration("Release", _ACTION)
 			
 	
+	project "benchmarks"
+		language "C++"
+		kind "ConsoleApp"
+		files { "benchmarks/**.cpp", "benchmarks/**.h" }
+		includedirs { "include/", "benchmarks/" }
+		links { "pelet" }
+		
+		configuration { "vs2008" }
+			defines { "_CRT_SECURE_NO_WARNINGS" }
+			
+			-- peak memory usage is read with GetProcessMemoryInfo
+			links { "psapi" }
+		
+		configuration { "gmake or codelite" }
+			
+			-- make it so that the benchmark executable can find the pelet shared lib
+			linkoptions { "-Wl,-rpath=./" }
+			
+		configuration "Debug"
+			pickywarnings(_ACTION)
+			icuconfiguration("Debug", _ACTION)
+		configuration "Release"
+			pickywarnings(_ACTION)
+			icuconfiguration("Release", _ACTION)
+			
 	project "unit_test++"
 		language "C++"
 		kind "StaticLib"
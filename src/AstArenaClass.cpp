@@ -0,0 +1,146 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/AstArenaClass.h>
+#include <pelet/ParserTypeClass.h>
+#include <algorithm>
+
+/**
+ * all allocations are rounded up to a multiple of this so that
+ * every node is properly aligned (pointers, doubles, long longs)
+ */
+#define PELET_ARENA_ALIGNMENT 16
+
+pelet::AstArenaClass::AstArenaClass(size_t blockSize)
+	: Blocks()
+	, BlockSizes()
+	, ArenaItems()
+	, HeapItems()
+	, BlockSize(blockSize > 0 ? blockSize : 1024)
+	, CurrentBlock(0)
+	, Offset(0)
+	, Used(0) {
+}
+
+pelet::AstArenaClass::~AstArenaClass() {
+	Release();
+}
+
+void* pelet::AstArenaClass::Allocate(size_t size) {
+	size = (size + PELET_ARENA_ALIGNMENT - 1) & ~((size_t)PELET_ARENA_ALIGNMENT - 1);
+	while (CurrentBlock < Blocks.size()) {
+		if (Offset + size <= BlockSizes[CurrentBlock]) {
+			void* ptr = Blocks[CurrentBlock] + Offset;
+			Offset += size;
+			Used += size;
+			return ptr;
+		}
+
+		// not enough room left in this block, move on to the next one.
+		// the remainder of this block is wasted until the next Reset()
+		CurrentBlock++;
+		Offset = 0;
+	}
+	size_t newBlockSize = size > BlockSize ? size : BlockSize;
+	Blocks.push_back(new char[newBlockSize]);
+	BlockSizes.push_back(newBlockSize);
+	CurrentBlock = Blocks.size() - 1;
+	Offset = size;
+	Used += size;
+	return Blocks[CurrentBlock];
+}
+
+void pelet::AstArenaClass::Adopt(pelet::AstItemClass* item) {
+	if (Contains(item)) {
+		ArenaItems.push_back(item);
+	}
+	else {
+		HeapItems.push_back(item);
+	}
+}
+
+bool pelet::AstArenaClass::Contains(const void* ptr) const {
+	const char* p = (const char*)ptr;
+
+	// the most recent allocation is the common case; check the current block first
+	if (CurrentBlock < Blocks.size() && p >= Blocks[CurrentBlock] && p < Blocks[CurrentBlock] + BlockSizes[CurrentBlock]) {
+		return true;
+	}
+	for (size_t i = 0; i < Blocks.size(); ++i) {
+		if (p >= Blocks[i] && p < Blocks[i] + BlockSizes[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void pelet::AstArenaClass::Reset() {
+	for (size_t i = 0; i < ArenaItems.size(); ++i) {
+		ArenaItems[i]->~AstItemClass();
+	}
+	for (size_t i = 0; i < HeapItems.size(); ++i) {
+		delete HeapItems[i];
+	}
+	ArenaItems.clear();
+	HeapItems.clear();
+	CurrentBlock = 0;
+	Offset = 0;
+	Used = 0;
+}
+
+void pelet::AstArenaClass::Release() {
+	Reset();
+	for (size_t i = 0; i < Blocks.size(); ++i) {
+		delete[] Blocks[i];
+	}
+	Blocks.clear();
+	BlockSizes.clear();
+}
+
+void pelet::AstArenaClass::Swap(pelet::AstArenaClass& other) {
+	Blocks.swap(other.Blocks);
+	BlockSizes.swap(other.BlockSizes);
+	ArenaItems.swap(other.ArenaItems);
+	HeapItems.swap(other.HeapItems);
+	std::swap(BlockSize, other.BlockSize);
+	std::swap(CurrentBlock, other.CurrentBlock);
+	std::swap(Offset, other.Offset);
+	std::swap(Used, other.Used);
+}
+
+size_t pelet::AstArenaClass::ItemCount() const {
+	return ArenaItems.size() + HeapItems.size();
+}
+
+size_t pelet::AstArenaClass::BytesUsed() const {
+	return Used;
+}
+
+size_t pelet::AstArenaClass::Capacity() const {
+	size_t capacity = 0;
+	for (size_t i = 0; i < BlockSizes.size(); ++i) {
+		capacity += BlockSizes[i];
+	}
+	return capacity;
+}
@@ -0,0 +1,138 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/BodyWatcherClass.h>
+#include <pelet/TokenClass.h>
+
+/*
+ * the states used to find the start of a function body
+ */
+#define PELET_BODY_STATE_NONE 0
+#define PELET_BODY_STATE_FUNCTION 1
+#define PELET_BODY_STATE_NAMED_FUNCTION 2
+#define PELET_BODY_STATE_PARAMETERS 3
+#define PELET_BODY_STATE_AFTER_PARAMETERS 4
+#define PELET_BODY_STATE_LEXICAL_VARS 5
+#define PELET_BODY_STATE_BODY 6
+
+/*
+ * the length of "func_get_arg"
+ */
+#define PELET_FUNC_GET_ARG_LENGTH 12
+
+pelet::BodyWatcherClass::BodyWatcherClass()
+	: IsNamedOnly(false)
+	, State(PELET_BODY_STATE_NONE)
+	, ParenDepth(0) {
+}
+
+void pelet::BodyWatcherClass::Watch(int token) {
+	switch (State) {
+	case PELET_BODY_STATE_FUNCTION:
+	case PELET_BODY_STATE_NAMED_FUNCTION:
+		
+		// function names and references come before the parameters
+		if ('(' == token) {
+			bool isClosure = PELET_BODY_STATE_FUNCTION == State;
+			State = isClosure && IsNamedOnly ? PELET_BODY_STATE_NONE : PELET_BODY_STATE_PARAMETERS;
+			ParenDepth = 1;
+		}
+		else if (pelet::T_STRING == token) {
+			State = PELET_BODY_STATE_NAMED_FUNCTION;
+		}
+		else if ('&' != token) {
+			State = PELET_BODY_STATE_NONE;
+		}
+		break;
+	case PELET_BODY_STATE_PARAMETERS:
+	case PELET_BODY_STATE_LEXICAL_VARS:
+		
+		// default values may have parenthesis, ie. array()
+		if ('(' == token) {
+			ParenDepth++;
+		}
+		else if (')' == token) {
+			ParenDepth--;
+			if (ParenDepth <= 0) {
+				State = PELET_BODY_STATE_AFTER_PARAMETERS;
+			}
+		}
+		else if (pelet::IsTerminatingToken(token)) {
+			State = PELET_BODY_STATE_NONE;
+		}
+		break;
+	case PELET_BODY_STATE_AFTER_PARAMETERS:
+		if ('{' == token) {
+			State = PELET_BODY_STATE_BODY;
+		}
+		else if (pelet::T_USE == token) {
+			State = PELET_BODY_STATE_LEXICAL_VARS;
+			ParenDepth = 0;
+		}
+		else {
+			
+			// abstract or interface methods do not have a body
+			State = PELET_BODY_STATE_NONE;
+		}
+		break;
+	default:
+		State = pelet::T_FUNCTION == token ? PELET_BODY_STATE_FUNCTION : PELET_BODY_STATE_NONE;
+		break;
+	}
+}
+
+bool pelet::BodyWatcherClass::IsBodyStart() const {
+	return PELET_BODY_STATE_BODY == State;
+}
+
+int pelet::SkipBody(pelet::LexicalAnalyzerClass& analyzer, bool& hasCallToFuncGetArg) {
+	int depth = 1;
+	int token = 0;
+	UnicodeString lexeme;
+	while (depth > 0) {
+		token = analyzer.NextToken();
+		if ('{' == token) {
+			depth++;
+		}
+		else if ('}' == token) {
+			depth--;
+		}
+		else if (pelet::T_STRING == token && !hasCallToFuncGetArg && 
+			analyzer.GetTokenLength() >= PELET_FUNC_GET_ARG_LENGTH) {
+			
+			// the grammar checks for these calls; since the parser does not see the 
+			// body we must look for them. the length check avoids copying the lexemes
+			// of most identifiers
+			analyzer.GetLexeme(lexeme);
+			if (lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0 ||
+				lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) {
+				hasCallToFuncGetArg = true;
+			}
+		}
+		else if (pelet::IsTerminatingToken(token)) {
+			break;
+		}
+	}
+	return token;
+}
@@ -0,0 +1,1883 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/DeclarationScannerClass.h>
+#include <pelet/TokenClass.h>
+
+/*
+ * the lengths of the function names that the resource grammar looks for; checked
+ * before copying the lexeme of an identifier
+ */
+#define PELET_DEFINE_LENGTH 6
+#define PELET_FUNC_GET_ARG_LENGTH 12
+#define PELET_FUNC_GET_ARGS_LENGTH 13
+
+/*
+ * the length of "$this"
+ */
+#define PELET_THIS_LENGTH 5
+
+static bool IsMemberModifier(int token) {
+	return pelet::T_PUBLIC == token || pelet::T_PROTECTED == token || pelet::T_PRIVATE == token
+		|| pelet::T_STATIC == token || pelet::T_ABSTRACT == token || pelet::T_FINAL == token;
+}
+
+/*
+ * tokens that end a list of inner statements
+ */
+static bool IsStatementListEnd(int token) {
+	switch (token) {
+	case '}':
+	case pelet::T_ENDIF:
+	case pelet::T_ELSE:
+	case pelet::T_ELSEIF:
+	case pelet::T_ENDWHILE:
+	case pelet::T_ENDFOR:
+	case pelet::T_ENDFOREACH:
+	case pelet::T_ENDSWITCH:
+	case pelet::T_ENDDECLARE:
+	case pelet::T_CASE:
+	case pelet::T_DEFAULT:
+		return true;
+	}
+	return pelet::IsTerminatingToken(token);
+}
+
+/*
+ * the operators that take one expression on their right side
+ */
+static bool IsPrefixOperator(int token) {
+	switch (token) {
+	case '!':
+	case '~':
+	case '+':
+	case '-':
+	case pelet::T_INC:
+	case pelet::T_DEC:
+	case pelet::T_INT_CAST:
+	case pelet::T_DOUBLE_CAST:
+	case pelet::T_STRING_CAST:
+	case pelet::T_ARRAY_CAST:
+	case pelet::T_OBJECT_CAST:
+	case pelet::T_BOOL_CAST:
+	case pelet::T_UNSET_CAST:
+	case pelet::T_CLONE:
+	case pelet::T_PRINT:
+		return true;
+	}
+	return false;
+}
+
+/*
+ * the operators that take an expression on each side, the assignment operators
+ * and the ternary operator
+ */
+static bool IsBinaryOperator(int token) {
+	switch (token) {
+	case '=':
+	case '?':
+	case '|':
+	case '^':
+	case '&':
+	case '<':
+	case '>':
+	case '+':
+	case '-':
+	case '.':
+	case '*':
+	case '/':
+	case '%':
+	case pelet::T_PLUS_EQUAL:
+	case pelet::T_MINUS_EQUAL:
+	case pelet::T_MUL_EQUAL:
+	case pelet::T_DIV_EQUAL:
+	case pelet::T_CONCAT_EQUAL:
+	case pelet::T_MOD_EQUAL:
+	case pelet::T_AND_EQUAL:
+	case pelet::T_OR_EQUAL:
+	case pelet::T_XOR_EQUAL:
+	case pelet::T_SL_EQUAL:
+	case pelet::T_SR_EQUAL:
+	case pelet::T_BOOLEAN_OR:
+	case pelet::T_BOOLEAN_AND:
+	case pelet::T_IS_EQUAL:
+	case pelet::T_IS_NOT_EQUAL:
+	case pelet::T_IS_IDENTICAL:
+	case pelet::T_IS_NOT_IDENTICAL:
+	case pelet::T_IS_SMALLER_OR_EQUAL:
+	case pelet::T_IS_GREATER_OR_EQUAL:
+	case pelet::T_SL:
+	case pelet::T_SR:
+		return true;
+	}
+	return false;
+}
+
+static bool IsProperty(pelet::StatementClass* value) {
+	return value && pelet::StatementClass::PROPERTY_DECLARATION == value->Type;
+}
+
+pelet::DeclarationScannerClass::DeclarationScannerClass(pelet::LexicalAnalyzerClass& analyzer, pelet::ResourceParserObserverClass& observers)
+	: Analyzer(analyzer)
+	, Observers(observers)
+	, Comment()
+	, Lexeme()
+	, Token(0)
+	, PreviousToken(0) {
+		
+}
+
+bool pelet::DeclarationScannerClass::Scan() {
+	Next();
+	pelet::StatementListClass statements;
+	if (!TopStatements(&statements, false)) {
+		return false;
+	}
+	
+	// like the grammar, a cancelled scan is not accepted; the lexer ended the 
+	// source early
+	if (Analyzer.WasCancelled()) {
+		return false;
+	}
+	Observers.MakeAst(&statements);
+	return true;
+}
+
+void pelet::DeclarationScannerClass::Next() {
+	PreviousToken = Token;
+	if (!Comment.isEmpty()) {
+		Comment.remove();
+	}
+	Token = Analyzer.NextToken();
+	
+	// same as ResourceLex(); the open tag is skipped, comments are skipped but the
+	// last PHPDoc comment is attached to the token after it, and the close tag ends
+	// a statement
+	if (pelet::T_OPEN_TAG == Token || pelet::T_OPEN_TAG_WITH_ECHO == Token) {
+		Token = Analyzer.NextToken();
+	}
+	while (pelet::T_DOC_COMMENT == Token || pelet::T_COMMENT == Token) {
+		if (pelet::T_DOC_COMMENT == Token && Observers.DoCaptureComments) {
+			Analyzer.GetLexeme(Comment);
+		}
+		Token = Analyzer.NextToken();
+	}
+	if (pelet::T_CLOSE_TAG == Token) {
+		Token = ';';
+	}
+}
+
+bool pelet::DeclarationScannerClass::Expect(int token) {
+	if (token != Token) {
+		return Error();
+	}
+	Next();
+	return true;
+}
+
+pelet::SemanticValueClass* pelet::DeclarationScannerClass::MakeLexeme() {
+	pelet::AstArenaClass* arena = Observers.GetArena();
+	pelet::SemanticValueClass* value = arena ? new (*arena) pelet::SemanticValueClass : new pelet::SemanticValueClass;
+	Observers.Adopt(value);
+	value->Token = Token;
+	Analyzer.GetLexeme(value->Lexeme);
+	value->Comment = Comment;
+	value->Pos = Analyzer.GetCharacterPosition();
+	value->LineNumber = Analyzer.GetLineNumber();
+	return value;
+}
+
+void pelet::DeclarationScannerClass::MakeToken(pelet::TokenPositionClass& token) {
+	token.Token = Token;
+	token.Pos = Analyzer.GetCharacterPosition();
+	token.LineNumber = Analyzer.GetLineNumber();
+}
+
+bool pelet::DeclarationScannerClass::Error() {
+	if (Analyzer.ParserError.isEmpty()) {
+		if (pelet::IsTerminatingToken(Token)) {
+			Analyzer.AddParserError(UNICODE_STRING_SIMPLE("syntax error, unexpected end of file"));
+		}
+		else {
+			Analyzer.GetLexeme(Lexeme);
+			UnicodeString error = UNICODE_STRING_SIMPLE("syntax error, unexpected '");
+			error.append(Lexeme).append(UNICODE_STRING_SIMPLE("'"));
+			Analyzer.AddParserError(error);
+		}
+	}
+	return false;
+}
+
+bool pelet::DeclarationScannerClass::TopStatements(pelet::StatementListClass* statements, bool isBlock) {
+	while (true) {
+		
+		// like the grammar, an unterminated comment or string ends the source
+		if (pelet::IsTerminatingToken(Token)) {
+			return isBlock ? Error() : true;
+		}
+		if ('}' == Token) {
+			return isBlock ? true : Error();
+		}
+		if (!TopStatement(statements)) {
+			return false;
+		}
+		if (!isBlock && Observers.DoNotifyEachStatement) {
+			Observers.MakeAst(statements);
+			Observers.ReleaseStatements(statements);
+		}
+	}
+}
+
+bool pelet::DeclarationScannerClass::InnerStatements(pelet::StatementListClass* statements) {
+	while (!IsStatementListEnd(Token)) {
+		if (!Statement(statements)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::TopStatement(pelet::StatementListClass* statements) {
+	switch (Token) {
+	case pelet::T_NAMESPACE:
+		return Namespace(statements);
+	case pelet::T_USE:
+		return UseDeclarations(statements);
+	case pelet::T_CONST:
+		return ConstantDeclarations(statements);
+	}
+	return Statement(statements);
+}
+
+bool pelet::DeclarationScannerClass::Statement(pelet::StatementListClass* statements) {
+	pelet::StatementClass* value = NULL;
+	pelet::StatementListClass ignored;
+	pelet::SemanticValueClass* functionValue = NULL;
+	bool isVariable = false;
+	bool isReference = false;
+	int startToken = Token;
+	switch (Token) {
+	case '{':
+		Next();
+		return InnerStatements(statements) && Expect('}');
+	case ';':
+	case pelet::T_INLINE_HTML:
+		Next();
+		return true;
+	case pelet::T_IF:
+		return If(statements);
+	case pelet::T_WHILE:
+		Next();
+		return Expect('(') && Expression(value) && Expect(')') 
+			&& ControlStatement(statements, pelet::T_ENDWHILE);
+	case pelet::T_DO:
+		Next();
+		return Statement(statements) && Expect(pelet::T_WHILE) && Expect('(') && Expression(value)
+			&& Expect(')') && Expect(';');
+	case pelet::T_FOR:
+		Next();
+		return Expect('(') && ExpressionList(';') && Expect(';') && ExpressionList(';') && Expect(';')
+			&& ExpressionList(')') && Expect(')') && ControlStatement(statements, pelet::T_ENDFOR);
+	case pelet::T_FOREACH:
+		Next();
+		if (!Expect('(') || !Expression(value) || !Expect(pelet::T_AS)) {
+			return false;
+		}
+		if ('&' == Token) {
+			Next();
+		}
+		if (!Expression(value)) {
+			return false;
+		}
+		if (pelet::T_DOUBLE_ARROW == Token) {
+			Next();
+			if ('&' == Token) {
+				Next();
+			}
+			if (!Expression(value)) {
+				return false;
+			}
+		}
+		return Expect(')') && ControlStatement(statements, pelet::T_ENDFOREACH);
+	case pelet::T_SWITCH:
+		return Switch(statements);
+	case pelet::T_DECLARE:
+		
+		// the resource grammar drops anything inside of a declare
+		Next();
+		return Expect('(') && ExpressionList(')') && Expect(')') 
+			&& ControlStatement(&ignored, pelet::T_ENDDECLARE);
+	case pelet::T_TRY:
+		return Try(statements);
+	case pelet::T_RETURN:
+	case pelet::T_BREAK:
+	case pelet::T_CONTINUE:
+	case pelet::T_GLOBAL:
+	case pelet::T_UNSET:
+		Next();
+		return ExpressionList(';') && Expect(';');
+	case pelet::T_GOTO:
+		Next();
+		return Expect(pelet::T_STRING) && Expect(';');
+	case pelet::T_ECHO:
+		Next();
+		while (true) {
+			if (!Expression(value)) {
+				return false;
+			}
+			statements->Push(value);
+			if (',' != Token) {
+				break;
+			}
+			Next();
+		}
+		return Expect(';');
+	case pelet::T_THROW:
+		Next();
+		if (!Expression(value)) {
+			return false;
+		}
+		statements->Push(value);
+		return Expect(';');
+	case pelet::T_HALT_COMPILER:
+		Next();
+		return Expect('(') && Expect(')') && Expect(';');
+	case pelet::T_CLASS:
+	case pelet::T_ABSTRACT:
+	case pelet::T_FINAL:
+	case pelet::T_TRAIT:
+	case pelet::T_INTERFACE:
+		return ClassDeclaration(statements);
+	case pelet::T_FUNCTION:
+		functionValue = MakeLexeme();
+		Next();
+		if ('&' == Token) {
+			isReference = true;
+			Next();
+		}
+		if (pelet::T_STRING == Token) {
+			return FunctionDeclaration(statements, functionValue, isReference);
+		}
+		if (!Closure() || !Operators(value, false) || !LogicalOperators(value)) {
+			return false;
+		}
+		return Expect(';');
+	case pelet::T_STATIC:
+		Next();
+		if (pelet::T_VARIABLE == Token) {
+			
+			// static variables
+			while (true) {
+				if (!Expect(pelet::T_VARIABLE)) {
+					return false;
+				}
+				if ('=' == Token) {
+					Next();
+					SkipStaticScalar();
+				}
+				if (',' != Token) {
+					break;
+				}
+				Next();
+			}
+			return Expect(';');
+		}
+		if (!Static(value, isVariable) || !Operators(value, isVariable) || !LogicalOperators(value)) {
+			return false;
+		}
+		statements->Push(value);
+		return Expect(';');
+	}
+	if (!Expression(value)) {
+		return false;
+	}
+	if (':' == Token && pelet::T_STRING == startToken && pelet::T_STRING == PreviousToken) {
+		
+		// a goto label
+		Next();
+		return true;
+	}
+	statements->Push(value);
+	return Expect(';');
+}
+
+bool pelet::DeclarationScannerClass::ControlStatement(pelet::StatementListClass* statements, int endToken) {
+	if (':' != Token) {
+		return Statement(statements);
+	}
+	Next();
+	return InnerStatements(statements) && Expect(endToken) && Expect(';');
+}
+
+bool pelet::DeclarationScannerClass::If(pelet::StatementListClass* statements) {
+	pelet::StatementClass* value = NULL;
+	Next();
+	if (!Expect('(') || !Expression(value) || !Expect(')')) {
+		return false;
+	}
+	bool isAlternative = ':' == Token;
+	if (isAlternative) {
+		Next();
+		if (!InnerStatements(statements)) {
+			return false;
+		}
+	}
+	else if (!Statement(statements)) {
+		return false;
+	}
+	while (pelet::T_ELSEIF == Token) {
+		
+		// the resource grammar keeps the value of an elseif condition
+		Next();
+		if (!Expect('(') || !Expression(value) || !Expect(')')) {
+			return false;
+		}
+		statements->Push(value);
+		if (isAlternative) {
+			if (!Expect(':') || !InnerStatements(statements)) {
+				return false;
+			}
+		}
+		else if (!Statement(statements)) {
+			return false;
+		}
+	}
+	if (pelet::T_ELSE == Token) {
+		Next();
+		if (isAlternative) {
+			if (!Expect(':') || !InnerStatements(statements)) {
+				return false;
+			}
+		}
+		else if (!Statement(statements)) {
+			return false;
+		}
+	}
+	if (isAlternative) {
+		return Expect(pelet::T_ENDIF) && Expect(';');
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Switch(pelet::StatementListClass* statements) {
+	pelet::StatementClass* value = NULL;
+	Next();
+	if (!Expect('(') || !Expression(value) || !Expect(')')) {
+		return false;
+	}
+	bool isAlternative = ':' == Token;
+	if (!isAlternative && '{' != Token) {
+		return Error();
+	}
+	Next();
+	if (';' == Token) {
+		Next();
+	}
+	
+	// the resource grammar only keeps the statements of the last case
+	pelet::StatementListClass caseStatements;
+	while (pelet::T_CASE == Token || pelet::T_DEFAULT == Token) {
+		if (pelet::T_CASE == Token) {
+			Next();
+			if (!Expression(value)) {
+				return false;
+			}
+		}
+		else {
+			Next();
+		}
+		if (':' != Token && ';' != Token) {
+			return Error();
+		}
+		Next();
+		caseStatements.Clear();
+		if (!InnerStatements(&caseStatements)) {
+			return false;
+		}
+	}
+	statements->PushAll(&caseStatements);
+	if (isAlternative) {
+		return Expect(pelet::T_ENDSWITCH) && Expect(';');
+	}
+	return Expect('}');
+}
+
+bool pelet::DeclarationScannerClass::Try(pelet::StatementListClass* statements) {
+	Next();
+	if (!Expect('{') || !InnerStatements(statements) || !Expect('}')) {
+		return false;
+	}
+	if (pelet::T_CATCH != Token) {
+		return Error();
+	}
+	while (pelet::T_CATCH == Token) {
+		Next();
+		if (!Expect('(') || !FullyQualifiedName() || !Expect(pelet::T_VARIABLE) || !Expect(')')) {
+			return false;
+		}
+		if (!Expect('{') || !InnerStatements(statements) || !Expect('}')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Namespace(pelet::StatementListClass* statements) {
+	pelet::TokenPositionClass namespaceToken;
+	MakeToken(namespaceToken);
+	Next();
+	if (pelet::T_NS_SEPARATOR == Token) {
+		
+		// not a declaration; a name relative to the current namespace, ie. namespace\func()
+		pelet::StatementClass* value = NULL;
+		bool isVariable = false;
+		if (!Name(value, isVariable, true) || !Operators(value, isVariable) || !LogicalOperators(value)) {
+			return false;
+		}
+		statements->Push(value);
+		return Expect(';');
+	}
+	pelet::NamespaceDeclarationClass* declaration = new pelet::NamespaceDeclarationClass;
+	Observers.Adopt(declaration);
+	if ('{' == Token) {
+		
+		// the global namespace
+		declaration->Init(namespaceToken);
+		statements->Push(declaration);
+		Observers.SetDeclaredNamespace(NULL);
+		Next();
+		return TopStatements(statements, true) && Expect('}');
+	}
+	if (pelet::T_STRING != Token) {
+		return Error();
+	}
+	pelet::SemanticValueClass* firstValue = MakeLexeme();
+	Next();
+	pelet::QualifiedNameClass* namespaceName = NamespaceName(firstValue);
+	if (!namespaceName) {
+		return false;
+	}
+	if (';' == Token) {
+		declaration->Init(namespaceName, namespaceToken);
+		statements->Push(declaration);
+		Observers.SetDeclaredNamespace(namespaceName);
+		Next();
+		return true;
+	}
+	if ('{' != Token) {
+		return Error();
+	}
+	Observers.SetDeclaredNamespace(namespaceName);
+	declaration->Init(namespaceName, namespaceToken);
+	statements->Push(declaration);
+	Next();
+	return TopStatements(statements, true) && Expect('}');
+}
+
+bool pelet::DeclarationScannerClass::UseDeclarations(pelet::StatementListClass* statements) {
+	pelet::TokenPositionClass useToken;
+	MakeToken(useToken);
+	Next();
+	pelet::StatementListClass uses;
+	while (true) {
+		if (pelet::T_NS_SEPARATOR == Token) {
+			Next();
+		}
+		if (pelet::T_STRING != Token) {
+			return Error();
+		}
+		pelet::SemanticValueClass* firstValue = MakeLexeme();
+		Next();
+		pelet::QualifiedNameClass* namespaceName = NamespaceName(firstValue);
+		if (!namespaceName) {
+			return false;
+		}
+		pelet::SemanticValueClass* alias = NULL;
+		if (pelet::T_AS == Token) {
+			Next();
+			if (pelet::T_STRING != Token) {
+				return Error();
+			}
+			alias = MakeLexeme();
+			Next();
+		}
+		pelet::NamespaceUseClass* use = new pelet::NamespaceUseClass;
+		Observers.Adopt(use);
+		use->Init(namespaceName, alias);
+		Observers.NamespaceUseAddScope(use);
+		uses.Push(use);
+		if (',' != Token) {
+			break;
+		}
+		Next();
+	}
+	if (';' != Token) {
+		return Error();
+	}
+	statements->PushAll(pelet::NamespaceUseClass::SetStartingPos(&uses, useToken));
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::ConstantDeclarations(pelet::StatementListClass* statements) {
+	Next();
+	while (true) {
+		if (pelet::T_STRING != Token) {
+			return Error();
+		}
+		pelet::SemanticValueClass* name = MakeLexeme();
+		Next();
+		if (!Expect('=')) {
+			return false;
+		}
+		int lineNumber = SkipStaticScalar();
+		pelet::ConstantStatementClass* constant = new pelet::ConstantStatementClass;
+		Observers.Adopt(constant);
+		constant->Init(name, lineNumber, Observers.GetDeclaredNamespace());
+		statements->Push(constant);
+		if (',' != Token) {
+			break;
+		}
+		Next();
+	}
+	return Expect(';');
+}
+
+bool pelet::DeclarationScannerClass::FunctionDeclaration(pelet::StatementListClass* statements, pelet::SemanticValueClass* functionValue, 
+															bool isReference) {
+	pelet::SemanticValueClass* name = MakeLexeme();
+	Next();
+	pelet::ParametersListClass* parameters = NULL;
+	if (!Parameters(parameters)) {
+		return false;
+	}
+	Observers.SetCurrentClassName(NULL);
+	Observers.SetCurrentMemberName(name);
+	Observers.HasCallToFuncGetArg = false;
+	if ('{' != Token) {
+		return Error();
+	}
+	pelet::TokenPositionClass openToken;
+	pelet::TokenPositionClass closeToken;
+	pelet::StatementListClass body;
+	MakeToken(openToken);
+	if (!Body(&body, closeToken)) {
+		return false;
+	}
+	pelet::ClassMemberSymbolClass* member = new pelet::ClassMemberSymbolClass;
+	Observers.Adopt(member);
+	member->MakeFunction(name, isReference, functionValue, parameters, openToken, closeToken,
+		Observers.GetScope(), Observers.GetDeclaredNamespace(), Observers.HasCallToFuncGetArg);
+	statements->Push(member);
+	statements->PushAll(&body);
+	Observers.SetCurrentMemberName(NULL);
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Closure() {
+	pelet::ParametersListClass* parameters = NULL;
+	if (!Parameters(parameters)) {
+		return false;
+	}
+	if (pelet::T_USE == Token) {
+		Next();
+		if (!Expect('(')) {
+			return false;
+		}
+		while (')' != Token) {
+			if ('&' == Token) {
+				Next();
+			}
+			if (!Expect(pelet::T_VARIABLE)) {
+				return false;
+			}
+			if (',' != Token) {
+				break;
+			}
+			Next();
+		}
+		if (!Expect(')')) {
+			return false;
+		}
+	}
+	if ('{' != Token) {
+		return Error();
+	}
+	
+	// the resource grammar drops everything inside of a closure
+	pelet::StatementListClass ignored;
+	pelet::TokenPositionClass closeToken;
+	Observers.IncrementAnonymousFunctionCount();
+	if (!Body(&ignored, closeToken)) {
+		return false;
+	}
+	Observers.EndAnonymousFunction();
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Body(pelet::StatementListClass* statements, pelet::TokenPositionClass& closeToken) {
+	if (Observers.DoSkipBodies) {
+		PreviousToken = Token;
+		Token = pelet::SkipBody(Analyzer, Observers.HasCallToFuncGetArg);
+	}
+	else {
+		Next();
+		if (!InnerStatements(statements)) {
+			return false;
+		}
+	}
+	if ('}' != Token) {
+		return Error();
+	}
+	MakeToken(closeToken);
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::ClassDeclaration(pelet::StatementListClass* statements) {
+	pelet::ClassSymbolClass* classType = new pelet::ClassSymbolClass;
+	Observers.Adopt(classType);
+	pelet::SemanticValueClass* entryValue = MakeLexeme();
+	bool isInterface = false;
+	switch (Token) {
+	case pelet::T_ABSTRACT:
+	case pelet::T_FINAL:
+		classType->SetFlags(entryValue, pelet::T_ABSTRACT == Token, pelet::T_FINAL == Token, false, false);
+		Next();
+		if (pelet::T_CLASS != Token) {
+			return Error();
+		}
+		break;
+	case pelet::T_TRAIT:
+		classType->SetFlags(entryValue, false, false, false, true);
+		break;
+	case pelet::T_INTERFACE:
+		classType->SetFlags(entryValue, false, false, true, false);
+		isInterface = true;
+		break;
+	default:
+		classType->SetFlags(entryValue, false, false, false, false);
+		break;
+	}
+	Next();
+	if (pelet::T_STRING != Token) {
+		return Error();
+	}
+	pelet::SemanticValueClass* name = MakeLexeme();
+	Next();
+	pelet::ClassSymbolClass* extends = NULL;
+	pelet::ClassSymbolClass* implements = NULL;
+	if (isInterface) {
+		if (pelet::T_EXTENDS == Token) {
+			Next();
+			if (!InterfaceList(implements)) {
+				return false;
+			}
+		}
+	}
+	else {
+		if (pelet::T_EXTENDS == Token) {
+			Next();
+			pelet::QualifiedNameClass* extendsName = FullyQualifiedName();
+			if (!extendsName) {
+				return false;
+			}
+			extends = new pelet::ClassSymbolClass;
+			Observers.Adopt(extends);
+			extends->SetExtends(extendsName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		if (pelet::T_IMPLEMENTS == Token) {
+			Next();
+			if (!InterfaceList(implements)) {
+				return false;
+			}
+		}
+		else {
+			implements = new pelet::ClassSymbolClass;
+			Observers.Adopt(implements);
+			implements->SetFlags(NULL, false, false, false, false);
+		}
+	}
+	Observers.SetCurrentClassName(name);
+	if (!Expect('{')) {
+		return false;
+	}
+	pelet::StatementListClass classStatements;
+	if (!ClassStatements(&classStatements)) {
+		return false;
+	}
+	pelet::TokenPositionClass closeToken;
+	MakeToken(closeToken);
+	pelet::ClassSymbolClass* clazz = new pelet::ClassSymbolClass;
+	Observers.Adopt(clazz);
+	clazz->SetAll(name, classType, extends, implements, closeToken, Observers.GetDeclaredNamespace());
+	classStatements.PushFront(clazz);
+	if (!isInterface) {
+		Observers.DeclareAssignedProperties(&classStatements);
+		Observers.CreateMagicMethodsAndProperties(&classStatements, clazz);
+	}
+	Observers.SetCurrentClassName(NULL);
+	statements->PushAll(&classStatements);
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::InterfaceList(pelet::ClassSymbolClass*& interfaces) {
+	interfaces = new pelet::ClassSymbolClass;
+	Observers.Adopt(interfaces);
+	while (true) {
+		pelet::QualifiedNameClass* interfaceName = FullyQualifiedName();
+		if (!interfaceName) {
+			return false;
+		}
+		interfaces->AddToImplements(interfaceName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		if (',' != Token) {
+			return true;
+		}
+		Next();
+	}
+}
+
+bool pelet::DeclarationScannerClass::ClassStatements(pelet::StatementListClass* statements) {
+	while ('}' != Token) {
+		bool ret = false;
+		if (pelet::T_USE == Token) {
+			ret = TraitUse(statements);
+		}
+		else if (pelet::T_CONST == Token) {
+			ret = ClassConstants(statements);
+		}
+		else {
+			ret = ClassMember(statements);
+		}
+		if (!ret) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::ClassMember(pelet::StatementListClass* statements) {
+	pelet::ClassMemberSymbolClass* modifiers = NULL;
+	if (pelet::T_VAR == Token) {
+		modifiers = new pelet::ClassMemberSymbolClass;
+		Observers.Adopt(modifiers);
+		modifiers->MakeAsPublicVariable(MakeLexeme(), Observers.GetScope(), Observers.GetDeclaredNamespace());
+		Next();
+		return Properties(statements, modifiers);
+	}
+	while (IsMemberModifier(Token)) {
+		if (!modifiers) {
+			modifiers = new pelet::ClassMemberSymbolClass;
+			Observers.Adopt(modifiers);
+			modifiers->Make(MakeLexeme(), Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		else {
+			modifiers->SetModifier(MakeLexeme());
+		}
+		Next();
+	}
+	if (pelet::T_FUNCTION == Token) {
+		if (!modifiers) {
+			modifiers = new pelet::ClassMemberSymbolClass;
+			Observers.Adopt(modifiers);
+			modifiers->Make(NULL, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		return Method(statements, modifiers);
+	}
+	if (modifiers) {
+		return Properties(statements, modifiers);
+	}
+	return Error();
+}
+
+bool pelet::DeclarationScannerClass::Method(pelet::StatementListClass* statements, pelet::ClassMemberSymbolClass* modifiers) {
+	pelet::SemanticValueClass* functionValue = MakeLexeme();
+	Next();
+	bool isReference = false;
+	if ('&' == Token) {
+		isReference = true;
+		Next();
+	}
+	if (pelet::T_STRING != Token) {
+		return Error();
+	}
+	pelet::SemanticValueClass* name = MakeLexeme();
+	Next();
+	pelet::ParametersListClass* parameters = NULL;
+	if (!Parameters(parameters)) {
+		return false;
+	}
+	Observers.SetCurrentMemberName(name);
+	Observers.HasCallToFuncGetArg = false;
+	pelet::ClassMemberSymbolClass* body = new pelet::ClassMemberSymbolClass;
+	Observers.Adopt(body);
+	pelet::TokenPositionClass openToken;
+	MakeToken(openToken);
+	if (';' == Token) {
+		
+		// abstract and interface methods
+		body->MakeBody(NULL, openToken, openToken);
+	}
+	else if ('{' == Token) {
+		pelet::StatementListClass bodyStatements;
+		pelet::TokenPositionClass closeToken;
+		if (!Body(&bodyStatements, closeToken)) {
+			return false;
+		}
+		body->MakeBody(&bodyStatements, openToken, closeToken);
+	}
+	else {
+		return Error();
+	}
+	pelet::ClassMemberSymbolClass* member = new pelet::ClassMemberSymbolClass;
+	Observers.Adopt(member);
+	member->MakeMethod(name, modifiers, isReference, functionValue, parameters, body,
+		Observers.GetScope(), Observers.GetDeclaredNamespace(), Observers.HasCallToFuncGetArg);
+	statements->Push(member);
+	statements->PushAll(&body->MethodStatements);
+	Observers.SetCurrentMemberName(NULL);
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Properties(pelet::StatementListClass* statements, pelet::ClassMemberSymbolClass* modifiers) {
+	pelet::StatementListClass properties;
+	while (true) {
+		if (pelet::T_VARIABLE != Token) {
+			return Error();
+		}
+		pelet::SemanticValueClass* name = MakeLexeme();
+		Next();
+		int lineNumber = 0;
+		if ('=' == Token) {
+			Next();
+			lineNumber = SkipStaticScalar();
+		}
+		else {
+			lineNumber = Analyzer.GetLineNumber();
+		}
+		pelet::ClassMemberSymbolClass* property = new pelet::ClassMemberSymbolClass;
+		Observers.Adopt(property);
+		property->MakeVariable(name, name, false, lineNumber, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		properties.Push(property);
+		if (',' != Token) {
+			break;
+		}
+		Next();
+	}
+	if (';' != Token) {
+		return Error();
+	}
+	statements->PushAll(pelet::ClassMemberSymbolClass::MakeVariables(&properties, modifiers, 
+		Observers.GetScope(), Observers.GetDeclaredNamespace()));
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::ClassConstants(pelet::StatementListClass* statements) {
+	pelet::SemanticValueClass* commentValue = MakeLexeme();
+	Next();
+	while (true) {
+		if (pelet::T_STRING != Token) {
+			return Error();
+		}
+		pelet::SemanticValueClass* name = MakeLexeme();
+		Next();
+		if (!Expect('=')) {
+			return false;
+		}
+		int lineNumber = SkipStaticScalar();
+		pelet::ClassMemberSymbolClass* constant = new pelet::ClassMemberSymbolClass;
+		Observers.Adopt(constant);
+		
+		// the comment of the first constant is the one before the const keyword
+		constant->MakeVariable(name, commentValue ? commentValue : name, true, lineNumber, 
+			Observers.GetScope(), Observers.GetDeclaredNamespace());
+		statements->Push(constant);
+		commentValue = NULL;
+		if (',' != Token) {
+			break;
+		}
+		Next();
+	}
+	return Expect(';');
+}
+
+bool pelet::DeclarationScannerClass::TraitUse(pelet::StatementListClass* statements) {
+	Next();
+	pelet::TraitUseClass* traitUse = new pelet::TraitUseClass;
+	Observers.Adopt(traitUse);
+	bool isFirst = true;
+	while (true) {
+		pelet::QualifiedNameClass* traitName = FullyQualifiedName();
+		if (!traitName) {
+			return false;
+		}
+		if (isFirst) {
+			traitUse->Init(traitName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+			isFirst = false;
+		}
+		else {
+			traitUse->AppendUse(traitName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		if (',' != Token) {
+			break;
+		}
+		Next();
+	}
+	statements->Push(traitUse);
+	if (';' == Token) {
+		Next();
+		return true;
+	}
+	if (!Expect('{')) {
+		return false;
+	}
+	while ('}' != Token) {
+		if (!TraitAdaptation(statements)) {
+			return false;
+		}
+	}
+	Next();
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::TraitAdaptation(pelet::StatementListClass* statements) {
+	pelet::TraitAliasClass* reference = new pelet::TraitAliasClass;
+	Observers.Adopt(reference);
+	pelet::QualifiedNameClass* traitName = NULL;
+	if (pelet::T_STRING == Token) {
+		pelet::SemanticValueClass* firstValue = MakeLexeme();
+		Next();
+		if (pelet::T_NS_SEPARATOR == Token || pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+			traitName = NamespaceName(firstValue);
+			if (!traitName) {
+				return false;
+			}
+		}
+		else {
+			
+			// just a method name
+			reference->SetMethodReference(firstValue, NULL, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+	}
+	else {
+		traitName = FullyQualifiedName();
+		if (!traitName) {
+			return false;
+		}
+	}
+	if (traitName) {
+		if (!Expect(pelet::T_PAAMAYIM_NEKUDOTAYIM)) {
+			return false;
+		}
+		if (pelet::T_STRING != Token) {
+			return Error();
+		}
+		reference->SetMethodReference(MakeLexeme(), traitName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		Next();
+	}
+	if (pelet::T_INSTEADOF == Token && traitName) {
+		Next();
+		pelet::TraitInsteadOfClass* insteadOf = new pelet::TraitInsteadOfClass;
+		Observers.Adopt(insteadOf);
+		bool isFirst = true;
+		while (true) {
+			pelet::QualifiedNameClass* insteadOfName = FullyQualifiedName();
+			if (!insteadOfName) {
+				return false;
+			}
+			if (isFirst) {
+				insteadOf->Init(insteadOfName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+				isFirst = false;
+			}
+			else {
+				insteadOf->AppendInsteadOf(insteadOfName, Observers.GetScope(), Observers.GetDeclaredNamespace());
+			}
+			if (',' != Token) {
+				break;
+			}
+			Next();
+		}
+		statements->Push(insteadOf->SetMethodReference(reference));
+	}
+	else if (pelet::T_AS == Token) {
+		Next();
+		pelet::SemanticValueClass* modifier = NULL;
+		if (IsMemberModifier(Token)) {
+			modifier = MakeLexeme();
+			Next();
+		}
+		if (pelet::T_STRING == Token) {
+			reference->SetModifiers(modifier)->SetAlias(MakeLexeme())->SetScope(Observers.GetScope(), Observers.GetDeclaredNamespace());
+			Next();
+		}
+		else if (modifier) {
+			reference->SetModifiers(modifier)->SetScope(Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		else {
+			return Error();
+		}
+		statements->Push(reference);
+	}
+	else {
+		return Error();
+	}
+	return Expect(';');
+}
+
+bool pelet::DeclarationScannerClass::Parameters(pelet::ParametersListClass*& parameters) {
+	parameters = NULL;
+	if (!Expect('(')) {
+		return false;
+	}
+	while (')' != Token) {
+		pelet::QualifiedNameClass* type = NULL;
+		if (pelet::T_ARRAY == Token || pelet::T_CALLABLE == Token) {
+			type = new pelet::QualifiedNameClass;
+			Observers.Adopt(type);
+			type->Init(pelet::T_ARRAY == Token ? UNICODE_STRING_SIMPLE("array") : UNICODE_STRING_SIMPLE("callable"), 0, 0);
+			Next();
+		}
+		else if (pelet::T_STRING == Token || pelet::T_NS_SEPARATOR == Token || pelet::T_NAMESPACE == Token) {
+			type = FullyQualifiedName();
+			if (!type) {
+				return false;
+			}
+		}
+		bool isReference = false;
+		if ('&' == Token) {
+			isReference = true;
+			Next();
+		}
+		if (pelet::T_VARIABLE != Token) {
+			return Error();
+		}
+		pelet::SemanticValueClass* name = MakeLexeme();
+		Next();
+		bool hasDefault = false;
+		if ('=' == Token) {
+			hasDefault = true;
+			Next();
+			SkipStaticScalar();
+		}
+		if (!parameters) {
+			parameters = new pelet::ParametersListClass;
+			Observers.Adopt(parameters);
+			parameters->Init(type, name, isReference, hasDefault, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		else {
+			parameters->Append(type, name, isReference, hasDefault, Observers.GetScope(), Observers.GetDeclaredNamespace());
+		}
+		if (',' == Token) {
+			Next();
+		}
+		else if (')' != Token) {
+			return Error();
+		}
+	}
+	Next();
+	return true;
+}
+
+pelet::QualifiedNameClass* pelet::DeclarationScannerClass::NamespaceName(pelet::SemanticValueClass* firstValue) {
+	pelet::QualifiedNameClass* name = new pelet::QualifiedNameClass;
+	Observers.Adopt(name);
+	name->Init(firstValue);
+	while (pelet::T_NS_SEPARATOR == Token) {
+		Next();
+		if (pelet::T_STRING != Token) {
+			Error();
+			return NULL;
+		}
+		name->AppendName(MakeLexeme());
+		Next();
+	}
+	return name;
+}
+
+pelet::QualifiedNameClass* pelet::DeclarationScannerClass::FullyQualifiedName() {
+	bool isAbsolute = false;
+	bool isRelative = false;
+	if (pelet::T_NS_SEPARATOR == Token) {
+		isAbsolute = true;
+		Next();
+	}
+	else if (pelet::T_NAMESPACE == Token) {
+		isRelative = true;
+		Next();
+		if (!Expect(pelet::T_NS_SEPARATOR)) {
+			return NULL;
+		}
+	}
+	if (pelet::T_STRING != Token) {
+		Error();
+		return NULL;
+	}
+	pelet::SemanticValueClass* firstValue = MakeLexeme();
+	Next();
+	pelet::QualifiedNameClass* name = NamespaceName(firstValue);
+	if (name && isAbsolute) {
+		name->MakeAbsolute();
+	}
+	else if (name && isRelative) {
+		name->MakeFromDeclaredNamespace(&Observers.GetDeclaredNamespace());
+	}
+	return name;
+}
+
+int pelet::DeclarationScannerClass::SkipStaticScalar() {
+	int depth = 0;
+	int lineNumber = Analyzer.GetLineNumber();
+	bool isName = false;
+	while (!pelet::IsTerminatingToken(Token)) {
+		if (0 == depth && (',' == Token || ';' == Token || ')' == Token || ']' == Token)) {
+			break;
+		}
+		if ('(' == Token || '[' == Token) {
+			depth++;
+		}
+		else if (')' == Token || ']' == Token) {
+			depth--;
+		}
+		isName = pelet::T_STRING == Token && pelet::T_PAAMAYIM_NEKUDOTAYIM != PreviousToken;
+		lineNumber = Analyzer.GetLineNumber();
+		Next();
+	}
+	
+	// the grammar reduces a constant name only after it has seen the token after it (since
+	// the name could keep going), so the line is the line of the token after the value
+	return isName ? Analyzer.GetLineNumber() : lineNumber;
+}
+
+bool pelet::DeclarationScannerClass::Expression(pelet::StatementClass*& value) {
+	return AssignmentExpression(value) && LogicalOperators(value);
+}
+
+bool pelet::DeclarationScannerClass::AssignmentExpression(pelet::StatementClass*& value) {
+	bool isVariable = false;
+	return Term(value, isVariable) && Operators(value, isVariable);
+}
+
+bool pelet::DeclarationScannerClass::Operators(pelet::StatementClass*& value, bool isVariable) {
+	pelet::StatementClass* right = NULL;
+	if (isVariable && '=' == Token) {
+		
+		// an assigned property wins over the assigned value
+		Next();
+		bool isReference = '&' == Token;
+		if (isReference) {
+			Next();
+		}
+		if (!AssignmentExpression(right)) {
+			return false;
+		}
+		if (!IsProperty(value)) {
+			value = isReference ? NULL : right;
+		}
+		return true;
+	}
+	while (IsBinaryOperator(Token) || pelet::T_INSTANCEOF == Token || pelet::T_INC == Token || pelet::T_DEC == Token) {
+		int op = Token;
+		Next();
+		value = NULL;
+		if (pelet::T_INC == op || pelet::T_DEC == op) {
+			continue;
+		}
+		if (pelet::T_INSTANCEOF == op) {
+			if (!ClassReference()) {
+				return false;
+			}
+			continue;
+		}
+		if ('=' == op && '&' == Token) {
+			Next();
+		}
+		if ('?' == op) {
+			if (':' != Token && !AssignmentExpression(right)) {
+				return false;
+			}
+			if (!Expect(':')) {
+				return false;
+			}
+		}
+		if (!AssignmentExpression(right)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::LogicalOperators(pelet::StatementClass*& value) {
+	pelet::StatementClass* right = NULL;
+	while (pelet::T_LOGICAL_OR == Token || pelet::T_LOGICAL_XOR == Token || pelet::T_LOGICAL_AND == Token) {
+		Next();
+		if (!AssignmentExpression(right)) {
+			return false;
+		}
+		value = NULL;
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Term(pelet::StatementClass*& value, bool& isVariable) {
+	value = NULL;
+	isVariable = false;
+	pelet::StatementClass* ignored = NULL;
+	pelet::StatementListClass* arguments = NULL;
+	pelet::ScalarExpressionClass* scalar = NULL;
+	switch (Token) {
+	case '@':
+		
+		// the resource grammar keeps the value of a silenced expression
+		Next();
+		return AssignmentExpression(value);
+	case '(':
+		Next();
+		if (!Expression(value) || !Expect(')')) {
+			return false;
+		}
+		if (pelet::T_OBJECT_OPERATOR == Token || '[' == Token) {
+			value = NULL;
+			return Chain();
+		}
+		return true;
+	case pelet::T_LNUMBER:
+	case pelet::T_DNUMBER:
+	case pelet::T_CONSTANT_ENCAPSED_STRING:
+		if (Observers.DoCaptureScalars) {
+			scalar = new pelet::ScalarExpressionClass;
+			Observers.Adopt(scalar);
+			scalar->Init(MakeLexeme());
+			value = scalar;
+		}
+		Next();
+		return true;
+	case pelet::T_LINE:
+	case pelet::T_FILE:
+	case pelet::T_DIR:
+	case pelet::T_TRAIT_C:
+	case pelet::T_METHOD_C:
+	case pelet::T_FUNC_C:
+	case pelet::T_NS_C:
+	case pelet::T_CLASS_C:
+		Next();
+		return true;
+	case pelet::T_VARIABLE:
+	case '$':
+		return Variable(value, isVariable);
+	case pelet::T_STRING:
+	case pelet::T_NS_SEPARATOR:
+		return Name(value, isVariable, false);
+	case pelet::T_NAMESPACE:
+		Next();
+		if (pelet::T_NS_SEPARATOR != Token) {
+			return Error();
+		}
+		return Name(value, isVariable, true);
+	case pelet::T_STATIC:
+		Next();
+		return Static(value, isVariable);
+	case pelet::T_ARRAY:
+		Next();
+		if ('(' != Token) {
+			return Error();
+		}
+		return ArrayPairs(')');
+	case '[':
+		return ArrayPairs(']');
+	case pelet::T_NEW:
+		Next();
+		if (!ClassReference()) {
+			return false;
+		}
+		if ('(' == Token) {
+			return Arguments(arguments) && Expect(')');
+		}
+		return true;
+	case pelet::T_INCLUDE:
+	case pelet::T_INCLUDE_ONCE:
+	case pelet::T_REQUIRE:
+	case pelet::T_REQUIRE_ONCE:
+		return Include(value);
+	case pelet::T_ISSET:
+	case pelet::T_EMPTY:
+	case pelet::T_EVAL:
+		Next();
+		if ('(' != Token) {
+			return Error();
+		}
+		return Arguments(arguments) && Expect(')');
+	case pelet::T_EXIT:
+		Next();
+		if ('(' == Token) {
+			return Arguments(arguments) && Expect(')');
+		}
+		return true;
+	case pelet::T_LIST:
+		Next();
+		if (!Expect('(')) {
+			return false;
+		}
+		while (')' != Token) {
+			if (',' == Token) {
+				Next();
+				continue;
+			}
+			if (!Expression(ignored)) {
+				return false;
+			}
+			if (',' == Token) {
+				Next();
+			}
+			else if (')' != Token) {
+				return Error();
+			}
+		}
+		Next();
+		if ('=' == Token) {
+			
+			// the value of a list assignment is the assigned value
+			Next();
+			return AssignmentExpression(value);
+		}
+		return true;
+	case pelet::T_FUNCTION:
+		Next();
+		if ('&' == Token) {
+			Next();
+		}
+		return Closure();
+	}
+	if (IsPrefixOperator(Token) || '&' == Token) {
+		Next();
+		return AssignmentExpression(ignored);
+	}
+	return Error();
+}
+
+bool pelet::DeclarationScannerClass::Variable(pelet::StatementClass*& value, bool& isVariable) {
+	pelet::StatementClass* ignored = NULL;
+	pelet::SemanticValueClass* thisValue = NULL;
+	pelet::StatementListClass* arguments = NULL;
+	isVariable = true;
+	if ('$' == Token) {
+		
+		// variable variables
+		while ('$' == Token) {
+			Next();
+		}
+		if ('{' == Token) {
+			Next();
+			if (!Expression(ignored) || !Expect('}')) {
+				return false;
+			}
+		}
+		else if (!Expect(pelet::T_VARIABLE)) {
+			return false;
+		}
+	}
+	else {
+		if (PELET_THIS_LENGTH == Analyzer.GetTokenLength()) {
+			Analyzer.GetLexeme(Lexeme);
+			if (Lexeme.caseCompare(UNICODE_STRING_SIMPLE("$this"), 0) == 0) {
+				thisValue = MakeLexeme();
+			}
+		}
+		Next();
+	}
+	if (!Dimensions()) {
+		return false;
+	}
+	if (pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+		return StaticMember(isVariable) && Chain();
+	}
+	if ('(' == Token) {
+		
+		// calling a variable function
+		return Arguments(arguments) && Expect(')') && Chain();
+	}
+	if (pelet::T_OBJECT_OPERATOR != Token) {
+		if (thisValue) {
+			
+			// "$this" by itself is a property to the resource grammar
+			pelet::ClassMemberSymbolClass* member = new pelet::ClassMemberSymbolClass;
+			Observers.Adopt(member);
+			member->MakeAsPublicVariable(thisValue, Observers.GetScope(), Observers.GetDeclaredNamespace());
+			value = member;
+		}
+		return true;
+	}
+	
+	// the first property is the one that is assigned, as long as it is not a method call
+	// (a method call that is then dereferenced as an array is still a property)
+	Next();
+	pelet::SemanticValueClass* propertyValue = NULL;
+	if (thisValue && (pelet::T_STRING == Token || pelet::T_VARIABLE == Token)) {
+		propertyValue = MakeLexeme();
+	}
+	if (!PropertyName() || !Dimensions()) {
+		return false;
+	}
+	bool isMethod = false;
+	if ('(' == Token) {
+		if (!Arguments(arguments) || !Expect(')')) {
+			return false;
+		}
+		isMethod = '[' != Token;
+	}
+	if (!Chain()) {
+		return false;
+	}
+	if (propertyValue && !isMethod) {
+		pelet::ClassMemberSymbolClass* member = new pelet::ClassMemberSymbolClass;
+		Observers.Adopt(member);
+		member->MakeVariable(propertyValue, propertyValue, false, propertyValue->Pos, 
+			Observers.GetScope(), Observers.GetDeclaredNamespace());
+		value = member;
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Name(pelet::StatementClass*& value, bool& isVariable, bool isRelative) {
+	if (isRelative || pelet::T_NS_SEPARATOR == Token) {
+		Next();
+	}
+	if (pelet::T_STRING != Token) {
+		return Error();
+	}
+	
+	// the resource grammar looks at calls to these functions (without a namespace)
+	bool isDefine = false;
+	bool isFuncGetArg = false;
+	pelet::SemanticValueClass* defineValue = NULL;
+	int length = Analyzer.GetTokenLength();
+	if (!isRelative && (PELET_DEFINE_LENGTH == length || PELET_FUNC_GET_ARG_LENGTH == length || PELET_FUNC_GET_ARGS_LENGTH == length)) {
+		Analyzer.GetLexeme(Lexeme);
+		isDefine = Lexeme.caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0;
+		isFuncGetArg = Lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0 
+			|| Lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0;
+		if (isDefine) {
+			defineValue = MakeLexeme();
+		}
+	}
+	Next();
+	while (pelet::T_NS_SEPARATOR == Token) {
+		isDefine = false;
+		isFuncGetArg = false;
+		Next();
+		if (!Expect(pelet::T_STRING)) {
+			return false;
+		}
+	}
+	if (pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+		return StaticMember(isVariable) && Chain();
+	}
+	if ('(' != Token) {
+		
+		// a constant
+		return true;
+	}
+	if (isDefine) {
+		Observers.DoCaptureScalars = true;
+		Observers.DoCaptureCallArguments = true;
+	}
+	if (isFuncGetArg) {
+		Observers.HasCallToFuncGetArg = true;
+	}
+	pelet::StatementListClass* arguments = NULL;
+	if (!Arguments(arguments)) {
+		return false;
+	}
+	if (')' != Token) {
+		return Error();
+	}
+	if (isDefine) {
+		pelet::QualifiedNameClass* functionName = new pelet::QualifiedNameClass;
+		Observers.Adopt(functionName);
+		functionName->Init(defineValue);
+		pelet::ConstantStatementClass* constant = new pelet::ConstantStatementClass;
+		Observers.Adopt(constant);
+		constant->Init(functionName, arguments, Analyzer.GetLineNumber());
+		value = constant;
+		Observers.DoCaptureScalars = false;
+		Observers.DoCaptureCallArguments = false;
+	}
+	Next();
+	if (pelet::T_OBJECT_OPERATOR == Token || '[' == Token) {
+		value = NULL;
+		isVariable = true;
+		return Chain();
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Static(pelet::StatementClass*& value, bool& isVariable) {
+	value = NULL;
+	isVariable = false;
+	if (pelet::T_FUNCTION == Token) {
+		Next();
+		if ('&' == Token) {
+			Next();
+		}
+		return Closure();
+	}
+	if (pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+		return StaticMember(isVariable) && Chain();
+	}
+	return Error();
+}
+
+bool pelet::DeclarationScannerClass::Include(pelet::StatementClass*& value) {
+	Next();
+	pelet::StatementClass* expression = NULL;
+	Observers.DoCaptureScalars = true;
+	if (!Expression(expression)) {
+		return false;
+	}
+	
+	// the grammar reduces the include when it sees the token after the expression
+	pelet::IncludeExpressionClass* include = new pelet::IncludeExpressionClass(Observers.GetScope());
+	Observers.Adopt(include);
+	include->Init(expression, Analyzer.GetLineNumber());
+	Observers.DoCaptureScalars = false;
+	value = include;
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::StaticMember(bool& isVariable) {
+	pelet::StatementListClass* arguments = NULL;
+	Next();
+	isVariable = false;
+	if (pelet::T_STRING == Token || pelet::T_CLASS == Token) {
+		Next();
+	}
+	else if (pelet::T_VARIABLE == Token || '$' == Token) {
+		isVariable = true;
+		pelet::StatementClass* ignored = NULL;
+		bool isIgnored = false;
+		if (!Variable(ignored, isIgnored)) {
+			return false;
+		}
+	}
+	else {
+		return Error();
+	}
+	if ('(' == Token) {
+		isVariable = false;
+		return Arguments(arguments) && Expect(')');
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Chain() {
+	pelet::StatementClass* ignored = NULL;
+	pelet::StatementListClass* arguments = NULL;
+	while (true) {
+		if ('[' == Token) {
+			Next();
+			if (']' != Token && !Expression(ignored)) {
+				return false;
+			}
+			if (!Expect(']')) {
+				return false;
+			}
+		}
+		else if (pelet::T_OBJECT_OPERATOR == Token) {
+			Next();
+			if (!PropertyName() || !Dimensions()) {
+				return false;
+			}
+		}
+		else if ('(' == Token) {
+			if (!Arguments(arguments) || !Expect(')')) {
+				return false;
+			}
+		}
+		else {
+			return true;
+		}
+	}
+}
+
+bool pelet::DeclarationScannerClass::Dimensions() {
+	pelet::StatementClass* ignored = NULL;
+	while ('[' == Token || '{' == Token) {
+		int endToken = '[' == Token ? ']' : '}';
+		Next();
+		if (endToken != Token && !Expression(ignored)) {
+			return false;
+		}
+		if (!Expect(endToken)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::PropertyName() {
+	pelet::StatementClass* ignored = NULL;
+	if (pelet::T_STRING == Token || pelet::T_VARIABLE == Token) {
+		Next();
+		return true;
+	}
+	if ('{' == Token) {
+		Next();
+		return Expression(ignored) && Expect('}');
+	}
+	if ('$' == Token) {
+		while ('$' == Token) {
+			Next();
+		}
+		return Expect(pelet::T_VARIABLE);
+	}
+	return Error();
+}
+
+bool pelet::DeclarationScannerClass::ClassReference() {
+	if (pelet::T_STATIC == Token) {
+		Next();
+		return true;
+	}
+	if (pelet::T_STRING == Token || pelet::T_NS_SEPARATOR == Token || pelet::T_NAMESPACE == Token) {
+		if (pelet::T_NAMESPACE == Token) {
+			Next();
+		}
+		if (pelet::T_NS_SEPARATOR == Token) {
+			Next();
+		}
+		if (!Expect(pelet::T_STRING)) {
+			return false;
+		}
+		while (pelet::T_NS_SEPARATOR == Token) {
+			Next();
+			if (!Expect(pelet::T_STRING)) {
+				return false;
+			}
+		}
+	}
+	else if (pelet::T_VARIABLE == Token || '$' == Token) {
+		while ('$' == Token) {
+			Next();
+		}
+		if (!Expect(pelet::T_VARIABLE) || !Dimensions()) {
+			return false;
+		}
+		while (pelet::T_OBJECT_OPERATOR == Token) {
+			Next();
+			if (!PropertyName() || !Dimensions()) {
+				return false;
+			}
+		}
+	}
+	else {
+		return Error();
+	}
+	if (pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+		Next();
+		return Expect(pelet::T_VARIABLE) && Dimensions();
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::Arguments(pelet::StatementListClass*& arguments) {
+	arguments = NULL;
+	bool isFirst = true;
+	Next();
+	while (')' != Token) {
+		pelet::StatementClass* value = NULL;
+		if ('&' == Token) {
+			Next();
+		}
+		if (!Expression(value)) {
+			return false;
+		}
+		
+		// same as the grammar; the arguments are captured only when they are being
+		// captured after the first argument
+		if (isFirst && Observers.DoCaptureCallArguments) {
+			arguments = new pelet::StatementListClass;
+			Observers.Adopt(arguments);
+		}
+		isFirst = false;
+		if (arguments) {
+			arguments->Push(value);
+		}
+		if (',' == Token) {
+			Next();
+		}
+		else if (')' != Token) {
+			return Error();
+		}
+	}
+	return true;
+}
+
+bool pelet::DeclarationScannerClass::ExpressionList(int endToken) {
+	pelet::StatementClass* ignored = NULL;
+	if (endToken == Token) {
+		return true;
+	}
+	while (true) {
+		if (!Expression(ignored)) {
+			return false;
+		}
+		if (',' != Token) {
+			return true;
+		}
+		Next();
+	}
+}
+
+bool pelet::DeclarationScannerClass::ArrayPairs(int endToken) {
+	pelet::StatementClass* ignored = NULL;
+	Next();
+	while (endToken != Token) {
+		if ('&' == Token) {
+			Next();
+		}
+		if (!Expression(ignored)) {
+			return false;
+		}
+		if (pelet::T_DOUBLE_ARROW == Token) {
+			Next();
+			if ('&' == Token) {
+				Next();
+			}
+			if (!Expression(ignored)) {
+				return false;
+			}
+		}
+		if (',' == Token) {
+			Next();
+		}
+		else if (endToken != Token) {
+			return Error();
+		}
+	}
+	Next();
+	return true;
+}
@@ -0,0 +1,279 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/ExpressionChainParserClass.h>
+#include <pelet/TokenClass.h>
+
+/*
+ * appends a name to the chain, unless the chain is not being kept
+ */
+static void AppendToChain(pelet::VariableClass* variable, const UnicodeString& name, bool isFunction, bool isStatic) {
+	if (variable) {
+		variable->ChainList.push_back(pelet::VariablePropertyClass());
+		pelet::VariablePropertyClass& prop = variable->ChainList.back();
+		prop.Name = name;
+		prop.IsFunction = isFunction;
+		prop.IsStatic = isStatic;
+	}
+}
+
+pelet::ExpressionChainParserClass::ExpressionChainParserClass(pelet::LexicalAnalyzerClass& analyzer, pelet::Versions version)
+	: Analyzer(analyzer)
+	, Version(version)
+	, Token(0) {
+
+}
+
+bool pelet::ExpressionChainParserClass::Parse(pelet::VariableClass& variable) {
+	Next();
+	if (!Chain(&variable)) {
+		return false;
+	}
+
+	// ParseExpression always terminates the expression; a line comment
+	// would have swallowed the terminator
+	if (';' != Token) {
+		return false;
+	}
+	Next();
+	return pelet::T_END == Token;
+}
+
+void pelet::ExpressionChainParserClass::Next() {
+	Token = Analyzer.NextToken();
+}
+
+bool pelet::ExpressionChainParserClass::Chain(pelet::VariableClass* variable) {
+	bool isKept = variable != NULL;
+	UnicodeString name;
+
+	// PHP 5.4 allows array dereferencing of call results
+	bool canDereferenceCalls = pelet::PHP_53 != Version;
+	bool canIndex = false;
+
+	// the grammar only keeps the array accesses of the first two
+	// items in the chain; anything further is left to the grammar
+	int properties = 0;
+	bool isNew = false;
+	if (pelet::T_VARIABLE == Token) {
+		if (isKept) {
+			Analyzer.GetLexeme(name);
+		}
+		AppendToChain(variable, name, false, false);
+		Next();
+		canIndex = true;
+	}
+	else if (pelet::T_NEW == Token) {
+		
+		// "new A()->b" is not valid, the caller will see the "->"
+		return New(variable);
+	}
+	else if ('(' == Token) {
+
+		// "(new A)->b" is only valid in PHP 5.4
+		if (pelet::PHP_53 == Version) {
+			return false;
+		}
+		Next();
+		if (pelet::T_NEW != Token || !New(variable) || ')' != Token) {
+			return false;
+		}
+		isNew = true;
+		Next();
+		if (pelet::T_OBJECT_OPERATOR != Token) {
+			return false;
+		}
+	}
+	else if (pelet::T_STRING == Token || pelet::T_NS_SEPARATOR == Token) {
+		if (!Name(name, isKept)) {
+			return false;
+		}
+		if ('(' == Token) {
+			if (!Arguments()) {
+				return false;
+			}
+			AppendToChain(variable, name, true, false);
+			canIndex = canDereferenceCalls;
+		}
+		else if (pelet::T_PAAMAYIM_NEKUDOTAYIM == Token) {
+			AppendToChain(variable, name, false, false);
+			Next();
+			if (isKept && (pelet::T_VARIABLE == Token || pelet::T_STRING == Token)) {
+				Analyzer.GetLexeme(name);
+			}
+			if (pelet::T_VARIABLE == Token) {
+				
+				// the grammar does not keep array accesses on static properties
+				Next();
+				AppendToChain(variable, name, false, true);
+			}
+			else if (pelet::T_STRING == Token) {
+				Next();
+				if ('(' != Token) {
+
+					// a class constant; nothing can come after it
+					AppendToChain(variable, name, false, true);
+					return true;
+				}
+				if (!Arguments()) {
+					return false;
+				}
+				AppendToChain(variable, name, true, true);
+				canIndex = canDereferenceCalls;
+			}
+			else {
+				return false;
+			}
+		}
+		else {
+
+			// a constant; nothing can come after it
+			AppendToChain(variable, name, false, false);
+			return true;
+		}
+	}
+	else {
+		return false;
+	}
+
+	while (true) {
+		if (pelet::T_OBJECT_OPERATOR == Token) {
+			properties++;
+			Next();
+			if (isKept && (pelet::T_VARIABLE == Token || pelet::T_STRING == Token)) {
+				Analyzer.GetLexeme(name);
+			}
+			if (pelet::T_STRING == Token) {
+				Next();
+				if ('(' == Token) {
+					if (!Arguments()) {
+						return false;
+					}
+					AppendToChain(variable, name, true, false);
+					canIndex = canDereferenceCalls;
+				}
+				else {
+					AppendToChain(variable, name, false, false);
+					canIndex = true;
+				}
+			}
+			else if (pelet::T_VARIABLE == Token) {
+				Next();
+				if ('(' == Token) {
+					return false;
+				}
+				AppendToChain(variable, name, false, false);
+				canIndex = true;
+			}
+			else {
+				return false;
+			}
+		}
+		else if ('[' == Token && canIndex && properties <= 1 && !isNew) {
+			Next();
+			if (!Argument() || ']' != Token) {
+				return false;
+			}
+			Next();
+			AppendToChain(variable, UNICODE_STRING_SIMPLE(""), false, false);
+			if (variable) {
+				variable->ChainList.back().IsArrayAccess = true;
+			}
+		}
+		else {
+			return true;
+		}
+	}
+}
+
+bool pelet::ExpressionChainParserClass::New(pelet::VariableClass* variable) {
+	Next();
+	if (pelet::T_STRING != Token && pelet::T_NS_SEPARATOR != Token) {
+		return false;
+	}
+	UnicodeString className;
+	if (!Name(className, variable != NULL)) {
+		return false;
+	}
+	if ('(' == Token && !Arguments()) {
+		return false;
+	}
+	if (variable) {
+		variable->ExpressionType = pelet::ExpressionClass::NEW_CALL;
+	}
+	AppendToChain(variable, className, false, false);
+	return true;
+}
+
+bool pelet::ExpressionChainParserClass::Name(UnicodeString& name, bool isKept) {
+	UnicodeString part;
+	if (pelet::T_NS_SEPARATOR == Token) {
+		if (isKept) {
+			name.append((UChar)'\\');
+		}
+		Next();
+	}
+	while (pelet::T_STRING == Token) {
+		if (isKept) {
+			Analyzer.GetLexeme(part);
+			name.append(part);
+		}
+		Next();
+		if (pelet::T_NS_SEPARATOR != Token) {
+			return true;
+		}
+		if (isKept) {
+			name.append((UChar)'\\');
+		}
+		Next();
+	}
+	return false;
+}
+
+bool pelet::ExpressionChainParserClass::Arguments() {
+	Next();
+	if (')' == Token) {
+		Next();
+		return true;
+	}
+	while (Argument()) {
+		if (')' == Token) {
+			Next();
+			return true;
+		}
+		if (',' != Token) {
+			return false;
+		}
+		Next();
+	}
+	return false;
+}
+
+bool pelet::ExpressionChainParserClass::Argument() {
+	if (pelet::T_CONSTANT_ENCAPSED_STRING == Token || pelet::T_LNUMBER == Token || pelet::T_DNUMBER == Token) {
+		Next();
+		return true;
+	}
+	return Chain(NULL);
+}
@@ -28,21 +28,77 @@
 #include <unicode/ustring.h>
 #include <algorithm>
 
+/*
+ * the length of "func_get_arg"
+ */
+#define PELET_FUNC_GET_ARG_LENGTH 12
+
 pelet::FullParserObserverClass::FullParserObserverClass(ClassObserverClass* classObserver, ClassMemberObserverClass* memberObserver,
         FunctionObserverClass* functionObserver, VariableObserverClass* variableObserver,
-        ExpressionObserverClass* expressionObserver)
-	: Scope()
+        ExpressionObserverClass* expressionObserver, pelet::AstArenaClass* arena)
+	: DoSkipBodies(false)
+	, Bodies()
+	, DoCaptureComments(true)
+	, Scope()
 	, Class(classObserver)
 	, Member(memberObserver)
 	, Function(functionObserver)
 	, Variable(variableObserver)
 	, ExpressionObserver(expressionObserver)
-	, AllAstItems() 
-	, AnonymousFunctionCount(-1) {
+	, ClassFields(0)
+	, MemberFields(0)
+	, FunctionFields(0)
+	, ExpressionFlags(pelet::EXPRESSION_ALL_TYPES)
+	, UnknownExpression(NULL)
+	, Arena(arena)
+	, OwnedArena(NULL)
+	, AnonymousFunctionCount(-1)
+	, BodyWatcher()
+	, BodyStartPos(0)
+	, BodyStartLineNumber(0)
+	, HasCallToFuncGetArg(false)
+	, IsBodyOnly(false)
+	, BodyDepth(0)
+	, FirstErrorScope()
+	, HasError(false) {
+	BodyWatcher.IsNamedOnly = true;
+	if (!Arena) {
+		OwnedArena = new pelet::AstArenaClass;
+		Arena = OwnedArena;
+	}
+	if (Class) {
+		ClassFields = Class->SymbolFields();
+	}
+	if (Member) {
+		MemberFields = Member->SymbolFields();
+	}
+	if (Function) {
+		FunctionFields = Function->SymbolFields();
+	}
+	int allFields = ClassFields | MemberFields | FunctionFields;
+	if (Variable) {
+		allFields |= Variable->SymbolFields();
+	}
+	if (ExpressionObserver) {
+		allFields |= ExpressionObserver->SymbolFields();
+	}
+	DoCaptureComments = (allFields & (pelet::SYMBOL_COMMENTS | pelet::SYMBOL_RETURN_TYPES)) != 0;
+
+	// variable observers are given the right hand side of assignments, and
+	// define() and include detection need the scalars
+	if (ExpressionObserver && !Variable) {
+		ExpressionFlags = ExpressionObserver->ExpressionTypes() | pelet::EXPRESSION_TYPE_REQUIRED;
+		if (Class) {
+			ExpressionFlags |= pelet::EXPRESSION_TYPE_SCALAR;
+		}
+	}
 }
 
 pelet::FullParserObserverClass::~FullParserObserverClass() {
 	SemanticValueFree();
+	if (OwnedArena) {
+		delete OwnedArena;
+	}
 }
 
 void pelet::FullParserObserverClass::NamespaceAliasClear() {
@@ -65,8 +121,8 @@ void pelet::FullParserObserverClass::NotifyVariablesFromParameterList(pelet::Par
 			// but also we want to keep the same memory ownership semantics
 			// ie. we want the pointer to be alive until the observer
 			// dies.
-			pelet::VariableClass* variable = new pelet::VariableClass(Scope);
-			AllAstItems.push_back(variable);
+			pelet::VariableClass* variable = new (*Arena) pelet::VariableClass(Scope);
+			Arena->Adopt(variable);
 
 			parameters.Param(i, paramName, paramType);
 			
@@ -80,8 +136,8 @@ void pelet::FullParserObserverClass::NotifyVariablesFromParameterList(pelet::Par
 			if (!paramType.isEmpty()) {
 
 				// TODO: set correct line/pos
-				pelet::NewInstanceExpressionClass* newCallExpr = new pelet::NewInstanceExpressionClass(Scope);
-				AllAstItems.push_back(newCallExpr);
+				pelet::NewInstanceExpressionClass* newCallExpr = new (*Arena) pelet::NewInstanceExpressionClass(Scope);
+				Arena->Adopt(newCallExpr);
 
 				newCallExpr->ClassName = paramType;
 				if (Variable) {
@@ -92,8 +148,8 @@ void pelet::FullParserObserverClass::NotifyVariablesFromParameterList(pelet::Par
 				}
 			} 
 			else {
-				pelet::ExpressionClass* unknownExpression = new pelet::ExpressionClass(Scope);
-				AllAstItems.push_back(unknownExpression);
+				pelet::ExpressionClass* unknownExpression = new (*Arena) pelet::ExpressionClass(Scope);
+				Arena->Adopt(unknownExpression);
 				unknownExpression->ExpressionType = pelet::ExpressionClass::UNKNOWN;
 				if (Variable) {
 					Variable->VariableFound(currentNamespaceName, currentClassName, currentMethodName, *variable, unknownExpression, comment);
@@ -163,6 +219,10 @@ void pelet::FullParserObserverClass::NotifyLocalVariableFromPhpDoc(const Unicode
 			pelet::ExpressionClass expression(Scope);
 			UnicodeString variableName;
 
+			// the comment has no expression; observers cast SCALAR expressions 
+			// to ScalarExpressionClass
+			expression.ExpressionType = pelet::ExpressionClass::UNKNOWN;
+
 			// example line: @var string $nameString a string version of a name
 			// will be lenient and allow the reverse var then type
 			// @var $nameString string
@@ -192,20 +252,27 @@ void pelet::FullParserObserverClass::NotifyLocalVariableFromPhpDoc(const Unicode
 }
 
 pelet::SemanticValueClass* pelet::FullParserObserverClass::SemanticValueInit() {
-	pelet::SemanticValueClass* value = new pelet::SemanticValueClass;
-	AllAstItems.push_back(value);
+	pelet::SemanticValueClass* value = new (*Arena) pelet::SemanticValueClass;
+	Arena->Adopt(value);
 	return value;
 }
 
 void pelet::FullParserObserverClass::SemanticValueFree() {
-	for (size_t i = 0; i < AllAstItems.size(); ++i) {
-		delete AllAstItems[i];
-	}
-	AllAstItems.clear();
+	Arena->Reset();
+	UnknownExpression = NULL;
 }
 
 int pelet::FullLex(pelet::ParserType* value, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers) {
-	int ret = analyzer.NextToken();
+	int ret = 0;
+	if (observers.IsBodyEnd()) {
+		ret = pelet::T_END;
+	}
+	else if (observers.IsBodyStart()) {
+		ret = observers.SkipBody(analyzer);
+	}
+	else {
+		ret = analyzer.NextToken();
+	}
 	value->semanticValue = observers.SemanticValueInit();
 
 	// ignore these token; there are no parse rules for them
@@ -223,7 +290,9 @@ int pelet::FullLex(pelet::ParserType* value, pelet::LexicalAnalyzerClass &analyz
 		// get type hints for local varibles
 		while (pelet::T_DOC_COMMENT == ret || pelet::T_COMMENT == ret) {
 			if (pelet::T_DOC_COMMENT == ret) {
-				analyzer.GetLexeme(value->semanticValue->Comment);
+				if (observers.DoCaptureComments) {
+					analyzer.GetLexeme(value->semanticValue->Comment);
+				}
 			} else if (pelet::T_COMMENT == ret) {
 				analyzer.GetLexeme(commentValue.Comment);
 			}
@@ -238,70 +307,76 @@ int pelet::FullLex(pelet::ParserType* value, pelet::LexicalAnalyzerClass &analyz
 	}
 	value->semanticValue->Token = ret;
 	analyzer.GetLexeme(value->semanticValue->Lexeme);
+	if (pelet::T_STRING == ret) {
+		observers.WatchString(value->semanticValue->Lexeme);
+	}
 	value->semanticValue->Pos = analyzer.GetCharacterPosition();
 	value->semanticValue->LineNumber = analyzer.GetLineNumber();
+	observers.WatchToken(ret, value->semanticValue->Pos, value->semanticValue->LineNumber);
 	return ret;
 }
 
 void pelet::FullGrammarError(pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers, std::string msg) {
 	int capacity = msg.length() + 1;
-	int written = u_sprintf(analyzer.ParserError.getBuffer(capacity), "%s", msg.c_str());
-	analyzer.ParserError.releaseBuffer(written);
-	observers.SemanticValueFree();
+	UnicodeString error;
+	int written = u_sprintf(error.getBuffer(capacity), "%s", msg.c_str());
+	error.releaseBuffer(written);
+	analyzer.AddParserError(error);
+	observers.ErrorFound();
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::AssignmentExpressionFromExpressionFound(pelet::VariableClass* variable, pelet::ExpressionClass* expression) {
-	pelet::AssignmentExpressionClass* newExpr =  new pelet::AssignmentExpressionClass(Scope);
+	pelet::AssignmentExpressionClass* newExpr =  new (*Arena) pelet::AssignmentExpressionClass(Scope);
 	newExpr->LineNumber = variable->LineNumber;
 	newExpr->Pos = variable->Pos;
 	newExpr->Destination = *variable;
 	newExpr->Expression = expression;
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::AssignmentExpressionFromNewFound(pelet::VariableClass* variable, pelet::QualifiedNameClass* className, 
 																						pelet::StatementListClass* callArguments) {
-	pelet::NewInstanceExpressionClass* classExpr =  new pelet::NewInstanceExpressionClass(Scope);
+	pelet::NewInstanceExpressionClass* classExpr =  new (*Arena) pelet::NewInstanceExpressionClass(Scope);
 	classExpr->LineNumber = variable->LineNumber;
 	classExpr->Pos = variable->Pos;
 	classExpr->ClassName = Scope.FullyQualify(*className, DeclaredNamespace);
 	classExpr->AddStatementsAsArguments(callArguments);
 
-	pelet::AssignmentExpressionClass* newExpr = new pelet::AssignmentExpressionClass(Scope);
+	pelet::AssignmentExpressionClass* newExpr = new (*Arena) pelet::AssignmentExpressionClass(Scope);
 	newExpr->LineNumber = variable->LineNumber;
 	newExpr->Pos = variable->Pos;
 	newExpr->Destination = *variable;
 	newExpr->Expression = classExpr;
 
-	AllAstItems.push_back(newExpr);
-	AllAstItems.push_back(classExpr);
+	Arena->Adopt(newExpr);
+	Arena->Adopt(classExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::AssignmentExpressionFromVariableFound(pelet::VariableClass* variable, pelet::VariableClass* srcVariable) {
-	pelet::AssignmentExpressionClass* newExpr = new pelet::AssignmentExpressionClass(Scope);
+	pelet::AssignmentExpressionClass* newExpr = new (*Arena) pelet::AssignmentExpressionClass(Scope);
 	newExpr->LineNumber = variable->LineNumber;
 	newExpr->Pos = variable->Pos;
 	newExpr->Destination = *variable;
 	newExpr->Expression = srcVariable;
 
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 
 }
 
 pelet::ClassMemberSymbolClass* pelet::FullParserObserverClass::ClassMemberSymbolMake(pelet::SemanticValueClass* varValue) {
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	newMember->Make(varValue, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newMember);
+	Arena->Adopt(newMember);
 	return newMember;
 }
 
 pelet::ClassMemberSymbolClass* pelet::FullParserObserverClass::ClassMemberSymbolMakeAsPublicVariable(pelet::SemanticValueClass* varValue) {
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	newMember->MakeAsPublicVariable(varValue, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newMember);
+	Arena->Adopt(newMember);
 	return newMember;
 }
 
@@ -309,7 +384,7 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ClassMemberSymbolMake
         pelet::SemanticValueClass* functionValue, pelet::ParametersListClass* parameters,
 		pelet::StatementListClass* functionStatements,
 		pelet::SemanticValueClass* startingBodyTokenValue, pelet::SemanticValueClass* endingBodyTokenValue) {
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	pelet::TokenPositionClass startingPos;
 	startingPos.LineNumber = nameValue->LineNumber;
 	startingPos.Pos = startingBodyTokenValue->Pos;
@@ -319,48 +394,30 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ClassMemberSymbolMake
 	endingPos.Pos = endingBodyTokenValue->Pos;
 	endingPos.Token = endingBodyTokenValue->Token;
 	
-	// check all the function body for calls to func_get_arg or func_get_args
-	// note that this is not a simple foreach loop, we must recurse
-	// down all expressions and check those too, for example the 
-	// binary expression $cnt = func_get_args();
-	bool hasVariableArguments = false;
-	pelet::FunctionCallCountObserverClass callCount;
-	callCount.FunctionName = UNICODE_STRING_SIMPLE("func_get_arg");
-	hasVariableArguments |= callCount.CountCalls(functionStatements) > 0;
-	callCount.FunctionName = UNICODE_STRING_SIMPLE("func_get_args");
-	hasVariableArguments |= callCount.CountCalls(functionStatements) > 0;
-	
-	newMember->MakeFunction(nameValue, isReference, functionValue, parameters, startingPos, endingPos, Scope, DeclaredNamespace, hasVariableArguments);
+	// the calls to func_get_arg or func_get_args are found by WatchString(), the
+	// body statements may not have all of the expressions (the expression observer
+	// may not want them)
+	newMember->MakeFunction(nameValue, isReference, functionValue, parameters, startingPos, endingPos, Scope, DeclaredNamespace, HasCallToFuncGetArg);
 	newMember->MethodStatements.PushAll(functionStatements);
-	AllAstItems.push_back(newMember);
+	Arena->Adopt(newMember);
 	return StatementListMakeAndAppend(newMember);
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::ClassMemberSymbolMakeMethod(pelet::SemanticValueClass* nameValue, pelet::ClassMemberSymbolClass* modifiers,
         bool isReference, pelet::SemanticValueClass* functionValue, pelet::ParametersListClass* parameters,
 		pelet::ClassMemberSymbolClass* methodBody) {
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
-	
-	// check all the function body for calls to func_get_arg or func_get_args
-	// note that this is not a simple foreach loop, we must recurse
-	// down all expressions and check those too, for example the 
-	// binary expression $cnt = func_get_args();
-	bool hasVariableArguments = false;
-	pelet::FunctionCallCountObserverClass callCount;
-	callCount.FunctionName = UNICODE_STRING_SIMPLE("func_get_arg");
-	hasVariableArguments |= callCount.CountCalls(&methodBody->MethodStatements) > 0;
-	callCount.FunctionName = UNICODE_STRING_SIMPLE("func_get_args");
-	hasVariableArguments |= callCount.CountCalls(&methodBody->MethodStatements) > 0;
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	
-	newMember->MakeMethod(nameValue, modifiers, isReference, functionValue, parameters, methodBody, Scope, DeclaredNamespace, hasVariableArguments);
-	AllAstItems.push_back(newMember);
+	// the calls to func_get_arg or func_get_args are found by WatchString()
+	newMember->MakeMethod(nameValue, modifiers, isReference, functionValue, parameters, methodBody, Scope, DeclaredNamespace, HasCallToFuncGetArg);
+	Arena->Adopt(newMember);
 	pelet::StatementListClass* list = StatementListMakeAndAppend(newMember);
 	return list;
 }
 
 pelet::ClassMemberSymbolClass* pelet::FullParserObserverClass::ClassMemberMakeBody(pelet::StatementListClass* bodyStatements, 
 	pelet::SemanticValueClass* startingPositionTokenValue, pelet::SemanticValueClass* endingPositionTokenValue) {
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	pelet::TokenPositionClass startingPos;
 	startingPos.LineNumber = startingPositionTokenValue->LineNumber;
 	startingPos.Pos = startingPositionTokenValue->Pos;
@@ -370,7 +427,7 @@ pelet::ClassMemberSymbolClass* pelet::FullParserObserverClass::ClassMemberMakeBo
 	endingPos.Pos = endingPositionTokenValue->Pos;
 	endingPos.Token = endingPositionTokenValue->Token;
 	newMember->MakeBody(bodyStatements, startingPos, endingPos);
-	AllAstItems.push_back(newMember);
+	Arena->Adopt(newMember);
 	return newMember;
 }
 
@@ -380,9 +437,9 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ClassMemberSymbolMake
 	if (nameValue) {
 		endingPosition = nameValue->Pos + nameValue->Lexeme.length();
 	}
-	pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass();
+	pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass();
 	newMember->MakeVariable(nameValue, commentValue, isConstant, endingPosition, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newMember);
+	Arena->Adopt(newMember);
 	return StatementListMakeAndAppend(newMember);
 }
 
@@ -424,21 +481,21 @@ pelet::ClassSymbolClass* pelet::FullParserObserverClass::ClassSymbolAddToImpleme
 }
 
 pelet::ClassSymbolClass* pelet::FullParserObserverClass::ClassSymbolAddToImplements(pelet::QualifiedNameClass* implementsClassName) {
-	pelet::ClassSymbolClass* newClassSymbol = new pelet::ClassSymbolClass();
+	pelet::ClassSymbolClass* newClassSymbol = new (*Arena) pelet::ClassSymbolClass();
 	newClassSymbol->AddToImplements(implementsClassName, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newClassSymbol);
+	Arena->Adopt(newClassSymbol);
 	return newClassSymbol;
 }
 
 pelet::ClassSymbolClass* pelet::FullParserObserverClass::ClassSymbolExtends(pelet::QualifiedNameClass* extendsClassName) {
-	pelet::ClassSymbolClass* newClassSymbol = new pelet::ClassSymbolClass();
+	pelet::ClassSymbolClass* newClassSymbol = new (*Arena) pelet::ClassSymbolClass();
 	newClassSymbol->SetExtends(extendsClassName, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newClassSymbol);
+	Arena->Adopt(newClassSymbol);
 	return newClassSymbol;
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::ClassSymbolMake(pelet::SemanticValueClass* nameValue, pelet::ClassSymbolClass* classTypeSymbol, pelet::ClassSymbolClass* extendsSymbol, pelet::ClassSymbolClass* implementsSymbol, pelet::SemanticValueClass* endToken) {
-	pelet::ClassSymbolClass* newClassSymbol = new pelet::ClassSymbolClass();
+	pelet::ClassSymbolClass* newClassSymbol = new (*Arena) pelet::ClassSymbolClass();
 	newClassSymbol->GrabClassName(nameValue);
 	newClassSymbol->NamespaceName = DeclaredNamespace.ToSignature();
 	newClassSymbol->Comment = classTypeSymbol->Comment;
@@ -455,12 +512,12 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ClassSymbolMake(pelet
 	newClassSymbol->StartingLineNumber = nameValue->LineNumber;
 	newClassSymbol->EndingLineNumber = endToken->LineNumber;
 
-	AllAstItems.push_back(newClassSymbol);
+	Arena->Adopt(newClassSymbol);
 	return StatementListMakeAndAppend(newClassSymbol);
 }
 
 pelet::ClassSymbolClass* pelet::FullParserObserverClass::ClassSymbolStart(pelet::SemanticValueClass* commentValue, bool isAbstract, bool isFinal, bool isInterface, bool isTrait) {
-	pelet::ClassSymbolClass* newClassSymbol = new pelet::ClassSymbolClass();
+	pelet::ClassSymbolClass* newClassSymbol = new (*Arena) pelet::ClassSymbolClass();
 	if (commentValue) {
 		newClassSymbol->AppendToComment(commentValue);
 	}
@@ -469,12 +526,12 @@ pelet::ClassSymbolClass* pelet::FullParserObserverClass::ClassSymbolStart(pelet:
 	newClassSymbol->IsInterface = isInterface;
 	newClassSymbol->IsTrait = isTrait;
 
-	AllAstItems.push_back(newClassSymbol);
+	Arena->Adopt(newClassSymbol);
 	return newClassSymbol;
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::ConstantMake(pelet::SemanticValueClass* value, int lineNumber) {
-	pelet::ConstantStatementClass* constant = new pelet::ConstantStatementClass();
+	pelet::ConstantStatementClass* constant = new (*Arena) pelet::ConstantStatementClass();
 	if (value) {
 		constant->Name = value->Lexeme;
 	}
@@ -484,13 +541,18 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ConstantMake(pelet::S
 	constant->LineNumber = lineNumber;
 	constant->NamespaceName = DeclaredNamespace.ToSignature();
 
-	AllAstItems.push_back(constant);
+	Arena->Adopt(constant);
 	return StatementListMakeAndAppend(constant);
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::ExpressionMakeArrayPair(pelet::ExpressionClass* key, pelet::ExpressionClass* value) {
 	pelet::StatementListClass* stmtList = StatementListMake();
-	pelet::ArrayPairExpressionClass* pair = new pelet::ArrayPairExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_ARRAY)) {
+
+		// the pairs are only kept by the array
+		return stmtList;
+	}
+	pelet::ArrayPairExpressionClass* pair = new (*Arena) pelet::ArrayPairExpressionClass(Scope);
 	if (key) {
 		pair->LineNumber = key->LineNumber;
 		pair->Pos = key->Pos;
@@ -503,12 +565,15 @@ pelet::StatementListClass* pelet::FullParserObserverClass::ExpressionMakeArrayPa
 	pair->Value = value;
 	stmtList->Push(pair);
 
-	AllAstItems.push_back(pair);
+	Arena->Adopt(pair);
 	return stmtList;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeArray(pelet::StatementListClass* pairStatements) {
-	pelet::ArrayExpressionClass* newExpr = new pelet::ArrayExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_ARRAY)) {
+		return ExpressionUnknown();
+	}
+	pelet::ArrayExpressionClass* newExpr = new (*Arena) pelet::ArrayExpressionClass(Scope);
 
 	// populate the array pairs
 	for (size_t i = 0; i < pairStatements->Size(); ++i) {
@@ -525,12 +590,12 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeArray(pele
 			}
 		}
 	}
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeAssignmentList(pelet::StatementListClass* assignmentList, pelet::ExpressionClass* srcExpression) {
-	pelet::AssignmentListExpressionClass* newExpr = new pelet::AssignmentListExpressionClass(Scope);
+	pelet::AssignmentListExpressionClass* newExpr = new (*Arena) pelet::AssignmentListExpressionClass(Scope);
 	newExpr->Expression = srcExpression;
 	for (size_t i = 0; i < assignmentList->Size(); ++i) {
 		pelet::StatementClass::Types type =  assignmentList->TypeAt(i);
@@ -548,12 +613,12 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeAssignment
 			}
 		}
 	}
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeClassConstant(pelet::QualifiedNameClass* className, pelet::SemanticValueClass* constantName) {
-	pelet::VariableClass* newExpr = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newExpr = new (*Arena) pelet::VariableClass(Scope);
 	UnicodeString fullClassName = Scope.FullyQualify(*className, DeclaredNamespace);
 	UnicodeString constantNameString;
 	if (constantName) {
@@ -562,12 +627,12 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeClassConst
 	newExpr->ToStaticFunctionCall(fullClassName, constantNameString, false);
 	newExpr->LineNumber = className->LineNumber;
 	newExpr->Pos = className->Pos;
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCall(pelet::QualifiedNameClass* functionName, pelet::StatementListClass* callArguments, int lineNumber) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 
 	newVar->LineNumber = lineNumber;
 	newVar->Pos = functionName->Pos;
@@ -586,12 +651,12 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCall(p
 	// not sure how to resolve the namespace here; since a functions fallback to the root namespace
 	UnicodeString fullFunctionName = Scope.FullyQualify(*functionName, DeclaredNamespace);
 	newVar->AppendToChain(fullFunctionName, varCallArguments, true, false);
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCallFromAbsoluteNamespace(pelet::QualifiedNameClass* functionName, pelet::StatementListClass* callArguments, int lineNumber) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	functionName->MakeAbsolute();
 	std::vector<pelet::ExpressionClass*> varCallArguments;
 	for (size_t i = 0; i < callArguments->Size(); ++i) {
@@ -605,12 +670,12 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCallFr
 	}
 	UnicodeString fullFunctionName = functionName->ToSignature() ;
 	newVar->AppendToChain(fullFunctionName, varCallArguments, true, false);
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCallFromDeclaredNamespace(pelet::QualifiedNameClass* functionName, pelet::StatementListClass* callArguments, int lineNumber) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	std::vector<pelet::ExpressionClass*> varCallArguments;
 	for (size_t i = 0; i < callArguments->Size(); ++i) {
 		pelet::StatementClass::Types type =  callArguments->TypeAt(i);
@@ -623,40 +688,43 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeFunctionCallFr
 	}
 	UnicodeString fullFunctionName = Scope.FullyQualify(*functionName, DeclaredNamespace);
 	newVar->AppendToChain(fullFunctionName, varCallArguments, true, false);
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeGlobalVariable(pelet::SemanticValueClass* value) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	if (value) {
 		newVar->AppendToChain(value->Lexeme);
 		newVar->LineNumber = value->LineNumber;
 		newVar->Pos = value->Pos;
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::NewInstanceExpressionClass* pelet::FullParserObserverClass::ExpressionMakeNewInstanceCall(pelet::QualifiedNameClass* className, 
 																								 pelet::StatementListClass* callArguments) {
-	pelet::NewInstanceExpressionClass* newExpr = new pelet::NewInstanceExpressionClass(Scope);
+	pelet::NewInstanceExpressionClass* newExpr = new (*Arena) pelet::NewInstanceExpressionClass(Scope);
 	newExpr->LineNumber = className->LineNumber;
 	newExpr->Pos = className->Pos;
 	newExpr->ClassName = Scope.FullyQualify(*className, DeclaredNamespace);
 	newExpr->AddStatementsAsArguments(callArguments);
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionInstanceOfOperation(pelet::ExpressionClass* leftExpression, 
 	pelet::QualifiedNameClass* className) {
-	pelet::InstanceOfOperationClass* newExpr = new pelet::InstanceOfOperationClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_INSTANCEOF_OPERATION)) {
+		return ExpressionUnknown();
+	}
+	pelet::InstanceOfOperationClass* newExpr = new (*Arena) pelet::InstanceOfOperationClass(Scope);
 	newExpr->LineNumber = leftExpression->LineNumber;
 	newExpr->Pos = leftExpression->Pos;
 	newExpr->Expression1 = leftExpression;
 	newExpr->ClassName = Scope.FullyQualify(*className, DeclaredNamespace);
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
@@ -670,47 +738,56 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::NewInstanceAppendToChain
 
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeObject(pelet::ExpressionClass* srcExpression) {
-	pelet::ExpressionClass* newExpr = new pelet::ExpressionClass(Scope);
+	pelet::ExpressionClass* newExpr = new (*Arena) pelet::ExpressionClass(Scope);
 	newExpr->LineNumber = srcExpression->LineNumber;
 	newExpr->Pos = srcExpression->Pos;
 	newExpr->Copy(*srcExpression);
 	newExpr->ExpressionType = pelet::ExpressionClass::VARIABLE;
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeScalar(pelet::ExpressionClass* srcExpression) {
-	pelet::ScalarExpressionClass* newExpr = new pelet::ScalarExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_SCALAR)) {
+		return ExpressionUnknown();
+	}
+	pelet::ScalarExpressionClass* newExpr = new (*Arena) pelet::ScalarExpressionClass(Scope);
 	newExpr->LineNumber = srcExpression->LineNumber;
 	newExpr->Pos = srcExpression->Pos;
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeScalar(pelet::SemanticValueClass* srcValue) {
-	pelet::ScalarExpressionClass* newExpr = new pelet::ScalarExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_SCALAR)) {
+		return ExpressionUnknown();
+	}
+	pelet::ScalarExpressionClass* newExpr = new (*Arena) pelet::ScalarExpressionClass(Scope);
 	if (srcValue) {
 		newExpr->LineNumber = srcValue->LineNumber;
 		newExpr->Pos = srcValue->Pos;
 		newExpr->Value = srcValue->Lexeme;
 	}
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeScalarFromConstant(pelet::QualifiedNameClass* constantName) {
-	pelet::ScalarExpressionClass* newExpr = new pelet::ScalarExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_SCALAR)) {
+		return ExpressionUnknown();
+	}
+	pelet::ScalarExpressionClass* newExpr = new (*Arena) pelet::ScalarExpressionClass(Scope);
 	newExpr->LineNumber = constantName->LineNumber;
 	newExpr->Pos = constantName->Pos;
 	newExpr->Value = constantName->ToSignature();
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeStaticMethodCall(pelet::QualifiedNameClass* className, 
 		pelet::SemanticValueClass* methodName, pelet::StatementListClass* callArguments, int lineNumber) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	newVar->LineNumber = lineNumber;
 	newVar->Pos = className->Pos;
 	std::vector<pelet::ExpressionClass*> varCallArguments;
@@ -726,13 +803,13 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeStaticMethodCa
 	if (methodName) {
 		newVar->AppendToChain(methodName->Lexeme, varCallArguments, true, true);
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeStaticMethodCall(pelet::QualifiedNameClass* className, 
 		pelet::VariableClass* methodName, pelet::StatementListClass* callArguments, int lineNumber) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	newVar->LineNumber = lineNumber;
 	newVar->Pos = className->Pos;
 	std::vector<pelet::ExpressionClass*> varCallArguments;
@@ -748,18 +825,18 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeStaticMethodCa
 	if (methodName && !methodName->ChainList.empty()) {
 		newVar->AppendToChain(methodName->ChainList[0].Name, varCallArguments, true, true);
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeStaticVariable(pelet::SemanticValueClass* nameValue) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	if (nameValue) {
 		newVar->AppendToChain(nameValue->Lexeme);
 		newVar->LineNumber = nameValue->LineNumber;
 		newVar->Pos = nameValue->Pos;
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
@@ -778,53 +855,68 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableAppendArrayOffset(
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionAssignmentCompoundOperation(int operatorToken, pelet::VariableClass* leftOperand, pelet::ExpressionClass* rightOperand) {
-	pelet::AssignmentCompoundExpressionClass* operation = new pelet::AssignmentCompoundExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_ASSIGNMENT_COMPOUND)) {
+		return ExpressionUnknown();
+	}
+	pelet::AssignmentCompoundExpressionClass* operation = new (*Arena) pelet::AssignmentCompoundExpressionClass(Scope);
 	operation->LineNumber = leftOperand->LineNumber;
 	operation->Pos = leftOperand->Pos;
 	operation->Operator = operatorToken;
 	operation->Variable = *leftOperand;
 	operation->RightOperand = rightOperand;
 
-	AllAstItems.push_back(operation);
+	Arena->Adopt(operation);
 	return operation;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionBinaryOperation(int operatorToken, pelet::ExpressionClass* leftOperand, pelet::ExpressionClass* rightOperand) {
-	pelet::BinaryOperationClass* operation = new pelet::BinaryOperationClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_BINARY_OPERATION)) {
+		return ExpressionUnknown();
+	}
+	pelet::BinaryOperationClass* operation = new (*Arena) pelet::BinaryOperationClass(Scope);
 	operation->LineNumber = leftOperand->LineNumber;
 	operation->Pos = leftOperand->Pos;
 	operation->Operator = operatorToken;
 	operation->LeftOperand = leftOperand;
 	operation->RightOperand = rightOperand;
 
-	AllAstItems.push_back(operation);
+	Arena->Adopt(operation);
 	return operation;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionUnaryOperation(int operatorToken, pelet::ExpressionClass* operand) {
-	pelet::UnaryOperationClass* operation = new pelet::UnaryOperationClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_UNARY_OPERATION)) {
+		return ExpressionUnknown();
+	}
+	pelet::UnaryOperationClass* operation = new (*Arena) pelet::UnaryOperationClass(Scope);
 	operation->LineNumber = operand->LineNumber;
 	operation->Pos = operand->Pos;
 	operation->Operator = operatorToken;
 	operation->Operand = operand;
 
-	AllAstItems.push_back(operation);
+	Arena->Adopt(operation);
 	return operation;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionUnaryVariableOperation(int operatorToken, pelet::VariableClass* operand) {
-	pelet::UnaryVariableOperationClass* operation = new pelet::UnaryVariableOperationClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_UNARY_VARIABLE_OPERATION)) {
+		return ExpressionUnknown();
+	}
+	pelet::UnaryVariableOperationClass* operation = new (*Arena) pelet::UnaryVariableOperationClass(Scope);
 	operation->LineNumber = operand->LineNumber;
 	operation->Pos = operand->Pos;
 	operation->Operator = operatorToken;
 	operation->Variable.Copy(*operand);
 
-	AllAstItems.push_back(operation);
+	Arena->Adopt(operation);
 	return operation;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionTernaryOperation(pelet::ExpressionClass* leftOperand, pelet::ExpressionClass* middleOperand, pelet::ExpressionClass* rightOperand) {
-	pelet::TernaryOperationClass* operation = new pelet::TernaryOperationClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_TERNARY_OPERATION)) {
+		return ExpressionUnknown();
+	}
+	pelet::TernaryOperationClass* operation = new (*Arena) pelet::TernaryOperationClass(Scope);
 	operation->LineNumber = leftOperand->LineNumber;
 	operation->Pos = leftOperand->Pos;
 	operation->Expression1 = leftOperand;
@@ -833,23 +925,30 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionTernaryOperati
 		operation->Expression3 = rightOperand;
 	}
 
-	AllAstItems.push_back(operation);
+	Arena->Adopt(operation);
 	return operation;
 }
 
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionNil() {
-	pelet::ExpressionClass* newExpr = new pelet::ExpressionClass(Scope);
+	pelet::ExpressionClass* newExpr = new (*Arena) pelet::ExpressionClass(Scope);
 	newExpr->Type = pelet::ExpressionClass::EXPRESSION;
 	newExpr->ExpressionType = pelet::ExpressionClass::UNKNOWN;
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
+pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionUnknown() {
+	if (!UnknownExpression) {
+		UnknownExpression = ExpressionNil();
+	}
+	return UnknownExpression;
+}
+
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeClosure(
 	pelet::ParametersListClass* parameters, pelet::StatementListClass* lexicalVars, pelet::StatementListClass* stmts,
 	pelet::SemanticValueClass* startingPositionTokenValue, pelet::SemanticValueClass* endingPositionTokenValue) {
-		pelet::ClosureExpressionClass* closure = new pelet::ClosureExpressionClass(Scope);
+		pelet::ClosureExpressionClass* closure = new (*Arena) pelet::ClosureExpressionClass(Scope);
 		closure->StartingPosition = startingPositionTokenValue->Pos;
 		closure->EndingPosition = endingPositionTokenValue->Pos;
 		for (size_t i = 0; i < parameters->GetCount(); ++i) {
@@ -866,8 +965,8 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeClosure(
 				isReference = true;
 			}
 			
-			pelet::VariableClass* var = new pelet::VariableClass(Scope);
-			AllAstItems.push_back(var);
+			pelet::VariableClass* var = new (*Arena) pelet::VariableClass(Scope);
+			Arena->Adopt(var);
 
 			// fill in line number, pos of params as the closure start for now
 			var->LineNumber = startingPositionTokenValue->LineNumber;
@@ -892,33 +991,41 @@ pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeClosure(
 		}
 		closure->Statements.PushAll(stmts);
 
-		AllAstItems.push_back(closure);
+		Arena->Adopt(closure);
 		return closure;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionIsset(pelet::ExpressionClass* expr) {
-	pelet::IssetExpressionClass* isset = new pelet::IssetExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_ISSET)) {
+		return ExpressionUnknown();
+	}
+	pelet::IssetExpressionClass* isset = new (*Arena) pelet::IssetExpressionClass(Scope);
 	isset->Expressions.push_back(expr);
 
-	AllAstItems.push_back(isset);
+	Arena->Adopt(isset);
 	return isset;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionIssetMerge(pelet::IssetExpressionClass* isset, pelet::ExpressionClass* expr) {
-	isset->Expressions.push_back(expr);
+	if (pelet::ExpressionClass::ISSET == isset->ExpressionType) {
+		isset->Expressions.push_back(expr);
+	}
 	return isset;
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionEval(pelet::ExpressionClass* expr) {
-	pelet::EvalExpressionClass* eval = new pelet::EvalExpressionClass(Scope);
+	if (!(ExpressionFlags & pelet::EXPRESSION_TYPE_EVAL)) {
+		return ExpressionUnknown();
+	}
+	pelet::EvalExpressionClass* eval = new (*Arena) pelet::EvalExpressionClass(Scope);
 	eval->Expression = expr;
 
-	AllAstItems.push_back(eval);
+	Arena->Adopt(eval);
 	return eval;
 }
 	
 pelet::StatementListClass* pelet::FullParserObserverClass::GlobalVariablesStatementMake(pelet::StatementListClass* variables) {
-	pelet::GlobalVariableStatementClass* globalVars =  new pelet::GlobalVariableStatementClass();
+	pelet::GlobalVariableStatementClass* globalVars =  new (*Arena) pelet::GlobalVariableStatementClass();
 	for (size_t i = 0; i < variables->Size(); ++i) {
 		if (pelet::StatementClass::EXPRESSION == variables->TypeAt(i)) {
 			pelet::ExpressionClass* expr = (pelet::ExpressionClass*) variables->At(i);
@@ -927,12 +1034,12 @@ pelet::StatementListClass* pelet::FullParserObserverClass::GlobalVariablesStatem
 			}
 		}
 	}
-	AllAstItems.push_back(globalVars);
+	Arena->Adopt(globalVars);
 	return StatementListMakeAndAppend(globalVars);
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::StaticVariablesStatementMake(pelet::StatementListClass* variables) {
-	pelet::StaticVariableStatementClass* staticVars =  new pelet::StaticVariableStatementClass();
+	pelet::StaticVariableStatementClass* staticVars =  new (*Arena) pelet::StaticVariableStatementClass();
 	for (size_t i = 0; i < variables->Size(); ++i) {
 		if (pelet::StatementClass::EXPRESSION == variables->TypeAt(i)) {
 			pelet::ExpressionClass* expr = (pelet::ExpressionClass*) variables->At(i);
@@ -941,17 +1048,17 @@ pelet::StatementListClass* pelet::FullParserObserverClass::StaticVariablesStatem
 			}
 		}
 	}
-	AllAstItems.push_back(staticVars);
+	Arena->Adopt(staticVars);
 	return StatementListMakeAndAppend(staticVars);
 }
 
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::IncludeFound(pelet::ExpressionClass* expr, const int lineNumber) {
-	pelet::IncludeExpressionClass* newExpr = new pelet::IncludeExpressionClass(Scope);
+	pelet::IncludeExpressionClass* newExpr = new (*Arena) pelet::IncludeExpressionClass(Scope);
 	newExpr->LineNumber = expr->LineNumber;
 	newExpr->Pos = expr->Pos;
 	newExpr->Init(expr, lineNumber);
-	AllAstItems.push_back(newExpr);
+	Arena->Adopt(newExpr);
 	return newExpr;
 }
 
@@ -962,9 +1069,9 @@ void pelet::FullParserObserverClass::MakeAst(pelet::StatementListClass* statemen
 		// we give ownership to the expression observer if it exists
 		// otherwise we still own these pointers
 		// doing this AFTER the callbacks because the NotifyVariablesFromParameterList
-		// method can add items to the AllAstItems list
-		ExpressionObserver->StatementOwnership(AllAstItems);
-		AllAstItems.clear();	
+		// method can add items to the arena
+		ExpressionObserver->StatementOwnership(*Arena);
+		UnknownExpression = NULL;
 	}
 }
 
@@ -983,10 +1090,16 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 			if (Class || Member) {
 				pelet::ClassSymbolClass* classSymbol = (pelet::ClassSymbolClass*) stmt;
 				if (Class) {
+					UnicodeString signature;
+					UnicodeString implementsList;
+					if (ClassFields & pelet::SYMBOL_SIGNATURES) {
+						signature = classSymbol->ToSignature();
+						implementsList = classSymbol->ImplementsString();
+					}
 					Class->ClassFound(classSymbol->NamespaceName, classSymbol->ClassName, 
-						classSymbol->ToSignature(),
+						signature,
 						classSymbol->ExtendsFrom,
-						classSymbol->ImplementsString(),
+						implementsList,
 						classSymbol->Comment,
 						classSymbol->StartingLineNumber);
 				}
@@ -1117,13 +1230,23 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 				// method signature
 				// didnt feel like writing a whole other class for just for functions when functions and
 				// methods are almost identical
-				UnicodeString signature = functionSymbol->ToMethodSignature(functionSymbol->ParametersList.ToSignature());
-				int32_t index = signature.indexOf(UNICODE_STRING_SIMPLE("function"));
-				signature.setTo(signature, index);
-				UnicodeString comment = functionSymbol->GetComment();
 				if (Function) {
+					UnicodeString signature;
+					UnicodeString returnType;
+					UnicodeString comment;
+					if (FunctionFields & pelet::SYMBOL_SIGNATURES) {
+						signature = functionSymbol->ToMethodSignature(functionSymbol->ParametersList.ToSignature());
+						int32_t index = signature.indexOf(UNICODE_STRING_SIMPLE("function"));
+						signature.setTo(signature, index);
+					}
+					if (FunctionFields & pelet::SYMBOL_RETURN_TYPES) {
+						returnType = functionSymbol->GetReturnType();
+					}
+					if (FunctionFields & pelet::SYMBOL_COMMENTS) {
+						comment = functionSymbol->GetComment();
+					}
 					Function->FunctionFound(functionSymbol->NamespaceName, functionSymbol->MemberName, signature,
-					                        functionSymbol->GetReturnType(), comment, functionSymbol->StartingLineNumber,
+					                        returnType, comment, functionSymbol->StartingLineNumber,
 												functionSymbol->HasVariableArguments);
 				}
 				if (Variable || ExpressionObserver) {
@@ -1144,7 +1267,6 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 		case pelet::StatementClass::METHOD_DECLARATION:
 			memberSymbol = (pelet::ClassMemberSymbolClass*) stmt;
 			if (Member || Variable || ExpressionObserver) {
-				UnicodeString signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
 				pelet::TokenClass::TokenIds visibility = pelet::TokenClass::PUBLIC;
 				if (memberSymbol->IsProtectedMember) {
 					visibility = pelet::TokenClass::PROTECTED;
@@ -1154,9 +1276,21 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 				UnicodeString className = memberSymbol->ClassName;
 				bool isStatic = memberSymbol->IsStaticMember;
 				if (Member) {
+					UnicodeString signature;
+					UnicodeString returnType;
+					UnicodeString comment;
+					if (MemberFields & pelet::SYMBOL_SIGNATURES) {
+						signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
+					}
+					if (MemberFields & pelet::SYMBOL_RETURN_TYPES) {
+						returnType = memberSymbol->GetReturnType();
+					}
+					if (MemberFields & pelet::SYMBOL_COMMENTS) {
+						comment = memberSymbol->GetComment();
+					}
 					Member->MethodFound(memberSymbol->NamespaceName, memberSymbol->ClassName, memberSymbol->MemberName, 
 										signature,
-					                    memberSymbol->GetReturnType(), memberSymbol->GetComment(), visibility, isStatic, 
+					                    returnType, comment, visibility, isStatic, 
 										memberSymbol->StartingLineNumber,
 										memberSymbol->HasVariableArguments);
 				}
@@ -1203,8 +1337,16 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 				UnicodeString className = memberSymbol->ClassName;
 				bool isStatic = memberSymbol->IsStaticMember;
 				bool isConst = memberSymbol->IsConstMember;
+				UnicodeString returnType;
+				UnicodeString comment;
+				if (MemberFields & pelet::SYMBOL_RETURN_TYPES) {
+					returnType = memberSymbol->GetReturnType();
+				}
+				if (MemberFields & pelet::SYMBOL_COMMENTS) {
+					comment = memberSymbol->GetComment();
+				}
 				Member->PropertyFound(memberSymbol->NamespaceName, memberSymbol->ClassName, memberSymbol->MemberName,
-				                      memberSymbol->GetReturnType(), memberSymbol->GetComment(), visibility, isConst, isStatic, memberSymbol->StartingLineNumber);
+				                      returnType, comment, visibility, isConst, isStatic, memberSymbol->StartingLineNumber);
 			}
 			break;
 		case pelet::StatementClass::TRAIT_ALIAS_DECLARATION:
@@ -1234,8 +1376,8 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 				pelet::GlobalVariableStatementClass * globalStmt = (pelet::GlobalVariableStatementClass*)stmt;
 				for (size_t i = 0; i < globalStmt->Variables.size(); ++i) {
 					pelet::VariableClass* globalVar = globalStmt->Variables[i];
-					pelet::ExpressionClass* unknownExpr = new pelet::ExpressionClass(globalVar->Scope);
-					AllAstItems.push_back(unknownExpr);
+					pelet::ExpressionClass* unknownExpr = new (*Arena) pelet::ExpressionClass(globalVar->Scope);
+					Arena->Adopt(unknownExpr);
 					unknownExpr->ExpressionType = pelet::ExpressionClass::UNKNOWN;
 					Variable->VariableFound(globalVar->Scope.NamespaceName, 
 						globalVar->Scope.ClassName, globalVar->Scope.MethodName, 
@@ -1252,9 +1394,9 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 				pelet::StaticVariableStatementClass * staticStmt = (pelet::StaticVariableStatementClass*)stmt;
 				for (size_t i = 0; i < staticStmt->Variables.size(); ++i) {
 					pelet::VariableClass* staticVar = staticStmt->Variables[i];
-					pelet::ExpressionClass* unknownExpr = new pelet::ExpressionClass(staticVar->Scope);
+					pelet::ExpressionClass* unknownExpr = new (*Arena) pelet::ExpressionClass(staticVar->Scope);
 					unknownExpr->ExpressionType = pelet::ExpressionClass::UNKNOWN;
-					AllAstItems.push_back(unknownExpr);
+					Arena->Adopt(unknownExpr);
 					Variable->VariableFound(staticVar->Scope.NamespaceName, 
 						staticVar->Scope.ClassName, staticVar->Scope.MethodName, 
 						*staticVar, unknownExpr, staticVar->Comment);
@@ -1269,18 +1411,18 @@ void pelet::FullParserObserverClass::RecurseAst(pelet::StatementListClass* state
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceDeclarationFound(pelet::QualifiedNameClass* namespaceName, pelet::SemanticValueClass* namespaceTokenValue) {
-	pelet::NamespaceDeclarationClass* newNamespace = new pelet::NamespaceDeclarationClass();
+	pelet::NamespaceDeclarationClass* newNamespace = new (*Arena) pelet::NamespaceDeclarationClass();
 	newNamespace->NamespaceName = namespaceName->ToSignature();
 	newNamespace->StartingPosition = namespaceTokenValue->Pos;
-	AllAstItems.push_back(newNamespace);
+	Arena->Adopt(newNamespace);
 	return StatementListMakeAndAppend(newNamespace);
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceGlobalDeclarationFound(pelet::SemanticValueClass* namespaceTokenValue) {
-	pelet::NamespaceDeclarationClass* newNamespace = new pelet::NamespaceDeclarationClass();
+	pelet::NamespaceDeclarationClass* newNamespace = new (*Arena) pelet::NamespaceDeclarationClass();
 	newNamespace->StartingPosition = namespaceTokenValue->Pos;
 	newNamespace->NamespaceName = UNICODE_STRING_SIMPLE("\\");
-	AllAstItems.push_back(newNamespace);
+	Arena->Adopt(newNamespace);
 	return StatementListMakeAndAppend(newNamespace);
 }
 
@@ -1290,14 +1432,14 @@ pelet::QualifiedNameClass* pelet::FullParserObserverClass::NamespaceNameAppend(p
 }
 
 pelet::QualifiedNameClass* pelet::FullParserObserverClass::NamespaceNameMake(pelet::SemanticValueClass* nameValue) {
-	QualifiedNameClass* qualifiedName = new pelet::QualifiedNameClass();
+	QualifiedNameClass* qualifiedName = new (*Arena) pelet::QualifiedNameClass();
 	qualifiedName->Init(nameValue);
-	AllAstItems.push_back(qualifiedName);
+	Arena->Adopt(qualifiedName);
 	return qualifiedName;
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceUse(pelet::QualifiedNameClass* namespaceName) {
-	pelet::NamespaceUseClass* useStatement = new pelet::NamespaceUseClass;
+	pelet::NamespaceUseClass* useStatement = new (*Arena) pelet::NamespaceUseClass;
 	
 	// according to PHP rules, all imports use absolute namespaces
 	namespaceName->MakeAbsolute();
@@ -1306,20 +1448,20 @@ pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceUse(pelet::Q
 	// dont worry about duplicate aliases, since its incorrect PHP
 	Scope.AddNamespaceAlias(namespaceName->ToSignature(), alias);
 
-	AllAstItems.push_back(useStatement);
+	Arena->Adopt(useStatement);
 	return StatementListMakeAndAppend(useStatement);
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceUseAbsolute(pelet::QualifiedNameClass* namespaceName) {
 	namespaceName->MakeAbsolute();
 
-	pelet::NamespaceUseClass* useStatement = new pelet::NamespaceUseClass;
+	pelet::NamespaceUseClass* useStatement = new (*Arena) pelet::NamespaceUseClass;
 	UnicodeString alias = useStatement->Set(namespaceName, UNICODE_STRING_SIMPLE(""));
 
 	// dont worry about duplicate aliases, since its incorrect PHP
 	Scope.AddNamespaceAlias(namespaceName->ToSignature(), alias);
 
-	AllAstItems.push_back(useStatement);
+	Arena->Adopt(useStatement);
 	return StatementListMakeAndAppend(useStatement);
 }
 
@@ -1327,14 +1469,14 @@ pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceUseAbsoluteA
 		pelet::SemanticValueClass* aliasValue) {
 	namespaceName->MakeAbsolute();
 
-	pelet::NamespaceUseClass* useStatement = new pelet::NamespaceUseClass;
+	pelet::NamespaceUseClass* useStatement = new (*Arena) pelet::NamespaceUseClass;
 	if (aliasValue) {
 		UnicodeString alias = useStatement->Set(namespaceName, aliasValue->Lexeme);
 
 		// dont worry about duplicate aliases, since its incorrect PHP
 		Scope.AddNamespaceAlias(namespaceName->ToSignature(), alias);
 	}
-	AllAstItems.push_back(useStatement);
+	Arena->Adopt(useStatement);
 	return StatementListMakeAndAppend(useStatement);
 }
 
@@ -1343,14 +1485,14 @@ pelet::StatementListClass* pelet::FullParserObserverClass::NamespaceUseAlias(pel
 		
 	// according to PHP rules, all imports use absolute namespaces
 	namespaceName->MakeAbsolute();
-	pelet::NamespaceUseClass* useStatement = new pelet::NamespaceUseClass;
+	pelet::NamespaceUseClass* useStatement = new (*Arena) pelet::NamespaceUseClass;
 	if (aliasValue) {
 		UnicodeString alias = useStatement->Set(namespaceName, aliasValue->Lexeme);
 
 		// dont worry about duplicate aliases, since its incorrect PHP
 		Scope.AddNamespaceAlias(namespaceName->ToSignature(), alias);
 	}
-	AllAstItems.push_back(useStatement);
+	Arena->Adopt(useStatement);
 	return StatementListMakeAndAppend(useStatement);
 }
 
@@ -1374,23 +1516,23 @@ pelet::ParametersListClass* pelet::FullParserObserverClass::ParametersListAppend
 
 pelet::ParametersListClass* pelet::FullParserObserverClass::ParametersListCreate(pelet::QualifiedNameClass* type, pelet::SemanticValueClass* parameterName, 
 		bool isReference, bool hasDefault) {
-	pelet::ParametersListClass* parametersList = new pelet::ParametersListClass;
+	pelet::ParametersListClass* parametersList = new (*Arena) pelet::ParametersListClass;
 	parametersList->Append(type, parameterName, isReference, hasDefault, Scope, DeclaredNamespace);
-	AllAstItems.push_back(parametersList);
+	Arena->Adopt(parametersList);
 	return parametersList;
 }
 
 pelet::ParametersListClass* pelet::FullParserObserverClass::ParametersListNil() {
-	pelet::ParametersListClass* parametersList = new pelet::ParametersListClass;
+	pelet::ParametersListClass* parametersList = new (*Arena) pelet::ParametersListClass;
 
-	AllAstItems.push_back(parametersList);
+	Arena->Adopt(parametersList);
 	return parametersList;
 }
 
 pelet::QualifiedNameClass* pelet::FullParserObserverClass::QualifiedNameCreate(pelet::SemanticValueClass* nameValue) {
-	pelet::QualifiedNameClass* qualifiedName = new pelet::QualifiedNameClass;
+	pelet::QualifiedNameClass* qualifiedName = new (*Arena) pelet::QualifiedNameClass;
 	qualifiedName->Init(nameValue);
-	AllAstItems.push_back(qualifiedName);
+	Arena->Adopt(qualifiedName);
 	return qualifiedName;
 }
 
@@ -1405,14 +1547,14 @@ pelet::QualifiedNameClass* pelet::FullParserObserverClass::QualifiedNameMakeFrom
 }
 
 pelet::QualifiedNameClass* pelet::FullParserObserverClass::QualifiedNameNil() {
-	pelet::QualifiedNameClass* qualifiedName = new pelet::QualifiedNameClass;
-	AllAstItems.push_back(qualifiedName);
+	pelet::QualifiedNameClass* qualifiedName = new (*Arena) pelet::QualifiedNameClass;
+	Arena->Adopt(qualifiedName);
 	return qualifiedName;
 }
 
 pelet::SemanticValueClass* pelet::FullParserObserverClass::SemanticValueNil() {
-	pelet::SemanticValueClass* value = new pelet::SemanticValueClass;
-	AllAstItems.push_back(value);
+	pelet::SemanticValueClass* value = new (*Arena) pelet::SemanticValueClass;
+	Arena->Adopt(value);
 	return value;
 }
 
@@ -1423,16 +1565,16 @@ pelet::StatementListClass* pelet::FullParserObserverClass::StatementListAppend(p
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::StatementListMake() {
-	pelet::StatementListClass* statementList =  new pelet::StatementListClass;
-	AllAstItems.push_back(statementList);
+	pelet::StatementListClass* statementList =  new (*Arena) pelet::StatementListClass;
+	Arena->Adopt(statementList);
 	return statementList;
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::StatementListMakeAndAppend(pelet::StatementClass* statement) {
-	pelet::StatementListClass* statementList =  new pelet::StatementListClass;
+	pelet::StatementListClass* statementList =  new (*Arena) pelet::StatementListClass;
 	statementList->Push(statement);
 
-	AllAstItems.push_back(statementList);
+	Arena->Adopt(statementList);
 	return statementList;
 }
 
@@ -1442,8 +1584,8 @@ pelet::StatementListClass* pelet::FullParserObserverClass::StatementListMerge(pe
 }
 
 pelet::StatementListClass* pelet::FullParserObserverClass::StatementListNil() {
-	pelet::StatementListClass* statementList =  new pelet::StatementListClass;
-	AllAstItems.push_back(statementList);
+	pelet::StatementListClass* statementList =  new (*Arena) pelet::StatementListClass;
+	Arena->Adopt(statementList);
 	return statementList;
 }
 
@@ -1457,6 +1599,7 @@ void pelet::FullParserObserverClass::SetCurrentMemberName(pelet::SemanticValueCl
 	Scope.MethodName = value ? value->Lexeme : UNICODE_STRING_SIMPLE("");
 	AnonymousFunctionCount = -1;
 	Scope.SetIsAnonymous(false);
+	HasCallToFuncGetArg = false;
 }
 
 void pelet::FullParserObserverClass::IncrementAnonymousFunctionCount() {
@@ -1484,25 +1627,25 @@ void pelet::FullParserObserverClass::SetDeclaredNamespace(pelet::QualifiedNameCl
 }
 
 pelet::ExpressionClass* pelet::FullParserObserverClass::ExpressionMakeAsAssignmentExpression(pelet::VariableClass* variable) {
-	pelet::AssignmentExpressionClass* newExpr =  new pelet::AssignmentExpressionClass(Scope);
+	pelet::AssignmentExpressionClass* newExpr =  new (*Arena) pelet::AssignmentExpressionClass(Scope);
 	newExpr->LineNumber = variable->LineNumber;
 	newExpr->Pos = variable->Pos;
 	newExpr->Destination.Copy(*variable);
 	
-	pelet::ExpressionClass* assignedExpr = new pelet::ExpressionClass(variable->Scope);
+	pelet::ExpressionClass* assignedExpr = new (*Arena) pelet::ExpressionClass(variable->Scope);
 	assignedExpr->LineNumber = variable->LineNumber;
 	assignedExpr->Pos = variable->Pos;
 	assignedExpr->ExpressionType = pelet::ExpressionClass::UNKNOWN;
 
 	newExpr->Expression = assignedExpr;
 
-	AllAstItems.push_back(newExpr);
-	AllAstItems.push_back(assignedExpr);
+	Arena->Adopt(newExpr);
+	Arena->Adopt(assignedExpr);
 	return newExpr;
 }
 
 pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMake(pelet::TraitAliasClass* traitMethodReference, pelet::ClassMemberSymbolClass* traitModifiers) {
-	pelet::TraitAliasClass* newAlias = new pelet::TraitAliasClass;
+	pelet::TraitAliasClass* newAlias = new (*Arena) pelet::TraitAliasClass;
 	newAlias->TraitUsedClassName = traitMethodReference->TraitUsedClassName;
 	newAlias->TraitMethodReferenceName = traitMethodReference->TraitMethodReferenceName;
 	if (traitModifiers->IsPublicMember) {
@@ -1512,12 +1655,12 @@ pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMake(pelet::Tr
 	} else if (traitModifiers->IsPrivateMember) {
 		newAlias->Visibility = pelet::TokenClass::PRIVATE;
 	}
-	AllAstItems.push_back(newAlias);
+	Arena->Adopt(newAlias);
 	return newAlias;
 }
 
 pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMake(pelet::TraitAliasClass* traitMethodReference, pelet::ClassMemberSymbolClass* traitModifiers, pelet::SemanticValueClass* aliasValue) {
-	pelet::TraitAliasClass* newAlias = new pelet::TraitAliasClass;
+	pelet::TraitAliasClass* newAlias = new (*Arena) pelet::TraitAliasClass;
 	newAlias->TraitUsedClassName = traitMethodReference->TraitUsedClassName;
 	newAlias->TraitMethodReferenceName = traitMethodReference->TraitMethodReferenceName;
 	if (traitModifiers->IsPublicMember) {
@@ -1530,26 +1673,26 @@ pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMake(pelet::Tr
 	if (aliasValue) {
 		newAlias->Alias = aliasValue->Lexeme;
 	}
-	AllAstItems.push_back(newAlias);
+	Arena->Adopt(newAlias);
 	return newAlias;
 }
 
 pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMakeMethodReferenceList(pelet::QualifiedNameClass* qualifiedName, pelet::SemanticValueClass* methodName) {
-	pelet::TraitAliasClass* newAlias = new pelet::TraitAliasClass;
+	pelet::TraitAliasClass* newAlias = new (*Arena) pelet::TraitAliasClass;
 	newAlias->TraitUsedClassName = Scope.FullyQualify(*qualifiedName, DeclaredNamespace);
 	if (methodName) {
 		newAlias->TraitMethodReferenceName = methodName->Lexeme;
 	}
-	AllAstItems.push_back(newAlias);
+	Arena->Adopt(newAlias);
 	return newAlias;
 }
 
 pelet::TraitAliasClass* pelet::FullParserObserverClass::TraitAliasMakeMethodReferenceList(pelet::SemanticValueClass* methodName) {
-	pelet::TraitAliasClass* newAlias = new pelet::TraitAliasClass;
+	pelet::TraitAliasClass* newAlias = new (*Arena) pelet::TraitAliasClass;
 	if (methodName) {
 		newAlias->TraitMethodReferenceName = methodName->Lexeme;
 	}
-	AllAstItems.push_back(newAlias);
+	Arena->Adopt(newAlias);
 	return newAlias;
 }
 
@@ -1559,18 +1702,18 @@ pelet::TraitInsteadOfClass* pelet::FullParserObserverClass::TraitInsteadOfAppend
 }
 
 pelet::TraitInsteadOfClass* pelet::FullParserObserverClass::TraitInsteadOfMake(pelet::TraitAliasClass* traitMethodReference, pelet::TraitInsteadOfClass* traitInsteadOfList) {
-	pelet::TraitInsteadOfClass* newInsteadOf = new pelet::TraitInsteadOfClass;
+	pelet::TraitInsteadOfClass* newInsteadOf = new (*Arena) pelet::TraitInsteadOfClass;
 	newInsteadOf->TraitUsedClassName =  traitMethodReference->TraitUsedClassName;
 	newInsteadOf->TraitMethodReferenceName = traitMethodReference->TraitMethodReferenceName;
 	newInsteadOf->InsteadOfList = traitInsteadOfList->InsteadOfList;
-	AllAstItems.push_back(newInsteadOf);
+	Arena->Adopt(newInsteadOf);
 	return newInsteadOf;
 }
 
 pelet::TraitInsteadOfClass* pelet::FullParserObserverClass::TraitInsteadOfMakeReferenceList(pelet::QualifiedNameClass* qualifiedName) {
-	pelet::TraitInsteadOfClass* newInsteadOf = new pelet::TraitInsteadOfClass;
+	pelet::TraitInsteadOfClass* newInsteadOf = new (*Arena) pelet::TraitInsteadOfClass;
 	newInsteadOf->AppendInsteadOf(qualifiedName, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newInsteadOf);
+	Arena->Adopt(newInsteadOf);
 	return newInsteadOf;
 }
 
@@ -1601,9 +1744,9 @@ pelet::StatementListClass* pelet::FullParserObserverClass::TraitUseMake(pelet::T
 }
 
 pelet::TraitUseClass* pelet::FullParserObserverClass::TraitUseStart(pelet::QualifiedNameClass* qualifiedName) {
-	pelet::TraitUseClass* newTraitUse = new pelet::TraitUseClass;
+	pelet::TraitUseClass* newTraitUse = new (*Arena) pelet::TraitUseClass;
 	newTraitUse->AppendUse(qualifiedName, Scope, DeclaredNamespace);
-	AllAstItems.push_back(newTraitUse);
+	Arena->Adopt(newTraitUse);
 	return newTraitUse;
 }
 
@@ -1620,7 +1763,7 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableAppendToChain(pele
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeAndAppendFunctionCall(pelet::StatementListClass* callArguments, bool isMethod) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	std::vector<pelet::ExpressionClass*> varCallArguments;
 	for (size_t i = 0; i < callArguments->Size(); ++i) {
 		pelet::StatementClass::Types type =  callArguments->TypeAt(i);
@@ -1632,7 +1775,7 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMakeAndAppendFunct
 		}
 	}
 	newVar->AppendToChain(UNICODE_STRING_SIMPLE(""), varCallArguments, isMethod, false);
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
@@ -1674,13 +1817,13 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableMake(pelet::Variab
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableNil() {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
-	AllAstItems.push_back(newVar);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableStart(pelet::SemanticValueClass* variableValue, bool isReference) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	if (variableValue) {
 		newVar->AppendToChain(variableValue->Lexeme);
 		newVar->Comment = variableValue->Comment;
@@ -1688,12 +1831,12 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableStart(pelet::Seman
 		newVar->Pos = variableValue->Pos;
 		newVar->IsReference = isReference;
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
 pelet::VariableClass* pelet::FullParserObserverClass::VariableStartStaticMember(pelet::QualifiedNameClass* className, pelet::VariableClass* memberName) {
-	pelet::VariableClass* newVar = new pelet::VariableClass(Scope);
+	pelet::VariableClass* newVar = new (*Arena) pelet::VariableClass(Scope);
 	if (className && memberName) {
 		newVar->LineNumber = memberName->LineNumber;
 		newVar->Pos = memberName->Pos;
@@ -1705,7 +1848,7 @@ pelet::VariableClass* pelet::FullParserObserverClass::VariableStartStaticMember(
 			newVar->AppendToChain(memberName->ChainList[0].Name, args, false, true);
 		}
 	}
-	AllAstItems.push_back(newVar);
+	Arena->Adopt(newVar);
 	return newVar;
 }
 
@@ -1718,6 +1861,78 @@ pelet::ScopeClass pelet::FullParserObserverClass::CurrentScope() {
 	return Scope;
 }
 
+void pelet::FullParserObserverClass::ErrorFound() {
+	if (!HasError) {
+		FirstErrorScope = Scope;
+		HasError = true;
+	}
+}
+
+pelet::ScopeClass pelet::FullParserObserverClass::ErrorScope() {
+	return HasError ? FirstErrorScope : Scope;
+}
+
+void pelet::FullParserObserverClass::SetBody(const pelet::BodyRangeClass& body) {
+	Scope = body.Scope;
+	DeclaredNamespace = body.DeclaredNamespace;
+	AnonymousFunctionCount = -1;
+	IsBodyOnly = true;
+	BodyDepth = 0;
+}
+
+void pelet::FullParserObserverClass::WatchString(const UnicodeString& lexeme) {
+	if (!HasCallToFuncGetArg && (Member || Function) && lexeme.length() >= PELET_FUNC_GET_ARG_LENGTH
+		&& (lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0
+		|| lexeme.caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0)) {
+		HasCallToFuncGetArg = true;
+	}
+}
+
+void pelet::FullParserObserverClass::WatchToken(int token, int pos, int lineNumber) {
+	if (IsBodyOnly) {
+		
+		// strings are single tokens, all braces seen here are 
+		// code braces. depth will be -1 once the body is closed
+		if ('{' == token) {
+			BodyDepth++;
+		}
+		else if ('}' == token) {
+			BodyDepth--;
+			if (0 == BodyDepth) {
+				BodyDepth = -1;
+			}
+		}
+	}
+	if (DoSkipBodies) {
+		BodyWatcher.Watch(token);
+		if (BodyWatcher.IsBodyStart()) {
+			BodyStartPos = pos;
+			BodyStartLineNumber = lineNumber;
+		}
+	}
+}
+
+bool pelet::FullParserObserverClass::IsBodyStart() const {
+	return DoSkipBodies && BodyWatcher.IsBodyStart();
+}
+
+bool pelet::FullParserObserverClass::IsBodyEnd() const {
+	return IsBodyOnly && BodyDepth < 0;
+}
+
+int pelet::FullParserObserverClass::SkipBody(pelet::LexicalAnalyzerClass& analyzer) {
+	pelet::BodyRangeClass body;
+	body.Scope = Scope;
+	body.DeclaredNamespace = DeclaredNamespace;
+	body.StartPos = BodyStartPos;
+	body.LineNumber = BodyStartLineNumber;
+	body.Condition = analyzer.GetCondition();
+	int ret = pelet::SkipBody(analyzer, HasCallToFuncGetArg);
+	body.EndPos = analyzer.GetCharacterPosition();
+	Bodies.push_back(body);
+	return ret;
+}
+
 void pelet::FullParserObserverClass::DeclareAssignedPropertiesFromAssignments(pelet::StatementListClass* classStatements) {
 	if (classStatements == NULL || classStatements->Size() <= 0) {
 		return;
@@ -1775,7 +1990,7 @@ void pelet::FullParserObserverClass::DeclareAssignedPropertiesFromAssignments(pe
 			// do not; we want to compare apples-to-apples
 			UnicodeString propertyName = UNICODE_STRING_SIMPLE("$") + expr->Destination.ChainList[1].Name;
 			if (assignedProperties.end() == std::find(assignedProperties.begin(), assignedProperties.end(), propertyName)) {
-				pelet::ClassMemberSymbolClass* newMember = new pelet::ClassMemberSymbolClass;
+				pelet::ClassMemberSymbolClass* newMember = new (*Arena) pelet::ClassMemberSymbolClass;
 				pelet::SemanticValueClass nameValue;
 				pelet::SemanticValueClass commentValue;
 				nameValue.Lexeme = propertyName;
@@ -1786,7 +2001,7 @@ void pelet::FullParserObserverClass::DeclareAssignedPropertiesFromAssignments(pe
 				newMember->ClassName = CurrentScope().ClassName;
 				
 				// this class will own the pointer
-				AllAstItems.push_back(newMember);
+				Arena->Adopt(newMember);
 				newMembers.Push(newMember);
 				assignedProperties.push_back(propertyName);
 			}
@@ -1796,5 +2011,9 @@ void pelet::FullParserObserverClass::DeclareAssignedPropertiesFromAssignments(pe
 }
 
 void pelet::FullParserObserverClass::CreateMagicMethodsAndProperties(pelet::StatementListClass* classStatements, pelet::ClassSymbolClass* clazz) {
-	pelet::CreateMagicMethodsAndProperties(AllAstItems, classStatements, Scope, DeclaredNamespace, clazz->Comment, clazz->EndingLineNumber);
+	std::vector<pelet::AstItemClass*> magicItems;
+	pelet::CreateMagicMethodsAndProperties(magicItems, classStatements, Scope, DeclaredNamespace, clazz->Comment, clazz->EndingLineNumber);
+	for (size_t i = 0; i < magicItems.size(); ++i) {
+		Arena->Adopt(magicItems[i]);
+	}
 }
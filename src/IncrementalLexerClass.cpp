@@ -0,0 +1,173 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/IncrementalLexerClass.h>
+#include <pelet/Php53LexicalAnalyzer.h>
+#include <pelet/Php54LexicalAnalyzer.h>
+#include <algorithm>
+
+/**
+ * The number of tokens before the edit that are re-lexed. The lexer may look
+ * past the end of a token before deciding on it; the longest look ahead is
+ * a cast ('(' WHITESPACE* 'int' WHITESPACE* ')') which reads through the 
+ * '(' token and the identifier token that follows it. Going back 2 tokens
+ * covers that look ahead. This is a heuristic based on the lexer rules, not a
+ * proof; if a rule with a longer look ahead is added, this number must grow. The 
+ * ManyEditsShouldBeSameAsFullLex test compares random edits with a full lex.
+ */
+#define PELET_RESTART_TOKENS_BACK 2
+
+namespace pelet {
+
+/**
+ * compares tokens by their end position
+ */
+static bool TokenEndsBefore(const LexedTokenClass& token, int position) {
+	return token.End < position;
+}
+
+}
+
+pelet::LexedTokenClass::LexedTokenClass()
+	: Token(0)
+	, Start(0)
+	, End(0)
+	, LineNumber(1)
+	, EndCondition(yycINLINE_HTML) {
+}
+
+pelet::RelexResultsClass::RelexResultsClass()
+	: FirstToken(0)
+	, TokensRemoved(0)
+	, TokensAdded(0)
+	, CharactersLexed(0) {
+}
+
+pelet::IncrementalLexerClass::IncrementalLexerClass()
+	: Code()
+	, Tokens()
+	, Version(PHP_53) {
+}
+
+void pelet::IncrementalLexerClass::SetVersion(pelet::Versions version) {
+	Version = version;
+}
+
+void pelet::IncrementalLexerClass::Open(const UnicodeString& code) {
+	Code = code;
+	Tokens.clear();
+	std::vector<pelet::LexedTokenClass> newTokens;
+	Lex(0, 1, yycINLINE_HTML, 0, 0, 0, newTokens);
+	Tokens.swap(newTokens);
+}
+
+bool pelet::IncrementalLexerClass::Edit(int position, int removedLength, const UnicodeString& text, pelet::RelexResultsClass& results) {
+	if (position < 0 || removedLength < 0 || position + removedLength > Code.length()) {
+		return false;
+	}
+	Code.replace(position, removedLength, text);
+	int delta = text.length() - removedLength;
+
+	// find the first token that the edit could have changed and back off
+	// from there; the token before the restart point is the checkpoint
+	size_t first = std::lower_bound(Tokens.begin(), Tokens.end(), position, TokenEndsBefore) - Tokens.begin();
+	size_t restart = first > PELET_RESTART_TOKENS_BACK ? first - PELET_RESTART_TOKENS_BACK : 0;
+	int startPos = 0;
+	int lineNumber = 1;
+	YYCONDTYPE condition = yycINLINE_HTML;
+	if (restart > 0) {
+		startPos = Tokens[restart - 1].End;
+		lineNumber = Tokens[restart - 1].LineNumber;
+		condition = Tokens[restart - 1].EndCondition;
+	}
+	std::vector<pelet::LexedTokenClass> newTokens;
+	size_t synced = Lex(startPos, lineNumber, condition, position + text.length(), delta, restart, newTokens);
+
+	// the tokens after the synchronization point have the same text as before,
+	// they only need to be moved 
+	size_t removedEnd = Tokens.size();
+	if (synced < Tokens.size()) {
+		removedEnd = synced + 1;
+		int lineDelta = newTokens.back().LineNumber - Tokens[synced].LineNumber;
+		for (size_t i = removedEnd; i < Tokens.size(); ++i) {
+			Tokens[i].Start += delta;
+			Tokens[i].End += delta;
+			Tokens[i].LineNumber += lineDelta;
+		}
+	}
+	results.FirstToken = restart;
+	results.TokensRemoved = removedEnd - restart;
+	results.TokensAdded = newTokens.size();
+	results.CharactersLexed = newTokens.empty() ? 0 : newTokens.back().End - startPos;
+	Tokens.erase(Tokens.begin() + restart, Tokens.begin() + removedEnd);
+	Tokens.insert(Tokens.begin() + restart, newTokens.begin(), newTokens.end());
+	return true;
+}
+
+size_t pelet::IncrementalLexerClass::Lex(int startPos, int lineNumber, YYCONDTYPE condition, int syncPos, int delta, 
+		size_t firstOld, std::vector<pelet::LexedTokenClass>& newTokens) {
+	pelet::UCharViewBufferClass buffer;
+	buffer.Open(Code.getTerminatedBuffer(), Code.length(), startPos, lineNumber);
+	size_t old = firstOld;
+	bool done = false;
+	while (!done) {
+		pelet::LexedTokenClass token;
+		token.Token = PHP_53 == Version ? pelet::Next53Token(&buffer, condition) : pelet::Next54Token(&buffer, condition);
+		token.Start = buffer.GetCharacterPosition();
+		token.End = buffer.GetCurrentPosition();
+		token.LineNumber = buffer.GetLineNumber();
+		token.EndCondition = condition;
+		newTokens.push_back(token);
+		done = pelet::IsTerminatingToken(token.Token);
+		if (!done && token.End >= syncPos) {
+
+			// past the edit, the code from here on is the same as the 
+			// code after the old token that ended at the same place (if any)
+			int oldEnd = token.End - delta;
+			old = std::lower_bound(Tokens.begin() + old, Tokens.end(), oldEnd, TokenEndsBefore) - Tokens.begin();
+			if (old < Tokens.size() && Tokens[old].End == oldEnd && Tokens[old].EndCondition == condition
+				&& !pelet::IsTerminatingToken(Tokens[old].Token)) {
+				return old;
+			}
+		}
+	}
+	return Tokens.size();
+}
+
+const UnicodeString& pelet::IncrementalLexerClass::GetCode() const {
+	return Code;
+}
+
+size_t pelet::IncrementalLexerClass::GetTokenCount() const {
+	return Tokens.size();
+}
+
+const pelet::LexedTokenClass& pelet::IncrementalLexerClass::GetToken(size_t i) const {
+	return Tokens[i];
+}
+
+UnicodeString pelet::IncrementalLexerClass::GetLexeme(size_t i) const {
+	const pelet::LexedTokenClass& token = Tokens[i];
+	return UnicodeString(Code, token.Start, token.End - token.Start);
+}
@@ -33,15 +33,36 @@
 #define DISCOVERY_SET_CONDITION(c) syntax = c
 
 pelet::LanguageDiscoveryClass::LanguageDiscoveryClass()
-	: Buffer()
-	, Code() {
+	: Boundaries()
+	, Buffer()
+	, Code()
+	, ScanSyntax(SYNTAX_HTML)
+	, ScanLastCondition(SYNTAX_HTML)
+	, ScanPos(0)
+	, IsIndexed(false)
+	, IsScanFinished(false) {
+}
+
+/**
+ * @return TRUE if the scanner may read the given character past the end of 
+ * a token while trying to match a longer rule (ie. the "php" in "<?ph" or the
+ * spaces in "=   '").  The scanner never looks past the first character that is
+ * not one of these.
+ */
+static bool IsLookahead(UChar c) {
+	return c >= 0x7f || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') 
+		|| '_' == c || ' ' == c || '\t' == c || '\v' == c || '\f' == c || '\r' == c || '\n' == c
+		|| '<' == c || '?' == c || '!' == c || '-' == c || '\'' == c || '"' == c;
 }
 
 void pelet::LanguageDiscoveryClass::Close() {
 	Buffer.Close();
+	Boundaries.clear();
 }
 
 bool pelet::LanguageDiscoveryClass::Open(const UnicodeString& code) {
+	IsIndexed = false;
+	Boundaries.clear();
 	bool ret = Buffer.OpenString(code);
 	if (ret) {
 		Code = code;
@@ -49,25 +70,126 @@ bool pelet::LanguageDiscoveryClass::Open(const UnicodeString& code) {
 	return ret;
 }
 
+bool pelet::LanguageDiscoveryClass::OpenIndexed(const UnicodeString& code) {
+	bool ret = Open(code);
+	IsIndexed = true;
+	ScanSyntax = SYNTAX_HTML;
+	ScanLastCondition = SYNTAX_HTML;
+	ScanPos = 0;
+	IsScanFinished = !ret;
+	return ret;
+}
+
+bool pelet::LanguageDiscoveryClass::Update(const UnicodeString& code, int pos) {
+	if (!IsIndexed) {
+		return Open(code);
+	}
+	
+	// the scanner may have looked past the end of a token while deciding on it; only
+	// keep the boundaries that were decided before the edit
+	if (pos > code.length()) {
+		pos = code.length();
+	}
+	while (pos > 0 && IsLookahead(code.charAt(pos - 1))) {
+		pos--;
+	}
+	while (!Boundaries.empty() && Boundaries.back().End >= pos) {
+		Boundaries.pop_back();
+	}
+	
+	// an unterminated heredoc is the only boundary that is not at a token end
+	while (!Boundaries.empty() && (SYNTAX_PHP_HEREDOC == Boundaries.back().NewSyntax || SYNTAX_PHP_NOWDOC == Boundaries.back().NewSyntax)) {
+		Boundaries.pop_back();
+	}
+	ScanSyntax = SYNTAX_HTML;
+	ScanLastCondition = SYNTAX_HTML;
+	ScanPos = 0;
+	if (!Boundaries.empty()) {
+		ScanSyntax = Boundaries.back().NewSyntax;
+		ScanLastCondition = Boundaries.back().LastCondition;
+		ScanPos = Boundaries.back().End;
+	}
+	bool ret = Buffer.OpenString(code);
+	Code = code;
+	IsScanFinished = !ret;
+	if (ret) {
+		Buffer.Current += ScanPos;
+		Buffer.TokenStart = Buffer.Current;
+		Buffer.Marker = Buffer.Current;
+	}
+	return ret;
+}
+
 pelet::LanguageDiscoveryClass::Syntax pelet::LanguageDiscoveryClass::at(int pos) {
+	if (IsIndexed) {
+		if (!IsScanFinished && ScanPos < pos) {
+			Scan(pos, ScanSyntax, ScanLastCondition, ScanPos);
+			IsScanFinished = ScanPos < pos;
+		}
+		return Find(pos);
+	}
 
 	// need to reset the buffer back to the beginning of the source code
 	Buffer.OpenString(Code);
 	int currentPos = 0;
-	
-	// this variable is used because PHP can be embedded within any part of HTML (tag, attribute or 
+	pelet::LanguageDiscoveryClass::Syntax lastCondition = pelet::LanguageDiscoveryClass::SYNTAX_HTML;
+	pelet::LanguageDiscoveryClass::Syntax syntax = pelet::LanguageDiscoveryClass::SYNTAX_HTML;
+	return Scan(pos, syntax, lastCondition, currentPos);
+}
+
+void pelet::LanguageDiscoveryClass::AddBoundary(int start, int end, pelet::LanguageDiscoveryClass::Syntax syntax, 
+		pelet::LanguageDiscoveryClass::Syntax lastCondition) {
+	pelet::LanguageDiscoveryClass::Syntax previous = Boundaries.empty() ? SYNTAX_HTML : Boundaries.back().NewSyntax;
+	if (previous != syntax) {
+		pelet::LanguageDiscoveryClass::BoundaryClass boundary;
+		boundary.Start = start;
+		boundary.End = end;
+		boundary.NewSyntax = syntax;
+		boundary.LastCondition = lastCondition;
+		Boundaries.push_back(boundary);
+	}
+}
+
+pelet::LanguageDiscoveryClass::Syntax pelet::LanguageDiscoveryClass::Find(int pos) const {
+
+	// the language at pos is the language after the first token that ends at or 
+	// after pos. if that token is not a boundary then the language is the same as
+	// after the previous boundary
+	size_t low = 0;
+	size_t high = Boundaries.size();
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		if (Boundaries[mid].End < pos) {
+			low = mid + 1;
+		}
+		else {
+			high = mid;
+		}
+	}
+	if (low < Boundaries.size() && Boundaries[low].Start < pos) {
+		return Boundaries[low].NewSyntax;
+	}
+	return low > 0 ? Boundaries[low - 1].NewSyntax : SYNTAX_HTML;
+}
+
+pelet::LanguageDiscoveryClass::Syntax pelet::LanguageDiscoveryClass::Scan(int pos, pelet::LanguageDiscoveryClass::Syntax& syntax, 
+		pelet::LanguageDiscoveryClass::Syntax& lastCondition, int& currentPos) {
+
+	// lastCondition is used because PHP can be embedded within any part of HTML (tag, attribute or 
 	// value) and when we break out of the PHP we need to know what HTML condition we were in
 	// for example this line:  < a href="<?php link_to('home'); ?>"
 	// in this case when PHP ends we need to go back to the HTML_ATTRIBUTE_VALUE condition 
-	pelet::LanguageDiscoveryClass::Syntax lastCondition = pelet::LanguageDiscoveryClass::SYNTAX_HTML;
-	pelet::LanguageDiscoveryClass::Syntax syntax = pelet::LanguageDiscoveryClass::SYNTAX_HTML;
 	
 	// Note: the rules below are NOT the full PHP spec; they are only enough rules so that we can
 	// properly tell what language we are in.  
+	Buffer.MarkTokenStart();
 	
 discovery_start:
 	int tokenLength = Buffer.Current - Buffer.TokenStart;
 	currentPos += tokenLength;
+	if (IsIndexed) {
+		AddBoundary(currentPos - tokenLength, currentPos, syntax, lastCondition);
+	}
 	if (currentPos >= pos) {
 		return syntax;
 	}
@@ -790,7 +912,7 @@ discovery_178:
 		{ goto discovery_start; }
 discovery_179:
 		++Buffer.Current;
-		{ syntax = SYNTAX_PHP_SCRIPT; }
+		{ syntax = SYNTAX_PHP_SCRIPT; goto discovery_start; }
 discovery_181:
 		++Buffer.Current;
 discovery_182:
@@ -822,7 +944,7 @@ discovery_PHP_HEREDOC:
 		{ return syntax; }
 discovery_194:
 		++Buffer.Current;
-		{ if (pelet::HandleHeredoc(&Buffer) == T_ERROR_UNTERMINATED_STRING || (currentPos + (Buffer.Current - Buffer.TokenStart)) >= pos)  { return syntax ; } syntax = SYNTAX_PHP_SCRIPT; goto discovery_start; }
+		{ int ret = pelet::HandleHeredoc(&Buffer); if (IsIndexed) { AddBoundary(currentPos, currentPos + (Buffer.Current - Buffer.TokenStart), syntax, lastCondition); } if (ret == T_ERROR_UNTERMINATED_STRING || (!IsIndexed && (currentPos + (Buffer.Current - Buffer.TokenStart)) >= pos)) { return syntax; } syntax = SYNTAX_PHP_SCRIPT; goto discovery_start; }
 /* *********************************** */
 discovery_PHP_LINE_COMMENT:
 		if ((Buffer.Limit - Buffer.Current) < 2) DISCOVERY_BUFFER_FILL(2);
@@ -916,7 +1038,7 @@ discovery_PHP_NOWDOC:
 		{ return syntax; }
 discovery_226:
 		++Buffer.Current;
-		{ if (pelet::HandleNowdoc(&Buffer) == T_ERROR_UNTERMINATED_STRING || (currentPos + (Buffer.Current - Buffer.TokenStart)) >= pos) { return syntax; } syntax = SYNTAX_PHP_SCRIPT; goto discovery_start; }
+		{ int ret = pelet::HandleNowdoc(&Buffer); if (IsIndexed) { AddBoundary(currentPos, currentPos + (Buffer.Current - Buffer.TokenStart), syntax, lastCondition); } if (ret == T_ERROR_UNTERMINATED_STRING || (!IsIndexed && (currentPos + (Buffer.Current - Buffer.TokenStart)) >= pos)) { return syntax; } syntax = SYNTAX_PHP_SCRIPT; goto discovery_start; }
 /* *********************************** */
 discovery_PHP_SCRIPT:
 		if ((Buffer.Limit - Buffer.Current) < 3) DISCOVERY_BUFFER_FILL(3);
@@ -25,46 +25,220 @@
 #include <pelet/LexicalAnalyzerClass.h>
 #include <pelet/Php53LexicalAnalyzer.h>
 #include <pelet/Php54LexicalAnalyzer.h>
+#include <pelet/UCharMappedFileClass.h>
+#include <pelet/TokenPipelineClass.h>
 #include <unicode/uchar.h>
 #include <unicode/ustring.h>
 #include <unicode/ucnv.h>
 
+/**
+ * the number of tokens that the lexer returns between looks at the cancel token
+ */
+#define PELET_CANCEL_CHECK_TOKENS 256
+
+/**
+ * the default size of the smallest code that is lexed on the pipeline, in characters
+ * or bytes
+ */
+#define PELET_PIPELINE_MIN_LENGTH (512 * 1024)
+
+pelet::ParserErrorClass::ParserErrorClass()
+	: Error()
+	, LineNumber(0)
+	, CharacterPosition(0) {
+}
+
 pelet::LexicalAnalyzerClass::LexicalAnalyzerClass(const std::string& fileName) 
 	: ParserError()
+	, ParserErrors()
 	, Buffer(NULL)
+	, Utf8Buffer(NULL)
+	, ChunkBuffer(NULL)
 	, FileName()
 	, Condition(yycINLINE_HTML)
-	, Version(PHP_53) {
+	, SavedCondition(yycINLINE_HTML)
+	, Version(PHP_53) 
+	, FileBufferType(STREAMING_FILE_BUFFER)
+	, CancelToken(NULL)
+	, TokensUntilCancelCheck(0)
+	, Cancelled(false)
+	, KeptBufferedFile(NULL)
+	, KeptMappedFile(NULL)
+	, KeptStringBuffer(NULL)
+	, KeptUtf8Buffer(NULL)
+	, IsKeepingBuffers(false)
+	, Pipeline(NULL)
+	, PipelineLength(PELET_PIPELINE_MIN_LENGTH)
+	, IsPipelineMode(false)
+	, IsPipelined(false) {
 	OpenFile(fileName);
 }
 
 pelet::LexicalAnalyzerClass::LexicalAnalyzerClass()
 	: ParserError()
+	, ParserErrors()
 	, Buffer(NULL)
+	, Utf8Buffer(NULL)
+	, ChunkBuffer(NULL)
 	, FileName()
-	, Condition(yycINLINE_HTML) 
-	, Version(PHP_53) {
+	, Condition(yycINLINE_HTML)
+	, SavedCondition(yycINLINE_HTML) 
+	, Version(PHP_53) 
+	, FileBufferType(STREAMING_FILE_BUFFER)
+	, CancelToken(NULL)
+	, TokensUntilCancelCheck(0)
+	, Cancelled(false)
+	, KeptBufferedFile(NULL)
+	, KeptMappedFile(NULL)
+	, KeptStringBuffer(NULL)
+	, KeptUtf8Buffer(NULL)
+	, IsKeepingBuffers(false)
+	, Pipeline(NULL)
+	, PipelineLength(PELET_PIPELINE_MIN_LENGTH)
+	, IsPipelineMode(false)
+	, IsPipelined(false) {
 }
 
 pelet::LexicalAnalyzerClass::~LexicalAnalyzerClass() {
 	Close();
+	DeleteKeptBuffers();
+	if (Pipeline) {
+		delete Pipeline;
+	}
 }
 
 void pelet::LexicalAnalyzerClass::Close() {
+	if (IsPipelined) {
+		Pipeline->Close();
+		IsPipelined = false;
+	}
 	if (Buffer) {
 		Buffer->Close();
-		delete Buffer;
+		if (Buffer != KeptBufferedFile && Buffer != KeptMappedFile && Buffer != KeptStringBuffer) {
+			delete Buffer;
+		}
 		Buffer = NULL;
+		ChunkBuffer = NULL;
+	}
+	if (Utf8Buffer) {
+		Utf8Buffer->Close();
+		if (Utf8Buffer != KeptUtf8Buffer) {
+			delete Utf8Buffer;
+		}
+		Utf8Buffer = NULL;
+	}
+}
+
+void pelet::LexicalAnalyzerClass::SetKeepBuffers(bool keep) {
+	if (IsKeepingBuffers && !keep) {
+		Close();
+		DeleteKeptBuffers();
+	}
+	IsKeepingBuffers = keep;
+}
+
+void pelet::LexicalAnalyzerClass::SetPipelineMode(bool pipeline, int minLength) {
+	IsPipelineMode = pipeline;
+	PipelineLength = minLength > 0 ? minLength : PELET_PIPELINE_MIN_LENGTH;
+}
+
+bool pelet::LexicalAnalyzerClass::PipelineFile(const std::string& file) {
+	if (!IsPipelineMode) {
+		return false;
+	}
+	FILE* fp = fopen(file.c_str(), "rb");
+	if (!fp) {
+		return false;
+	}
+	long size = 0;
+	if (fseek(fp, 0, SEEK_END) == 0) {
+		size = ftell(fp);
+	}
+	fclose(fp);
+	if (size < PipelineLength) {
+		return false;
+	}
+	if (!Pipeline) {
+		Pipeline = new pelet::TokenPipelineClass();
+	}
+	IsPipelined = Pipeline->OpenFile(file, Version, FileBufferType);
+	return IsPipelined;
+}
+
+bool pelet::LexicalAnalyzerClass::PipelineString(const UnicodeString& code) {
+	if (!IsPipelineMode || code.length() < PipelineLength) {
+		return false;
+	}
+	if (!Pipeline) {
+		Pipeline = new pelet::TokenPipelineClass();
+	}
+	IsPipelined = Pipeline->OpenString(code, Version);
+	return IsPipelined;
+}
+
+void pelet::LexicalAnalyzerClass::DeleteKeptBuffers() {
+	if (KeptBufferedFile) {
+		delete KeptBufferedFile;
+		KeptBufferedFile = NULL;
+	}
+	if (KeptMappedFile) {
+		delete KeptMappedFile;
+		KeptMappedFile = NULL;
+	}
+	if (KeptStringBuffer) {
+		delete KeptStringBuffer;
+		KeptStringBuffer = NULL;
+	}
+	if (KeptUtf8Buffer) {
+		delete KeptUtf8Buffer;
+		KeptUtf8Buffer = NULL;
+	}
+}
+
+void pelet::LexicalAnalyzerClass::AddParserError(const UnicodeString& error) {
+	pelet::ParserErrorClass parserError;
+	parserError.Error = error;
+	parserError.LineNumber = GetLineNumber();
+	parserError.CharacterPosition = GetCharacterPosition();
+	ParserErrors.push_back(parserError);
+	if (ParserError.isEmpty()) {
+		ParserError = error;
 	}
 }
 
 bool pelet::LexicalAnalyzerClass::OpenFile(const std::string& newFile) {
 	Close();
 	ParserError = UNICODE_STRING_SIMPLE("");
-	UCharBufferedFileClass* bufferFile =  new UCharBufferedFileClass();
-	Buffer = bufferFile;
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
 	FileName = newFile;
 	Condition = yycINLINE_HTML;
+	if (PipelineFile(newFile)) {
+		return true;
+	}
+	if (UTF8_FILE_BUFFER == FileBufferType) {
+		if (IsKeepingBuffers && !KeptUtf8Buffer) {
+			KeptUtf8Buffer = new Utf8BufferClass();
+		}
+		Utf8Buffer = IsKeepingBuffers ? KeptUtf8Buffer : new Utf8BufferClass();
+		return Utf8Buffer->OpenFile(newFile.c_str());
+	}
+	if (MAPPED_UTF8_FILE_BUFFER == FileBufferType) {
+		if (IsKeepingBuffers && !KeptMappedFile) {
+			KeptMappedFile = new UCharMappedFileClass();
+			KeptMappedFile->SetKeepCapacity(true);
+		}
+		UCharMappedFileClass* mappedFile = IsKeepingBuffers ? KeptMappedFile : new UCharMappedFileClass();
+		Buffer = mappedFile;
+		return mappedFile->OpenFile(newFile.c_str());
+	}
+	if (IsKeepingBuffers && !KeptBufferedFile) {
+		KeptBufferedFile = new UCharBufferedFileClass();
+		KeptBufferedFile->SetKeepCapacity(true);
+	}
+	UCharBufferedFileClass* bufferFile = IsKeepingBuffers ? KeptBufferedFile : new UCharBufferedFileClass();
+	Buffer = bufferFile;
 	return bufferFile->OpenFile(newFile.c_str());
 }
 
@@ -72,9 +246,32 @@ bool pelet::LexicalAnalyzerClass::OpenFile(FILE* file) {
 	Close();
 	FileName = "";
 	ParserError = UNICODE_STRING_SIMPLE("");
-	UCharBufferedFileClass* bufferFile =  new UCharBufferedFileClass();
-	Buffer = bufferFile;	
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
 	Condition = yycINLINE_HTML;
+	if (UTF8_FILE_BUFFER == FileBufferType) {
+		if (IsKeepingBuffers && !KeptUtf8Buffer) {
+			KeptUtf8Buffer = new Utf8BufferClass();
+		}
+		Utf8Buffer = IsKeepingBuffers ? KeptUtf8Buffer : new Utf8BufferClass();
+		return Utf8Buffer->OpenFile(file);
+	}
+	if (MAPPED_UTF8_FILE_BUFFER == FileBufferType) {
+		if (IsKeepingBuffers && !KeptMappedFile) {
+			KeptMappedFile = new UCharMappedFileClass();
+			KeptMappedFile->SetKeepCapacity(true);
+		}
+		UCharMappedFileClass* mappedFile = IsKeepingBuffers ? KeptMappedFile : new UCharMappedFileClass();
+		Buffer = mappedFile;
+		return mappedFile->OpenFile(file);
+	}
+	if (IsKeepingBuffers && !KeptBufferedFile) {
+		KeptBufferedFile = new UCharBufferedFileClass();
+		KeptBufferedFile->SetKeepCapacity(true);
+	}
+	UCharBufferedFileClass* bufferFile = IsKeepingBuffers ? KeptBufferedFile : new UCharBufferedFileClass();
+	Buffer = bufferFile;	
 	return bufferFile->OpenFile(file);
 }
 
@@ -82,17 +279,137 @@ bool pelet::LexicalAnalyzerClass::OpenString(const UnicodeString& code) {
 	Close();
 	FileName = "";
 	ParserError = UNICODE_STRING_SIMPLE("");
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
 	Condition = yycSCRIPT;
-	pelet::UCharBufferClass* memBuffer = new UCharBufferClass();
+	if (PipelineString(code)) {
+		return true;
+	}
+	if (IsKeepingBuffers && !KeptStringBuffer) {
+		KeptStringBuffer = new UCharBufferClass();
+		KeptStringBuffer->SetKeepCapacity(true);
+	}
+	pelet::UCharBufferClass* memBuffer = IsKeepingBuffers ? KeptStringBuffer : new UCharBufferClass();
 	Buffer = memBuffer;
 	return memBuffer->OpenString(code);
 }
 
+bool pelet::LexicalAnalyzerClass::OpenStringAt(const UnicodeString& code, int startPos, int lineNumber, YYCONDTYPE condition) {
+	Close();
+	FileName = "";
+	ParserError = UNICODE_STRING_SIMPLE("");
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
+	Condition = condition;
+	if (IsKeepingBuffers && !KeptStringBuffer) {
+		KeptStringBuffer = new UCharBufferClass();
+		KeptStringBuffer->SetKeepCapacity(true);
+	}
+	pelet::UCharBufferClass* memBuffer = IsKeepingBuffers ? KeptStringBuffer : new UCharBufferClass();
+	Buffer = memBuffer;
+	return memBuffer->OpenString(code, startPos, lineNumber);
+}
+
+bool pelet::LexicalAnalyzerClass::OpenView(const UChar* code, int length, int startPos, int lineNumber, YYCONDTYPE condition) {
+	Close();
+	FileName = "";
+	ParserError = UNICODE_STRING_SIMPLE("");
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
+	Condition = condition;
+	if (startPos < 0 || startPos > length) {
+		return false;
+	}
+	pelet::UCharViewBufferClass* viewBuffer = new UCharViewBufferClass();
+	Buffer = viewBuffer;
+	viewBuffer->Open(code, length, startPos, lineNumber);
+	return true;
+}
+
+void pelet::LexicalAnalyzerClass::OpenChunks() {
+	Close();
+	FileName = "";
+	ParserError = UNICODE_STRING_SIMPLE("");
+	ParserErrors.clear();
+	Cancelled = false;
+	TokensUntilCancelCheck = 0;
+	Condition = yycINLINE_HTML;
+	SavedCondition = yycINLINE_HTML;
+	ChunkBuffer = new UCharChunkBufferClass();
+	Buffer = ChunkBuffer;
+	ChunkBuffer->Open();
+}
+
+void pelet::LexicalAnalyzerClass::AppendChunk(const UChar* chars, int length) {
+	if (ChunkBuffer) {
+		ChunkBuffer->Append(chars, length);
+	}
+}
+
+void pelet::LexicalAnalyzerClass::FinishChunks() {
+	if (ChunkBuffer) {
+		ChunkBuffer->Finish();
+	}
+}
+
+void pelet::LexicalAnalyzerClass::SavePosition() {
+	if (ChunkBuffer) {
+		ChunkBuffer->SavePosition();
+		SavedCondition = Condition;
+	}
+}
+
+void pelet::LexicalAnalyzerClass::RestorePosition() {
+	if (ChunkBuffer) {
+		ChunkBuffer->RestorePosition();
+		Condition = SavedCondition;
+	}
+}
+
+bool pelet::LexicalAnalyzerClass::NeedsMoreInput() const {
+	return ChunkBuffer && ChunkBuffer->NeedsMoreInput();
+}
+
 void pelet::LexicalAnalyzerClass::SetVersion(Versions version) {
 	Version = version;
 }
 
+void pelet::LexicalAnalyzerClass::SetFileBufferType(FileBufferTypes type) {
+	FileBufferType = type;
+}
+
+void pelet::LexicalAnalyzerClass::SetCancelToken(pelet::CancelTokenClass* cancelToken) {
+	CancelToken = cancelToken;
+}
+
+bool pelet::LexicalAnalyzerClass::WasCancelled() const {
+	return Cancelled;
+}
+
 int pelet::LexicalAnalyzerClass::NextToken() {
+	if (CancelToken) {
+		if (Cancelled) {
+			return T_END;
+		}
+		if (--TokensUntilCancelCheck <= 0) {
+			TokensUntilCancelCheck = PELET_CANCEL_CHECK_TOKENS;
+			if (CancelToken->IsCancelled()) {
+				Cancelled = true;
+				return T_ERROR_CANCELLED;
+			}
+		}
+	}
+	if (IsPipelined) {
+		const pelet::TokenRecordClass& record = Pipeline->Next();
+		Condition = record.Condition;
+		return record.Token;
+	}
+	if (Utf8Buffer) {
+		return PHP_53 == Version ? pelet::Next53Token(Utf8Buffer, Condition) : pelet::Next54Token(Utf8Buffer, Condition);
+	}
 	if (PHP_53 == Version) {
 		return Buffer ? pelet::Next53Token(Buffer, Condition) : T_END;
 	}
@@ -102,26 +419,47 @@ int pelet::LexicalAnalyzerClass::NextToken() {
 }
 
 bool pelet::LexicalAnalyzerClass::GetLexeme(UnicodeString& lexeme) {
-	if (!Buffer) {
+	if (IsPipelined) {
+
+		// copy the characters; sharing the buffer with the record would make
+		// the lexer thread allocate a new one when it reuses the record
+		const pelet::TokenRecordClass& record = Pipeline->Current();
+		lexeme.setTo(record.Lexeme.getBuffer(), record.Lexeme.length());
+		return record.HasLexeme;
+	}
+	if (!Buffer && !Utf8Buffer) {
 		return false;
 	}
 	lexeme.remove();
-	const UChar *start = Buffer->TokenStart;
-	const UChar *end =  Buffer->Current;
+	const UChar *start = NULL;
+	const UChar *end = NULL;
 	bool ret = false;
 	bool isSingleQuoteString = false;
 	bool isDoubleQuoteString = false;
 	bool isHeredoc = false;
 	bool isNowdoc = false;
+	UnicodeString converted;
+	bool inLimit = false;
+	if (Utf8Buffer) {
+	
+		// only now do we convert the token into UTF-16
+		inLimit = Utf8Buffer->Current <= Utf8Buffer->Limit;
+		if (inLimit && Utf8Buffer->Current > Utf8Buffer->TokenStart) {
+			converted = UnicodeString::fromUTF8(StringPiece((const char*)Utf8Buffer->TokenStart, 
+				Utf8Buffer->Current - Utf8Buffer->TokenStart));
+		}
+		start = converted.getBuffer();
+		end = start + converted.length();
+	}
+	else {
+		start = Buffer->TokenStart;
+		end =  Buffer->Current;
+		inLimit = Buffer->Current <= Buffer->Limit;
+	}
 	
 	// be careful, take Limit into account too... we dont want to read past what is allowed
-	if ((end - start) > 0 && Buffer->Current <= Buffer->Limit) {
+	if ((end - start) > 0 && inLimit) {
 	
-		// the lexer may ask for too much when the last token is an identifier
-		// in this case current will point to past the null character
-		if (Buffer->Current > Buffer->Limit) {
-			end = Buffer->Limit;
-		}
 		if (start[0] == '\'') {
 			isSingleQuoteString = true;
 			start++;
@@ -216,14 +554,111 @@ bool pelet::LexicalAnalyzerClass::GetLexeme(UnicodeString& lexeme) {
 	return ret;
 }
 
+/**
+ * @return the number of newlines in the given characters; a CR LF pair is one newline
+ */
+static int CountNewlines(const UChar* start, const UChar* end) {
+	int count = 0;
+	for (const UChar* c = start; c < end; ++c) {
+		if ('\n' == *c) {
+			count++;
+		}
+		else if ('\r' == *c) {
+			count++;
+			if (c + 1 < end && '\n' == *(c + 1)) {
+				++c;
+			}
+		}
+	}
+	return count;
+}
+
+/**
+ * tokenizes the code in table.Source
+ */
+static void TokenizeSource(pelet::Versions version, pelet::YYCONDTYPE condition, pelet::TokenTableClass& table) {
+	const UChar* code = table.Source.getTerminatedBuffer();
+	pelet::UCharViewBufferClass buffer;
+	buffer.Open(code, table.Source.length());
+	int lastLine = 1;
+	bool done = false;
+	while (!done) {
+		int token = pelet::PHP_53 == version ? pelet::Next53Token(&buffer, condition) : pelet::Next54Token(&buffer, condition);
+		int start = buffer.GetCharacterPosition();
+		int length = buffer.GetCurrentPosition() - start;
+		
+		// the lexer gives the line after the token; only tokens that 
+		// end on a new line can span lines
+		int line = buffer.GetLineNumber();
+		if (line != lastLine) {
+			lastLine = line;
+			line -= CountNewlines(code + start, code + start + length);
+		}
+		table.Tokens.push_back(token);
+		table.Starts.push_back(start);
+		table.Lengths.push_back(length);
+		table.Lines.push_back(line);
+		table.EndConditions.push_back((unsigned char)condition);
+		done = pelet::IsTerminatingToken(token);
+	}
+}
+
+bool pelet::LexicalAnalyzerClass::TokenizeAll(const UnicodeString& code, pelet::TokenTableClass& table) {
+	table.Clear();
+	if (code.isEmpty()) {
+		return false;
+	}
+	table.Source = code;
+	TokenizeSource(Version, pelet::yycSCRIPT, table);
+	return true;
+}
+
+bool pelet::LexicalAnalyzerClass::TokenizeFile(const std::string& fileName, pelet::TokenTableClass& table) {
+	table.Clear();
+	pelet::UCharMappedFileClass file;
+	if (!file.OpenFile(fileName.c_str())) {
+		return false;
+	}
+	table.Source.setTo(file.Current, file.GetLength());
+	file.Close();
+	TokenizeSource(Version, pelet::yycINLINE_HTML, table);
+	return true;
+}
+
 int pelet::LexicalAnalyzerClass::GetLineNumber() const {
+	if (IsPipelined) {
+		return Pipeline->Current().LineNumber;
+	}
+	if (Utf8Buffer) {
+		return Utf8Buffer->GetLineNumber();
+	}
 	return Buffer ? Buffer->GetLineNumber() : 0;
 }
 
+int pelet::LexicalAnalyzerClass::GetTokenLength() const {
+	if (IsPipelined) {
+		return Pipeline->Current().Length;
+	}
+	if (Utf8Buffer) {
+		return Utf8Buffer->Current - Utf8Buffer->TokenStart;
+	}
+	return Buffer ? (Buffer->Current - Buffer->TokenStart) : 0;
+}
+
 int pelet::LexicalAnalyzerClass::GetCharacterPosition() const {
+	if (IsPipelined) {
+		return Pipeline->Current().Pos;
+	}
+	if (Utf8Buffer) {
+		return Utf8Buffer->GetCharacterPosition();
+	}
 	return Buffer ? Buffer->GetCharacterPosition() : 0;
 }
 
+pelet::YYCONDTYPE pelet::LexicalAnalyzerClass::GetCondition() const {
+	return Condition;
+}
+
 std::string pelet::LexicalAnalyzerClass::GetFileName() const {
 	return FileName;
 }
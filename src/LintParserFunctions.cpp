@@ -47,6 +47,8 @@ int pelet::LintLex(int* value, pelet::LexicalAnalyzerClass& analyzer) {
 
 void pelet::LintGrammarError(pelet::LexicalAnalyzerClass& analyzer, std::string msg) {
 	int capacity = msg.length() + 1;
-	int written = u_sprintf(analyzer.ParserError.getBuffer(capacity), "%s", msg.c_str());
-	analyzer.ParserError.releaseBuffer(written);
+	UnicodeString error;
+	int written = u_sprintf(error.getBuffer(capacity), "%s", msg.c_str());
+	error.releaseBuffer(written);
+	analyzer.AddParserError(error);
 }
\ No newline at end of file
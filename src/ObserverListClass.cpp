@@ -0,0 +1,342 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/ObserverListClass.h>
+
+pelet::ObserverListClass::ObserverListClass()
+	: ClassObserverClass()
+	, ClassMemberObserverClass()
+	, FunctionObserverClass()
+	, VariableObserverClass()
+	, ExpressionObserverClass()
+	, ClassObservers()
+	, ClassMemberObservers()
+	, FunctionObservers()
+	, VariableObservers()
+	, ExpressionObservers() {
+}
+
+pelet::ClassObserverClass* pelet::ObserverListClass::GetClassObserver() {
+	if (ClassObservers.empty()) {
+		return NULL;
+	}
+	if (ClassObservers.size() == 1) {
+		return ClassObservers[0];
+	}
+	return this;
+}
+
+pelet::ClassMemberObserverClass* pelet::ObserverListClass::GetClassMemberObserver() {
+	if (ClassMemberObservers.empty()) {
+		return NULL;
+	}
+	if (ClassMemberObservers.size() == 1) {
+		return ClassMemberObservers[0];
+	}
+	return this;
+}
+
+pelet::FunctionObserverClass* pelet::ObserverListClass::GetFunctionObserver() {
+	if (FunctionObservers.empty()) {
+		return NULL;
+	}
+	if (FunctionObservers.size() == 1) {
+		return FunctionObservers[0];
+	}
+	return this;
+}
+
+pelet::VariableObserverClass* pelet::ObserverListClass::GetVariableObserver() {
+	if (VariableObservers.empty()) {
+		return NULL;
+	}
+	if (VariableObservers.size() == 1) {
+		return VariableObservers[0];
+	}
+	return this;
+}
+
+pelet::ExpressionObserverClass* pelet::ObserverListClass::GetExpressionObserver() {
+	if (ExpressionObservers.empty()) {
+		return NULL;
+	}
+	if (ExpressionObservers.size() == 1) {
+		return ExpressionObservers[0];
+	}
+	return this;
+}
+
+int pelet::ObserverListClass::SymbolFields() const {
+	int fields = 0;
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		fields |= ClassObservers[i]->SymbolFields();
+	}
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		fields |= ClassMemberObservers[i]->SymbolFields();
+	}
+	for (size_t i = 0; i < FunctionObservers.size(); ++i) {
+		fields |= FunctionObservers[i]->SymbolFields();
+	}
+	for (size_t i = 0; i < VariableObservers.size(); ++i) {
+		fields |= VariableObservers[i]->SymbolFields();
+	}
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		fields |= ExpressionObservers[i]->SymbolFields();
+	}
+	return fields;
+}
+
+int pelet::ObserverListClass::ExpressionTypes() const {
+	int types = 0;
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		types |= ExpressionObservers[i]->ExpressionTypes();
+	}
+	return types;
+}
+
+void pelet::ObserverListClass::ClassFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& signature, const UnicodeString& baseClassName, const UnicodeString& implementInterfaceNames,
+		const UnicodeString& comment, const int lineNumber) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->ClassFound(namespaceName, className, signature, baseClassName, implementInterfaceNames, comment, lineNumber);
+	}
+}
+
+void pelet::ObserverListClass::ClassEnd(const UnicodeString& namespaceName, const UnicodeString& className, int pos) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->ClassEnd(namespaceName, className, pos);
+	}
+}
+
+void pelet::ObserverListClass::DefineDeclarationFound(const UnicodeString& namespaceName,
+		const UnicodeString& variableName, const UnicodeString& variableValue, const UnicodeString& comment,
+		const int lineNumber) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->DefineDeclarationFound(namespaceName, variableName, variableValue, comment, lineNumber);
+	}
+}
+
+void pelet::ObserverListClass::IncludeFound(const UnicodeString& filename, const int lineNumber) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->IncludeFound(filename, lineNumber);
+	}
+}
+
+void pelet::ObserverListClass::NamespaceDeclarationFound(const UnicodeString& namespaceName, int startingPos) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->NamespaceDeclarationFound(namespaceName, startingPos);
+	}
+}
+
+void pelet::ObserverListClass::NamespaceUseFound(const UnicodeString& namespaceName, const UnicodeString& alias,
+		int lineNumber, int startingPos) {
+	for (size_t i = 0; i < ClassObservers.size(); ++i) {
+		ClassObservers[i]->NamespaceUseFound(namespaceName, alias, lineNumber, startingPos);
+	}
+}
+
+void pelet::ObserverListClass::MethodFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& methodName, const UnicodeString& signature, const UnicodeString& returnType,
+		const UnicodeString& comment, pelet::TokenClass::TokenIds visibility, bool isStatic, const int lineNumber,
+		bool hasVariableArguments) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->MethodFound(namespaceName, className, methodName, signature, returnType, comment, visibility, isStatic, lineNumber, hasVariableArguments);
+	}
+}
+
+void pelet::ObserverListClass::PropertyFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& propertyName, const UnicodeString& propertyType, const UnicodeString& comment,
+		pelet::TokenClass::TokenIds visibility, bool isConst, bool isStatic, const int lineNumber) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->PropertyFound(namespaceName, className, propertyName, propertyType, comment, visibility, isConst, isStatic, lineNumber);
+	}
+}
+
+void pelet::ObserverListClass::MethodScope(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& methodName, int startingPos, int endingPos) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->MethodScope(namespaceName, className, methodName, startingPos, endingPos);
+	}
+}
+
+void pelet::ObserverListClass::TraitUseFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& fullyQualifiedTraitName) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->TraitUseFound(namespaceName, className, fullyQualifiedTraitName);
+	}
+}
+
+void pelet::ObserverListClass::TraitAliasFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& traitUsedClassName, const UnicodeString& traitMethodName, const UnicodeString& alias,
+		pelet::TokenClass::TokenIds visibility) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->TraitAliasFound(namespaceName, className, traitUsedClassName, traitMethodName, alias, visibility);
+	}
+}
+
+void pelet::ObserverListClass::TraitInsteadOfFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& traitUsedClassName, const UnicodeString& traitMethodName,
+		const std::vector<UnicodeString>& insteadOfList) {
+	for (size_t i = 0; i < ClassMemberObservers.size(); ++i) {
+		ClassMemberObservers[i]->TraitInsteadOfFound(namespaceName, className, traitUsedClassName, traitMethodName, insteadOfList);
+	}
+}
+
+void pelet::ObserverListClass::FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName,
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+		bool hasVariableArguments) {
+	for (size_t i = 0; i < FunctionObservers.size(); ++i) {
+		FunctionObservers[i]->FunctionFound(namespaceName, functionName, signature, returnType, comment, lineNumber, hasVariableArguments);
+	}
+}
+
+void pelet::ObserverListClass::FunctionScope(const UnicodeString& namespaceName, const UnicodeString& functionName,
+		int startingPos, int endingPos) {
+	for (size_t i = 0; i < FunctionObservers.size(); ++i) {
+		FunctionObservers[i]->FunctionScope(namespaceName, functionName, startingPos, endingPos);
+	}
+}
+
+void pelet::ObserverListClass::VariableFound(const UnicodeString& namespaceName, const UnicodeString& className,
+		const UnicodeString& methodName, const pelet::VariableClass& variable, pelet::ExpressionClass* expression,
+		const UnicodeString& comment) {
+	for (size_t i = 0; i < VariableObservers.size(); ++i) {
+		VariableObservers[i]->VariableFound(namespaceName, className, methodName, variable, expression, comment);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionVariableFound(pelet::VariableClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionVariableFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionAssignmentFound(pelet::AssignmentExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionAssignmentFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionAssignmentListFound(pelet::AssignmentListExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionAssignmentListFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionAssignmentCompoundFound(pelet::AssignmentCompoundExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionAssignmentCompoundFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionBinaryOperationFound(pelet::BinaryOperationClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionBinaryOperationFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionUnaryOperationFound(pelet::UnaryOperationClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionUnaryOperationFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionUnaryVariableOperationFound(pelet::UnaryVariableOperationClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionUnaryVariableOperationFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionTernaryOperationFound(pelet::TernaryOperationClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionTernaryOperationFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionInstanceOfOperationFound(pelet::InstanceOfOperationClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionInstanceOfOperationFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionScalarFound(pelet::ScalarExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionScalarFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionNewInstanceFound(pelet::NewInstanceExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionNewInstanceFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionFunctionArgumentFound(pelet::VariableClass* variable) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionFunctionArgumentFound(variable);
+	}
+}
+
+void pelet::ObserverListClass::StatementGlobalVariablesFound(pelet::GlobalVariableStatementClass* variables) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->StatementGlobalVariablesFound(variables);
+	}
+}
+
+void pelet::ObserverListClass::StatementStaticVariablesFound(pelet::StaticVariableStatementClass* variables) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->StatementStaticVariablesFound(variables);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionIncludeFound(pelet::IncludeExpressionClass* expr) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionIncludeFound(expr);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionClosureFound(pelet::ClosureExpressionClass* expr) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionClosureFound(expr);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionIssetFound(pelet::IssetExpressionClass* expr) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionIssetFound(expr);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionArrayFound(pelet::ArrayExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionArrayFound(expression);
+	}
+}
+
+void pelet::ObserverListClass::ExpressionEvalFound(pelet::EvalExpressionClass* expression) {
+	for (size_t i = 0; i < ExpressionObservers.size(); ++i) {
+		ExpressionObservers[i]->ExpressionEvalFound(expression);
+	}
+}
+
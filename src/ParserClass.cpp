@@ -26,8 +26,22 @@
 #include <pelet/TokenClass.h>
 #include <pelet/FullParserObserverClass.h>
 #include <pelet/ResourceParserObserverClass.h>
+#include <pelet/DeclarationScannerClass.h>
+#include <pelet/ExpressionChainParserClass.h>
+#include <pelet/UCharMappedFileClass.h>
+#include <pelet/BodyWatcherClass.h>
 #include <stack>
 
+/**
+ * the status that the bison push parsers return when they need another token
+ */
+#define PELET_PUSH_MORE 4
+
+/**
+ * the status that the bison push parsers return when the parse was aborted
+ */
+#define PELET_PUSH_ABORTED 1
+
 /* 
  * generated by Bison according to the prefix of our choosing
  * Bison won't put this declaration in the header file so we must
@@ -39,42 +53,226 @@ extern int php54_lint_parse(pelet::LexicalAnalyzerClass &analyzer);
 extern int php53_resource_parse(pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass& observers);
 extern int php54_resource_parse(pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass& observers);
 
+/*
+ * the push parsers, used by ParserClass::Feed(). Bison defines the parser state 
+ * structs in the generated source only.
+ */
+struct php53_resource_pstate;
+struct php54_resource_pstate;
+struct php53pstate;
+struct php54pstate;
+extern php53_resource_pstate* php53_resource_pstate_new();
+extern php54_resource_pstate* php54_resource_pstate_new();
+extern php53pstate* php53pstate_new();
+extern php54pstate* php54pstate_new();
+extern void php53_resource_pstate_delete(php53_resource_pstate* state);
+extern void php54_resource_pstate_delete(php54_resource_pstate* state);
+extern void php53pstate_delete(php53pstate* state);
+extern void php54pstate_delete(php54pstate* state);
+extern int php53_resource_push_parse(php53_resource_pstate* state, int token, const pelet::ResourceParserTypeClass* value, 
+	pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass& observers);
+extern int php54_resource_push_parse(php54_resource_pstate* state, int token, const pelet::ResourceParserTypeClass* value, 
+	pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass& observers);
+extern int php53push_parse(php53pstate* state, int token, const pelet::ParserType* value, 
+	pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+extern int php54push_parse(php54pstate* state, int token, const pelet::ParserType* value, 
+	pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+
+/**
+ * copies the parse errors from the lexer to the results. When there are errors the
+ * results will point to the first one; the parsers recover from errors so the 
+ * lexer is no longer at the error position. When the lexer was cancelled the
+ * syntax error caused by stopping is not an error.
+ *
+ * @return bool TRUE if there were no parse errors
+ */
+static bool CopyErrors(const pelet::LexicalAnalyzerClass& lexer, pelet::LintResultsClass& results) {
+	results.IsCancelled = lexer.WasCancelled();
+	if (results.IsCancelled) {
+		results.Error.remove();
+		results.Errors.clear();
+		return false;
+	}
+	results.Errors = lexer.ParserErrors;
+	if (!lexer.ParserErrors.empty()) {
+		results.LineNumber = lexer.ParserErrors[0].LineNumber;
+		results.CharacterPosition = lexer.ParserErrors[0].CharacterPosition;
+	}
+	return lexer.ParserErrors.empty();
+}
+
+/**
+ * lexes the next token the same way that ResourceLex() and FullLex() do, but
+ * only to find out whether the code given so far is enough to make the token.
+ * The caller must save and restore the lexer position around this call.
+ *
+ * @param lexer the lexer, opened with OpenChunks()
+ * @param isBodyStart TRUE if the observers would skip over a body
+ * @return bool TRUE if the token is complete
+ */
+static bool IsNextTokenComplete(pelet::LexicalAnalyzerClass& lexer, bool isBodyStart) {
+	int token = 0;
+	if (isBodyStart) {
+		bool hasCallToFuncGetArg = false;
+		token = pelet::SkipBody(lexer, hasCallToFuncGetArg);
+	}
+	else {
+		token = lexer.NextToken();
+	}
+	if (pelet::T_OPEN_TAG == token || pelet::T_OPEN_TAG_WITH_ECHO == token) {
+		token = lexer.NextToken();
+	}
+	while (!lexer.NeedsMoreInput() && (pelet::T_DOC_COMMENT == token || pelet::T_COMMENT == token)) {
+		token = lexer.NextToken();
+	}
+	return !lexer.NeedsMoreInput();
+}
+
+namespace pelet {
+
+/**
+ * The state of a parse that is given its code in pieces. Only one of the
+ * bison parser states is created; which one depends on the version and the
+ * observers, following the same rules as ParserClass::ScanString().
+ */
+class PushParserStateClass {
+
+public:
+
+	ResourceParserObserverClass ResourceObservers;
+
+	FullParserObserverClass FullObservers;
+
+	php53_resource_pstate* Resource53;
+
+	php54_resource_pstate* Resource54;
+
+	php53pstate* Full53;
+
+	php54pstate* Full54;
+
+	/**
+	 * the status returned by the last push; PELET_PUSH_MORE until the parse ends
+	 */
+	int Status;
+
+	PushParserStateClass(ClassObserverClass* classObserver, ClassMemberObserverClass* classMemberObserver,
+		FunctionObserverClass* functionObserver, VariableObserverClass* variableObserver, 
+		ExpressionObserverClass* expressionObserver, AstArenaClass* arena, Versions version)
+	: ResourceObservers(classObserver, classMemberObserver, functionObserver)
+	, FullObservers(classObserver, classMemberObserver, functionObserver, variableObserver, expressionObserver, arena)
+	, Resource53(NULL)
+	, Resource54(NULL)
+	, Full53(NULL)
+	, Full54(NULL)
+	, Status(PELET_PUSH_MORE) {
+		bool isFull = variableObserver || expressionObserver;
+		if (pelet::PHP_53 == version) {
+			if (isFull) {
+				Full53 = php53pstate_new();
+			}
+			else {
+				Resource53 = php53_resource_pstate_new();
+			}
+		}
+		else if (isFull) {
+			Full54 = php54pstate_new();
+		}
+		else {
+			Resource54 = php54_resource_pstate_new();
+		}
+	}
+
+	~PushParserStateClass() {
+		if (Resource53) {
+			php53_resource_pstate_delete(Resource53);
+		}
+		if (Resource54) {
+			php54_resource_pstate_delete(Resource54);
+		}
+		if (Full53) {
+			php53pstate_delete(Full53);
+		}
+		if (Full54) {
+			php54pstate_delete(Full54);
+		}
+	}
+
+	/**
+	 * gives the parser all of the complete tokens in the lexer. Stops when the
+	 * lexer needs more code or when the parse has ended.
+	 */
+	void Push(LexicalAnalyzerClass& lexer) {
+		bool isFull = Full53 || Full54;
+		while (PELET_PUSH_MORE == Status) {
+			bool isComplete = isFull && FullObservers.IsBodyEnd();
+			if (!isComplete) {
+				lexer.SavePosition();
+				isComplete = IsNextTokenComplete(lexer, isFull ? FullObservers.IsBodyStart() : ResourceObservers.IsBodyStart());
+				lexer.RestorePosition();
+			}
+			if (lexer.WasCancelled()) {
+
+				// the parser is not given any more tokens, so that it does 
+				// not accept the code that it has seen so far
+				Status = PELET_PUSH_ABORTED;
+				break;
+			}
+			if (!isComplete) {
+				break;
+			}
+			if (isFull) {
+				pelet::ParserType value;
+				int token = pelet::FullLex(&value, lexer, FullObservers);
+				Status = Full53 ? php53push_parse(Full53, token, &value, lexer, FullObservers)
+					: php54push_parse(Full54, token, &value, lexer, FullObservers);
+			}
+			else {
+				pelet::ResourceParserTypeClass value;
+				int token = pelet::ResourceLex(&value, lexer, ResourceObservers);
+				Status = Resource53 ? php53_resource_push_parse(Resource53, token, &value, lexer, ResourceObservers)
+					: php54_resource_push_parse(Resource54, token, &value, lexer, ResourceObservers);
+			}
+		}
+	}
+};
+
+}
+
 pelet::ParserClass::ParserClass()
 	: Lexer()
 	, ClassObserver(0)
 	, ClassMemberObserver(0)
 	, FunctionObserver(0)
 	, VariableObserver(0)
-	, ExpressionObserver(0) {
+	, ExpressionObserver(0)
+	, IsOutline(false)
+	, IsDeclarationScanner(false)
+	, IsLazy(false)
+	, IsStreaming(false)
+	, IsSession(false)
+	, IsExpressionChain(true)
+	, Arena()
+	, PushState(NULL)
+	, Observers() {
 	SetVersion(pelet::PHP_53);
 }
 
+pelet::ParserClass::~ParserClass() {
+	if (PushState) {
+		delete PushState;
+	}
+}
+
 bool pelet::ParserClass::ScanFile(const std::string& file, pelet::LintResultsClass& results) {
 	bool ret = false;
 	if (Lexer.OpenFile(file)) {
-		pelet::FullParserObserverClass observers(ClassObserver, ClassMemberObserver, FunctionObserver, VariableObserver, ExpressionObserver);
-		if (pelet::PHP_53 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php53_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_54 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php54_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_53 == Version) {
-			ret = php53parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
-		}
-		else if (pelet::PHP_54 == Version) {
-			ret = php54parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
-		}
+		ret = Parse(results);
 		results.Error = Lexer.ParserError;
 		results.File = file;
 		results.LineNumber = Lexer.GetLineNumber();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Close();
 	}
 	return ret;
@@ -83,29 +281,12 @@ bool pelet::ParserClass::ScanFile(const std::string& file, pelet::LintResultsCla
 bool pelet::ParserClass::ScanFile(FILE* file, const UnicodeString& filename, pelet::LintResultsClass& results) {
 	bool ret = false;
 	if (Lexer.OpenFile(file)) {
-		pelet::FullParserObserverClass observers(ClassObserver, ClassMemberObserver, FunctionObserver, VariableObserver, ExpressionObserver);
-		if (pelet::PHP_53 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php53_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_54 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php54_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_53 == Version) {
-			ret = php53parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
-		}
-		else if (pelet::PHP_54 == Version) {
-			ret = php54parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
-		}
+		ret = Parse(results);
 		results.Error = Lexer.ParserError;
 		results.UnicodeFilename = filename;
 		results.LineNumber = Lexer.GetLineNumber();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Close();
 	}
 	return ret;
@@ -114,58 +295,270 @@ bool pelet::ParserClass::ScanFile(FILE* file, const UnicodeString& filename, pel
 bool pelet::ParserClass::ScanString(const UnicodeString& code, pelet::LintResultsClass& results) {
 	bool ret = false;
 	if (Lexer.OpenString(code)) {
-		pelet::FullParserObserverClass observers(ClassObserver, ClassMemberObserver, FunctionObserver, VariableObserver, ExpressionObserver);
-		if (pelet::PHP_53 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php53_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_54 == Version && !VariableObserver && !ExpressionObserver) {
-			pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
-			ret = php54_resource_parse(Lexer, rObservers) == 0;
-			results.Scope = rObservers.GetScope();
-		}
-		else if (pelet::PHP_53 == Version) {
+		ret = Parse(results);
+		results.Error = Lexer.ParserError;
+		results.File = "";
+		
+		results.LineNumber = Lexer.GetLineNumber();
+		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
+		Close();
+	}
+	return ret;
+}
+
+bool pelet::ParserClass::ScanBody(const UnicodeString& code, const pelet::BodyRangeClass& body, pelet::LintResultsClass& results) {
+	bool ret = false;
+	if (Lexer.OpenStringAt(code, body.StartPos, body.LineNumber, body.Condition)) {
+		pelet::FullParserObserverClass observers(ClassObserver, ClassMemberObserver, FunctionObserver, VariableObserver, ExpressionObserver, &Arena);
+		observers.SetBody(body);
+		
+		// the body is parsed as a block statement; the lexer stops at the 
+		// closing brace of the body
+		if (pelet::PHP_53 == Version) {
 			ret = php53parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
 		}
 		else if (pelet::PHP_54 == Version) {
 			ret = php54parse(Lexer, observers) == 0;
-			results.Scope = observers.CurrentScope();
 		}
+		results.Scope = observers.ErrorScope();
+		results.Bodies.clear();
 		results.Error = Lexer.ParserError;
 		results.File = "";
-		
 		results.LineNumber = Lexer.GetLineNumber();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Close();
 	}
 	return ret;
 }
 
+bool pelet::ParserClass::ScanBody(const std::string& file, const pelet::BodyRangeClass& body, pelet::LintResultsClass& results) {
+	pelet::UCharMappedFileClass mappedFile;
+	if (!mappedFile.OpenFile(file.c_str())) {
+		return false;
+	}
+	UnicodeString code(mappedFile.Current, mappedFile.GetLength());
+	mappedFile.Close();
+	bool ret = ScanBody(code, body, results);
+	results.File = file;
+	return ret;
+}
+
+bool pelet::ParserClass::ScanRange(const UChar* code, const pelet::BodyRangeClass& range, pelet::LintResultsClass& results) {
+	bool ret = false;
+	if (Lexer.OpenView(code, range.EndPos, range.StartPos, range.LineNumber, range.Condition)) {
+		ret = ResourceParse(&range, results);
+		results.Bodies.clear();
+		results.Error = Lexer.ParserError;
+		results.File = "";
+		results.LineNumber = Lexer.GetLineNumber();
+		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
+		Close();
+	}
+	return ret;
+}
+
+bool pelet::ParserClass::Parse(pelet::LintResultsClass& results) {
+	bool ret = false;
+	pelet::FullParserObserverClass observers(ClassObserver, ClassMemberObserver, FunctionObserver, VariableObserver, ExpressionObserver, &Arena);
+	observers.DoSkipBodies = IsLazy;
+	if (!VariableObserver && !ExpressionObserver) {
+		ret = ResourceParse(NULL, results);
+	}
+	else if (pelet::PHP_53 == Version) {
+		ret = php53parse(Lexer, observers) == 0;
+		results.Scope = observers.ErrorScope();
+	}
+	else if (pelet::PHP_54 == Version) {
+		ret = php54parse(Lexer, observers) == 0;
+		results.Scope = observers.ErrorScope();
+	}
+	results.Bodies = observers.Bodies;
+	return ret;
+}
+
+bool pelet::ParserClass::ResourceParse(const pelet::BodyRangeClass* range, pelet::LintResultsClass& results) {
+	bool ret = false;
+	pelet::AstArenaClass* arena = ResourceArena();
+	{
+		pelet::ResourceParserObserverClass rObservers(ClassObserver, ClassMemberObserver, FunctionObserver);
+		rObservers.DoSkipBodies = IsOutline;
+		rObservers.DoNotifyEachStatement = IsStreaming;
+		rObservers.SetArena(arena);
+		if (range) {
+			rObservers.SetStartingScope(range->Scope, range->DeclaredNamespace);
+		}
+		if (IsDeclarationScanner && !range) {
+			pelet::DeclarationScannerClass scanner(Lexer, rObservers);
+			ret = scanner.Scan();
+		}
+		else if (pelet::PHP_53 == Version) {
+			ret = php53_resource_parse(Lexer, rObservers) == 0;
+		}
+		else if (pelet::PHP_54 == Version) {
+			ret = php54_resource_parse(Lexer, rObservers) == 0;
+		}
+		results.Scope = rObservers.GetScope();
+	}
+	
+	// the observers have been notified, the nodes are no longer needed. the memory 
+	// blocks are kept for the next scan
+	if (arena) {
+		arena->Reset();
+	}
+	return ret;
+}
+
+bool pelet::ParserClass::Feed(const UChar* code, int length) {
+	if (!PushState) {
+		Lexer.OpenChunks();
+		PushState = new pelet::PushParserStateClass(ClassObserver, ClassMemberObserver, FunctionObserver, 
+			VariableObserver, ExpressionObserver, &Arena, Version);
+		PushState->ResourceObservers.DoSkipBodies = IsOutline;
+		PushState->ResourceObservers.DoNotifyEachStatement = true;
+		PushState->FullObservers.DoSkipBodies = IsLazy;
+	}
+	if (PELET_PUSH_MORE == PushState->Status) {
+		Lexer.AppendChunk(code, length);
+		PushState->Push(Lexer);
+	}
+	return PELET_PUSH_MORE == PushState->Status;
+}
+
+bool pelet::ParserClass::Finish(pelet::LintResultsClass& results) {
+	if (!PushState) {
+		Feed(NULL, 0);
+	}
+	Lexer.FinishChunks();
+	PushState->Push(Lexer);
+	bool ret = 0 == PushState->Status;
+	if (PushState->Resource53 || PushState->Resource54) {
+		results.Scope = PushState->ResourceObservers.GetScope();
+	}
+	else {
+		results.Scope = PushState->FullObservers.ErrorScope();
+	}
+	results.Bodies = PushState->FullObservers.Bodies;
+	results.Error = Lexer.ParserError;
+	results.File = "";
+	results.LineNumber = Lexer.GetLineNumber();
+	results.CharacterPosition = Lexer.GetCharacterPosition();
+	ret = CopyErrors(Lexer, results) && ret;
+	delete PushState;
+	PushState = NULL;
+	Close();
+	return ret;
+}
+
 void pelet::ParserClass::SetVersion(pelet::Versions version) {
 	Version = version;
 	Lexer.SetVersion(Version);
 }
 
+void pelet::ParserClass::SetFileBufferType(pelet::FileBufferTypes type) {
+	Lexer.SetFileBufferType(type);
+}
+
+void pelet::ParserClass::SetOutlineMode(bool outline) {
+	IsOutline = outline;
+}
+
+void pelet::ParserClass::SetDeclarationScannerMode(bool scanner) {
+	IsDeclarationScanner = scanner;
+}
+
+void pelet::ParserClass::SetLazyBodyMode(bool lazy) {
+	IsLazy = lazy;
+}
+
+void pelet::ParserClass::SetStreamingMode(bool streaming) {
+	IsStreaming = streaming;
+}
+
+void pelet::ParserClass::SetSessionMode(bool session) {
+	IsSession = session;
+	Lexer.SetKeepBuffers(session);
+}
+
+void pelet::ParserClass::SetExpressionChainMode(bool chain) {
+	IsExpressionChain = chain;
+}
+
+void pelet::ParserClass::SetPipelineMode(bool pipeline, int minLength) {
+	Lexer.SetPipelineMode(pipeline, minLength);
+}
+
+pelet::AstArenaClass* pelet::ParserClass::ResourceArena() {
+	if (IsSession && !IsStreaming) {
+		return &Arena;
+	}
+	return NULL;
+}
+
+void pelet::ParserClass::SetCancelToken(pelet::CancelTokenClass* cancelToken) {
+	Lexer.SetCancelToken(cancelToken);
+}
+
 void pelet::ParserClass::SetClassMemberObserver(ClassMemberObserverClass* observer) {
-	ClassMemberObserver = observer;
+	Observers.ClassMemberObservers.clear();
+	AddClassMemberObserver(observer);
 }
 
 void pelet::ParserClass::SetClassObserver(ClassObserverClass* observer) {
-	ClassObserver = observer;
+	Observers.ClassObservers.clear();
+	AddClassObserver(observer);
 }
 
 void pelet::ParserClass::SetFunctionObserver(FunctionObserverClass* observer) {
-	FunctionObserver = observer;
+	Observers.FunctionObservers.clear();
+	AddFunctionObserver(observer);
 }
 
 void pelet::ParserClass::SetVariableObserver(VariableObserverClass* observer) {
-	VariableObserver = observer;
+	Observers.VariableObservers.clear();
+	AddVariableObserver(observer);
 }
 
 void pelet::ParserClass::SetExpressionObserver(ExpressionObserverClass* observer) {
-	ExpressionObserver = observer;
+	Observers.ExpressionObservers.clear();
+	AddExpressionObserver(observer);
+}
+
+void pelet::ParserClass::AddClassMemberObserver(ClassMemberObserverClass* observer) {
+	if (observer) {
+		Observers.ClassMemberObservers.push_back(observer);
+	}
+	ClassMemberObserver = Observers.GetClassMemberObserver();
+}
+
+void pelet::ParserClass::AddClassObserver(ClassObserverClass* observer) {
+	if (observer) {
+		Observers.ClassObservers.push_back(observer);
+	}
+	ClassObserver = Observers.GetClassObserver();
+}
+
+void pelet::ParserClass::AddFunctionObserver(FunctionObserverClass* observer) {
+	if (observer) {
+		Observers.FunctionObservers.push_back(observer);
+	}
+	FunctionObserver = Observers.GetFunctionObserver();
+}
+
+void pelet::ParserClass::AddVariableObserver(VariableObserverClass* observer) {
+	if (observer) {
+		Observers.VariableObservers.push_back(observer);
+	}
+	VariableObserver = Observers.GetVariableObserver();
+}
+
+void pelet::ParserClass::AddExpressionObserver(ExpressionObserverClass* observer) {
+	if (observer) {
+		Observers.ExpressionObservers.push_back(observer);
+	}
+	ExpressionObserver = Observers.GetExpressionObserver();
 }
 
 bool pelet::ParserClass::LintFile(const std::string& file, LintResultsClass& results) {
@@ -182,6 +575,7 @@ bool pelet::ParserClass::LintFile(const std::string& file, LintResultsClass& res
 		results.LineNumber = Lexer.GetLineNumber();
 		///results.Scope = observers.CurrentScope();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Lexer.Close();
 	}
 	return ret;
@@ -201,6 +595,7 @@ bool pelet::ParserClass::LintFile(FILE* file, const UnicodeString& filename, Lin
 		///results.Scope = observers.CurrentScope();
 		results.LineNumber = Lexer.GetLineNumber();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Lexer.Close();
 	}
 	return ret;
@@ -220,6 +615,7 @@ bool pelet::ParserClass::LintString(const UnicodeString& code, LintResultsClass&
 		///results.Scope = observers.CurrentScope();
 		results.LineNumber = Lexer.GetLineNumber();
 		results.CharacterPosition = Lexer.GetCharacterPosition();
+		ret = CopyErrors(Lexer, results) && ret;
 		Lexer.Close();
 	}
 	return ret;
@@ -312,23 +708,37 @@ void pelet::ParserClass::ParseExpression(UnicodeString expressionString, pelet::
 	}
 	variable.Clear();
 
-	pelet::ParserVariableObserverClass localObserver;
-	pelet::FullParserObserverClass observers(NULL, NULL, NULL, NULL, &localObserver);
-
-	// parse the given expression code snippet
-	// most of the time, the expression observer will NOT be called because 
-	// the expression observer is only called for assignment expressions
-	// but we want this method to be able to parse a single expression
-	if (Lexer.OpenString(expressionString)) {	
-		if (pelet::PHP_53 == Version) {
-			php53parse(Lexer, observers);
+	// most expressions are simple chains, those do not need the full grammar
+	bool isChain = false;
+	if (IsExpressionChain && Lexer.OpenString(expressionString)) {
+		pelet::ScopeClass scope;
+		pelet::VariableClass chain(scope);
+		pelet::ExpressionChainParserClass chainParser(Lexer, Version);
+		isChain = chainParser.Parse(chain);
+		Lexer.Close();
+		if (isChain) {
+			variable.Copy(chain);
 		}
-		else if (pelet::PHP_54 == Version) {
-			php54parse(Lexer, observers);
+	}
+	if (!isChain) {
+		pelet::ParserVariableObserverClass localObserver;
+		pelet::FullParserObserverClass observers(NULL, NULL, NULL, NULL, &localObserver, &Arena);
+
+		// parse the given expression code snippet
+		// most of the time, the expression observer will NOT be called because 
+		// the expression observer is only called for assignment expressions
+		// but we want this method to be able to parse a single expression
+		if (Lexer.OpenString(expressionString)) {	
+			if (pelet::PHP_53 == Version) {
+				php53parse(Lexer, observers);
+			}
+			else if (pelet::PHP_54 == Version) {
+				php54parse(Lexer, observers);
+			}
+			Lexer.Close();
 		}
-		Lexer.Close();
+		variable.Copy(localObserver.Variable);
 	}
-	variable.Copy(localObserver.Variable);
 	if (endsWithObject) {
 		std::vector<pelet::ExpressionClass*> args;
 		variable.AppendToChain(UNICODE_STRING_SIMPLE(""), args, false, false);
@@ -350,7 +760,10 @@ pelet::LintResultsClass::LintResultsClass()
 	, UnicodeFilename()
 	, Scope()
 	, LineNumber(0)
-	, CharacterPosition(0) {
+	, CharacterPosition(0)
+	, Errors()
+	, Bodies()
+	, IsCancelled(false) {
 }
 
 void pelet::LintResultsClass::Copy(const pelet::LintResultsClass& other) {
@@ -360,6 +773,9 @@ void pelet::LintResultsClass::Copy(const pelet::LintResultsClass& other) {
 	Scope = other.Scope;
 	LineNumber = other.LineNumber;
 	CharacterPosition = other.CharacterPosition;
+	Errors = other.Errors;
+	Bodies = other.Bodies;
+	IsCancelled = other.IsCancelled;
 }
 
 void pelet::LintResultsClass::Clear() {
@@ -369,4 +785,7 @@ void pelet::LintResultsClass::Clear() {
 	File = "";
 	LineNumber = 0;
 	CharacterPosition = 0;
+	Errors.clear();
+	Bodies.clear();
+	IsCancelled = false;
 }
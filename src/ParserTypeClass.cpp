@@ -25,6 +25,77 @@
 #include <pelet/ParserTypeClass.h>
 #include <unicode/uchar.h>
 #include <unicode/ustring.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace pelet {
+
+/**
+ * The namespace aliases of a scope. Instances are shared between scopes 
+ * and are deleted when the last scope that references them
+ * lets go of them. The reference count is atomic so that scopes
+ * that are handed to other threads can still be copied safely.
+ */
+class NamespaceAliasesClass {
+
+public:
+
+	NamespaceAliasesClass();
+
+	NamespaceAliasesClass(const pelet::NamespaceAliasesClass& src);
+
+	void AddRef();
+
+	/**
+	 * @return the remaining number of references; when zero the caller must delete
+	 *         this object
+	 */
+	long RemoveRef();
+
+	/**
+	 * @return TRUE if more than one scope references this table
+	 */
+	bool IsShared() const;
+
+	std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass> Aliases;
+
+private:
+
+	volatile long RefCount;
+};
+
+}
+
+pelet::NamespaceAliasesClass::NamespaceAliasesClass()
+	: Aliases()
+	, RefCount(1) {
+}
+
+pelet::NamespaceAliasesClass::NamespaceAliasesClass(const pelet::NamespaceAliasesClass& src)
+	: Aliases(src.Aliases)
+	, RefCount(1) {
+}
+
+void pelet::NamespaceAliasesClass::AddRef() {
+#if defined(__WIN32__) || defined(_WIN32)
+	InterlockedIncrement(&RefCount);
+#else
+	__sync_add_and_fetch(&RefCount, 1);
+#endif
+}
+
+long pelet::NamespaceAliasesClass::RemoveRef() {
+#if defined(__WIN32__) || defined(_WIN32)
+	return InterlockedDecrement(&RefCount);
+#else
+	return __sync_sub_and_fetch(&RefCount, 1);
+#endif
+}
+
+bool pelet::NamespaceAliasesClass::IsShared() const {
+	return RefCount > 1;
+}
 
 UnicodeString pelet::ReturnTypeFromPhpDocComment(const UnicodeString& phpDocComment, bool varAnnotation, 
 												 const pelet::ScopeClass& scope, 
@@ -270,24 +341,56 @@ void pelet::CreateMagicMethodsAndProperties(std::vector<pelet::AstItemClass*>& a
 	delete[] buf;
 }
 
+int pelet::ClassObserverClass::SymbolFields() const {
+	return pelet::SYMBOL_ALL_FIELDS;
+}
+
+int pelet::ClassMemberObserverClass::SymbolFields() const {
+	return pelet::SYMBOL_ALL_FIELDS;
+}
+
+int pelet::FunctionObserverClass::SymbolFields() const {
+	return pelet::SYMBOL_ALL_FIELDS;
+}
+
+int pelet::VariableObserverClass::SymbolFields() const {
+	return pelet::SYMBOL_ALL_FIELDS;
+}
+
 pelet::ExpressionObserverClass::ExpressionObserverClass()
-: Statements() {
+: Statements()
+, Arena() {
 }
 
 pelet::ExpressionObserverClass::~ExpressionObserverClass() {
 	CleanupStatements();
 }
 
+int pelet::ExpressionObserverClass::ExpressionTypes() const {
+	return pelet::EXPRESSION_ALL_TYPES;
+}
+
+int pelet::ExpressionObserverClass::SymbolFields() const {
+	return pelet::SYMBOL_ALL_FIELDS;
+}
+
 void pelet::ExpressionObserverClass::StatementOwnership(std::vector<pelet::AstItemClass*> statements) {
 	CleanupStatements();
 	Statements = statements;
 }
 
+void pelet::ExpressionObserverClass::StatementOwnership(pelet::AstArenaClass& arena) {
+	CleanupStatements();
+	Arena.Swap(arena);
+}
+
 void pelet::ExpressionObserverClass::CleanupStatements() {
 	std::vector<pelet::AstItemClass*>::iterator it;
 	for (it = Statements.begin(); it != Statements.end(); ++it) {
 		delete (*it);
 	}
+	Statements.clear();
+	Arena.Reset();
 }
 
 pelet::AnyExpressionObserverClass::AnyExpressionObserverClass()
@@ -546,6 +649,10 @@ int pelet::FunctionCallCountObserverClass::CountCalls(pelet::StatementListClass*
 	return Counter;
 }
 		
+int pelet::FunctionCallCountObserverClass::ExpressionTypes() const {
+	return pelet::EXPRESSION_ALL_TYPES & ~pelet::EXPRESSION_TYPE_SCALAR;
+}
+
 void pelet::FunctionCallCountObserverClass::OnAnyExpression(pelet::ExpressionClass* expression) {
 	if (expression->ExpressionType != pelet::ExpressionClass::VARIABLE) {
 		return;
@@ -583,6 +690,23 @@ pelet::AstItemClass::~AstItemClass() {
 
 }
 
+void* pelet::AstItemClass::operator new(size_t size) {
+	return ::operator new(size);
+}
+
+void* pelet::AstItemClass::operator new(size_t size, pelet::AstArenaClass& arena) {
+	return arena.Allocate(size);
+}
+
+void pelet::AstItemClass::operator delete(void* ptr) {
+	::operator delete(ptr);
+}
+
+void pelet::AstItemClass::operator delete(void* ptr, pelet::AstArenaClass& arena) {
+	
+	// nothing to do; arena memory is released by AstArenaClass::Reset()
+}
+
 pelet::ConstantStatementClass::ConstantStatementClass()
 	: StatementClass(pelet::StatementClass::DEFINE_DECLARATION)
 	, Name()
@@ -995,6 +1119,7 @@ pelet::ClassMemberSymbolClass::ClassMemberSymbolClass()
 	, Comment()
 	, ReturnType()
 	, StartingLineNumber(0)
+	, StartingPosition(0)
 	, EndingPosition(0)
 
 	// PHP default access mode is TRUE
@@ -1328,7 +1453,8 @@ pelet::QualifiedNameClass::QualifiedNameClass()
 	, IsAbsolute(false)
 	, LineNumber(0)
 	, Pos(0)
-	, Namespaces() {
+	, Names()
+	, NameCount(0) {
 
 }
 
@@ -1344,7 +1470,8 @@ void pelet::QualifiedNameClass::Init(SemanticValueClass* value) {
 }
 
 void pelet::QualifiedNameClass::Clear() {
-	Namespaces.clear();
+	Names.remove();
+	NameCount = 0;
 	IsAbsolute = false;
 	LineNumber = 0;
 	Pos = 0;
@@ -1352,15 +1479,19 @@ void pelet::QualifiedNameClass::Clear() {
 
 pelet::QualifiedNameClass* pelet::QualifiedNameClass::AppendName(SemanticValueClass* value) {
 	if (value) {
-		UnicodeString name = value->Lexeme;
-		if (Namespaces.empty() && value) {
+		if (0 == NameCount) {
 			IsAbsolute = value->Lexeme.indexOf(UNICODE_STRING_SIMPLE("\\")) == 0;
 			if (IsAbsolute) {
-				name.remove();
-				value->Lexeme.extract(1, value->Lexeme.length() - 1, name);
+				Names.append(value->Lexeme, 1, value->Lexeme.length() - 1);
 			}
+			else {
+				Names.append(value->Lexeme);
+			}
+		}
+		else {
+			Names.append(UNICODE_STRING_SIMPLE("\\")).append(value->Lexeme);
 		}
-		Namespaces.push_back(name);
+		NameCount++;
 	}
 	return this;
 }
@@ -1371,7 +1502,13 @@ pelet::QualifiedNameClass* pelet::QualifiedNameClass::MakeAbsolute() {
 }
 
 void pelet::QualifiedNameClass::PrependNamespace(const QualifiedNameClass& name) {
-	Namespaces.insert(Namespaces.begin(), name.Namespaces.begin(), name.Namespaces.end());
+	if (name.NameCount > 0 && NameCount > 0) {
+		Names.insert(0, UNICODE_STRING_SIMPLE("\\")).insert(0, name.Names);
+	}
+	else if (name.NameCount > 0) {
+		Names = name.Names;
+	}
+	NameCount += name.NameCount;
 	
 	// if we prepend an absolute namespace then this namespace becomes absolute
 	IsAbsolute = name.IsAbsolute;
@@ -1382,19 +1519,16 @@ UnicodeString pelet::QualifiedNameClass::ToSignature() const {
 	if (IsAbsolute) {
 		ret.append(UNICODE_STRING_SIMPLE("\\"));
 	}
-	
-	std::vector<UnicodeString>::const_iterator nm;
-	for (nm = Namespaces.begin(); nm != Namespaces.end(); ++nm) {
-		if (Namespaces.begin() != nm) {
-			ret.append(UNICODE_STRING_SIMPLE("\\"));
-		}
-		ret.append(*nm);
-	}
+	ret.append(Names);
 	return ret;
 }
 
 void pelet::QualifiedNameClass::Init(const UnicodeString& name, int lineNumber, int pos) {
-	Namespaces.push_back(name);
+	if (NameCount > 0) {
+		Names.append(UNICODE_STRING_SIMPLE("\\"));
+	}
+	Names.append(name);
+	NameCount++;
 	LineNumber = lineNumber;
 	Pos = pos;
 }
@@ -1402,11 +1536,26 @@ void pelet::QualifiedNameClass::Init(const UnicodeString& name, int lineNumber,
 pelet::QualifiedNameClass* pelet::QualifiedNameClass::MakeFromDeclaredNamespace(const pelet::QualifiedNameClass* currentNamespace) {
 	if (currentNamespace) {
 		IsAbsolute = currentNamespace->IsAbsolute;
-		Namespaces = currentNamespace->Namespaces;
+		Names = currentNamespace->Names;
+		NameCount = currentNamespace->NameCount;
 	}
 	return this;
 }
 
+pelet::BodyRangeClass::BodyRangeClass()
+	: Scope()
+	, DeclaredNamespace()
+	, StartPos(0)
+	, EndPos(0)
+	, LineNumber(0)
+	, Condition(pelet::yycSCRIPT) {
+		
+}
+
+bool pelet::BodyRangeClass::Contains(int pos) const {
+	return pos >= StartPos && pos <= EndPos;
+}
+
 pelet::ParametersListClass::ParametersListClass()
 	: Params()
 	, OptionalTypes() 
@@ -2074,9 +2223,7 @@ pelet::ScopeClass::ScopeClass()
 }
 
 pelet::ScopeClass::~ScopeClass() {
-	if (NamespaceAliases) {
-		delete NamespaceAliases;
-	}
+	ReleaseAliases();
 }
 
 
@@ -2094,30 +2241,33 @@ void pelet::ScopeClass::Clear() {
 	NamespaceName.remove();
 	ClassName.remove();
 	MethodName.remove();
-	if (NamespaceAliases) {
-		NamespaceAliases->clear();
-	}
+	ReleaseAliases();
 	AnonymousFunctionCount = -1;
 }
 
 void pelet::ScopeClass::ClearAliases() {
-	if (NamespaceAliases) {
-		NamespaceAliases->clear();
+	ReleaseAliases();
+}
+
+void pelet::ScopeClass::ReleaseAliases() {
+	if (NamespaceAliases && NamespaceAliases->RemoveRef() == 0) {
+		delete NamespaceAliases;
 	}
+	NamespaceAliases = NULL;
 }
 
 void pelet::ScopeClass::Copy(const pelet::ScopeClass& src) {
 	NamespaceName = src.NamespaceName;
 	ClassName = src.ClassName;
 	MethodName = src.MethodName;
-	if (!NamespaceAliases && src.NamespaceAliases) {
-		NamespaceAliases = new std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass>(*src.NamespaceAliases);
-	}
-	else if (NamespaceAliases && !src.NamespaceAliases) {
-		NamespaceAliases->clear();
-	}
-	else if (NamespaceAliases && src.NamespaceAliases) {
-		*NamespaceAliases = *src.NamespaceAliases;
+	if (NamespaceAliases != src.NamespaceAliases) {
+
+		// share the alias table, it is only copied when it is modified
+		ReleaseAliases();
+		NamespaceAliases = src.NamespaceAliases;
+		if (NamespaceAliases) {
+			NamespaceAliases->AddRef();
+		}
 	}
 	AnonymousFunctionCount = src.AnonymousFunctionCount;
 }
@@ -2140,7 +2290,14 @@ bool pelet::ScopeClass::IsAnonymousScope() const {
 
 void pelet::ScopeClass::AddNamespaceAlias(const UnicodeString& namespaceName, const UnicodeString& namespaceAlias) {
 	if (!NamespaceAliases) {
-		NamespaceAliases = new std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass>();
+		NamespaceAliases = new pelet::NamespaceAliasesClass;
+	}
+	else if (NamespaceAliases->IsShared()) {
+		
+		// other scopes see the current aliases, copy before writing
+		pelet::NamespaceAliasesClass* aliases = new pelet::NamespaceAliasesClass(*NamespaceAliases);
+		ReleaseAliases();
+		NamespaceAliases = aliases;
 	}
 	
 	// a namespace alias is always fully qualified
@@ -2150,14 +2307,14 @@ void pelet::ScopeClass::AddNamespaceAlias(const UnicodeString& namespaceName, co
 		fullyQualified.append(UNICODE_STRING_SIMPLE("\\"));
 	}
 	fullyQualified.append(namespaceName);
-	(*NamespaceAliases)[namespaceAlias] = fullyQualified;
+	NamespaceAliases->Aliases[namespaceAlias] = fullyQualified;
 }
 
 UnicodeString pelet::ScopeClass::ResolveAlias(const UnicodeString& alias) const {
 	UnicodeString fullName;
 	if (NamespaceAliases) {
-		std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass>::const_iterator it = NamespaceAliases->find(alias);
-		if (it != NamespaceAliases->end()) {
+		std::map<UnicodeString, UnicodeString, UnicodeStringComparatorClass>::const_iterator it = NamespaceAliases->Aliases.find(alias);
+		if (it != NamespaceAliases->Aliases.end()) {
 			fullName = it->second;
 		}
 	}
@@ -2167,7 +2324,7 @@ UnicodeString pelet::ScopeClass::ResolveAlias(const UnicodeString& alias) const
 std::map<UnicodeString, UnicodeString, pelet::UnicodeStringComparatorClass> pelet::ScopeClass::GetNamespaceAliases() const {
 	std::map<UnicodeString, UnicodeString, pelet::UnicodeStringComparatorClass> map;
 	if (NamespaceAliases) {
-		map.insert(NamespaceAliases->begin(), NamespaceAliases->end());
+		map.insert(NamespaceAliases->Aliases.begin(), NamespaceAliases->Aliases.end());
 	}
 	return map;
 }
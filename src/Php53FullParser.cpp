@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -53,28 +58,28 @@
 #define YYPURE 1
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
+/* Substitute the type names.  */
+#define YYSTYPE         PHP53STYPE
 /* Substitute the variable and function names.  */
 #define yyparse         php53parse
+#define yypush_parse    php53push_parse
+#define yypull_parse    php53pull_parse
+#define yypstate_new    php53pstate_new
+#define yypstate_clear  php53pstate_clear
+#define yypstate_delete php53pstate_delete
+#define yypstate        php53pstate
 #define yylex           php53lex
 #define yyerror         php53error
-#define yylval          php53lval
-#define yychar          php53char
 #define yydebug         php53debug
 #define yynerrs         php53nerrs
 
-
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
-#line 1 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
+/* First part of user prologue.  */
+#line 1 "/root/repo/src/Php53FullParser.y"
 
 	
 /**
@@ -108,7 +113,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ParserType
+#define PHP53STYPE pelet::ParserType
 
 // all PHP parsers will use same lex function
 #define php53lex pelet::FullLex
@@ -117,205 +122,573 @@
 #define php53error pelet::FullGrammarError
 
 
+#line 126 "/root/repo/src/Php53FullParser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Line 268 of yacc.c  */
-#line 123 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.cpp"
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
+/* Debug traces.  */
+#ifndef PHP53DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define PHP53DEBUG 1
+#  else
+#   define PHP53DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define PHP53DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined PHP53DEBUG */
+#if PHP53DEBUG
+extern int php53debug;
 #endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
+/* Token kinds.  */
+#ifndef PHP53TOKENTYPE
+# define PHP53TOKENTYPE
+  enum php53tokentype
+  {
+    PHP53EMPTY = -2,
+    PHP53EOF = 0,                  /* "end of file"  */
+    PHP53error = 256,              /* error  */
+    PHP53UNDEF = 629,              /* "invalid token"  */
+    T_ABSTRACT = 502,              /* T_ABSTRACT  */
+    T_AND_EQUAL = 503,             /* T_AND_EQUAL  */
+    T_ARRAY = 504,                 /* T_ARRAY  */
+    T_ARRAY_CAST = 505,            /* T_ARRAY_CAST  */
+    T_AS = 506,                    /* T_AS  */
+    T_BAD_CHARACTER = 507,         /* T_BAD_CHARACTER  */
+    T_BOOL_CAST = 508,             /* T_BOOL_CAST  */
+    T_BOOLEAN_AND = 509,           /* T_BOOLEAN_AND  */
+    T_BOOLEAN_OR = 510,            /* T_BOOLEAN_OR  */
+    T_BREAK = 511,                 /* T_BREAK  */
+    T_CASE = 513,                  /* T_CASE  */
+    T_CATCH = 514,                 /* T_CATCH  */
+    T_CHARACTER = 515,             /* T_CHARACTER  */
+    T_CLASS = 516,                 /* T_CLASS  */
+    T_CLASS_C = 517,               /* T_CLASS_C  */
+    T_CLONE = 518,                 /* T_CLONE  */
+    T_CLOSE_TAG = 519,             /* T_CLOSE_TAG  */
+    T_COMMENT = 520,               /* T_COMMENT  */
+    T_CONCAT_EQUAL = 521,          /* T_CONCAT_EQUAL  */
+    T_CONST = 522,                 /* T_CONST  */
+    T_CONSTANT_ENCAPSED_STRING = 523, /* T_CONSTANT_ENCAPSED_STRING  */
+    T_CONTINUE = 524,              /* T_CONTINUE  */
+    T_CURLY_OPEN = 525,            /* T_CURLY_OPEN  */
+    T_DEC = 526,                   /* T_DEC  */
+    T_DECLARE = 527,               /* T_DECLARE  */
+    T_DEFAULT = 528,               /* T_DEFAULT  */
+    T_DIR = 529,                   /* T_DIR  */
+    T_DIV_EQUAL = 530,             /* T_DIV_EQUAL  */
+    T_DNUMBER = 531,               /* T_DNUMBER  */
+    T_DO = 532,                    /* T_DO  */
+    T_DOC_COMMENT = 533,           /* T_DOC_COMMENT  */
+    T_DOLLAR_OPEN_CURLY_BRACES = 534, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+    T_DOUBLE_ARROW = 535,          /* T_DOUBLE_ARROW  */
+    T_DOUBLE_CAST = 536,           /* T_DOUBLE_CAST  */
+    T_ECHO = 537,                  /* T_ECHO  */
+    T_ELSE = 538,                  /* T_ELSE  */
+    T_ELSEIF = 539,                /* T_ELSEIF  */
+    T_EMPTY = 540,                 /* T_EMPTY  */
+    T_ENCAPSED_AND_WHITESPACE = 541, /* T_ENCAPSED_AND_WHITESPACE  */
+    T_ENDDECLARE = 542,            /* T_ENDDECLARE  */
+    T_ENDFOR = 543,                /* T_ENDFOR  */
+    T_ENDFOREACH = 544,            /* T_ENDFOREACH  */
+    T_END_HEREDOC = 545,           /* T_END_HEREDOC  */
+    T_ENDIF = 546,                 /* T_ENDIF  */
+    T_ENDSWITCH = 547,             /* T_ENDSWITCH  */
+    T_ENDWHILE = 548,              /* T_ENDWHILE  */
+    T_EVAL = 549,                  /* T_EVAL  */
+    T_EXIT = 550,                  /* T_EXIT  */
+    T_EXTENDS = 551,               /* T_EXTENDS  */
+    T_FILE = 552,                  /* T_FILE  */
+    T_FINAL = 553,                 /* T_FINAL  */
+    T_FOR = 554,                   /* T_FOR  */
+    T_FOREACH = 555,               /* T_FOREACH  */
+    T_FUNC_C = 556,                /* T_FUNC_C  */
+    T_FUNCTION = 557,              /* T_FUNCTION  */
+    T_GLOBAL = 558,                /* T_GLOBAL  */
+    T_GOTO = 559,                  /* T_GOTO  */
+    T_HALT_COMPILER = 560,         /* T_HALT_COMPILER  */
+    T_IF = 561,                    /* T_IF  */
+    T_IMPLEMENTS = 562,            /* T_IMPLEMENTS  */
+    T_INC = 563,                   /* T_INC  */
+    T_INCLUDE = 564,               /* T_INCLUDE  */
+    T_INCLUDE_ONCE = 565,          /* T_INCLUDE_ONCE  */
+    T_INLINE_HTML = 566,           /* T_INLINE_HTML  */
+    T_INSTANCEOF = 567,            /* T_INSTANCEOF  */
+    T_INT_CAST = 569,              /* T_INT_CAST  */
+    T_INTERFACE = 570,             /* T_INTERFACE  */
+    T_IS_EQUAL = 571,              /* T_IS_EQUAL  */
+    T_IS_GREATER_OR_EQUAL = 572,   /* T_IS_GREATER_OR_EQUAL  */
+    T_IS_IDENTICAL = 573,          /* T_IS_IDENTICAL  */
+    T_IS_NOT_EQUAL = 574,          /* T_IS_NOT_EQUAL  */
+    T_IS_NOT_IDENTICAL = 575,      /* T_IS_NOT_IDENTICAL  */
+    T_ISSET = 576,                 /* T_ISSET  */
+    T_IS_SMALLER_OR_EQUAL = 577,   /* T_IS_SMALLER_OR_EQUAL  */
+    T_LINE = 578,                  /* T_LINE  */
+    T_LIST = 579,                  /* T_LIST  */
+    T_LNUMBER = 580,               /* T_LNUMBER  */
+    T_LOGICAL_AND = 581,           /* T_LOGICAL_AND  */
+    T_LOGICAL_OR = 582,            /* T_LOGICAL_OR  */
+    T_LOGICAL_XOR = 583,           /* T_LOGICAL_XOR  */
+    T_METHOD_C = 584,              /* T_METHOD_C  */
+    T_MINUS_EQUAL = 585,           /* T_MINUS_EQUAL  */
+    T_MOD_EQUAL = 586,             /* T_MOD_EQUAL  */
+    T_MUL_EQUAL = 587,             /* T_MUL_EQUAL  */
+    T_NAMESPACE = 588,             /* T_NAMESPACE  */
+    T_NEW = 589,                   /* T_NEW  */
+    T_NS_C = 590,                  /* T_NS_C  */
+    T_NS_SEPARATOR = 591,          /* T_NS_SEPARATOR  */
+    T_NUM_STRING = 592,            /* T_NUM_STRING  */
+    T_OBJECT_CAST = 593,           /* T_OBJECT_CAST  */
+    T_OBJECT_OPERATOR = 594,       /* T_OBJECT_OPERATOR  */
+    T_OPEN_TAG = 595,              /* T_OPEN_TAG  */
+    T_OPEN_TAG_WITH_ECHO = 596,    /* T_OPEN_TAG_WITH_ECHO  */
+    T_OR_EQUAL = 597,              /* T_OR_EQUAL  */
+    T_PAAMAYIM_NEKUDOTAYIM = 598,  /* T_PAAMAYIM_NEKUDOTAYIM  */
+    T_PLUS_EQUAL = 599,            /* T_PLUS_EQUAL  */
+    T_PRINT = 600,                 /* T_PRINT  */
+    T_PRIVATE = 601,               /* T_PRIVATE  */
+    T_PROTECTED = 602,             /* T_PROTECTED  */
+    T_PUBLIC = 603,                /* T_PUBLIC  */
+    T_REQUIRE = 604,               /* T_REQUIRE  */
+    T_REQUIRE_ONCE = 605,          /* T_REQUIRE_ONCE  */
+    T_RETURN = 606,                /* T_RETURN  */
+    T_SL = 607,                    /* T_SL  */
+    T_SL_EQUAL = 608,              /* T_SL_EQUAL  */
+    T_SR = 609,                    /* T_SR  */
+    T_SR_EQUAL = 610,              /* T_SR_EQUAL  */
+    T_START_HEREDOC = 611,         /* T_START_HEREDOC  */
+    T_STATIC = 612,                /* T_STATIC  */
+    T_STRING = 613,                /* T_STRING  */
+    T_STRING_CAST = 614,           /* T_STRING_CAST  */
+    T_STRING_VARNAME = 615,        /* T_STRING_VARNAME  */
+    T_SWITCH = 616,                /* T_SWITCH  */
+    T_THROW = 617,                 /* T_THROW  */
+    T_TRY = 620,                   /* T_TRY  */
+    T_UNSET = 621,                 /* T_UNSET  */
+    T_UNSET_CAST = 622,            /* T_UNSET_CAST  */
+    T_USE = 623,                   /* T_USE  */
+    T_VAR = 624,                   /* T_VAR  */
+    T_VARIABLE = 625,              /* T_VARIABLE  */
+    T_WHILE = 626,                 /* T_WHILE  */
+    T_WHITESPACE = 627,            /* T_WHITESPACE  */
+    T_XOR_EQUAL = 628              /* T_XOR_EQUAL  */
+  };
+  typedef enum php53tokentype php53token_kind_t;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+/* Value type.  */
 
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_REQUIRE_ONCE = 605,
-     T_REQUIRE = 604,
-     T_EVAL = 549,
-     T_INCLUDE_ONCE = 565,
-     T_INCLUDE = 564,
-     T_LOGICAL_OR = 582,
-     T_LOGICAL_XOR = 583,
-     T_LOGICAL_AND = 581,
-     T_PRINT = 600,
-     T_SR_EQUAL = 610,
-     T_SL_EQUAL = 608,
-     T_XOR_EQUAL = 628,
-     T_OR_EQUAL = 597,
-     T_AND_EQUAL = 503,
-     T_MOD_EQUAL = 586,
-     T_CONCAT_EQUAL = 521,
-     T_DIV_EQUAL = 530,
-     T_MUL_EQUAL = 587,
-     T_MINUS_EQUAL = 585,
-     T_PLUS_EQUAL = 599,
-     T_BOOLEAN_OR = 510,
-     T_BOOLEAN_AND = 509,
-     T_IS_NOT_IDENTICAL = 575,
-     T_IS_IDENTICAL = 573,
-     T_IS_NOT_EQUAL = 574,
-     T_IS_EQUAL = 571,
-     T_IS_GREATER_OR_EQUAL = 572,
-     T_IS_SMALLER_OR_EQUAL = 577,
-     T_SR = 609,
-     T_SL = 607,
-     T_INSTANCEOF = 567,
-     T_UNSET_CAST = 622,
-     T_BOOL_CAST = 508,
-     T_OBJECT_CAST = 593,
-     T_ARRAY_CAST = 505,
-     T_STRING_CAST = 614,
-     T_DOUBLE_CAST = 536,
-     T_INT_CAST = 569,
-     T_DEC = 526,
-     T_INC = 563,
-     T_CLONE = 518,
-     T_NEW = 589,
-     T_ELSEIF = 539,
-     T_ELSE = 538,
-     T_ENDIF = 546,
-     T_PUBLIC = 603,
-     T_PROTECTED = 602,
-     T_PRIVATE = 601,
-     T_FINAL = 553,
-     T_ABSTRACT = 502,
-     T_STATIC = 612,
-     T_ARRAY = 504,
-     T_AS = 506,
-     T_BAD_CHARACTER = 507,
-     T_BREAK = 511,
-     T_CASE = 513,
-     T_CATCH = 514,
-     T_CHARACTER = 515,
-     T_CLASS = 516,
-     T_CLASS_C = 517,
-     T_CLOSE_TAG = 519,
-     T_COMMENT = 520,
-     T_CONST = 522,
-     T_CONSTANT_ENCAPSED_STRING = 523,
-     T_CONTINUE = 524,
-     T_CURLY_OPEN = 525,
-     T_DECLARE = 527,
-     T_DEFAULT = 528,
-     T_DIR = 529,
-     T_DNUMBER = 531,
-     T_DO = 532,
-     T_DOC_COMMENT = 533,
-     T_DOLLAR_OPEN_CURLY_BRACES = 534,
-     T_DOUBLE_ARROW = 535,
-     T_ECHO = 537,
-     T_EMPTY = 540,
-     T_ENCAPSED_AND_WHITESPACE = 541,
-     T_ENDDECLARE = 542,
-     T_ENDFOR = 543,
-     T_ENDFOREACH = 544,
-     T_END_HEREDOC = 545,
-     T_ENDSWITCH = 547,
-     T_ENDWHILE = 548,
-     T_EXIT = 550,
-     T_EXTENDS = 551,
-     T_FILE = 552,
-     T_FOR = 554,
-     T_FOREACH = 555,
-     T_FUNC_C = 556,
-     T_FUNCTION = 557,
-     T_GLOBAL = 558,
-     T_GOTO = 559,
-     T_HALT_COMPILER = 560,
-     T_IF = 561,
-     T_IMPLEMENTS = 562,
-     T_INLINE_HTML = 566,
-     T_INTERFACE = 570,
-     T_ISSET = 576,
-     T_LINE = 578,
-     T_LIST = 579,
-     T_LNUMBER = 580,
-     T_METHOD_C = 584,
-     T_NAMESPACE = 588,
-     T_NS_C = 590,
-     T_NS_SEPARATOR = 591,
-     T_NUM_STRING = 592,
-     T_OBJECT_OPERATOR = 594,
-     T_OPEN_TAG = 595,
-     T_OPEN_TAG_WITH_ECHO = 596,
-     T_PAAMAYIM_NEKUDOTAYIM = 598,
-     T_RETURN = 606,
-     T_START_HEREDOC = 611,
-     T_STRING = 613,
-     T_STRING_VARNAME = 615,
-     T_SWITCH = 616,
-     T_THROW = 617,
-     T_TRY = 620,
-     T_UNSET = 621,
-     T_USE = 623,
-     T_VAR = 624,
-     T_VARIABLE = 625,
-     T_WHILE = 626,
-     T_WHITESPACE = 627
-   };
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
 #endif
 
+typedef struct php53pstate php53pstate;
 
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+int php53parse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+int php53push_parse (php53pstate *ps,
+                  int pushed_char, PHP53STYPE const *pushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+int php53pull_parse (php53pstate *ps, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+php53pstate *php53pstate_new (void);
+void php53pstate_delete (php53pstate *ps);
+
 
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ','  */
+  YYSYMBOL_4_ = 4,                         /* '='  */
+  YYSYMBOL_5_ = 5,                         /* '?'  */
+  YYSYMBOL_6_ = 6,                         /* ':'  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_12_ = 12,                       /* '+'  */
+  YYSYMBOL_13_ = 13,                       /* '-'  */
+  YYSYMBOL_14_ = 14,                       /* '.'  */
+  YYSYMBOL_15_ = 15,                       /* '*'  */
+  YYSYMBOL_16_ = 16,                       /* '/'  */
+  YYSYMBOL_17_ = 17,                       /* '%'  */
+  YYSYMBOL_18_ = 18,                       /* '!'  */
+  YYSYMBOL_19_ = 19,                       /* '~'  */
+  YYSYMBOL_20_ = 20,                       /* '@'  */
+  YYSYMBOL_21_ = 21,                       /* '['  */
+  YYSYMBOL_T_ABSTRACT = 22,                /* T_ABSTRACT  */
+  YYSYMBOL_T_AND_EQUAL = 23,               /* T_AND_EQUAL  */
+  YYSYMBOL_T_ARRAY = 24,                   /* T_ARRAY  */
+  YYSYMBOL_T_ARRAY_CAST = 25,              /* T_ARRAY_CAST  */
+  YYSYMBOL_T_AS = 26,                      /* T_AS  */
+  YYSYMBOL_T_BAD_CHARACTER = 27,           /* T_BAD_CHARACTER  */
+  YYSYMBOL_T_BOOL_CAST = 28,               /* T_BOOL_CAST  */
+  YYSYMBOL_T_BOOLEAN_AND = 29,             /* T_BOOLEAN_AND  */
+  YYSYMBOL_T_BOOLEAN_OR = 30,              /* T_BOOLEAN_OR  */
+  YYSYMBOL_T_BREAK = 31,                   /* T_BREAK  */
+  YYSYMBOL_T_CASE = 32,                    /* T_CASE  */
+  YYSYMBOL_T_CATCH = 33,                   /* T_CATCH  */
+  YYSYMBOL_T_CHARACTER = 34,               /* T_CHARACTER  */
+  YYSYMBOL_T_CLASS = 35,                   /* T_CLASS  */
+  YYSYMBOL_T_CLASS_C = 36,                 /* T_CLASS_C  */
+  YYSYMBOL_T_CLONE = 37,                   /* T_CLONE  */
+  YYSYMBOL_T_CLOSE_TAG = 38,               /* T_CLOSE_TAG  */
+  YYSYMBOL_T_COMMENT = 39,                 /* T_COMMENT  */
+  YYSYMBOL_T_CONCAT_EQUAL = 40,            /* T_CONCAT_EQUAL  */
+  YYSYMBOL_T_CONST = 41,                   /* T_CONST  */
+  YYSYMBOL_T_CONSTANT_ENCAPSED_STRING = 42, /* T_CONSTANT_ENCAPSED_STRING  */
+  YYSYMBOL_T_CONTINUE = 43,                /* T_CONTINUE  */
+  YYSYMBOL_T_CURLY_OPEN = 44,              /* T_CURLY_OPEN  */
+  YYSYMBOL_T_DEC = 45,                     /* T_DEC  */
+  YYSYMBOL_T_DECLARE = 46,                 /* T_DECLARE  */
+  YYSYMBOL_T_DEFAULT = 47,                 /* T_DEFAULT  */
+  YYSYMBOL_T_DIR = 48,                     /* T_DIR  */
+  YYSYMBOL_T_DIV_EQUAL = 49,               /* T_DIV_EQUAL  */
+  YYSYMBOL_T_DNUMBER = 50,                 /* T_DNUMBER  */
+  YYSYMBOL_T_DO = 51,                      /* T_DO  */
+  YYSYMBOL_T_DOC_COMMENT = 52,             /* T_DOC_COMMENT  */
+  YYSYMBOL_T_DOLLAR_OPEN_CURLY_BRACES = 53, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+  YYSYMBOL_T_DOUBLE_ARROW = 54,            /* T_DOUBLE_ARROW  */
+  YYSYMBOL_T_DOUBLE_CAST = 55,             /* T_DOUBLE_CAST  */
+  YYSYMBOL_T_ECHO = 56,                    /* T_ECHO  */
+  YYSYMBOL_T_ELSE = 57,                    /* T_ELSE  */
+  YYSYMBOL_T_ELSEIF = 58,                  /* T_ELSEIF  */
+  YYSYMBOL_T_EMPTY = 59,                   /* T_EMPTY  */
+  YYSYMBOL_T_ENCAPSED_AND_WHITESPACE = 60, /* T_ENCAPSED_AND_WHITESPACE  */
+  YYSYMBOL_T_ENDDECLARE = 61,              /* T_ENDDECLARE  */
+  YYSYMBOL_T_ENDFOR = 62,                  /* T_ENDFOR  */
+  YYSYMBOL_T_ENDFOREACH = 63,              /* T_ENDFOREACH  */
+  YYSYMBOL_T_END_HEREDOC = 64,             /* T_END_HEREDOC  */
+  YYSYMBOL_T_ENDIF = 65,                   /* T_ENDIF  */
+  YYSYMBOL_T_ENDSWITCH = 66,               /* T_ENDSWITCH  */
+  YYSYMBOL_T_ENDWHILE = 67,                /* T_ENDWHILE  */
+  YYSYMBOL_T_EVAL = 68,                    /* T_EVAL  */
+  YYSYMBOL_T_EXIT = 69,                    /* T_EXIT  */
+  YYSYMBOL_T_EXTENDS = 70,                 /* T_EXTENDS  */
+  YYSYMBOL_T_FILE = 71,                    /* T_FILE  */
+  YYSYMBOL_T_FINAL = 72,                   /* T_FINAL  */
+  YYSYMBOL_T_FOR = 73,                     /* T_FOR  */
+  YYSYMBOL_T_FOREACH = 74,                 /* T_FOREACH  */
+  YYSYMBOL_T_FUNC_C = 75,                  /* T_FUNC_C  */
+  YYSYMBOL_T_FUNCTION = 76,                /* T_FUNCTION  */
+  YYSYMBOL_T_GLOBAL = 77,                  /* T_GLOBAL  */
+  YYSYMBOL_T_GOTO = 78,                    /* T_GOTO  */
+  YYSYMBOL_T_HALT_COMPILER = 79,           /* T_HALT_COMPILER  */
+  YYSYMBOL_T_IF = 80,                      /* T_IF  */
+  YYSYMBOL_T_IMPLEMENTS = 81,              /* T_IMPLEMENTS  */
+  YYSYMBOL_T_INC = 82,                     /* T_INC  */
+  YYSYMBOL_T_INCLUDE = 83,                 /* T_INCLUDE  */
+  YYSYMBOL_T_INCLUDE_ONCE = 84,            /* T_INCLUDE_ONCE  */
+  YYSYMBOL_T_INLINE_HTML = 85,             /* T_INLINE_HTML  */
+  YYSYMBOL_T_INSTANCEOF = 86,              /* T_INSTANCEOF  */
+  YYSYMBOL_T_INT_CAST = 87,                /* T_INT_CAST  */
+  YYSYMBOL_T_INTERFACE = 88,               /* T_INTERFACE  */
+  YYSYMBOL_T_IS_EQUAL = 89,                /* T_IS_EQUAL  */
+  YYSYMBOL_T_IS_GREATER_OR_EQUAL = 90,     /* T_IS_GREATER_OR_EQUAL  */
+  YYSYMBOL_T_IS_IDENTICAL = 91,            /* T_IS_IDENTICAL  */
+  YYSYMBOL_T_IS_NOT_EQUAL = 92,            /* T_IS_NOT_EQUAL  */
+  YYSYMBOL_T_IS_NOT_IDENTICAL = 93,        /* T_IS_NOT_IDENTICAL  */
+  YYSYMBOL_T_ISSET = 94,                   /* T_ISSET  */
+  YYSYMBOL_T_IS_SMALLER_OR_EQUAL = 95,     /* T_IS_SMALLER_OR_EQUAL  */
+  YYSYMBOL_T_LINE = 96,                    /* T_LINE  */
+  YYSYMBOL_T_LIST = 97,                    /* T_LIST  */
+  YYSYMBOL_T_LNUMBER = 98,                 /* T_LNUMBER  */
+  YYSYMBOL_T_LOGICAL_AND = 99,             /* T_LOGICAL_AND  */
+  YYSYMBOL_T_LOGICAL_OR = 100,             /* T_LOGICAL_OR  */
+  YYSYMBOL_T_LOGICAL_XOR = 101,            /* T_LOGICAL_XOR  */
+  YYSYMBOL_T_METHOD_C = 102,               /* T_METHOD_C  */
+  YYSYMBOL_T_MINUS_EQUAL = 103,            /* T_MINUS_EQUAL  */
+  YYSYMBOL_T_MOD_EQUAL = 104,              /* T_MOD_EQUAL  */
+  YYSYMBOL_T_MUL_EQUAL = 105,              /* T_MUL_EQUAL  */
+  YYSYMBOL_T_NAMESPACE = 106,              /* T_NAMESPACE  */
+  YYSYMBOL_T_NEW = 107,                    /* T_NEW  */
+  YYSYMBOL_T_NS_C = 108,                   /* T_NS_C  */
+  YYSYMBOL_T_NS_SEPARATOR = 109,           /* T_NS_SEPARATOR  */
+  YYSYMBOL_T_NUM_STRING = 110,             /* T_NUM_STRING  */
+  YYSYMBOL_T_OBJECT_CAST = 111,            /* T_OBJECT_CAST  */
+  YYSYMBOL_T_OBJECT_OPERATOR = 112,        /* T_OBJECT_OPERATOR  */
+  YYSYMBOL_T_OPEN_TAG = 113,               /* T_OPEN_TAG  */
+  YYSYMBOL_T_OPEN_TAG_WITH_ECHO = 114,     /* T_OPEN_TAG_WITH_ECHO  */
+  YYSYMBOL_T_OR_EQUAL = 115,               /* T_OR_EQUAL  */
+  YYSYMBOL_T_PAAMAYIM_NEKUDOTAYIM = 116,   /* T_PAAMAYIM_NEKUDOTAYIM  */
+  YYSYMBOL_T_PLUS_EQUAL = 117,             /* T_PLUS_EQUAL  */
+  YYSYMBOL_T_PRINT = 118,                  /* T_PRINT  */
+  YYSYMBOL_T_PRIVATE = 119,                /* T_PRIVATE  */
+  YYSYMBOL_T_PROTECTED = 120,              /* T_PROTECTED  */
+  YYSYMBOL_T_PUBLIC = 121,                 /* T_PUBLIC  */
+  YYSYMBOL_T_REQUIRE = 122,                /* T_REQUIRE  */
+  YYSYMBOL_T_REQUIRE_ONCE = 123,           /* T_REQUIRE_ONCE  */
+  YYSYMBOL_T_RETURN = 124,                 /* T_RETURN  */
+  YYSYMBOL_T_SL = 125,                     /* T_SL  */
+  YYSYMBOL_T_SL_EQUAL = 126,               /* T_SL_EQUAL  */
+  YYSYMBOL_T_SR = 127,                     /* T_SR  */
+  YYSYMBOL_T_SR_EQUAL = 128,               /* T_SR_EQUAL  */
+  YYSYMBOL_T_START_HEREDOC = 129,          /* T_START_HEREDOC  */
+  YYSYMBOL_T_STATIC = 130,                 /* T_STATIC  */
+  YYSYMBOL_T_STRING = 131,                 /* T_STRING  */
+  YYSYMBOL_T_STRING_CAST = 132,            /* T_STRING_CAST  */
+  YYSYMBOL_T_STRING_VARNAME = 133,         /* T_STRING_VARNAME  */
+  YYSYMBOL_T_SWITCH = 134,                 /* T_SWITCH  */
+  YYSYMBOL_T_THROW = 135,                  /* T_THROW  */
+  YYSYMBOL_T_TRY = 136,                    /* T_TRY  */
+  YYSYMBOL_T_UNSET = 137,                  /* T_UNSET  */
+  YYSYMBOL_T_UNSET_CAST = 138,             /* T_UNSET_CAST  */
+  YYSYMBOL_T_USE = 139,                    /* T_USE  */
+  YYSYMBOL_T_VAR = 140,                    /* T_VAR  */
+  YYSYMBOL_T_VARIABLE = 141,               /* T_VARIABLE  */
+  YYSYMBOL_T_WHILE = 142,                  /* T_WHILE  */
+  YYSYMBOL_T_WHITESPACE = 143,             /* T_WHITESPACE  */
+  YYSYMBOL_T_XOR_EQUAL = 144,              /* T_XOR_EQUAL  */
+  YYSYMBOL_145_ = 145,                     /* '{'  */
+  YYSYMBOL_146_ = 146,                     /* '}'  */
+  YYSYMBOL_147_ = 147,                     /* '('  */
+  YYSYMBOL_148_ = 148,                     /* ')'  */
+  YYSYMBOL_149_ = 149,                     /* ';'  */
+  YYSYMBOL_150_ = 150,                     /* '`'  */
+  YYSYMBOL_151_ = 151,                     /* '$'  */
+  YYSYMBOL_152_ = 152,                     /* '"'  */
+  YYSYMBOL_153_ = 153,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 154,                 /* $accept  */
+  YYSYMBOL_start = 155,                    /* start  */
+  YYSYMBOL_top_statement_list = 156,       /* top_statement_list  */
+  YYSYMBOL_namespace_name = 157,           /* namespace_name  */
+  YYSYMBOL_top_statement = 158,            /* top_statement  */
+  YYSYMBOL_159_1 = 159,                    /* $@1  */
+  YYSYMBOL_160_2 = 160,                    /* $@2  */
+  YYSYMBOL_use_declarations = 161,         /* use_declarations  */
+  YYSYMBOL_use_declaration = 162,          /* use_declaration  */
+  YYSYMBOL_constant_declaration = 163,     /* constant_declaration  */
+  YYSYMBOL_inner_statement_list = 164,     /* inner_statement_list  */
+  YYSYMBOL_inner_statement = 165,          /* inner_statement  */
+  YYSYMBOL_statement = 166,                /* statement  */
+  YYSYMBOL_unticked_statement = 167,       /* unticked_statement  */
+  YYSYMBOL_additional_catches = 168,       /* additional_catches  */
+  YYSYMBOL_non_empty_additional_catches = 169, /* non_empty_additional_catches  */
+  YYSYMBOL_additional_catch = 170,         /* additional_catch  */
+  YYSYMBOL_unset_variables = 171,          /* unset_variables  */
+  YYSYMBOL_unset_variable = 172,           /* unset_variable  */
+  YYSYMBOL_function_declaration_statement = 173, /* function_declaration_statement  */
+  YYSYMBOL_class_declaration_statement = 174, /* class_declaration_statement  */
+  YYSYMBOL_is_reference = 175,             /* is_reference  */
+  YYSYMBOL_unticked_function_declaration_statement = 176, /* unticked_function_declaration_statement  */
+  YYSYMBOL_177_3 = 177,                    /* $@3  */
+  YYSYMBOL_unticked_class_declaration_statement = 178, /* unticked_class_declaration_statement  */
+  YYSYMBOL_179_4 = 179,                    /* $@4  */
+  YYSYMBOL_180_5 = 180,                    /* $@5  */
+  YYSYMBOL_class_entry_type = 181,         /* class_entry_type  */
+  YYSYMBOL_extends_from = 182,             /* extends_from  */
+  YYSYMBOL_interface_entry = 183,          /* interface_entry  */
+  YYSYMBOL_interface_extends_list = 184,   /* interface_extends_list  */
+  YYSYMBOL_implements_list = 185,          /* implements_list  */
+  YYSYMBOL_interface_list = 186,           /* interface_list  */
+  YYSYMBOL_foreach_optional_arg = 187,     /* foreach_optional_arg  */
+  YYSYMBOL_foreach_variable = 188,         /* foreach_variable  */
+  YYSYMBOL_for_statement = 189,            /* for_statement  */
+  YYSYMBOL_foreach_statement = 190,        /* foreach_statement  */
+  YYSYMBOL_declare_statement = 191,        /* declare_statement  */
+  YYSYMBOL_declare_list = 192,             /* declare_list  */
+  YYSYMBOL_switch_case_list = 193,         /* switch_case_list  */
+  YYSYMBOL_case_list = 194,                /* case_list  */
+  YYSYMBOL_case_separator = 195,           /* case_separator  */
+  YYSYMBOL_while_statement = 196,          /* while_statement  */
+  YYSYMBOL_elseif_list = 197,              /* elseif_list  */
+  YYSYMBOL_new_elseif_list = 198,          /* new_elseif_list  */
+  YYSYMBOL_else_single = 199,              /* else_single  */
+  YYSYMBOL_new_else_single = 200,          /* new_else_single  */
+  YYSYMBOL_parameter_list = 201,           /* parameter_list  */
+  YYSYMBOL_non_empty_parameter_list = 202, /* non_empty_parameter_list  */
+  YYSYMBOL_optional_class_type = 203,      /* optional_class_type  */
+  YYSYMBOL_function_call_parameter_list = 204, /* function_call_parameter_list  */
+  YYSYMBOL_non_empty_function_call_parameter_list = 205, /* non_empty_function_call_parameter_list  */
+  YYSYMBOL_global_var_list = 206,          /* global_var_list  */
+  YYSYMBOL_global_var = 207,               /* global_var  */
+  YYSYMBOL_static_var_list = 208,          /* static_var_list  */
+  YYSYMBOL_class_statement_list = 209,     /* class_statement_list  */
+  YYSYMBOL_class_statement = 210,          /* class_statement  */
+  YYSYMBOL_211_6 = 211,                    /* $@6  */
+  YYSYMBOL_method_body = 212,              /* method_body  */
+  YYSYMBOL_variable_modifiers = 213,       /* variable_modifiers  */
+  YYSYMBOL_method_modifiers = 214,         /* method_modifiers  */
+  YYSYMBOL_non_empty_member_modifiers = 215, /* non_empty_member_modifiers  */
+  YYSYMBOL_member_modifier = 216,          /* member_modifier  */
+  YYSYMBOL_class_variable_declaration = 217, /* class_variable_declaration  */
+  YYSYMBOL_class_constant_declaration = 218, /* class_constant_declaration  */
+  YYSYMBOL_echo_expr_list = 219,           /* echo_expr_list  */
+  YYSYMBOL_for_expr = 220,                 /* for_expr  */
+  YYSYMBOL_non_empty_for_expr = 221,       /* non_empty_for_expr  */
+  YYSYMBOL_expr_without_variable = 222,    /* expr_without_variable  */
+  YYSYMBOL_223_7 = 223,                    /* $@7  */
+  YYSYMBOL_function = 224,                 /* function  */
+  YYSYMBOL_lexical_vars = 225,             /* lexical_vars  */
+  YYSYMBOL_lexical_var_list = 226,         /* lexical_var_list  */
+  YYSYMBOL_function_call = 227,            /* function_call  */
+  YYSYMBOL_class_name = 228,               /* class_name  */
+  YYSYMBOL_fully_qualified_class_name = 229, /* fully_qualified_class_name  */
+  YYSYMBOL_class_name_reference = 230,     /* class_name_reference  */
+  YYSYMBOL_dynamic_class_name_reference = 231, /* dynamic_class_name_reference  */
+  YYSYMBOL_dynamic_class_name_variable_properties = 232, /* dynamic_class_name_variable_properties  */
+  YYSYMBOL_dynamic_class_name_variable_property = 233, /* dynamic_class_name_variable_property  */
+  YYSYMBOL_exit_expr = 234,                /* exit_expr  */
+  YYSYMBOL_backticks_expr = 235,           /* backticks_expr  */
+  YYSYMBOL_ctor_arguments = 236,           /* ctor_arguments  */
+  YYSYMBOL_common_scalar = 237,            /* common_scalar  */
+  YYSYMBOL_static_scalar = 238,            /* static_scalar  */
+  YYSYMBOL_static_class_constant = 239,    /* static_class_constant  */
+  YYSYMBOL_scalar = 240,                   /* scalar  */
+  YYSYMBOL_static_array_pair_list = 241,   /* static_array_pair_list  */
+  YYSYMBOL_possible_comma = 242,           /* possible_comma  */
+  YYSYMBOL_non_empty_static_array_pair_list = 243, /* non_empty_static_array_pair_list  */
+  YYSYMBOL_expr = 244,                     /* expr  */
+  YYSYMBOL_r_variable = 245,               /* r_variable  */
+  YYSYMBOL_w_variable = 246,               /* w_variable  */
+  YYSYMBOL_rw_variable = 247,              /* rw_variable  */
+  YYSYMBOL_variable = 248,                 /* variable  */
+  YYSYMBOL_variable_properties = 249,      /* variable_properties  */
+  YYSYMBOL_variable_property = 250,        /* variable_property  */
+  YYSYMBOL_method_or_not = 251,            /* method_or_not  */
+  YYSYMBOL_variable_without_objects = 252, /* variable_without_objects  */
+  YYSYMBOL_static_member = 253,            /* static_member  */
+  YYSYMBOL_variable_class_name = 254,      /* variable_class_name  */
+  YYSYMBOL_base_variable_with_function_calls = 255, /* base_variable_with_function_calls  */
+  YYSYMBOL_base_variable = 256,            /* base_variable  */
+  YYSYMBOL_reference_variable = 257,       /* reference_variable  */
+  YYSYMBOL_compound_variable = 258,        /* compound_variable  */
+  YYSYMBOL_dim_offset = 259,               /* dim_offset  */
+  YYSYMBOL_object_property = 260,          /* object_property  */
+  YYSYMBOL_object_dim_list = 261,          /* object_dim_list  */
+  YYSYMBOL_variable_name = 262,            /* variable_name  */
+  YYSYMBOL_simple_indirect_reference = 263, /* simple_indirect_reference  */
+  YYSYMBOL_assignment_list = 264,          /* assignment_list  */
+  YYSYMBOL_assignment_list_element = 265,  /* assignment_list_element  */
+  YYSYMBOL_array_pair_list = 266,          /* array_pair_list  */
+  YYSYMBOL_non_empty_array_pair_list = 267, /* non_empty_array_pair_list  */
+  YYSYMBOL_encaps_list = 268,              /* encaps_list  */
+  YYSYMBOL_encaps_var = 269,               /* encaps_var  */
+  YYSYMBOL_encaps_var_offset = 270,        /* encaps_var_offset  */
+  YYSYMBOL_internal_functions_in_yacc = 271, /* internal_functions_in_yacc  */
+  YYSYMBOL_isset_variables = 272,          /* isset_variables  */
+  YYSYMBOL_class_constant = 273            /* class_constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 343 of yacc.c  */
-#line 289 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.cpp"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -323,85 +696,112 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -417,7 +817,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -425,40 +825,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined PHP53STYPE_IS_TRIVIAL && PHP53STYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -468,35 +865,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -504,40 +901,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   7341
+#define YYLAST   8848
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  154
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  120
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  403
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  833
+#define YYNRULES  405
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  837
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   629
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    48,   152,     2,   151,    47,    31,     2,
-     147,   148,    45,    42,     8,    43,    44,    46,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    26,   149,
-      36,    13,    37,    25,    60,     2,     2,     2,     2,     2,
+       2,     2,     2,    18,   152,     2,   151,    17,     9,     2,
+     147,   148,    15,    12,     3,    13,    14,    16,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     6,   149,
+      10,     4,    11,     5,    20,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    61,     2,   153,    30,     2,   150,     2,     2,     2,
+       2,    21,     2,   153,     8,     2,   150,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   145,    29,   146,    50,     2,     2,     2,
+       2,     2,     2,   145,     7,   146,    19,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -575,296 +977,111 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    71,    18,    73,    54,    74,    75,    52,    28,
-      27,    76,     2,    77,    78,    79,    80,    81,    62,    82,
-      83,    20,    84,    85,    86,    87,    58,    88,    89,    90,
-      21,    91,    92,    93,    94,    95,    56,    96,    65,    64,
-      97,    98,    99,   100,   101,   102,    66,   103,   104,     5,
-     105,   106,   107,    70,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,    59,     7,     6,   117,    49,     2,    57,
-     118,    35,    38,    33,    34,    32,   119,    39,   120,   121,
-     122,    11,     9,    10,   123,    23,    19,    22,   124,    63,
-     125,   126,   127,    53,   128,   129,   130,    17,   131,    24,
-      12,    69,    68,    67,     4,     3,   132,    41,    15,    40,
-      14,   133,    72,   134,    55,   135,   136,   137,     2,     2,
-     138,   139,    51,   140,   141,   142,   143,   144,    16,     2
+       2,     2,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,     2,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,     2,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,     2,     2,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,     2
 };
 
-#if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+#if PHP53DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,     9,    11,    15,    17,    19,
-      21,    26,    30,    31,    38,    39,    45,    49,    52,    56,
-      58,    60,    64,    67,    72,    78,    83,    86,    87,    89,
-      91,    93,    98,   100,   103,   107,   115,   126,   132,   140,
-     150,   156,   159,   163,   166,   170,   173,   177,   181,   185,
-     189,   193,   195,   198,   204,   213,   222,   228,   230,   244,
-     248,   252,   254,   255,   257,   260,   269,   271,   275,   277,
-     279,   281,   282,   284,   285,   296,   297,   306,   307,   315,
-     317,   320,   323,   324,   327,   329,   330,   333,   334,   337,
-     339,   343,   344,   347,   349,   352,   354,   359,   361,   366,
-     368,   373,   377,   383,   387,   392,   397,   403,   404,   410,
-     415,   417,   419,   421,   426,   427,   434,   435,   443,   444,
-     447,   448,   452,   454,   455,   458,   462,   468,   473,   478,
-     484,   492,   499,   500,   502,   504,   506,   507,   509,   511,
-     514,   518,   522,   527,   531,   533,   535,   538,   543,   547,
-     553,   555,   559,   562,   563,   567,   570,   571,   581,   583,
-     587,   589,   591,   592,   594,   596,   599,   601,   603,   605,
-     607,   609,   611,   615,   621,   623,   627,   633,   638,   642,
-     644,   645,   647,   651,   653,   660,   664,   669,   676,   680,
-     683,   687,   691,   695,   699,   703,   707,   711,   715,   719,
-     723,   727,   730,   733,   736,   739,   743,   747,   751,   755,
-     759,   763,   767,   771,   775,   779,   783,   787,   791,   795,
-     799,   803,   806,   809,   812,   815,   819,   823,   827,   831,
-     835,   839,   843,   847,   851,   855,   861,   866,   868,   871,
-     874,   877,   880,   883,   886,   889,   892,   895,   897,   902,
-     906,   909,   910,   921,   923,   924,   929,   933,   938,   940,
-     943,   948,   955,   961,   968,   975,   982,   989,   994,   996,
-     998,  1002,  1005,  1007,  1011,  1014,  1016,  1018,  1023,  1025,
-    1028,  1029,  1032,  1033,  1036,  1040,  1041,  1043,  1045,  1046,
-    1050,  1052,  1054,  1056,  1058,  1060,  1062,  1064,  1066,  1068,
-    1070,  1074,  1077,  1079,  1081,  1085,  1088,  1091,  1094,  1099,
-    1101,  1105,  1107,  1109,  1111,  1115,  1118,  1120,  1124,  1128,
-    1129,  1132,  1133,  1135,  1141,  1145,  1149,  1151,  1153,  1155,
-    1157,  1159,  1161,  1167,  1169,  1172,  1173,  1177,  1181,  1182,
-    1184,  1187,  1191,  1195,  1197,  1199,  1201,  1203,  1206,  1208,
-    1213,  1218,  1220,  1222,  1227,  1228,  1230,  1232,  1234,  1239,
-    1244,  1246,  1248,  1252,  1254,  1257,  1261,  1263,  1265,  1270,
-    1271,  1272,  1275,  1281,  1285,  1289,  1291,  1298,  1303,  1308,
-    1311,  1314,  1317,  1319,  1322,  1324,  1329,  1333,  1337,  1344,
-    1348,  1350,  1352,  1354,  1359,  1364,  1367,  1370,  1375,  1378,
-    1381,  1383,  1387,  1391
+       0,   353,   353,   357,   358,   362,   363,   367,   368,   369,
+     370,   371,   372,   372,   374,   374,   376,   377,   381,   383,
+     387,   388,   389,   390,   394,   395,   399,   400,   404,   405,
+     406,   407,   411,   412,   413,   417,   418,   422,   426,   428,
+     429,   441,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   464,   471,   472,   473,
+     483,   484,   488,   489,   493,   494,   498,   507,   508,   512,
+     516,   520,   524,   525,   530,   529,   538,   537,   551,   550,
+     559,   560,   561,   565,   566,   571,   575,   576,   581,   582,
+     587,   588,   592,   593,   597,   598,   602,   603,   607,   608,
+     612,   613,   617,   618,   622,   623,   624,   625,   629,   630,
+     634,   640,   641,   645,   646,   650,   651,   658,   659,   666,
+     667,   671,   672,   676,   677,   682,   683,   684,   685,   686,
+     687,   688,   689,   693,   694,   695,   699,   700,   704,   705,
+     706,   707,   708,   709,   713,   714,   718,   719,   720,   724,
+     725,   726,   727,   731,   732,   736,   737,   739,   738,   743,
+     747,   748,   752,   753,   757,   758,   762,   763,   767,   768,
+     769,   770,   771,   772,   776,   777,   778,   779,   783,   785,
+     789,   790,   794,   795,   799,   800,   804,   805,   806,   807,
+     808,   809,   810,   811,   812,   813,   814,   815,   816,   817,
+     818,   819,   820,   821,   822,   823,   824,   825,   826,   827,
+     828,   829,   830,   831,   832,   833,   834,   835,   836,   837,
+     838,   839,   840,   841,   842,   843,   844,   845,   846,   847,
+     848,   849,   850,   851,   852,   853,   854,   855,   858,   860,
+     861,   862,   863,   864,   865,   866,   867,   868,   869,   870,
+     871,   872,   873,   876,   874,   886,   890,   891,   895,   899,
+     903,   904,   908,   910,   913,   915,   917,   919,   921,   923,
+     928,   929,   930,   931,   935,   936,   937,   941,   942,   946,
+     948,   952,   953,   957,   961,   962,   963,   967,   968,   969,
+     973,   974,   978,   979,   980,   981,   982,   983,   984,   985,
+     986,   987,   988,   989,   993,   994,   995,   996,   997,   998,
+     999,  1000,  1004,  1008,  1009,  1010,  1011,  1012,  1013,  1014,
+    1015,  1019,  1020,  1024,  1025,  1029,  1030,  1031,  1032,  1036,
+    1037,  1041,  1045,  1049,  1053,  1057,  1061,  1062,  1066,  1071,
+    1072,  1076,  1077,  1081,  1082,  1086,  1090,  1091,  1095,  1096,
+    1097,  1101,  1102,  1103,  1107,  1108,  1112,  1113,  1117,  1118,
+    1122,  1123,  1124,  1128,  1129,  1133,  1134,  1138,  1139,  1143,
+    1144,  1145,  1149,  1150,  1154,  1158,  1162,  1163,  1164,  1168,
+    1172,  1173,  1177,  1178,  1179,  1180,  1184,  1185,  1186,  1187,
+    1188,  1189,  1193,  1194,  1195,  1199,  1200,  1201,  1202,  1203,
+    1204,  1205,  1209,  1210,  1214,  1215
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     155,     0,    -1,   156,    -1,   156,   158,    -1,    -1,   134,
-      -1,   157,   126,   134,    -1,   166,    -1,   173,    -1,   174,
-      -1,   114,   147,   148,   149,    -1,   124,   157,   149,    -1,
-      -1,   124,   157,   145,   159,   156,   146,    -1,    -1,   124,
-     145,   160,   156,   146,    -1,   140,   161,   149,    -1,   163,
-     149,    -1,   161,     8,   162,    -1,   162,    -1,   157,    -1,
-     157,    74,   134,    -1,   126,   157,    -1,   126,   157,    74,
-     134,    -1,   163,     8,   134,    13,   238,    -1,    84,   134,
-      13,   238,    -1,   164,   165,    -1,    -1,   166,    -1,   173,
-      -1,   174,    -1,   114,   147,   148,   149,    -1,   167,    -1,
-     134,    26,    -1,   145,   164,   146,    -1,   115,   147,   244,
-     148,   166,   197,   199,    -1,   115,   147,   244,   148,    26,
-     164,   198,   200,    66,   149,    -1,   143,   147,   244,   148,
-     196,    -1,    92,   166,   143,   147,   244,   148,   149,    -1,
-     108,   147,   220,   149,   220,   149,   220,   148,   189,    -1,
-     136,   147,   244,   148,   193,    -1,    76,   149,    -1,    76,
-     244,   149,    -1,    86,   149,    -1,    86,   244,   149,    -1,
-     132,   149,    -1,   132,   222,   149,    -1,   132,   248,   149,
-      -1,   112,   206,   149,    -1,    72,   208,   149,    -1,    96,
-     219,   149,    -1,   117,    -1,   244,   149,    -1,   139,   147,
-     171,   148,   149,    -1,   109,   147,   248,    74,   188,   187,
-     148,   190,    -1,   109,   147,   222,    74,   248,   187,   148,
-     190,    -1,    88,   147,   192,   148,   191,    -1,   149,    -1,
-     138,   145,   164,   146,    78,   147,   229,   142,   148,   145,
-     164,   146,   168,    -1,   137,   244,   149,    -1,   113,   134,
-     149,    -1,   169,    -1,    -1,   170,    -1,   169,   170,    -1,
-      78,   147,   229,   142,   148,   145,   164,   146,    -1,   172,
-      -1,   171,     8,   172,    -1,   248,    -1,   176,    -1,   178,
-      -1,    -1,    31,    -1,    -1,   224,   175,   134,   147,   201,
-     148,   177,   145,   164,   146,    -1,    -1,   181,   134,   182,
-     185,   179,   145,   209,   146,    -1,    -1,   183,   134,   184,
-     180,   145,   209,   146,    -1,    80,    -1,    71,    80,    -1,
-      70,    80,    -1,    -1,   106,   229,    -1,   118,    -1,    -1,
-     106,   186,    -1,    -1,   116,   186,    -1,   229,    -1,   186,
-       8,   229,    -1,    -1,    95,   188,    -1,   248,    -1,    31,
-     248,    -1,   166,    -1,    26,   164,   100,   149,    -1,   166,
-      -1,    26,   164,   101,   149,    -1,   166,    -1,    26,   164,
-      99,   149,    -1,   134,    13,   238,    -1,   192,     8,   134,
-      13,   238,    -1,   145,   194,   146,    -1,   145,   149,   194,
-     146,    -1,    26,   194,   103,   149,    -1,    26,   149,   194,
-     103,   149,    -1,    -1,   194,    77,   244,   195,   164,    -1,
-     194,    89,   195,   164,    -1,    26,    -1,   149,    -1,   166,
-      -1,    26,   164,   104,   149,    -1,    -1,   197,    64,   147,
-     244,   148,   166,    -1,    -1,   198,    64,   147,   244,   148,
-      26,   164,    -1,    -1,    65,   166,    -1,    -1,    65,    26,
-     164,    -1,   202,    -1,    -1,   203,   142,    -1,   203,    31,
-     142,    -1,   203,    31,   142,    13,   238,    -1,   203,   142,
-      13,   238,    -1,   202,     8,   203,   142,    -1,   202,     8,
-     203,    31,   142,    -1,   202,     8,   203,    31,   142,    13,
-     238,    -1,   202,     8,   203,   142,    13,   238,    -1,    -1,
-     229,    -1,    73,    -1,   205,    -1,    -1,   222,    -1,   248,
-      -1,    31,   246,    -1,   205,     8,   222,    -1,   205,     8,
-     248,    -1,   205,     8,    31,   246,    -1,   206,     8,   207,
-      -1,   207,    -1,   142,    -1,   151,   245,    -1,   151,   145,
-     244,   146,    -1,   208,     8,   142,    -1,   208,     8,   142,
-      13,   238,    -1,   142,    -1,   142,    13,   238,    -1,   209,
-     210,    -1,    -1,   213,   217,   149,    -1,   218,   149,    -1,
-      -1,   214,   224,   175,   134,   147,   201,   148,   211,   212,
-      -1,   149,    -1,   145,   164,   146,    -1,   215,    -1,   141,
-      -1,    -1,   215,    -1,   216,    -1,   215,   216,    -1,    67,
-      -1,    68,    -1,    69,    -1,    72,    -1,    71,    -1,    70,
-      -1,   217,     8,   142,    -1,   217,     8,   142,    13,   238,
-      -1,   142,    -1,   142,    13,   238,    -1,   218,     8,   134,
-      13,   238,    -1,    84,   134,    13,   238,    -1,   219,     8,
-     244,    -1,   244,    -1,    -1,   221,    -1,   221,     8,   244,
-      -1,   244,    -1,   121,   147,   264,   148,    13,   244,    -1,
-     248,    13,   244,    -1,   248,    13,    31,   248,    -1,   248,
-      13,    31,    63,   230,   236,    -1,    63,   230,   236,    -1,
-      62,   244,    -1,   248,    24,   244,    -1,   248,    23,   244,
-      -1,   248,    22,   244,    -1,   248,    21,   244,    -1,   248,
-      20,   244,    -1,   248,    19,   244,    -1,   248,    18,   244,
-      -1,   248,    17,   244,    -1,   248,    16,   244,    -1,   248,
-      15,   244,    -1,   248,    14,   244,    -1,   247,    59,    -1,
-      59,   247,    -1,   247,    58,    -1,    58,   247,    -1,   244,
-      27,   244,    -1,   244,    28,   244,    -1,   244,     9,   244,
-      -1,   244,    11,   244,    -1,   244,    10,   244,    -1,   244,
-      29,   244,    -1,   244,    31,   244,    -1,   244,    30,   244,
-      -1,   244,    44,   244,    -1,   244,    42,   244,    -1,   244,
-      43,   244,    -1,   244,    45,   244,    -1,   244,    46,   244,
-      -1,   244,    47,   244,    -1,   244,    41,   244,    -1,   244,
-      40,   244,    -1,    42,   244,    -1,    43,   244,    -1,    48,
-     244,    -1,    50,   244,    -1,   244,    33,   244,    -1,   244,
-      32,   244,    -1,   244,    35,   244,    -1,   244,    34,   244,
-      -1,   244,    36,   244,    -1,   244,    39,   244,    -1,   244,
-      37,   244,    -1,   244,    38,   244,    -1,   244,    49,   230,
-      -1,   147,   244,   148,    -1,   244,    25,   244,    26,   244,
-      -1,   244,    25,    26,   244,    -1,   271,    -1,    57,   244,
-      -1,    56,   244,    -1,    55,   244,    -1,    54,   244,    -1,
-      53,   244,    -1,    52,   244,    -1,    51,   244,    -1,   105,
-     234,    -1,    60,   244,    -1,   240,    -1,    73,   147,   266,
-     148,    -1,   150,   235,   150,    -1,    12,   244,    -1,    -1,
-     224,   175,   147,   201,   148,   225,   145,   223,   164,   146,
-      -1,   111,    -1,    -1,   140,   147,   226,   148,    -1,   226,
-       8,   142,    -1,   226,     8,    31,   142,    -1,   142,    -1,
-      31,   142,    -1,   157,   147,   204,   148,    -1,   124,   126,
-     157,   147,   204,   148,    -1,   126,   157,   147,   204,   148,
-      -1,   228,   131,   134,   147,   204,   148,    -1,   228,   131,
-     252,   147,   204,   148,    -1,   254,   131,   134,   147,   204,
-     148,    -1,   254,   131,   252,   147,   204,   148,    -1,   252,
-     147,   204,   148,    -1,    72,    -1,   157,    -1,   124,   126,
-     157,    -1,   126,   157,    -1,   157,    -1,   124,   126,   157,
-      -1,   126,   157,    -1,   228,    -1,   231,    -1,   256,   128,
-     260,   232,    -1,   256,    -1,   232,   233,    -1,    -1,   128,
-     260,    -1,    -1,   147,   148,    -1,   147,   244,   148,    -1,
-      -1,    98,    -1,   268,    -1,    -1,   147,   204,   148,    -1,
-     122,    -1,    91,    -1,    85,    -1,   120,    -1,   107,    -1,
-      90,    -1,    81,    -1,   123,    -1,   110,    -1,   125,    -1,
-     133,    98,   102,    -1,   133,   102,    -1,   237,    -1,   157,
-      -1,   124,   126,   157,    -1,   126,   157,    -1,    42,   238,
-      -1,    43,   238,    -1,    73,   147,   241,   148,    -1,   239,
-      -1,   228,   131,   134,    -1,   135,    -1,   273,    -1,   157,
-      -1,   124,   126,   157,    -1,   126,   157,    -1,   237,    -1,
-     152,   268,   152,    -1,   133,   268,   102,    -1,    -1,   243,
-     242,    -1,    -1,     8,    -1,   243,     8,   238,    95,   238,
-      -1,   243,     8,   238,    -1,   238,    95,   238,    -1,   238,
-      -1,   245,    -1,   222,    -1,   248,    -1,   248,    -1,   248,
-      -1,   255,   128,   260,   251,   249,    -1,   255,    -1,   249,
-     250,    -1,    -1,   128,   260,   251,    -1,   147,   204,   148,
-      -1,    -1,   257,    -1,   263,   257,    -1,   228,   131,   252,
-      -1,   254,   131,   252,    -1,   257,    -1,   256,    -1,   227,
-      -1,   257,    -1,   263,   257,    -1,   253,    -1,   257,    61,
-     259,   153,    -1,   257,   145,   244,   146,    -1,   258,    -1,
-     142,    -1,   151,   145,   244,   146,    -1,    -1,   244,    -1,
-     261,    -1,   252,    -1,   261,    61,   259,   153,    -1,   261,
-     145,   244,   146,    -1,   262,    -1,   134,    -1,   145,   244,
-     146,    -1,   151,    -1,   263,   151,    -1,   264,     8,   265,
-      -1,   265,    -1,   248,    -1,   121,   147,   264,   148,    -1,
-      -1,    -1,   267,   242,    -1,   267,     8,   244,    95,   244,
-      -1,   267,     8,   244,    -1,   244,    95,   244,    -1,   244,
-      -1,   267,     8,   244,    95,    31,   246,    -1,   267,     8,
-      31,   246,    -1,   244,    95,    31,   246,    -1,    31,   246,
-      -1,   268,   269,    -1,   268,    98,    -1,   269,    -1,    98,
-     269,    -1,   142,    -1,   142,    61,   270,   153,    -1,   142,
-     128,   134,    -1,    94,   244,   146,    -1,    94,   135,    61,
-     244,   153,   146,    -1,    87,   248,   146,    -1,   134,    -1,
-     127,    -1,   142,    -1,   119,   147,   272,   148,    -1,    97,
-     147,   248,   148,    -1,     7,   244,    -1,     6,   244,    -1,
-       5,   147,   244,   148,    -1,     4,   244,    -1,     3,   244,
-      -1,   248,    -1,   272,     8,   248,    -1,   228,   131,   134,
-      -1,   254,   131,   134,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   352,   352,   356,   357,   361,   362,   366,   367,   368,
-     369,   370,   371,   371,   373,   373,   375,   376,   380,   382,
-     386,   387,   388,   389,   393,   394,   398,   399,   403,   404,
-     405,   406,   410,   411,   415,   416,   420,   424,   426,   427,
-     439,   442,   443,   444,   445,   446,   447,   448,   449,   450,
-     451,   452,   453,   454,   455,   462,   469,   470,   471,   481,
-     482,   486,   487,   491,   492,   496,   505,   506,   510,   514,
-     518,   522,   523,   528,   527,   536,   535,   549,   548,   557,
-     558,   559,   563,   564,   569,   573,   574,   579,   580,   585,
-     586,   590,   591,   595,   596,   600,   601,   605,   606,   610,
-     611,   615,   616,   620,   621,   622,   623,   627,   628,   632,
-     638,   639,   643,   644,   648,   649,   656,   657,   664,   665,
-     669,   670,   674,   675,   680,   681,   682,   683,   684,   685,
-     686,   687,   691,   692,   693,   697,   698,   702,   703,   704,
-     705,   706,   707,   711,   712,   716,   717,   718,   722,   723,
-     724,   725,   729,   730,   734,   735,   737,   736,   744,   745,
-     749,   750,   754,   755,   759,   760,   764,   765,   766,   767,
-     768,   769,   773,   774,   775,   776,   780,   782,   786,   787,
-     791,   792,   796,   797,   801,   802,   803,   804,   805,   806,
-     807,   808,   809,   810,   811,   812,   813,   814,   815,   816,
-     817,   818,   819,   820,   821,   822,   823,   824,   825,   826,
-     827,   828,   829,   830,   831,   832,   833,   834,   835,   836,
-     837,   838,   839,   840,   841,   842,   843,   844,   845,   846,
-     847,   848,   849,   850,   851,   852,   855,   857,   858,   859,
-     860,   861,   862,   863,   864,   865,   866,   867,   868,   869,
-     870,   873,   871,   883,   887,   888,   892,   896,   900,   901,
-     905,   907,   910,   912,   914,   916,   918,   920,   925,   926,
-     927,   928,   932,   933,   934,   938,   939,   943,   945,   949,
-     950,   954,   958,   959,   960,   964,   965,   966,   970,   971,
-     975,   976,   977,   978,   979,   980,   981,   982,   983,   984,
-     985,   986,   990,   991,   992,   993,   994,   995,   996,   997,
-    1001,  1005,  1006,  1007,  1008,  1009,  1010,  1011,  1012,  1016,
-    1017,  1021,  1022,  1026,  1027,  1028,  1029,  1033,  1034,  1038,
-    1042,  1046,  1050,  1054,  1058,  1059,  1063,  1068,  1069,  1073,
-    1074,  1078,  1079,  1083,  1087,  1088,  1092,  1093,  1094,  1098,
-    1099,  1100,  1104,  1105,  1109,  1110,  1114,  1115,  1119,  1120,
-    1121,  1125,  1126,  1130,  1131,  1135,  1136,  1140,  1141,  1142,
-    1146,  1147,  1151,  1155,  1159,  1160,  1161,  1165,  1169,  1170,
-    1174,  1175,  1176,  1177,  1181,  1182,  1183,  1184,  1185,  1186,
-    1190,  1191,  1192,  1196,  1197,  1198,  1199,  1200,  1201,  1202,
-    1206,  1207,  1211,  1212
-};
-#endif
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "T_REQUIRE_ONCE", "T_REQUIRE", "T_EVAL",
-  "T_INCLUDE_ONCE", "T_INCLUDE", "','", "T_LOGICAL_OR", "T_LOGICAL_XOR",
-  "T_LOGICAL_AND", "T_PRINT", "'='", "T_SR_EQUAL", "T_SL_EQUAL",
-  "T_XOR_EQUAL", "T_OR_EQUAL", "T_AND_EQUAL", "T_MOD_EQUAL",
-  "T_CONCAT_EQUAL", "T_DIV_EQUAL", "T_MUL_EQUAL", "T_MINUS_EQUAL",
-  "T_PLUS_EQUAL", "'?'", "':'", "T_BOOLEAN_OR", "T_BOOLEAN_AND", "'|'",
-  "'^'", "'&'", "T_IS_NOT_IDENTICAL", "T_IS_IDENTICAL", "T_IS_NOT_EQUAL",
-  "T_IS_EQUAL", "'<'", "'>'", "T_IS_GREATER_OR_EQUAL",
-  "T_IS_SMALLER_OR_EQUAL", "T_SR", "T_SL", "'+'", "'-'", "'.'", "'*'",
-  "'/'", "'%'", "'!'", "T_INSTANCEOF", "'~'", "T_UNSET_CAST",
-  "T_BOOL_CAST", "T_OBJECT_CAST", "T_ARRAY_CAST", "T_STRING_CAST",
-  "T_DOUBLE_CAST", "T_INT_CAST", "T_DEC", "T_INC", "'@'", "'['", "T_CLONE",
-  "T_NEW", "T_ELSEIF", "T_ELSE", "T_ENDIF", "T_PUBLIC", "T_PROTECTED",
-  "T_PRIVATE", "T_FINAL", "T_ABSTRACT", "T_STATIC", "T_ARRAY", "T_AS",
-  "T_BAD_CHARACTER", "T_BREAK", "T_CASE", "T_CATCH", "T_CHARACTER",
-  "T_CLASS", "T_CLASS_C", "T_CLOSE_TAG", "T_COMMENT", "T_CONST",
-  "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN", "T_DECLARE",
-  "T_DEFAULT", "T_DIR", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
-  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_ECHO", "T_EMPTY",
-  "T_ENCAPSED_AND_WHITESPACE", "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH",
-  "T_END_HEREDOC", "T_ENDSWITCH", "T_ENDWHILE", "T_EXIT", "T_EXTENDS",
-  "T_FILE", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
-  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INLINE_HTML",
-  "T_INTERFACE", "T_ISSET", "T_LINE", "T_LIST", "T_LNUMBER", "T_METHOD_C",
-  "T_NAMESPACE", "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING",
-  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO",
-  "T_PAAMAYIM_NEKUDOTAYIM", "T_RETURN", "T_START_HEREDOC", "T_STRING",
-  "T_STRING_VARNAME", "T_SWITCH", "T_THROW", "T_TRY", "T_UNSET", "T_USE",
-  "T_VAR", "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "'{'", "'}'", "'('",
-  "')'", "';'", "'`'", "'$'", "'\"'", "']'", "$accept", "start",
+  "\"end of file\"", "error", "\"invalid token\"", "','", "'='", "'?'",
+  "':'", "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'.'", "'*'",
+  "'/'", "'%'", "'!'", "'~'", "'@'", "'['", "T_ABSTRACT", "T_AND_EQUAL",
+  "T_ARRAY", "T_ARRAY_CAST", "T_AS", "T_BAD_CHARACTER", "T_BOOL_CAST",
+  "T_BOOLEAN_AND", "T_BOOLEAN_OR", "T_BREAK", "T_CASE", "T_CATCH",
+  "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLONE", "T_CLOSE_TAG",
+  "T_COMMENT", "T_CONCAT_EQUAL", "T_CONST", "T_CONSTANT_ENCAPSED_STRING",
+  "T_CONTINUE", "T_CURLY_OPEN", "T_DEC", "T_DECLARE", "T_DEFAULT", "T_DIR",
+  "T_DIV_EQUAL", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
+  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_DOUBLE_CAST",
+  "T_ECHO", "T_ELSE", "T_ELSEIF", "T_EMPTY", "T_ENCAPSED_AND_WHITESPACE",
+  "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH", "T_END_HEREDOC", "T_ENDIF",
+  "T_ENDSWITCH", "T_ENDWHILE", "T_EVAL", "T_EXIT", "T_EXTENDS", "T_FILE",
+  "T_FINAL", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
+  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INC",
+  "T_INCLUDE", "T_INCLUDE_ONCE", "T_INLINE_HTML", "T_INSTANCEOF",
+  "T_INT_CAST", "T_INTERFACE", "T_IS_EQUAL", "T_IS_GREATER_OR_EQUAL",
+  "T_IS_IDENTICAL", "T_IS_NOT_EQUAL", "T_IS_NOT_IDENTICAL", "T_ISSET",
+  "T_IS_SMALLER_OR_EQUAL", "T_LINE", "T_LIST", "T_LNUMBER",
+  "T_LOGICAL_AND", "T_LOGICAL_OR", "T_LOGICAL_XOR", "T_METHOD_C",
+  "T_MINUS_EQUAL", "T_MOD_EQUAL", "T_MUL_EQUAL", "T_NAMESPACE", "T_NEW",
+  "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING", "T_OBJECT_CAST",
+  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO", "T_OR_EQUAL",
+  "T_PAAMAYIM_NEKUDOTAYIM", "T_PLUS_EQUAL", "T_PRINT", "T_PRIVATE",
+  "T_PROTECTED", "T_PUBLIC", "T_REQUIRE", "T_REQUIRE_ONCE", "T_RETURN",
+  "T_SL", "T_SL_EQUAL", "T_SR", "T_SR_EQUAL", "T_START_HEREDOC",
+  "T_STATIC", "T_STRING", "T_STRING_CAST", "T_STRING_VARNAME", "T_SWITCH",
+  "T_THROW", "T_TRY", "T_UNSET", "T_UNSET_CAST", "T_USE", "T_VAR",
+  "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "T_XOR_EQUAL", "'{'", "'}'",
+  "'('", "')'", "';'", "'`'", "'$'", "'\"'", "']'", "$accept", "start",
   "top_statement_list", "namespace_name", "top_statement", "$@1", "$@2",
   "use_declarations", "use_declaration", "constant_declaration",
   "inner_statement_list", "inner_statement", "statement",
@@ -905,2097 +1122,2302 @@ static const char *const yytname[] =
   "assignment_list_element", "array_pair_list",
   "non_empty_array_pair_list", "encaps_list", "encaps_var",
   "encaps_var_offset", "internal_functions_in_yacc", "isset_variables",
-  "class_constant", 0
+  "class_constant", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   629,   605,   604,   549,   565,   564,    44,   582,
-     583,   581,   600,    61,   610,   608,   628,   597,   503,   586,
-     521,   530,   587,   585,   599,    63,    58,   510,   509,   124,
-      94,    38,   575,   573,   574,   571,    60,    62,   572,   577,
-     609,   607,    43,    45,    46,    42,    47,    37,    33,   567,
-     126,   622,   508,   593,   505,   614,   536,   569,   526,   563,
-      64,    91,   518,   589,   539,   538,   546,   603,   602,   601,
-     553,   502,   612,   504,   506,   507,   511,   513,   514,   515,
-     516,   517,   519,   520,   522,   523,   524,   525,   527,   528,
-     529,   531,   532,   533,   534,   535,   537,   540,   541,   542,
-     543,   544,   545,   547,   548,   550,   551,   552,   554,   555,
-     556,   557,   558,   559,   560,   561,   562,   566,   570,   576,
-     578,   579,   580,   584,   588,   590,   591,   592,   594,   595,
-     596,   598,   606,   611,   613,   615,   616,   617,   620,   621,
-     623,   624,   625,   626,   627,   123,   125,    40,    41,    59,
-      96,    36,    34,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   154,   155,   156,   156,   157,   157,   158,   158,   158,
-     158,   158,   159,   158,   160,   158,   158,   158,   161,   161,
-     162,   162,   162,   162,   163,   163,   164,   164,   165,   165,
-     165,   165,   166,   166,   167,   167,   167,   167,   167,   167,
-     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
-     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
-     167,   168,   168,   169,   169,   170,   171,   171,   172,   173,
-     174,   175,   175,   177,   176,   179,   178,   180,   178,   181,
-     181,   181,   182,   182,   183,   184,   184,   185,   185,   186,
-     186,   187,   187,   188,   188,   189,   189,   190,   190,   191,
-     191,   192,   192,   193,   193,   193,   193,   194,   194,   194,
-     195,   195,   196,   196,   197,   197,   198,   198,   199,   199,
-     200,   200,   201,   201,   202,   202,   202,   202,   202,   202,
-     202,   202,   203,   203,   203,   204,   204,   205,   205,   205,
-     205,   205,   205,   206,   206,   207,   207,   207,   208,   208,
-     208,   208,   209,   209,   210,   210,   211,   210,   212,   212,
-     213,   213,   214,   214,   215,   215,   216,   216,   216,   216,
-     216,   216,   217,   217,   217,   217,   218,   218,   219,   219,
-     220,   220,   221,   221,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-     222,   223,   222,   224,   225,   225,   226,   226,   226,   226,
-     227,   227,   227,   227,   227,   227,   227,   227,   228,   228,
-     228,   228,   229,   229,   229,   230,   230,   231,   231,   232,
-     232,   233,   234,   234,   234,   235,   235,   235,   236,   236,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   238,   238,   238,   238,   238,   238,   238,   238,
-     239,   240,   240,   240,   240,   240,   240,   240,   240,   241,
-     241,   242,   242,   243,   243,   243,   243,   244,   244,   245,
-     246,   247,   248,   248,   249,   249,   250,   251,   251,   252,
-     252,   253,   253,   254,   255,   255,   256,   256,   256,   257,
-     257,   257,   258,   258,   259,   259,   260,   260,   261,   261,
-     261,   262,   262,   263,   263,   264,   264,   265,   265,   265,
-     266,   266,   267,   267,   267,   267,   267,   267,   267,   267,
-     268,   268,   268,   268,   269,   269,   269,   269,   269,   269,
-     270,   270,   270,   271,   271,   271,   271,   271,   271,   271,
-     272,   272,   273,   273
-};
+#define YYPACT_NINF (-518)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
-       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
-       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
-       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
-       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
-       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
-       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
-       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
-       2,     2,     0,     2,     1,     0,     2,     0,     2,     1,
-       3,     0,     2,     1,     2,     1,     4,     1,     4,     1,
-       4,     3,     5,     3,     4,     4,     5,     0,     5,     4,
-       1,     1,     1,     4,     0,     6,     0,     7,     0,     2,
-       0,     3,     1,     0,     2,     3,     5,     4,     4,     5,
-       7,     6,     0,     1,     1,     1,     0,     1,     1,     2,
-       3,     3,     4,     3,     1,     1,     2,     4,     3,     5,
-       1,     3,     2,     0,     3,     2,     0,     9,     1,     3,
-       1,     1,     0,     1,     1,     2,     1,     1,     1,     1,
-       1,     1,     3,     5,     1,     3,     5,     4,     3,     1,
-       0,     1,     3,     1,     6,     3,     4,     6,     3,     2,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     5,     4,     1,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     4,     3,
-       2,     0,    10,     1,     0,     4,     3,     4,     1,     2,
-       4,     6,     5,     6,     6,     6,     6,     4,     1,     1,
-       3,     2,     1,     3,     2,     1,     1,     4,     1,     2,
-       0,     2,     0,     2,     3,     0,     1,     1,     0,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     2,     1,     1,     3,     2,     2,     2,     4,     1,
-       3,     1,     1,     1,     3,     2,     1,     3,     3,     0,
-       2,     0,     1,     5,     3,     3,     1,     1,     1,     1,
-       1,     1,     5,     1,     2,     0,     3,     3,     0,     1,
-       2,     3,     3,     1,     1,     1,     1,     2,     1,     4,
-       4,     1,     1,     4,     0,     1,     1,     1,     4,     4,
-       1,     1,     3,     1,     2,     3,     1,     1,     4,     0,
-       0,     2,     5,     3,     3,     1,     6,     4,     4,     2,
-       2,     2,     1,     2,     1,     4,     3,     3,     6,     3,
-       1,     1,     1,     4,     4,     2,     2,     4,     2,     2,
-       1,     3,     3,     3
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       4,     0,     2,     1,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   268,     0,
-       0,    79,   296,     0,   292,     0,     0,   295,   291,     0,
-       0,     0,   282,   294,     0,     0,   298,   253,     0,     0,
-       0,     0,    51,    84,     0,   293,     0,   290,   297,     0,
-     299,     0,     0,     0,     5,   311,     0,     0,     0,     0,
-       0,   352,     0,    27,     0,    57,   285,   363,     0,   313,
-       3,     0,     7,    32,     8,     9,    69,    70,     0,     0,
-     328,    71,   345,     0,   316,   247,     0,   327,     0,   329,
-       0,   348,     0,   333,   344,   346,   351,     0,   237,   312,
-     268,     0,     5,    71,   399,   398,     0,   396,   395,   250,
-     221,   222,   223,   224,   244,   243,   242,   241,   240,   239,
-     238,     0,     0,   269,     0,   204,   331,     0,   202,   246,
-     189,     0,     0,   269,   275,   288,   276,     0,   278,   346,
-       0,    81,    80,   150,     0,   370,    41,     0,     0,    43,
-       0,     0,     0,     0,   179,     0,     0,   245,   180,     0,
-     145,     0,     0,   144,     0,     0,     0,     0,   369,     0,
-      14,     0,   315,    45,   328,     0,   329,     0,     0,     0,
-     301,   384,     0,   382,    33,     0,     0,    27,     0,     0,
-      20,     0,    19,     0,     0,     0,   286,     0,   287,     0,
-       0,     0,     0,   136,     0,    17,    82,    85,    72,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    52,   203,   201,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   136,     0,     0,   354,     0,   364,   347,     0,
-       0,     0,   271,     0,     0,     0,   271,     0,   136,   188,
-       0,     0,   347,     0,     0,    49,     0,   375,     0,   321,
-      42,     0,    44,     0,     0,     0,     0,    50,     0,   283,
-       0,     0,   181,   183,   328,   329,     0,   146,   329,     0,
-      48,    60,     0,     0,   400,     0,     0,   367,     0,   366,
-     314,     4,    12,    11,   136,    46,    47,     0,   311,     0,
-     300,   383,     0,     0,   381,   318,   380,     0,    59,     0,
-       0,    66,    68,    22,     0,     0,    16,     0,     0,    34,
-      26,    28,    29,    30,   234,   249,     0,   317,     6,     0,
-       0,   135,   328,   329,     0,     0,    87,     0,    77,     0,
-     132,   402,   341,   339,     0,   207,   209,   208,     0,     0,
-     205,   206,   210,   212,   211,   226,   225,   228,   227,   229,
-     231,   232,   230,   220,   219,   214,   215,   213,   216,   217,
-     218,   233,     0,   185,   200,   199,   198,   197,   196,   195,
-     194,   193,   192,   191,   190,     0,   403,   342,   361,     0,
-     357,   338,   356,   360,   355,     0,     0,   397,   270,     0,
-       0,   270,   341,     0,   342,   280,     0,     0,     0,     0,
-       0,     0,   303,     0,   302,   151,   309,   148,   379,   330,
-       0,   248,   322,   371,    25,     0,     0,     0,     0,   178,
-     394,   284,   180,     0,     0,     0,     0,   143,    10,     0,
-       0,   393,   369,   369,     0,   136,     0,     4,     0,   389,
-       0,   387,   391,   390,   392,     0,   386,     0,     0,     0,
-       0,     0,    21,    18,     0,     0,   353,   139,   260,     0,
-       0,     0,     0,   272,    83,     0,    75,    86,    89,     0,
-     132,   134,     0,   122,     0,   133,   136,   136,   340,   236,
-       0,     0,   186,   267,   136,   136,     0,   136,   335,   354,
-       0,   349,   350,   289,   277,   306,   307,   319,     0,   305,
-       0,     0,     0,     0,   374,     0,   373,   101,     0,    27,
-      99,    56,     0,     0,   182,    91,     0,    91,    93,   147,
-      27,   114,   401,     0,   365,     0,     0,    15,     0,   262,
-       0,   385,   107,   107,    40,     0,    67,    53,    23,    27,
-     112,    37,     0,     0,   328,   329,    24,     0,   274,    88,
-       0,     0,   153,     0,   254,   132,     0,   124,     0,     0,
-     235,   288,     0,     0,   362,     0,   332,     0,     0,     0,
-     279,   326,     0,   321,   304,   310,   149,   378,   377,     0,
-       0,     0,     0,   180,     0,     0,    94,     0,   116,   118,
-     368,   184,   261,    13,     0,   107,     0,   107,     0,     0,
-       0,    31,   142,   273,   153,    90,   162,    73,     0,     0,
-       0,   125,     0,   263,   264,   187,   265,   266,   337,     0,
-     334,   358,   359,   281,     0,   308,   322,   320,     0,   372,
-     102,     0,    38,     0,    92,     0,     0,   120,     0,     0,
-      35,   388,     0,     0,     0,     0,     0,   103,     0,     0,
-     162,   166,   167,   168,   171,   170,   169,     0,   161,    78,
-     152,     0,     0,   160,   164,     0,     0,     0,   251,     0,
-     128,     0,   127,   338,   325,   324,   376,   100,     0,    27,
-      97,    55,    54,     0,     0,     0,     0,   119,     0,     0,
-     110,   111,    27,   105,   104,     0,   113,    76,     0,   174,
-       0,    71,   165,     0,   155,    27,     0,   258,     0,    27,
-     129,     0,   126,   336,     0,    27,    95,    39,     0,     0,
-      27,     0,     0,   106,    27,   109,     0,     0,     0,     0,
-     154,     0,     0,     0,   259,     0,   255,     0,     0,   131,
-     323,     0,     0,     0,   121,    36,     0,   108,    27,   177,
-     175,   172,     0,     0,    74,     0,   256,   252,   130,     0,
-      98,     0,   115,     0,     0,   132,   176,   257,    96,    27,
-      62,   173,     0,   117,     0,    58,    61,    63,   156,     0,
-      64,     0,     0,    27,   158,   157,     0,     0,     0,   159,
-      27,     0,    65
-};
+#define YYTABLE_NINF (-346)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,     2,    79,    80,   477,   321,   201,   202,    81,
-     204,   350,   351,    83,   815,   816,   817,   340,   341,   352,
-     353,   219,    86,   706,    87,   590,   509,    88,   366,    89,
-     368,   506,   507,   625,   557,   757,   721,   551,   294,   574,
-     636,   732,   581,   629,   677,   680,   725,   512,   513,   514,
-     360,   361,   172,   173,   154,   646,   700,   821,   825,   701,
-     702,   703,   704,   740,   705,   163,   301,   302,    90,   749,
-     113,   649,   748,    92,    93,   515,   145,   146,   534,   610,
-     167,   207,   279,    94,   445,   446,    95,   612,   453,   613,
-      96,    97,   448,    98,    99,   606,   660,   528,   100,   101,
-     102,   103,   104,   105,   106,   425,   421,   422,   423,   107,
-     318,   319,   288,   289,   192,   193,   485,   108,   315,   109
-};
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -509
 static const yytype_int16 yypact[] =
 {
-    -509,    55,  1835,  -509,  6058,  6058,   -33,  6058,  6058,  6058,
-    6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,
-    6058,   309,   309,  6058,  6058,   345,    77,    80,    58,    65,
-    1336,  -509,  -509,    94,  -509,  4685,    85,  -509,  -509,  4535,
-    6058,   109,   138,  -509,   147,   152,  -509,  -509,   -90,   178,
-     170,   174,  -509,  -509,   183,  -509,   186,  -509,  -509,    70,
-    -509,   191,  4809,   224,   310,  -509,   200,  6058,   207,   218,
-     100,  -509,   232,  -509,  6058,  -509,   252,   235,   378,    54,
-    -509,     9,  -509,  -509,  -509,  -509,  -509,  -509,   249,   250,
-    -509,   364,  -509,   269,  -509,  -509,  1480,  -509,   220,  1234,
-     255,  -509,   277,   275,  -509,   -30,  -509,   -61,  -509,  -509,
-    -509,   283,  -509,   364,  7215,  7215,  6058,  7215,  7215,  1671,
-    -509,  -509,   366,  -509,  -509,  -509,  -509,  -509,  -509,  -509,
-    -509,   292,   191,   -75,   291,  -509,  -509,   300,  -509,  -509,
-    -509,   308,   191,   315,   316,   299,  -509,   319,   324,    60,
-     -61,  -509,  -509,   446,    15,  4933,  -509,  6351,   450,  -509,
-    6392,   333,   325,    16,  7215,   309,  5057,  -509,  6058,  6058,
-    -509,    82,    17,  -509,   331,   342,  6058,   309,   272,   191,
-    -509,    97,    67,  -509,   332,  7215,   354,   309,  6182,   123,
-    -509,   -32,   240,  -509,  -509,  6058,  6433,  -509,   309,   191,
-      -8,    18,  -509,  6058,  1985,  6474,   124,   348,   436,  6058,
-     124,   105,   367,  5181,   374,  -509,   386,   405,  -509,   -63,
-     211,  6058,  6058,  6058,  5314,  6058,  6058,  6058,  6058,  6058,
-    6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,
-    6058,  6058,  6058,  6058,  6058,  6058,   345,  -509,  -509,  -509,
-    5438,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,  6058,
-    6058,  6058,  5181,   311,   265,  6058,  6058,   235,   -25,   369,
-    6515,   191,   -69,   349,   351,   191,   315,   103,  5181,  -509,
-     103,   265,   -22,   873,   371,  -509,   309,  7092,   370,   509,
-    -509,   873,  -509,   506,    22,   377,  6058,  -509,   384,  -509,
-    6556,   376,   525,  7215,   461,  1543,  6058,  -509,  -509,   -90,
-    -509,  -509,   387,  6598,  -509,    24,   392,  -509,    29,  -509,
-     151,  -509,  -509,  -509,  5181,  -509,  -509,   395,   481,  6846,
-    -509,  -509,   221,   413,  -509,  -509,  -509,  6639,  -509,  2135,
-      33,  -509,  -509,    50,   414,   100,  -509,  6680,   403,  -509,
-    -509,  -509,  -509,  -509,  -509,  -509,  6887,  -509,  -509,   309,
-     410,   543,    36,    89,   546,   -41,   444,   -41,  -509,   421,
-     115,   429,   430,   -22,   -61,  7255,  7292,  1671,  6058,  7174,
-    1970,  2119,  2268,  2417,  2566,  2716,  2716,  2716,  2716,  2862,
-    1289,  1175,  1175,   598,   598,   391,   391,   391,   366,   366,
-     366,  -509,   189,  1671,  1671,  1671,  1671,  1671,  1671,  1671,
-    1671,  1671,  1671,  1671,  1671,   432,   434,   435,  -509,  6058,
-    -509,   437,    14,  -509,  7215,   433,  6928,  -509,   -68,   429,
-     434,   315,  -509,   440,  -509,  -509,   873,   873,   442,   466,
-     191,    92,   -44,   468,  -509,  -509,  -509,   584,  -509,  -509,
-    5562,  -509,  5686,  -509,  -509,   873,   467,  3785,  6058,  7215,
-    -509,  -509,  6058,  6058,   309,   190,  6969,  -509,  -509,  3935,
-     309,  -509,   272,   272,   587,  5181,  1535,  -509,   454,  -509,
-    6058,  -509,  -509,  -509,  -509,   452,  -509,     7,   528,   309,
-     464,   469,  -509,  -509,  4085,   472,  -509,  -509,  -509,  5810,
-     873,   488,   191,   315,  -509,   -41,  -509,   609,  -509,   476,
-     115,  -509,   474,   616,   -11,  -509,  5181,  5181,   -22,  1821,
-    6058,   345,  -509,  -509,  5181,  5181,  7010,  5181,  -509,  6058,
-    6058,  -509,  -509,  -509,   499,  -509,  -509,   873,   191,    25,
-     529,   500,   873,   309,  7215,   309,  7133,  -509,   620,  -509,
-    -509,  -509,  6722,   486,  7215,   551,   309,   551,  -509,  -509,
-    -509,  -509,  -509,    38,  -509,  6058,   501,  -509,  1685,  -509,
-    1151,  -509,   502,   504,  -509,   507,  -509,  -509,  -509,  -509,
-    -509,  -509,   508,   309,    39,   120,  -509,   191,   315,   609,
-     510,   -41,  -509,   511,   518,   -35,   519,   647,   514,   515,
-    1821,   299,   516,   520,  -509,   521,   539,   522,  7051,   265,
-    -509,   576,   524,   665,   127,  -509,  -509,  -509,  -509,  5934,
-     873,  2285,   530,  6058,   190,   526,  -509,   533,  3635,   242,
-    -509,  1671,  -509,  -509,   532,  -509,    -3,  -509,   -27,   -41,
-    2435,  -509,  -509,   315,  -509,  -509,   320,  -509,   536,   540,
-     -10,   671,   873,  -509,  -509,  -509,  -509,  -509,  -509,   265,
-    -509,  -509,  -509,  -509,   873,  -509,   873,  -509,   309,  7215,
-    -509,   537,  -509,   541,  -509,  4235,  4235,   293,   544,  4535,
-    -509,  -509,   187,  6058,    -4,   545,   -21,  -509,   548,   547,
-     358,  -509,  -509,  -509,  -509,  -509,  -509,   558,  -509,  -509,
-    -509,   556,   588,   485,  -509,    19,   557,     4,  -509,   559,
-     690,   873,  -509,   437,  -509,   610,  -509,  -509,  4385,  -509,
-    -509,  -509,  -509,   560,   680,   642,  6058,  -509,   562,  6310,
-    -509,  -509,  -509,  -509,  -509,   561,  -509,  -509,   699,   700,
-      20,   364,  -509,   580,  -509,  -509,   573,  -509,    41,  -509,
-     703,   873,  -509,  -509,   873,  -509,  -509,  -509,  2585,  6058,
-    -509,   568,  6763,  -509,  -509,  3635,   575,   873,   873,   579,
-    -509,   589,   705,  2735,  -509,    11,  -509,  2885,   873,  -509,
-    -509,  3035,   577,  6804,  3635,  -509,  4535,  3635,  -509,  -509,
-    -509,   709,   581,   873,  -509,   582,  -509,  -509,  -509,   578,
-    -509,   704,  -509,  3185,   873,   115,  -509,  -509,  -509,  -509,
-     651,  -509,   585,  3635,   593,  -509,   651,  -509,  -509,   -41,
-    -509,   -57,   590,  -509,  -509,  -509,   586,  3335,   591,  -509,
-    -509,  3485,  -509
+    -518,    51,  1468,  -518,  -112,  7996,  7996,  7996,  7996,  7996,
+      79,   -66,  7996,  7996,  7432,  -518,  -518,  7996,    -6,  -518,
+    7573,   399,   -16,  -518,  -518,  4876,  7996,  7996,   -10,    31,
+      76,  -518,   171,    97,   130,  -518,  -518,    84,   100,   133,
+     154,   399,  7996,  7996,  -518,  7996,  -518,   174,  -518,   177,
+    -518,  -518,   -38,   505,  -518,   187,  7996,  7996,  7996,  7996,
+    7714,   168,    81,   323,  7996,  -518,   194,  7996,   202,   218,
+    7996,   -37,  -518,   227,  -518,  7996,  -518,    75,   231,   201,
+     -34,  -518,    12,  -518,  -518,  -518,  -518,  -518,  -518,   255,
+     258,  -518,   382,  -518,   278,  -518,  -518,  5261,  -518,     8,
+    1237,   251,  -518,   286,   294,  -518,    -5,  -518,   156,  -518,
+    -518,  -518,   302,  -518,  -518,   382,  -518,  -518,   326,  -518,
+    -518,  -518,  5548,  -518,  -518,  -518,  5360,  -518,   412,  -518,
+    5389,   312,   187,   -49,   307,  -518,  -518,   309,   293,   288,
+    -518,    16,  8437,   399,  7996,  7855,  -518,  -518,  7996,  7996,
+    -518,   308,    20,  -518,   279,   283,  7996,  -518,  8437,  8437,
+    -518,   399,   269,   187,  -518,   -54,   325,   187,   335,   329,
+     300,  -518,   336,   342,    13,   156,   -30,  -518,  8590,  8437,
+    8437,  -518,   311,  8437,   876,   399,  8132,   193,  -518,    63,
+     226,  -518,   453,    22,  -518,  -518,  7996,  5488,  -518,   399,
+    -518,   187,    24,    27,  -518,  7996,  2462,  6512,    99,   313,
+     243,  7996,    99,    95,   327,  5684,   346,  -518,   410,   413,
+    -518,   -48,   -35,  5084,  7996,  7996,  7996,  7996,  7996,  7996,
+    7996,  7996,  7996,  7996,  7996,  7996,  7996,   505,  7996,  7996,
+    7996,  7996,  7996,  7996,  7996,  7996,  7996,  7996,  7996,  -518,
+    -518,  -518,  5820,  7996,  7996,  7996,  7996,  7996,  7996,  7996,
+    7996,  7996,  7996,  7996,  5684,   153,   252,  7996,  7996,   231,
+       6,   345,   399,  8280,   348,   491,  -518,  1343,  -518,   187,
+     -43,   182,   254,   493,    19,   354,  7996,  -518,   350,  6541,
+    -518,  6640,   361,   504,  8437,   485,   879,  7996,  -518,  -518,
+      84,  -518,  -518,   363,  6669,  -518,    37,   366,  -518,    38,
+    -518,   -24,  -518,  -518,  -518,   187,   335,   165,  5684,  -518,
+     165,   252,    36,  5684,  -518,  -518,   368,   494,  7053,  -518,
+    -518,   128,   385,  -518,  -518,  -518,  1343,   378,  -518,  6768,
+    -518,  2604,    40,  -518,  -518,    48,   390,   -37,  -518,  6797,
+     375,  -518,  -518,  -518,  -518,  -518,  -518,  -518,  7152,  -518,
+    -518,   399,   383,   520,    41,  1088,   522,    -1,   456,    -1,
+    -518,   392,    32,   394,   396,    36,   156,  7996,  8309,  8679,
+    8710,  1283,  5045,  5297,    61,    61,    61,   326,   326,   326,
+    8654,  8559,  -518,  8721,   881,  8721,  8721,  8721,   881,  8590,
+    8464,  8491,   347,   347,   358,  8590,  8590,  8590,  8590,  8590,
+    8590,  8590,  8590,  8590,  8590,  8590,  8590,   397,   400,   402,
+    -518,  7996,  -518,   404,    52,  -518,  8437,   391,  7181,  -518,
+    -518,  5956,  -518,  6092,  -518,  1343,  1343,   405,   444,   187,
+     235,   155,   438,  -518,  -518,  -518,   -29,   394,   400,  1343,
+     426,  4166,  7996,  8437,  -518,  -518,  -518,  7996,  7996,   399,
+     205,  7210,  -518,  -518,  4308,   399,  -518,   269,   269,   554,
+    5684,  1894,  -518,   335,  -518,   414,  -518,  -518,   415,  -518,
+    7996,  -518,  -518,  -518,  -518,   407,  -518,  -518,   557,    14,
+     534,   399,   425,   447,  -518,  -518,  4450,   427,  -518,  -518,
+    -518,  6228,  1343,   472,   187,   335,  -518,    -1,  -518,   581,
+    -518,   440,    32,  -518,   439,   583,    50,  -518,  5684,  5684,
+      36,  8614,  7996,   505,  -518,  -518,  5684,  5684,  7309,  5684,
+    -518,  7996,  7996,  -518,  -518,   399,  8437,   399,  8338,  -518,
+    -518,  1343,   187,   199,   525,   459,  -518,   588,  -518,  -518,
+    -518,  6896,   446,  8437,   539,   399,   539,  -518,  -518,  -518,
+    -518,  -518,    44,  -518,  7996,   449,  -518,  2036,  -518,   486,
+    -518,  5024,  -518,  1343,   450,   451,  -518,   457,  -518,  -518,
+    -518,  -518,  -518,  -518,   458,   399,    45,  1164,  -518,   187,
+     335,   581,   463,    -1,  -518,   467,   477,    18,   476,   615,
+     473,   478,  8614,   300,   479,   480,  -518,   482,   508,   489,
+    7338,  -518,  -518,  6364,   578,   490,   636,   216,  -518,  1343,
+    2746,   500,  7996,   205,   495,  -518,   503,  2178,   324,  -518,
+    8590,  -518,  -518,   252,  -518,   509,  -518,  -518,   192,  -518,
+      55,    -1,  2888,  -518,  -518,   335,  -518,  -518,   250,  -518,
+     510,   514,    54,   659,  1343,  -518,  -518,  -518,  -518,  -518,
+    -518,   252,  -518,  -518,  -518,   399,  8437,  1343,  -518,  1343,
+    -518,  -518,   515,  -518,   517,  -518,  4592,  4592,   351,  4876,
+     519,  -518,  -518,  -518,   209,  7996,     7,   518,    56,  -518,
+     527,   524,   316,   526,  -518,   540,  -518,  -518,  -518,  -518,
+    -518,  -518,  -518,  -518,   533,   601,    88,  -518,    28,   537,
+      58,  -518,   538,   674,  1343,  -518,   404,  -518,  -518,   630,
+    -518,  4734,  -518,  -518,  -518,  -518,   679,   541,   621,  -518,
+    7996,   543,  5232,  -518,  -518,  -518,  -518,  -518,   542,  -518,
+    -518,  -518,   685,   689,    30,   382,  -518,   563,  -518,  -518,
+     555,  -518,    46,  -518,   691,  1343,  -518,  -518,  1343,  -518,
+    -518,  -518,  3030,  -518,  7996,   549,  6925,  -518,  -518,  1610,
+     556,  1343,  1343,   558,  -518,   569,   698,  3172,  -518,    59,
+    -518,  3314,  1343,  -518,  -518,  3456,   559,  3598,  7024,  -518,
+    4876,  1752,  -518,  -518,  -518,   700,   560,  1343,  -518,   565,
+    -518,  -518,  -518,   561,  -518,   703,  -518,  3740,  1343,    32,
+    -518,  -518,  -518,  -518,   678,  -518,   564,  2320,   566,  -518,
+     678,  -518,  -518,    -1,  -518,   228,   574,  -518,  -518,  -518,
+     568,  3882,   572,  -518,  -518,  4024,  -518
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       4,     0,     0,     1,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    80,   298,     0,     0,   294,
+       0,     0,     0,   297,   293,     0,     0,     0,     0,     0,
+     284,   296,     0,     0,     0,   300,   255,     0,     0,     0,
+       0,     0,     0,     0,    52,     0,    85,     0,   295,     0,
+     292,   299,     0,     0,   301,     0,     0,     0,     0,     0,
+       0,     0,   270,     5,     0,   313,     0,     0,     0,     0,
+       0,     0,   354,     0,    27,     0,    58,   287,   365,     0,
+     315,     3,     0,     7,    32,     8,     9,    70,    71,     0,
+       0,   330,    72,   347,     0,   318,   249,     0,   329,     0,
+     331,     0,   350,     0,   335,   346,   348,   353,     0,   239,
+     314,    34,     0,   270,     5,    72,   223,   224,   225,   226,
+     248,    81,   372,   243,   245,    42,     0,   191,     0,    44,
+       0,     0,     0,   271,     0,   206,   333,     0,     0,     0,
+     241,     0,   181,     0,     0,     0,   247,    82,   182,     0,
+     146,     0,     0,   145,     0,     0,     0,   204,   397,   398,
+     240,     0,   371,     0,    14,     0,     0,     0,   271,   277,
+     290,   278,     0,   280,   348,     0,   317,   244,   252,   400,
+     401,    46,   330,     0,   331,     0,     0,     0,   303,   386,
+       0,   384,   151,     0,    33,   242,     0,     0,    27,     0,
+     246,     0,    20,     0,    19,     0,     0,     0,   288,     0,
+     289,     0,     0,     0,     0,   137,     0,    17,    83,    86,
+      73,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    53,
+     205,   203,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   137,     0,     0,   356,     0,   366,
+     349,     0,     0,   377,     0,   323,    43,     0,    45,     0,
+     273,     0,     0,     0,     0,     0,     0,    51,     0,     0,
+     285,     0,     0,   183,   185,   330,   331,     0,   147,   331,
+       0,    49,    61,     0,     0,   402,     0,     0,   369,     0,
+     368,   316,     4,    12,    11,     0,   273,     0,   137,   190,
+       0,     0,   349,   137,    47,    48,     0,   313,     0,   302,
+     385,     0,     0,   383,   320,   382,     0,     0,    50,     0,
+      60,     0,     0,    67,    69,    22,     0,     0,    16,     0,
+       0,    35,    26,    28,    29,    30,   236,   251,     0,   319,
+       6,     0,     0,   136,   330,   331,     0,     0,    88,     0,
+      78,     0,   133,   404,   343,   341,     0,     0,     0,   212,
+     214,   213,   231,   233,   216,   217,   215,   218,   219,   220,
+     208,   207,   235,   229,   234,   227,   230,   228,   232,   210,
+     209,   211,   221,   222,     0,   187,   198,   196,   195,   193,
+     197,   194,   199,   192,   201,   202,   200,     0,   405,   344,
+     363,     0,   359,   340,   358,   362,   357,     0,     0,   381,
+     332,     0,   250,   324,   373,     0,     0,     0,     0,     0,
+       0,   305,     0,   304,    25,   311,   272,     0,     0,     0,
+       0,     0,     0,   180,   396,   399,   286,   182,     0,     0,
+       0,     0,   144,    10,     0,     0,   395,   371,   371,     0,
+     137,     0,     4,   272,   343,     0,   344,   282,     0,   391,
+       0,   389,   393,   392,   394,     0,   388,   152,   149,     0,
+       0,     0,     0,     0,    21,    18,     0,     0,   355,   140,
+     262,     0,     0,     0,     0,   274,    84,     0,    76,    87,
+      90,     0,   133,   135,     0,   123,     0,   134,   137,   137,
+     342,   238,     0,     0,   188,   269,   137,   137,     0,   137,
+     337,   356,     0,   351,   352,     0,   376,     0,   375,   308,
+     309,   321,     0,   307,     0,     0,   102,     0,    27,   100,
+      57,     0,     0,   184,    92,     0,    92,    94,   148,    27,
+     115,   403,     0,   367,     0,     0,    15,     0,   291,   279,
+     264,     0,   387,     0,   108,   108,    41,     0,    68,    54,
+      23,    27,   113,    38,     0,     0,   330,   331,    24,     0,
+     276,    89,     0,     0,   154,     0,   256,   133,     0,   125,
+       0,     0,   237,   290,     0,     0,   364,     0,   334,     0,
+       0,   380,   379,     0,   328,     0,   323,   306,   312,     0,
+       0,     0,   182,     0,     0,    95,     0,     0,   119,   370,
+     186,   263,    13,     0,   281,     0,   150,   108,     0,   108,
+       0,     0,     0,    31,   143,   275,   154,    91,     0,    74,
+       0,     0,     0,   126,     0,   265,   266,   189,   267,   268,
+     339,     0,   336,   360,   361,     0,   374,     0,   310,   324,
+     322,   103,     0,    39,     0,    93,     0,     0,   121,     0,
+       0,    36,   283,   390,     0,     0,     0,     0,     0,   104,
+       0,     0,     0,     0,   172,     0,   173,   170,   169,   168,
+     171,   163,    79,   153,     0,     0,   162,   166,     0,     0,
+       0,   253,     0,   129,     0,   128,   340,   378,   327,   326,
+     101,     0,    27,    98,    56,    55,     0,     0,     0,   120,
+       0,     0,     0,   111,   112,    27,   106,   105,     0,   114,
+      77,   159,     0,   176,     0,    72,   167,     0,   156,    27,
+       0,   260,     0,    27,   130,     0,   127,   338,     0,    27,
+      96,    40,     0,    27,     0,     0,     0,   107,    27,     0,
+       0,     0,     0,     0,   155,     0,     0,     0,   261,     0,
+     257,     0,     0,   132,   325,     0,     0,     0,     0,    37,
+       0,     0,    27,   179,   177,   174,     0,     0,    75,     0,
+     258,   254,   131,     0,    99,     0,   116,     0,     0,   133,
+     178,   259,    97,    27,    63,   175,     0,     0,     0,    59,
+      62,    64,   157,     0,    65,     0,     0,    27,   160,   158,
+       0,     0,     0,   161,    27,     0,    66
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -509,  -509,  -302,   -16,  -509,  -509,  -509,  -509,   397,  -509,
-      12,  -509,     1,  -509,  -509,  -509,   -73,  -509,   256,     2,
-       6,  -111,  -509,  -509,  -509,  -509,  -509,  -509,  -509,  -509,
-    -509,  -509,   241,   192,   129,  -509,    71,  -509,  -509,  -509,
-    -508,    26,  -509,  -509,  -509,  -509,  -509,  -495,  -509,   159,
-    -244,  -509,  -509,   449,  -509,   116,  -509,  -509,  -509,  -509,
-    -509,  -509,    56,  -509,  -509,  -509,  -449,  -509,   426,  -509,
-      -2,  -509,  -509,  -509,    73,  -355,  -232,  -509,  -509,  -509,
-    -509,  -509,   163,   128,   492,  -509,  -509,  -509,   153,  -509,
-     845,   594,  -348,   339,   950,  -509,  -509,    57,  -204,  -509,
-      42,  -509,   -24,    23,  -509,   239,  -274,  -509,  -509,    28,
-     297,   301,  -509,  -509,   217,   401,  -509,  -509,  -509,  -509
+    -518,  -518,  -302,   -17,  -518,  -518,  -518,  -518,   371,  -518,
+    -180,  -518,     4,  -518,  -518,  -518,  -101,  -518,   229,    10,
+      15,  -114,  -518,  -518,  -518,  -518,  -518,  -518,  -518,  -518,
+    -518,  -518,   214,   167,   101,  -518,    49,  -518,  -518,  -518,
+    -517,    -4,  -518,  -518,  -518,  -518,  -518,  -507,  -518,   132,
+    -253,  -518,  -518,   430,  -518,    85,  -518,  -518,  -518,  -518,
+    -518,  -518,    21,  -518,  -518,  -518,  -448,  -518,   143,  -518,
+      -2,  -518,  -518,  -518,    68,  -341,  -230,  -518,  -518,  -518,
+    -518,  -518,   129,    -9,   634,  -518,  -518,  -518,   120,  -518,
+     804,   589,  -322,    91,   693,  -518,  -518,    23,  -220,  -518,
+      11,  -518,   -50,   -39,  -518,   211,  -313,  -518,  -518,   -32,
+     276,   277,  -518,  -518,   233,   141,  -518,  -518,  -518,  -518
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    80,    81,   472,   312,   203,   204,    82,
+     206,   352,   353,    84,   819,   820,   821,   342,   343,   354,
+     355,   221,    87,   709,    88,   592,   511,    89,   368,    90,
+     370,   508,   509,   624,   556,   761,   724,   550,   284,   576,
+     638,   735,   583,   628,   678,   681,   728,   514,   515,   516,
+     362,   363,   152,   153,   193,   648,   703,   825,   829,   704,
+     705,   706,   707,   744,   708,   141,   292,   293,    91,   753,
+     115,   651,   752,    93,    94,   517,   170,   171,   569,   634,
+     146,   209,   319,    95,   444,   445,    96,   615,   434,   616,
+      97,    98,   429,    99,   100,   608,   662,   530,   101,   102,
+     103,   104,   105,   106,   107,   427,   423,   424,   425,   108,
+     309,   310,   274,   275,   190,   191,   485,   109,   306,   110
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -344
 static const yytype_int16 yytable[] =
 {
-      91,   148,   269,    82,    84,   133,   133,   435,    85,   143,
-     504,   497,   508,   553,   401,   593,   372,   214,   415,   476,
-     596,   709,   730,   284,   296,   309,   345,   743,   769,   332,
-     456,   265,   470,   572,   433,   746,   265,   473,   511,   265,
-     162,   489,   795,   181,  -137,   182,   473,  -140,   149,   775,
-     683,   212,   170,   150,   200,     3,   683,   212,   212,   417,
-     420,   171,   684,   137,   137,   638,   344,   147,   684,   372,
-     417,   369,   213,   432,   683,   529,   434,   420,   324,   475,
-     478,    71,   212,   501,   370,   502,   684,  -269,   823,   501,
-     267,   502,   824,   112,   134,   134,   333,  -138,   144,   112,
-     685,  -343,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,   259,   260,   261,   116,   266,   272,  -339,   212,   687,
-     266,   265,  -340,   266,   491,   734,   276,   682,  -141,   686,
-     268,   597,   710,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   731,   747,  -331,  -331,   133,
-     508,   212,   573,   796,   110,   133,  -271,   151,   215,   530,
-     152,   133,   133,   320,   285,   297,   310,   346,   744,   770,
-     457,   133,   471,   282,   673,   568,   212,   474,  -331,  -331,
-     212,   490,   133,   343,  -137,  -269,   630,  -140,   511,   776,
-     540,  -343,   187,   212,   190,   617,   179,   618,  -271,   188,
-     153,   213,    91,   334,   112,   266,   131,   137,   132,   339,
-     187,   187,   155,   137,   324,   180,   112,   188,   188,   137,
-     137,   556,   148,   212,    71,   330,   199,   306,   158,   137,
-     143,   566,   161,    77,   112,   642,   645,  -138,   134,   501,
-     137,   502,   322,   373,   134,    71,   323,   191,   374,   112,
-     134,   134,   521,   212,    77,   428,   165,   357,  -270,   431,
-     134,   110,   110,  -123,   683,   191,   191,   442,  -141,   149,
-     133,   134,   598,   599,   150,   442,   684,   212,   248,   249,
-     602,   603,  -270,   605,   688,   166,   373,   373,   147,   601,
-     728,   374,   374,   208,   168,   211,   373,   373,   475,   169,
-     373,   374,   374,   373,   373,   374,   678,   679,   374,   374,
-     812,   187,   174,   131,   131,   132,   132,   175,   188,   144,
-     716,   176,   189,   112,   112,   112,   190,   187,   137,   200,
-     177,    71,    71,   178,   188,   663,   194,    91,   334,   187,
-      77,    77,   335,   133,   110,   371,   188,   195,   482,   503,
-     206,   503,   197,    71,   503,   483,   443,   723,   724,   134,
-     135,   138,    77,   484,   443,   198,   191,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   203,
-     209,   110,   191,   216,   217,   713,   133,   691,   692,   693,
-     694,   695,   696,   316,   191,   218,   131,   518,   132,   418,
-     220,   137,   262,   264,   697,   420,   112,    71,   263,   179,
-     419,   444,  -331,  -331,    71,   246,    77,   110,   271,   444,
-     442,   442,   273,    77,   539,   691,   692,   693,   694,   695,
-     696,   274,   134,   131,   275,   132,   243,   244,   245,   442,
-     246,   212,   697,   112,   137,   416,   278,   277,   133,   133,
-     280,    71,   281,    71,   133,   420,   133,   133,   550,   283,
-      77,   698,    77,   291,   822,   187,   699,   293,   295,   141,
-     561,   142,   188,   133,    91,   134,   210,    82,    84,   112,
-     311,   325,    85,   429,   442,   430,   588,    71,   184,   503,
-     312,    71,   365,    71,   503,   580,    77,   148,   355,   698,
-      77,   358,    77,   326,   737,   143,   137,   137,   364,   443,
-     443,   367,   137,   447,   137,   137,   370,   452,   451,   455,
-     191,   442,   614,   187,   458,   462,   442,   133,   443,   133,
-     188,   137,   460,   463,   334,   464,   468,   134,   134,   472,
-     133,   479,   480,   134,   149,   134,   134,   486,   492,   150,
-     495,   499,   691,   692,   693,   694,   695,   696,   498,   500,
-     505,   621,   134,   147,   444,   444,    91,   133,   510,    82,
-      84,   643,   628,   443,    85,   503,   516,   517,   191,   503,
-     523,   524,   525,   444,   527,   137,   531,   137,   533,   537,
-     331,   640,   538,   336,   144,   304,  -163,   542,   137,   541,
-     565,   548,   569,   578,   442,   571,   575,   331,   133,   336,
-     443,   331,   336,   577,   587,   443,   134,   591,   134,    91,
-     582,   592,   594,   503,   595,   137,    91,   609,   444,   134,
-     771,   330,   373,   620,   615,   623,   442,   374,    91,   362,
-     240,   241,   242,   243,   244,   245,   624,   246,   442,   632,
-     442,   635,   133,   637,   639,   644,   134,   641,   648,   647,
-     652,   651,   653,   654,   656,   444,   137,   659,   657,   658,
-     444,   664,   665,   666,   675,   661,   720,   720,   681,   672,
-     727,   676,   373,   707,   711,   708,   717,   374,   362,   718,
-     735,   726,   738,   443,   733,   442,   736,   134,   739,    47,
-     741,   750,   745,   751,   362,   754,   760,   759,   761,   766,
-     137,   763,   767,   768,   772,   774,   778,   785,   793,   756,
-     788,   791,   804,   792,   807,   443,   800,   808,   805,   814,
-     809,   758,   826,   818,   828,   442,   830,   443,   442,   443,
-     819,   134,   493,   820,   765,   576,   589,   722,   444,   627,
-     362,   442,   442,   674,   650,   764,    91,   773,   467,   742,
-     690,   777,   442,    91,   655,   307,   667,   781,   607,   563,
-     753,    91,   784,     0,   564,    91,   787,   442,     0,    91,
-     444,     0,    91,   454,   443,    91,     0,   802,   442,   503,
-       0,     0,   444,     0,   444,     0,     0,     0,     0,     0,
-     803,    91,     0,   503,     0,     0,     0,     0,     0,     0,
-       0,    91,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   813,     0,     0,   443,    91,     0,   443,     0,    91,
-       0,     0,     0,     0,     0,   827,     0,     0,     0,   444,
-     443,   443,   831,     0,     0,     0,     0,     0,     0,   114,
-     115,   443,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   443,     0,   139,   140,
-       0,     0,     0,     0,     0,   157,     0,   443,     0,   444,
-     160,     0,   444,     0,     0,   164,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   444,   444,     0,     0,     0,
-       0,   362,     0,     0,     0,     0,   444,   185,     0,     0,
-       0,     0,   196,     0,     0,   436,   437,     0,     0,   205,
-       0,   444,     0,     0,     0,   584,     0,     0,   535,   536,
-       0,     0,   444,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   362,   362,     0,   110,   438,   547,     0,     0,
-     362,   362,     0,   362,    32,     0,     0,     0,    34,     0,
-       0,   270,     0,    37,    38,     0,     0,     0,     0,     0,
-       0,   136,   136,     0,     0,     0,     0,     0,     0,     0,
-      43,     0,     0,    46,     0,     0,     0,     0,     0,     0,
-       0,     0,   586,    55,     0,    57,    58,   439,    60,   440,
-     287,     0,     0,     0,     0,     0,   441,   112,     0,     0,
-       0,   300,   186,   303,   185,     0,     0,     0,     0,     0,
-       0,   313,     0,     0,     0,     0,     0,     0,     0,   611,
-       0,     0,     0,   329,   616,     0,     0,     0,     0,     0,
-     337,     0,     0,     0,     0,     0,     0,     0,   347,     0,
-       0,     0,     0,     0,   356,     0,     0,     0,   185,     0,
-       0,     0,     0,     0,     0,     0,   375,   376,   377,   379,
-     380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,     0,     0,     0,     0,   403,   404,   405,   406,   407,
-     408,   409,   410,   411,   412,   413,   414,   185,     0,     0,
-     424,   426,   670,     0,     0,   298,     0,     0,     0,   305,
-       0,   308,     0,   185,     0,     0,     0,   314,   317,     0,
-       0,     0,     0,     0,     0,     0,     0,   327,     0,     0,
-       0,   459,     0,     0,   712,     0,     0,     0,   342,     0,
-       0,   466,     0,     0,     0,     0,   714,     0,   715,     0,
-     221,   222,   223,   363,     0,     0,     0,     0,     0,   185,
-       0,     0,     0,     0,     0,     0,   224,     0,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,   752,     0,     0,     0,     0,     0,     0,
-       0,     0,   363,  -344,  -344,   238,   239,   240,   241,   242,
-     243,   244,   245,   519,   246,     0,     0,     0,   363,     0,
-       0,     0,     0,     0,     0,     0,   449,     0,     0,     0,
-       0,     0,     0,   779,     0,     0,   780,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   789,
-     790,     0,     0,     0,   526,     0,     0,     0,     0,     0,
-     798,     0,     0,     0,   363,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   806,     0,     0,     0,     0,
-       0,     0,  -331,  -331,     0,   544,   811,   546,     0,     0,
-       0,     0,     0,   552,   634,     0,     0,   303,   554,   449,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     185,     0,     0,     0,     0,   570,  -344,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     4,
-       5,     6,     7,     8,   185,     0,     0,     0,     9,     0,
-       0,     0,   522,     0,     0,     0,     0,     0,     0,     0,
-       0,   185,   185,     0,     0,   600,     0,     0,     0,   185,
-     185,     0,   185,     0,   424,   608,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   110,    29,
-     631,     0,     0,     0,   555,   558,     0,    32,     0,     0,
-     562,    34,   317,   317,     0,   363,    37,    38,     0,     0,
-       0,     0,     0,    41,     0,     0,     0,     0,     0,   342,
-       0,    42,     0,    43,     0,     0,    46,    47,     0,   585,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     0,   669,     0,   363,   363,   303,    63,
-     112,    65,     0,     0,   363,   363,     0,   363,    71,     0,
-       0,     0,     0,    74,     0,   156,    76,    77,    78,   221,
-     222,   223,     0,   449,     0,   449,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   626,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,   729,   246,
-       0,     0,     0,   449,     0,     0,     0,     0,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
-       0,     0,     0,     0,     0,     0,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,   259,   260,   261,     0,     0,
-       0,   762,     0,     0,   558,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,  -331,  -331,     0,   783,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,   465,   449,    33,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,   247,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,     0,    71,    72,     0,
-      73,   567,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,   224,     9,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,    33,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,     0,    71,    72,     0,
-      73,   633,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,    33,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   349,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   488,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,   671,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,   689,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,   782,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,  -344,  -344,
-    -344,  -344,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   794,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,  -344,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   797,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+      92,   271,   374,   173,   133,   595,    83,   392,   477,   552,
+     471,   417,    85,   733,   174,   216,   267,    86,   341,   286,
+     574,   175,   450,   300,   133,   337,   506,   267,   510,   139,
+     347,   747,   137,   773,   267,   165,   168,   111,   176,   499,
+     465,   468,   513,   491,  -138,   419,   422,   468,  -141,   779,
+     346,     3,   137,   250,   202,   214,   513,   267,   640,   598,
+     214,   374,   419,   712,   172,   475,   214,   750,   799,   270,
+     478,   163,   201,   531,   493,   214,   232,   233,   234,   214,
+     214,   122,  -271,   371,   331,   214,  -273,   685,   685,   134,
+     251,   313,  -272,   114,   114,   314,   373,   474,   215,   372,
+     476,   422,   686,   686,   323,   503,    72,   164,   504,   134,
+     694,  -345,   135,   215,   121,   280,    78,   323,   470,   185,
+     684,   169,   688,   470,   503,   128,   133,   504,   186,  -345,
+     114,   138,   157,   214,   133,   208,   322,   143,   503,   185,
+     268,   504,  -341,   185,   133,   133,   311,   237,   186,   114,
+     316,   268,   186,  -342,   137,   333,   734,   214,   268,   575,
+     696,   217,   137,   114,  -165,   287,   510,   451,   133,   301,
+     567,   338,   137,   137,   674,   332,   348,   748,   144,   774,
+    -124,   268,   133,   375,   345,   466,   469,   173,   492,  -138,
+     376,   599,   629,  -141,   780,   713,   137,   532,   174,   751,
+     800,   689,   737,   182,    92,   175,   147,   697,   698,   699,
+     137,   134,   185,   611,   555,   612,   189,   565,   700,   134,
+     168,   186,   192,   145,   685,   150,   375,   375,   187,   134,
+     134,   154,   188,   376,   376,   151,   189,   185,   482,   686,
+     189,   685,   375,   375,   148,   185,   186,   359,   172,   376,
+     376,   693,   647,   134,   186,   133,   686,   329,   687,   483,
+     441,   212,   446,   644,   214,   600,   601,   134,   443,   484,
+     185,  -271,   694,   604,   605,   731,   607,   149,   375,   186,
+     155,   375,   375,   137,   418,   376,   333,   185,   376,   376,
+     334,   695,   295,   603,    72,   544,   186,    72,   473,   188,
+     690,   156,   816,   333,    78,   169,    72,   269,   214,   189,
+     210,   131,   213,   447,   132,  -273,    78,   693,   114,   441,
+     682,   161,   696,    72,   162,   214,  -164,   443,   330,   194,
+     202,   335,  -272,    78,   189,   113,   114,   520,   694,    92,
+     134,   196,   189,   717,   133,   442,    72,   198,   716,   330,
+     505,   335,   505,   330,   335,   505,    78,   695,   364,   229,
+     230,   231,   232,   233,   234,   199,   307,   189,   620,   697,
+     698,   699,   137,   827,   205,   131,   211,   828,   132,   627,
+     700,   679,   680,   420,   189,   448,   218,   133,   696,   219,
+     701,   220,  -164,    72,   222,    72,   702,   421,   264,   113,
+     114,   642,   265,    78,   442,    78,   266,   364,   726,   727,
+      72,   163,   237,   422,   131,   137,   277,   132,   441,   441,
+      78,   279,   543,   281,   283,   282,   443,   443,   302,   134,
+     285,   303,   441,   237,   315,   697,   698,   699,   113,   114,
+     443,   422,   133,   133,   214,   317,   700,   318,   133,    72,
+     133,   133,   320,   297,   321,   549,   701,   336,   360,    78,
+     324,   364,   740,   357,   131,   523,   364,   132,   560,    92,
+     137,   137,   134,   173,   133,    83,   137,   366,   137,   137,
+     367,    85,   826,   369,   174,   441,    86,   590,   113,   114,
+     505,   175,   372,   443,   433,   505,   432,   449,   454,    72,
+     582,   452,   137,   442,   442,   131,   168,   458,   132,    78,
+     457,   459,   463,   467,   479,   480,   486,   442,   133,   488,
+     133,   494,   497,   501,   441,   617,   502,   134,   134,   113,
+     114,   500,   443,   134,   172,   134,   134,   507,   133,   512,
+      72,   518,   762,   519,   533,   525,   137,   526,   137,   527,
+      78,   529,   541,   542,   545,   769,   441,   547,   564,   134,
+     572,   573,   568,   570,   443,    92,   137,   577,   133,   777,
+     442,    83,   645,   781,   579,   584,   505,    85,   580,   785,
+     505,   589,    86,   787,   593,   594,   597,   596,   791,   329,
+     618,   169,   619,   623,   375,   622,   137,   631,   633,   637,
+     639,   376,   441,   134,   641,   134,   133,   643,   646,   442,
+     443,   166,   807,   364,   167,   649,   650,   653,    92,   654,
+     661,   655,   375,   134,   505,    92,   656,   658,   659,   376,
+     660,   775,   667,   817,   137,   113,   114,   441,   668,   669,
+      92,   442,   663,   676,   586,   443,    72,   831,   133,   673,
+     441,   677,   441,   134,   835,   683,    78,   710,   443,   711,
+     443,   364,   364,   714,   720,   721,   730,   736,   738,   364,
+     364,   742,   364,   739,   743,   741,   137,    36,   755,   754,
+     723,   723,   749,   729,   758,   763,   765,   442,   764,   771,
+     770,   134,   767,   772,   776,   782,   778,   441,   789,   795,
+     796,   792,   797,   745,   808,   443,   811,   809,   804,   813,
+     812,   818,   822,   823,   136,   830,   832,   834,   495,   824,
+     578,   591,   442,   626,   675,   760,   725,   746,   768,   652,
+     462,   692,   657,   134,   136,   442,   670,   442,   441,   757,
+     298,   441,   609,   562,     0,   563,   443,     0,     0,   443,
+       0,     0,     0,   184,   441,   441,     0,     0,     0,     0,
+      92,     0,   443,   443,     0,   441,     0,    92,     0,     0,
+       0,     0,     0,   443,     0,    92,     0,     0,     0,    92,
+     441,     0,   442,    92,     0,    92,     0,     0,   443,    92,
+       0,   441,   505,     0,   806,     0,     0,     0,     0,   443,
+       0,     0,     0,     0,     0,    92,   505,     0,     0,   116,
+     117,   118,   119,   120,     0,    92,   123,   124,   126,     0,
+       0,   127,     0,   442,   130,     0,   442,     0,     0,    92,
+     140,   142,     0,    92,     0,     0,   288,     0,     0,   442,
+     442,     0,   296,     0,   299,     0,   158,   159,     0,   160,
+     442,     0,     0,     0,   305,   308,     0,     0,     0,     0,
+     177,   178,   179,   180,   183,   442,     0,     0,   195,     0,
+       0,   197,     0,     0,   200,     0,   442,     0,   326,   207,
+     252,     0,     0,   252,     0,     0,     0,     0,     0,     0,
+       0,     0,   344,   229,   230,   231,   232,   233,   234,   253,
+       0,     0,   253,     0,     0,   460,     0,     0,   365,     0,
+       0,     0,     0,     0,     0,     0,   254,     0,     0,   254,
+       0,  -333,     0,     0,  -333,   255,   273,     0,   255,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   289,   291,
+       0,     0,   294,   183,     0,     0,     0,   365,  -333,     0,
+     304,  -333,     0,     0,     0,   430,     0,   237,     0,     0,
+     487,  -346,     0,     0,     0,     0,  -346,     0,     0,   256,
+     257,   258,   256,   257,   258,     0,     0,     0,     0,     0,
+     328,   259,     0,   260,   259,     0,   260,     0,     0,     0,
+     339,     0,   261,     0,   262,   261,   247,   262,   248,   349,
+       0,   365,     0,     0,     0,   358,   365,     0,     0,   183,
+     263,     0,     0,   263,     0,   325,     0,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   388,   389,   390,
+     391,     0,   393,   394,   395,   396,   397,   398,   399,   400,
+     401,   402,   403,     0,   430,     0,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   183,   539,
+     540,   426,   428,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   546,     0,     0,     0,     0,     0,     0,
+     453,  -139,   252,     0,     0,     0,     0,   524,     0,     0,
+       0,   461,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   253,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   183,     0,     0,     0,     0,   183,   254,     0,
+       0,     0,     0,  -333,     0,     0,   588,   255,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,   799,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,   554,   557,     0,     0,     0,     0,   561,     0,
+     308,   308,     0,   365,     0,     0,     0,  -142,   252,     0,
+    -333,     0,     0,     0,     0,   614,     0,     0,     0,     0,
+       0,   521,     0,     0,   344,     0,     0,   253,     0,     0,
+       0,   256,   257,   258,   587,     0,     0,     0,     0,     0,
+       0,     0,     0,   259,   254,   260,     0,   636,     0,  -333,
+       0,   365,   365,   255,   261,     0,   262,     0,     0,   365,
+     365,     0,   365,     0,     0,   528,     0,     0,   430,     0,
+     430,     0,   263,     0,     0,   536,  -139,   538,     0,     0,
+       0,   252,     0,     0,     0,     0,  -333,     0,   625,     0,
+       0,     0,     0,   671,     0,     0,   551,     0,     0,     0,
+     253,   294,   553,     0,     0,     0,     0,   256,   257,   258,
+       0,     0,     0,     0,   183,     0,     0,   254,   430,   259,
+       0,   260,  -333,     0,   571,     0,   255,     0,   715,     0,
+     261,     0,   262,   227,   228,   229,   230,   231,   232,   233,
+     234,   718,     0,   719,     0,   183,     0,     0,   263,     0,
+       0,     0,  -142,     0,     0,     0,   557,     0,     0,  -333,
+       0,     0,   183,   183,     0,     0,   602,     0,     0,     0,
+     183,   183,     0,   183,     0,   426,   610,     0,     0,     0,
+     256,   257,   258,     0,     0,     0,     0,     0,   756,     0,
+       0,     0,   259,     0,   260,   435,   436,     0,   430,     0,
+       0,     0,     0,   261,     0,   262,     0,   437,   630,   237,
+       0,     0,   238,   239,   240,   241,   242,     0,   243,    16,
+       0,   263,     0,     0,     0,    19,     0,     0,     0,   783,
+       0,    23,   784,    24,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   793,   794,     0,   247,     0,
+     248,     0,     0,     0,    31,     0,   802,   666,    35,     0,
+       0,     0,     0,     0,     0,     0,   294,     0,     0,     0,
+       0,   810,     0,     0,     0,     0,     0,     0,     0,    48,
+       0,    50,   815,     0,     0,    51,     0,     0,     0,   438,
+       0,    54,   439,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    -2,     4,
+       0,     0,   440,   113,   114,     0,     0,     0,     0,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,   732,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,    18,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,   766,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,     0,
+      41,    42,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,   788,     0,
+      51,     0,     0,     0,    52,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,     0,    72,
+      73,     4,     0,    74,     0,    75,     0,    76,    77,    78,
+      79,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,    10,     0,    11,    12,     0,     0,    13,     0,
+       0,    14,  -110,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,  -110,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,  -110,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     0,
+       0,    72,    73,     4,     0,    74,  -110,    75,     0,    76,
+      77,    78,    79,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,    10,     0,    11,    12,     0,     0,
+      13,     0,     0,    14,  -109,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,  -109,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,  -109,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,    60,     0,     0,     0,
+       0,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     0,     0,    72,    73,     4,     0,    74,  -109,    75,
+       0,    76,    77,    78,    79,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,    10,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,    18,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    41,    42,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+      52,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,    60,     0,
+       0,     0,     0,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,     0,    72,    73,     4,     0,    74,
+     566,    75,     0,    76,    77,    78,    79,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,    10,     0,
+      11,    12,     0,     0,    13,     0,     0,    14,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,    18,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,     0,    41,    42,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,    52,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,     0,    72,    73,     4,
+       0,    74,   632,    75,     0,    76,    77,    78,    79,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,  -117,  -117,    28,     0,     0,
+       0,     0,     0,  -117,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     0,     0,    72,
+      73,     4,     0,    74,     0,    75,     0,    76,    77,    78,
+      79,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,    10,     0,    11,    12,     0,     0,    13,     0,
+       0,    14,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,  -118,  -118,    28,
+       0,     0,     0,     0,     0,  -118,     0,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     0,
+       0,    72,    73,     4,     0,    74,     0,    75,     0,    76,
+      77,    78,    79,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,    10,     0,    11,    12,     0,     0,
+      13,     0,     0,    14,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,    60,     0,     0,     0,
+       0,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     0,     0,    72,    73,     4,     0,    74,   351,    75,
+       0,    76,    77,    78,    79,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,    10,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   350,    40,     0,    41,    42,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,    60,     0,
+       0,     0,     0,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,     0,     0,    72,    73,     4,     0,    74,
+     490,    75,     0,    76,    77,    78,    79,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,    10,     0,
+      11,    12,     0,     0,    13,     0,     0,    14,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,   672,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,   350,    40,     0,    41,    42,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,     0,     0,    72,    73,     4,
+       0,    74,     0,    75,     0,    76,    77,    78,    79,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,   691,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     0,     0,    72,
+      73,     4,     0,    74,     0,    75,     0,    76,    77,    78,
+      79,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,    10,     0,    11,    12,     0,     0,    13,     0,
+       0,    14,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,   786,     0,     0,     0,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     0,
+       0,    72,    73,     4,     0,    74,     0,    75,     0,    76,
+      77,    78,    79,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,    10,     0,    11,    12,     0,     0,
+      13,     0,     0,    14,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,    60,     0,     0,     0,
+       0,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     0,     0,    72,    73,     4,     0,    74,   798,    75,
+       0,    76,    77,    78,    79,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,    10,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   350,    40,     0,    41,    42,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,    60,     0,
+       0,     0,     0,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,     0,     0,    72,    73,     4,     0,    74,
+     801,    75,     0,    76,    77,    78,    79,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,    10,     0,
+      11,    12,     0,     0,    13,     0,     0,    14,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,   803,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,   350,    40,     0,    41,    42,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,     0,     0,    72,    73,     4,
+       0,    74,     0,    75,     0,    76,    77,    78,    79,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,  -122,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     0,     0,    72,
+      73,     4,     0,    74,     0,    75,     0,    76,    77,    78,
+      79,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,    10,     0,    11,    12,     0,     0,    13,     0,
+       0,    14,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     0,
+       0,    72,    73,     4,     0,    74,   814,    75,     0,    76,
+      77,    78,    79,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,    10,     0,    11,    12,     0,     0,
+      13,     0,     0,    14,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,    60,     0,     0,     0,
+       0,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     0,     0,    72,    73,     4,     0,    74,   833,    75,
+       0,    76,    77,    78,    79,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,    10,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   350,    40,     0,    41,    42,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,    60,     0,
+       0,     0,     0,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,     0,     0,    72,    73,     4,     0,    74,
+     836,    75,   548,    76,    77,    78,    79,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,    14,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,    33,
+      34,    35,    36,    37,    38,     0,    40,     0,    41,    42,
+      43,    44,     0,    45,     0,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,     0,     0,    72,    73,     4,
+       0,    74,     0,    75,   559,    76,    77,    78,    79,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+       0,    33,    34,    35,    36,    37,    38,     0,    40,     0,
+      41,    42,    43,    44,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     0,     0,    72,
+      73,     4,     0,    74,     0,    75,   581,    76,    77,    78,
+      79,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,     0,     0,    13,     0,
+       0,    14,     0,     0,     0,     0,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,    29,    30,
+       0,    31,     0,    33,    34,    35,    36,    37,    38,     0,
+      40,     0,    41,    42,    43,    44,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     0,
+       0,    72,    73,     4,     0,    74,     0,    75,   722,    76,
+      77,    78,    79,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,     0,     0,    11,    12,     0,     0,
+      13,     0,     0,    14,     0,     0,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,    33,    34,    35,    36,    37,
+      38,     0,    40,     0,    41,    42,    43,    44,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,    60,     0,     0,     0,
+       0,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     0,     0,    72,    73,     4,     0,    74,     0,    75,
+     759,    76,    77,    78,    79,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,     0,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,    33,    34,    35,
+      36,    37,    38,     0,    40,     0,    41,    42,    43,    44,
+       0,    45,     0,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,    60,     0,
+       0,     0,     0,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,     0,     0,    72,    73,     4,     0,    74,
+       0,    75,     0,    76,    77,    78,    79,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,    14,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,    33,
+      34,    35,    36,    37,    38,     0,    40,     0,    41,    42,
+      43,    44,     0,    45,     0,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,     0,     0,    72,    73,     0,
+       0,    74,     0,    75,     0,    76,    77,    78,    79,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,   236,  -346,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   810,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+     377,     0,     0,     0,     0,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,     0,     0,    11,    12,
+     237,     0,    13,   238,   239,   240,   241,   242,     0,   243,
+      16,    17,     0,   244,   245,   246,    19,     0,     0,    21,
+       0,   237,    23,     0,    24,   239,     0,     0,     0,    26,
+     243,     0,     0,    28,     0,     0,     0,     0,     0,   247,
+       0,   248,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+     247,    45,   248,     0,     0,     0,     0,   635,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,     0,     0,
+       0,     0,     0,    61,   113,   114,    64,    65,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     0,     0,    77,    78,    79,   223,   733,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   235,   236,     0,     0,     0,   223,     0,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   829,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -346,   229,
+     230,   231,   232,   233,   234,     0,     0,     0,   237,     0,
+       0,   238,   239,   240,   241,   242,     0,   243,     0,     0,
+       0,   244,   245,   246,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   237,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,   247,     0,   248,
+     244,   245,   246,     0,     0,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,   734,     0,   237,     0,     0,   247,   239,   248,   235,
+     236,     0,   243,     0,   223,     0,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,     0,
+     249,     0,     0,     0,     0,     0,     0,     0,   235,   236,
+       0,     0,   247,     0,   248,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,   238,
+     239,   240,   241,   242,     0,   243,     0,     0,     0,   244,
+     245,   246,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,   247,     0,   248,   244,   245,
+     246,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,     0,   276,
+       0,     0,     0,     0,   247,     0,   248,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,   832,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   278,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   272,     0,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+       0,     0,    11,    12,   237,     0,    13,   238,   239,   240,
+     241,   242,     0,   243,    16,    17,     0,   244,   245,   246,
+      19,     0,     0,    21,     0,     0,    23,     0,    24,     0,
+       0,     0,     0,    26,     0,     0,     0,    28,     0,     0,
+       0,     0,     0,   247,     0,   248,    29,    30,     0,    31,
+       0,     0,     0,    35,    36,     0,     0,     0,     0,     0,
+      41,    42,    43,     0,     0,    45,     0,   340,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   113,   114,
+      64,    65,     0,     0,     0,     0,    70,     0,     0,    72,
+       0,     0,     0,   361,     0,    75,     5,     6,    77,    78,
+      79,     0,     7,     8,     9,     0,     0,     0,    11,    12,
+       0,     0,    13,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,    45,     0,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,     0,     0,
+       0,     0,     0,    61,   113,   114,    64,    65,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,   404,
+       0,    75,     5,     6,    77,    78,    79,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,     0,     0,    13,     0,
+       0,     0,     0,     0,     0,     0,    16,    17,     0,     0,
+       0,     0,    19,     0,     0,    21,     0,     0,    23,     0,
+      24,     0,     0,     0,     0,    26,     0,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,    29,    30,
+       0,    31,     0,     0,     0,    35,    36,     0,     0,     0,
+       0,     0,    41,    42,    43,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     113,   114,    64,    65,     0,     0,     0,     0,    70,     0,
+       0,    72,     0,     0,     0,   535,     0,    75,     5,     6,
+      77,    78,    79,     0,     7,     8,     9,     0,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,     0,
+       0,    21,     0,     0,    23,     0,    24,     0,     0,     0,
+       0,    26,     0,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,     0,
+       0,    35,    36,     0,     0,     0,     0,     0,    41,    42,
+      43,     0,     0,    45,     0,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+       0,     0,     0,     0,     0,    61,   113,   114,    64,    65,
+       0,     0,     0,     0,    70,     0,     0,    72,     0,     0,
+       0,   537,     0,    75,     5,     6,    77,    78,    79,     0,
+       7,     8,     9,     0,     0,     0,    11,    12,     0,     0,
+      13,     0,     0,     0,     0,     0,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,     0,     0,    21,     0,     0,
+      23,     0,    24,     0,     0,     0,     0,    26,     0,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,     0,     0,    35,    36,     0,
+       0,     0,     0,     0,    41,    42,    43,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,    65,     0,     0,     0,     0,
+      70,     0,     0,    72,     0,     0,     0,   585,     0,    75,
+       5,     6,    77,    78,    79,     0,     7,     8,     9,     0,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,    16,    17,     0,     0,     0,     0,
+      19,     0,     0,    21,     0,     0,    23,     0,    24,     0,
+       0,     0,     0,    26,     0,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+       0,     0,     0,    35,    36,     0,     0,     0,     0,     0,
+      41,    42,    43,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   112,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   113,   114,
+      64,    65,     0,     0,     0,     0,    70,     0,     0,    72,
+       0,     0,     0,   665,     0,    75,     5,     6,    77,    78,
+      79,     0,     7,     8,     9,     0,     0,     0,    11,    12,
+       0,     0,    13,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,    45,     0,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,     0,     0,
+       0,     0,     0,    61,   113,   114,    64,    65,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     0,     0,    77,    78,    79,   223,     0,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,    53,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,   235,   236,     0,     0,     0,   223,     0,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   549,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   560,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   237,     0,
+       0,   238,   239,   240,   241,   242,     0,   243,     0,     0,
+       0,   244,   245,   246,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   237,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,   247,     0,   248,
+     244,   245,   246,     0,     0,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+     356,     0,     0,     0,     0,     0,   247,     0,   248,   235,
+     236,     0,     0,     0,   223,     0,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,   455,
+       0,     0,     0,     0,     0,     0,     0,     0,   235,   236,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   579,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   719,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,   238,
+     239,   240,   241,   242,     0,   243,     0,     0,     0,   244,
+     245,   246,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,   247,     0,   248,   244,   245,
+     246,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,   456,     0,
+       0,     0,     0,     0,   247,     0,   248,   235,   236,     0,
+       0,     0,   223,     0,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,     0,     0,   464,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,   236,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   755,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   237,     0,     0,   238,   239,   240,
+     241,   242,     0,   243,     0,     0,     0,   244,   245,   246,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,   237,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,   247,     0,   248,   244,   245,   246,     0,
+       0,   223,     0,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,     0,     0,   489,     0,     0,     0,
+       0,     0,   247,     0,   248,   235,   236,     0,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,   496,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,   236,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,   110,    29,     0,
-       0,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,     0,     0,     0,     0,    37,    38,     0,     0,     0,
-       0,     0,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,     0,     0,    46,    47,     0,     0,     0,
-       0,     0,     0,     0,    54,    55,    56,    57,    58,   111,
-      60,    61,     4,     5,     6,     7,     8,     0,    63,   112,
-      65,     9,     0,     0,     0,     0,     0,    71,     0,     0,
-       0,     0,    74,     0,   159,    76,    77,    78,     0,     0,
+       0,     0,   237,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,     0,     0,     0,   244,   245,   246,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,     0,
-       0,   110,    29,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,    54,    55,
-      56,    57,    58,   111,    60,    61,     4,     5,     6,     7,
-       8,     0,    63,   112,    65,     9,     0,     0,     0,     0,
-       0,    71,     0,     0,     0,     0,    74,     0,   183,    76,
-      77,    78,     0,     0,   286,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,     0,     0,   110,    29,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,    54,    55,    56,    57,    58,   111,    60,    61,
-       4,     5,     6,     7,     8,     0,    63,   112,    65,     9,
-       0,     0,     0,     0,     0,    71,     0,     0,     0,     0,
-      74,     0,     0,    76,    77,    78,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,     0,     0,   110,
-      29,     0,     0,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,     0,     0,     0,     0,    37,    38,     0,
-       0,     0,     0,     0,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,     0,     0,    46,    47,     0,
-       0,     0,     0,     0,     0,     0,    54,    55,    56,    57,
-      58,   111,    60,    61,     4,     5,     6,     7,     8,     0,
-      63,   112,    65,     9,     0,     0,     0,     0,     0,    71,
-       0,     0,     0,     0,    74,   299,     0,    76,    77,    78,
-       0,     0,   359,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,     0,     0,   110,    29,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-      54,    55,    56,    57,    58,   111,    60,    61,     0,     0,
-       0,     0,     0,     0,    63,   112,    65,     4,     5,     6,
-       7,     8,     0,    71,     0,     0,     9,     0,    74,     0,
-       0,    76,    77,    78,     0,     0,     0,     0,     0,     0,
-     378,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,    29,     0,     0,
-       0,     0,     0,     0,     0,    32,     0,     0,     0,    34,
-       0,     0,     0,     0,    37,    38,     0,     0,     0,     0,
-       0,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,     0,     0,    46,    47,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   112,    65,
-       9,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,     0,     0,   402,
+       0,   237,     0,     0,   238,   239,   240,   241,   242,     0,
+     243,   247,     0,   248,   244,   245,   246,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,   621,     0,     0,     0,     0,     0,
+     247,     0,   248,   235,   236,     0,     0,     0,   223,     0,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,     0,     0,   790,     0,     0,     0,     0,     0,     0,
+       0,     0,   235,   236,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     110,    29,     0,     0,     0,     0,     0,     0,     0,    32,
-       0,     0,     0,    34,     0,     0,     0,     0,    37,    38,
-       0,     0,     0,     0,     0,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,     0,     0,    46,    47,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   111,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   112,    65,     9,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,     0,    76,    77,
-      78,     0,     0,   543,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   110,    29,     0,     0,     0,     0,
-       0,     0,     0,    32,     0,     0,     0,    34,     0,     0,
-       0,     0,    37,    38,     0,     0,     0,     0,     0,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-       0,     0,    46,    47,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     4,
-       5,     6,     7,     8,     0,    63,   112,    65,     9,     0,
-       0,     0,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,     0,     0,   545,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   110,    29,
-       0,     0,     0,     0,     0,     0,     0,    32,     0,     0,
-       0,    34,     0,     0,     0,     0,    37,    38,     0,     0,
-       0,     0,     0,    41,     0,     0,     0,     0,     0,     0,
-       0,    42,     0,    43,     0,     0,    46,    47,     0,     0,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     4,     5,     6,     7,     8,     0,    63,
-     112,    65,     9,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,     0,     0,    76,    77,    78,     0,
-       0,   583,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   110,    29,     0,     0,     0,     0,     0,     0,
-       0,    32,     0,     0,     0,    34,     0,     0,     0,     0,
-      37,    38,     0,     0,     0,     0,     0,    41,     0,     0,
-       0,     0,     0,     0,     0,    42,     0,    43,     0,     0,
-      46,    47,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     4,     5,     6,
-       7,     8,     0,    63,   112,    65,     9,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,    74,     0,     0,
-      76,    77,    78,     0,     0,   668,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,    29,     0,     0,
-       0,     0,     0,     0,     0,    32,     0,     0,     0,    34,
-       0,     0,     0,     0,    37,    38,     0,     0,     0,     0,
-       0,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,     0,     0,    46,    47,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   112,    65,
-       9,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     110,    29,     0,     0,     0,     0,     0,     0,     0,    32,
-       0,     0,     0,    34,     0,     0,     0,     0,    37,    38,
-       0,     0,     0,     0,     0,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,     0,     0,    46,    47,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   111,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   112,    65,     9,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,     0,    76,    77,
-      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   110,    29,     0,     0,     0,     0,
-       0,     0,     0,    32,     0,     0,     0,    34,     0,     0,
-       0,     0,    37,    38,     0,     0,     0,     0,     0,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-       0,     0,    46,    47,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,     0,    63,   112,   328,     0,   221,
-     222,   223,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,   224,   730,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,     0,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,   221,   222,   223,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   731,
+     237,     0,     0,   238,   239,   240,   241,   242,     0,   243,
+       0,     0,     0,   244,   245,   246,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   237,
+       0,     0,   238,   239,   240,   241,   242,     0,   243,   247,
+       0,   248,   244,   245,   246,     0,     0,   223,     0,   224,
      225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     290,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   221,   222,   223,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,   292,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,   221,   222,   223,     0,     0,
+       0,     0,   805,     0,     0,     0,     0,     0,   247,     0,
+     248,   235,   236,     0,     0,     0,   223,     0,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,   481,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   224,   338,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,   221,   222,   223,
+     235,   236,     0,     0,     0,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   237,   235,
+     236,   238,   239,   240,   241,   242,     0,   243,     0,     0,
+       0,   244,   245,   246,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   237,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,   247,     0,   248,
+     244,   245,   246,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,   498,   238,
+     239,   240,   241,   242,     0,   243,   247,     0,   248,   244,
+     245,   246,     0,     0,   223,     0,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   534,     0,     0,
+       0,     0,     0,     0,     0,   247,     0,   248,   235,   236,
+       0,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,   558,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   354,   224,     0,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   427,   224,     0,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   461,   224,     0,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-       0,   221,   222,   223,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   469,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   487,   224,     0,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   494,   224,
-       0,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,     0,   221,   222,   223,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     622,   224,     0,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,   221,   222,   223,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,     0,     0,     0,   244,   245,
+     246,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   237,     0,     0,   238,   239,   240,
+     241,   242,     0,   243,   247,     0,   248,   244,   245,   246,
+       0,     0,     0,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,     0,     0,   606,    11,    12,     0,     0,
+      13,     0,     0,   247,     0,   248,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,     0,     0,    21,     0,     0,
+      23,     0,    24,     0,   664,     0,     0,    26,     0,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,     0,     0,    35,    36,     0,
+       0,     0,     0,     0,    41,    42,    43,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,    65,     0,     0,     0,     0,
+      70,     0,     0,    72,     0,     0,     0,     0,     0,    75,
+       0,   125,    77,    78,    79,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,    16,
+      17,     0,     0,     0,     0,    19,     0,     0,    21,     0,
+       0,    23,     0,    24,     0,     0,     0,     0,    26,     0,
+       0,     0,    28,     0,     0,     0,     0,     0,     0,     0,
+       0,    29,    30,     0,    31,     0,     0,     0,    35,    36,
+       0,     0,     0,     0,     0,    41,    42,    43,     0,     0,
+      45,     0,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,     0,     0,     0,
+       0,     0,    61,   113,   114,    64,    65,     0,     0,     0,
+       0,    70,     0,     0,    72,     0,     0,     0,     0,     0,
+      75,     0,   129,    77,    78,    79,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,     0,     0,    11,    12,
+       0,     0,    13,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,    45,     0,     0,     0,     0,     0,     0,    47,     0,
+      48,    49,    50,     0,     0,     0,    51,     0,     0,     0,
+     112,    53,    54,    55,     0,    56,     0,     0,     0,     0,
+       0,     0,    57,     0,     0,     0,    58,    59,     0,     0,
+       0,     0,     0,    61,   113,   114,    64,    65,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     0,   181,    77,    78,    79,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,     0,     0,    11,
+      12,     0,     0,    13,     0,     0,     0,     0,     0,     0,
+       0,    16,    17,     0,     0,     0,     0,    19,     0,     0,
+      21,     0,     0,    23,     0,    24,     0,     0,     0,     0,
+      26,     0,     0,     0,    28,     0,     0,     0,     0,     0,
+       0,     0,     0,    29,    30,     0,    31,     0,     0,     0,
+      35,    36,     0,     0,     0,     0,     0,    41,    42,    43,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,    70,     0,     0,    72,     0,     0,     0,
+       0,     0,    75,   290,     0,    77,    78,    79,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,     0,
+       0,    21,     0,     0,    23,     0,    24,     0,     0,     0,
+       0,    26,     0,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,     0,
+       0,    35,    36,     0,     0,     0,     0,     0,    41,    42,
+      43,     0,     0,    45,     0,     0,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+       0,     0,     0,     0,     0,    61,   113,   114,    64,    65,
+       0,     0,     0,     0,    70,     0,     0,    72,     0,     0,
+       0,     0,     0,    75,     5,     6,    77,    78,    79,     0,
+       7,     8,     9,     0,     0,     0,    11,    12,     0,     0,
+      13,     0,     0,     0,     0,     0,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,     0,     0,    21,     0,     0,
+      23,     0,    24,     0,     0,     0,     0,    26,     0,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,     0,     0,    35,    36,     0,
+       0,     0,     0,     0,    41,    42,    43,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,   327,     0,     0,     0,     0,
+      70,     0,     0,    72,     0,     0,     0,     0,     0,    75,
+       0,     0,    77,    78,    79,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+     236,     0,     0,     0,   223,   522,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,     0,
+       0,     0,     0,     0,   431,     0,     0,     0,   235,   236,
+       0,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,   235,   236,   238,
+     239,   240,   241,   242,     0,   243,     0,     0,     0,   244,
+     245,   246,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   613,     0,     0,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,   247,     0,   248,   244,   245,
+     246,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   237,     0,     0,   238,   239,   240,
+     241,   242,     0,   243,   247,     0,   248,   244,   245,   246,
+       0,     0,   223,     0,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,     0,     0,     0,     0,     0,
+       0,     0,     0,   247,     0,   248,   235,   236,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,   223,     0,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   786,   224,     0,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,   221,   222,   223,
+     235,   236,     0,   237,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   801,   224,     0,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   481,     0,   224,     0,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   496,     0,   224,     0,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   532,     0,   224,     0,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,   221,   222,   223,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   559,     0,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   604,     0,   224,     0,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,   450,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   662,     0,   224,
-     520,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   221,   222,   223,     0,   619,     0,
+     237,     0,     0,   238,   239,   240,   241,   242,     0,   243,
+       0,     0,   247,   244,   248,   246,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   237,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,     0,   235,   247,
+     244,   248,     0,     0,     0,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,     0,     0,     0,     0,     0,   247,     0,   248,   235,
+     236,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,   236,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,     0,     0,     0,     0,     0,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,   237,     0,     0,   238,
+     239,   240,   241,   242,   247,   243,   248,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,     0,
+     237,     0,     0,   238,   239,   240,   241,   242,     0,   243,
+       0,     0,     0,     0,     0,   247,     0,   248,     0,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,   227,   228,   229,   230,   231,   232,   233,   234,   247,
+     237,   248,     0,   238,   239,   240,   241,   242,     0,   243,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,     0,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,   222,   223,     0,     0,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,     0,     0,     0,     0,   247,
+       0,   248,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,   238,
+     239,   240,   241,   242,   247,   243,   248,   237,     0,     0,
+    -346,   239,  -346,  -346,  -346,     0,   243,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,     0,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   223,   246,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246
+       0,     0,     0,     0,     0,   247,     0,   248,     0,     0,
+       0,     0,     0,     0,     0,     0,   247,     0,   248
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-509))
-
-#define yytable_value_is_error(yytable_value) \
-  ((yytable_value) == (-344))
-
 static const yytype_int16 yycheck[] =
 {
-       2,    25,   113,     2,     2,    21,    22,   281,     2,    25,
-     365,   359,   367,   462,   246,   510,   220,     8,   262,   321,
-      31,    31,    26,     8,     8,     8,     8,     8,     8,    61,
-       8,    61,     8,    26,   278,    31,    61,     8,    73,    61,
-      39,     8,    31,    59,     8,    61,     8,     8,    25,     8,
-      77,   126,   142,    25,    70,     0,    77,   126,   126,   263,
-     264,   151,    89,    21,    22,   573,    74,    25,    89,   273,
-     274,   134,   147,   277,    77,    61,   280,   281,   147,   147,
-     324,   142,   126,   124,   147,   126,    89,   131,   145,   124,
-     151,   126,   149,   134,    21,    22,   128,     8,    25,   134,
-     103,   131,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,   147,   145,   132,   147,   126,   146,
-     145,    61,   147,   145,    74,   146,   142,   635,     8,   637,
-     107,   142,   142,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,   149,   142,    58,    59,   165,
-     505,   126,   145,   142,    72,   171,   131,    80,   149,   145,
-      80,   177,   178,   179,   149,   149,   149,   149,   149,   149,
-     148,   187,   148,   150,   623,   477,   126,   148,    58,    59,
-     126,   148,   198,   199,   148,   131,   148,   148,    73,   148,
-      98,   131,    87,   126,   102,   543,   126,   545,   131,    94,
-     142,   147,   204,    98,   134,   145,   124,   165,   126,   197,
-      87,    87,   147,   171,   147,   145,   134,    94,    94,   177,
-     178,    31,   246,   126,   142,   102,   126,   145,   134,   187,
-     246,   475,   147,   151,   134,   583,   591,   148,   165,   124,
-     198,   126,   145,   220,   171,   142,   149,   142,   220,   134,
-     177,   178,    63,   126,   151,   271,   147,   152,   131,   275,
-     187,    72,    72,   148,    77,   142,   142,   283,   148,   246,
-     286,   198,   516,   517,   246,   291,    89,   126,    58,    59,
-     524,   525,   131,   527,   639,   147,   263,   264,   246,   521,
-     103,   263,   264,    76,   147,    78,   273,   274,   147,   147,
-     277,   273,   274,   280,   281,   277,    64,    65,   280,   281,
-     805,    87,   134,   124,   124,   126,   126,   147,    94,   246,
-     668,   147,    98,   134,   134,   134,   102,    87,   286,   345,
-     147,   142,   142,   147,    94,   609,    26,   339,    98,    87,
-     151,   151,   102,   359,    72,   134,    94,   147,   127,   365,
-      98,   367,   145,   142,   370,   134,   283,    64,    65,   286,
-      21,    22,   151,   142,   291,   147,   142,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,   147,
-     145,    72,   142,   134,   134,   659,   402,    67,    68,    69,
-      70,    71,    72,   121,   142,    31,   124,   374,   126,   134,
-     131,   359,   147,   128,    84,   609,   134,   142,   131,   126,
-     145,   283,    58,    59,   142,    49,   151,    72,   126,   291,
-     436,   437,   131,   151,   440,    67,    68,    69,    70,    71,
-      72,   131,   359,   124,   126,   126,    45,    46,    47,   455,
-      49,   126,    84,   134,   402,   134,   147,   131,   464,   465,
-     131,   142,   128,   142,   470,   659,   472,   473,   457,    13,
-     151,   141,   151,    13,   819,    87,   146,   134,   143,   124,
-     469,   126,    94,   489,   476,   402,    98,   476,   476,   134,
-     149,   149,   476,   134,   500,   134,   502,   142,    62,   505,
-     148,   142,   106,   142,   510,   494,   151,   521,   150,   141,
-     151,   134,   151,   149,   146,   521,   464,   465,   134,   436,
-     437,   106,   470,   142,   472,   473,   147,     8,   148,    13,
-     142,   537,   538,    87,   147,   149,   542,   543,   455,   545,
-      94,   489,   148,     8,    98,    74,   149,   464,   465,   147,
-     556,   146,    61,   470,   521,   472,   473,   134,   134,   521,
-     147,     8,    67,    68,    69,    70,    71,    72,   148,    13,
-     116,   549,   489,   521,   436,   437,   568,   583,   147,   568,
-     568,   587,   560,   500,   568,   591,   147,   147,   142,   595,
-     148,   147,   147,   455,   147,   543,   153,   545,   148,   147,
-     189,   579,   126,   192,   521,   169,   111,    13,   556,   131,
-      13,   134,   148,   134,   620,   153,    78,   206,   624,   208,
-     537,   210,   211,   149,   126,   542,   543,     8,   545,   621,
-     148,   145,   148,   639,     8,   583,   628,   128,   500,   556,
-     741,   102,   609,    13,   134,   149,   652,   609,   640,   213,
-      42,    43,    44,    45,    46,    47,    95,    49,   664,   148,
-     666,   149,   668,   149,   147,   145,   583,   149,   140,   148,
-      13,   142,   148,   148,   148,   537,   624,   128,   148,   148,
-     542,    95,   148,     8,   148,   153,   675,   676,   146,   149,
-     679,   148,   659,   147,    13,   145,   149,   659,   262,   148,
-     142,   147,   134,   620,   149,   711,   149,   624,   142,   111,
-     702,   142,   145,    13,   278,    95,    26,   147,    66,   148,
-     668,   149,    13,    13,   134,   142,    13,   149,    13,   718,
-     145,   142,    13,   134,   142,   652,   149,   149,   147,    78,
-      26,   719,   142,   148,   148,   751,   145,   664,   754,   666,
-     147,   668,   345,   816,   732,   489,   505,   676,   620,   557,
-     324,   767,   768,   624,   595,   729,   758,   745,   309,   703,
-     644,   749,   778,   765,   601,   171,   613,   755,   529,   472,
-     713,   773,   760,    -1,   473,   777,   764,   793,    -1,   781,
-     652,    -1,   784,   291,   711,   787,    -1,   786,   804,   805,
-      -1,    -1,   664,    -1,   666,    -1,    -1,    -1,    -1,    -1,
-     788,   803,    -1,   819,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   813,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   809,    -1,    -1,   751,   827,    -1,   754,    -1,   831,
-      -1,    -1,    -1,    -1,    -1,   823,    -1,    -1,    -1,   711,
-     767,   768,   830,    -1,    -1,    -1,    -1,    -1,    -1,     4,
-       5,   778,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,   793,    -1,    23,    24,
-      -1,    -1,    -1,    -1,    -1,    30,    -1,   804,    -1,   751,
-      35,    -1,   754,    -1,    -1,    40,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   767,   768,    -1,    -1,    -1,
-      -1,   475,    -1,    -1,    -1,    -1,   778,    62,    -1,    -1,
-      -1,    -1,    67,    -1,    -1,    42,    43,    -1,    -1,    74,
-      -1,   793,    -1,    -1,    -1,   499,    -1,    -1,   436,   437,
-      -1,    -1,   804,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   516,   517,    -1,    72,    73,   455,    -1,    -1,
-     524,   525,    -1,   527,    81,    -1,    -1,    -1,    85,    -1,
-      -1,   116,    -1,    90,    91,    -1,    -1,    -1,    -1,    -1,
-      -1,    21,    22,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     107,    -1,    -1,   110,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   500,   120,    -1,   122,   123,   124,   125,   126,
-     155,    -1,    -1,    -1,    -1,    -1,   133,   134,    -1,    -1,
-      -1,   166,    62,   168,   169,    -1,    -1,    -1,    -1,    -1,
-      -1,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   537,
-      -1,    -1,    -1,   188,   542,    -1,    -1,    -1,    -1,    -1,
-     195,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   203,    -1,
-      -1,    -1,    -1,    -1,   209,    -1,    -1,    -1,   213,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    -1,    -1,    -1,    -1,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,    -1,    -1,
-     265,   266,   620,    -1,    -1,   165,    -1,    -1,    -1,   169,
-      -1,   171,    -1,   278,    -1,    -1,    -1,   177,   178,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   187,    -1,    -1,
-      -1,   296,    -1,    -1,   652,    -1,    -1,    -1,   198,    -1,
-      -1,   306,    -1,    -1,    -1,    -1,   664,    -1,   666,    -1,
-       9,    10,    11,   213,    -1,    -1,    -1,    -1,    -1,   324,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,   711,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   262,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,   378,    49,    -1,    -1,    -1,   278,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   286,    -1,    -1,    -1,
-      -1,    -1,    -1,   751,    -1,    -1,   754,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,   767,
-     768,    -1,    -1,    -1,   419,    -1,    -1,    -1,    -1,    -1,
-     778,    -1,    -1,    -1,   324,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   793,    -1,    -1,    -1,    -1,
-      -1,    -1,    58,    59,    -1,   450,   804,   452,    -1,    -1,
-      -1,    -1,    -1,   458,   153,    -1,    -1,   462,   463,   359,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     475,    -1,    -1,    -1,    -1,   480,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     3,
-       4,     5,     6,     7,   499,    -1,    -1,    -1,    12,    -1,
-      -1,    -1,   402,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   516,   517,    -1,    -1,   520,    -1,    -1,    -1,   524,
-     525,    -1,   527,    -1,   529,   530,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-     565,    -1,    -1,    -1,   464,   465,    -1,    81,    -1,    -1,
-     470,    85,   472,   473,    -1,   475,    90,    91,    -1,    -1,
-      -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,   489,
-      -1,   105,    -1,   107,    -1,    -1,   110,   111,    -1,   499,
-      -1,    -1,    -1,    -1,    -1,   119,   120,   121,   122,   123,
-     124,   125,   126,    -1,   619,    -1,   516,   517,   623,   133,
-     134,   135,    -1,    -1,   524,   525,    -1,   527,   142,    -1,
-      -1,    -1,    -1,   147,    -1,   149,   150,   151,   152,     9,
-      10,    11,    -1,   543,    -1,   545,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   556,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,   683,    49,
-      -1,    -1,    -1,   583,    -1,    -1,    -1,    -1,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
-      -1,   726,    -1,    -1,   624,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    58,    59,    -1,   759,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    74,   668,    84,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,   149,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    25,    12,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    84,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    84,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    99,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,   104,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,   101,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       2,   115,   222,    53,    21,   512,     2,   237,   321,   457,
+     312,   264,     2,     6,    53,     3,    21,     2,   198,     3,
+       6,    53,     3,     3,    41,     3,   367,    21,   369,    25,
+       3,     3,    21,     3,    21,    52,    53,   149,    55,   361,
+       3,     3,    24,     3,     3,   265,   266,     3,     3,     3,
+      26,     0,    41,    45,    71,   109,    24,    21,   575,     9,
+     109,   281,   282,     9,    53,   318,   109,     9,     9,   108,
+     323,   109,   109,    21,    26,   109,    15,    16,    17,   109,
+     109,   147,   116,   131,    21,   109,   116,    32,    32,    21,
+      82,   145,   116,   131,   131,   149,   131,   317,   147,   147,
+     320,   321,    47,    47,   147,   106,   141,   145,   109,    41,
+      22,   116,    21,   147,    35,   132,   151,   147,   147,    44,
+     637,    53,   639,   147,   106,   131,   143,   109,    53,   116,
+     131,   147,    41,   109,   151,    60,   175,   147,   106,    44,
+     145,   109,   147,    44,   161,   162,   163,    86,    53,   131,
+     167,   145,    53,   147,   143,    60,   149,   109,   145,   145,
+      72,   149,   151,   131,    76,   149,   507,   148,   185,   149,
+     472,   149,   161,   162,   622,   112,   149,   149,   147,   149,
+     148,   145,   199,   222,   201,   148,   148,   237,   148,   148,
+     222,   141,   148,   148,   148,   141,   185,   145,   237,   141,
+     141,   146,   146,    60,   206,   237,    35,   119,   120,   121,
+     199,   143,    44,   535,     9,   537,   141,   470,   130,   151,
+     237,    53,   141,   147,    32,   141,   265,   266,    60,   161,
+     162,   131,    64,   265,   266,   151,   141,    44,   110,    47,
+     141,    32,   281,   282,   147,    44,    53,   152,   237,   281,
+     282,     1,   593,   185,    53,   272,    47,    64,    66,   131,
+     277,    60,   279,   585,   109,   518,   519,   199,   277,   141,
+      44,   116,    22,   526,   527,    66,   529,   147,   317,    53,
+     147,   320,   321,   272,   131,   317,    60,    44,   320,   321,
+      64,    41,   149,   523,   141,    60,    53,   141,   315,    64,
+     641,   147,   809,    60,   151,   237,   141,   151,   109,   141,
+      77,   106,    79,   131,   109,   116,   151,     1,   131,   336,
+     633,   147,    72,   141,   147,   109,    76,   336,   187,     6,
+     347,   190,   116,   151,   141,   130,   131,   376,    22,   341,
+     272,   147,   141,   665,   361,   277,   141,   145,   661,   208,
+     367,   210,   369,   212,   213,   372,   151,    41,   215,    12,
+      13,    14,    15,    16,    17,   147,    97,   141,   548,   119,
+     120,   121,   361,   145,   147,   106,   145,   149,   109,   559,
+     130,    57,    58,   131,   141,   131,   131,   404,    72,   131,
+     140,     9,    76,   141,   116,   141,   146,   145,   147,   130,
+     131,   581,   116,   151,   336,   151,   112,   264,    57,    58,
+     141,   109,    86,   633,   106,   404,     4,   109,   435,   436,
+     151,   109,   439,   116,   131,   116,   435,   436,   149,   361,
+     142,   148,   449,    86,   109,   119,   120,   121,   130,   131,
+     449,   661,   459,   460,   109,   116,   130,   147,   465,   141,
+     467,   468,   116,   145,   112,   451,   140,     4,   131,   151,
+     149,   318,   146,   150,   106,   107,   323,   109,   464,   471,
+     459,   460,   404,   523,   491,   471,   465,   131,   467,   468,
+      70,   471,   823,    70,   523,   502,   471,   504,   130,   131,
+     507,   523,   147,   502,     3,   512,   148,     4,   148,   141,
+     496,   147,   491,   435,   436,   106,   523,     3,   109,   151,
+     149,    26,   149,   147,   146,    21,   131,   449,   535,   141,
+     537,   131,   147,     3,   541,   542,     4,   459,   460,   130,
+     131,   148,   541,   465,   523,   467,   468,    81,   555,   147,
+     141,   147,   722,   147,   153,   148,   535,   147,   537,   147,
+     151,   147,   147,   109,   116,   735,   573,   131,     4,   491,
+     153,     4,   148,   148,   573,   567,   555,    33,   585,   749,
+     502,   567,   589,   753,   149,   148,   593,   567,   131,   759,
+     597,   109,   567,   763,     3,   145,     3,   148,   768,    64,
+     131,   523,     4,    54,   633,   149,   585,   148,   112,   149,
+     149,   633,   619,   535,   147,   537,   623,   149,   145,   541,
+     619,   106,   792,   470,   109,   148,   139,   141,   620,     4,
+     112,   148,   661,   555,   641,   627,   148,   148,   148,   661,
+     148,   745,    54,   813,   623,   130,   131,   654,   148,     3,
+     642,   573,   153,   148,   501,   654,   141,   827,   665,   149,
+     667,   148,   669,   585,   834,   146,   151,   147,   667,   145,
+     669,   518,   519,     4,   149,   148,   147,   149,   141,   526,
+     527,   131,   529,   149,   141,   149,   665,    76,     4,   141,
+     676,   677,   145,   679,    54,     6,    65,   619,   147,     4,
+     148,   623,   149,     4,   131,     4,   141,   714,   149,   141,
+     131,   145,     4,   705,     4,   714,   141,   147,   149,     6,
+     149,    33,   148,   147,    21,   141,   148,   145,   347,   820,
+     491,   507,   654,   556,   623,   721,   677,   706,   732,   597,
+     300,   646,   603,   665,    41,   667,   616,   669,   755,   716,
+     151,   758,   531,   467,    -1,   468,   755,    -1,    -1,   758,
+      -1,    -1,    -1,    60,   771,   772,    -1,    -1,    -1,    -1,
+     762,    -1,   771,   772,    -1,   782,    -1,   769,    -1,    -1,
+      -1,    -1,    -1,   782,    -1,   777,    -1,    -1,    -1,   781,
+     797,    -1,   714,   785,    -1,   787,    -1,    -1,   797,   791,
+      -1,   808,   809,    -1,   790,    -1,    -1,    -1,    -1,   808,
+      -1,    -1,    -1,    -1,    -1,   807,   823,    -1,    -1,     5,
+       6,     7,     8,     9,    -1,   817,    12,    13,    14,    -1,
+      -1,    17,    -1,   755,    20,    -1,   758,    -1,    -1,   831,
+      26,    27,    -1,   835,    -1,    -1,   143,    -1,    -1,   771,
+     772,    -1,   149,    -1,   151,    -1,    42,    43,    -1,    45,
+     782,    -1,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      56,    57,    58,    59,    60,   797,    -1,    -1,    64,    -1,
+      -1,    67,    -1,    -1,    70,    -1,   808,    -1,   185,    75,
+       4,    -1,    -1,     4,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   199,    12,    13,    14,    15,    16,    17,    23,
+      -1,    -1,    23,    -1,    -1,    26,    -1,    -1,   215,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    40,    -1,    -1,    40,
+      -1,    45,    -1,    -1,    45,    49,   122,    -1,    49,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,   100,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,
+      -1,    -1,   148,   149,    -1,    -1,    -1,   264,    82,    -1,
+     156,    82,    -1,    -1,    -1,   272,    -1,    86,    -1,    -1,
+     336,    90,    -1,    -1,    -1,    -1,    95,    -1,    -1,   103,
+     104,   105,   103,   104,   105,    -1,    -1,    -1,    -1,    -1,
+     186,   115,    -1,   117,   115,    -1,   117,    -1,    -1,    -1,
+     196,    -1,   126,    -1,   128,   126,   125,   128,   127,   205,
+      -1,   318,    -1,    -1,    -1,   211,   323,    -1,    -1,   215,
+     144,    -1,    -1,   144,    -1,   149,    -1,   223,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
+     236,    -1,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,    -1,   361,    -1,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   435,
+     436,   267,   268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   449,    -1,    -1,    -1,    -1,    -1,    -1,
+     286,     3,     4,    -1,    -1,    -1,    -1,   404,    -1,    -1,
+      -1,   297,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   318,    -1,    -1,    -1,    -1,   323,    40,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,   502,    49,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   459,   460,    -1,    -1,    -1,    -1,   465,    -1,
+     467,   468,    -1,   470,    -1,    -1,    -1,     3,     4,    -1,
+      82,    -1,    -1,    -1,    -1,   541,    -1,    -1,    -1,    -1,
+      -1,   377,    -1,    -1,   491,    -1,    -1,    23,    -1,    -1,
+      -1,   103,   104,   105,   501,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,    40,   117,    -1,   573,    -1,    45,
+      -1,   518,   519,    49,   126,    -1,   128,    -1,    -1,   526,
+     527,    -1,   529,    -1,    -1,   421,    -1,    -1,   535,    -1,
+     537,    -1,   144,    -1,    -1,   431,   148,   433,    -1,    -1,
+      -1,     4,    -1,    -1,    -1,    -1,    82,    -1,   555,    -1,
+      -1,    -1,    -1,   619,    -1,    -1,   452,    -1,    -1,    -1,
+      23,   457,   458,    -1,    -1,    -1,    -1,   103,   104,   105,
+      -1,    -1,    -1,    -1,   470,    -1,    -1,    40,   585,   115,
+      -1,   117,    45,    -1,   480,    -1,    49,    -1,   654,    -1,
+     126,    -1,   128,    10,    11,    12,    13,    14,    15,    16,
+      17,   667,    -1,   669,    -1,   501,    -1,    -1,   144,    -1,
+      -1,    -1,   148,    -1,    -1,    -1,   623,    -1,    -1,    82,
+      -1,    -1,   518,   519,    -1,    -1,   522,    -1,    -1,    -1,
+     526,   527,    -1,   529,    -1,   531,   532,    -1,    -1,    -1,
+     103,   104,   105,    -1,    -1,    -1,    -1,    -1,   714,    -1,
+      -1,    -1,   115,    -1,   117,    12,    13,    -1,   665,    -1,
+      -1,    -1,    -1,   126,    -1,   128,    -1,    24,   564,    86,
+      -1,    -1,    89,    90,    91,    92,    93,    -1,    95,    36,
+      -1,   144,    -1,    -1,    -1,    42,    -1,    -1,    -1,   755,
+      -1,    48,   758,    50,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   771,   772,    -1,   125,    -1,
+     127,    -1,    -1,    -1,    71,    -1,   782,   613,    75,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   622,    -1,    -1,    -1,
+      -1,   797,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,   808,    -1,    -1,   102,    -1,    -1,    -1,   106,
+      -1,   108,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     0,     1,
+      -1,    -1,   129,   130,   131,    -1,    -1,    -1,    -1,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,   685,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    35,    36,    37,    -1,    -1,    -1,    41,
+      42,    43,    -1,    45,    46,    -1,    48,    -1,    50,    51,
+      -1,    -1,    -1,    55,    56,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,    -1,   730,    -1,    68,    69,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    -1,
+      82,    83,    84,    85,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,   764,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,   124,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,    -1,   141,
+     142,     1,    -1,   145,    -1,   147,    -1,   149,   150,   151,
+     152,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    32,    -1,    -1,    35,    36,    37,    -1,    -1,
+      -1,    -1,    42,    43,    -1,    45,    46,    47,    48,    -1,
+      50,    51,    -1,    -1,    -1,    55,    56,    -1,    -1,    59,
+      -1,    -1,    -1,    -1,    -1,    -1,    66,    -1,    68,    69,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    -1,    82,    83,    84,    85,    -1,    87,    88,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,   124,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,    -1,
+      -1,   141,   142,     1,    -1,   145,   146,   147,    -1,   149,
+     150,   151,   152,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    32,    -1,    -1,    35,    36,    37,
+      -1,    -1,    -1,    -1,    42,    43,    -1,    45,    46,    47,
+      48,    -1,    50,    51,    -1,    -1,    -1,    55,    56,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    66,    -1,
+      68,    69,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    -1,    82,    83,    84,    85,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,   124,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,    -1,    -1,   141,   142,     1,    -1,   145,   146,   147,
+      -1,   149,   150,   151,   152,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    35,
+      36,    37,    -1,    -1,    -1,    41,    42,    43,    -1,    45,
+      46,    -1,    48,    -1,    50,    51,    -1,    -1,    -1,    55,
+      56,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    -1,    82,    83,    84,    85,
+      -1,    87,    88,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,   124,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,    -1,   141,   142,     1,    -1,   145,
+     146,   147,    -1,   149,   150,   151,   152,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    35,    36,    37,    -1,    -1,    -1,    41,    42,    43,
+      -1,    45,    46,    -1,    48,    -1,    50,    51,    -1,    -1,
+      -1,    55,    56,    -1,    -1,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    -1,    82,    83,
+      84,    85,    -1,    87,    88,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+     124,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,    -1,   141,   142,     1,
+      -1,   145,   146,   147,    -1,   149,   150,   151,   152,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    35,    36,    37,    -1,    -1,    -1,    -1,
+      42,    43,    -1,    45,    46,    -1,    48,    -1,    50,    51,
+      -1,    -1,    -1,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    -1,    65,    -1,    -1,    68,    69,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    -1,
+      82,    83,    84,    85,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,   124,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,    -1,    -1,   141,
+     142,     1,    -1,   145,    -1,   147,    -1,   149,   150,   151,
+     152,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    35,    36,    37,    -1,    -1,
+      -1,    -1,    42,    43,    -1,    45,    46,    -1,    48,    -1,
+      50,    51,    -1,    -1,    -1,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    -1,    65,    -1,    -1,    68,    69,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    -1,    82,    83,    84,    85,    -1,    87,    88,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,   124,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,    -1,
+      -1,   141,   142,     1,    -1,   145,    -1,   147,    -1,   149,
+     150,   151,   152,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    35,    36,    37,
+      -1,    -1,    -1,    -1,    42,    43,    -1,    45,    46,    -1,
+      48,    -1,    50,    51,    -1,    -1,    -1,    55,    56,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    -1,    82,    83,    84,    85,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,   124,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,    -1,    -1,   141,   142,     1,    -1,   145,   146,   147,
+      -1,   149,   150,   151,   152,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    35,
+      36,    37,    -1,    -1,    -1,    -1,    42,    43,    -1,    45,
+      46,    -1,    48,    -1,    50,    51,    -1,    -1,    -1,    55,
+      56,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    -1,    82,    83,    84,    85,
+      -1,    87,    88,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,   124,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,    -1,    -1,   141,   142,     1,    -1,   145,
+     146,   147,    -1,   149,   150,   151,   152,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    35,    36,    37,    -1,    -1,    -1,    -1,    42,    43,
+      -1,    45,    46,    -1,    48,    -1,    50,    51,    -1,    -1,
+      -1,    55,    56,    -1,    -1,    59,    -1,    61,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    -1,    82,    83,
+      84,    85,    -1,    87,    88,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+     124,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,    -1,    -1,   141,   142,     1,
+      -1,   145,    -1,   147,    -1,   149,   150,   151,   152,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    35,    36,    37,    -1,    -1,    -1,    -1,
+      42,    43,    -1,    45,    46,    -1,    48,    -1,    50,    51,
+      -1,    -1,    -1,    55,    56,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    67,    68,    69,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    -1,
+      82,    83,    84,    85,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,   124,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,    -1,    -1,   141,
+     142,     1,    -1,   145,    -1,   147,    -1,   149,   150,   151,
+     152,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    35,    36,    37,    -1,    -1,
+      -1,    -1,    42,    43,    -1,    45,    46,    -1,    48,    -1,
+      50,    51,    -1,    -1,    -1,    55,    56,    -1,    -1,    59,
+      -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,    68,    69,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    -1,    82,    83,    84,    85,    -1,    87,    88,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,   124,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,    -1,
+      -1,   141,   142,     1,    -1,   145,    -1,   147,    -1,   149,
+     150,   151,   152,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    35,    36,    37,
+      -1,    -1,    -1,    -1,    42,    43,    -1,    45,    46,    -1,
+      48,    -1,    50,    51,    -1,    -1,    -1,    55,    56,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    -1,    82,    83,    84,    85,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,   124,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,    -1,    -1,   141,   142,     1,    -1,   145,   146,   147,
+      -1,   149,   150,   151,   152,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    35,
+      36,    37,    -1,    -1,    -1,    -1,    42,    43,    -1,    45,
+      46,    -1,    48,    -1,    50,    51,    -1,    -1,    -1,    55,
+      56,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    -1,    82,    83,    84,    85,
+      -1,    87,    88,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,   124,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,    -1,    -1,   141,   142,     1,    -1,   145,
+     146,   147,    -1,   149,   150,   151,   152,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    35,    36,    37,    -1,    -1,    -1,    -1,    42,    43,
+      -1,    45,    46,    -1,    48,    -1,    50,    51,    -1,    -1,
+      -1,    55,    56,    -1,    -1,    59,    -1,    -1,    62,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    -1,    82,    83,
+      84,    85,    -1,    87,    88,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+     124,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,    -1,    -1,   141,   142,     1,
+      -1,   145,    -1,   147,    -1,   149,   150,   151,   152,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    35,    36,    37,    -1,    -1,    -1,    -1,
+      42,    43,    -1,    45,    46,    -1,    48,    -1,    50,    51,
+      -1,    -1,    -1,    55,    56,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,    65,    -1,    -1,    68,    69,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    -1,
+      82,    83,    84,    85,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,   124,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,    -1,    -1,   141,
+     142,     1,    -1,   145,    -1,   147,    -1,   149,   150,   151,
+     152,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    35,    36,    37,    -1,    -1,
+      -1,    -1,    42,    43,    -1,    45,    46,    -1,    48,    -1,
+      50,    51,    -1,    -1,    -1,    55,    56,    -1,    -1,    59,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    -1,    82,    83,    84,    85,    -1,    87,    88,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,   124,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,    -1,
+      -1,   141,   142,     1,    -1,   145,   146,   147,    -1,   149,
+     150,   151,   152,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    35,    36,    37,
+      -1,    -1,    -1,    -1,    42,    43,    -1,    45,    46,    -1,
+      48,    -1,    50,    51,    -1,    -1,    -1,    55,    56,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    -1,    82,    83,    84,    85,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,   124,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,    -1,    -1,   141,   142,     1,    -1,   145,   146,   147,
+      -1,   149,   150,   151,   152,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    35,
+      36,    37,    -1,    -1,    -1,    -1,    42,    43,    -1,    45,
+      46,    -1,    48,    -1,    50,    51,    -1,    -1,    -1,    55,
+      56,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    -1,    82,    83,    84,    85,
+      -1,    87,    88,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,   124,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,    -1,    -1,   141,   142,     1,    -1,   145,
+     146,   147,     6,   149,   150,   151,   152,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    -1,    -1,    -1,    -1,    42,    43,
+      -1,    45,    46,    -1,    48,    -1,    50,    51,    -1,    -1,
+      -1,    55,    56,    -1,    -1,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    -1,    73,
+      74,    75,    76,    77,    78,    -1,    80,    -1,    82,    83,
+      84,    85,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+     124,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,    -1,    -1,   141,   142,     1,
+      -1,   145,    -1,   147,     6,   149,   150,   151,   152,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    -1,    -1,    -1,    -1,
+      42,    43,    -1,    45,    46,    -1,    48,    -1,    50,    51,
+      -1,    -1,    -1,    55,    56,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    71,
+      -1,    73,    74,    75,    76,    77,    78,    -1,    80,    -1,
+      82,    83,    84,    85,    -1,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,   124,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,    -1,    -1,   141,
+     142,     1,    -1,   145,    -1,   147,     6,   149,   150,   151,
+     152,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    36,    37,    -1,    -1,
+      -1,    -1,    42,    43,    -1,    45,    46,    -1,    48,    -1,
+      50,    51,    -1,    -1,    -1,    55,    56,    -1,    -1,    59,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      -1,    71,    -1,    73,    74,    75,    76,    77,    78,    -1,
+      80,    -1,    82,    83,    84,    85,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,   124,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,    -1,
+      -1,   141,   142,     1,    -1,   145,    -1,   147,     6,   149,
+     150,   151,   152,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,
+      -1,    -1,    -1,    -1,    42,    43,    -1,    45,    46,    -1,
+      48,    -1,    50,    51,    -1,    -1,    -1,    55,    56,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    -1,    73,    74,    75,    76,    77,
+      78,    -1,    80,    -1,    82,    83,    84,    85,    -1,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,   124,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,    -1,    -1,   141,   142,     1,    -1,   145,    -1,   147,
+       6,   149,   150,   151,   152,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      36,    37,    -1,    -1,    -1,    -1,    42,    43,    -1,    45,
+      46,    -1,    48,    -1,    50,    51,    -1,    -1,    -1,    55,
+      56,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    -1,    73,    74,    75,
+      76,    77,    78,    -1,    80,    -1,    82,    83,    84,    85,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,   124,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,    -1,    -1,   141,   142,     1,    -1,   145,
+      -1,   147,    -1,   149,   150,   151,   152,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    -1,    -1,    -1,    -1,    42,    43,
+      -1,    45,    46,    -1,    48,    -1,    50,    51,    -1,    -1,
+      -1,    55,    56,    -1,    -1,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    -1,    73,
+      74,    75,    76,    77,    78,    -1,    80,    -1,    82,    83,
+      84,    85,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+     124,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,    -1,    -1,   141,   142,    -1,
+      -1,   145,    -1,   147,    -1,   149,   150,   151,   152,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       6,    -1,    -1,    -1,    -1,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      86,    -1,    28,    89,    90,    91,    92,    93,    -1,    95,
+      36,    37,    -1,    99,   100,   101,    42,    -1,    -1,    45,
+      -1,    86,    48,    -1,    50,    90,    -1,    -1,    -1,    55,
+      95,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,   125,
+      -1,   127,    68,    69,    -1,    71,    -1,    -1,    -1,    75,
+      76,    -1,    -1,    -1,    -1,    -1,    82,    83,    84,    -1,
+     125,    87,   127,    -1,    -1,    -1,    -1,   153,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,    -1,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,    -1,    -1,
+      -1,    -1,   138,    -1,    -1,   141,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,    -1,   150,   151,   152,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    29,    30,    -1,    -1,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    86,    -1,
+      -1,    89,    90,    91,    92,    93,    -1,    95,    -1,    -1,
+      -1,    99,   100,   101,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,
+      89,    90,    91,    92,    93,    -1,    95,   125,    -1,   127,
+      99,   100,   101,    -1,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,   149,    -1,    86,    -1,    -1,   125,    90,   127,    29,
+      30,    -1,    95,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+     149,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,
+      -1,    -1,   125,    -1,   127,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,   146,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,
+      90,    91,    92,    93,    -1,    95,    -1,    -1,    -1,    99,
+     100,   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,   125,    -1,   127,    99,   100,
+     101,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,   149,
+      -1,    -1,    -1,    -1,   125,    -1,   127,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   149,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    80,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    -1,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      -1,    -1,    24,    25,    86,    -1,    28,    89,    90,    91,
+      92,    93,    -1,    95,    36,    37,    -1,    99,   100,   101,
+      42,    -1,    -1,    45,    -1,    -1,    48,    -1,    50,    -1,
+      -1,    -1,    -1,    55,    -1,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,   125,    -1,   127,    68,    69,    -1,    71,
+      -1,    -1,    -1,    75,    76,    -1,    -1,    -1,    -1,    -1,
+      82,    83,    84,    -1,    -1,    87,    -1,   149,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,    -1,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,    -1,    -1,    -1,    -1,   138,    -1,    -1,   141,
+      -1,    -1,    -1,     9,    -1,   147,    12,    13,   150,   151,
+     152,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      36,    37,    -1,    -1,    -1,    -1,    42,    -1,    -1,    45,
+      -1,    -1,    48,    -1,    50,    -1,    -1,    -1,    -1,    55,
+      -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    -1,    -1,    -1,    75,
+      76,    -1,    -1,    -1,    -1,    -1,    82,    83,    84,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,    -1,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,    -1,    -1,
+      -1,    -1,   138,    -1,    -1,   141,    -1,    -1,    -1,     9,
+      -1,   147,    12,    13,   150,   151,   152,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    36,    37,    -1,    -1,
+      -1,    -1,    42,    -1,    -1,    45,    -1,    -1,    48,    -1,
+      50,    -1,    -1,    -1,    -1,    55,    -1,    -1,    -1,    59,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      -1,    71,    -1,    -1,    -1,    75,    76,    -1,    -1,    -1,
+      -1,    -1,    82,    83,    84,    -1,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    94,    -1,    96,    97,    98,    -1,
+      -1,    -1,   102,    -1,    -1,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,   122,   123,    -1,    -1,    -1,    -1,    -1,   129,
+     130,   131,   132,   133,    -1,    -1,    -1,    -1,   138,    -1,
+      -1,   141,    -1,    -1,    -1,     9,    -1,   147,    12,    13,
+     150,   151,   152,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    36,    37,    -1,    -1,    -1,    -1,    42,    -1,
+      -1,    45,    -1,    -1,    48,    -1,    50,    -1,    -1,    -1,
+      -1,    55,    -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    -1,    -1,
+      -1,    75,    76,    -1,    -1,    -1,    -1,    -1,    82,    83,
+      84,    -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+      -1,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+      -1,    -1,    -1,    -1,   138,    -1,    -1,   141,    -1,    -1,
+      -1,     9,    -1,   147,    12,    13,   150,   151,   152,    -1,
+      18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    36,    37,
+      -1,    -1,    -1,    -1,    42,    -1,    -1,    45,    -1,    -1,
+      48,    -1,    50,    -1,    -1,    -1,    -1,    55,    -1,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    -1,    -1,    -1,    75,    76,    -1,
+      -1,    -1,    -1,    -1,    82,    83,    84,    -1,    -1,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,    -1,    -1,    -1,    -1,
+     138,    -1,    -1,   141,    -1,    -1,    -1,     9,    -1,   147,
+      12,    13,   150,   151,   152,    -1,    18,    19,    20,    -1,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    36,    37,    -1,    -1,    -1,    -1,
+      42,    -1,    -1,    45,    -1,    -1,    48,    -1,    50,    -1,
+      -1,    -1,    -1,    55,    -1,    -1,    -1,    59,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    -1,    71,
+      -1,    -1,    -1,    75,    76,    -1,    -1,    -1,    -1,    -1,
+      82,    83,    84,    -1,    -1,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    94,    -1,    96,    97,    98,    -1,    -1,    -1,
+     102,    -1,    -1,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,
+     122,   123,    -1,    -1,    -1,    -1,    -1,   129,   130,   131,
+     132,   133,    -1,    -1,    -1,    -1,   138,    -1,    -1,   141,
+      -1,    -1,    -1,     9,    -1,   147,    12,    13,   150,   151,
+     152,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      36,    37,    -1,    -1,    -1,    -1,    42,    -1,    -1,    45,
+      -1,    -1,    48,    -1,    50,    -1,    -1,    -1,    -1,    55,
+      -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    -1,    -1,    -1,    75,
+      76,    -1,    -1,    -1,    -1,    -1,    82,    83,    84,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,    -1,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,    -1,    -1,
+      -1,    -1,   138,    -1,    -1,   141,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,    -1,   150,   151,   152,     5,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    29,    30,    -1,    -1,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      29,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,
+      -1,    89,    90,    91,    92,    93,    -1,    95,    -1,    -1,
+      -1,    99,   100,   101,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,
+      89,    90,    91,    92,    93,    -1,    95,   125,    -1,   127,
+      99,   100,   101,    -1,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+     148,    -1,    -1,    -1,    -1,    -1,   125,    -1,   127,    29,
+      30,    -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,   148,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,
+      90,    91,    92,    93,    -1,    95,    -1,    -1,    -1,    99,
+     100,   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,   125,    -1,   127,    99,   100,
+     101,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,   148,    -1,
+      -1,    -1,    -1,    -1,   125,    -1,   127,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,   148,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    86,    -1,    88,    -1,    90,    91,    92,    -1,    -1,
-      -1,    96,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,   108,   109,   110,   111,   112,   113,    -1,
-     115,    -1,   117,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,    -1,    -1,    -1,    -1,    -1,   132,   133,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-     145,    -1,   147,    -1,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,    91,
+      92,    93,    -1,    95,    -1,    -1,    -1,    99,   100,   101,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    86,    -1,    -1,    89,    90,    91,    92,
+      93,    -1,    95,   125,    -1,   127,    99,   100,   101,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,   148,    -1,    -1,    -1,
+      -1,    -1,   125,    -1,   127,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,   148,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,
-      85,    -1,    -1,    -1,    -1,    90,    91,    -1,    -1,    -1,
-      -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     105,    -1,   107,    -1,    -1,   110,   111,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   119,   120,   121,   122,   123,   124,
-     125,   126,     3,     4,     5,     6,     7,    -1,   133,   134,
-     135,    12,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,
-      -1,    -1,   147,    -1,   149,   150,   151,   152,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      81,    -1,    -1,    -1,    85,    -1,    -1,    -1,    -1,    90,
-      91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   105,    -1,   107,    -1,    -1,   110,
-     111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,   120,
-     121,   122,   123,   124,   125,   126,     3,     4,     5,     6,
-       7,    -1,   133,   134,   135,    12,    -1,    -1,    -1,    -1,
-      -1,   142,    -1,    -1,    -1,    -1,   147,    -1,   149,   150,
-     151,   152,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,    85,    -1,
-      -1,    -1,    -1,    90,    91,    -1,    -1,    -1,    -1,    -1,
-      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,
-     107,    -1,    -1,   110,   111,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   119,   120,   121,   122,   123,   124,   125,   126,
-       3,     4,     5,     6,     7,    -1,   133,   134,   135,    12,
-      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,    -1,    -1,
-     147,    -1,    -1,   150,   151,   152,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,    -1,
-      -1,    -1,    85,    -1,    -1,    -1,    -1,    90,    91,    -1,
-      -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   105,    -1,   107,    -1,    -1,   110,   111,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   119,   120,   121,   122,
-     123,   124,   125,   126,     3,     4,     5,     6,     7,    -1,
-     133,   134,   135,    12,    -1,    -1,    -1,    -1,    -1,   142,
-      -1,    -1,    -1,    -1,   147,   148,    -1,   150,   151,   152,
-      -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    81,    -1,    -1,    -1,    85,    -1,    -1,    -1,
-      -1,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,   107,    -1,
-      -1,   110,   111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     119,   120,   121,   122,   123,   124,   125,   126,    -1,    -1,
-      -1,    -1,    -1,    -1,   133,   134,   135,     3,     4,     5,
-       6,     7,    -1,   142,    -1,    -1,    12,    -1,   147,    -1,
-      -1,   150,   151,   152,    -1,    -1,    -1,    -1,    -1,    -1,
-      26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,    85,
-      -1,    -1,    -1,    -1,    90,    91,    -1,    -1,    -1,    -1,
-      -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
-      -1,   107,    -1,    -1,   110,   111,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   119,   120,   121,   122,   123,   124,   125,
-     126,     3,     4,     5,     6,     7,    -1,   133,   134,   135,
-      12,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,    -1,
-      -1,   147,    -1,    -1,   150,   151,   152,    -1,    -1,    31,
+      -1,    -1,    86,    -1,    -1,    89,    90,    91,    92,    93,
+      -1,    95,    -1,    -1,    -1,    99,   100,   101,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,
-      -1,    -1,    -1,    85,    -1,    -1,    -1,    -1,    90,    91,
-      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   105,    -1,   107,    -1,    -1,   110,   111,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,   120,   121,
-     122,   123,   124,   125,   126,     3,     4,     5,     6,     7,
-      -1,   133,   134,   135,    12,    -1,    -1,    -1,    -1,    -1,
-     142,    -1,    -1,    -1,    -1,   147,    -1,    -1,   150,   151,
-     152,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    81,    -1,    -1,    -1,    85,    -1,    -1,
-      -1,    -1,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,   107,
-      -1,    -1,   110,   111,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   119,   120,   121,   122,   123,   124,   125,   126,     3,
-       4,     5,     6,     7,    -1,   133,   134,   135,    12,    -1,
-      -1,    -1,    -1,    -1,   142,    -1,    -1,    -1,    -1,   147,
-      -1,    -1,   150,   151,   152,    -1,    -1,    31,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,    -1,    -1,
-      -1,    85,    -1,    -1,    -1,    -1,    90,    91,    -1,    -1,
-      -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   105,    -1,   107,    -1,    -1,   110,   111,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   119,   120,   121,   122,   123,
-     124,   125,   126,     3,     4,     5,     6,     7,    -1,   133,
-     134,   135,    12,    -1,    -1,    -1,    -1,    -1,   142,    -1,
-      -1,    -1,    -1,   147,    -1,    -1,   150,   151,   152,    -1,
-      -1,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    81,    -1,    -1,    -1,    85,    -1,    -1,    -1,    -1,
-      90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   105,    -1,   107,    -1,    -1,
-     110,   111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,
-     120,   121,   122,   123,   124,   125,   126,     3,     4,     5,
-       6,     7,    -1,   133,   134,   135,    12,    -1,    -1,    -1,
-      -1,    -1,   142,    -1,    -1,    -1,    -1,   147,    -1,    -1,
-     150,   151,   152,    -1,    -1,    31,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,    85,
-      -1,    -1,    -1,    -1,    90,    91,    -1,    -1,    -1,    -1,
-      -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
-      -1,   107,    -1,    -1,   110,   111,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   119,   120,   121,   122,   123,   124,   125,
-     126,     3,     4,     5,     6,     7,    -1,   133,   134,   135,
-      12,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,    -1,
-      -1,   147,    -1,    -1,   150,   151,   152,    -1,    -1,    -1,
+      -1,    86,    -1,    -1,    89,    90,    91,    92,    93,    -1,
+      95,   125,    -1,   127,    99,   100,   101,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,
+     125,    -1,   127,    29,    30,    -1,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,
-      -1,    -1,    -1,    85,    -1,    -1,    -1,    -1,    90,    91,
-      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   105,    -1,   107,    -1,    -1,   110,   111,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   119,   120,   121,
-     122,   123,   124,   125,   126,     3,     4,     5,     6,     7,
-      -1,   133,   134,   135,    12,    -1,    -1,    -1,    -1,    -1,
-     142,    -1,    -1,    -1,    -1,   147,    -1,    -1,   150,   151,
-     152,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    81,    -1,    -1,    -1,    85,    -1,    -1,
-      -1,    -1,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,    -1,   107,
-      -1,    -1,   110,   111,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   119,   120,   121,   122,   123,   124,   125,   126,    -1,
-      -1,    -1,    -1,    -1,    -1,   133,   134,   135,    -1,     9,
-      10,    11,    -1,    -1,   142,    -1,    -1,    -1,    -1,   147,
-      -1,    -1,   150,   151,   152,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   149,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     149,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   149,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,     9,    10,    11,    -1,    -1,
+      86,    -1,    -1,    89,    90,    91,    92,    93,    -1,    95,
+      -1,    -1,    -1,    99,   100,   101,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
+      -1,    -1,    89,    90,    91,    92,    93,    -1,    95,   125,
+      -1,   127,    99,   100,   101,    -1,    -1,     5,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,   125,    -1,
+     127,    29,    30,    -1,    -1,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,   146,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   149,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,     9,    10,    11,
+      29,    30,    -1,    -1,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    29,
+      30,    89,    90,    91,    92,    93,    -1,    95,    -1,    -1,
+      -1,    99,   100,   101,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,
+      89,    90,    91,    92,    93,    -1,    95,   125,    -1,   127,
+      99,   100,   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,   146,    89,
+      90,    91,    92,    93,    -1,    95,   125,    -1,   127,    99,
+     100,   101,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,   146,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   125,    -1,   127,    29,    30,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,   146,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   148,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   148,    25,    -1,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   148,    25,    -1,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   148,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   148,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   148,    25,
-      -1,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,     9,    10,    11,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     148,    25,    -1,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,    -1,    -1,    -1,    99,   100,
+     101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,    91,
+      92,    93,    -1,    95,   125,    -1,   127,    99,   100,   101,
+      -1,    -1,    -1,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    -1,    -1,   146,    24,    25,    -1,    -1,
+      28,    -1,    -1,   125,    -1,   127,    -1,    -1,    36,    37,
+      -1,    -1,    -1,    -1,    42,    -1,    -1,    45,    -1,    -1,
+      48,    -1,    50,    -1,   146,    -1,    -1,    55,    -1,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    -1,    -1,    -1,    75,    76,    -1,
+      -1,    -1,    -1,    -1,    82,    83,    84,    -1,    -1,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,    -1,    -1,    -1,    -1,
+     138,    -1,    -1,   141,    -1,    -1,    -1,    -1,    -1,   147,
+      -1,   149,   150,   151,   152,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    36,
+      37,    -1,    -1,    -1,    -1,    42,    -1,    -1,    45,    -1,
+      -1,    48,    -1,    50,    -1,    -1,    -1,    -1,    55,    -1,
+      -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    -1,    71,    -1,    -1,    -1,    75,    76,
+      -1,    -1,    -1,    -1,    -1,    82,    83,    84,    -1,    -1,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,
+      97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,
+     107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,
+      -1,   118,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,
+      -1,    -1,   129,   130,   131,   132,   133,    -1,    -1,    -1,
+      -1,   138,    -1,    -1,   141,    -1,    -1,    -1,    -1,    -1,
+     147,    -1,   149,   150,   151,   152,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      36,    37,    -1,    -1,    -1,    -1,    42,    -1,    -1,    45,
+      -1,    -1,    48,    -1,    50,    -1,    -1,    -1,    -1,    55,
+      -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    -1,    71,    -1,    -1,    -1,    75,
+      76,    -1,    -1,    -1,    -1,    -1,    82,    83,    84,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,    -1,
+      -1,    -1,   118,    -1,    -1,    -1,   122,   123,    -1,    -1,
+      -1,    -1,    -1,   129,   130,   131,   132,   133,    -1,    -1,
+      -1,    -1,   138,    -1,    -1,   141,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,   149,   150,   151,   152,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    36,    37,    -1,    -1,    -1,    -1,    42,    -1,    -1,
+      45,    -1,    -1,    48,    -1,    50,    -1,    -1,    -1,    -1,
+      55,    -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    68,    69,    -1,    71,    -1,    -1,    -1,
+      75,    76,    -1,    -1,    -1,    -1,    -1,    82,    83,    84,
+      -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,
+      -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,
+      -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,    -1,
+      -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,    -1,
+      -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,    -1,
+      -1,    -1,    -1,   138,    -1,    -1,   141,    -1,    -1,    -1,
+      -1,    -1,   147,   148,    -1,   150,   151,   152,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    36,    37,    -1,    -1,    -1,    -1,    42,    -1,
+      -1,    45,    -1,    -1,    48,    -1,    50,    -1,    -1,    -1,
+      -1,    55,    -1,    -1,    -1,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    -1,    71,    -1,    -1,
+      -1,    75,    76,    -1,    -1,    -1,    -1,    -1,    82,    83,
+      84,    -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,    96,    97,    98,    -1,    -1,    -1,   102,    -1,
+      -1,    -1,   106,   107,   108,   109,    -1,   111,    -1,    -1,
+      -1,    -1,    -1,    -1,   118,    -1,    -1,    -1,   122,   123,
+      -1,    -1,    -1,    -1,    -1,   129,   130,   131,   132,   133,
+      -1,    -1,    -1,    -1,   138,    -1,    -1,   141,    -1,    -1,
+      -1,    -1,    -1,   147,    12,    13,   150,   151,   152,    -1,
+      18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    36,    37,
+      -1,    -1,    -1,    -1,    42,    -1,    -1,    45,    -1,    -1,
+      48,    -1,    50,    -1,    -1,    -1,    -1,    55,    -1,    -1,
+      -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    -1,    71,    -1,    -1,    -1,    75,    76,    -1,
+      -1,    -1,    -1,    -1,    82,    83,    84,    -1,    -1,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    96,    97,
+      98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,    -1,    -1,    -1,   122,   123,    -1,    -1,    -1,    -1,
+      -1,   129,   130,   131,   132,   133,    -1,    -1,    -1,    -1,
+     138,    -1,    -1,   141,    -1,    -1,    -1,    -1,    -1,   147,
+      -1,    -1,   150,   151,   152,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    -1,    -1,    -1,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    54,    -1,    -1,    -1,    29,    30,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    29,    30,    89,
+      90,    91,    92,    93,    -1,    95,    -1,    -1,    -1,    99,
+     100,   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    54,    -1,    -1,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,   125,    -1,   127,    99,   100,
+     101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,    91,
+      92,    93,    -1,    95,   125,    -1,   127,    99,   100,   101,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   125,    -1,   127,    29,    30,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   148,    25,    -1,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
+      29,    30,    -1,    86,    -1,    -1,    89,    90,    91,    92,
+      93,    -1,    95,    -1,    -1,    -1,    99,   100,   101,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   148,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   146,    -1,    25,    -1,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   146,    -1,    25,    -1,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   146,    -1,    25,    -1,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   146,    -1,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    95,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    95,    -1,
+      86,    -1,    -1,    89,    90,    91,    92,    93,    -1,    95,
+      -1,    -1,   125,    99,   127,   101,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    86,    -1,    -1,
+      89,    90,    91,    92,    93,    -1,    95,    -1,    29,   125,
+      99,   127,    -1,    -1,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   125,    -1,   127,    29,
+      30,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,    -1,    -1,    -1,    -1,    -1,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,
+      90,    91,    92,    93,   125,    95,   127,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      86,    -1,    -1,    89,    90,    91,    92,    93,    -1,    95,
+      -1,    -1,    -1,    -1,    -1,   125,    -1,   127,    -1,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    10,    11,    12,    13,    14,    15,    16,    17,   125,
+      86,   127,    -1,    89,    90,    91,    92,    93,    -1,    95,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    10,    11,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,    90,
+      91,    92,    93,    -1,    95,    -1,    -1,    -1,    -1,   125,
+      -1,   127,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,    89,
+      90,    91,    92,    93,   125,    95,   127,    86,    -1,    -1,
+      89,    90,    91,    92,    93,    -1,    95,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    11,    49,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49
+      -1,    -1,    -1,    -1,    -1,   125,    -1,   127,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   125,    -1,   127
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   155,   156,     0,     3,     4,     5,     6,     7,    12,
-      42,    43,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    62,    63,    70,    71,    72,    73,
-      76,    80,    81,    84,    85,    86,    88,    90,    91,    92,
-      96,    97,   105,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   142,   143,   145,   147,   149,   150,   151,   152,   157,
-     158,   163,   166,   167,   173,   174,   176,   178,   181,   183,
-     222,   224,   227,   228,   237,   240,   244,   245,   247,   248,
-     252,   253,   254,   255,   256,   257,   258,   263,   271,   273,
-      72,   124,   134,   224,   244,   244,   147,   244,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   124,   126,   157,   228,   247,   248,   254,   247,   244,
-     244,   124,   126,   157,   228,   230,   231,   254,   256,   257,
-     263,    80,    80,   142,   208,   147,   149,   244,   134,   149,
-     244,   147,   166,   219,   244,   147,   147,   234,   147,   147,
-     142,   151,   206,   207,   134,   147,   147,   147,   147,   126,
-     145,   157,   157,   149,   222,   244,   248,    87,    94,    98,
-     102,   142,   268,   269,    26,   147,   244,   145,   147,   126,
-     157,   161,   162,   147,   164,   244,    98,   235,   268,   145,
-      98,   268,   126,   147,     8,   149,   134,   134,    31,   175,
-     131,     9,    10,    11,    25,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    49,   149,    58,    59,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,   147,   131,   128,    61,   145,   151,   257,   175,
-     244,   126,   157,   131,   131,   126,   157,   131,   147,   236,
-     131,   128,   257,    13,     8,   149,    31,   244,   266,   267,
-     149,    13,   149,   134,   192,   143,     8,   149,   248,   148,
-     244,   220,   221,   244,   222,   248,   145,   245,   248,     8,
-     149,   149,   148,   244,   248,   272,   121,   248,   264,   265,
-     157,   160,   145,   149,   147,   149,   149,   248,   135,   244,
-     102,   269,    61,   128,    98,   102,   269,   244,   149,   164,
-     171,   172,   248,   157,    74,     8,   149,   244,   114,   146,
-     165,   166,   173,   174,   148,   150,   244,   152,   134,    31,
-     204,   205,   222,   248,   134,   106,   182,   106,   184,   134,
-     147,   134,   252,   257,   263,   244,   244,   244,    26,   244,
+       0,   155,   156,     0,     1,    12,    13,    18,    19,    20,
+      22,    24,    25,    28,    31,    35,    36,    37,    41,    42,
+      43,    45,    46,    48,    50,    51,    55,    56,    59,    68,
+      69,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    82,    83,    84,    85,    87,    88,    94,    96,    97,
+      98,   102,   106,   107,   108,   109,   111,   118,   122,   123,
+     124,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   141,   142,   145,   147,   149,   150,   151,   152,
+     157,   158,   163,   166,   167,   173,   174,   176,   178,   181,
+     183,   222,   224,   227,   228,   237,   240,   244,   245,   247,
+     248,   252,   253,   254,   255,   256,   257,   258,   263,   271,
+     273,   149,   106,   130,   131,   224,   244,   244,   244,   244,
+     244,    35,   147,   244,   244,   149,   244,   244,   131,   149,
+     244,   106,   109,   157,   228,   247,   248,   254,   147,   166,
+     244,   219,   244,   147,   147,   147,   234,    35,   147,   147,
+     141,   151,   206,   207,   131,   147,   147,   247,   244,   244,
+     244,   147,   147,   109,   145,   157,   106,   109,   157,   228,
+     230,   231,   254,   256,   257,   263,   157,   244,   244,   244,
+     244,   149,   222,   244,   248,    44,    53,    60,    64,   141,
+     268,   269,   141,   208,     6,   244,   147,   244,   145,   147,
+     244,   109,   157,   161,   162,   147,   164,   244,    60,   235,
+     268,   145,    60,   268,   109,   147,     3,   149,   131,   131,
+       9,   175,   116,     5,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    29,    30,    86,    89,    90,
+      91,    92,    93,    95,    99,   100,   101,   125,   127,   149,
+      45,    82,     4,    23,    40,    49,   103,   104,   105,   115,
+     117,   126,   128,   144,   147,   116,   112,    21,   145,   151,
+     257,   175,     9,   244,   266,   267,   149,     4,   149,   109,
+     157,   116,   116,   131,   192,   142,     3,   149,   248,   244,
+     148,   244,   220,   221,   244,   222,   248,   145,   245,   248,
+       3,   149,   149,   148,   244,   248,   272,    97,   248,   264,
+     265,   157,   160,   145,   149,   109,   157,   116,   147,   236,
+     116,   112,   257,   147,   149,   149,   248,   133,   244,    64,
+     269,    21,   112,    60,    64,   269,     4,     3,   149,   244,
+     149,   164,   171,   172,   248,   157,    26,     3,   149,   244,
+      79,   146,   165,   166,   173,   174,   148,   150,   244,   152,
+     131,     9,   204,   205,   222,   248,   131,    70,   182,    70,
+     184,   131,   147,   131,   252,   257,   263,     6,   244,   244,
      244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   230,    31,   244,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,   204,   134,   252,   134,   145,
-     252,   260,   261,   262,   244,   259,   244,   148,   157,   134,
-     134,   157,   252,   204,   252,   260,    42,    43,    73,   124,
-     126,   133,   157,   228,   237,   238,   239,   142,   246,   248,
-      95,   148,     8,   242,   238,    13,     8,   148,   147,   244,
-     148,   148,   149,     8,    74,    74,   244,   207,   149,   148,
-       8,   148,   147,     8,   148,   147,   156,   159,   204,   146,
-      61,   146,   127,   134,   142,   270,   134,   148,   146,     8,
-     148,    74,   134,   162,   148,   147,   146,   246,   148,     8,
-      13,   124,   126,   157,   229,   116,   185,   186,   229,   180,
-     147,    73,   201,   202,   203,   229,   147,   147,   257,   244,
-      26,    63,   248,   148,   147,   147,   244,   147,   251,    61,
-     145,   153,   146,   148,   232,   238,   238,   147,   126,   157,
-      98,   131,    13,    31,   244,    31,   244,   238,   134,    26,
-     166,   191,   244,   220,   244,   248,    31,   188,   248,   146,
-      26,   166,   248,   264,   265,    13,   204,   146,   156,   148,
-     244,   153,    26,   145,   193,    78,   172,   149,   134,    26,
-     166,   196,   148,    31,   222,   248,   238,   126,   157,   186,
-     179,     8,   145,   201,   148,     8,    31,   142,   204,   204,
-     244,   230,   204,   204,   146,   204,   249,   259,   244,   128,
-     233,   238,   241,   243,   157,   134,   238,   246,   246,    95,
-      13,   164,   148,   149,    95,   187,   248,   187,   164,   197,
-     148,   244,   148,   146,   153,   149,   194,   149,   194,   147,
-     164,   149,   246,   157,   145,   229,   209,   148,   140,   225,
-     203,   142,    13,   148,   148,   236,   148,   148,   148,   128,
-     250,   153,   146,   260,    95,   148,     8,   242,    31,   244,
-     238,    99,   149,   220,   188,   148,   148,   198,    64,    65,
-     199,   146,   194,    77,    89,   103,   194,   146,   229,   104,
-     209,    67,    68,    69,    70,    71,    72,    84,   141,   146,
-     210,   213,   214,   215,   216,   218,   177,   147,   145,    31,
-     142,    13,   238,   260,   238,   238,   246,   149,   148,    26,
-     166,   190,   190,    64,    65,   200,   147,   166,   103,   244,
-      26,   149,   195,   149,   146,   142,   149,   146,   134,   142,
-     217,   224,   216,     8,   149,   145,    31,   142,   226,   223,
-     142,    13,   238,   251,    95,    26,   166,   189,   164,   147,
-      26,    66,   244,   149,   195,   164,   148,    13,    13,     8,
-     149,   175,   134,   164,   142,     8,   148,   164,    13,   238,
-     238,   164,   101,   244,   164,   149,   148,   164,   145,   238,
-     238,   142,   134,    13,   146,    31,   142,   146,   238,   100,
-     149,   148,   166,   164,    13,   147,   238,   142,   149,    26,
-     146,   238,   201,   164,    78,   168,   169,   170,   148,   147,
-     170,   211,   229,   145,   149,   212,   142,   164,   148,   146,
-     145,   164,   146
+     244,   244,   230,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,     9,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   204,   131,   252,
+     131,   145,   252,   260,   261,   262,   244,   259,   244,   246,
+     248,    54,   148,     3,   242,    12,    13,    24,   106,   109,
+     129,   157,   228,   237,   238,   239,   157,   131,   131,     4,
+       3,   148,   147,   244,   148,   148,   148,   149,     3,    26,
+      26,   244,   207,   149,   148,     3,   148,   147,     3,   148,
+     147,   156,   159,   157,   252,   204,   252,   260,   204,   146,
+      21,   146,   110,   131,   141,   270,   131,   238,   141,   148,
+     146,     3,   148,    26,   131,   162,   148,   147,   146,   246,
+     148,     3,     4,   106,   109,   157,   229,    81,   185,   186,
+     229,   180,   147,    24,   201,   202,   203,   229,   147,   147,
+     257,   244,     6,   107,   248,   148,   147,   147,   244,   147,
+     251,    21,   145,   153,   146,     9,   244,     9,   244,   238,
+     238,   147,   109,   157,    60,   116,   238,   131,     6,   166,
+     191,   244,   220,   244,   248,     9,   188,   248,   146,     6,
+     166,   248,   264,   265,     4,   204,   146,   156,   148,   232,
+     148,   244,   153,     4,     6,   145,   193,    33,   172,   149,
+     131,     6,   166,   196,   148,     9,   222,   248,   238,   109,
+     157,   186,   179,     3,   145,   201,   148,     3,     9,   141,
+     204,   204,   244,   230,   204,   204,   146,   204,   249,   259,
+     244,   246,   246,    54,   238,   241,   243,   157,   131,     4,
+     164,   148,   149,    54,   187,   248,   187,   164,   197,   148,
+     244,   148,   146,   112,   233,   153,   238,   149,   194,   149,
+     194,   147,   164,   149,   246,   157,   145,   229,   209,   148,
+     139,   225,   203,   141,     4,   148,   148,   236,   148,   148,
+     148,   112,   250,   153,   146,     9,   244,    54,   148,     3,
+     242,   238,    61,   149,   220,   188,   148,   148,   198,    57,
+      58,   199,   260,   146,   194,    32,    47,    66,   194,   146,
+     229,    67,   209,     1,    22,    41,    72,   119,   120,   121,
+     130,   140,   146,   210,   213,   214,   215,   216,   218,   177,
+     147,   145,     9,   141,     4,   238,   260,   246,   238,   238,
+     149,   148,     6,   166,   190,   190,    57,    58,   200,   166,
+     147,    66,   244,     6,   149,   195,   149,   146,   141,   149,
+     146,   149,   131,   141,   217,   224,   216,     3,   149,   145,
+       9,   141,   226,   223,   141,     4,   238,   251,    54,     6,
+     166,   189,   164,     6,   147,    65,   244,   149,   195,   164,
+     148,     4,     4,     3,   149,   175,   131,   164,   141,     3,
+     148,   164,     4,   238,   238,   164,    63,   164,   244,   149,
+     148,   164,   145,   238,   238,   141,   131,     4,   146,     9,
+     141,   146,   238,    62,   149,   148,   166,   164,     4,   147,
+     238,   141,   149,     6,   146,   238,   201,   164,    33,   168,
+     169,   170,   148,   147,   170,   211,   229,   145,   149,   212,
+     141,   164,   148,   146,   145,   164,   146
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   154,   155,   156,   156,   157,   157,   158,   158,   158,
+     158,   158,   159,   158,   160,   158,   158,   158,   161,   161,
+     162,   162,   162,   162,   163,   163,   164,   164,   165,   165,
+     165,   165,   166,   166,   166,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   168,   168,   169,   169,   170,   171,   171,   172,
+     173,   174,   175,   175,   177,   176,   179,   178,   180,   178,
+     181,   181,   181,   182,   182,   183,   184,   184,   185,   185,
+     186,   186,   187,   187,   188,   188,   189,   189,   190,   190,
+     191,   191,   192,   192,   193,   193,   193,   193,   194,   194,
+     194,   195,   195,   196,   196,   197,   197,   198,   198,   199,
+     199,   200,   200,   201,   201,   202,   202,   202,   202,   202,
+     202,   202,   202,   203,   203,   203,   204,   204,   205,   205,
+     205,   205,   205,   205,   206,   206,   207,   207,   207,   208,
+     208,   208,   208,   209,   209,   210,   210,   211,   210,   210,
+     212,   212,   213,   213,   214,   214,   215,   215,   216,   216,
+     216,   216,   216,   216,   217,   217,   217,   217,   218,   218,
+     219,   219,   220,   220,   221,   221,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   223,   222,   224,   225,   225,   226,   226,
+     226,   226,   227,   227,   227,   227,   227,   227,   227,   227,
+     228,   228,   228,   228,   229,   229,   229,   230,   230,   231,
+     231,   232,   232,   233,   234,   234,   234,   235,   235,   235,
+     236,   236,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   238,   238,   238,   238,   238,   238,
+     238,   238,   239,   240,   240,   240,   240,   240,   240,   240,
+     240,   241,   241,   242,   242,   243,   243,   243,   243,   244,
+     244,   245,   246,   247,   248,   248,   249,   249,   250,   251,
+     251,   252,   252,   253,   253,   254,   255,   255,   256,   256,
+     256,   257,   257,   257,   258,   258,   259,   259,   260,   260,
+     261,   261,   261,   262,   262,   263,   263,   264,   264,   265,
+     265,   265,   266,   266,   267,   267,   267,   267,   267,   267,
+     267,   267,   268,   268,   268,   268,   269,   269,   269,   269,
+     269,   269,   270,   270,   270,   271,   271,   271,   271,   271,
+     271,   271,   272,   272,   273,   273
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
+       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
+       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
+       1,     4,     1,     2,     2,     3,     7,    10,     5,     7,
+       9,     5,     2,     3,     2,     3,     2,     3,     3,     3,
+       3,     3,     1,     2,     5,     8,     8,     5,     1,    13,
+       3,     3,     1,     0,     1,     2,     8,     1,     3,     1,
+       1,     1,     0,     1,     0,    10,     0,     8,     0,     7,
+       1,     2,     2,     0,     2,     1,     0,     2,     0,     2,
+       1,     3,     0,     2,     1,     2,     1,     4,     1,     4,
+       1,     4,     3,     5,     3,     4,     4,     5,     0,     5,
+       4,     1,     1,     1,     4,     0,     6,     0,     7,     0,
+       2,     0,     3,     1,     0,     2,     3,     5,     4,     4,
+       5,     7,     6,     0,     1,     1,     1,     0,     1,     1,
+       2,     3,     3,     4,     3,     1,     1,     2,     4,     3,
+       5,     1,     3,     2,     0,     3,     2,     0,     9,     2,
+       1,     3,     1,     1,     0,     1,     1,     2,     1,     1,
+       1,     1,     1,     1,     3,     5,     1,     3,     5,     4,
+       3,     1,     0,     1,     3,     1,     6,     3,     4,     6,
+       3,     2,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     2,     2,     2,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     2,     2,     2,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     5,     4,     1,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
+       4,     3,     2,     0,    10,     1,     0,     4,     3,     4,
+       1,     2,     4,     6,     5,     6,     6,     6,     6,     4,
+       1,     1,     3,     2,     1,     3,     2,     1,     1,     4,
+       1,     2,     0,     2,     0,     2,     3,     0,     1,     1,
+       0,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     2,     1,     1,     3,     2,     2,     2,
+       4,     1,     3,     1,     1,     1,     3,     2,     1,     3,
+       3,     0,     2,     0,     1,     5,     3,     3,     1,     1,
+       1,     1,     1,     1,     5,     1,     2,     0,     3,     3,
+       0,     1,     2,     3,     3,     1,     1,     1,     1,     2,
+       1,     4,     4,     1,     1,     4,     0,     1,     1,     1,
+       4,     4,     1,     1,     3,     1,     2,     3,     1,     1,
+       4,     0,     0,     2,     5,     3,     3,     1,     6,     4,
+       4,     2,     2,     2,     1,     2,     1,     4,     3,     3,
+       6,     3,     1,     1,     1,     4,     4,     2,     2,     4,
+       2,     2,     1,     3,     3,     3
+};
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
 
+enum { YYENOMEM = -2 };
 
-/* This macro is provided for backward compatibility. */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = PHP53EMPTY)
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == PHP53EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use PHP53error or PHP53UNDEF. */
+#define YYERRCODE PHP53UNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, analyzer, observers)
-#endif
 
 /* Enable debugging if requested.  */
-#if YYDEBUG
+#if PHP53DEBUG
 
 # ifndef YYFPRINTF
 #  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, analyzer, observers); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, analyzer, observers); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yyvaluep)
     return;
-  YYUSE (analyzer);
-  YYUSE (observers);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, analyzer, observers);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -3003,16 +3425,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -3023,65 +3437,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule, analyzer, observers)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , analyzer, observers);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], analyzer, observers);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, analyzer, observers); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, analyzer, observers); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+#else /* !PHP53DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
+#endif /* !PHP53DEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -3095,49 +3500,118 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
+
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
 
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-#if YYERROR_VERBOSE
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yypstate* yyps;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypstate_expected_tokens (yypstate *yyps,
+                          yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyps->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+/* Similar to the previous function.  */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  return yypstate_expected_tokens (yyctx->yyps, yyarg, yyargn);
+}
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static char *
 yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
 {
   char *yyd = yydest;
   const char *yys = yysrc;
@@ -3147,10 +3621,10 @@ yystpcpy (yydest, yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -3158,75 +3632,56 @@ yystpcpy (yydest, yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -3249,60 +3704,79 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
   if (*yymsg_alloc < yysize)
     {
@@ -3310,7 +3784,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -3322,144 +3796,161 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep, analyzer, observers)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-  YYUSE (yyvaluep);
-  YYUSE (analyzer);
-  YYUSE (observers);
-
+  YY_USE (yyvaluep);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-/*----------.
-| yyparse.  |
-`----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      yyerror (analyzer, observers, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, analyzer, observers);
+  yypstate_delete (yyps);
+  return yystatus;
+}
+
 int
-yyparse (analyzer, observers)
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
-#endif
+yypull_parse (yypstate *yyps, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-/* The lookahead symbol.  */
-int yychar;
+  YY_ASSERT (yyps);
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, analyzer, observers);
+    yystatus = yypush_parse (yyps, yychar, &yylval, analyzer, observers);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+#define php53nerrs yyps->php53nerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-    /* Number of syntax errors so far.  */
-    int yynerrs;
+  yyssp = yyss;
+  yyvsp = yyvs;
 
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
 
-    YYSIZE_T yystacksize;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
+
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3467,111 +3958,121 @@ YYSTYPE yylval;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+    case 2:
+      yypstate_clear (yyps);
+      break;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+    default:
+      break;
+    }
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = PHP53EMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -3582,18 +4083,39 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == PHP53EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= PHP53EOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = PHP53EOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == PHP53error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = PHP53UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3621,13 +4143,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = PHP53EMPTY;
   goto yynewstate;
 
 
@@ -3642,14 +4164,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3662,2695 +4184,2334 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-
-/* Line 1806 of yacc.c  */
-#line 352 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.MakeAst((yyvsp[(1) - (1)].statementList)); }
+  case 2: /* start: top_statement_list  */
+#line 353 "/root/repo/src/Php53FullParser.y"
+                                                                                { if (analyzer.WasCancelled()) { YYABORT; } observers.MakeAst((yyvsp[0].statementList)); }
+#line 4191 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 3:
-
-/* Line 1806 of yacc.c  */
-#line 356 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 3: /* top_statement_list: top_statement_list top_statement  */
+#line 357 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4197 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 4:
-
-/* Line 1806 of yacc.c  */
-#line 357 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 4: /* top_statement_list: %empty  */
+#line 358 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 4203 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 5:
-
-/* Line 1806 of yacc.c  */
-#line 361 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.NamespaceNameMake((yyvsp[(1) - (1)].semanticValue)); }
+  case 5: /* namespace_name: T_STRING  */
+#line 362 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.qualifiedName) = observers.NamespaceNameMake((yyvsp[0].semanticValue)); }
+#line 4209 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 6:
-
-/* Line 1806 of yacc.c  */
-#line 362 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.NamespaceNameAppend((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 6: /* namespace_name: namespace_name T_NS_SEPARATOR T_STRING  */
+#line 363 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.qualifiedName) = observers.NamespaceNameAppend((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4215 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 7:
-
-/* Line 1806 of yacc.c  */
-#line 366 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 7: /* top_statement: statement  */
+#line 367 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4221 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 8:
-
-/* Line 1806 of yacc.c  */
-#line 367 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 8: /* top_statement: function_declaration_statement  */
+#line 368 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4227 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 9:
-
-/* Line 1806 of yacc.c  */
-#line 368 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 9: /* top_statement: class_declaration_statement  */
+#line 369 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4233 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 10:
-
-/* Line 1806 of yacc.c  */
-#line 369 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 10: /* top_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 370 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 4239 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 11:
-
-/* Line 1806 of yacc.c  */
-#line 370 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[(2) - (3)].qualifiedName), (yyvsp[(1) - (3)].semanticValue)); observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 11: /* top_statement: T_NAMESPACE namespace_name ';'  */
+#line 371 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[-1].qualifiedName), (yyvsp[-2].semanticValue)); observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); }
+#line 4245 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 12:
-
-/* Line 1806 of yacc.c  */
-#line 371 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 12: /* $@1: %empty  */
+#line 372 "/root/repo/src/Php53FullParser.y"
+                                                                { observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); }
+#line 4251 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 372 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[(2) - (6)].qualifiedName), (yyvsp[(1) - (6)].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (6)].statementList)); }
+  case 13: /* top_statement: T_NAMESPACE namespace_name '{' $@1 top_statement_list '}'  */
+#line 373 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[-4].qualifiedName), (yyvsp[-5].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4257 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 14:
-
-/* Line 1806 of yacc.c  */
-#line 373 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetDeclaredNamespace(NULL); }
+  case 14: /* $@2: %empty  */
+#line 374 "/root/repo/src/Php53FullParser.y"
+                                                                                { observers.SetDeclaredNamespace(NULL); }
+#line 4263 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 15:
-
-/* Line 1806 of yacc.c  */
-#line 374 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    {  (yyval.statementList) = observers.NamespaceGlobalDeclarationFound((yyvsp[(1) - (5)].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(4) - (5)].statementList)); }
+  case 15: /* top_statement: T_NAMESPACE '{' $@2 top_statement_list '}'  */
+#line 375 "/root/repo/src/Php53FullParser.y"
+                                                                        {  (yyval.statementList) = observers.NamespaceGlobalDeclarationFound((yyvsp[-4].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4269 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 16:
-
-/* Line 1806 of yacc.c  */
-#line 375 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseSetStartingPos((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].semanticValue)); }
+  case 16: /* top_statement: T_USE use_declarations ';'  */
+#line 376 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.NamespaceUseSetStartingPos((yyvsp[-1].statementList), (yyvsp[-2].semanticValue)); }
+#line 4275 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 17:
-
-/* Line 1806 of yacc.c  */
-#line 376 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 17: /* top_statement: constant_declaration ';'  */
+#line 377 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4281 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 18:
-
-/* Line 1806 of yacc.c  */
-#line 381 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].statementList)); }
+  case 18: /* use_declarations: use_declarations ',' use_declaration  */
+#line 382 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), (yyvsp[0].statementList)); }
+#line 4287 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 19:
-
-/* Line 1806 of yacc.c  */
-#line 382 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 19: /* use_declarations: use_declaration  */
+#line 383 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4293 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 20:
-
-/* Line 1806 of yacc.c  */
-#line 386 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUse((yyvsp[(1) - (1)].qualifiedName)); }
+  case 20: /* use_declaration: namespace_name  */
+#line 387 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.NamespaceUse((yyvsp[0].qualifiedName)); }
+#line 4299 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 21:
-
-/* Line 1806 of yacc.c  */
-#line 387 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAlias((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 21: /* use_declaration: namespace_name T_AS T_STRING  */
+#line 388 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.NamespaceUseAlias((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4305 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 22:
-
-/* Line 1806 of yacc.c  */
-#line 388 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 22: /* use_declaration: T_NS_SEPARATOR namespace_name  */
+#line 389 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.NamespaceUseAbsolute((yyvsp[0].qualifiedName)); }
+#line 4311 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 23:
-
-/* Line 1806 of yacc.c  */
-#line 389 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAbsoluteAlias((yyvsp[(2) - (4)].qualifiedName), (yyvsp[(4) - (4)].semanticValue)); }
+  case 23: /* use_declaration: T_NS_SEPARATOR namespace_name T_AS T_STRING  */
+#line 390 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.NamespaceUseAbsoluteAlias((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4317 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 24:
-
-/* Line 1806 of yacc.c  */
-#line 393 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ConstantMake((yyvsp[(3) - (5)].semanticValue), analyzer.GetLineNumber())); }
+  case 24: /* constant_declaration: constant_declaration ',' T_STRING '=' static_scalar  */
+#line 394 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ConstantMake((yyvsp[-2].semanticValue), analyzer.GetLineNumber())); }
+#line 4323 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 25:
-
-/* Line 1806 of yacc.c  */
-#line 394 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ConstantMake((yyvsp[(2) - (4)].semanticValue), analyzer.GetLineNumber()); }
+  case 25: /* constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 395 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.ConstantMake((yyvsp[-2].semanticValue), analyzer.GetLineNumber()); }
+#line 4329 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 26:
-
-/* Line 1806 of yacc.c  */
-#line 398 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 26: /* inner_statement_list: inner_statement_list inner_statement  */
+#line 399 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4335 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 27:
-
-/* Line 1806 of yacc.c  */
-#line 399 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 27: /* inner_statement_list: %empty  */
+#line 400 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 4341 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 31:
-
-/* Line 1806 of yacc.c  */
-#line 406 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 31: /* inner_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 407 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4347 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 32:
-
-/* Line 1806 of yacc.c  */
-#line 410 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 32: /* statement: unticked_statement  */
+#line 411 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4353 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 33:
-
-/* Line 1806 of yacc.c  */
-#line 411 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 33: /* statement: T_STRING ':'  */
+#line 412 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMake(); }
+#line 4359 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 34:
-
-/* Line 1806 of yacc.c  */
-#line 415 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 34: /* statement: error ';'  */
+#line 413 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMake(); yyerrok; }
+#line 4365 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 35:
-
-/* Line 1806 of yacc.c  */
-#line 416 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (7)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (7)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (7)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (7)].statementList)); }
+  case 35: /* unticked_statement: '{' inner_statement_list '}'  */
+#line 417 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4371 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 36:
-
-/* Line 1806 of yacc.c  */
-#line 420 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (10)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (10)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (10)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (10)].statementList)); }
+  case 36: /* unticked_statement: T_IF '(' expr ')' statement elseif_list else_single  */
+#line 418 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-4].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4380 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 37:
-
-/* Line 1806 of yacc.c  */
-#line 424 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (5)].expression));
-																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList)); }
+  case 37: /* unticked_statement: T_IF '(' expr ')' ':' inner_statement_list new_elseif_list new_else_single T_ENDIF ';'  */
+#line 422 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-7].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-4].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-3].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); }
+#line 4389 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 38:
-
-/* Line 1806 of yacc.c  */
-#line 426 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(2) - (7)].statementList), (yyvsp[(5) - (7)].expression)); }
+  case 38: /* unticked_statement: T_WHILE '(' expr ')' while_statement  */
+#line 426 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-2].expression));
+																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4396 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 39:
+  case 39: /* unticked_statement: T_DO statement T_WHILE '(' expr ')' ';'  */
+#line 428 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-5].statementList), (yyvsp[-2].expression)); }
+#line 4402 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 435 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(3) - (9)].statementList), (yyvsp[(5) - (9)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (9)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(9) - (9)].statementList)); 
+  case 40: /* unticked_statement: T_FOR '(' for_expr ';' for_expr ';' for_expr ')' for_statement  */
+#line 437 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-6].statementList), (yyvsp[-4].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); 
 																									}
+#line 4411 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 40:
-
-/* Line 1806 of yacc.c  */
-#line 439 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (5)].expression)); 
-																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList));
+  case 41: /* unticked_statement: T_SWITCH '(' expr ')' switch_case_list  */
+#line 441 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-2].expression)); 
+																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList));
  																										}
+#line 4419 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 41:
-
-/* Line 1806 of yacc.c  */
-#line 442 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 42: /* unticked_statement: T_BREAK ';'  */
+#line 444 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4425 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 42:
-
-/* Line 1806 of yacc.c  */
-#line 443 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 43: /* unticked_statement: T_BREAK expr ';'  */
+#line 445 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4431 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 43:
-
-/* Line 1806 of yacc.c  */
-#line 444 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 44: /* unticked_statement: T_CONTINUE ';'  */
+#line 446 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4437 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 44:
-
-/* Line 1806 of yacc.c  */
-#line 445 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 45: /* unticked_statement: T_CONTINUE expr ';'  */
+#line 447 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4443 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 45:
-
-/* Line 1806 of yacc.c  */
-#line 446 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 46: /* unticked_statement: T_RETURN ';'  */
+#line 448 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4449 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 46:
-
-/* Line 1806 of yacc.c  */
-#line 447 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 47: /* unticked_statement: T_RETURN expr_without_variable ';'  */
+#line 449 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4455 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 47:
-
-/* Line 1806 of yacc.c  */
-#line 448 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].variable)); }
+  case 48: /* unticked_statement: T_RETURN variable ';'  */
+#line 450 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].variable)); }
+#line 4461 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 48:
-
-/* Line 1806 of yacc.c  */
-#line 449 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.GlobalVariablesStatementMake((yyvsp[(2) - (3)].statementList)); }
+  case 49: /* unticked_statement: T_GLOBAL global_var_list ';'  */
+#line 451 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.GlobalVariablesStatementMake((yyvsp[-1].statementList)); }
+#line 4467 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 49:
-
-/* Line 1806 of yacc.c  */
-#line 450 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StaticVariablesStatementMake((yyvsp[(2) - (3)].statementList)); }
+  case 50: /* unticked_statement: T_STATIC static_var_list ';'  */
+#line 452 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StaticVariablesStatementMake((yyvsp[-1].statementList)); }
+#line 4473 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 50:
-
-/* Line 1806 of yacc.c  */
-#line 451 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 51: /* unticked_statement: T_ECHO echo_expr_list ';'  */
+#line 453 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4479 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 51:
-
-/* Line 1806 of yacc.c  */
-#line 452 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 52: /* unticked_statement: T_INLINE_HTML  */
+#line 454 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4485 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 52:
-
-/* Line 1806 of yacc.c  */
-#line 453 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (2)].expression)); }
+  case 53: /* unticked_statement: expr ';'  */
+#line 455 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4491 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 53:
-
-/* Line 1806 of yacc.c  */
-#line 454 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 54: /* unticked_statement: T_UNSET '(' unset_variables ')' ';'  */
+#line 456 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4497 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 54:
-
-/* Line 1806 of yacc.c  */
-#line 457 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake();
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (8)].variable));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(5) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(6) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (8)].statementList)); }
+  case 55: /* unticked_statement: T_FOREACH '(' variable T_AS foreach_variable foreach_optional_arg ')' foreach_statement  */
+#line 459 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMake();
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-5].variable));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-3].expression));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4507 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 55:
-
-/* Line 1806 of yacc.c  */
-#line 464 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake();
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), observers.ExpressionMakeAsAssignmentExpression((yyvsp[(5) - (8)].variable)));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(6) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (8)].statementList)); }
+  case 56: /* unticked_statement: T_FOREACH '(' expr_without_variable T_AS variable foreach_optional_arg ')' foreach_statement  */
+#line 466 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMake();
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-5].expression));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), observers.ExpressionMakeAsAssignmentExpression((yyvsp[-3].variable)));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4517 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 56:
-
-/* Line 1806 of yacc.c  */
-#line 469 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 57: /* unticked_statement: T_DECLARE '(' declare_list ')' declare_statement  */
+#line 471 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4523 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 57:
-
-/* Line 1806 of yacc.c  */
-#line 470 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 58: /* unticked_statement: ';'  */
+#line 472 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4529 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 58:
-
-/* Line 1806 of yacc.c  */
-#line 474 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(3) - (13)].statementList), 
+  case 59: /* unticked_statement: T_TRY '{' inner_statement_list '}' T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}' additional_catches  */
+#line 476 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-10].statementList), 
 																											observers.AssignmentExpressionFromNewFound(
-																											observers.VariableStart((yyvsp[(8) - (13)].semanticValue)), 
-																											(yyvsp[(7) - (13)].qualifiedName),
+																											observers.VariableStart((yyvsp[-5].semanticValue)), 
+																											(yyvsp[-6].qualifiedName),
 																											NULL));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(11) - (13)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(13) - (13)].statementList)); }
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4541 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 59:
-
-/* Line 1806 of yacc.c  */
-#line 481 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 60: /* unticked_statement: T_THROW expr ';'  */
+#line 483 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4547 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 60:
-
-/* Line 1806 of yacc.c  */
-#line 482 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 61: /* unticked_statement: T_GOTO T_STRING ';'  */
+#line 484 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4553 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 61:
-
-/* Line 1806 of yacc.c  */
-#line 486 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 62: /* additional_catches: non_empty_additional_catches  */
+#line 488 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4559 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 62:
-
-/* Line 1806 of yacc.c  */
-#line 487 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 63: /* additional_catches: %empty  */
+#line 489 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4565 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 63:
-
-/* Line 1806 of yacc.c  */
-#line 491 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 64: /* non_empty_additional_catches: additional_catch  */
+#line 493 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4571 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 64:
-
-/* Line 1806 of yacc.c  */
-#line 492 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 65: /* non_empty_additional_catches: non_empty_additional_catches additional_catch  */
+#line 494 "/root/repo/src/Php53FullParser.y"
+                                                                                                { observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4577 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 65:
-
-/* Line 1806 of yacc.c  */
-#line 497 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.AssignmentExpressionFromNewFound(
-																			   observers.VariableStart((yyvsp[(4) - (8)].semanticValue)), 
-																			   (yyvsp[(3) - (8)].qualifiedName),
+  case 66: /* additional_catch: T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}'  */
+#line 499 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.AssignmentExpressionFromNewFound(
+																			   observers.VariableStart((yyvsp[-4].semanticValue)), 
+																			   (yyvsp[-5].qualifiedName),
 																			   NULL));
-																		  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (8)].statementList)); }
+																		  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4587 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 66:
-
-/* Line 1806 of yacc.c  */
-#line 505 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 67: /* unset_variables: unset_variable  */
+#line 507 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4593 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 67:
-
-/* Line 1806 of yacc.c  */
-#line 506 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList); }
+  case 68: /* unset_variables: unset_variables ',' unset_variable  */
+#line 508 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4599 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 71:
-
-/* Line 1806 of yacc.c  */
-#line 522 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.isMethod) = false; }
+  case 72: /* is_reference: %empty  */
+#line 524 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.isMethod) = false; }
+#line 4605 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 72:
-
-/* Line 1806 of yacc.c  */
-#line 523 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.isMethod) = true; }
+  case 73: /* is_reference: '&'  */
+#line 525 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.isMethod) = true; }
+#line 4611 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 73:
-
-/* Line 1806 of yacc.c  */
-#line 528 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(3) - (6)].semanticValue)); }
+  case 74: /* $@3: %empty  */
+#line 530 "/root/repo/src/Php53FullParser.y"
+                                                                { observers.SetCurrentMemberName((yyvsp[-3].semanticValue)); }
+#line 4617 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 74:
-
-/* Line 1806 of yacc.c  */
-#line 529 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeFunction((yyvsp[(3) - (10)].semanticValue), (yyvsp[(2) - (10)].isMethod), (yyvsp[(1) - (10)].semanticValue), (yyvsp[(5) - (10)].parametersList), (yyvsp[(9) - (10)].statementList), (yyvsp[(8) - (10)].semanticValue), (yyvsp[(10) - (10)].semanticValue));
+  case 75: /* unticked_function_declaration_statement: function is_reference T_STRING '(' parameter_list ')' $@3 '{' inner_statement_list '}'  */
+#line 531 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeFunction((yyvsp[-7].semanticValue), (yyvsp[-8].isMethod), (yyvsp[-9].semanticValue), (yyvsp[-5].parametersList), (yyvsp[-1].statementList), (yyvsp[-2].semanticValue), (yyvsp[0].semanticValue));
 											  observers.SetCurrentMemberName(NULL);
 											}
+#line 4625 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 75:
-
-/* Line 1806 of yacc.c  */
-#line 536 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (4)].semanticValue)); }
+  case 76: /* $@4: %empty  */
+#line 538 "/root/repo/src/Php53FullParser.y"
+                                                        { observers.SetCurrentClassName((yyvsp[-2].semanticValue)); }
+#line 4631 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 76:
-
-/* Line 1806 of yacc.c  */
-#line 537 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[(2) - (8)].semanticValue), (yyvsp[(1) - (8)].classSymbol), (yyvsp[(3) - (8)].classSymbol), (yyvsp[(4) - (8)].classSymbol), (yyvsp[(8) - (8)].semanticValue));
-											  observers.DeclareAssignedPropertiesFromAssignments((yyvsp[(7) - (8)].statementList));
+  case 77: /* unticked_class_declaration_statement: class_entry_type T_STRING extends_from implements_list $@4 '{' class_statement_list '}'  */
+#line 539 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[-6].semanticValue), (yyvsp[-7].classSymbol), (yyvsp[-5].classSymbol), (yyvsp[-4].classSymbol), (yyvsp[0].semanticValue));
+											  observers.DeclareAssignedPropertiesFromAssignments((yyvsp[-1].statementList));
 											 
 											  /*
 											   * parse out property and method PHP docs
 											   */
 											  pelet::ClassSymbolClass* clazz = (pelet::ClassSymbolClass*) (yyval.statementList)->At(0);
 											  observers.CreateMagicMethodsAndProperties((yyval.statementList), clazz);
-											  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (8)].statementList)); 
+											  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); 
 											  observers.SetCurrentClassName(NULL);  
 											}
+#line 4647 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 77:
-
-/* Line 1806 of yacc.c  */
-#line 549 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (3)].semanticValue)); }
+  case 78: /* $@5: %empty  */
+#line 551 "/root/repo/src/Php53FullParser.y"
+                                                                { observers.SetCurrentClassName((yyvsp[-1].semanticValue)); }
+#line 4653 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 78:
-
-/* Line 1806 of yacc.c  */
-#line 550 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[(2) - (7)].semanticValue), (yyvsp[(1) - (7)].classSymbol), NULL, (yyvsp[(3) - (7)].classSymbol), (yyvsp[(7) - (7)].semanticValue));
-											  observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (7)].statementList)); 
+  case 79: /* unticked_class_declaration_statement: interface_entry T_STRING interface_extends_list $@5 '{' class_statement_list '}'  */
+#line 552 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[-5].semanticValue), (yyvsp[-6].classSymbol), NULL, (yyvsp[-4].classSymbol), (yyvsp[0].semanticValue));
+											  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); 
 											  observers.SetCurrentClassName(NULL);    
 											}
+#line 4662 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 79:
-
-/* Line 1806 of yacc.c  */
-#line 557 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (1)].semanticValue), false, false, false, false); }
-    break;
-
-  case 80:
-
-/* Line 1806 of yacc.c  */
-#line 558 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (2)].semanticValue), true, false, false, false); }
-    break;
-
-  case 81:
-
-/* Line 1806 of yacc.c  */
-#line 559 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (2)].semanticValue), false, true, false, false); }
-    break;
-
-  case 82:
-
-/* Line 1806 of yacc.c  */
-#line 563 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
-    break;
-
-  case 83:
-
-/* Line 1806 of yacc.c  */
-#line 565 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolExtends((yyvsp[(2) - (2)].qualifiedName)); }
-    break;
-
-  case 84:
-
-/* Line 1806 of yacc.c  */
-#line 569 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (1)].semanticValue), false, false, true, false); }
-    break;
-
-  case 85:
-
-/* Line 1806 of yacc.c  */
-#line 573 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
-    break;
-
-  case 86:
-
-/* Line 1806 of yacc.c  */
-#line 575 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
-    break;
-
-  case 87:
-
-/* Line 1806 of yacc.c  */
-#line 579 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
-    break;
-
-  case 88:
-
-/* Line 1806 of yacc.c  */
-#line 581 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
-    break;
-
-  case 89:
-
-/* Line 1806 of yacc.c  */
-#line 585 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[(1) - (1)].qualifiedName)); }
-    break;
-
-  case 90:
-
-/* Line 1806 of yacc.c  */
-#line 586 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[(1) - (3)].classSymbol), (yyvsp[(3) - (3)].qualifiedName)); }
-    break;
-
-  case 91:
-
-/* Line 1806 of yacc.c  */
-#line 590 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) =  observers.ExpressionNil(); }
-    break;
-
-  case 92:
-
-/* Line 1806 of yacc.c  */
-#line 591 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
-    break;
-
-  case 93:
-
-/* Line 1806 of yacc.c  */
-#line 595 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[(1) - (1)].variable)); }
-    break;
-
-  case 94:
-
-/* Line 1806 of yacc.c  */
-#line 596 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 95:
-
-/* Line 1806 of yacc.c  */
-#line 600 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 96:
-
-/* Line 1806 of yacc.c  */
-#line 601 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 97:
-
-/* Line 1806 of yacc.c  */
-#line 605 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 98:
-
-/* Line 1806 of yacc.c  */
-#line 606 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 99:
-
-/* Line 1806 of yacc.c  */
-#line 610 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 100:
-
-/* Line 1806 of yacc.c  */
-#line 611 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 101:
-
-/* Line 1806 of yacc.c  */
-#line 615 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 102:
-
-/* Line 1806 of yacc.c  */
-#line 616 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 103:
-
-/* Line 1806 of yacc.c  */
-#line 620 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 104:
-
-/* Line 1806 of yacc.c  */
-#line 621 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
-    break;
-
-  case 105:
-
-/* Line 1806 of yacc.c  */
-#line 622 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 106:
-
-/* Line 1806 of yacc.c  */
-#line 623 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (5)].statementList); }
-    break;
-
-  case 107:
-
-/* Line 1806 of yacc.c  */
-#line 627 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 108:
-
-/* Line 1806 of yacc.c  */
-#line 628 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (5)].statementList);
-																				  observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (5)].expression));
-																			      observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList)); 
-																				}
-    break;
-
-  case 109:
-
-/* Line 1806 of yacc.c  */
-#line 632 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (4)].statementList); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(4) - (4)].statementList));
-																				}
-    break;
-
-  case 112:
-
-/* Line 1806 of yacc.c  */
-#line 643 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 113:
-
-/* Line 1806 of yacc.c  */
-#line 644 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 114:
-
-/* Line 1806 of yacc.c  */
-#line 648 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 115:
-
-/* Line 1806 of yacc.c  */
-#line 649 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); 
-															  observers.StatementListMerge((yyval.statementList), (yyvsp[(1) - (6)].statementList));
-															  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[(4) - (6)].expression))); 
-															  observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (6)].statementList)); }
-    break;
-
-  case 116:
-
-/* Line 1806 of yacc.c  */
-#line 656 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 117:
-
-/* Line 1806 of yacc.c  */
-#line 657 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(1) - (7)].statementList));
-																			  	  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[(4) - (7)].expression))); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (7)].statementList)); }
-    break;
-
-  case 118:
-
-/* Line 1806 of yacc.c  */
-#line 664 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 119:
-
-/* Line 1806 of yacc.c  */
-#line 665 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (2)].statementList); }
-    break;
-
-  case 120:
-
-/* Line 1806 of yacc.c  */
-#line 669 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 121:
-
-/* Line 1806 of yacc.c  */
-#line 670 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (3)].statementList); }
-    break;
-
-  case 122:
-
-/* Line 1806 of yacc.c  */
-#line 674 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (1)].parametersList); }
-    break;
-
-  case 123:
-
-/* Line 1806 of yacc.c  */
-#line 675 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListNil(); }
-    break;
-
-  case 124:
-
-/* Line 1806 of yacc.c  */
-#line 680 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (2)].qualifiedName), (yyvsp[(2) - (2)].semanticValue), false, false); }
-    break;
-
-  case 125:
-
-/* Line 1806 of yacc.c  */
-#line 681 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue), true, false); }
-    break;
-
-  case 126:
-
-/* Line 1806 of yacc.c  */
-#line 682 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (5)].qualifiedName), (yyvsp[(3) - (5)].semanticValue), true, true);}
-    break;
-
-  case 127:
-
-/* Line 1806 of yacc.c  */
-#line 683 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (4)].qualifiedName), (yyvsp[(2) - (4)].semanticValue), false, true); }
-    break;
-
-  case 128:
-
-/* Line 1806 of yacc.c  */
-#line 684 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (4)].parametersList), (yyvsp[(3) - (4)].qualifiedName), (yyvsp[(4) - (4)].semanticValue), false, false); }
-    break;
-
-  case 129:
-
-/* Line 1806 of yacc.c  */
-#line 685 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (5)].parametersList), (yyvsp[(3) - (5)].qualifiedName), (yyvsp[(5) - (5)].semanticValue), true, false); }
-    break;
-
-  case 130:
-
-/* Line 1806 of yacc.c  */
-#line 686 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (7)].parametersList), (yyvsp[(3) - (7)].qualifiedName), (yyvsp[(5) - (7)].semanticValue), true, true); }
-    break;
-
-  case 131:
-
-/* Line 1806 of yacc.c  */
-#line 687 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (6)].parametersList), (yyvsp[(3) - (6)].qualifiedName), (yyvsp[(4) - (6)].semanticValue), false, true); }
-    break;
-
-  case 132:
-
-/* Line 1806 of yacc.c  */
-#line 691 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
-    break;
-
-  case 133:
-
-/* Line 1806 of yacc.c  */
-#line 692 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
-    break;
-
-  case 134:
-
-/* Line 1806 of yacc.c  */
-#line 693 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[(1) - (1)].semanticValue));}
-    break;
-
-  case 135:
-
-/* Line 1806 of yacc.c  */
-#line 697 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 136:
-
-/* Line 1806 of yacc.c  */
-#line 698 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) =  observers.StatementListNil(); }
-    break;
-
-  case 137:
-
-/* Line 1806 of yacc.c  */
-#line 702 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 138:
-
-/* Line 1806 of yacc.c  */
-#line 703 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].variable)); }
-    break;
-
-  case 139:
-
-/* Line 1806 of yacc.c  */
-#line 704 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 140:
-
-/* Line 1806 of yacc.c  */
-#line 705 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 141:
-
-/* Line 1806 of yacc.c  */
-#line 706 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].variable)); }
-    break;
-
-  case 142:
-
-/* Line 1806 of yacc.c  */
-#line 707 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (4)].statementList), (yyvsp[(4) - (4)].variable)); }
-    break;
-
-  case 143:
-
-/* Line 1806 of yacc.c  */
-#line 711 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 144:
-
-/* Line 1806 of yacc.c  */
-#line 712 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 145:
-
-/* Line 1806 of yacc.c  */
-#line 716 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeGlobalVariable((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 146:
-
-/* Line 1806 of yacc.c  */
-#line 717 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
-    break;
-
-  case 147:
-
-/* Line 1806 of yacc.c  */
-#line 718 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
-    break;
-
-  case 148:
-
-/* Line 1806 of yacc.c  */
-#line 722 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), observers.ExpressionMakeStaticVariable((yyvsp[(3) - (3)].semanticValue))); }
+  case 80: /* class_entry_type: T_CLASS  */
+#line 559 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[0].semanticValue), false, false, false, false); }
+#line 4668 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 149:
-
-/* Line 1806 of yacc.c  */
-#line 723 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (5)].statementList), observers.ExpressionMakeStaticVariable((yyvsp[(3) - (5)].semanticValue))); }
+  case 81: /* class_entry_type: T_ABSTRACT T_CLASS  */
+#line 560 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[-1].semanticValue), true, false, false, false); }
+#line 4674 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 150:
-
-/* Line 1806 of yacc.c  */
-#line 724 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[(1) - (1)].semanticValue))); }
+  case 82: /* class_entry_type: T_FINAL T_CLASS  */
+#line 561 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[-1].semanticValue), false, true, false, false); }
+#line 4680 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 151:
-
-/* Line 1806 of yacc.c  */
-#line 725 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[(1) - (3)].semanticValue))); }
+  case 83: /* extends_from: %empty  */
+#line 565 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4686 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 152:
-
-/* Line 1806 of yacc.c  */
-#line 729 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 84: /* extends_from: T_EXTENDS fully_qualified_class_name  */
+#line 567 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.classSymbol) = observers.ClassSymbolExtends((yyvsp[0].qualifiedName)); }
+#line 4692 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 153:
-
-/* Line 1806 of yacc.c  */
-#line 730 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 85: /* interface_entry: T_INTERFACE  */
+#line 571 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[0].semanticValue), false, false, true, false); }
+#line 4698 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 154:
-
-/* Line 1806 of yacc.c  */
-#line 734 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariables((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].classMemberSymbol)); }
+  case 86: /* interface_extends_list: %empty  */
+#line 575 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4704 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 155:
-
-/* Line 1806 of yacc.c  */
-#line 735 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 87: /* interface_extends_list: T_EXTENDS interface_list  */
+#line 577 "/root/repo/src/Php53FullParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4710 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 156:
-
-/* Line 1806 of yacc.c  */
-#line 737 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(4) - (7)].semanticValue)); }
+  case 88: /* implements_list: %empty  */
+#line 581 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4716 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 157:
-
-/* Line 1806 of yacc.c  */
-#line 738 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeMethod((yyvsp[(4) - (9)].semanticValue), (yyvsp[(1) - (9)].classMemberSymbol), (yyvsp[(3) - (9)].isMethod), (yyvsp[(2) - (9)].semanticValue), (yyvsp[(6) - (9)].parametersList), (yyvsp[(9) - (9)].classMemberSymbol)); 
-															  observers.SetCurrentMemberName(NULL);
-															}
+  case 89: /* implements_list: T_IMPLEMENTS interface_list  */
+#line 583 "/root/repo/src/Php53FullParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4722 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 158:
-
-/* Line 1806 of yacc.c  */
-#line 744 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody(observers.StatementListNil(), (yyvsp[(1) - (1)].semanticValue), (yyvsp[(1) - (1)].semanticValue)); }
+  case 90: /* interface_list: fully_qualified_class_name  */
+#line 587 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[0].qualifiedName)); }
+#line 4728 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 159:
-
-/* Line 1806 of yacc.c  */
-#line 745 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].semanticValue), (yyvsp[(3) - (3)].semanticValue)); }
+  case 91: /* interface_list: interface_list ',' fully_qualified_class_name  */
+#line 588 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[-2].classSymbol), (yyvsp[0].qualifiedName)); }
+#line 4734 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 160:
-
-/* Line 1806 of yacc.c  */
-#line 749 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 161:
-
-/* Line 1806 of yacc.c  */
-#line 750 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMakeAsPublicVariable((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 162:
-
-/* Line 1806 of yacc.c  */
-#line 754 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
-    break;
-
-  case 163:
-
-/* Line 1806 of yacc.c  */
-#line 755 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 164:
-
-/* Line 1806 of yacc.c  */
-#line 759 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 165:
-
-/* Line 1806 of yacc.c  */
-#line 760 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolSetModifier((yyvsp[(1) - (2)].classMemberSymbol), (yyvsp[(2) - (2)].semanticValue)); }
-    break;
-
-  case 172:
-
-/* Line 1806 of yacc.c  */
-#line 773 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (3)].semanticValue), (yyvsp[(3) - (3)].semanticValue), false, analyzer.GetLineNumber())); }
-    break;
-
-  case 173:
-
-/* Line 1806 of yacc.c  */
-#line 774 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (5)].semanticValue), (yyvsp[(3) - (5)].semanticValue), false, analyzer.GetLineNumber()));  }
-    break;
-
-  case 174:
-
-/* Line 1806 of yacc.c  */
-#line 775 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(1) - (1)].semanticValue), (yyvsp[(1) - (1)].semanticValue), false, analyzer.GetLineNumber()); }
-    break;
-
-  case 175:
-
-/* Line 1806 of yacc.c  */
-#line 776 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(1) - (3)].semanticValue), (yyvsp[(1) - (3)].semanticValue), false, analyzer.GetLineNumber()); }
+  case 92: /* foreach_optional_arg: %empty  */
+#line 592 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) =  observers.ExpressionNil(); }
+#line 4740 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 176:
+  case 93: /* foreach_optional_arg: T_DOUBLE_ARROW foreach_variable  */
+#line 593 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 4746 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 781 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (5)].semanticValue), (yyvsp[(3) - (5)].semanticValue), true, analyzer.GetLineNumber())); }
+  case 94: /* foreach_variable: variable  */
+#line 597 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[0].variable)); }
+#line 4752 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 177:
+  case 95: /* foreach_variable: '&' variable  */
+#line 598 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[0].variable)); }
+#line 4758 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 782 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(2) - (4)].semanticValue), (yyvsp[(1) - (4)].semanticValue), true, analyzer.GetLineNumber()); }
+  case 96: /* for_statement: statement  */
+#line 602 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4764 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 178:
+  case 97: /* for_statement: ':' inner_statement_list T_ENDFOR ';'  */
+#line 603 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4770 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 786 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
+  case 98: /* foreach_statement: statement  */
+#line 607 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4776 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 179:
+  case 99: /* foreach_statement: ':' inner_statement_list T_ENDFOREACH ';'  */
+#line 608 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4782 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 787 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
+  case 100: /* declare_statement: statement  */
+#line 612 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4788 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 180:
+  case 101: /* declare_statement: ':' inner_statement_list T_ENDDECLARE ';'  */
+#line 613 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4794 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 791 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 102: /* declare_list: T_STRING '=' static_scalar  */
+#line 617 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4800 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 181:
+  case 103: /* declare_list: declare_list ',' T_STRING '=' static_scalar  */
+#line 618 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4806 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 792 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 104: /* switch_case_list: '{' case_list '}'  */
+#line 622 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4812 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 182:
+  case 105: /* switch_case_list: '{' ';' case_list '}'  */
+#line 623 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4818 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 796 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) =  observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
+  case 106: /* switch_case_list: ':' case_list T_ENDSWITCH ';'  */
+#line 624 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4824 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 183:
+  case 107: /* switch_case_list: ':' ';' case_list T_ENDSWITCH ';'  */
+#line 625 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4830 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 797 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
+  case 108: /* case_list: %empty  */
+#line 629 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4836 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 184:
+  case 109: /* case_list: case_list T_CASE expr case_separator inner_statement_list  */
+#line 630 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-4].statementList);
+																				  observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																			      observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); 
+																				}
+#line 4845 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 801 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAssignmentList((yyvsp[(3) - (6)].statementList), (yyvsp[(6) - (6)].expression)); }
+  case 110: /* case_list: case_list T_DEFAULT case_separator inner_statement_list  */
+#line 634 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-3].statementList); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList));
+																				}
+#line 4853 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 185:
+  case 113: /* while_statement: statement  */
+#line 645 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4859 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 802 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromExpressionFound((yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 114: /* while_statement: ':' inner_statement_list T_ENDWHILE ';'  */
+#line 646 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4865 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 186:
+  case 115: /* elseif_list: %empty  */
+#line 650 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4871 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 803 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromVariableFound((yyvsp[(1) - (4)].variable), (yyvsp[(4) - (4)].variable)); }
+  case 116: /* elseif_list: elseif_list T_ELSEIF '(' expr ')' statement  */
+#line 651 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMake(); 
+															  observers.StatementListMerge((yyval.statementList), (yyvsp[-5].statementList));
+															  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[-2].expression))); 
+															  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4880 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 187:
+  case 117: /* new_elseif_list: %empty  */
+#line 658 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4886 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 804 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromNewFound((yyvsp[(1) - (6)].variable), (yyvsp[(5) - (6)].qualifiedName), (yyvsp[(6) - (6)].statementList)); }
+  case 118: /* new_elseif_list: new_elseif_list T_ELSEIF '(' expr ')' ':' inner_statement_list  */
+#line 659 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMake(); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[-6].statementList));
+																			  	  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[-3].expression))); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4895 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 188:
+  case 119: /* else_single: %empty  */
+#line 666 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4901 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 805 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeNewInstanceCall((yyvsp[(2) - (3)].qualifiedName), (yyvsp[(3) - (3)].statementList)); }
+  case 120: /* else_single: T_ELSE statement  */
+#line 667 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4907 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 189:
+  case 121: /* new_else_single: %empty  */
+#line 671 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4913 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 806 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
+  case 122: /* new_else_single: T_ELSE ':' inner_statement_list  */
+#line 672 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4919 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 190:
+  case 123: /* parameter_list: non_empty_parameter_list  */
+#line 676 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.parametersList) = (yyvsp[0].parametersList); }
+#line 4925 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 807 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 124: /* parameter_list: %empty  */
+#line 677 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.parametersList) = observers.ParametersListNil(); }
+#line 4931 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 191:
+  case 125: /* non_empty_parameter_list: optional_class_type T_VARIABLE  */
+#line 682 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-1].qualifiedName), (yyvsp[0].semanticValue), false, false); }
+#line 4937 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 808 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 126: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE  */
+#line 683 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue), true, false); }
+#line 4943 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 192:
+  case 127: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 684 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-4].qualifiedName), (yyvsp[-2].semanticValue), true, true);}
+#line 4949 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 809 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 128: /* non_empty_parameter_list: optional_class_type T_VARIABLE '=' static_scalar  */
+#line 685 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-3].qualifiedName), (yyvsp[-2].semanticValue), false, true); }
+#line 4955 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 193:
+  case 129: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE  */
+#line 686 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-3].parametersList), (yyvsp[-1].qualifiedName), (yyvsp[0].semanticValue), false, false); }
+#line 4961 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 810 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 130: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE  */
+#line 687 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-4].parametersList), (yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue), true, false); }
+#line 4967 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 194:
+  case 131: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 688 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-6].parametersList), (yyvsp[-4].qualifiedName), (yyvsp[-2].semanticValue), true, true); }
+#line 4973 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 811 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 132: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE '=' static_scalar  */
+#line 689 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-5].parametersList), (yyvsp[-3].qualifiedName), (yyvsp[-2].semanticValue), false, true); }
+#line 4979 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 195:
+  case 133: /* optional_class_type: %empty  */
+#line 693 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 4985 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 812 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 134: /* optional_class_type: fully_qualified_class_name  */
+#line 694 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 4991 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 196:
+  case 135: /* optional_class_type: T_ARRAY  */
+#line 695 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[0].semanticValue));}
+#line 4997 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 813 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 136: /* function_call_parameter_list: non_empty_function_call_parameter_list  */
+#line 699 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5003 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 197:
+  case 137: /* function_call_parameter_list: %empty  */
+#line 700 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) =  observers.StatementListNil(); }
+#line 5009 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 814 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 138: /* non_empty_function_call_parameter_list: expr_without_variable  */
+#line 704 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5015 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 198:
+  case 139: /* non_empty_function_call_parameter_list: variable  */
+#line 705 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 5021 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 815 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 140: /* non_empty_function_call_parameter_list: '&' w_variable  */
+#line 706 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 5027 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 199:
+  case 141: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' expr_without_variable  */
+#line 707 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5033 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 816 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 142: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' variable  */
+#line 708 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].variable)); }
+#line 5039 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 200:
+  case 143: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' '&' w_variable  */
+#line 709 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-3].statementList), (yyvsp[0].variable)); }
+#line 5045 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 817 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
+  case 144: /* global_var_list: global_var_list ',' global_var  */
+#line 713 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5051 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 201:
+  case 145: /* global_var_list: global_var  */
+#line 714 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5057 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 818 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(2) - (2)].semanticValue)->Token, (yyvsp[(1) - (2)].variable)); }
+  case 146: /* global_var: T_VARIABLE  */
+#line 718 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionMakeGlobalVariable((yyvsp[0].semanticValue)); }
+#line 5063 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 202:
+  case 147: /* global_var: '$' r_variable  */
+#line 719 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 5069 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 819 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].variable)); }
+  case 148: /* global_var: '$' '{' expr '}'  */
+#line 720 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 5075 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 203:
+  case 149: /* static_var_list: static_var_list ',' T_VARIABLE  */
+#line 724 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), observers.ExpressionMakeStaticVariable((yyvsp[0].semanticValue))); }
+#line 5081 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 820 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(2) - (2)].semanticValue)->Token, (yyvsp[(1) - (2)].variable)); }
+  case 150: /* static_var_list: static_var_list ',' T_VARIABLE '=' static_scalar  */
+#line 725 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-4].statementList), observers.ExpressionMakeStaticVariable((yyvsp[-2].semanticValue))); }
+#line 5087 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 204:
+  case 151: /* static_var_list: T_VARIABLE  */
+#line 726 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[0].semanticValue))); }
+#line 5093 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 821 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].variable)); }
+  case 152: /* static_var_list: T_VARIABLE '=' static_scalar  */
+#line 727 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[-2].semanticValue))); }
+#line 5099 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 205:
+  case 153: /* class_statement_list: class_statement_list class_statement  */
+#line 731 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 5105 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 822 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 154: /* class_statement_list: %empty  */
+#line 732 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMake(); }
+#line 5111 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 206:
+  case 155: /* class_statement: variable_modifiers class_variable_declaration ';'  */
+#line 736 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeVariables((yyvsp[-1].statementList), (yyvsp[-2].classMemberSymbol)); }
+#line 5117 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 823 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 156: /* class_statement: class_constant_declaration ';'  */
+#line 737 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5123 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 207:
+  case 157: /* $@6: %empty  */
+#line 739 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { observers.SetCurrentMemberName((yyvsp[-3].semanticValue)); }
+#line 5129 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 824 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 158: /* class_statement: method_modifiers function is_reference T_STRING '(' parameter_list ')' $@6 method_body  */
+#line 740 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.ClassMemberSymbolMakeMethod((yyvsp[-5].semanticValue), (yyvsp[-8].classMemberSymbol), (yyvsp[-6].isMethod), (yyvsp[-7].semanticValue), (yyvsp[-3].parametersList), (yyvsp[0].classMemberSymbol)); 
+															  observers.SetCurrentMemberName(NULL);
+															}
+#line 5137 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 208:
+  case 159: /* class_statement: error ';'  */
+#line 743 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListNil(); yyerrok; }
+#line 5143 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 825 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 160: /* method_body: ';'  */
+#line 747 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody(observers.StatementListNil(), (yyvsp[0].semanticValue), (yyvsp[0].semanticValue)); }
+#line 5149 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 209:
+  case 161: /* method_body: '{' inner_statement_list '}'  */
+#line 748 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody((yyvsp[-1].statementList), (yyvsp[-2].semanticValue), (yyvsp[0].semanticValue)); }
+#line 5155 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 826 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 162: /* variable_modifiers: non_empty_member_modifiers  */
+#line 752 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5161 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 210:
+  case 163: /* variable_modifiers: T_VAR  */
+#line 753 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMakeAsPublicVariable((yyvsp[0].semanticValue)); }
+#line 5167 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 827 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 164: /* method_modifiers: %empty  */
+#line 757 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
+#line 5173 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 211:
+  case 165: /* method_modifiers: non_empty_member_modifiers  */
+#line 758 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5179 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 828 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 166: /* non_empty_member_modifiers: member_modifier  */
+#line 762 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[0].semanticValue)); }
+#line 5185 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 212:
+  case 167: /* non_empty_member_modifiers: non_empty_member_modifiers member_modifier  */
+#line 763 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolSetModifier((yyvsp[-1].classMemberSymbol), (yyvsp[0].semanticValue)); }
+#line 5191 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 829 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 174: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE  */
+#line 776 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[0].semanticValue), (yyvsp[0].semanticValue), false, analyzer.GetLineNumber())); }
+#line 5197 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 213:
+  case 175: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE '=' static_scalar  */
+#line 777 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), false, analyzer.GetLineNumber()));  }
+#line 5203 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 830 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 176: /* class_variable_declaration: T_VARIABLE  */
+#line 778 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[0].semanticValue), (yyvsp[0].semanticValue), false, analyzer.GetLineNumber()); }
+#line 5209 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 214:
+  case 177: /* class_variable_declaration: T_VARIABLE '=' static_scalar  */
+#line 779 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), false, analyzer.GetLineNumber()); }
+#line 5215 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 831 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 178: /* class_constant_declaration: class_constant_declaration ',' T_STRING '=' static_scalar  */
+#line 784 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), true, analyzer.GetLineNumber())); }
+#line 5221 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 215:
+  case 179: /* class_constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 785 "/root/repo/src/Php53FullParser.y"
+                                                    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-3].semanticValue), true, analyzer.GetLineNumber()); }
+#line 5227 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 832 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 180: /* echo_expr_list: echo_expr_list ',' expr  */
+#line 789 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5233 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 216:
+  case 181: /* echo_expr_list: expr  */
+#line 790 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5239 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 833 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 182: /* for_expr: %empty  */
+#line 794 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5245 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 217:
+  case 183: /* for_expr: non_empty_for_expr  */
+#line 795 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5251 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 834 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 184: /* non_empty_for_expr: non_empty_for_expr ',' expr  */
+#line 799 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.statementList) =  observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5257 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 218:
+  case 185: /* non_empty_for_expr: expr  */
+#line 800 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5263 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 835 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 186: /* expr_without_variable: T_LIST '(' assignment_list ')' '=' expr  */
+#line 804 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeAssignmentList((yyvsp[-3].statementList), (yyvsp[0].expression)); }
+#line 5269 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 219:
+  case 187: /* expr_without_variable: variable '=' expr  */
+#line 805 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.AssignmentExpressionFromExpressionFound((yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5275 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 836 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 188: /* expr_without_variable: variable '=' '&' variable  */
+#line 806 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.AssignmentExpressionFromVariableFound((yyvsp[-3].variable), (yyvsp[0].variable)); }
+#line 5281 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 220:
+  case 189: /* expr_without_variable: variable '=' '&' T_NEW class_name_reference ctor_arguments  */
+#line 807 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.AssignmentExpressionFromNewFound((yyvsp[-5].variable), (yyvsp[-1].qualifiedName), (yyvsp[0].statementList)); }
+#line 5287 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 837 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 190: /* expr_without_variable: T_NEW class_name_reference ctor_arguments  */
+#line 808 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeNewInstanceCall((yyvsp[-1].qualifiedName), (yyvsp[0].statementList)); }
+#line 5293 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 221:
+  case 191: /* expr_without_variable: T_CLONE expr  */
+#line 809 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 5299 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 838 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 192: /* expr_without_variable: variable T_PLUS_EQUAL expr  */
+#line 810 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5305 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 222:
+  case 193: /* expr_without_variable: variable T_MINUS_EQUAL expr  */
+#line 811 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5311 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 839 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 194: /* expr_without_variable: variable T_MUL_EQUAL expr  */
+#line 812 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5317 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 223:
+  case 195: /* expr_without_variable: variable T_DIV_EQUAL expr  */
+#line 813 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5323 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 840 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 196: /* expr_without_variable: variable T_CONCAT_EQUAL expr  */
+#line 814 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5329 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 224:
+  case 197: /* expr_without_variable: variable T_MOD_EQUAL expr  */
+#line 815 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5335 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 841 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 198: /* expr_without_variable: variable T_AND_EQUAL expr  */
+#line 816 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5341 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 225:
+  case 199: /* expr_without_variable: variable T_OR_EQUAL expr  */
+#line 817 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5347 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 842 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 200: /* expr_without_variable: variable T_XOR_EQUAL expr  */
+#line 818 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5353 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 226:
+  case 201: /* expr_without_variable: variable T_SL_EQUAL expr  */
+#line 819 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5359 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 843 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 202: /* expr_without_variable: variable T_SR_EQUAL expr  */
+#line 820 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5365 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 227:
+  case 203: /* expr_without_variable: rw_variable T_INC  */
+#line 821 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[0].semanticValue)->Token, (yyvsp[-1].variable)); }
+#line 5371 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 844 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 204: /* expr_without_variable: T_INC rw_variable  */
+#line 822 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].variable)); }
+#line 5377 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 228:
+  case 205: /* expr_without_variable: rw_variable T_DEC  */
+#line 823 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[0].semanticValue)->Token, (yyvsp[-1].variable)); }
+#line 5383 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 845 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 206: /* expr_without_variable: T_DEC rw_variable  */
+#line 824 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].variable)); }
+#line 5389 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 229:
+  case 207: /* expr_without_variable: expr T_BOOLEAN_OR expr  */
+#line 825 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5395 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 846 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 208: /* expr_without_variable: expr T_BOOLEAN_AND expr  */
+#line 826 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5401 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 230:
+  case 209: /* expr_without_variable: expr T_LOGICAL_OR expr  */
+#line 827 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5407 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 847 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 210: /* expr_without_variable: expr T_LOGICAL_AND expr  */
+#line 828 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5413 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 231:
+  case 211: /* expr_without_variable: expr T_LOGICAL_XOR expr  */
+#line 829 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5419 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 848 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 212: /* expr_without_variable: expr '|' expr  */
+#line 830 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5425 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 232:
+  case 213: /* expr_without_variable: expr '&' expr  */
+#line 831 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5431 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 849 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 214: /* expr_without_variable: expr '^' expr  */
+#line 832 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5437 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 233:
+  case 215: /* expr_without_variable: expr '.' expr  */
+#line 833 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5443 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 850 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionInstanceOfOperation((yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].qualifiedName)); }
+  case 216: /* expr_without_variable: expr '+' expr  */
+#line 834 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5449 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 234:
+  case 217: /* expr_without_variable: expr '-' expr  */
+#line 835 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5455 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 851 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (3)].expression); }
+  case 218: /* expr_without_variable: expr '*' expr  */
+#line 836 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5461 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 235:
+  case 219: /* expr_without_variable: expr '/' expr  */
+#line 837 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5467 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 854 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[(1) - (5)].expression), (yyvsp[(3) - (5)].expression), (yyvsp[(5) - (5)].expression)); }
+  case 220: /* expr_without_variable: expr '%' expr  */
+#line 838 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5473 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 236:
+  case 221: /* expr_without_variable: expr T_SL expr  */
+#line 839 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5479 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 856 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[(1) - (4)].expression), (yyvsp[(4) - (4)].expression), NULL); }
+  case 222: /* expr_without_variable: expr T_SR expr  */
+#line 840 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5485 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 237:
+  case 223: /* expr_without_variable: '+' expr  */
+#line 841 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5491 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 857 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 224: /* expr_without_variable: '-' expr  */
+#line 842 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5497 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 238:
+  case 225: /* expr_without_variable: '!' expr  */
+#line 843 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5503 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 858 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 226: /* expr_without_variable: '~' expr  */
+#line 844 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5509 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 239:
+  case 227: /* expr_without_variable: expr T_IS_IDENTICAL expr  */
+#line 845 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5515 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 859 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 228: /* expr_without_variable: expr T_IS_NOT_IDENTICAL expr  */
+#line 846 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5521 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 240:
+  case 229: /* expr_without_variable: expr T_IS_EQUAL expr  */
+#line 847 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5527 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 860 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 230: /* expr_without_variable: expr T_IS_NOT_EQUAL expr  */
+#line 848 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5533 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 241:
+  case 231: /* expr_without_variable: expr '<' expr  */
+#line 849 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5539 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 861 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeArray(observers.StatementListMakeAndAppend((yyvsp[(2) - (2)].expression))); }
+  case 232: /* expr_without_variable: expr T_IS_SMALLER_OR_EQUAL expr  */
+#line 850 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5545 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 242:
+  case 233: /* expr_without_variable: expr '>' expr  */
+#line 851 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5551 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 862 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 234: /* expr_without_variable: expr T_IS_GREATER_OR_EQUAL expr  */
+#line 852 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5557 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 243:
+  case 235: /* expr_without_variable: expr T_INSTANCEOF class_name_reference  */
+#line 853 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionInstanceOfOperation((yyvsp[-2].expression), (yyvsp[0].qualifiedName)); }
+#line 5563 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 863 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 236: /* expr_without_variable: '(' expr ')'  */
+#line 854 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = (yyvsp[-1].expression); }
+#line 5569 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 244:
+  case 237: /* expr_without_variable: expr '?' expr ':' expr  */
+#line 857 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[-4].expression), (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5575 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 864 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 238: /* expr_without_variable: expr '?' ':' expr  */
+#line 859 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[-3].expression), (yyvsp[0].expression), NULL); }
+#line 5581 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 245:
+  case 239: /* expr_without_variable: internal_functions_in_yacc  */
+#line 860 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 5587 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 865 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 240: /* expr_without_variable: T_INT_CAST expr  */
+#line 861 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5593 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 246:
+  case 241: /* expr_without_variable: T_DOUBLE_CAST expr  */
+#line 862 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5599 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 866 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 242: /* expr_without_variable: T_STRING_CAST expr  */
+#line 863 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5605 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 247:
+  case 243: /* expr_without_variable: T_ARRAY_CAST expr  */
+#line 864 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionMakeArray(observers.StatementListMakeAndAppend((yyvsp[0].expression))); }
+#line 5611 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 867 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression);}
+  case 244: /* expr_without_variable: T_OBJECT_CAST expr  */
+#line 865 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5617 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 248:
+  case 245: /* expr_without_variable: T_BOOL_CAST expr  */
+#line 866 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5623 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 868 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[(3) - (4)].statementList)); }
+  case 246: /* expr_without_variable: T_UNSET_CAST expr  */
+#line 867 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5629 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 249:
+  case 247: /* expr_without_variable: T_EXIT exit_expr  */
+#line 868 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5635 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 869 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].expression)); /* results of backtick operator is a string */ }
+  case 248: /* expr_without_variable: '@' expr  */
+#line 869 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5641 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 250:
+  case 249: /* expr_without_variable: scalar  */
+#line 870 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = (yyvsp[0].expression);}
+#line 5647 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 870 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (2)].expression)); }
+  case 250: /* expr_without_variable: T_ARRAY '(' array_pair_list ')'  */
+#line 871 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[-1].statementList)); }
+#line 5653 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 251:
+  case 251: /* expr_without_variable: '`' backticks_expr '`'  */
+#line 872 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].expression)); /* results of backtick operator is a string */ }
+#line 5659 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 873 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 252: /* expr_without_variable: T_PRINT expr  */
+#line 873 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].expression)); }
+#line 5665 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 252:
+  case 253: /* $@7: %empty  */
+#line 876 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 5671 "/root/repo/src/Php53FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 874 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[(4) - (10)].parametersList), (yyvsp[(6) - (10)].statementList), (yyvsp[(9) - (10)].statementList), (yyvsp[(7) - (10)].semanticValue), (yyvsp[(10) - (10)].semanticValue));  
+  case 254: /* expr_without_variable: function is_reference '(' parameter_list ')' lexical_vars '{' $@7 inner_statement_list '}'  */
+#line 877 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[-6].parametersList), (yyvsp[-4].statementList), (yyvsp[-1].statementList), (yyvsp[-3].semanticValue), (yyvsp[0].semanticValue));  
 																	  
 																	  // end after we create the closure so that closure gets the correct scope
 																	  // anonymous function count
 																	  observers.EndAnonymousFunction(); 
 																	}
+#line 5682 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 254:
-
-/* Line 1806 of yacc.c  */
-#line 887 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 256: /* lexical_vars: %empty  */
+#line 890 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5688 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 255:
-
-/* Line 1806 of yacc.c  */
-#line 888 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
+  case 257: /* lexical_vars: T_USE '(' lexical_var_list ')'  */
+#line 891 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5694 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 256:
-
-/* Line 1806 of yacc.c  */
-#line 892 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), 
-														       observers.VariableStart((yyvsp[(3) - (3)].semanticValue))
+  case 258: /* lexical_var_list: lexical_var_list ',' T_VARIABLE  */
+#line 895 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), 
+														       observers.VariableStart((yyvsp[0].semanticValue))
 		                                                   ); 
 		                                            }
+#line 5703 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 257:
-
-/* Line 1806 of yacc.c  */
-#line 896 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (4)].statementList), 
-	                                                         observers.VariableStart((yyvsp[(4) - (4)].semanticValue), true)
+  case 259: /* lexical_var_list: lexical_var_list ',' '&' T_VARIABLE  */
+#line 899 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-3].statementList), 
+	                                                         observers.VariableStart((yyvsp[0].semanticValue), true)
 		                                                   ); 
 		                                            }
+#line 5712 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 258:
-
-/* Line 1806 of yacc.c  */
-#line 900 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[(1) - (1)].semanticValue))); }
+  case 260: /* lexical_var_list: T_VARIABLE  */
+#line 903 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[0].semanticValue))); }
+#line 5718 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 259:
-
-/* Line 1806 of yacc.c  */
-#line 901 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[(2) - (2)].semanticValue), true)); }
+  case 261: /* lexical_var_list: '&' T_VARIABLE  */
+#line 904 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[0].semanticValue), true)); }
+#line 5724 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 260:
-
-/* Line 1806 of yacc.c  */
-#line 906 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCall((yyvsp[(1) - (4)].qualifiedName), (yyvsp[(3) - (4)].statementList), analyzer.GetLineNumber()); }
+  case 262: /* function_call: namespace_name '(' function_call_parameter_list ')'  */
+#line 909 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCall((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 5730 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 261:
-
-/* Line 1806 of yacc.c  */
-#line 909 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCallFromDeclaredNamespace((yyvsp[(3) - (6)].qualifiedName), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber()); }
+  case 263: /* function_call: T_NAMESPACE T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 912 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCallFromDeclaredNamespace((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 5736 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 262:
-
-/* Line 1806 of yacc.c  */
-#line 911 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCallFromAbsoluteNamespace((yyvsp[(2) - (5)].qualifiedName), (yyvsp[(4) - (5)].statementList), analyzer.GetLineNumber()); }
+  case 264: /* function_call: T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 914 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCallFromAbsoluteNamespace((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 5742 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 263:
-
-/* Line 1806 of yacc.c  */
-#line 913 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeStaticMethodCall((yyvsp[(1) - (6)].qualifiedName), (yyvsp[(3) - (6)].semanticValue), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber()); }
+  case 265: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING '(' function_call_parameter_list ')'  */
+#line 916 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeStaticMethodCall((yyvsp[-5].qualifiedName), (yyvsp[-3].semanticValue), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 5748 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 264:
-
-/* Line 1806 of yacc.c  */
-#line 915 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 266: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 918 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5754 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 265:
-
-/* Line 1806 of yacc.c  */
-#line 917 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 267: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING '(' function_call_parameter_list ')'  */
+#line 920 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5760 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 266:
-
-/* Line 1806 of yacc.c  */
-#line 919 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 268: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 922 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5766 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 267:
-
-/* Line 1806 of yacc.c  */
-#line 921 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 269: /* function_call: variable_without_objects '(' function_call_parameter_list ')'  */
+#line 924 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5772 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 268:
-
-/* Line 1806 of yacc.c  */
-#line 925 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 270: /* class_name: T_STATIC  */
+#line 928 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 5778 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 269:
-
-/* Line 1806 of yacc.c  */
-#line 926 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 271: /* class_name: namespace_name  */
+#line 929 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5784 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 270:
-
-/* Line 1806 of yacc.c  */
-#line 927 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName)); }
+  case 272: /* class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 930 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName)); }
+#line 5790 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 271:
-
-/* Line 1806 of yacc.c  */
-#line 928 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 273: /* class_name: T_NS_SEPARATOR namespace_name  */
+#line 931 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName)); }
+#line 5796 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 272:
-
-/* Line 1806 of yacc.c  */
-#line 932 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 274: /* fully_qualified_class_name: namespace_name  */
+#line 935 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5802 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 273:
-
-/* Line 1806 of yacc.c  */
-#line 933 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName)); }
+  case 275: /* fully_qualified_class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 936 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName)); }
+#line 5808 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 274:
-
-/* Line 1806 of yacc.c  */
-#line 934 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 276: /* fully_qualified_class_name: T_NS_SEPARATOR namespace_name  */
+#line 937 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName)); }
+#line 5814 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 275:
-
-/* Line 1806 of yacc.c  */
-#line 938 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 277: /* class_name_reference: class_name  */
+#line 941 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5820 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 276:
-
-/* Line 1806 of yacc.c  */
-#line 939 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 278: /* class_name_reference: dynamic_class_name_reference  */
+#line 942 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5826 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 277:
-
-/* Line 1806 of yacc.c  */
-#line 944 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 279: /* dynamic_class_name_reference: base_variable T_OBJECT_OPERATOR object_property dynamic_class_name_variable_properties  */
+#line 947 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 5832 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 278:
-
-/* Line 1806 of yacc.c  */
-#line 945 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 280: /* dynamic_class_name_reference: base_variable  */
+#line 948 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 5838 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 279:
-
-/* Line 1806 of yacc.c  */
-#line 949 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = (yyvsp[(1) - (2)].semanticValue); }
+  case 281: /* dynamic_class_name_variable_properties: dynamic_class_name_variable_properties dynamic_class_name_variable_property  */
+#line 952 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.semanticValue) = (yyvsp[-1].semanticValue); }
+#line 5844 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 280:
-
-/* Line 1806 of yacc.c  */
-#line 950 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 282: /* dynamic_class_name_variable_properties: %empty  */
+#line 953 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 5850 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 282:
-
-/* Line 1806 of yacc.c  */
-#line 958 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 284: /* exit_expr: %empty  */
+#line 961 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5856 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 283:
-
-/* Line 1806 of yacc.c  */
-#line 959 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 285: /* exit_expr: '(' ')'  */
+#line 962 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5862 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 284:
-
-/* Line 1806 of yacc.c  */
-#line 960 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (3)].expression); }
+  case 286: /* exit_expr: '(' expr ')'  */
+#line 963 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 5868 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 285:
-
-/* Line 1806 of yacc.c  */
-#line 964 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 287: /* backticks_expr: %empty  */
+#line 967 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5874 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 286:
-
-/* Line 1806 of yacc.c  */
-#line 965 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 288: /* backticks_expr: T_ENCAPSED_AND_WHITESPACE  */
+#line 968 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5880 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 287:
-
-/* Line 1806 of yacc.c  */
-#line 966 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 289: /* backticks_expr: encaps_list  */
+#line 969 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5886 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 288:
-
-/* Line 1806 of yacc.c  */
-#line 970 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 290: /* ctor_arguments: %empty  */
+#line 973 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5892 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 289:
-
-/* Line 1806 of yacc.c  */
-#line 971 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 291: /* ctor_arguments: '(' function_call_parameter_list ')'  */
+#line 974 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5898 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 290:
-
-/* Line 1806 of yacc.c  */
-#line 975 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 292: /* common_scalar: T_LNUMBER  */
+#line 978 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5904 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 291:
-
-/* Line 1806 of yacc.c  */
-#line 976 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 293: /* common_scalar: T_DNUMBER  */
+#line 979 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5910 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 292:
-
-/* Line 1806 of yacc.c  */
-#line 977 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 294: /* common_scalar: T_CONSTANT_ENCAPSED_STRING  */
+#line 980 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5916 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 293:
-
-/* Line 1806 of yacc.c  */
-#line 978 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 295: /* common_scalar: T_LINE  */
+#line 981 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5922 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 294:
-
-/* Line 1806 of yacc.c  */
-#line 979 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 296: /* common_scalar: T_FILE  */
+#line 982 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5928 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 295:
-
-/* Line 1806 of yacc.c  */
-#line 980 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 297: /* common_scalar: T_DIR  */
+#line 983 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5934 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 296:
-
-/* Line 1806 of yacc.c  */
-#line 981 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 298: /* common_scalar: T_CLASS_C  */
+#line 984 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5940 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 297:
-
-/* Line 1806 of yacc.c  */
-#line 982 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 299: /* common_scalar: T_METHOD_C  */
+#line 985 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5946 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 298:
-
-/* Line 1806 of yacc.c  */
-#line 983 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 300: /* common_scalar: T_FUNC_C  */
+#line 986 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5952 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 299:
-
-/* Line 1806 of yacc.c  */
-#line 984 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 301: /* common_scalar: T_NS_C  */
+#line 987 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 5958 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 300:
-
-/* Line 1806 of yacc.c  */
-#line 985 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].semanticValue)); }
+  case 302: /* common_scalar: T_START_HEREDOC T_ENCAPSED_AND_WHITESPACE T_END_HEREDOC  */
+#line 988 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 5964 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 301:
-
-/* Line 1806 of yacc.c  */
-#line 986 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (2)].semanticValue)); }
+  case 303: /* common_scalar: T_START_HEREDOC T_END_HEREDOC  */
+#line 989 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 5970 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 302:
-
-/* Line 1806 of yacc.c  */
-#line 990 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 304: /* static_scalar: common_scalar  */
+#line 993 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5976 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 303:
-
-/* Line 1806 of yacc.c  */
-#line 991 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 305: /* static_scalar: namespace_name  */
+#line 994 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5982 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 304:
-
-/* Line 1806 of yacc.c  */
-#line 992 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 306: /* static_scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 995 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 5988 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 305:
-
-/* Line 1806 of yacc.c  */
-#line 993 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 307: /* static_scalar: T_NS_SEPARATOR namespace_name  */
+#line 996 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 5994 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 306:
-
-/* Line 1806 of yacc.c  */
-#line 994 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 308: /* static_scalar: '+' static_scalar  */
+#line 997 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6000 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 307:
-
-/* Line 1806 of yacc.c  */
-#line 995 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 309: /* static_scalar: '-' static_scalar  */
+#line 998 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6006 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 308:
-
-/* Line 1806 of yacc.c  */
-#line 996 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(3) - (4)].semanticValue)); }
+  case 310: /* static_scalar: T_ARRAY '(' static_array_pair_list ')'  */
+#line 999 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 6012 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 310:
-
-/* Line 1806 of yacc.c  */
-#line 1001 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 312: /* static_class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1004 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 6018 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 311:
-
-/* Line 1806 of yacc.c  */
-#line 1005 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 313: /* scalar: T_STRING_VARNAME  */
+#line 1008 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6024 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 312:
-
-/* Line 1806 of yacc.c  */
-#line 1006 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 314: /* scalar: class_constant  */
+#line 1009 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6030 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 313:
-
-/* Line 1806 of yacc.c  */
-#line 1007 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant((yyvsp[(1) - (1)].qualifiedName)); }
+  case 315: /* scalar: namespace_name  */
+#line 1010 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalarFromConstant((yyvsp[0].qualifiedName)); }
+#line 6036 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 314:
-
-/* Line 1806 of yacc.c  */
-#line 1008 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName))); }
+  case 316: /* scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1011 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName))); }
+#line 6042 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 315:
-
-/* Line 1806 of yacc.c  */
-#line 1009 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName))); }
+  case 317: /* scalar: T_NS_SEPARATOR namespace_name  */
+#line 1012 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName))); }
+#line 6048 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 317:
-
-/* Line 1806 of yacc.c  */
-#line 1011 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].expression)); }
+  case 319: /* scalar: '"' encaps_list '"'  */
+#line 1014 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].expression)); }
+#line 6054 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 318:
-
-/* Line 1806 of yacc.c  */
-#line 1012 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (3)].semanticValue)); }
+  case 320: /* scalar: T_START_HEREDOC encaps_list T_END_HEREDOC  */
+#line 1015 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-2].semanticValue)); }
+#line 6060 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 319:
-
-/* Line 1806 of yacc.c  */
-#line 1016 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 321: /* static_array_pair_list: %empty  */
+#line 1019 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6066 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 321:
-
-/* Line 1806 of yacc.c  */
-#line 1021 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.isComma) = false; }
+  case 323: /* possible_comma: %empty  */
+#line 1024 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.isComma) = false; }
+#line 6072 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 322:
-
-/* Line 1806 of yacc.c  */
-#line 1022 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.isComma) = true; }
+  case 324: /* possible_comma: ','  */
+#line 1025 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.isComma) = true; }
+#line 6078 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 323:
-
-/* Line 1806 of yacc.c  */
-#line 1026 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 325: /* non_empty_static_array_pair_list: non_empty_static_array_pair_list ',' static_scalar T_DOUBLE_ARROW static_scalar  */
+#line 1029 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6084 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 324:
-
-/* Line 1806 of yacc.c  */
-#line 1027 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 326: /* non_empty_static_array_pair_list: non_empty_static_array_pair_list ',' static_scalar  */
+#line 1030 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6090 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 325:
-
-/* Line 1806 of yacc.c  */
-#line 1028 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 327: /* non_empty_static_array_pair_list: static_scalar T_DOUBLE_ARROW static_scalar  */
+#line 1031 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6096 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 326:
-
-/* Line 1806 of yacc.c  */
-#line 1029 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 328: /* non_empty_static_array_pair_list: static_scalar  */
+#line 1032 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6102 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 327:
-
-/* Line 1806 of yacc.c  */
-#line 1033 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].variable); }
+  case 329: /* expr: r_variable  */
+#line 1036 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.expression) = (yyvsp[0].variable); }
+#line 6108 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 332:
-
-/* Line 1806 of yacc.c  */
-#line 1053 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMake((yyvsp[(1) - (5)].variable), (yyvsp[(3) - (5)].variable), (yyvsp[(4) - (5)].variable), (yyvsp[(5) - (5)].variable)); }
+  case 334: /* variable: base_variable_with_function_calls T_OBJECT_OPERATOR object_property method_or_not variable_properties  */
+#line 1056 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.variable) = observers.VariableMake((yyvsp[-4].variable), (yyvsp[-2].variable), (yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 6114 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 333:
-
-/* Line 1806 of yacc.c  */
-#line 1054 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMake((yyvsp[(1) - (1)].variable), NULL, NULL, NULL); }
+  case 335: /* variable: base_variable_with_function_calls  */
+#line 1057 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = observers.VariableMake((yyvsp[0].variable), NULL, NULL, NULL); }
+#line 6120 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 334:
-
-/* Line 1806 of yacc.c  */
-#line 1058 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(1) - (2)].variable), (yyvsp[(2) - (2)].variable)); }
+  case 336: /* variable_properties: variable_properties variable_property  */
+#line 1061 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 6126 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 335:
-
-/* Line 1806 of yacc.c  */
-#line 1059 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 337: /* variable_properties: %empty  */
+#line 1062 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6132 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 336:
-
-/* Line 1806 of yacc.c  */
-#line 1064 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(2) - (3)].variable), (yyvsp[(3) - (3)].variable), (yyvsp[(1) - (3)].semanticValue));  }
+  case 338: /* variable_property: T_OBJECT_OPERATOR object_property method_or_not  */
+#line 1067 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable), (yyvsp[-2].semanticValue));  }
+#line 6138 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 337:
-
-/* Line 1806 of yacc.c  */
-#line 1068 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeAndAppendFunctionCall((yyvsp[(2) - (3)].statementList), true); }
+  case 339: /* method_or_not: '(' function_call_parameter_list ')'  */
+#line 1071 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableMakeAndAppendFunctionCall((yyvsp[-1].statementList), true); }
+#line 6144 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 338:
-
-/* Line 1806 of yacc.c  */
-#line 1069 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 340: /* method_or_not: %empty  */
+#line 1072 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6150 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 340:
-
-/* Line 1806 of yacc.c  */
-#line 1074 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[(2) - (2)].variable)); }
+  case 342: /* variable_without_objects: simple_indirect_reference reference_variable  */
+#line 1077 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[0].variable)); }
+#line 6156 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 341:
-
-/* Line 1806 of yacc.c  */
-#line 1078 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableStartStaticMember((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].variable)); }
+  case 343: /* static_member: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1081 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.variable) = observers.VariableStartStaticMember((yyvsp[-2].qualifiedName), (yyvsp[0].variable)); }
+#line 6162 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 342:
-
-/* Line 1806 of yacc.c  */
-#line 1079 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 344: /* static_member: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1082 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6168 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 343:
-
-/* Line 1806 of yacc.c  */
-#line 1083 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 345: /* variable_class_name: reference_variable  */
+#line 1086 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6174 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 345:
-
-/* Line 1806 of yacc.c  */
-#line 1088 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 347: /* base_variable_with_function_calls: function_call  */
+#line 1091 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6180 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 347:
-
-/* Line 1806 of yacc.c  */
-#line 1093 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[(2) - (2)].variable)); }
+  case 349: /* base_variable: simple_indirect_reference reference_variable  */
+#line 1096 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[0].variable)); }
+#line 6186 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 349:
-
-/* Line 1806 of yacc.c  */
-#line 1098 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 351: /* reference_variable: reference_variable '[' dim_offset ']'  */
+#line 1101 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6192 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 350:
-
-/* Line 1806 of yacc.c  */
-#line 1099 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 352: /* reference_variable: reference_variable '{' expr '}'  */
+#line 1102 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6198 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 352:
-
-/* Line 1806 of yacc.c  */
-#line 1104 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableStart((yyvsp[(1) - (1)].semanticValue)); }
+  case 354: /* compound_variable: T_VARIABLE  */
+#line 1107 "/root/repo/src/Php53FullParser.y"
+                                                { (yyval.variable) = observers.VariableStart((yyvsp[0].semanticValue)); }
+#line 6204 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 353:
-
-/* Line 1806 of yacc.c  */
-#line 1105 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 355: /* compound_variable: '$' '{' expr '}'  */
+#line 1108 "/root/repo/src/Php53FullParser.y"
+                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6210 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 354:
-
-/* Line 1806 of yacc.c  */
-#line 1109 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 356: /* dim_offset: %empty  */
+#line 1112 "/root/repo/src/Php53FullParser.y"
+                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6216 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 355:
-
-/* Line 1806 of yacc.c  */
-#line 1110 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 357: /* dim_offset: expr  */
+#line 1113 "/root/repo/src/Php53FullParser.y"
+                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 6222 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 356:
-
-/* Line 1806 of yacc.c  */
-#line 1114 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 358: /* object_property: object_dim_list  */
+#line 1117 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6228 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 357:
-
-/* Line 1806 of yacc.c  */
-#line 1115 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 359: /* object_property: variable_without_objects  */
+#line 1118 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 6234 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 358:
-
-/* Line 1806 of yacc.c  */
-#line 1119 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 360: /* object_dim_list: object_dim_list '[' dim_offset ']'  */
+#line 1122 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6240 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 359:
-
-/* Line 1806 of yacc.c  */
-#line 1120 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 361: /* object_dim_list: object_dim_list '{' expr '}'  */
+#line 1123 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6246 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 360:
-
-/* Line 1806 of yacc.c  */
-#line 1121 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 362: /* object_dim_list: variable_name  */
+#line 1124 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 6252 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 361:
-
-/* Line 1806 of yacc.c  */
-#line 1125 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    {  (yyval.variable) = observers.VariableStart((yyvsp[(1) - (1)].semanticValue)); }
+  case 363: /* variable_name: T_STRING  */
+#line 1128 "/root/repo/src/Php53FullParser.y"
+                                                                {  (yyval.variable) = observers.VariableStart((yyvsp[0].semanticValue)); }
+#line 6258 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 362:
-
-/* Line 1806 of yacc.c  */
-#line 1126 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 364: /* variable_name: '{' expr '}'  */
+#line 1129 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6264 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 365:
-
-/* Line 1806 of yacc.c  */
-#line 1135 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].statementList)); }
+  case 367: /* assignment_list: assignment_list ',' assignment_list_element  */
+#line 1138 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), (yyvsp[0].statementList)); }
+#line 6270 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 366:
-
-/* Line 1806 of yacc.c  */
-#line 1136 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 368: /* assignment_list: assignment_list_element  */
+#line 1139 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 6276 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 367:
-
-/* Line 1806 of yacc.c  */
-#line 1140 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].variable)); }
+  case 369: /* assignment_list_element: variable  */
+#line 1143 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 6282 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 368:
-
-/* Line 1806 of yacc.c  */
-#line 1141 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
+  case 370: /* assignment_list_element: T_LIST '(' assignment_list ')'  */
+#line 1144 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6288 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 369:
-
-/* Line 1806 of yacc.c  */
-#line 1142 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 371: /* assignment_list_element: %empty  */
+#line 1145 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 6294 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 370:
-
-/* Line 1806 of yacc.c  */
-#line 1146 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 372: /* array_pair_list: %empty  */
+#line 1149 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 6300 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 371:
-
-/* Line 1806 of yacc.c  */
-#line 1147 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 373: /* array_pair_list: non_empty_array_pair_list possible_comma  */
+#line 1150 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6306 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 372:
-
-/* Line 1806 of yacc.c  */
-#line 1151 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair((yyvsp[(3) - (5)].expression), (yyvsp[(5) - (5)].expression))
+  case 374: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW expr  */
+#line 1154 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair((yyvsp[-2].expression), (yyvsp[0].expression))
                                                                                        ); 
                                                                                 }
+#line 6315 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 373:
-
-/* Line 1806 of yacc.c  */
-#line 1155 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[(3) - (3)].expression))
+  case 375: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr  */
+#line 1158 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].expression))
                                                                                        ); 
                                                                                 }
+#line 6324 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 374:
-
-/* Line 1806 of yacc.c  */
-#line 1159 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 376: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW expr  */
+#line 1162 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 6330 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 375:
-
-/* Line 1806 of yacc.c  */
-#line 1160 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[(1) - (1)].expression)); }
+  case 377: /* non_empty_array_pair_list: expr  */
+#line 1163 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].expression)); }
+#line 6336 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 376:
-
-/* Line 1806 of yacc.c  */
-#line 1161 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (6)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair((yyvsp[(3) - (6)].expression), (yyvsp[(6) - (6)].variable))
+  case 378: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1164 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-5].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair((yyvsp[-3].expression), (yyvsp[0].variable))
                                                                                        ); 
                                                                                 }
+#line 6345 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 377:
-
-/* Line 1806 of yacc.c  */
-#line 1165 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (4)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[(4) - (4)].variable))
+  case 379: /* non_empty_array_pair_list: non_empty_array_pair_list ',' '&' w_variable  */
+#line 1168 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-3].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].variable))
                                                                                        ); 
                                                                                 }
+#line 6354 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 378:
-
-/* Line 1806 of yacc.c  */
-#line 1169 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[(1) - (4)].expression), (yyvsp[(4) - (4)].variable)); }
+  case 380: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1172 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[-3].expression), (yyvsp[0].variable)); }
+#line 6360 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 379:
-
-/* Line 1806 of yacc.c  */
-#line 1170 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[(2) - (2)].variable)); }
+  case 381: /* non_empty_array_pair_list: '&' w_variable  */
+#line 1173 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].variable)); }
+#line 6366 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 380:
-
-/* Line 1806 of yacc.c  */
-#line 1174 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (2)].expression); }
+  case 382: /* encaps_list: encaps_list encaps_var  */
+#line 1177 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6372 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 381:
-
-/* Line 1806 of yacc.c  */
-#line 1175 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (2)].expression); }
+  case 383: /* encaps_list: encaps_list T_ENCAPSED_AND_WHITESPACE  */
+#line 1178 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6378 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 382:
-
-/* Line 1806 of yacc.c  */
-#line 1176 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 384: /* encaps_list: encaps_var  */
+#line 1179 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6384 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 383:
-
-/* Line 1806 of yacc.c  */
-#line 1177 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
+  case 385: /* encaps_list: T_ENCAPSED_AND_WHITESPACE encaps_var  */
+#line 1180 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6390 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 384:
-
-/* Line 1806 of yacc.c  */
-#line 1181 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 386: /* encaps_var: T_VARIABLE  */
+#line 1184 "/root/repo/src/Php53FullParser.y"
+                                                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6396 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 385:
-
-/* Line 1806 of yacc.c  */
-#line 1182 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 387: /* encaps_var: T_VARIABLE '[' encaps_var_offset ']'  */
+#line 1185 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6402 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 386:
-
-/* Line 1806 of yacc.c  */
-#line 1183 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 388: /* encaps_var: T_VARIABLE T_OBJECT_OPERATOR T_STRING  */
+#line 1186 "/root/repo/src/Php53FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6408 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 387:
-
-/* Line 1806 of yacc.c  */
-#line 1184 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 389: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES expr '}'  */
+#line 1187 "/root/repo/src/Php53FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6414 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 388:
-
-/* Line 1806 of yacc.c  */
-#line 1185 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 390: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES T_STRING_VARNAME '[' expr ']' '}'  */
+#line 1188 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6420 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 389:
-
-/* Line 1806 of yacc.c  */
-#line 1186 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 391: /* encaps_var: T_CURLY_OPEN variable '}'  */
+#line 1189 "/root/repo/src/Php53FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6426 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 390:
-
-/* Line 1806 of yacc.c  */
-#line 1190 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 392: /* encaps_var_offset: T_STRING  */
+#line 1193 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6432 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 391:
-
-/* Line 1806 of yacc.c  */
-#line 1191 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 393: /* encaps_var_offset: T_NUM_STRING  */
+#line 1194 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6438 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 392:
-
-/* Line 1806 of yacc.c  */
-#line 1192 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 394: /* encaps_var_offset: T_VARIABLE  */
+#line 1195 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6444 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 393:
-
-/* Line 1806 of yacc.c  */
-#line 1196 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = (yyvsp[(3) - (4)].expression); }
+  case 395: /* internal_functions_in_yacc: T_ISSET '(' isset_variables ')'  */
+#line 1199 "/root/repo/src/Php53FullParser.y"
+                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6450 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 394:
-
-/* Line 1806 of yacc.c  */
-#line 1197 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 396: /* internal_functions_in_yacc: T_EMPTY '(' variable ')'  */
+#line 1200 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6456 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 395:
-
-/* Line 1806 of yacc.c  */
-#line 1198 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 397: /* internal_functions_in_yacc: T_INCLUDE expr  */
+#line 1201 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6462 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 396:
-
-/* Line 1806 of yacc.c  */
-#line 1199 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 398: /* internal_functions_in_yacc: T_INCLUDE_ONCE expr  */
+#line 1202 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6468 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 397:
-
-/* Line 1806 of yacc.c  */
-#line 1200 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionEval((yyvsp[(3) - (4)].expression)); }
+  case 399: /* internal_functions_in_yacc: T_EVAL '(' expr ')'  */
+#line 1203 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionEval((yyvsp[-1].expression)); }
+#line 6474 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 398:
-
-/* Line 1806 of yacc.c  */
-#line 1201 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 400: /* internal_functions_in_yacc: T_REQUIRE expr  */
+#line 1204 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6480 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 399:
-
-/* Line 1806 of yacc.c  */
-#line 1202 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 401: /* internal_functions_in_yacc: T_REQUIRE_ONCE expr  */
+#line 1205 "/root/repo/src/Php53FullParser.y"
+                                                                        { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6486 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 400:
-
-/* Line 1806 of yacc.c  */
-#line 1206 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionIsset((yyvsp[(1) - (1)].variable)); }
+  case 402: /* isset_variables: variable  */
+#line 1209 "/root/repo/src/Php53FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionIsset((yyvsp[0].variable)); }
+#line 6492 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 401:
-
-/* Line 1806 of yacc.c  */
-#line 1207 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionIssetMerge((pelet::IssetExpressionClass*)(yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].variable)); }
+  case 403: /* isset_variables: isset_variables ',' variable  */
+#line 1210 "/root/repo/src/Php53FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionIssetMerge((pelet::IssetExpressionClass*)(yyvsp[-2].expression), (yyvsp[0].variable)); }
+#line 6498 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 402:
-
-/* Line 1806 of yacc.c  */
-#line 1211 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 404: /* class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1214 "/root/repo/src/Php53FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 6504 "/root/repo/src/Php53FullParser.cpp"
     break;
 
-  case 403:
-
-/* Line 1806 of yacc.c  */
-#line 1212 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 405: /* class_constant: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1215 "/root/repo/src/Php53FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6510 "/root/repo/src/Php53FullParser.cpp"
     break;
 
 
+#line 6514 "/root/repo/src/Php53FullParser.cpp"
 
-/* Line 1806 of yacc.c  */
-#line 6354 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6364,96 +6525,88 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == PHP53EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (analyzer, observers, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyps, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (analyzer, observers, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= PHP53EOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == PHP53EOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, analyzer, observers);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, analyzer, observers);
+          yychar = PHP53EMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -6465,14 +6618,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -6485,39 +6637,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6528,27 +6683,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (analyzer, observers, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEMPTY)
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != PHP53EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -6556,31 +6715,37 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, analyzer, observers);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  return yyresult;
 }
-
-
-
-/* Line 2067 of yacc.c  */
-#line 1215 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53FullParser.y"
-
+#undef php53nerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 1218 "/root/repo/src/Php53FullParser.y"
 
@@ -31,7 +31,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ParserType
+#define PHP53STYPE pelet::ParserType
 
 // all PHP parsers will use same lex function
 #define php53lex pelet::FullLex
@@ -50,9 +50,10 @@
  * This parser was ripped from the PHP source (version 5.3.6). All credit goes to them.
  */
 %define api.pure
-%error-verbose
+%define api.push-pull both
+%define parse.error verbose
 %expect 2
-%name-prefix "php53"
+%define api.prefix {php53}
 %debug
 
 %left T_INCLUDE T_INCLUDE_ONCE T_EVAL T_REQUIRE T_REQUIRE_ONCE
@@ -349,7 +350,7 @@
 
 %%
 start:
-	top_statement_list							{ observers.MakeAst($1); }
+	top_statement_list							{ if (analyzer.WasCancelled()) { YYABORT; } observers.MakeAst($1); }
 ;
 
 top_statement_list:
@@ -409,6 +410,7 @@ inner_statement:
 statement:
 		unticked_statement				{ $$ = $1; }
 	|	T_STRING ':'					{ $$ = observers.StatementListMake(); }
+	|	error ';'					{ $$ = observers.StatementListMake(); yyerrok; }
 ;
 
 unticked_statement:
@@ -738,6 +740,7 @@ class_statement:
 		method_body											{ $$ = observers.ClassMemberSymbolMakeMethod($4, $1, $3, $2, $6, $9); 
 															  observers.SetCurrentMemberName(NULL);
 															}
+	|	error ';'											{ $$ = observers.StatementListNil(); yyerrok; }
 ;
 
 method_body:
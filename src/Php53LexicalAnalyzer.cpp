@@ -26,8 +26,10 @@
  
 #include <pelet/Php53LexicalAnalyzer.h>
 
-// tell re2c we will use Unicode chars
-#define YYCTYPE UChar
+// tell re2c we will use Unicode chars; or bytes for the UTF-8 lexer. The
+// rules only look at characters 0x00-0xFF so the same state machine handles both
+// (multi-byte UTF-8 sequences are matched by the \x7f-\xff identifier ranges)
+#define YYCTYPE CharType
 
 // this is the pointer to the current position; 
 #define YYCURSOR buffer->Current
@@ -47,7 +49,10 @@
 // condition is actually a variable (reference) that is passed into the nextToken() function
 #define YYSETCONDITION(c)  condition = c
 
-int pelet::Next53Token(BufferClass* buffer, YYCONDTYPE &condition) {
+namespace pelet {
+
+template<typename BufferType, typename CharType>
+static int Next53TokenImpl(BufferType* buffer, YYCONDTYPE &condition) {
 	if (buffer->HasReachedEnd()) {
 		return T_END;
 	}
@@ -9437,4 +9442,14 @@ php_53_lexical_analyzer_824:
 	}
 
 
+}
+
+}
+
+int pelet::Next53Token(BufferClass* buffer, YYCONDTYPE &condition) {
+	return Next53TokenImpl<BufferClass, UChar>(buffer, condition);
+}
+
+int pelet::Next53Token(Utf8BufferClass* buffer, YYCONDTYPE &condition) {
+	return Next53TokenImpl<Utf8BufferClass, unsigned char>(buffer, condition);
 }
\ No newline at end of file
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -58,23 +63,17 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
+/* Substitute the type names.  */
+#define YYSTYPE         PHP53_LINT_STYPE
 /* Substitute the variable and function names.  */
 #define yyparse         php53_lint_parse
 #define yylex           php53_lint_lex
 #define yyerror         php53_lint_error
-#define yylval          php53_lint_lval
-#define yychar          php53_lint_char
 #define yydebug         php53_lint_debug
 #define yynerrs         php53_lint_nerrs
 
-
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
-#line 1 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53LintParser.y"
+/* First part of user prologue.  */
+#line 1 "/root/repo/src/Php53LintParser.y"
 
 /**
  * This software is released under the terms of the MIT License
@@ -108,7 +107,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE int
+#define PHP53_LINT_STYPE int
 
 // so that both bison parses call the same lex function
 #define php53_lint_lex pelet::LintLex
@@ -117,210 +116,561 @@
 #define php53_lint_error pelet::LintGrammarError
 
 
+#line 120 "/root/repo/src/Php53LintParser.cpp"
 
-/* Line 268 of yacc.c  */
-#line 123 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53LintParser.cpp"
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
+/* Debug traces.  */
+#ifndef PHP53_LINT_DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define PHP53_LINT_DEBUG 1
+#  else
+#   define PHP53_LINT_DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define PHP53_LINT_DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined PHP53_LINT_DEBUG */
+#if PHP53_LINT_DEBUG
+extern int php53_lint_debug;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
+/* Token kinds.  */
+#ifndef PHP53_LINT_TOKENTYPE
+# define PHP53_LINT_TOKENTYPE
+  enum php53_lint_tokentype
+  {
+    PHP53_LINT_EMPTY = -2,
+    T_END = 0,                     /* T_END  */
+    PHP53_LINT_error = 256,        /* error  */
+    PHP53_LINT_UNDEF = 629,        /* "invalid token"  */
+    T_ABSTRACT = 502,              /* T_ABSTRACT  */
+    T_AND_EQUAL = 503,             /* T_AND_EQUAL  */
+    T_ARRAY = 504,                 /* T_ARRAY  */
+    T_ARRAY_CAST = 505,            /* T_ARRAY_CAST  */
+    T_AS = 506,                    /* T_AS  */
+    T_BAD_CHARACTER = 507,         /* T_BAD_CHARACTER  */
+    T_BOOL_CAST = 508,             /* T_BOOL_CAST  */
+    T_BOOLEAN_AND = 509,           /* T_BOOLEAN_AND  */
+    T_BOOLEAN_OR = 510,            /* T_BOOLEAN_OR  */
+    T_BREAK = 511,                 /* T_BREAK  */
+    T_CALLABLE = 512,              /* T_CALLABLE  */
+    T_CASE = 513,                  /* T_CASE  */
+    T_CATCH = 514,                 /* T_CATCH  */
+    T_CHARACTER = 515,             /* T_CHARACTER  */
+    T_CLASS = 516,                 /* T_CLASS  */
+    T_CLASS_C = 517,               /* T_CLASS_C  */
+    T_CLONE = 518,                 /* T_CLONE  */
+    T_CLOSE_TAG = 519,             /* T_CLOSE_TAG  */
+    T_COMMENT = 520,               /* T_COMMENT  */
+    T_CONCAT_EQUAL = 521,          /* T_CONCAT_EQUAL  */
+    T_CONST = 522,                 /* T_CONST  */
+    T_CONSTANT_ENCAPSED_STRING = 523, /* T_CONSTANT_ENCAPSED_STRING  */
+    T_CONTINUE = 524,              /* T_CONTINUE  */
+    T_CURLY_OPEN = 525,            /* T_CURLY_OPEN  */
+    T_DEC = 526,                   /* T_DEC  */
+    T_DECLARE = 527,               /* T_DECLARE  */
+    T_DEFAULT = 528,               /* T_DEFAULT  */
+    T_DIR = 529,                   /* T_DIR  */
+    T_DIV_EQUAL = 530,             /* T_DIV_EQUAL  */
+    T_DNUMBER = 531,               /* T_DNUMBER  */
+    T_DO = 532,                    /* T_DO  */
+    T_DOC_COMMENT = 533,           /* T_DOC_COMMENT  */
+    T_DOLLAR_OPEN_CURLY_BRACES = 534, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+    T_DOUBLE_ARROW = 535,          /* T_DOUBLE_ARROW  */
+    T_DOUBLE_CAST = 536,           /* T_DOUBLE_CAST  */
+    T_ECHO = 537,                  /* T_ECHO  */
+    T_ELSE = 538,                  /* T_ELSE  */
+    T_ELSEIF = 539,                /* T_ELSEIF  */
+    T_EMPTY = 540,                 /* T_EMPTY  */
+    T_ENCAPSED_AND_WHITESPACE = 541, /* T_ENCAPSED_AND_WHITESPACE  */
+    T_ENDDECLARE = 542,            /* T_ENDDECLARE  */
+    T_ENDFOR = 543,                /* T_ENDFOR  */
+    T_ENDFOREACH = 544,            /* T_ENDFOREACH  */
+    T_END_HEREDOC = 545,           /* T_END_HEREDOC  */
+    T_ENDIF = 546,                 /* T_ENDIF  */
+    T_ENDSWITCH = 547,             /* T_ENDSWITCH  */
+    T_ENDWHILE = 548,              /* T_ENDWHILE  */
+    T_EVAL = 549,                  /* T_EVAL  */
+    T_EXIT = 550,                  /* T_EXIT  */
+    T_EXTENDS = 551,               /* T_EXTENDS  */
+    T_FILE = 552,                  /* T_FILE  */
+    T_FINAL = 553,                 /* T_FINAL  */
+    T_FOR = 554,                   /* T_FOR  */
+    T_FOREACH = 555,               /* T_FOREACH  */
+    T_FUNC_C = 556,                /* T_FUNC_C  */
+    T_FUNCTION = 557,              /* T_FUNCTION  */
+    T_GLOBAL = 558,                /* T_GLOBAL  */
+    T_GOTO = 559,                  /* T_GOTO  */
+    T_HALT_COMPILER = 560,         /* T_HALT_COMPILER  */
+    T_IF = 561,                    /* T_IF  */
+    T_IMPLEMENTS = 562,            /* T_IMPLEMENTS  */
+    T_INC = 563,                   /* T_INC  */
+    T_INCLUDE = 564,               /* T_INCLUDE  */
+    T_INCLUDE_ONCE = 565,          /* T_INCLUDE_ONCE  */
+    T_INLINE_HTML = 566,           /* T_INLINE_HTML  */
+    T_INSTANCEOF = 567,            /* T_INSTANCEOF  */
+    T_INSTEADOF = 568,             /* T_INSTEADOF  */
+    T_INT_CAST = 569,              /* T_INT_CAST  */
+    T_INTERFACE = 570,             /* T_INTERFACE  */
+    T_IS_EQUAL = 571,              /* T_IS_EQUAL  */
+    T_IS_GREATER_OR_EQUAL = 572,   /* T_IS_GREATER_OR_EQUAL  */
+    T_IS_IDENTICAL = 573,          /* T_IS_IDENTICAL  */
+    T_IS_NOT_EQUAL = 574,          /* T_IS_NOT_EQUAL  */
+    T_IS_NOT_IDENTICAL = 575,      /* T_IS_NOT_IDENTICAL  */
+    T_ISSET = 576,                 /* T_ISSET  */
+    T_IS_SMALLER_OR_EQUAL = 577,   /* T_IS_SMALLER_OR_EQUAL  */
+    T_LINE = 578,                  /* T_LINE  */
+    T_LIST = 579,                  /* T_LIST  */
+    T_LNUMBER = 580,               /* T_LNUMBER  */
+    T_LOGICAL_AND = 581,           /* T_LOGICAL_AND  */
+    T_LOGICAL_OR = 582,            /* T_LOGICAL_OR  */
+    T_LOGICAL_XOR = 583,           /* T_LOGICAL_XOR  */
+    T_METHOD_C = 584,              /* T_METHOD_C  */
+    T_MINUS_EQUAL = 585,           /* T_MINUS_EQUAL  */
+    T_MOD_EQUAL = 586,             /* T_MOD_EQUAL  */
+    T_MUL_EQUAL = 587,             /* T_MUL_EQUAL  */
+    T_NAMESPACE = 588,             /* T_NAMESPACE  */
+    T_NEW = 589,                   /* T_NEW  */
+    T_NS_C = 590,                  /* T_NS_C  */
+    T_NS_SEPARATOR = 591,          /* T_NS_SEPARATOR  */
+    T_NUM_STRING = 592,            /* T_NUM_STRING  */
+    T_OBJECT_CAST = 593,           /* T_OBJECT_CAST  */
+    T_OBJECT_OPERATOR = 594,       /* T_OBJECT_OPERATOR  */
+    T_OPEN_TAG = 595,              /* T_OPEN_TAG  */
+    T_OPEN_TAG_WITH_ECHO = 596,    /* T_OPEN_TAG_WITH_ECHO  */
+    T_OR_EQUAL = 597,              /* T_OR_EQUAL  */
+    T_PAAMAYIM_NEKUDOTAYIM = 598,  /* T_PAAMAYIM_NEKUDOTAYIM  */
+    T_PLUS_EQUAL = 599,            /* T_PLUS_EQUAL  */
+    T_PRINT = 600,                 /* T_PRINT  */
+    T_PRIVATE = 601,               /* T_PRIVATE  */
+    T_PROTECTED = 602,             /* T_PROTECTED  */
+    T_PUBLIC = 603,                /* T_PUBLIC  */
+    T_REQUIRE = 604,               /* T_REQUIRE  */
+    T_REQUIRE_ONCE = 605,          /* T_REQUIRE_ONCE  */
+    T_RETURN = 606,                /* T_RETURN  */
+    T_SL = 607,                    /* T_SL  */
+    T_SL_EQUAL = 608,              /* T_SL_EQUAL  */
+    T_SR = 609,                    /* T_SR  */
+    T_SR_EQUAL = 610,              /* T_SR_EQUAL  */
+    T_START_HEREDOC = 611,         /* T_START_HEREDOC  */
+    T_STATIC = 612,                /* T_STATIC  */
+    T_STRING = 613,                /* T_STRING  */
+    T_STRING_CAST = 614,           /* T_STRING_CAST  */
+    T_STRING_VARNAME = 615,        /* T_STRING_VARNAME  */
+    T_SWITCH = 616,                /* T_SWITCH  */
+    T_THROW = 617,                 /* T_THROW  */
+    T_TRAIT = 618,                 /* T_TRAIT  */
+    T_TRAIT_C = 619,               /* T_TRAIT_C  */
+    T_TRY = 620,                   /* T_TRY  */
+    T_UNSET = 621,                 /* T_UNSET  */
+    T_UNSET_CAST = 622,            /* T_UNSET_CAST  */
+    T_USE = 623,                   /* T_USE  */
+    T_VAR = 624,                   /* T_VAR  */
+    T_VARIABLE = 625,              /* T_VARIABLE  */
+    T_WHILE = 626,                 /* T_WHILE  */
+    T_WHITESPACE = 627,            /* T_WHITESPACE  */
+    T_XOR_EQUAL = 628              /* T_XOR_EQUAL  */
+  };
+  typedef enum php53_lint_tokentype php53_lint_token_kind_t;
 #endif
 
+/* Value type.  */
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_END = 0,
-     T_REQUIRE_ONCE = 605,
-     T_REQUIRE = 604,
-     T_EVAL = 549,
-     T_INCLUDE_ONCE = 565,
-     T_INCLUDE = 564,
-     T_LOGICAL_OR = 582,
-     T_LOGICAL_XOR = 583,
-     T_LOGICAL_AND = 581,
-     T_PRINT = 600,
-     T_SR_EQUAL = 610,
-     T_SL_EQUAL = 608,
-     T_XOR_EQUAL = 628,
-     T_OR_EQUAL = 597,
-     T_AND_EQUAL = 503,
-     T_MOD_EQUAL = 586,
-     T_CONCAT_EQUAL = 521,
-     T_DIV_EQUAL = 530,
-     T_MUL_EQUAL = 587,
-     T_MINUS_EQUAL = 585,
-     T_PLUS_EQUAL = 599,
-     T_BOOLEAN_OR = 510,
-     T_BOOLEAN_AND = 509,
-     T_IS_NOT_IDENTICAL = 575,
-     T_IS_IDENTICAL = 573,
-     T_IS_NOT_EQUAL = 574,
-     T_IS_EQUAL = 571,
-     T_IS_GREATER_OR_EQUAL = 572,
-     T_IS_SMALLER_OR_EQUAL = 577,
-     T_SR = 609,
-     T_SL = 607,
-     T_INSTANCEOF = 567,
-     T_UNSET_CAST = 622,
-     T_BOOL_CAST = 508,
-     T_OBJECT_CAST = 593,
-     T_ARRAY_CAST = 505,
-     T_STRING_CAST = 614,
-     T_DOUBLE_CAST = 536,
-     T_INT_CAST = 569,
-     T_DEC = 526,
-     T_INC = 563,
-     T_CLONE = 518,
-     T_NEW = 589,
-     T_ELSEIF = 539,
-     T_ELSE = 538,
-     T_ENDIF = 546,
-     T_PUBLIC = 603,
-     T_PROTECTED = 602,
-     T_PRIVATE = 601,
-     T_FINAL = 553,
-     T_ABSTRACT = 502,
-     T_STATIC = 612,
-     T_ARRAY = 504,
-     T_AS = 506,
-     T_BAD_CHARACTER = 507,
-     T_BREAK = 511,
-     T_CALLABLE = 512,
-     T_CASE = 513,
-     T_CATCH = 514,
-     T_CHARACTER = 515,
-     T_CLASS = 516,
-     T_CLASS_C = 517,
-     T_CLOSE_TAG = 519,
-     T_COMMENT = 520,
-     T_CONST = 522,
-     T_CONSTANT_ENCAPSED_STRING = 523,
-     T_CONTINUE = 524,
-     T_CURLY_OPEN = 525,
-     T_DECLARE = 527,
-     T_DEFAULT = 528,
-     T_DIR = 529,
-     T_DNUMBER = 531,
-     T_DO = 532,
-     T_DOC_COMMENT = 533,
-     T_DOLLAR_OPEN_CURLY_BRACES = 534,
-     T_DOUBLE_ARROW = 535,
-     T_ECHO = 537,
-     T_EMPTY = 540,
-     T_ENCAPSED_AND_WHITESPACE = 541,
-     T_ENDDECLARE = 542,
-     T_ENDFOR = 543,
-     T_ENDFOREACH = 544,
-     T_END_HEREDOC = 545,
-     T_ENDSWITCH = 547,
-     T_ENDWHILE = 548,
-     T_EXIT = 550,
-     T_EXTENDS = 551,
-     T_FILE = 552,
-     T_FOR = 554,
-     T_FOREACH = 555,
-     T_FUNC_C = 556,
-     T_FUNCTION = 557,
-     T_GLOBAL = 558,
-     T_GOTO = 559,
-     T_HALT_COMPILER = 560,
-     T_IF = 561,
-     T_IMPLEMENTS = 562,
-     T_INLINE_HTML = 566,
-     T_INSTEADOF = 568,
-     T_INTERFACE = 570,
-     T_ISSET = 576,
-     T_LINE = 578,
-     T_LIST = 579,
-     T_LNUMBER = 580,
-     T_METHOD_C = 584,
-     T_NAMESPACE = 588,
-     T_NS_C = 590,
-     T_NS_SEPARATOR = 591,
-     T_NUM_STRING = 592,
-     T_OBJECT_OPERATOR = 594,
-     T_OPEN_TAG = 595,
-     T_OPEN_TAG_WITH_ECHO = 596,
-     T_PAAMAYIM_NEKUDOTAYIM = 598,
-     T_RETURN = 606,
-     T_START_HEREDOC = 611,
-     T_STRING = 613,
-     T_STRING_VARNAME = 615,
-     T_SWITCH = 616,
-     T_THROW = 617,
-     T_TRAIT = 618,
-     T_TRAIT_C = 619,
-     T_TRY = 620,
-     T_UNSET = 621,
-     T_USE = 623,
-     T_VAR = 624,
-     T_VARIABLE = 625,
-     T_WHILE = 626,
-     T_WHITESPACE = 627
-   };
-#endif
 
 
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+int php53_lint_parse (pelet::LexicalAnalyzerClass &analyzer);
+
 
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* T_END  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ','  */
+  YYSYMBOL_4_ = 4,                         /* '='  */
+  YYSYMBOL_5_ = 5,                         /* '?'  */
+  YYSYMBOL_6_ = 6,                         /* ':'  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_12_ = 12,                       /* '+'  */
+  YYSYMBOL_13_ = 13,                       /* '-'  */
+  YYSYMBOL_14_ = 14,                       /* '.'  */
+  YYSYMBOL_15_ = 15,                       /* '*'  */
+  YYSYMBOL_16_ = 16,                       /* '/'  */
+  YYSYMBOL_17_ = 17,                       /* '%'  */
+  YYSYMBOL_18_ = 18,                       /* '!'  */
+  YYSYMBOL_19_ = 19,                       /* '~'  */
+  YYSYMBOL_20_ = 20,                       /* '@'  */
+  YYSYMBOL_21_ = 21,                       /* '['  */
+  YYSYMBOL_T_ABSTRACT = 22,                /* T_ABSTRACT  */
+  YYSYMBOL_T_AND_EQUAL = 23,               /* T_AND_EQUAL  */
+  YYSYMBOL_T_ARRAY = 24,                   /* T_ARRAY  */
+  YYSYMBOL_T_ARRAY_CAST = 25,              /* T_ARRAY_CAST  */
+  YYSYMBOL_T_AS = 26,                      /* T_AS  */
+  YYSYMBOL_T_BAD_CHARACTER = 27,           /* T_BAD_CHARACTER  */
+  YYSYMBOL_T_BOOL_CAST = 28,               /* T_BOOL_CAST  */
+  YYSYMBOL_T_BOOLEAN_AND = 29,             /* T_BOOLEAN_AND  */
+  YYSYMBOL_T_BOOLEAN_OR = 30,              /* T_BOOLEAN_OR  */
+  YYSYMBOL_T_BREAK = 31,                   /* T_BREAK  */
+  YYSYMBOL_T_CALLABLE = 32,                /* T_CALLABLE  */
+  YYSYMBOL_T_CASE = 33,                    /* T_CASE  */
+  YYSYMBOL_T_CATCH = 34,                   /* T_CATCH  */
+  YYSYMBOL_T_CHARACTER = 35,               /* T_CHARACTER  */
+  YYSYMBOL_T_CLASS = 36,                   /* T_CLASS  */
+  YYSYMBOL_T_CLASS_C = 37,                 /* T_CLASS_C  */
+  YYSYMBOL_T_CLONE = 38,                   /* T_CLONE  */
+  YYSYMBOL_T_CLOSE_TAG = 39,               /* T_CLOSE_TAG  */
+  YYSYMBOL_T_COMMENT = 40,                 /* T_COMMENT  */
+  YYSYMBOL_T_CONCAT_EQUAL = 41,            /* T_CONCAT_EQUAL  */
+  YYSYMBOL_T_CONST = 42,                   /* T_CONST  */
+  YYSYMBOL_T_CONSTANT_ENCAPSED_STRING = 43, /* T_CONSTANT_ENCAPSED_STRING  */
+  YYSYMBOL_T_CONTINUE = 44,                /* T_CONTINUE  */
+  YYSYMBOL_T_CURLY_OPEN = 45,              /* T_CURLY_OPEN  */
+  YYSYMBOL_T_DEC = 46,                     /* T_DEC  */
+  YYSYMBOL_T_DECLARE = 47,                 /* T_DECLARE  */
+  YYSYMBOL_T_DEFAULT = 48,                 /* T_DEFAULT  */
+  YYSYMBOL_T_DIR = 49,                     /* T_DIR  */
+  YYSYMBOL_T_DIV_EQUAL = 50,               /* T_DIV_EQUAL  */
+  YYSYMBOL_T_DNUMBER = 51,                 /* T_DNUMBER  */
+  YYSYMBOL_T_DO = 52,                      /* T_DO  */
+  YYSYMBOL_T_DOC_COMMENT = 53,             /* T_DOC_COMMENT  */
+  YYSYMBOL_T_DOLLAR_OPEN_CURLY_BRACES = 54, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+  YYSYMBOL_T_DOUBLE_ARROW = 55,            /* T_DOUBLE_ARROW  */
+  YYSYMBOL_T_DOUBLE_CAST = 56,             /* T_DOUBLE_CAST  */
+  YYSYMBOL_T_ECHO = 57,                    /* T_ECHO  */
+  YYSYMBOL_T_ELSE = 58,                    /* T_ELSE  */
+  YYSYMBOL_T_ELSEIF = 59,                  /* T_ELSEIF  */
+  YYSYMBOL_T_EMPTY = 60,                   /* T_EMPTY  */
+  YYSYMBOL_T_ENCAPSED_AND_WHITESPACE = 61, /* T_ENCAPSED_AND_WHITESPACE  */
+  YYSYMBOL_T_ENDDECLARE = 62,              /* T_ENDDECLARE  */
+  YYSYMBOL_T_ENDFOR = 63,                  /* T_ENDFOR  */
+  YYSYMBOL_T_ENDFOREACH = 64,              /* T_ENDFOREACH  */
+  YYSYMBOL_T_END_HEREDOC = 65,             /* T_END_HEREDOC  */
+  YYSYMBOL_T_ENDIF = 66,                   /* T_ENDIF  */
+  YYSYMBOL_T_ENDSWITCH = 67,               /* T_ENDSWITCH  */
+  YYSYMBOL_T_ENDWHILE = 68,                /* T_ENDWHILE  */
+  YYSYMBOL_T_EVAL = 69,                    /* T_EVAL  */
+  YYSYMBOL_T_EXIT = 70,                    /* T_EXIT  */
+  YYSYMBOL_T_EXTENDS = 71,                 /* T_EXTENDS  */
+  YYSYMBOL_T_FILE = 72,                    /* T_FILE  */
+  YYSYMBOL_T_FINAL = 73,                   /* T_FINAL  */
+  YYSYMBOL_T_FOR = 74,                     /* T_FOR  */
+  YYSYMBOL_T_FOREACH = 75,                 /* T_FOREACH  */
+  YYSYMBOL_T_FUNC_C = 76,                  /* T_FUNC_C  */
+  YYSYMBOL_T_FUNCTION = 77,                /* T_FUNCTION  */
+  YYSYMBOL_T_GLOBAL = 78,                  /* T_GLOBAL  */
+  YYSYMBOL_T_GOTO = 79,                    /* T_GOTO  */
+  YYSYMBOL_T_HALT_COMPILER = 80,           /* T_HALT_COMPILER  */
+  YYSYMBOL_T_IF = 81,                      /* T_IF  */
+  YYSYMBOL_T_IMPLEMENTS = 82,              /* T_IMPLEMENTS  */
+  YYSYMBOL_T_INC = 83,                     /* T_INC  */
+  YYSYMBOL_T_INCLUDE = 84,                 /* T_INCLUDE  */
+  YYSYMBOL_T_INCLUDE_ONCE = 85,            /* T_INCLUDE_ONCE  */
+  YYSYMBOL_T_INLINE_HTML = 86,             /* T_INLINE_HTML  */
+  YYSYMBOL_T_INSTANCEOF = 87,              /* T_INSTANCEOF  */
+  YYSYMBOL_T_INSTEADOF = 88,               /* T_INSTEADOF  */
+  YYSYMBOL_T_INT_CAST = 89,                /* T_INT_CAST  */
+  YYSYMBOL_T_INTERFACE = 90,               /* T_INTERFACE  */
+  YYSYMBOL_T_IS_EQUAL = 91,                /* T_IS_EQUAL  */
+  YYSYMBOL_T_IS_GREATER_OR_EQUAL = 92,     /* T_IS_GREATER_OR_EQUAL  */
+  YYSYMBOL_T_IS_IDENTICAL = 93,            /* T_IS_IDENTICAL  */
+  YYSYMBOL_T_IS_NOT_EQUAL = 94,            /* T_IS_NOT_EQUAL  */
+  YYSYMBOL_T_IS_NOT_IDENTICAL = 95,        /* T_IS_NOT_IDENTICAL  */
+  YYSYMBOL_T_ISSET = 96,                   /* T_ISSET  */
+  YYSYMBOL_T_IS_SMALLER_OR_EQUAL = 97,     /* T_IS_SMALLER_OR_EQUAL  */
+  YYSYMBOL_T_LINE = 98,                    /* T_LINE  */
+  YYSYMBOL_T_LIST = 99,                    /* T_LIST  */
+  YYSYMBOL_T_LNUMBER = 100,                /* T_LNUMBER  */
+  YYSYMBOL_T_LOGICAL_AND = 101,            /* T_LOGICAL_AND  */
+  YYSYMBOL_T_LOGICAL_OR = 102,             /* T_LOGICAL_OR  */
+  YYSYMBOL_T_LOGICAL_XOR = 103,            /* T_LOGICAL_XOR  */
+  YYSYMBOL_T_METHOD_C = 104,               /* T_METHOD_C  */
+  YYSYMBOL_T_MINUS_EQUAL = 105,            /* T_MINUS_EQUAL  */
+  YYSYMBOL_T_MOD_EQUAL = 106,              /* T_MOD_EQUAL  */
+  YYSYMBOL_T_MUL_EQUAL = 107,              /* T_MUL_EQUAL  */
+  YYSYMBOL_T_NAMESPACE = 108,              /* T_NAMESPACE  */
+  YYSYMBOL_T_NEW = 109,                    /* T_NEW  */
+  YYSYMBOL_T_NS_C = 110,                   /* T_NS_C  */
+  YYSYMBOL_T_NS_SEPARATOR = 111,           /* T_NS_SEPARATOR  */
+  YYSYMBOL_T_NUM_STRING = 112,             /* T_NUM_STRING  */
+  YYSYMBOL_T_OBJECT_CAST = 113,            /* T_OBJECT_CAST  */
+  YYSYMBOL_T_OBJECT_OPERATOR = 114,        /* T_OBJECT_OPERATOR  */
+  YYSYMBOL_T_OPEN_TAG = 115,               /* T_OPEN_TAG  */
+  YYSYMBOL_T_OPEN_TAG_WITH_ECHO = 116,     /* T_OPEN_TAG_WITH_ECHO  */
+  YYSYMBOL_T_OR_EQUAL = 117,               /* T_OR_EQUAL  */
+  YYSYMBOL_T_PAAMAYIM_NEKUDOTAYIM = 118,   /* T_PAAMAYIM_NEKUDOTAYIM  */
+  YYSYMBOL_T_PLUS_EQUAL = 119,             /* T_PLUS_EQUAL  */
+  YYSYMBOL_T_PRINT = 120,                  /* T_PRINT  */
+  YYSYMBOL_T_PRIVATE = 121,                /* T_PRIVATE  */
+  YYSYMBOL_T_PROTECTED = 122,              /* T_PROTECTED  */
+  YYSYMBOL_T_PUBLIC = 123,                 /* T_PUBLIC  */
+  YYSYMBOL_T_REQUIRE = 124,                /* T_REQUIRE  */
+  YYSYMBOL_T_REQUIRE_ONCE = 125,           /* T_REQUIRE_ONCE  */
+  YYSYMBOL_T_RETURN = 126,                 /* T_RETURN  */
+  YYSYMBOL_T_SL = 127,                     /* T_SL  */
+  YYSYMBOL_T_SL_EQUAL = 128,               /* T_SL_EQUAL  */
+  YYSYMBOL_T_SR = 129,                     /* T_SR  */
+  YYSYMBOL_T_SR_EQUAL = 130,               /* T_SR_EQUAL  */
+  YYSYMBOL_T_START_HEREDOC = 131,          /* T_START_HEREDOC  */
+  YYSYMBOL_T_STATIC = 132,                 /* T_STATIC  */
+  YYSYMBOL_T_STRING = 133,                 /* T_STRING  */
+  YYSYMBOL_T_STRING_CAST = 134,            /* T_STRING_CAST  */
+  YYSYMBOL_T_STRING_VARNAME = 135,         /* T_STRING_VARNAME  */
+  YYSYMBOL_T_SWITCH = 136,                 /* T_SWITCH  */
+  YYSYMBOL_T_THROW = 137,                  /* T_THROW  */
+  YYSYMBOL_T_TRAIT = 138,                  /* T_TRAIT  */
+  YYSYMBOL_T_TRAIT_C = 139,                /* T_TRAIT_C  */
+  YYSYMBOL_T_TRY = 140,                    /* T_TRY  */
+  YYSYMBOL_T_UNSET = 141,                  /* T_UNSET  */
+  YYSYMBOL_T_UNSET_CAST = 142,             /* T_UNSET_CAST  */
+  YYSYMBOL_T_USE = 143,                    /* T_USE  */
+  YYSYMBOL_T_VAR = 144,                    /* T_VAR  */
+  YYSYMBOL_T_VARIABLE = 145,               /* T_VARIABLE  */
+  YYSYMBOL_T_WHILE = 146,                  /* T_WHILE  */
+  YYSYMBOL_T_WHITESPACE = 147,             /* T_WHITESPACE  */
+  YYSYMBOL_T_XOR_EQUAL = 148,              /* T_XOR_EQUAL  */
+  YYSYMBOL_149_ = 149,                     /* '{'  */
+  YYSYMBOL_150_ = 150,                     /* '}'  */
+  YYSYMBOL_151_ = 151,                     /* '('  */
+  YYSYMBOL_152_ = 152,                     /* ')'  */
+  YYSYMBOL_153_ = 153,                     /* ';'  */
+  YYSYMBOL_154_ = 154,                     /* '`'  */
+  YYSYMBOL_155_ = 155,                     /* '$'  */
+  YYSYMBOL_156_ = 156,                     /* '"'  */
+  YYSYMBOL_157_ = 157,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 158,                 /* $accept  */
+  YYSYMBOL_start = 159,                    /* start  */
+  YYSYMBOL_top_statement_list = 160,       /* top_statement_list  */
+  YYSYMBOL_namespace_name = 161,           /* namespace_name  */
+  YYSYMBOL_top_statement = 162,            /* top_statement  */
+  YYSYMBOL_use_declarations = 163,         /* use_declarations  */
+  YYSYMBOL_use_declaration = 164,          /* use_declaration  */
+  YYSYMBOL_constant_declaration = 165,     /* constant_declaration  */
+  YYSYMBOL_inner_statement_list = 166,     /* inner_statement_list  */
+  YYSYMBOL_inner_statement = 167,          /* inner_statement  */
+  YYSYMBOL_statement = 168,                /* statement  */
+  YYSYMBOL_unticked_statement = 169,       /* unticked_statement  */
+  YYSYMBOL_additional_catches = 170,       /* additional_catches  */
+  YYSYMBOL_non_empty_additional_catches = 171, /* non_empty_additional_catches  */
+  YYSYMBOL_additional_catch = 172,         /* additional_catch  */
+  YYSYMBOL_unset_variables = 173,          /* unset_variables  */
+  YYSYMBOL_unset_variable = 174,           /* unset_variable  */
+  YYSYMBOL_function_declaration_statement = 175, /* function_declaration_statement  */
+  YYSYMBOL_class_declaration_statement = 176, /* class_declaration_statement  */
+  YYSYMBOL_is_reference = 177,             /* is_reference  */
+  YYSYMBOL_unticked_function_declaration_statement = 178, /* unticked_function_declaration_statement  */
+  YYSYMBOL_unticked_class_declaration_statement = 179, /* unticked_class_declaration_statement  */
+  YYSYMBOL_class_entry_type = 180,         /* class_entry_type  */
+  YYSYMBOL_extends_from = 181,             /* extends_from  */
+  YYSYMBOL_interface_entry = 182,          /* interface_entry  */
+  YYSYMBOL_interface_extends_list = 183,   /* interface_extends_list  */
+  YYSYMBOL_implements_list = 184,          /* implements_list  */
+  YYSYMBOL_interface_list = 185,           /* interface_list  */
+  YYSYMBOL_foreach_optional_arg = 186,     /* foreach_optional_arg  */
+  YYSYMBOL_foreach_variable = 187,         /* foreach_variable  */
+  YYSYMBOL_for_statement = 188,            /* for_statement  */
+  YYSYMBOL_foreach_statement = 189,        /* foreach_statement  */
+  YYSYMBOL_declare_statement = 190,        /* declare_statement  */
+  YYSYMBOL_declare_list = 191,             /* declare_list  */
+  YYSYMBOL_switch_case_list = 192,         /* switch_case_list  */
+  YYSYMBOL_case_list = 193,                /* case_list  */
+  YYSYMBOL_case_separator = 194,           /* case_separator  */
+  YYSYMBOL_while_statement = 195,          /* while_statement  */
+  YYSYMBOL_elseif_list = 196,              /* elseif_list  */
+  YYSYMBOL_new_elseif_list = 197,          /* new_elseif_list  */
+  YYSYMBOL_else_single = 198,              /* else_single  */
+  YYSYMBOL_new_else_single = 199,          /* new_else_single  */
+  YYSYMBOL_parameter_list = 200,           /* parameter_list  */
+  YYSYMBOL_non_empty_parameter_list = 201, /* non_empty_parameter_list  */
+  YYSYMBOL_optional_class_type = 202,      /* optional_class_type  */
+  YYSYMBOL_function_call_parameter_list = 203, /* function_call_parameter_list  */
+  YYSYMBOL_non_empty_function_call_parameter_list = 204, /* non_empty_function_call_parameter_list  */
+  YYSYMBOL_global_var_list = 205,          /* global_var_list  */
+  YYSYMBOL_global_var = 206,               /* global_var  */
+  YYSYMBOL_static_var_list = 207,          /* static_var_list  */
+  YYSYMBOL_class_statement_list = 208,     /* class_statement_list  */
+  YYSYMBOL_class_statement = 209,          /* class_statement  */
+  YYSYMBOL_method_body = 210,              /* method_body  */
+  YYSYMBOL_variable_modifiers = 211,       /* variable_modifiers  */
+  YYSYMBOL_method_modifiers = 212,         /* method_modifiers  */
+  YYSYMBOL_non_empty_member_modifiers = 213, /* non_empty_member_modifiers  */
+  YYSYMBOL_member_modifier = 214,          /* member_modifier  */
+  YYSYMBOL_class_variable_declaration = 215, /* class_variable_declaration  */
+  YYSYMBOL_class_constant_declaration = 216, /* class_constant_declaration  */
+  YYSYMBOL_echo_expr_list = 217,           /* echo_expr_list  */
+  YYSYMBOL_for_expr = 218,                 /* for_expr  */
+  YYSYMBOL_non_empty_for_expr = 219,       /* non_empty_for_expr  */
+  YYSYMBOL_expr_without_variable = 220,    /* expr_without_variable  */
+  YYSYMBOL_function = 221,                 /* function  */
+  YYSYMBOL_lexical_vars = 222,             /* lexical_vars  */
+  YYSYMBOL_lexical_var_list = 223,         /* lexical_var_list  */
+  YYSYMBOL_function_call = 224,            /* function_call  */
+  YYSYMBOL_class_name = 225,               /* class_name  */
+  YYSYMBOL_fully_qualified_class_name = 226, /* fully_qualified_class_name  */
+  YYSYMBOL_class_name_reference = 227,     /* class_name_reference  */
+  YYSYMBOL_dynamic_class_name_reference = 228, /* dynamic_class_name_reference  */
+  YYSYMBOL_dynamic_class_name_variable_properties = 229, /* dynamic_class_name_variable_properties  */
+  YYSYMBOL_dynamic_class_name_variable_property = 230, /* dynamic_class_name_variable_property  */
+  YYSYMBOL_exit_expr = 231,                /* exit_expr  */
+  YYSYMBOL_backticks_expr = 232,           /* backticks_expr  */
+  YYSYMBOL_ctor_arguments = 233,           /* ctor_arguments  */
+  YYSYMBOL_common_scalar = 234,            /* common_scalar  */
+  YYSYMBOL_static_scalar = 235,            /* static_scalar  */
+  YYSYMBOL_static_class_constant = 236,    /* static_class_constant  */
+  YYSYMBOL_scalar = 237,                   /* scalar  */
+  YYSYMBOL_static_array_pair_list = 238,   /* static_array_pair_list  */
+  YYSYMBOL_possible_comma = 239,           /* possible_comma  */
+  YYSYMBOL_non_empty_static_array_pair_list = 240, /* non_empty_static_array_pair_list  */
+  YYSYMBOL_expr = 241,                     /* expr  */
+  YYSYMBOL_r_variable = 242,               /* r_variable  */
+  YYSYMBOL_w_variable = 243,               /* w_variable  */
+  YYSYMBOL_rw_variable = 244,              /* rw_variable  */
+  YYSYMBOL_variable = 245,                 /* variable  */
+  YYSYMBOL_variable_properties = 246,      /* variable_properties  */
+  YYSYMBOL_variable_property = 247,        /* variable_property  */
+  YYSYMBOL_method_or_not = 248,            /* method_or_not  */
+  YYSYMBOL_variable_without_objects = 249, /* variable_without_objects  */
+  YYSYMBOL_static_member = 250,            /* static_member  */
+  YYSYMBOL_variable_class_name = 251,      /* variable_class_name  */
+  YYSYMBOL_base_variable_with_function_calls = 252, /* base_variable_with_function_calls  */
+  YYSYMBOL_base_variable = 253,            /* base_variable  */
+  YYSYMBOL_reference_variable = 254,       /* reference_variable  */
+  YYSYMBOL_compound_variable = 255,        /* compound_variable  */
+  YYSYMBOL_dim_offset = 256,               /* dim_offset  */
+  YYSYMBOL_object_property = 257,          /* object_property  */
+  YYSYMBOL_object_dim_list = 258,          /* object_dim_list  */
+  YYSYMBOL_variable_name = 259,            /* variable_name  */
+  YYSYMBOL_simple_indirect_reference = 260, /* simple_indirect_reference  */
+  YYSYMBOL_assignment_list = 261,          /* assignment_list  */
+  YYSYMBOL_assignment_list_element = 262,  /* assignment_list_element  */
+  YYSYMBOL_array_pair_list = 263,          /* array_pair_list  */
+  YYSYMBOL_non_empty_array_pair_list = 264, /* non_empty_array_pair_list  */
+  YYSYMBOL_encaps_list = 265,              /* encaps_list  */
+  YYSYMBOL_encaps_var = 266,               /* encaps_var  */
+  YYSYMBOL_encaps_var_offset = 267,        /* encaps_var_offset  */
+  YYSYMBOL_internal_functions_in_yacc = 268, /* internal_functions_in_yacc  */
+  YYSYMBOL_isset_variables = 269,          /* isset_variables  */
+  YYSYMBOL_class_constant = 270            /* class_constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 343 of yacc.c  */
-#line 294 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53LintParser.cpp"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -328,55 +678,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -393,9 +794,9 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
 #      define EXIT_SUCCESS 0
 #     endif
@@ -405,8 +806,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -422,7 +823,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -430,40 +831,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined PHP53_LINT_STYPE_IS_TRIVIAL && PHP53_LINT_STYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -473,35 +871,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -509,40 +907,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   7601
+#define YYLAST   9118
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  158
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  113
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  396
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  826
+#define YYNRULES  398
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  830
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   629
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    48,   156,     2,   155,    47,    31,     2,
-     151,   152,    45,    42,     8,    43,    44,    46,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    26,   153,
-      36,    13,    37,    25,    60,     2,     2,     2,     2,     2,
+       2,     2,     2,    18,   156,     2,   155,    17,     9,     2,
+     151,   152,    15,    12,     3,    13,    14,    16,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     6,   153,
+      10,     4,    11,     5,    20,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    61,     2,   157,    30,     2,   154,     2,     2,     2,
+       2,    21,     2,   157,     8,     2,   154,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   149,    29,   150,    50,     2,     2,     2,
+       2,     2,     2,   149,     7,   150,    19,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -580,294 +983,112 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    71,    18,    73,    54,    74,    75,    52,    28,
-      27,    76,    77,    78,    79,    80,    81,    82,    62,    83,
-      84,    20,    85,    86,    87,    88,    58,    89,    90,    91,
-      21,    92,    93,    94,    95,    96,    56,    97,    65,    64,
-      98,    99,   100,   101,   102,   103,    66,   104,   105,     5,
-     106,   107,   108,    70,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,    59,     7,     6,   118,    49,   119,    57,
-     120,    35,    38,    33,    34,    32,   121,    39,   122,   123,
-     124,    11,     9,    10,   125,    23,    19,    22,   126,    63,
-     127,   128,   129,    53,   130,   131,   132,    17,   133,    24,
-      12,    69,    68,    67,     4,     3,   134,    41,    15,    40,
-      14,   135,    72,   136,    55,   137,   138,   139,   140,   141,
-     142,   143,    51,   144,   145,   146,   147,   148,    16,     2
-};
-
-#if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
-{
-       0,     0,     3,     5,     8,     9,    11,    15,    17,    19,
-      21,    26,    30,    36,    41,    45,    48,    52,    54,    56,
-      60,    63,    68,    74,    79,    82,    83,    85,    87,    89,
-      94,    96,    99,   103,   111,   122,   128,   136,   146,   152,
-     155,   159,   162,   166,   169,   173,   177,   181,   185,   189,
-     191,   194,   200,   209,   218,   224,   226,   240,   244,   248,
-     250,   251,   253,   256,   265,   267,   271,   273,   275,   277,
-     278,   280,   290,   298,   305,   307,   310,   313,   314,   317,
-     319,   320,   323,   324,   327,   329,   333,   334,   337,   339,
-     342,   344,   349,   351,   356,   358,   363,   367,   373,   377,
-     382,   387,   393,   394,   400,   405,   407,   409,   411,   416,
-     417,   424,   425,   433,   434,   437,   438,   442,   444,   445,
-     448,   452,   458,   463,   468,   474,   482,   489,   490,   492,
-     494,   496,   497,   499,   501,   504,   508,   512,   517,   521,
-     523,   525,   528,   533,   537,   543,   545,   549,   552,   553,
-     557,   560,   569,   571,   575,   577,   579,   580,   582,   584,
-     587,   589,   591,   593,   595,   597,   599,   603,   609,   611,
-     615,   621,   626,   630,   632,   633,   635,   639,   641,   648,
-     652,   657,   664,   668,   671,   675,   679,   683,   687,   691,
-     695,   699,   703,   707,   711,   715,   718,   721,   724,   727,
-     731,   735,   739,   743,   747,   751,   755,   759,   763,   767,
-     771,   775,   779,   783,   787,   791,   794,   797,   800,   803,
-     807,   811,   815,   819,   823,   827,   831,   835,   839,   843,
-     849,   854,   856,   859,   862,   865,   868,   871,   874,   877,
-     880,   883,   885,   890,   894,   897,   907,   909,   910,   915,
-     919,   924,   926,   929,   934,   941,   947,   954,   961,   968,
-     975,   980,   982,   984,   988,   991,   993,   997,  1000,  1002,
-    1004,  1009,  1011,  1014,  1015,  1018,  1019,  1022,  1026,  1027,
-    1029,  1031,  1032,  1036,  1038,  1040,  1042,  1044,  1046,  1048,
-    1050,  1052,  1054,  1056,  1060,  1063,  1065,  1067,  1071,  1074,
-    1077,  1080,  1085,  1087,  1091,  1093,  1095,  1097,  1101,  1104,
-    1106,  1110,  1114,  1115,  1118,  1119,  1121,  1127,  1131,  1135,
-    1137,  1139,  1141,  1143,  1145,  1147,  1153,  1155,  1158,  1159,
-    1163,  1167,  1168,  1170,  1173,  1177,  1181,  1183,  1185,  1187,
-    1189,  1192,  1194,  1199,  1204,  1206,  1208,  1213,  1214,  1216,
-    1218,  1220,  1225,  1230,  1232,  1234,  1238,  1240,  1243,  1247,
-    1249,  1251,  1256,  1257,  1258,  1261,  1267,  1271,  1275,  1277,
-    1284,  1289,  1294,  1297,  1300,  1303,  1305,  1308,  1310,  1315,
-    1319,  1323,  1330,  1334,  1336,  1338,  1340,  1345,  1350,  1353,
-    1356,  1361,  1364,  1367,  1369,  1373,  1377
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     159,     0,    -1,   160,    -1,   160,   162,    -1,    -1,   136,
-      -1,   161,   128,   136,    -1,   168,    -1,   175,    -1,   176,
-      -1,   115,   151,   152,   153,    -1,   126,   161,   153,    -1,
-     126,   161,   149,   160,   150,    -1,   126,   149,   160,   150,
-      -1,   144,   163,   153,    -1,   165,   153,    -1,   163,     8,
-     164,    -1,   164,    -1,   161,    -1,   161,    74,   136,    -1,
-     128,   161,    -1,   128,   161,    74,   136,    -1,   165,     8,
-     136,    13,   235,    -1,    85,   136,    13,   235,    -1,   166,
-     167,    -1,    -1,   168,    -1,   175,    -1,   176,    -1,   115,
-     151,   152,   153,    -1,   169,    -1,   136,    26,    -1,   149,
-     166,   150,    -1,   116,   151,   241,   152,   168,   196,   198,
-      -1,   116,   151,   241,   152,    26,   166,   197,   199,    66,
-     153,    -1,   147,   151,   241,   152,   195,    -1,    93,   168,
-     147,   151,   241,   152,   153,    -1,   109,   151,   218,   153,
-     218,   153,   218,   152,   188,    -1,   138,   151,   241,   152,
-     192,    -1,    76,   153,    -1,    76,   241,   153,    -1,    87,
-     153,    -1,    87,   241,   153,    -1,   134,   153,    -1,   134,
-     220,   153,    -1,   134,   245,   153,    -1,   113,   205,   153,
-      -1,    72,   207,   153,    -1,    97,   217,   153,    -1,   118,
-      -1,   241,   153,    -1,   143,   151,   173,   152,   153,    -1,
-     110,   151,   245,    74,   187,   186,   152,   189,    -1,   110,
-     151,   220,    74,   245,   186,   152,   189,    -1,    89,   151,
-     191,   152,   190,    -1,   153,    -1,   142,   149,   166,   150,
-      79,   151,   226,   146,   152,   149,   166,   150,   170,    -1,
-     139,   241,   153,    -1,   114,   136,   153,    -1,   171,    -1,
-      -1,   172,    -1,   171,   172,    -1,    79,   151,   226,   146,
-     152,   149,   166,   150,    -1,   174,    -1,   173,     8,   174,
-      -1,   245,    -1,   178,    -1,   179,    -1,    -1,    31,    -1,
-     221,   177,   136,   151,   200,   152,   149,   166,   150,    -1,
-     180,   136,   181,   184,   149,   208,   150,    -1,   182,   136,
-     183,   149,   208,   150,    -1,    81,    -1,    71,    81,    -1,
-      70,    81,    -1,    -1,   107,   226,    -1,   120,    -1,    -1,
-     107,   185,    -1,    -1,   117,   185,    -1,   226,    -1,   185,
-       8,   226,    -1,    -1,    96,   187,    -1,   245,    -1,    31,
-     245,    -1,   168,    -1,    26,   166,   101,   153,    -1,   168,
-      -1,    26,   166,   102,   153,    -1,   168,    -1,    26,   166,
-     100,   153,    -1,   136,    13,   235,    -1,   191,     8,   136,
-      13,   235,    -1,   149,   193,   150,    -1,   149,   153,   193,
-     150,    -1,    26,   193,   104,   153,    -1,    26,   153,   193,
-     104,   153,    -1,    -1,   193,    78,   241,   194,   166,    -1,
-     193,    90,   194,   166,    -1,    26,    -1,   153,    -1,   168,
-      -1,    26,   166,   105,   153,    -1,    -1,   196,    64,   151,
-     241,   152,   168,    -1,    -1,   197,    64,   151,   241,   152,
-      26,   166,    -1,    -1,    65,   168,    -1,    -1,    65,    26,
-     166,    -1,   201,    -1,    -1,   202,   146,    -1,   202,    31,
-     146,    -1,   202,    31,   146,    13,   235,    -1,   202,   146,
-      13,   235,    -1,   201,     8,   202,   146,    -1,   201,     8,
-     202,    31,   146,    -1,   201,     8,   202,    31,   146,    13,
-     235,    -1,   201,     8,   202,   146,    13,   235,    -1,    -1,
-     226,    -1,    73,    -1,   204,    -1,    -1,   220,    -1,   245,
-      -1,    31,   243,    -1,   204,     8,   220,    -1,   204,     8,
-     245,    -1,   204,     8,    31,   243,    -1,   205,     8,   206,
-      -1,   206,    -1,   146,    -1,   155,   242,    -1,   155,   149,
-     241,   150,    -1,   207,     8,   146,    -1,   207,     8,   146,
-      13,   235,    -1,   146,    -1,   146,    13,   235,    -1,   208,
-     209,    -1,    -1,   211,   215,   153,    -1,   216,   153,    -1,
-     212,   221,   177,   136,   151,   200,   152,   210,    -1,   153,
-      -1,   149,   166,   150,    -1,   213,    -1,   145,    -1,    -1,
-     213,    -1,   214,    -1,   213,   214,    -1,    67,    -1,    68,
-      -1,    69,    -1,    72,    -1,    71,    -1,    70,    -1,   215,
-       8,   146,    -1,   215,     8,   146,    13,   235,    -1,   146,
-      -1,   146,    13,   235,    -1,   216,     8,   136,    13,   235,
-      -1,    85,   136,    13,   235,    -1,   217,     8,   241,    -1,
-     241,    -1,    -1,   219,    -1,   219,     8,   241,    -1,   241,
-      -1,   123,   151,   261,   152,    13,   241,    -1,   245,    13,
-     241,    -1,   245,    13,    31,   245,    -1,   245,    13,    31,
-      63,   227,   233,    -1,    63,   227,   233,    -1,    62,   241,
-      -1,   245,    24,   241,    -1,   245,    23,   241,    -1,   245,
-      22,   241,    -1,   245,    21,   241,    -1,   245,    20,   241,
-      -1,   245,    19,   241,    -1,   245,    18,   241,    -1,   245,
-      17,   241,    -1,   245,    16,   241,    -1,   245,    15,   241,
-      -1,   245,    14,   241,    -1,   244,    59,    -1,    59,   244,
-      -1,   244,    58,    -1,    58,   244,    -1,   241,    27,   241,
-      -1,   241,    28,   241,    -1,   241,     9,   241,    -1,   241,
-      11,   241,    -1,   241,    10,   241,    -1,   241,    29,   241,
-      -1,   241,    31,   241,    -1,   241,    30,   241,    -1,   241,
-      44,   241,    -1,   241,    42,   241,    -1,   241,    43,   241,
-      -1,   241,    45,   241,    -1,   241,    46,   241,    -1,   241,
-      47,   241,    -1,   241,    41,   241,    -1,   241,    40,   241,
-      -1,    42,   241,    -1,    43,   241,    -1,    48,   241,    -1,
-      50,   241,    -1,   241,    33,   241,    -1,   241,    32,   241,
-      -1,   241,    35,   241,    -1,   241,    34,   241,    -1,   241,
-      36,   241,    -1,   241,    39,   241,    -1,   241,    37,   241,
-      -1,   241,    38,   241,    -1,   241,    49,   227,    -1,   151,
-     241,   152,    -1,   241,    25,   241,    26,   241,    -1,   241,
-      25,    26,   241,    -1,   268,    -1,    57,   241,    -1,    56,
-     241,    -1,    55,   241,    -1,    54,   241,    -1,    53,   241,
-      -1,    52,   241,    -1,    51,   241,    -1,   106,   231,    -1,
-      60,   241,    -1,   237,    -1,    73,   151,   263,   152,    -1,
-     154,   232,   154,    -1,    12,   241,    -1,   221,   177,   151,
-     200,   152,   222,   149,   166,   150,    -1,   112,    -1,    -1,
-     144,   151,   223,   152,    -1,   223,     8,   146,    -1,   223,
-       8,    31,   146,    -1,   146,    -1,    31,   146,    -1,   161,
-     151,   203,   152,    -1,   126,   128,   161,   151,   203,   152,
-      -1,   128,   161,   151,   203,   152,    -1,   225,   133,   136,
-     151,   203,   152,    -1,   225,   133,   249,   151,   203,   152,
-      -1,   251,   133,   136,   151,   203,   152,    -1,   251,   133,
-     249,   151,   203,   152,    -1,   249,   151,   203,   152,    -1,
-      72,    -1,   161,    -1,   126,   128,   161,    -1,   128,   161,
-      -1,   161,    -1,   126,   128,   161,    -1,   128,   161,    -1,
-     225,    -1,   228,    -1,   253,   130,   257,   229,    -1,   253,
-      -1,   229,   230,    -1,    -1,   130,   257,    -1,    -1,   151,
-     152,    -1,   151,   241,   152,    -1,    -1,    99,    -1,   265,
-      -1,    -1,   151,   203,   152,    -1,   124,    -1,    92,    -1,
-      86,    -1,   122,    -1,   108,    -1,    91,    -1,    82,    -1,
-     125,    -1,   111,    -1,   127,    -1,   135,    99,   103,    -1,
-     135,   103,    -1,   234,    -1,   161,    -1,   126,   128,   161,
-      -1,   128,   161,    -1,    42,   235,    -1,    43,   235,    -1,
-      73,   151,   238,   152,    -1,   236,    -1,   225,   133,   136,
-      -1,   137,    -1,   270,    -1,   161,    -1,   126,   128,   161,
-      -1,   128,   161,    -1,   234,    -1,   156,   265,   156,    -1,
-     135,   265,   103,    -1,    -1,   240,   239,    -1,    -1,     8,
-      -1,   240,     8,   235,    96,   235,    -1,   240,     8,   235,
-      -1,   235,    96,   235,    -1,   235,    -1,   242,    -1,   220,
-      -1,   245,    -1,   245,    -1,   245,    -1,   252,   130,   257,
-     248,   246,    -1,   252,    -1,   246,   247,    -1,    -1,   130,
-     257,   248,    -1,   151,   203,   152,    -1,    -1,   254,    -1,
-     260,   254,    -1,   225,   133,   249,    -1,   251,   133,   249,
-      -1,   254,    -1,   253,    -1,   224,    -1,   254,    -1,   260,
-     254,    -1,   250,    -1,   254,    61,   256,   157,    -1,   254,
-     149,   241,   150,    -1,   255,    -1,   146,    -1,   155,   149,
-     241,   150,    -1,    -1,   241,    -1,   258,    -1,   249,    -1,
-     258,    61,   256,   157,    -1,   258,   149,   241,   150,    -1,
-     259,    -1,   136,    -1,   149,   241,   150,    -1,   155,    -1,
-     260,   155,    -1,   261,     8,   262,    -1,   262,    -1,   245,
-      -1,   123,   151,   261,   152,    -1,    -1,    -1,   264,   239,
-      -1,   264,     8,   241,    96,   241,    -1,   264,     8,   241,
-      -1,   241,    96,   241,    -1,   241,    -1,   264,     8,   241,
-      96,    31,   243,    -1,   264,     8,    31,   243,    -1,   241,
-      96,    31,   243,    -1,    31,   243,    -1,   265,   266,    -1,
-     265,    99,    -1,   266,    -1,    99,   266,    -1,   146,    -1,
-     146,    61,   267,   157,    -1,   146,   130,   136,    -1,    95,
-     241,   150,    -1,    95,   137,    61,   241,   157,   150,    -1,
-      88,   245,   150,    -1,   136,    -1,   129,    -1,   146,    -1,
-     121,   151,   269,   152,    -1,    98,   151,   245,   152,    -1,
-       7,   241,    -1,     6,   241,    -1,     5,   151,   241,   152,
-      -1,     4,   241,    -1,     3,   241,    -1,   245,    -1,   269,
-       8,   245,    -1,   225,   133,   136,    -1,   251,   133,   136,
-      -1
+       2,     2,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,     2
 };
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+#if PHP53_LINT_DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
        0,   225,   225,   229,   230,   234,   235,   239,   240,   241,
      242,   243,   244,   246,   248,   249,   253,   254,   258,   259,
      260,   261,   265,   266,   270,   271,   276,   277,   278,   279,
-     284,   285,   289,   290,   291,   292,   293,   294,   303,   304,
+     284,   285,   286,   290,   291,   292,   293,   294,   295,   304,
      305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   321,   325,   326,   327,   333,   334,   339,
-     340,   344,   345,   350,   355,   356,   360,   364,   368,   372,
-     374,   379,   384,   390,   400,   401,   402,   405,   407,   411,
-     414,   416,   419,   421,   425,   426,   429,   431,   436,   437,
-     441,   442,   447,   448,   453,   454,   459,   460,   465,   466,
-     467,   468,   472,   474,   475,   480,   481,   486,   487,   492,
-     494,   498,   500,   504,   506,   510,   512,   517,   518,   523,
-     524,   525,   526,   527,   528,   529,   530,   534,   536,   537,
-     542,   543,   548,   549,   550,   551,   552,   553,   557,   558,
-     563,   564,   565,   570,   571,   572,   573,   579,   580,   585,
-     586,   587,   593,   594,   598,   599,   602,   604,   608,   609,
-     613,   614,   615,   616,   617,   618,   622,   623,   624,   625,
-     629,   630,   634,   635,   639,   641,   645,   646,   650,   651,
+     315,   316,   317,   318,   322,   326,   327,   328,   334,   335,
+     340,   341,   345,   346,   351,   356,   357,   361,   365,   369,
+     373,   375,   380,   385,   391,   401,   402,   403,   406,   408,
+     412,   415,   417,   420,   422,   426,   427,   430,   432,   437,
+     438,   442,   443,   448,   449,   454,   455,   460,   461,   466,
+     467,   468,   469,   473,   475,   476,   481,   482,   487,   488,
+     493,   495,   499,   501,   505,   507,   511,   513,   518,   519,
+     524,   525,   526,   527,   528,   529,   530,   531,   535,   537,
+     538,   543,   544,   549,   550,   551,   552,   553,   554,   558,
+     559,   564,   565,   566,   571,   572,   573,   574,   580,   581,
+     586,   587,   588,   590,   595,   596,   600,   601,   604,   606,
+     610,   611,   615,   616,   617,   618,   619,   620,   624,   625,
+     626,   627,   631,   632,   636,   637,   641,   643,   647,   648,
      652,   653,   654,   655,   656,   657,   658,   659,   660,   661,
      662,   663,   664,   665,   666,   667,   668,   669,   670,   671,
      672,   673,   674,   675,   676,   677,   678,   679,   680,   681,
      682,   683,   684,   685,   686,   687,   688,   689,   690,   691,
      692,   693,   694,   695,   696,   697,   698,   699,   700,   701,
-     704,   706,   707,   708,   709,   710,   711,   712,   713,   714,
-     715,   716,   717,   718,   719,   720,   725,   728,   730,   734,
-     735,   736,   737,   741,   744,   747,   750,   753,   756,   759,
-     762,   768,   769,   770,   771,   775,   776,   777,   783,   784,
-     789,   792,   797,   798,   803,   806,   808,   809,   812,   814,
-     815,   819,   821,   826,   827,   828,   829,   830,   831,   832,
-     833,   834,   835,   836,   837,   842,   843,   844,   845,   846,
-     847,   848,   849,   853,   857,   858,   859,   860,   861,   862,
-     863,   864,   868,   870,   873,   875,   879,   880,   881,   882,
-     886,   887,   892,   897,   901,   905,   908,   912,   913,   918,
-     922,   925,   929,   930,   934,   935,   940,   944,   945,   950,
-     951,   952,   956,   957,   958,   963,   964,   967,   969,   974,
-     975,   979,   980,   981,   985,   986,   990,   991,   995,   996,
-    1001,  1002,  1003,  1007,  1009,  1013,  1014,  1015,  1016,  1017,
-    1018,  1019,  1020,  1024,  1025,  1026,  1027,  1033,  1034,  1035,
-    1036,  1037,  1038,  1043,  1044,  1045,  1050,  1051,  1052,  1053,
-    1054,  1055,  1056,  1060,  1061,  1065,  1066
+     702,   703,   706,   708,   709,   710,   711,   712,   713,   714,
+     715,   716,   717,   718,   719,   720,   721,   722,   727,   730,
+     732,   736,   737,   738,   739,   743,   746,   749,   752,   755,
+     758,   761,   764,   770,   771,   772,   773,   777,   778,   779,
+     785,   786,   791,   794,   799,   800,   805,   808,   810,   811,
+     814,   816,   817,   821,   823,   828,   829,   830,   831,   832,
+     833,   834,   835,   836,   837,   838,   839,   844,   845,   846,
+     847,   848,   849,   850,   851,   855,   859,   860,   861,   862,
+     863,   864,   865,   866,   870,   872,   875,   877,   881,   882,
+     883,   884,   888,   889,   894,   899,   903,   907,   910,   914,
+     915,   920,   924,   927,   931,   932,   936,   937,   942,   946,
+     947,   952,   953,   954,   958,   959,   960,   965,   966,   969,
+     971,   976,   977,   981,   982,   983,   987,   988,   992,   993,
+     997,   998,  1003,  1004,  1005,  1009,  1011,  1015,  1016,  1017,
+    1018,  1019,  1020,  1021,  1022,  1026,  1027,  1028,  1029,  1035,
+    1036,  1037,  1038,  1039,  1040,  1045,  1046,  1047,  1052,  1053,
+    1054,  1055,  1056,  1057,  1058,  1062,  1063,  1067,  1068
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "T_END", "error", "$undefined", "T_REQUIRE_ONCE", "T_REQUIRE", "T_EVAL",
-  "T_INCLUDE_ONCE", "T_INCLUDE", "','", "T_LOGICAL_OR", "T_LOGICAL_XOR",
-  "T_LOGICAL_AND", "T_PRINT", "'='", "T_SR_EQUAL", "T_SL_EQUAL",
-  "T_XOR_EQUAL", "T_OR_EQUAL", "T_AND_EQUAL", "T_MOD_EQUAL",
-  "T_CONCAT_EQUAL", "T_DIV_EQUAL", "T_MUL_EQUAL", "T_MINUS_EQUAL",
-  "T_PLUS_EQUAL", "'?'", "':'", "T_BOOLEAN_OR", "T_BOOLEAN_AND", "'|'",
-  "'^'", "'&'", "T_IS_NOT_IDENTICAL", "T_IS_IDENTICAL", "T_IS_NOT_EQUAL",
-  "T_IS_EQUAL", "'<'", "'>'", "T_IS_GREATER_OR_EQUAL",
-  "T_IS_SMALLER_OR_EQUAL", "T_SR", "T_SL", "'+'", "'-'", "'.'", "'*'",
-  "'/'", "'%'", "'!'", "T_INSTANCEOF", "'~'", "T_UNSET_CAST",
-  "T_BOOL_CAST", "T_OBJECT_CAST", "T_ARRAY_CAST", "T_STRING_CAST",
-  "T_DOUBLE_CAST", "T_INT_CAST", "T_DEC", "T_INC", "'@'", "'['", "T_CLONE",
-  "T_NEW", "T_ELSEIF", "T_ELSE", "T_ENDIF", "T_PUBLIC", "T_PROTECTED",
-  "T_PRIVATE", "T_FINAL", "T_ABSTRACT", "T_STATIC", "T_ARRAY", "T_AS",
-  "T_BAD_CHARACTER", "T_BREAK", "T_CALLABLE", "T_CASE", "T_CATCH",
-  "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLOSE_TAG", "T_COMMENT",
-  "T_CONST", "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN",
-  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
-  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_ECHO", "T_EMPTY",
+  "T_END", "error", "\"invalid token\"", "','", "'='", "'?'", "':'",
+  "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'.'", "'*'", "'/'",
+  "'%'", "'!'", "'~'", "'@'", "'['", "T_ABSTRACT", "T_AND_EQUAL",
+  "T_ARRAY", "T_ARRAY_CAST", "T_AS", "T_BAD_CHARACTER", "T_BOOL_CAST",
+  "T_BOOLEAN_AND", "T_BOOLEAN_OR", "T_BREAK", "T_CALLABLE", "T_CASE",
+  "T_CATCH", "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLONE",
+  "T_CLOSE_TAG", "T_COMMENT", "T_CONCAT_EQUAL", "T_CONST",
+  "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN", "T_DEC",
+  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DIV_EQUAL", "T_DNUMBER", "T_DO",
+  "T_DOC_COMMENT", "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW",
+  "T_DOUBLE_CAST", "T_ECHO", "T_ELSE", "T_ELSEIF", "T_EMPTY",
   "T_ENCAPSED_AND_WHITESPACE", "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH",
-  "T_END_HEREDOC", "T_ENDSWITCH", "T_ENDWHILE", "T_EXIT", "T_EXTENDS",
-  "T_FILE", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
-  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INLINE_HTML",
-  "T_INSTEADOF", "T_INTERFACE", "T_ISSET", "T_LINE", "T_LIST", "T_LNUMBER",
-  "T_METHOD_C", "T_NAMESPACE", "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING",
-  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO",
-  "T_PAAMAYIM_NEKUDOTAYIM", "T_RETURN", "T_START_HEREDOC", "T_STRING",
-  "T_STRING_VARNAME", "T_SWITCH", "T_THROW", "T_TRAIT", "T_TRAIT_C",
-  "T_TRY", "T_UNSET", "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE",
-  "T_WHITESPACE", "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'",
-  "']'", "$accept", "start", "top_statement_list", "namespace_name",
+  "T_END_HEREDOC", "T_ENDIF", "T_ENDSWITCH", "T_ENDWHILE", "T_EVAL",
+  "T_EXIT", "T_EXTENDS", "T_FILE", "T_FINAL", "T_FOR", "T_FOREACH",
+  "T_FUNC_C", "T_FUNCTION", "T_GLOBAL", "T_GOTO", "T_HALT_COMPILER",
+  "T_IF", "T_IMPLEMENTS", "T_INC", "T_INCLUDE", "T_INCLUDE_ONCE",
+  "T_INLINE_HTML", "T_INSTANCEOF", "T_INSTEADOF", "T_INT_CAST",
+  "T_INTERFACE", "T_IS_EQUAL", "T_IS_GREATER_OR_EQUAL", "T_IS_IDENTICAL",
+  "T_IS_NOT_EQUAL", "T_IS_NOT_IDENTICAL", "T_ISSET",
+  "T_IS_SMALLER_OR_EQUAL", "T_LINE", "T_LIST", "T_LNUMBER",
+  "T_LOGICAL_AND", "T_LOGICAL_OR", "T_LOGICAL_XOR", "T_METHOD_C",
+  "T_MINUS_EQUAL", "T_MOD_EQUAL", "T_MUL_EQUAL", "T_NAMESPACE", "T_NEW",
+  "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING", "T_OBJECT_CAST",
+  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO", "T_OR_EQUAL",
+  "T_PAAMAYIM_NEKUDOTAYIM", "T_PLUS_EQUAL", "T_PRINT", "T_PRIVATE",
+  "T_PROTECTED", "T_PUBLIC", "T_REQUIRE", "T_REQUIRE_ONCE", "T_RETURN",
+  "T_SL", "T_SL_EQUAL", "T_SR", "T_SR_EQUAL", "T_START_HEREDOC",
+  "T_STATIC", "T_STRING", "T_STRING_CAST", "T_STRING_VARNAME", "T_SWITCH",
+  "T_THROW", "T_TRAIT", "T_TRAIT_C", "T_TRY", "T_UNSET", "T_UNSET_CAST",
+  "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "T_XOR_EQUAL",
+  "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'", "']'",
+  "$accept", "start", "top_statement_list", "namespace_name",
   "top_statement", "use_declarations", "use_declaration",
   "constant_declaration", "inner_statement_list", "inner_statement",
   "statement", "unticked_statement", "additional_catches",
@@ -907,2141 +1128,2350 @@ static const char *const yytname[] =
   "assignment_list_element", "array_pair_list",
   "non_empty_array_pair_list", "encaps_list", "encaps_var",
   "encaps_var_offset", "internal_functions_in_yacc", "isset_variables",
-  "class_constant", 0
+  "class_constant", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   629,   605,   604,   549,   565,   564,    44,   582,
-     583,   581,   600,    61,   610,   608,   628,   597,   503,   586,
-     521,   530,   587,   585,   599,    63,    58,   510,   509,   124,
-      94,    38,   575,   573,   574,   571,    60,    62,   572,   577,
-     609,   607,    43,    45,    46,    42,    47,    37,    33,   567,
-     126,   622,   508,   593,   505,   614,   536,   569,   526,   563,
-      64,    91,   518,   589,   539,   538,   546,   603,   602,   601,
-     553,   502,   612,   504,   506,   507,   511,   512,   513,   514,
-     515,   516,   517,   519,   520,   522,   523,   524,   525,   527,
-     528,   529,   531,   532,   533,   534,   535,   537,   540,   541,
-     542,   543,   544,   545,   547,   548,   550,   551,   552,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   566,   568,
-     570,   576,   578,   579,   580,   584,   588,   590,   591,   592,
-     594,   595,   596,   598,   606,   611,   613,   615,   616,   617,
-     618,   619,   620,   621,   623,   624,   625,   626,   627,   123,
-     125,    40,    41,    59,    96,    36,    34,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
-     162,   162,   162,   162,   162,   162,   163,   163,   164,   164,
-     164,   164,   165,   165,   166,   166,   167,   167,   167,   167,
-     168,   168,   169,   169,   169,   169,   169,   169,   169,   169,
-     169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
-     169,   169,   169,   169,   169,   169,   169,   169,   169,   170,
-     170,   171,   171,   172,   173,   173,   174,   175,   176,   177,
-     177,   178,   179,   179,   180,   180,   180,   181,   181,   182,
-     183,   183,   184,   184,   185,   185,   186,   186,   187,   187,
-     188,   188,   189,   189,   190,   190,   191,   191,   192,   192,
-     192,   192,   193,   193,   193,   194,   194,   195,   195,   196,
-     196,   197,   197,   198,   198,   199,   199,   200,   200,   201,
-     201,   201,   201,   201,   201,   201,   201,   202,   202,   202,
-     203,   203,   204,   204,   204,   204,   204,   204,   205,   205,
-     206,   206,   206,   207,   207,   207,   207,   208,   208,   209,
-     209,   209,   210,   210,   211,   211,   212,   212,   213,   213,
-     214,   214,   214,   214,   214,   214,   215,   215,   215,   215,
-     216,   216,   217,   217,   218,   218,   219,   219,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   221,   222,   222,   223,
-     223,   223,   223,   224,   224,   224,   224,   224,   224,   224,
-     224,   225,   225,   225,   225,   226,   226,   226,   227,   227,
-     228,   228,   229,   229,   230,   231,   231,   231,   232,   232,
-     232,   233,   233,   234,   234,   234,   234,   234,   234,   234,
-     234,   234,   234,   234,   234,   235,   235,   235,   235,   235,
-     235,   235,   235,   236,   237,   237,   237,   237,   237,   237,
-     237,   237,   238,   238,   239,   239,   240,   240,   240,   240,
-     241,   241,   242,   243,   244,   245,   245,   246,   246,   247,
-     248,   248,   249,   249,   250,   250,   251,   252,   252,   253,
-     253,   253,   254,   254,   254,   255,   255,   256,   256,   257,
-     257,   258,   258,   258,   259,   259,   260,   260,   261,   261,
-     262,   262,   262,   263,   263,   264,   264,   264,   264,   264,
-     264,   264,   264,   265,   265,   265,   265,   266,   266,   266,
-     266,   266,   266,   267,   267,   267,   268,   268,   268,   268,
-     268,   268,   268,   269,   269,   270,   270
-};
+#define YYPACT_NINF (-502)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
-       4,     3,     5,     4,     3,     2,     3,     1,     1,     3,
-       2,     4,     5,     4,     2,     0,     1,     1,     1,     4,
-       1,     2,     3,     7,    10,     5,     7,     9,     5,     2,
-       3,     2,     3,     2,     3,     3,     3,     3,     3,     1,
-       2,     5,     8,     8,     5,     1,    13,     3,     3,     1,
-       0,     1,     2,     8,     1,     3,     1,     1,     1,     0,
-       1,     9,     7,     6,     1,     2,     2,     0,     2,     1,
-       0,     2,     0,     2,     1,     3,     0,     2,     1,     2,
-       1,     4,     1,     4,     1,     4,     3,     5,     3,     4,
-       4,     5,     0,     5,     4,     1,     1,     1,     4,     0,
-       6,     0,     7,     0,     2,     0,     3,     1,     0,     2,
-       3,     5,     4,     4,     5,     7,     6,     0,     1,     1,
-       1,     0,     1,     1,     2,     3,     3,     4,     3,     1,
-       1,     2,     4,     3,     5,     1,     3,     2,     0,     3,
-       2,     8,     1,     3,     1,     1,     0,     1,     1,     2,
-       1,     1,     1,     1,     1,     1,     3,     5,     1,     3,
-       5,     4,     3,     1,     0,     1,     3,     1,     6,     3,
-       4,     6,     3,     2,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     2,     2,     2,     2,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     2,     2,     2,     2,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     5,
-       4,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     1,     4,     3,     2,     9,     1,     0,     4,     3,
-       4,     1,     2,     4,     6,     5,     6,     6,     6,     6,
-       4,     1,     1,     3,     2,     1,     3,     2,     1,     1,
-       4,     1,     2,     0,     2,     0,     2,     3,     0,     1,
-       1,     0,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     2,     1,     1,     3,     2,     2,
-       2,     4,     1,     3,     1,     1,     1,     3,     2,     1,
-       3,     3,     0,     2,     0,     1,     5,     3,     3,     1,
-       1,     1,     1,     1,     1,     5,     1,     2,     0,     3,
-       3,     0,     1,     2,     3,     3,     1,     1,     1,     1,
-       2,     1,     4,     4,     1,     1,     4,     0,     1,     1,
-       1,     4,     4,     1,     1,     3,     1,     2,     3,     1,
-       1,     4,     0,     0,     2,     5,     3,     3,     1,     6,
-       4,     4,     2,     2,     2,     1,     2,     1,     4,     3,
-       3,     6,     3,     1,     1,     1,     4,     4,     2,     2,
-       4,     2,     2,     1,     3,     3,     3
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       4,     0,     2,     1,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   261,     0,
-       0,    74,   289,     0,   285,     0,     0,   288,   284,     0,
-       0,     0,   275,   287,     0,     0,   291,   246,     0,     0,
-       0,     0,    49,    79,     0,   286,     0,   283,   290,     0,
-     292,     0,     0,     0,     5,   304,     0,     0,     0,     0,
-       0,   345,     0,    25,     0,    55,   278,   356,     0,   306,
-       3,     0,     7,    30,     8,     9,    67,    68,     0,     0,
-     321,    69,   338,     0,   309,   241,     0,   320,     0,   322,
-       0,   341,     0,   326,   337,   339,   344,     0,   231,   305,
-     261,     0,     5,    69,   392,   391,     0,   389,   388,   244,
-     215,   216,   217,   218,   238,   237,   236,   235,   234,   233,
-     232,     0,     0,   262,     0,   198,   324,     0,   196,   240,
-     183,     0,     0,   262,   268,   281,   269,     0,   271,   339,
-       0,    76,    75,   145,     0,   363,    39,     0,     0,    41,
-       0,     0,     0,     0,   173,     0,     0,   239,   174,     0,
-     140,     0,     0,   139,     0,     0,     0,     0,   362,     0,
-       4,     0,   308,    43,   321,     0,   322,     0,     0,     0,
-     294,   377,     0,   375,    31,     0,     0,    25,     0,     0,
-      18,     0,    17,     0,     0,     0,   279,     0,   280,     0,
-       0,     0,     0,   131,     0,    15,    77,    80,    70,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    50,   197,   195,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   131,     0,     0,   347,     0,   357,   340,     0,
-       0,     0,   264,     0,     0,     0,   264,     0,   131,   182,
-       0,     0,   340,     0,     0,    47,     0,   368,     0,   314,
-      40,     0,    42,     0,     0,     0,     0,    48,     0,   276,
-       0,     0,   175,   177,   321,   322,     0,   141,   322,     0,
-      46,    58,     0,     0,   393,     0,     0,   360,     0,   359,
-     307,     0,     4,    11,   131,    44,    45,     0,   304,     0,
-     293,   376,     0,     0,   374,   311,   373,     0,    57,     0,
-       0,    64,    66,    20,     0,     0,    14,     0,     0,    32,
-      24,    26,    27,    28,   228,   243,     0,   310,     6,     0,
-       0,   130,   321,   322,     0,     0,    82,     0,     0,     0,
-     127,   395,   334,   332,     0,   201,   203,   202,     0,     0,
-     199,   200,   204,   206,   205,   220,   219,   222,   221,   223,
-     225,   226,   224,   214,   213,   208,   209,   207,   210,   211,
-     212,   227,     0,   179,   194,   193,   192,   191,   190,   189,
-     188,   187,   186,   185,   184,     0,   396,   335,   354,     0,
-     350,   331,   349,   353,   348,     0,     0,   390,   263,     0,
-       0,   263,   334,     0,   335,   273,     0,     0,     0,     0,
-       0,     0,   296,     0,   295,   146,   302,   143,   372,   323,
-       0,   242,   315,   364,    23,     0,     0,     0,     0,   172,
-     387,   277,   174,     0,     0,     0,     0,   138,    10,     0,
-       0,   386,   362,   362,     0,   131,    13,     0,     0,   382,
-       0,   380,   384,   383,   385,     0,   379,     0,     0,     0,
-       0,     0,    19,    16,     0,     0,   346,   134,   253,     0,
-       0,     0,     0,   265,    78,     0,     0,    81,    84,   148,
-     127,   129,     0,   117,     0,   128,   131,   131,   333,   230,
-       0,     0,   180,   260,   131,   131,     0,   131,   328,   347,
-       0,   342,   343,   282,   270,   299,   300,   312,     0,   298,
-       0,     0,     0,     0,   367,     0,   366,    96,     0,    25,
-      94,    54,     0,     0,   176,    86,     0,    86,    88,   142,
-      25,   109,   394,     0,   358,     0,     0,    12,   255,     0,
-     378,   102,   102,    38,     0,    65,    51,    21,    25,   107,
-      35,     0,     0,   321,   322,    22,     0,   267,    83,   148,
-       0,   156,     0,   247,   127,     0,   119,     0,     0,   229,
-     281,     0,     0,   355,     0,   325,     0,     0,     0,   272,
-     319,     0,   314,   297,   303,   144,   371,   370,     0,     0,
-       0,     0,   174,     0,     0,    89,     0,   111,   113,   361,
-     178,   254,     0,   102,     0,   102,     0,     0,     0,    29,
-     137,   266,   156,    85,   160,   161,   162,   165,   164,   163,
-       0,   155,    73,   147,     0,     0,   154,   158,     0,     0,
-       0,     0,     0,   120,     0,   256,   257,   181,   258,   259,
-     330,     0,   327,   351,   352,   274,     0,   301,   315,   313,
-       0,   365,    97,     0,    36,     0,    87,     0,     0,   115,
-       0,     0,    33,   381,     0,     0,     0,     0,     0,    98,
-       0,     0,    72,     0,   168,     0,    69,   159,     0,   150,
-      25,     0,    25,     0,   123,     0,   122,   331,   318,   317,
-     369,    95,     0,    25,    92,    53,    52,     0,     0,     0,
-       0,   114,     0,     0,   105,   106,    25,   100,    99,     0,
-     108,     0,     0,     0,   149,     0,     0,     0,     0,   251,
-       0,     0,   124,     0,   121,   329,     0,    25,    90,    37,
-       0,     0,    25,     0,     0,   101,    25,   104,     0,   171,
-     169,   166,     0,     0,    71,   252,     0,   248,   245,     0,
-     126,   316,     0,     0,     0,   116,    34,     0,   103,    25,
-       0,   127,   170,     0,   249,   125,     0,    93,     0,   110,
-       0,   167,     0,   250,    91,    25,    60,     0,   112,     0,
-      56,    59,    61,    25,   152,   151,     0,    62,     0,     0,
-     153,     0,     0,    25,     0,    63
-};
+#define YYTABLE_NINF (-339)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,     2,    79,    80,   201,   202,    81,   204,   350,
-     351,    83,   810,   811,   812,   340,   341,   352,   353,   219,
-      86,    87,    88,   366,    89,   368,   506,   507,   624,   557,
-     759,   725,   551,   294,   573,   634,   736,   580,   628,   689,
-     692,   729,   512,   513,   514,   360,   361,   172,   173,   154,
-     591,   653,   815,   654,   655,   656,   657,   705,   658,   163,
-     301,   302,    90,   113,   661,   750,    92,    93,   515,   145,
-     146,   534,   609,   167,   207,   279,    94,   445,   446,    95,
-     611,   453,   612,    96,    97,   448,    98,    99,   605,   672,
-     528,   100,   101,   102,   103,   104,   105,   106,   425,   421,
-     422,   423,   107,   318,   319,   288,   289,   192,   193,   485,
-     108,   315,   109
-};
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -531
 static const yytype_int16 yypact[] =
 {
-    -531,    61,  1856,  -531,  6294,  6294,  -121,  6294,  6294,  6294,
-    6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,
-    6294,   126,   126,  6294,  6294,   279,   -14,    27,    50,    76,
-    4782,  -531,  -531,     5,  -531,  4908,    83,  -531,  -531,  4628,
-    6294,    91,    92,  -531,   102,   108,  -531,  -531,   101,    82,
-     153,   155,  -531,  -531,   164,  -531,   166,  -531,  -531,   -29,
-    -531,   140,  5034,   360,   251,  -531,   167,  6294,   177,   178,
-     -22,  -531,   184,  -531,  6294,  -531,   408,   191,   410,   -74,
-    -531,    12,  -531,  -531,  -531,  -531,  -531,  -531,   147,   210,
-    -531,   323,  -531,   224,  -531,  -531,  6552,  -531,   -10,   825,
-     209,  -531,   234,   244,  -531,   -36,  -531,   115,  -531,  -531,
-    -531,   249,  -531,   323,  7475,  7475,  6294,  7475,  7475,  1688,
-    -531,  -531,   329,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,   252,   140,   -94,   246,  -531,  -531,   248,  -531,  -531,
-    -531,   255,   140,   256,   262,   250,  -531,   286,   280,    -6,
-     115,  -531,  -531,   396,    13,  5160,  -531,  6593,   416,  -531,
-    6634,   303,   290,    15,  7475,   126,  5286,  -531,  6294,  6294,
-    -531,   272,    16,  -531,   287,   289,  6294,   126,   276,   140,
-    -531,   -85,   -57,  -531,   304,  7475,   190,   126,  6420,   134,
-    -531,   -32,   373,  -531,  -531,  6294,  6679,  -531,   126,   140,
-       0,    18,  -531,  6294,  2010,  6720,   -37,   288,   450,  6294,
-     -37,   348,   320,  5412,   326,  -531,   366,   370,  -531,   -41,
-     278,  6294,  6294,  6294,  5538,  6294,  6294,  6294,  6294,  6294,
-    6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,
-    6294,  6294,  6294,  6294,  6294,  6294,   279,  -531,  -531,  -531,
-    5664,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,  6294,
-    6294,  6294,  5412,   328,   277,  6294,  6294,   191,   -30,   316,
-    6761,   140,   -35,   374,   375,   140,   256,   118,  5412,  -531,
-     118,   277,    -5,  1262,   342,  -531,   126,  7350,   339,   485,
-    -531,  1262,  -531,   484,    24,   362,  6294,  -531,   347,  -531,
-    6806,   359,   523,  7475,   463,   951,  6294,  -531,  -531,   101,
-    -531,  -531,   387,  6848,  -531,    25,   392,  -531,    29,  -531,
-     -55,  1548,  -531,  -531,  5412,  -531,  -531,   397,   487,  7100,
-    -531,  -531,    99,   415,  -531,  -531,  -531,  6889,  -531,  2164,
-      30,  -531,  -531,    88,   419,   -22,  -531,  6932,   395,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,  7141,  -531,  -531,   126,
-     405,   550,    36,    67,   546,   353,   443,   353,   412,   413,
-     302,   414,   424,    -5,   115,  7515,  7552,  1688,  6294,  7434,
-    1995,  1024,  1436,  2146,  2299,  2453,  2453,  2453,  2453,   823,
-    1001,  1001,  1001,   588,   588,   148,   148,   148,   329,   329,
-     329,  -531,   206,  1688,  1688,  1688,  1688,  1688,  1688,  1688,
-    1688,  1688,  1688,  1688,  1688,   411,   425,   426,  -531,  6294,
-    -531,   428,    -1,  -531,  7475,   423,  7184,  -531,    72,   414,
-     425,   256,  -531,   429,  -531,  -531,  1262,  1262,   433,   457,
-     140,    53,   132,   453,  -531,  -531,  -531,   574,  -531,  -531,
-    5790,  -531,  5916,  -531,  -531,  1262,   452,  3858,  6294,  7475,
-    -531,  -531,  6294,  6294,   126,   161,  7226,  -531,  -531,  4012,
-     126,  -531,   276,   276,   578,  5412,  -531,  1702,   440,  -531,
-    6294,  -531,  -531,  -531,  -531,   436,  -531,    -7,   515,   126,
-     449,   468,  -531,  -531,  4166,   460,  -531,  -531,  -531,  6042,
-    1262,   488,   140,   256,  -531,   353,   464,   607,  -531,  -531,
-     302,  -531,   470,   618,     4,  -531,  5412,  5412,    -5,  1842,
-    6294,   279,  -531,  -531,  5412,  5412,  7267,  5412,  -531,  6294,
-    6294,  -531,  -531,  -531,   497,  -531,  -531,  1262,   140,   172,
-     535,   504,  1262,   126,  7475,   126,  7391,  -531,   630,  -531,
-    -531,  -531,  6974,   492,  7475,   551,   126,   551,  -531,  -531,
-    -531,  -531,  -531,    37,  -531,  6294,   494,  -531,  -531,   867,
-    -531,   495,   501,  -531,   506,  -531,  -531,  -531,  -531,  -531,
-    -531,   508,   126,    38,   116,  -531,   140,   256,   607,  -531,
-     353,   301,   507,   518,   173,   517,   651,   513,   514,  1842,
-     250,   519,   520,  -531,   521,   537,   512,  7308,   277,  -531,
-     579,   522,   668,   180,  -531,  -531,  -531,  -531,  6168,  1262,
-    2318,   524,  6294,   161,   526,  -531,   527,  3704,   120,  -531,
-    1688,  -531,   530,  -531,   146,  -531,    14,   353,  2472,  -531,
-    -531,   256,   321,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-     547,  -531,  -531,  -531,   538,   573,   539,  -531,    19,   541,
-     536,   542,    34,   673,  1262,  -531,  -531,  -531,  -531,  -531,
-    -531,   277,  -531,  -531,  -531,  -531,  1262,  -531,  1262,  -531,
-     126,  7475,  -531,   540,  -531,   545,  -531,  4320,  4320,   156,
-     543,  4628,  -531,  -531,   154,  6294,    -4,   548,    33,  -531,
-     552,   549,  -531,   686,   687,    20,   323,  -531,   567,  -531,
-    -531,    69,  -531,   558,   692,  1262,  -531,   428,  -531,   610,
-    -531,  -531,  4474,  -531,  -531,  -531,  -531,   557,   683,   644,
-    6294,  -531,   559,  1223,  -531,  -531,  -531,  -531,  -531,   561,
-    -531,  1262,  1262,   565,  -531,   580,   701,  2626,   569,  -531,
-      39,  2780,   704,  1262,  -531,  -531,  1262,  -531,  -531,  -531,
-    2934,  6294,  -531,   566,  7015,  -531,  -531,  3704,   571,  -531,
-    -531,   711,   575,  1262,  -531,  -531,    71,  -531,  -531,  1262,
-    -531,  -531,  3088,   572,  7058,  3704,  -531,  4628,  3704,  -531,
-    1262,   302,  -531,   581,  -531,  -531,   576,  -531,   702,  -531,
-    3242,  -531,   582,  -531,  -531,  -531,   652,   200,  3704,   584,
-    -531,   652,  -531,  -531,  -531,  -531,   353,  -531,  3396,   586,
-    -531,   585,   589,  -531,  3550,  -531
+    -502,    49,  1233,  -502,   -60,  8100,  8100,  8100,  8100,  8100,
+      62,   -49,  8100,  8100,  7520,  -502,  -502,  8100,   -15,  -502,
+    7665,   713,   -14,  -502,  -502,  4833,  8100,  8100,    -5,    25,
+      88,  -502,   103,   117,   118,  -502,  -502,    96,    27,   146,
+     152,   713,  8100,  8100,  -502,  8100,  -502,   154,  -502,   155,
+    -502,  -502,   -27,   779,  -502,    29,  8100,  8100,  8100,  8100,
+    7810,    79,   166,   309,  8100,  -502,   168,  8100,   179,   183,
+    8100,   115,  -502,   189,  -502,  8100,  -502,     9,   197,   263,
+     -40,  -502,    10,  -502,  -502,  -502,  -502,  -502,  -502,   224,
+     225,  -502,   350,  -502,   249,  -502,  -502,  5339,  -502,    46,
+     732,   214,  -502,   268,   274,  -502,   109,  -502,   110,  -502,
+    -502,  -502,   284,  -502,  -502,   350,  -502,  -502,   310,  -502,
+    -502,  -502,  5593,  -502,  -502,  -502,  5368,  -502,   394,  -502,
+    5469,   289,    29,   -51,   286,  -502,  -502,   295,   281,   271,
+    -502,    17,  8553,   713,  8100,  7955,  -502,  -502,  8100,  8100,
+    -502,   519,    19,  -502,   269,   272,  8100,  -502,  8553,  8553,
+    -502,   713,   609,    29,  -502,   -64,   312,    29,   314,   308,
+     277,  -502,   315,   313,   105,   110,   -38,  -502,  8707,  8553,
+    8553,  -502,   283,  8553,   226,   713,  8240,   345,  -502,    18,
+     216,  -502,   426,    20,  -502,  -502,  8100,  5498,  -502,   713,
+    -502,    29,   -12,    21,  -502,  8100,  2351,  6585,    91,   280,
+     317,  8100,    91,   290,   304,  5733,   305,  -502,   370,   372,
+    -502,   -69,   181,  5078,  8100,  8100,  8100,  8100,  8100,  8100,
+    8100,  8100,  8100,  8100,  8100,  8100,  8100,   779,  8100,  8100,
+    8100,  8100,  8100,  8100,  8100,  8100,  8100,  8100,  8100,  -502,
+    -502,  -502,  5873,  8100,  8100,  8100,  8100,  8100,  8100,  8100,
+    8100,  8100,  8100,  8100,  5733,   215,   247,  8100,  8100,   197,
+      67,   293,   713,  8392,   301,   451,  -502,  8877,  -502,    29,
+     -50,   230,   248,   452,    15,   306,  8100,  -502,   303,  6614,
+    -502,  6715,   311,   456,  8553,   443,  8343,  8100,  -502,  -502,
+      96,  -502,  -502,   326,  6744,  -502,    26,   330,  -502,    28,
+    -502,   -32,  1767,  -502,  -502,    29,   314,   141,  5733,  -502,
+     141,   247,    54,  5733,  -502,  -502,   333,   464,  7134,  -502,
+    -502,   -17,   355,  -502,  -502,  -502,  8877,   344,  -502,  6845,
+    -502,  2497,    35,  -502,  -502,     4,   358,   115,  -502,  6874,
+     343,  -502,  -502,  -502,  -502,  -502,  -502,  -502,  7235,  -502,
+    -502,   713,   347,   492,    37,   748,   496,   142,   414,   142,
+     352,   351,   190,   354,   356,    54,   110,  8100,  8423,  8869,
+    8920,  8929,   988,   534,    40,    40,    40,   310,   310,   310,
+    8830,  8776,  -502,  8989,   534,  8989,  8989,  8989,   534,  8707,
+    8580,  8681,   572,   572,   774,  8707,  8707,  8707,  8707,  8707,
+    8707,  8707,  8707,  8707,  8707,  8707,  8707,   357,   359,   361,
+    -502,  8100,  -502,   362,    66,  -502,  8553,   349,  7264,  -502,
+    -502,  6013,  -502,  6153,  -502,  8877,  8877,   363,   393,    29,
+      60,   -77,   398,  -502,  -502,  -502,   -46,   354,   359,  8877,
+     385,  4103,  8100,  8553,  -502,  -502,  -502,  8100,  8100,   713,
+     101,  7295,  -502,  -502,  4249,   713,  -502,   609,   609,   516,
+    5733,  -502,  1913,   314,  -502,   371,  -502,  -502,   375,  -502,
+    8100,  -502,  -502,  -502,  -502,   367,  -502,  -502,   524,    52,
+     497,   713,   379,   404,  -502,  -502,  4395,   386,  -502,  -502,
+    -502,  6293,  8877,   428,    29,   314,  -502,   142,   392,   551,
+    -502,  -502,   190,  -502,   403,   553,    57,  -502,  5733,  5733,
+      54,  8731,  8100,   779,  -502,  -502,  5733,  5733,  7396,  5733,
+    -502,  8100,  8100,  -502,  -502,   713,  8553,   713,  8524,  -502,
+    -502,  8877,    29,   -75,   493,   424,  -502,   556,  -502,  -502,
+    -502,  6975,   416,  8553,   515,   713,   515,  -502,  -502,  -502,
+    -502,  -502,    39,  -502,  8100,   419,  -502,  -502,   459,  -502,
+    4985,  -502,  8877,   421,   422,  -502,   427,  -502,  -502,  -502,
+    -502,  -502,  -502,   430,   713,    42,  5176,  -502,    29,   314,
+     551,  -502,   142,    61,   425,   437,   258,   436,   588,   441,
+     444,  8731,   277,   449,   454,  -502,   457,   481,   446,  7425,
+    -502,  -502,  6433,   549,   460,   608,   276,  -502,  8877,  2643,
+     461,  8100,   101,   468,  -502,   470,  2059,   162,  -502,  8707,
+    -502,   247,  -502,   463,  -502,  -502,   199,  -502,    11,   142,
+    2789,  -502,  -502,   314,    75,  -502,   475,  -502,   499,  -502,
+    -502,  -502,  -502,  -502,  -502,  -502,  -502,   488,   557,   328,
+    -502,    22,   487,   490,   494,    63,   635,  8877,  -502,  -502,
+    -502,  -502,  -502,  -502,   247,  -502,  -502,  -502,   713,  8553,
+    8877,  -502,  8877,  -502,  -502,   489,  -502,   502,  -502,  4541,
+    4541,   205,  4833,   495,  -502,  -502,  -502,   240,  8100,    13,
+     504,    87,  -502,   510,   512,  -502,  -502,   645,   662,    24,
+     350,  -502,   536,  -502,  -502,    65,  -502,   522,   666,  8877,
+    -502,   362,  -502,  -502,   616,  -502,  4687,  -502,  -502,  -502,
+    -502,   667,   521,   611,  -502,  8100,   525,  5238,  -502,  -502,
+    -502,  -502,  -502,   523,  -502,  8877,  8877,   537,  -502,   546,
+     679,  2935,   539,  -502,    43,  3081,   690,  8877,  -502,  -502,
+    8877,  -502,  -502,  -502,  3227,  -502,  8100,   542,  7004,  -502,
+    -502,  1474,   547,  -502,  -502,   693,   550,  8877,  -502,  -502,
+      68,  -502,  -502,  8877,  -502,  -502,  3373,   545,  3519,  7105,
+    -502,  4833,  1621,  -502,  8877,   190,  -502,   558,  -502,  -502,
+     552,  -502,   696,  -502,  3665,  -502,   554,  -502,  -502,  -502,
+     673,   136,  2205,   560,  -502,   673,  -502,  -502,  -502,  -502,
+     142,  -502,  3811,   568,  -502,   562,   566,  -502,  3957,  -502
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       4,     0,     0,     1,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    75,   291,     0,     0,   287,
+       0,     0,     0,   290,   286,     0,     0,     0,     0,     0,
+     277,   289,     0,     0,     0,   293,   248,     0,     0,     0,
+       0,     0,     0,     0,    50,     0,    80,     0,   288,     0,
+     285,   292,     0,     0,   294,     0,     0,     0,     0,     0,
+       0,     0,   263,     5,     0,   306,     0,     0,     0,     0,
+       0,     0,   347,     0,    25,     0,    56,   280,   358,     0,
+     308,     3,     0,     7,    30,     8,     9,    68,    69,     0,
+       0,   323,    70,   340,     0,   311,   243,     0,   322,     0,
+     324,     0,   343,     0,   328,   339,   341,   346,     0,   233,
+     307,    32,     0,   263,     5,    70,   217,   218,   219,   220,
+     242,    76,   365,   237,   239,    40,     0,   185,     0,    42,
+       0,     0,     0,   264,     0,   200,   326,     0,     0,     0,
+     235,     0,   175,     0,     0,     0,   241,    77,   176,     0,
+     141,     0,     0,   140,     0,     0,     0,   198,   390,   391,
+     234,     0,   364,     0,     4,     0,     0,     0,   264,   270,
+     283,   271,     0,   273,   341,     0,   310,   238,   246,   393,
+     394,    44,   323,     0,   324,     0,     0,     0,   296,   379,
+       0,   377,   146,     0,    31,   236,     0,     0,    25,     0,
+     240,     0,    18,     0,    17,     0,     0,     0,   281,     0,
+     282,     0,     0,     0,     0,   132,     0,    15,    78,    81,
+      71,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    51,
+     199,   197,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   132,     0,     0,   349,     0,   359,
+     342,     0,     0,   370,     0,   316,    41,     0,    43,     0,
+     266,     0,     0,     0,     0,     0,     0,    49,     0,     0,
+     278,     0,     0,   177,   179,   323,   324,     0,   142,   324,
+       0,    47,    59,     0,     0,   395,     0,     0,   362,     0,
+     361,   309,     0,     4,    11,     0,   266,     0,   132,   184,
+       0,     0,   342,   132,    45,    46,     0,   306,     0,   295,
+     378,     0,     0,   376,   313,   375,     0,     0,    48,     0,
+      58,     0,     0,    65,    67,    20,     0,     0,    14,     0,
+       0,    33,    24,    26,    27,    28,   230,   245,     0,   312,
+       6,     0,     0,   131,   323,   324,     0,     0,    83,     0,
+       0,     0,   128,   397,   336,   334,     0,     0,     0,   206,
+     208,   207,   225,   227,   210,   211,   209,   212,   213,   214,
+     202,   201,   229,   223,   228,   221,   224,   222,   226,   204,
+     203,   205,   215,   216,     0,   181,   192,   190,   189,   187,
+     191,   188,   193,   186,   195,   196,   194,     0,   398,   337,
+     356,     0,   352,   333,   351,   355,   350,     0,     0,   374,
+     325,     0,   244,   317,   366,     0,     0,     0,     0,     0,
+       0,   298,     0,   297,    23,   304,   265,     0,     0,     0,
+       0,     0,     0,   174,   389,   392,   279,   176,     0,     0,
+       0,     0,   139,    10,     0,     0,   388,   364,   364,     0,
+     132,    13,     0,   265,   336,     0,   337,   275,     0,   384,
+       0,   382,   386,   385,   387,     0,   381,   147,   144,     0,
+       0,     0,     0,     0,    19,    16,     0,     0,   348,   135,
+     255,     0,     0,     0,     0,   267,    79,     0,     0,    82,
+      85,   149,   128,   130,     0,   118,     0,   129,   132,   132,
+     335,   232,     0,     0,   182,   262,   132,   132,     0,   132,
+     330,   349,     0,   344,   345,     0,   369,     0,   368,   301,
+     302,   314,     0,   300,     0,     0,    97,     0,    25,    95,
+      55,     0,     0,   178,    87,     0,    87,    89,   143,    25,
+     110,   396,     0,   360,     0,     0,    12,   284,   272,   257,
+       0,   380,     0,   103,   103,    39,     0,    66,    52,    21,
+      25,   108,    36,     0,     0,   323,   324,    22,     0,   269,
+      84,   149,     0,     0,     0,   249,   128,     0,   120,     0,
+       0,   231,   283,     0,     0,   357,     0,   327,     0,     0,
+     373,   372,     0,   321,     0,   316,   299,   305,     0,     0,
+       0,   176,     0,     0,    90,     0,     0,   114,   363,   180,
+     256,     0,   274,     0,   145,   103,     0,   103,     0,     0,
+       0,    29,   138,   268,     0,    86,     0,   166,     0,   167,
+     164,   163,   162,   165,   157,    74,   148,     0,     0,   156,
+     160,     0,     0,     0,     0,     0,   121,     0,   258,   259,
+     183,   260,   261,   332,     0,   329,   353,   354,     0,   367,
+       0,   303,   317,   315,    98,     0,    37,     0,    88,     0,
+       0,   116,     0,     0,    34,   276,   383,     0,     0,     0,
+       0,     0,    99,     0,     0,    73,   153,     0,   170,     0,
+      70,   161,     0,   151,    25,     0,    25,     0,   124,     0,
+     123,   333,   371,   320,   319,    96,     0,    25,    93,    54,
+      53,     0,     0,     0,   115,     0,     0,     0,   106,   107,
+      25,   101,   100,     0,   109,     0,     0,     0,   150,     0,
+       0,     0,     0,   253,     0,     0,   125,     0,   122,   331,
+       0,    25,    91,    38,     0,    25,     0,     0,     0,   102,
+      25,     0,     0,   173,   171,   168,     0,     0,    72,   254,
+       0,   250,   247,     0,   127,   318,     0,     0,     0,     0,
+      35,     0,     0,    25,     0,   128,   172,     0,   251,   126,
+       0,    94,     0,   111,     0,   169,     0,   252,    92,    25,
+      61,     0,     0,     0,    57,    60,    62,    25,   154,   152,
+       0,    63,     0,     0,   155,     0,     0,    25,     0,    64
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -531,  -531,  -162,   -20,  -531,  -531,   385,  -531,  -184,  -531,
-       1,  -531,  -531,  -531,   -71,  -531,   253,     9,    10,  -105,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,   236,   186,   121,
-    -531,    58,  -531,  -531,  -531,  -530,    21,  -531,  -531,  -531,
-    -531,  -531,  -493,  -531,   157,  -161,  -531,  -531,   438,  -531,
-     163,  -531,  -531,  -531,  -531,  -531,    94,  -531,  -531,  -531,
-    -452,  -531,    17,    -2,  -531,  -531,  -531,   337,  -351,  -239,
-    -531,  -531,  -531,  -531,  -531,   160,   746,   786,  -531,  -531,
-    -531,   143,  -531,   919,   590,  -344,   219,   125,  -531,  -531,
-      40,  -211,  -531,   829,  -531,   -21,    11,  -531,   227,  -275,
-    -531,  -531,    47,   291,   293,  -531,  -531,    77,   361,  -531,
-    -531,  -531,  -531
+    -502,  -502,  -114,   -20,  -502,  -502,   369,  -502,  -117,  -502,
+       1,  -502,  -502,  -502,   -97,  -502,   228,     6,     8,  -110,
+    -502,  -502,  -502,  -502,  -502,  -502,  -502,   217,   165,   100,
+    -502,    33,  -502,  -502,  -502,  -484,    -9,  -502,  -502,  -502,
+    -502,  -502,  -501,  -502,   135,  -227,  -502,  -502,   432,  -502,
+     147,  -502,  -502,  -502,  -502,  -502,    74,  -502,  -502,  -502,
+    -450,  -502,    89,    -2,  -502,  -502,  -502,   368,  -352,  -233,
+    -502,  -502,  -502,  -502,  -502,   137,   373,   299,  -502,  -502,
+    -502,   128,  -502,   950,   594,  -349,    73,     7,  -502,  -502,
+      38,  -213,  -502,   221,  -502,   -47,    56,  -502,   219,  -319,
+    -502,  -502,   -37,   279,   292,  -502,  -502,    80,   353,  -502,
+    -502,  -502,  -502
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    80,    81,   203,   204,    82,   206,   352,
+     353,    84,   814,   815,   816,   342,   343,   354,   355,   221,
+      87,    88,    89,   368,    90,   370,   508,   509,   623,   556,
+     763,   729,   550,   284,   575,   636,   740,   582,   627,   691,
+     694,   733,   514,   515,   516,   362,   363,   152,   153,   193,
+     593,   656,   819,   657,   658,   659,   660,   709,   661,   141,
+     292,   293,    91,   115,   664,   754,    93,    94,   517,   170,
+     171,   568,   632,   146,   209,   319,    95,   444,   445,    96,
+     614,   434,   615,    97,    98,   429,    99,   100,   607,   675,
+     530,   101,   102,   103,   104,   105,   106,   107,   427,   423,
+     424,   425,   108,   309,   310,   274,   275,   190,   191,   485,
+     109,   306,   110
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -337
 static const yytype_int16 yytable[] =
 {
-      91,   133,   133,    82,   148,   143,   435,   401,   269,   372,
-     553,    84,    85,   339,   504,   497,   508,   592,   321,   571,
-     214,   284,   734,   296,   309,   265,   345,   708,   743,   332,
-     116,   265,   456,   470,   212,   595,   149,   473,   489,   181,
-     162,   182,   636,   212,  -132,   473,  -135,   776,   248,   249,
-     200,   187,   417,   420,   212,   265,   265,   213,   188,  -262,
-     529,     3,   372,   417,   322,   713,   432,   151,   323,   434,
-     420,   212,   150,   212,   344,  -133,  -264,   213,  -263,   184,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   695,   212,   324,   369,   475,  -336,   333,   179,
-     748,   415,   793,   694,   696,   698,   199,   112,   152,   191,
-     370,   695,   272,   266,   112,  -332,   324,   433,   268,   266,
-     180,  -333,   276,   696,  -136,  -324,  -324,  -336,   212,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   158,   572,   266,   266,   133,   136,   136,   530,   735,
-     596,   133,   540,   208,   508,   211,   190,   133,   133,   320,
-     477,   282,   491,   478,   699,   215,   285,   133,   297,   310,
-     685,   346,   709,   744,  -324,  -324,   457,   471,   133,   343,
-     714,   474,   490,   738,   690,   691,   304,   186,  -132,   629,
-    -135,   777,   556,   243,   244,   245,   153,   246,   110,   616,
-     212,   617,    91,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   749,   212,   794,   174,  -133,
-     727,   728,   187,   475,   695,   148,   143,   155,   482,   188,
-     362,   373,   695,   110,   161,   483,   696,   330,   640,   643,
-     135,   138,   165,   166,   696,   484,   511,   170,  -324,  -324,
-     697,   428,   131,   168,   132,   431,   171,   149,   732,   169,
-     212,    71,   112,   442,    71,  -262,   133,   374,  -136,   521,
-     267,   442,    71,    77,   373,   373,   112,   194,   110,   362,
-     191,    77,   600,   216,   373,   373,   700,   131,   373,   132,
-     298,   373,   373,   150,   305,   362,   308,   112,   802,   501,
-     212,   502,   314,   317,   175,  -264,   176,    71,   212,   112,
-     374,   374,   327,  -263,   566,   177,    77,   178,   195,    91,
-     374,   374,    82,   342,   374,   200,   197,   374,   374,   198,
-      84,    85,   131,   675,   132,   203,   720,    91,   363,   133,
-     209,   362,   112,   326,   110,   503,   217,   503,   110,   813,
-     503,   110,    71,   814,   218,   597,   598,   220,   134,   134,
-     262,    77,   144,   601,   602,   620,   604,   263,   644,   645,
-     646,   647,   648,   649,   264,   511,   627,   179,   246,   273,
-     271,   274,   133,   275,   212,   518,   650,   363,   644,   645,
-     646,   647,   648,   649,   638,   277,   717,   420,   131,   316,
-     132,   278,   131,   363,   132,   141,   650,   142,   112,   283,
-     281,   449,   112,   418,   371,   112,   442,   442,    71,   280,
-     539,   306,    71,    71,    71,    71,   419,    77,   501,   291,
-     502,    77,    77,    77,    77,   442,   187,   295,   112,   293,
-     311,   312,   355,   188,   133,   133,   651,   334,   187,   363,
-     133,   652,   133,   133,  -118,   188,   358,   325,   550,   189,
-     420,   187,   364,   190,   416,   819,   651,   370,   188,   133,
-     561,   702,   334,   365,    71,    91,   335,   367,    82,   501,
-     442,   502,   587,    77,   449,   503,    84,    85,   447,   112,
-     503,   451,   362,   452,   191,   579,   187,   455,   187,   460,
-     148,   143,   134,   188,   357,   188,   191,   206,   134,   210,
-     429,   430,   462,   458,   134,   134,   583,   442,   613,   191,
-      71,    71,   442,   133,   134,   133,   747,   522,   751,    77,
-      77,   463,   149,   362,   362,   134,   133,   464,   187,   760,
-     468,   362,   362,   472,   362,   188,   495,   479,   480,   334,
-     331,   486,   767,   336,   191,   492,   191,   498,   499,   500,
-     505,   509,   133,   523,   510,   516,   641,   331,   150,   336,
-     503,   331,   336,   782,   503,   517,   524,   525,   785,   527,
-     531,   533,   788,   144,   537,   538,   541,   542,   548,   555,
-     558,   565,   568,   570,   574,   562,   191,   317,   317,   442,
-     363,   745,   576,   133,   577,   800,   644,   645,   646,   647,
-     648,   649,   581,   589,   342,   590,   586,   503,    91,   373,
-     443,   808,   593,   134,   584,    91,   594,   608,   443,   818,
-     240,   241,   242,   243,   244,   245,    91,   246,   330,   824,
-     614,   363,   363,   619,   442,   622,   631,   623,   633,   363,
-     363,  -157,   363,   706,   635,   374,   442,   637,   442,   659,
-     133,   639,   660,   663,   664,   665,   666,   671,   449,   673,
-     449,   668,   669,   670,   677,   676,   678,   684,   687,   688,
-     693,   625,   373,   703,   704,    47,   715,   711,   724,   724,
-     710,   712,   731,   721,   730,   442,   134,   722,   739,   741,
-     742,   737,   740,   746,   752,   753,   756,   449,   761,   762,
-     763,   771,   765,   768,   773,   775,   772,   779,   374,   786,
-     789,   442,   442,   758,   790,   797,   791,   803,   805,   804,
-     493,   809,   821,   442,   807,   816,   442,   822,   823,   134,
-     817,   588,   575,   626,   686,    91,   726,   467,   558,    91,
-     707,   662,   642,   442,   766,   679,   606,   755,    91,   442,
-     667,   307,     0,   563,     0,    91,   564,     0,     0,     0,
-     442,   503,     0,   443,   443,     0,     0,     0,     0,     0,
-      91,     0,     0,    91,     0,     0,    91,     0,   799,     0,
-       0,     0,   443,     0,     0,     0,   503,     0,    91,     0,
-       0,   134,   134,     0,     0,   449,    91,   134,     0,   134,
-     134,     0,     0,     0,     0,     0,    91,     0,     0,     0,
-       0,     0,    91,     0,     0,     0,   134,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   443,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     137,   137,     0,     0,   147,     0,     0,     0,   144,  -337,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,     0,   443,     0,   221,   222,   223,   443,
-     134,     0,   134,  -324,  -324,     0,     0,     0,     0,     0,
-       0,     0,   224,   134,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,     0,     0,   134,
-       0,     0,     0,   114,   115,     0,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-       0,     0,   139,   140,     0,     0,     0,     0,     0,   157,
-       0,     0,     0,     0,   160,     0,   443,     0,     0,   164,
-     134,     0,     0,     0,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,     0,     0,     0,     0,
-       0,   185,     0,     0,     0,     0,   196,     0,     0,     0,
-       0,     0,     0,   205,   137,     0,     0,     0,     0,     0,
-     137,   443,     0,     0,     0,     0,   137,   137,     0,  -324,
-    -324,     0,     0,   443,     0,   443,   137,   134,     0,     0,
-       0,     0,     0,     0,   632,   465,     0,   137,     0,   444,
-       0,     0,     0,     0,     0,   270,     0,   444,  -337,  -337,
-    -337,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,   443,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   287,   147,     0,   454,   443,   443,
-       0,     0,     0,     0,     0,   300,     0,   303,   185,     0,
-     443,     0,     0,   443,     0,   313,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   329,     0,     0,
-     443,     0,     0,     0,   337,   137,   443,     0,     0,     0,
-       0,     0,   347,     0,     0,     0,     0,   443,   356,     0,
-       0,     0,   185,     0,     0,     0,     0,     0,     0,     0,
-     375,   376,   377,   379,   380,   381,   382,   383,   384,   385,
-     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,     0,     0,     0,     0,   403,
-     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
-     414,   185,   444,   444,   424,   426,     0,     0,   137,     0,
-       0,     0,     0,     0,     0,     0,     0,   185,     0,     0,
-       0,   444,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   459,     0,     0,     0,     0,
-       0,     0,   535,   536,     0,   466,     0,     0,     0,     0,
-       0,   137,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,   547,     0,   185,     0,     0,   444,     0,   224,   734,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   444,     0,     0,   585,     0,   444,     0,
-       0,     0,     0,   137,   137,     0,     0,   519,     0,   137,
-       0,   137,   137,     0,   436,   437,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   137,     0,
-       0,     0,     0,   610,     0,     0,     0,     0,   615,     0,
-       0,     0,     0,     0,   110,   438,     0,     0,   526,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-     147,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   444,     0,     0,     0,   544,
-      43,   546,   137,    46,   137,     0,   735,   552,     0,     0,
-       0,   303,   554,     0,    55,   137,    57,    58,   439,    60,
-     440,     0,     0,     0,   185,     0,     0,   441,   112,   569,
-       0,     0,     0,     0,     0,   682,     0,     0,     0,     0,
-     444,   137,     0,     0,     0,     0,     0,     0,   185,     0,
-       0,     0,   444,     0,   444,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   185,   185,     0,     0,   599,
-       0,     0,     0,   185,   185,     0,   185,     0,   424,   607,
-     716,     0,   137,     0,     0,     0,     0,     0,     0,     0,
-       0,   444,   718,     0,   719,     0,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   630,   246,     0,   444,   444,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   444,
-       0,   754,   444,     0,     0,     0,     0,     0,     0,   137,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   444,
-       0,     0,     0,     0,     0,   444,     0,   769,   770,     0,
-       0,     0,     0,     0,     0,     0,   444,   681,     0,   780,
-       0,   303,   781,     0,     0,     0,     0,     0,     0,     0,
-       0,     4,     5,     6,     7,     8,     0,     0,     0,   792,
-       9,     0,     0,     0,     0,   795,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   801,     0,     0,     0,
+      92,   133,   477,    83,   392,   271,   173,   552,    85,   374,
+      86,   594,   499,   216,   346,   506,   175,   510,   450,   738,
+     286,   133,   300,   337,   347,   712,   139,   747,   136,   465,
+     493,   468,   165,   168,   214,   176,   214,   417,   491,   331,
+    -133,  -264,   468,  -266,   698,  -136,   780,   214,   136,     3,
+     312,   202,   419,   422,   185,   232,   233,   234,   573,   699,
+     214,   214,   646,   186,   371,   214,   597,   184,   374,   419,
+     208,   214,   717,   214,   752,   267,   646,   797,  -264,   214,
+    -266,   341,   372,   647,   163,   313,  -265,   531,   267,   314,
+     638,   475,   250,   111,   135,   482,   478,   647,   121,   214,
+     215,   323,   122,   648,   474,   470,   114,   476,   422,   174,
+     555,   215,   280,   323,   157,   214,   483,   648,   128,   470,
+     698,   544,   164,   133,   185,   188,   267,   237,   484,   251,
+     267,   133,   332,   186,   649,   699,   185,   138,  -158,   147,
+     187,   133,   133,   311,   188,   186,   143,   316,   649,   182,
+     288,   697,  -158,   701,   189,   510,   296,   210,   299,   213,
+     154,   702,   114,   217,   270,   133,   739,   451,   305,   308,
+     287,   687,   301,   338,   348,   713,   144,   748,   466,   133,
+     469,   345,   650,   651,   652,   376,   610,   492,   611,  -133,
+     173,   628,   326,   653,  -136,   781,   650,   651,   652,   472,
+     175,   574,   598,   268,    92,   654,   344,   653,   718,   131,
+     753,   655,   132,   798,   513,   532,   268,   168,  -335,   654,
+     692,   693,   365,  -338,   189,   705,   201,  -338,   376,   376,
+     252,   322,   698,   113,   114,   642,   189,   742,   295,   145,
+     645,   150,   137,   565,   376,   376,    72,   699,   114,   253,
+     503,   151,   133,   504,   268,    72,    78,   441,   268,   446,
+    -334,   185,   137,   731,   732,   269,   700,   254,   148,   149,
+     186,   365,  -326,   698,   172,   114,   255,   333,   375,   430,
+     376,   334,   513,   376,   376,   817,    72,   703,   699,   818,
+     602,   599,   600,   174,   806,   473,    78,   155,   503,   603,
+     604,   504,   606,   156,   364,   161,   162,   736,   185,  -326,
+      92,   192,   695,    83,   373,   194,   441,   186,    85,   196,
+      86,   375,   375,   114,   212,   365,    72,   202,   198,   722,
+     365,   256,   257,   258,   199,   185,    78,   375,   375,    92,
+     205,   133,  -119,   259,   186,   260,   211,   505,   418,   505,
+     647,   333,   505,   364,   261,   721,   262,   218,   219,   220,
+      72,   189,   185,   447,   137,   264,   503,   222,   430,   504,
+      78,   186,   137,   375,   263,    72,   375,   375,   333,   325,
+     420,   448,   137,   137,   133,    78,   265,   214,   266,   134,
+     185,   114,    72,    72,  -265,   163,   421,   237,   277,   186,
+     279,   649,    78,    78,   281,  -159,   137,   364,   189,   134,
+     329,   524,   364,   282,   283,   441,   441,   285,   422,   543,
+     137,   169,   302,   315,   303,   214,   317,   321,   318,   441,
+     336,   619,   520,   320,   357,   189,   324,   360,   366,   133,
+     133,   367,   626,   369,   372,   133,   359,   133,   133,   650,
+     651,   652,   549,   432,   433,   454,   449,   452,   172,   458,
+     653,   422,   189,   640,   457,   560,   554,   557,   823,   459,
+      92,   133,   561,    83,   308,   308,   173,   365,    85,   463,
+      86,   467,   441,   479,   589,   480,   175,   505,   486,   488,
+     189,   494,   505,   137,   497,   501,   507,   581,   344,   500,
+     502,   511,   512,   168,   542,   518,   533,   519,   586,   525,
+     526,   134,   527,   529,   541,   133,   545,   133,   547,   134,
+     564,   441,   616,   567,   571,   365,   365,   569,   572,   134,
+     134,   576,   578,   365,   365,   133,   365,   579,   583,   588,
+     330,   591,   430,   335,   430,  -339,   229,   230,   231,   232,
+     233,   234,   441,   134,   592,   595,   596,   617,   329,   364,
+     618,   330,   624,   335,   133,   330,   335,   134,   643,   621,
+     622,   630,   505,   631,   635,   637,   505,   662,   639,   174,
+     663,   666,   137,   641,   229,   230,   231,   232,   233,   234,
+     585,   430,   667,   668,   376,   674,   669,   751,   441,   755,
+     749,   671,   133,   676,   680,   169,   672,   364,   364,   673,
+     764,   682,   681,   696,   686,   364,   364,    92,   364,   505,
+     689,   237,   690,   771,    92,   137,  -339,   131,   706,   557,
+     132,  -339,   707,   708,    36,   487,   714,   376,    92,   719,
+     134,   715,   725,   716,   786,   442,   735,   441,   788,   745,
+     443,   113,   114,   792,   726,   743,   710,   741,   133,   237,
+     441,   247,   441,   248,    72,   744,   746,   756,   297,   750,
+     757,   760,   766,   765,    78,   772,   804,   767,   769,   776,
+     137,   137,   775,   777,   779,   430,   137,   375,   137,   137,
+     728,   728,   812,   734,   783,   790,   793,   794,   801,   441,
+     822,   795,   809,   807,   442,   808,   811,   813,   307,   443,
+     828,   820,   137,   825,   826,   827,   495,   131,   821,   577,
+     132,   625,   688,   730,   590,   441,   441,   762,   770,   134,
+     375,   665,   462,   711,   539,   540,   252,   441,   644,   670,
+     441,   113,   114,   683,   172,   298,   562,     0,   546,    92,
+     608,  -134,   252,    92,    72,   253,   137,   441,   137,   759,
+     563,     0,    92,   441,    78,     0,     0,     0,     0,    92,
+       0,   253,   134,   254,   441,   505,   137,     0,  -326,     0,
+       0,     0,   255,     0,    92,     0,    92,     0,     0,   254,
+      92,     0,   803,     0,  -326,     0,     0,     0,   255,     0,
+     505,   587,    92,   442,   442,   137,     0,     0,   443,   443,
+      92,     0,     0,     0,     0,  -326,     0,   442,     0,     0,
+      92,   131,   443,     0,   132,     0,    92,   134,   134,     0,
+       0,  -326,     0,   134,     0,   134,   134,   256,   257,   258,
+     613,     0,     0,   137,     0,   113,   114,     0,     0,   259,
+       0,   260,     0,   256,   257,   258,     0,     0,    72,   134,
+     261,     0,   262,     0,     0,   259,     0,   260,    78,     0,
+     442,   634,     0,     0,     0,   443,   261,     0,   262,     0,
+     263,     0,   131,   523,     0,   132,     0,   166,     0,     0,
+     167,   169,     0,     0,     0,     0,   263,     0,     0,   137,
+    -134,     0,     0,   134,     0,   134,   113,   114,     0,   442,
+       0,   113,   114,     0,   443,     0,     0,   684,     0,    72,
+       0,     0,     0,   134,    72,     0,     0,     0,     0,    78,
+       0,     0,     0,     0,    78,     0,     0,     0,     0,     0,
+     442,     0,     0,     0,     0,   443,     0,     0,     0,     0,
+       0,     0,   134,     0,     0,   116,   117,   118,   119,   120,
+       0,     0,   123,   124,   126,     0,   720,   127,     0,     0,
+     130,     0,     0,     0,     0,     0,   140,   142,     0,   723,
+       0,   724,     0,     0,     0,     0,   442,     0,     0,     0,
+     134,   443,   158,   159,     0,   160,     0,     0,  -339,   228,
+     229,   230,   231,   232,   233,   234,   177,   178,   179,   180,
+     183,     0,     0,     0,   195,     0,     0,   197,   758,     0,
+     200,     0,     0,     0,     0,   207,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   442,     0,     0,     0,     0,
+     443,     0,     0,     0,   773,   774,   134,     0,   442,     0,
+     442,     0,     0,   443,     0,   443,   784,     0,     0,   785,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,   733,     0,     0,     0,    26,    27,
-      28,    29,     0,     0,    30,     0,     0,     0,     0,    31,
-      32,     0,     0,    33,    34,    35,     0,    36,     0,    37,
-      38,    39,     0,     0,     0,    40,    41,     0,     0,   764,
-       0,     0,     0,     0,    42,     0,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,     0,    52,     0,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,     0,     0,     0,
-     784,     0,    62,    63,    64,    65,    66,    67,     0,     0,
-      68,    69,    70,     0,    71,    72,     0,    73,   476,    74,
-       0,    75,    76,    77,    78,     4,     5,     6,     7,     8,
-       0,     0,     0,   224,     9,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,    26,    27,    28,    29,     0,     0,    30,     0,
-       0,     0,     0,    31,    32,     0,     0,    33,    34,    35,
-       0,    36,     0,    37,    38,    39,     0,     0,     0,    40,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,     0,
-      52,     0,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,     0,     0,     0,     0,     0,    62,    63,    64,    65,
-      66,    67,     0,     0,    68,    69,    70,     0,    71,    72,
-       0,    73,   567,    74,     0,    75,    76,    77,    78,     4,
-       5,     6,     7,     8,     0,     0,     0,     0,     9,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,    26,    27,    28,    29,
-       0,     0,    30,     0,     0,     0,     0,    31,    32,     0,
-       0,    33,    34,    35,     0,    36,     0,    37,    38,    39,
-       0,     0,     0,    40,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,     0,    52,     0,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,     0,     0,     0,     0,     0,
-      62,    63,    64,    65,    66,    67,     0,     0,    68,    69,
-      70,     0,    71,    72,     0,    73,     0,    74,     0,    75,
-      76,    77,    78,     4,     5,     6,     7,     8,     0,     0,
-       0,     0,     9,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-      26,    27,    28,    29,     0,     0,    30,     0,     0,     0,
-       0,    31,    32,     0,     0,     0,    34,    35,     0,    36,
-       0,    37,    38,    39,     0,     0,     0,    40,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,    44,
-      45,    46,    47,    48,    49,   348,    51,     0,    52,     0,
-      53,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,    62,    63,    64,    65,    66,    67,
-       0,     0,    68,    69,     0,     0,    71,    72,     0,    73,
-     349,    74,     0,    75,    76,    77,    78,     4,     5,     6,
-       7,     8,     0,     0,     0,     0,     9,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,    26,    27,    28,    29,     0,     0,
-      30,     0,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,     0,    53,    54,    55,    56,    57,    58,
-     111,    60,    61,     0,     0,     0,     0,     0,    62,    63,
-      64,    65,    66,    67,     0,     0,    68,    69,     0,     0,
-      71,    72,     0,    73,   488,    74,     0,    75,    76,    77,
-      78,     4,     5,     6,     7,     8,     0,     0,     0,     0,
-       9,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     0,
+       0,     0,   273,     0,     0,   237,   796,     0,     0,     0,
+     239,     0,   799,     0,     0,   243,     0,   442,     0,     0,
+       0,     0,   443,   805,   289,   291,     0,     0,   294,   183,
+       0,     0,     0,     0,     0,     0,   304,     0,     0,     0,
+       0,     0,     0,   442,   442,   247,     0,   248,   443,   443,
+       0,     0,     0,     0,     0,   442,     0,     0,   442,     0,
+     443,     0,     0,   443,     0,     0,   328,     0,     0,     0,
+       0,     0,     0,     0,     0,   442,   339,     0,     0,     0,
+     443,   442,     0,     0,     0,   349,   443,     0,     0,     0,
+       0,   358,   442,     0,     0,   183,     0,   443,     0,     0,
+       0,     0,     0,   378,   379,   380,   381,   382,   383,   384,
+     385,   386,   387,   388,   389,   390,   391,     0,   393,   394,
+     395,   396,   397,   398,   399,   400,   401,   402,   403,     0,
+       0,     0,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   183,     0,     0,   426,   428,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,    26,    27,
-      28,    29,     0,     0,    30,     0,     0,     0,     0,    31,
-      32,     0,     0,     0,    34,    35,     0,    36,     0,    37,
-      38,    39,     0,     0,     0,    40,    41,     0,   683,     0,
-       0,     0,     0,     0,    42,     0,    43,    44,    45,    46,
-      47,    48,    49,   348,    51,     0,    52,     0,    53,    54,
-      55,    56,    57,    58,   111,    60,    61,     0,     0,     0,
-       0,     0,    62,    63,    64,    65,    66,    67,     0,     0,
-      68,    69,     0,     0,    71,    72,     0,    73,     0,    74,
-       0,    75,    76,    77,    78,     4,     5,     6,     7,     8,
-       0,     0,     0,     0,     9,  -337,  -337,  -337,  -337,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,    26,    27,    28,    29,     0,     0,    30,     0,
-       0,     0,     0,    31,    32,     0,     0,     0,    34,    35,
-       0,    36,     0,    37,    38,    39,     0,     0,     0,    40,
-      41,     0,     0,     0,     0,     0,     0,   701,    42,     0,
-      43,    44,    45,    46,    47,    48,    49,   348,    51,     0,
-      52,     0,    53,    54,    55,    56,    57,    58,   111,    60,
-      61,     0,     0,     0,     0,     0,    62,    63,    64,    65,
-      66,    67,     0,     0,    68,    69,     0,     0,    71,    72,
-       0,    73,     0,    74,     0,    75,    76,    77,    78,     4,
-       5,     6,     7,     8,     0,     0,     0,     0,     9,     0,
+       0,     0,     0,    -2,     4,     0,   453,     0,     0,     0,
+       0,     0,     0,     0,     0,     5,     6,   461,     0,     0,
+       0,     7,     8,     9,     0,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,   183,    15,
+      16,    17,     0,   183,     0,    18,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,   521,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,    52,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,   528,     0,    68,    69,    70,    71,     0,    72,    73,
+       0,   536,    74,   538,    75,     0,    76,    77,    78,    79,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   551,     0,     0,     0,     0,   294,   553,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,    26,    27,    28,    29,
-       0,     0,    30,     0,     0,     0,     0,    31,    32,     0,
-       0,     0,    34,    35,     0,    36,     0,    37,    38,    39,
-       0,     0,     0,    40,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,    44,    45,    46,    47,    48,
-      49,   348,    51,     0,    52,     0,    53,    54,    55,    56,
-      57,    58,   111,    60,    61,     0,     0,     0,     0,     0,
-      62,    63,    64,    65,    66,    67,     0,     0,    68,    69,
-       0,     0,    71,    72,     0,    73,   774,    74,     0,    75,
-      76,    77,    78,     4,     5,     6,     7,     8,     0,     0,
-       0,     0,     9,     0,     0,     0,     0,     0,     0,     0,
+     183,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     570,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   183,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   183,   183,
+       0,     0,   601,     0,     0,     4,   183,   183,     0,   183,
+       0,   426,   609,     0,     0,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,     0,    10,     0,    11,    12,
+       0,     0,    13,     0,     0,    14,     0,  -105,     0,     0,
+      15,    16,    17,     0,   629,     0,     0,    19,    20,     0,
+      21,    22,  -105,    23,     0,    24,    25,     0,     0,     0,
+      26,    27,     0,     0,    28,     0,     0,     0,     0,     0,
+       0,  -105,     0,    29,    30,     0,    31,    32,    33,    34,
+      35,    36,    37,    38,   350,    40,     0,    41,    42,    43,
+      44,     0,   679,    45,    46,     0,     0,     0,     0,     0,
+      47,   294,    48,    49,    50,     0,     0,     0,    51,     0,
+       0,     0,   112,    53,    54,    55,     0,    56,     0,     0,
+       0,     0,     0,     0,    57,     0,     0,     0,    58,    59,
+      60,     0,     0,     0,     0,    61,    62,    63,    64,    65,
+      66,    67,     0,     0,    68,    69,    70,     0,     0,    72,
+      73,     0,     4,    74,  -105,    75,     0,    76,    77,    78,
+      79,     0,     0,     5,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,    10,     0,    11,    12,     0,   737,    13,
+       0,     0,    14,     0,  -104,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,  -104,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,   768,     0,     0,  -104,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,    46,     0,     0,     0,     0,   789,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+       0,    68,    69,    70,     0,     0,    72,    73,     4,     0,
+      74,  -104,    75,     0,    76,    77,    78,    79,     0,     5,
+       6,     0,     0,     0,     0,     7,     8,     9,     0,    10,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,    18,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,    46,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,    52,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
+      71,     0,    72,    73,     4,     0,    74,   471,    75,     0,
+      76,    77,    78,    79,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,    18,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,    52,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,     0,    68,    69,    70,    71,     0,    72,    73,
+       4,     0,    74,   566,    75,     0,    76,    77,    78,    79,
+       0,     5,     6,     0,     0,     0,     0,     7,     8,     9,
+       0,    10,     0,    11,    12,     0,     0,    13,     0,     0,
+      14,     0,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,  -112,  -112,    28,
+       0,     0,     0,     0,     0,  -112,     0,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,     0,    45,    46,
+       0,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,     0,    51,     0,     0,     0,   112,    53,    54,
+      55,     0,    56,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,    58,    59,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,    65,    66,    67,     0,     0,    68,
+      69,    70,     0,     0,    72,    73,     4,     0,    74,     0,
+      75,     0,    76,    77,    78,    79,     0,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,    10,     0,    11,
+      12,     0,     0,    13,     0,     0,    14,     0,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,  -113,  -113,    28,     0,     0,     0,     0,
+       0,  -113,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,   350,    40,     0,    41,    42,
+      43,    44,     0,     0,    45,    46,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,    60,     0,     0,     0,     0,    61,    62,    63,    64,
+      65,    66,    67,     0,     0,    68,    69,    70,     0,     0,
+      72,    73,     4,     0,    74,     0,    75,     0,    76,    77,
+      78,    79,     0,     5,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,    10,     0,    11,    12,     0,     0,    13,
+       0,     0,    14,     0,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,    46,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+       0,    68,    69,    70,     0,     0,    72,    73,     4,     0,
+      74,   351,    75,     0,    76,    77,    78,    79,     0,     5,
+       6,     0,     0,     0,     0,     7,     8,     9,     0,    10,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,    46,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,   112,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
+       0,     0,    72,    73,     4,     0,    74,   490,    75,     0,
+      76,    77,    78,    79,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,   685,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   350,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,     0,    68,    69,    70,     0,     0,    72,    73,
+       4,     0,    74,     0,    75,     0,    76,    77,    78,    79,
+       0,     5,     6,     0,     0,     0,     0,     7,     8,     9,
+       0,    10,     0,    11,    12,     0,     0,    13,     0,     0,
+      14,     0,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,   704,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,     0,    45,    46,
+       0,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,     0,    51,     0,     0,     0,   112,    53,    54,
+      55,     0,    56,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,    58,    59,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,    65,    66,    67,     0,     0,    68,
+      69,    70,     0,     0,    72,    73,     4,     0,    74,     0,
+      75,     0,    76,    77,    78,    79,     0,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,    10,     0,    11,
+      12,     0,     0,    13,     0,     0,    14,     0,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,   350,    40,     0,    41,    42,
+      43,    44,     0,     0,    45,    46,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,    60,     0,     0,     0,     0,    61,    62,    63,    64,
+      65,    66,    67,     0,     0,    68,    69,    70,     0,     0,
+      72,    73,     4,     0,    74,   778,    75,     0,    76,    77,
+      78,    79,     0,     5,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,    10,     0,    11,    12,     0,     0,    13,
+       0,     0,    14,     0,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,    46,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+       0,    68,    69,    70,     0,     0,    72,    73,     4,     0,
+      74,   782,    75,     0,    76,    77,    78,    79,     0,     5,
+       6,     0,     0,     0,     0,     7,     8,     9,     0,    10,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,   787,     0,     0,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,    46,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,   112,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
+       0,     0,    72,    73,     4,     0,    74,     0,    75,     0,
+      76,    77,    78,    79,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,   800,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   350,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,     0,    68,    69,    70,     0,     0,    72,    73,
+       4,     0,    74,     0,    75,     0,    76,    77,    78,    79,
+       0,     5,     6,     0,     0,     0,     0,     7,     8,     9,
+       0,    10,     0,    11,    12,     0,     0,    13,     0,     0,
+      14,     0,     0,     0,     0,    15,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,  -117,     0,     0,    29,    30,
+       0,    31,    32,    33,    34,    35,    36,    37,    38,   350,
+      40,     0,    41,    42,    43,    44,     0,     0,    45,    46,
+       0,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,     0,    51,     0,     0,     0,   112,    53,    54,
+      55,     0,    56,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,    58,    59,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,    65,    66,    67,     0,     0,    68,
+      69,    70,     0,     0,    72,    73,     4,     0,    74,     0,
+      75,     0,    76,    77,    78,    79,     0,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,    10,     0,    11,
+      12,     0,     0,    13,     0,     0,    14,     0,     0,     0,
+       0,    15,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,    32,    33,
+      34,    35,    36,    37,    38,   350,    40,     0,    41,    42,
+      43,    44,     0,     0,    45,    46,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,    60,     0,     0,     0,     0,    61,    62,    63,    64,
+      65,    66,    67,     0,     0,    68,    69,    70,     0,     0,
+      72,    73,     4,     0,    74,   810,    75,     0,    76,    77,
+      78,    79,     0,     5,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,    10,     0,    11,    12,     0,     0,    13,
+       0,     0,    14,     0,     0,     0,     0,    15,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,    32,    33,    34,    35,    36,    37,
+      38,   350,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,    46,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+       0,    68,    69,    70,     0,     0,    72,    73,     4,     0,
+      74,   824,    75,     0,    76,    77,    78,    79,     0,     5,
+       6,     0,     0,     0,     0,     7,     8,     9,     0,    10,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,    15,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+      32,    33,    34,    35,    36,    37,    38,   350,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,    46,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,   112,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
+       0,     0,    72,    73,     4,     0,    74,   829,    75,   548,
+      76,    77,    78,    79,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,    33,    34,    35,
+      36,    37,    38,     0,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,     0,    68,    69,    70,     0,     0,    72,    73,
+       4,     0,    74,     0,    75,   559,    76,    77,    78,    79,
+       0,     5,     6,     0,     0,     0,     0,     7,     8,     9,
+       0,     0,     0,    11,    12,     0,     0,    13,     0,     0,
+      14,     0,     0,     0,     0,     0,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,    29,    30,
+       0,    31,     0,    33,    34,    35,    36,    37,    38,     0,
+      40,     0,    41,    42,    43,    44,     0,     0,    45,     0,
+       0,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,     0,    51,     0,     0,     0,   112,    53,    54,
+      55,     0,    56,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,    58,    59,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,    65,    66,    67,     0,     0,    68,
+      69,    70,     0,     0,    72,    73,     4,     0,    74,     0,
+      75,   580,    76,    77,    78,    79,     0,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,     0,     0,    11,
+      12,     0,     0,    13,     0,     0,    14,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,    33,
+      34,    35,    36,    37,    38,     0,    40,     0,    41,    42,
+      43,    44,     0,     0,    45,     0,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,    60,     0,     0,     0,     0,    61,    62,    63,    64,
+      65,    66,    67,     0,     0,    68,    69,    70,     0,     0,
+      72,    73,     4,     0,    74,     0,    75,   727,    76,    77,
+      78,    79,     0,     5,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,     0,     0,    11,    12,     0,     0,    13,
+       0,     0,    14,     0,     0,     0,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,    33,    34,    35,    36,    37,
+      38,     0,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,     0,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   112,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+       0,    68,    69,    70,     0,     0,    72,    73,     4,     0,
+      74,     0,    75,   761,    76,    77,    78,    79,     0,     5,
+       6,     0,     0,     0,     0,     7,     8,     9,     0,     0,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,     0,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+       0,    33,    34,    35,    36,    37,    38,     0,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,     0,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,   112,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
+       0,     0,    72,    73,     4,     0,    74,     0,    75,     0,
+      76,    77,    78,    79,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,    33,    34,    35,
+      36,    37,    38,     0,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,     0,    68,    69,    70,     0,     0,    72,    73,
+       0,     0,    74,     0,    75,     0,    76,    77,    78,    79,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,   236,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-      26,    27,    28,    29,     0,     0,    30,     0,     0,     0,
-       0,    31,    32,     0,     0,     0,    34,    35,     0,    36,
-       0,    37,    38,    39,     0,     0,     0,    40,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,    44,
-      45,    46,    47,    48,    49,   348,    51,     0,    52,     0,
-      53,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,    62,    63,    64,    65,    66,    67,
-       0,     0,    68,    69,     0,     0,    71,    72,     0,    73,
-     778,    74,     0,    75,    76,    77,    78,     4,     5,     6,
-       7,     8,     0,     0,     0,     0,     9,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,    26,    27,    28,    29,     0,     0,
-      30,     0,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,   783,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,     0,    53,    54,    55,    56,    57,    58,
-     111,    60,    61,     0,     0,     0,     0,     0,    62,    63,
-      64,    65,    66,    67,     0,     0,    68,    69,     0,     0,
-      71,    72,     0,    73,     0,    74,     0,    75,    76,    77,
-      78,     4,     5,     6,     7,     8,     0,     0,     0,     0,
-       9,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,    26,    27,
-      28,    29,     0,     0,    30,     0,     0,     0,     0,    31,
-      32,     0,     0,     0,    34,    35,     0,    36,     0,    37,
-      38,    39,     0,     0,     0,    40,    41,     0,     0,   796,
-       0,     0,     0,     0,    42,     0,    43,    44,    45,    46,
-      47,    48,    49,   348,    51,     0,    52,     0,    53,    54,
-      55,    56,    57,    58,   111,    60,    61,     0,     0,     0,
-       0,     0,    62,    63,    64,    65,    66,    67,     0,     0,
-      68,    69,     0,     0,    71,    72,     0,    73,     0,    74,
-       0,    75,    76,    77,    78,     4,     5,     6,     7,     8,
-       0,     0,     0,     0,     9,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,   377,     0,   244,   245,   246,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,     0,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,   247,     0,   248,    16,    17,     0,     0,     0,
+       0,    19,     0,     0,    21,     0,     0,    23,     0,    24,
+       0,     0,     0,     0,    26,     0,     0,     0,    28,     0,
+       0,     0,   633,     0,     0,     0,     0,    29,    30,     0,
+      31,     0,     0,     0,    35,    36,     0,     0,     0,     0,
+       0,    41,    42,    43,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,  -137,
+     252,     0,    51,     0,     0,     0,   112,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,   253,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     113,   114,    64,    65,     0,     0,     0,   254,     0,     0,
+      70,     0,  -326,    72,     0,     0,   255,     0,     0,    75,
+       0,     0,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,     0,     0,   223,   738,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,     0,  -326,
+       0,     0,     0,     0,     0,     0,     0,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   256,   257,   258,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   259,     0,   260,     0,     0,     0,     0,
+       0,     0,     0,     0,   261,     0,   262,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,    26,    27,    28,    29,     0,     0,    30,     0,
-       0,     0,     0,    31,    32,     0,     0,     0,    34,    35,
-       0,    36,     0,    37,    38,    39,     0,     0,     0,    40,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,    44,    45,    46,    47,    48,    49,   348,    51,     0,
-      52,     0,    53,    54,    55,    56,    57,    58,   111,    60,
-      61,     0,     0,     0,     0,     0,    62,    63,    64,    65,
-      66,    67,     0,     0,    68,    69,     0,     0,    71,    72,
-       0,    73,   806,    74,     0,    75,    76,    77,    78,     4,
-       5,     6,     7,     8,     0,     0,     0,     0,     9,     0,
+       0,     0,     0,     0,   263,   237,     0,     0,  -137,   238,
+     239,   240,   241,   242,     0,   243,     0,     0,     0,   244,
+     245,   246,     0,     0,   223,     0,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,     0,
+       0,     0,     0,     0,     0,   247,     0,   248,   235,   236,
+       0,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,     0,     0,
+       0,   739,     0,     0,     0,     0,     0,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,    26,    27,    28,    29,
-       0,     0,    30,     0,     0,     0,     0,    31,    32,     0,
-       0,     0,    34,    35,     0,    36,     0,    37,    38,    39,
-       0,     0,     0,    40,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,    44,    45,    46,    47,    48,
-      49,   348,    51,     0,    52,     0,    53,    54,    55,    56,
-      57,    58,   111,    60,    61,     0,     0,     0,     0,     0,
-      62,    63,    64,    65,    66,    67,     0,     0,    68,    69,
-       0,     0,    71,    72,     0,    73,   820,    74,     0,    75,
-      76,    77,    78,     4,     5,     6,     7,     8,     0,     0,
-       0,     0,     9,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,     0,     0,     0,
+     244,   245,   246,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,     0,   238,
+     239,   240,   241,   242,     0,   243,   247,     0,   248,   244,
+     245,   246,     0,     0,   223,     0,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,     0,
+       0,     0,   249,     0,     0,   247,     0,   248,   235,   236,
+       0,     0,     0,   223,     0,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,     0,     0,     0,     0,
+       0,   276,     0,     0,     0,     0,     0,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-      26,    27,    28,    29,     0,     0,    30,     0,     0,     0,
-       0,    31,    32,     0,     0,     0,    34,    35,     0,    36,
-       0,    37,    38,    39,     0,     0,     0,    40,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,    44,
-      45,    46,    47,    48,    49,   348,    51,     0,    52,     0,
-      53,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,    62,    63,    64,    65,    66,    67,
-       0,     0,    68,    69,     0,     0,    71,    72,     0,    73,
-     825,    74,     0,    75,    76,    77,    78,     4,     5,     6,
-       7,     8,     0,     0,     0,     0,     9,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,     0,     0,     0,
+     244,   245,   246,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   237,     0,     0,     0,   238,
+     239,   240,   241,   242,     0,   243,   247,     0,   248,   244,
+     245,   246,   272,     0,     0,     5,     6,     0,     0,     0,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,   278,     0,     0,   247,     0,   248,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,   340,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   361,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   404,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   535,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   537,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   584,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,   678,     0,    75,     5,     6,    77,    78,    79,
+       0,     7,     8,     9,     0,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   112,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   113,   114,    64,    65,     0,
+       0,     0,     0,     0,     0,    70,     0,     0,    72,     0,
+       0,     0,     0,     0,    75,     0,     0,    77,    78,    79,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,    26,    27,    28,    29,     0,     0,
-      30,     0,     0,     0,     0,    31,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,   348,
-      51,     0,    52,     0,    53,    54,    55,    56,    57,    58,
-     111,    60,    61,     0,     0,     0,     0,     0,    62,    63,
-      64,    65,    66,    67,     0,     0,    68,    69,     0,     0,
-      71,    72,     0,    73,     0,    74,     0,    75,    76,    77,
-      78,     4,     5,     6,     7,     8,     0,     0,     0,     0,
-       9,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   549,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-      28,    29,     0,     0,    30,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,    35,     0,    36,     0,    37,
-      38,    39,     0,     0,     0,    40,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,    44,    45,    46,
-      47,    48,    49,     0,    51,     0,    52,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     0,     0,     0,
-       0,     0,    62,    63,    64,    65,    66,    67,     0,     0,
-      68,    69,     0,     0,    71,    72,     0,    73,     0,    74,
-       0,    75,    76,    77,    78,     4,     5,     6,     7,     8,
-       0,     0,     0,     0,     9,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   560,     0,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,   356,     0,     0,
+       0,   247,     0,   248,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,   455,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,    28,    29,     0,     0,    30,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,    35,
-       0,    36,     0,    37,    38,    39,     0,     0,     0,    40,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,    44,    45,    46,    47,    48,    49,     0,    51,     0,
-      52,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     0,     0,     0,     0,     0,    62,    63,    64,    65,
-      66,    67,     0,     0,    68,    69,     0,     0,    71,    72,
-       0,    73,     0,    74,     0,    75,    76,    77,    78,     4,
-       5,     6,     7,     8,     0,     0,     0,     0,     9,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   578,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,    28,    29,
-       0,     0,    30,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,    35,     0,    36,     0,    37,    38,    39,
-       0,     0,     0,    40,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,    44,    45,    46,    47,    48,
-      49,     0,    51,     0,    52,     0,     0,    54,    55,    56,
-      57,    58,   111,    60,    61,     0,     0,     0,     0,     0,
-      62,    63,    64,    65,    66,    67,     0,     0,    68,    69,
-       0,     0,    71,    72,     0,    73,     0,    74,     0,    75,
-      76,    77,    78,     4,     5,     6,     7,     8,     0,     0,
-       0,     0,     9,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   723,     0,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,    28,    29,     0,     0,    30,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,    35,     0,    36,
-       0,    37,    38,    39,     0,     0,     0,    40,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,    44,
-      45,    46,    47,    48,    49,     0,    51,     0,    52,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,    62,    63,    64,    65,    66,    67,
-       0,     0,    68,    69,     0,     0,    71,    72,     0,    73,
-       0,    74,     0,    75,    76,    77,    78,     4,     5,     6,
-       7,     8,     0,     0,     0,     0,     9,     0,     0,     0,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,   456,     0,     0,
+       0,   247,     0,   248,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,   464,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     757,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,    28,    29,     0,     0,
-      30,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,    35,     0,    36,     0,    37,    38,    39,     0,     0,
-       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,    44,    45,    46,    47,    48,    49,     0,
-      51,     0,    52,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     0,     0,     0,     0,     0,    62,    63,
-      64,    65,    66,    67,     0,     0,    68,    69,     0,     0,
-      71,    72,     0,    73,     0,    74,     0,    75,    76,    77,
-      78,     4,     5,     6,     7,     8,     0,     0,     0,     0,
-       9,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-      28,    29,     0,     0,    30,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,    35,     0,    36,     0,    37,
-      38,    39,     0,     0,     0,    40,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,    44,    45,    46,
-      47,    48,    49,     0,    51,     0,    52,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     0,     0,     0,
-       0,     0,    62,    63,    64,    65,    66,    67,     0,     0,
-      68,    69,     0,     0,    71,    72,     0,    73,     0,    74,
-       0,    75,    76,    77,    78,     4,     5,     6,     7,     8,
-       0,     0,     0,     0,     9,     0,     0,     0,     0,     0,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,   489,     0,     0,
+       0,   247,     0,   248,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,   496,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   110,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   112,    65,
-       9,     0,     0,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,     0,   156,    76,    77,    78,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     110,    29,     0,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     4,     5,     6,
-       7,     8,     0,    63,   112,    65,     9,     0,     0,     0,
-       0,     0,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,   159,    76,    77,    78,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,    29,     0,     0,
-       0,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,     0,     0,     0,     0,    37,    38,     0,     0,     0,
-       0,     0,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,     0,     0,    46,    47,     0,     0,     0,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     4,     5,     6,     7,     8,     0,    63,
-     112,    65,     9,     0,     0,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,   183,    76,    77,
-      78,   286,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   110,    29,     0,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     4,
-       5,     6,     7,     8,     0,    63,   112,    65,     9,     0,
-       0,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   110,    29,
-       0,     0,     0,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,     0,     0,     0,     0,    37,    38,     0,
-       0,     0,     0,     0,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,     0,     0,    46,    47,     0,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   111,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   112,    65,     9,     0,     0,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,    74,   299,     0,
-      76,    77,    78,   359,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   110,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   112,    65,
-       9,     0,     0,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,   378,     0,    76,    77,    78,     0,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,   620,     0,     0,
+       0,   247,     0,   248,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,   791,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     110,    29,     0,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     4,     5,     6,
-       7,     8,     0,    63,   112,    65,     9,     0,     0,     0,
-       0,     0,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,   402,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,    29,     0,     0,
-       0,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,     0,     0,     0,     0,    37,    38,     0,     0,     0,
-       0,     0,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,     0,     0,    46,    47,     0,     0,     0,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     4,     5,     6,     7,     8,     0,    63,
-     112,    65,     9,     0,     0,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,     0,    76,    77,
-      78,   543,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   110,    29,     0,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     4,
-       5,     6,     7,     8,     0,    63,   112,    65,     9,     0,
-       0,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,   545,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   110,    29,
-       0,     0,     0,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,     0,     0,     0,     0,    37,    38,     0,
-       0,     0,     0,     0,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,     0,     0,    46,    47,     0,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   111,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   112,    65,     9,     0,     0,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,    74,     0,     0,
-      76,    77,    78,   582,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   110,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   111,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   112,    65,
-       9,     0,     0,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,     0,     0,    76,    77,    78,   680,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     110,    29,     0,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   111,    60,    61,     4,     5,     6,
-       7,     8,     0,    63,   112,    65,     9,     0,     0,     0,
-       0,     0,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,    29,     0,     0,
-       0,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,     0,     0,     0,     0,    37,    38,     0,     0,     0,
-       0,     0,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,     0,     0,    46,    47,     0,     0,     0,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     111,    60,    61,     4,     5,     6,     7,     8,     0,    63,
-     112,    65,     9,     0,     0,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,     0,    76,    77,
-      78,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   110,    29,     0,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   111,    60,    61,     0,
-       0,     0,     0,     0,     0,    63,   112,   328,     0,     0,
-       0,   221,   222,   223,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,     0,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-       0,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,     0,     0,     0,     0,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   247,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   290,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   292,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,     0,     0,   221,   222,   223,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   224,   338,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,   221,   222,   223,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,   802,     0,     0,
+       0,   247,     0,   248,   235,   236,     0,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,   481,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,   236,     0,     0,     0,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,   235,   236,   238,   239,   240,   241,
+     242,     0,   243,     0,     0,     0,   244,   245,   246,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   354,   224,     0,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   427,   224,     0,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     0,
-       0,   221,   222,   223,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,   461,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,     0,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     469,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   221,   222,   223,     0,     0,     0,
+       0,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,   247,     0,   248,   244,   245,   246,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,     0,   498,   238,   239,   240,   241,
+     242,   247,   243,   248,     0,     0,   244,   245,   246,     0,
+       0,   223,     0,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   534,     0,     0,     0,     0,     0,
+       0,     0,   247,     0,   248,   235,   236,     0,     0,     0,
+     223,     0,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,     0,     0,   558,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,   236,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   237,     0,     0,     0,   238,   239,   240,
+     241,   242,     0,   243,     0,     0,     0,   244,   245,   246,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   237,     0,     0,     0,   238,   239,   240,   241,
+     242,     0,   243,   247,     0,   248,   244,   245,   246,     0,
+       0,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,   605,     0,    13,     0,
+       0,     0,   247,     0,   248,     0,     0,    16,    17,     0,
+       0,     0,     0,    19,     0,     0,    21,     0,     0,    23,
+       0,    24,     0,     0,     0,   677,    26,     0,     0,     0,
+      28,     0,     0,     0,     0,     0,     0,     0,     0,    29,
+      30,     0,    31,     0,     0,     0,    35,    36,     0,     0,
+       0,     0,     0,    41,    42,    43,     0,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,    65,     0,     0,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     0,   125,    77,    78,    79,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,     0,     0,    11,
+      12,     0,     0,    13,     0,     0,     0,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,     0,
+       0,    21,     0,     0,    23,     0,    24,     0,     0,     0,
+       0,    26,     0,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,     0,
+       0,    35,    36,     0,     0,     0,     0,     0,    41,    42,
+      43,     0,     0,     0,    45,     0,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,     0,     0,     0,     0,     0,    61,   113,   114,    64,
+      65,     0,     0,     0,     0,     0,     0,    70,     0,     0,
+      72,     0,     0,     0,     0,     0,    75,     0,   129,    77,
+      78,    79,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,     0,     0,    13,     0,
+       0,     0,     0,     0,     0,     0,     0,    16,    17,     0,
+       0,     0,     0,    19,     0,     0,    21,     0,     0,    23,
+       0,    24,     0,     0,     0,     0,    26,     0,     0,     0,
+      28,     0,     0,     0,     0,     0,     0,     0,     0,    29,
+      30,     0,    31,     0,     0,     0,    35,    36,     0,     0,
+       0,     0,     0,    41,    42,    43,     0,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,    65,     0,     0,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     0,   181,    77,    78,    79,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,     0,     0,     0,    11,
+      12,     0,     0,    13,     0,     0,     0,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,     0,
+       0,    21,     0,     0,    23,     0,    24,     0,     0,     0,
+       0,    26,     0,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,     0,
+       0,    35,    36,     0,     0,     0,     0,     0,    41,    42,
+      43,     0,     0,     0,    45,     0,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   112,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,     0,     0,     0,     0,     0,    61,   113,   114,    64,
+      65,     0,     0,     0,     0,     0,     0,    70,     0,     0,
+      72,     0,     0,     0,     0,     0,    75,   290,     0,    77,
+      78,    79,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,     0,     0,    13,     0,
+       0,     0,     0,     0,     0,     0,     0,    16,    17,     0,
+       0,     0,     0,    19,     0,     0,    21,     0,     0,    23,
+       0,    24,     0,     0,     0,     0,    26,     0,     0,     0,
+      28,     0,     0,     0,     0,     0,     0,     0,     0,    29,
+      30,     0,    31,     0,     0,     0,    35,    36,     0,     0,
+       0,     0,     0,    41,    42,    43,     0,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,     0,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,     0,     0,     0,     0,
+       0,    61,   113,   114,    64,    65,     0,     0,     0,     0,
+       0,     0,    70,     0,     0,    72,     0,     0,     0,     0,
+       0,    75,     5,     6,    77,    78,    79,     0,     7,     8,
+       9,     0,     0,     0,    11,    12,     0,     0,    13,     0,
+       0,     0,     0,     0,     0,     0,     0,    16,    17,     0,
+       0,     0,     0,    19,     0,     0,    21,     0,     0,    23,
+       0,    24,     0,     0,     0,     0,    26,     0,     0,     0,
+      28,     0,     0,     0,     0,     0,     0,     0,     0,    29,
+      30,     0,    31,     0,     0,     0,    35,    36,     0,     0,
+       0,     0,     0,    41,    42,    43,     0,     0,     0,    45,
+       0,     0,     0,     0,     0,     0,    47,     0,    48,    49,
+      50,     0,     0,     0,    51,     0,     0,   252,   112,    53,
+      54,    55,     0,    56,     0,     0,     0,     0,     0,     0,
+      57,     0,     0,     0,    58,    59,   253,     0,     0,   460,
+       0,    61,   113,   114,    64,   327,     0,     0,     0,     0,
+       0,     0,    70,     0,   254,    72,     0,     0,     0,  -326,
+       0,    75,     0,   255,    77,    78,    79,   223,     0,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,   487,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,     0,     0,   221,   222,   223,
+       0,   235,   236,     0,     0,     0,  -326,     0,   223,   522,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,     0,     0,     0,     0,     0,     0,   431,   256,   257,
+     258,     0,   235,   236,     0,     0,     0,     0,     0,     0,
+     259,     0,   260,     0,     0,     0,     0,     0,     0,     0,
+       0,   261,     0,   262,     0,     0,     0,     0,     0,   237,
+       0,     0,     0,   238,   239,   240,   241,   242,     0,   243,
+       0,   263,     0,   244,   245,   246,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,   494,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,     0,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   621,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   787,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     798,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,     0,   221,   222,   223,     0,     0,
+     237,     0,     0,     0,   238,   239,   240,   241,   242,   247,
+     243,   248,     0,     0,   244,   245,   246,     0,     0,   223,
+       0,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,     0,     0,     0,     0,     0,     0,     0,     0,
+     247,     0,   248,   235,   236,     0,     0,     0,   223,     0,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,     0,     0,     0,     0,     0,     0,     0,     0,   612,
+       0,     0,   235,   236,     0,   223,     0,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+     236,   237,     0,     0,     0,   238,   239,   240,   241,   242,
+       0,   243,     0,     0,     0,   244,   245,   246,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     481,   224,     0,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,   221,   222,   223,     0,
+     237,     0,     0,     0,   238,   239,   240,   241,   242,     0,
+     243,   247,     0,   248,   244,   245,   246,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   237,     0,     0,
+       0,   238,   239,   240,   241,   242,     0,   243,     0,     0,
+     247,   244,   248,   246,     0,     0,   223,     0,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,     0,
+       0,     0,     0,     0,     0,     0,     0,   247,     0,   248,
+     235,   236,   223,     0,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,   236,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   496,   224,     0,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,   221,   222,   223,
+     235,   236,     0,     0,     0,     0,     0,     0,   237,     0,
+       0,     0,   238,   239,   240,   241,   242,     0,   243,     0,
+       0,     0,   244,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   237,     0,     0,     0,   238,   239,
+     240,   241,   242,     0,   243,   235,     0,     0,   247,     0,
+     248,     0,     0,     0,     0,     0,     0,     0,   237,     0,
+       0,     0,   238,   239,   240,   241,   242,     0,   243,     0,
+       0,     0,     0,     0,   247,     0,   248,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   247,     0,
+     248,     0,     0,   237,     0,     0,     0,   238,   239,   240,
+     241,   242,     0,   243,     0,     0,     0,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   437,     0,   247,     0,   248,     0,     0,     0,     0,
+       0,     0,     0,     0,    16,     0,     0,   237,     0,     0,
+      19,   238,   239,   240,   241,   242,    23,   243,    24,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,     0,   227,
+     228,   229,   230,   231,   232,   233,   234,     0,     0,    31,
+       0,     0,     0,    35,     0,     0,   237,   247,     0,   248,
+     238,   239,   240,   241,   242,     0,   243,     0,     0,     0,
+       0,     0,     0,     0,     0,    48,     0,    50,     0,     0,
+       0,    51,     0,     0,     0,   438,     0,    54,   439,     0,
+       0,     0,     0,     0,     0,     0,   247,     0,   248,   227,
+     228,   229,   230,   231,   232,   233,   234,   237,   440,   113,
+     114,   238,   239,   240,   241,   242,   237,   243,     0,     0,
+     238,   239,   240,   241,   242,     0,   243,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,   532,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,     0,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   559,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   603,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,   221,   222,   223,   450,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   674,   224,
-     520,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   221,   222,   223,   618,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   247,     0,   248,
+       0,     0,     0,     0,     0,     0,   247,     0,   248,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,     0,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,   222,   223,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,     0,     0,
+    -339,   239,  -339,  -339,  -339,     0,   243,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,     0,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   223,   246,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   247,     0,   248
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-531))
-
-#define yytable_value_is_error(yytable_value) \
-  ((yytable_value) == (-337))
-
 static const yytype_int16 yycheck[] =
 {
-       2,    21,    22,     2,    25,    25,   281,   246,   113,   220,
-     462,     2,     2,   197,   365,   359,   367,   510,   180,    26,
-       8,     8,    26,     8,     8,    61,     8,     8,     8,    61,
-     151,    61,     8,     8,   128,    31,    25,     8,     8,    59,
-      39,    61,   572,   128,     8,     8,     8,     8,    58,    59,
-      70,    88,   263,   264,   128,    61,    61,   151,    95,   133,
-      61,     0,   273,   274,   149,    31,   277,    81,   153,   280,
-     281,   128,    25,   128,    74,     8,   133,   151,   133,    62,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    78,   128,   151,   136,   151,   133,   130,   128,
-      31,   262,    31,   633,    90,   635,   128,   136,    81,   146,
-     151,    78,   132,   149,   136,   151,   151,   278,   107,   149,
-     149,   151,   142,    90,     8,    58,    59,   133,   128,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,   136,   149,   149,   149,   165,    21,    22,   149,   153,
-     146,   171,    99,    76,   505,    78,   103,   177,   178,   179,
-     322,   150,    74,   324,   150,   153,   153,   187,   153,   153,
-     622,   153,   153,   153,    58,    59,   152,   152,   198,   199,
-     146,   152,   152,   150,    64,    65,   169,    62,   152,   152,
-     152,   152,    31,    45,    46,    47,   146,    49,    72,   543,
-     128,   545,   204,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,   146,   128,   146,   136,   152,
-      64,    65,    88,   151,    78,   246,   246,   151,   129,    95,
-     213,   220,    78,    72,   151,   136,    90,   103,   582,   590,
-      21,    22,   151,   151,    90,   146,    73,   146,    58,    59,
-     104,   271,   126,   151,   128,   275,   155,   246,   104,   151,
-     128,   146,   136,   283,   146,   133,   286,   220,   152,    63,
-     155,   291,   146,   155,   263,   264,   136,    26,    72,   262,
-     146,   155,   521,   136,   273,   274,   637,   126,   277,   128,
-     165,   280,   281,   246,   169,   278,   171,   136,   791,   126,
-     128,   128,   177,   178,   151,   133,   151,   146,   128,   136,
-     263,   264,   187,   133,   475,   151,   155,   151,   151,   321,
-     273,   274,   321,   198,   277,   345,   149,   280,   281,   151,
-     321,   321,   126,   608,   128,   151,   680,   339,   213,   359,
-     149,   324,   136,   153,    72,   365,   136,   367,    72,   149,
-     370,    72,   146,   153,    31,   516,   517,   133,    21,    22,
-     151,   155,    25,   524,   525,   549,   527,   133,    67,    68,
-      69,    70,    71,    72,   130,    73,   560,   128,    49,   133,
-     128,   133,   402,   128,   128,   374,    85,   262,    67,    68,
-      69,    70,    71,    72,   578,   133,   671,   608,   126,   123,
-     128,   151,   126,   278,   128,   126,    85,   128,   136,    13,
-     130,   286,   136,   136,   136,   136,   436,   437,   146,   133,
-     440,   149,   146,   146,   146,   146,   149,   155,   126,    13,
-     128,   155,   155,   155,   155,   455,    88,   147,   136,   136,
-     153,   152,   154,    95,   464,   465,   145,    99,    88,   324,
-     470,   150,   472,   473,   152,    95,   136,   153,   457,    99,
-     671,    88,   136,   103,   136,   816,   145,   151,    95,   489,
-     469,   150,    99,   107,   146,   477,   103,   107,   477,   126,
-     500,   128,   502,   155,   359,   505,   477,   477,   146,   136,
-     510,   152,   475,     8,   146,   494,    88,    13,    88,   152,
-     521,   521,   165,    95,   156,    95,   146,    99,   171,    99,
-     136,   136,   153,   151,   177,   178,   499,   537,   538,   146,
-     146,   146,   542,   543,   187,   545,   710,   402,   712,   155,
-     155,     8,   521,   516,   517,   198,   556,    74,    88,   723,
-     153,   524,   525,   151,   527,    95,   151,   150,    61,    99,
-     189,   136,   736,   192,   146,   136,   146,   152,     8,    13,
-     117,   149,   582,   152,   151,   151,   586,   206,   521,   208,
-     590,   210,   211,   757,   594,   151,   151,   151,   762,   151,
-     157,   152,   766,   246,   151,   128,   133,    13,   136,   464,
-     465,    13,   152,   157,    79,   470,   146,   472,   473,   619,
-     475,   706,   153,   623,   136,   789,    67,    68,    69,    70,
-      71,    72,   152,   149,   489,     8,   128,   637,   620,   608,
-     283,   805,   152,   286,   499,   627,     8,   130,   291,   813,
-      42,    43,    44,    45,    46,    47,   638,    49,   103,   823,
-     136,   516,   517,    13,   664,   153,   152,    96,   153,   524,
-     525,   112,   527,   655,   153,   608,   676,   151,   678,   152,
-     680,   153,   144,   146,    13,   152,   152,   130,   543,   157,
-     545,   152,   152,   152,   152,    96,     8,   153,   152,   152,
-     150,   556,   671,   136,   146,   112,    13,   151,   687,   688,
-     149,   149,   691,   153,   151,   715,   359,   152,   146,    13,
-      13,   153,   153,   136,   146,    13,    96,   582,   151,    26,
-      66,   146,   153,   152,    13,   146,   136,    13,   671,   153,
-     149,   741,   742,   722,    13,   153,   151,   146,    26,   153,
-     345,    79,   146,   753,   152,   151,   756,   152,   149,   402,
-     811,   505,   489,   557,   623,   747,   688,   309,   623,   751,
-     656,   594,   589,   773,   733,   612,   529,   717,   760,   779,
-     600,   171,    -1,   472,    -1,   767,   473,    -1,    -1,    -1,
-     790,   791,    -1,   436,   437,    -1,    -1,    -1,    -1,    -1,
-     782,    -1,    -1,   785,    -1,    -1,   788,    -1,   787,    -1,
-      -1,    -1,   455,    -1,    -1,    -1,   816,    -1,   800,    -1,
-      -1,   464,   465,    -1,    -1,   680,   808,   470,    -1,   472,
-     473,    -1,    -1,    -1,    -1,    -1,   818,    -1,    -1,    -1,
-      -1,    -1,   824,    -1,    -1,    -1,   489,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   500,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      21,    22,    -1,    -1,    25,    -1,    -1,    -1,   521,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,   537,    -1,     9,    10,    11,   542,
-     543,    -1,   545,    58,    59,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   556,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,   582,
-      -1,    -1,    -1,     4,     5,    -1,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      -1,    -1,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
-      -1,    -1,    -1,    -1,    35,    -1,   619,    -1,    -1,    40,
-     623,    -1,    -1,    -1,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
-      -1,    62,    -1,    -1,    -1,    -1,    67,    -1,    -1,    -1,
-      -1,    -1,    -1,    74,   165,    -1,    -1,    -1,    -1,    -1,
-     171,   664,    -1,    -1,    -1,    -1,   177,   178,    -1,    58,
-      59,    -1,    -1,   676,    -1,   678,   187,   680,    -1,    -1,
-      -1,    -1,    -1,    -1,   157,    74,    -1,   198,    -1,   283,
-      -1,    -1,    -1,    -1,    -1,   116,    -1,   291,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,   715,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,   155,   246,    -1,   291,   741,   742,
-      -1,    -1,    -1,    -1,    -1,   166,    -1,   168,   169,    -1,
-     753,    -1,    -1,   756,    -1,   176,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   188,    -1,    -1,
-     773,    -1,    -1,    -1,   195,   286,   779,    -1,    -1,    -1,
-      -1,    -1,   203,    -1,    -1,    -1,    -1,   790,   209,    -1,
-      -1,    -1,   213,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    -1,    -1,    -1,    -1,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   436,   437,   265,   266,    -1,    -1,   359,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   278,    -1,    -1,
-      -1,   455,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   296,    -1,    -1,    -1,    -1,
-      -1,    -1,   436,   437,    -1,   306,    -1,    -1,    -1,    -1,
-      -1,   402,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,   455,    -1,   324,    -1,    -1,   500,    -1,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   537,    -1,    -1,   500,    -1,   542,    -1,
-      -1,    -1,    -1,   464,   465,    -1,    -1,   378,    -1,   470,
-      -1,   472,   473,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   489,    -1,
-      -1,    -1,    -1,   537,    -1,    -1,    -1,    -1,   542,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,   419,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-     521,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   619,    -1,    -1,    -1,   450,
-     108,   452,   543,   111,   545,    -1,   153,   458,    -1,    -1,
-      -1,   462,   463,    -1,   122,   556,   124,   125,   126,   127,
-     128,    -1,    -1,    -1,   475,    -1,    -1,   135,   136,   480,
-      -1,    -1,    -1,    -1,    -1,   619,    -1,    -1,    -1,    -1,
-     664,   582,    -1,    -1,    -1,    -1,    -1,    -1,   499,    -1,
-      -1,    -1,   676,    -1,   678,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   516,   517,    -1,    -1,   520,
-      -1,    -1,    -1,   524,   525,    -1,   527,    -1,   529,   530,
-     664,    -1,   623,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   715,   676,    -1,   678,    -1,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,   565,    49,    -1,   741,   742,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   753,
-      -1,   715,   756,    -1,    -1,    -1,    -1,    -1,    -1,   680,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   773,
-      -1,    -1,    -1,    -1,    -1,   779,    -1,   741,   742,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   790,   618,    -1,   753,
-      -1,   622,   756,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,   773,
-      12,    -1,    -1,    -1,    -1,   779,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   790,    -1,    -1,    -1,
+       2,    21,   321,     2,   237,   115,    53,   457,     2,   222,
+       2,   512,   361,     3,    26,   367,    53,   369,     3,     6,
+       3,    41,     3,     3,     3,     3,    25,     3,    21,     3,
+      26,     3,    52,    53,   111,    55,   111,   264,     3,    21,
+       3,   118,     3,   118,    33,     3,     3,   111,    41,     0,
+     164,    71,   265,   266,    45,    15,    16,    17,     6,    48,
+     111,   111,     1,    54,   133,   111,     9,    60,   281,   282,
+      61,   111,     9,   111,     9,    21,     1,     9,   118,   111,
+     118,   198,   151,    22,   111,   149,   118,    21,    21,   153,
+     574,   318,    46,   153,    21,   112,   323,    22,    36,   111,
+     151,   151,   151,    42,   317,   151,   133,   320,   321,    53,
+       9,   151,   132,   151,    41,   111,   133,    42,   133,   151,
+      33,    61,   149,   143,    45,    65,    21,    87,   145,    83,
+      21,   151,   114,    54,    73,    48,    45,   151,    77,    36,
+      61,   161,   162,   163,    65,    54,   151,   167,    73,    60,
+     143,   635,    77,   637,   145,   507,   149,    77,   151,    79,
+     133,   150,   133,   153,   108,   185,   153,   152,   161,   162,
+     153,   621,   153,   153,   153,   153,   151,   153,   152,   199,
+     152,   201,   121,   122,   123,   222,   535,   152,   537,   152,
+     237,   152,   185,   132,   152,   152,   121,   122,   123,   313,
+     237,   149,   145,   149,   206,   144,   199,   132,   145,   108,
+     145,   150,   111,   145,    24,   149,   149,   237,   151,   144,
+      58,    59,   215,   118,   145,   150,   111,   118,   265,   266,
+       4,   175,    33,   132,   133,   584,   145,   150,   149,   151,
+     592,   145,    21,   470,   281,   282,   145,    48,   133,    23,
+     108,   155,   272,   111,   149,   145,   155,   277,   149,   279,
+     151,    45,    41,    58,    59,   155,    67,    41,   151,   151,
+      54,   264,    46,    33,    53,   133,    50,    61,   222,   272,
+     317,    65,    24,   320,   321,   149,   145,   639,    48,   153,
+     523,   518,   519,   237,   795,   315,   155,   151,   108,   526,
+     527,   111,   529,   151,   215,   151,   151,    67,    45,    83,
+     312,   145,   631,   312,   133,     6,   336,    54,   312,   151,
+     312,   265,   266,   133,    61,   318,   145,   347,   149,   678,
+     323,   105,   106,   107,   151,    45,   155,   281,   282,   341,
+     151,   361,   152,   117,    54,   119,   149,   367,   133,   369,
+      22,    61,   372,   264,   128,   674,   130,   133,   133,     9,
+     145,   145,    45,   133,   143,   151,   108,   118,   361,   111,
+     155,    54,   151,   317,   148,   145,   320,   321,    61,   153,
+     133,   133,   161,   162,   404,   155,   118,   111,   114,    21,
+      45,   133,   145,   145,   118,   111,   149,    87,     4,    54,
+     111,    73,   155,   155,   118,    77,   185,   318,   145,    41,
+      65,   404,   323,   118,   133,   435,   436,   146,   631,   439,
+     199,    53,   153,   111,   152,   111,   118,   114,   151,   449,
+       4,   548,   376,   118,   154,   145,   153,   133,   133,   459,
+     460,    71,   559,    71,   151,   465,   156,   467,   468,   121,
+     122,   123,   451,   152,     3,   152,     4,   151,   237,     3,
+     132,   674,   145,   580,   153,   464,   459,   460,   820,    26,
+     472,   491,   465,   472,   467,   468,   523,   470,   472,   153,
+     472,   151,   502,   150,   504,    21,   523,   507,   133,   145,
+     145,   133,   512,   272,   151,     3,    82,   496,   491,   152,
+       4,   149,   151,   523,   111,   151,   157,   151,   501,   152,
+     151,   143,   151,   151,   151,   535,   118,   537,   133,   151,
+       4,   541,   542,   152,   157,   518,   519,   152,     4,   161,
+     162,    34,   153,   526,   527,   555,   529,   133,   152,   111,
+     187,   149,   535,   190,   537,    11,    12,    13,    14,    15,
+      16,    17,   572,   185,     3,   152,     3,   133,    65,   470,
+       4,   208,   555,   210,   584,   212,   213,   199,   588,   153,
+      55,   152,   592,   114,   153,   153,   596,   152,   151,   523,
+     143,   145,   361,   153,    12,    13,    14,    15,    16,    17,
+     501,   584,     4,   152,   631,   114,   152,   714,   618,   716,
+     710,   152,   622,   157,    55,   237,   152,   518,   519,   152,
+     727,     3,   152,   150,   153,   526,   527,   619,   529,   639,
+     152,    87,   152,   740,   626,   404,    92,   108,   153,   622,
+     111,    97,   133,   145,    77,   336,   149,   674,   640,     4,
+     272,   151,   153,   149,   761,   277,   151,   667,   765,     4,
+     277,   132,   133,   770,   152,   145,   658,   153,   678,    87,
+     680,   127,   682,   129,   145,   153,     4,   145,   149,   133,
+       4,    55,   151,     6,   155,   152,   793,    66,   153,   133,
+     459,   460,   145,     4,   145,   678,   465,   631,   467,   468,
+     689,   690,   809,   692,     4,   153,   149,     4,   153,   719,
+     817,   151,     6,   145,   336,   153,   152,    34,    99,   336,
+     827,   151,   491,   145,   152,   149,   347,   108,   815,   491,
+     111,   556,   622,   690,   507,   745,   746,   726,   737,   361,
+     674,   596,   300,   659,   435,   436,     4,   757,   591,   602,
+     760,   132,   133,   615,   523,   151,   467,    -1,   449,   751,
+     531,     3,     4,   755,   145,    23,   535,   777,   537,   721,
+     468,    -1,   764,   783,   155,    -1,    -1,    -1,    -1,   771,
+      -1,    23,   404,    41,   794,   795,   555,    -1,    46,    -1,
+      -1,    -1,    50,    -1,   786,    -1,   788,    -1,    -1,    41,
+     792,    -1,   791,    -1,    46,    -1,    -1,    -1,    50,    -1,
+     820,   502,   804,   435,   436,   584,    -1,    -1,   435,   436,
+     812,    -1,    -1,    -1,    -1,    83,    -1,   449,    -1,    -1,
+     822,   108,   449,    -1,   111,    -1,   828,   459,   460,    -1,
+      -1,    83,    -1,   465,    -1,   467,   468,   105,   106,   107,
+     541,    -1,    -1,   622,    -1,   132,   133,    -1,    -1,   117,
+      -1,   119,    -1,   105,   106,   107,    -1,    -1,   145,   491,
+     128,    -1,   130,    -1,    -1,   117,    -1,   119,   155,    -1,
+     502,   572,    -1,    -1,    -1,   502,   128,    -1,   130,    -1,
+     148,    -1,   108,   109,    -1,   111,    -1,   108,    -1,    -1,
+     111,   523,    -1,    -1,    -1,    -1,   148,    -1,    -1,   678,
+     152,    -1,    -1,   535,    -1,   537,   132,   133,    -1,   541,
+      -1,   132,   133,    -1,   541,    -1,    -1,   618,    -1,   145,
+      -1,    -1,    -1,   555,   145,    -1,    -1,    -1,    -1,   155,
+      -1,    -1,    -1,    -1,   155,    -1,    -1,    -1,    -1,    -1,
+     572,    -1,    -1,    -1,    -1,   572,    -1,    -1,    -1,    -1,
+      -1,    -1,   584,    -1,    -1,     5,     6,     7,     8,     9,
+      -1,    -1,    12,    13,    14,    -1,   667,    17,    -1,    -1,
+      20,    -1,    -1,    -1,    -1,    -1,    26,    27,    -1,   680,
+      -1,   682,    -1,    -1,    -1,    -1,   618,    -1,    -1,    -1,
+     622,   618,    42,    43,    -1,    45,    -1,    -1,    10,    11,
+      12,    13,    14,    15,    16,    17,    56,    57,    58,    59,
+      60,    -1,    -1,    -1,    64,    -1,    -1,    67,   719,    -1,
+      70,    -1,    -1,    -1,    -1,    75,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   667,    -1,    -1,    -1,    -1,
+     667,    -1,    -1,    -1,   745,   746,   678,    -1,   680,    -1,
+     682,    -1,    -1,   680,    -1,   682,   757,    -1,    -1,   760,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,   695,    -1,    -1,    -1,    70,    71,
-      72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,
-      82,    -1,    -1,    85,    86,    87,    -1,    89,    -1,    91,
-      92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,   730,
-      -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,    -1,   118,    -1,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-     761,    -1,   134,   135,   136,   137,   138,   139,    -1,    -1,
-     142,   143,   144,    -1,   146,   147,    -1,   149,   150,   151,
-      -1,   153,   154,   155,   156,     3,     4,     5,     6,     7,
-      -1,    -1,    -1,    25,    12,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,
-      -1,    -1,    -1,    81,    82,    -1,    -1,    85,    86,    87,
-      -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,    -1,
-     118,    -1,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,
-     138,   139,    -1,    -1,   142,   143,   144,    -1,   146,   147,
-      -1,   149,   150,   151,    -1,   153,   154,   155,   156,     3,
-       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,
-      -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,
-      -1,    85,    86,    87,    -1,    89,    -1,    91,    92,    93,
-      -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,    -1,   118,    -1,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,
-     134,   135,   136,   137,   138,   139,    -1,    -1,   142,   143,
-     144,    -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,
-     154,   155,   156,     3,     4,     5,     6,     7,    -1,    -1,
-      -1,    -1,    12,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,
-      -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,
-      -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,    -1,   118,    -1,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,   139,
-      -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,
-     150,   151,    -1,   153,   154,   155,   156,     3,     4,     5,
-       6,     7,    -1,    -1,    -1,    -1,    12,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,
-      76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
-      86,    87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,
-      -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,    -1,   118,    -1,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,
-     136,   137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,
-     146,   147,    -1,   149,   150,   151,    -1,   153,   154,   155,
-     156,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
-      12,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
+      -1,    -1,   122,    -1,    -1,    87,   777,    -1,    -1,    -1,
+      92,    -1,   783,    -1,    -1,    97,    -1,   719,    -1,    -1,
+      -1,    -1,   719,   794,   144,   145,    -1,    -1,   148,   149,
+      -1,    -1,    -1,    -1,    -1,    -1,   156,    -1,    -1,    -1,
+      -1,    -1,    -1,   745,   746,   127,    -1,   129,   745,   746,
+      -1,    -1,    -1,    -1,    -1,   757,    -1,    -1,   760,    -1,
+     757,    -1,    -1,   760,    -1,    -1,   186,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   777,   196,    -1,    -1,    -1,
+     777,   783,    -1,    -1,    -1,   205,   783,    -1,    -1,    -1,
+      -1,   211,   794,    -1,    -1,   215,    -1,   794,    -1,    -1,
+      -1,    -1,    -1,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   236,    -1,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,    -1,
+      -1,    -1,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,    -1,    -1,   267,   268,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,
-      72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,
-      82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,
-      92,    93,    -1,    -1,    -1,    97,    98,    -1,   100,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,    -1,   118,    -1,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-      -1,    -1,   134,   135,   136,   137,   138,   139,    -1,    -1,
-     142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,
-      -1,   153,   154,   155,   156,     3,     4,     5,     6,     7,
-      -1,    -1,    -1,    -1,    12,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,
-      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,
-      -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,    -1,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,    -1,
-     118,    -1,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,
-     138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,
-      -1,   149,    -1,   151,    -1,   153,   154,   155,   156,     3,
-       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,
+      -1,    -1,    -1,     0,     1,    -1,   286,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    12,    13,   297,    -1,    -1,
+      -1,    18,    19,    20,    -1,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,   318,    36,
+      37,    38,    -1,   323,    -1,    42,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,   377,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   421,    -1,   140,   141,   142,   143,    -1,   145,   146,
+      -1,   431,   149,   433,   151,    -1,   153,   154,   155,   156,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   452,    -1,    -1,    -1,    -1,   457,   458,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,
-      -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,
-      -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,    93,
-      -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,    -1,   118,    -1,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,
-     134,   135,   136,   137,   138,   139,    -1,    -1,   142,   143,
-      -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,   153,
-     154,   155,   156,     3,     4,     5,     6,     7,    -1,    -1,
-      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     470,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     480,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   501,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   518,   519,
+      -1,    -1,   522,    -1,    -1,     1,   526,   527,    -1,   529,
+      -1,   531,   532,    -1,    -1,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    33,    -1,    -1,
+      36,    37,    38,    -1,   564,    -1,    -1,    43,    44,    -1,
+      46,    47,    48,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    67,    -1,    69,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    -1,    83,    84,    85,
+      86,    -1,   612,    89,    90,    -1,    -1,    -1,    -1,    -1,
+      96,   621,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,
+     146,    -1,     1,   149,   150,   151,    -1,   153,   154,   155,
+     156,    -1,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,   698,    28,
+      -1,    -1,    31,    -1,    33,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    48,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,   735,    -1,    -1,    67,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,   766,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,     1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,    42,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+     143,    -1,   145,   146,     1,    -1,   149,   150,   151,    -1,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,   143,    -1,   145,   146,
+       1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    58,    59,    60,
+      -1,    -1,    -1,    -1,    -1,    66,    -1,    -1,    69,    70,
+      -1,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    90,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,    -1,   140,
+     141,   142,    -1,    -1,   145,   146,     1,    -1,   149,    -1,
+     151,    -1,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    58,    59,    60,    -1,    -1,    -1,    -1,
+      -1,    66,    -1,    -1,    69,    70,    -1,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,     1,    -1,   149,    -1,   151,    -1,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,     1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,   146,     1,    -1,   149,   150,   151,    -1,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,   146,
+       1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,
+      -1,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    90,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,    -1,   140,
+     141,   142,    -1,    -1,   145,   146,     1,    -1,   149,    -1,
+     151,    -1,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,     1,    -1,   149,   150,   151,    -1,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,     1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    64,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,   146,
+       1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      -1,    22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    66,    -1,    -1,    69,    70,
+      -1,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    90,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,    -1,   140,
+     141,   142,    -1,    -1,   145,   146,     1,    -1,   149,    -1,
+     151,    -1,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,     1,    -1,   149,   150,   151,    -1,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,     1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,   146,     1,    -1,   149,   150,   151,     6,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    -1,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,   146,
+       1,    -1,   149,    -1,   151,     6,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,
+      -1,    72,    -1,    74,    75,    76,    77,    78,    79,    -1,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,    -1,   140,
+     141,   142,    -1,    -1,   145,   146,     1,    -1,   149,    -1,
+     151,     6,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    74,
+      75,    76,    77,    78,    79,    -1,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,     1,    -1,   149,    -1,   151,     6,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    74,    75,    76,    77,    78,
+      79,    -1,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,     1,    -1,
+     149,    -1,   151,     6,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      -1,    74,    75,    76,    77,    78,    79,    -1,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    -1,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,
-      -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,
-      -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,    -1,   118,    -1,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,   139,
-      -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,
-     150,   151,    -1,   153,   154,   155,   156,     3,     4,     5,
-       6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,
-      76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
-      86,    87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,
-      -1,    97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,    -1,   118,    -1,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,
-     136,   137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,
-     146,   147,    -1,   149,    -1,   151,    -1,   153,   154,   155,
-     156,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,
-      72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,
-      82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,
-      92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,   101,
-      -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,    -1,   118,    -1,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-      -1,    -1,   134,   135,   136,   137,   138,   139,    -1,    -1,
-     142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,
-      -1,   153,   154,   155,   156,     3,     4,     5,     6,     7,
-      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,     6,    -1,   101,   102,   103,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,   127,    -1,   129,    37,    38,    -1,    -1,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,    60,    -1,
+      -1,    -1,   157,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    -1,    -1,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,     3,
+       4,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    23,
+      -1,    -1,   124,   125,    -1,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,    -1,    -1,    -1,    41,    -1,    -1,
+     142,    -1,    46,   145,    -1,    -1,    50,    -1,    -1,   151,
+      -1,    -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    83,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   105,   106,   107,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,    -1,   119,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,    -1,   130,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,
-      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,
-      -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,    -1,
-     118,    -1,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,
-     138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,
-      -1,   149,   150,   151,    -1,   153,   154,   155,   156,     3,
-       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,
+      -1,    -1,    -1,    -1,   148,    87,    -1,    -1,   152,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    29,    30,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,   153,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,
-      -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,
-      -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,    93,
-      -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,    -1,   118,    -1,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,
-     134,   135,   136,   137,   138,   139,    -1,    -1,   142,   143,
-      -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,   153,
-     154,   155,   156,     3,     4,     5,     6,     7,    -1,    -1,
-      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+     101,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,   127,    -1,   129,   101,
+     102,   103,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,   153,    -1,    -1,   127,    -1,   129,    29,    30,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,   153,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,
-      -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,
-      -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,    -1,   118,    -1,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,   139,
-      -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,
-     150,   151,    -1,   153,   154,   155,   156,     3,     4,     5,
-       6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+     101,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,   127,    -1,   129,   101,
+     102,   103,     9,    -1,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,   153,    -1,    -1,   127,    -1,   129,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,   153,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,     9,    -1,   151,    12,    13,   154,   155,   156,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,
-      76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
-      86,    87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,
-      -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,    -1,   118,    -1,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,
-     136,   137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,
-     146,   147,    -1,   149,    -1,   151,    -1,   153,   154,   155,
-     156,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,
-      92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,
-     112,   113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-      -1,    -1,   134,   135,   136,   137,   138,   139,    -1,    -1,
-     142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,
-      -1,   153,   154,   155,   156,     3,     4,     5,     6,     7,
-      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    76,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    87,
-      -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,   109,   110,   111,   112,   113,   114,    -1,   116,    -1,
-     118,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,
-     138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,
-      -1,   149,    -1,   151,    -1,   153,   154,   155,   156,     3,
-       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,    93,
-      -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,   111,   112,   113,
-     114,    -1,   116,    -1,   118,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,
-     134,   135,   136,   137,   138,   139,    -1,    -1,   142,   143,
-      -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,
-     154,   155,   156,     3,     4,     5,     6,     7,    -1,    -1,
-      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    87,    -1,    89,
-      -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,
-     110,   111,   112,   113,   114,    -1,   116,    -1,   118,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,   139,
-      -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,
-      -1,   151,    -1,   153,   154,   155,   156,     3,     4,     5,
-       6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      76,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,
-      -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,   111,   112,   113,   114,    -1,
-     116,    -1,   118,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,
-     136,   137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,
-     146,   147,    -1,   149,    -1,   151,    -1,   153,   154,   155,
-     156,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,
-      92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,
-     112,   113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-      -1,    -1,   134,   135,   136,   137,   138,   139,    -1,    -1,
-     142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,
-      -1,   153,   154,   155,   156,     3,     4,     5,     6,     7,
-      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,   153,   154,   155,   156,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,   153,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,   155,
-     156,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,     3,
-       4,     5,     6,     7,    -1,   135,   136,   137,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,
-      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,     3,     4,     5,     6,     7,
-      -1,   135,   136,   137,    12,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   146,    -1,    -1,    -1,    -1,   151,   152,    -1,
-     154,   155,   156,    31,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    26,    -1,   154,   155,   156,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    31,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
-     156,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,     3,
-       4,     5,     6,     7,    -1,   135,   136,   137,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    31,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,
-      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,     3,     4,     5,     6,     7,
-      -1,   135,   136,   137,    12,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,
-     154,   155,   156,    31,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,    31,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
-     156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,    -1,   135,   136,   137,    -1,    -1,
-      -1,     9,    10,    11,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-      -1,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,    -1,    -1,    -1,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   153,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   153,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   153,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   153,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,     9,    10,    11,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    29,    30,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   152,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   152,    25,    -1,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     152,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   152,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,     9,    10,    11,
+      -1,    -1,    87,    -1,    -1,   150,    91,    92,    93,    94,
+      95,   127,    97,   129,    -1,    -1,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,   152,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     152,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,     9,    10,    11,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     150,    25,    -1,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   150,    25,    -1,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,   150,    -1,    28,    -1,
+      -1,    -1,   127,    -1,   129,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,   150,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,    -1,
+      -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,    -1,
+      -1,   151,    -1,   153,   154,   155,   156,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,
+     155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,    -1,
+      -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,    -1,
+      -1,   151,    -1,   153,   154,   155,   156,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,   152,    -1,   154,
+     155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,    -1,
+      -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,    -1,
+      -1,   151,    12,    13,   154,   155,   156,    -1,    18,    19,
+      20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,     4,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    23,    -1,    -1,    26,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,    -1,
+      -1,    -1,   142,    -1,    41,   145,    -1,    -1,    -1,    46,
+      -1,   151,    -1,    50,   154,   155,   156,     5,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,   150,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   150,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   150,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,     9,    10,    11,    96,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    96,    -1,    -1,
+      -1,    29,    30,    -1,    -1,    -1,    83,    -1,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    55,   105,   106,
+     107,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,    -1,   119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   128,    -1,   130,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+      -1,   148,    -1,   101,   102,   103,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,   127,
+      97,   129,    -1,    -1,   101,   102,   103,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,
+      -1,    -1,    29,    30,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,   127,    -1,   129,   101,   102,   103,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,
+      -1,    91,    92,    93,    94,    95,    -1,    97,    -1,    -1,
+     127,   101,   129,   103,    -1,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,
+      29,    30,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    10,    11,    -1,    -1,    -1,
+      29,    30,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,    -1,   101,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    29,    -1,    -1,   127,    -1,
+     129,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,   129,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,
+     129,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    24,    -1,   127,    -1,   129,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    37,    -1,    -1,    87,    -1,    -1,
+      43,    91,    92,    93,    94,    95,    49,    97,    51,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    72,
+      -1,    -1,    -1,    76,    -1,    -1,    87,   127,    -1,   129,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    98,    -1,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,    -1,   110,   111,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    10,
+      11,    12,    13,    14,    15,    16,    17,    87,   131,   132,
+     133,    91,    92,    93,    94,    95,    87,    97,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    11,    49,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,
+      -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   159,   160,     0,     3,     4,     5,     6,     7,    12,
-      42,    43,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    62,    63,    70,    71,    72,    73,
-      76,    81,    82,    85,    86,    87,    89,    91,    92,    93,
-      97,    98,   106,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   118,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   134,   135,   136,   137,   138,   139,   142,   143,
-     144,   146,   147,   149,   151,   153,   154,   155,   156,   161,
-     162,   165,   168,   169,   175,   176,   178,   179,   180,   182,
-     220,   221,   224,   225,   234,   237,   241,   242,   244,   245,
-     249,   250,   251,   252,   253,   254,   255,   260,   268,   270,
-      72,   126,   136,   221,   241,   241,   151,   241,   241,   241,
-     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-     241,   126,   128,   161,   225,   244,   245,   251,   244,   241,
-     241,   126,   128,   161,   225,   227,   228,   251,   253,   254,
-     260,    81,    81,   146,   207,   151,   153,   241,   136,   153,
-     241,   151,   168,   217,   241,   151,   151,   231,   151,   151,
-     146,   155,   205,   206,   136,   151,   151,   151,   151,   128,
-     149,   161,   161,   153,   220,   241,   245,    88,    95,    99,
-     103,   146,   265,   266,    26,   151,   241,   149,   151,   128,
-     161,   163,   164,   151,   166,   241,    99,   232,   265,   149,
-      99,   265,   128,   151,     8,   153,   136,   136,    31,   177,
-     133,     9,    10,    11,    25,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    49,   153,    58,    59,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,   151,   133,   130,    61,   149,   155,   254,   177,
-     241,   128,   161,   133,   133,   128,   161,   133,   151,   233,
-     133,   130,   254,    13,     8,   153,    31,   241,   263,   264,
-     153,    13,   153,   136,   191,   147,     8,   153,   245,   152,
-     241,   218,   219,   241,   220,   245,   149,   242,   245,     8,
-     153,   153,   152,   241,   245,   269,   123,   245,   261,   262,
-     161,   160,   149,   153,   151,   153,   153,   245,   137,   241,
-     103,   266,    61,   130,    99,   103,   266,   241,   153,   166,
-     173,   174,   245,   161,    74,     8,   153,   241,   115,   150,
-     167,   168,   175,   176,   152,   154,   241,   156,   136,    31,
-     203,   204,   220,   245,   136,   107,   181,   107,   183,   136,
-     151,   136,   249,   254,   260,   241,   241,   241,    26,   241,
-     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
+       0,   159,   160,     0,     1,    12,    13,    18,    19,    20,
+      22,    24,    25,    28,    31,    36,    37,    38,    42,    43,
+      44,    46,    47,    49,    51,    52,    56,    57,    60,    69,
+      70,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    83,    84,    85,    86,    89,    90,    96,    98,    99,
+     100,   104,   108,   109,   110,   111,   113,   120,   124,   125,
+     126,   131,   132,   133,   134,   135,   136,   137,   140,   141,
+     142,   143,   145,   146,   149,   151,   153,   154,   155,   156,
+     161,   162,   165,   168,   169,   175,   176,   178,   179,   180,
+     182,   220,   221,   224,   225,   234,   237,   241,   242,   244,
+     245,   249,   250,   251,   252,   253,   254,   255,   260,   268,
+     270,   153,   108,   132,   133,   221,   241,   241,   241,   241,
+     241,    36,   151,   241,   241,   153,   241,   241,   133,   153,
+     241,   108,   111,   161,   225,   244,   245,   251,   151,   168,
+     241,   217,   241,   151,   151,   151,   231,    36,   151,   151,
+     145,   155,   205,   206,   133,   151,   151,   244,   241,   241,
+     241,   151,   151,   111,   149,   161,   108,   111,   161,   225,
+     227,   228,   251,   253,   254,   260,   161,   241,   241,   241,
+     241,   153,   220,   241,   245,    45,    54,    61,    65,   145,
+     265,   266,   145,   207,     6,   241,   151,   241,   149,   151,
+     241,   111,   161,   163,   164,   151,   166,   241,    61,   232,
+     265,   149,    61,   265,   111,   151,     3,   153,   133,   133,
+       9,   177,   118,     5,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    29,    30,    87,    91,    92,
+      93,    94,    95,    97,   101,   102,   103,   127,   129,   153,
+      46,    83,     4,    23,    41,    50,   105,   106,   107,   117,
+     119,   128,   130,   148,   151,   118,   114,    21,   149,   155,
+     254,   177,     9,   241,   263,   264,   153,     4,   153,   111,
+     161,   118,   118,   133,   191,   146,     3,   153,   245,   241,
+     152,   241,   218,   219,   241,   220,   245,   149,   242,   245,
+       3,   153,   153,   152,   241,   245,   269,    99,   245,   261,
+     262,   161,   160,   149,   153,   111,   161,   118,   151,   233,
+     118,   114,   254,   151,   153,   153,   245,   135,   241,    65,
+     266,    21,   114,    61,    65,   266,     4,     3,   153,   241,
+     153,   166,   173,   174,   245,   161,    26,     3,   153,   241,
+      80,   150,   167,   168,   175,   176,   152,   154,   241,   156,
+     133,     9,   203,   204,   220,   245,   133,    71,   181,    71,
+     183,   133,   151,   133,   249,   254,   260,     6,   241,   241,
      241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-     241,   227,    31,   241,   241,   241,   241,   241,   241,   241,
-     241,   241,   241,   241,   241,   203,   136,   249,   136,   149,
-     249,   257,   258,   259,   241,   256,   241,   152,   161,   136,
-     136,   161,   249,   203,   249,   257,    42,    43,    73,   126,
-     128,   135,   161,   225,   234,   235,   236,   146,   243,   245,
-      96,   152,     8,   239,   235,    13,     8,   152,   151,   241,
-     152,   152,   153,     8,    74,    74,   241,   206,   153,   152,
-       8,   152,   151,     8,   152,   151,   150,   160,   203,   150,
-      61,   150,   129,   136,   146,   267,   136,   152,   150,     8,
-     152,    74,   136,   164,   152,   151,   150,   243,   152,     8,
-      13,   126,   128,   161,   226,   117,   184,   185,   226,   149,
-     151,    73,   200,   201,   202,   226,   151,   151,   254,   241,
-      26,    63,   245,   152,   151,   151,   241,   151,   248,    61,
-     149,   157,   150,   152,   229,   235,   235,   151,   128,   161,
-      99,   133,    13,    31,   241,    31,   241,   235,   136,    26,
-     168,   190,   241,   218,   241,   245,    31,   187,   245,   150,
-      26,   168,   245,   261,   262,    13,   203,   150,   152,   241,
-     157,    26,   149,   192,    79,   174,   153,   136,    26,   168,
-     195,   152,    31,   220,   245,   235,   128,   161,   185,   149,
-       8,   208,   200,   152,     8,    31,   146,   203,   203,   241,
-     227,   203,   203,   150,   203,   246,   256,   241,   130,   230,
-     235,   238,   240,   161,   136,   235,   243,   243,    96,    13,
-     166,   152,   153,    96,   186,   245,   186,   166,   196,   152,
-     241,   152,   157,   153,   193,   153,   193,   151,   166,   153,
-     243,   161,   208,   226,    67,    68,    69,    70,    71,    72,
-      85,   145,   150,   209,   211,   212,   213,   214,   216,   152,
-     144,   222,   202,   146,    13,   152,   152,   233,   152,   152,
-     152,   130,   247,   157,   150,   257,    96,   152,     8,   239,
-      31,   241,   235,   100,   153,   218,   187,   152,   152,   197,
-      64,    65,   198,   150,   193,    78,    90,   104,   193,   150,
-     226,   105,   150,   136,   146,   215,   221,   214,     8,   153,
-     149,   151,   149,    31,   146,    13,   235,   257,   235,   235,
-     243,   153,   152,    26,   168,   189,   189,    64,    65,   199,
-     151,   168,   104,   241,    26,   153,   194,   153,   150,   146,
-     153,    13,    13,     8,   153,   177,   136,   166,    31,   146,
-     223,   166,   146,    13,   235,   248,    96,    26,   168,   188,
-     166,   151,    26,    66,   241,   153,   194,   166,   152,   235,
-     235,   146,   136,    13,   150,   146,     8,   152,   150,    13,
-     235,   235,   166,   102,   241,   166,   153,   152,   166,   149,
-      13,   151,   235,    31,   146,   235,   101,   153,   152,   168,
-     166,   235,   200,   146,   153,    26,   150,   152,   166,    79,
-     170,   171,   172,   149,   153,   210,   151,   172,   166,   226,
-     150,   146,   152,   149,   166,   150
+     241,   241,   227,   241,   241,   241,   241,   241,   241,   241,
+     241,   241,   241,   241,     9,   241,   241,   241,   241,   241,
+     241,   241,   241,   241,   241,   241,   241,   203,   133,   249,
+     133,   149,   249,   257,   258,   259,   241,   256,   241,   243,
+     245,    55,   152,     3,   239,    12,    13,    24,   108,   111,
+     131,   161,   225,   234,   235,   236,   161,   133,   133,     4,
+       3,   152,   151,   241,   152,   152,   152,   153,     3,    26,
+      26,   241,   206,   153,   152,     3,   152,   151,     3,   152,
+     151,   150,   160,   161,   249,   203,   249,   257,   203,   150,
+      21,   150,   112,   133,   145,   267,   133,   235,   145,   152,
+     150,     3,   152,    26,   133,   164,   152,   151,   150,   243,
+     152,     3,     4,   108,   111,   161,   226,    82,   184,   185,
+     226,   149,   151,    24,   200,   201,   202,   226,   151,   151,
+     254,   241,     6,   109,   245,   152,   151,   151,   241,   151,
+     248,    21,   149,   157,   150,     9,   241,     9,   241,   235,
+     235,   151,   111,   161,    61,   118,   235,   133,     6,   168,
+     190,   241,   218,   241,   245,     9,   187,   245,   150,     6,
+     168,   245,   261,   262,     4,   203,   150,   152,   229,   152,
+     241,   157,     4,     6,   149,   192,    34,   174,   153,   133,
+       6,   168,   195,   152,     9,   220,   245,   235,   111,   161,
+     185,   149,     3,   208,   200,   152,     3,     9,   145,   203,
+     203,   241,   227,   203,   203,   150,   203,   246,   256,   241,
+     243,   243,    55,   235,   238,   240,   161,   133,     4,   166,
+     152,   153,    55,   186,   245,   186,   166,   196,   152,   241,
+     152,   114,   230,   157,   235,   153,   193,   153,   193,   151,
+     166,   153,   243,   161,   208,   226,     1,    22,    42,    73,
+     121,   122,   123,   132,   144,   150,   209,   211,   212,   213,
+     214,   216,   152,   143,   222,   202,   145,     4,   152,   152,
+     233,   152,   152,   152,   114,   247,   157,   150,     9,   241,
+      55,   152,     3,   239,   235,    62,   153,   218,   187,   152,
+     152,   197,    58,    59,   198,   257,   150,   193,    33,    48,
+      67,   193,   150,   226,    68,   150,   153,   133,   145,   215,
+     221,   214,     3,   153,   149,   151,   149,     9,   145,     4,
+     235,   257,   243,   235,   235,   153,   152,     6,   168,   189,
+     189,    58,    59,   199,   168,   151,    67,   241,     6,   153,
+     194,   153,   150,   145,   153,     4,     4,     3,   153,   177,
+     133,   166,     9,   145,   223,   166,   145,     4,   235,   248,
+      55,     6,   168,   188,   166,     6,   151,    66,   241,   153,
+     194,   166,   152,   235,   235,   145,   133,     4,   150,   145,
+       3,   152,   150,     4,   235,   235,   166,    64,   166,   241,
+     153,   152,   166,   149,     4,   151,   235,     9,   145,   235,
+      63,   153,   152,   168,   166,   235,   200,   145,   153,     6,
+     150,   152,   166,    34,   170,   171,   172,   149,   153,   210,
+     151,   172,   166,   226,   150,   145,   152,   149,   166,   150
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
+     162,   162,   162,   162,   162,   162,   163,   163,   164,   164,
+     164,   164,   165,   165,   166,   166,   167,   167,   167,   167,
+     168,   168,   168,   169,   169,   169,   169,   169,   169,   169,
+     169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
+     169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
+     170,   170,   171,   171,   172,   173,   173,   174,   175,   176,
+     177,   177,   178,   179,   179,   180,   180,   180,   181,   181,
+     182,   183,   183,   184,   184,   185,   185,   186,   186,   187,
+     187,   188,   188,   189,   189,   190,   190,   191,   191,   192,
+     192,   192,   192,   193,   193,   193,   194,   194,   195,   195,
+     196,   196,   197,   197,   198,   198,   199,   199,   200,   200,
+     201,   201,   201,   201,   201,   201,   201,   201,   202,   202,
+     202,   203,   203,   204,   204,   204,   204,   204,   204,   205,
+     205,   206,   206,   206,   207,   207,   207,   207,   208,   208,
+     209,   209,   209,   209,   210,   210,   211,   211,   212,   212,
+     213,   213,   214,   214,   214,   214,   214,   214,   215,   215,
+     215,   215,   216,   216,   217,   217,   218,   218,   219,   219,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   221,   222,
+     222,   223,   223,   223,   223,   224,   224,   224,   224,   224,
+     224,   224,   224,   225,   225,   225,   225,   226,   226,   226,
+     227,   227,   228,   228,   229,   229,   230,   231,   231,   231,
+     232,   232,   232,   233,   233,   234,   234,   234,   234,   234,
+     234,   234,   234,   234,   234,   234,   234,   235,   235,   235,
+     235,   235,   235,   235,   235,   236,   237,   237,   237,   237,
+     237,   237,   237,   237,   238,   238,   239,   239,   240,   240,
+     240,   240,   241,   241,   242,   243,   244,   245,   245,   246,
+     246,   247,   248,   248,   249,   249,   250,   250,   251,   252,
+     252,   253,   253,   253,   254,   254,   254,   255,   255,   256,
+     256,   257,   257,   258,   258,   258,   259,   259,   260,   260,
+     261,   261,   262,   262,   262,   263,   263,   264,   264,   264,
+     264,   264,   264,   264,   264,   265,   265,   265,   265,   266,
+     266,   266,   266,   266,   266,   267,   267,   267,   268,   268,
+     268,   268,   268,   268,   268,   269,   269,   270,   270
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
+       4,     3,     5,     4,     3,     2,     3,     1,     1,     3,
+       2,     4,     5,     4,     2,     0,     1,     1,     1,     4,
+       1,     2,     2,     3,     7,    10,     5,     7,     9,     5,
+       2,     3,     2,     3,     2,     3,     3,     3,     3,     3,
+       1,     2,     5,     8,     8,     5,     1,    13,     3,     3,
+       1,     0,     1,     2,     8,     1,     3,     1,     1,     1,
+       0,     1,     9,     7,     6,     1,     2,     2,     0,     2,
+       1,     0,     2,     0,     2,     1,     3,     0,     2,     1,
+       2,     1,     4,     1,     4,     1,     4,     3,     5,     3,
+       4,     4,     5,     0,     5,     4,     1,     1,     1,     4,
+       0,     6,     0,     7,     0,     2,     0,     3,     1,     0,
+       2,     3,     5,     4,     4,     5,     7,     6,     0,     1,
+       1,     1,     0,     1,     1,     2,     3,     3,     4,     3,
+       1,     1,     2,     4,     3,     5,     1,     3,     2,     0,
+       3,     2,     8,     2,     1,     3,     1,     1,     0,     1,
+       1,     2,     1,     1,     1,     1,     1,     1,     3,     5,
+       1,     3,     5,     4,     3,     1,     0,     1,     3,     1,
+       6,     3,     4,     6,     3,     2,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     2,     2,
+       2,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     2,     2,
+       2,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     5,     4,     1,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     4,     3,     2,     9,     1,     0,
+       4,     3,     4,     1,     2,     4,     6,     5,     6,     6,
+       6,     6,     4,     1,     1,     3,     2,     1,     3,     2,
+       1,     1,     4,     1,     2,     0,     2,     0,     2,     3,
+       0,     1,     1,     0,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     2,     1,     1,     3,
+       2,     2,     2,     4,     1,     3,     1,     1,     1,     3,
+       2,     1,     3,     3,     0,     2,     0,     1,     5,     3,
+       3,     1,     1,     1,     1,     1,     1,     5,     1,     2,
+       0,     3,     3,     0,     1,     2,     3,     3,     1,     1,
+       1,     1,     2,     1,     4,     4,     1,     1,     4,     0,
+       1,     1,     1,     4,     4,     1,     1,     3,     1,     2,
+       3,     1,     1,     4,     0,     0,     2,     5,     3,     3,
+       1,     6,     4,     4,     2,     2,     2,     1,     2,     1,
+       4,     3,     3,     6,     3,     1,     1,     1,     4,     4,
+       2,     2,     4,     2,     2,     1,     3,     3,     3
+};
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (analyzer, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
 
+enum { YYENOMEM = -2 };
 
-/* This macro is provided for backward compatibility. */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = PHP53_LINT_EMPTY)
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == PHP53_LINT_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (analyzer, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use PHP53_LINT_error or PHP53_LINT_UNDEF. */
+#define YYERRCODE PHP53_LINT_UNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, analyzer)
-#endif
 
 /* Enable debugging if requested.  */
-#if YYDEBUG
+#if PHP53_LINT_DEBUG
 
 # ifndef YYFPRINTF
 #  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, analyzer); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, analyzer); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (analyzer);
   if (!yyvaluep)
     return;
-  YYUSE (analyzer);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, analyzer);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -3049,16 +3479,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -3069,64 +3491,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, pelet::LexicalAnalyzerClass &analyzer)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule, analyzer)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    pelet::LexicalAnalyzerClass &analyzer;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, pelet::LexicalAnalyzerClass &analyzer)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , analyzer);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], analyzer);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, analyzer); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, analyzer); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+#else /* !PHP53_LINT_DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
+#endif /* !PHP53_LINT_DEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -3142,47 +3556,80 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static char *
 yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
 {
   char *yyd = yydest;
   const char *yys = yysrc;
@@ -3192,10 +3639,10 @@ yystpcpy (yydest, yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -3203,75 +3650,56 @@ yystpcpy (yydest, yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -3294,60 +3722,79 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
   if (*yymsg_alloc < yysize)
     {
@@ -3355,7 +3802,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -3367,141 +3814,96 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep, analyzer)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer)
 {
-  YYUSE (yyvaluep);
-  YYUSE (analyzer);
-
+  YY_USE (yyvaluep);
+  YY_USE (analyzer);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (pelet::LexicalAnalyzerClass &analyzer);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
+
+
 
 
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (pelet::LexicalAnalyzerClass &analyzer)
-#else
-int
-yyparse (analyzer)
-    pelet::LexicalAnalyzerClass &analyzer;
-#endif
-#endif
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
+
 /* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3509,111 +3911,107 @@ YYSTYPE yylval;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = PHP53_LINT_EMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -3624,18 +4022,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == PHP53_LINT_EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, analyzer);
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= T_END)
     {
-      yychar = yytoken = YYEOF;
+      yychar = T_END;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == PHP53_LINT_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = PHP53_LINT_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3663,13 +4072,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = PHP53_LINT_EMPTY;
   goto yynewstate;
 
 
@@ -3684,14 +4093,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3704,10 +4113,21 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-      
+  case 32: /* statement: error ';'  */
+#line 286 "/root/repo/src/Php53LintParser.y"
+                                                                { yyerrok; }
+#line 4120 "/root/repo/src/Php53LintParser.cpp"
+    break;
+
+  case 153: /* class_statement: error ';'  */
+#line 590 "/root/repo/src/Php53LintParser.y"
+                                                                                                                { yyerrok; }
+#line 4126 "/root/repo/src/Php53LintParser.cpp"
+    break;
+
+
+#line 4130 "/root/repo/src/Php53LintParser.cpp"
 
-/* Line 1806 of yacc.c  */
-#line 3711 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53LintParser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -3721,96 +4141,88 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == PHP53_LINT_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (analyzer, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (analyzer, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= T_END)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == T_END)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, analyzer);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, analyzer);
+          yychar = PHP53_LINT_EMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -3822,14 +4234,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3842,39 +4253,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, analyzer);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, analyzer);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3885,27 +4299,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (analyzer, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEMPTY)
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != PHP53_LINT_EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -3913,31 +4331,24 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, analyzer);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, analyzer);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, analyzer);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  return yyresult;
 }
 
-
-
-/* Line 2067 of yacc.c  */
-#line 1069 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53LintParser.y"
-
+#line 1071 "/root/repo/src/Php53LintParser.y"
 
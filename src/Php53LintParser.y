@@ -31,7 +31,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE int
+#define PHP53_LINT_STYPE int
 
 // so that both bison parses call the same lex function
 #define php53_lint_lex pelet::LintLex
@@ -46,8 +46,8 @@
 
 %define api.pure
 %expect 2
-%error-verbose
-%name-prefix "php53_lint_"
+%define parse.error verbose
+%define api.prefix {php53_lint_}
 %debug
 
 %left T_INCLUDE T_INCLUDE_ONCE T_EVAL T_REQUIRE T_REQUIRE_ONCE
@@ -283,6 +283,7 @@ inner_statement:
 statement:
 		unticked_statement 
 	|	T_STRING ':' 
+	|	error ';'					{ yyerrok; }
 ;
 
 unticked_statement:
@@ -586,6 +587,7 @@ class_statement:
 	|	class_constant_declaration ';'
 	|	method_modifiers function is_reference T_STRING  '('
 			parameter_list ')' method_body 
+	|	error ';'											{ yyerrok; }
 ;
 
 
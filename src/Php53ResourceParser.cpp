@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -53,275 +58,654 @@
 #define YYPURE 1
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
+/* Substitute the type names.  */
+#define YYSTYPE         PHP53_RESOURCE_STYPE
 /* Substitute the variable and function names.  */
 #define yyparse         php53_resource_parse
+#define yypush_parse    php53_resource_push_parse
+#define yypull_parse    php53_resource_pull_parse
+#define yypstate_new    php53_resource_pstate_new
+#define yypstate_clear  php53_resource_pstate_clear
+#define yypstate_delete php53_resource_pstate_delete
+#define yypstate        php53_resource_pstate
 #define yylex           php53_resource_lex
 #define yyerror         php53_resource_error
-#define yylval          php53_resource_lval
-#define yychar          php53_resource_char
 #define yydebug         php53_resource_debug
 #define yynerrs         php53_resource_nerrs
 
+/* First part of user prologue.  */
+#line 1 "/root/repo/src/Php53ResourceParser.y"
+
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */	
+#include <pelet/LexicalAnalyzerClass.h>
+#include <pelet/ResourceParserObserverClass.h>
+#include <pelet/LintParserFunctions.h>
+#include <pelet/TokenClass.h>
+ 
+ #if defined(_MSC_VER)
+    #pragma warning(disable:4065) // Bison generates a switch statement without a case
+ #endif
+ 
+#define PHP53_RESOURCE_STYPE pelet::ResourceParserTypeClass
+
+// so that both bison parses call the same lex function
+#define php53_resource_lex pelet::ResourceLex
+
+// so that both bison parses call the same error function
+#define php53_resource_error pelet::ResourceGrammarError
+
+
+#line 127 "/root/repo/src/Php53ResourceParser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
-#line 1 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-
-/**
- * This software is released under the terms of the MIT License
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
- * THE SOFTWARE.
- *
- * @copyright  2012 Roberto Perpuly
- * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
- */	
-#include <pelet/LexicalAnalyzerClass.h>
-#include <pelet/ResourceParserObserverClass.h>
-#include <pelet/LintParserFunctions.h>
-#include <pelet/TokenClass.h>
- 
- #if defined(_MSC_VER)
-    #pragma warning(disable:4065) // Bison generates a switch statement without a case
- #endif
- 
-#define YYSTYPE pelet::ResourceParserTypeClass
-
-// so that both bison parses call the same lex function
-#define php53_resource_lex pelet::ResourceLex
-
-// so that both bison parses call the same error function
-#define php53_resource_error pelet::ResourceGrammarError
-
-
-
-/* Line 268 of yacc.c  */
-#line 124 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.cpp"
-
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
+/* Debug traces.  */
+#ifndef PHP53_RESOURCE_DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define PHP53_RESOURCE_DEBUG 1
+#  else
+#   define PHP53_RESOURCE_DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define PHP53_RESOURCE_DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined PHP53_RESOURCE_DEBUG */
+#if PHP53_RESOURCE_DEBUG
+extern int php53_resource_debug;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
+/* Token kinds.  */
+#ifndef PHP53_RESOURCE_TOKENTYPE
+# define PHP53_RESOURCE_TOKENTYPE
+  enum php53_resource_tokentype
+  {
+    PHP53_RESOURCE_EMPTY = -2,
+    T_END = 0,                     /* T_END  */
+    PHP53_RESOURCE_error = 256,    /* error  */
+    PHP53_RESOURCE_UNDEF = 629,    /* "invalid token"  */
+    T_ABSTRACT = 502,              /* T_ABSTRACT  */
+    T_AND_EQUAL = 503,             /* T_AND_EQUAL  */
+    T_ARRAY = 504,                 /* T_ARRAY  */
+    T_ARRAY_CAST = 505,            /* T_ARRAY_CAST  */
+    T_AS = 506,                    /* T_AS  */
+    T_BAD_CHARACTER = 507,         /* T_BAD_CHARACTER  */
+    T_BOOL_CAST = 508,             /* T_BOOL_CAST  */
+    T_BOOLEAN_AND = 509,           /* T_BOOLEAN_AND  */
+    T_BOOLEAN_OR = 510,            /* T_BOOLEAN_OR  */
+    T_BREAK = 511,                 /* T_BREAK  */
+    T_CALLABLE = 512,              /* T_CALLABLE  */
+    T_CASE = 513,                  /* T_CASE  */
+    T_CATCH = 514,                 /* T_CATCH  */
+    T_CHARACTER = 515,             /* T_CHARACTER  */
+    T_CLASS = 516,                 /* T_CLASS  */
+    T_CLASS_C = 517,               /* T_CLASS_C  */
+    T_CLONE = 518,                 /* T_CLONE  */
+    T_CLOSE_TAG = 519,             /* T_CLOSE_TAG  */
+    T_COMMENT = 520,               /* T_COMMENT  */
+    T_CONCAT_EQUAL = 521,          /* T_CONCAT_EQUAL  */
+    T_CONST = 522,                 /* T_CONST  */
+    T_CONSTANT_ENCAPSED_STRING = 523, /* T_CONSTANT_ENCAPSED_STRING  */
+    T_CONTINUE = 524,              /* T_CONTINUE  */
+    T_CURLY_OPEN = 525,            /* T_CURLY_OPEN  */
+    T_DEC = 526,                   /* T_DEC  */
+    T_DECLARE = 527,               /* T_DECLARE  */
+    T_DEFAULT = 528,               /* T_DEFAULT  */
+    T_DIR = 529,                   /* T_DIR  */
+    T_DIV_EQUAL = 530,             /* T_DIV_EQUAL  */
+    T_DNUMBER = 531,               /* T_DNUMBER  */
+    T_DO = 532,                    /* T_DO  */
+    T_DOC_COMMENT = 533,           /* T_DOC_COMMENT  */
+    T_DOLLAR_OPEN_CURLY_BRACES = 534, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+    T_DOUBLE_ARROW = 535,          /* T_DOUBLE_ARROW  */
+    T_DOUBLE_CAST = 536,           /* T_DOUBLE_CAST  */
+    T_ECHO = 537,                  /* T_ECHO  */
+    T_ELSE = 538,                  /* T_ELSE  */
+    T_ELSEIF = 539,                /* T_ELSEIF  */
+    T_EMPTY = 540,                 /* T_EMPTY  */
+    T_ENCAPSED_AND_WHITESPACE = 541, /* T_ENCAPSED_AND_WHITESPACE  */
+    T_ENDDECLARE = 542,            /* T_ENDDECLARE  */
+    T_ENDFOR = 543,                /* T_ENDFOR  */
+    T_ENDFOREACH = 544,            /* T_ENDFOREACH  */
+    T_END_HEREDOC = 545,           /* T_END_HEREDOC  */
+    T_ENDIF = 546,                 /* T_ENDIF  */
+    T_ENDSWITCH = 547,             /* T_ENDSWITCH  */
+    T_ENDWHILE = 548,              /* T_ENDWHILE  */
+    T_EVAL = 549,                  /* T_EVAL  */
+    T_EXIT = 550,                  /* T_EXIT  */
+    T_EXTENDS = 551,               /* T_EXTENDS  */
+    T_FILE = 552,                  /* T_FILE  */
+    T_FINAL = 553,                 /* T_FINAL  */
+    T_FOR = 554,                   /* T_FOR  */
+    T_FOREACH = 555,               /* T_FOREACH  */
+    T_FUNC_C = 556,                /* T_FUNC_C  */
+    T_FUNCTION = 557,              /* T_FUNCTION  */
+    T_GLOBAL = 558,                /* T_GLOBAL  */
+    T_GOTO = 559,                  /* T_GOTO  */
+    T_HALT_COMPILER = 560,         /* T_HALT_COMPILER  */
+    T_IF = 561,                    /* T_IF  */
+    T_IMPLEMENTS = 562,            /* T_IMPLEMENTS  */
+    T_INC = 563,                   /* T_INC  */
+    T_INCLUDE = 564,               /* T_INCLUDE  */
+    T_INCLUDE_ONCE = 565,          /* T_INCLUDE_ONCE  */
+    T_INLINE_HTML = 566,           /* T_INLINE_HTML  */
+    T_INSTANCEOF = 567,            /* T_INSTANCEOF  */
+    T_INSTEADOF = 568,             /* T_INSTEADOF  */
+    T_INT_CAST = 569,              /* T_INT_CAST  */
+    T_INTERFACE = 570,             /* T_INTERFACE  */
+    T_IS_EQUAL = 571,              /* T_IS_EQUAL  */
+    T_IS_GREATER_OR_EQUAL = 572,   /* T_IS_GREATER_OR_EQUAL  */
+    T_IS_IDENTICAL = 573,          /* T_IS_IDENTICAL  */
+    T_IS_NOT_EQUAL = 574,          /* T_IS_NOT_EQUAL  */
+    T_IS_NOT_IDENTICAL = 575,      /* T_IS_NOT_IDENTICAL  */
+    T_ISSET = 576,                 /* T_ISSET  */
+    T_IS_SMALLER_OR_EQUAL = 577,   /* T_IS_SMALLER_OR_EQUAL  */
+    T_LINE = 578,                  /* T_LINE  */
+    T_LIST = 579,                  /* T_LIST  */
+    T_LNUMBER = 580,               /* T_LNUMBER  */
+    T_LOGICAL_AND = 581,           /* T_LOGICAL_AND  */
+    T_LOGICAL_OR = 582,            /* T_LOGICAL_OR  */
+    T_LOGICAL_XOR = 583,           /* T_LOGICAL_XOR  */
+    T_METHOD_C = 584,              /* T_METHOD_C  */
+    T_MINUS_EQUAL = 585,           /* T_MINUS_EQUAL  */
+    T_MOD_EQUAL = 586,             /* T_MOD_EQUAL  */
+    T_MUL_EQUAL = 587,             /* T_MUL_EQUAL  */
+    T_NAMESPACE = 588,             /* T_NAMESPACE  */
+    T_NEW = 589,                   /* T_NEW  */
+    T_NS_C = 590,                  /* T_NS_C  */
+    T_NS_SEPARATOR = 591,          /* T_NS_SEPARATOR  */
+    T_NUM_STRING = 592,            /* T_NUM_STRING  */
+    T_OBJECT_CAST = 593,           /* T_OBJECT_CAST  */
+    T_OBJECT_OPERATOR = 594,       /* T_OBJECT_OPERATOR  */
+    T_OPEN_TAG = 595,              /* T_OPEN_TAG  */
+    T_OPEN_TAG_WITH_ECHO = 596,    /* T_OPEN_TAG_WITH_ECHO  */
+    T_OR_EQUAL = 597,              /* T_OR_EQUAL  */
+    T_PAAMAYIM_NEKUDOTAYIM = 598,  /* T_PAAMAYIM_NEKUDOTAYIM  */
+    T_PLUS_EQUAL = 599,            /* T_PLUS_EQUAL  */
+    T_PRINT = 600,                 /* T_PRINT  */
+    T_PRIVATE = 601,               /* T_PRIVATE  */
+    T_PROTECTED = 602,             /* T_PROTECTED  */
+    T_PUBLIC = 603,                /* T_PUBLIC  */
+    T_REQUIRE = 604,               /* T_REQUIRE  */
+    T_REQUIRE_ONCE = 605,          /* T_REQUIRE_ONCE  */
+    T_RETURN = 606,                /* T_RETURN  */
+    T_SL = 607,                    /* T_SL  */
+    T_SL_EQUAL = 608,              /* T_SL_EQUAL  */
+    T_SR = 609,                    /* T_SR  */
+    T_SR_EQUAL = 610,              /* T_SR_EQUAL  */
+    T_START_HEREDOC = 611,         /* T_START_HEREDOC  */
+    T_STATIC = 612,                /* T_STATIC  */
+    T_STRING = 613,                /* T_STRING  */
+    T_STRING_CAST = 614,           /* T_STRING_CAST  */
+    T_STRING_VARNAME = 615,        /* T_STRING_VARNAME  */
+    T_SWITCH = 616,                /* T_SWITCH  */
+    T_THROW = 617,                 /* T_THROW  */
+    T_TRAIT = 618,                 /* T_TRAIT  */
+    T_TRAIT_C = 619,               /* T_TRAIT_C  */
+    T_TRY = 620,                   /* T_TRY  */
+    T_UNSET = 621,                 /* T_UNSET  */
+    T_UNSET_CAST = 622,            /* T_UNSET_CAST  */
+    T_USE = 623,                   /* T_USE  */
+    T_VAR = 624,                   /* T_VAR  */
+    T_VARIABLE = 625,              /* T_VARIABLE  */
+    T_WHILE = 626,                 /* T_WHILE  */
+    T_WHITESPACE = 627,            /* T_WHITESPACE  */
+    T_XOR_EQUAL = 628              /* T_XOR_EQUAL  */
+  };
+  typedef enum php53_resource_tokentype php53_resource_token_kind_t;
 #endif
 
+/* Value type.  */
+
+
+
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_END = 0,
-     T_REQUIRE_ONCE = 605,
-     T_REQUIRE = 604,
-     T_EVAL = 549,
-     T_INCLUDE_ONCE = 565,
-     T_INCLUDE = 564,
-     T_LOGICAL_OR = 582,
-     T_LOGICAL_XOR = 583,
-     T_LOGICAL_AND = 581,
-     T_PRINT = 600,
-     T_SR_EQUAL = 610,
-     T_SL_EQUAL = 608,
-     T_XOR_EQUAL = 628,
-     T_OR_EQUAL = 597,
-     T_AND_EQUAL = 503,
-     T_MOD_EQUAL = 586,
-     T_CONCAT_EQUAL = 521,
-     T_DIV_EQUAL = 530,
-     T_MUL_EQUAL = 587,
-     T_MINUS_EQUAL = 585,
-     T_PLUS_EQUAL = 599,
-     T_BOOLEAN_OR = 510,
-     T_BOOLEAN_AND = 509,
-     T_IS_NOT_IDENTICAL = 575,
-     T_IS_IDENTICAL = 573,
-     T_IS_NOT_EQUAL = 574,
-     T_IS_EQUAL = 571,
-     T_IS_GREATER_OR_EQUAL = 572,
-     T_IS_SMALLER_OR_EQUAL = 577,
-     T_SR = 609,
-     T_SL = 607,
-     T_INSTANCEOF = 567,
-     T_UNSET_CAST = 622,
-     T_BOOL_CAST = 508,
-     T_OBJECT_CAST = 593,
-     T_ARRAY_CAST = 505,
-     T_STRING_CAST = 614,
-     T_DOUBLE_CAST = 536,
-     T_INT_CAST = 569,
-     T_DEC = 526,
-     T_INC = 563,
-     T_CLONE = 518,
-     T_NEW = 589,
-     T_ELSEIF = 539,
-     T_ELSE = 538,
-     T_ENDIF = 546,
-     T_PUBLIC = 603,
-     T_PROTECTED = 602,
-     T_PRIVATE = 601,
-     T_FINAL = 553,
-     T_ABSTRACT = 502,
-     T_STATIC = 612,
-     T_ARRAY = 504,
-     T_AS = 506,
-     T_BAD_CHARACTER = 507,
-     T_BREAK = 511,
-     T_CALLABLE = 512,
-     T_CASE = 513,
-     T_CATCH = 514,
-     T_CHARACTER = 515,
-     T_CLASS = 516,
-     T_CLASS_C = 517,
-     T_CLOSE_TAG = 519,
-     T_COMMENT = 520,
-     T_CONST = 522,
-     T_CONSTANT_ENCAPSED_STRING = 523,
-     T_CONTINUE = 524,
-     T_CURLY_OPEN = 525,
-     T_DECLARE = 527,
-     T_DEFAULT = 528,
-     T_DIR = 529,
-     T_DNUMBER = 531,
-     T_DO = 532,
-     T_DOC_COMMENT = 533,
-     T_DOLLAR_OPEN_CURLY_BRACES = 534,
-     T_DOUBLE_ARROW = 535,
-     T_ECHO = 537,
-     T_EMPTY = 540,
-     T_ENCAPSED_AND_WHITESPACE = 541,
-     T_ENDDECLARE = 542,
-     T_ENDFOR = 543,
-     T_ENDFOREACH = 544,
-     T_END_HEREDOC = 545,
-     T_ENDSWITCH = 547,
-     T_ENDWHILE = 548,
-     T_EXIT = 550,
-     T_EXTENDS = 551,
-     T_FILE = 552,
-     T_FOR = 554,
-     T_FOREACH = 555,
-     T_FUNC_C = 556,
-     T_FUNCTION = 557,
-     T_GLOBAL = 558,
-     T_GOTO = 559,
-     T_HALT_COMPILER = 560,
-     T_IF = 561,
-     T_IMPLEMENTS = 562,
-     T_INLINE_HTML = 566,
-     T_INSTEADOF = 568,
-     T_INTERFACE = 570,
-     T_ISSET = 576,
-     T_LINE = 578,
-     T_LIST = 579,
-     T_LNUMBER = 580,
-     T_METHOD_C = 584,
-     T_NAMESPACE = 588,
-     T_NS_C = 590,
-     T_NS_SEPARATOR = 591,
-     T_NUM_STRING = 592,
-     T_OBJECT_OPERATOR = 594,
-     T_OPEN_TAG = 595,
-     T_OPEN_TAG_WITH_ECHO = 596,
-     T_PAAMAYIM_NEKUDOTAYIM = 598,
-     T_RETURN = 606,
-     T_START_HEREDOC = 611,
-     T_STRING = 613,
-     T_STRING_VARNAME = 615,
-     T_SWITCH = 616,
-     T_THROW = 617,
-     T_TRAIT = 618,
-     T_TRAIT_C = 619,
-     T_TRY = 620,
-     T_UNSET = 621,
-     T_USE = 623,
-     T_VAR = 624,
-     T_VARIABLE = 625,
-     T_WHILE = 626,
-     T_WHITESPACE = 627
-   };
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
 #endif
 
+typedef struct php53_resource_pstate php53_resource_pstate;
 
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+int php53_resource_parse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+int php53_resource_push_parse (php53_resource_pstate *ps,
+                  int pushed_char, PHP53_RESOURCE_STYPE const *pushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+int php53_resource_pull_parse (php53_resource_pstate *ps, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+php53_resource_pstate *php53_resource_pstate_new (void);
+void php53_resource_pstate_delete (php53_resource_pstate *ps);
+
 
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* T_END  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ','  */
+  YYSYMBOL_4_ = 4,                         /* '='  */
+  YYSYMBOL_5_ = 5,                         /* '?'  */
+  YYSYMBOL_6_ = 6,                         /* ':'  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_12_ = 12,                       /* '+'  */
+  YYSYMBOL_13_ = 13,                       /* '-'  */
+  YYSYMBOL_14_ = 14,                       /* '.'  */
+  YYSYMBOL_15_ = 15,                       /* '*'  */
+  YYSYMBOL_16_ = 16,                       /* '/'  */
+  YYSYMBOL_17_ = 17,                       /* '%'  */
+  YYSYMBOL_18_ = 18,                       /* '!'  */
+  YYSYMBOL_19_ = 19,                       /* '~'  */
+  YYSYMBOL_20_ = 20,                       /* '@'  */
+  YYSYMBOL_21_ = 21,                       /* '['  */
+  YYSYMBOL_T_ABSTRACT = 22,                /* T_ABSTRACT  */
+  YYSYMBOL_T_AND_EQUAL = 23,               /* T_AND_EQUAL  */
+  YYSYMBOL_T_ARRAY = 24,                   /* T_ARRAY  */
+  YYSYMBOL_T_ARRAY_CAST = 25,              /* T_ARRAY_CAST  */
+  YYSYMBOL_T_AS = 26,                      /* T_AS  */
+  YYSYMBOL_T_BAD_CHARACTER = 27,           /* T_BAD_CHARACTER  */
+  YYSYMBOL_T_BOOL_CAST = 28,               /* T_BOOL_CAST  */
+  YYSYMBOL_T_BOOLEAN_AND = 29,             /* T_BOOLEAN_AND  */
+  YYSYMBOL_T_BOOLEAN_OR = 30,              /* T_BOOLEAN_OR  */
+  YYSYMBOL_T_BREAK = 31,                   /* T_BREAK  */
+  YYSYMBOL_T_CALLABLE = 32,                /* T_CALLABLE  */
+  YYSYMBOL_T_CASE = 33,                    /* T_CASE  */
+  YYSYMBOL_T_CATCH = 34,                   /* T_CATCH  */
+  YYSYMBOL_T_CHARACTER = 35,               /* T_CHARACTER  */
+  YYSYMBOL_T_CLASS = 36,                   /* T_CLASS  */
+  YYSYMBOL_T_CLASS_C = 37,                 /* T_CLASS_C  */
+  YYSYMBOL_T_CLONE = 38,                   /* T_CLONE  */
+  YYSYMBOL_T_CLOSE_TAG = 39,               /* T_CLOSE_TAG  */
+  YYSYMBOL_T_COMMENT = 40,                 /* T_COMMENT  */
+  YYSYMBOL_T_CONCAT_EQUAL = 41,            /* T_CONCAT_EQUAL  */
+  YYSYMBOL_T_CONST = 42,                   /* T_CONST  */
+  YYSYMBOL_T_CONSTANT_ENCAPSED_STRING = 43, /* T_CONSTANT_ENCAPSED_STRING  */
+  YYSYMBOL_T_CONTINUE = 44,                /* T_CONTINUE  */
+  YYSYMBOL_T_CURLY_OPEN = 45,              /* T_CURLY_OPEN  */
+  YYSYMBOL_T_DEC = 46,                     /* T_DEC  */
+  YYSYMBOL_T_DECLARE = 47,                 /* T_DECLARE  */
+  YYSYMBOL_T_DEFAULT = 48,                 /* T_DEFAULT  */
+  YYSYMBOL_T_DIR = 49,                     /* T_DIR  */
+  YYSYMBOL_T_DIV_EQUAL = 50,               /* T_DIV_EQUAL  */
+  YYSYMBOL_T_DNUMBER = 51,                 /* T_DNUMBER  */
+  YYSYMBOL_T_DO = 52,                      /* T_DO  */
+  YYSYMBOL_T_DOC_COMMENT = 53,             /* T_DOC_COMMENT  */
+  YYSYMBOL_T_DOLLAR_OPEN_CURLY_BRACES = 54, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+  YYSYMBOL_T_DOUBLE_ARROW = 55,            /* T_DOUBLE_ARROW  */
+  YYSYMBOL_T_DOUBLE_CAST = 56,             /* T_DOUBLE_CAST  */
+  YYSYMBOL_T_ECHO = 57,                    /* T_ECHO  */
+  YYSYMBOL_T_ELSE = 58,                    /* T_ELSE  */
+  YYSYMBOL_T_ELSEIF = 59,                  /* T_ELSEIF  */
+  YYSYMBOL_T_EMPTY = 60,                   /* T_EMPTY  */
+  YYSYMBOL_T_ENCAPSED_AND_WHITESPACE = 61, /* T_ENCAPSED_AND_WHITESPACE  */
+  YYSYMBOL_T_ENDDECLARE = 62,              /* T_ENDDECLARE  */
+  YYSYMBOL_T_ENDFOR = 63,                  /* T_ENDFOR  */
+  YYSYMBOL_T_ENDFOREACH = 64,              /* T_ENDFOREACH  */
+  YYSYMBOL_T_END_HEREDOC = 65,             /* T_END_HEREDOC  */
+  YYSYMBOL_T_ENDIF = 66,                   /* T_ENDIF  */
+  YYSYMBOL_T_ENDSWITCH = 67,               /* T_ENDSWITCH  */
+  YYSYMBOL_T_ENDWHILE = 68,                /* T_ENDWHILE  */
+  YYSYMBOL_T_EVAL = 69,                    /* T_EVAL  */
+  YYSYMBOL_T_EXIT = 70,                    /* T_EXIT  */
+  YYSYMBOL_T_EXTENDS = 71,                 /* T_EXTENDS  */
+  YYSYMBOL_T_FILE = 72,                    /* T_FILE  */
+  YYSYMBOL_T_FINAL = 73,                   /* T_FINAL  */
+  YYSYMBOL_T_FOR = 74,                     /* T_FOR  */
+  YYSYMBOL_T_FOREACH = 75,                 /* T_FOREACH  */
+  YYSYMBOL_T_FUNC_C = 76,                  /* T_FUNC_C  */
+  YYSYMBOL_T_FUNCTION = 77,                /* T_FUNCTION  */
+  YYSYMBOL_T_GLOBAL = 78,                  /* T_GLOBAL  */
+  YYSYMBOL_T_GOTO = 79,                    /* T_GOTO  */
+  YYSYMBOL_T_HALT_COMPILER = 80,           /* T_HALT_COMPILER  */
+  YYSYMBOL_T_IF = 81,                      /* T_IF  */
+  YYSYMBOL_T_IMPLEMENTS = 82,              /* T_IMPLEMENTS  */
+  YYSYMBOL_T_INC = 83,                     /* T_INC  */
+  YYSYMBOL_T_INCLUDE = 84,                 /* T_INCLUDE  */
+  YYSYMBOL_T_INCLUDE_ONCE = 85,            /* T_INCLUDE_ONCE  */
+  YYSYMBOL_T_INLINE_HTML = 86,             /* T_INLINE_HTML  */
+  YYSYMBOL_T_INSTANCEOF = 87,              /* T_INSTANCEOF  */
+  YYSYMBOL_T_INSTEADOF = 88,               /* T_INSTEADOF  */
+  YYSYMBOL_T_INT_CAST = 89,                /* T_INT_CAST  */
+  YYSYMBOL_T_INTERFACE = 90,               /* T_INTERFACE  */
+  YYSYMBOL_T_IS_EQUAL = 91,                /* T_IS_EQUAL  */
+  YYSYMBOL_T_IS_GREATER_OR_EQUAL = 92,     /* T_IS_GREATER_OR_EQUAL  */
+  YYSYMBOL_T_IS_IDENTICAL = 93,            /* T_IS_IDENTICAL  */
+  YYSYMBOL_T_IS_NOT_EQUAL = 94,            /* T_IS_NOT_EQUAL  */
+  YYSYMBOL_T_IS_NOT_IDENTICAL = 95,        /* T_IS_NOT_IDENTICAL  */
+  YYSYMBOL_T_ISSET = 96,                   /* T_ISSET  */
+  YYSYMBOL_T_IS_SMALLER_OR_EQUAL = 97,     /* T_IS_SMALLER_OR_EQUAL  */
+  YYSYMBOL_T_LINE = 98,                    /* T_LINE  */
+  YYSYMBOL_T_LIST = 99,                    /* T_LIST  */
+  YYSYMBOL_T_LNUMBER = 100,                /* T_LNUMBER  */
+  YYSYMBOL_T_LOGICAL_AND = 101,            /* T_LOGICAL_AND  */
+  YYSYMBOL_T_LOGICAL_OR = 102,             /* T_LOGICAL_OR  */
+  YYSYMBOL_T_LOGICAL_XOR = 103,            /* T_LOGICAL_XOR  */
+  YYSYMBOL_T_METHOD_C = 104,               /* T_METHOD_C  */
+  YYSYMBOL_T_MINUS_EQUAL = 105,            /* T_MINUS_EQUAL  */
+  YYSYMBOL_T_MOD_EQUAL = 106,              /* T_MOD_EQUAL  */
+  YYSYMBOL_T_MUL_EQUAL = 107,              /* T_MUL_EQUAL  */
+  YYSYMBOL_T_NAMESPACE = 108,              /* T_NAMESPACE  */
+  YYSYMBOL_T_NEW = 109,                    /* T_NEW  */
+  YYSYMBOL_T_NS_C = 110,                   /* T_NS_C  */
+  YYSYMBOL_T_NS_SEPARATOR = 111,           /* T_NS_SEPARATOR  */
+  YYSYMBOL_T_NUM_STRING = 112,             /* T_NUM_STRING  */
+  YYSYMBOL_T_OBJECT_CAST = 113,            /* T_OBJECT_CAST  */
+  YYSYMBOL_T_OBJECT_OPERATOR = 114,        /* T_OBJECT_OPERATOR  */
+  YYSYMBOL_T_OPEN_TAG = 115,               /* T_OPEN_TAG  */
+  YYSYMBOL_T_OPEN_TAG_WITH_ECHO = 116,     /* T_OPEN_TAG_WITH_ECHO  */
+  YYSYMBOL_T_OR_EQUAL = 117,               /* T_OR_EQUAL  */
+  YYSYMBOL_T_PAAMAYIM_NEKUDOTAYIM = 118,   /* T_PAAMAYIM_NEKUDOTAYIM  */
+  YYSYMBOL_T_PLUS_EQUAL = 119,             /* T_PLUS_EQUAL  */
+  YYSYMBOL_T_PRINT = 120,                  /* T_PRINT  */
+  YYSYMBOL_T_PRIVATE = 121,                /* T_PRIVATE  */
+  YYSYMBOL_T_PROTECTED = 122,              /* T_PROTECTED  */
+  YYSYMBOL_T_PUBLIC = 123,                 /* T_PUBLIC  */
+  YYSYMBOL_T_REQUIRE = 124,                /* T_REQUIRE  */
+  YYSYMBOL_T_REQUIRE_ONCE = 125,           /* T_REQUIRE_ONCE  */
+  YYSYMBOL_T_RETURN = 126,                 /* T_RETURN  */
+  YYSYMBOL_T_SL = 127,                     /* T_SL  */
+  YYSYMBOL_T_SL_EQUAL = 128,               /* T_SL_EQUAL  */
+  YYSYMBOL_T_SR = 129,                     /* T_SR  */
+  YYSYMBOL_T_SR_EQUAL = 130,               /* T_SR_EQUAL  */
+  YYSYMBOL_T_START_HEREDOC = 131,          /* T_START_HEREDOC  */
+  YYSYMBOL_T_STATIC = 132,                 /* T_STATIC  */
+  YYSYMBOL_T_STRING = 133,                 /* T_STRING  */
+  YYSYMBOL_T_STRING_CAST = 134,            /* T_STRING_CAST  */
+  YYSYMBOL_T_STRING_VARNAME = 135,         /* T_STRING_VARNAME  */
+  YYSYMBOL_T_SWITCH = 136,                 /* T_SWITCH  */
+  YYSYMBOL_T_THROW = 137,                  /* T_THROW  */
+  YYSYMBOL_T_TRAIT = 138,                  /* T_TRAIT  */
+  YYSYMBOL_T_TRAIT_C = 139,                /* T_TRAIT_C  */
+  YYSYMBOL_T_TRY = 140,                    /* T_TRY  */
+  YYSYMBOL_T_UNSET = 141,                  /* T_UNSET  */
+  YYSYMBOL_T_UNSET_CAST = 142,             /* T_UNSET_CAST  */
+  YYSYMBOL_T_USE = 143,                    /* T_USE  */
+  YYSYMBOL_T_VAR = 144,                    /* T_VAR  */
+  YYSYMBOL_T_VARIABLE = 145,               /* T_VARIABLE  */
+  YYSYMBOL_T_WHILE = 146,                  /* T_WHILE  */
+  YYSYMBOL_T_WHITESPACE = 147,             /* T_WHITESPACE  */
+  YYSYMBOL_T_XOR_EQUAL = 148,              /* T_XOR_EQUAL  */
+  YYSYMBOL_149_ = 149,                     /* '{'  */
+  YYSYMBOL_150_ = 150,                     /* '}'  */
+  YYSYMBOL_151_ = 151,                     /* '('  */
+  YYSYMBOL_152_ = 152,                     /* ')'  */
+  YYSYMBOL_153_ = 153,                     /* ';'  */
+  YYSYMBOL_154_ = 154,                     /* '`'  */
+  YYSYMBOL_155_ = 155,                     /* '$'  */
+  YYSYMBOL_156_ = 156,                     /* '"'  */
+  YYSYMBOL_157_ = 157,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 158,                 /* $accept  */
+  YYSYMBOL_start = 159,                    /* start  */
+  YYSYMBOL_top_statement_list = 160,       /* top_statement_list  */
+  YYSYMBOL_namespace_name = 161,           /* namespace_name  */
+  YYSYMBOL_top_statement = 162,            /* top_statement  */
+  YYSYMBOL_163_1 = 163,                    /* $@1  */
+  YYSYMBOL_164_2 = 164,                    /* $@2  */
+  YYSYMBOL_use_declarations = 165,         /* use_declarations  */
+  YYSYMBOL_use_declaration = 166,          /* use_declaration  */
+  YYSYMBOL_constant_declaration = 167,     /* constant_declaration  */
+  YYSYMBOL_inner_statement_list = 168,     /* inner_statement_list  */
+  YYSYMBOL_inner_statement = 169,          /* inner_statement  */
+  YYSYMBOL_statement = 170,                /* statement  */
+  YYSYMBOL_unticked_statement = 171,       /* unticked_statement  */
+  YYSYMBOL_additional_catches = 172,       /* additional_catches  */
+  YYSYMBOL_non_empty_additional_catches = 173, /* non_empty_additional_catches  */
+  YYSYMBOL_additional_catch = 174,         /* additional_catch  */
+  YYSYMBOL_unset_variables = 175,          /* unset_variables  */
+  YYSYMBOL_unset_variable = 176,           /* unset_variable  */
+  YYSYMBOL_function_declaration_statement = 177, /* function_declaration_statement  */
+  YYSYMBOL_class_declaration_statement = 178, /* class_declaration_statement  */
+  YYSYMBOL_is_reference = 179,             /* is_reference  */
+  YYSYMBOL_unticked_function_declaration_statement = 180, /* unticked_function_declaration_statement  */
+  YYSYMBOL_181_3 = 181,                    /* $@3  */
+  YYSYMBOL_unticked_class_declaration_statement = 182, /* unticked_class_declaration_statement  */
+  YYSYMBOL_183_4 = 183,                    /* $@4  */
+  YYSYMBOL_184_5 = 184,                    /* $@5  */
+  YYSYMBOL_class_entry_type = 185,         /* class_entry_type  */
+  YYSYMBOL_extends_from = 186,             /* extends_from  */
+  YYSYMBOL_interface_entry = 187,          /* interface_entry  */
+  YYSYMBOL_interface_extends_list = 188,   /* interface_extends_list  */
+  YYSYMBOL_implements_list = 189,          /* implements_list  */
+  YYSYMBOL_interface_list = 190,           /* interface_list  */
+  YYSYMBOL_foreach_optional_arg = 191,     /* foreach_optional_arg  */
+  YYSYMBOL_foreach_variable = 192,         /* foreach_variable  */
+  YYSYMBOL_for_statement = 193,            /* for_statement  */
+  YYSYMBOL_foreach_statement = 194,        /* foreach_statement  */
+  YYSYMBOL_declare_statement = 195,        /* declare_statement  */
+  YYSYMBOL_declare_list = 196,             /* declare_list  */
+  YYSYMBOL_switch_case_list = 197,         /* switch_case_list  */
+  YYSYMBOL_case_list = 198,                /* case_list  */
+  YYSYMBOL_case_separator = 199,           /* case_separator  */
+  YYSYMBOL_while_statement = 200,          /* while_statement  */
+  YYSYMBOL_elseif_list = 201,              /* elseif_list  */
+  YYSYMBOL_new_elseif_list = 202,          /* new_elseif_list  */
+  YYSYMBOL_else_single = 203,              /* else_single  */
+  YYSYMBOL_new_else_single = 204,          /* new_else_single  */
+  YYSYMBOL_parameter_list = 205,           /* parameter_list  */
+  YYSYMBOL_non_empty_parameter_list = 206, /* non_empty_parameter_list  */
+  YYSYMBOL_optional_class_type = 207,      /* optional_class_type  */
+  YYSYMBOL_function_call_parameter_list = 208, /* function_call_parameter_list  */
+  YYSYMBOL_non_empty_function_call_parameter_list = 209, /* non_empty_function_call_parameter_list  */
+  YYSYMBOL_global_var_list = 210,          /* global_var_list  */
+  YYSYMBOL_global_var = 211,               /* global_var  */
+  YYSYMBOL_static_var_list = 212,          /* static_var_list  */
+  YYSYMBOL_class_statement_list = 213,     /* class_statement_list  */
+  YYSYMBOL_class_statement = 214,          /* class_statement  */
+  YYSYMBOL_215_6 = 215,                    /* $@6  */
+  YYSYMBOL_method_body = 216,              /* method_body  */
+  YYSYMBOL_variable_modifiers = 217,       /* variable_modifiers  */
+  YYSYMBOL_method_modifiers = 218,         /* method_modifiers  */
+  YYSYMBOL_non_empty_member_modifiers = 219, /* non_empty_member_modifiers  */
+  YYSYMBOL_member_modifier = 220,          /* member_modifier  */
+  YYSYMBOL_class_variable_declaration = 221, /* class_variable_declaration  */
+  YYSYMBOL_class_constant_declaration = 222, /* class_constant_declaration  */
+  YYSYMBOL_echo_expr_list = 223,           /* echo_expr_list  */
+  YYSYMBOL_for_expr = 224,                 /* for_expr  */
+  YYSYMBOL_non_empty_for_expr = 225,       /* non_empty_for_expr  */
+  YYSYMBOL_expr_without_variable = 226,    /* expr_without_variable  */
+  YYSYMBOL_227_7 = 227,                    /* $@7  */
+  YYSYMBOL_function = 228,                 /* function  */
+  YYSYMBOL_lexical_vars = 229,             /* lexical_vars  */
+  YYSYMBOL_lexical_var_list = 230,         /* lexical_var_list  */
+  YYSYMBOL_function_call = 231,            /* function_call  */
+  YYSYMBOL_232_8 = 232,                    /* $@8  */
+  YYSYMBOL_233_9 = 233,                    /* $@9  */
+  YYSYMBOL_class_name = 234,               /* class_name  */
+  YYSYMBOL_fully_qualified_class_name = 235, /* fully_qualified_class_name  */
+  YYSYMBOL_class_name_reference = 236,     /* class_name_reference  */
+  YYSYMBOL_dynamic_class_name_reference = 237, /* dynamic_class_name_reference  */
+  YYSYMBOL_dynamic_class_name_variable_properties = 238, /* dynamic_class_name_variable_properties  */
+  YYSYMBOL_dynamic_class_name_variable_property = 239, /* dynamic_class_name_variable_property  */
+  YYSYMBOL_exit_expr = 240,                /* exit_expr  */
+  YYSYMBOL_backticks_expr = 241,           /* backticks_expr  */
+  YYSYMBOL_ctor_arguments = 242,           /* ctor_arguments  */
+  YYSYMBOL_common_scalar = 243,            /* common_scalar  */
+  YYSYMBOL_static_scalar = 244,            /* static_scalar  */
+  YYSYMBOL_static_class_constant = 245,    /* static_class_constant  */
+  YYSYMBOL_scalar = 246,                   /* scalar  */
+  YYSYMBOL_static_array_pair_list = 247,   /* static_array_pair_list  */
+  YYSYMBOL_possible_comma = 248,           /* possible_comma  */
+  YYSYMBOL_non_empty_static_array_pair_list = 249, /* non_empty_static_array_pair_list  */
+  YYSYMBOL_expr = 250,                     /* expr  */
+  YYSYMBOL_r_variable = 251,               /* r_variable  */
+  YYSYMBOL_w_variable = 252,               /* w_variable  */
+  YYSYMBOL_rw_variable = 253,              /* rw_variable  */
+  YYSYMBOL_variable = 254,                 /* variable  */
+  YYSYMBOL_255_10 = 255,                   /* $@10  */
+  YYSYMBOL_256_11 = 256,                   /* $@11  */
+  YYSYMBOL_variable_properties = 257,      /* variable_properties  */
+  YYSYMBOL_variable_property = 258,        /* variable_property  */
+  YYSYMBOL_method_or_not = 259,            /* method_or_not  */
+  YYSYMBOL_variable_without_objects = 260, /* variable_without_objects  */
+  YYSYMBOL_static_member = 261,            /* static_member  */
+  YYSYMBOL_variable_class_name = 262,      /* variable_class_name  */
+  YYSYMBOL_base_variable_with_function_calls = 263, /* base_variable_with_function_calls  */
+  YYSYMBOL_base_variable = 264,            /* base_variable  */
+  YYSYMBOL_reference_variable = 265,       /* reference_variable  */
+  YYSYMBOL_compound_variable = 266,        /* compound_variable  */
+  YYSYMBOL_dim_offset = 267,               /* dim_offset  */
+  YYSYMBOL_object_property = 268,          /* object_property  */
+  YYSYMBOL_object_dim_list = 269,          /* object_dim_list  */
+  YYSYMBOL_variable_name = 270,            /* variable_name  */
+  YYSYMBOL_simple_indirect_reference = 271, /* simple_indirect_reference  */
+  YYSYMBOL_assignment_list = 272,          /* assignment_list  */
+  YYSYMBOL_assignment_list_element = 273,  /* assignment_list_element  */
+  YYSYMBOL_array_pair_list = 274,          /* array_pair_list  */
+  YYSYMBOL_non_empty_array_pair_list = 275, /* non_empty_array_pair_list  */
+  YYSYMBOL_encaps_list = 276,              /* encaps_list  */
+  YYSYMBOL_encaps_var = 277,               /* encaps_var  */
+  YYSYMBOL_encaps_var_offset = 278,        /* encaps_var_offset  */
+  YYSYMBOL_internal_functions_in_yacc = 279, /* internal_functions_in_yacc  */
+  YYSYMBOL_280_12 = 280,                   /* $@12  */
+  YYSYMBOL_281_13 = 281,                   /* $@13  */
+  YYSYMBOL_282_14 = 282,                   /* $@14  */
+  YYSYMBOL_283_15 = 283,                   /* $@15  */
+  YYSYMBOL_isset_variables = 284,          /* isset_variables  */
+  YYSYMBOL_class_constant = 285            /* class_constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 343 of yacc.c  */
-#line 295 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.cpp"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -329,85 +713,112 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -423,7 +834,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -431,40 +842,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined PHP53_RESOURCE_STYPE_IS_TRIVIAL && PHP53_RESOURCE_STYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -474,35 +882,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -510,7 +918,7 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   7504
+#define YYLAST   8572
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  158
@@ -518,32 +926,37 @@ union yyalloc
 #define YYNNTS  128
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  411
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  841
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   629
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    48,   156,     2,   155,    47,    31,     2,
-     151,   152,    45,    42,     8,    43,    44,    46,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    26,   153,
-      36,    13,    37,    25,    60,     2,     2,     2,     2,     2,
+       2,     2,     2,    18,   156,     2,   155,    17,     9,     2,
+     151,   152,    15,    12,     3,    13,    14,    16,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     6,   153,
+      10,     4,    11,     5,    20,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    61,     2,   157,    30,     2,   154,     2,     2,     2,
+       2,    21,     2,   157,     8,     2,   154,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   149,    29,   150,    50,     2,     2,     2,
+       2,     2,     2,   149,     7,   150,    19,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -581,301 +994,114 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    71,    18,    73,    54,    74,    75,    52,    28,
-      27,    76,    77,    78,    79,    80,    81,    82,    62,    83,
-      84,    20,    85,    86,    87,    88,    58,    89,    90,    91,
-      21,    92,    93,    94,    95,    96,    56,    97,    65,    64,
-      98,    99,   100,   101,   102,   103,    66,   104,   105,     5,
-     106,   107,   108,    70,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,    59,     7,     6,   118,    49,   119,    57,
-     120,    35,    38,    33,    34,    32,   121,    39,   122,   123,
-     124,    11,     9,    10,   125,    23,    19,    22,   126,    63,
-     127,   128,   129,    53,   130,   131,   132,    17,   133,    24,
-      12,    69,    68,    67,     4,     3,   134,    41,    15,    40,
-      14,   135,    72,   136,    55,   137,   138,   139,   140,   141,
-     142,   143,    51,   144,   145,   146,   147,   148,    16,     2
+       2,     2,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,     2
 };
 
-#if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+#if PHP53_RESOURCE_DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,     9,    11,    15,    17,    19,
-      21,    26,    30,    31,    38,    39,    45,    49,    52,    56,
-      58,    60,    64,    67,    72,    78,    83,    86,    87,    89,
-      91,    93,    98,   100,   103,   107,   115,   126,   132,   140,
-     150,   156,   159,   163,   166,   170,   173,   177,   181,   185,
-     189,   193,   195,   198,   204,   213,   222,   228,   230,   244,
-     248,   252,   254,   255,   257,   260,   269,   271,   275,   277,
-     279,   281,   282,   284,   285,   296,   297,   306,   307,   315,
-     317,   320,   323,   324,   327,   329,   330,   333,   334,   337,
-     339,   343,   344,   347,   349,   352,   354,   359,   361,   366,
-     368,   373,   377,   383,   387,   392,   397,   403,   404,   410,
-     415,   417,   419,   421,   426,   427,   434,   435,   443,   444,
-     447,   448,   452,   454,   455,   458,   462,   468,   473,   478,
-     484,   492,   499,   500,   502,   504,   506,   507,   509,   511,
-     514,   518,   522,   527,   531,   533,   535,   538,   543,   547,
-     553,   555,   559,   562,   563,   567,   570,   571,   581,   583,
-     587,   589,   591,   592,   594,   596,   599,   601,   603,   605,
-     607,   609,   611,   615,   621,   623,   627,   633,   638,   642,
-     644,   645,   647,   651,   653,   660,   664,   669,   676,   680,
-     683,   687,   691,   695,   699,   703,   707,   711,   715,   719,
-     723,   727,   730,   733,   736,   739,   743,   747,   751,   755,
-     759,   763,   767,   771,   775,   779,   783,   787,   791,   795,
-     799,   803,   806,   809,   812,   815,   819,   823,   827,   831,
-     835,   839,   843,   847,   851,   855,   861,   866,   868,   871,
-     874,   877,   880,   883,   886,   889,   892,   895,   897,   902,
-     906,   909,   910,   921,   923,   924,   929,   933,   938,   940,
-     943,   944,   950,   957,   958,   965,   972,   979,   986,   993,
-     998,  1000,  1002,  1006,  1009,  1011,  1015,  1018,  1020,  1022,
-    1027,  1029,  1032,  1033,  1036,  1037,  1040,  1044,  1045,  1047,
-    1049,  1050,  1054,  1056,  1058,  1060,  1062,  1064,  1066,  1068,
-    1070,  1072,  1074,  1078,  1081,  1083,  1085,  1089,  1092,  1095,
-    1098,  1103,  1105,  1109,  1111,  1113,  1115,  1119,  1122,  1124,
-    1128,  1132,  1133,  1136,  1137,  1139,  1145,  1149,  1153,  1155,
-    1157,  1159,  1161,  1163,  1165,  1166,  1167,  1175,  1177,  1180,
-    1181,  1185,  1189,  1190,  1192,  1195,  1199,  1203,  1205,  1207,
-    1209,  1211,  1214,  1216,  1221,  1226,  1228,  1230,  1235,  1236,
-    1238,  1240,  1242,  1247,  1252,  1254,  1256,  1260,  1262,  1265,
-    1269,  1271,  1273,  1278,  1279,  1280,  1283,  1289,  1293,  1297,
-    1299,  1306,  1311,  1316,  1319,  1322,  1325,  1327,  1330,  1332,
-    1337,  1341,  1345,  1352,  1356,  1358,  1360,  1362,  1367,  1372,
-    1373,  1377,  1378,  1382,  1387,  1388,  1392,  1393,  1397,  1399,
-    1403,  1407
+       0,   342,   342,   346,   348,   352,   353,   357,   358,   359,
+     360,   361,   366,   366,   371,   371,   377,   378,   382,   384,
+     388,   391,   394,   397,   403,   409,   418,   419,   423,   424,
+     425,   426,   430,   431,   435,   436,   440,   444,   445,   446,
+     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
+     465,   466,   467,   468,   469,   472,   475,   476,   477,   483,
+     484,   488,   489,   493,   494,   498,   503,   504,   508,   512,
+     516,   520,   521,   526,   525,   543,   542,   564,   563,   574,
+     575,   576,   580,   581,   588,   592,   593,   598,   599,   604,
+     607,   611,   612,   616,   617,   621,   622,   626,   627,   631,
+     632,   636,   637,   641,   642,   643,   644,   648,   649,   650,
+     654,   655,   659,   660,   664,   665,   671,   672,   678,   679,
+     683,   684,   688,   689,   693,   694,   695,   696,   697,   698,
+     699,   700,   704,   705,   706,   710,   711,   715,   722,   729,
+     736,   737,   738,   742,   743,   747,   748,   749,   753,   754,
+     755,   756,   760,   761,   765,   766,   768,   767,   784,   785,
+     789,   790,   796,   797,   801,   802,   806,   807,   808,   809,
+     810,   811,   815,   821,   827,   833,   842,   849,   858,   859,
+     863,   864,   868,   869,   873,   874,   887,   892,   897,   898,
+     899,   900,   901,   902,   903,   904,   905,   906,   907,   908,
+     909,   910,   911,   912,   913,   914,   915,   916,   917,   918,
+     919,   920,   921,   922,   923,   924,   925,   926,   927,   928,
+     929,   930,   931,   932,   933,   934,   935,   936,   937,   938,
+     939,   940,   941,   942,   943,   944,   947,   949,   950,   951,
+     952,   953,   954,   955,   956,   957,   958,   959,   960,   961,
+     962,   964,   963,   971,   975,   976,   980,   981,   982,   983,
+     987,   987,  1010,  1013,  1013,  1036,  1038,  1040,  1042,  1044,
+    1049,  1050,  1051,  1052,  1056,  1057,  1058,  1062,  1063,  1067,
+    1069,  1074,  1075,  1079,  1083,  1084,  1085,  1089,  1090,  1091,
+    1096,  1097,  1102,  1111,  1121,  1130,  1131,  1132,  1133,  1134,
+    1135,  1136,  1137,  1138,  1143,  1144,  1145,  1146,  1147,  1148,
+    1149,  1150,  1154,  1158,  1159,  1160,  1161,  1162,  1163,  1164,
+    1165,  1170,  1171,  1175,  1176,  1180,  1181,  1182,  1183,  1187,
+    1188,  1193,  1198,  1202,  1207,  1212,  1206,  1225,  1229,  1230,
+    1235,  1239,  1240,  1244,  1245,  1249,  1250,  1255,  1259,  1269,
+    1273,  1274,  1275,  1279,  1280,  1281,  1285,  1286,  1290,  1291,
+    1295,  1296,  1300,  1301,  1302,  1306,  1307,  1311,  1312,  1316,
+    1317,  1322,  1323,  1324,  1328,  1329,  1333,  1334,  1335,  1336,
+    1337,  1338,  1339,  1340,  1344,  1345,  1346,  1347,  1351,  1352,
+    1353,  1354,  1355,  1356,  1360,  1361,  1362,  1366,  1367,  1368,
+    1368,  1374,  1374,  1380,  1381,  1381,  1387,  1387,  1396,  1397,
+    1401,  1402
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     159,     0,    -1,   160,    -1,   160,   162,    -1,    -1,   136,
-      -1,   161,   128,   136,    -1,   170,    -1,   177,    -1,   178,
-      -1,   115,   151,   152,   153,    -1,   126,   161,   153,    -1,
-      -1,   126,   161,   149,   163,   160,   150,    -1,    -1,   126,
-     149,   164,   160,   150,    -1,   144,   165,   153,    -1,   167,
-     153,    -1,   165,     8,   166,    -1,   166,    -1,   161,    -1,
-     161,    74,   136,    -1,   128,   161,    -1,   128,   161,    74,
-     136,    -1,   167,     8,   136,    13,   244,    -1,    85,   136,
-      13,   244,    -1,   168,   169,    -1,    -1,   170,    -1,   177,
-      -1,   178,    -1,   115,   151,   152,   153,    -1,   171,    -1,
-     136,    26,    -1,   149,   168,   150,    -1,   116,   151,   250,
-     152,   170,   201,   203,    -1,   116,   151,   250,   152,    26,
-     168,   202,   204,    66,   153,    -1,   147,   151,   250,   152,
-     200,    -1,    93,   170,   147,   151,   250,   152,   153,    -1,
-     109,   151,   224,   153,   224,   153,   224,   152,   193,    -1,
-     138,   151,   250,   152,   197,    -1,    76,   153,    -1,    76,
-     250,   153,    -1,    87,   153,    -1,    87,   250,   153,    -1,
-     134,   153,    -1,   134,   226,   153,    -1,   134,   254,   153,
-      -1,   113,   210,   153,    -1,    72,   212,   153,    -1,    97,
-     223,   153,    -1,   118,    -1,   250,   153,    -1,   143,   151,
-     175,   152,   153,    -1,   110,   151,   254,    74,   192,   191,
-     152,   194,    -1,   110,   151,   226,    74,   254,   191,   152,
-     194,    -1,    89,   151,   196,   152,   195,    -1,   153,    -1,
-     142,   149,   168,   150,    79,   151,   235,   146,   152,   149,
-     168,   150,   172,    -1,   139,   250,   153,    -1,   114,   136,
-     153,    -1,   173,    -1,    -1,   174,    -1,   173,   174,    -1,
-      79,   151,   235,   146,   152,   149,   168,   150,    -1,   176,
-      -1,   175,     8,   176,    -1,   254,    -1,   180,    -1,   182,
-      -1,    -1,    31,    -1,    -1,   228,   179,   136,   151,   205,
-     152,   181,   149,   168,   150,    -1,    -1,   185,   136,   186,
-     189,   183,   149,   213,   150,    -1,    -1,   187,   136,   188,
-     184,   149,   213,   150,    -1,    81,    -1,    71,    81,    -1,
-      70,    81,    -1,    -1,   107,   235,    -1,   120,    -1,    -1,
-     107,   190,    -1,    -1,   117,   190,    -1,   235,    -1,   190,
-       8,   235,    -1,    -1,    96,   192,    -1,   254,    -1,    31,
-     254,    -1,   170,    -1,    26,   168,   101,   153,    -1,   170,
-      -1,    26,   168,   102,   153,    -1,   170,    -1,    26,   168,
-     100,   153,    -1,   136,    13,   244,    -1,   196,     8,   136,
-      13,   244,    -1,   149,   198,   150,    -1,   149,   153,   198,
-     150,    -1,    26,   198,   104,   153,    -1,    26,   153,   198,
-     104,   153,    -1,    -1,   198,    78,   250,   199,   168,    -1,
-     198,    90,   199,   168,    -1,    26,    -1,   153,    -1,   170,
-      -1,    26,   168,   105,   153,    -1,    -1,   201,    64,   151,
-     250,   152,   170,    -1,    -1,   202,    64,   151,   250,   152,
-      26,   168,    -1,    -1,    65,   170,    -1,    -1,    65,    26,
-     168,    -1,   206,    -1,    -1,   207,   146,    -1,   207,    31,
-     146,    -1,   207,    31,   146,    13,   244,    -1,   207,   146,
-      13,   244,    -1,   206,     8,   207,   146,    -1,   206,     8,
-     207,    31,   146,    -1,   206,     8,   207,    31,   146,    13,
-     244,    -1,   206,     8,   207,   146,    13,   244,    -1,    -1,
-     235,    -1,    73,    -1,   209,    -1,    -1,   226,    -1,   254,
-      -1,    31,   252,    -1,   209,     8,   226,    -1,   209,     8,
-     254,    -1,   209,     8,    31,   252,    -1,   210,     8,   211,
-      -1,   211,    -1,   146,    -1,   155,   251,    -1,   155,   149,
-     250,   150,    -1,   212,     8,   146,    -1,   212,     8,   146,
-      13,   244,    -1,   146,    -1,   146,    13,   244,    -1,   213,
-     214,    -1,    -1,   217,   221,   153,    -1,   222,   153,    -1,
-      -1,   218,   228,   179,   136,   151,   205,   152,   215,   216,
-      -1,   153,    -1,   149,   168,   150,    -1,   219,    -1,   145,
-      -1,    -1,   219,    -1,   220,    -1,   219,   220,    -1,    67,
-      -1,    68,    -1,    69,    -1,    72,    -1,    71,    -1,    70,
-      -1,   221,     8,   146,    -1,   221,     8,   146,    13,   244,
-      -1,   146,    -1,   146,    13,   244,    -1,   222,     8,   136,
-      13,   244,    -1,    85,   136,    13,   244,    -1,   223,     8,
-     250,    -1,   250,    -1,    -1,   225,    -1,   225,     8,   250,
-      -1,   250,    -1,   123,   151,   272,   152,    13,   250,    -1,
-     254,    13,   250,    -1,   254,    13,    31,   254,    -1,   254,
-      13,    31,    63,   236,   242,    -1,    63,   236,   242,    -1,
-      62,   250,    -1,   254,    24,   250,    -1,   254,    23,   250,
-      -1,   254,    22,   250,    -1,   254,    21,   250,    -1,   254,
-      20,   250,    -1,   254,    19,   250,    -1,   254,    18,   250,
-      -1,   254,    17,   250,    -1,   254,    16,   250,    -1,   254,
-      15,   250,    -1,   254,    14,   250,    -1,   253,    59,    -1,
-      59,   253,    -1,   253,    58,    -1,    58,   253,    -1,   250,
-      27,   250,    -1,   250,    28,   250,    -1,   250,     9,   250,
-      -1,   250,    11,   250,    -1,   250,    10,   250,    -1,   250,
-      29,   250,    -1,   250,    31,   250,    -1,   250,    30,   250,
-      -1,   250,    44,   250,    -1,   250,    42,   250,    -1,   250,
-      43,   250,    -1,   250,    45,   250,    -1,   250,    46,   250,
-      -1,   250,    47,   250,    -1,   250,    41,   250,    -1,   250,
-      40,   250,    -1,    42,   250,    -1,    43,   250,    -1,    48,
-     250,    -1,    50,   250,    -1,   250,    33,   250,    -1,   250,
-      32,   250,    -1,   250,    35,   250,    -1,   250,    34,   250,
-      -1,   250,    36,   250,    -1,   250,    39,   250,    -1,   250,
-      37,   250,    -1,   250,    38,   250,    -1,   250,    49,   236,
-      -1,   151,   250,   152,    -1,   250,    25,   250,    26,   250,
-      -1,   250,    25,    26,   250,    -1,   279,    -1,    57,   250,
-      -1,    56,   250,    -1,    55,   250,    -1,    54,   250,    -1,
-      53,   250,    -1,    52,   250,    -1,    51,   250,    -1,   106,
-     240,    -1,    60,   250,    -1,   246,    -1,    73,   151,   274,
-     152,    -1,   154,   241,   154,    -1,    12,   250,    -1,    -1,
-     228,   179,   151,   205,   152,   229,   149,   227,   168,   150,
-      -1,   112,    -1,    -1,   144,   151,   230,   152,    -1,   230,
-       8,   146,    -1,   230,     8,    31,   146,    -1,   146,    -1,
-      31,   146,    -1,    -1,   161,   151,   232,   208,   152,    -1,
-     126,   128,   161,   151,   208,   152,    -1,    -1,   128,   161,
-     151,   233,   208,   152,    -1,   234,   133,   136,   151,   208,
-     152,    -1,   234,   133,   260,   151,   208,   152,    -1,   262,
-     133,   136,   151,   208,   152,    -1,   262,   133,   260,   151,
-     208,   152,    -1,   260,   151,   208,   152,    -1,    72,    -1,
-     161,    -1,   126,   128,   161,    -1,   128,   161,    -1,   161,
-      -1,   126,   128,   161,    -1,   128,   161,    -1,   234,    -1,
-     237,    -1,   264,   130,   268,   238,    -1,   264,    -1,   238,
-     239,    -1,    -1,   130,   268,    -1,    -1,   151,   152,    -1,
-     151,   250,   152,    -1,    -1,    99,    -1,   276,    -1,    -1,
-     151,   208,   152,    -1,   124,    -1,    92,    -1,    86,    -1,
-     122,    -1,   108,    -1,    91,    -1,    82,    -1,   125,    -1,
-     111,    -1,   127,    -1,   135,    99,   103,    -1,   135,   103,
-      -1,   243,    -1,   161,    -1,   126,   128,   161,    -1,   128,
-     161,    -1,    42,   244,    -1,    43,   244,    -1,    73,   151,
-     247,   152,    -1,   245,    -1,   234,   133,   136,    -1,   137,
-      -1,   285,    -1,   161,    -1,   126,   128,   161,    -1,   128,
-     161,    -1,   243,    -1,   156,   276,   156,    -1,   135,   276,
-     103,    -1,    -1,   249,   248,    -1,    -1,     8,    -1,   249,
-       8,   244,    96,   244,    -1,   249,     8,   244,    -1,   244,
-      96,   244,    -1,   244,    -1,   251,    -1,   226,    -1,   254,
-      -1,   254,    -1,   254,    -1,    -1,    -1,   263,   130,   255,
-     268,   259,   256,   257,    -1,   263,    -1,   257,   258,    -1,
-      -1,   130,   268,   259,    -1,   151,   208,   152,    -1,    -1,
-     265,    -1,   271,   265,    -1,   234,   133,   260,    -1,   262,
-     133,   260,    -1,   265,    -1,   264,    -1,   231,    -1,   265,
-      -1,   271,   265,    -1,   261,    -1,   265,    61,   267,   157,
-      -1,   265,   149,   250,   150,    -1,   266,    -1,   146,    -1,
-     155,   149,   250,   150,    -1,    -1,   250,    -1,   269,    -1,
-     260,    -1,   269,    61,   267,   157,    -1,   269,   149,   250,
-     150,    -1,   270,    -1,   136,    -1,   149,   250,   150,    -1,
-     155,    -1,   271,   155,    -1,   272,     8,   273,    -1,   273,
-      -1,   254,    -1,   123,   151,   272,   152,    -1,    -1,    -1,
-     275,   248,    -1,   275,     8,   250,    96,   250,    -1,   275,
-       8,   250,    -1,   250,    96,   250,    -1,   250,    -1,   275,
-       8,   250,    96,    31,   252,    -1,   275,     8,    31,   252,
-      -1,   250,    96,    31,   252,    -1,    31,   252,    -1,   276,
-     277,    -1,   276,    99,    -1,   277,    -1,    99,   277,    -1,
-     146,    -1,   146,    61,   278,   157,    -1,   146,   130,   136,
-      -1,    95,   250,   150,    -1,    95,   137,    61,   250,   157,
-     150,    -1,    88,   254,   150,    -1,   136,    -1,   129,    -1,
-     146,    -1,   121,   151,   284,   152,    -1,    98,   151,   254,
-     152,    -1,    -1,     7,   280,   250,    -1,    -1,     6,   281,
-     250,    -1,     5,   151,   250,   152,    -1,    -1,     4,   282,
-     250,    -1,    -1,     3,   283,   250,    -1,   254,    -1,   284,
-       8,   254,    -1,   234,   133,   136,    -1,   262,   133,   136,
-      -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   341,   341,   345,   346,   350,   351,   355,   356,   357,
-     358,   359,   364,   364,   369,   369,   375,   376,   380,   382,
-     386,   389,   392,   395,   401,   407,   416,   417,   421,   422,
-     423,   424,   428,   429,   433,   434,   438,   442,   443,   444,
-     453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
-     463,   464,   465,   466,   467,   470,   473,   474,   475,   481,
-     482,   486,   487,   491,   492,   496,   501,   502,   506,   510,
-     514,   518,   519,   524,   523,   541,   540,   562,   561,   572,
-     573,   574,   578,   579,   586,   590,   591,   596,   597,   602,
-     605,   609,   610,   614,   615,   619,   620,   624,   625,   629,
-     630,   634,   635,   639,   640,   641,   642,   646,   647,   648,
-     652,   653,   657,   658,   662,   663,   669,   670,   676,   677,
-     681,   682,   686,   687,   691,   692,   693,   694,   695,   696,
-     697,   698,   702,   703,   704,   708,   709,   713,   720,   727,
-     734,   735,   736,   740,   741,   745,   746,   747,   751,   752,
-     753,   754,   758,   759,   763,   764,   766,   765,   782,   783,
-     787,   788,   794,   795,   799,   800,   804,   805,   806,   807,
-     808,   809,   813,   819,   825,   831,   840,   847,   856,   857,
-     861,   862,   866,   867,   871,   872,   885,   890,   895,   896,
-     897,   898,   899,   900,   901,   902,   903,   904,   905,   906,
-     907,   908,   909,   910,   911,   912,   913,   914,   915,   916,
-     917,   918,   919,   920,   921,   922,   923,   924,   925,   926,
-     927,   928,   929,   930,   931,   932,   933,   934,   935,   936,
-     937,   938,   939,   940,   941,   942,   945,   947,   948,   949,
-     950,   951,   952,   953,   954,   955,   956,   957,   958,   959,
-     960,   962,   961,   969,   973,   974,   978,   979,   980,   981,
-     985,   985,  1008,  1011,  1011,  1034,  1036,  1038,  1040,  1042,
-    1047,  1048,  1049,  1050,  1054,  1055,  1056,  1060,  1061,  1065,
-    1067,  1072,  1073,  1077,  1081,  1082,  1083,  1087,  1088,  1089,
-    1094,  1095,  1100,  1109,  1119,  1128,  1129,  1130,  1131,  1132,
-    1133,  1134,  1135,  1136,  1141,  1142,  1143,  1144,  1145,  1146,
-    1147,  1148,  1152,  1156,  1157,  1158,  1159,  1160,  1161,  1162,
-    1163,  1168,  1169,  1173,  1174,  1178,  1179,  1180,  1181,  1185,
-    1186,  1191,  1196,  1200,  1205,  1210,  1204,  1223,  1227,  1228,
-    1233,  1237,  1238,  1242,  1243,  1247,  1248,  1253,  1257,  1267,
-    1271,  1272,  1273,  1277,  1278,  1279,  1284,  1285,  1289,  1290,
-    1294,  1295,  1299,  1300,  1301,  1305,  1306,  1310,  1311,  1315,
-    1316,  1321,  1322,  1323,  1327,  1328,  1332,  1333,  1334,  1335,
-    1336,  1337,  1338,  1339,  1343,  1344,  1345,  1346,  1350,  1351,
-    1352,  1353,  1354,  1355,  1359,  1360,  1361,  1365,  1366,  1367,
-    1367,  1373,  1373,  1379,  1380,  1380,  1386,  1386,  1395,  1396,
-    1400,  1401
-};
-#endif
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "T_END", "error", "$undefined", "T_REQUIRE_ONCE", "T_REQUIRE", "T_EVAL",
-  "T_INCLUDE_ONCE", "T_INCLUDE", "','", "T_LOGICAL_OR", "T_LOGICAL_XOR",
-  "T_LOGICAL_AND", "T_PRINT", "'='", "T_SR_EQUAL", "T_SL_EQUAL",
-  "T_XOR_EQUAL", "T_OR_EQUAL", "T_AND_EQUAL", "T_MOD_EQUAL",
-  "T_CONCAT_EQUAL", "T_DIV_EQUAL", "T_MUL_EQUAL", "T_MINUS_EQUAL",
-  "T_PLUS_EQUAL", "'?'", "':'", "T_BOOLEAN_OR", "T_BOOLEAN_AND", "'|'",
-  "'^'", "'&'", "T_IS_NOT_IDENTICAL", "T_IS_IDENTICAL", "T_IS_NOT_EQUAL",
-  "T_IS_EQUAL", "'<'", "'>'", "T_IS_GREATER_OR_EQUAL",
-  "T_IS_SMALLER_OR_EQUAL", "T_SR", "T_SL", "'+'", "'-'", "'.'", "'*'",
-  "'/'", "'%'", "'!'", "T_INSTANCEOF", "'~'", "T_UNSET_CAST",
-  "T_BOOL_CAST", "T_OBJECT_CAST", "T_ARRAY_CAST", "T_STRING_CAST",
-  "T_DOUBLE_CAST", "T_INT_CAST", "T_DEC", "T_INC", "'@'", "'['", "T_CLONE",
-  "T_NEW", "T_ELSEIF", "T_ELSE", "T_ENDIF", "T_PUBLIC", "T_PROTECTED",
-  "T_PRIVATE", "T_FINAL", "T_ABSTRACT", "T_STATIC", "T_ARRAY", "T_AS",
-  "T_BAD_CHARACTER", "T_BREAK", "T_CALLABLE", "T_CASE", "T_CATCH",
-  "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLOSE_TAG", "T_COMMENT",
-  "T_CONST", "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN",
-  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
-  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_ECHO", "T_EMPTY",
+  "T_END", "error", "\"invalid token\"", "','", "'='", "'?'", "':'",
+  "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'.'", "'*'", "'/'",
+  "'%'", "'!'", "'~'", "'@'", "'['", "T_ABSTRACT", "T_AND_EQUAL",
+  "T_ARRAY", "T_ARRAY_CAST", "T_AS", "T_BAD_CHARACTER", "T_BOOL_CAST",
+  "T_BOOLEAN_AND", "T_BOOLEAN_OR", "T_BREAK", "T_CALLABLE", "T_CASE",
+  "T_CATCH", "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLONE",
+  "T_CLOSE_TAG", "T_COMMENT", "T_CONCAT_EQUAL", "T_CONST",
+  "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN", "T_DEC",
+  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DIV_EQUAL", "T_DNUMBER", "T_DO",
+  "T_DOC_COMMENT", "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW",
+  "T_DOUBLE_CAST", "T_ECHO", "T_ELSE", "T_ELSEIF", "T_EMPTY",
   "T_ENCAPSED_AND_WHITESPACE", "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH",
-  "T_END_HEREDOC", "T_ENDSWITCH", "T_ENDWHILE", "T_EXIT", "T_EXTENDS",
-  "T_FILE", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
-  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INLINE_HTML",
-  "T_INSTEADOF", "T_INTERFACE", "T_ISSET", "T_LINE", "T_LIST", "T_LNUMBER",
-  "T_METHOD_C", "T_NAMESPACE", "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING",
-  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO",
-  "T_PAAMAYIM_NEKUDOTAYIM", "T_RETURN", "T_START_HEREDOC", "T_STRING",
-  "T_STRING_VARNAME", "T_SWITCH", "T_THROW", "T_TRAIT", "T_TRAIT_C",
-  "T_TRY", "T_UNSET", "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE",
-  "T_WHITESPACE", "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'",
-  "']'", "$accept", "start", "top_statement_list", "namespace_name",
+  "T_END_HEREDOC", "T_ENDIF", "T_ENDSWITCH", "T_ENDWHILE", "T_EVAL",
+  "T_EXIT", "T_EXTENDS", "T_FILE", "T_FINAL", "T_FOR", "T_FOREACH",
+  "T_FUNC_C", "T_FUNCTION", "T_GLOBAL", "T_GOTO", "T_HALT_COMPILER",
+  "T_IF", "T_IMPLEMENTS", "T_INC", "T_INCLUDE", "T_INCLUDE_ONCE",
+  "T_INLINE_HTML", "T_INSTANCEOF", "T_INSTEADOF", "T_INT_CAST",
+  "T_INTERFACE", "T_IS_EQUAL", "T_IS_GREATER_OR_EQUAL", "T_IS_IDENTICAL",
+  "T_IS_NOT_EQUAL", "T_IS_NOT_IDENTICAL", "T_ISSET",
+  "T_IS_SMALLER_OR_EQUAL", "T_LINE", "T_LIST", "T_LNUMBER",
+  "T_LOGICAL_AND", "T_LOGICAL_OR", "T_LOGICAL_XOR", "T_METHOD_C",
+  "T_MINUS_EQUAL", "T_MOD_EQUAL", "T_MUL_EQUAL", "T_NAMESPACE", "T_NEW",
+  "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING", "T_OBJECT_CAST",
+  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO", "T_OR_EQUAL",
+  "T_PAAMAYIM_NEKUDOTAYIM", "T_PLUS_EQUAL", "T_PRINT", "T_PRIVATE",
+  "T_PROTECTED", "T_PUBLIC", "T_REQUIRE", "T_REQUIRE_ONCE", "T_RETURN",
+  "T_SL", "T_SL_EQUAL", "T_SR", "T_SR_EQUAL", "T_START_HEREDOC",
+  "T_STATIC", "T_STRING", "T_STRING_CAST", "T_STRING_VARNAME", "T_SWITCH",
+  "T_THROW", "T_TRAIT", "T_TRAIT_C", "T_TRY", "T_UNSET", "T_UNSET_CAST",
+  "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "T_XOR_EQUAL",
+  "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'", "']'",
+  "$accept", "start", "top_statement_list", "namespace_name",
   "top_statement", "$@1", "$@2", "use_declarations", "use_declaration",
   "constant_declaration", "inner_statement_list", "inner_statement",
   "statement", "unticked_statement", "additional_catches",
@@ -915,213 +1141,202 @@ static const char *const yytname[] =
   "assignment_list_element", "array_pair_list",
   "non_empty_array_pair_list", "encaps_list", "encaps_var",
   "encaps_var_offset", "internal_functions_in_yacc", "$@12", "$@13",
-  "$@14", "$@15", "isset_variables", "class_constant", 0
+  "$@14", "$@15", "isset_variables", "class_constant", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   629,   605,   604,   549,   565,   564,    44,   582,
-     583,   581,   600,    61,   610,   608,   628,   597,   503,   586,
-     521,   530,   587,   585,   599,    63,    58,   510,   509,   124,
-      94,    38,   575,   573,   574,   571,    60,    62,   572,   577,
-     609,   607,    43,    45,    46,    42,    47,    37,    33,   567,
-     126,   622,   508,   593,   505,   614,   536,   569,   526,   563,
-      64,    91,   518,   589,   539,   538,   546,   603,   602,   601,
-     553,   502,   612,   504,   506,   507,   511,   512,   513,   514,
-     515,   516,   517,   519,   520,   522,   523,   524,   525,   527,
-     528,   529,   531,   532,   533,   534,   535,   537,   540,   541,
-     542,   543,   544,   545,   547,   548,   550,   551,   552,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   566,   568,
-     570,   576,   578,   579,   580,   584,   588,   590,   591,   592,
-     594,   595,   596,   598,   606,   611,   613,   615,   616,   617,
-     618,   619,   620,   621,   623,   624,   625,   626,   627,   123,
-     125,    40,    41,    59,    96,    36,    34,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
-     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
-     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
-     169,   169,   170,   170,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   172,   172,   173,   173,   174,   175,   175,   176,   177,
-     178,   179,   179,   181,   180,   183,   182,   184,   182,   185,
-     185,   185,   186,   186,   187,   188,   188,   189,   189,   190,
-     190,   191,   191,   192,   192,   193,   193,   194,   194,   195,
-     195,   196,   196,   197,   197,   197,   197,   198,   198,   198,
-     199,   199,   200,   200,   201,   201,   202,   202,   203,   203,
-     204,   204,   205,   205,   206,   206,   206,   206,   206,   206,
-     206,   206,   207,   207,   207,   208,   208,   209,   209,   209,
-     209,   209,   209,   210,   210,   211,   211,   211,   212,   212,
-     212,   212,   213,   213,   214,   214,   215,   214,   216,   216,
-     217,   217,   218,   218,   219,   219,   220,   220,   220,   220,
-     220,   220,   221,   221,   221,   221,   222,   222,   223,   223,
-     224,   224,   225,   225,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   227,   226,   228,   229,   229,   230,   230,   230,   230,
-     232,   231,   231,   233,   231,   231,   231,   231,   231,   231,
-     234,   234,   234,   234,   235,   235,   235,   236,   236,   237,
-     237,   238,   238,   239,   240,   240,   240,   241,   241,   241,
-     242,   242,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   244,   244,   244,   244,   244,   244,
-     244,   244,   245,   246,   246,   246,   246,   246,   246,   246,
-     246,   247,   247,   248,   248,   249,   249,   249,   249,   250,
-     250,   251,   252,   253,   255,   256,   254,   254,   257,   257,
-     258,   259,   259,   260,   260,   261,   261,   262,   263,   263,
-     264,   264,   264,   265,   265,   265,   266,   266,   267,   267,
-     268,   268,   269,   269,   269,   270,   270,   271,   271,   272,
-     272,   273,   273,   273,   274,   274,   275,   275,   275,   275,
-     275,   275,   275,   275,   276,   276,   276,   276,   277,   277,
-     277,   277,   277,   277,   278,   278,   278,   279,   279,   280,
-     279,   281,   279,   279,   282,   279,   283,   279,   284,   284,
-     285,   285
-};
+#define YYPACT_NINF (-537)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-348)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
-       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
-       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
-       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
-       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
-       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
-       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
-       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
-       2,     2,     0,     2,     1,     0,     2,     0,     2,     1,
-       3,     0,     2,     1,     2,     1,     4,     1,     4,     1,
-       4,     3,     5,     3,     4,     4,     5,     0,     5,     4,
-       1,     1,     1,     4,     0,     6,     0,     7,     0,     2,
-       0,     3,     1,     0,     2,     3,     5,     4,     4,     5,
-       7,     6,     0,     1,     1,     1,     0,     1,     1,     2,
-       3,     3,     4,     3,     1,     1,     2,     4,     3,     5,
-       1,     3,     2,     0,     3,     2,     0,     9,     1,     3,
-       1,     1,     0,     1,     1,     2,     1,     1,     1,     1,
-       1,     1,     3,     5,     1,     3,     5,     4,     3,     1,
-       0,     1,     3,     1,     6,     3,     4,     6,     3,     2,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     5,     4,     1,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     4,     3,
-       2,     0,    10,     1,     0,     4,     3,     4,     1,     2,
-       0,     5,     6,     0,     6,     6,     6,     6,     6,     4,
-       1,     1,     3,     2,     1,     3,     2,     1,     1,     4,
-       1,     2,     0,     2,     0,     2,     3,     0,     1,     1,
-       0,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     2,     1,     1,     3,     2,     2,     2,
-       4,     1,     3,     1,     1,     1,     3,     2,     1,     3,
-       3,     0,     2,     0,     1,     5,     3,     3,     1,     1,
-       1,     1,     1,     1,     0,     0,     7,     1,     2,     0,
-       3,     3,     0,     1,     2,     3,     3,     1,     1,     1,
-       1,     2,     1,     4,     4,     1,     1,     4,     0,     1,
-       1,     1,     4,     4,     1,     1,     3,     1,     2,     3,
-       1,     1,     4,     0,     0,     2,     5,     3,     3,     1,
-       6,     4,     4,     2,     2,     2,     1,     2,     1,     4,
-       3,     3,     6,     3,     1,     1,     1,     4,     4,     0,
-       3,     0,     3,     4,     0,     3,     0,     3,     1,     3,
-       3,     3
+    -537,    73,  5031,  -537,  7641,  7641,  7641,  7641,  7641,    65,
+     -99,  7641,  7641,  7061,  -537,  -537,  7641,   -39,  -537,  7206,
+     448,   -15,  -537,  -537,  6916,  7641,  7641,     2,    71,    94,
+    -537,    84,   130,   132,  -537,  -537,   -29,    66,   156,   161,
+     448,  -537,  -537,  -537,  7641,  -537,   174,  -537,   188,  -537,
+    -537,   235,   501,  -537,    83,  7641,  7641,  -537,  -537,  7351,
+     198,    92,   273,  7641,  -537,   193,  7641,   212,   213,  7641,
+     -61,  -537,   216,  -537,  7641,  -537,   247,   214,   277,   -13,
+    -537,    17,  -537,  -537,  -537,  -537,  -537,  -537,   241,   245,
+    -537,   370,  -537,   276,  -537,  -537,  2522,  -537,    -1,  1432,
+     240,  -537,   278,   279,  -537,     5,  -537,    -4,  -537,  -537,
+     286,  -537,  -537,   370,  -537,  -537,   315,  -537,  -537,  -537,
+    2814,  -537,  -537,  -537,  2623,  -537,   400,  -537,  2652,   295,
+      83,   -48,   289,  -537,  -537,   290,   281,   264,  -537,    18,
+    8094,   448,  7641,  7496,  -537,  -537,  7641,  7641,  -537,   254,
+      19,  -537,   265,   268,  7641,  -537,  7641,  7641,  -537,   448,
+     433,    83,  -537,   -54,   310,    83,   316,   308,   280,  -537,
+     317,   327,    37,    -4,    90,  -537,  8249,  7641,  7641,  -537,
+     291,  8094,   699,   448,  7781,     1,  -537,    53,   232,  -537,
+     438,    22,  -537,  -537,  7641,  2753,  -537,   448,  -537,    83,
+      23,    24,  -537,  7641,  5176,  3806,    74,   292,   312,  7641,
+      74,    86,   323,  -537,   326,  -537,   390,   394,  -537,   -68,
+     135,  2341,  7641,  7641,  7641,  7641,  7641,  7641,  7641,  7641,
+    7641,  7641,  7641,  7641,  7641,   501,  7641,  7641,  7641,  7641,
+    7641,  7641,  7641,  7641,  7641,  7641,  7641,  -537,  -537,  -537,
+    2954,  7641,  7641,  7641,  7641,  7641,  7641,  7641,  7641,  7641,
+    7641,  7641,  3094,   305,  -537,  7641,  7641,   214,    55,   329,
+     448,  7933,   332,   466,  -537,  1123,  -537,    83,   -42,   319,
+     353,   489,    16,   343,  7641,  -537,   344,  3835,  -537,  3936,
+     346,   494,  8094,   476,   906,  7641,  -537,  -537,   -29,  -537,
+    -537,   350,  3965,  8094,  8094,  -537,    29,   363,  -537,    33,
+    -537,   173,  -537,  -537,  -537,    83,   316,    85,  3094,  -537,
+      85,   318,    54,  -537,  8094,  8094,  -537,  -537,   354,   496,
+    4355,  -537,  -537,   -12,   382,  -537,  -537,  -537,  1123,   374,
+    -537,  4066,  -537,  5321,    35,  -537,  -537,    89,   388,   -61,
+    -537,  4095,   373,  -537,  -537,  -537,  -537,  -537,  -537,  -537,
+    4456,  -537,  -537,  3094,   522,   -31,   446,   -31,  -537,   378,
+       6,   383,   389,    54,    -4,  7641,  7962,  8395,  8404,  1321,
+     303,  1585,    75,    75,    75,   315,   315,   315,  8340,  8297,
+    -537,  8443,  1585,  8443,  8443,  8443,  1585,  8249,  8121,  8148,
+      72,    72,   380,  8249,  8249,  8249,  8249,  8249,  8249,  8249,
+    8249,  8249,  8249,  8249,  8249,   448,   379,   530,    36,   253,
+     391,   392,   318,  8094,   397,  4485,  -537,  -537,  3234,  -537,
+    3374,  -537,  1123,  1123,   395,   428,    83,    32,   144,   427,
+    -537,  -537,  -537,   -33,   383,   391,  1123,   414,  1611,  7641,
+    8094,  -537,  -537,  -537,  7641,  7641,   448,   140,  4516,  -537,
+    -537,  1757,   448,  -537,   433,   433,   551,  3094,  4741,  -537,
+     316,  -537,   406,  -537,  -537,  7641,  -537,  -537,    58,  -537,
+    3094,  -537,  7641,  -537,  -537,  -537,  -537,   403,  -537,  -537,
+     560,    45,   539,   448,   421,   444,  -537,  -537,  1903,   431,
+    -537,   432,  1123,   474,    83,   316,  -537,   -31,  -537,   586,
+    -537,   442,     6,  -537,   440,   591,    15,  -537,  3094,  3094,
+      54,  8273,  7641,   501,  -537,  -537,  -537,  3514,  3094,  3094,
+     445,  -537,  -537,   448,  8094,   448,  7993,  -537,  -537,  1123,
+      83,   171,   532,   467,  -537,   595,  -537,  -537,  -537,  4196,
+     449,  8094,   549,   448,   549,  -537,  -537,  -537,  -537,  -537,
+      39,  -537,  7641,   454,  -537,  4886,  -537,  4617,   497,  7641,
+    7641,   458,  1518,  -537,  1123,   460,   461,  -537,   464,  -537,
+    -537,  -537,  -537,  -537,  -537,   463,  -537,  -537,    83,   316,
+     586,   469,   -31,  -537,   468,   479,   128,   478,   615,   477,
+     485,  8273,   280,   448,    40,   306,   490,   493,  3094,  -537,
+    -537,  -537,  3654,   571,   495,   627,   224,  -537,  1123,  5466,
+     498,  7641,   140,   502,  -537,   503,  6771,   191,  -537,  8249,
+    -537,  -537,  -537,   318,  -537,   492,  4646,  -537,   481,  -537,
+    -537,   263,  -537,    14,   -31,  5611,  -537,   316,  -537,  -537,
+      88,  -537,   506,   504,    20,   655,  1123,  -537,  -537,  -537,
+    -537,  -537,  -537,   508,  -537,   448,  8094,  1123,  -537,  1123,
+    -537,  -537,   509,  -537,   511,  -537,  2049,  2049,   275,  6916,
+     510,  -537,  -537,  -537,  -537,  -537,   321,  7641,    42,   512,
+      48,  -537,   519,   514,   205,  -537,   535,  -537,  -537,  -537,
+    -537,  -537,  -537,  -537,  -537,   524,   593,   360,  -537,    25,
+     523,    51,  -537,   526,   669,  1123,  -537,  -537,   561,  -537,
+    -537,   619,  -537,  2195,  -537,  -537,  -537,  -537,   670,   527,
+     611,  -537,  7641,   528,  2493,  -537,  -537,  -537,  -537,  -537,
+     533,  -537,  -537,   676,   678,    30,   370,  -537,   554,  -537,
+    -537,   544,  -537,    41,  -537,   686,  1123,  -537,   318,  -537,
+    1123,  -537,  -537,  -537,  5756,  -537,  7641,   538,  4225,  -537,
+    -537,  6771,   543,  1123,  1123,   548,  -537,   562,   690,  5901,
+    -537,    52,  -537,  6046,  1123,  -537,   445,  -537,  6191,   546,
+    6771,  4326,  -537,  6916,  6771,  -537,  -537,  -537,   692,   550,
+    1123,  -537,   552,  -537,  -537,  -537,  -537,   547,  -537,   700,
+    -537,  6336,  1123,     6,  -537,  -537,  -537,  -537,   671,  -537,
+     558,  6771,   563,  -537,   671,  -537,  -537,   -31,  -537,   -85,
+     566,  -537,  -537,  -537,   564,  6481,   568,  -537,  -537,  6626,
+    -537
 };
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+static const yytype_int16 yydefact[] =
 {
-       4,     0,     2,     1,   406,   404,     0,   401,   399,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   270,     0,
-       0,    79,   298,     0,   294,     0,     0,   297,   293,     0,
-       0,     0,   284,   296,     0,     0,   300,   253,     0,     0,
-       0,     0,    51,    84,     0,   295,     0,   292,   299,     0,
-     301,     0,     0,     0,     5,   313,     0,     0,     0,     0,
+       4,     0,     2,     1,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    79,   298,     0,     0,   294,     0,
+       0,     0,   297,   293,     0,     0,     0,     0,     0,   284,
+     296,     0,     0,     0,   300,   253,     0,     0,     0,     0,
+       0,   399,   401,    51,     0,    84,     0,   295,     0,   292,
+     299,     0,     0,   301,     0,     0,     0,   404,   406,     0,
+       0,   270,     5,     0,   313,     0,     0,     0,     0,     0,
        0,   356,     0,    27,     0,    57,   287,   367,     0,   315,
        3,     0,     7,    32,     8,     9,    69,    70,     0,     0,
      330,    71,   349,     0,   318,   247,     0,   329,     0,   331,
        0,   352,     0,   337,   348,   350,   355,     0,   237,   314,
-       0,     0,     0,     0,     0,   270,     0,     5,    71,   250,
-     221,   222,   223,   224,   244,   243,   242,   241,   240,   239,
-     238,     0,     0,   271,     0,   204,   333,     0,   202,   246,
-     189,     0,     0,   271,   277,   290,   278,     0,   280,   350,
-       0,    81,    80,   150,     0,   374,    41,     0,     0,    43,
-       0,     0,     0,     0,   179,     0,     0,   245,   180,     0,
-     145,     0,     0,   144,     0,     0,     0,     0,   373,     0,
-      14,     0,   317,    45,   330,     0,   331,     0,     0,     0,
-     303,   388,     0,   386,    33,     0,     0,    27,     0,     0,
+       0,   270,     5,    71,   221,   222,   223,   224,   246,    80,
+     374,   241,   243,    41,     0,   189,     0,    43,     0,     0,
+       0,   271,     0,   204,   333,     0,     0,     0,   239,     0,
+     179,     0,     0,     0,   245,    81,   180,     0,   145,     0,
+       0,   144,     0,     0,     0,   202,     0,     0,   238,     0,
+     373,     0,    14,     0,     0,     0,   271,   277,   290,   278,
+       0,   280,   350,     0,   317,   242,   250,     0,     0,    45,
+     330,     0,   331,     0,     0,     0,   303,   388,     0,   386,
+     150,     0,    33,   240,     0,     0,    27,     0,   244,     0,
       20,     0,    19,     0,     0,     0,   288,     0,   289,     0,
        0,     0,     0,   260,     0,    17,    82,    85,    72,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,    52,   203,   201,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   136,     0,   334,   358,     0,   368,   351,   407,
-     405,     0,   402,   400,     0,     0,   273,     0,     0,     0,
-     273,     0,   136,   188,     0,     0,   351,     0,     0,    49,
-       0,   379,     0,   323,    42,     0,    44,     0,     0,     0,
-       0,    50,     0,   285,     0,     0,   181,   183,   330,   331,
-       0,   146,   331,     0,    48,    60,     0,     0,   408,     0,
-       0,   371,     0,   370,   316,     4,    12,    11,   263,    46,
-      47,     0,   313,     0,   302,   387,     0,     0,   385,   320,
-     384,     0,    59,     0,     0,    66,    68,    22,     0,     0,
+       0,     0,   136,     0,   334,   358,     0,   368,   351,     0,
+       0,   379,     0,   323,    42,     0,    44,     0,   273,     0,
+       0,     0,     0,     0,     0,    50,     0,     0,   285,     0,
+       0,   181,   183,   330,   331,     0,   146,   331,     0,    48,
+      60,     0,     0,   400,   402,   408,     0,     0,   371,     0,
+     370,   316,     4,    12,    11,     0,   273,     0,   136,   188,
+       0,     0,   351,   263,   405,   407,    46,    47,     0,   313,
+       0,   302,   387,     0,     0,   385,   320,   384,     0,     0,
+      49,     0,    59,     0,     0,    66,    68,    22,     0,     0,
       16,     0,     0,    34,    26,    28,    29,    30,   234,   249,
        0,   319,     6,   136,     0,     0,    87,     0,    77,     0,
-     132,   410,   345,   343,     0,   207,   209,   208,     0,     0,
-     205,   206,   210,   212,   211,   226,   225,   228,   227,   229,
-     231,   232,   230,   220,   219,   214,   215,   213,   216,   217,
-     218,   233,     0,   185,   200,   199,   198,   197,   196,   195,
-     194,   193,   192,   191,   190,     0,     0,   135,   330,   331,
-     411,   346,     0,   359,     0,     0,   403,   272,     0,     0,
+     132,   410,   345,   343,     0,     0,     0,   210,   212,   211,
+     229,   231,   214,   215,   213,   216,   217,   218,   206,   205,
+     233,   227,   232,   225,   228,   226,   230,   208,   207,   209,
+     219,   220,     0,   185,   196,   194,   193,   191,   195,   192,
+     197,   190,   199,   200,   198,     0,     0,   135,   330,   331,
+     411,   346,     0,   359,     0,     0,   383,   332,     0,   248,
+     324,   375,     0,     0,     0,     0,     0,     0,   305,     0,
+     304,    25,   311,   272,     0,     0,     0,     0,     0,     0,
+     178,   398,   403,   286,   180,     0,     0,     0,     0,   143,
+      10,     0,     0,   397,   373,   373,     0,   136,     0,     4,
      272,   345,     0,   346,   365,     0,   361,   282,   360,   364,
-       0,     0,     0,     0,     0,     0,   305,     0,   304,   151,
-     311,   148,   383,   332,     0,   248,   324,   375,    25,     0,
-       0,     0,     0,   178,   398,   286,   180,     0,     0,     0,
-       0,   143,    10,     0,     0,   397,   373,   373,     0,   136,
-       0,     4,   136,   393,     0,   391,   395,   394,   396,     0,
-     390,     0,     0,     0,     0,     0,    21,    18,     0,     0,
+     136,   393,     0,   391,   395,   394,   396,     0,   390,   151,
+     148,     0,     0,     0,     0,     0,    21,    18,     0,     0,
      357,     0,     0,     0,     0,   274,    83,     0,    75,    86,
       89,     0,   132,   134,     0,   122,     0,   133,   136,   136,
      344,   236,     0,     0,   186,   139,   269,     0,   136,   136,
-     342,   353,   354,   291,     0,   279,   358,     0,   308,   309,
-     321,     0,   307,     0,     0,     0,     0,   378,     0,   377,
-     101,     0,    27,    99,    56,     0,     0,   182,    91,     0,
-      91,    93,   147,    27,   114,   409,     0,   369,     0,     0,
-      15,     0,     0,     0,   389,   107,   107,    40,     0,    67,
+     342,   353,   354,     0,   378,     0,   377,   308,   309,   321,
+       0,   307,     0,     0,   101,     0,    27,    99,    56,     0,
+       0,   182,    91,     0,    91,    93,   147,    27,   114,   409,
+       0,   369,     0,     0,    15,     0,   291,     0,   279,   358,
+       0,     0,     0,   389,     0,   107,   107,    40,     0,    67,
       53,    23,    27,   112,    37,     0,   261,    24,     0,   276,
       88,     0,     0,   153,     0,   254,   132,     0,   124,     0,
        0,   235,   290,     0,   330,   331,     0,     0,   136,   335,
-     366,     0,   281,     0,     0,   328,     0,   323,   306,   312,
-     149,   382,   381,     0,     0,     0,     0,   180,     0,     0,
-      94,     0,   116,   118,   372,   184,   262,    13,   264,     0,
+     382,   381,     0,   328,     0,   323,   306,   312,     0,     0,
+       0,   180,     0,     0,    94,     0,   116,   118,   372,   184,
+     262,    13,   366,     0,   281,     0,     0,   264,     0,   149,
      107,     0,   107,     0,     0,     0,    31,   275,   153,    90,
      162,    73,     0,     0,     0,   125,     0,   265,   266,   187,
-     142,   267,   268,     0,   339,   283,   362,   363,     0,   310,
-     324,   322,     0,   376,   102,     0,    38,     0,    92,     0,
-       0,   120,     0,     0,    35,   392,     0,     0,     0,     0,
-       0,   103,     0,     0,   162,   166,   167,   168,   171,   170,
-     169,     0,   161,    78,   152,     0,     0,   160,   164,     0,
-       0,     0,   251,     0,   128,     0,   127,   341,   336,   327,
-     326,   380,   100,     0,    27,    97,    55,    54,     0,     0,
-       0,     0,   119,     0,     0,   110,   111,    27,   105,   104,
+     142,   267,   268,     0,   339,     0,   376,     0,   310,   324,
+     322,   102,     0,    38,     0,    92,     0,     0,   120,     0,
+       0,    35,   283,   362,   363,   392,     0,     0,     0,     0,
+       0,   103,     0,     0,   162,   170,     0,   171,   168,   167,
+     166,   169,   161,    78,   152,     0,     0,   160,   164,     0,
+       0,     0,   251,     0,   128,     0,   127,   341,   336,   380,
+     327,   326,   100,     0,    27,    97,    55,    54,     0,     0,
+       0,   119,     0,     0,     0,   110,   111,    27,   105,   104,
        0,   113,    76,     0,   174,     0,    71,   165,     0,   155,
       27,     0,   258,     0,    27,   129,     0,   126,     0,   338,
-       0,    27,    95,    39,     0,     0,    27,     0,     0,   106,
+       0,    27,    95,    39,     0,    27,     0,     0,     0,   106,
       27,   109,     0,     0,     0,     0,   154,     0,     0,     0,
      259,     0,   255,     0,     0,   131,   342,   325,     0,     0,
-       0,   121,    36,     0,   108,    27,   177,   175,   172,     0,
+     121,     0,    36,     0,   108,    27,   177,   175,   172,     0,
        0,    74,     0,   256,   252,   130,   340,     0,    98,     0,
      115,     0,     0,   132,   176,   257,    96,    27,    62,   173,
        0,   117,     0,    58,    61,    63,   156,     0,    64,     0,
@@ -1129,1922 +1344,2052 @@ static const yytype_uint16 yydefact[] =
       65
 };
 
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -537,  -537,  -296,   -17,  -537,  -537,  -537,  -537,   364,  -537,
+    -129,  -537,     7,  -537,  -537,  -537,  -109,  -537,   225,     3,
+      11,  -111,  -537,  -537,  -537,  -537,  -537,  -537,  -537,  -537,
+    -537,  -537,   217,   165,    98,  -537,    44,  -537,  -537,  -537,
+    -536,    -9,  -537,  -537,  -537,  -537,  -537,  -508,  -537,   133,
+    -304,  -537,  -537,   430,  -537,    78,  -537,  -537,  -537,  -537,
+    -537,  -537,    26,  -537,  -537,  -537,  -442,  -537,   -18,  -537,
+      -2,  -537,  -537,  -537,  -537,  -537,   105,  -357,  -217,  -537,
+    -537,  -537,  -537,  -537,   129,   584,   706,  -537,  -537,  -537,
+     117,  -537,   837,   585,  -398,    87,   967,  -537,  -537,  -537,
+    -537,   -50,  -209,  -537,   726,  -537,   -45,   -51,  -537,   166,
+    -407,  -537,  -537,   -46,   274,   272,  -537,  -537,   145,   342,
+    -537,  -537,  -537,  -537,  -537,  -537,  -537,  -537
+};
+
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,     2,    79,    80,   481,   325,   201,   202,    81,
+       0,     1,     2,    79,    80,   469,   312,   201,   202,    81,
      204,   354,   355,    83,   823,   824,   825,   344,   345,   356,
      357,   219,    86,   710,    87,   591,   511,    88,   366,    89,
-     368,   508,   509,   629,   560,   763,   726,   554,   298,   577,
-     641,   737,   584,   633,   681,   684,   730,   514,   515,   516,
-     416,   417,   172,   173,   154,   650,   704,   829,   833,   705,
-     706,   707,   708,   745,   709,   163,   305,   306,    90,   754,
-     118,   653,   753,    92,   363,   482,    93,   517,   145,   146,
-     535,   612,   167,   207,   283,    94,   449,   450,    95,   616,
-     457,   617,    96,    97,   452,    98,    99,   422,   664,   718,
+     368,   508,   509,   623,   554,   763,   726,   548,   282,   577,
+     641,   737,   584,   627,   678,   681,   730,   514,   515,   516,
+     416,   417,   150,   151,   191,   650,   704,   829,   833,   705,
+     706,   707,   708,   745,   709,   139,   290,   291,    90,   754,
+     113,   653,   753,    92,   363,   480,    93,   517,   168,   169,
+     568,   634,   144,   207,   319,    94,   441,   442,    95,   614,
+     431,   615,    96,    97,   426,    98,    99,   422,   664,   718,
      759,   609,   100,   101,   102,   103,   104,   105,   106,   424,
-     437,   438,   439,   107,   322,   323,   292,   293,   192,   193,
-     489,   108,   114,   113,   111,   110,   319,   109
-};
-
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -530
-static const yytype_int16 yypact[] =
-{
-    -530,    48,  1803,  -530,  -530,  -530,   -22,  -530,  -530,  6242,
-    6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,
-    6242,   275,   275,  6242,  6242,   372,   120,   150,    60,   101,
-    4729,  -530,  -530,   121,  -530,  4855,   126,  -530,  -530,  4575,
-    6242,   139,   146,  -530,   162,   164,  -530,  -530,    73,   218,
-     180,   215,  -530,  -530,   222,  -530,   230,  -530,  -530,   228,
-    -530,   234,  4981,   280,   249,  -530,   236,  6242,   242,   251,
-     201,  -530,   255,  -530,  6242,  -530,   168,   259,   376,   206,
-    -530,    10,  -530,  -530,  -530,  -530,  -530,  -530,   278,   293,
-    -530,   116,  -530,   283,  -530,  -530,  1158,  -530,    92,  1337,
-     269,  -530,   289,   307,  -530,   -23,  -530,    89,  -530,  -530,
-    6242,  6242,  6242,  6242,  6242,  -530,   312,  -530,   116,  1635,
-    -530,  -530,   392,  -530,  -530,  -530,  -530,  -530,  -530,  -530,
-    -530,   315,   234,     7,   314,  -530,  -530,   320,  -530,  -530,
-    -530,   360,   234,   366,   363,   328,  -530,   370,   375,   -10,
-      89,  -530,  -530,   508,    12,  5107,  -530,  6500,   517,  -530,
-    6541,   396,   386,    13,  7378,   275,  5233,  -530,  6242,  6242,
-    -530,   264,    15,  -530,   384,   389,  6242,   275,   421,   234,
-    -530,    83,   207,  -530,   385,  7378,    84,   275,  6368,   152,
-    -530,     8,   351,  -530,  -530,  6242,  6582,  -530,   275,   234,
-     -12,    16,  -530,  6242,  1957,  6627,    69,   394,   451,  6242,
-      69,   272,   415,  -530,   423,  -530,   453,   457,  -530,   -15,
-     219,  6242,  6242,  6242,  5360,  6242,  6242,  6242,  6242,  6242,
-    6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,
-    6242,  6242,  6242,  6242,  6242,  6242,   372,  -530,  -530,  -530,
-    5486,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,  6242,
-    6242,  6242,  5612,   331,  -530,  6242,  6242,   259,   -32,  7378,
-    7378,  6668,  7378,  7378,   414,   234,    94,   346,   379,   234,
-     366,   130,  5612,  -530,   130,   250,   -29,  1213,   422,  -530,
-     275,  7253,   418,   565,  -530,  1213,  -530,   561,    22,   426,
-    6242,  -530,   429,  -530,  6709,   425,   577,  7378,   516,   975,
-    6242,  -530,  -530,    73,  -530,  -530,   439,  6753,  -530,    23,
-     442,  -530,    25,  -530,   256,  -530,  -530,  -530,  -530,  -530,
-    -530,   444,   534,  7005,  -530,  -530,   319,   460,  -530,  -530,
-    -530,  6794,  -530,  2111,    26,  -530,  -530,    -4,   463,   201,
-    -530,  6835,   449,  -530,  -530,  -530,  -530,  -530,  -530,  -530,
-    7046,  -530,  -530,  5612,   591,   344,   491,   344,  -530,   458,
-      61,   459,   461,   -29,    89,  7418,  7455,  1635,  6242,  7337,
-    1942,  1234,  2094,  1367,  2246,  2400,  2400,  2400,  2400,   886,
-     619,   619,   619,   630,   630,   509,   509,   509,   392,   392,
-     392,  -530,   -14,  1635,  1635,  1635,  1635,  1635,  1635,  1635,
-    1635,  1635,  1635,  1635,  1635,   275,   464,   605,    27,   286,
-     466,   467,   250,  7378,   465,  7087,  -530,    97,   459,   466,
-     366,  -530,   468,  -530,  -530,  6242,  -530,  -530,   -18,  -530,
-    1213,  1213,   470,   487,   234,   -49,   284,   492,  -530,  -530,
-    -530,   611,  -530,  -530,  5738,  -530,  5864,  -530,  -530,  1213,
-     490,  3805,  6242,  7378,  -530,  -530,  6242,  6242,   275,   223,
-    7129,  -530,  -530,  3959,   275,  -530,   421,   421,   615,  5612,
-    1495,  -530,  5612,  -530,  6242,  -530,  -530,  -530,  -530,   474,
-    -530,    35,   562,   275,   494,   504,  -530,  -530,  4113,   493,
-    -530,   496,  1213,   521,   234,   366,  -530,   344,  -530,   636,
-    -530,   501,    61,  -530,   500,   646,    -6,  -530,  5612,  5612,
-     -29,  1789,  6242,   372,  -530,  -530,  -530,  5990,  5612,  5612,
-     518,  -530,  -530,  -530,  7170,   540,  6242,  6242,  -530,  -530,
-    1213,   234,   333,   579,   547,  1213,   275,  7378,   275,  7294,
-    -530,   674,  -530,  -530,  -530,  6879,   537,  7378,   596,   275,
-     596,  -530,  -530,  -530,  -530,  -530,    28,  -530,  6242,   543,
-    -530,  1649,   544,  1483,  -530,   549,   550,  -530,   546,  -530,
-    -530,  -530,  -530,  -530,  -530,   552,  -530,  -530,   234,   366,
-     636,   551,   344,  -530,   554,   564,   125,   563,   701,   567,
-     568,  1789,   328,   275,    31,   304,   569,   570,  5612,  -530,
-    -530,   250,  -530,   559,  7211,   621,   571,   710,   340,  -530,
-    -530,  -530,  -530,  6116,  1213,  2265,   572,  6242,   223,   574,
-    -530,   575,  3651,   153,  -530,  1635,  -530,  -530,  -530,   578,
-    -530,    55,  -530,    40,   344,  2419,  -530,   366,  -530,  -530,
-     124,  -530,   581,   580,     6,   717,  1213,  -530,  -530,  -530,
-    -530,  -530,  -530,   582,  -530,  -530,  -530,  -530,  1213,  -530,
-    1213,  -530,   275,  7378,  -530,   583,  -530,   585,  -530,  4267,
-    4267,   195,   584,  4575,  -530,  -530,   122,  6242,    -7,   588,
-      66,  -530,   587,   589,   364,  -530,  -530,  -530,  -530,  -530,
-    -530,   602,  -530,  -530,  -530,   598,   634,   566,  -530,    18,
-     599,    21,  -530,   601,   736,  1213,  -530,  -530,   622,  -530,
-     655,  -530,  -530,  4421,  -530,  -530,  -530,  -530,   603,   727,
-     689,  6242,  -530,   606,    46,  -530,  -530,  -530,  -530,  -530,
-     608,  -530,  -530,   751,   753,    19,   116,  -530,   632,  -530,
-    -530,   624,  -530,    33,  -530,   758,  1213,  -530,   250,  -530,
-    1213,  -530,  -530,  -530,  2573,  6242,  -530,   620,  6920,  -530,
-    -530,  3651,   623,  1213,  1213,   628,  -530,   639,   765,  2727,
-    -530,    78,  -530,  2881,  1213,  -530,   518,  -530,  3035,   626,
-    6961,  3651,  -530,  4575,  3651,  -530,  -530,  -530,   767,   631,
-    1213,  -530,   638,  -530,  -530,  -530,  -530,   644,  -530,   759,
-    -530,  3189,  1213,    61,  -530,  -530,  -530,  -530,   708,  -530,
-     648,  3651,   647,  -530,   708,  -530,  -530,   344,  -530,   227,
-     656,  -530,  -530,  -530,   649,  3343,   657,  -530,  -530,  3497,
-    -530
-};
-
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
-{
-    -530,  -530,  -308,   -17,  -530,  -530,  -530,  -530,   455,  -530,
-     149,  -530,     1,  -530,  -530,  -530,   -16,  -530,   318,     9,
-      11,  -117,  -530,  -530,  -530,  -530,  -530,  -530,  -530,  -530,
-    -530,  -530,   298,   247,   184,  -530,   133,  -530,  -530,  -530,
-    -529,    80,  -530,  -530,  -530,  -530,  -530,  -502,  -530,   225,
-    -236,  -530,  -530,   502,  -530,   170,  -530,  -530,  -530,  -530,
-    -530,  -530,   115,  -530,  -530,  -530,  -451,  -530,    34,  -530,
-      -2,  -530,  -530,  -530,  -530,  -530,    43,  -358,  -232,  -530,
-    -530,  -530,  -530,  -530,   221,   248,   676,  -530,  -530,  -530,
-     208,  -530,   847,   653,  -393,   321,   769,  -530,  -530,  -530,
-    -530,    42,  -218,  -530,   217,  -530,   -19,   -13,  -530,   290,
-    -406,  -530,  -530,     3,   353,   355,  -530,  -530,   110,   395,
-    -530,  -530,  -530,  -530,  -530,  -530,  -530,  -530
+     477,   478,   479,   107,   309,   310,   272,   273,   188,   189,
+     487,   108,   156,   157,   177,   178,   306,   109
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -348
 static const yytype_int16 yytable[] =
 {
-      91,   274,   372,    82,   133,   133,   148,   506,   143,   510,
-     594,    84,   149,    85,   401,   556,   530,   480,   214,   735,
-     288,   300,   525,   313,   349,   597,   748,   775,   150,   265,
-     460,   474,   265,   477,   493,  -137,   477,   713,   265,  -140,
-     162,   781,   181,   536,   182,   421,   432,   643,     3,   523,
-     543,   265,   751,   200,   190,   221,   222,   223,   115,   372,
-     421,   575,   348,   431,   134,   134,   433,   436,   144,   336,
-     495,   224,   735,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   268,   246,   184,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   802,
-    -347,   686,   131,   690,   132,   276,   212,   266,   687,  -344,
-     266,   369,   117,  -347,   212,   280,   266,   501,  -343,   112,
-     688,   537,    71,   687,   513,   212,   370,   286,   337,   266,
-     598,    77,  -333,  -333,   687,   688,   736,   218,   133,   510,
-     248,   249,   714,   621,   133,   622,   688,   187,   213,   689,
-     133,   133,   324,   215,   188,   289,   301,   752,   314,   350,
-     133,   749,   776,   571,   461,   475,   677,   478,   494,  -137,
-     634,   133,   347,  -140,   576,   782,   208,   503,   211,   504,
-     691,   695,   696,   697,   698,   699,   700,   117,   513,   736,
-     687,   151,    91,   308,   436,   665,   153,   373,   134,   701,
-     660,   212,   688,  -123,   134,   191,   739,   682,   683,   170,
-     134,   134,   212,   374,   803,   212,   733,   148,   171,   143,
-     134,   152,   326,   149,   649,    71,   327,   330,   137,   137,
-     187,   134,   147,   569,   267,   328,   572,   188,   479,   150,
-     373,   503,   155,   504,   559,   334,   187,   158,   427,   728,
-     729,   117,   430,   188,   373,   373,   374,   206,   373,   702,
-     446,   373,   373,   133,   703,   194,    71,   161,   446,   721,
-     374,   374,   599,   600,   374,    77,   692,   374,   374,   144,
-     165,   602,   606,   607,  -138,   115,   418,   166,   191,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   820,  -141,   168,   191,   169,   418,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   199,
-     447,   175,   200,   134,   212,   212,   115,   117,   447,  -271,
-    -273,    91,   135,   138,  -333,  -333,   343,   115,   505,   131,
-     505,   132,   786,   505,   174,   371,   179,   213,   328,   117,
-     187,   520,  -333,  -333,   117,    71,   176,   188,   187,    71,
-     117,   338,   663,   177,    77,   188,   831,   180,    77,   189,
-     832,   178,   137,   190,   212,   133,   434,   195,   137,  -272,
-     131,   197,   132,   436,   137,   137,    71,   418,   133,   435,
-     117,   131,   198,   132,   137,    77,   203,   479,   209,   373,
-      71,   117,   212,   310,   216,   137,   220,  -271,   191,    77,
-     262,    71,   263,   446,   446,   374,   191,   542,   361,   217,
-      77,   695,   696,   697,   698,   699,   700,   264,  -138,   187,
-     179,   246,   446,   275,   115,   134,   188,   277,   486,   701,
-     338,   133,   133,   278,   339,   487,  -141,   133,   134,   133,
-     133,   212,   553,   147,   187,   488,  -273,   420,   212,   830,
-     503,   188,   504,  -272,   564,   210,   133,    71,    91,   282,
-     117,    82,   428,   447,   447,   446,    77,   589,   279,    84,
-     505,    85,    71,   115,   212,   505,   281,   191,   141,   583,
-     142,    77,   447,   284,   148,   285,   143,   137,   117,   702,
-     149,   134,   134,   418,   742,   429,   418,   134,    71,   134,
-     134,   287,   191,   446,   618,    71,   150,    77,   446,   133,
-     295,   133,   297,   299,    77,   448,   134,   315,   329,   187,
-     436,   316,   133,   448,   320,   447,   188,   131,   359,   132,
-     338,   362,   418,   418,   243,   244,   245,   117,   246,   364,
-     365,   604,   418,   418,   367,   370,   144,    71,   451,    91,
-     455,   647,    82,   456,   459,   505,    77,   462,   466,   505,
-      84,   464,    85,   447,   335,   467,   133,   340,   447,   134,
-     468,   134,   472,   476,   483,   484,   490,   191,   373,   496,
-     499,   335,   134,   340,   502,   335,   340,   446,   507,   512,
-     518,   133,   519,   527,   374,   541,   526,   528,   529,   137,
-     533,   540,   531,    91,   545,   544,   551,   505,   568,   777,
-      91,   574,   137,   695,   696,   697,   698,   699,   700,   446,
-     581,   578,   418,    91,   592,   585,   134,   580,   586,   588,
-     593,   446,   595,   446,   596,   133,  -348,  -348,  -348,   238,
-     239,   240,   241,   242,   243,   244,   245,   447,   246,   608,
-     611,   134,   240,   241,   242,   243,   244,   245,  -163,   246,
-     725,   725,   334,   619,   732,   137,   137,   624,   448,   448,
-     627,   137,   628,   137,   137,   636,   638,   644,   446,   447,
-     648,   625,   640,   642,   746,   646,   651,   448,   652,   655,
-     137,   447,   632,   447,   656,   134,   666,   668,   670,   657,
-     658,   661,   662,   669,   762,   676,   679,   680,   685,   712,
-     715,   645,   711,   740,   717,   731,   722,   723,   743,   446,
-     147,   738,   741,   446,   744,   373,    47,   755,   750,   756,
-     448,   760,   758,   766,   765,   767,   446,   446,   447,   769,
-     772,   374,    91,   137,   773,   137,   774,   446,   778,    91,
-     780,   784,   795,   792,   798,   799,   137,    91,   800,   808,
-     812,    91,   813,   446,   815,   817,    91,   822,   448,    91,
-     136,   136,    91,   448,   810,   446,   505,   816,   827,   447,
-     826,   836,   834,   447,   497,   590,   838,   631,   828,    91,
-     505,   579,   678,   727,   770,   471,   447,   447,   694,    91,
-     137,   654,   747,   659,   311,   671,   613,   447,   806,   566,
-       0,   186,   567,    91,     0,     0,     0,    91,     0,     0,
-       0,     0,     0,   447,     0,   137,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   447,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,     0,     0,
-     139,   140,   448,   764,     0,     0,     0,   157,     0,     0,
-       0,     0,   160,     0,     0,     0,   771,   164,     0,   137,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   779,
-       0,     0,     0,   783,   448,     0,     0,     0,     0,   185,
-     788,     0,     0,     0,   196,   791,   448,     0,   448,   794,
-       0,   205,  -348,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   302,   246,     0,     0,   309,     0,
-     312,     0,     0,     0,   811,     0,   318,   321,     0,     0,
-       0,     0,     0,     0,     0,     0,   331,   269,   270,   271,
-     272,   273,     0,   448,     0,     0,   821,   346,     0,     0,
-       0,   458,     0,     0,     0,     0,     0,     0,     0,     0,
-     835,     0,     0,     0,     0,     0,     0,   839,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-       0,     0,   291,     0,   448,     0,     0,     0,   448,     0,
-       0,     0,     0,   304,     0,   307,   185,     0,     0,     0,
-       0,   448,   448,   317,     0,     0,     0,     0,     0,     0,
-       0,   419,   448,  -333,  -333,   333,     0,     0,     0,     0,
-       0,     0,   341,     0,     0,     0,     0,     0,   448,   469,
-     351,   419,     0,     0,     0,     0,   360,     0,     0,   453,
-     448,     0,     0,     0,     0,     0,     0,     0,   375,   376,
-     377,   379,   380,   381,   382,   383,   384,   385,   386,   387,
-     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
-     398,   399,   400,     0,     0,     0,     0,   403,   404,   405,
-     406,   407,   408,   409,   410,   411,   412,   413,   414,   185,
-       0,     0,   423,   425,     0,     0,   538,   539,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   185,
-       0,     0,   419,     0,     0,   550,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   463,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   470,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   221,   222,   223,
-       0,   524,     0,     0,     0,     0,     0,     0,   587,     0,
-       0,     0,     0,   224,   453,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,     0,     0,
-     185,     0,     0,     0,     0,     0,   615,     0,     0,     0,
-       0,   620,     0,     0,     0,   521,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   558,   561,     0,
-       0,     0,     0,   565,     0,   321,   321,     0,   419,     0,
-       0,   419,     0,     0,     0,   440,   441,     0,     0,     0,
-       0,     0,   346,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   534,   246,     0,   115,   442,   419,   419,     0,
-       0,     0,     0,     0,     0,    32,   605,   419,   419,    34,
-     674,   547,     0,   549,    37,    38,     0,     0,     0,   555,
-       0,   247,     0,   307,   557,   453,     0,   453,     0,     0,
-       0,    43,     0,     0,    46,     0,   185,     0,   630,   185,
-       0,   573,   716,     0,     0,    55,     0,    57,    58,   443,
-      60,   444,     0,     0,   719,     0,   720,     0,   445,   117,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,     0,     0,     0,   185,   185,     0,     0,   601,
-       0,     0,   453,     0,   185,   185,   185,   419,     0,     0,
-       0,     0,     0,   423,   614,     0,     0,     0,     0,     0,
-       0,   757,     0,     0,     0,  -333,  -333,   561,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   635,   246,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   785,     0,     0,     0,   787,     0,     0,     0,
-       0,   453,     0,     0,     0,     0,     0,     0,     0,   796,
-     797,     0,     0,     0,     0,   185,     0,     0,     0,     0,
-     805,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     673,     0,     0,     0,   307,     0,   814,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   819,     0,
-       0,     0,   221,   222,   223,     0,     0,     0,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   224,     0,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,     0,   734,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    31,    32,   768,     0,
-      33,    34,    35,     0,    36,     0,    37,    38,    39,     0,
-       0,     0,    40,    41,     0,     0,     0,     0,     0,     0,
-       0,    42,     0,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,   790,    52,     0,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,     0,     0,     0,     0,     0,    62,
-      63,    64,    65,    66,    67,     0,     0,    68,    69,    70,
-     639,    71,    72,     0,    73,   570,    74,     0,    75,    76,
-      77,    78,     4,     5,     6,     7,     8,     0,     0,     0,
-     224,     9,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,    26,
-      27,    28,    29,     0,     0,    30,     0,     0,     0,     0,
-      31,    32,     0,     0,    33,    34,    35,     0,    36,     0,
-      37,    38,    39,     0,     0,     0,    40,    41,     0,     0,
-       0,     0,     0,     0,     0,    42,     0,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,     0,    52,     0,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,     0,     0,
-       0,     0,     0,    62,    63,    64,    65,    66,    67,     0,
-       0,    68,    69,    70,     0,    71,    72,     0,    73,   637,
-      74,     0,    75,    76,    77,    78,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,    26,    27,    28,    29,     0,     0,    30,
-       0,     0,     0,     0,    31,    32,     0,     0,    33,    34,
-      35,     0,    36,     0,    37,    38,    39,     0,     0,     0,
-      40,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-       0,    52,     0,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,     0,     0,    68,    69,    70,     0,    71,
-      72,     0,    73,     0,    74,     0,    75,    76,    77,    78,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,    26,    27,    28,
-      29,     0,     0,    30,     0,     0,     0,     0,    31,    32,
-       0,     0,     0,    34,    35,     0,    36,     0,    37,    38,
-      39,     0,     0,     0,    40,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,    44,    45,    46,    47,
-      48,    49,   352,    51,     0,    52,     0,    53,    54,    55,
-      56,    57,    58,   116,    60,    61,     0,     0,     0,     0,
-       0,    62,    63,    64,    65,    66,    67,     0,     0,    68,
-      69,     0,     0,    71,    72,     0,    73,   353,    74,     0,
-      75,    76,    77,    78,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,    26,    27,    28,    29,     0,     0,    30,     0,     0,
-       0,     0,    31,    32,     0,     0,     0,    34,    35,     0,
-      36,     0,    37,    38,    39,     0,     0,     0,    40,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-      44,    45,    46,    47,    48,    49,   352,    51,     0,    52,
-       0,    53,    54,    55,    56,    57,    58,   116,    60,    61,
-       0,     0,     0,     0,     0,    62,    63,    64,    65,    66,
-      67,     0,     0,    68,    69,     0,     0,    71,    72,     0,
-      73,   492,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    31,    32,     0,     0,
-       0,    34,    35,     0,    36,     0,    37,    38,    39,     0,
-       0,     0,    40,    41,     0,   675,     0,     0,     0,     0,
-       0,    42,     0,    43,    44,    45,    46,    47,    48,    49,
-     352,    51,     0,    52,     0,    53,    54,    55,    56,    57,
-      58,   116,    60,    61,     0,     0,     0,     0,     0,    62,
-      63,    64,    65,    66,    67,     0,     0,    68,    69,     0,
-       0,    71,    72,     0,    73,     0,    74,     0,    75,    76,
-      77,    78,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,  -348,  -348,  -348,  -348,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,    26,
-      27,    28,    29,     0,     0,    30,     0,     0,     0,     0,
-      31,    32,     0,     0,     0,    34,    35,     0,    36,     0,
-      37,    38,    39,     0,     0,     0,    40,    41,     0,     0,
-       0,     0,     0,     0,   693,    42,     0,    43,    44,    45,
-      46,    47,    48,    49,   352,    51,     0,    52,     0,    53,
-      54,    55,    56,    57,    58,   116,    60,    61,     0,     0,
-       0,     0,     0,    62,    63,    64,    65,    66,    67,     0,
-       0,    68,    69,     0,     0,    71,    72,     0,    73,     0,
-      74,     0,    75,    76,    77,    78,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,    26,    27,    28,    29,     0,     0,    30,
-       0,     0,     0,     0,    31,    32,     0,     0,     0,    34,
-      35,     0,    36,     0,    37,    38,    39,     0,     0,     0,
-      40,    41,     0,     0,     0,   789,     0,     0,     0,    42,
-       0,    43,    44,    45,    46,    47,    48,    49,   352,    51,
-       0,    52,     0,    53,    54,    55,    56,    57,    58,   116,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,     0,     0,    68,    69,     0,     0,    71,
-      72,     0,    73,     0,    74,     0,    75,    76,    77,    78,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,    26,    27,    28,
-      29,     0,     0,    30,     0,     0,     0,     0,    31,    32,
-       0,     0,     0,    34,    35,     0,    36,     0,    37,    38,
-      39,     0,     0,     0,    40,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,    44,    45,    46,    47,
-      48,    49,   352,    51,     0,    52,     0,    53,    54,    55,
-      56,    57,    58,   116,    60,    61,     0,     0,     0,     0,
-       0,    62,    63,    64,    65,    66,    67,     0,     0,    68,
-      69,     0,     0,    71,    72,     0,    73,   801,    74,     0,
-      75,    76,    77,    78,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
+      91,   172,   269,   131,   594,    84,   173,   171,   506,    82,
+     510,   372,   550,    85,   472,   530,   468,   525,   390,   447,
+     214,   284,   298,   131,   597,   339,   265,   349,   748,   713,
+     513,   137,   462,   775,   163,   166,   465,   174,   493,  -137,
+     643,   180,   465,  -140,   781,   248,   183,   687,   735,   348,
+     199,   575,   120,   200,   421,   184,   268,   212,   265,   501,
+     751,   802,   688,   212,   831,   369,   331,   343,   832,   212,
+     372,   421,   112,     3,   333,   265,   265,   503,   212,   569,
+     504,   687,   249,   370,   227,   228,   229,   230,   231,   232,
+     230,   231,   232,   542,   126,   313,   688,   186,   212,   314,
+     484,   119,   112,   213,   686,  -271,   690,   133,   471,   323,
+     695,   473,   476,   278,   503,   495,   148,   504,   467,   183,
+     145,   485,   322,  -347,   131,   132,   149,   155,   184,   293,
+     696,   183,   131,   486,   212,   610,   136,   611,   213,   112,
+     184,    71,   131,   131,   311,   132,   187,   335,   316,   553,
+     510,   267,   513,   141,   266,  -347,  -343,   167,  -123,   235,
+     598,   697,   235,   563,   691,   714,   131,   334,   448,   373,
+     215,   285,   299,   565,   374,   340,   571,   350,   749,   674,
+     131,   463,   347,   776,   172,   466,   266,   494,  -137,   173,
+     171,   628,  -140,   782,   576,   736,   752,   803,   739,   152,
+     212,   212,    91,   266,   266,   660,  -344,   570,  -273,   698,
+     699,   700,   373,   476,   599,   600,   112,   374,   166,   187,
+     701,   208,   142,   211,   606,   607,   682,   695,   373,   373,
+      71,   187,   702,   374,   374,   649,   503,   190,   703,   504,
+      77,   323,   361,   183,   418,   143,   132,   696,   129,   679,
+     680,   130,   184,   131,   132,   212,  -138,   250,   438,   185,
+     443,   112,  -271,   186,   132,   132,   373,   719,   371,   373,
+     373,   374,   111,   112,   374,   374,   251,   183,   697,   192,
+      71,   146,   212,   147,   212,    71,   184,   692,   132,  -273,
+      77,  -272,   183,   335,   252,    77,   687,   336,   470,  -333,
+     418,   184,   132,   253,   663,   820,   602,   153,   206,  -141,
+     250,   688,   154,  -348,   226,   227,   228,   229,   230,   231,
+     232,   438,   183,   520,   467,   159,   698,   699,   700,   251,
+     689,   184,   200,   728,   729,   212,  -333,   701,   210,   160,
+     167,    91,  -272,   187,   194,   418,   161,   252,   505,   702,
+     505,   786,  -333,   505,   687,   742,   253,   183,   254,   255,
+     256,   196,   129,   209,   197,   130,   184,   203,   112,   688,
+     257,   373,   258,   335,   216,   132,   374,   187,   217,   218,
+     439,   259,   695,   260,   162,   131,   111,   112,   733,  -333,
+     235,   262,   187,   264,   220,   237,   263,   161,   131,    71,
+     241,   261,   235,   295,   275,  -138,   277,   279,   280,    77,
+     283,   254,   255,   256,   281,   438,   438,   619,   300,   541,
+     301,   315,   187,   257,   476,   258,   317,   212,   626,   438,
+     245,   318,   246,   697,   259,   320,   260,  -163,   420,   131,
+     131,   321,   338,   439,   326,   131,   359,   131,   131,   418,
+      71,   474,   444,   645,   261,   547,   362,   187,  -141,   364,
+      77,   365,   418,    71,    71,   367,    91,   475,   558,   430,
+     830,    84,   172,    77,    77,    82,   131,   173,   171,    85,
+     370,   698,   699,   700,   429,   438,   445,   589,   129,   523,
+     505,   130,   701,   446,   449,   505,   451,   455,    71,   454,
+     418,   418,   456,   460,   481,   583,   166,   132,    77,   604,
+     418,   418,   111,   112,   464,   488,   131,   482,   131,   490,
+     132,   496,   438,   616,   499,    71,   502,   332,   507,   512,
+     337,   526,   307,   527,   518,    77,   131,   439,   439,   540,
+     519,   129,   528,   529,   130,   543,   539,   545,   332,   476,
+     337,   439,   332,   337,   531,   562,   129,   438,   566,   130,
+     573,   132,   132,    91,   574,   111,   112,   132,    84,   132,
+     132,   647,    82,   578,   580,   505,    85,   581,    71,   505,
+     111,   112,   373,   585,   586,   588,   131,   374,    77,   592,
+     418,   593,   595,    71,   596,   764,   608,   331,   132,   618,
+     617,   438,   621,    77,   622,   131,   630,   439,   771,   164,
+     637,   633,   165,   640,   642,   644,   646,    91,   648,   656,
+     651,   779,   652,   655,    91,   783,   667,   505,   167,   657,
+     669,   685,   788,   111,   112,   777,   790,   658,   132,   438,
+     132,   794,   661,    91,   439,   662,    71,   668,   131,   683,
+     438,   673,   438,   712,   676,   677,    77,   711,   132,   715,
+     717,   732,   722,   723,   740,   738,   811,   741,   743,   744,
+      35,   755,   750,   756,   760,   758,   765,   767,   766,   439,
+     773,   769,   774,   725,   725,   772,   731,   778,   821,   780,
+     784,   792,   795,   798,   800,   799,   812,   815,   438,   808,
+     816,   813,   835,   250,   746,   822,   817,   373,   132,   839,
+     826,   834,   374,   497,   827,   828,   836,   838,   579,   625,
+     675,   727,   251,   439,   590,   770,   694,   132,   459,   654,
+     762,   659,   670,   747,   296,   635,   806,   561,   560,   438,
+     252,     0,     0,   438,     0,  -333,   135,     0,     0,   253,
+       0,     0,     0,     0,     0,     0,   438,   438,     0,     0,
+       0,   439,    91,     0,     0,     0,   135,   438,     0,    91,
+     132,     0,   439,     0,   439,     0,     0,    91,   170,     0,
+       0,    91,  -333,   438,     0,     0,    91,     0,    91,     0,
+       0,     0,    91,     0,     0,   438,   505,     0,     0,     0,
+     810,     0,     0,     0,   254,   255,   256,     0,     0,    91,
+     505,     0,     0,     0,     0,     0,   257,     0,   258,    91,
+     439,     0,     0,     0,     0,     0,     0,   259,     0,   260,
+       0,     0,     0,    91,     0,     0,     0,    91,     0,     0,
+       0,   114,   115,   116,   117,   118,     0,   261,   121,   122,
+     124,     0,   327,   125,     0,     0,   128,     0,     0,   440,
+       0,   439,   138,   140,     0,   439,     0,   135,     0,     0,
+       0,     0,     0,     0,     0,   135,     0,     0,   439,   439,
+       0,   158,     0,     0,     0,   135,   135,     0,     0,   439,
+       0,     0,   175,   176,     0,     0,   181,     0,     0,     0,
+     193,     0,     0,   195,     0,   439,   198,     0,     0,   135,
+     250,   205,     0,     0,     0,     0,     0,   439,     0,     0,
+       0,     0,   440,   135,     0,     0,     0,     0,     0,   251,
+       0,     0,   457,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   252,     0,     0,
+       0,     0,  -333,     0,     0,     0,   253,   271,     0,     0,
+       0,   170,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   287,
+     289,     0,     0,   292,   181,     0,     0,   134,     0,  -333,
+       0,   302,     0,   303,   304,     0,   135,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   134,     0,     0,
+       0,   254,   255,   256,   324,   325,   440,   440,     0,     0,
+       0,   330,     0,   257,     0,   258,   182,     0,     0,     0,
+     440,   341,     0,     0,   259,     0,   260,     0,     0,     0,
+     351,     0,     0,     0,   489,     0,   360,     0,     0,     0,
+       0,     0,     0,     0,   261,     0,     0,     0,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,   385,   386,   387,
+     388,   389,     0,   391,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,   401,     0,     0,   440,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   181,
+       0,     0,   423,   425,     0,     0,     0,     0,   286,     0,
+       0,     0,     0,     0,   294,     0,   297,     0,     0,     0,
+       0,   450,     0,   440,     0,     0,   305,   308,   135,     0,
+       0,     0,   458,     0,     0,   432,   433,     0,   537,   538,
+       0,   135,     0,     0,     0,     0,     0,   434,     0,     0,
+     328,     0,   544,     0,     0,   181,     0,     0,   440,     0,
+      15,     0,     0,     0,   346,     0,    18,     0,     0,     0,
+       0,     0,    22,     0,    23,     0,     0,     0,     0,     0,
+       0,     0,   135,   135,     0,     0,     0,     0,   135,     0,
+     135,   135,     0,     0,     0,    30,     0,     0,     0,    34,
+     181,     0,   440,     0,     0,     0,     0,     0,   587,     0,
+       0,     0,   521,     0,     0,     0,     0,     0,     0,   135,
+       0,    47,     0,    49,     0,     0,     0,    50,     0,   419,
+       0,   435,     0,    53,   436,     0,     0,   427,     0,     0,
+     440,     0,     0,     0,     0,   613,     0,     0,     0,   170,
+       0,   440,     0,   440,   437,   111,   112,     0,     0,   135,
+       0,   135,     0,     0,     0,   534,     0,   536,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     639,     0,     0,     0,     0,   419,   549,     0,     0,     0,
+       0,   292,   551,     0,     0,     0,     0,     0,     0,   440,
+       0,     0,     0,     0,   181,     0,     0,     0,     0,     0,
+       0,     0,   567,     0,     0,     0,     0,   181,     0,   572,
+       0,     0,     0,     0,   671,     0,     0,     0,     0,   135,
+     419,   225,   226,   227,   228,   229,   230,   231,   232,     0,
+     440,     0,     0,     0,   440,     0,     0,     0,   135,     0,
+       0,     0,     0,     0,     0,   181,   181,   440,   440,   601,
+       0,     0,   716,     0,   181,   181,   181,     0,   440,   524,
+       0,     0,     0,   720,     0,   721,     0,     0,     0,     0,
+       0,     0,   427,     0,   440,     0,     0,     0,     0,     0,
+       0,   135,     0,     0,     0,     0,   440,     0,     0,   629,
+       0,     0,     0,     0,     0,     0,   423,   636,   235,     0,
+       0,     0,   236,   237,   238,   239,   240,     0,   241,     0,
+       0,   757,     0,   552,   555,     0,     0,     0,     0,   559,
+       0,   308,   308,     0,   419,     0,   250,     0,     0,     0,
+       0,     0,     0,     0,     0,   181,     0,   419,   245,   666,
+     246,     0,     0,     0,     0,   251,     0,     0,   292,     0,
+     346,     0,   785,     0,     0,     0,   787,     0,     0,     0,
+       0,     0,     0,   252,     0,     0,     0,     0,  -333,   796,
+     797,     0,   253,     0,     0,   419,   419,     0,     0,     0,
+     805,     0,     0,     0,   605,   419,   419,     0,     0,     0,
+     427,     0,   427,     0,     0,     0,   814,     0,     0,     0,
+       0,     0,     0,     0,     0,  -333,     0,     0,   819,     0,
+     624,     0,     0,   221,   734,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,     0,   254,   255,   256,
+       0,     0,     0,     0,     0,     0,     0,   233,   234,   257,
+       0,   258,     0,     0,     0,     0,     0,     0,     0,     0,
+     259,     0,   260,     0,     0,     0,     0,     0,     0,   768,
+     427,     0,     0,     0,     0,   419,     0,     0,     0,     0,
+     261,     0,     0,     0,     0,     0,     0,     0,     0,   555,
+       0,     0,     0,     0,     0,     0,  -348,   227,   228,   229,
+     230,   231,   232,   791,     0,   235,     0,     0,     0,   236,
+     237,   238,   239,   240,     0,   241,     0,   546,     0,   242,
+     243,   244,     0,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,   427,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,   245,     0,   246,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,   235,     0,     0,   638,     0,  -348,     0,     0,
+      28,    29,  -348,    30,     0,    32,    33,    34,    35,    36,
+      37,     0,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,   245,     0,   246,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,     0,    74,   557,    75,    76,    77,    78,     0,     4,
+       5,     0,     0,     0,     0,     6,     7,     8,     0,     0,
+       0,    10,    11,     0,     0,    12,     0,     0,    13,     0,
+       0,     0,     0,     0,    15,    16,     0,     0,     0,     0,
+      18,    19,     0,    20,    21,     0,    22,     0,    23,    24,
+       0,     0,     0,    25,    26,     0,     0,    27,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,    29,     0,    30,
+       0,    32,    33,    34,    35,    36,    37,     0,    39,     0,
+      40,    41,    42,    43,     0,     0,    44,     0,     0,     0,
+       0,     0,     0,    46,     0,    47,    48,    49,     0,     0,
+       0,    50,     0,     0,     0,   110,    52,    53,    54,     0,
+      55,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+       0,    57,    58,    59,     0,     0,     0,     0,    60,    61,
+      62,    63,    64,    65,    66,     0,     0,    67,    68,    69,
+       0,     0,    71,    72,     0,     0,    73,     0,    74,   582,
+      75,    76,    77,    78,     0,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     0,     0,     0,    10,    11,     0,
+       0,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+      15,    16,     0,     0,     0,     0,    18,    19,     0,    20,
+      21,     0,    22,     0,    23,    24,     0,     0,     0,    25,
+      26,     0,     0,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,    28,    29,     0,    30,     0,    32,    33,    34,
+      35,    36,    37,     0,    39,     0,    40,    41,    42,    43,
+       0,     0,    44,     0,     0,     0,     0,     0,     0,    46,
+       0,    47,    48,    49,     0,     0,     0,    50,     0,     0,
+       0,   110,    52,    53,    54,     0,    55,     0,     0,     0,
+       0,     0,     0,    56,     0,     0,     0,    57,    58,    59,
+       0,     0,     0,     0,    60,    61,    62,    63,    64,    65,
+      66,     0,     0,    67,    68,    69,     0,     0,    71,    72,
+       0,     0,    73,     0,    74,   724,    75,    76,    77,    78,
+       0,     4,     5,     0,     0,     0,     0,     6,     7,     8,
+       0,     0,     0,    10,    11,     0,     0,    12,     0,     0,
+      13,     0,     0,     0,     0,     0,    15,    16,     0,     0,
+       0,     0,    18,    19,     0,    20,    21,     0,    22,     0,
+      23,    24,     0,     0,     0,    25,    26,     0,     0,    27,
+       0,     0,     0,     0,     0,     0,     0,     0,    28,    29,
+       0,    30,     0,    32,    33,    34,    35,    36,    37,     0,
+      39,     0,    40,    41,    42,    43,     0,     0,    44,     0,
+       0,     0,     0,     0,     0,    46,     0,    47,    48,    49,
+       0,     0,     0,    50,     0,     0,     0,   110,    52,    53,
+      54,     0,    55,     0,     0,     0,     0,     0,     0,    56,
+       0,     0,     0,    57,    58,    59,     0,     0,     0,     0,
+      60,    61,    62,    63,    64,    65,    66,     0,     0,    67,
+      68,    69,     0,     0,    71,    72,     0,     0,    73,     0,
+      74,   761,    75,    76,    77,    78,     0,     4,     5,     0,
+       0,     0,     0,     6,     7,     8,     0,     0,     0,    10,
+      11,     0,     0,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,    15,    16,     0,     0,     0,     0,    18,    19,
+       0,    20,    21,     0,    22,     0,    23,    24,     0,     0,
+       0,    25,    26,     0,     0,    27,     0,     0,     0,     0,
+       0,     0,     0,     0,    28,    29,     0,    30,     0,    32,
+      33,    34,    35,    36,    37,     0,    39,     0,    40,    41,
+      42,    43,     0,     0,    44,     0,     0,     0,     0,     0,
+       0,    46,     0,    47,    48,    49,     0,     0,     0,    50,
+       0,     0,     0,   110,    52,    53,    54,     0,    55,     0,
+       0,     0,     0,     0,     0,    56,     0,     0,     0,    57,
+      58,    59,     0,     0,     0,     0,    60,    61,    62,    63,
+      64,    65,    66,     0,     0,    67,    68,    69,     0,     0,
+      71,    72,     0,     0,    73,     0,    74,   375,    75,    76,
+      77,    78,     0,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,    16,
+       0,     0,     0,     0,    18,     0,     0,    20,     0,     0,
+      22,     0,    23,     0,     0,     0,     0,    25,     0,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,     0,     0,     0,    34,    35,     0,
+       0,     0,     0,     0,    40,    41,    42,     0,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,     0,     0,     0,
+       0,     0,    60,   111,   112,    63,    64,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,    71,     0,     0,     0,
+       0,     0,    74,     0,     0,    76,    77,    78,   221,   735,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   233,   234,     0,     0,     0,   221,     0,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   233,   234,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,    26,    27,    28,    29,     0,     0,    30,     0,     0,
-       0,     0,    31,    32,     0,     0,     0,    34,    35,     0,
-      36,     0,    37,    38,    39,     0,     0,     0,    40,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-      44,    45,    46,    47,    48,    49,   352,    51,     0,    52,
-       0,    53,    54,    55,    56,    57,    58,   116,    60,    61,
-       0,     0,     0,     0,     0,    62,    63,    64,    65,    66,
-      67,     0,     0,    68,    69,     0,     0,    71,    72,     0,
-      73,   804,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     235,     0,     0,     0,   236,   237,   238,   239,   240,     0,
+     241,     0,     0,     0,   242,   243,   244,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+       0,     0,     0,   236,   237,   238,   239,   240,     0,   241,
+     245,     0,   246,   242,   243,   244,     0,     0,   221,     0,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,   736,     0,     0,   245,
+       0,   246,   233,   234,     0,     0,     0,   221,     0,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+       0,     0,     0,     0,     0,   247,     0,     0,     0,     0,
+       0,   233,   234,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,    26,    27,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,    31,    32,     0,     0,
-       0,    34,    35,     0,    36,     0,    37,    38,    39,     0,
-       0,     0,    40,    41,     0,     0,   807,     0,     0,     0,
-       0,    42,     0,    43,    44,    45,    46,    47,    48,    49,
-     352,    51,     0,    52,     0,    53,    54,    55,    56,    57,
-      58,   116,    60,    61,     0,     0,     0,     0,     0,    62,
-      63,    64,    65,    66,    67,     0,     0,    68,    69,     0,
-       0,    71,    72,     0,    73,     0,    74,     0,    75,    76,
-      77,    78,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     235,     0,     0,     0,   236,   237,   238,   239,   240,     0,
+     241,     0,     0,     0,   242,   243,   244,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   235,
+       0,     0,     0,   236,   237,   238,   239,   240,     0,   241,
+     245,     0,   246,   242,   243,   244,     0,     0,   221,     0,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,   274,     0,     0,   245,
+       0,   246,   233,   234,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,    26,
-      27,    28,    29,     0,     0,    30,     0,     0,     0,     0,
-      31,    32,     0,     0,     0,    34,    35,     0,    36,     0,
-      37,    38,    39,     0,     0,     0,    40,    41,     0,     0,
-       0,     0,     0,     0,     0,    42,     0,    43,    44,    45,
-      46,    47,    48,    49,   352,    51,     0,    52,     0,    53,
-      54,    55,    56,    57,    58,   116,    60,    61,     0,     0,
-       0,     0,     0,    62,    63,    64,    65,    66,    67,     0,
-       0,    68,    69,     0,     0,    71,    72,     0,    73,   818,
-      74,     0,    75,    76,    77,    78,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   276,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   270,     0,     0,     4,     5,     0,     0,
+       0,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+     235,     0,    12,     0,   236,   237,   238,   239,   240,     0,
+     241,    15,    16,     0,   242,   243,   244,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+     245,     0,   246,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,   342,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   402,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   415,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   533,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   535,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   603,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,   665,     0,    74,     4,     5,    76,    77,
+      78,     0,     6,     7,     8,     0,     0,     0,    10,    11,
+       0,     0,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,    15,    16,     0,     0,     0,     0,    18,     0,     0,
+      20,     0,     0,    22,     0,    23,     0,     0,     0,     0,
+      25,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,     0,    30,     0,     0,     0,
+      34,    35,     0,     0,     0,     0,     0,    40,    41,    42,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
+      46,     0,    47,    48,    49,     0,     0,     0,    50,     0,
+       0,     0,   110,    52,    53,    54,     0,    55,     0,     0,
+       0,     0,     0,     0,    56,     0,     0,     0,    57,    58,
+       0,     0,     0,     0,     0,    60,   111,   112,    63,    64,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,    71,
+       0,     0,     0,     0,     0,    74,     0,     0,    76,    77,
+      78,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,    26,    27,    28,    29,     0,     0,    30,
-       0,     0,     0,     0,    31,    32,     0,     0,     0,    34,
-      35,     0,    36,     0,    37,    38,    39,     0,     0,     0,
-      40,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,    44,    45,    46,    47,    48,    49,   352,    51,
-       0,    52,     0,    53,    54,    55,    56,    57,    58,   116,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,     0,     0,    68,    69,     0,     0,    71,
-      72,     0,    73,   837,    74,     0,    75,    76,    77,    78,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,    26,    27,    28,
-      29,     0,     0,    30,     0,     0,     0,     0,    31,    32,
-       0,     0,     0,    34,    35,     0,    36,     0,    37,    38,
-      39,     0,     0,     0,    40,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,    44,    45,    46,    47,
-      48,    49,   352,    51,     0,    52,     0,    53,    54,    55,
-      56,    57,    58,   116,    60,    61,     0,     0,     0,     0,
-       0,    62,    63,    64,    65,    66,    67,     0,     0,    68,
-      69,     0,     0,    71,    72,     0,    73,   840,    74,     0,
-      75,    76,    77,    78,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,   358,     0,
+       0,     0,   245,     0,   246,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,     0,     0,   452,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,    26,    27,    28,    29,     0,     0,    30,     0,     0,
-       0,     0,    31,    32,     0,     0,     0,    34,    35,     0,
-      36,     0,    37,    38,    39,     0,     0,     0,    40,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-      44,    45,    46,    47,    48,    49,   352,    51,     0,    52,
-       0,    53,    54,    55,    56,    57,    58,   116,    60,    61,
-       0,     0,     0,     0,     0,    62,    63,    64,    65,    66,
-      67,     0,     0,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   552,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,     0,    32,     0,     0,
-       0,    34,    35,     0,    36,     0,    37,    38,    39,     0,
-       0,     0,    40,    41,     0,     0,     0,     0,     0,     0,
-       0,    42,     0,    43,    44,    45,    46,    47,    48,    49,
-       0,    51,     0,    52,     0,     0,    54,    55,    56,    57,
-      58,   116,    60,    61,     0,     0,     0,     0,     0,    62,
-      63,    64,    65,    66,    67,     0,     0,    68,    69,     0,
-       0,    71,    72,     0,    73,     0,    74,     0,    75,    76,
-      77,    78,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   563,     0,     0,     0,     0,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,   453,     0,
+       0,     0,   245,     0,   246,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,     0,     0,   461,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,     0,
-       0,    28,    29,     0,     0,    30,     0,     0,     0,     0,
-       0,    32,     0,     0,     0,    34,    35,     0,    36,     0,
-      37,    38,    39,     0,     0,     0,    40,    41,     0,     0,
-       0,     0,     0,     0,     0,    42,     0,    43,    44,    45,
-      46,    47,    48,    49,     0,    51,     0,    52,     0,     0,
-      54,    55,    56,    57,    58,   116,    60,    61,     0,     0,
-       0,     0,     0,    62,    63,    64,    65,    66,    67,     0,
-       0,    68,    69,     0,     0,    71,    72,     0,    73,     0,
-      74,     0,    75,    76,    77,    78,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   582,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,     0,     0,    28,    29,     0,     0,    30,
-       0,     0,     0,     0,     0,    32,     0,     0,     0,    34,
-      35,     0,    36,     0,    37,    38,    39,     0,     0,     0,
-      40,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,    44,    45,    46,    47,    48,    49,     0,    51,
-       0,    52,     0,     0,    54,    55,    56,    57,    58,   116,
-      60,    61,     0,     0,     0,     0,     0,    62,    63,    64,
-      65,    66,    67,     0,     0,    68,    69,     0,     0,    71,
-      72,     0,    73,     0,    74,     0,    75,    76,    77,    78,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   724,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,     0,     0,    28,
-      29,     0,     0,    30,     0,     0,     0,     0,     0,    32,
-       0,     0,     0,    34,    35,     0,    36,     0,    37,    38,
-      39,     0,     0,     0,    40,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,    44,    45,    46,    47,
-      48,    49,     0,    51,     0,    52,     0,     0,    54,    55,
-      56,    57,    58,   116,    60,    61,     0,     0,     0,     0,
-       0,    62,    63,    64,    65,    66,    67,     0,     0,    68,
-      69,     0,     0,    71,    72,     0,    73,     0,    74,     0,
-      75,    76,    77,    78,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   761,     0,     0,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,   491,     0,
+       0,     0,   245,     0,   246,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,     0,     0,   498,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,     0,     0,    28,    29,     0,     0,    30,     0,     0,
-       0,     0,     0,    32,     0,     0,     0,    34,    35,     0,
-      36,     0,    37,    38,    39,     0,     0,     0,    40,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-      44,    45,    46,    47,    48,    49,     0,    51,     0,    52,
-       0,     0,    54,    55,    56,    57,    58,   116,    60,    61,
-       0,     0,     0,     0,     0,    62,    63,    64,    65,    66,
-      67,     0,     0,    68,    69,     0,     0,    71,    72,     0,
-      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,     0,
-       0,    30,     0,     0,     0,     0,     0,    32,     0,     0,
-       0,    34,    35,     0,    36,     0,    37,    38,    39,     0,
-       0,     0,    40,    41,     0,     0,     0,     0,     0,     0,
-       0,    42,     0,    43,    44,    45,    46,    47,    48,    49,
-       0,    51,     0,    52,     0,     0,    54,    55,    56,    57,
-      58,   116,    60,    61,     0,     0,     0,     0,     0,    62,
-      63,    64,    65,    66,    67,     0,     0,    68,    69,     0,
-       0,    71,    72,     0,    73,     0,    74,     0,    75,    76,
-      77,    78,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,   620,     0,
+       0,     0,   245,     0,   246,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,     0,     0,   793,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-       0,    24,    25,     0,     0,     0,     0,     0,     0,     0,
-       0,   115,    29,     0,     0,     0,     0,     0,     0,     0,
-       0,    32,     0,     0,     0,    34,     0,     0,     0,     0,
-      37,    38,     0,     0,     0,     0,     0,    41,     0,     0,
-       0,     0,     0,     0,     0,    42,     0,    43,     0,     0,
-      46,    47,     0,     0,     0,     0,     0,     0,     0,     0,
-      54,    55,    56,    57,    58,   116,    60,    61,     4,     5,
-       6,     7,     8,     0,    63,   117,    65,     9,     0,     0,
-       0,     0,     0,     0,     0,    71,     0,     0,     0,     0,
-      74,     0,   156,    76,    77,    78,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,    24,    25,     0,
-       0,     0,     0,     0,     0,     0,     0,   115,    29,     0,
-       0,     0,     0,     0,     0,     0,     0,    32,     0,     0,
-       0,    34,     0,     0,     0,     0,    37,    38,     0,     0,
-       0,     0,     0,    41,     0,     0,     0,     0,     0,     0,
-       0,    42,     0,    43,     0,     0,    46,    47,     0,     0,
-       0,     0,     0,     0,     0,     0,    54,    55,    56,    57,
-      58,   116,    60,    61,     4,     5,     6,     7,     8,     0,
-      63,   117,    65,     9,     0,     0,     0,     0,     0,     0,
-       0,    71,     0,     0,     0,     0,    74,     0,   159,    76,
-      77,    78,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,     0,    24,    25,     0,     0,     0,     0,     0,
-       0,     0,     0,   115,    29,     0,     0,     0,     0,     0,
-       0,     0,     0,    32,     0,     0,     0,    34,     0,     0,
-       0,     0,    37,    38,     0,     0,     0,     0,     0,    41,
-       0,     0,     0,     0,     0,     0,     0,    42,     0,    43,
-       0,     0,    46,    47,     0,     0,     0,     0,     0,     0,
-       0,     0,    54,    55,    56,    57,    58,   116,    60,    61,
-       4,     5,     6,     7,     8,     0,    63,   117,    65,     9,
-       0,     0,     0,     0,     0,     0,     0,    71,     0,     0,
-       0,     0,    74,     0,   183,    76,    77,    78,   290,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,     0,    24,
-      25,     0,     0,     0,     0,     0,     0,     0,     0,   115,
-      29,     0,     0,     0,     0,     0,     0,     0,     0,    32,
-       0,     0,     0,    34,     0,     0,     0,     0,    37,    38,
-       0,     0,     0,     0,     0,    41,     0,     0,     0,     0,
-       0,     0,     0,    42,     0,    43,     0,     0,    46,    47,
-       0,     0,     0,     0,     0,     0,     0,     0,    54,    55,
-      56,    57,    58,   116,    60,    61,     4,     5,     6,     7,
-       8,     0,    63,   117,    65,     9,     0,     0,     0,     0,
-       0,     0,     0,    71,     0,     0,     0,     0,    74,     0,
-       0,    76,    77,    78,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,     0,    24,    25,     0,     0,     0,
-       0,     0,     0,     0,     0,   115,    29,     0,     0,     0,
-       0,     0,     0,     0,     0,    32,     0,     0,     0,    34,
-       0,     0,     0,     0,    37,    38,     0,     0,     0,     0,
-       0,    41,     0,     0,     0,     0,     0,     0,     0,    42,
-       0,    43,     0,     0,    46,    47,     0,     0,     0,     0,
-       0,     0,     0,     0,    54,    55,    56,    57,    58,   116,
-      60,    61,     0,     4,     5,     6,     7,     8,    63,   117,
-      65,     0,     9,     0,     0,     0,     0,     0,     0,    71,
-       0,     0,     0,     0,    74,   303,   378,    76,    77,    78,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   115,    29,     0,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   116,    60,    61,     4,
-       5,     6,     7,     8,     0,    63,   117,    65,     9,     0,
-       0,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,   402,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   115,    29,
-       0,     0,     0,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,     0,     0,     0,     0,    37,    38,     0,
-       0,     0,     0,     0,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,     0,     0,    46,    47,     0,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   116,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   117,    65,     9,     0,     0,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,    74,     0,     0,
-      76,    77,    78,   415,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   115,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   116,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   117,    65,
-       9,     0,     0,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,     0,     0,    76,    77,    78,   546,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,   809,     0,
+       0,     0,   245,     0,   246,   233,   234,     0,     0,     0,
+     221,     0,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,     0,     0,   483,     0,     0,     0,     0,
+       0,     0,     0,     0,   233,   234,     0,     0,     0,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,   233,   234,   236,   237,   238,
+     239,   240,     0,   241,     0,     0,     0,   242,   243,   244,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     115,    29,     0,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   116,    60,    61,     4,     5,     6,
-       7,     8,     0,    63,   117,    65,     9,     0,     0,     0,
-       0,     0,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,   548,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,    24,    25,     0,     0,
-       0,     0,     0,     0,     0,     0,   115,    29,     0,     0,
-       0,     0,     0,     0,     0,     0,    32,     0,     0,     0,
-      34,     0,     0,     0,     0,    37,    38,     0,     0,     0,
-       0,     0,    41,     0,     0,     0,     0,     0,     0,     0,
-      42,     0,    43,     0,     0,    46,    47,     0,     0,     0,
-       0,     0,     0,     0,     0,    54,    55,    56,    57,    58,
-     116,    60,    61,     4,     5,     6,     7,     8,     0,    63,
-     117,    65,     9,     0,     0,     0,     0,     0,     0,     0,
-      71,     0,     0,     0,     0,    74,     0,     0,    76,    77,
-      78,   603,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,    24,    25,     0,     0,     0,     0,     0,     0,
-       0,     0,   115,    29,     0,     0,     0,     0,     0,     0,
-       0,     0,    32,     0,     0,     0,    34,     0,     0,     0,
-       0,    37,    38,     0,     0,     0,     0,     0,    41,     0,
-       0,     0,     0,     0,     0,     0,    42,     0,    43,     0,
-       0,    46,    47,     0,     0,     0,     0,     0,     0,     0,
-       0,    54,    55,    56,    57,    58,   116,    60,    61,     4,
-       5,     6,     7,     8,     0,    63,   117,    65,     9,     0,
-       0,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,    74,     0,     0,    76,    77,    78,   672,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,     0,    24,    25,
-       0,     0,     0,     0,     0,     0,     0,     0,   115,    29,
-       0,     0,     0,     0,     0,     0,     0,     0,    32,     0,
-       0,     0,    34,     0,     0,     0,     0,    37,    38,     0,
-       0,     0,     0,     0,    41,     0,     0,     0,     0,     0,
-       0,     0,    42,     0,    43,     0,     0,    46,    47,     0,
-       0,     0,     0,     0,     0,     0,     0,    54,    55,    56,
-      57,    58,   116,    60,    61,     4,     5,     6,     7,     8,
-       0,    63,   117,    65,     9,     0,     0,     0,     0,     0,
-       0,     0,    71,     0,     0,     0,     0,    74,     0,     0,
-      76,    77,    78,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,     0,    24,    25,     0,     0,     0,     0,
-       0,     0,     0,     0,   115,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,     0,     0,    34,     0,
-       0,     0,     0,    37,    38,     0,     0,     0,     0,     0,
-      41,     0,     0,     0,     0,     0,     0,     0,    42,     0,
-      43,     0,     0,    46,    47,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    55,    56,    57,    58,   116,    60,
-      61,     4,     5,     6,     7,     8,     0,    63,   117,    65,
-       9,     0,     0,     0,     0,     0,     0,     0,    71,     0,
-       0,     0,     0,    74,     0,     0,    76,    77,    78,     0,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,     0,   241,   245,     0,   246,   242,   243,   244,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-      24,    25,     0,     0,     0,     0,     0,     0,     0,     0,
-     115,    29,     0,     0,     0,     0,     0,     0,     0,     0,
-      32,     0,     0,     0,    34,     0,     0,     0,     0,    37,
-      38,     0,     0,     0,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    43,     0,     0,    46,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      55,    56,    57,    58,   116,    60,    61,     0,     0,     0,
-       0,     0,     0,    63,   117,   332,     0,     0,     0,   221,
-     222,   223,     0,     0,    71,     0,     0,     0,     0,    74,
-       0,     0,    76,    77,    78,   224,     0,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,     0,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,   221,   222,   223,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   224,     0,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-       0,   246,     0,     0,     0,     0,   221,   222,   223,     0,
+       0,     0,     0,   235,     0,     0,   500,   236,   237,   238,
+     239,   240,   245,   241,   246,     0,     0,   242,   243,   244,
+       0,     0,   221,     0,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   532,     0,     0,     0,     0,
+       0,     0,     0,   245,     0,   246,   233,   234,     0,     0,
+       0,   221,     0,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,     0,     0,   556,     0,     0,     0,
+       0,     0,     0,     0,     0,   233,   234,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   224,   294,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,   221,   222,   223,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,   296,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   342,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,     0,
-       0,     0,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   358,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     426,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,   221,   222,   223,     0,     0,     0,
+       0,     0,     0,     0,   235,     0,     0,     0,   236,   237,
+     238,   239,   240,     0,   241,     0,     0,     0,   242,   243,
+     244,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   235,     0,     0,     0,   236,   237,   238,
+     239,   240,     0,   241,   245,     0,   246,   242,   243,   244,
+       0,     0,     0,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,   632,     0,    12,
+       0,     0,    13,   245,     0,   246,     0,    14,    15,    16,
+       0,     0,     0,    17,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,   684,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,    51,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,    70,     0,    71,    72,     0,     0,
+      73,   564,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,    17,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,    51,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,    70,
+       0,    71,    72,     0,     0,    73,   631,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,    17,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,    51,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,    70,     0,    71,    72,     0,     0,
+      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,   353,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,   492,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,   672,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,     0,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,   693,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+     789,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,     0,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,   801,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,   804,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,   807,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,   818,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,   837,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     9,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,    14,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,    31,
+      32,    33,    34,    35,    36,    37,   352,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,    45,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,   840,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     9,     0,    10,    11,     0,     0,    12,
+       0,     0,    13,     0,     0,     0,     0,    14,    15,    16,
+       0,     0,     0,     0,    18,    19,     0,    20,    21,     0,
+      22,     0,    23,    24,     0,     0,     0,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,    31,    32,    33,    34,    35,    36,
+      37,   352,    39,     0,    40,    41,    42,    43,     0,     0,
+      44,    45,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,    59,     0,     0,
+       0,     0,    60,    61,    62,    63,    64,    65,    66,     0,
+       0,    67,    68,    69,     0,     0,    71,    72,     0,     0,
+      73,     0,    74,     0,    75,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     0,     0,
+      10,    11,     0,     0,    12,     0,     0,    13,     0,     0,
+       0,     0,     0,    15,    16,     0,     0,     0,     0,    18,
+      19,     0,    20,    21,     0,    22,     0,    23,    24,     0,
+       0,     0,    25,    26,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,     0,
+      32,    33,    34,    35,    36,    37,     0,    39,     0,    40,
+      41,    42,    43,     0,     0,    44,     0,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,    59,     0,     0,     0,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,     0,    67,    68,    69,     0,
+       0,    71,    72,     0,     0,    73,     0,    74,     0,    75,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,    16,
+       0,     0,     0,     0,    18,     0,     0,    20,     0,     0,
+      22,     0,    23,     0,     0,     0,     0,    25,     0,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,     0,     0,     0,    34,    35,     0,
+       0,     0,     0,     0,    40,    41,    42,     0,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,     0,     0,     0,
+       0,     0,    60,   111,   112,    63,    64,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,    71,     0,     0,     0,
+       0,     0,    74,     0,   123,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     0,     0,
+      10,    11,     0,     0,    12,     0,     0,     0,     0,     0,
+       0,     0,     0,    15,    16,     0,     0,     0,     0,    18,
+       0,     0,    20,     0,     0,    22,     0,    23,     0,     0,
+       0,     0,    25,     0,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,     0,
+       0,     0,    34,    35,     0,     0,     0,     0,     0,    40,
+      41,    42,     0,     0,     0,    44,     0,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,     0,     0,     0,     0,     0,    60,   111,   112,
+      63,    64,     0,     0,     0,     0,     0,     0,    69,     0,
+       0,    71,     0,     0,     0,     0,     0,    74,     0,   127,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,    16,
+       0,     0,     0,     0,    18,     0,     0,    20,     0,     0,
+      22,     0,    23,     0,     0,     0,     0,    25,     0,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,     0,     0,     0,    34,    35,     0,
+       0,     0,     0,     0,    40,    41,    42,     0,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,     0,     0,     0,
+       0,     0,    60,   111,   112,    63,    64,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,    71,     0,     0,     0,
+       0,     0,    74,     0,   179,    76,    77,    78,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     0,     0,     0,
+      10,    11,     0,     0,    12,     0,     0,     0,     0,     0,
+       0,     0,     0,    15,    16,     0,     0,     0,     0,    18,
+       0,     0,    20,     0,     0,    22,     0,    23,     0,     0,
+       0,     0,    25,     0,     0,     0,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,     0,
+       0,     0,    34,    35,     0,     0,     0,     0,     0,    40,
+      41,    42,     0,     0,     0,    44,     0,     0,     0,     0,
+       0,     0,    46,     0,    47,    48,    49,     0,     0,     0,
+      50,     0,     0,     0,   110,    52,    53,    54,     0,    55,
+       0,     0,     0,     0,     0,     0,    56,     0,     0,     0,
+      57,    58,     0,     0,     0,     0,     0,    60,   111,   112,
+      63,    64,     0,     0,     0,     0,     0,     0,    69,     0,
+       0,    71,     0,     0,     0,     0,     0,    74,   288,     0,
+      76,    77,    78,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     0,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,    16,
+       0,     0,     0,     0,    18,     0,     0,    20,     0,     0,
+      22,     0,    23,     0,     0,     0,     0,    25,     0,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,     0,     0,     0,    34,    35,     0,
+       0,     0,     0,     0,    40,    41,    42,     0,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,     0,     0,     0,
+       0,     0,    60,   111,   112,    63,    64,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,    71,     0,     0,     0,
+       0,     0,    74,     4,     5,    76,    77,    78,     0,     6,
+       7,     8,     0,     0,     0,    10,    11,     0,     0,    12,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,    16,
+       0,     0,     0,     0,    18,     0,     0,    20,     0,     0,
+      22,     0,    23,     0,     0,     0,     0,    25,     0,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      28,    29,     0,    30,     0,     0,     0,    34,    35,     0,
+       0,     0,     0,     0,    40,    41,    42,     0,     0,     0,
+      44,     0,     0,     0,     0,     0,     0,    46,     0,    47,
+      48,    49,     0,     0,     0,    50,     0,     0,     0,   110,
+      52,    53,    54,     0,    55,     0,     0,     0,     0,     0,
+       0,    56,     0,     0,     0,    57,    58,     0,     0,     0,
+       0,     0,    60,   111,   112,    63,   329,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,    71,     0,     0,     0,
+       0,     0,    74,     0,     0,    76,    77,    78,   221,     0,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   233,   234,     0,     0,     0,   221,   522,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+       0,     0,     0,     0,     0,     0,     0,     0,   428,     0,
+       0,   233,   234,     0,     0,     0,     0,     0,   221,     0,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     235,     0,   233,   234,   236,   237,   238,   239,   240,     0,
+     241,     0,     0,     0,   242,   243,   244,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   612,   235,
+       0,     0,     0,   236,   237,   238,   239,   240,     0,   241,
+     245,     0,   246,   242,   243,   244,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,   465,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,     0,     0,     0,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   473,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   491,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   498,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,     0,     0,   221,   222,   223,     0,     0,     0,
+     235,     0,     0,     0,   236,   237,   238,   239,   240,   245,
+     241,   246,     0,     0,   242,   243,   244,     0,     0,   221,
+       0,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,     0,     0,     0,     0,     0,     0,     0,     0,
+     245,     0,   246,   233,   234,     0,   221,     0,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,   626,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246,   221,   222,   223,     0,     0,
+     233,   234,     0,   221,     0,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   233,   234,     0,
+       0,   235,     0,     0,     0,   236,   237,   238,   239,   240,
+       0,   241,     0,     0,     0,   242,   243,   244,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   235,     0,
+       0,     0,   236,   237,   238,   239,   240,     0,   241,     0,
+       0,   245,   242,   246,   244,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   235,     0,     0,     0,   236,
+     237,   238,   239,   240,     0,   241,     0,     0,   245,   242,
+     246,     0,     0,     0,   221,     0,   222,   223,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,     0,     0,     0,
+       0,     0,     0,     0,     0,   245,     0,   246,   233,   234,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   233,   234,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   233,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,     0,     0,     0,
+     236,   237,   238,   239,   240,     0,   241,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,     0,     0,
+     235,     0,     0,     0,   236,   237,   238,   239,   240,     0,
+     241,     0,     0,     0,     0,     0,   245,     0,   246,     0,
+       0,     0,     0,     0,   235,     0,     0,     0,   236,   237,
+     238,   239,   240,     0,   241,     0,     0,     0,     0,     0,
+     245,     0,   246,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,     0,     0,   245,     0,   246,   235,     0,     0,
+       0,   236,   237,   238,   239,   240,     0,   241,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   224,   793,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,     0,   246,   221,   222,   223,     0,
+       0,     0,     0,   225,   226,   227,   228,   229,   230,   231,
+     232,     0,     0,     0,     0,     0,     0,   245,     0,   246,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   224,   809,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,     0,   221,   222,
-     223,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   224,   485,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,     0,   246,   221,
-     222,   223,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   224,   500,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,     0,   246,
-     221,   222,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   224,   532,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
-     246,     0,   221,   222,   223,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   562,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,     0,   246,   221,   222,   223,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   224,
-     610,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,     0,   246,     0,     0,   221,   222,   223,   454,
+       0,     0,   235,     0,     0,     0,   236,   237,   238,   239,
+     240,   235,   241,     0,     0,   236,   237,   238,   239,   240,
+       0,   241,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   667,   224,   522,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,     0,   246,   221,   222,   223,
-     623,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,     0,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,     0,   246,   222,   223,
+       0,     0,   245,     0,   246,     0,     0,     0,     0,     0,
+     235,   245,     0,   246,  -348,   237,  -348,  -348,  -348,     0,
+     241,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   224,     0,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,   223,   246,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     224,     0,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,     0,   246
+     245,     0,   246
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-530))
-
-#define yytable_value_is_error(yytable_value) \
-  ((yytable_value) == (-348))
-
 static const yytype_int16 yycheck[] =
 {
-       2,   118,   220,     2,    21,    22,    25,   365,    25,   367,
-     512,     2,    25,     2,   246,   466,   422,   325,     8,    26,
-       8,     8,   415,     8,     8,    31,     8,     8,    25,    61,
-       8,     8,    61,     8,     8,     8,     8,    31,    61,     8,
-      39,     8,    59,    61,    61,   263,   282,   576,     0,    63,
-      99,    61,    31,    70,   103,     9,    10,    11,    72,   277,
-     278,    26,    74,   281,    21,    22,   284,   285,    25,    61,
-      74,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,   107,    49,    62,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    31,
-     133,   640,   126,   642,   128,   132,   128,   149,    78,   151,
-     149,   136,   136,   133,   128,   142,   149,   363,   151,   151,
-      90,   149,   146,    78,    73,   128,   151,   150,   130,   149,
-     146,   155,    58,    59,    78,    90,   153,    31,   165,   507,
-      58,    59,   146,   546,   171,   548,    90,    88,   151,   104,
-     177,   178,   179,   153,    95,   153,   153,   146,   153,   153,
-     187,   153,   153,   481,   152,   152,   627,   152,   152,   152,
-     152,   198,   199,   152,   149,   152,    76,   126,    78,   128,
-     150,    67,    68,    69,    70,    71,    72,   136,    73,   153,
-      78,    81,   204,   169,   422,   611,   146,   220,   165,    85,
-     603,   128,    90,   152,   171,   146,   150,    64,    65,   146,
-     177,   178,   128,   220,   146,   128,   104,   246,   155,   246,
-     187,    81,   149,   246,   592,   146,   153,   153,    21,    22,
-      88,   198,    25,   479,   155,   151,   482,    95,   151,   246,
-     263,   126,   151,   128,    31,   103,    88,   136,   275,    64,
-      65,   136,   279,    95,   277,   278,   263,    99,   281,   145,
-     287,   284,   285,   290,   150,    26,   146,   151,   295,   672,
-     277,   278,   518,   519,   281,   155,   644,   284,   285,   246,
-     151,   523,   528,   529,     8,    72,   262,   151,   146,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,   813,     8,   151,   146,   151,   282,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,   128,
-     287,   151,   349,   290,   128,   128,    72,   136,   295,   133,
-     133,   343,    21,    22,    58,    59,   197,    72,   365,   126,
-     367,   128,   758,   370,   136,   136,   128,   151,   151,   136,
-      88,   374,    58,    59,   136,   146,   151,    95,    88,   146,
-     136,    99,   608,   151,   155,    95,   149,   149,   155,    99,
-     153,   151,   165,   103,   128,   402,   136,   151,   171,   133,
-     126,   149,   128,   611,   177,   178,   146,   363,   415,   149,
-     136,   126,   151,   128,   187,   155,   151,   151,   149,   422,
-     146,   136,   128,   149,   136,   198,   133,   133,   146,   155,
-     151,   146,   133,   440,   441,   422,   146,   444,   156,   136,
-     155,    67,    68,    69,    70,    71,    72,   130,   152,    88,
-     128,    49,   459,   128,    72,   402,    95,   133,   129,    85,
-      99,   468,   469,   133,   103,   136,   152,   474,   415,   476,
-     477,   128,   461,   246,    88,   146,   133,   136,   128,   827,
-     126,    95,   128,   133,   473,    99,   493,   146,   480,   151,
-     136,   480,   136,   440,   441,   502,   155,   504,   128,   480,
-     507,   480,   146,    72,   128,   512,   133,   146,   126,   498,
-     128,   155,   459,   133,   523,   130,   523,   290,   136,   145,
-     523,   468,   469,   479,   150,   136,   482,   474,   146,   476,
-     477,    13,   146,   540,   541,   146,   523,   155,   545,   546,
-      13,   548,   136,   147,   155,   287,   493,   153,   153,    88,
-     758,   152,   559,   295,   123,   502,    95,   126,   154,   128,
-      99,   136,   518,   519,    45,    46,    47,   136,    49,   136,
-     107,   527,   528,   529,   107,   151,   523,   146,   146,   571,
-     152,   588,   571,     8,    13,   592,   155,   151,   153,   596,
-     571,   152,   571,   540,   189,     8,   603,   192,   545,   546,
-      74,   548,   153,   151,   150,    61,   136,   146,   611,   136,
-     151,   206,   559,   208,    13,   210,   211,   624,   117,   151,
-     151,   628,   151,     8,   611,   128,   152,   151,   151,   402,
-     152,   151,   157,   625,    13,   133,   136,   644,    13,   746,
-     632,   157,   415,    67,    68,    69,    70,    71,    72,   656,
-     136,    79,   608,   645,     8,   152,   603,   153,   152,   128,
-     149,   668,   152,   670,     8,   672,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,   624,    49,   151,
-     130,   628,    42,    43,    44,    45,    46,    47,   112,    49,
-     679,   680,   103,   136,   683,   468,   469,    13,   440,   441,
-     153,   474,    96,   476,   477,   152,   152,   151,   715,   656,
-     149,   552,   153,   153,   706,   153,   152,   459,   144,   146,
-     493,   668,   563,   670,    13,   672,   157,    96,     8,   152,
-     152,   152,   152,   152,   723,   153,   152,   152,   150,   149,
-      13,   582,   151,   146,   152,   151,   153,   152,   136,   756,
-     523,   153,   153,   760,   146,   758,   112,   146,   149,    13,
-     502,    96,   130,    26,   151,    66,   773,   774,   715,   153,
-     152,   758,   764,   546,    13,   548,    13,   784,   136,   771,
-     146,    13,   149,   153,   146,   136,   559,   779,    13,   153,
-      13,   783,   151,   800,   146,    26,   788,    79,   540,   791,
-      21,    22,   794,   545,   793,   812,   813,   153,   151,   756,
-     152,   152,   146,   760,   349,   507,   149,   560,   824,   811,
-     827,   493,   628,   680,   734,   313,   773,   774,   648,   821,
-     603,   596,   707,   602,   171,   617,   536,   784,   786,   476,
-      -1,    62,   477,   835,    -1,    -1,    -1,   839,    -1,    -1,
-      -1,    -1,    -1,   800,    -1,   628,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   812,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    -1,    -1,
-      23,    24,   624,   724,    -1,    -1,    -1,    30,    -1,    -1,
-      -1,    -1,    35,    -1,    -1,    -1,   737,    40,    -1,   672,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   750,
-      -1,    -1,    -1,   754,   656,    -1,    -1,    -1,    -1,    62,
-     761,    -1,    -1,    -1,    67,   766,   668,    -1,   670,   770,
-      -1,    74,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,   165,    49,    -1,    -1,   169,    -1,
-     171,    -1,    -1,    -1,   795,    -1,   177,   178,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   187,   110,   111,   112,
-     113,   114,    -1,   715,    -1,    -1,   817,   198,    -1,    -1,
-      -1,   295,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     831,    -1,    -1,    -1,    -1,    -1,    -1,   838,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      -1,    -1,   155,    -1,   756,    -1,    -1,    -1,   760,    -1,
-      -1,    -1,    -1,   166,    -1,   168,   169,    -1,    -1,    -1,
-      -1,   773,   774,   176,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   262,   784,    58,    59,   188,    -1,    -1,    -1,    -1,
-      -1,    -1,   195,    -1,    -1,    -1,    -1,    -1,   800,    74,
-     203,   282,    -1,    -1,    -1,    -1,   209,    -1,    -1,   290,
-     812,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   221,   222,
+       2,    52,   113,    20,   512,     2,    52,    52,   365,     2,
+     367,   220,   454,     2,   318,   422,   312,   415,   235,     3,
+       3,     3,     3,    40,     9,     3,    21,     3,     3,     9,
+      24,    24,     3,     3,    51,    52,     3,    54,     3,     3,
+     576,    59,     3,     3,     3,    46,    45,    33,     6,    26,
+     111,     6,   151,    70,   263,    54,   107,   111,    21,   363,
+       9,     9,    48,   111,   149,   133,    65,   196,   153,   111,
+     279,   280,   133,     0,    21,    21,    21,   108,   111,    21,
+     111,    33,    83,   151,    12,    13,    14,    15,    16,    17,
+      15,    16,    17,    61,   133,   149,    48,    65,   111,   153,
+     112,    36,   133,   151,   640,   118,   642,    20,   317,   151,
+      22,   320,   321,   130,   108,    26,   145,   111,   151,    45,
+      36,   133,   173,   118,   141,    20,   155,    40,    54,   147,
+      42,    45,   149,   145,   111,   533,   151,   535,   151,   133,
+      54,   145,   159,   160,   161,    40,   145,    61,   165,     9,
+     507,   155,    24,   151,   149,   118,   151,    52,   152,    87,
+     145,    73,    87,   467,   150,   145,   183,   114,   152,   220,
+     153,   153,   153,   469,   220,   153,   480,   153,   153,   621,
+     197,   152,   199,   153,   235,   152,   149,   152,   152,   235,
+     235,   152,   152,   152,   149,   153,   145,   145,   150,   133,
+     111,   111,   204,   149,   149,   603,   151,   149,   118,   121,
+     122,   123,   263,   422,   518,   519,   133,   263,   235,   145,
+     132,    76,   151,    78,   528,   529,   633,    22,   279,   280,
+     145,   145,   144,   279,   280,   592,   108,   145,   150,   111,
+     155,   151,   156,    45,   262,   151,   141,    42,   108,    58,
+      59,   111,    54,   270,   149,   111,     3,     4,   275,    61,
+     277,   133,   118,    65,   159,   160,   317,   665,   133,   320,
+     321,   317,   132,   133,   320,   321,    23,    45,    73,     6,
+     145,   151,   111,   151,   111,   145,    54,   644,   183,   118,
+     155,   118,    45,    61,    41,   155,    33,    65,   315,    46,
+     318,    54,   197,    50,   608,   813,   523,   151,    61,     3,
+       4,    48,   151,    10,    11,    12,    13,    14,    15,    16,
+      17,   338,    45,   374,   151,   151,   121,   122,   123,    23,
+      67,    54,   349,    58,    59,   111,    83,   132,    61,   151,
+     235,   343,   118,   145,   151,   363,   111,    41,   365,   144,
+     367,   758,    46,   370,    33,   150,    50,    45,   105,   106,
+     107,   149,   108,   149,   151,   111,    54,   151,   133,    48,
+     117,   422,   119,    61,   133,   270,   422,   145,   133,     9,
+     275,   128,    22,   130,   149,   402,   132,   133,    67,    83,
+      87,   151,   145,   114,   118,    92,   118,   111,   415,   145,
+      97,   148,    87,   149,     4,   152,   111,   118,   118,   155,
+     146,   105,   106,   107,   133,   432,   433,   546,   153,   436,
+     152,   111,   145,   117,   633,   119,   118,   111,   557,   446,
+     127,   151,   129,    73,   128,   118,   130,    77,   133,   456,
+     457,   114,     4,   338,   153,   462,   154,   464,   465,   467,
+     145,   133,   133,   582,   148,   448,   133,   145,   152,   133,
+     155,    71,   480,   145,   145,    71,   468,   149,   461,     3,
+     827,   468,   523,   155,   155,   468,   493,   523,   523,   468,
+     151,   121,   122,   123,   152,   502,   133,   504,   108,   109,
+     507,   111,   132,     4,   151,   512,   152,     3,   145,   153,
+     518,   519,    26,   153,   150,   498,   523,   402,   155,   527,
+     528,   529,   132,   133,   151,   133,   533,    21,   535,   145,
+     415,   133,   539,   540,   151,   145,     4,   185,    82,   151,
+     188,   152,    99,     3,   151,   155,   553,   432,   433,   111,
+     151,   108,   151,   151,   111,   118,   151,   133,   206,   758,
+     208,   446,   210,   211,   157,     4,   108,   574,   152,   111,
+     157,   456,   457,   565,     4,   132,   133,   462,   565,   464,
+     465,   588,   565,    34,   153,   592,   565,   133,   145,   596,
+     132,   133,   633,   152,   152,   111,   603,   633,   155,     3,
+     608,   149,   152,   145,     3,   724,   151,    65,   493,     4,
+     133,   618,   153,   155,    55,   622,   152,   502,   737,   108,
+     152,   114,   111,   153,   153,   151,   153,   619,   149,     4,
+     152,   750,   143,   145,   626,   754,    55,   644,   523,   152,
+       3,   150,   761,   132,   133,   746,   765,   152,   533,   656,
+     535,   770,   152,   645,   539,   152,   145,   152,   665,   157,
+     667,   153,   669,   149,   152,   152,   155,   151,   553,     4,
+     152,   151,   153,   152,   145,   153,   795,   153,   133,   145,
+      77,   145,   149,     4,    55,   114,     6,    66,   151,   574,
+       4,   153,     4,   676,   677,   152,   679,   133,   817,   145,
+       4,   153,   149,   145,     4,   133,     4,   145,   715,   153,
+     153,   151,   831,     4,   706,    34,     6,   758,   603,   838,
+     152,   145,   758,   349,   151,   824,   152,   149,   493,   554,
+     622,   677,    23,   618,   507,   734,   648,   622,   298,   596,
+     723,   602,   615,   707,   149,   569,   786,   465,   464,   756,
+      41,    -1,    -1,   760,    -1,    46,    20,    -1,    -1,    50,
+      -1,    -1,    -1,    -1,    -1,    -1,   773,   774,    -1,    -1,
+      -1,   656,   764,    -1,    -1,    -1,    40,   784,    -1,   771,
+     665,    -1,   667,    -1,   669,    -1,    -1,   779,    52,    -1,
+      -1,   783,    83,   800,    -1,    -1,   788,    -1,   790,    -1,
+      -1,    -1,   794,    -1,    -1,   812,   813,    -1,    -1,    -1,
+     793,    -1,    -1,    -1,   105,   106,   107,    -1,    -1,   811,
+     827,    -1,    -1,    -1,    -1,    -1,   117,    -1,   119,   821,
+     715,    -1,    -1,    -1,    -1,    -1,    -1,   128,    -1,   130,
+      -1,    -1,    -1,   835,    -1,    -1,    -1,   839,    -1,    -1,
+      -1,     4,     5,     6,     7,     8,    -1,   148,    11,    12,
+      13,    -1,   153,    16,    -1,    -1,    19,    -1,    -1,   275,
+      -1,   756,    25,    26,    -1,   760,    -1,   141,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   149,    -1,    -1,   773,   774,
+      -1,    44,    -1,    -1,    -1,   159,   160,    -1,    -1,   784,
+      -1,    -1,    55,    56,    -1,    -1,    59,    -1,    -1,    -1,
+      63,    -1,    -1,    66,    -1,   800,    69,    -1,    -1,   183,
+       4,    74,    -1,    -1,    -1,    -1,    -1,   812,    -1,    -1,
+      -1,    -1,   338,   197,    -1,    -1,    -1,    -1,    -1,    23,
+      -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    41,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    50,   120,    -1,    -1,
+      -1,   235,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   142,
+     143,    -1,    -1,   146,   147,    -1,    -1,    20,    -1,    83,
+      -1,   154,    -1,   156,   157,    -1,   270,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    40,    -1,    -1,
+      -1,   105,   106,   107,   177,   178,   432,   433,    -1,    -1,
+      -1,   184,    -1,   117,    -1,   119,    59,    -1,    -1,    -1,
+     446,   194,    -1,    -1,   128,    -1,   130,    -1,    -1,    -1,
+     203,    -1,    -1,    -1,   338,    -1,   209,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   148,    -1,    -1,    -1,   221,   222,
      223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    -1,    -1,    -1,    -1,   250,   251,   252,
+     233,   234,    -1,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,    -1,    -1,   502,   250,   251,   252,
      253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-      -1,    -1,   265,   266,    -1,    -1,   440,   441,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   282,
-      -1,    -1,   363,    -1,    -1,   459,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   310,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,    11,
-      -1,   402,    -1,    -1,    -1,    -1,    -1,    -1,   502,    -1,
-      -1,    -1,    -1,    25,   415,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
-     363,    -1,    -1,    -1,    -1,    -1,   540,    -1,    -1,    -1,
-      -1,   545,    -1,    -1,    -1,   378,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   468,   469,    -1,
-      -1,    -1,    -1,   474,    -1,   476,   477,    -1,   479,    -1,
-      -1,   482,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    -1,   493,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,   435,    49,    -1,    72,    73,   518,   519,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,   527,   528,   529,    86,
-     624,   454,    -1,   456,    91,    92,    -1,    -1,    -1,   462,
-      -1,   153,    -1,   466,   467,   546,    -1,   548,    -1,    -1,
-      -1,   108,    -1,    -1,   111,    -1,   479,    -1,   559,   482,
-      -1,   484,   656,    -1,    -1,   122,    -1,   124,   125,   126,
-     127,   128,    -1,    -1,   668,    -1,   670,    -1,   135,   136,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    -1,    -1,    -1,   518,   519,    -1,    -1,   522,
-      -1,    -1,   603,    -1,   527,   528,   529,   608,    -1,    -1,
-      -1,    -1,    -1,   536,   537,    -1,    -1,    -1,    -1,    -1,
-      -1,   715,    -1,    -1,    -1,    58,    59,   628,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,   568,    49,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   756,    -1,    -1,    -1,   760,    -1,    -1,    -1,
-      -1,   672,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   773,
-     774,    -1,    -1,    -1,    -1,   608,    -1,    -1,    -1,    -1,
-     784,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     623,    -1,    -1,    -1,   627,    -1,   800,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   812,    -1,
-      -1,    -1,     9,    10,    11,    -1,    -1,    -1,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,   687,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,   731,    -1,
-      85,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   765,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,   144,
-     157,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      25,    12,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    85,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-      -1,   142,   143,   144,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    85,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,    -1,   142,   143,   144,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,    -1,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,   100,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,   105,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-      -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,   265,   266,    -1,    -1,    -1,    -1,   141,    -1,
+      -1,    -1,    -1,    -1,   147,    -1,   149,    -1,    -1,    -1,
+      -1,   284,    -1,   539,    -1,    -1,   159,   160,   402,    -1,
+      -1,    -1,   295,    -1,    -1,    12,    13,    -1,   432,   433,
+      -1,   415,    -1,    -1,    -1,    -1,    -1,    24,    -1,    -1,
+     183,    -1,   446,    -1,    -1,   318,    -1,    -1,   574,    -1,
+      37,    -1,    -1,    -1,   197,    -1,    43,    -1,    -1,    -1,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   456,   457,    -1,    -1,    -1,    -1,   462,    -1,
+     464,   465,    -1,    -1,    -1,    72,    -1,    -1,    -1,    76,
+     363,    -1,   618,    -1,    -1,    -1,    -1,    -1,   502,    -1,
+      -1,    -1,   375,    -1,    -1,    -1,    -1,    -1,    -1,   493,
+      -1,    98,    -1,   100,    -1,    -1,    -1,   104,    -1,   262,
+      -1,   108,    -1,   110,   111,    -1,    -1,   270,    -1,    -1,
+     656,    -1,    -1,    -1,    -1,   539,    -1,    -1,    -1,   523,
+      -1,   667,    -1,   669,   131,   132,   133,    -1,    -1,   533,
+      -1,   535,    -1,    -1,    -1,   428,    -1,   430,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   553,
+     574,    -1,    -1,    -1,    -1,   318,   449,    -1,    -1,    -1,
+      -1,   454,   455,    -1,    -1,    -1,    -1,    -1,    -1,   715,
+      -1,    -1,    -1,    -1,   467,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   475,    -1,    -1,    -1,    -1,   480,    -1,   482,
+      -1,    -1,    -1,    -1,   618,    -1,    -1,    -1,    -1,   603,
+     363,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
+     756,    -1,    -1,    -1,   760,    -1,    -1,    -1,   622,    -1,
+      -1,    -1,    -1,    -1,    -1,   518,   519,   773,   774,   522,
+      -1,    -1,   656,    -1,   527,   528,   529,    -1,   784,   402,
+      -1,    -1,    -1,   667,    -1,   669,    -1,    -1,    -1,    -1,
+      -1,    -1,   415,    -1,   800,    -1,    -1,    -1,    -1,    -1,
+      -1,   665,    -1,    -1,    -1,    -1,   812,    -1,    -1,   562,
+      -1,    -1,    -1,    -1,    -1,    -1,   569,   570,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,   715,    -1,   456,   457,    -1,    -1,    -1,    -1,   462,
+      -1,   464,   465,    -1,   467,    -1,     4,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   608,    -1,   480,   127,   612,
+     129,    -1,    -1,    -1,    -1,    23,    -1,    -1,   621,    -1,
+     493,    -1,   756,    -1,    -1,    -1,   760,    -1,    -1,    -1,
+      -1,    -1,    -1,    41,    -1,    -1,    -1,    -1,    46,   773,
+     774,    -1,    50,    -1,    -1,   518,   519,    -1,    -1,    -1,
+     784,    -1,    -1,    -1,   527,   528,   529,    -1,    -1,    -1,
+     533,    -1,   535,    -1,    -1,    -1,   800,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    83,    -1,    -1,   812,    -1,
+     553,    -1,    -1,     5,   687,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,   105,   106,   107,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,   117,
+      -1,   119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     128,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,   732,
+     603,    -1,    -1,    -1,    -1,   608,    -1,    -1,    -1,    -1,
+     148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   622,
+      -1,    -1,    -1,    -1,    -1,    -1,    11,    12,    13,    14,
+      15,    16,    17,   766,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,     6,    -1,   101,
+     102,   103,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,   665,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,   127,    -1,   129,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    87,    -1,    -1,   157,    -1,    92,    -1,    -1,
+      69,    70,    97,    72,    -1,    74,    75,    76,    77,    78,
+      79,    -1,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,   127,    -1,   129,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,     6,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      -1,    74,    75,    76,    77,    78,    79,    -1,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,    -1,   140,   141,   142,
+      -1,    -1,   145,   146,    -1,    -1,   149,    -1,   151,     6,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    -1,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,     6,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      -1,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,
+      -1,    72,    -1,    74,    75,    76,    77,    78,    79,    -1,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,    -1,   140,
+     141,   142,    -1,    -1,   145,   146,    -1,    -1,   149,    -1,
+     151,     6,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    74,
+      75,    76,    77,    78,    79,    -1,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,    -1,   140,   141,   142,    -1,    -1,
+     145,   146,    -1,    -1,   149,    -1,   151,     6,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,
+      49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,
+      -1,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,
+      -1,    -1,   151,    -1,    -1,   154,   155,   156,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,     5,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,    -1,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+     127,    -1,   129,   101,   102,   103,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,   127,
+      -1,   129,    29,    30,    -1,    -1,    -1,     5,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+     127,    -1,   129,   101,   102,   103,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,   127,
+      -1,   129,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,   101,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     9,    -1,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      87,    -1,    28,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    37,    38,    -1,   101,   102,   103,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+     127,    -1,   129,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,   153,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,   155,
+     156,    -1,    18,    19,    20,    -1,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,
+      46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,
+      56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+      -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+      -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,    -1,   145,
+      -1,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
+     156,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-      -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,    -1,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-      -1,   116,    -1,   118,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,    -1,   116,    -1,   118,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-      -1,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,    -1,   116,
-      -1,   118,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,    -1,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,    -1,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,    -1,   116,    -1,   118,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,    -1,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-      -1,   116,    -1,   118,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,    -1,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    29,    30,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-      91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,     3,     4,
-       5,     6,     7,    -1,   135,   136,   137,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,
-     151,    -1,   153,   154,   155,   156,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    -1,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,     3,     4,     5,     6,     7,    -1,
-     135,   136,   137,    12,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   146,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,
-     155,   156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,
-      -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-      -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-       3,     4,     5,     6,     7,    -1,   135,   136,   137,    12,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,
-      -1,    -1,   151,    -1,   153,   154,   155,   156,    31,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    -1,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,
-      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,     3,     4,     5,     6,
-       7,    -1,   135,   136,   137,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,
-      -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,
-      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,     3,     4,     5,     6,     7,   135,   136,
-     137,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,   146,
-      -1,    -1,    -1,    -1,   151,   152,    26,   154,   155,   156,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,   127,    -1,   129,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,     3,
-       4,     5,     6,     7,    -1,   135,   136,   137,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    31,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,
-      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,     3,     4,     5,     6,     7,
-      -1,   135,   136,   137,    12,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,
-     154,   155,   156,    31,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,    31,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    31,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    -1,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
-     156,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,     3,
-       4,     5,     6,     7,    -1,   135,   136,   137,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    31,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    -1,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,
-      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,     3,     4,     5,     6,     7,
-      -1,   135,   136,   137,    12,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,
-     154,   155,   156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    -1,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,    -1,    -1,    -1,
-      -1,    -1,    -1,   135,   136,   137,    -1,    -1,    -1,     9,
-      10,    11,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    25,    -1,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,   150,    91,    92,    93,
+      94,    95,   127,    97,   129,    -1,    -1,   101,   102,   103,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   153,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,   153,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   153,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   152,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     152,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
+      -1,    -1,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,   150,    -1,    28,
+      -1,    -1,    31,   127,    -1,   129,    -1,    36,    37,    38,
+      -1,    -1,    -1,    42,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,   150,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,   143,    -1,   145,   146,    -1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,   143,
+      -1,   145,   146,    -1,    -1,   149,   150,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    42,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,   143,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,   150,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    62,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      64,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,   150,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,   150,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,   150,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,   150,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    22,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+      -1,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      74,    75,    76,    77,    78,    79,    -1,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,    -1,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,
+      49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,
+      -1,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,
+      -1,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,    -1,    -1,   151,    -1,   153,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,
+      49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,
+      -1,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,
+      -1,    -1,   151,    -1,   153,   154,   155,   156,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    -1,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,    -1,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,    -1,    -1,   151,   152,    -1,
+     154,   155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,
+      49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,
+      -1,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,
+      -1,    -1,   151,    12,    13,   154,   155,   156,    -1,    18,
+      19,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,
+      49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,
+      -1,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,
+      -1,    -1,   151,    -1,    -1,   154,   155,   156,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      -1,    29,    30,    -1,    -1,    -1,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    29,    30,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+     127,    -1,   129,   101,   102,   103,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   152,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,    -1,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,   127,
+      97,   129,    -1,    -1,   101,   102,   103,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     127,    -1,   129,    29,    30,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   152,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,     9,    10,    11,    -1,    -1,
+      29,    30,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,   127,   101,   129,   103,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,   127,   101,
+     129,    -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    29,    30,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,    -1,    -1,
+     127,    -1,   129,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,   127,    -1,   129,    87,    -1,    -1,
+      -1,    91,    92,    93,    94,    95,    -1,    97,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   152,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
+      -1,    -1,    -1,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   152,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   150,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   150,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   150,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   150,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     150,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,    -1,     9,    10,    11,    96,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    87,    97,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   150,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
-      96,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    10,    11,
+      -1,    -1,   127,    -1,   129,    -1,    -1,    -1,    -1,    -1,
+      87,   127,    -1,   129,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    11,    49,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49
+     127,    -1,   129
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   159,   160,     0,     3,     4,     5,     6,     7,    12,
-      42,    43,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    62,    63,    70,    71,    72,    73,
-      76,    81,    82,    85,    86,    87,    89,    91,    92,    93,
-      97,    98,   106,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   118,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   134,   135,   136,   137,   138,   139,   142,   143,
-     144,   146,   147,   149,   151,   153,   154,   155,   156,   161,
+       0,   159,   160,     0,    12,    13,    18,    19,    20,    22,
+      24,    25,    28,    31,    36,    37,    38,    42,    43,    44,
+      46,    47,    49,    51,    52,    56,    57,    60,    69,    70,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      83,    84,    85,    86,    89,    90,    96,    98,    99,   100,
+     104,   108,   109,   110,   111,   113,   120,   124,   125,   126,
+     131,   132,   133,   134,   135,   136,   137,   140,   141,   142,
+     143,   145,   146,   149,   151,   153,   154,   155,   156,   161,
      162,   167,   170,   171,   177,   178,   180,   182,   185,   187,
      226,   228,   231,   234,   243,   246,   250,   251,   253,   254,
      260,   261,   262,   263,   264,   265,   266,   271,   279,   285,
-     283,   282,   151,   281,   280,    72,   126,   136,   228,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   126,   128,   161,   234,   253,   254,   262,   253,   250,
-     250,   126,   128,   161,   234,   236,   237,   262,   264,   265,
-     271,    81,    81,   146,   212,   151,   153,   250,   136,   153,
-     250,   151,   170,   223,   250,   151,   151,   240,   151,   151,
-     146,   155,   210,   211,   136,   151,   151,   151,   151,   128,
-     149,   161,   161,   153,   226,   250,   254,    88,    95,    99,
-     103,   146,   276,   277,    26,   151,   250,   149,   151,   128,
-     161,   165,   166,   151,   168,   250,    99,   241,   276,   149,
-      99,   276,   128,   151,     8,   153,   136,   136,    31,   179,
-     133,     9,    10,    11,    25,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    49,   153,    58,    59,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,   151,   133,   130,    61,   149,   155,   265,   250,
-     250,   250,   250,   250,   179,   128,   161,   133,   133,   128,
-     161,   133,   151,   242,   133,   130,   265,    13,     8,   153,
-      31,   250,   274,   275,   153,    13,   153,   136,   196,   147,
-       8,   153,   254,   152,   250,   224,   225,   250,   226,   254,
-     149,   251,   254,     8,   153,   153,   152,   250,   254,   284,
-     123,   254,   272,   273,   161,   164,   149,   153,   151,   153,
-     153,   254,   137,   250,   103,   277,    61,   130,    99,   103,
-     277,   250,   153,   168,   175,   176,   254,   161,    74,     8,
-     153,   250,   115,   150,   169,   170,   177,   178,   152,   154,
-     250,   156,   136,   232,   136,   107,   186,   107,   188,   136,
-     151,   136,   260,   265,   271,   250,   250,   250,    26,   250,
+     108,   132,   133,   228,   250,   250,   250,   250,   250,    36,
+     151,   250,   250,   153,   250,   250,   133,   153,   250,   108,
+     111,   161,   234,   253,   254,   262,   151,   170,   250,   223,
+     250,   151,   151,   151,   240,    36,   151,   151,   145,   155,
+     210,   211,   133,   151,   151,   253,   280,   281,   250,   151,
+     151,   111,   149,   161,   108,   111,   161,   234,   236,   237,
+     262,   264,   265,   271,   161,   250,   250,   282,   283,   153,
+     226,   250,   254,    45,    54,    61,    65,   145,   276,   277,
+     145,   212,     6,   250,   151,   250,   149,   151,   250,   111,
+     161,   165,   166,   151,   168,   250,    61,   241,   276,   149,
+      61,   276,   111,   151,     3,   153,   133,   133,     9,   179,
+     118,     5,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    29,    30,    87,    91,    92,    93,    94,
+      95,    97,   101,   102,   103,   127,   129,   153,    46,    83,
+       4,    23,    41,    50,   105,   106,   107,   117,   119,   128,
+     130,   148,   151,   118,   114,    21,   149,   155,   265,   179,
+       9,   250,   274,   275,   153,     4,   153,   111,   161,   118,
+     118,   133,   196,   146,     3,   153,   254,   250,   152,   250,
+     224,   225,   250,   226,   254,   149,   251,   254,     3,   153,
+     153,   152,   250,   250,   250,   254,   284,    99,   254,   272,
+     273,   161,   164,   149,   153,   111,   161,   118,   151,   242,
+     118,   114,   265,   151,   250,   250,   153,   153,   254,   135,
+     250,    65,   277,    21,   114,    61,    65,   277,     4,     3,
+     153,   250,   153,   168,   175,   176,   254,   161,    26,     3,
+     153,   250,    80,   150,   169,   170,   177,   178,   152,   154,
+     250,   156,   133,   232,   133,    71,   186,    71,   188,   133,
+     151,   133,   260,   265,   271,     6,   250,   250,   250,   250,
      250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   236,    31,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,    31,   208,   209,   226,   254,
-     136,   260,   255,   250,   267,   250,   152,   161,   136,   136,
-     161,   260,   208,   260,   136,   149,   260,   268,   269,   270,
-      42,    43,    73,   126,   128,   135,   161,   234,   243,   244,
-     245,   146,   252,   254,    96,   152,     8,   248,   244,    13,
-       8,   152,   151,   250,   152,   152,   153,     8,    74,    74,
-     250,   211,   153,   152,     8,   152,   151,     8,   152,   151,
-     160,   163,   233,   150,    61,   150,   129,   136,   146,   278,
-     136,   152,   150,     8,   152,    74,   136,   166,   152,   151,
-     150,   208,    13,   126,   128,   161,   235,   117,   189,   190,
-     235,   184,   151,    73,   205,   206,   207,   235,   151,   151,
-     265,   250,    26,    63,   254,   252,   152,     8,   151,   151,
-     268,   157,   150,   152,   250,   238,    61,   149,   244,   244,
-     151,   128,   161,    99,   133,    13,    31,   250,    31,   250,
-     244,   136,    26,   170,   195,   250,   224,   250,   254,    31,
-     192,   254,   150,    26,   170,   254,   272,   273,    13,   208,
-     150,   160,   208,   250,   157,    26,   149,   197,    79,   176,
-     153,   136,    26,   170,   200,   152,   152,   244,   128,   161,
-     190,   183,     8,   149,   205,   152,     8,    31,   146,   208,
-     208,   250,   236,    31,   226,   254,   208,   208,   151,   259,
-     150,   130,   239,   267,   250,   244,   247,   249,   161,   136,
-     244,   252,   252,    96,    13,   168,   152,   153,    96,   191,
-     254,   191,   168,   201,   152,   250,   152,   150,   152,   157,
+     236,   250,   250,   250,   250,   250,   250,   250,   250,   250,
+     250,   250,     9,   250,   250,   250,   250,   250,   250,   250,
+     250,   250,   250,   250,   250,     9,   208,   209,   226,   254,
+     133,   260,   255,   250,   267,   250,   252,   254,    55,   152,
+       3,   248,    12,    13,    24,   108,   111,   131,   161,   234,
+     243,   244,   245,   161,   133,   133,     4,     3,   152,   151,
+     250,   152,   152,   152,   153,     3,    26,    26,   250,   211,
+     153,   152,     3,   152,   151,     3,   152,   151,   160,   163,
+     161,   260,   208,   260,   133,   149,   260,   268,   269,   270,
+     233,   150,    21,   150,   112,   133,   145,   278,   133,   244,
+     145,   152,   150,     3,   152,    26,   133,   166,   152,   151,
+     150,   208,     4,   108,   111,   161,   235,    82,   189,   190,
+     235,   184,   151,    24,   205,   206,   207,   235,   151,   151,
+     265,   250,     6,   109,   254,   252,   152,     3,   151,   151,
+     268,   157,   150,     9,   250,     9,   250,   244,   244,   151,
+     111,   161,    61,   118,   244,   133,     6,   170,   195,   250,
+     224,   250,   254,     9,   192,   254,   150,     6,   170,   254,
+     272,   273,     4,   208,   150,   160,   152,   250,   238,    21,
+     149,   208,   250,   157,     4,     6,   149,   197,    34,   176,
+     153,   133,     6,   170,   200,   152,   152,   244,   111,   161,
+     190,   183,     3,   149,   205,   152,     3,     9,   145,   208,
+     208,   250,   236,     9,   226,   254,   208,   208,   151,   259,
+     252,   252,    55,   244,   247,   249,   161,   133,     4,   168,
+     152,   153,    55,   191,   254,   191,   168,   201,   152,   250,
+     152,   150,   150,   114,   239,   267,   250,   152,   157,   244,
      153,   198,   153,   198,   151,   168,   153,   161,   149,   235,
-     213,   152,   144,   229,   207,   146,    13,   152,   152,   242,
-     252,   152,   152,   208,   256,   268,   157,   150,    96,   152,
-       8,   248,    31,   250,   244,   100,   153,   224,   192,   152,
-     152,   202,    64,    65,   203,   150,   198,    78,    90,   104,
-     198,   150,   235,   105,   213,    67,    68,    69,    70,    71,
-      72,    85,   145,   150,   214,   217,   218,   219,   220,   222,
-     181,   151,   149,    31,   146,    13,   244,   152,   257,   244,
-     244,   252,   153,   152,    26,   170,   194,   194,    64,    65,
-     204,   151,   170,   104,   250,    26,   153,   199,   153,   150,
-     146,   153,   150,   136,   146,   221,   228,   220,     8,   153,
-     149,    31,   146,   230,   227,   146,    13,   244,   130,   258,
-      96,    26,   170,   193,   168,   151,    26,    66,   250,   153,
-     199,   168,   152,    13,    13,     8,   153,   179,   136,   168,
-     146,     8,   152,   168,    13,   244,   268,   244,   168,   102,
-     250,   168,   153,   152,   168,   149,   244,   244,   146,   136,
-      13,   150,    31,   146,   150,   244,   259,   101,   153,   152,
-     170,   168,    13,   151,   244,   146,   153,    26,   150,   244,
-     205,   168,    79,   172,   173,   174,   152,   151,   174,   215,
-     235,   149,   153,   216,   146,   168,   152,   150,   149,   168,
+     213,   152,   143,   229,   207,   145,     4,   152,   152,   242,
+     252,   152,   152,   208,   256,     9,   250,    55,   152,     3,
+     248,   244,    62,   153,   224,   192,   152,   152,   202,    58,
+      59,   203,   268,   157,   150,   150,   198,    33,    48,    67,
+     198,   150,   235,    68,   213,    22,    42,    73,   121,   122,
+     123,   132,   144,   150,   214,   217,   218,   219,   220,   222,
+     181,   151,   149,     9,   145,     4,   244,   152,   257,   252,
+     244,   244,   153,   152,     6,   170,   194,   194,    58,    59,
+     204,   170,   151,    67,   250,     6,   153,   199,   153,   150,
+     145,   153,   150,   133,   145,   221,   228,   220,     3,   153,
+     149,     9,   145,   230,   227,   145,     4,   244,   114,   258,
+      55,     6,   170,   193,   168,     6,   151,    66,   250,   153,
+     199,   168,   152,     4,     4,     3,   153,   179,   133,   168,
+     145,     3,   152,   168,     4,   244,   268,   244,   168,    64,
+     168,   250,   153,   152,   168,   149,   244,   244,   145,   133,
+       4,   150,     9,   145,   150,   244,   259,    63,   153,   152,
+     170,   168,     4,   151,   244,   145,   153,     6,   150,   244,
+     205,   168,    34,   172,   173,   174,   152,   151,   174,   215,
+     235,   149,   153,   216,   145,   168,   152,   150,   149,   168,
      150
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
-
-#define YYRECOVERING()  (!!yyerrstatus)
-
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* This macro is provided for backward compatibility. */
-
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
-
-
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, analyzer, observers)
-#endif
-
-/* Enable debugging if requested.  */
-#if YYDEBUG
-
-# ifndef YYFPRINTF
-#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYFPRINTF fprintf
-# endif
-
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, analyzer, observers); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
+     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
+     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
+     169,   169,   170,   170,   171,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   172,   172,   173,   173,   174,   175,   175,   176,   177,
+     178,   179,   179,   181,   180,   183,   182,   184,   182,   185,
+     185,   185,   186,   186,   187,   188,   188,   189,   189,   190,
+     190,   191,   191,   192,   192,   193,   193,   194,   194,   195,
+     195,   196,   196,   197,   197,   197,   197,   198,   198,   198,
+     199,   199,   200,   200,   201,   201,   202,   202,   203,   203,
+     204,   204,   205,   205,   206,   206,   206,   206,   206,   206,
+     206,   206,   207,   207,   207,   208,   208,   209,   209,   209,
+     209,   209,   209,   210,   210,   211,   211,   211,   212,   212,
+     212,   212,   213,   213,   214,   214,   215,   214,   216,   216,
+     217,   217,   218,   218,   219,   219,   220,   220,   220,   220,
+     220,   220,   221,   221,   221,   221,   222,   222,   223,   223,
+     224,   224,   225,   225,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   227,   226,   228,   229,   229,   230,   230,   230,   230,
+     232,   231,   231,   233,   231,   231,   231,   231,   231,   231,
+     234,   234,   234,   234,   235,   235,   235,   236,   236,   237,
+     237,   238,   238,   239,   240,   240,   240,   241,   241,   241,
+     242,   242,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   244,   244,   244,   244,   244,   244,
+     244,   244,   245,   246,   246,   246,   246,   246,   246,   246,
+     246,   247,   247,   248,   248,   249,   249,   249,   249,   250,
+     250,   251,   252,   253,   255,   256,   254,   254,   257,   257,
+     258,   259,   259,   260,   260,   261,   261,   262,   263,   263,
+     264,   264,   264,   265,   265,   265,   266,   266,   267,   267,
+     268,   268,   269,   269,   269,   270,   270,   271,   271,   272,
+     272,   273,   273,   273,   274,   274,   275,   275,   275,   275,
+     275,   275,   275,   275,   276,   276,   276,   276,   277,   277,
+     277,   277,   277,   277,   278,   278,   278,   279,   279,   280,
+     279,   281,   279,   279,   282,   279,   283,   279,   284,   284,
+     285,   285
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
+       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
+       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
+       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
+       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
+       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
+       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
+       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
+       2,     2,     0,     2,     1,     0,     2,     0,     2,     1,
+       3,     0,     2,     1,     2,     1,     4,     1,     4,     1,
+       4,     3,     5,     3,     4,     4,     5,     0,     5,     4,
+       1,     1,     1,     4,     0,     6,     0,     7,     0,     2,
+       0,     3,     1,     0,     2,     3,     5,     4,     4,     5,
+       7,     6,     0,     1,     1,     1,     0,     1,     1,     2,
+       3,     3,     4,     3,     1,     1,     2,     4,     3,     5,
+       1,     3,     2,     0,     3,     2,     0,     9,     1,     3,
+       1,     1,     0,     1,     1,     2,     1,     1,     1,     1,
+       1,     1,     3,     5,     1,     3,     5,     4,     3,     1,
+       0,     1,     3,     1,     6,     3,     4,     6,     3,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     2,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     5,     4,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     4,     3,
+       2,     0,    10,     1,     0,     4,     3,     4,     1,     2,
+       0,     5,     6,     0,     6,     6,     6,     6,     6,     4,
+       1,     1,     3,     2,     1,     3,     2,     1,     1,     4,
+       1,     2,     0,     2,     0,     2,     3,     0,     1,     1,
+       0,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     2,     1,     1,     3,     2,     2,     2,
+       4,     1,     3,     1,     1,     1,     3,     2,     1,     3,
+       3,     0,     2,     0,     1,     5,     3,     3,     1,     1,
+       1,     1,     1,     1,     0,     0,     7,     1,     2,     0,
+       3,     3,     0,     1,     2,     3,     3,     1,     1,     1,
+       1,     2,     1,     4,     4,     1,     1,     4,     0,     1,
+       1,     1,     4,     4,     1,     1,     3,     1,     2,     3,
+       1,     1,     4,     0,     0,     2,     5,     3,     3,     1,
+       6,     4,     4,     2,     2,     2,     1,     2,     1,     4,
+       3,     3,     6,     3,     1,     1,     1,     4,     4,     0,
+       3,     0,     3,     4,     0,     3,     0,     3,     1,     3,
+       3,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = PHP53_RESOURCE_EMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == PHP53_RESOURCE_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use PHP53_RESOURCE_error or PHP53_RESOURCE_UNDEF. */
+#define YYERRCODE PHP53_RESOURCE_UNDEF
+
+
+/* Enable debugging if requested.  */
+#if PHP53_RESOURCE_DEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, analyzer, observers); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yyvaluep)
     return;
-  YYUSE (analyzer);
-  YYUSE (observers);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, analyzer, observers);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -3052,16 +3397,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -3072,65 +3409,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule, analyzer, observers)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , analyzer, observers);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], analyzer, observers);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, analyzer, observers); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, analyzer, observers); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+#else /* !PHP53_RESOURCE_DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
+#endif /* !PHP53_RESOURCE_DEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -3144,49 +3472,118 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
 
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
 
-#if YYERROR_VERBOSE
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yypstate* yyps;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypstate_expected_tokens (yypstate *yyps,
+                          yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyps->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+/* Similar to the previous function.  */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  return yypstate_expected_tokens (yyctx->yyps, yyarg, yyargn);
+}
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static char *
 yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
 {
   char *yyd = yydest;
   const char *yys = yysrc;
@@ -3196,10 +3593,10 @@ yystpcpy (yydest, yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -3207,75 +3604,56 @@ yystpcpy (yydest, yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -3298,60 +3676,79 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
   if (*yymsg_alloc < yysize)
     {
@@ -3359,7 +3756,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -3371,144 +3768,161 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep, analyzer, observers)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
-  YYUSE (yyvaluep);
-  YYUSE (analyzer);
-  YYUSE (observers);
-
+  YY_USE (yyvaluep);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-/*----------.
-| yyparse.  |
-`----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
-int
-yyparse (analyzer, observers)
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
-#endif
 {
-/* The lookahead symbol.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      yyerror (analyzer, observers, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, analyzer, observers);
+  yypstate_delete (yyps);
+  return yystatus;
+}
 
-    /* Number of syntax errors so far.  */
-    int yynerrs;
+int
+yypull_parse (yypstate *yyps, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
+{
+  YY_ASSERT (yyps);
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, analyzer, observers);
+    yystatus = yypush_parse (yyps, yychar, &yylval, analyzer, observers);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+#define php53_resource_nerrs yyps->php53_resource_nerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+  yyssp = yyss;
+  yyvsp = yyvs;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
+
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
+
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
 
-    YYSIZE_T yystacksize;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
+
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3516,111 +3930,121 @@ YYSTYPE yylval;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+    case 2:
+      yypstate_clear (yyps);
+      break;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+    default:
+      break;
+    }
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = PHP53_RESOURCE_EMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -3631,18 +4055,39 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == PHP53_RESOURCE_EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= T_END)
     {
-      yychar = yytoken = YYEOF;
+      yychar = T_END;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == PHP53_RESOURCE_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = PHP53_RESOURCE_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3670,13 +4115,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = PHP53_RESOURCE_EMPTY;
   goto yynewstate;
 
 
@@ -3691,14 +4136,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3711,2987 +4156,2600 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-
-/* Line 1806 of yacc.c  */
-#line 341 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.MakeAst((yyvsp[(1) - (1)].statementList)); }
+  case 2: /* start: top_statement_list  */
+#line 342 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { if (analyzer.WasCancelled()) { YYABORT; } if (!observers.DoNotifyEachStatement) { observers.MakeAst((yyvsp[0].statementList)); } }
+#line 4163 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 3:
-
-/* Line 1806 of yacc.c  */
-#line 345 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList)->PushAll((yyvsp[(2) - (2)].statementList)); }
+  case 3: /* top_statement_list: top_statement_list top_statement  */
+#line 346 "/root/repo/src/Php53ResourceParser.y"
+                                                                { if (observers.DoNotifyEachStatement && observers.IsAtTopLevel()) { observers.MakeAst((yyvsp[0].statementList)); observers.ReleaseStatements((yyvsp[-1].statementList)); (yyval.statementList) = (yyvsp[-1].statementList); } 
+												  else { (yyval.statementList) = (yyvsp[-1].statementList)->PushAll((yyvsp[0].statementList)); } }
+#line 4170 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 4:
-
-/* Line 1806 of yacc.c  */
-#line 346 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 4: /* top_statement_list: %empty  */
+#line 348 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4176 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 5:
-
-/* Line 1806 of yacc.c  */
-#line 350 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, (yyvsp[(1) - (1)].lexeme)); }
+  case 5: /* namespace_name: T_STRING  */
+#line 352 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, (yyvsp[0].lexeme)); }
+#line 4182 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 6:
-
-/* Line 1806 of yacc.c  */
-#line 351 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (3)].qualifiedName)->AppendName((yyvsp[(3) - (3)].lexeme)); }
+  case 6: /* namespace_name: namespace_name T_NS_SEPARATOR T_STRING  */
+#line 353 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[-2].qualifiedName)->AppendName((yyvsp[0].lexeme)); }
+#line 4188 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 7:
-
-/* Line 1806 of yacc.c  */
-#line 355 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 7: /* top_statement: statement  */
+#line 357 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4194 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 8:
-
-/* Line 1806 of yacc.c  */
-#line 356 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 8: /* top_statement: function_declaration_statement  */
+#line 358 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4200 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 9:
-
-/* Line 1806 of yacc.c  */
-#line 357 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 9: /* top_statement: class_declaration_statement  */
+#line 359 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4206 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 10:
-
-/* Line 1806 of yacc.c  */
-#line 358 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 10: /* top_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 360 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = 0; }
+#line 4212 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 11:
-
-/* Line 1806 of yacc.c  */
-#line 359 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(2) - (3)].qualifiedName), (yyvsp[(1) - (3)].token));  
-												  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, decl);
-												  observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); 
+  case 11: /* top_statement: T_NAMESPACE namespace_name ';'  */
+#line 361 "/root/repo/src/Php53ResourceParser.y"
+                                                                { pelet::NamespaceDeclarationClass* decl;
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-1].qualifiedName), (yyvsp[-2].token));  
+												  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, decl);
+												  observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); 
 												}
+#line 4222 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 12:
-
-/* Line 1806 of yacc.c  */
-#line 364 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 12: /* $@1: %empty  */
+#line 366 "/root/repo/src/Php53ResourceParser.y"
+                                                                { observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); observers.BeginNamespaceBlock(); }
+#line 4228 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 365 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(2) - (6)].qualifiedName), (yyvsp[(1) - (6)].token));
-												  (yyval.statementList) = (yyvsp[(5) - (6)].statementList)->PushFront(decl);
+  case 13: /* top_statement: T_NAMESPACE namespace_name '{' $@1 top_statement_list '}'  */
+#line 367 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { pelet::NamespaceDeclarationClass* decl;
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-4].qualifiedName), (yyvsp[-5].token));
+												  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(decl); observers.EndNamespaceBlock();
 												}
+#line 4237 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 14:
-
-/* Line 1806 of yacc.c  */
-#line 369 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetDeclaredNamespace(NULL); }
+  case 14: /* $@2: %empty  */
+#line 371 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { observers.SetDeclaredNamespace(NULL); observers.BeginNamespaceBlock(); }
+#line 4243 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 15:
-
-/* Line 1806 of yacc.c  */
-#line 370 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { 
-												  pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(1) - (5)].token));
-												  (yyval.statementList) = (yyvsp[(4) - (5)].statementList)->PushFront(decl);
+  case 15: /* top_statement: T_NAMESPACE '{' $@2 top_statement_list '}'  */
+#line 372 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { 
+												  pelet::NamespaceDeclarationClass* decl;
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-4].token));
+												  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(decl); observers.EndNamespaceBlock();
 												}
+#line 4253 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 16:
-
-/* Line 1806 of yacc.c  */
-#line 375 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = pelet::NamespaceUseClass::SetStartingPos((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].token)); }
+  case 16: /* top_statement: T_USE use_declarations ';'  */
+#line 377 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = pelet::NamespaceUseClass::SetStartingPos((yyvsp[-1].statementList), (yyvsp[-2].token)); }
+#line 4259 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 17:
-
-/* Line 1806 of yacc.c  */
-#line 376 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (2)].statementList)); }
+  case 17: /* top_statement: constant_declaration ';'  */
+#line 378 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statementList)); }
+#line 4265 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 18:
-
-/* Line 1806 of yacc.c  */
-#line 381 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].namespaceUse)); }
+  case 18: /* use_declarations: use_declarations ',' use_declaration  */
+#line 383 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].namespaceUse)); }
+#line 4271 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 19:
-
-/* Line 1806 of yacc.c  */
-#line 382 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].namespaceUse)); }
+  case 19: /* use_declarations: use_declaration  */
+#line 384 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].namespaceUse)); }
+#line 4277 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 20:
-
-/* Line 1806 of yacc.c  */
-#line 386 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(1) - (1)].qualifiedName), NULL); 
-																  observers.NamespaceUseAddScope((yyval.namespaceUse));
+  case 20: /* use_declaration: namespace_name  */
+#line 388 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[0].qualifiedName), NULL); 
+																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4285 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 21:
-
-/* Line 1806 of yacc.c  */
-#line 389 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].lexeme)); 
-																  observers.NamespaceUseAddScope((yyval.namespaceUse));
+  case 21: /* use_declaration: namespace_name T_AS T_STRING  */
+#line 391 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme)); 
+																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4293 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 22:
-
-/* Line 1806 of yacc.c  */
-#line 392 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(2) - (2)].qualifiedName), NULL); 
-																  observers.NamespaceUseAddScope((yyval.namespaceUse));
+  case 22: /* use_declaration: T_NS_SEPARATOR namespace_name  */
+#line 394 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[0].qualifiedName), NULL); 
+																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4301 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 23:
-
-/* Line 1806 of yacc.c  */
-#line 395 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(2) - (4)].qualifiedName), (yyvsp[(4) - (4)].lexeme)); 
-																  observers.NamespaceUseAddScope((yyval.namespaceUse));
+  case 23: /* use_declaration: T_NS_SEPARATOR namespace_name T_AS T_STRING  */
+#line 397 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme)); 
+																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4309 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 24:
-
-/* Line 1806 of yacc.c  */
-#line 401 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ConstantStatementClass* constStmt;
-																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
-																	(yyvsp[(3) - (5)].lexeme), analyzer.GetLineNumber(), 
-																	observers.GetDeclaredNamespace());
-																  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(constStmt);
+  case 24: /* constant_declaration: constant_declaration ',' T_STRING '=' static_scalar  */
+#line 403 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { pelet::ConstantStatementClass* constStmt;
+																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
+																	(yyvsp[-2].lexeme), analyzer.GetLineNumber(), 
+																	observers.GetDeclaredNamespace());
+																  (yyval.statementList) = (yyvsp[-4].statementList)->Push(constStmt);
 																}
+#line 4320 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 25:
-
-/* Line 1806 of yacc.c  */
-#line 407 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ConstantStatementClass* constStmt;
-																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
-																    (yyvsp[(2) - (4)].lexeme), analyzer.GetLineNumber(),
-																    observers.GetDeclaredNamespace());
-																  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, constStmt);																	
+  case 25: /* constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 409 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { pelet::ConstantStatementClass* constStmt;
+																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
+																    (yyvsp[-2].lexeme), analyzer.GetLineNumber(),
+																    observers.GetDeclaredNamespace());
+																  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, constStmt);																	
 																}
+#line 4331 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 26:
-
-/* Line 1806 of yacc.c  */
-#line 416 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList)->PushAll((yyvsp[(2) - (2)].statementList)); }
-    break;
-
-  case 27:
-
-/* Line 1806 of yacc.c  */
-#line 417 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 26: /* inner_statement_list: inner_statement_list inner_statement  */
+#line 418 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList)->PushAll((yyvsp[0].statementList)); }
+#line 4337 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 31:
-
-/* Line 1806 of yacc.c  */
-#line 424 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 27: /* inner_statement_list: %empty  */
+#line 419 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4343 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 32:
-
-/* Line 1806 of yacc.c  */
-#line 428 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 31: /* inner_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 426 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 4349 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 33:
-
-/* Line 1806 of yacc.c  */
-#line 429 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 32: /* statement: unticked_statement  */
+#line 430 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4355 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 34:
-
-/* Line 1806 of yacc.c  */
-#line 433 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 33: /* statement: T_STRING ':'  */
+#line 431 "/root/repo/src/Php53ResourceParser.y"
+                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4361 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 35:
-
-/* Line 1806 of yacc.c  */
-#line 434 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(5) - (7)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(6) - (7)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(7) - (7)].statementList));
-																									}
+  case 34: /* unticked_statement: '{' inner_statement_list '}'  */
+#line 435 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4367 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 36:
-
-/* Line 1806 of yacc.c  */
-#line 438 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(6) - (10)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(7) - (10)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(8) - (10)].statementList));
+  case 35: /* unticked_statement: T_IF '(' expr ')' statement elseif_list else_single  */
+#line 436 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-2].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-1].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[0].statementList));
 																									}
+#line 4376 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 37:
-
-/* Line 1806 of yacc.c  */
-#line 442 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
-    break;
-
-  case 38:
-
-/* Line 1806 of yacc.c  */
-#line 443 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (7)].statementList); }
-    break;
-
-  case 39:
-
-/* Line 1806 of yacc.c  */
-#line 452 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(9) - (9)].statementList); }
-    break;
-
-  case 40:
-
-/* Line 1806 of yacc.c  */
-#line 453 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
-    break;
-
-  case 41:
-
-/* Line 1806 of yacc.c  */
-#line 454 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 42:
-
-/* Line 1806 of yacc.c  */
-#line 455 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 43:
-
-/* Line 1806 of yacc.c  */
-#line 456 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 44:
-
-/* Line 1806 of yacc.c  */
-#line 457 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 45:
-
-/* Line 1806 of yacc.c  */
-#line 458 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 46:
-
-/* Line 1806 of yacc.c  */
-#line 459 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 47:
-
-/* Line 1806 of yacc.c  */
-#line 460 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 48:
-
-/* Line 1806 of yacc.c  */
-#line 461 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 49:
-
-/* Line 1806 of yacc.c  */
-#line 462 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 50:
-
-/* Line 1806 of yacc.c  */
-#line 463 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 51:
-
-/* Line 1806 of yacc.c  */
-#line 464 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 52:
-
-/* Line 1806 of yacc.c  */
-#line 465 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (2)].statement)); }
-    break;
-
-  case 53:
-
-/* Line 1806 of yacc.c  */
-#line 466 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 54:
-
-/* Line 1806 of yacc.c  */
-#line 469 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(8) - (8)].statementList); }
-    break;
-
-  case 55:
-
-/* Line 1806 of yacc.c  */
-#line 472 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(8) - (8)].statementList); }
-    break;
-
-  case 56:
-
-/* Line 1806 of yacc.c  */
-#line 473 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 57:
-
-/* Line 1806 of yacc.c  */
-#line 474 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 58:
-
-/* Line 1806 of yacc.c  */
-#line 478 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(3) - (13)].statementList), (yyvsp[(11) - (13)].statementList));
-																									  AST_PUSH_ALL_MERGE((yyval.statementList), (yyval.statementList), (yyvsp[(13) - (13)].statementList));
+  case 36: /* unticked_statement: T_IF '(' expr ')' ':' inner_statement_list new_elseif_list new_else_single T_ENDIF ';'  */
+#line 440 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-4].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-3].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-2].statementList));
 																									}
+#line 4385 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 59:
-
-/* Line 1806 of yacc.c  */
-#line 481 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(2) - (3)].statement)); }
-    break;
-
-  case 60:
-
-/* Line 1806 of yacc.c  */
-#line 482 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 61:
-
-/* Line 1806 of yacc.c  */
-#line 486 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 62:
-
-/* Line 1806 of yacc.c  */
-#line 487 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 63:
-
-/* Line 1806 of yacc.c  */
-#line 491 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 64:
-
-/* Line 1806 of yacc.c  */
-#line 492 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
-    break;
-
-  case 65:
-
-/* Line 1806 of yacc.c  */
-#line 497 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) =  (yyvsp[(7) - (8)].statementList); }
-    break;
-
-  case 66:
-
-/* Line 1806 of yacc.c  */
-#line 501 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 67:
-
-/* Line 1806 of yacc.c  */
-#line 502 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 68:
-
-/* Line 1806 of yacc.c  */
-#line 506 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 71:
-
-/* Line 1806 of yacc.c  */
-#line 518 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isReference) = false; }
-    break;
-
-  case 72:
-
-/* Line 1806 of yacc.c  */
-#line 519 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isReference) = true; }
-    break;
-
-  case 73:
-
-/* Line 1806 of yacc.c  */
-#line 524 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetCurrentClassName(NULL); 
-											  observers.SetCurrentMemberName((yyvsp[(3) - (6)].lexeme)); 
-											  observers.HasCallToFuncGetArg = false;
-											}
-    break;
-
-  case 74:
-
-/* Line 1806 of yacc.c  */
-#line 528 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* member;
-											  AST_INIT(member, pelet::ClassMemberSymbolClass);
-											  member->MakeFunction((yyvsp[(3) - (10)].lexeme), (yyvsp[(2) - (10)].isReference), (yyvsp[(1) - (10)].lexeme), (yyvsp[(5) - (10)].parametersList), (yyvsp[(8) - (10)].token), (yyvsp[(10) - (10)].token),
-												observers.GetScope(), observers.GetDeclaredNamespace(),
-												observers.HasCallToFuncGetArg);
-											  (yyval.statementList) = (yyvsp[(9) - (10)].statementList);
-											  (yyval.statementList)->PushFront(member);
-											  observers.SetCurrentMemberName(NULL);
-											}
-    break;
-
-  case 75:
-
-/* Line 1806 of yacc.c  */
-#line 541 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (4)].lexeme)); }
-    break;
-
-  case 76:
-
-/* Line 1806 of yacc.c  */
-#line 542 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassSymbolClass* clazz;
-											  AST_INIT(clazz, pelet::ClassSymbolClass);
-											  clazz->SetAll((yyvsp[(2) - (8)].lexeme), (yyvsp[(1) - (8)].classSymbol), (yyvsp[(3) - (8)].classSymbol), (yyvsp[(4) - (8)].classSymbol), (yyvsp[(8) - (8)].token), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(7) - (8)].statementList)->PushFront(clazz);
-											  
-											   /* at the end of a class, see if any assigned properties were not explicitly
-											    * defined and it so make them as defined
-											    * very important to use $$ as we want the returned to list to be modified
-											    */
-											  observers.DeclareAssignedProperties((yyval.statementList));
-											  
-																		  
-											  /*
-											   * parse out property and method PHP docs
-											   */
-											  observers.CreateMagicMethodsAndProperties((yyval.statementList), clazz);
-											  
-											  observers.SetCurrentClassName(NULL);
-											}
-    break;
-
-  case 77:
-
-/* Line 1806 of yacc.c  */
-#line 562 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (3)].lexeme)); }
-    break;
-
-  case 78:
-
-/* Line 1806 of yacc.c  */
-#line 563 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassSymbolClass* clazz;
-											  AST_INIT(clazz, pelet::ClassSymbolClass);
-											  clazz->SetAll((yyvsp[(2) - (7)].lexeme), (yyvsp[(1) - (7)].classSymbol), NULL, (yyvsp[(3) - (7)].classSymbol), (yyvsp[(7) - (7)].token), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(6) - (7)].statementList)->PushFront(clazz);
-											  observers.SetCurrentClassName(NULL);
-											}
-    break;
-
-  case 79:
-
-/* Line 1806 of yacc.c  */
-#line 572 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (1)].lexeme), false, false, false, false); }
-    break;
-
-  case 80:
-
-/* Line 1806 of yacc.c  */
-#line 573 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (2)].lexeme), true, false, false, false); }
-    break;
-
-  case 81:
-
-/* Line 1806 of yacc.c  */
-#line 574 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (2)].lexeme), false, true, false, false); }
-    break;
-
-  case 82:
-
-/* Line 1806 of yacc.c  */
-#line 578 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classSymbol) = 0; }
-    break;
-
-  case 83:
-
-/* Line 1806 of yacc.c  */
-#line 580 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass);
-										  (yyval.classSymbol)->SetExtends((yyvsp[(2) - (2)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
-										}
-    break;
-
-  case 84:
-
-/* Line 1806 of yacc.c  */
-#line 586 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (1)].lexeme), false, false, true, false); }
-    break;
-
-  case 85:
-
-/* Line 1806 of yacc.c  */
-#line 590 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classSymbol) = 0; }
-    break;
-
-  case 86:
-
-/* Line 1806 of yacc.c  */
-#line 592 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
-    break;
-
-  case 87:
-
-/* Line 1806 of yacc.c  */
-#line 596 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags(NULL, false, false, false, false); }
-    break;
-
-  case 88:
-
-/* Line 1806 of yacc.c  */
-#line 598 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
-    break;
-
-  case 89:
-
-/* Line 1806 of yacc.c  */
-#line 602 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); 
-															  (yyval.classSymbol)->AddToImplements((yyvsp[(1) - (1)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
-															}
-    break;
-
-  case 90:
-
-/* Line 1806 of yacc.c  */
-#line 605 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(1) - (3)].classSymbol)->AddToImplements((yyvsp[(3) - (3)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 91:
-
-/* Line 1806 of yacc.c  */
-#line 609 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 92:
-
-/* Line 1806 of yacc.c  */
-#line 610 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 37: /* unticked_statement: T_WHILE '(' expr ')' while_statement  */
+#line 444 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4391 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 93:
-
-/* Line 1806 of yacc.c  */
-#line 614 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 38: /* unticked_statement: T_DO statement T_WHILE '(' expr ')' ';'  */
+#line 445 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[-5].statementList); }
+#line 4397 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 94:
-
-/* Line 1806 of yacc.c  */
-#line 615 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (2)].statement); }
+  case 39: /* unticked_statement: T_FOR '(' for_expr ';' for_expr ';' for_expr ')' for_statement  */
+#line 454 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4403 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 95:
-
-/* Line 1806 of yacc.c  */
-#line 619 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 40: /* unticked_statement: T_SWITCH '(' expr ')' switch_case_list  */
+#line 455 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4409 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 96:
-
-/* Line 1806 of yacc.c  */
-#line 620 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 41: /* unticked_statement: T_BREAK ';'  */
+#line 456 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4415 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 97:
-
-/* Line 1806 of yacc.c  */
-#line 624 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 42: /* unticked_statement: T_BREAK expr ';'  */
+#line 457 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4421 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 98:
-
-/* Line 1806 of yacc.c  */
-#line 625 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 99:
-
-/* Line 1806 of yacc.c  */
-#line 629 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 100:
-
-/* Line 1806 of yacc.c  */
-#line 630 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 101:
-
-/* Line 1806 of yacc.c  */
-#line 634 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 102:
-
-/* Line 1806 of yacc.c  */
-#line 635 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 103:
-
-/* Line 1806 of yacc.c  */
-#line 639 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 104:
-
-/* Line 1806 of yacc.c  */
-#line 640 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
-    break;
-
-  case 105:
-
-/* Line 1806 of yacc.c  */
-#line 641 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 106:
-
-/* Line 1806 of yacc.c  */
-#line 642 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (5)].statementList); }
-    break;
-
-  case 107:
-
-/* Line 1806 of yacc.c  */
-#line 646 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 108:
-
-/* Line 1806 of yacc.c  */
-#line 647 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
-    break;
-
-  case 109:
-
-/* Line 1806 of yacc.c  */
-#line 648 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(4) - (4)].statementList); }
-    break;
-
-  case 110:
-
-/* Line 1806 of yacc.c  */
-#line 652 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 111:
-
-/* Line 1806 of yacc.c  */
-#line 653 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 112:
-
-/* Line 1806 of yacc.c  */
-#line 657 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 113:
-
-/* Line 1806 of yacc.c  */
-#line 658 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 114:
-
-/* Line 1806 of yacc.c  */
-#line 662 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 115:
-
-/* Line 1806 of yacc.c  */
-#line 663 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass);
-															  (yyval.statementList)->PushAll((yyvsp[(1) - (6)].statementList))->Push((yyvsp[(4) - (6)].statement))->PushAll((yyvsp[(6) - (6)].statementList));
-															}
-    break;
-
-  case 116:
-
-/* Line 1806 of yacc.c  */
-#line 669 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 117:
-
-/* Line 1806 of yacc.c  */
-#line 670 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass);
-																				  (yyval.statementList)->PushAll((yyvsp[(1) - (7)].statementList))->Push((yyvsp[(4) - (7)].statement))->PushAll((yyvsp[(7) - (7)].statementList));
-																			  	}
-    break;
-
-  case 118:
-
-/* Line 1806 of yacc.c  */
-#line 676 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 119:
-
-/* Line 1806 of yacc.c  */
-#line 677 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (2)].statementList); }
-    break;
-
-  case 120:
-
-/* Line 1806 of yacc.c  */
-#line 681 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 121:
-
-/* Line 1806 of yacc.c  */
-#line 682 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (3)].statementList); }
-    break;
-
-  case 122:
-
-/* Line 1806 of yacc.c  */
-#line 686 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (1)].parametersList); }
-    break;
-
-  case 123:
-
-/* Line 1806 of yacc.c  */
-#line 687 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = 0; }
-    break;
-
-  case 124:
-
-/* Line 1806 of yacc.c  */
-#line 691 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (2)].qualifiedName), (yyvsp[(2) - (2)].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 125:
-
-/* Line 1806 of yacc.c  */
-#line 692 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 126:
-
-/* Line 1806 of yacc.c  */
-#line 693 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (5)].qualifiedName), (yyvsp[(3) - (5)].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 127:
-
-/* Line 1806 of yacc.c  */
-#line 694 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (4)].qualifiedName), (yyvsp[(2) - (4)].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 128:
-
-/* Line 1806 of yacc.c  */
-#line 695 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (4)].parametersList)->Append((yyvsp[(3) - (4)].qualifiedName), (yyvsp[(4) - (4)].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 129:
-
-/* Line 1806 of yacc.c  */
-#line 696 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (5)].parametersList)->Append((yyvsp[(3) - (5)].qualifiedName), (yyvsp[(5) - (5)].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 130:
-
-/* Line 1806 of yacc.c  */
-#line 697 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (7)].parametersList)->Append((yyvsp[(3) - (7)].qualifiedName), (yyvsp[(5) - (7)].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 131:
-
-/* Line 1806 of yacc.c  */
-#line 698 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (6)].parametersList)->Append((yyvsp[(3) - (6)].qualifiedName), (yyvsp[(4) - (6)].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 132:
-
-/* Line 1806 of yacc.c  */
-#line 702 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
-    break;
-
-  case 133:
-
-/* Line 1806 of yacc.c  */
-#line 703 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
-    break;
-
-  case 134:
-
-/* Line 1806 of yacc.c  */
-#line 704 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("array"), 0, 0); }
-    break;
-
-  case 135:
-
-/* Line 1806 of yacc.c  */
-#line 708 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 136:
-
-/* Line 1806 of yacc.c  */
-#line 709 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) =  0; }
-    break;
-
-  case 137:
-
-/* Line 1806 of yacc.c  */
-#line 713 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    {  if (observers.DoCaptureCallArguments) { 
-																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); 
-																			   }
-																			   else {
-																				 (yyval.statementList) = 0;
-																			   }
-																			}
-    break;
-
-  case 138:
-
-/* Line 1806 of yacc.c  */
-#line 720 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if (observers.DoCaptureCallArguments) { 
-																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); 
-																			   }
-																			   else {
-																				 (yyval.statementList) = 0;
-																			   }
-																			}
-    break;
-
-  case 139:
-
-/* Line 1806 of yacc.c  */
-#line 727 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if (observers.DoCaptureCallArguments) { 
-																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(2) - (2)].statement)); 
-																			   }
-																			   else {
-																				 (yyval.statementList) = 0;
-																			   }
-																			}
-    break;
-
-  case 140:
-
-/* Line 1806 of yacc.c  */
-#line 734 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList) ? (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)) : 0; }
-    break;
-
-  case 141:
-
-/* Line 1806 of yacc.c  */
-#line 735 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList) ? (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)) : 0; }
-    break;
-
-  case 142:
-
-/* Line 1806 of yacc.c  */
-#line 736 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (4)].statementList) ? (yyvsp[(1) - (4)].statementList)->Push((yyvsp[(4) - (4)].statement)) : 0; }
-    break;
-
-  case 145:
-
-/* Line 1806 of yacc.c  */
-#line 745 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 146:
-
-/* Line 1806 of yacc.c  */
-#line 746 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 147:
-
-/* Line 1806 of yacc.c  */
-#line 747 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 148:
-
-/* Line 1806 of yacc.c  */
-#line 751 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 149:
-
-/* Line 1806 of yacc.c  */
-#line 752 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 150:
-
-/* Line 1806 of yacc.c  */
-#line 753 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 151:
-
-/* Line 1806 of yacc.c  */
-#line 754 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 152:
-
-/* Line 1806 of yacc.c  */
-#line 758 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
-    break;
-
-  case 153:
-
-/* Line 1806 of yacc.c  */
-#line 759 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
-    break;
-
-  case 154:
-
-/* Line 1806 of yacc.c  */
-#line 763 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = pelet::ClassMemberSymbolClass::MakeVariables((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].classMemberSymbol), observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 155:
-
-/* Line 1806 of yacc.c  */
-#line 764 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
-    break;
-
-  case 156:
-
-/* Line 1806 of yacc.c  */
-#line 766 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(4) - (7)].lexeme)); 
-															  observers.HasCallToFuncGetArg = false;
-															}
-    break;
-
-  case 157:
-
-/* Line 1806 of yacc.c  */
-#line 769 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-															  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-															  memberSymbol->MakeMethod((yyvsp[(4) - (9)].lexeme), (yyvsp[(1) - (9)].classMemberSymbol), (yyvsp[(3) - (9)].isReference), (yyvsp[(2) - (9)].lexeme), (yyvsp[(6) - (9)].parametersList), (yyvsp[(9) - (9)].classMemberSymbol),
-															    observers.GetScope(), observers.GetDeclaredNamespace(),
-																observers.HasCallToFuncGetArg); 															  
-															  AST_INIT((yyval.statementList), pelet::StatementListClass);
-															  (yyval.statementList)->PushFront(memberSymbol);
-															  (yyval.statementList)->PushAll(&((yyvsp[(9) - (9)].classMemberSymbol)->MethodStatements));
-															  observers.SetCurrentMemberName(NULL);
-															}
-    break;
-
-  case 158:
-
-/* Line 1806 of yacc.c  */
-#line 782 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody(0, (yyvsp[(1) - (1)].token), (yyvsp[(1) - (1)].token)); }
-    break;
-
-  case 159:
-
-/* Line 1806 of yacc.c  */
-#line 783 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].token), (yyvsp[(3) - (3)].token)); }
-    break;
-
-  case 160:
-
-/* Line 1806 of yacc.c  */
-#line 787 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 161:
-
-/* Line 1806 of yacc.c  */
-#line 788 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass);
-										  (yyval.classMemberSymbol)->MakeAsPublicVariable((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); 
-										}
-    break;
-
-  case 162:
-
-/* Line 1806 of yacc.c  */
-#line 794 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make(NULL, observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 163:
-
-/* Line 1806 of yacc.c  */
-#line 795 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 164:
-
-/* Line 1806 of yacc.c  */
-#line 799 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); }
-    break;
-
-  case 165:
-
-/* Line 1806 of yacc.c  */
-#line 800 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (2)].classMemberSymbol)->SetModifier((yyvsp[(2) - (2)].lexeme)); }
-    break;
-
-  case 169:
-
-/* Line 1806 of yacc.c  */
-#line 807 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
-    break;
-
-  case 172:
-
-/* Line 1806 of yacc.c  */
-#line 813 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(3) - (3)].lexeme), (yyvsp[(3) - (3)].lexeme), false, analyzer.GetLineNumber(),
-																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push(memberSymbol);
-																		}
-    break;
-
-  case 173:
-
-/* Line 1806 of yacc.c  */
-#line 819 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(3) - (5)].lexeme), (yyvsp[(3) - (5)].lexeme), false, analyzer.GetLineNumber(),
-																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(memberSymbol);
-																		}
-    break;
-
-  case 174:
-
-/* Line 1806 of yacc.c  */
-#line 825 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(1) - (1)].lexeme), (yyvsp[(1) - (1)].lexeme), false, analyzer.GetLineNumber(),
-																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
-																		}
-    break;
-
-  case 175:
-
-/* Line 1806 of yacc.c  */
-#line 831 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(1) - (3)].lexeme), (yyvsp[(1) - (3)].lexeme), false, analyzer.GetLineNumber(),
-																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
-																		}
-    break;
-
-  case 176:
-
-/* Line 1806 of yacc.c  */
-#line 841 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-											  memberSymbol->MakeVariable((yyvsp[(3) - (5)].lexeme), (yyvsp[(3) - (5)].lexeme), true, analyzer.GetLineNumber(),
-												observers.GetScope(), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(memberSymbol);
-											}
-    break;
-
-  case 177:
-
-/* Line 1806 of yacc.c  */
-#line 847 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
-											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-											  memberSymbol->MakeVariable((yyvsp[(2) - (4)].lexeme), (yyvsp[(1) - (4)].lexeme), true, analyzer.GetLineNumber(),
-												observers.GetScope(), observers.GetDeclaredNamespace());
-											  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
-											}
-    break;
-
-  case 178:
-
-/* Line 1806 of yacc.c  */
-#line 856 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)); }
-    break;
-
-  case 179:
-
-/* Line 1806 of yacc.c  */
-#line 857 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); }
-    break;
-
-  case 180:
-
-/* Line 1806 of yacc.c  */
-#line 861 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 181:
-
-/* Line 1806 of yacc.c  */
-#line 862 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 182:
-
-/* Line 1806 of yacc.c  */
-#line 866 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)); }
-    break;
-
-  case 183:
-
-/* Line 1806 of yacc.c  */
-#line 867 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); }
-    break;
-
-  case 184:
-
-/* Line 1806 of yacc.c  */
-#line 871 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(6) - (6)].statement); }
-    break;
-
-  case 185:
-
-/* Line 1806 of yacc.c  */
-#line 872 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { 
-																			  /* 
-																			   * since this parser only looks for defines or property assignments
-																			   * and there could never be both in one expression we can return
-																			   * just one
-																			   */
-																			  if ((yyvsp[(1) - (3)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (3)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (3)].statement);
-																			  }
-																			  else {
-																				(yyval.statement) = (yyvsp[(3) - (3)].statement);
-																			  }
-																			 }
-    break;
-
-  case 186:
-
-/* Line 1806 of yacc.c  */
-#line 885 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; 
-																			  if ((yyvsp[(1) - (4)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (4)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (4)].statement);
-																			  }
-																			}
-    break;
-
-  case 187:
-
-/* Line 1806 of yacc.c  */
-#line 890 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; 
-																			  if ((yyvsp[(1) - (6)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (6)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (6)].statement);
-																			  }	
-																			}
-    break;
-
-  case 188:
-
-/* Line 1806 of yacc.c  */
-#line 895 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 189:
-
-/* Line 1806 of yacc.c  */
-#line 896 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 190:
-
-/* Line 1806 of yacc.c  */
-#line 897 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 191:
-
-/* Line 1806 of yacc.c  */
-#line 898 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 192:
-
-/* Line 1806 of yacc.c  */
-#line 899 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 193:
-
-/* Line 1806 of yacc.c  */
-#line 900 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 194:
-
-/* Line 1806 of yacc.c  */
-#line 901 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 195:
-
-/* Line 1806 of yacc.c  */
-#line 902 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 196:
-
-/* Line 1806 of yacc.c  */
-#line 903 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 197:
-
-/* Line 1806 of yacc.c  */
-#line 904 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 198:
-
-/* Line 1806 of yacc.c  */
-#line 905 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 199:
-
-/* Line 1806 of yacc.c  */
-#line 906 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 200:
-
-/* Line 1806 of yacc.c  */
-#line 907 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 201:
-
-/* Line 1806 of yacc.c  */
-#line 908 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 202:
-
-/* Line 1806 of yacc.c  */
-#line 909 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 203:
-
-/* Line 1806 of yacc.c  */
-#line 910 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 204:
-
-/* Line 1806 of yacc.c  */
-#line 911 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 205:
-
-/* Line 1806 of yacc.c  */
-#line 912 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 206:
-
-/* Line 1806 of yacc.c  */
-#line 913 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 207:
-
-/* Line 1806 of yacc.c  */
-#line 914 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 208:
-
-/* Line 1806 of yacc.c  */
-#line 915 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 209:
-
-/* Line 1806 of yacc.c  */
-#line 916 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 210:
-
-/* Line 1806 of yacc.c  */
-#line 917 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 211:
-
-/* Line 1806 of yacc.c  */
-#line 918 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 212:
-
-/* Line 1806 of yacc.c  */
-#line 919 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 213:
-
-/* Line 1806 of yacc.c  */
-#line 920 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 214:
-
-/* Line 1806 of yacc.c  */
-#line 921 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 215:
-
-/* Line 1806 of yacc.c  */
-#line 922 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 216:
-
-/* Line 1806 of yacc.c  */
-#line 923 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 217:
-
-/* Line 1806 of yacc.c  */
-#line 924 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 218:
-
-/* Line 1806 of yacc.c  */
-#line 925 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 219:
-
-/* Line 1806 of yacc.c  */
-#line 926 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 220:
-
-/* Line 1806 of yacc.c  */
-#line 927 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 221:
-
-/* Line 1806 of yacc.c  */
-#line 928 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 222:
-
-/* Line 1806 of yacc.c  */
-#line 929 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 223:
-
-/* Line 1806 of yacc.c  */
-#line 930 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 224:
-
-/* Line 1806 of yacc.c  */
-#line 931 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 225:
-
-/* Line 1806 of yacc.c  */
-#line 932 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 43: /* unticked_statement: T_CONTINUE ';'  */
+#line 458 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4427 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 226:
+  case 44: /* unticked_statement: T_CONTINUE expr ';'  */
+#line 459 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4433 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 933 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 45: /* unticked_statement: T_RETURN ';'  */
+#line 460 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4439 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 227:
+  case 46: /* unticked_statement: T_RETURN expr_without_variable ';'  */
+#line 461 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4445 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 934 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 47: /* unticked_statement: T_RETURN variable ';'  */
+#line 462 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4451 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 228:
+  case 48: /* unticked_statement: T_GLOBAL global_var_list ';'  */
+#line 463 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4457 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 935 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 49: /* unticked_statement: T_STATIC static_var_list ';'  */
+#line 464 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4463 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 229:
+  case 50: /* unticked_statement: T_ECHO echo_expr_list ';'  */
+#line 465 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4469 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 936 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 51: /* unticked_statement: T_INLINE_HTML  */
+#line 466 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4475 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 230:
+  case 52: /* unticked_statement: expr ';'  */
+#line 467 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statement)); }
+#line 4481 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 937 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 53: /* unticked_statement: T_UNSET '(' unset_variables ')' ';'  */
+#line 468 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4487 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 231:
+  case 54: /* unticked_statement: T_FOREACH '(' variable T_AS foreach_variable foreach_optional_arg ')' foreach_statement  */
+#line 471 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4493 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 938 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 55: /* unticked_statement: T_FOREACH '(' expr_without_variable T_AS variable foreach_optional_arg ')' foreach_statement  */
+#line 474 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4499 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 232:
+  case 56: /* unticked_statement: T_DECLARE '(' declare_list ')' declare_statement  */
+#line 475 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4505 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 939 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 57: /* unticked_statement: ';'  */
+#line 476 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4511 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 233:
+  case 58: /* unticked_statement: T_TRY '{' inner_statement_list '}' T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}' additional_catches  */
+#line 480 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-10].statementList), (yyvsp[-2].statementList));
+																									  AST_PUSH_ALL_MERGE((yyval.statementList), (yyval.statementList), (yyvsp[0].statementList));
+																									}
+#line 4519 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 940 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 59: /* unticked_statement: T_THROW expr ';'  */
+#line 483 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statement)); }
+#line 4525 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 234:
+  case 60: /* unticked_statement: T_GOTO T_STRING ';'  */
+#line 484 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4531 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 941 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (3)].statement); }
+  case 61: /* additional_catches: non_empty_additional_catches  */
+#line 488 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4537 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 235:
+  case 62: /* additional_catches: %empty  */
+#line 489 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 4543 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 944 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 63: /* non_empty_additional_catches: additional_catch  */
+#line 493 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4549 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 236:
+  case 64: /* non_empty_additional_catches: non_empty_additional_catches additional_catch  */
+#line 494 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4555 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 946 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 65: /* additional_catch: T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}'  */
+#line 499 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statementList) =  (yyvsp[-1].statementList); }
+#line 4561 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 237:
+  case 66: /* unset_variables: unset_variable  */
+#line 503 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4567 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 947 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 67: /* unset_variables: unset_variables ',' unset_variable  */
+#line 504 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 4573 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 238:
+  case 68: /* unset_variable: variable  */
+#line 508 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 4579 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 948 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 71: /* is_reference: %empty  */
+#line 520 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.isReference) = false; }
+#line 4585 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 239:
+  case 72: /* is_reference: '&'  */
+#line 521 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.isReference) = true; }
+#line 4591 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 949 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 73: /* $@3: %empty  */
+#line 526 "/root/repo/src/Php53ResourceParser.y"
+                                                                { observers.SetCurrentClassName(NULL); 
+											  observers.SetCurrentMemberName((yyvsp[-3].lexeme)); 
+											  observers.HasCallToFuncGetArg = false;
+											}
+#line 4600 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 74: /* unticked_function_declaration_statement: function is_reference T_STRING '(' parameter_list ')' $@3 '{' inner_statement_list '}'  */
+#line 530 "/root/repo/src/Php53ResourceParser.y"
+                                                        { pelet::ClassMemberSymbolClass* member;
+											  AST_INIT(member, pelet::ClassMemberSymbolClass);
+											  member->MakeFunction((yyvsp[-7].lexeme), (yyvsp[-8].isReference), (yyvsp[-9].lexeme), (yyvsp[-5].parametersList), (yyvsp[-2].token), (yyvsp[0].token),
+												observers.GetScope(), observers.GetDeclaredNamespace(),
+												observers.HasCallToFuncGetArg);
+											  (yyval.statementList) = (yyvsp[-1].statementList);
+											  (yyval.statementList)->PushFront(member);
+											  observers.SetCurrentMemberName(NULL);
+											}
+#line 4614 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 75: /* $@4: %empty  */
+#line 543 "/root/repo/src/Php53ResourceParser.y"
+                                                        { observers.SetCurrentClassName((yyvsp[-2].lexeme)); }
+#line 4620 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 76: /* unticked_class_declaration_statement: class_entry_type T_STRING extends_from implements_list $@4 '{' class_statement_list '}'  */
+#line 544 "/root/repo/src/Php53ResourceParser.y"
+                                                        { pelet::ClassSymbolClass* clazz;
+											  AST_INIT(clazz, pelet::ClassSymbolClass);
+											  clazz->SetAll((yyvsp[-6].lexeme), (yyvsp[-7].classSymbol), (yyvsp[-5].classSymbol), (yyvsp[-4].classSymbol), (yyvsp[0].token), observers.GetDeclaredNamespace());
+											  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(clazz);
+											  
+											   /* at the end of a class, see if any assigned properties were not explicitly
+											    * defined and it so make them as defined
+											    * very important to use $$ as we want the returned to list to be modified
+											    */
+											  observers.DeclareAssignedProperties((yyval.statementList));
+											  
+																		  
+											  /*
+											   * parse out property and method PHP docs
+											   */
+											  observers.CreateMagicMethodsAndProperties((yyval.statementList), clazz);
+											  
+											  observers.SetCurrentClassName(NULL);
+											}
+#line 4644 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 240:
+  case 77: /* $@5: %empty  */
+#line 564 "/root/repo/src/Php53ResourceParser.y"
+                                                                { observers.SetCurrentClassName((yyvsp[-1].lexeme)); }
+#line 4650 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 950 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 78: /* unticked_class_declaration_statement: interface_entry T_STRING interface_extends_list $@5 '{' class_statement_list '}'  */
+#line 565 "/root/repo/src/Php53ResourceParser.y"
+                                                        { pelet::ClassSymbolClass* clazz;
+											  AST_INIT(clazz, pelet::ClassSymbolClass);
+											  clazz->SetAll((yyvsp[-5].lexeme), (yyvsp[-6].classSymbol), NULL, (yyvsp[-4].classSymbol), (yyvsp[0].token), observers.GetDeclaredNamespace());
+											  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(clazz);
+											  observers.SetCurrentClassName(NULL);
+											}
+#line 4661 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 241:
+  case 79: /* class_entry_type: T_CLASS  */
+#line 574 "/root/repo/src/Php53ResourceParser.y"
+                                                        { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[0].lexeme), false, false, false, false); }
+#line 4667 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 951 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 80: /* class_entry_type: T_ABSTRACT T_CLASS  */
+#line 575 "/root/repo/src/Php53ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[-1].lexeme), true, false, false, false); }
+#line 4673 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 242:
+  case 81: /* class_entry_type: T_FINAL T_CLASS  */
+#line 576 "/root/repo/src/Php53ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[-1].lexeme), false, true, false, false); }
+#line 4679 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 952 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 82: /* extends_from: %empty  */
+#line 580 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.classSymbol) = 0; }
+#line 4685 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 243:
+  case 83: /* extends_from: T_EXTENDS fully_qualified_class_name  */
+#line 582 "/root/repo/src/Php53ResourceParser.y"
+                                                        { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass);
+										  (yyval.classSymbol)->SetExtends((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
+										}
+#line 4693 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 953 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 84: /* interface_entry: T_INTERFACE  */
+#line 588 "/root/repo/src/Php53ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[0].lexeme), false, false, true, false); }
+#line 4699 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 244:
+  case 85: /* interface_extends_list: %empty  */
+#line 592 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.classSymbol) = 0; }
+#line 4705 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 954 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 86: /* interface_extends_list: T_EXTENDS interface_list  */
+#line 594 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4711 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 245:
+  case 87: /* implements_list: %empty  */
+#line 598 "/root/repo/src/Php53ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags(NULL, false, false, false, false); }
+#line 4717 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 955 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 88: /* implements_list: T_IMPLEMENTS interface_list  */
+#line 600 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4723 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 246:
+  case 89: /* interface_list: fully_qualified_class_name  */
+#line 604 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); 
+															  (yyval.classSymbol)->AddToImplements((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
+															}
+#line 4731 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 956 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (2)].statement); }
+  case 90: /* interface_list: interface_list ',' fully_qualified_class_name  */
+#line 607 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.classSymbol) = (yyvsp[-2].classSymbol)->AddToImplements((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4737 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 247:
+  case 91: /* foreach_optional_arg: %empty  */
+#line 611 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4743 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 957 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 92: /* foreach_optional_arg: T_DOUBLE_ARROW foreach_variable  */
+#line 612 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 4749 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 248:
+  case 93: /* foreach_variable: variable  */
+#line 616 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 4755 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 958 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 94: /* foreach_variable: '&' variable  */
+#line 617 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 4761 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 249:
+  case 95: /* for_statement: statement  */
+#line 621 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4767 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 959 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 96: /* for_statement: ':' inner_statement_list T_ENDFOR ';'  */
+#line 622 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4773 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 250:
+  case 97: /* foreach_statement: statement  */
+#line 626 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4779 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 960 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 98: /* foreach_statement: ':' inner_statement_list T_ENDFOREACH ';'  */
+#line 627 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4785 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 251:
+  case 99: /* declare_statement: statement  */
+#line 631 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4791 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 962 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 100: /* declare_statement: ':' inner_statement_list T_ENDDECLARE ';'  */
+#line 632 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4797 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 252:
+  case 101: /* declare_list: T_STRING '=' static_scalar  */
+#line 636 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4803 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 963 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.EndAnonymousFunction();
-																			  (yyval.statement) = 0;
-																			}
+  case 102: /* declare_list: declare_list ',' T_STRING '=' static_scalar  */
+#line 637 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 4809 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 254:
+  case 103: /* switch_case_list: '{' case_list '}'  */
+#line 641 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4815 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 973 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 104: /* switch_case_list: '{' ';' case_list '}'  */
+#line 642 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4821 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 255:
+  case 105: /* switch_case_list: ':' case_list T_ENDSWITCH ';'  */
+#line 643 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4827 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 974 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 106: /* switch_case_list: ':' ';' case_list T_ENDSWITCH ';'  */
+#line 644 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4833 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 256:
+  case 107: /* case_list: %empty  */
+#line 648 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4839 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 978 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 108: /* case_list: case_list T_CASE expr case_separator inner_statement_list  */
+#line 649 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4845 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 257:
+  case 109: /* case_list: case_list T_DEFAULT case_separator inner_statement_list  */
+#line 650 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4851 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 979 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 110: /* case_separator: ':'  */
+#line 654 "/root/repo/src/Php53ResourceParser.y"
+                                { (yyval.unused) = 0; }
+#line 4857 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 258:
+  case 111: /* case_separator: ';'  */
+#line 655 "/root/repo/src/Php53ResourceParser.y"
+                                { (yyval.unused) = 0; }
+#line 4863 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 980 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 112: /* while_statement: statement  */
+#line 659 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4869 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 259:
+  case 113: /* while_statement: ':' inner_statement_list T_ENDWHILE ';'  */
+#line 660 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4875 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 981 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 114: /* elseif_list: %empty  */
+#line 664 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statementList) = 0; }
+#line 4881 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 260:
+  case 115: /* elseif_list: elseif_list T_ELSEIF '(' expr ')' statement  */
+#line 665 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass);
+															  (yyval.statementList)->PushAll((yyvsp[-5].statementList))->Push((yyvsp[-2].statement))->PushAll((yyvsp[0].statementList));
+															}
+#line 4889 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 985 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
-																							observers.DoCaptureScalars = true;
-																							observers.DoCaptureCallArguments = true;
-																						  }
-																						  if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) { 
-																							observers.HasCallToFuncGetArg = true;
-																						  }
-																						  if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) { 
-																							observers.HasCallToFuncGetArg = true;
-																						  }
-																						}
+  case 116: /* new_elseif_list: %empty  */
+#line 671 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4895 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 261:
-
-/* Line 1806 of yacc.c  */
-#line 996 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { /* this parser is only interested in calls to the define function */
-																						  if ((yyvsp[(1) - (5)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
-																							pelet::ConstantStatementClass* constStmt;
-																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[(1) - (5)].qualifiedName), (yyvsp[(4) - (5)].statementList), analyzer.GetLineNumber());
-																							(yyval.statement) = constStmt;
-																						  }
-																						  else {
-																							(yyval.statement) = 0;
-																						  }
-																						  observers.DoCaptureScalars = false;	
-																						  observers.DoCaptureCallArguments = false;
-																						}
+  case 117: /* new_elseif_list: new_elseif_list T_ELSEIF '(' expr ')' ':' inner_statement_list  */
+#line 672 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass);
+																				  (yyval.statementList)->PushAll((yyvsp[-6].statementList))->Push((yyvsp[-3].statement))->PushAll((yyvsp[0].statementList));
+																			  	}
+#line 4903 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 262:
+  case 118: /* else_single: %empty  */
+#line 678 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = 0; }
+#line 4909 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1010 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 119: /* else_single: T_ELSE statement  */
+#line 679 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4915 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 263:
+  case 120: /* new_else_single: %empty  */
+#line 683 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = 0; }
+#line 4921 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1011 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
-																							observers.DoCaptureScalars = true; 
-																							observers.DoCaptureCallArguments = true;
-																						  }
-																						  if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) { 
-																							observers.HasCallToFuncGetArg = true;
-																						  }
-																						  if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) { 
-																							observers.HasCallToFuncGetArg = true;
-																						  }
-																						}
+  case 121: /* new_else_single: T_ELSE ':' inner_statement_list  */
+#line 684 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4927 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 264:
-
-/* Line 1806 of yacc.c  */
-#line 1022 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { /* this parser is only interested in calls to the define function */
-																						  if ((yyvsp[(2) - (6)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
-																							pelet::ConstantStatementClass* constStmt;
-																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[(2) - (6)].qualifiedName), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber());
-																							(yyval.statement) = constStmt;
-																						  }
-																						  else {
-																							(yyval.statement) = 0;
-																						  }	
-																						  observers.DoCaptureScalars = false;
-																						  observers.DoCaptureCallArguments = false;
-																						}
+  case 122: /* parameter_list: non_empty_parameter_list  */
+#line 688 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.parametersList) = (yyvsp[0].parametersList); }
+#line 4933 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 265:
+  case 123: /* parameter_list: %empty  */
+#line 689 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.parametersList) = 0; }
+#line 4939 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1035 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 124: /* non_empty_parameter_list: optional_class_type T_VARIABLE  */
+#line 693 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-1].qualifiedName), (yyvsp[0].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4945 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 266:
+  case 125: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE  */
+#line 694 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4951 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1037 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 126: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 695 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-4].qualifiedName), (yyvsp[-2].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4957 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 267:
+  case 127: /* non_empty_parameter_list: optional_class_type T_VARIABLE '=' static_scalar  */
+#line 696 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-3].qualifiedName), (yyvsp[-2].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4963 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1039 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 128: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE  */
+#line 697 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.parametersList) = (yyvsp[-3].parametersList)->Append((yyvsp[-1].qualifiedName), (yyvsp[0].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4969 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 268:
+  case 129: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE  */
+#line 698 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.parametersList) = (yyvsp[-4].parametersList)->Append((yyvsp[-2].qualifiedName), (yyvsp[0].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4975 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1041 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 130: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 699 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.parametersList) = (yyvsp[-6].parametersList)->Append((yyvsp[-4].qualifiedName), (yyvsp[-2].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4981 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 269:
+  case 131: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE '=' static_scalar  */
+#line 700 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.parametersList) = (yyvsp[-5].parametersList)->Append((yyvsp[-3].qualifiedName), (yyvsp[-2].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4987 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1043 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 132: /* optional_class_type: %empty  */
+#line 704 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.qualifiedName) = 0; }
+#line 4993 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 270:
+  case 133: /* optional_class_type: fully_qualified_class_name  */
+#line 705 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 4999 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1047 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 134: /* optional_class_type: T_ARRAY  */
+#line 706 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("array"), 0, 0); }
+#line 5005 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 271:
+  case 135: /* function_call_parameter_list: non_empty_function_call_parameter_list  */
+#line 710 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5011 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1048 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 136: /* function_call_parameter_list: %empty  */
+#line 711 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) =  0; }
+#line 5017 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 272:
+  case 137: /* non_empty_function_call_parameter_list: expr_without_variable  */
+#line 715 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                {  if (observers.DoCaptureCallArguments) { 
+																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); 
+																			   }
+																			   else {
+																				 (yyval.statementList) = 0;
+																			   }
+																			}
+#line 5029 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1049 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(3) - (3)].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+  case 138: /* non_empty_function_call_parameter_list: variable  */
+#line 722 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { if (observers.DoCaptureCallArguments) { 
+																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); 
+																			   }
+																			   else {
+																				 (yyval.statementList) = 0;
+																			   }
+																			}
+#line 5041 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 273:
+  case 139: /* non_empty_function_call_parameter_list: '&' w_variable  */
+#line 729 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { if (observers.DoCaptureCallArguments) { 
+																				 AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); 
+																			   }
+																			   else {
+																				 (yyval.statementList) = 0;
+																			   }
+																			}
+#line 5053 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1050 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(2) - (2)].qualifiedName)->MakeAbsolute(); }
+  case 140: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' expr_without_variable  */
+#line 736 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList) ? (yyvsp[-2].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5059 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 274:
+  case 141: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' variable  */
+#line 737 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList) ? (yyvsp[-2].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5065 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1054 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 142: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' '&' w_variable  */
+#line 738 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-3].statementList) ? (yyvsp[-3].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5071 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 275:
+  case 145: /* global_var: T_VARIABLE  */
+#line 747 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 5077 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1055 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(3) - (3)].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+  case 146: /* global_var: '$' r_variable  */
+#line 748 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 5083 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 276:
+  case 147: /* global_var: '$' '{' expr '}'  */
+#line 749 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 5089 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1056 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(2) - (2)].qualifiedName)->MakeAbsolute(); }
+  case 148: /* static_var_list: static_var_list ',' T_VARIABLE  */
+#line 753 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 5095 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 277:
+  case 149: /* static_var_list: static_var_list ',' T_VARIABLE '=' static_scalar  */
+#line 754 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 5101 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1060 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 150: /* static_var_list: T_VARIABLE  */
+#line 755 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 5107 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 278:
+  case 151: /* static_var_list: T_VARIABLE '=' static_scalar  */
+#line 756 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 5113 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1061 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 152: /* class_statement_list: class_statement_list class_statement  */
+#line 760 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 5119 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 279:
+  case 153: /* class_statement_list: %empty  */
+#line 761 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 5125 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1066 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 154: /* class_statement: variable_modifiers class_variable_declaration ';'  */
+#line 765 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statementList) = pelet::ClassMemberSymbolClass::MakeVariables((yyvsp[-1].statementList), (yyvsp[-2].classMemberSymbol), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5131 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 280:
+  case 155: /* class_statement: class_constant_declaration ';'  */
+#line 766 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5137 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1067 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 156: /* $@6: %empty  */
+#line 768 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { observers.SetCurrentMemberName((yyvsp[-3].lexeme)); 
+															  observers.HasCallToFuncGetArg = false;
+															}
+#line 5145 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 157: /* class_statement: method_modifiers function is_reference T_STRING '(' parameter_list ')' $@6 method_body  */
+#line 771 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
+															  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+															  memberSymbol->MakeMethod((yyvsp[-5].lexeme), (yyvsp[-8].classMemberSymbol), (yyvsp[-6].isReference), (yyvsp[-7].lexeme), (yyvsp[-3].parametersList), (yyvsp[0].classMemberSymbol),
+															    observers.GetScope(), observers.GetDeclaredNamespace(),
+																observers.HasCallToFuncGetArg); 															  
+															  AST_INIT((yyval.statementList), pelet::StatementListClass);
+															  (yyval.statementList)->PushFront(memberSymbol);
+															  (yyval.statementList)->PushAll(&((yyvsp[0].classMemberSymbol)->MethodStatements));
+															  observers.SetCurrentMemberName(NULL);
+															}
+#line 5160 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 281:
+  case 158: /* method_body: ';'  */
+#line 784 "/root/repo/src/Php53ResourceParser.y"
+                                                                { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody(0, (yyvsp[0].token), (yyvsp[0].token)); }
+#line 5166 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1072 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 159: /* method_body: '{' inner_statement_list '}'  */
+#line 785 "/root/repo/src/Php53ResourceParser.y"
+                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody((yyvsp[-1].statementList), (yyvsp[-2].token), (yyvsp[0].token)); }
+#line 5172 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 282:
+  case 160: /* variable_modifiers: non_empty_member_modifiers  */
+#line 789 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5178 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1073 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 161: /* variable_modifiers: T_VAR  */
+#line 790 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass);
+										  (yyval.classMemberSymbol)->MakeAsPublicVariable((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); 
+										}
+#line 5186 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 283:
+  case 162: /* method_modifiers: %empty  */
+#line 796 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make(NULL, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5192 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1077 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 163: /* method_modifiers: non_empty_member_modifiers  */
+#line 797 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5198 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 284:
+  case 164: /* non_empty_member_modifiers: member_modifier  */
+#line 801 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5204 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1081 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 165: /* non_empty_member_modifiers: non_empty_member_modifiers member_modifier  */
+#line 802 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.classMemberSymbol) = (yyvsp[-1].classMemberSymbol)->SetModifier((yyvsp[0].lexeme)); }
+#line 5210 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 285:
+  case 169: /* member_modifier: T_STATIC  */
+#line 809 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 5216 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1082 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 172: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE  */
+#line 815 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
+																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+																		  memberSymbol->MakeVariable((yyvsp[0].lexeme), (yyvsp[0].lexeme), false, analyzer.GetLineNumber(),
+																			observers.GetScope(), observers.GetDeclaredNamespace());
+																		  (yyval.statementList) = (yyvsp[-2].statementList)->Push(memberSymbol);
+																		}
+#line 5227 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 286:
+  case 173: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE '=' static_scalar  */
+#line 821 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
+																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+																		  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), false, analyzer.GetLineNumber(),
+																			observers.GetScope(), observers.GetDeclaredNamespace());
+																		  (yyval.statementList) = (yyvsp[-4].statementList)->Push(memberSymbol);
+																		}
+#line 5238 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1083 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 174: /* class_variable_declaration: T_VARIABLE  */
+#line 827 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
+																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+																		  memberSymbol->MakeVariable((yyvsp[0].lexeme), (yyvsp[0].lexeme), false, analyzer.GetLineNumber(),
+																			observers.GetScope(), observers.GetDeclaredNamespace());
+																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
+																		}
+#line 5249 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 287:
+  case 175: /* class_variable_declaration: T_VARIABLE '=' static_scalar  */
+#line 833 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
+																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+																		  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), false, analyzer.GetLineNumber(),
+																			observers.GetScope(), observers.GetDeclaredNamespace());
+																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
+																		}
+#line 5260 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1087 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 176: /* class_constant_declaration: class_constant_declaration ',' T_STRING '=' static_scalar  */
+#line 843 "/root/repo/src/Php53ResourceParser.y"
+                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
+											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+											  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), true, analyzer.GetLineNumber(),
+												observers.GetScope(), observers.GetDeclaredNamespace());
+											  (yyval.statementList) = (yyvsp[-4].statementList)->Push(memberSymbol);
+											}
+#line 5271 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 288:
+  case 177: /* class_constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 849 "/root/repo/src/Php53ResourceParser.y"
+                                                    { pelet::ClassMemberSymbolClass* memberSymbol;
+											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
+											  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-3].lexeme), true, analyzer.GetLineNumber(),
+												observers.GetScope(), observers.GetDeclaredNamespace());
+											  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
+											}
+#line 5282 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1088 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 178: /* echo_expr_list: echo_expr_list ',' expr  */
+#line 858 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].statement)); }
+#line 5288 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 289:
+  case 179: /* echo_expr_list: expr  */
+#line 859 "/root/repo/src/Php53ResourceParser.y"
+                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); }
+#line 5294 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1089 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 180: /* for_expr: %empty  */
+#line 863 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 5300 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 290:
+  case 181: /* for_expr: non_empty_for_expr  */
+#line 864 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5306 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1094 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 182: /* non_empty_for_expr: non_empty_for_expr ',' expr  */
+#line 868 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].statement)); }
+#line 5312 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 291:
+  case 183: /* non_empty_for_expr: expr  */
+#line 869 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); }
+#line 5318 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1095 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 184: /* expr_without_variable: T_LIST '(' assignment_list ')' '=' expr  */
+#line 873 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5324 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 292:
+  case 185: /* expr_without_variable: variable '=' expr  */
+#line 874 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { 
+																			  /* 
+																			   * since this parser only looks for defines or property assignments
+																			   * and there could never be both in one expression we can return
+																			   * just one
+																			   */
+																			  if ((yyvsp[-2].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-2].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-2].statement);
+																			  }
+																			  else {
+																				(yyval.statement) = (yyvsp[0].statement);
+																			  }
+																			 }
+#line 5342 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1100 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if (observers.DoCaptureScalars) {
-																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
-																				(yyval.statement) = scalarExpr;
-																			  }
-																			  else { 
-																			    (yyval.statement) = 0; 
-																			  }
+  case 186: /* expr_without_variable: variable '=' '&' variable  */
+#line 887 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; 
+																			  if ((yyvsp[-3].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-3].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-3].statement);
+																			  }
 																			}
+#line 5352 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 293:
-
-/* Line 1806 of yacc.c  */
-#line 1109 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { 
-																			  if (observers.DoCaptureScalars) {
-																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
-																				(yyval.statement) = scalarExpr;
-																			  }
-																			  else { 
-																			    (yyval.statement) = 0; 
-																			  }
+  case 187: /* expr_without_variable: variable '=' '&' T_NEW class_name_reference ctor_arguments  */
+#line 892 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statement) = 0; 
+																			  if ((yyvsp[-5].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-5].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-5].statement);
+																			  }	
 																			}
+#line 5362 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 294:
+  case 188: /* expr_without_variable: T_NEW class_name_reference ctor_arguments  */
+#line 897 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statement) = 0; }
+#line 5368 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1119 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if (observers.DoCaptureScalars) {
-																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
-																				(yyval.statement) = scalarExpr;
-																			  }
-																			  else { 
-																			    (yyval.statement) = 0; 
-																			  }
-																			}
+  case 189: /* expr_without_variable: T_CLONE expr  */
+#line 898 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5374 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 295:
+  case 190: /* expr_without_variable: variable T_PLUS_EQUAL expr  */
+#line 899 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5380 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1128 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 191: /* expr_without_variable: variable T_MINUS_EQUAL expr  */
+#line 900 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5386 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 296:
+  case 192: /* expr_without_variable: variable T_MUL_EQUAL expr  */
+#line 901 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5392 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1129 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 193: /* expr_without_variable: variable T_DIV_EQUAL expr  */
+#line 902 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5398 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 297:
+  case 194: /* expr_without_variable: variable T_CONCAT_EQUAL expr  */
+#line 903 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5404 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1130 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 195: /* expr_without_variable: variable T_MOD_EQUAL expr  */
+#line 904 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5410 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 298:
+  case 196: /* expr_without_variable: variable T_AND_EQUAL expr  */
+#line 905 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5416 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1131 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 197: /* expr_without_variable: variable T_OR_EQUAL expr  */
+#line 906 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5422 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 299:
+  case 198: /* expr_without_variable: variable T_XOR_EQUAL expr  */
+#line 907 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5428 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1132 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 199: /* expr_without_variable: variable T_SL_EQUAL expr  */
+#line 908 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5434 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 300:
+  case 200: /* expr_without_variable: variable T_SR_EQUAL expr  */
+#line 909 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5440 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1133 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 201: /* expr_without_variable: rw_variable T_INC  */
+#line 910 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5446 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 301:
+  case 202: /* expr_without_variable: T_INC rw_variable  */
+#line 911 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5452 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1134 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 203: /* expr_without_variable: rw_variable T_DEC  */
+#line 912 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5458 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 302:
+  case 204: /* expr_without_variable: T_DEC rw_variable  */
+#line 913 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5464 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1135 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 205: /* expr_without_variable: expr T_BOOLEAN_OR expr  */
+#line 914 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5470 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 303:
+  case 206: /* expr_without_variable: expr T_BOOLEAN_AND expr  */
+#line 915 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5476 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1136 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 207: /* expr_without_variable: expr T_LOGICAL_OR expr  */
+#line 916 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5482 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 304:
+  case 208: /* expr_without_variable: expr T_LOGICAL_AND expr  */
+#line 917 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5488 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1141 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 209: /* expr_without_variable: expr T_LOGICAL_XOR expr  */
+#line 918 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5494 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 305:
+  case 210: /* expr_without_variable: expr '|' expr  */
+#line 919 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5500 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1142 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 211: /* expr_without_variable: expr '&' expr  */
+#line 920 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5506 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 306:
+  case 212: /* expr_without_variable: expr '^' expr  */
+#line 921 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5512 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1143 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 213: /* expr_without_variable: expr '.' expr  */
+#line 922 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5518 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 307:
+  case 214: /* expr_without_variable: expr '+' expr  */
+#line 923 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5524 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1144 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 215: /* expr_without_variable: expr '-' expr  */
+#line 924 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5530 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 308:
+  case 216: /* expr_without_variable: expr '*' expr  */
+#line 925 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5536 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1145 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 217: /* expr_without_variable: expr '/' expr  */
+#line 926 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5542 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 309:
+  case 218: /* expr_without_variable: expr '%' expr  */
+#line 927 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5548 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1146 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 219: /* expr_without_variable: expr T_SL expr  */
+#line 928 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5554 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 310:
+  case 220: /* expr_without_variable: expr T_SR expr  */
+#line 929 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5560 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1147 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 221: /* expr_without_variable: '+' expr  */
+#line 930 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5566 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 311:
+  case 222: /* expr_without_variable: '-' expr  */
+#line 931 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5572 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1148 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 223: /* expr_without_variable: '!' expr  */
+#line 932 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5578 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 312:
+  case 224: /* expr_without_variable: '~' expr  */
+#line 933 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5584 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1152 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 225: /* expr_without_variable: expr T_IS_IDENTICAL expr  */
+#line 934 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5590 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 313:
+  case 226: /* expr_without_variable: expr T_IS_NOT_IDENTICAL expr  */
+#line 935 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5596 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1156 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 227: /* expr_without_variable: expr T_IS_EQUAL expr  */
+#line 936 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5602 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 314:
+  case 228: /* expr_without_variable: expr T_IS_NOT_EQUAL expr  */
+#line 937 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5608 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1157 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 229: /* expr_without_variable: expr '<' expr  */
+#line 938 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5614 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 315:
+  case 230: /* expr_without_variable: expr T_IS_SMALLER_OR_EQUAL expr  */
+#line 939 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5620 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1158 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 231: /* expr_without_variable: expr '>' expr  */
+#line 940 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5626 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 316:
+  case 232: /* expr_without_variable: expr T_IS_GREATER_OR_EQUAL expr  */
+#line 941 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5632 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1159 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 233: /* expr_without_variable: expr T_INSTANCEOF class_name_reference  */
+#line 942 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statement) = 0; }
+#line 5638 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 317:
+  case 234: /* expr_without_variable: '(' expr ')'  */
+#line 943 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = (yyvsp[-1].statement); }
+#line 5644 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1160 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 235: /* expr_without_variable: expr '?' expr ':' expr  */
+#line 946 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5650 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 318:
+  case 236: /* expr_without_variable: expr '?' ':' expr  */
+#line 948 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5656 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1161 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 237: /* expr_without_variable: internal_functions_in_yacc  */
+#line 949 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5662 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 319:
+  case 238: /* expr_without_variable: T_INT_CAST expr  */
+#line 950 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5668 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1162 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 239: /* expr_without_variable: T_DOUBLE_CAST expr  */
+#line 951 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5674 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 320:
+  case 240: /* expr_without_variable: T_STRING_CAST expr  */
+#line 952 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5680 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1163 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 241: /* expr_without_variable: T_ARRAY_CAST expr  */
+#line 953 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5686 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 321:
+  case 242: /* expr_without_variable: T_OBJECT_CAST expr  */
+#line 954 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5692 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1168 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 243: /* expr_without_variable: T_BOOL_CAST expr  */
+#line 955 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5698 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 322:
+  case 244: /* expr_without_variable: T_UNSET_CAST expr  */
+#line 956 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5704 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1169 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 245: /* expr_without_variable: T_EXIT exit_expr  */
+#line 957 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5710 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 323:
+  case 246: /* expr_without_variable: '@' expr  */
+#line 958 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5716 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1173 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isComma) = 0; }
+  case 247: /* expr_without_variable: scalar  */
+#line 959 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5722 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 324:
+  case 248: /* expr_without_variable: T_ARRAY '(' array_pair_list ')'  */
+#line 960 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5728 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1174 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isComma) = 0; }
+  case 249: /* expr_without_variable: '`' backticks_expr '`'  */
+#line 961 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5734 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 329:
+  case 250: /* expr_without_variable: T_PRINT expr  */
+#line 962 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5740 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1185 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 251: /* $@7: %empty  */
+#line 964 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 5746 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 330:
+  case 252: /* expr_without_variable: function is_reference '(' parameter_list ')' lexical_vars '{' $@7 inner_statement_list '}'  */
+#line 965 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { observers.EndAnonymousFunction();
+																			  (yyval.statement) = 0;
+																			}
+#line 5754 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1186 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 254: /* lexical_vars: %empty  */
+#line 975 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 5760 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 334:
+  case 255: /* lexical_vars: T_USE '(' lexical_var_list ')'  */
+#line 976 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 5766 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1205 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if ((yyvsp[(1) - (2)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (2)].statement)->Type) {
-													observers.DoCaptureProperties = true;	
-												  }
-												}
+  case 256: /* lexical_var_list: lexical_var_list ',' T_VARIABLE  */
+#line 980 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 5772 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 335:
+  case 257: /* lexical_var_list: lexical_var_list ',' '&' T_VARIABLE  */
+#line 981 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 5778 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1210 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.DoCaptureProperties = false; }
+  case 258: /* lexical_var_list: T_VARIABLE  */
+#line 982 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 5784 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 336:
+  case 259: /* lexical_var_list: '&' T_VARIABLE  */
+#line 983 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 5790 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1211 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { 
-													if ((yyvsp[(1) - (7)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (7)].statement)->Type && (yyvsp[(4) - (7)].lexeme) && !(yyvsp[(5) - (7)].isMethod)) {
-														AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
-														
-														/* need to cast because we are returning a statement pointer from this rule */
-														(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeVariable((yyvsp[(4) - (7)].lexeme), (yyvsp[(4) - (7)].lexeme), false, (yyvsp[(4) - (7)].lexeme)->Pos, 
-														observers.GetScope(), observers.GetDeclaredNamespace());
-													}
-													else {
-														(yyval.statement) = 0; 
-													}													
-												}
+  case 260: /* $@8: %empty  */
+#line 987 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                { if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
+																							observers.DoCaptureScalars = true;
+																							observers.DoCaptureCallArguments = true;
+																						  }
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) { 
+																							observers.HasCallToFuncGetArg = true;
+																						  }
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) { 
+																							observers.HasCallToFuncGetArg = true;
+																						  }
+																						}
+#line 5806 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 261: /* function_call: namespace_name '(' $@8 function_call_parameter_list ')'  */
+#line 998 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { /* this parser is only interested in calls to the define function */
+																						  if ((yyvsp[-4].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
+																							pelet::ConstantStatementClass* constStmt;
+																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[-4].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber());
+																							(yyval.statement) = constStmt;
+																						  }
+																						  else {
+																							(yyval.statement) = 0;
+																						  }
+																						  observers.DoCaptureScalars = false;	
+																						  observers.DoCaptureCallArguments = false;
+																						}
+#line 5823 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 262: /* function_call: T_NAMESPACE T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 1012 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5829 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 263: /* $@9: %empty  */
+#line 1013 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
+																							observers.DoCaptureScalars = true; 
+																							observers.DoCaptureCallArguments = true;
+																						  }
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) { 
+																							observers.HasCallToFuncGetArg = true;
+																						  }
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) { 
+																							observers.HasCallToFuncGetArg = true;
+																						  }
+																						}
+#line 5845 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 264: /* function_call: T_NS_SEPARATOR namespace_name '(' $@9 function_call_parameter_list ')'  */
+#line 1024 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { /* this parser is only interested in calls to the define function */
+																						  if ((yyvsp[-4].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
+																							pelet::ConstantStatementClass* constStmt;
+																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[-4].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber());
+																							(yyval.statement) = constStmt;
+																						  }
+																						  else {
+																							(yyval.statement) = 0;
+																						  }	
+																						  observers.DoCaptureScalars = false;
+																						  observers.DoCaptureCallArguments = false;
+																						}
+#line 5862 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 337:
+  case 265: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING '(' function_call_parameter_list ')'  */
+#line 1037 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5868 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1223 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 266: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1039 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5874 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 338:
+  case 267: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING '(' function_call_parameter_list ')'  */
+#line 1041 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5880 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1227 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 268: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1043 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5886 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 339:
+  case 269: /* function_call: variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1045 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5892 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1228 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 270: /* class_name: T_STATIC  */
+#line 1049 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = 0; }
+#line 5898 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 340:
+  case 271: /* class_name: namespace_name  */
+#line 1050 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5904 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1233 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 272: /* class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1051 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+#line 5910 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 341:
+  case 273: /* class_name: T_NS_SEPARATOR namespace_name  */
+#line 1052 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeAbsolute(); }
+#line 5916 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1237 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isMethod) = 1; }
+  case 274: /* fully_qualified_class_name: namespace_name  */
+#line 1056 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5922 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 342:
+  case 275: /* fully_qualified_class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1057 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+#line 5928 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1238 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.isMethod) = 0; }
+  case 276: /* fully_qualified_class_name: T_NS_SEPARATOR namespace_name  */
+#line 1058 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeAbsolute(); }
+#line 5934 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 344:
+  case 277: /* class_name_reference: class_name  */
+#line 1062 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5940 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1243 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 278: /* class_name_reference: dynamic_class_name_reference  */
+#line 1063 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5946 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 345:
+  case 279: /* dynamic_class_name_reference: base_variable T_OBJECT_OPERATOR object_property dynamic_class_name_variable_properties  */
+#line 1068 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.qualifiedName) = 0; }
+#line 5952 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1247 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 280: /* dynamic_class_name_reference: base_variable  */
+#line 1069 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = 0; }
+#line 5958 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 346:
+  case 281: /* dynamic_class_name_variable_properties: dynamic_class_name_variable_properties dynamic_class_name_variable_property  */
+#line 1074 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 5964 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1248 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 282: /* dynamic_class_name_variable_properties: %empty  */
+#line 1075 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                                        { (yyval.unused) = 0; }
+#line 5970 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 347:
+  case 283: /* dynamic_class_name_variable_property: T_OBJECT_OPERATOR object_property  */
+#line 1079 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 5976 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1253 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 284: /* exit_expr: %empty  */
+#line 1083 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 5982 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 348:
+  case 285: /* exit_expr: '(' ')'  */
+#line 1084 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 5988 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1257 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { if ((yyvsp[(1) - (1)].lexeme) && (yyvsp[(1) - (1)].lexeme)->Lexeme.caseCompare(UNICODE_STRING_SIMPLE("$this"), 0) == 0) {
-										AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
-										
-										/* need to cast because we are returning a statement pointer from this rule */
-										(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeAsPublicVariable((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace());
-									  }
-									  else {
-										(yyval.statement) = 0; 
-									  }
-									}
+  case 286: /* exit_expr: '(' expr ')'  */
+#line 1085 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 5994 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 349:
+  case 287: /* backticks_expr: %empty  */
+#line 1089 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6000 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1267 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 288: /* backticks_expr: T_ENCAPSED_AND_WHITESPACE  */
+#line 1090 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6006 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 350:
+  case 289: /* backticks_expr: encaps_list  */
+#line 1091 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6012 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1271 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 290: /* ctor_arguments: %empty  */
+#line 1096 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6018 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 351:
+  case 291: /* ctor_arguments: '(' function_call_parameter_list ')'  */
+#line 1097 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6024 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1272 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 292: /* common_scalar: T_LNUMBER  */
+#line 1102 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { if (observers.DoCaptureScalars) {
+																				pelet::ScalarExpressionClass* scalarExpr;
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
+																				(yyval.statement) = scalarExpr;
+																			  }
+																			  else { 
+																			    (yyval.statement) = 0; 
+																			  }
+																			}
+#line 6038 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 293: /* common_scalar: T_DNUMBER  */
+#line 1111 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { 
+																			  if (observers.DoCaptureScalars) {
+																				pelet::ScalarExpressionClass* scalarExpr;
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
+																				(yyval.statement) = scalarExpr;
+																			  }
+																			  else { 
+																			    (yyval.statement) = 0; 
+																			  }
+																			}
+#line 6053 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 294: /* common_scalar: T_CONSTANT_ENCAPSED_STRING  */
+#line 1121 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { if (observers.DoCaptureScalars) {
+																				pelet::ScalarExpressionClass* scalarExpr;
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
+																				(yyval.statement) = scalarExpr;
+																			  }
+																			  else { 
+																			    (yyval.statement) = 0; 
+																			  }
+																			}
+#line 6067 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 352:
+  case 295: /* common_scalar: T_LINE  */
+#line 1130 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6073 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1273 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 296: /* common_scalar: T_FILE  */
+#line 1131 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6079 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 353:
+  case 297: /* common_scalar: T_DIR  */
+#line 1132 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6085 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1277 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 298: /* common_scalar: T_CLASS_C  */
+#line 1133 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6091 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 354:
+  case 299: /* common_scalar: T_METHOD_C  */
+#line 1134 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6097 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1278 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 300: /* common_scalar: T_FUNC_C  */
+#line 1135 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6103 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 355:
+  case 301: /* common_scalar: T_NS_C  */
+#line 1136 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6109 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1279 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 302: /* common_scalar: T_START_HEREDOC T_ENCAPSED_AND_WHITESPACE T_END_HEREDOC  */
+#line 1137 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statement) = 0; }
+#line 6115 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 356:
+  case 303: /* common_scalar: T_START_HEREDOC T_END_HEREDOC  */
+#line 1138 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 6121 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1284 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme);	}
+  case 304: /* static_scalar: common_scalar  */
+#line 1143 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6127 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 357:
+  case 305: /* static_scalar: namespace_name  */
+#line 1144 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6133 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1285 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 306: /* static_scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1145 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6139 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 358:
+  case 307: /* static_scalar: T_NS_SEPARATOR namespace_name  */
+#line 1146 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6145 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1289 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 308: /* static_scalar: '+' static_scalar  */
+#line 1147 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6151 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 359:
+  case 309: /* static_scalar: '-' static_scalar  */
+#line 1148 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6157 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1290 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 310: /* static_scalar: T_ARRAY '(' static_array_pair_list ')'  */
+#line 1149 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6163 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 360:
+  case 311: /* static_scalar: static_class_constant  */
+#line 1150 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6169 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1294 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 312: /* static_class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1154 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6175 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 361:
+  case 313: /* scalar: T_STRING_VARNAME  */
+#line 1158 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6181 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1295 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 314: /* scalar: class_constant  */
+#line 1159 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6187 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 362:
+  case 315: /* scalar: namespace_name  */
+#line 1160 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6193 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1299 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 316: /* scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1161 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6199 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 363:
+  case 317: /* scalar: T_NS_SEPARATOR namespace_name  */
+#line 1162 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 6205 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1300 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 318: /* scalar: common_scalar  */
+#line 1163 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 6211 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 364:
+  case 319: /* scalar: '"' encaps_list '"'  */
+#line 1164 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.statement) = 0; }
+#line 6217 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1301 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 320: /* scalar: T_START_HEREDOC encaps_list T_END_HEREDOC  */
+#line 1165 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6223 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 365:
+  case 321: /* static_array_pair_list: %empty  */
+#line 1170 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 6229 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1305 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = observers.DoCaptureProperties ? ((yyvsp[(1) - (1)].lexeme)) : 0; }
+  case 322: /* static_array_pair_list: non_empty_static_array_pair_list possible_comma  */
+#line 1171 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6235 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 366:
+  case 323: /* possible_comma: %empty  */
+#line 1175 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.isComma) = 0; }
+#line 6241 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1306 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 324: /* possible_comma: ','  */
+#line 1176 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.isComma) = 0; }
+#line 6247 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 367:
+  case 329: /* expr: r_variable  */
+#line 1187 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6253 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1310 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 330: /* expr: expr_without_variable  */
+#line 1188 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6259 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 368:
+  case 334: /* $@10: %empty  */
+#line 1207 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { if ((yyvsp[-1].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-1].statement)->Type) {
+													observers.DoCaptureProperties = true;	
+												  }
+												}
+#line 6268 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 335: /* $@11: %empty  */
+#line 1212 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { observers.DoCaptureProperties = false; }
+#line 6274 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
+
+  case 336: /* variable: base_variable_with_function_calls T_OBJECT_OPERATOR $@10 object_property method_or_not $@11 variable_properties  */
+#line 1213 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { 
+													if ((yyvsp[-6].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-6].statement)->Type && (yyvsp[-3].lexeme) && !(yyvsp[-2].isMethod)) {
+														AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
+														
+														/* need to cast because we are returning a statement pointer from this rule */
+														(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeVariable((yyvsp[-3].lexeme), (yyvsp[-3].lexeme), false, (yyvsp[-3].lexeme)->Pos, 
+														observers.GetScope(), observers.GetDeclaredNamespace());
+													}
+													else {
+														(yyval.statement) = 0; 
+													}													
+												}
+#line 6291 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1311 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 337: /* variable: base_variable_with_function_calls  */
+#line 1225 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6297 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 371:
+  case 338: /* variable_properties: variable_properties variable_property  */
+#line 1229 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6303 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1321 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 339: /* variable_properties: %empty  */
+#line 1230 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6309 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 372:
+  case 340: /* variable_property: T_OBJECT_OPERATOR object_property method_or_not  */
+#line 1235 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6315 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1322 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 341: /* method_or_not: '(' function_call_parameter_list ')'  */
+#line 1239 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.isMethod) = 1; }
+#line 6321 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 373:
+  case 342: /* method_or_not: %empty  */
+#line 1240 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.isMethod) = 0; }
+#line 6327 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1323 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 344: /* variable_without_objects: simple_indirect_reference reference_variable  */
+#line 1245 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.lexeme) = 0; }
+#line 6333 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 374:
+  case 345: /* static_member: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1249 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6339 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1327 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 346: /* static_member: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1250 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6345 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 375:
+  case 347: /* variable_class_name: reference_variable  */
+#line 1255 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6351 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1328 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 348: /* base_variable_with_function_calls: base_variable  */
+#line 1259 "/root/repo/src/Php53ResourceParser.y"
+                                                        { if ((yyvsp[0].lexeme) && (yyvsp[0].lexeme)->Lexeme.caseCompare(UNICODE_STRING_SIMPLE("$this"), 0) == 0) {
+										AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
+										
+										/* need to cast because we are returning a statement pointer from this rule */
+										(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeAsPublicVariable((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace());
+									  }
+									  else {
+										(yyval.statement) = 0; 
+									  }
+									}
+#line 6366 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 376:
+  case 349: /* base_variable_with_function_calls: function_call  */
+#line 1269 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 6372 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1332 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 350: /* base_variable: reference_variable  */
+#line 1273 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6378 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 377:
+  case 351: /* base_variable: simple_indirect_reference reference_variable  */
+#line 1274 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.lexeme) = 0; }
+#line 6384 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1333 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 352: /* base_variable: static_member  */
+#line 1275 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.lexeme) = 0; }
+#line 6390 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 378:
+  case 353: /* reference_variable: reference_variable '[' dim_offset ']'  */
+#line 1279 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6396 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1334 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 354: /* reference_variable: reference_variable '{' expr '}'  */
+#line 1280 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6402 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 379:
+  case 355: /* reference_variable: compound_variable  */
+#line 1281 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6408 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1335 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 356: /* compound_variable: T_VARIABLE  */
+#line 1285 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.lexeme) = (yyvsp[0].lexeme);	}
+#line 6414 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 380:
+  case 357: /* compound_variable: '$' '{' expr '}'  */
+#line 1286 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.lexeme) = 0; }
+#line 6420 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1336 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 358: /* dim_offset: %empty  */
+#line 1290 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6426 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 381:
+  case 359: /* dim_offset: expr  */
+#line 1291 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6432 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1337 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 360: /* object_property: object_dim_list  */
+#line 1295 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6438 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 382:
+  case 361: /* object_property: variable_without_objects  */
+#line 1296 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6444 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1338 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 362: /* object_dim_list: object_dim_list '[' dim_offset ']'  */
+#line 1300 "/root/repo/src/Php53ResourceParser.y"
+                                                         { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6450 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 383:
+  case 363: /* object_dim_list: object_dim_list '{' expr '}'  */
+#line 1301 "/root/repo/src/Php53ResourceParser.y"
+                                                         { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6456 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1339 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 364: /* object_dim_list: variable_name  */
+#line 1302 "/root/repo/src/Php53ResourceParser.y"
+                                                                         { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6462 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 384:
+  case 365: /* variable_name: T_STRING  */
+#line 1306 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.lexeme) = observers.DoCaptureProperties ? ((yyvsp[0].lexeme)) : 0; }
+#line 6468 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1343 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 366: /* variable_name: '{' expr '}'  */
+#line 1307 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.lexeme) = 0; }
+#line 6474 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 385:
+  case 367: /* simple_indirect_reference: '$'  */
+#line 1311 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6480 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1344 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 368: /* simple_indirect_reference: simple_indirect_reference '$'  */
+#line 1312 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6486 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 386:
+  case 371: /* assignment_list_element: variable  */
+#line 1322 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6492 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1345 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 372: /* assignment_list_element: T_LIST '(' assignment_list ')'  */
+#line 1323 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6498 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 387:
+  case 373: /* assignment_list_element: %empty  */
+#line 1324 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6504 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1346 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 374: /* array_pair_list: %empty  */
+#line 1328 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 6510 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 388:
+  case 375: /* array_pair_list: non_empty_array_pair_list possible_comma  */
+#line 1329 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 6516 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1350 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 376: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW expr  */
+#line 1333 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.statementList) = 0; }
+#line 6522 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 389:
+  case 377: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr  */
+#line 1334 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = 0; }
+#line 6528 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1351 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 378: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW expr  */
+#line 1335 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.statementList) = 0; }
+#line 6534 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 390:
+  case 379: /* non_empty_array_pair_list: expr  */
+#line 1336 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 6540 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1352 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 380: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1337 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 6546 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 391:
+  case 381: /* non_empty_array_pair_list: non_empty_array_pair_list ',' '&' w_variable  */
+#line 1338 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.statementList) = 0; }
+#line 6552 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1353 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 382: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1339 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = 0; }
+#line 6558 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 392:
+  case 383: /* non_empty_array_pair_list: '&' w_variable  */
+#line 1340 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                                { (yyval.statementList) = 0; }
+#line 6564 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1354 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 384: /* encaps_list: encaps_list encaps_var  */
+#line 1344 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6570 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 393:
+  case 385: /* encaps_list: encaps_list T_ENCAPSED_AND_WHITESPACE  */
+#line 1345 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6576 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1355 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 386: /* encaps_list: encaps_var  */
+#line 1346 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 6582 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 394:
+  case 387: /* encaps_list: T_ENCAPSED_AND_WHITESPACE encaps_var  */
+#line 1347 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6588 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1359 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 388: /* encaps_var: T_VARIABLE  */
+#line 1351 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                                        { (yyval.unused) = 0; }
+#line 6594 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 395:
+  case 389: /* encaps_var: T_VARIABLE '[' encaps_var_offset ']'  */
+#line 1352 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6600 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1360 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 390: /* encaps_var: T_VARIABLE T_OBJECT_OPERATOR T_STRING  */
+#line 1353 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6606 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 396:
+  case 391: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES expr '}'  */
+#line 1354 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 6612 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1361 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 392: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES T_STRING_VARNAME '[' expr ']' '}'  */
+#line 1355 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6618 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 397:
+  case 393: /* encaps_var: T_CURLY_OPEN variable '}'  */
+#line 1356 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 6624 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1365 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 394: /* encaps_var_offset: T_STRING  */
+#line 1360 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6630 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 398:
+  case 395: /* encaps_var_offset: T_NUM_STRING  */
+#line 1361 "/root/repo/src/Php53ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 6636 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1366 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 396: /* encaps_var_offset: T_VARIABLE  */
+#line 1362 "/root/repo/src/Php53ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6642 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 399:
+  case 397: /* internal_functions_in_yacc: T_ISSET '(' isset_variables ')'  */
+#line 1366 "/root/repo/src/Php53ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6648 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1367 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 398: /* internal_functions_in_yacc: T_EMPTY '(' variable ')'  */
+#line 1367 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 6654 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 400:
+  case 399: /* $@12: %empty  */
+#line 1368 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { observers.DoCaptureScalars = true; }
+#line 6660 "/root/repo/src/Php53ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1368 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
-												  (yyval.statement) = includeExpr;
-												  observers.DoCaptureScalars = false;  
+  case 400: /* internal_functions_in_yacc: T_INCLUDE $@12 expr  */
+#line 1369 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
+												  (yyval.statement) = includeExpr;
+												  observers.DoCaptureScalars = false;  
 												}
+#line 6670 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 401:
-
-/* Line 1806 of yacc.c  */
-#line 1373 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 401: /* $@13: %empty  */
+#line 1374 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { observers.DoCaptureScalars = true; }
+#line 6676 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 402:
-
-/* Line 1806 of yacc.c  */
-#line 1374 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
-												  (yyval.statement) = includeExpr;
-												  observers.DoCaptureScalars = false;  
+  case 402: /* internal_functions_in_yacc: T_INCLUDE_ONCE $@13 expr  */
+#line 1375 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
+												  (yyval.statement) = includeExpr;
+												  observers.DoCaptureScalars = false;  
 												}
+#line 6686 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 403:
-
-/* Line 1806 of yacc.c  */
-#line 1379 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 403: /* internal_functions_in_yacc: T_EVAL '(' expr ')'  */
+#line 1380 "/root/repo/src/Php53ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 6692 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 404:
-
-/* Line 1806 of yacc.c  */
-#line 1380 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 404: /* $@14: %empty  */
+#line 1381 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { observers.DoCaptureScalars = true; }
+#line 6698 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 405:
-
-/* Line 1806 of yacc.c  */
-#line 1381 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
-												  (yyval.statement) = includeExpr;
-												  observers.DoCaptureScalars = false;  
+  case 405: /* internal_functions_in_yacc: T_REQUIRE $@14 expr  */
+#line 1382 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
+												  (yyval.statement) = includeExpr;
+												  observers.DoCaptureScalars = false;  
 												}
+#line 6708 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 406:
-
-/* Line 1806 of yacc.c  */
-#line 1386 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 406: /* $@15: %empty  */
+#line 1387 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { observers.DoCaptureScalars = true; }
+#line 6714 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 407:
-
-/* Line 1806 of yacc.c  */
-#line 1387 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
-												  (yyval.statement) = includeExpr;
-												  observers.DoCaptureScalars = false;  
+  case 407: /* internal_functions_in_yacc: T_REQUIRE_ONCE $@15 expr  */
+#line 1388 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
+												  (yyval.statement) = includeExpr;
+												  observers.DoCaptureScalars = false;  
 												}
+#line 6724 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 408:
-
-/* Line 1806 of yacc.c  */
-#line 1395 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 408: /* isset_variables: variable  */
+#line 1396 "/root/repo/src/Php53ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6730 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 409:
-
-/* Line 1806 of yacc.c  */
-#line 1396 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 409: /* isset_variables: isset_variables ',' variable  */
+#line 1397 "/root/repo/src/Php53ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6736 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 410:
-
-/* Line 1806 of yacc.c  */
-#line 1400 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 410: /* class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1401 "/root/repo/src/Php53ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6742 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
-  case 411:
-
-/* Line 1806 of yacc.c  */
-#line 1401 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 411: /* class_constant: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1402 "/root/repo/src/Php53ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6748 "/root/repo/src/Php53ResourceParser.cpp"
     break;
 
 
+#line 6752 "/root/repo/src/Php53ResourceParser.cpp"
 
-/* Line 1806 of yacc.c  */
-#line 6695 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6705,96 +6763,88 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == PHP53_RESOURCE_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (analyzer, observers, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyps, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (analyzer, observers, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= T_END)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == T_END)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, analyzer, observers);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, analyzer, observers);
+          yychar = PHP53_RESOURCE_EMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -6806,14 +6856,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -6826,39 +6875,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6869,27 +6921,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (analyzer, observers, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEMPTY)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != PHP53_RESOURCE_EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -6897,31 +6953,37 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, analyzer, observers);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  return yyresult;
 }
-
-
-
-/* Line 2067 of yacc.c  */
-#line 1404 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php53ResourceParser.y"
-
-
+#undef php53_resource_nerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 1405 "/root/repo/src/Php53ResourceParser.y"
+
@@ -32,7 +32,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ResourceParserTypeClass
+#define PHP53_RESOURCE_STYPE pelet::ResourceParserTypeClass
 
 // so that both bison parses call the same lex function
 #define php53_resource_lex pelet::ResourceLex
@@ -48,9 +48,10 @@
 %lex-param { pelet::ResourceParserBufferClass &observers }
 
 %define api.pure
+%define api.push-pull both
 %expect 2
-%error-verbose
-%name-prefix "php53_resource_"
+%define parse.error verbose
+%define api.prefix {php53_resource_}
 %debug
 
 %left T_INCLUDE T_INCLUDE_ONCE T_EVAL T_REQUIRE T_REQUIRE_ONCE
@@ -338,11 +339,12 @@
 %% /* Rules */
 
 start:
-	top_statement_list							{ observers.MakeAst($1); }
+	top_statement_list							{ if (analyzer.WasCancelled()) { YYABORT; } if (!observers.DoNotifyEachStatement) { observers.MakeAst($1); } }
 ;
 
 top_statement_list:
-		top_statement_list top_statement		{ $$ = $1->PushAll($2); }
+		top_statement_list top_statement		{ if (observers.DoNotifyEachStatement && observers.IsAtTopLevel()) { observers.MakeAst($2); observers.ReleaseStatements($1); $$ = $1; } 
+												  else { $$ = $1->PushAll($2); } }
 	|	/* empty */								{ AST_INIT($$, pelet::StatementListClass); }
 ;
 
@@ -361,16 +363,16 @@ top_statement:
 												  AST_INIT_ARGS($$, pelet::StatementListClass, decl);
 												  observers.SetDeclaredNamespace($2); 
 												}
-	|	T_NAMESPACE namespace_name '{'			{ observers.SetDeclaredNamespace($2); }
+	|	T_NAMESPACE namespace_name '{'			{ observers.SetDeclaredNamespace($2); observers.BeginNamespaceBlock(); }
 		top_statement_list '}'					{ pelet::NamespaceDeclarationClass* decl;
 												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, $2, $1);
-												  $$ = $5->PushFront(decl);
+												  $$ = $5->PushFront(decl); observers.EndNamespaceBlock();
 												}
-	|	T_NAMESPACE '{'							{ observers.SetDeclaredNamespace(NULL); }
+	|	T_NAMESPACE '{'							{ observers.SetDeclaredNamespace(NULL); observers.BeginNamespaceBlock(); }
 		top_statement_list '}'					{ 
 												  pelet::NamespaceDeclarationClass* decl;
 												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, $1);
-												  $$ = $4->PushFront(decl);
+												  $$ = $4->PushFront(decl); observers.EndNamespaceBlock();
 												}
 	|	T_USE use_declarations ';'				{ $$ = pelet::NamespaceUseClass::SetStartingPos($2, $1); }
 	|	constant_declaration ';'				{ AST_INIT_ARGS($$, pelet::StatementListClass, $1); }
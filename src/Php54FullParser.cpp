@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -53,28 +58,28 @@
 #define YYPURE 1
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
+/* Substitute the type names.  */
+#define YYSTYPE         PHP54STYPE
 /* Substitute the variable and function names.  */
 #define yyparse         php54parse
+#define yypush_parse    php54push_parse
+#define yypull_parse    php54pull_parse
+#define yypstate_new    php54pstate_new
+#define yypstate_clear  php54pstate_clear
+#define yypstate_delete php54pstate_delete
+#define yypstate        php54pstate
 #define yylex           php54lex
 #define yyerror         php54error
-#define yylval          php54lval
-#define yychar          php54char
 #define yydebug         php54debug
 #define yynerrs         php54nerrs
 
-
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
-#line 1 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
+/* First part of user prologue.  */
+#line 1 "/root/repo/src/Php54FullParser.y"
 
 	
 #include <pelet/LexicalAnalyzerClass.h>
@@ -85,7 +90,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ParserType
+#define PHP54STYPE pelet::ParserType
 
 // so that both bison parses call the same lex function
 #define php54lex pelet::FullLex
@@ -94,210 +99,602 @@
 #define php54error pelet::FullGrammarError
 
 
+#line 103 "/root/repo/src/Php54FullParser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Line 268 of yacc.c  */
-#line 100 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.cpp"
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
+/* Debug traces.  */
+#ifndef PHP54DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define PHP54DEBUG 1
+#  else
+#   define PHP54DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define PHP54DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined PHP54DEBUG */
+#if PHP54DEBUG
+extern int php54debug;
 #endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
+/* Token kinds.  */
+#ifndef PHP54TOKENTYPE
+# define PHP54TOKENTYPE
+  enum php54tokentype
+  {
+    PHP54EMPTY = -2,
+    T_END = 0,                     /* T_END  */
+    PHP54error = 256,              /* error  */
+    PHP54UNDEF = 629,              /* "invalid token"  */
+    T_ABSTRACT = 502,              /* T_ABSTRACT  */
+    T_AND_EQUAL = 503,             /* T_AND_EQUAL  */
+    T_ARRAY = 504,                 /* T_ARRAY  */
+    T_ARRAY_CAST = 505,            /* T_ARRAY_CAST  */
+    T_AS = 506,                    /* T_AS  */
+    T_BAD_CHARACTER = 507,         /* T_BAD_CHARACTER  */
+    T_BOOL_CAST = 508,             /* T_BOOL_CAST  */
+    T_BOOLEAN_AND = 509,           /* T_BOOLEAN_AND  */
+    T_BOOLEAN_OR = 510,            /* T_BOOLEAN_OR  */
+    T_BREAK = 511,                 /* T_BREAK  */
+    T_CALLABLE = 512,              /* T_CALLABLE  */
+    T_CASE = 513,                  /* T_CASE  */
+    T_CATCH = 514,                 /* T_CATCH  */
+    T_CHARACTER = 515,             /* T_CHARACTER  */
+    T_CLASS = 516,                 /* T_CLASS  */
+    T_CLASS_C = 517,               /* T_CLASS_C  */
+    T_CLONE = 518,                 /* T_CLONE  */
+    T_CLOSE_TAG = 519,             /* T_CLOSE_TAG  */
+    T_COMMENT = 520,               /* T_COMMENT  */
+    T_CONCAT_EQUAL = 521,          /* T_CONCAT_EQUAL  */
+    T_CONST = 522,                 /* T_CONST  */
+    T_CONSTANT_ENCAPSED_STRING = 523, /* T_CONSTANT_ENCAPSED_STRING  */
+    T_CONTINUE = 524,              /* T_CONTINUE  */
+    T_CURLY_OPEN = 525,            /* T_CURLY_OPEN  */
+    T_DEC = 526,                   /* T_DEC  */
+    T_DECLARE = 527,               /* T_DECLARE  */
+    T_DEFAULT = 528,               /* T_DEFAULT  */
+    T_DIR = 529,                   /* T_DIR  */
+    T_DIV_EQUAL = 530,             /* T_DIV_EQUAL  */
+    T_DNUMBER = 531,               /* T_DNUMBER  */
+    T_DO = 532,                    /* T_DO  */
+    T_DOC_COMMENT = 533,           /* T_DOC_COMMENT  */
+    T_DOLLAR_OPEN_CURLY_BRACES = 534, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+    T_DOUBLE_ARROW = 535,          /* T_DOUBLE_ARROW  */
+    T_DOUBLE_CAST = 536,           /* T_DOUBLE_CAST  */
+    T_ECHO = 537,                  /* T_ECHO  */
+    T_ELSE = 538,                  /* T_ELSE  */
+    T_ELSEIF = 539,                /* T_ELSEIF  */
+    T_EMPTY = 540,                 /* T_EMPTY  */
+    T_ENCAPSED_AND_WHITESPACE = 541, /* T_ENCAPSED_AND_WHITESPACE  */
+    T_ENDDECLARE = 542,            /* T_ENDDECLARE  */
+    T_ENDFOR = 543,                /* T_ENDFOR  */
+    T_ENDFOREACH = 544,            /* T_ENDFOREACH  */
+    T_END_HEREDOC = 545,           /* T_END_HEREDOC  */
+    T_ENDIF = 546,                 /* T_ENDIF  */
+    T_ENDSWITCH = 547,             /* T_ENDSWITCH  */
+    T_ENDWHILE = 548,              /* T_ENDWHILE  */
+    T_EVAL = 549,                  /* T_EVAL  */
+    T_EXIT = 550,                  /* T_EXIT  */
+    T_EXTENDS = 551,               /* T_EXTENDS  */
+    T_FILE = 552,                  /* T_FILE  */
+    T_FINAL = 553,                 /* T_FINAL  */
+    T_FOR = 554,                   /* T_FOR  */
+    T_FOREACH = 555,               /* T_FOREACH  */
+    T_FUNC_C = 556,                /* T_FUNC_C  */
+    T_FUNCTION = 557,              /* T_FUNCTION  */
+    T_GLOBAL = 558,                /* T_GLOBAL  */
+    T_GOTO = 559,                  /* T_GOTO  */
+    T_HALT_COMPILER = 560,         /* T_HALT_COMPILER  */
+    T_IF = 561,                    /* T_IF  */
+    T_IMPLEMENTS = 562,            /* T_IMPLEMENTS  */
+    T_INC = 563,                   /* T_INC  */
+    T_INCLUDE = 564,               /* T_INCLUDE  */
+    T_INCLUDE_ONCE = 565,          /* T_INCLUDE_ONCE  */
+    T_INLINE_HTML = 566,           /* T_INLINE_HTML  */
+    T_INSTANCEOF = 567,            /* T_INSTANCEOF  */
+    T_INSTEADOF = 568,             /* T_INSTEADOF  */
+    T_INT_CAST = 569,              /* T_INT_CAST  */
+    T_INTERFACE = 570,             /* T_INTERFACE  */
+    T_IS_EQUAL = 571,              /* T_IS_EQUAL  */
+    T_IS_GREATER_OR_EQUAL = 572,   /* T_IS_GREATER_OR_EQUAL  */
+    T_IS_IDENTICAL = 573,          /* T_IS_IDENTICAL  */
+    T_IS_NOT_EQUAL = 574,          /* T_IS_NOT_EQUAL  */
+    T_IS_NOT_IDENTICAL = 575,      /* T_IS_NOT_IDENTICAL  */
+    T_ISSET = 576,                 /* T_ISSET  */
+    T_IS_SMALLER_OR_EQUAL = 577,   /* T_IS_SMALLER_OR_EQUAL  */
+    T_LINE = 578,                  /* T_LINE  */
+    T_LIST = 579,                  /* T_LIST  */
+    T_LNUMBER = 580,               /* T_LNUMBER  */
+    T_LOGICAL_AND = 581,           /* T_LOGICAL_AND  */
+    T_LOGICAL_OR = 582,            /* T_LOGICAL_OR  */
+    T_LOGICAL_XOR = 583,           /* T_LOGICAL_XOR  */
+    T_METHOD_C = 584,              /* T_METHOD_C  */
+    T_MINUS_EQUAL = 585,           /* T_MINUS_EQUAL  */
+    T_MOD_EQUAL = 586,             /* T_MOD_EQUAL  */
+    T_MUL_EQUAL = 587,             /* T_MUL_EQUAL  */
+    T_NAMESPACE = 588,             /* T_NAMESPACE  */
+    T_NEW = 589,                   /* T_NEW  */
+    T_NS_C = 590,                  /* T_NS_C  */
+    T_NS_SEPARATOR = 591,          /* T_NS_SEPARATOR  */
+    T_NUM_STRING = 592,            /* T_NUM_STRING  */
+    T_OBJECT_CAST = 593,           /* T_OBJECT_CAST  */
+    T_OBJECT_OPERATOR = 594,       /* T_OBJECT_OPERATOR  */
+    T_OPEN_TAG = 595,              /* T_OPEN_TAG  */
+    T_OPEN_TAG_WITH_ECHO = 596,    /* T_OPEN_TAG_WITH_ECHO  */
+    T_OR_EQUAL = 597,              /* T_OR_EQUAL  */
+    T_PAAMAYIM_NEKUDOTAYIM = 598,  /* T_PAAMAYIM_NEKUDOTAYIM  */
+    T_PLUS_EQUAL = 599,            /* T_PLUS_EQUAL  */
+    T_PRINT = 600,                 /* T_PRINT  */
+    T_PRIVATE = 601,               /* T_PRIVATE  */
+    T_PROTECTED = 602,             /* T_PROTECTED  */
+    T_PUBLIC = 603,                /* T_PUBLIC  */
+    T_REQUIRE = 604,               /* T_REQUIRE  */
+    T_REQUIRE_ONCE = 605,          /* T_REQUIRE_ONCE  */
+    T_RETURN = 606,                /* T_RETURN  */
+    T_SL = 607,                    /* T_SL  */
+    T_SL_EQUAL = 608,              /* T_SL_EQUAL  */
+    T_SR = 609,                    /* T_SR  */
+    T_SR_EQUAL = 610,              /* T_SR_EQUAL  */
+    T_START_HEREDOC = 611,         /* T_START_HEREDOC  */
+    T_STATIC = 612,                /* T_STATIC  */
+    T_STRING = 613,                /* T_STRING  */
+    T_STRING_CAST = 614,           /* T_STRING_CAST  */
+    T_STRING_VARNAME = 615,        /* T_STRING_VARNAME  */
+    T_SWITCH = 616,                /* T_SWITCH  */
+    T_THROW = 617,                 /* T_THROW  */
+    T_TRAIT = 618,                 /* T_TRAIT  */
+    T_TRAIT_C = 619,               /* T_TRAIT_C  */
+    T_TRY = 620,                   /* T_TRY  */
+    T_UNSET = 621,                 /* T_UNSET  */
+    T_UNSET_CAST = 622,            /* T_UNSET_CAST  */
+    T_USE = 623,                   /* T_USE  */
+    T_VAR = 624,                   /* T_VAR  */
+    T_VARIABLE = 625,              /* T_VARIABLE  */
+    T_WHILE = 626,                 /* T_WHILE  */
+    T_WHITESPACE = 627,            /* T_WHITESPACE  */
+    T_XOR_EQUAL = 628              /* T_XOR_EQUAL  */
+  };
+  typedef enum php54tokentype php54token_kind_t;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+/* Value type.  */
 
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_END = 0,
-     T_REQUIRE_ONCE = 605,
-     T_REQUIRE = 604,
-     T_EVAL = 549,
-     T_INCLUDE_ONCE = 565,
-     T_INCLUDE = 564,
-     T_LOGICAL_OR = 582,
-     T_LOGICAL_XOR = 583,
-     T_LOGICAL_AND = 581,
-     T_PRINT = 600,
-     T_SR_EQUAL = 610,
-     T_SL_EQUAL = 608,
-     T_XOR_EQUAL = 628,
-     T_OR_EQUAL = 597,
-     T_AND_EQUAL = 503,
-     T_MOD_EQUAL = 586,
-     T_CONCAT_EQUAL = 521,
-     T_DIV_EQUAL = 530,
-     T_MUL_EQUAL = 587,
-     T_MINUS_EQUAL = 585,
-     T_PLUS_EQUAL = 599,
-     T_BOOLEAN_OR = 510,
-     T_BOOLEAN_AND = 509,
-     T_IS_NOT_IDENTICAL = 575,
-     T_IS_IDENTICAL = 573,
-     T_IS_NOT_EQUAL = 574,
-     T_IS_EQUAL = 571,
-     T_IS_GREATER_OR_EQUAL = 572,
-     T_IS_SMALLER_OR_EQUAL = 577,
-     T_SR = 609,
-     T_SL = 607,
-     T_INSTANCEOF = 567,
-     T_UNSET_CAST = 622,
-     T_BOOL_CAST = 508,
-     T_OBJECT_CAST = 593,
-     T_ARRAY_CAST = 505,
-     T_STRING_CAST = 614,
-     T_DOUBLE_CAST = 536,
-     T_INT_CAST = 569,
-     T_DEC = 526,
-     T_INC = 563,
-     T_CLONE = 518,
-     T_NEW = 589,
-     T_ELSEIF = 539,
-     T_ELSE = 538,
-     T_ENDIF = 546,
-     T_PUBLIC = 603,
-     T_PROTECTED = 602,
-     T_PRIVATE = 601,
-     T_FINAL = 553,
-     T_ABSTRACT = 502,
-     T_STATIC = 612,
-     T_ARRAY = 504,
-     T_AS = 506,
-     T_BAD_CHARACTER = 507,
-     T_BREAK = 511,
-     T_CALLABLE = 512,
-     T_CASE = 513,
-     T_CATCH = 514,
-     T_CHARACTER = 515,
-     T_CLASS = 516,
-     T_CLASS_C = 517,
-     T_CLOSE_TAG = 519,
-     T_COMMENT = 520,
-     T_CONST = 522,
-     T_CONSTANT_ENCAPSED_STRING = 523,
-     T_CONTINUE = 524,
-     T_CURLY_OPEN = 525,
-     T_DECLARE = 527,
-     T_DEFAULT = 528,
-     T_DIR = 529,
-     T_DNUMBER = 531,
-     T_DO = 532,
-     T_DOC_COMMENT = 533,
-     T_DOLLAR_OPEN_CURLY_BRACES = 534,
-     T_DOUBLE_ARROW = 535,
-     T_ECHO = 537,
-     T_EMPTY = 540,
-     T_ENCAPSED_AND_WHITESPACE = 541,
-     T_ENDDECLARE = 542,
-     T_ENDFOR = 543,
-     T_ENDFOREACH = 544,
-     T_END_HEREDOC = 545,
-     T_ENDSWITCH = 547,
-     T_ENDWHILE = 548,
-     T_EXIT = 550,
-     T_EXTENDS = 551,
-     T_FILE = 552,
-     T_FOR = 554,
-     T_FOREACH = 555,
-     T_FUNC_C = 556,
-     T_FUNCTION = 557,
-     T_GLOBAL = 558,
-     T_GOTO = 559,
-     T_HALT_COMPILER = 560,
-     T_IF = 561,
-     T_IMPLEMENTS = 562,
-     T_INLINE_HTML = 566,
-     T_INSTEADOF = 568,
-     T_INTERFACE = 570,
-     T_ISSET = 576,
-     T_LINE = 578,
-     T_LIST = 579,
-     T_LNUMBER = 580,
-     T_METHOD_C = 584,
-     T_NAMESPACE = 588,
-     T_NS_C = 590,
-     T_NS_SEPARATOR = 591,
-     T_NUM_STRING = 592,
-     T_OBJECT_OPERATOR = 594,
-     T_OPEN_TAG = 595,
-     T_OPEN_TAG_WITH_ECHO = 596,
-     T_PAAMAYIM_NEKUDOTAYIM = 598,
-     T_RETURN = 606,
-     T_START_HEREDOC = 611,
-     T_STRING = 613,
-     T_STRING_VARNAME = 615,
-     T_SWITCH = 616,
-     T_THROW = 617,
-     T_TRAIT = 618,
-     T_TRAIT_C = 619,
-     T_TRY = 620,
-     T_UNSET = 621,
-     T_USE = 623,
-     T_VAR = 624,
-     T_VARIABLE = 625,
-     T_WHILE = 626,
-     T_WHITESPACE = 627
-   };
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
 #endif
 
+typedef struct php54pstate php54pstate;
 
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+int php54parse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+int php54push_parse (php54pstate *ps,
+                  int pushed_char, PHP54STYPE const *pushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+int php54pull_parse (php54pstate *ps, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
+php54pstate *php54pstate_new (void);
+void php54pstate_delete (php54pstate *ps);
+
 
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* T_END  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ','  */
+  YYSYMBOL_4_ = 4,                         /* '='  */
+  YYSYMBOL_5_ = 5,                         /* '?'  */
+  YYSYMBOL_6_ = 6,                         /* ':'  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_12_ = 12,                       /* '+'  */
+  YYSYMBOL_13_ = 13,                       /* '-'  */
+  YYSYMBOL_14_ = 14,                       /* '.'  */
+  YYSYMBOL_15_ = 15,                       /* '*'  */
+  YYSYMBOL_16_ = 16,                       /* '/'  */
+  YYSYMBOL_17_ = 17,                       /* '%'  */
+  YYSYMBOL_18_ = 18,                       /* '!'  */
+  YYSYMBOL_19_ = 19,                       /* '~'  */
+  YYSYMBOL_20_ = 20,                       /* '@'  */
+  YYSYMBOL_21_ = 21,                       /* '['  */
+  YYSYMBOL_T_ABSTRACT = 22,                /* T_ABSTRACT  */
+  YYSYMBOL_T_AND_EQUAL = 23,               /* T_AND_EQUAL  */
+  YYSYMBOL_T_ARRAY = 24,                   /* T_ARRAY  */
+  YYSYMBOL_T_ARRAY_CAST = 25,              /* T_ARRAY_CAST  */
+  YYSYMBOL_T_AS = 26,                      /* T_AS  */
+  YYSYMBOL_T_BAD_CHARACTER = 27,           /* T_BAD_CHARACTER  */
+  YYSYMBOL_T_BOOL_CAST = 28,               /* T_BOOL_CAST  */
+  YYSYMBOL_T_BOOLEAN_AND = 29,             /* T_BOOLEAN_AND  */
+  YYSYMBOL_T_BOOLEAN_OR = 30,              /* T_BOOLEAN_OR  */
+  YYSYMBOL_T_BREAK = 31,                   /* T_BREAK  */
+  YYSYMBOL_T_CALLABLE = 32,                /* T_CALLABLE  */
+  YYSYMBOL_T_CASE = 33,                    /* T_CASE  */
+  YYSYMBOL_T_CATCH = 34,                   /* T_CATCH  */
+  YYSYMBOL_T_CHARACTER = 35,               /* T_CHARACTER  */
+  YYSYMBOL_T_CLASS = 36,                   /* T_CLASS  */
+  YYSYMBOL_T_CLASS_C = 37,                 /* T_CLASS_C  */
+  YYSYMBOL_T_CLONE = 38,                   /* T_CLONE  */
+  YYSYMBOL_T_CLOSE_TAG = 39,               /* T_CLOSE_TAG  */
+  YYSYMBOL_T_COMMENT = 40,                 /* T_COMMENT  */
+  YYSYMBOL_T_CONCAT_EQUAL = 41,            /* T_CONCAT_EQUAL  */
+  YYSYMBOL_T_CONST = 42,                   /* T_CONST  */
+  YYSYMBOL_T_CONSTANT_ENCAPSED_STRING = 43, /* T_CONSTANT_ENCAPSED_STRING  */
+  YYSYMBOL_T_CONTINUE = 44,                /* T_CONTINUE  */
+  YYSYMBOL_T_CURLY_OPEN = 45,              /* T_CURLY_OPEN  */
+  YYSYMBOL_T_DEC = 46,                     /* T_DEC  */
+  YYSYMBOL_T_DECLARE = 47,                 /* T_DECLARE  */
+  YYSYMBOL_T_DEFAULT = 48,                 /* T_DEFAULT  */
+  YYSYMBOL_T_DIR = 49,                     /* T_DIR  */
+  YYSYMBOL_T_DIV_EQUAL = 50,               /* T_DIV_EQUAL  */
+  YYSYMBOL_T_DNUMBER = 51,                 /* T_DNUMBER  */
+  YYSYMBOL_T_DO = 52,                      /* T_DO  */
+  YYSYMBOL_T_DOC_COMMENT = 53,             /* T_DOC_COMMENT  */
+  YYSYMBOL_T_DOLLAR_OPEN_CURLY_BRACES = 54, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+  YYSYMBOL_T_DOUBLE_ARROW = 55,            /* T_DOUBLE_ARROW  */
+  YYSYMBOL_T_DOUBLE_CAST = 56,             /* T_DOUBLE_CAST  */
+  YYSYMBOL_T_ECHO = 57,                    /* T_ECHO  */
+  YYSYMBOL_T_ELSE = 58,                    /* T_ELSE  */
+  YYSYMBOL_T_ELSEIF = 59,                  /* T_ELSEIF  */
+  YYSYMBOL_T_EMPTY = 60,                   /* T_EMPTY  */
+  YYSYMBOL_T_ENCAPSED_AND_WHITESPACE = 61, /* T_ENCAPSED_AND_WHITESPACE  */
+  YYSYMBOL_T_ENDDECLARE = 62,              /* T_ENDDECLARE  */
+  YYSYMBOL_T_ENDFOR = 63,                  /* T_ENDFOR  */
+  YYSYMBOL_T_ENDFOREACH = 64,              /* T_ENDFOREACH  */
+  YYSYMBOL_T_END_HEREDOC = 65,             /* T_END_HEREDOC  */
+  YYSYMBOL_T_ENDIF = 66,                   /* T_ENDIF  */
+  YYSYMBOL_T_ENDSWITCH = 67,               /* T_ENDSWITCH  */
+  YYSYMBOL_T_ENDWHILE = 68,                /* T_ENDWHILE  */
+  YYSYMBOL_T_EVAL = 69,                    /* T_EVAL  */
+  YYSYMBOL_T_EXIT = 70,                    /* T_EXIT  */
+  YYSYMBOL_T_EXTENDS = 71,                 /* T_EXTENDS  */
+  YYSYMBOL_T_FILE = 72,                    /* T_FILE  */
+  YYSYMBOL_T_FINAL = 73,                   /* T_FINAL  */
+  YYSYMBOL_T_FOR = 74,                     /* T_FOR  */
+  YYSYMBOL_T_FOREACH = 75,                 /* T_FOREACH  */
+  YYSYMBOL_T_FUNC_C = 76,                  /* T_FUNC_C  */
+  YYSYMBOL_T_FUNCTION = 77,                /* T_FUNCTION  */
+  YYSYMBOL_T_GLOBAL = 78,                  /* T_GLOBAL  */
+  YYSYMBOL_T_GOTO = 79,                    /* T_GOTO  */
+  YYSYMBOL_T_HALT_COMPILER = 80,           /* T_HALT_COMPILER  */
+  YYSYMBOL_T_IF = 81,                      /* T_IF  */
+  YYSYMBOL_T_IMPLEMENTS = 82,              /* T_IMPLEMENTS  */
+  YYSYMBOL_T_INC = 83,                     /* T_INC  */
+  YYSYMBOL_T_INCLUDE = 84,                 /* T_INCLUDE  */
+  YYSYMBOL_T_INCLUDE_ONCE = 85,            /* T_INCLUDE_ONCE  */
+  YYSYMBOL_T_INLINE_HTML = 86,             /* T_INLINE_HTML  */
+  YYSYMBOL_T_INSTANCEOF = 87,              /* T_INSTANCEOF  */
+  YYSYMBOL_T_INSTEADOF = 88,               /* T_INSTEADOF  */
+  YYSYMBOL_T_INT_CAST = 89,                /* T_INT_CAST  */
+  YYSYMBOL_T_INTERFACE = 90,               /* T_INTERFACE  */
+  YYSYMBOL_T_IS_EQUAL = 91,                /* T_IS_EQUAL  */
+  YYSYMBOL_T_IS_GREATER_OR_EQUAL = 92,     /* T_IS_GREATER_OR_EQUAL  */
+  YYSYMBOL_T_IS_IDENTICAL = 93,            /* T_IS_IDENTICAL  */
+  YYSYMBOL_T_IS_NOT_EQUAL = 94,            /* T_IS_NOT_EQUAL  */
+  YYSYMBOL_T_IS_NOT_IDENTICAL = 95,        /* T_IS_NOT_IDENTICAL  */
+  YYSYMBOL_T_ISSET = 96,                   /* T_ISSET  */
+  YYSYMBOL_T_IS_SMALLER_OR_EQUAL = 97,     /* T_IS_SMALLER_OR_EQUAL  */
+  YYSYMBOL_T_LINE = 98,                    /* T_LINE  */
+  YYSYMBOL_T_LIST = 99,                    /* T_LIST  */
+  YYSYMBOL_T_LNUMBER = 100,                /* T_LNUMBER  */
+  YYSYMBOL_T_LOGICAL_AND = 101,            /* T_LOGICAL_AND  */
+  YYSYMBOL_T_LOGICAL_OR = 102,             /* T_LOGICAL_OR  */
+  YYSYMBOL_T_LOGICAL_XOR = 103,            /* T_LOGICAL_XOR  */
+  YYSYMBOL_T_METHOD_C = 104,               /* T_METHOD_C  */
+  YYSYMBOL_T_MINUS_EQUAL = 105,            /* T_MINUS_EQUAL  */
+  YYSYMBOL_T_MOD_EQUAL = 106,              /* T_MOD_EQUAL  */
+  YYSYMBOL_T_MUL_EQUAL = 107,              /* T_MUL_EQUAL  */
+  YYSYMBOL_T_NAMESPACE = 108,              /* T_NAMESPACE  */
+  YYSYMBOL_T_NEW = 109,                    /* T_NEW  */
+  YYSYMBOL_T_NS_C = 110,                   /* T_NS_C  */
+  YYSYMBOL_T_NS_SEPARATOR = 111,           /* T_NS_SEPARATOR  */
+  YYSYMBOL_T_NUM_STRING = 112,             /* T_NUM_STRING  */
+  YYSYMBOL_T_OBJECT_CAST = 113,            /* T_OBJECT_CAST  */
+  YYSYMBOL_T_OBJECT_OPERATOR = 114,        /* T_OBJECT_OPERATOR  */
+  YYSYMBOL_T_OPEN_TAG = 115,               /* T_OPEN_TAG  */
+  YYSYMBOL_T_OPEN_TAG_WITH_ECHO = 116,     /* T_OPEN_TAG_WITH_ECHO  */
+  YYSYMBOL_T_OR_EQUAL = 117,               /* T_OR_EQUAL  */
+  YYSYMBOL_T_PAAMAYIM_NEKUDOTAYIM = 118,   /* T_PAAMAYIM_NEKUDOTAYIM  */
+  YYSYMBOL_T_PLUS_EQUAL = 119,             /* T_PLUS_EQUAL  */
+  YYSYMBOL_T_PRINT = 120,                  /* T_PRINT  */
+  YYSYMBOL_T_PRIVATE = 121,                /* T_PRIVATE  */
+  YYSYMBOL_T_PROTECTED = 122,              /* T_PROTECTED  */
+  YYSYMBOL_T_PUBLIC = 123,                 /* T_PUBLIC  */
+  YYSYMBOL_T_REQUIRE = 124,                /* T_REQUIRE  */
+  YYSYMBOL_T_REQUIRE_ONCE = 125,           /* T_REQUIRE_ONCE  */
+  YYSYMBOL_T_RETURN = 126,                 /* T_RETURN  */
+  YYSYMBOL_T_SL = 127,                     /* T_SL  */
+  YYSYMBOL_T_SL_EQUAL = 128,               /* T_SL_EQUAL  */
+  YYSYMBOL_T_SR = 129,                     /* T_SR  */
+  YYSYMBOL_T_SR_EQUAL = 130,               /* T_SR_EQUAL  */
+  YYSYMBOL_T_START_HEREDOC = 131,          /* T_START_HEREDOC  */
+  YYSYMBOL_T_STATIC = 132,                 /* T_STATIC  */
+  YYSYMBOL_T_STRING = 133,                 /* T_STRING  */
+  YYSYMBOL_T_STRING_CAST = 134,            /* T_STRING_CAST  */
+  YYSYMBOL_T_STRING_VARNAME = 135,         /* T_STRING_VARNAME  */
+  YYSYMBOL_T_SWITCH = 136,                 /* T_SWITCH  */
+  YYSYMBOL_T_THROW = 137,                  /* T_THROW  */
+  YYSYMBOL_T_TRAIT = 138,                  /* T_TRAIT  */
+  YYSYMBOL_T_TRAIT_C = 139,                /* T_TRAIT_C  */
+  YYSYMBOL_T_TRY = 140,                    /* T_TRY  */
+  YYSYMBOL_T_UNSET = 141,                  /* T_UNSET  */
+  YYSYMBOL_T_UNSET_CAST = 142,             /* T_UNSET_CAST  */
+  YYSYMBOL_T_USE = 143,                    /* T_USE  */
+  YYSYMBOL_T_VAR = 144,                    /* T_VAR  */
+  YYSYMBOL_T_VARIABLE = 145,               /* T_VARIABLE  */
+  YYSYMBOL_T_WHILE = 146,                  /* T_WHILE  */
+  YYSYMBOL_T_WHITESPACE = 147,             /* T_WHITESPACE  */
+  YYSYMBOL_T_XOR_EQUAL = 148,              /* T_XOR_EQUAL  */
+  YYSYMBOL_149_ = 149,                     /* '{'  */
+  YYSYMBOL_150_ = 150,                     /* '}'  */
+  YYSYMBOL_151_ = 151,                     /* '('  */
+  YYSYMBOL_152_ = 152,                     /* ')'  */
+  YYSYMBOL_153_ = 153,                     /* ';'  */
+  YYSYMBOL_154_ = 154,                     /* '`'  */
+  YYSYMBOL_155_ = 155,                     /* '$'  */
+  YYSYMBOL_156_ = 156,                     /* '"'  */
+  YYSYMBOL_157_ = 157,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 158,                 /* $accept  */
+  YYSYMBOL_start = 159,                    /* start  */
+  YYSYMBOL_top_statement_list = 160,       /* top_statement_list  */
+  YYSYMBOL_namespace_name = 161,           /* namespace_name  */
+  YYSYMBOL_top_statement = 162,            /* top_statement  */
+  YYSYMBOL_163_1 = 163,                    /* $@1  */
+  YYSYMBOL_164_2 = 164,                    /* $@2  */
+  YYSYMBOL_use_declarations = 165,         /* use_declarations  */
+  YYSYMBOL_use_declaration = 166,          /* use_declaration  */
+  YYSYMBOL_constant_declaration = 167,     /* constant_declaration  */
+  YYSYMBOL_inner_statement_list = 168,     /* inner_statement_list  */
+  YYSYMBOL_inner_statement = 169,          /* inner_statement  */
+  YYSYMBOL_statement = 170,                /* statement  */
+  YYSYMBOL_unticked_statement = 171,       /* unticked_statement  */
+  YYSYMBOL_additional_catches = 172,       /* additional_catches  */
+  YYSYMBOL_non_empty_additional_catches = 173, /* non_empty_additional_catches  */
+  YYSYMBOL_additional_catch = 174,         /* additional_catch  */
+  YYSYMBOL_unset_variables = 175,          /* unset_variables  */
+  YYSYMBOL_unset_variable = 176,           /* unset_variable  */
+  YYSYMBOL_function_declaration_statement = 177, /* function_declaration_statement  */
+  YYSYMBOL_class_declaration_statement = 178, /* class_declaration_statement  */
+  YYSYMBOL_is_reference = 179,             /* is_reference  */
+  YYSYMBOL_unticked_function_declaration_statement = 180, /* unticked_function_declaration_statement  */
+  YYSYMBOL_181_3 = 181,                    /* $@3  */
+  YYSYMBOL_unticked_class_declaration_statement = 182, /* unticked_class_declaration_statement  */
+  YYSYMBOL_183_4 = 183,                    /* $@4  */
+  YYSYMBOL_184_5 = 184,                    /* $@5  */
+  YYSYMBOL_class_entry_type = 185,         /* class_entry_type  */
+  YYSYMBOL_extends_from = 186,             /* extends_from  */
+  YYSYMBOL_interface_entry = 187,          /* interface_entry  */
+  YYSYMBOL_interface_extends_list = 188,   /* interface_extends_list  */
+  YYSYMBOL_implements_list = 189,          /* implements_list  */
+  YYSYMBOL_interface_list = 190,           /* interface_list  */
+  YYSYMBOL_foreach_optional_arg = 191,     /* foreach_optional_arg  */
+  YYSYMBOL_foreach_variable = 192,         /* foreach_variable  */
+  YYSYMBOL_for_statement = 193,            /* for_statement  */
+  YYSYMBOL_foreach_statement = 194,        /* foreach_statement  */
+  YYSYMBOL_declare_statement = 195,        /* declare_statement  */
+  YYSYMBOL_declare_list = 196,             /* declare_list  */
+  YYSYMBOL_switch_case_list = 197,         /* switch_case_list  */
+  YYSYMBOL_case_list = 198,                /* case_list  */
+  YYSYMBOL_case_separator = 199,           /* case_separator  */
+  YYSYMBOL_while_statement = 200,          /* while_statement  */
+  YYSYMBOL_elseif_list = 201,              /* elseif_list  */
+  YYSYMBOL_new_elseif_list = 202,          /* new_elseif_list  */
+  YYSYMBOL_else_single = 203,              /* else_single  */
+  YYSYMBOL_new_else_single = 204,          /* new_else_single  */
+  YYSYMBOL_parameter_list = 205,           /* parameter_list  */
+  YYSYMBOL_non_empty_parameter_list = 206, /* non_empty_parameter_list  */
+  YYSYMBOL_optional_class_type = 207,      /* optional_class_type  */
+  YYSYMBOL_function_call_parameter_list = 208, /* function_call_parameter_list  */
+  YYSYMBOL_non_empty_function_call_parameter_list = 209, /* non_empty_function_call_parameter_list  */
+  YYSYMBOL_global_var_list = 210,          /* global_var_list  */
+  YYSYMBOL_global_var = 211,               /* global_var  */
+  YYSYMBOL_static_var_list = 212,          /* static_var_list  */
+  YYSYMBOL_class_statement_list = 213,     /* class_statement_list  */
+  YYSYMBOL_class_statement = 214,          /* class_statement  */
+  YYSYMBOL_215_6 = 215,                    /* $@6  */
+  YYSYMBOL_trait_use_statement = 216,      /* trait_use_statement  */
+  YYSYMBOL_trait_list = 217,               /* trait_list  */
+  YYSYMBOL_trait_adaptations = 218,        /* trait_adaptations  */
+  YYSYMBOL_trait_adaptation_list = 219,    /* trait_adaptation_list  */
+  YYSYMBOL_non_empty_trait_adaptation_list = 220, /* non_empty_trait_adaptation_list  */
+  YYSYMBOL_trait_adaptation_statement = 221, /* trait_adaptation_statement  */
+  YYSYMBOL_trait_precedence = 222,         /* trait_precedence  */
+  YYSYMBOL_trait_reference_list = 223,     /* trait_reference_list  */
+  YYSYMBOL_trait_method_reference = 224,   /* trait_method_reference  */
+  YYSYMBOL_trait_method_reference_fully_qualified = 225, /* trait_method_reference_fully_qualified  */
+  YYSYMBOL_trait_alias = 226,              /* trait_alias  */
+  YYSYMBOL_trait_modifiers = 227,          /* trait_modifiers  */
+  YYSYMBOL_method_body = 228,              /* method_body  */
+  YYSYMBOL_variable_modifiers = 229,       /* variable_modifiers  */
+  YYSYMBOL_method_modifiers = 230,         /* method_modifiers  */
+  YYSYMBOL_non_empty_member_modifiers = 231, /* non_empty_member_modifiers  */
+  YYSYMBOL_member_modifier = 232,          /* member_modifier  */
+  YYSYMBOL_class_variable_declaration = 233, /* class_variable_declaration  */
+  YYSYMBOL_class_constant_declaration = 234, /* class_constant_declaration  */
+  YYSYMBOL_echo_expr_list = 235,           /* echo_expr_list  */
+  YYSYMBOL_for_expr = 236,                 /* for_expr  */
+  YYSYMBOL_non_empty_for_expr = 237,       /* non_empty_for_expr  */
+  YYSYMBOL_chaining_method_or_property = 238, /* chaining_method_or_property  */
+  YYSYMBOL_chaining_dereference = 239,     /* chaining_dereference  */
+  YYSYMBOL_chaining_instance_call = 240,   /* chaining_instance_call  */
+  YYSYMBOL_instance_call = 241,            /* instance_call  */
+  YYSYMBOL_new_expr = 242,                 /* new_expr  */
+  YYSYMBOL_expr_without_variable = 243,    /* expr_without_variable  */
+  YYSYMBOL_244_7 = 244,                    /* $@7  */
+  YYSYMBOL_245_8 = 245,                    /* $@8  */
+  YYSYMBOL_function = 246,                 /* function  */
+  YYSYMBOL_lexical_vars = 247,             /* lexical_vars  */
+  YYSYMBOL_lexical_var_list = 248,         /* lexical_var_list  */
+  YYSYMBOL_function_call = 249,            /* function_call  */
+  YYSYMBOL_class_name = 250,               /* class_name  */
+  YYSYMBOL_fully_qualified_class_name = 251, /* fully_qualified_class_name  */
+  YYSYMBOL_class_name_reference = 252,     /* class_name_reference  */
+  YYSYMBOL_dynamic_class_name_reference = 253, /* dynamic_class_name_reference  */
+  YYSYMBOL_dynamic_class_name_variable_properties = 254, /* dynamic_class_name_variable_properties  */
+  YYSYMBOL_dynamic_class_name_variable_property = 255, /* dynamic_class_name_variable_property  */
+  YYSYMBOL_exit_expr = 256,                /* exit_expr  */
+  YYSYMBOL_backticks_expr = 257,           /* backticks_expr  */
+  YYSYMBOL_ctor_arguments = 258,           /* ctor_arguments  */
+  YYSYMBOL_common_scalar = 259,            /* common_scalar  */
+  YYSYMBOL_static_scalar = 260,            /* static_scalar  */
+  YYSYMBOL_static_class_constant = 261,    /* static_class_constant  */
+  YYSYMBOL_scalar = 262,                   /* scalar  */
+  YYSYMBOL_static_array_pair_list = 263,   /* static_array_pair_list  */
+  YYSYMBOL_possible_comma = 264,           /* possible_comma  */
+  YYSYMBOL_non_empty_static_array_pair_list = 265, /* non_empty_static_array_pair_list  */
+  YYSYMBOL_expr = 266,                     /* expr  */
+  YYSYMBOL_r_variable = 267,               /* r_variable  */
+  YYSYMBOL_w_variable = 268,               /* w_variable  */
+  YYSYMBOL_rw_variable = 269,              /* rw_variable  */
+  YYSYMBOL_variable = 270,                 /* variable  */
+  YYSYMBOL_variable_properties = 271,      /* variable_properties  */
+  YYSYMBOL_variable_property = 272,        /* variable_property  */
+  YYSYMBOL_array_method_dereference = 273, /* array_method_dereference  */
+  YYSYMBOL_method = 274,                   /* method  */
+  YYSYMBOL_method_or_not = 275,            /* method_or_not  */
+  YYSYMBOL_variable_without_objects = 276, /* variable_without_objects  */
+  YYSYMBOL_static_member = 277,            /* static_member  */
+  YYSYMBOL_variable_class_name = 278,      /* variable_class_name  */
+  YYSYMBOL_array_function_dereference = 279, /* array_function_dereference  */
+  YYSYMBOL_base_variable_with_function_calls = 280, /* base_variable_with_function_calls  */
+  YYSYMBOL_base_variable = 281,            /* base_variable  */
+  YYSYMBOL_reference_variable = 282,       /* reference_variable  */
+  YYSYMBOL_compound_variable = 283,        /* compound_variable  */
+  YYSYMBOL_dim_offset = 284,               /* dim_offset  */
+  YYSYMBOL_object_property = 285,          /* object_property  */
+  YYSYMBOL_object_dim_list = 286,          /* object_dim_list  */
+  YYSYMBOL_variable_name = 287,            /* variable_name  */
+  YYSYMBOL_simple_indirect_reference = 288, /* simple_indirect_reference  */
+  YYSYMBOL_assignment_list = 289,          /* assignment_list  */
+  YYSYMBOL_assignment_list_element = 290,  /* assignment_list_element  */
+  YYSYMBOL_array_pair_list = 291,          /* array_pair_list  */
+  YYSYMBOL_non_empty_array_pair_list = 292, /* non_empty_array_pair_list  */
+  YYSYMBOL_encaps_list = 293,              /* encaps_list  */
+  YYSYMBOL_encaps_var = 294,               /* encaps_var  */
+  YYSYMBOL_encaps_var_offset = 295,        /* encaps_var_offset  */
+  YYSYMBOL_internal_functions_in_yacc = 296, /* internal_functions_in_yacc  */
+  YYSYMBOL_isset_variables = 297,          /* isset_variables  */
+  YYSYMBOL_class_constant = 298            /* class_constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 343 of yacc.c  */
-#line 271 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.cpp"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -305,85 +702,112 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -399,7 +823,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -407,40 +831,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined PHP54STYPE_IS_TRIVIAL && PHP54STYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -450,35 +871,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -486,40 +907,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   7844
+#define YYLAST   9161
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  158
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  141
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  451
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  918
+#define YYNRULES  453
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  922
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   629
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    48,   156,     2,   155,    47,    31,     2,
-     151,   152,    45,    42,     8,    43,    44,    46,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    26,   153,
-      36,    13,    37,    25,    60,     2,     2,     2,     2,     2,
+       2,     2,     2,    18,   156,     2,   155,    17,     9,     2,
+     151,   152,    15,    12,     3,    13,    14,    16,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     6,   153,
+      10,     4,    11,     5,    20,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    61,     2,   157,    30,     2,   154,     2,     2,     2,
+       2,    21,     2,   157,     8,     2,   154,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   149,    29,   150,    50,     2,     2,     2,
+       2,     2,     2,   149,     7,   150,    19,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -557,322 +983,118 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    71,    18,    73,    54,    74,    75,    52,    28,
-      27,    76,    77,    78,    79,    80,    81,    82,    62,    83,
-      84,    20,    85,    86,    87,    88,    58,    89,    90,    91,
-      21,    92,    93,    94,    95,    96,    56,    97,    65,    64,
-      98,    99,   100,   101,   102,   103,    66,   104,   105,     5,
-     106,   107,   108,    70,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,    59,     7,     6,   118,    49,   119,    57,
-     120,    35,    38,    33,    34,    32,   121,    39,   122,   123,
-     124,    11,     9,    10,   125,    23,    19,    22,   126,    63,
-     127,   128,   129,    53,   130,   131,   132,    17,   133,    24,
-      12,    69,    68,    67,     4,     3,   134,    41,    15,    40,
-      14,   135,    72,   136,    55,   137,   138,   139,   140,   141,
-     142,   143,    51,   144,   145,   146,   147,   148,    16,     2
+       2,     2,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,     2
 };
 
-#if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+#if PHP54DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,     9,    11,    15,    17,    19,
-      21,    26,    30,    31,    38,    39,    45,    49,    52,    56,
-      58,    60,    64,    67,    72,    78,    83,    86,    87,    89,
-      91,    93,    98,   100,   103,   107,   115,   126,   132,   140,
-     150,   156,   159,   163,   166,   170,   173,   177,   181,   185,
-     189,   193,   195,   198,   204,   213,   222,   228,   230,   244,
-     248,   252,   254,   255,   257,   260,   269,   271,   275,   277,
-     279,   281,   282,   284,   285,   296,   297,   306,   307,   315,
-     317,   320,   322,   325,   326,   329,   331,   332,   335,   336,
-     339,   341,   345,   346,   349,   351,   354,   356,   361,   363,
-     368,   370,   375,   379,   385,   389,   394,   399,   405,   406,
-     412,   417,   419,   421,   423,   428,   429,   436,   437,   445,
-     446,   449,   450,   454,   456,   457,   460,   464,   470,   475,
-     480,   486,   494,   501,   502,   504,   506,   508,   510,   511,
-     513,   515,   518,   522,   526,   531,   535,   537,   539,   542,
-     547,   551,   557,   559,   563,   566,   567,   571,   574,   576,
-     577,   587,   591,   593,   597,   599,   603,   604,   606,   608,
-     611,   614,   617,   621,   623,   627,   629,   631,   635,   640,
-     644,   645,   647,   649,   653,   655,   657,   658,   660,   662,
-     665,   667,   669,   671,   673,   675,   677,   681,   687,   689,
-     693,   699,   704,   708,   710,   711,   713,   717,   719,   722,
-     724,   729,   733,   736,   738,   740,   741,   743,   747,   754,
-     758,   763,   770,   773,   777,   781,   785,   789,   793,   797,
-     801,   805,   809,   813,   817,   820,   823,   826,   829,   833,
-     837,   841,   845,   849,   853,   857,   861,   865,   869,   873,
-     877,   881,   885,   889,   893,   896,   899,   902,   905,   909,
-     913,   917,   921,   925,   929,   933,   937,   941,   945,   947,
-     952,   958,   963,   965,   968,   971,   974,   977,   980,   983,
-     986,   989,   992,   994,   999,  1003,  1007,  1010,  1011,  1022,
-    1023,  1035,  1037,  1038,  1043,  1047,  1052,  1054,  1057,  1062,
-    1069,  1075,  1082,  1089,  1096,  1103,  1108,  1110,  1112,  1116,
-    1119,  1121,  1125,  1128,  1130,  1132,  1137,  1139,  1142,  1143,
-    1146,  1147,  1150,  1154,  1155,  1157,  1159,  1160,  1164,  1166,
-    1168,  1170,  1172,  1174,  1176,  1178,  1180,  1182,  1184,  1188,
-    1191,  1193,  1195,  1199,  1202,  1205,  1208,  1213,  1217,  1219,
-    1221,  1225,  1227,  1229,  1231,  1235,  1238,  1240,  1244,  1248,
-    1250,  1251,  1254,  1255,  1257,  1263,  1267,  1271,  1273,  1275,
-    1277,  1279,  1281,  1283,  1289,  1291,  1294,  1295,  1299,  1304,
-    1309,  1313,  1315,  1317,  1318,  1320,  1323,  1327,  1331,  1333,
-    1338,  1343,  1345,  1347,  1349,  1351,  1354,  1356,  1361,  1366,
-    1368,  1370,  1375,  1376,  1378,  1380,  1382,  1387,  1392,  1394,
-    1396,  1400,  1402,  1405,  1409,  1411,  1413,  1418,  1419,  1420,
-    1423,  1429,  1433,  1437,  1439,  1446,  1451,  1456,  1459,  1462,
-    1465,  1467,  1470,  1472,  1477,  1481,  1485,  1492,  1496,  1498,
-    1500,  1502,  1507,  1512,  1515,  1518,  1523,  1526,  1529,  1531,
-    1535,  1539
+       0,   338,   338,   342,   343,   347,   348,   352,   353,   354,
+     355,   356,   357,   357,   359,   359,   361,   362,   366,   368,
+     372,   373,   374,   375,   379,   380,   384,   385,   389,   390,
+     391,   392,   396,   397,   398,   402,   403,   407,   411,   414,
+     415,   427,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   450,   457,   458,   459,
+     469,   470,   474,   475,   479,   480,   484,   493,   494,   498,
+     502,   506,   510,   511,   516,   515,   524,   523,   541,   540,
+     549,   550,   551,   552,   556,   557,   562,   566,   567,   572,
+     573,   578,   579,   583,   584,   588,   589,   593,   594,   598,
+     599,   603,   604,   608,   609,   613,   614,   615,   616,   620,
+     621,   625,   631,   632,   636,   637,   641,   642,   649,   650,
+     657,   658,   662,   663,   667,   668,   673,   674,   675,   676,
+     677,   678,   679,   680,   684,   685,   686,   687,   691,   692,
+     696,   697,   698,   699,   700,   701,   705,   706,   710,   711,
+     712,   716,   717,   718,   719,   723,   724,   728,   729,   730,
+     732,   731,   736,   740,   745,   746,   751,   752,   758,   759,
+     763,   764,   768,   769,   773,   778,   779,   783,   784,   788,
+     792,   793,   797,   798,   802,   803,   807,   808,   812,   813,
+     817,   818,   822,   823,   824,   825,   826,   827,   831,   832,
+     833,   834,   838,   840,   844,   845,   849,   850,   854,   855,
+     859,   860,   864,   865,   869,   870,   871,   875,   876,   880,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,   899,   900,   901,   902,   903,
+     904,   905,   906,   907,   908,   909,   910,   911,   912,   913,
+     914,   915,   916,   917,   918,   919,   920,   921,   922,   923,
+     924,   925,   926,   927,   928,   929,   930,   931,   932,   933,
+     934,   935,   936,   939,   941,   942,   943,   944,   945,   946,
+     947,   948,   949,   950,   951,   952,   953,   954,   955,   958,
+     956,   966,   965,   976,   980,   981,   985,   989,   993,   994,
+     998,  1000,  1003,  1005,  1007,  1009,  1011,  1013,  1018,  1019,
+    1020,  1021,  1025,  1026,  1027,  1031,  1032,  1036,  1038,  1042,
+    1043,  1047,  1051,  1052,  1053,  1057,  1058,  1059,  1063,  1064,
+    1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,
+    1078,  1079,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,
+    1091,  1092,  1096,  1100,  1101,  1102,  1103,  1104,  1105,  1106,
+    1107,  1108,  1112,  1113,  1117,  1118,  1122,  1123,  1124,  1125,
+    1129,  1130,  1134,  1138,  1142,  1146,  1150,  1154,  1155,  1159,
+    1164,  1165,  1169,  1173,  1174,  1175,  1179,  1180,  1184,  1185,
+    1189,  1193,  1194,  1198,  1199,  1200,  1204,  1205,  1206,  1210,
+    1211,  1212,  1216,  1217,  1221,  1222,  1226,  1227,  1231,  1232,
+    1233,  1237,  1238,  1242,  1243,  1247,  1248,  1252,  1253,  1254,
+    1258,  1259,  1263,  1267,  1271,  1272,  1273,  1277,  1281,  1282,
+    1286,  1287,  1288,  1289,  1293,  1294,  1295,  1296,  1297,  1298,
+    1302,  1303,  1304,  1308,  1309,  1310,  1311,  1312,  1313,  1314,
+    1318,  1319,  1323,  1324
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     159,     0,    -1,   160,    -1,   160,   162,    -1,    -1,   136,
-      -1,   161,   128,   136,    -1,   170,    -1,   177,    -1,   178,
-      -1,   115,   151,   152,   153,    -1,   126,   161,   153,    -1,
-      -1,   126,   161,   149,   163,   160,   150,    -1,    -1,   126,
-     149,   164,   160,   150,    -1,   144,   165,   153,    -1,   167,
-     153,    -1,   165,     8,   166,    -1,   166,    -1,   161,    -1,
-     161,    74,   136,    -1,   128,   161,    -1,   128,   161,    74,
-     136,    -1,   167,     8,   136,    13,   260,    -1,    85,   136,
-      13,   260,    -1,   168,   169,    -1,    -1,   170,    -1,   177,
-      -1,   178,    -1,   115,   151,   152,   153,    -1,   171,    -1,
-     136,    26,    -1,   149,   168,   150,    -1,   116,   151,   266,
-     152,   170,   201,   203,    -1,   116,   151,   266,   152,    26,
-     168,   202,   204,    66,   153,    -1,   147,   151,   266,   152,
-     200,    -1,    93,   170,   147,   151,   266,   152,   153,    -1,
-     109,   151,   236,   153,   236,   153,   236,   152,   193,    -1,
-     138,   151,   266,   152,   197,    -1,    76,   153,    -1,    76,
-     266,   153,    -1,    87,   153,    -1,    87,   266,   153,    -1,
-     134,   153,    -1,   134,   243,   153,    -1,   134,   270,   153,
-      -1,   113,   210,   153,    -1,    72,   212,   153,    -1,    97,
-     235,   153,    -1,   118,    -1,   266,   153,    -1,   143,   151,
-     175,   152,   153,    -1,   110,   151,   270,    74,   192,   191,
-     152,   194,    -1,   110,   151,   243,    74,   270,   191,   152,
-     194,    -1,    89,   151,   196,   152,   195,    -1,   153,    -1,
-     142,   149,   168,   150,    79,   151,   251,   146,   152,   149,
-     168,   150,   172,    -1,   139,   266,   153,    -1,   114,   136,
-     153,    -1,   173,    -1,    -1,   174,    -1,   173,   174,    -1,
-      79,   151,   251,   146,   152,   149,   168,   150,    -1,   176,
-      -1,   175,     8,   176,    -1,   270,    -1,   180,    -1,   182,
-      -1,    -1,    31,    -1,    -1,   246,   179,   136,   151,   205,
-     152,   181,   149,   168,   150,    -1,    -1,   185,   136,   186,
-     189,   183,   149,   213,   150,    -1,    -1,   187,   136,   188,
-     184,   149,   213,   150,    -1,    81,    -1,    71,    81,    -1,
-     140,    -1,    70,    81,    -1,    -1,   107,   251,    -1,   120,
-      -1,    -1,   107,   190,    -1,    -1,   117,   190,    -1,   251,
-      -1,   190,     8,   251,    -1,    -1,    96,   192,    -1,   270,
-      -1,    31,   270,    -1,   170,    -1,    26,   168,   101,   153,
-      -1,   170,    -1,    26,   168,   102,   153,    -1,   170,    -1,
-      26,   168,   100,   153,    -1,   136,    13,   260,    -1,   196,
-       8,   136,    13,   260,    -1,   149,   198,   150,    -1,   149,
-     153,   198,   150,    -1,    26,   198,   104,   153,    -1,    26,
-     153,   198,   104,   153,    -1,    -1,   198,    78,   266,   199,
-     168,    -1,   198,    90,   199,   168,    -1,    26,    -1,   153,
-      -1,   170,    -1,    26,   168,   105,   153,    -1,    -1,   201,
-      64,   151,   266,   152,   170,    -1,    -1,   202,    64,   151,
-     266,   152,    26,   168,    -1,    -1,    65,   170,    -1,    -1,
-      65,    26,   168,    -1,   206,    -1,    -1,   207,   146,    -1,
-     207,    31,   146,    -1,   207,    31,   146,    13,   260,    -1,
-     207,   146,    13,   260,    -1,   206,     8,   207,   146,    -1,
-     206,     8,   207,    31,   146,    -1,   206,     8,   207,    31,
-     146,    13,   260,    -1,   206,     8,   207,   146,    13,   260,
-      -1,    -1,    73,    -1,    77,    -1,   251,    -1,   209,    -1,
-      -1,   243,    -1,   270,    -1,    31,   268,    -1,   209,     8,
-     243,    -1,   209,     8,   270,    -1,   209,     8,    31,   268,
-      -1,   210,     8,   211,    -1,   211,    -1,   146,    -1,   155,
-     267,    -1,   155,   149,   266,   150,    -1,   212,     8,   146,
-      -1,   212,     8,   146,    13,   260,    -1,   146,    -1,   146,
-      13,   260,    -1,   213,   214,    -1,    -1,   229,   233,   153,
-      -1,   234,   153,    -1,   216,    -1,    -1,   230,   246,   179,
-     136,   151,   205,   152,   215,   228,    -1,   144,   217,   218,
-      -1,   251,    -1,   217,     8,   251,    -1,   153,    -1,   149,
-     219,   150,    -1,    -1,   220,    -1,   221,    -1,   220,   221,
-      -1,   222,   153,    -1,   226,   153,    -1,   225,   119,   223,
-      -1,   251,    -1,   223,     8,   251,    -1,   136,    -1,   225,
-      -1,   251,   133,   136,    -1,   224,    74,   227,   136,    -1,
-     224,    74,   232,    -1,    -1,   232,    -1,   153,    -1,   149,
-     168,   150,    -1,   231,    -1,   145,    -1,    -1,   231,    -1,
-     232,    -1,   231,   232,    -1,    67,    -1,    68,    -1,    69,
-      -1,    72,    -1,    71,    -1,    70,    -1,   233,     8,   146,
-      -1,   233,     8,   146,    13,   260,    -1,   146,    -1,   146,
-      13,   260,    -1,   234,     8,   136,    13,   260,    -1,    85,
-     136,    13,   260,    -1,   235,     8,   266,    -1,   266,    -1,
-      -1,   237,    -1,   237,     8,   266,    -1,   266,    -1,   238,
-     272,    -1,   272,    -1,   239,    61,   284,   157,    -1,    61,
-     284,   157,    -1,   239,   238,    -1,   239,    -1,   238,    -1,
-      -1,   240,    -1,    63,   252,   258,    -1,   123,   151,   289,
-     152,    13,   266,    -1,   270,    13,   266,    -1,   270,    13,
-      31,   270,    -1,   270,    13,    31,    63,   252,   258,    -1,
-      62,   266,    -1,   270,    24,   266,    -1,   270,    23,   266,
-      -1,   270,    22,   266,    -1,   270,    21,   266,    -1,   270,
-      20,   266,    -1,   270,    19,   266,    -1,   270,    18,   266,
-      -1,   270,    17,   266,    -1,   270,    16,   266,    -1,   270,
-      15,   266,    -1,   270,    14,   266,    -1,   269,    59,    -1,
-      59,   269,    -1,   269,    58,    -1,    58,   269,    -1,   266,
-      27,   266,    -1,   266,    28,   266,    -1,   266,     9,   266,
-      -1,   266,    11,   266,    -1,   266,    10,   266,    -1,   266,
-      29,   266,    -1,   266,    31,   266,    -1,   266,    30,   266,
-      -1,   266,    44,   266,    -1,   266,    42,   266,    -1,   266,
-      43,   266,    -1,   266,    45,   266,    -1,   266,    46,   266,
-      -1,   266,    47,   266,    -1,   266,    41,   266,    -1,   266,
-      40,   266,    -1,    42,   266,    -1,    43,   266,    -1,    48,
-     266,    -1,    50,   266,    -1,   266,    33,   266,    -1,   266,
-      32,   266,    -1,   266,    35,   266,    -1,   266,    34,   266,
-      -1,   266,    36,   266,    -1,   266,    39,   266,    -1,   266,
-      37,   266,    -1,   266,    38,   266,    -1,   266,    49,   252,
-      -1,   151,   266,   152,    -1,   242,    -1,   151,   242,   152,
-     241,    -1,   266,    25,   266,    26,   266,    -1,   266,    25,
-      26,   266,    -1,   296,    -1,    57,   266,    -1,    56,   266,
-      -1,    55,   266,    -1,    54,   266,    -1,    53,   266,    -1,
-      52,   266,    -1,    51,   266,    -1,   106,   256,    -1,    60,
-     266,    -1,   262,    -1,    73,   151,   291,   152,    -1,    61,
-     291,   157,    -1,   154,   257,   154,    -1,    12,   266,    -1,
-      -1,   246,   179,   151,   205,   152,   247,   149,   244,   168,
-     150,    -1,    -1,    72,   246,   179,   151,   205,   152,   247,
-     149,   245,   168,   150,    -1,   112,    -1,    -1,   144,   151,
-     248,   152,    -1,   248,     8,   146,    -1,   248,     8,    31,
-     146,    -1,   146,    -1,    31,   146,    -1,   161,   151,   208,
-     152,    -1,   126,   128,   161,   151,   208,   152,    -1,   128,
-     161,   151,   208,   152,    -1,   250,   133,   287,   151,   208,
-     152,    -1,   250,   133,   276,   151,   208,   152,    -1,   278,
-     133,   287,   151,   208,   152,    -1,   278,   133,   276,   151,
-     208,   152,    -1,   276,   151,   208,   152,    -1,    72,    -1,
-     161,    -1,   126,   128,   161,    -1,   128,   161,    -1,   161,
-      -1,   126,   128,   161,    -1,   128,   161,    -1,   250,    -1,
-     253,    -1,   281,   130,   285,   254,    -1,   281,    -1,   254,
-     255,    -1,    -1,   130,   285,    -1,    -1,   151,   152,    -1,
-     151,   266,   152,    -1,    -1,    99,    -1,   293,    -1,    -1,
-     151,   208,   152,    -1,   124,    -1,    92,    -1,    86,    -1,
-     122,    -1,   108,    -1,    91,    -1,   141,    -1,   125,    -1,
-     111,    -1,   127,    -1,   135,    99,   103,    -1,   135,   103,
-      -1,   259,    -1,   161,    -1,   126,   128,   161,    -1,   128,
-     161,    -1,    42,   260,    -1,    43,   260,    -1,    73,   151,
-     263,   152,    -1,    61,   263,   157,    -1,   261,    -1,    82,
-      -1,   250,   133,   136,    -1,   137,    -1,   298,    -1,   161,
-      -1,   126,   128,   161,    -1,   128,   161,    -1,   259,    -1,
-     156,   293,   156,    -1,   135,   293,   103,    -1,    82,    -1,
-      -1,   265,   264,    -1,    -1,     8,    -1,   265,     8,   260,
-      96,   260,    -1,   265,     8,   260,    -1,   260,    96,   260,
-      -1,   260,    -1,   267,    -1,   243,    -1,   270,    -1,   270,
-      -1,   270,    -1,   280,   130,   285,   275,   271,    -1,   280,
-      -1,   271,   272,    -1,    -1,   130,   285,   275,    -1,   273,
-      61,   284,   157,    -1,   274,    61,   284,   157,    -1,   151,
-     208,   152,    -1,   274,    -1,   273,    -1,    -1,   282,    -1,
-     288,   282,    -1,   250,   133,   276,    -1,   278,   133,   276,
-      -1,   282,    -1,   279,    61,   284,   157,    -1,   249,    61,
-     284,   157,    -1,   281,    -1,   279,    -1,   249,    -1,   282,
-      -1,   288,   282,    -1,   277,    -1,   282,    61,   284,   157,
-      -1,   282,   149,   266,   150,    -1,   283,    -1,   146,    -1,
-     155,   149,   266,   150,    -1,    -1,   266,    -1,   286,    -1,
-     276,    -1,   286,    61,   284,   157,    -1,   286,   149,   266,
-     150,    -1,   287,    -1,   136,    -1,   149,   266,   150,    -1,
-     155,    -1,   288,   155,    -1,   289,     8,   290,    -1,   290,
-      -1,   270,    -1,   123,   151,   289,   152,    -1,    -1,    -1,
-     292,   264,    -1,   292,     8,   266,    96,   266,    -1,   292,
-       8,   266,    -1,   266,    96,   266,    -1,   266,    -1,   292,
-       8,   266,    96,    31,   268,    -1,   292,     8,    31,   268,
-      -1,   266,    96,    31,   268,    -1,    31,   268,    -1,   293,
-     294,    -1,   293,    99,    -1,   294,    -1,    99,   294,    -1,
-     146,    -1,   146,    61,   295,   157,    -1,   146,   130,   136,
-      -1,    95,   266,   150,    -1,    95,   137,    61,   266,   157,
-     150,    -1,    88,   270,   150,    -1,   136,    -1,   129,    -1,
-     146,    -1,   121,   151,   297,   152,    -1,    98,   151,   270,
-     152,    -1,     7,   266,    -1,     6,   266,    -1,     5,   151,
-     266,   152,    -1,     4,   266,    -1,     3,   266,    -1,   270,
-      -1,   297,     8,   270,    -1,   250,   133,   136,    -1,   278,
-     133,   136,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   337,   337,   341,   342,   346,   347,   351,   352,   353,
-     354,   355,   356,   356,   358,   358,   360,   361,   365,   367,
-     371,   372,   373,   374,   378,   379,   383,   384,   388,   389,
-     390,   391,   395,   396,   400,   401,   405,   409,   412,   413,
-     425,   428,   429,   430,   431,   432,   433,   434,   435,   436,
-     437,   438,   439,   440,   441,   448,   455,   456,   457,   467,
-     468,   472,   473,   477,   478,   482,   491,   492,   496,   500,
-     504,   508,   509,   514,   513,   522,   521,   539,   538,   547,
-     548,   549,   550,   554,   555,   560,   564,   565,   570,   571,
-     576,   577,   581,   582,   586,   587,   591,   592,   596,   597,
-     601,   602,   606,   607,   611,   612,   613,   614,   618,   619,
-     623,   629,   630,   634,   635,   639,   640,   647,   648,   655,
-     656,   660,   661,   665,   666,   671,   672,   673,   674,   675,
-     676,   677,   678,   682,   683,   684,   685,   689,   690,   694,
-     695,   696,   697,   698,   699,   703,   704,   708,   709,   710,
-     714,   715,   716,   717,   721,   722,   726,   727,   728,   730,
-     729,   737,   742,   743,   748,   749,   755,   756,   760,   761,
-     765,   766,   770,   775,   776,   780,   781,   785,   789,   790,
-     794,   795,   799,   800,   804,   805,   809,   810,   814,   815,
-     819,   820,   821,   822,   823,   824,   828,   829,   830,   831,
-     835,   837,   841,   842,   846,   847,   851,   852,   856,   857,
-     861,   862,   866,   867,   868,   872,   873,   877,   881,   882,
-     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
-     893,   894,   895,   896,   897,   898,   899,   900,   901,   902,
-     903,   904,   905,   906,   907,   908,   909,   910,   911,   912,
-     913,   914,   915,   916,   917,   918,   919,   920,   921,   922,
-     923,   924,   925,   926,   927,   928,   929,   930,   931,   932,
-     933,   936,   938,   939,   940,   941,   942,   943,   944,   945,
-     946,   947,   948,   949,   950,   951,   952,   955,   953,   963,
-     962,   973,   977,   978,   982,   986,   990,   991,   995,   997,
-    1000,  1002,  1004,  1006,  1008,  1010,  1015,  1016,  1017,  1018,
-    1022,  1023,  1024,  1028,  1029,  1033,  1035,  1039,  1040,  1044,
-    1048,  1049,  1050,  1054,  1055,  1056,  1060,  1061,  1065,  1066,
-    1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,
-    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
-    1093,  1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,  1105,
-    1109,  1110,  1114,  1115,  1119,  1120,  1121,  1122,  1126,  1127,
-    1131,  1135,  1139,  1143,  1147,  1151,  1152,  1156,  1161,  1162,
-    1166,  1170,  1171,  1172,  1176,  1177,  1181,  1182,  1186,  1190,
-    1191,  1195,  1196,  1197,  1201,  1202,  1203,  1207,  1208,  1209,
-    1213,  1214,  1218,  1219,  1223,  1224,  1228,  1229,  1230,  1234,
-    1235,  1239,  1240,  1244,  1245,  1249,  1250,  1251,  1255,  1256,
-    1260,  1264,  1268,  1269,  1270,  1274,  1278,  1279,  1283,  1284,
-    1285,  1286,  1290,  1291,  1292,  1293,  1294,  1295,  1299,  1300,
-    1301,  1305,  1306,  1307,  1308,  1309,  1310,  1311,  1315,  1316,
-    1320,  1321
-};
-#endif
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "T_END", "error", "$undefined", "T_REQUIRE_ONCE", "T_REQUIRE", "T_EVAL",
-  "T_INCLUDE_ONCE", "T_INCLUDE", "','", "T_LOGICAL_OR", "T_LOGICAL_XOR",
-  "T_LOGICAL_AND", "T_PRINT", "'='", "T_SR_EQUAL", "T_SL_EQUAL",
-  "T_XOR_EQUAL", "T_OR_EQUAL", "T_AND_EQUAL", "T_MOD_EQUAL",
-  "T_CONCAT_EQUAL", "T_DIV_EQUAL", "T_MUL_EQUAL", "T_MINUS_EQUAL",
-  "T_PLUS_EQUAL", "'?'", "':'", "T_BOOLEAN_OR", "T_BOOLEAN_AND", "'|'",
-  "'^'", "'&'", "T_IS_NOT_IDENTICAL", "T_IS_IDENTICAL", "T_IS_NOT_EQUAL",
-  "T_IS_EQUAL", "'<'", "'>'", "T_IS_GREATER_OR_EQUAL",
-  "T_IS_SMALLER_OR_EQUAL", "T_SR", "T_SL", "'+'", "'-'", "'.'", "'*'",
-  "'/'", "'%'", "'!'", "T_INSTANCEOF", "'~'", "T_UNSET_CAST",
-  "T_BOOL_CAST", "T_OBJECT_CAST", "T_ARRAY_CAST", "T_STRING_CAST",
-  "T_DOUBLE_CAST", "T_INT_CAST", "T_DEC", "T_INC", "'@'", "'['", "T_CLONE",
-  "T_NEW", "T_ELSEIF", "T_ELSE", "T_ENDIF", "T_PUBLIC", "T_PROTECTED",
-  "T_PRIVATE", "T_FINAL", "T_ABSTRACT", "T_STATIC", "T_ARRAY", "T_AS",
-  "T_BAD_CHARACTER", "T_BREAK", "T_CALLABLE", "T_CASE", "T_CATCH",
-  "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLOSE_TAG", "T_COMMENT",
-  "T_CONST", "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN",
-  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
-  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_ECHO", "T_EMPTY",
+  "T_END", "error", "\"invalid token\"", "','", "'='", "'?'", "':'",
+  "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'.'", "'*'", "'/'",
+  "'%'", "'!'", "'~'", "'@'", "'['", "T_ABSTRACT", "T_AND_EQUAL",
+  "T_ARRAY", "T_ARRAY_CAST", "T_AS", "T_BAD_CHARACTER", "T_BOOL_CAST",
+  "T_BOOLEAN_AND", "T_BOOLEAN_OR", "T_BREAK", "T_CALLABLE", "T_CASE",
+  "T_CATCH", "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLONE",
+  "T_CLOSE_TAG", "T_COMMENT", "T_CONCAT_EQUAL", "T_CONST",
+  "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN", "T_DEC",
+  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DIV_EQUAL", "T_DNUMBER", "T_DO",
+  "T_DOC_COMMENT", "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW",
+  "T_DOUBLE_CAST", "T_ECHO", "T_ELSE", "T_ELSEIF", "T_EMPTY",
   "T_ENCAPSED_AND_WHITESPACE", "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH",
-  "T_END_HEREDOC", "T_ENDSWITCH", "T_ENDWHILE", "T_EXIT", "T_EXTENDS",
-  "T_FILE", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
-  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INLINE_HTML",
-  "T_INSTEADOF", "T_INTERFACE", "T_ISSET", "T_LINE", "T_LIST", "T_LNUMBER",
-  "T_METHOD_C", "T_NAMESPACE", "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING",
-  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO",
-  "T_PAAMAYIM_NEKUDOTAYIM", "T_RETURN", "T_START_HEREDOC", "T_STRING",
-  "T_STRING_VARNAME", "T_SWITCH", "T_THROW", "T_TRAIT", "T_TRAIT_C",
-  "T_TRY", "T_UNSET", "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE",
-  "T_WHITESPACE", "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'",
-  "']'", "$accept", "start", "top_statement_list", "namespace_name",
+  "T_END_HEREDOC", "T_ENDIF", "T_ENDSWITCH", "T_ENDWHILE", "T_EVAL",
+  "T_EXIT", "T_EXTENDS", "T_FILE", "T_FINAL", "T_FOR", "T_FOREACH",
+  "T_FUNC_C", "T_FUNCTION", "T_GLOBAL", "T_GOTO", "T_HALT_COMPILER",
+  "T_IF", "T_IMPLEMENTS", "T_INC", "T_INCLUDE", "T_INCLUDE_ONCE",
+  "T_INLINE_HTML", "T_INSTANCEOF", "T_INSTEADOF", "T_INT_CAST",
+  "T_INTERFACE", "T_IS_EQUAL", "T_IS_GREATER_OR_EQUAL", "T_IS_IDENTICAL",
+  "T_IS_NOT_EQUAL", "T_IS_NOT_IDENTICAL", "T_ISSET",
+  "T_IS_SMALLER_OR_EQUAL", "T_LINE", "T_LIST", "T_LNUMBER",
+  "T_LOGICAL_AND", "T_LOGICAL_OR", "T_LOGICAL_XOR", "T_METHOD_C",
+  "T_MINUS_EQUAL", "T_MOD_EQUAL", "T_MUL_EQUAL", "T_NAMESPACE", "T_NEW",
+  "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING", "T_OBJECT_CAST",
+  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO", "T_OR_EQUAL",
+  "T_PAAMAYIM_NEKUDOTAYIM", "T_PLUS_EQUAL", "T_PRINT", "T_PRIVATE",
+  "T_PROTECTED", "T_PUBLIC", "T_REQUIRE", "T_REQUIRE_ONCE", "T_RETURN",
+  "T_SL", "T_SL_EQUAL", "T_SR", "T_SR_EQUAL", "T_START_HEREDOC",
+  "T_STATIC", "T_STRING", "T_STRING_CAST", "T_STRING_VARNAME", "T_SWITCH",
+  "T_THROW", "T_TRAIT", "T_TRAIT_C", "T_TRY", "T_UNSET", "T_UNSET_CAST",
+  "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "T_XOR_EQUAL",
+  "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'", "']'",
+  "$accept", "start", "top_statement_list", "namespace_name",
   "top_statement", "$@1", "$@2", "use_declarations", "use_declaration",
   "constant_declaration", "inner_statement_list", "inner_statement",
   "statement", "unticked_statement", "additional_catches",
@@ -920,2237 +1142,2409 @@ static const char *const yytname[] =
   "assignment_list_element", "array_pair_list",
   "non_empty_array_pair_list", "encaps_list", "encaps_var",
   "encaps_var_offset", "internal_functions_in_yacc", "isset_variables",
-  "class_constant", 0
+  "class_constant", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   629,   605,   604,   549,   565,   564,    44,   582,
-     583,   581,   600,    61,   610,   608,   628,   597,   503,   586,
-     521,   530,   587,   585,   599,    63,    58,   510,   509,   124,
-      94,    38,   575,   573,   574,   571,    60,    62,   572,   577,
-     609,   607,    43,    45,    46,    42,    47,    37,    33,   567,
-     126,   622,   508,   593,   505,   614,   536,   569,   526,   563,
-      64,    91,   518,   589,   539,   538,   546,   603,   602,   601,
-     553,   502,   612,   504,   506,   507,   511,   512,   513,   514,
-     515,   516,   517,   519,   520,   522,   523,   524,   525,   527,
-     528,   529,   531,   532,   533,   534,   535,   537,   540,   541,
-     542,   543,   544,   545,   547,   548,   550,   551,   552,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   566,   568,
-     570,   576,   578,   579,   580,   584,   588,   590,   591,   592,
-     594,   595,   596,   598,   606,   611,   613,   615,   616,   617,
-     618,   619,   620,   621,   623,   624,   625,   626,   627,   123,
-     125,    40,    41,    59,    96,    36,    34,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
-     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
-     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
-     169,   169,   170,   170,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   172,   172,   173,   173,   174,   175,   175,   176,   177,
-     178,   179,   179,   181,   180,   183,   182,   184,   182,   185,
-     185,   185,   185,   186,   186,   187,   188,   188,   189,   189,
-     190,   190,   191,   191,   192,   192,   193,   193,   194,   194,
-     195,   195,   196,   196,   197,   197,   197,   197,   198,   198,
-     198,   199,   199,   200,   200,   201,   201,   202,   202,   203,
-     203,   204,   204,   205,   205,   206,   206,   206,   206,   206,
-     206,   206,   206,   207,   207,   207,   207,   208,   208,   209,
-     209,   209,   209,   209,   209,   210,   210,   211,   211,   211,
-     212,   212,   212,   212,   213,   213,   214,   214,   214,   215,
-     214,   216,   217,   217,   218,   218,   219,   219,   220,   220,
-     221,   221,   222,   223,   223,   224,   224,   225,   226,   226,
-     227,   227,   228,   228,   229,   229,   230,   230,   231,   231,
-     232,   232,   232,   232,   232,   232,   233,   233,   233,   233,
-     234,   234,   235,   235,   236,   236,   237,   237,   238,   238,
-     239,   239,   240,   240,   240,   241,   241,   242,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   244,   243,   245,
-     243,   246,   247,   247,   248,   248,   248,   248,   249,   249,
-     249,   249,   249,   249,   249,   249,   250,   250,   250,   250,
-     251,   251,   251,   252,   252,   253,   253,   254,   254,   255,
-     256,   256,   256,   257,   257,   257,   258,   258,   259,   259,
-     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     260,   260,   260,   260,   260,   260,   260,   260,   260,   260,
-     261,   262,   262,   262,   262,   262,   262,   262,   262,   262,
-     263,   263,   264,   264,   265,   265,   265,   265,   266,   266,
-     267,   268,   269,   270,   270,   271,   271,   272,   273,   273,
-     274,   275,   275,   275,   276,   276,   277,   277,   278,   279,
-     279,   280,   280,   280,   281,   281,   281,   282,   282,   282,
-     283,   283,   284,   284,   285,   285,   286,   286,   286,   287,
-     287,   288,   288,   289,   289,   290,   290,   290,   291,   291,
-     292,   292,   292,   292,   292,   292,   292,   292,   293,   293,
-     293,   293,   294,   294,   294,   294,   294,   294,   295,   295,
-     295,   296,   296,   296,   296,   296,   296,   296,   297,   297,
-     298,   298
-};
+#define YYPACT_NINF (-720)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define YYTABLE_NINF (-412)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
-       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
-       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
-       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
-       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
-       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
-       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
-       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
-       2,     1,     2,     0,     2,     1,     0,     2,     0,     2,
-       1,     3,     0,     2,     1,     2,     1,     4,     1,     4,
-       1,     4,     3,     5,     3,     4,     4,     5,     0,     5,
-       4,     1,     1,     1,     4,     0,     6,     0,     7,     0,
-       2,     0,     3,     1,     0,     2,     3,     5,     4,     4,
-       5,     7,     6,     0,     1,     1,     1,     1,     0,     1,
-       1,     2,     3,     3,     4,     3,     1,     1,     2,     4,
-       3,     5,     1,     3,     2,     0,     3,     2,     1,     0,
-       9,     3,     1,     3,     1,     3,     0,     1,     1,     2,
-       2,     2,     3,     1,     3,     1,     1,     3,     4,     3,
-       0,     1,     1,     3,     1,     1,     0,     1,     1,     2,
-       1,     1,     1,     1,     1,     1,     3,     5,     1,     3,
-       5,     4,     3,     1,     0,     1,     3,     1,     2,     1,
-       4,     3,     2,     1,     1,     0,     1,     3,     6,     3,
-       4,     6,     2,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     1,     4,
-       5,     4,     1,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     1,     4,     3,     3,     2,     0,    10,     0,
-      11,     1,     0,     4,     3,     4,     1,     2,     4,     6,
-       5,     6,     6,     6,     6,     4,     1,     1,     3,     2,
-       1,     3,     2,     1,     1,     4,     1,     2,     0,     2,
-       0,     2,     3,     0,     1,     1,     0,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     2,
-       1,     1,     3,     2,     2,     2,     4,     3,     1,     1,
-       3,     1,     1,     1,     3,     2,     1,     3,     3,     1,
-       0,     2,     0,     1,     5,     3,     3,     1,     1,     1,
-       1,     1,     1,     5,     1,     2,     0,     3,     4,     4,
-       3,     1,     1,     0,     1,     2,     3,     3,     1,     4,
-       4,     1,     1,     1,     1,     2,     1,     4,     4,     1,
-       1,     4,     0,     1,     1,     1,     4,     4,     1,     1,
-       3,     1,     2,     3,     1,     1,     4,     0,     0,     2,
-       5,     3,     3,     1,     6,     4,     4,     2,     2,     2,
-       1,     2,     1,     4,     3,     3,     6,     3,     1,     1,
-       1,     4,     4,     2,     2,     4,     2,     2,     1,     3,
-       3,     3
+    -720,   129,  1666,  -720,   -72,  8335,  8335,  8335,  8335,  8335,
+    5935,   100,   -10,  8335,  8335,  7755,  -720,  -720,  8335,   127,
+    -720,  7900,   279,     3,  -720,  -720,  5316,  8335,  8335,   115,
+     134,   138,  -720,   139,   153,   156,  -720,  -720,    77,   182,
+     169,   201,   279,  8335,  8335,  -720,  8335,  -720,   209,  -720,
+     220,  -720,  -720,     0,   396,  -720,   203,  8335,  8335,  8335,
+    8335,  8045,    22,   -28,   350,  8335,  -720,   249,  8335,  -720,
+    -720,   250,   259,  8335,   -69,  -720,   263,  -720,  8335,  -720,
+      24,   272,   218,   -27,  -720,    11,  -720,  -720,  -720,  -720,
+    -720,  -720,   289,   290,  -720,  -720,   426,   420,   326,  -720,
+    -720,  5643,  -720,   191,  1093,   294,  -720,   328,   427,   333,
+    -720,   101,  -720,    81,  -720,  -720,  -720,   338,   376,  -720,
+     426,  -720,  -720,   368,  -720,  -720,   279,  8627,   302,   459,
+    -720,  5935,  -720,  -720,  -720,  5744,  -720,   460,  -720,  5773,
+     352,   203,  -720,   -52,   353,  -720,  -720,   362,   337,   336,
+    -720,    17,  8788,   279,  8335,  8190,  -720,  -720,  8335,  8335,
+    -720,   541,    19,  -720,   331,   335,  8335,  -720,  8788,  8788,
+    -720,   279,    -7,   203,  -720,   -53,   384,   203,   385,   382,
+     351,  -720,   391,   389,    39,    81,   227,  -720,  8841,  8788,
+    8788,  -720,   364,  8788,   540,   279,  8475,   180,  -720,    30,
+      69,  -720,   514,    20,   426,  -720,  -720,  8335,  5874,  -720,
+     279,  -720,   203,    72,    23,  -720,  8335,  2688,   371,  1509,
+     188,   379,   285,  8335,   188,    67,   401,  6075,   403,  -720,
+     467,   469,  -720,   -14,  8335,   334,  5462,  8335,  8335,  8335,
+    8335,  8335,  8335,  8335,  8335,  8335,  8335,  8335,  8335,  8335,
+     396,  8335,  8335,  8335,  8335,  8335,  8335,  8335,  8335,  8335,
+    8335,  8335,  -720,  -720,  -720,  6215,  8335,  8335,  8335,  8335,
+    8335,  8335,  8335,  8335,  8335,  8335,  8335,  6075,   375,  8335,
+     377,  8335,  8335,   272,    58,   398,  -720,  -720,  6355,  -720,
+    6495,  -720,   407,  -720,  1537,  -720,   203,    -8,   377,   377,
+     546,    25,   404,  8335,  -720,   408,  6927,  -720,  6956,   411,
+     558,  8788,   539,   958,  8335,  -720,  -720,    77,  -720,  -720,
+     415,  7057,  -720,    38,   419,  -720,    42,  -720,   265,  -720,
+    -720,  -720,   203,   385,   110,  6075,  -720,   110,   377,    61,
+    6075,  -720,  -720,   423,   555,  7447,  -720,  -720,   228,   444,
+    -720,  -720,  -720,  1537,   433,  -720,   428,  7086,  -720,  2834,
+      43,  -720,  -720,   105,   447,   -69,  -720,  7187,   431,  -720,
+    -720,  -720,  -720,  -720,    41,  -720,  -720,  7476,  -720,  -720,
+     279,   432,   582,    44,   236,   584,   185,   509,   185,  -720,
+     442,   274,  8788,   438,   445,  8335,   449,    61,   452,    81,
+    8335,  8656,  9005,  9032,   933,  1220,   752,    78,    78,    78,
+     368,   368,   368,  8989,  8966,  -720,  1531,  1020,  1531,  1531,
+    1531,  1020,  8841,  1328,  8815,   461,   461,   666,  8841,  8841,
+    8841,  8841,  8841,  8841,  8841,  8841,  8841,  8841,  8841,  8841,
+     446,   445,   453,   454,   457,  -720,  -720,   458,    68,  -720,
+     463,  7507,   279,  8788,   279,  8687,  -720,  1537,  1537,  1537,
+     465,  -720,   507,   203,   170,    -3,   503,  -720,  -720,  -720,
+       7,  1537,   491,  4586,  8335,  8788,  -720,  -720,  -720,  8335,
+    8335,   279,   136,  7608,  -720,  -720,  4732,   279,  -720,    -7,
+      -7,   621,  6075,  2104,  -720,   385,  -720,   475,  -720,  -720,
+     479,  -720,  8335,  -720,  -720,  -720,  -720,   476,  -720,  -720,
+     630,   274,    37,   602,   279,   485,   510,  -720,  -720,  4878,
+     488,  8335,   377,   536,    92,  -720,  -720,  -720,  -720,  -720,
+    -720,  6635,  1537,   542,   203,   385,  -720,   185,  -720,   651,
+    -720,   506,   274,  -720,  -720,   504,   655,    21,  -720,  -720,
+    7637,  6075,  6075,    61,  8942,  8335,   396,  -720,  -720,  6075,
+    6075,  -720,  6075,   640,   641,  -720,  8335,  8335,  -720,  -720,
+    -720,  -720,  6775,  -720,  -720,   608,   508,   663,  1537,   203,
+     140,   604,   543,  -720,   674,  -720,  -720,  -720,  7216,   526,
+    8788,   625,   279,   625,  -720,  -720,  -720,  -720,  -720,    45,
+    -720,  8335,   529,  -720,  2250,  -720,   570,  -720,  1273,  -720,
+    1537,   533,   538,   544,  -720,   547,  -720,  -720,  -720,  -720,
+    -720,  -720,   548,   532,   458,  -720,  8335,   536,   279,    51,
+     848,  -720,   203,   385,   651,   545,   185,  -720,   551,   552,
+     284,   559,   704,  -720,   557,   560,  8942,   351,   562,   563,
+     564,  8335,  8335,   536,   553,  7668,   279,  8788,  1537,  -720,
+    1537,  -720,   565,   165,  -720,  1537,  2980,   567,  8335,   136,
+     566,  -720,   572,  2396,   102,  -720,  8841,  -720,  -720,   377,
+    -720,   575,  -720,   552,  -720,   329,  -720,    -4,   185,  3126,
+    -720,  -720,  -720,   569,  -720,   385,  -720,  -720,   650,  -720,
+     571,   590,    57,   736,  1537,  -720,  -720,  -720,  -720,  -720,
+    -720,   585,   586,  -720,  -720,  -720,  -720,  -720,   689,  -720,
+    -720,   592,  -720,   595,  -720,  5024,  5024,   251,  5316,   597,
+    -720,  -720,  -720,   600,   360,  8335,    18,   598,    32,  -720,
+     610,   605,  -720,   710,   606,  -720,   620,  -720,  -720,  -720,
+    -720,  -720,   185,  -720,  -720,  -720,  -720,   612,   376,   281,
+    -720,    28,   611,    59,  -720,   616,   766,  1537,  -720,  -720,
+    -720,  1537,  -720,  5170,  -720,  -720,  -720,  -720,   770,   627,
+     713,  -720,  8335,  -720,   631,  5614,  -720,  -720,  -720,  -720,
+    -720,   633,  -720,  -720,  -720,   782,    10,  -720,   784,    34,
+     426,  -720,   657,  -720,  -720,   646,  -720,    53,  -720,   788,
+    1537,  -720,  -720,  -720,  -720,  -720,  3272,  -720,  8335,   642,
+    7317,  -720,  -720,  -720,  1812,   647,  1537,   185,   307,  -720,
+    -720,  1537,   652,  -720,   668,   798,  3418,  -720,    63,  -720,
+    3564,  1537,  -720,  3710,   656,  3856,  7346,  -720,  5316,  4002,
+    1958,  -720,  -720,  -720,   777,   658,   307,  -720,   659,   787,
+     727,   664,   698,  -720,   814,   672,  1537,  -720,   679,  -720,
+    -720,  -720,   675,  -720,   813,  -720,  -720,  4148,  -720,  -720,
+    -720,   205,   185,  -720,   692,  1537,   274,  -720,  -720,  -720,
+    -720,   793,   696,   697,   833,  -720,  -720,  -720,   685,  2542,
+     695,  -720,   793,  -720,  -720,   185,  -720,   185,  -720,  -720,
+     198,   705,  -720,  -720,  -720,   703,  4294,   708,  -720,  -720,
+    4440,  -720
 };
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+static const yytype_int16 yydefact[] =
 {
-       4,     0,     2,     1,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   418,     0,     0,     0,     0,   306,
-       0,     0,    79,   359,     0,   330,     0,     0,   333,   329,
-       0,     0,     0,   320,   332,     0,     0,   336,   291,     0,
-       0,     0,     0,    51,    85,     0,   331,     0,   328,   335,
-       0,   337,     0,     0,     0,     5,   351,     0,     0,    81,
-     334,     0,     0,     0,   400,     0,    27,     0,    57,   323,
-     411,     0,   353,     3,     0,     7,    32,     8,     9,    69,
-      70,     0,     0,   268,   369,    71,   393,     0,   356,   282,
-       0,   368,     0,   370,     0,   396,     0,   392,   374,   391,
-     394,   399,     0,   272,   352,   306,     0,     5,    71,   447,
-     446,     0,   444,   443,   286,   254,   255,   256,   257,   279,
-     278,   277,   276,   275,   274,   273,   306,     0,     0,   307,
-       0,   237,   372,     0,   235,   281,     0,   423,     0,   362,
-     222,     0,     0,   307,   313,   326,   314,     0,   316,   394,
-       0,    82,    80,   152,     0,    71,   418,    41,     0,     0,
-      43,     0,     0,     0,     0,   203,     0,     0,   280,   204,
-       0,   147,     0,     0,   146,     0,     0,     0,     0,   417,
-       0,    14,     0,   355,    45,   369,     0,   370,     0,     0,
-       0,   339,   432,     0,   430,    33,     0,     0,    27,     0,
-       0,    20,     0,    19,     0,     0,   268,     0,   324,     0,
-     325,     0,     0,     0,     0,   138,     0,    17,    83,    86,
-      72,     0,   402,     0,     0,     0,     0,     0,     0,     0,
+       4,     0,     0,     1,     0,     0,     0,     0,     0,     0,
+     420,     0,     0,     0,     0,     0,    80,   361,     0,     0,
+     332,     0,     0,     0,   335,   331,     0,     0,     0,     0,
+       0,   322,   334,     0,     0,     0,   338,   293,     0,     0,
+       0,     0,     0,     0,     0,    52,     0,    86,     0,   333,
+       0,   330,   337,     0,     0,   339,     0,     0,     0,     0,
+       0,     0,     0,   308,     5,     0,   353,     0,     0,    82,
+     336,     0,     0,     0,     0,   402,     0,    27,     0,    58,
+     325,   413,     0,   355,     3,     0,     7,    32,     8,     9,
+      70,    71,     0,     0,   270,   371,    72,   395,     0,   358,
+     284,     0,   370,     0,   372,     0,   398,     0,   394,   376,
+     393,   396,   401,     0,   274,   354,    34,     0,   308,     5,
+      72,   256,   257,   258,   259,   283,     0,   425,     0,   364,
+      81,   420,   278,   280,    42,     0,   224,     0,    44,     0,
+       0,     0,   308,   309,     0,   239,   374,     0,     0,     0,
+     276,     0,   205,     0,     0,     0,   282,    83,   206,     0,
+     148,     0,     0,   147,     0,     0,     0,   237,   445,   446,
+     275,     0,   419,     0,    14,     0,     0,     0,   309,   315,
+     328,   316,     0,   318,   396,     0,   357,   279,   288,   448,
+     449,    46,   371,     0,   372,     0,     0,     0,   341,   434,
+       0,   432,   153,     0,    72,    33,   277,     0,     0,    27,
+       0,   281,     0,    20,     0,    19,     0,     0,   270,     0,
+     326,     0,   327,     0,     0,     0,     0,   139,     0,    17,
+      84,    87,    73,     0,   404,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      52,   236,   234,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   138,     0,   402,     0,   402,
-       0,   412,   395,     0,     0,     0,   309,     0,     0,   427,
-     371,     0,   284,   363,   419,     0,   309,     0,   138,   217,
-       0,     0,   395,     0,     0,    49,     0,     0,    42,     0,
-      44,     0,     0,     0,     0,    50,     0,   321,     0,     0,
-     205,   207,   369,   370,     0,   148,   370,     0,    48,    60,
-       0,     0,   448,     0,     0,   415,     0,   414,   354,     4,
-      12,    11,   138,    46,    47,     0,   351,     0,   338,   431,
-       0,     0,   429,   358,   428,     0,    59,     0,     0,    66,
-      68,    22,     0,     0,    16,     0,     0,    34,    26,    28,
-      29,    30,   215,   267,   285,     0,   357,     6,     0,     0,
-     137,   369,   370,     0,     0,    88,     0,    77,     0,   133,
-     403,     0,   450,     0,   386,   384,     0,     0,   240,   242,
-     241,     0,     0,   238,   239,   243,   245,   244,   259,   258,
-     261,   260,   262,   264,   265,   263,   253,   252,   247,   248,
-     246,   249,   250,   251,   266,     0,   219,   233,   232,   231,
-     230,   229,   228,   227,   226,   225,   224,   223,     0,   451,
-     387,     0,     0,   409,   405,   383,   404,   408,     0,     0,
-     445,   308,     0,   422,     0,   421,   308,   386,     0,   387,
-     318,     0,     0,   360,     0,   349,     0,     0,     0,   341,
-       0,   340,   153,   348,   150,   133,   283,    25,     0,     0,
-       0,     0,   202,   442,   322,   204,     0,     0,     0,     0,
-     145,    10,     0,     0,   441,   417,   417,     0,   138,     0,
-       4,     0,   437,     0,   435,   439,   438,   440,     0,   434,
-       0,     0,     0,     0,     0,    21,    18,     0,     0,   402,
-       0,   214,   213,   216,   269,   209,   401,   141,   298,     0,
-       0,     0,     0,   310,    84,     0,    75,    87,    90,     0,
-     133,   134,   135,     0,   123,     0,   136,   390,     0,   138,
-     138,   385,   271,     0,     0,   220,   305,   138,   138,   389,
-     138,   382,   381,   376,   402,     0,   397,   398,   426,   425,
-       0,   327,   315,   344,   345,   367,     0,   362,   360,     0,
-     343,     0,     0,     0,     0,   102,     0,    27,   100,    56,
-       0,     0,   206,    92,     0,    92,    94,   149,    27,   115,
-     449,     0,   413,     0,     0,    15,     0,   300,     0,   433,
-     108,   108,    40,     0,    67,    53,    23,    27,   113,    37,
-       0,     0,   383,   208,   402,   212,     0,   369,   370,    24,
-       0,   312,    89,     0,     0,   155,     0,   292,   133,     0,
-     125,   410,     0,     0,   270,   326,     0,     0,     0,   402,
-     402,   373,     0,     0,     0,   420,     0,   317,     0,   347,
-     363,   361,     0,   342,   350,   151,   292,     0,     0,     0,
-     204,     0,     0,    95,     0,   117,   119,   416,   218,   299,
-      13,     0,   108,     0,   108,     0,     0,     0,    31,   211,
-     377,     0,   144,   311,   155,    91,   186,    73,     0,     0,
-       0,   126,     0,   302,   301,   221,   304,   303,   380,     0,
-       0,   375,   406,   407,   424,   319,   366,   365,   346,     0,
-     103,     0,    38,     0,    93,     0,     0,   121,     0,     0,
-      35,   436,     0,     0,     0,     0,     0,   104,     0,     0,
-     210,   186,   190,   191,   192,   195,   194,   193,     0,     0,
-     185,    78,   154,   158,     0,     0,   184,   188,     0,     0,
-       0,   287,     0,   129,     0,   128,   378,   379,     0,   289,
-     101,     0,    27,    98,    55,    54,     0,     0,     0,     0,
-     120,     0,     0,   111,   112,    27,   106,   105,     0,   114,
-      76,     0,     0,   162,   198,     0,    71,   189,     0,   157,
-      27,     0,   296,     0,    27,   130,     0,   127,   364,    27,
-      27,    96,    39,     0,     0,    27,     0,     0,   107,    27,
-     110,     0,     0,     0,   166,   164,   161,     0,     0,   156,
-       0,     0,     0,   297,     0,   293,     0,     0,   132,     0,
-       0,     0,     0,   122,    36,     0,   109,    27,   201,   163,
-       5,     0,   167,   168,     0,     0,   176,     0,     0,   199,
-     196,     0,     0,    74,     0,   294,   288,   131,   290,     0,
-      99,     0,   116,     0,   165,   169,   170,   180,     0,   171,
-       0,     0,   133,   200,   295,    97,    27,    62,     0,   179,
-     172,   173,   177,   197,     0,   118,     0,    58,    61,    63,
-     178,     0,   159,     0,    64,   174,     0,     0,    27,   182,
-     160,     0,     0,     0,   183,    27,     0,    65
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,     2,    82,    83,   500,   339,   212,   213,    84,
-     215,   368,   369,    86,   897,   898,   899,   358,   359,   370,
-     371,   231,    89,   759,    90,   633,   539,    91,   385,    92,
-     387,   536,   537,   672,   595,   812,   774,   589,   312,   612,
-     683,   785,   619,   676,   727,   730,   778,   543,   544,   545,
-     379,   380,   183,   184,   164,   696,   752,   906,   753,   792,
-     826,   851,   852,   853,   854,   890,   855,   856,   857,   888,
-     910,   754,   755,   756,   757,   795,   758,   174,   319,   320,
-     521,   522,   523,   524,    93,    94,   804,   809,   118,   699,
-     803,    96,    97,   546,   155,   156,   572,   657,   178,   219,
-     299,    98,   575,   473,    99,   576,   294,   577,   100,   101,
-     289,   102,   103,   651,   525,   561,   562,   563,   104,   105,
-     106,   107,   108,   109,   110,   111,   391,   445,   446,   447,
-     112,   336,   337,   148,   149,   203,   204,   508,   113,   333,
-     114
+       0,     0,    53,   238,   236,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   139,     0,   404,
+       0,   404,     0,   414,   397,     0,   429,   373,     0,   286,
+     365,   421,     0,    43,     0,    45,     0,   311,     0,     0,
+       0,     0,     0,     0,    51,     0,     0,   323,     0,     0,
+     207,   209,   371,   372,     0,   149,   372,     0,    49,    61,
+       0,     0,   450,     0,     0,   417,     0,   416,   356,     4,
+      12,    11,     0,   311,     0,   139,   219,     0,     0,   397,
+     139,    47,    48,     0,   353,     0,   340,   433,     0,     0,
+     431,   360,   430,     0,     0,    50,     0,     0,    60,     0,
+       0,    67,    69,    22,     0,     0,    16,     0,     0,    35,
+      26,    28,    29,    30,   217,   269,   287,     0,   359,     6,
+       0,     0,   138,   371,   372,     0,     0,    89,     0,    78,
+       0,   134,   405,     0,   452,     0,   388,   386,     0,     0,
+       0,     0,   245,   247,   246,   264,   266,   249,   250,   248,
+     251,   252,   253,   241,   240,   268,   262,   267,   260,   263,
+     261,   265,   243,   242,   244,   254,   255,     0,   221,   231,
+     229,   228,   226,   230,   227,   232,   225,   234,   235,   233,
+       0,   453,   389,     0,     0,   411,   407,   385,   406,   410,
+       0,     0,     0,   424,     0,   423,   285,     0,     0,   362,
+       0,   351,     0,     0,     0,   343,     0,   342,    25,   350,
+     310,     0,     0,     0,     0,   204,   444,   447,   324,   206,
+       0,     0,     0,     0,   146,    10,     0,     0,   443,   419,
+     419,     0,   139,     0,     4,   310,   388,     0,   389,   320,
+       0,   439,     0,   437,   441,   440,   442,     0,   436,   154,
+     151,   134,     0,     0,     0,     0,     0,    21,    18,     0,
+       0,   404,     0,   216,   215,   218,   271,   211,   403,   142,
+     300,     0,     0,     0,     0,   312,    85,     0,    76,    88,
+      91,     0,   134,   135,   136,     0,   124,     0,   137,   392,
+       0,   139,   139,   387,   273,     0,     0,   222,   307,   139,
+     139,   391,   139,   384,   383,   378,   404,     0,   399,   400,
+     428,   427,     0,   346,   347,   369,     0,   364,   362,     0,
+     345,     0,     0,   103,     0,    27,   101,    57,     0,     0,
+     208,    93,     0,    93,    95,   150,    27,   116,   451,     0,
+     415,     0,     0,    15,     0,   329,   317,   302,     0,   435,
+       0,     0,   109,   109,    41,     0,    68,    54,    23,    27,
+     114,    38,     0,     0,   385,   210,   404,   214,     0,   371,
+     372,    24,     0,   314,    90,     0,     0,   156,     0,   294,
+     134,     0,   126,   412,     0,     0,   272,   328,     0,     0,
+       0,   404,   404,   375,     0,     0,     0,   422,     0,   349,
+     365,   363,     0,   344,   352,     0,     0,     0,   206,     0,
+       0,    96,     0,     0,   120,   418,   220,   301,    13,     0,
+     319,     0,   152,   294,   109,     0,   109,     0,     0,     0,
+      31,   213,   379,     0,   145,   313,   156,    92,     0,    74,
+       0,     0,     0,   127,     0,   304,   303,   223,   306,   305,
+     382,     0,     0,   377,   408,   409,   426,   368,   367,   348,
+     104,     0,    39,     0,    94,     0,     0,   122,     0,     0,
+      36,   321,   438,     0,     0,     0,     0,     0,     0,   105,
+       0,     0,   212,     0,     0,   196,     0,   197,   194,   193,
+     192,   195,     0,   187,    79,   155,   159,     0,     0,   186,
+     190,     0,     0,     0,   289,     0,   130,     0,   129,   380,
+     381,     0,   102,     0,    27,    99,    56,    55,     0,     0,
+       0,   121,     0,   291,     0,     0,   112,   113,    27,   107,
+     106,     0,   115,    77,   162,     0,     0,   164,   200,     0,
+      72,   191,     0,   158,    27,     0,   298,     0,    27,   131,
+       0,   128,   366,    27,    97,    40,     0,    27,     0,     0,
+       0,    27,   108,    27,     0,     0,     0,     0,   168,   166,
+     163,     0,     0,   157,     0,     0,     0,   299,     0,   295,
+       0,     0,   133,     0,     0,     0,     0,    37,     0,     0,
+       0,    27,   203,   165,     5,     0,   169,   170,     0,     0,
+     178,     0,     0,   201,   198,     0,     0,    75,     0,   296,
+     290,   132,     0,   100,     0,   117,   292,     0,   167,   171,
+     172,   182,     0,   173,     0,     0,   134,   202,   297,    98,
+      27,    63,     0,   181,   174,   175,   179,   199,     0,     0,
+       0,    59,    62,    64,   180,     0,   160,     0,    65,   176,
+       0,     0,    27,   184,   161,     0,     0,     0,   185,    27,
+       0,    66
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -723
-static const yytype_int16 yypact[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
 {
-    -723,   105,  1987,  -723,  6579,  6579,   -28,  6579,  6579,  6579,
-    6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,
-    6579,   235,   235,  6579,  5067,  6579,   248,   127,   131,   -47,
-      -7,  5193,  -723,  -723,    89,  -723,  5319,    85,  -723,  -723,
-    4913,  6579,    96,    99,  -723,   115,   125,  -723,  -723,   -54,
-     107,   137,   145,  -723,  -723,   154,  -723,   158,  -723,  -723,
-     106,  -723,   142,  5445,   265,   297,  -723,   182,  6579,  -723,
-    -723,   217,   198,   143,  -723,   228,  -723,  6579,  -723,   318,
-     233,   339,   -37,  -723,    14,  -723,  -723,  -723,  -723,  -723,
-    -723,   256,   260,  -723,  -723,   376,   347,   285,  -723,  -723,
-    6838,  -723,   254,  1128,   268,  -723,   289,   362,   294,  -723,
-      -9,  -723,   -38,  -723,  -723,   317,   302,  -723,   376,  7718,
-    7718,  6579,  7718,  7718,  1973,  -723,  -723,   383,  -723,  -723,
-    -723,  -723,  -723,  -723,  -723,  -723,  -723,   305,   142,     2,
-     304,  -723,  -723,   307,  -723,  -723,   235,  7636,   278,   449,
-    -723,   331,   142,   334,   328,   312,  -723,   340,   336,    -1,
-     -38,  -723,  -723,   465,    15,   376,  5067,  -723,  6879,   471,
-    -723,  6920,   343,   344,    17,  7718,   235,  5571,  -723,  6579,
-    6579,  -723,   -10,    18,  -723,   337,   335,  6579,   235,   231,
-     142,  -723,    95,   165,  -723,   342,  7718,   430,   235,  6705,
-     119,  -723,    -3,   290,  -723,  -723,  6579,  6965,  -723,   235,
-     142,    88,    20,  -723,  6579,  2141,   349,  7006,   -21,   332,
-     377,  6579,   -21,   168,   356,  5697,   374,  -723,   409,   414,
-    -723,   -61,  6579,   322,  6579,  6579,  6579,  5823,  6579,  6579,
-    6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,
-    6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,  6579,   248,
-    -723,  -723,  -723,  5949,  6579,  6579,  6579,  6579,  6579,  6579,
-    6579,  6579,  6579,  6579,  6579,  5697,   482,  6579,   498,  6579,
-    6579,   233,     0,   371,  7047,   142,    78,   498,   498,  -723,
-    -723,  6075,  -723,  6201,  -723,   142,   334,   -12,  5697,  -723,
-     -12,   498,    46,   865,   380,  -723,   381,   375,  -723,   865,
-    -723,   515,    30,   391,  6579,  -723,   379,  -723,  7092,   390,
-     536,  7718,   472,   761,  6579,  -723,  -723,   -54,  -723,  -723,
-     392,  7134,  -723,    31,   399,  -723,    32,  -723,   171,  -723,
-    -723,  -723,  5697,  -723,  -723,   402,   496,  7386,  -723,  -723,
-      92,   422,  -723,  -723,  -723,  7175,  -723,  2295,    34,  -723,
-    -723,   126,   425,   143,  -723,  7218,   411,  -723,  -723,  -723,
-    -723,  -723,    27,  -723,  -723,  7427,  -723,  -723,   235,   412,
-     555,    35,    63,   553,   200,   452,   200,  -723,   420,   132,
-    7718,   416,   424,  6579,   428,    46,   433,   -38,  7758,  7795,
-    1973,  6579,  1824,  2280,  2433,  2586,  1030,  2738,  2892,  2892,
-    2892,  2892,  1192,  1464,   676,   676,   689,   689,   466,   466,
-     466,   383,   383,   383,  -723,   -17,  1973,  1973,  1973,  1973,
-    1973,  1973,  1973,  1973,  1973,  1973,  1973,  1973,   442,   424,
-     435,   444,   419,  -723,  -723,   447,    49,  -723,   443,  7470,
-    -723,    98,   235,  7718,   235,  7677,   334,  -723,   454,  -723,
-    -723,   865,   865,   865,   448,  -723,   457,   142,    38,   201,
-     468,  -723,  -723,  -723,   598,   132,  -723,  -723,   865,   479,
-    4143,  6579,  7718,  -723,  -723,  6579,  6579,   235,   189,  7512,
-    -723,  -723,  4297,   235,  -723,   231,   231,   604,  5697,  1674,
-    -723,   467,  -723,  6579,  -723,  -723,  -723,  -723,   469,  -723,
-      28,   545,   235,   474,   493,  -723,  -723,  4451,   478,  6579,
-     498,   503,    59,  -723,  -723,  -723,  -723,  -723,  -723,  6327,
-     865,   507,   142,   334,  -723,   200,  -723,   630,  -723,   490,
-     132,  -723,  -723,   494,   637,     4,  -723,  -723,  7553,  5697,
-    5697,    46,  2127,  6579,   248,  -723,  -723,  5697,  5697,  -723,
-    5697,   587,   588,  -723,  6579,  6579,  -723,  -723,  -723,  -723,
-    6453,  -723,   521,  -723,  -723,   556,   497,   647,   865,   142,
-     242,   554,   523,   865,   504,  -723,   648,  -723,  -723,  -723,
-    7260,   509,  7718,   564,   235,   564,  -723,  -723,  -723,  -723,
-    -723,    40,  -723,  6579,   511,  -723,  1833,  -723,  1415,  -723,
-     514,   516,  -723,   524,  -723,  -723,  -723,  -723,  -723,  -723,
-     518,   517,   447,  -723,  6579,   503,   235,    41,   746,  -723,
-     142,   334,   630,   532,   200,  -723,   531,   540,   164,   549,
-     684,  -723,   547,   551,  2127,   312,   552,   558,   559,  6579,
-    6579,   503,   548,  7594,   235,  7718,   498,  -723,   865,  -723,
-     865,  -723,   560,   276,  -723,  -723,   540,   865,  2449,   571,
-    6579,   189,   577,  -723,   589,  3989,   266,  -723,  1973,  -723,
-    -723,   557,  -723,    57,  -723,    16,   200,  2603,  -723,  -723,
-    -723,   582,  -723,   334,  -723,  -723,   271,  -723,   591,   596,
-       6,   693,   865,  -723,  -723,  -723,  -723,  -723,  -723,   583,
-     590,  -723,  -723,  -723,  -723,  -723,  -723,   652,  -723,   600,
-    -723,   597,  -723,   599,  -723,  4605,  4605,   282,   601,  4913,
-    -723,  -723,   113,  6579,     5,   602,    22,  -723,   610,   605,
-    -723,   520,  -723,  -723,  -723,  -723,  -723,  -723,   621,   200,
-    -723,  -723,  -723,  -723,   625,   317,   330,  -723,    21,   624,
-      13,  -723,   640,   774,   865,  -723,  -723,  -723,   865,  -723,
-    -723,  4759,  -723,  -723,  -723,  -723,   638,   762,   724,  6579,
-    -723,   639,  1519,  -723,  -723,  -723,  -723,  -723,   641,  -723,
-    -723,   781,    11,  -723,   782,    25,   376,  -723,   660,  -723,
-    -723,   651,  -723,    45,  -723,   785,   865,  -723,  -723,  -723,
-    -723,  -723,  -723,  2757,  6579,  -723,   649,  7301,  -723,  -723,
-    3989,   654,   865,   200,   222,  -723,  -723,   865,   655,  -723,
-     664,   794,  2911,  -723,    19,  -723,  3065,   865,  -723,  3219,
-    3373,   656,  7344,  3989,  -723,  4913,  3989,  -723,  -723,  -723,
-     734,   663,   222,  -723,   661,   741,   697,   668,   690,  -723,
-     804,   671,   865,  -723,   678,  -723,  -723,  -723,  -723,   672,
-    -723,   800,  -723,  3527,  -723,  -723,  -723,   619,   200,  -723,
-     691,   865,   132,  -723,  -723,  -723,  -723,   749,   695,   696,
-     821,  -723,  -723,  -723,   681,  3989,   685,  -723,   749,  -723,
-    -723,   200,  -723,   200,  -723,  -723,   -60,   694,  -723,  -723,
-    -723,   687,  3681,   698,  -723,  -723,  3835,  -723
+    -720,  -720,  -310,   -21,  -720,  -720,  -720,  -720,   494,  -720,
+    -191,  -720,     8,  -720,  -720,  -720,   -40,  -720,   349,     4,
+       6,  -118,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,   330,   273,   199,  -720,   143,  -720,  -720,  -720,
+    -466,    87,  -720,  -720,  -720,  -720,  -720,  -506,  -720,   230,
+    -238,  -720,  -720,   556,  -720,   178,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,    26,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -719,  -720,  -720,  -720,  -467,  -720,
+     354,  -720,  -720,  -720,   799,    -6,  -720,  -720,    -2,   197,
+    -720,  -720,   248,  -313,  -239,  -720,  -720,  -720,  -720,  -720,
+     238,  -279,   669,  -720,  -720,   305,   310,  -720,   914,   729,
+    -364,    35,  1103,  -720,  -485,  -720,  -720,   264,  -228,  -720,
+      85,  -720,  -720,   -51,   -50,  -720,  -254,  -329,  -720,    70,
+     -37,   402,   405,   761,  -720,   309,   232,  -720,  -720,  -720,
+    -720
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
 {
-    -723,  -723,  -321,    42,  -723,  -723,  -723,  -723,   480,  -723,
-    -207,  -723,     1,  -723,  -723,  -723,   -56,  -723,   341,     3,
-       8,  -114,  -723,  -723,  -723,  -723,  -723,  -723,  -723,  -723,
-    -723,  -723,   310,   259,   178,  -723,   129,  -723,  -723,  -723,
-    -480,    74,  -723,  -723,  -723,  -723,  -723,  -468,  -723,   219,
-    -239,  -723,  -723,   533,  -723,   167,  -723,  -723,  -723,  -723,
-    -723,  -723,  -723,    23,  -723,  -723,  -723,  -723,  -723,  -723,
-    -723,  -723,  -723,  -723,  -722,  -723,  -723,  -723,  -469,  -723,
-     346,  -723,  -723,  -723,   786,    10,  -723,  -723,    -2,   192,
-    -723,  -723,   434,  -354,  -248,  -723,  -723,  -723,  -723,  -723,
-     225,   389,   216,  -723,  -723,   284,   295,  -723,  1099,   699,
-    -357,   351,   983,  -723,  -497,  -723,  -723,   251,  -231,  -723,
-     -13,  -723,  -723,   -20,   -14,  -723,  -262,  -287,  -723,   -77,
-      -6,   382,   384,   712,  -723,   196,   333,  -723,  -723,  -723,
-    -723
+       0,     1,     2,    83,    84,   494,   329,   214,   215,    85,
+     217,   370,   371,    87,   901,   902,   903,   360,   361,   372,
+     373,   233,    90,   762,    91,   635,   541,    92,   387,    93,
+     389,   538,   539,   670,   593,   815,   776,   587,   301,   614,
+     685,   788,   621,   674,   727,   730,   780,   545,   546,   547,
+     381,   382,   162,   163,   203,   698,   755,   910,   756,   796,
+     830,   855,   856,   857,   858,   894,   859,   860,   861,   892,
+     914,   757,   758,   759,   760,   799,   761,   151,   309,   310,
+     523,   524,   525,   526,    94,    95,   808,   821,   120,   701,
+     807,    97,    98,   548,   180,   181,   606,   680,   156,   221,
+     336,    99,   575,   469,   100,   576,   291,   577,   101,   102,
+     286,   103,   104,   653,   527,   563,   564,   565,   105,   106,
+     107,   108,   109,   110,   111,   112,   393,   447,   448,   449,
+     113,   326,   327,   128,   129,   200,   201,   507,   114,   323,
+     115
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -410
 static const yytype_int16 yytable[] =
 {
-      95,   357,   394,    85,   283,    87,   158,   584,   143,   143,
-      88,   424,   159,   157,   460,   442,   591,   448,   499,   823,
-     160,   527,   226,   304,   623,   314,   327,   165,   363,   798,
-     534,   783,   538,   828,   797,   639,   438,   762,   479,   493,
-     496,   173,   512,  -139,   801,   440,   554,   444,   496,  -142,
-     864,   306,   279,   834,   610,   136,   394,   440,   350,   458,
-     279,   279,   136,   139,   139,    48,   457,   198,   153,   459,
-     444,  -140,   636,   195,   199,   388,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   519,   908,
-     389,   224,   181,   909,   733,   568,  -307,   569,   282,   163,
-     733,   182,   192,   501,   193,     3,   734,   279,    74,   137,
-     564,   138,   734,   165,   225,   211,   137,   281,   138,   117,
-     624,  -372,  -372,   121,  -388,   202,   117,   351,   623,    74,
-     224,   685,  -388,   143,    74,   733,    74,   581,    80,   324,
-     280,   201,  -384,    80,   166,    80,   302,   734,   280,   280,
-     640,  -385,   763,   225,   711,   889,   396,   520,   784,   802,
-     824,   735,   362,   143,   825,   865,   737,   227,   305,   143,
-     315,   328,   787,   364,   799,   143,   143,   611,   829,   606,
-     286,   538,   480,   494,   497,   143,   513,  -139,   139,   520,
-     322,   733,   677,  -142,   296,   280,   143,   835,   565,   441,
-     514,   723,   732,   734,   736,   541,   224,   198,   161,   542,
-     396,   441,   162,    95,   199,  -140,   224,   781,   139,   395,
-     594,   505,   348,   224,   139,   169,   224,   397,   506,   342,
-     139,   139,   338,   622,   190,   381,   172,   541,   507,   158,
-     139,   542,   117,   185,   340,   159,   157,   176,   341,   498,
-     177,   139,   361,   160,   224,   191,   198,   621,   531,   604,
-     532,   136,   395,   199,   395,   202,   179,   352,   117,   692,
-     397,   210,   397,   395,   395,   220,   180,   223,   117,   117,
-     695,   397,   397,   395,  -124,   381,   395,   395,   186,   444,
-     531,   397,   532,   224,   397,   397,   187,   714,  -309,   224,
-     117,   153,   652,   136,  -308,   188,   645,   136,   381,   189,
-     642,   643,   261,   262,   202,   137,   342,   138,   646,   647,
-     136,   648,   498,   205,   376,   117,   531,   451,   532,   224,
-     728,   729,   738,   206,  -307,    74,   117,   456,   742,   743,
-     744,   745,   746,   747,    80,   469,   776,   777,   531,   209,
-     532,   469,   381,   198,   334,    95,   748,   137,   850,   138,
-     199,   137,   691,   138,   200,   143,   208,   117,   201,   715,
-     224,   117,   141,   144,   151,  -309,   152,    74,   198,   214,
-     668,    74,   221,   551,   117,   199,    80,   709,   710,   352,
-      80,   675,   228,   353,    74,   793,   229,   742,   743,   744,
-     745,   746,   747,    80,   224,   211,   198,   230,   232,  -308,
-     687,   202,   143,   199,   894,   749,   750,   218,   233,   275,
-     139,   751,   276,   277,   278,   444,   533,   198,   533,    48,
-     190,   533,   259,   285,   199,   292,   202,   287,   222,   143,
-     288,   143,  -187,   263,   264,   265,   266,   267,   268,   269,
-     270,   271,   272,   273,   274,   140,   140,   293,   392,   295,
-     154,   297,   224,   298,   202,   198,   301,   139,    74,   849,
-     858,   393,   199,   300,   143,   143,   352,    80,   303,   311,
-     143,   588,   143,   143,   309,   202,   374,   330,  -372,  -372,
-     329,   313,   377,   599,   139,   343,   139,    95,   858,   143,
-      85,   372,    87,   469,   469,   469,   395,    88,   381,   580,
-     383,   256,   257,   258,   397,   259,   384,   533,   618,   472,
-     469,   386,   389,   202,   891,   477,   474,   476,   478,   139,
-     139,   483,   475,   349,   158,   139,   354,   139,   139,   627,
-     159,   157,   481,   485,   486,   491,   487,   905,   160,   907,
-     495,   349,   502,   354,   139,   349,   354,   503,   509,   381,
-     381,   515,   518,   529,   528,   813,   530,   381,   381,   535,
-     381,   540,   469,   547,   631,  -409,   559,   533,   820,   549,
-     140,   143,   533,   344,   550,   579,   557,   742,   743,   744,
-     745,   746,   747,   832,   556,   558,   153,   836,   560,   578,
-     566,   582,   839,   840,    95,   748,   571,    85,   843,    87,
-     140,   583,   846,   143,    88,   586,   140,   603,   439,   607,
-     469,   663,   140,   140,   613,   469,   609,   615,    74,   616,
-     620,   393,   140,   520,   443,   630,   139,    80,   634,   635,
-     873,   143,   395,   140,    74,   638,   637,   393,   649,   650,
-     397,   656,   658,    80,   659,   660,   666,   348,   143,   664,
-     671,   667,   670,   679,   749,   750,    95,   682,   139,   684,
-     790,   688,   693,    95,   689,   686,   533,   573,   574,   895,
-     533,   694,   830,   697,   698,    95,   742,   743,   744,   745,
-     746,   747,   471,   154,   585,   701,   139,   702,   471,   703,
-     469,   912,   469,   704,   706,   712,   764,   731,   916,   469,
-     707,   708,   718,   139,  -410,  -410,   251,   252,   253,   254,
-     255,   256,   257,   258,   722,   259,   773,   773,   533,   725,
-     780,   253,   254,   255,   256,   257,   258,   470,   259,   740,
-     766,   726,   760,   470,   469,   761,   629,   767,   768,   769,
-     770,   771,   779,   796,  -143,   786,   788,   791,   789,   263,
-     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   794,   811,   800,   263,   264,   265,   266,   267,   268,
-     269,   270,   271,   272,   273,   274,   805,   806,   815,   814,
-     816,   533,   818,   821,   822,   827,   831,   833,   837,   665,
-     861,   860,   844,   847,  -372,  -372,   469,   862,  -175,   870,
-     469,    95,   140,   874,   876,   877,   878,   881,    95,  -372,
-    -372,   879,   882,   880,   884,   885,   886,   892,   896,   901,
-      95,   900,  -181,   902,    95,   488,   903,    95,    95,   913,
-     911,    95,   904,   516,    95,   632,   872,   915,   469,   724,
-     471,   471,   471,   614,   674,   775,   819,   700,   719,   140,
-     490,   741,   662,   216,   469,   533,   533,   471,   625,   469,
-     705,    95,   661,   690,   716,   875,   717,   601,   307,   469,
-     602,   325,     0,   720,     0,     0,   140,     0,   140,     0,
-       0,     0,     0,    95,   533,   470,   470,   470,  -143,     0,
-       0,     0,     0,     0,   469,     0,     0,   461,   462,     0,
-      95,     0,   470,     0,    95,     0,     0,     0,   765,   471,
-     533,   140,   140,   469,   533,     0,   463,   140,     0,   140,
-     140,     0,     0,     0,     0,     0,     0,   136,   464,     0,
-       0,     0,     0,   533,     0,   533,   140,   465,     0,     0,
-       0,    35,     0,     0,     0,     0,    38,    39,     0,     0,
-       0,     0,     0,     0,   470,     0,     0,   471,     0,     0,
-       0,     0,   471,    44,     0,     0,    47,     0,     0,     0,
-     807,     0,     0,     0,   808,     0,     0,    56,   154,    58,
-      59,   466,    61,   467,     0,     0,     0,     0,     0,     0,
-     468,   117,     0,     0,   142,   142,    70,     0,     0,     0,
-       0,     0,   470,     0,     0,     0,     0,   470,     0,     0,
-       0,     0,   838,     0,     0,     0,     0,     0,   140,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   848,     0,
-       0,     0,     0,   859,     0,     0,   197,   471,     0,   471,
-       0,     0,     0,   867,     0,     0,   471,     0,     0,     0,
-     140,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   883,   259,
-       0,     0,     0,     0,     0,     0,     0,     0,   140,     0,
-       0,   471,   470,     0,   470,     0,     0,   893,     0,     0,
-       0,   470,     0,   119,   120,   140,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-       0,     0,   145,   147,   150,     0,     0,     0,     0,   290,
-     168,     0,     0,     0,     0,   171,   470,     0,     0,     0,
-     175,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   471,     0,     0,     0,   471,     0,   316,
-       0,     0,   196,   323,     0,   326,     0,   207,     0,     0,
-       0,   332,   335,     0,     0,     0,   217,     0,     0,     0,
-       0,   345,     0,     0,     0,     0,  -372,  -372,     0,     0,
-       0,     0,   360,     0,     0,   471,     0,     0,   470,     0,
-       0,     0,   470,     0,     0,     0,     0,     0,   382,     0,
-       0,   471,     0,     0,     0,     0,   471,     0,     0,     0,
-     284,     0,     0,     0,     0,     0,   471,     0,  -410,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-     470,   259,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   471,     0,     0,     0,     0,   470,     0,   382,     0,
-       0,   470,     0,     0,     0,   147,     0,     0,     0,     0,
-     471,   470,     0,     0,     0,     0,   318,     0,   321,   196,
-       0,   382,     0,     0,     0,     0,   331,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   470,     0,   347,     0,
-       0,     0,     0,     0,     0,   355,     0,     0,     0,     0,
-       0,     0,     0,   365,     0,   470,     0,     0,     0,     0,
-     375,     0,     0,     0,   196,   382,     0,     0,     0,     0,
-       0,   390,     0,   398,   399,   400,   402,   403,   404,   405,
-     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
-     416,   417,   418,   419,   420,   421,   422,   423,     0,     0,
-       0,   290,   426,   427,   428,   429,   430,   431,   432,   433,
-     434,   435,   436,   437,   196,     0,   390,     0,   390,   449,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     453,     0,   455,     0,     0,     0,     0,   196,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   555,     0,
-       0,     0,     0,   482,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   489,   234,   235,   236,     0,     0,     0,
-       0,     0,     0,     0,     0,   290,     0,   290,     0,     0,
-     237,   196,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,     0,     0,     0,     0,     0,
-     593,   596,     0,     0,     0,     0,   600,     0,   335,   335,
-       0,   382,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   548,     0,     0,   360,     0,     0,     0,     0,
-     552,  -410,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   628,   259,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   234,   235,
-     236,     0,   382,   382,     0,     0,     0,     0,     0,     0,
-     382,   382,     0,   382,   237,   783,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,     0,
-       0,     0,   681,     0,     0,     0,     0,   673,     0,     0,
-     590,     0,     0,     0,   321,   592,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   196,     0,     0,
-       0,     0,   608,     0,     0,     0,     0,     0,     0,   290,
-       0,     0,     0,     0,     0,     0,     0,     0,   390,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   196,     0,
-       0,     0,     0,     0,     0,     0,     0,   290,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   196,   196,
-       0,     0,   644,     0,   596,     0,   196,   196,     0,   196,
-       0,     0,     0,   390,   653,     0,     0,     0,     0,   655,
-       0,     0,   784,     0,     0,     0,     0,     4,     5,     6,
-       7,     8,     0,     0,     0,     0,     9,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   678,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,   390,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-       0,     0,     0,     0,    27,    28,    29,    30,   390,   390,
-      31,     0,     0,     0,     0,    32,    33,     0,     0,    34,
-      35,    36,     0,    37,     0,    38,    39,    40,     0,   321,
-       0,    41,    42,     0,     0,     0,     0,     0,     0,     0,
-      43,     0,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,     0,    53,     0,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,     0,     0,     0,     0,     0,    63,    64,
+      96,   143,   285,   183,   184,   611,    88,   396,    89,   499,
+      86,   415,   589,   827,   228,   467,   529,   185,   359,   493,
+     303,   143,   317,   354,   786,   444,   365,   450,   472,   735,
+     641,   802,   175,   178,   149,   186,   638,   832,   625,   440,
+     801,   487,   212,   612,   736,   490,   514,  -140,   490,    37,
+     442,   348,   446,   213,  -143,   192,   838,   145,   226,   226,
+     281,   204,   521,   284,   119,   735,   765,   195,   805,   195,
+     396,   442,   868,   536,   467,   540,   196,   167,   196,   281,
+     736,   116,   281,   197,   226,   220,   356,   198,   570,   566,
+     571,  -309,   324,   245,   246,   247,   330,   497,   364,   227,
+     331,   140,   500,   226,   141,   143,   496,   147,   226,   498,
+     446,   173,   195,   626,   195,  -309,   204,   202,   226,   390,
+     297,   196,   281,   196,   227,   142,   119,   147,   350,     3,
+     350,   516,   143,   119,   351,   339,   130,   391,    75,   182,
+     143,   131,   625,   340,   349,   592,   739,   687,    81,   174,
+     143,   143,   328,   312,   148,   522,   333,  -390,   492,   828,
+     728,   729,   893,   829,   229,   250,   642,   199,   713,   199,
+     304,   787,   318,   355,   143,   157,   366,   473,   467,   467,
+     467,   803,   790,   226,   604,   397,   613,   833,   282,   143,
+     488,   363,   467,   624,   491,   515,  -140,   675,   399,   183,
+     184,   723,   766,  -143,   806,   839,   522,   282,   869,  -387,
+     282,   147,   199,   185,   199,    96,   226,   567,   734,  -390,
+     738,   383,   160,   378,   540,   195,    75,   745,   397,   178,
+     397,   581,   161,   195,   196,   198,   283,   263,   147,  -141,
+     265,   399,   196,   399,   140,   346,   147,   141,   397,   397,
+     282,   226,  -386,   467,   602,    75,   147,   147,  -311,   266,
+     137,   399,   399,   195,   694,    81,   153,   623,   142,   119,
+     144,   383,   196,   465,   264,   470,   226,   267,   747,   224,
+     147,    75,  -374,  -310,   397,   154,   268,   397,   397,   155,
+     144,    81,   716,   533,   446,   147,   534,   399,   543,   467,
+     399,   399,   179,   745,   158,   398,   544,   159,   543,   778,
+     779,   495,   654,   644,   645,   164,   544,   647,   119,  -374,
+     165,   648,   649,   697,   650,   199,   748,   749,   750,   383,
+     195,   467,   465,   199,   383,   182,   119,   751,   226,   196,
+     504,   269,   270,   271,   213,  -311,   350,   912,   443,   553,
+     731,   913,   166,   272,   747,   273,   205,    96,  -189,   143,
+     171,   505,   735,   199,   274,   535,   275,   535,   398,   443,
+     535,   172,   693,   506,   144,   740,   226,   736,   340,   467,
+     898,   467,   533,  -310,   276,   534,   467,   140,  -141,   222,
+     141,   225,   533,   735,   666,   534,   737,   711,   712,   209,
+     207,   144,   748,   749,   750,   673,   143,   119,   736,   144,
+     210,   142,   119,   751,   216,   533,   492,   119,   534,   144,
+     144,   223,   230,   231,    75,   467,  -125,   784,   689,   347,
+     199,   143,   352,   143,    81,   232,   465,   465,   465,   797,
+     854,   234,   580,   144,   235,   277,   278,   280,   279,   173,
+     465,   446,   347,    37,   352,   250,   347,   352,   144,   289,
+     143,   143,   290,   296,   294,   147,   143,   394,   143,   143,
+     300,   298,   397,   242,   243,   244,   245,   246,   247,    75,
+     299,   586,   302,   395,   319,   399,   383,   320,   467,    81,
+     535,    96,   467,   143,   597,   332,   226,    88,   179,    89,
+     334,    86,   335,   338,   176,   183,   184,   177,   441,   337,
+     445,   465,   147,   633,   853,   862,   535,   341,   353,   185,
+      75,   535,    75,   374,   395,   629,   395,   620,   142,   119,
+      81,   467,    81,   376,   379,   178,   385,   147,   386,   147,
+     388,    75,   466,   862,   265,   383,   383,   467,   250,   391,
+     471,    81,   467,   383,   383,   474,   383,   465,   663,   456,
+     476,   480,   467,   266,   479,   481,   147,   147,   485,   895,
+     489,   143,   147,   501,   147,   147,   502,   508,   510,   511,
+     517,   267,   520,   816,   530,   531,  -374,   467,   532,   465,
+     268,   537,   909,   542,   911,   549,  -411,   824,   558,   147,
+     551,   466,    96,   552,   559,   560,   467,   143,    88,   562,
+      89,   695,    86,   836,   561,   535,   578,   840,   579,   535,
+     568,   582,   843,  -374,   584,   601,   845,   605,   144,   397,
+     849,   607,   850,   609,   610,   143,   615,   465,   617,   465,
+     622,   182,   399,   618,   465,   269,   270,   271,   143,   140,
+     522,   744,   141,   632,   636,   637,   639,   272,   640,   273,
+     877,   651,   652,   658,    96,   659,   660,   535,   274,   346,
+     275,    96,   745,   142,   119,   144,   664,   147,   665,   668,
+     669,   677,   834,   465,   679,   683,    75,    96,   276,   691,
+     314,   684,   746,   342,   696,   700,    81,   686,   688,   899,
+     144,   690,   144,   699,   703,   466,   466,   466,   704,   705,
+     714,   744,   706,   147,   708,   709,   710,   719,   725,   466,
+     722,   916,   763,   747,   726,   732,   742,  -188,   920,   144,
+     144,   535,   745,   775,   775,   144,   781,   144,   144,   764,
+     767,   147,   769,   770,   771,   772,   465,   773,   782,   783,
+     465,   789,   746,   795,   147,   791,   800,   798,   792,   794,
+     804,   809,   144,  -412,   242,   243,   244,   245,   246,   247,
+     810,   748,   749,   750,   140,   556,   817,   141,   818,   819,
+     466,   814,   751,   747,   822,   825,   826,  -188,   831,   465,
+     835,   837,   841,   752,   753,   847,   851,   864,   142,   119,
+     754,   865,   866,  -177,   179,   465,   535,   535,   878,   873,
+     465,    75,   880,   881,    96,   882,   884,   883,   885,   890,
+     465,    81,    96,   886,   888,   896,   466,   900,   889,   904,
+    -183,   748,   749,   750,    96,   535,   905,   906,    96,   250,
+     144,    96,   751,    96,   252,   465,   907,    96,    96,   256,
+     915,  -144,   265,   752,   753,   917,   875,   919,   466,   518,
+     793,   535,   908,   616,   465,   535,   672,   634,   724,   777,
+     702,   266,   823,   484,   743,    96,   144,   218,   627,   260,
+     733,   261,   879,   662,   535,   707,   535,   661,   692,   267,
+     315,   599,   292,     0,  -374,   600,     0,    96,   268,     0,
+       0,     0,     0,     0,   144,     0,   466,     0,   466,     0,
+       0,     0,     0,   466,    96,     0,     0,   144,    96,   121,
+     122,   123,   124,   125,   127,     0,     0,   132,   133,   135,
+       0,  -374,   136,     0,     0,   139,     0,     0,     0,     0,
+       0,   150,   152,   240,   241,   242,   243,   244,   245,   246,
+     247,     0,   466,   269,   270,   271,     0,   168,   169,     0,
+     170,     0,   265,   468,     0,   272,     0,   273,     0,     0,
+       0,   187,   188,   189,   190,   193,   274,     0,   275,   206,
+       0,   266,   208,     0,   482,     0,     0,   211,     0,     0,
+       0,     0,   219,     0,     0,     0,   276,     0,     0,   267,
+    -144,     0,     0,     0,  -374,     0,     0,     0,   268,     0,
+       0,     0,     0,     0,     0,   466,     0,     0,     0,   466,
+     250,     0,   509,     0,   251,   252,   253,   254,   255,     0,
+     256,     0,   242,   243,   244,   245,   246,   247,     0,     0,
+       0,  -374,     0,     0,     0,   127,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   466,     0,
+     260,     0,   261,   269,   270,   271,     0,     0,   306,   308,
+       0,     0,   311,   193,   466,   272,     0,   273,     0,   466,
+     321,     0,     0,     0,     0,     0,   274,     0,   275,   466,
+       0,     0,     0,     0,     0,     0,     0,   265,     0,     0,
+       0,     0,     0,     0,     0,     0,   276,   250,     0,     0,
+     345,     0,  -412,     0,   466,     0,   266,  -412,     0,     0,
+       0,   357,     0,     0,     0,   146,   573,   574,     0,     0,
+     367,     0,     0,   466,   267,     0,     0,   377,     0,  -374,
+     583,   193,     0,   268,     0,   146,     0,   260,   392,   261,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   194,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,  -374,     0,     0,   428,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   193,     0,   392,     0,   392,   451,     0,   269,   270,
+     271,   631,   453,     0,   455,     0,     0,     0,     0,     0,
+     272,     0,   273,     0,     0,     0,     0,   475,     0,     0,
+       0,   274,     0,   275,     0,     0,     0,     0,   483,   287,
+    -412,   241,   242,   243,   244,   245,   246,   247,     0,     0,
+       0,   276,     0,     0,     0,     0,     0,     0,     0,   193,
+       0,     0,     0,     0,   193,     0,   305,     0,     0,     0,
+       0,     0,   313,     0,   316,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   322,   325,     0,     0,   236,   682,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,     0,     0,     0,     0,     0,     0,     0,   343,     0,
+       0,     0,   248,   249,     0,     0,     0,   250,     0,   550,
+       0,     0,   252,   362,   554,     0,     0,   256,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   717,     0,   718,
+     384,     0,     0,   236,   720,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,     0,   260,     0,   261,
+       0,     0,     0,     0,     0,     0,     0,   248,   249,     0,
+     250,     0,     0,     0,   251,   252,   253,   254,   255,     0,
+     256,     0,     0,   768,   257,   258,   259,     0,     0,     0,
+     384,     0,     0,     0,     0,     0,     0,     0,   588,     0,
+       0,     0,     0,   311,   590,     0,     0,     0,     0,     0,
+     260,     0,   261,     0,     0,     0,   193,     0,     0,     0,
+       0,     0,     0,     0,     0,   250,   608,     0,     0,   251,
+     252,   253,   254,   255,     0,   256,     0,     0,     0,   257,
+     681,   259,     0,     0,     0,   392,   811,     0,   384,     0,
+     812,     0,     0,   384,     0,   193,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   260,     0,   261,     0,     0,
+       0,     0,     0,     0,     0,   193,   193,     0,     0,   646,
+       0,     0,     0,   193,   193,     0,   193,     0,     0,   842,
+     392,   655,     0,   287,     0,     0,   657,     0,     0,     0,
+       0,     0,     0,     0,     0,   852,     0,     0,     0,     0,
+     863,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     871,     0,     0,     0,   236,   676,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,     0,     0,     0,
+     557,     0,     0,     0,     0,   887,     0,     0,   248,   249,
+     392,   240,   241,   242,   243,   244,   245,   246,   247,   457,
+     458,     0,     0,     0,   897,   287,     0,   287,   459,     0,
+       0,   460,     0,     0,     0,   392,   392,     0,     0,     0,
+       0,     0,     0,     0,   461,     0,     0,     0,     0,     0,
+      20,     0,   311,     0,   591,   594,    24,     0,    25,     0,
+     598,     0,   325,   325,     0,   384,   250,     0,     0,     0,
+     251,   252,   253,   254,   255,     0,   256,     0,     0,    32,
+     257,   258,   259,    36,     0,     0,     0,   362,   250,     0,
+       0,     0,  -412,   252,  -412,  -412,  -412,     0,   256,     0,
+       0,     0,     0,     0,   630,    49,   260,    51,   261,     0,
+       0,    52,     0,     0,     0,   462,     0,    55,   463,   785,
+       0,     0,     0,     0,   384,   384,     0,     0,   260,     0,
+     261,   375,   384,   384,     0,   384,    -2,     4,   464,   142,
+     119,     0,     0,     0,     0,     0,    70,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,    11,     0,
+      12,    13,     0,     0,    14,   671,   820,    15,     0,     0,
+       0,     0,    16,    17,    18,     0,     0,     0,    19,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,     0,     0,    29,     0,     0,     0,
+       0,   287,   846,     0,     0,    30,    31,     0,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,    47,     0,     0,   287,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,   594,     0,    53,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+       0,    75,    76,     4,     0,    77,     0,    78,     0,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,    11,     0,    12,    13,     0,     0,
+      14,     0,     0,    15,     0,  -111,     0,     0,    16,    17,
+      18,     0,     0,     0,     0,    20,    21,     0,    22,    23,
+    -111,    24,     0,    25,    26,     0,     0,     0,    27,    28,
+       0,     0,    29,     0,     0,     0,     0,     0,     0,  -111,
+       0,    30,    31,     0,    32,    33,    34,    35,    36,    37,
+      38,    39,   368,    41,     0,    42,    43,    44,    45,     0,
+       0,    46,    47,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,    61,     0,
+       0,     0,     0,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,     0,     0,    75,    76,     4,
+       0,    77,  -111,    78,     0,    79,    80,    81,    82,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,    10,
+      11,     0,    12,    13,     0,     0,    14,     0,     0,    15,
+       0,  -110,     0,     0,    16,    17,    18,     0,     0,     0,
+       0,    20,    21,     0,    22,    23,  -110,    24,     0,    25,
+      26,     0,     0,     0,    27,    28,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,  -110,     0,    30,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,    39,   368,    41,
+       0,    42,    43,    44,    45,     0,     0,    46,    47,     0,
+       0,     0,     0,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,     0,     0,   117,    54,    55,    56,
+       0,    57,     0,     0,     0,     0,     0,     0,    58,     0,
+       0,     0,    59,    60,    61,     0,     0,     0,     0,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,     0,     0,    75,    76,     4,     0,    77,  -110,    78,
+       0,    79,    80,    81,    82,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,    10,    11,     0,    12,    13,
+       0,     0,    14,     0,     0,    15,     0,     0,     0,     0,
+      16,    17,    18,     0,     0,     0,    19,    20,    21,     0,
+      22,    23,     0,    24,     0,    25,    26,     0,     0,     0,
+      27,    28,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,    30,    31,     0,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,     0,    42,    43,    44,
+      45,     0,     0,    46,    47,     0,     0,     0,     0,     0,
+      48,     0,    49,    50,    51,     0,     0,     0,    52,     0,
+       0,     0,    53,    54,    55,    56,     0,    57,     0,     0,
+       0,     0,     0,     0,    58,     0,     0,     0,    59,    60,
+      61,     0,     0,     0,     0,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,     0,    75,
+      76,     4,     0,    77,   603,    78,     0,    79,    80,    81,
+      82,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,    11,     0,    12,    13,     0,     0,    14,     0,
+       0,    15,     0,     0,     0,     0,    16,    17,    18,     0,
+       0,     0,    19,    20,    21,     0,    22,    23,     0,    24,
+       0,    25,    26,     0,     0,     0,    27,    28,     0,     0,
+      29,     0,     0,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,     0,    42,    43,    44,    45,     0,     0,    46,
+      47,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,    53,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,    61,     0,     0,     0,
+       0,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,     0,    75,    76,     4,     0,    77,
+     678,    78,     0,    79,    80,    81,    82,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,    11,     0,
+      12,    13,     0,     0,    14,     0,     0,    15,     0,     0,
+       0,     0,    16,    17,    18,     0,     0,     0,     0,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,  -118,  -118,    29,     0,     0,     0,
+       0,     0,  -118,     0,     0,    30,    31,     0,    32,    33,
+      34,    35,    36,    37,    38,    39,   368,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,    47,     0,     0,     0,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,     0,     0,   117,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,     0,
-      74,    75,     0,    76,   605,    77,     0,    78,    79,    80,
-      81,     0,   782,   234,   235,   236,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,   237,
-     553,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,     0,   259,     0,    10,    11,     0,   817,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,   842,    32,    33,     0,     0,    34,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,     0,    74,
-      75,     0,    76,   680,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,   237,     9,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,    34,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,   366,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,   116,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,   367,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     366,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   116,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   511,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,   721,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   366,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   116,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,     0,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,   739,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,   366,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,   116,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,     0,   259,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,   841,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,   366,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,   116,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,  -410,  -410,  -410,  -410,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,   366,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,   116,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,   863,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     366,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   116,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   866,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   366,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   116,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,   868,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,   869,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,   366,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,   116,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,   366,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,   116,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,   887,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,   366,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,   116,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,   914,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    75,    76,     4,     0,    77,     0,    78,     0,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,    11,     0,    12,    13,     0,     0,
+      14,     0,     0,    15,     0,     0,     0,     0,    16,    17,
+      18,     0,     0,     0,     0,    20,    21,     0,    22,    23,
+       0,    24,     0,    25,    26,     0,     0,     0,    27,    28,
+    -119,  -119,    29,     0,     0,     0,     0,     0,  -119,     0,
+       0,    30,    31,     0,    32,    33,    34,    35,    36,    37,
+      38,    39,   368,    41,     0,    42,    43,    44,    45,     0,
+       0,    46,    47,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,    61,     0,
+       0,     0,     0,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,     0,     0,    75,    76,     4,
+       0,    77,     0,    78,     0,    79,    80,    81,    82,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,    10,
+      11,     0,    12,    13,     0,     0,    14,     0,     0,    15,
+       0,     0,     0,     0,    16,    17,    18,     0,     0,     0,
+       0,    20,    21,     0,    22,    23,     0,    24,     0,    25,
+      26,     0,     0,     0,    27,    28,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,     0,     0,    30,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,    39,   368,    41,
+       0,    42,    43,    44,    45,     0,     0,    46,    47,     0,
+       0,     0,     0,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,     0,     0,   117,    54,    55,    56,
+       0,    57,     0,     0,     0,     0,     0,     0,    58,     0,
+       0,     0,    59,    60,    61,     0,     0,     0,     0,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,     0,     0,    75,    76,     4,     0,    77,   369,    78,
+       0,    79,    80,    81,    82,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,    10,    11,     0,    12,    13,
+       0,     0,    14,     0,     0,    15,     0,     0,     0,     0,
+      16,    17,    18,     0,     0,     0,     0,    20,    21,     0,
+      22,    23,     0,    24,     0,    25,    26,     0,     0,     0,
+      27,    28,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,    30,    31,     0,    32,    33,    34,    35,
+      36,    37,    38,    39,   368,    41,     0,    42,    43,    44,
+      45,     0,     0,    46,    47,     0,     0,     0,     0,     0,
+      48,     0,    49,    50,    51,     0,     0,     0,    52,     0,
+       0,     0,   117,    54,    55,    56,     0,    57,     0,     0,
+       0,     0,     0,     0,    58,     0,     0,     0,    59,    60,
+      61,     0,     0,     0,     0,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,     0,     0,    75,
+      76,     4,     0,    77,   513,    78,     0,    79,    80,    81,
+      82,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,    11,     0,    12,    13,     0,     0,    14,     0,
+       0,    15,     0,     0,     0,     0,    16,    17,    18,     0,
+       0,     0,     0,    20,    21,     0,    22,    23,     0,    24,
+       0,    25,    26,     0,     0,     0,    27,    28,     0,     0,
+      29,     0,   721,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,    33,    34,    35,    36,    37,    38,    39,
+     368,    41,     0,    42,    43,    44,    45,     0,     0,    46,
+      47,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,    61,     0,     0,     0,
+       0,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,     0,     0,    75,    76,     4,     0,    77,
+       0,    78,     0,    79,    80,    81,    82,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,    11,     0,
+      12,    13,     0,     0,    14,     0,     0,    15,     0,     0,
+       0,     0,    16,    17,    18,     0,     0,     0,     0,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,     0,     0,    29,     0,     0,     0,
+       0,     0,     0,     0,   741,    30,    31,     0,    32,    33,
+      34,    35,    36,    37,    38,    39,   368,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,    47,     0,     0,     0,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,     0,     0,   117,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,     0,
+       0,    75,    76,     4,     0,    77,     0,    78,     0,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,    11,     0,    12,    13,     0,     0,
+      14,     0,     0,    15,     0,     0,     0,     0,    16,    17,
+      18,     0,     0,     0,     0,    20,    21,     0,    22,    23,
+       0,    24,     0,    25,    26,     0,     0,     0,    27,    28,
+       0,     0,    29,     0,     0,     0,   844,     0,     0,     0,
+       0,    30,    31,     0,    32,    33,    34,    35,    36,    37,
+      38,    39,   368,    41,     0,    42,    43,    44,    45,     0,
+       0,    46,    47,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,    61,     0,
+       0,     0,     0,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,     0,     0,    75,    76,     4,
+       0,    77,     0,    78,     0,    79,    80,    81,    82,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,    10,
+      11,     0,    12,    13,     0,     0,    14,     0,     0,    15,
+       0,     0,     0,     0,    16,    17,    18,     0,     0,     0,
+       0,    20,    21,     0,    22,    23,     0,    24,     0,    25,
+      26,     0,     0,     0,    27,    28,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,     0,     0,    30,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,    39,   368,    41,
+       0,    42,    43,    44,    45,     0,     0,    46,    47,     0,
+       0,     0,     0,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,     0,     0,   117,    54,    55,    56,
+       0,    57,     0,     0,     0,     0,     0,     0,    58,     0,
+       0,     0,    59,    60,    61,     0,     0,     0,     0,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,     0,     0,    75,    76,     4,     0,    77,   867,    78,
+       0,    79,    80,    81,    82,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,    10,    11,     0,    12,    13,
+       0,     0,    14,     0,     0,    15,     0,     0,     0,     0,
+      16,    17,    18,     0,     0,     0,     0,    20,    21,     0,
+      22,    23,     0,    24,     0,    25,    26,     0,     0,     0,
+      27,    28,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,    30,    31,     0,    32,    33,    34,    35,
+      36,    37,    38,    39,   368,    41,     0,    42,    43,    44,
+      45,     0,     0,    46,    47,     0,     0,     0,     0,     0,
+      48,     0,    49,    50,    51,     0,     0,     0,    52,     0,
+       0,     0,   117,    54,    55,    56,     0,    57,     0,     0,
+       0,     0,     0,     0,    58,     0,     0,     0,    59,    60,
+      61,     0,     0,     0,     0,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,     0,     0,    75,
+      76,     4,     0,    77,   870,    78,     0,    79,    80,    81,
+      82,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,    11,     0,    12,    13,     0,     0,    14,     0,
+       0,    15,     0,     0,     0,     0,    16,    17,    18,     0,
+       0,     0,     0,    20,    21,     0,    22,    23,     0,    24,
+       0,    25,    26,     0,     0,     0,    27,    28,     0,     0,
+      29,     0,     0,   872,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,    33,    34,    35,    36,    37,    38,    39,
+     368,    41,     0,    42,    43,    44,    45,     0,     0,    46,
+      47,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,    61,     0,     0,     0,
+       0,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,     0,     0,    75,    76,     4,     0,    77,
+       0,    78,     0,    79,    80,    81,    82,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,    11,     0,
+      12,    13,     0,     0,    14,     0,     0,    15,     0,     0,
+       0,     0,    16,    17,    18,     0,     0,     0,     0,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,     0,     0,    29,     0,     0,     0,
+       0,     0,  -123,     0,     0,    30,    31,     0,    32,    33,
+      34,    35,    36,    37,    38,    39,   368,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,    47,     0,     0,     0,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,     0,     0,   117,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,     0,
+       0,    75,    76,     4,     0,    77,     0,    78,     0,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,    11,     0,    12,    13,     0,     0,
+      14,     0,     0,    15,     0,     0,     0,     0,    16,    17,
+      18,     0,     0,     0,     0,    20,    21,     0,    22,    23,
+       0,    24,     0,    25,    26,     0,     0,     0,    27,    28,
+       0,     0,    29,     0,     0,     0,     0,     0,     0,     0,
+       0,    30,    31,     0,    32,    33,    34,    35,    36,    37,
+      38,    39,   368,    41,     0,    42,    43,    44,    45,     0,
+       0,    46,    47,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,    61,     0,
+       0,     0,     0,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,     0,     0,    75,    76,     4,
+       0,    77,   876,    78,     0,    79,    80,    81,    82,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,    10,
+      11,     0,    12,    13,     0,     0,    14,     0,     0,    15,
+       0,     0,     0,     0,    16,    17,    18,     0,     0,     0,
+       0,    20,    21,     0,    22,    23,     0,    24,     0,    25,
+      26,     0,     0,     0,    27,    28,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,     0,     0,    30,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,    39,   368,    41,
+       0,    42,    43,    44,    45,     0,     0,    46,    47,     0,
+       0,     0,     0,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,     0,     0,   117,    54,    55,    56,
+       0,    57,     0,     0,     0,     0,     0,     0,    58,     0,
+       0,     0,    59,    60,    61,     0,     0,     0,     0,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,     0,     0,    75,    76,     4,     0,    77,   891,    78,
+       0,    79,    80,    81,    82,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,    10,    11,     0,    12,    13,
+       0,     0,    14,     0,     0,    15,     0,     0,     0,     0,
+      16,    17,    18,     0,     0,     0,     0,    20,    21,     0,
+      22,    23,     0,    24,     0,    25,    26,     0,     0,     0,
+      27,    28,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,    30,    31,     0,    32,    33,    34,    35,
+      36,    37,    38,    39,   368,    41,     0,    42,    43,    44,
+      45,     0,     0,    46,    47,     0,     0,     0,     0,     0,
+      48,     0,    49,    50,    51,     0,     0,     0,    52,     0,
+       0,     0,   117,    54,    55,    56,     0,    57,     0,     0,
+       0,     0,     0,     0,    58,     0,     0,     0,    59,    60,
+      61,     0,     0,     0,     0,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,     0,     0,    75,
+      76,     4,     0,    77,   918,    78,     0,    79,    80,    81,
+      82,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,    11,     0,    12,    13,     0,     0,    14,     0,
+       0,    15,     0,     0,     0,     0,    16,    17,    18,     0,
+       0,     0,     0,    20,    21,     0,    22,    23,     0,    24,
+       0,    25,    26,     0,     0,     0,    27,    28,     0,     0,
+      29,     0,     0,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,    33,    34,    35,    36,    37,    38,    39,
+     368,    41,     0,    42,    43,    44,    45,     0,     0,    46,
+      47,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,    61,     0,     0,     0,
+       0,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,     0,     0,    75,    76,     4,     0,    77,
+     921,    78,   585,    79,    80,    81,    82,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,     0,     0,
+      12,    13,     0,     0,    14,     0,     0,    15,     0,     0,
+       0,     0,     0,    17,    18,     0,     0,     0,     0,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,     0,     0,    29,     0,     0,     0,
+       0,     0,     0,     0,     0,    30,    31,     0,    32,     0,
+      34,    35,    36,    37,    38,    39,     0,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,     0,     0,     0,     0,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,     0,     0,   117,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
+      65,    66,    67,    68,     0,    70,    71,    72,    73,     0,
+       0,    75,    76,     4,     0,    77,     0,    78,   596,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,     0,     0,    12,    13,     0,     0,
+      14,     0,     0,    15,     0,     0,     0,     0,     0,    17,
+      18,     0,     0,     0,     0,    20,    21,     0,    22,    23,
+       0,    24,     0,    25,    26,     0,     0,     0,    27,    28,
+       0,     0,    29,     0,     0,     0,     0,     0,     0,     0,
+       0,    30,    31,     0,    32,     0,    34,    35,    36,    37,
+      38,    39,     0,    41,     0,    42,    43,    44,    45,     0,
+       0,    46,     0,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,    61,     0,
+       0,     0,     0,    62,    63,    64,    65,    66,    67,    68,
+       0,    70,    71,    72,    73,     0,     0,    75,    76,     4,
+       0,    77,     0,    78,   619,    79,    80,    81,    82,     0,
+       5,     6,     0,     0,     0,     0,     7,     8,     9,    10,
+       0,     0,    12,    13,     0,     0,    14,     0,     0,    15,
+       0,     0,     0,     0,     0,    17,    18,     0,     0,     0,
+       0,    20,    21,     0,    22,    23,     0,    24,     0,    25,
+      26,     0,     0,     0,    27,    28,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,     0,     0,    30,    31,     0,
+      32,     0,    34,    35,    36,    37,    38,    39,     0,    41,
+       0,    42,    43,    44,    45,     0,     0,    46,     0,     0,
+       0,     0,     0,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,     0,     0,   117,    54,    55,    56,
+       0,    57,     0,     0,     0,     0,     0,     0,    58,     0,
+       0,     0,    59,    60,    61,     0,     0,     0,     0,    62,
+      63,    64,    65,    66,    67,    68,     0,    70,    71,    72,
+      73,     0,     0,    75,    76,     4,     0,    77,     0,    78,
+     774,    79,    80,    81,    82,     0,     5,     6,     0,     0,
+       0,     0,     7,     8,     9,    10,     0,     0,    12,    13,
+       0,     0,    14,     0,     0,    15,     0,     0,     0,     0,
+       0,    17,    18,     0,     0,     0,     0,    20,    21,     0,
+      22,    23,     0,    24,     0,    25,    26,     0,     0,     0,
+      27,    28,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,    30,    31,     0,    32,     0,    34,    35,
+      36,    37,    38,    39,     0,    41,     0,    42,    43,    44,
+      45,     0,     0,    46,     0,     0,     0,     0,     0,     0,
+      48,     0,    49,    50,    51,     0,     0,     0,    52,     0,
+       0,     0,   117,    54,    55,    56,     0,    57,     0,     0,
+       0,     0,     0,     0,    58,     0,     0,     0,    59,    60,
+      61,     0,     0,     0,     0,    62,    63,    64,    65,    66,
+      67,    68,     0,    70,    71,    72,    73,     0,     0,    75,
+      76,     4,     0,    77,     0,    78,   813,    79,    80,    81,
+      82,     0,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,     0,     0,    12,    13,     0,     0,    14,     0,
+       0,    15,     0,     0,     0,     0,     0,    17,    18,     0,
+       0,     0,     0,    20,    21,     0,    22,    23,     0,    24,
+       0,    25,    26,     0,     0,     0,    27,    28,     0,     0,
+      29,     0,     0,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,     0,    34,    35,    36,    37,    38,    39,
+       0,    41,     0,    42,    43,    44,    45,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,    61,     0,     0,     0,
+       0,    62,    63,    64,    65,    66,    67,    68,     0,    70,
+      71,    72,    73,     0,     0,    75,    76,     4,     0,    77,
+       0,    78,     0,    79,    80,    81,    82,     0,     5,     6,
+       0,     0,     0,     0,     7,     8,     9,    10,     0,     0,
+      12,    13,     0,     0,    14,     0,     0,    15,     0,     0,
+       0,     0,     0,    17,    18,     0,     0,     0,     0,    20,
+      21,     0,    22,    23,     0,    24,     0,    25,    26,     0,
+       0,     0,    27,    28,     0,     0,    29,     0,     0,     0,
+       0,     0,     0,     0,     0,    30,    31,     0,    32,     0,
+      34,    35,    36,    37,    38,    39,     0,    41,     0,    42,
+      43,    44,    45,     0,     0,    46,     0,     0,     0,     0,
+       0,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,     0,     0,   117,    54,    55,    56,     0,    57,
+       0,     0,     0,     0,     0,     0,    58,     0,     0,     0,
+      59,    60,    61,     0,     0,     0,     0,    62,    63,    64,
+      65,    66,    67,    68,     0,    70,    71,    72,    73,     0,
+       0,    75,    76,     0,     0,    77,     0,    78,   400,    79,
+      80,    81,    82,     0,     5,     6,     0,     0,     0,     0,
+       7,     8,     9,    10,     0,     0,    12,    13,     0,     0,
+      14,     0,     0,     0,     0,     0,     0,     0,     0,    17,
+      18,     0,     0,     0,     0,    20,     0,     0,    22,     0,
+       0,    24,     0,    25,     0,     0,     0,     0,    27,     0,
+       0,     0,    29,     0,     0,     0,     0,     0,     0,     0,
+       0,    30,    31,     0,    32,     0,     0,     0,    36,    37,
+       0,     0,     0,     0,     0,    42,    43,    44,     0,     0,
+       0,    46,     0,     0,     0,     0,     0,     0,    48,     0,
+      49,    50,    51,     0,     0,     0,    52,     0,     0,     0,
+     117,    54,    55,    56,     0,    57,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,    59,    60,     0,     0,
+       0,     0,     0,    62,   118,   119,    65,    66,     0,     0,
+       0,    70,     0,     0,    73,     0,     0,    75,     0,     0,
+       0,     0,     0,    78,     0,     0,    80,    81,    82,   236,
+     786,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   248,   249,     0,     0,     0,   236,     0,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   248,   249,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     366,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   116,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   917,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   250,     0,     0,     0,   251,   252,   253,   254,   255,
+       0,   256,     0,     0,     0,   257,   258,   259,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   366,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   116,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,     0,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   587,
+     250,     0,     0,     0,   251,   252,   253,   254,   255,     0,
+     256,   260,     0,   261,   257,   258,   259,     0,     0,   236,
+       0,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,     0,     0,     0,     0,     0,   787,     0,     0,
+     260,     0,   261,   248,   249,     0,     0,     0,   236,     0,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,     0,     0,     0,     0,     0,   262,     0,     0,     0,
+       0,     0,   248,   249,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,     0,    52,
-       0,    53,     0,     0,    55,    56,    57,    58,    59,   116,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,     0,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   598,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,     0,    52,     0,    53,     0,     0,    55,    56,
-      57,    58,    59,   116,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,     0,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   617,     0,     0,
+       0,   250,     0,     0,     0,   251,   252,   253,   254,   255,
+       0,   256,     0,     0,     0,   257,   258,   259,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,     0,     0,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,     0,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,     0,    52,     0,    53,
-       0,     0,    55,    56,    57,    58,    59,   116,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,     0,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,     0,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+     250,     0,     0,     0,   251,   252,   253,   254,   255,     0,
+     256,   260,     0,   261,   257,   258,   259,     0,     0,   236,
+       0,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,     0,     0,     0,     0,     0,   293,     0,     0,
+     260,     0,   261,   248,   249,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   772,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-       0,    52,     0,    53,     0,     0,    55,    56,    57,    58,
-      59,   116,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,     0,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,     0,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   810,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   295,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,     0,    52,     0,    53,     0,     0,
-      55,    56,    57,    58,    59,   116,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,     0,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,     0,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
+       0,     0,     0,     0,   126,     0,     0,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,   250,     0,    14,     0,   251,   252,   253,   254,   255,
+       0,   256,    17,    18,     0,   257,   258,   259,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,   260,     0,   261,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,   358,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   380,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   427,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   452,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   454,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   628,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,   656,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,     0,     0,    78,     0,     0,    80,
+      81,    82,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   248,   249,     0,     0,
+       0,   236,     0,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,   249,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,     0,    52,
-       0,    53,     0,     0,    55,    56,    57,    58,    59,   116,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,     0,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,   477,
+       0,     0,     0,   260,     0,   261,   248,   249,     0,     0,
+       0,   236,     0,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,   478,     0,
+       0,     0,     0,     0,     0,   248,   249,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   146,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,   115,
-      30,     0,     0,     0,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,     0,     0,     0,     0,    38,    39,
-       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,     0,     0,    47,    48,
-       0,     0,     0,     0,     0,     0,     0,     0,    55,    56,
-      57,    58,    59,   116,    61,    62,     4,     5,     6,     7,
-       8,     0,    64,   117,    66,     9,     0,     0,    70,     0,
-       0,     0,     0,    74,     0,     0,     0,     0,    77,     0,
-       0,    79,    80,    81,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,   115,    30,     0,     0,     0,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-       0,     0,     0,     0,    38,    39,     0,     0,     0,     0,
-       0,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,     0,     0,    47,    48,     0,     0,     0,     0,
-       0,     0,     0,     0,    55,    56,    57,    58,    59,   116,
-      61,    62,     4,     5,     6,     7,     8,     0,    64,   117,
-      66,     9,     0,     0,    70,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,    77,     0,   167,    79,    80,    81,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,   115,    30,     0,     0,     0,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,     0,     0,     0,     0,
-      38,    39,     0,     0,     0,     0,     0,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,     0,     0,
-      47,    48,     0,     0,     0,     0,     0,     0,     0,     0,
-      55,    56,    57,    58,    59,   116,    61,    62,     4,     5,
-       6,     7,     8,     0,    64,   117,    66,     9,     0,     0,
-      70,     0,     0,     0,     0,    74,     0,     0,     0,     0,
-      77,     0,   170,    79,    80,    81,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,   115,    30,     0,
-       0,     0,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,     0,     0,     0,     0,    38,    39,     0,     0,
-       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,     0,     0,    47,    48,     0,     0,
-       0,     0,     0,     0,     0,     0,    55,    56,    57,    58,
-      59,   116,    61,    62,     4,     5,     6,     7,     8,     0,
-      64,   117,    66,     9,     0,     0,    70,     0,     0,     0,
-       0,    74,     0,     0,     0,     0,    77,     0,   194,    79,
-      80,    81,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,     0,     0,   115,    30,     0,     0,     0,     0,     0,
-       0,     0,     0,    33,     0,     0,     0,    35,     0,     0,
-       0,     0,    38,    39,     0,     0,     0,     0,     0,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-       0,     0,    47,    48,     0,     0,     0,     0,     0,     0,
-       0,     0,    55,    56,    57,    58,    59,   116,    61,    62,
-       4,     5,     6,     7,     8,     0,    64,   117,    66,     9,
-       0,     0,    70,     0,     0,     0,     0,    74,     0,     0,
-       0,     0,    77,   317,     0,    79,    80,    81,   378,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,   115,
-      30,     0,     0,     0,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,     0,     0,     0,     0,    38,    39,
-       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,     0,     0,    47,    48,
-       0,     0,     0,     0,     0,     0,     0,     0,    55,    56,
-      57,    58,    59,   116,    61,    62,     4,     5,     6,     7,
-       8,     0,    64,   117,    66,     9,     0,     0,    70,     0,
-       0,     0,     0,    74,     0,     0,     0,     0,    77,   401,
-       0,    79,    80,    81,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,   115,    30,     0,     0,     0,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-       0,     0,     0,     0,    38,    39,     0,     0,     0,     0,
-       0,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,     0,     0,    47,    48,     0,     0,     0,     0,
-       0,     0,     0,     0,    55,    56,    57,    58,    59,   116,
-      61,    62,     4,     5,     6,     7,     8,     0,    64,   117,
-      66,     9,     0,     0,    70,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,    77,     0,     0,    79,    80,    81,
-     425,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,   115,    30,     0,     0,     0,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,     0,     0,     0,     0,
-      38,    39,     0,     0,     0,     0,     0,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,     0,     0,
-      47,    48,     0,     0,     0,     0,     0,     0,     0,     0,
-      55,    56,    57,    58,    59,   116,    61,    62,     4,     5,
-       6,     7,     8,     0,    64,   117,    66,     9,     0,     0,
-      70,     0,     0,     0,     0,    74,     0,     0,     0,     0,
-      77,     0,     0,    79,    80,    81,   452,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,   115,    30,     0,
-       0,     0,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,     0,     0,     0,     0,    38,    39,     0,     0,
-       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,     0,     0,    47,    48,     0,     0,
-       0,     0,     0,     0,     0,     0,    55,    56,    57,    58,
-      59,   116,    61,    62,     4,     5,     6,     7,     8,     0,
-      64,   117,    66,     9,     0,     0,    70,     0,     0,     0,
-       0,    74,     0,     0,     0,     0,    77,     0,     0,    79,
-      80,    81,   454,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,     0,     0,   115,    30,     0,     0,     0,     0,     0,
-       0,     0,     0,    33,     0,     0,     0,    35,     0,     0,
-       0,     0,    38,    39,     0,     0,     0,     0,     0,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-       0,     0,    47,    48,     0,     0,     0,     0,     0,     0,
-       0,     0,    55,    56,    57,    58,    59,   116,    61,    62,
-       4,     5,     6,     7,     8,     0,    64,   117,    66,     9,
-       0,     0,    70,     0,     0,     0,     0,    74,     0,     0,
-       0,     0,    77,     0,     0,    79,    80,    81,   626,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,   115,
-      30,     0,     0,     0,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,     0,     0,     0,     0,    38,    39,
-       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,     0,     0,    47,    48,
-       0,     0,     0,     0,     0,     0,     0,     0,    55,    56,
-      57,    58,    59,   116,    61,    62,     4,     5,     6,     7,
-       8,     0,    64,   117,    66,     9,     0,     0,    70,     0,
-       0,     0,     0,    74,     0,     0,     0,     0,    77,     0,
-       0,    79,    80,    81,   654,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,   115,    30,     0,     0,     0,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-       0,     0,     0,     0,    38,    39,     0,     0,     0,     0,
-       0,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,     0,     0,    47,    48,     0,     0,     0,     0,
-       0,     0,     0,     0,    55,    56,    57,    58,    59,   116,
-      61,    62,     4,     5,     6,     7,     8,     0,    64,   117,
-      66,     9,     0,     0,    70,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,    77,     0,     0,    79,    80,    81,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,   486,
+       0,     0,     0,   260,     0,   261,   248,   249,     0,     0,
+       0,   236,     0,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,   512,     0,
+       0,     0,     0,     0,     0,   248,   249,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,   115,    30,     0,     0,     0,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,     0,     0,     0,     0,
-      38,    39,     0,     0,     0,     0,     0,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,     0,     0,
-      47,    48,     0,     0,     0,     0,     0,     0,     0,     0,
-      55,    56,    57,    58,    59,   116,    61,    62,     4,     5,
-       6,     7,     8,     0,    64,   117,    66,     9,     0,     0,
-      70,     0,     0,     0,     0,    74,     0,     0,     0,     0,
-      77,     0,     0,    79,    80,    81,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,   115,    30,     0,
-       0,     0,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,     0,     0,     0,     0,    38,    39,     0,     0,
-       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,     0,     0,    47,    48,     0,     0,
-       0,     0,     0,     0,     0,     0,    55,    56,    57,    58,
-      59,   116,    61,    62,     0,     0,     0,     0,     0,     0,
-      64,   117,   346,     0,     0,     0,    70,   234,   235,   236,
-       0,    74,     0,     0,     0,     0,    77,     0,     0,    79,
-      80,    81,     0,   237,     0,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,     0,   259,   234,   235,
-     236,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   237,     0,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,   234,
-     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   237,     0,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,     0,     0,     0,   234,   235,   236,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     237,   260,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,   234,   235,   236,     0,     0,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,   519,
+       0,     0,     0,   260,     0,   261,   248,   249,     0,     0,
+       0,   236,     0,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,   667,     0,
+       0,     0,     0,     0,     0,   248,   249,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,   308,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,   234,   235,   236,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   237,   310,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,     0,     0,     0,
-       0,   234,   235,   236,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   237,   356,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,   234,   235,   236,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   373,   237,
-       0,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,     0,   259,   234,   235,   236,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   450,
-     237,     0,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,     0,     0,   234,   235,   236,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,   848,
+       0,     0,     0,   260,     0,   261,   248,   249,     0,     0,
+       0,   236,     0,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,   874,     0,
+       0,     0,     0,     0,     0,   248,   249,     0,     0,     0,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   250,     0,   248,   249,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   237,   484,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,     0,   259,     0,   234,
-     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   237,   492,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-     234,   235,   236,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   237,   510,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,     0,
-     259,     0,     0,   234,   235,   236,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   237,
-     517,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,     0,   259,     0,   234,   235,   236,     0,     0,
+       0,     0,     0,     0,   250,     0,     0,   503,   251,   252,
+     253,   254,   255,   260,   256,   261,     0,     0,   257,   258,
+     259,     0,     0,   236,     0,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   528,     0,     0,     0,
+       0,     0,     0,     0,   260,     0,   261,   248,   249,     0,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,   569,     0,     0,
+       0,     0,     0,     0,     0,     0,   248,   249,     0,     0,
+       0,     0,     0,   236,     0,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   250,     0,   248,   249,   251,
+     252,   253,   254,   255,     0,   256,     0,     0,     0,   257,
+     258,   259,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,     0,   256,   260,     0,   261,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   250,     0,     0,   595,   251,
+     252,   253,   254,   255,   260,   256,   261,     5,     6,   257,
+     258,   259,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,   643,     0,     0,
+       0,     0,    17,    18,     0,   260,     0,   261,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,   715,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,     0,     0,    78,     0,   134,    80,
+      81,    82,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,     0,     0,    12,    13,     0,     0,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    17,    18,     0,
+       0,     0,     0,    20,     0,     0,    22,     0,     0,    24,
+       0,    25,     0,     0,     0,     0,    27,     0,     0,     0,
+      29,     0,     0,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,     0,     0,     0,    36,    37,     0,     0,
+       0,     0,     0,    42,    43,    44,     0,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,     0,     0,     0,     0,
+       0,    62,   118,   119,    65,    66,     0,     0,     0,    70,
+       0,     0,    73,     0,     0,    75,     0,     0,     0,     0,
+       0,    78,     0,   138,    80,    81,    82,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,     0,     0,    78,     0,   191,    80,
+      81,    82,     5,     6,     0,     0,     0,     0,     7,     8,
+       9,    10,     0,     0,    12,    13,     0,     0,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    17,    18,     0,
+       0,     0,     0,    20,     0,     0,    22,     0,     0,    24,
+       0,    25,     0,     0,     0,     0,    27,     0,     0,     0,
+      29,     0,     0,     0,     0,     0,     0,     0,     0,    30,
+      31,     0,    32,     0,     0,     0,    36,    37,     0,     0,
+       0,     0,     0,    42,    43,    44,     0,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,     0,     0,   117,    54,
+      55,    56,     0,    57,     0,     0,     0,     0,     0,     0,
+      58,     0,     0,     0,    59,    60,     0,     0,     0,     0,
+       0,    62,   118,   119,    65,    66,     0,     0,     0,    70,
+       0,     0,    73,     0,     0,    75,     0,     0,     0,     0,
+       0,    78,   307,     0,    80,    81,    82,     5,     6,     0,
+       0,     0,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+      66,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,     0,     0,    78,     5,     6,    80,
+      81,    82,     0,     7,     8,     9,    10,     0,     0,    12,
+      13,     0,     0,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    17,    18,     0,     0,     0,     0,    20,     0,
+       0,    22,     0,     0,    24,     0,    25,     0,     0,     0,
+       0,    27,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,     0,    30,    31,     0,    32,     0,     0,
+       0,    36,    37,     0,     0,     0,     0,     0,    42,    43,
+      44,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,     0,     0,   117,    54,    55,    56,     0,    57,     0,
+       0,     0,     0,     0,     0,    58,     0,     0,     0,    59,
+      60,     0,     0,     0,     0,     0,    62,   118,   119,    65,
+     344,     0,     0,     0,    70,     0,     0,    73,     0,     0,
+      75,     0,     0,     0,     0,     0,    78,     0,     0,    80,
+      81,    82,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   248,   249,     0,     0,
+       0,   236,   555,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,     0,     0,
+       0,     0,   288,     0,     0,   248,   249,     0,     0,     0,
+       0,     0,   236,     0,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   250,     0,   248,   249,   251,   252,
+     253,   254,   255,     0,   256,     0,     0,     0,   257,   258,
+     259,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   572,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,   260,     0,   261,   257,   258,   259,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,   669,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,   234,   235,   236,     0,
+       0,     0,     0,     0,   250,     0,     0,     0,   251,   252,
+     253,   254,   255,   260,   256,   261,     0,     0,   257,   258,
+     259,     0,     0,   236,     0,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,     0,     0,     0,     0,
+       0,     0,     0,     0,   260,     0,   261,   248,   249,     0,
+     236,     0,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,   249,   236,     0,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   237,   845,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,     0,     0,   234,
-     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   237,   871,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,   234,   235,   236,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   504,   237,     0,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,   234,   235,   236,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   526,   237,     0,
+     248,   249,     0,     0,     0,   250,     0,     0,     0,   251,
+     252,   253,   254,   255,     0,   256,     0,     0,     0,   257,
+     258,   259,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   250,     0,     0,     0,   251,   252,   253,   254,
+     255,     0,   256,     0,     0,   260,   257,   261,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   250,     0,
+       0,     0,   251,   252,   253,   254,   255,     0,   256,     0,
+       0,     0,   260,     0,   261,     0,     0,     0,     0,   237,
      238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,   234,   235,   236,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   237,
-     567,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,     0,   259,     0,   234,   235,   236,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   260,     0,
+     261,   248,   249,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,     0,     0,     0,
+       0,     0,     0,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,     0,     0,     0,     0,     0,     0,   250,
+       0,     0,     0,   251,   252,   253,   254,   255,     0,   256,
+       0,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+       0,     0,     0,   250,     0,     0,     0,   251,   252,   253,
+     254,   255,     0,   256,     0,     0,     0,     0,     0,   260,
+       0,   261,     0,     0,     0,     0,   250,     0,     0,     0,
+     251,   252,   253,   254,   255,     0,   256,     0,     0,     0,
+       0,     0,   250,   260,     0,   261,   251,   252,   253,   254,
+     255,     0,   256,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   260,     0,   261,   250,
+       0,     0,     0,   251,   252,   253,   254,   255,     0,   256,
+       0,     0,   260,     0,   261,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,   597,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,   234,   235,   236,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   237,   641,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,   234,   235,   236,
-       0,     0,   291,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   237,   713,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,     0,   259,   235,   236,
-       0,     0,     0,   570,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   237,     0,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   236,   259,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     237,     0,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   260,
+       0,   261
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-723))
-
-#define yytable_value_is_error(yytable_value) \
-  ((yytable_value) == (-410))
-
 static const yytype_int16 yycheck[] =
 {
-       2,   208,   233,     2,   118,     2,    26,   475,    21,    22,
-       2,   259,    26,    26,   301,   277,   485,   279,   339,     8,
-      26,   378,     8,     8,   521,     8,     8,    29,     8,     8,
-     384,    26,   386,     8,   756,    31,   275,    31,     8,     8,
-       8,    40,     8,     8,    31,   276,    63,   278,     8,     8,
-      31,   165,    61,     8,    26,    72,   287,   288,    61,   298,
-      61,    61,    72,    21,    22,   112,   297,    88,    26,   300,
-     301,     8,   540,    63,    95,   136,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    61,   149,
-     151,   128,   146,   153,    78,   452,   133,   454,   112,   146,
-      78,   155,    60,   342,    62,     0,    90,    61,   146,   126,
-      61,   128,    90,   115,   151,    73,   126,   155,   128,   136,
-      61,    58,    59,   151,   133,   146,   136,   130,   625,   146,
-     128,   611,   133,   146,   146,    78,   146,    99,   155,   149,
-     149,   103,   151,   155,   151,   155,   160,    90,   149,   149,
-     146,   151,   146,   151,   651,   877,   233,   130,   153,   146,
-     149,   104,    74,   176,   153,   146,   150,   153,   153,   182,
-     153,   153,   150,   153,   153,   188,   189,   149,   153,   500,
-     138,   535,   152,   152,   152,   198,   152,   152,   146,   130,
-     180,    78,   152,   152,   152,   149,   209,   152,   149,   276,
-      74,   670,   682,    90,   684,    73,   128,    88,    81,    77,
-     287,   288,    81,   215,    95,   152,   128,   104,   176,   233,
-      31,   129,   103,   128,   182,   136,   128,   233,   136,   151,
-     188,   189,   190,   520,   128,   225,   151,    73,   146,   259,
-     198,    77,   136,   136,   149,   259,   259,   151,   153,   151,
-     151,   209,   210,   259,   128,   149,    88,   519,   126,   498,
-     128,    72,   276,    95,   278,   146,   151,    99,   136,   626,
-     276,   128,   278,   287,   288,    79,   151,    81,   136,   136,
-     634,   287,   288,   297,   152,   275,   300,   301,   151,   520,
-     126,   297,   128,   128,   300,   301,   151,   654,   133,   128,
-     136,   259,   564,    72,   133,   151,   554,    72,   298,   151,
-     549,   550,    58,    59,   146,   126,   151,   128,   557,   558,
-      72,   560,   151,    26,   156,   136,   126,   285,   128,   128,
-      64,    65,   686,   151,   133,   146,   136,   295,    67,    68,
-      69,    70,    71,    72,   155,   303,    64,    65,   126,   151,
-     128,   309,   342,    88,   123,   357,    85,   126,   136,   128,
-      95,   126,   624,   128,    99,   378,   149,   136,   103,   656,
-     128,   136,    21,    22,   126,   133,   128,   146,    88,   151,
-     587,   146,   149,   397,   136,    95,   155,   649,   650,    99,
-     155,   598,   136,   103,   146,   749,   136,    67,    68,    69,
-      70,    71,    72,   155,   128,   363,    88,    31,    61,   133,
-     617,   146,   425,    95,   882,   144,   145,    99,   133,   151,
-     378,   150,   133,    61,   130,   656,   384,    88,   386,   112,
-     128,   389,    49,   128,    95,   157,   146,   133,    99,   452,
-     133,   454,   112,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    21,    22,     8,   136,   128,
-      26,   133,   128,   151,   146,    88,   130,   425,   146,   823,
-     824,   149,    95,   133,   487,   488,    99,   155,    13,   136,
-     493,   480,   495,   496,    13,   146,   154,   152,    58,    59,
-     153,   147,   136,   492,   452,   153,   454,   499,   852,   512,
-     499,   152,   499,   461,   462,   463,   520,   499,   498,   467,
-     136,    45,    46,    47,   520,    49,   107,   475,   517,   303,
-     478,   107,   151,   146,   878,   309,   146,   152,    13,   487,
-     488,   152,   151,   200,   554,   493,   203,   495,   496,   529,
-     554,   554,   151,   153,     8,   153,    74,   901,   554,   903,
-     151,   218,   150,   220,   512,   222,   223,    61,   136,   549,
-     550,   136,   151,     8,   152,   772,    13,   557,   558,   117,
-     560,   151,   530,   157,   532,   151,   157,   535,   785,   151,
-     146,   594,   540,   153,   151,   128,   151,    67,    68,    69,
-      70,    71,    72,   800,   152,   151,   554,   804,   151,   151,
-     157,   133,   809,   810,   606,    85,   152,   606,   815,   606,
-     176,    13,   819,   626,   606,   136,   182,    13,   136,   152,
-     578,   579,   188,   189,    79,   583,   157,   153,   146,   136,
-     152,   149,   198,   130,   136,   128,   594,   155,     8,   149,
-     847,   654,   656,   209,   146,     8,   152,   149,    61,    61,
-     656,   130,    96,   155,   157,     8,   152,   103,   671,   136,
-      96,    13,   153,   152,   144,   145,   668,   153,   626,   153,
-     150,   153,   630,   675,   157,   151,   634,   461,   462,   886,
-     638,   149,   796,   152,   144,   687,    67,    68,    69,    70,
-      71,    72,   303,   259,   478,   146,   654,    13,   309,   152,
-     658,   908,   660,   152,   152,   157,    13,   150,   915,   667,
-     152,   152,   152,   671,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,   153,    49,   725,   726,   686,   152,
-     729,    42,    43,    44,    45,    46,    47,   303,    49,   157,
-     157,   152,   151,   309,   702,   149,   530,   157,    96,   149,
-     153,   152,   151,   755,     8,   153,   146,   136,   153,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,   146,   771,   149,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,   146,    13,    26,   151,
-      66,   749,   153,   152,    13,    13,   136,   146,    13,   583,
-     136,   146,   153,   149,    58,    59,   764,    13,    74,   153,
-     768,   813,   378,   150,   153,    74,   119,    13,   820,    58,
-      59,   153,   151,   133,   146,   153,    26,   136,    79,     8,
-     832,   136,   136,   152,   836,    74,   151,   839,   840,   152,
-     146,   843,   898,   363,   846,   535,   845,   149,   806,   671,
-     461,   462,   463,   512,   595,   726,   782,   638,   666,   425,
-     327,   694,   578,    77,   822,   823,   824,   478,   522,   827,
-     645,   873,   577,   622,   658,   852,   660,   495,   166,   837,
-     496,   182,    -1,   667,    -1,    -1,   452,    -1,   454,    -1,
-      -1,    -1,    -1,   895,   852,   461,   462,   463,   152,    -1,
-      -1,    -1,    -1,    -1,   862,    -1,    -1,    42,    43,    -1,
-     912,    -1,   478,    -1,   916,    -1,    -1,    -1,   702,   530,
-     878,   487,   488,   881,   882,    -1,    61,   493,    -1,   495,
-     496,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,   901,    -1,   903,   512,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    -1,   530,    -1,    -1,   578,    -1,    -1,
-      -1,    -1,   583,   108,    -1,    -1,   111,    -1,    -1,    -1,
-     764,    -1,    -1,    -1,   768,    -1,    -1,   122,   554,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
-     135,   136,    -1,    -1,    21,    22,   141,    -1,    -1,    -1,
-      -1,    -1,   578,    -1,    -1,    -1,    -1,   583,    -1,    -1,
-      -1,    -1,   806,    -1,    -1,    -1,    -1,    -1,   594,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   822,    -1,
-      -1,    -1,    -1,   827,    -1,    -1,    63,   658,    -1,   660,
-      -1,    -1,    -1,   837,    -1,    -1,   667,    -1,    -1,    -1,
-     626,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,   862,    49,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   654,    -1,
-      -1,   702,   658,    -1,   660,    -1,    -1,   881,    -1,    -1,
-      -1,   667,    -1,     4,     5,   671,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      -1,    -1,    23,    24,    25,    -1,    -1,    -1,    -1,   146,
-      31,    -1,    -1,    -1,    -1,    36,   702,    -1,    -1,    -1,
-      41,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,   764,    -1,    -1,    -1,   768,    -1,   176,
-      -1,    -1,    63,   180,    -1,   182,    -1,    68,    -1,    -1,
-      -1,   188,   189,    -1,    -1,    -1,    77,    -1,    -1,    -1,
-      -1,   198,    -1,    -1,    -1,    -1,    58,    59,    -1,    -1,
-      -1,    -1,   209,    -1,    -1,   806,    -1,    -1,   764,    -1,
-      -1,    -1,   768,    -1,    -1,    -1,    -1,    -1,   225,    -1,
-      -1,   822,    -1,    -1,    -1,    -1,   827,    -1,    -1,    -1,
-     121,    -1,    -1,    -1,    -1,    -1,   837,    -1,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-     806,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   862,    -1,    -1,    -1,    -1,   822,    -1,   275,    -1,
-      -1,   827,    -1,    -1,    -1,   166,    -1,    -1,    -1,    -1,
-     881,   837,    -1,    -1,    -1,    -1,   177,    -1,   179,   180,
-      -1,   298,    -1,    -1,    -1,    -1,   187,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   862,    -1,   199,    -1,
-      -1,    -1,    -1,    -1,    -1,   206,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   214,    -1,   881,    -1,    -1,    -1,    -1,
-     221,    -1,    -1,    -1,   225,   342,    -1,    -1,    -1,    -1,
-      -1,   232,    -1,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,    -1,    -1,
-      -1,   378,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   272,   273,   274,   275,    -1,   277,    -1,   279,   280,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     291,    -1,   293,    -1,    -1,    -1,    -1,   298,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   425,    -1,
-      -1,    -1,    -1,   314,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   324,     9,    10,    11,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   452,    -1,   454,    -1,    -1,
-      25,   342,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,
-     487,   488,    -1,    -1,    -1,    -1,   493,    -1,   495,   496,
-      -1,   498,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   393,    -1,    -1,   512,    -1,    -1,    -1,    -1,
-     401,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,   529,    49,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,
-      11,    -1,   549,   550,    -1,    -1,    -1,    -1,    -1,    -1,
-     557,   558,    -1,   560,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,    -1,   157,    -1,    -1,    -1,    -1,   594,    -1,    -1,
-     481,    -1,    -1,    -1,   485,   486,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   498,    -1,    -1,
-      -1,    -1,   503,    -1,    -1,    -1,    -1,    -1,    -1,   626,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   519,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   529,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   654,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   549,   550,
-      -1,    -1,   553,    -1,   671,    -1,   557,   558,    -1,   560,
-      -1,    -1,    -1,   564,   565,    -1,    -1,    -1,    -1,   570,
-      -1,    -1,   153,    -1,    -1,    -1,    -1,     3,     4,     5,
-       6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   603,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,   624,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    70,    71,    72,    73,   649,   650,
-      76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    85,
-      86,    87,    -1,    89,    -1,    91,    92,    93,    -1,   670,
-      -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,    -1,   118,    -1,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,
-     136,   137,   138,   139,   140,   141,   142,   143,   144,    -1,
-     146,   147,    -1,   149,   150,   151,    -1,   153,   154,   155,
-     156,    -1,   733,     9,    10,    11,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,    42,    43,    -1,   779,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,   814,    81,    82,    -1,    -1,    85,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,    -1,   146,
-     147,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    25,    12,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    85,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,   100,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,   105,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,   102,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       2,    22,   120,    54,    54,   511,     2,   235,     2,   338,
+       2,   250,   479,     3,     3,   294,   380,    54,   209,   329,
+       3,    42,     3,     3,     6,   279,     3,   281,     3,    33,
+       9,     3,    53,    54,    26,    56,   542,     3,   523,   277,
+     759,     3,   111,     6,    48,     3,     3,     3,     3,    77,
+     278,    21,   280,    74,     3,    61,     3,    22,   111,   111,
+      21,    63,    21,   113,   133,    33,     9,    45,     9,    45,
+     298,   299,     9,   386,   353,   388,    54,    42,    54,    21,
+      48,   153,    21,    61,   111,    61,   204,    65,   452,    21,
+     454,   118,    99,    15,    16,    17,   149,   335,    26,   151,
+     153,   108,   340,   111,   111,   126,   334,    22,   111,   337,
+     338,   111,    45,    21,    45,   118,   118,   145,   111,   133,
+     141,    54,    21,    54,   151,   132,   133,    42,    61,     0,
+      61,    26,   153,   133,    65,   185,    36,   151,   145,    54,
+     161,   151,   627,   151,   114,     9,   150,   613,   155,   149,
+     171,   172,   173,   159,   151,   114,   177,   118,   151,   149,
+      58,    59,   881,   153,   153,    87,   145,   145,   653,   145,
+     153,   153,   153,   153,   195,    36,   153,   152,   457,   458,
+     459,   153,   150,   111,   494,   235,   149,   153,   149,   210,
+     152,   212,   471,   522,   152,   152,   152,   152,   235,   250,
+     250,   668,   145,   152,   145,   152,   114,   149,   145,   151,
+     149,   126,   145,   250,   145,   217,   111,   149,   684,   118,
+     686,   227,   145,   156,   537,    45,   145,    22,   278,   250,
+     280,    61,   155,    45,    54,    65,   155,    46,   153,     3,
+       4,   278,    54,   280,   108,    65,   161,   111,   298,   299,
+     149,   111,   151,   532,   492,   145,   171,   172,   118,    23,
+     133,   298,   299,    45,   628,   155,   151,   521,   132,   133,
+      22,   277,    54,   294,    83,   296,   111,    41,    73,    61,
+     195,   145,    46,   118,   334,   151,    50,   337,   338,   151,
+      42,   155,   656,   108,   522,   210,   111,   334,    24,   578,
+     337,   338,    54,    22,   151,   235,    32,   151,    24,    58,
+      59,   332,   566,   551,   552,   133,    32,   556,   133,    83,
+     151,   559,   560,   636,   562,   145,   121,   122,   123,   335,
+      45,   610,   353,   145,   340,   250,   133,   132,   111,    54,
+     112,   105,   106,   107,   365,   118,    61,   149,   278,   399,
+     679,   153,   151,   117,    73,   119,     6,   359,    77,   380,
+     151,   133,    33,   145,   128,   386,   130,   388,   298,   299,
+     391,   151,   626,   145,   126,   688,   111,    48,   151,   658,
+     886,   660,   108,   118,   148,   111,   665,   108,   152,    80,
+     111,    82,   108,    33,   585,   111,    67,   651,   652,   149,
+     151,   153,   121,   122,   123,   596,   427,   133,    48,   161,
+     151,   132,   133,   132,   151,   108,   151,   133,   111,   171,
+     172,   149,   133,   133,   145,   704,   152,    67,   619,   197,
+     145,   452,   200,   454,   155,     9,   457,   458,   459,   752,
+     133,    21,   463,   195,   118,   151,   118,   114,    21,   111,
+     471,   679,   220,    77,   222,    87,   224,   225,   210,   157,
+     481,   482,     3,   111,     4,   380,   487,   133,   489,   490,
+     133,   118,   522,    12,    13,    14,    15,    16,    17,   145,
+     118,   473,   146,   149,   153,   522,   492,   152,   767,   155,
+     511,   493,   771,   514,   486,   111,   111,   493,   250,   493,
+     118,   493,   151,   114,   108,   556,   556,   111,   133,   118,
+     133,   532,   427,   534,   827,   828,   537,   153,     4,   556,
+     145,   542,   145,   152,   149,   531,   149,   519,   132,   133,
+     155,   810,   155,   154,   133,   556,   133,   452,    71,   454,
+      71,   145,   294,   856,     4,   551,   552,   826,    87,   151,
+       4,   155,   831,   559,   560,   151,   562,   578,   579,   152,
+     152,     3,   841,    23,   153,    26,   481,   482,   153,   882,
+     151,   592,   487,   150,   489,   490,    21,   133,   145,   151,
+     133,    41,   151,   774,   152,     3,    46,   866,     4,   610,
+      50,    82,   905,   151,   907,   157,   151,   788,   152,   514,
+     151,   353,   604,   151,   151,   151,   885,   628,   604,   151,
+     604,   632,   604,   804,   157,   636,   151,   808,   111,   640,
+     157,   118,   813,    83,   133,     4,   817,   152,   380,   679,
+     821,   152,   823,   157,     4,   656,    34,   658,   153,   660,
+     152,   556,   679,   133,   665,   105,   106,   107,   669,   108,
+     114,     1,   111,   111,     3,   149,   152,   117,     3,   119,
+     851,    21,    21,    55,   666,   157,     3,   688,   128,    65,
+     130,   673,    22,   132,   133,   427,   133,   592,     4,   153,
+      55,   152,   800,   704,   114,   152,   145,   689,   148,   157,
+     149,   153,    42,   153,   149,   143,   155,   153,   151,   890,
+     452,   153,   454,   152,   145,   457,   458,   459,     4,   152,
+     157,     1,   152,   628,   152,   152,   152,   152,   152,   471,
+     153,   912,   151,    73,   152,   150,   157,    77,   919,   481,
+     482,   752,    22,   725,   726,   487,   728,   489,   490,   149,
+       4,   656,   157,   157,    55,   153,   767,   152,   151,   149,
+     771,   153,    42,   133,   669,   145,   758,   145,   153,   153,
+     149,   145,   514,    11,    12,    13,    14,    15,    16,    17,
+       4,   121,   122,   123,   108,   109,     6,   111,   151,    66,
+     532,   773,   132,    73,   153,   152,     4,    77,     4,   810,
+     133,   145,     4,   143,   144,   153,   149,   145,   132,   133,
+     150,   133,     4,    26,   556,   826,   827,   828,   150,   153,
+     831,   145,   153,    26,   816,    88,   118,   153,     4,     6,
+     841,   155,   824,   151,   145,   133,   578,    34,   153,   133,
+     133,   121,   122,   123,   836,   856,     3,   152,   840,    87,
+     592,   843,   132,   845,    92,   866,   151,   849,   850,    97,
+     145,     3,     4,   143,   144,   152,   848,   149,   610,   365,
+     150,   882,   902,   514,   885,   886,   593,   537,   669,   726,
+     640,    23,   785,   317,   696,   877,   628,    78,   524,   127,
+     683,   129,   856,   578,   905,   647,   907,   577,   624,    41,
+     161,   489,   131,    -1,    46,   490,    -1,   899,    50,    -1,
+      -1,    -1,    -1,    -1,   656,    -1,   658,    -1,   660,    -1,
+      -1,    -1,    -1,   665,   916,    -1,    -1,   669,   920,     5,
+       6,     7,     8,     9,    10,    -1,    -1,    13,    14,    15,
+      -1,    83,    18,    -1,    -1,    21,    -1,    -1,    -1,    -1,
+      -1,    27,    28,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,   704,   105,   106,   107,    -1,    43,    44,    -1,
+      46,    -1,     4,   294,    -1,   117,    -1,   119,    -1,    -1,
+      -1,    57,    58,    59,    60,    61,   128,    -1,   130,    65,
+      -1,    23,    68,    -1,    26,    -1,    -1,    73,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    -1,   148,    -1,    -1,    41,
+     152,    -1,    -1,    -1,    46,    -1,    -1,    -1,    50,    -1,
+      -1,    -1,    -1,    -1,    -1,   767,    -1,    -1,    -1,   771,
+      87,    -1,   353,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    83,    -1,    -1,    -1,   131,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   810,    -1,
+     127,    -1,   129,   105,   106,   107,    -1,    -1,   154,   155,
+      -1,    -1,   158,   159,   826,   117,    -1,   119,    -1,   831,
+     166,    -1,    -1,    -1,    -1,    -1,   128,    -1,   130,   841,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   148,    87,    -1,    -1,
+     196,    -1,    92,    -1,   866,    -1,    23,    97,    -1,    -1,
+      -1,   207,    -1,    -1,    -1,    22,   457,   458,    -1,    -1,
+     216,    -1,    -1,   885,    41,    -1,    -1,   223,    -1,    46,
+     471,   227,    -1,    50,    -1,    42,    -1,   127,   234,   129,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,    61,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,    83,    -1,    -1,   265,
+     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,    -1,   279,    -1,   281,   282,    -1,   105,   106,
+     107,   532,   288,    -1,   290,    -1,    -1,    -1,    -1,    -1,
+     117,    -1,   119,    -1,    -1,    -1,    -1,   303,    -1,    -1,
+      -1,   128,    -1,   130,    -1,    -1,    -1,    -1,   314,   126,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,
+      -1,    -1,    -1,    -1,   340,    -1,   153,    -1,    -1,    -1,
+      -1,    -1,   159,    -1,   161,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   171,   172,    -1,    -1,     5,   610,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   195,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,    87,    -1,   395,
+      -1,    -1,    92,   210,   400,    -1,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   658,    -1,   660,
+     227,    -1,    -1,     5,   665,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,   127,    -1,   129,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,    -1,    -1,   704,   101,   102,   103,    -1,    -1,    -1,
+     277,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   474,    -1,
+      -1,    -1,    -1,   479,   480,    -1,    -1,    -1,    -1,    -1,
+     127,    -1,   129,    -1,    -1,    -1,   492,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,   502,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     157,   103,    -1,    -1,    -1,   521,   767,    -1,   335,    -1,
+     771,    -1,    -1,   340,    -1,   531,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   551,   552,    -1,    -1,   555,
+      -1,    -1,    -1,   559,   560,    -1,   562,    -1,    -1,   810,
+     566,   567,    -1,   380,    -1,    -1,   572,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   826,    -1,    -1,    -1,    -1,
+     831,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     841,    -1,    -1,    -1,     5,   601,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+     427,    -1,    -1,    -1,    -1,   866,    -1,    -1,    29,    30,
+     626,    10,    11,    12,    13,    14,    15,    16,    17,    12,
+      13,    -1,    -1,    -1,   885,   452,    -1,   454,    21,    -1,
+      -1,    24,    -1,    -1,    -1,   651,   652,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    37,    -1,    -1,    -1,    -1,    -1,
+      43,    -1,   668,    -1,   481,   482,    49,    -1,    51,    -1,
+     487,    -1,   489,   490,    -1,   492,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    72,
+     101,   102,   103,    76,    -1,    -1,    -1,   514,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,   531,    98,   127,   100,   129,    -1,
+      -1,   104,    -1,    -1,    -1,   108,    -1,   110,   111,   735,
+      -1,    -1,    -1,    -1,   551,   552,    -1,    -1,   127,    -1,
+     129,   152,   559,   560,    -1,   562,     0,     1,   131,   132,
+     133,    -1,    -1,    -1,    -1,    -1,   139,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    22,    -1,
+      24,    25,    -1,    -1,    28,   592,   782,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,   628,   818,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,   656,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,   669,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+      -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    33,    -1,    -1,    36,    37,
+      38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
+      48,    49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,
+      -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    67,
+      -1,    69,    70,    -1,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    -1,    83,    84,    85,    86,    -1,
+      -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,    -1,    -1,   145,   146,     1,
+      -1,   149,   150,   151,    -1,   153,   154,   155,   156,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    33,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    48,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    67,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,     1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    21,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      36,    37,    38,    -1,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    -1,    83,    84,    85,
+      86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,    -1,   145,
+     146,     1,    -1,   149,   150,   151,    -1,   153,   154,   155,
+     156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    -1,    49,
+      -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    -1,    83,    84,    85,    86,    -1,    -1,    89,
+      90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,    -1,   145,   146,     1,    -1,   149,
+     150,   151,    -1,   153,   154,   155,   156,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    58,    59,    60,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,    -1,
+      -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,
+      38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
+      -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,
+      58,    59,    60,    -1,    -1,    -1,    -1,    -1,    66,    -1,
+      -1,    69,    70,    -1,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    -1,    83,    84,    85,    86,    -1,
+      -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,    -1,    -1,   145,   146,     1,
+      -1,   149,    -1,   151,    -1,   153,   154,   155,   156,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,     1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    21,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,
+      46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    -1,    83,    84,    85,
+      86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,    -1,    -1,   145,
+     146,     1,    -1,   149,   150,   151,    -1,   153,   154,   155,
+     156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,
+      -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,
+      -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      60,    -1,    62,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    -1,    83,    84,    85,    86,    -1,    -1,    89,
+      90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,   145,   146,     1,    -1,   149,
+      -1,   151,    -1,   153,   154,   155,   156,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,    -1,
+      -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,
+      38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
+      -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,
+      -1,    -1,    60,    -1,    -1,    -1,    64,    -1,    -1,    -1,
+      -1,    69,    70,    -1,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    -1,    83,    84,    85,    86,    -1,
+      -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,    -1,    -1,   145,   146,     1,
+      -1,   149,    -1,   151,    -1,   153,   154,   155,   156,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,     1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    21,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,
+      46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    -1,    83,    84,    85,
+      86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,    -1,    -1,   145,
+     146,     1,    -1,   149,   150,   151,    -1,   153,   154,   155,
+     156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,
+      -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,
+      -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      60,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    -1,    83,    84,    85,    86,    -1,    -1,    89,
+      90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,   145,   146,     1,    -1,   149,
+      -1,   151,    -1,   153,   154,   155,   156,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    22,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    36,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    69,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,    -1,
+      -1,   145,   146,     1,    -1,   149,    -1,   151,    -1,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,    37,
+      38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
+      -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,
+      -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    -1,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    -1,    83,    84,    85,    86,    -1,
+      -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,    -1,    -1,   145,   146,     1,
+      -1,   149,   150,   151,    -1,   153,   154,   155,   156,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,     1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    21,    22,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      36,    37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,
+      46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    -1,    83,    84,    85,
+      86,    -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,    -1,    -1,   145,
+     146,     1,    -1,   149,   150,   151,    -1,   153,   154,   155,
+     156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    22,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,
+      -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,
+      -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    -1,    83,    84,    85,    86,    -1,    -1,    89,
+      90,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,   145,   146,     1,    -1,   149,
+     150,   151,     6,   153,   154,   155,   156,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      74,    75,    76,    77,    78,    79,    -1,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,   139,   140,   141,   142,    -1,
+      -1,   145,   146,     1,    -1,   149,    -1,   151,     6,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    -1,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    37,
+      38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
+      -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,
+      -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    -1,    72,    -1,    74,    75,    76,    77,
+      78,    79,    -1,    81,    -1,    83,    84,    85,    86,    -1,
+      -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,   136,   137,
+      -1,   139,   140,   141,   142,    -1,    -1,   145,   146,     1,
+      -1,   149,    -1,   151,     6,   153,   154,   155,   156,    -1,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    74,    75,    76,    77,    78,    79,    -1,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,    -1,   139,   140,   141,
+     142,    -1,    -1,   145,   146,     1,    -1,   149,    -1,   151,
+       6,   153,   154,   155,   156,    -1,    12,    13,    -1,    -1,
+      -1,    -1,    18,    19,    20,    21,    -1,    -1,    24,    25,
+      -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      -1,    37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,
+      46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,
+      56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,
+      76,    77,    78,    79,    -1,    81,    -1,    83,    84,    85,
+      86,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,
+      -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,
+     126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,
+     136,   137,    -1,   139,   140,   141,   142,    -1,    -1,   145,
+     146,     1,    -1,   149,    -1,   151,     6,   153,   154,   155,
+     156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,
+      -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    74,    75,    76,    77,    78,    79,
+      -1,    81,    -1,    83,    84,    85,    86,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,   136,   137,    -1,   139,
+     140,   141,   142,    -1,    -1,   145,   146,     1,    -1,   149,
+      -1,   151,    -1,   153,   154,   155,   156,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,
+      -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      74,    75,    76,    77,    78,    79,    -1,    81,    -1,    83,
+      84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,   136,   137,    -1,   139,   140,   141,   142,    -1,
+      -1,   145,   146,    -1,    -1,   149,    -1,   151,     6,   153,
+     154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    -1,    -1,    24,    25,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,
+      38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,    -1,
+      -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,    -1,
+      -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,    77,
+      -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,    -1,
+      -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,
+      98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,
+     108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,    -1,
+      -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,    -1,
+      -1,   139,    -1,    -1,   142,    -1,    -1,   145,    -1,    -1,
+      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,   101,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,   150,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,   127,    -1,   129,   101,   102,   103,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,
+     127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,    -1,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,
+      97,   127,    -1,   129,   101,   102,   103,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,
+     127,    -1,   129,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    -1,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    87,    -1,    28,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    37,    38,    -1,   101,   102,   103,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,   127,    -1,   129,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,   153,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,
+     155,   156,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,    -1,   116,
-      -1,   118,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,    -1,   116,    -1,   118,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-      -1,   116,    -1,   118,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,    -1,   116,    -1,   118,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,    -1,   116,
-      -1,   118,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    29,    30,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    31,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,
-      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,     3,     4,     5,     6,
-       7,    -1,   135,   136,   137,    12,    -1,    -1,   141,    -1,
-      -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,
-      -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,
-      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,     3,     4,     5,     6,     7,    -1,   135,   136,
-     137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,
-      -1,    -1,    -1,    -1,   151,    -1,   153,   154,   155,   156,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,   150,    91,    92,
+      93,    94,    95,   127,    97,   129,    -1,    -1,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    29,    30,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,   150,    91,
+      92,    93,    94,    95,   127,    97,   129,    12,    13,   101,
+     102,   103,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,   150,    -1,    -1,
+      -1,    -1,    37,    38,    -1,   127,    -1,   129,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,   150,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,
+     155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,   139,
+      -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,    -1,
+      -1,   151,    -1,   153,   154,   155,   156,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,
+     155,   156,    12,    13,    -1,    -1,    -1,    -1,    18,    19,
+      20,    21,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,
+      -1,    -1,    -1,    43,    -1,    -1,    46,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    -1,    72,    -1,    -1,    -1,    76,    77,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,
+     110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,    -1,    -1,    -1,   124,   125,    -1,    -1,    -1,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,   139,
+      -1,    -1,   142,    -1,    -1,   145,    -1,    -1,    -1,    -1,
+      -1,   151,   152,    -1,   154,   155,   156,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    12,    13,   154,
+     155,   156,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    -1,
+      -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,
+     155,   156,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
+      -1,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    -1,    -1,    29,    30,    -1,    -1,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    29,    30,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,   127,    -1,   129,   101,   102,   103,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-      91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,     3,     4,
-       5,     6,     7,    -1,   135,   136,   137,    12,    -1,    -1,
-     141,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,
-     151,    -1,   153,   154,   155,   156,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,     3,     4,     5,     6,     7,    -1,
-     135,   136,   137,    12,    -1,    -1,   141,    -1,    -1,    -1,
-      -1,   146,    -1,    -1,    -1,    -1,   151,    -1,   153,   154,
-     155,   156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,
-      -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-      -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-       3,     4,     5,     6,     7,    -1,   135,   136,   137,    12,
-      -1,    -1,   141,    -1,    -1,    -1,    -1,   146,    -1,    -1,
-      -1,    -1,   151,   152,    -1,   154,   155,   156,    31,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,
-      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,     3,     4,     5,     6,
-       7,    -1,   135,   136,   137,    12,    -1,    -1,   141,    -1,
-      -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    26,
-      -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,
-      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,     3,     4,     5,     6,     7,    -1,   135,   136,
-     137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,
-      -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,
-      31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-      91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,     3,     4,
-       5,     6,     7,    -1,   135,   136,   137,    12,    -1,    -1,
-     141,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,
-     151,    -1,    -1,   154,   155,   156,    31,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,     3,     4,     5,     6,     7,    -1,
-     135,   136,   137,    12,    -1,    -1,   141,    -1,    -1,    -1,
-      -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,
-     155,   156,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,
-      -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-      -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-       3,     4,     5,     6,     7,    -1,   135,   136,   137,    12,
-      -1,    -1,   141,    -1,    -1,    -1,    -1,   146,    -1,    -1,
-      -1,    -1,   151,    -1,    -1,   154,   155,   156,    31,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,
-      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,     3,     4,     5,     6,
-       7,    -1,   135,   136,   137,    12,    -1,    -1,   141,    -1,
-      -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,
-      -1,   154,   155,   156,    31,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,
-      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,     3,     4,     5,     6,     7,    -1,   135,   136,
-     137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,
-      -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,   127,    97,   129,    -1,    -1,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-      91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,     3,     4,
-       5,     6,     7,    -1,   135,   136,   137,    12,    -1,    -1,
-     141,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,
-     151,    -1,    -1,   154,   155,   156,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
-     135,   136,   137,    -1,    -1,    -1,   141,     9,    10,    11,
-      -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,
-     155,   156,    -1,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,    -1,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,    -1,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   153,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,     9,    10,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   153,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   153,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,
-      -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   153,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,    25,
-      -1,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,     9,    10,    11,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,   152,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     152,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,     9,    10,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   152,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   152,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   150,    25,    -1,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-     150,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,    -1,     9,    10,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   150,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,     9,    10,    11,    -1,
+      29,    30,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,   127,   101,   129,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,    -1,   127,    -1,   129,    -1,    -1,    -1,    -1,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,
+     129,    29,    30,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+      -1,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,    -1,    -1,    -1,    -1,   127,
+      -1,   129,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+      -1,    -1,    87,   127,    -1,   129,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    -1,    97,
+      -1,    -1,   127,    -1,   129,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   150,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
-      -1,    -1,    96,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,   150,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,    10,    11,
-      -1,    -1,    -1,    96,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    11,    49,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,
+      -1,   129
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   159,   160,     0,     3,     4,     5,     6,     7,    12,
-      42,    43,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    70,    71,    72,
-      73,    76,    81,    82,    85,    86,    87,    89,    91,    92,
-      93,    97,    98,   106,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   118,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   146,   147,   149,   151,   153,   154,
-     155,   156,   161,   162,   167,   170,   171,   177,   178,   180,
-     182,   185,   187,   242,   243,   246,   249,   250,   259,   262,
-     266,   267,   269,   270,   276,   277,   278,   279,   280,   281,
-     282,   283,   288,   296,   298,    72,   126,   136,   246,   266,
-     266,   151,   266,   266,   266,   266,   266,   266,   266,   266,
-     266,   266,   266,   266,   266,   266,    72,   126,   128,   161,
-     250,   269,   270,   278,   269,   266,    31,   266,   291,   292,
-     266,   126,   128,   161,   250,   252,   253,   278,   281,   282,
-     288,    81,    81,   146,   212,   246,   151,   153,   266,   136,
-     153,   266,   151,   170,   235,   266,   151,   151,   256,   151,
-     151,   146,   155,   210,   211,   136,   151,   151,   151,   151,
-     128,   149,   161,   161,   153,   243,   266,   270,    88,    95,
-      99,   103,   146,   293,   294,    26,   151,   266,   149,   151,
-     128,   161,   165,   166,   151,   168,   242,   266,    99,   257,
-     293,   149,    99,   293,   128,   151,     8,   153,   136,   136,
-      31,   179,    61,   133,     9,    10,    11,    25,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    49,
-     153,    58,    59,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,   151,   133,    61,   130,    61,
-     149,   155,   282,   179,   266,   128,   161,   133,   133,   268,
-     270,    96,   157,     8,   264,   128,   161,   133,   151,   258,
-     133,   130,   282,    13,     8,   153,   179,   291,   153,    13,
-     153,   136,   196,   147,     8,   153,   270,   152,   266,   236,
-     237,   266,   243,   270,   149,   267,   270,     8,   153,   153,
-     152,   266,   270,   297,   123,   270,   289,   290,   161,   164,
-     149,   153,   151,   153,   153,   270,   137,   266,   103,   294,
-      61,   130,    99,   103,   294,   266,   153,   168,   175,   176,
-     270,   161,    74,     8,   153,   266,   115,   150,   169,   170,
-     177,   178,   152,   152,   154,   266,   156,   136,    31,   208,
-     209,   243,   270,   136,   107,   186,   107,   188,   136,   151,
-     266,   284,   136,   149,   276,   282,   287,   288,   266,   266,
-     266,    26,   266,   266,   266,   266,   266,   266,   266,   266,
+       0,   159,   160,     0,     1,    12,    13,    18,    19,    20,
+      21,    22,    24,    25,    28,    31,    36,    37,    38,    42,
+      43,    44,    46,    47,    49,    51,    52,    56,    57,    60,
+      69,    70,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    83,    84,    85,    86,    89,    90,    96,    98,
+      99,   100,   104,   108,   109,   110,   111,   113,   120,   124,
+     125,   126,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   145,   146,   149,   151,   153,
+     154,   155,   156,   161,   162,   167,   170,   171,   177,   178,
+     180,   182,   185,   187,   242,   243,   246,   249,   250,   259,
+     262,   266,   267,   269,   270,   276,   277,   278,   279,   280,
+     281,   282,   283,   288,   296,   298,   153,   108,   132,   133,
+     246,   266,   266,   266,   266,   266,     9,   266,   291,   292,
+      36,   151,   266,   266,   153,   266,   266,   133,   153,   266,
+     108,   111,   132,   161,   250,   269,   270,   278,   151,   170,
+     266,   235,   266,   151,   151,   151,   256,    36,   151,   151,
+     145,   155,   210,   211,   133,   151,   151,   269,   266,   266,
+     266,   151,   151,   111,   149,   161,   108,   111,   161,   250,
+     252,   253,   278,   281,   282,   288,   161,   266,   266,   266,
+     266,   153,   243,   266,   270,    45,    54,    61,    65,   145,
+     293,   294,   145,   212,   246,     6,   266,   151,   266,   149,
+     151,   266,   111,   161,   165,   166,   151,   168,   242,   266,
+      61,   257,   293,   149,    61,   293,   111,   151,     3,   153,
+     133,   133,     9,   179,    21,   118,     5,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    29,    30,
+      87,    91,    92,    93,    94,    95,    97,   101,   102,   103,
+     127,   129,   153,    46,    83,     4,    23,    41,    50,   105,
+     106,   107,   117,   119,   128,   130,   148,   151,   118,    21,
+     114,    21,   149,   155,   282,   179,   268,   270,    55,   157,
+       3,   264,   291,   153,     4,   153,   111,   161,   118,   118,
+     133,   196,   146,     3,   153,   270,   266,   152,   266,   236,
+     237,   266,   243,   270,   149,   267,   270,     3,   153,   153,
+     152,   266,   270,   297,    99,   270,   289,   290,   161,   164,
+     149,   153,   111,   161,   118,   151,   258,   118,   114,   282,
+     151,   153,   153,   270,   135,   266,    65,   294,    21,   114,
+      61,    65,   294,     4,     3,   153,   179,   266,   153,   168,
+     175,   176,   270,   161,    26,     3,   153,   266,    80,   150,
+     169,   170,   177,   178,   152,   152,   154,   266,   156,   133,
+       9,   208,   209,   243,   270,   133,    71,   186,    71,   188,
+     133,   151,   266,   284,   133,   149,   276,   282,   287,   288,
+       6,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   252,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,     9,   266,   266,
      266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
-     266,   266,   266,   266,   252,    31,   266,   266,   266,   266,
-     266,   266,   266,   266,   266,   266,   266,   266,   208,   136,
-     276,   287,   284,   136,   276,   285,   286,   287,   284,   266,
-     152,   161,    31,   266,    31,   266,   161,   276,   208,   276,
-     285,    42,    43,    61,    73,    82,   126,   128,   135,   161,
-     250,   259,   260,   261,   146,   151,   152,   260,    13,     8,
-     152,   151,   266,   152,   152,   153,     8,    74,    74,   266,
-     211,   153,   152,     8,   152,   151,     8,   152,   151,   160,
-     163,   208,   150,    61,   150,   129,   136,   146,   295,   136,
-     152,   150,     8,   152,    74,   136,   166,   152,   151,    61,
-     130,   238,   239,   240,   241,   272,   150,   268,   152,     8,
-      13,   126,   128,   161,   251,   117,   189,   190,   251,   184,
-     151,    73,    77,   205,   206,   207,   251,   157,   266,   151,
-     151,   282,   266,    26,    63,   270,   152,   151,   151,   157,
-     151,   273,   274,   275,    61,   149,   157,   150,   268,   268,
-      96,   152,   254,   260,   260,   260,   263,   265,   151,   128,
-     161,    99,   133,    13,   205,   260,   136,    26,   170,   195,
-     266,   236,   266,   270,    31,   192,   270,   150,    26,   170,
-     270,   289,   290,    13,   208,   150,   160,   152,   266,   157,
-      26,   149,   197,    79,   176,   153,   136,    26,   170,   200,
-     152,   284,   285,   272,    61,   238,    31,   243,   270,   260,
-     128,   161,   190,   183,     8,   149,   205,   152,     8,    31,
-     146,   150,   208,   208,   266,   252,   208,   208,   208,    61,
-      61,   271,   284,   266,    31,   266,   130,   255,    96,   157,
-       8,   264,   263,   161,   136,   260,   152,    13,   168,   152,
-     153,    96,   191,   270,   191,   168,   201,   152,   266,   152,
-     150,   157,   153,   198,   153,   198,   151,   168,   153,   157,
-     275,   284,   268,   161,   149,   251,   213,   152,   144,   247,
-     207,   146,    13,   152,   152,   258,   152,   152,   152,   284,
-     284,   272,   157,   150,   268,   285,   260,   260,   152,   247,
-     260,   100,   153,   236,   192,   152,   152,   202,    64,    65,
-     203,   150,   198,    78,    90,   104,   198,   150,   251,   105,
-     157,   213,    67,    68,    69,    70,    71,    72,    85,   144,
-     145,   150,   214,   216,   229,   230,   231,   232,   234,   181,
-     151,   149,    31,   146,    13,   260,   157,   157,    96,   149,
-     153,   152,    26,   170,   194,   194,    64,    65,   204,   151,
-     170,   104,   266,    26,   153,   199,   153,   150,   146,   153,
-     150,   136,   217,   251,   146,   233,   246,   232,     8,   153,
-     149,    31,   146,   248,   244,   146,    13,   260,   260,   245,
-      26,   170,   193,   168,   151,    26,    66,   266,   153,   199,
-     168,   152,    13,     8,   149,   153,   218,    13,     8,   153,
-     179,   136,   168,   146,     8,   152,   168,    13,   260,   168,
-     168,   102,   266,   168,   153,   152,   168,   149,   260,   251,
-     136,   219,   220,   221,   222,   224,   225,   226,   251,   260,
-     146,   136,    13,   150,    31,   146,   150,   260,   150,   101,
-     153,   152,   170,   168,   150,   221,   153,    74,   119,   153,
-     133,    13,   151,   260,   146,   153,    26,   150,   227,   232,
-     223,   251,   136,   260,   205,   168,    79,   172,   173,   174,
-     136,     8,   152,   151,   174,   251,   215,   251,   149,   153,
-     228,   146,   168,   152,   150,   149,   168,   150
+     208,   133,   276,   287,   284,   133,   276,   285,   286,   287,
+     284,   266,     9,   266,     9,   266,   152,    12,    13,    21,
+      24,    37,   108,   111,   131,   161,   250,   259,   260,   261,
+     161,     4,     3,   152,   151,   266,   152,   152,   152,   153,
+       3,    26,    26,   266,   211,   153,   152,     3,   152,   151,
+       3,   152,   151,   160,   163,   161,   276,   208,   276,   285,
+     208,   150,    21,   150,   112,   133,   145,   295,   133,   260,
+     145,   151,   152,   150,     3,   152,    26,   133,   166,   152,
+     151,    21,   114,   238,   239,   240,   241,   272,   150,   268,
+     152,     3,     4,   108,   111,   161,   251,    82,   189,   190,
+     251,   184,   151,    24,    32,   205,   206,   207,   251,   157,
+     266,   151,   151,   282,   266,     6,   109,   270,   152,   151,
+     151,   157,   151,   273,   274,   275,    21,   149,   157,   150,
+     268,   268,    55,   260,   260,   260,   263,   265,   151,   111,
+     161,    61,   118,   260,   133,     6,   170,   195,   266,   236,
+     266,   270,     9,   192,   270,   150,     6,   170,   270,   289,
+     290,     4,   208,   150,   160,   152,   254,   152,   266,   157,
+       4,   205,     6,   149,   197,    34,   176,   153,   133,     6,
+     170,   200,   152,   284,   285,   272,    21,   238,     9,   243,
+     270,   260,   111,   161,   190,   183,     3,   149,   205,   152,
+       3,     9,   145,   150,   208,   208,   266,   252,   208,   208,
+     208,    21,    21,   271,   284,   266,     9,   266,    55,   157,
+       3,   264,   263,   161,   133,     4,   168,   152,   153,    55,
+     191,   270,   191,   168,   201,   152,   266,   152,   150,   114,
+     255,   157,   260,   152,   153,   198,   153,   198,   151,   168,
+     153,   157,   275,   284,   268,   161,   149,   251,   213,   152,
+     143,   247,   207,   145,     4,   152,   152,   258,   152,   152,
+     152,   284,   284,   272,   157,   150,   268,   260,   260,   152,
+     260,    62,   153,   236,   192,   152,   152,   202,    58,    59,
+     203,   285,   150,   247,   198,    33,    48,    67,   198,   150,
+     251,    68,   157,   213,     1,    22,    42,    73,   121,   122,
+     123,   132,   143,   144,   150,   214,   216,   229,   230,   231,
+     232,   234,   181,   151,   149,     9,   145,     4,   260,   157,
+     157,    55,   153,   152,     6,   170,   194,   194,    58,    59,
+     204,   170,   151,   149,    67,   266,     6,   153,   199,   153,
+     150,   145,   153,   150,   153,   133,   217,   251,   145,   233,
+     246,   232,     3,   153,   149,     9,   145,   248,   244,   145,
+       4,   260,   260,     6,   170,   193,   168,     6,   151,    66,
+     266,   245,   153,   199,   168,   152,     4,     3,   149,   153,
+     218,     4,     3,   153,   179,   133,   168,   145,     3,   152,
+     168,     4,   260,   168,    64,   168,   266,   153,   152,   168,
+     168,   149,   260,   251,   133,   219,   220,   221,   222,   224,
+     225,   226,   251,   260,   145,   133,     4,   150,     9,   145,
+     150,   260,    63,   153,   152,   170,   150,   168,   150,   221,
+     153,    26,    88,   153,   118,     4,   151,   260,   145,   153,
+       6,   150,   227,   232,   223,   251,   133,   260,   205,   168,
+      34,   172,   173,   174,   133,     3,   152,   151,   174,   251,
+     215,   251,   149,   153,   228,   145,   168,   152,   150,   149,
+     168,   150
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
+     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
+     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
+     169,   169,   170,   170,   170,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   171,   172,   172,   173,   173,   174,   175,   175,   176,
+     177,   178,   179,   179,   181,   180,   183,   182,   184,   182,
+     185,   185,   185,   185,   186,   186,   187,   188,   188,   189,
+     189,   190,   190,   191,   191,   192,   192,   193,   193,   194,
+     194,   195,   195,   196,   196,   197,   197,   197,   197,   198,
+     198,   198,   199,   199,   200,   200,   201,   201,   202,   202,
+     203,   203,   204,   204,   205,   205,   206,   206,   206,   206,
+     206,   206,   206,   206,   207,   207,   207,   207,   208,   208,
+     209,   209,   209,   209,   209,   209,   210,   210,   211,   211,
+     211,   212,   212,   212,   212,   213,   213,   214,   214,   214,
+     215,   214,   214,   216,   217,   217,   218,   218,   219,   219,
+     220,   220,   221,   221,   222,   223,   223,   224,   224,   225,
+     226,   226,   227,   227,   228,   228,   229,   229,   230,   230,
+     231,   231,   232,   232,   232,   232,   232,   232,   233,   233,
+     233,   233,   234,   234,   235,   235,   236,   236,   237,   237,
+     238,   238,   239,   239,   240,   240,   240,   241,   241,   242,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   244,
+     243,   245,   243,   246,   247,   247,   248,   248,   248,   248,
+     249,   249,   249,   249,   249,   249,   249,   249,   250,   250,
+     250,   250,   251,   251,   251,   252,   252,   253,   253,   254,
+     254,   255,   256,   256,   256,   257,   257,   257,   258,   258,
+     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   260,   260,   260,   260,   260,   260,   260,   260,
+     260,   260,   261,   262,   262,   262,   262,   262,   262,   262,
+     262,   262,   263,   263,   264,   264,   265,   265,   265,   265,
+     266,   266,   267,   268,   269,   270,   270,   271,   271,   272,
+     273,   273,   274,   275,   275,   275,   276,   276,   277,   277,
+     278,   279,   279,   280,   280,   280,   281,   281,   281,   282,
+     282,   282,   283,   283,   284,   284,   285,   285,   286,   286,
+     286,   287,   287,   288,   288,   289,   289,   290,   290,   290,
+     291,   291,   292,   292,   292,   292,   292,   292,   292,   292,
+     293,   293,   293,   293,   294,   294,   294,   294,   294,   294,
+     295,   295,   295,   296,   296,   296,   296,   296,   296,   296,
+     297,   297,   298,   298
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
+       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
+       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
+       1,     4,     1,     2,     2,     3,     7,    10,     5,     7,
+       9,     5,     2,     3,     2,     3,     2,     3,     3,     3,
+       3,     3,     1,     2,     5,     8,     8,     5,     1,    13,
+       3,     3,     1,     0,     1,     2,     8,     1,     3,     1,
+       1,     1,     0,     1,     0,    10,     0,     8,     0,     7,
+       1,     2,     1,     2,     0,     2,     1,     0,     2,     0,
+       2,     1,     3,     0,     2,     1,     2,     1,     4,     1,
+       4,     1,     4,     3,     5,     3,     4,     4,     5,     0,
+       5,     4,     1,     1,     1,     4,     0,     6,     0,     7,
+       0,     2,     0,     3,     1,     0,     2,     3,     5,     4,
+       4,     5,     7,     6,     0,     1,     1,     1,     1,     0,
+       1,     1,     2,     3,     3,     4,     3,     1,     1,     2,
+       4,     3,     5,     1,     3,     2,     0,     3,     2,     1,
+       0,     9,     2,     3,     1,     3,     1,     3,     0,     1,
+       1,     2,     2,     2,     3,     1,     3,     1,     1,     3,
+       4,     3,     0,     1,     1,     3,     1,     1,     0,     1,
+       1,     2,     1,     1,     1,     1,     1,     1,     3,     5,
+       1,     3,     5,     4,     3,     1,     0,     1,     3,     1,
+       2,     1,     4,     3,     2,     1,     1,     0,     1,     3,
+       6,     3,     4,     6,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     2,     2,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     2,     2,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       1,     4,     5,     4,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     1,     4,     3,     3,     2,     0,
+      10,     0,    11,     1,     0,     4,     3,     4,     1,     2,
+       4,     6,     5,     6,     6,     6,     6,     4,     1,     1,
+       3,     2,     1,     3,     2,     1,     1,     4,     1,     2,
+       0,     2,     0,     2,     3,     0,     1,     1,     0,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     2,     1,     1,     3,     2,     2,     2,     4,     3,
+       1,     1,     3,     1,     1,     1,     3,     2,     1,     3,
+       3,     1,     0,     2,     0,     1,     5,     3,     3,     1,
+       1,     1,     1,     1,     1,     5,     1,     2,     0,     3,
+       4,     4,     3,     1,     1,     0,     1,     2,     3,     3,
+       1,     4,     4,     1,     1,     1,     1,     2,     1,     4,
+       4,     1,     1,     4,     0,     1,     1,     1,     4,     4,
+       1,     1,     3,     1,     2,     3,     1,     1,     4,     0,
+       0,     2,     5,     3,     3,     1,     6,     4,     4,     2,
+       2,     2,     1,     2,     1,     4,     3,     3,     6,     3,
+       1,     1,     1,     4,     4,     2,     2,     4,     2,     2,
+       1,     3,     3,     3
+};
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
 
+enum { YYENOMEM = -2 };
 
-/* This macro is provided for backward compatibility. */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = PHP54EMPTY)
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == PHP54EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use PHP54error or PHP54UNDEF. */
+#define YYERRCODE PHP54UNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, analyzer, observers)
-#endif
 
 /* Enable debugging if requested.  */
-#if YYDEBUG
+#if PHP54DEBUG
 
 # ifndef YYFPRINTF
 #  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, analyzer, observers); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, analyzer, observers); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yyvaluep)
     return;
-  YYUSE (analyzer);
-  YYUSE (observers);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, analyzer, observers);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -3158,16 +3552,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -3178,65 +3564,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule, analyzer, observers)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , analyzer, observers);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], analyzer, observers);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, analyzer, observers); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, analyzer, observers); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+#else /* !PHP54DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
+#endif /* !PHP54DEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -3250,51 +3627,120 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
 
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
 
-#if YYERROR_VERBOSE
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yypstate* yyps;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypstate_expected_tokens (yypstate *yyps,
+                          yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyps->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+/* Similar to the previous function.  */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  return yypstate_expected_tokens (yyctx->yyps, yyarg, yyargn);
+}
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
   const char *yys = yysrc;
 
   while ((*yyd++ = *yys++) != '\0')
@@ -3302,10 +3748,10 @@ yystpcpy (yydest, yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -3313,75 +3759,56 @@ yystpcpy (yydest, yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -3404,60 +3831,79 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
   if (*yymsg_alloc < yysize)
     {
@@ -3465,7 +3911,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -3477,144 +3923,161 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep, analyzer, observers)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-  YYUSE (yyvaluep);
-  YYUSE (analyzer);
-  YYUSE (observers);
-
+  YY_USE (yyvaluep);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-/*----------.
-| yyparse.  |
-`----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
-#else
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      yyerror (analyzer, observers, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, analyzer, observers);
+  yypstate_delete (yyps);
+  return yystatus;
+}
+
 int
-yyparse (analyzer, observers)
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::FullParserObserverClass& observers;
-#endif
-#endif
+yypull_parse (yypstate *yyps, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
 {
-/* The lookahead symbol.  */
-int yychar;
+  YY_ASSERT (yyps);
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, analyzer, observers);
+    yystatus = yypush_parse (yyps, yychar, &yylval, analyzer, observers);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+#define php54nerrs yyps->php54nerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-    /* Number of syntax errors so far.  */
-    int yynerrs;
+  yyssp = yyss;
+  yyvsp = yyvs;
 
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
 
-    YYSIZE_T yystacksize;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
+
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::FullParserObserverClass& observers)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3622,111 +4085,121 @@ YYSTYPE yylval;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+    case 2:
+      yypstate_clear (yyps);
+      break;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+    default:
+      break;
+    }
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = PHP54EMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -3737,18 +4210,39 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == PHP54EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= T_END)
     {
-      yychar = yytoken = YYEOF;
+      yychar = T_END;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == PHP54error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = PHP54UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3776,13 +4270,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = PHP54EMPTY;
   goto yynewstate;
 
 
@@ -3797,14 +4291,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3817,514 +4311,451 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-
-/* Line 1806 of yacc.c  */
-#line 337 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.MakeAst((yyvsp[(1) - (1)].statementList)); }
+  case 2: /* start: top_statement_list  */
+#line 338 "/root/repo/src/Php54FullParser.y"
+                                                                        { if (analyzer.WasCancelled()) { YYABORT; } observers.MakeAst((yyvsp[0].statementList)); }
+#line 4318 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 3:
-
-/* Line 1806 of yacc.c  */
-#line 341 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 3: /* top_statement_list: top_statement_list top_statement  */
+#line 342 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4324 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 4:
-
-/* Line 1806 of yacc.c  */
-#line 342 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 4: /* top_statement_list: %empty  */
+#line 343 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMake(); }
+#line 4330 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 5:
-
-/* Line 1806 of yacc.c  */
-#line 346 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.NamespaceNameMake((yyvsp[(1) - (1)].semanticValue)); }
+  case 5: /* namespace_name: T_STRING  */
+#line 347 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.qualifiedName) = observers.NamespaceNameMake((yyvsp[0].semanticValue)); }
+#line 4336 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 6:
-
-/* Line 1806 of yacc.c  */
-#line 347 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.NamespaceNameAppend((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 6: /* namespace_name: namespace_name T_NS_SEPARATOR T_STRING  */
+#line 348 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.qualifiedName) = observers.NamespaceNameAppend((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4342 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 7:
-
-/* Line 1806 of yacc.c  */
-#line 351 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 7: /* top_statement: statement  */
+#line 352 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4348 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 8:
-
-/* Line 1806 of yacc.c  */
-#line 352 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 8: /* top_statement: function_declaration_statement  */
+#line 353 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4354 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 9:
-
-/* Line 1806 of yacc.c  */
-#line 353 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 9: /* top_statement: class_declaration_statement  */
+#line 354 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4360 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 10:
-
-/* Line 1806 of yacc.c  */
-#line 354 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 10: /* top_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 355 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 4366 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 11:
-
-/* Line 1806 of yacc.c  */
-#line 355 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[(2) - (3)].qualifiedName), (yyvsp[(1) - (3)].semanticValue)); observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 11: /* top_statement: T_NAMESPACE namespace_name ';'  */
+#line 356 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[-1].qualifiedName), (yyvsp[-2].semanticValue)); observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); }
+#line 4372 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 12:
-
-/* Line 1806 of yacc.c  */
-#line 356 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 12: /* $@1: %empty  */
+#line 357 "/root/repo/src/Php54FullParser.y"
+                                                                { observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); }
+#line 4378 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 357 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[(2) - (6)].qualifiedName), (yyvsp[(1) - (6)].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (6)].statementList)); }
+  case 13: /* top_statement: T_NAMESPACE namespace_name '{' $@1 top_statement_list '}'  */
+#line 358 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.NamespaceDeclarationFound((yyvsp[-4].qualifiedName), (yyvsp[-5].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4384 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 14:
-
-/* Line 1806 of yacc.c  */
-#line 358 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetDeclaredNamespace(NULL); }
+  case 14: /* $@2: %empty  */
+#line 359 "/root/repo/src/Php54FullParser.y"
+                                                                                { observers.SetDeclaredNamespace(NULL); }
+#line 4390 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 15:
-
-/* Line 1806 of yacc.c  */
-#line 359 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    {  (yyval.statementList) = observers.NamespaceGlobalDeclarationFound((yyvsp[(1) - (5)].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(4) - (5)].statementList)); }
+  case 15: /* top_statement: T_NAMESPACE '{' $@2 top_statement_list '}'  */
+#line 360 "/root/repo/src/Php54FullParser.y"
+                                                                        {  (yyval.statementList) = observers.NamespaceGlobalDeclarationFound((yyvsp[-4].semanticValue)); (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4396 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 16:
-
-/* Line 1806 of yacc.c  */
-#line 360 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseSetStartingPos((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].semanticValue)); }
+  case 16: /* top_statement: T_USE use_declarations ';'  */
+#line 361 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.NamespaceUseSetStartingPos((yyvsp[-1].statementList), (yyvsp[-2].semanticValue)); }
+#line 4402 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 17:
-
-/* Line 1806 of yacc.c  */
-#line 361 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 17: /* top_statement: constant_declaration ';'  */
+#line 362 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4408 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 18:
-
-/* Line 1806 of yacc.c  */
-#line 366 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].statementList)); }
+  case 18: /* use_declarations: use_declarations ',' use_declaration  */
+#line 367 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), (yyvsp[0].statementList)); }
+#line 4414 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 19:
-
-/* Line 1806 of yacc.c  */
-#line 367 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 19: /* use_declarations: use_declaration  */
+#line 368 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4420 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 20:
-
-/* Line 1806 of yacc.c  */
-#line 371 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUse((yyvsp[(1) - (1)].qualifiedName)); }
+  case 20: /* use_declaration: namespace_name  */
+#line 372 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.NamespaceUse((yyvsp[0].qualifiedName)); }
+#line 4426 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 21:
-
-/* Line 1806 of yacc.c  */
-#line 372 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAlias((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 21: /* use_declaration: namespace_name T_AS T_STRING  */
+#line 373 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.NamespaceUseAlias((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4432 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 22:
-
-/* Line 1806 of yacc.c  */
-#line 373 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 22: /* use_declaration: T_NS_SEPARATOR namespace_name  */
+#line 374 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.NamespaceUseAbsolute((yyvsp[0].qualifiedName)); }
+#line 4438 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 23:
-
-/* Line 1806 of yacc.c  */
-#line 374 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.NamespaceUseAbsoluteAlias((yyvsp[(2) - (4)].qualifiedName), (yyvsp[(4) - (4)].semanticValue)); }
+  case 23: /* use_declaration: T_NS_SEPARATOR namespace_name T_AS T_STRING  */
+#line 375 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.NamespaceUseAbsoluteAlias((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 4444 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 24:
-
-/* Line 1806 of yacc.c  */
-#line 378 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ConstantMake((yyvsp[(3) - (5)].semanticValue), analyzer.GetLineNumber())); }
+  case 24: /* constant_declaration: constant_declaration ',' T_STRING '=' static_scalar  */
+#line 379 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ConstantMake((yyvsp[-2].semanticValue), analyzer.GetLineNumber())); }
+#line 4450 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 25:
-
-/* Line 1806 of yacc.c  */
-#line 379 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ConstantMake((yyvsp[(2) - (4)].semanticValue), analyzer.GetLineNumber()); }
+  case 25: /* constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 380 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.ConstantMake((yyvsp[-2].semanticValue), analyzer.GetLineNumber()); }
+#line 4456 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 26:
-
-/* Line 1806 of yacc.c  */
-#line 383 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 26: /* inner_statement_list: inner_statement_list inner_statement  */
+#line 384 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4462 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 27:
-
-/* Line 1806 of yacc.c  */
-#line 384 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 27: /* inner_statement_list: %empty  */
+#line 385 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 4468 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 31:
-
-/* Line 1806 of yacc.c  */
-#line 391 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 31: /* inner_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 392 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4474 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 33:
-
-/* Line 1806 of yacc.c  */
-#line 396 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 33: /* statement: T_STRING ':'  */
+#line 397 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4480 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 34:
-
-/* Line 1806 of yacc.c  */
-#line 400 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 34: /* statement: error ';'  */
+#line 398 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListNil(); yyerrok; }
+#line 4486 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 35:
-
-/* Line 1806 of yacc.c  */
-#line 401 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (7)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (7)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (7)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (7)].statementList)); }
+  case 35: /* unticked_statement: '{' inner_statement_list '}'  */
+#line 402 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4492 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 36:
-
-/* Line 1806 of yacc.c  */
-#line 405 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (10)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (10)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (10)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (10)].statementList)); }
+  case 36: /* unticked_statement: T_IF '(' expr ')' statement elseif_list else_single  */
+#line 403 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-4].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4501 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 37:
+  case 37: /* unticked_statement: T_IF '(' expr ')' ':' inner_statement_list new_elseif_list new_else_single T_ENDIF ';'  */
+#line 407 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-7].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-4].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-3].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); }
+#line 4510 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 409 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (5)].expression));
-																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList));
+  case 38: /* unticked_statement: T_WHILE '(' expr ')' while_statement  */
+#line 411 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-2].expression));
+																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList));
 																										}
+#line 4518 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 38:
-
-/* Line 1806 of yacc.c  */
-#line 412 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(2) - (7)].statementList), (yyvsp[(5) - (7)].expression)); }
+  case 39: /* unticked_statement: T_DO statement T_WHILE '(' expr ')' ';'  */
+#line 414 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-5].statementList), (yyvsp[-2].expression)); }
+#line 4524 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 39:
-
-/* Line 1806 of yacc.c  */
-#line 421 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(3) - (9)].statementList), (yyvsp[(5) - (9)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (9)].statementList)); 
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(9) - (9)].statementList)); 
+  case 40: /* unticked_statement: T_FOR '(' for_expr ';' for_expr ';' for_expr ')' for_statement  */
+#line 423 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-6].statementList), (yyvsp[-4].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList)); 
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); 
 																									}
+#line 4533 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 40:
-
-/* Line 1806 of yacc.c  */
-#line 425 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(3) - (5)].expression)); 
-																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList));
+  case 41: /* unticked_statement: T_SWITCH '(' expr ')' switch_case_list  */
+#line 427 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-2].expression)); 
+																										  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList));
  																										}
+#line 4541 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 41:
-
-/* Line 1806 of yacc.c  */
-#line 428 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 42: /* unticked_statement: T_BREAK ';'  */
+#line 430 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4547 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 42:
-
-/* Line 1806 of yacc.c  */
-#line 429 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 43: /* unticked_statement: T_BREAK expr ';'  */
+#line 431 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4553 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 43:
-
-/* Line 1806 of yacc.c  */
-#line 430 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 44: /* unticked_statement: T_CONTINUE ';'  */
+#line 432 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4559 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 44:
-
-/* Line 1806 of yacc.c  */
-#line 431 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 45: /* unticked_statement: T_CONTINUE expr ';'  */
+#line 433 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4565 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 45:
-
-/* Line 1806 of yacc.c  */
-#line 432 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 46: /* unticked_statement: T_RETURN ';'  */
+#line 434 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4571 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 46:
-
-/* Line 1806 of yacc.c  */
-#line 433 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 47: /* unticked_statement: T_RETURN expr_without_variable ';'  */
+#line 435 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4577 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 47:
-
-/* Line 1806 of yacc.c  */
-#line 434 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].variable)); }
+  case 48: /* unticked_statement: T_RETURN variable ';'  */
+#line 436 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].variable)); }
+#line 4583 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 48:
-
-/* Line 1806 of yacc.c  */
-#line 435 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.GlobalVariablesStatementMake((yyvsp[(2) - (3)].statementList)); }
+  case 49: /* unticked_statement: T_GLOBAL global_var_list ';'  */
+#line 437 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.GlobalVariablesStatementMake((yyvsp[-1].statementList)); }
+#line 4589 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 49:
-
-/* Line 1806 of yacc.c  */
-#line 436 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StaticVariablesStatementMake((yyvsp[(2) - (3)].statementList)); }
+  case 50: /* unticked_statement: T_STATIC static_var_list ';'  */
+#line 438 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StaticVariablesStatementMake((yyvsp[-1].statementList)); }
+#line 4595 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 50:
-
-/* Line 1806 of yacc.c  */
-#line 437 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 51: /* unticked_statement: T_ECHO echo_expr_list ';'  */
+#line 439 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4601 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 51:
-
-/* Line 1806 of yacc.c  */
-#line 438 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 52: /* unticked_statement: T_INLINE_HTML  */
+#line 440 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4607 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 52:
-
-/* Line 1806 of yacc.c  */
-#line 439 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (2)].expression)); }
+  case 53: /* unticked_statement: expr ';'  */
+#line 441 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4613 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 53:
-
-/* Line 1806 of yacc.c  */
-#line 440 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 54: /* unticked_statement: T_UNSET '(' unset_variables ')' ';'  */
+#line 442 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4619 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 54:
-
-/* Line 1806 of yacc.c  */
-#line 443 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake();
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (8)].variable));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(5) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(6) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (8)].statementList)); }
+  case 55: /* unticked_statement: T_FOREACH '(' variable T_AS foreach_variable foreach_optional_arg ')' foreach_statement  */
+#line 445 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMake();
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-5].variable));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-3].expression));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4629 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 55:
-
-/* Line 1806 of yacc.c  */
-#line 450 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake();
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), observers.ExpressionMakeAsAssignmentExpression((yyvsp[(5) - (8)].variable)));
-																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[(6) - (8)].expression));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(8) - (8)].statementList)); }
+  case 56: /* unticked_statement: T_FOREACH '(' expr_without_variable T_AS variable foreach_optional_arg ')' foreach_statement  */
+#line 452 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMake();
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-5].expression));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), observers.ExpressionMakeAsAssignmentExpression((yyvsp[-3].variable)));
+																									  (yyval.statementList) = observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4639 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 56:
-
-/* Line 1806 of yacc.c  */
-#line 455 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 57: /* unticked_statement: T_DECLARE '(' declare_list ')' declare_statement  */
+#line 457 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4645 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 57:
-
-/* Line 1806 of yacc.c  */
-#line 456 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 58: /* unticked_statement: ';'  */
+#line 458 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4651 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 58:
-
-/* Line 1806 of yacc.c  */
-#line 460 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(3) - (13)].statementList), 
+  case 59: /* unticked_statement: T_TRY '{' inner_statement_list '}' T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}' additional_catches  */
+#line 462 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-10].statementList), 
 																											observers.AssignmentExpressionFromNewFound(
-																											observers.VariableStart((yyvsp[(8) - (13)].semanticValue)), 
-																											(yyvsp[(7) - (13)].qualifiedName),
+																											observers.VariableStart((yyvsp[-5].semanticValue)), 
+																											(yyvsp[-6].qualifiedName),
 																											NULL));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(11) - (13)].statementList));
-																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[(13) - (13)].statementList)); }
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[-2].statementList));
+																									  (yyval.statementList) = observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 4663 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 59:
-
-/* Line 1806 of yacc.c  */
-#line 467 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (3)].expression)); }
+  case 60: /* unticked_statement: T_THROW expr ';'  */
+#line 469 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].expression)); }
+#line 4669 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 60:
-
-/* Line 1806 of yacc.c  */
-#line 468 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 61: /* unticked_statement: T_GOTO T_STRING ';'  */
+#line 470 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4675 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 61:
-
-/* Line 1806 of yacc.c  */
-#line 472 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 62: /* additional_catches: non_empty_additional_catches  */
+#line 474 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4681 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 62:
-
-/* Line 1806 of yacc.c  */
-#line 473 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 63: /* additional_catches: %empty  */
+#line 475 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4687 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 63:
-
-/* Line 1806 of yacc.c  */
-#line 477 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 64: /* non_empty_additional_catches: additional_catch  */
+#line 479 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4693 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 64:
-
-/* Line 1806 of yacc.c  */
-#line 478 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 65: /* non_empty_additional_catches: non_empty_additional_catches additional_catch  */
+#line 480 "/root/repo/src/Php54FullParser.y"
+                                                                                                { observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4699 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 65:
-
-/* Line 1806 of yacc.c  */
-#line 483 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.AssignmentExpressionFromNewFound(
-																			   observers.VariableStart((yyvsp[(4) - (8)].semanticValue)), 
-																			   (yyvsp[(3) - (8)].qualifiedName),
+  case 66: /* additional_catch: T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}'  */
+#line 485 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.AssignmentExpressionFromNewFound(
+																			   observers.VariableStart((yyvsp[-4].semanticValue)), 
+																			   (yyvsp[-5].qualifiedName),
 																			   NULL));
-																		  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (8)].statementList)); }
+																		  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); }
+#line 4709 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 66:
-
-/* Line 1806 of yacc.c  */
-#line 491 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 67: /* unset_variables: unset_variable  */
+#line 493 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4715 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 67:
-
-/* Line 1806 of yacc.c  */
-#line 492 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList); }
+  case 68: /* unset_variables: unset_variables ',' unset_variable  */
+#line 494 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4721 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 71:
-
-/* Line 1806 of yacc.c  */
-#line 508 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.isMethod) = false; }
+  case 72: /* is_reference: %empty  */
+#line 510 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.isMethod) = false; }
+#line 4727 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 72:
-
-/* Line 1806 of yacc.c  */
-#line 509 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.isMethod) = true; }
+  case 73: /* is_reference: '&'  */
+#line 511 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.isMethod) = true; }
+#line 4733 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 73:
-
-/* Line 1806 of yacc.c  */
-#line 514 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(3) - (6)].semanticValue)); }
+  case 74: /* $@3: %empty  */
+#line 516 "/root/repo/src/Php54FullParser.y"
+                                                                { observers.SetCurrentMemberName((yyvsp[-3].semanticValue)); }
+#line 4739 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 74:
-
-/* Line 1806 of yacc.c  */
-#line 515 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeFunction((yyvsp[(3) - (10)].semanticValue), (yyvsp[(2) - (10)].isMethod), (yyvsp[(1) - (10)].semanticValue), (yyvsp[(5) - (10)].parametersList), (yyvsp[(9) - (10)].statementList), (yyvsp[(8) - (10)].semanticValue), (yyvsp[(10) - (10)].semanticValue));
+  case 75: /* unticked_function_declaration_statement: function is_reference T_STRING '(' parameter_list ')' $@3 '{' inner_statement_list '}'  */
+#line 517 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeFunction((yyvsp[-7].semanticValue), (yyvsp[-8].isMethod), (yyvsp[-9].semanticValue), (yyvsp[-5].parametersList), (yyvsp[-1].statementList), (yyvsp[-2].semanticValue), (yyvsp[0].semanticValue));
 											  observers.SetCurrentMemberName(NULL);
 											}
+#line 4747 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 75:
-
-/* Line 1806 of yacc.c  */
-#line 522 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (4)].semanticValue)); }
+  case 76: /* $@4: %empty  */
+#line 524 "/root/repo/src/Php54FullParser.y"
+                                                        { observers.SetCurrentClassName((yyvsp[-2].semanticValue)); }
+#line 4753 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 76:
-
-/* Line 1806 of yacc.c  */
-#line 523 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[(2) - (8)].semanticValue), (yyvsp[(1) - (8)].classSymbol), (yyvsp[(3) - (8)].classSymbol), (yyvsp[(4) - (8)].classSymbol), (yyvsp[(8) - (8)].semanticValue));
-											  observers.DeclareAssignedPropertiesFromAssignments((yyvsp[(7) - (8)].statementList));
+  case 77: /* unticked_class_declaration_statement: class_entry_type T_STRING extends_from implements_list $@4 '{' class_statement_list '}'  */
+#line 525 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[-6].semanticValue), (yyvsp[-7].classSymbol), (yyvsp[-5].classSymbol), (yyvsp[-4].classSymbol), (yyvsp[0].semanticValue));
+											  observers.DeclareAssignedPropertiesFromAssignments((yyvsp[-1].statementList));
 											  
 											   /*
 											   * parse out property and method PHP docs
@@ -4332,2526 +4763,2180 @@ yyreduce:
 											  pelet::ClassSymbolClass* clazz = (pelet::ClassSymbolClass*) (yyval.statementList)->At(0);
 											  observers.CreateMagicMethodsAndProperties((yyval.statementList), clazz);
  
-											  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (8)].statementList)); 
+											  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); 
 											  
 											 
 											  
 											  observers.SetCurrentClassName(NULL);  
 											}
+#line 4773 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 77:
-
-/* Line 1806 of yacc.c  */
-#line 539 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (3)].semanticValue)); }
+  case 78: /* $@5: %empty  */
+#line 541 "/root/repo/src/Php54FullParser.y"
+                                                                { observers.SetCurrentClassName((yyvsp[-1].semanticValue)); }
+#line 4779 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 78:
-
-/* Line 1806 of yacc.c  */
-#line 540 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[(2) - (7)].semanticValue), (yyvsp[(1) - (7)].classSymbol), NULL, (yyvsp[(3) - (7)].classSymbol), (yyvsp[(7) - (7)].semanticValue));
-											  observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (7)].statementList)); 
+  case 79: /* unticked_class_declaration_statement: interface_entry T_STRING interface_extends_list $@5 '{' class_statement_list '}'  */
+#line 542 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.ClassSymbolMake((yyvsp[-5].semanticValue), (yyvsp[-6].classSymbol), NULL, (yyvsp[-4].classSymbol), (yyvsp[0].semanticValue));
+											  observers.StatementListMerge((yyval.statementList), (yyvsp[-1].statementList)); 
 											  observers.SetCurrentClassName(NULL);    
 											}
+#line 4788 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 79:
-
-/* Line 1806 of yacc.c  */
-#line 547 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (1)].semanticValue), false, false, false, false); }
+  case 80: /* class_entry_type: T_CLASS  */
+#line 549 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[0].semanticValue), false, false, false, false); }
+#line 4794 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 80:
-
-/* Line 1806 of yacc.c  */
-#line 548 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (2)].semanticValue), true, false, false, false); }
+  case 81: /* class_entry_type: T_ABSTRACT T_CLASS  */
+#line 550 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[-1].semanticValue), true, false, false, false); }
+#line 4800 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 81:
-
-/* Line 1806 of yacc.c  */
-#line 549 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (1)].semanticValue), false, false, false, true); }
+  case 82: /* class_entry_type: T_TRAIT  */
+#line 551 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[0].semanticValue), false, false, false, true); }
+#line 4806 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 82:
-
-/* Line 1806 of yacc.c  */
-#line 550 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (2)].semanticValue), false, true, false, false); }
+  case 83: /* class_entry_type: T_FINAL T_CLASS  */
+#line 552 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[-1].semanticValue), false, true, false, false); }
+#line 4812 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 83:
-
-/* Line 1806 of yacc.c  */
-#line 554 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+  case 84: /* extends_from: %empty  */
+#line 556 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4818 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 84:
-
-/* Line 1806 of yacc.c  */
-#line 556 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolExtends((yyvsp[(2) - (2)].qualifiedName)); }
+  case 85: /* extends_from: T_EXTENDS fully_qualified_class_name  */
+#line 558 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classSymbol) = observers.ClassSymbolExtends((yyvsp[0].qualifiedName)); }
+#line 4824 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 85:
-
-/* Line 1806 of yacc.c  */
-#line 560 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[(1) - (1)].semanticValue), false, false, true, false); }
+  case 86: /* interface_entry: T_INTERFACE  */
+#line 562 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart((yyvsp[0].semanticValue), false, false, true, false); }
+#line 4830 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 86:
-
-/* Line 1806 of yacc.c  */
-#line 564 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+  case 87: /* interface_extends_list: %empty  */
+#line 566 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4836 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 87:
-
-/* Line 1806 of yacc.c  */
-#line 566 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
+  case 88: /* interface_extends_list: T_EXTENDS interface_list  */
+#line 568 "/root/repo/src/Php54FullParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4842 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 88:
-
-/* Line 1806 of yacc.c  */
-#line 570 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+  case 89: /* implements_list: %empty  */
+#line 572 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.classSymbol) = observers.ClassSymbolStart(NULL, false, false, false, false); }
+#line 4848 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 89:
-
-/* Line 1806 of yacc.c  */
-#line 572 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
+  case 90: /* implements_list: T_IMPLEMENTS interface_list  */
+#line 574 "/root/repo/src/Php54FullParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4854 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 90:
-
-/* Line 1806 of yacc.c  */
-#line 576 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[(1) - (1)].qualifiedName)); }
+  case 91: /* interface_list: fully_qualified_class_name  */
+#line 578 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[0].qualifiedName)); }
+#line 4860 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 91:
-
-/* Line 1806 of yacc.c  */
-#line 577 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[(1) - (3)].classSymbol), (yyvsp[(3) - (3)].qualifiedName)); }
-    break;
-
-  case 92:
-
-/* Line 1806 of yacc.c  */
-#line 581 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) =  observers.ExpressionNil(); }
-    break;
-
-  case 93:
-
-/* Line 1806 of yacc.c  */
-#line 582 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
-    break;
-
-  case 94:
-
-/* Line 1806 of yacc.c  */
-#line 586 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[(1) - (1)].variable)); }
-    break;
-
-  case 95:
-
-/* Line 1806 of yacc.c  */
-#line 587 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 96:
-
-/* Line 1806 of yacc.c  */
-#line 591 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 97:
-
-/* Line 1806 of yacc.c  */
-#line 592 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 98:
-
-/* Line 1806 of yacc.c  */
-#line 596 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 99:
-
-/* Line 1806 of yacc.c  */
-#line 597 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 100:
-
-/* Line 1806 of yacc.c  */
-#line 601 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 101:
-
-/* Line 1806 of yacc.c  */
-#line 602 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 102:
-
-/* Line 1806 of yacc.c  */
-#line 606 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 103:
-
-/* Line 1806 of yacc.c  */
-#line 607 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 104:
-
-/* Line 1806 of yacc.c  */
-#line 611 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 105:
-
-/* Line 1806 of yacc.c  */
-#line 612 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
-    break;
-
-  case 106:
-
-/* Line 1806 of yacc.c  */
-#line 613 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 107:
-
-/* Line 1806 of yacc.c  */
-#line 614 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (5)].statementList); }
-    break;
-
-  case 108:
-
-/* Line 1806 of yacc.c  */
-#line 618 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 109:
-
-/* Line 1806 of yacc.c  */
-#line 619 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (5)].statementList);
-																				  observers.StatementListAppend((yyval.statementList), (yyvsp[(3) - (5)].expression));
-																			      observers.StatementListMerge((yyval.statementList), (yyvsp[(5) - (5)].statementList)); 
-																				}
-    break;
-
-  case 110:
-
-/* Line 1806 of yacc.c  */
-#line 623 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (4)].statementList); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(4) - (4)].statementList));
-																				}
-    break;
-
-  case 113:
-
-/* Line 1806 of yacc.c  */
-#line 634 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 114:
-
-/* Line 1806 of yacc.c  */
-#line 635 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
-    break;
-
-  case 115:
-
-/* Line 1806 of yacc.c  */
-#line 639 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 116:
-
-/* Line 1806 of yacc.c  */
-#line 640 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); 
-															  observers.StatementListMerge((yyval.statementList), (yyvsp[(1) - (6)].statementList));
-															  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[(4) - (6)].expression))); 
-															  observers.StatementListMerge((yyval.statementList), (yyvsp[(6) - (6)].statementList)); }
-    break;
-
-  case 117:
-
-/* Line 1806 of yacc.c  */
-#line 647 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 118:
-
-/* Line 1806 of yacc.c  */
-#line 648 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(1) - (7)].statementList));
-																			  	  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[(4) - (7)].expression))); 
-																				  observers.StatementListMerge((yyval.statementList), (yyvsp[(7) - (7)].statementList)); }
-    break;
-
-  case 119:
-
-/* Line 1806 of yacc.c  */
-#line 655 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 120:
-
-/* Line 1806 of yacc.c  */
-#line 656 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (2)].statementList); }
-    break;
-
-  case 121:
-
-/* Line 1806 of yacc.c  */
-#line 660 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 122:
-
-/* Line 1806 of yacc.c  */
-#line 661 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (3)].statementList); }
-    break;
-
-  case 123:
-
-/* Line 1806 of yacc.c  */
-#line 665 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (1)].parametersList); }
-    break;
-
-  case 124:
-
-/* Line 1806 of yacc.c  */
-#line 666 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListNil(); }
-    break;
-
-  case 125:
-
-/* Line 1806 of yacc.c  */
-#line 671 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (2)].qualifiedName), (yyvsp[(2) - (2)].semanticValue), false, false); }
-    break;
-
-  case 126:
-
-/* Line 1806 of yacc.c  */
-#line 672 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue), true, false); }
-    break;
-
-  case 127:
-
-/* Line 1806 of yacc.c  */
-#line 673 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (5)].qualifiedName), (yyvsp[(3) - (5)].semanticValue), true, true);}
-    break;
-
-  case 128:
-
-/* Line 1806 of yacc.c  */
-#line 674 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[(1) - (4)].qualifiedName), (yyvsp[(2) - (4)].semanticValue), false, true); }
-    break;
-
-  case 129:
-
-/* Line 1806 of yacc.c  */
-#line 675 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (4)].parametersList), (yyvsp[(3) - (4)].qualifiedName), (yyvsp[(4) - (4)].semanticValue), false, false); }
-    break;
-
-  case 130:
-
-/* Line 1806 of yacc.c  */
-#line 676 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (5)].parametersList), (yyvsp[(3) - (5)].qualifiedName), (yyvsp[(5) - (5)].semanticValue), true, false); }
-    break;
-
-  case 131:
-
-/* Line 1806 of yacc.c  */
-#line 677 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (7)].parametersList), (yyvsp[(3) - (7)].qualifiedName), (yyvsp[(5) - (7)].semanticValue), true, true); }
-    break;
-
-  case 132:
-
-/* Line 1806 of yacc.c  */
-#line 678 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[(1) - (6)].parametersList), (yyvsp[(3) - (6)].qualifiedName), (yyvsp[(4) - (6)].semanticValue), false, true); }
-    break;
-
-  case 133:
-
-/* Line 1806 of yacc.c  */
-#line 682 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
-    break;
-
-  case 134:
-
-/* Line 1806 of yacc.c  */
-#line 683 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 135:
-
-/* Line 1806 of yacc.c  */
-#line 684 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 136:
-
-/* Line 1806 of yacc.c  */
-#line 685 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
-    break;
-
-  case 137:
-
-/* Line 1806 of yacc.c  */
-#line 689 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 138:
-
-/* Line 1806 of yacc.c  */
-#line 690 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) =  observers.StatementListNil(); }
-    break;
-
-  case 139:
-
-/* Line 1806 of yacc.c  */
-#line 694 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 140:
-
-/* Line 1806 of yacc.c  */
-#line 695 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].variable)); }
-    break;
-
-  case 141:
-
-/* Line 1806 of yacc.c  */
-#line 696 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 142:
-
-/* Line 1806 of yacc.c  */
-#line 697 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 143:
-
-/* Line 1806 of yacc.c  */
-#line 698 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].variable)); }
-    break;
-
-  case 144:
-
-/* Line 1806 of yacc.c  */
-#line 699 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (4)].statementList), (yyvsp[(4) - (4)].variable)); }
-    break;
-
-  case 145:
-
-/* Line 1806 of yacc.c  */
-#line 703 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 146:
-
-/* Line 1806 of yacc.c  */
-#line 704 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 147:
-
-/* Line 1806 of yacc.c  */
-#line 708 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeGlobalVariable((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 148:
-
-/* Line 1806 of yacc.c  */
-#line 709 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
-    break;
-
-  case 149:
-
-/* Line 1806 of yacc.c  */
-#line 710 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
-    break;
-
-  case 150:
-
-/* Line 1806 of yacc.c  */
-#line 714 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), observers.ExpressionMakeStaticVariable((yyvsp[(3) - (3)].semanticValue))); }
-    break;
-
-  case 151:
-
-/* Line 1806 of yacc.c  */
-#line 715 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (5)].statementList), observers.ExpressionMakeStaticVariable((yyvsp[(3) - (5)].semanticValue))); }
-    break;
-
-  case 152:
-
-/* Line 1806 of yacc.c  */
-#line 716 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[(1) - (1)].semanticValue))); }
-    break;
-
-  case 153:
-
-/* Line 1806 of yacc.c  */
-#line 717 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[(1) - (3)].semanticValue))); }
-    break;
-
-  case 154:
-
-/* Line 1806 of yacc.c  */
-#line 721 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
-    break;
-
-  case 155:
-
-/* Line 1806 of yacc.c  */
-#line 722 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
-    break;
-
-  case 156:
-
-/* Line 1806 of yacc.c  */
-#line 726 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariables((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].classMemberSymbol)); }
-    break;
-
-  case 157:
-
-/* Line 1806 of yacc.c  */
-#line 727 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
-    break;
-
-  case 158:
-
-/* Line 1806 of yacc.c  */
-#line 728 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 159:
-
-/* Line 1806 of yacc.c  */
-#line 730 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(4) - (7)].semanticValue)); }
-    break;
-
-  case 160:
-
-/* Line 1806 of yacc.c  */
-#line 731 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeMethod((yyvsp[(4) - (9)].semanticValue), (yyvsp[(1) - (9)].classMemberSymbol), (yyvsp[(3) - (9)].isMethod), (yyvsp[(2) - (9)].semanticValue), (yyvsp[(6) - (9)].parametersList), (yyvsp[(9) - (9)].classMemberSymbol));
-															  observers.SetCurrentMemberName(NULL);
-															}
-    break;
-
-  case 161:
-
-/* Line 1806 of yacc.c  */
-#line 738 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.TraitUseMake((yyvsp[(2) - (3)].traitUse), (yyvsp[(3) - (3)].statementList)); }
-    break;
-
-  case 162:
-
-/* Line 1806 of yacc.c  */
-#line 742 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitUse) = observers.TraitUseStart((yyvsp[(1) - (1)].qualifiedName)); }
-    break;
-
-  case 163:
-
-/* Line 1806 of yacc.c  */
-#line 744 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitUse) = observers.TraitUseAppend((yyvsp[(1) - (3)].traitUse), (yyvsp[(3) - (3)].qualifiedName)); }
-    break;
-
-  case 164:
-
-/* Line 1806 of yacc.c  */
-#line 748 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 165:
-
-/* Line 1806 of yacc.c  */
-#line 751 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 166:
-
-/* Line 1806 of yacc.c  */
-#line 755 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 167:
-
-/* Line 1806 of yacc.c  */
-#line 756 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 168:
-
-/* Line 1806 of yacc.c  */
-#line 760 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 169:
-
-/* Line 1806 of yacc.c  */
-#line 761 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
-    break;
-
-  case 170:
-
-/* Line 1806 of yacc.c  */
-#line 765 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (2)].traitInsteadOf)); }
-    break;
-
-  case 171:
-
-/* Line 1806 of yacc.c  */
-#line 766 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (2)].traitAlias)); }
-    break;
-
-  case 172:
-
-/* Line 1806 of yacc.c  */
-#line 771 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitInsteadOf) =  observers.TraitInsteadOfMake((yyvsp[(1) - (3)].traitAlias), (yyvsp[(3) - (3)].traitInsteadOf)); }
-    break;
-
-  case 173:
-
-/* Line 1806 of yacc.c  */
-#line 775 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitInsteadOf) = observers.TraitInsteadOfMakeReferenceList((yyvsp[(1) - (1)].qualifiedName)); }
-    break;
-
-  case 174:
-
-/* Line 1806 of yacc.c  */
-#line 776 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitInsteadOf) = observers.TraitInsteadOfAppendReferenceList((yyvsp[(1) - (3)].traitInsteadOf), (yyvsp[(3) - (3)].qualifiedName)); }
-    break;
-
-  case 175:
-
-/* Line 1806 of yacc.c  */
-#line 780 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitAlias) = observers.TraitAliasMakeMethodReferenceList((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 176:
-
-/* Line 1806 of yacc.c  */
-#line 781 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitAlias) = (yyvsp[(1) - (1)].traitAlias); }
-    break;
-
-  case 177:
-
-/* Line 1806 of yacc.c  */
-#line 785 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitAlias) = observers.TraitAliasMakeMethodReferenceList((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
-    break;
-
-  case 178:
-
-/* Line 1806 of yacc.c  */
-#line 789 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitAlias) = observers.TraitAliasMake((yyvsp[(1) - (4)].traitAlias), (yyvsp[(3) - (4)].classMemberSymbol), (yyvsp[(4) - (4)].semanticValue)); }
-    break;
-
-  case 179:
-
-/* Line 1806 of yacc.c  */
-#line 790 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.traitAlias) = observers.TraitAliasMake((yyvsp[(1) - (3)].traitAlias), observers.ClassMemberSymbolMake((yyvsp[(3) - (3)].semanticValue))); }
-    break;
-
-  case 180:
-
-/* Line 1806 of yacc.c  */
-#line 794 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
-    break;
-
-  case 181:
-
-/* Line 1806 of yacc.c  */
-#line 795 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 182:
-
-/* Line 1806 of yacc.c  */
-#line 799 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody(observers.StatementListNil(), (yyvsp[(1) - (1)].semanticValue), (yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 183:
-
-/* Line 1806 of yacc.c  */
-#line 800 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].semanticValue), (yyvsp[(3) - (3)].semanticValue)); }
-    break;
-
-  case 184:
-
-/* Line 1806 of yacc.c  */
-#line 804 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 185:
-
-/* Line 1806 of yacc.c  */
-#line 805 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMakeAsPublicVariable((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 186:
-
-/* Line 1806 of yacc.c  */
-#line 809 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
-    break;
-
-  case 187:
-
-/* Line 1806 of yacc.c  */
-#line 810 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
-    break;
-
-  case 188:
-
-/* Line 1806 of yacc.c  */
-#line 814 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[(1) - (1)].semanticValue)); }
-    break;
-
-  case 189:
-
-/* Line 1806 of yacc.c  */
-#line 815 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.classMemberSymbol) = observers.ClassMemberSymbolSetModifier((yyvsp[(1) - (2)].classMemberSymbol), (yyvsp[(2) - (2)].semanticValue)); }
-    break;
-
-  case 196:
-
-/* Line 1806 of yacc.c  */
-#line 828 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (3)].semanticValue), (yyvsp[(3) - (3)].semanticValue), false, analyzer.GetLineNumber())); }
-    break;
-
-  case 197:
-
-/* Line 1806 of yacc.c  */
-#line 829 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (5)].semanticValue), (yyvsp[(3) - (5)].semanticValue), false, analyzer.GetLineNumber()));  }
-    break;
-
-  case 198:
-
-/* Line 1806 of yacc.c  */
-#line 830 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(1) - (1)].semanticValue), (yyvsp[(1) - (1)].semanticValue), false, analyzer.GetLineNumber()); }
-    break;
-
-  case 199:
-
-/* Line 1806 of yacc.c  */
-#line 831 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(1) - (3)].semanticValue), (yyvsp[(1) - (3)].semanticValue), false, analyzer.GetLineNumber()); }
-    break;
-
-  case 200:
-
-/* Line 1806 of yacc.c  */
-#line 836 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[(3) - (5)].semanticValue), (yyvsp[(3) - (5)].semanticValue), true, analyzer.GetLineNumber())); }
-    break;
-
-  case 201:
-
-/* Line 1806 of yacc.c  */
-#line 837 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[(2) - (4)].semanticValue), (yyvsp[(1) - (4)].semanticValue), true, analyzer.GetLineNumber()); }
-    break;
-
-  case 202:
-
-/* Line 1806 of yacc.c  */
-#line 841 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 203:
-
-/* Line 1806 of yacc.c  */
-#line 842 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 204:
-
-/* Line 1806 of yacc.c  */
-#line 846 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
-    break;
-
-  case 205:
-
-/* Line 1806 of yacc.c  */
-#line 847 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 206:
-
-/* Line 1806 of yacc.c  */
-#line 851 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) =  observers.StatementListAppend((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 207:
-
-/* Line 1806 of yacc.c  */
-#line 852 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].expression)); }
-    break;
-
-  case 208:
-
-/* Line 1806 of yacc.c  */
-#line 856 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(1) - (2)].variable), (yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 209:
-
-/* Line 1806 of yacc.c  */
-#line 857 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
-    break;
-
-  case 210:
-
-/* Line 1806 of yacc.c  */
-#line 861 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (4)].variable); }
-    break;
-
-  case 211:
-
-/* Line 1806 of yacc.c  */
-#line 862 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
-    break;
-
-  case 212:
-
-/* Line 1806 of yacc.c  */
-#line 866 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(1) - (2)].variable), (yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 213:
-
-/* Line 1806 of yacc.c  */
-#line 867 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 92: /* interface_list: interface_list ',' fully_qualified_class_name  */
+#line 579 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.classSymbol) = observers.ClassSymbolAddToImplements((yyvsp[-2].classSymbol), (yyvsp[0].qualifiedName)); }
+#line 4866 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 214:
-
-/* Line 1806 of yacc.c  */
-#line 868 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
-    break;
-
-  case 215:
-
-/* Line 1806 of yacc.c  */
-#line 872 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
-    break;
-
-  case 216:
-
-/* Line 1806 of yacc.c  */
-#line 873 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
-    break;
-
-  case 217:
-
-/* Line 1806 of yacc.c  */
-#line 877 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeNewInstanceCall((yyvsp[(2) - (3)].qualifiedName), (yyvsp[(3) - (3)].statementList));  }
-    break;
-
-  case 218:
-
-/* Line 1806 of yacc.c  */
-#line 881 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeAssignmentList((yyvsp[(3) - (6)].statementList), (yyvsp[(6) - (6)].expression)); }
-    break;
-
-  case 219:
-
-/* Line 1806 of yacc.c  */
-#line 882 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromExpressionFound((yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 220:
-
-/* Line 1806 of yacc.c  */
-#line 883 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromVariableFound((yyvsp[(1) - (4)].variable), (yyvsp[(4) - (4)].variable)); }
-    break;
-
-  case 221:
-
-/* Line 1806 of yacc.c  */
-#line 884 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.AssignmentExpressionFromNewFound((yyvsp[(1) - (6)].variable), (yyvsp[(5) - (6)].qualifiedName), (yyvsp[(6) - (6)].statementList)); }
-    break;
-
-  case 222:
-
-/* Line 1806 of yacc.c  */
-#line 885 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
-    break;
-
-  case 223:
-
-/* Line 1806 of yacc.c  */
-#line 886 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 224:
-
-/* Line 1806 of yacc.c  */
-#line 887 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 225:
-
-/* Line 1806 of yacc.c  */
-#line 888 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 226:
-
-/* Line 1806 of yacc.c  */
-#line 889 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 227:
-
-/* Line 1806 of yacc.c  */
-#line 890 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 228:
-
-/* Line 1806 of yacc.c  */
-#line 891 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 229:
-
-/* Line 1806 of yacc.c  */
-#line 892 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 230:
-
-/* Line 1806 of yacc.c  */
-#line 893 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 231:
-
-/* Line 1806 of yacc.c  */
-#line 894 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 232:
-
-/* Line 1806 of yacc.c  */
-#line 895 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 233:
-
-/* Line 1806 of yacc.c  */
-#line 896 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].variable), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 234:
-
-/* Line 1806 of yacc.c  */
-#line 897 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(2) - (2)].semanticValue)->Token, (yyvsp[(1) - (2)].variable)); }
-    break;
-
-  case 235:
-
-/* Line 1806 of yacc.c  */
-#line 898 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 236:
-
-/* Line 1806 of yacc.c  */
-#line 899 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(2) - (2)].semanticValue)->Token, (yyvsp[(1) - (2)].variable)); }
-    break;
-
-  case 237:
-
-/* Line 1806 of yacc.c  */
-#line 900 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].variable)); }
-    break;
-
-  case 238:
-
-/* Line 1806 of yacc.c  */
-#line 901 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 239:
-
-/* Line 1806 of yacc.c  */
-#line 902 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 240:
-
-/* Line 1806 of yacc.c  */
-#line 903 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 241:
-
-/* Line 1806 of yacc.c  */
-#line 904 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 242:
-
-/* Line 1806 of yacc.c  */
-#line 905 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 243:
-
-/* Line 1806 of yacc.c  */
-#line 906 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 244:
-
-/* Line 1806 of yacc.c  */
-#line 907 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 245:
-
-/* Line 1806 of yacc.c  */
-#line 908 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 246:
-
-/* Line 1806 of yacc.c  */
-#line 909 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 247:
-
-/* Line 1806 of yacc.c  */
-#line 910 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 248:
-
-/* Line 1806 of yacc.c  */
-#line 911 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 249:
-
-/* Line 1806 of yacc.c  */
-#line 912 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 250:
-
-/* Line 1806 of yacc.c  */
-#line 913 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 251:
-
-/* Line 1806 of yacc.c  */
-#line 914 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
-    break;
-
-  case 252:
-
-/* Line 1806 of yacc.c  */
-#line 915 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 93: /* foreach_optional_arg: %empty  */
+#line 583 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) =  observers.ExpressionNil(); }
+#line 4872 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 253:
+  case 94: /* foreach_optional_arg: T_DOUBLE_ARROW foreach_variable  */
+#line 584 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 4878 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 916 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 95: /* foreach_variable: variable  */
+#line 588 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[0].variable)); }
+#line 4884 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 254:
+  case 96: /* foreach_variable: '&' variable  */
+#line 589 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionMakeAsAssignmentExpression((yyvsp[0].variable)); }
+#line 4890 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 917 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 97: /* for_statement: statement  */
+#line 593 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4896 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 255:
+  case 98: /* for_statement: ':' inner_statement_list T_ENDFOR ';'  */
+#line 594 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4902 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 918 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 99: /* foreach_statement: statement  */
+#line 598 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4908 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 256:
+  case 100: /* foreach_statement: ':' inner_statement_list T_ENDFOREACH ';'  */
+#line 599 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4914 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 919 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 101: /* declare_statement: statement  */
+#line 603 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4920 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 257:
+  case 102: /* declare_statement: ':' inner_statement_list T_ENDDECLARE ';'  */
+#line 604 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4926 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 920 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 103: /* declare_list: T_STRING '=' static_scalar  */
+#line 608 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4932 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 258:
+  case 104: /* declare_list: declare_list ',' T_STRING '=' static_scalar  */
+#line 609 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 4938 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 921 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 105: /* switch_case_list: '{' case_list '}'  */
+#line 613 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4944 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 259:
+  case 106: /* switch_case_list: '{' ';' case_list '}'  */
+#line 614 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4950 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 922 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 107: /* switch_case_list: ':' case_list T_ENDSWITCH ';'  */
+#line 615 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4956 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 260:
+  case 108: /* switch_case_list: ':' ';' case_list T_ENDSWITCH ';'  */
+#line 616 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4962 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 923 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 109: /* case_list: %empty  */
+#line 620 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 4968 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 261:
+  case 110: /* case_list: case_list T_CASE expr case_separator inner_statement_list  */
+#line 621 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-4].statementList);
+																				  observers.StatementListAppend((yyval.statementList), (yyvsp[-2].expression));
+																			      observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); 
+																				}
+#line 4977 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 924 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 111: /* case_list: case_list T_DEFAULT case_separator inner_statement_list  */
+#line 625 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-3].statementList); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList));
+																				}
+#line 4985 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 262:
+  case 114: /* while_statement: statement  */
+#line 636 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4991 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 925 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 115: /* while_statement: ':' inner_statement_list T_ENDWHILE ';'  */
+#line 637 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4997 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 263:
+  case 116: /* elseif_list: %empty  */
+#line 641 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5003 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 926 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 117: /* elseif_list: elseif_list T_ELSEIF '(' expr ')' statement  */
+#line 642 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMake(); 
+															  observers.StatementListMerge((yyval.statementList), (yyvsp[-5].statementList));
+															  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[-2].expression))); 
+															  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 5012 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 264:
+  case 118: /* new_elseif_list: %empty  */
+#line 649 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 5018 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 927 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 119: /* new_elseif_list: new_elseif_list T_ELSEIF '(' expr ')' ':' inner_statement_list  */
+#line 650 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMake(); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[-6].statementList));
+																			  	  observers.StatementListMerge((yyval.statementList), observers.StatementListMakeAndAppend((yyvsp[-3].expression))); 
+																				  observers.StatementListMerge((yyval.statementList), (yyvsp[0].statementList)); }
+#line 5027 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 265:
+  case 120: /* else_single: %empty  */
+#line 657 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 5033 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 928 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[(2) - (3)].semanticValue)->Token, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 121: /* else_single: T_ELSE statement  */
+#line 658 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5039 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 266:
+  case 122: /* new_else_single: %empty  */
+#line 662 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 5045 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 929 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionInstanceOfOperation((yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].qualifiedName)); }
+  case 123: /* new_else_single: T_ELSE ':' inner_statement_list  */
+#line 663 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5051 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 267:
+  case 124: /* parameter_list: non_empty_parameter_list  */
+#line 667 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.parametersList) = (yyvsp[0].parametersList); }
+#line 5057 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 930 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (3)].expression); }
+  case 125: /* parameter_list: %empty  */
+#line 668 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.parametersList) = observers.ParametersListNil(); }
+#line 5063 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 268:
+  case 126: /* non_empty_parameter_list: optional_class_type T_VARIABLE  */
+#line 673 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-1].qualifiedName), (yyvsp[0].semanticValue), false, false); }
+#line 5069 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 931 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 127: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE  */
+#line 674 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue), true, false); }
+#line 5075 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 269:
+  case 128: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 675 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-4].qualifiedName), (yyvsp[-2].semanticValue), true, true);}
+#line 5081 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 932 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.NewInstanceAppendToChain((yyvsp[(2) - (4)].expression), (yyvsp[(4) - (4)].variable)); }
+  case 129: /* non_empty_parameter_list: optional_class_type T_VARIABLE '=' static_scalar  */
+#line 676 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.parametersList) = observers.ParametersListCreate((yyvsp[-3].qualifiedName), (yyvsp[-2].semanticValue), false, true); }
+#line 5087 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 270:
+  case 130: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE  */
+#line 677 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-3].parametersList), (yyvsp[-1].qualifiedName), (yyvsp[0].semanticValue), false, false); }
+#line 5093 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 935 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[(1) - (5)].expression), (yyvsp[(3) - (5)].expression), (yyvsp[(5) - (5)].expression)); }
+  case 131: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE  */
+#line 678 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-4].parametersList), (yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue), true, false); }
+#line 5099 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 271:
+  case 132: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 679 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-6].parametersList), (yyvsp[-4].qualifiedName), (yyvsp[-2].semanticValue), true, true); }
+#line 5105 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 937 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[(1) - (4)].expression), (yyvsp[(4) - (4)].expression), NULL); }
+  case 133: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE '=' static_scalar  */
+#line 680 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.parametersList) = observers.ParametersListAppend((yyvsp[-5].parametersList), (yyvsp[-3].qualifiedName), (yyvsp[-2].semanticValue), false, true); }
+#line 5111 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 272:
+  case 134: /* optional_class_type: %empty  */
+#line 684 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 5117 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 938 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 135: /* optional_class_type: T_ARRAY  */
+#line 685 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[0].semanticValue)); }
+#line 5123 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 273:
+  case 136: /* optional_class_type: T_CALLABLE  */
+#line 686 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.qualifiedName) = observers.QualifiedNameCreate((yyvsp[0].semanticValue)); }
+#line 5129 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 939 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 137: /* optional_class_type: fully_qualified_class_name  */
+#line 687 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5135 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 274:
+  case 138: /* function_call_parameter_list: non_empty_function_call_parameter_list  */
+#line 691 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5141 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 940 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 139: /* function_call_parameter_list: %empty  */
+#line 692 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) =  observers.StatementListNil(); }
+#line 5147 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 275:
+  case 140: /* non_empty_function_call_parameter_list: expr_without_variable  */
+#line 696 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5153 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 941 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 141: /* non_empty_function_call_parameter_list: variable  */
+#line 697 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 5159 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 276:
+  case 142: /* non_empty_function_call_parameter_list: '&' w_variable  */
+#line 698 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 5165 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 942 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeArray(observers.StatementListMakeAndAppend((yyvsp[(2) - (2)].expression))); }
+  case 143: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' expr_without_variable  */
+#line 699 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5171 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 277:
+  case 144: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' variable  */
+#line 700 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].variable)); }
+#line 5177 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 943 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 145: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' '&' w_variable  */
+#line 701 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-3].statementList), (yyvsp[0].variable)); }
+#line 5183 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 278:
+  case 146: /* global_var_list: global_var_list ',' global_var  */
+#line 705 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5189 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 944 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 147: /* global_var_list: global_var  */
+#line 706 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5195 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 279:
+  case 148: /* global_var: T_VARIABLE  */
+#line 710 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionMakeGlobalVariable((yyvsp[0].semanticValue)); }
+#line 5201 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 945 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 149: /* global_var: '$' r_variable  */
+#line 711 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 5207 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 280:
+  case 150: /* global_var: '$' '{' expr '}'  */
+#line 712 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 5213 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 946 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 151: /* static_var_list: static_var_list ',' T_VARIABLE  */
+#line 716 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), observers.ExpressionMakeStaticVariable((yyvsp[0].semanticValue))); }
+#line 5219 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 281:
+  case 152: /* static_var_list: static_var_list ',' T_VARIABLE '=' static_scalar  */
+#line 717 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-4].statementList), observers.ExpressionMakeStaticVariable((yyvsp[-2].semanticValue))); }
+#line 5225 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 947 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[(1) - (2)].semanticValue)->Token, (yyvsp[(2) - (2)].expression)); }
+  case 153: /* static_var_list: T_VARIABLE  */
+#line 718 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[0].semanticValue))); }
+#line 5231 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 282:
+  case 154: /* static_var_list: T_VARIABLE '=' static_scalar  */
+#line 719 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.ExpressionMakeStaticVariable((yyvsp[-2].semanticValue))); }
+#line 5237 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 948 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression);}
+  case 155: /* class_statement_list: class_statement_list class_statement  */
+#line 723 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 5243 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 283:
+  case 156: /* class_statement_list: %empty  */
+#line 724 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMake(); }
+#line 5249 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 949 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[(3) - (4)].statementList)); }
+  case 157: /* class_statement: variable_modifiers class_variable_declaration ';'  */
+#line 728 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeVariables((yyvsp[-1].statementList), (yyvsp[-2].classMemberSymbol)); }
+#line 5255 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 284:
+  case 158: /* class_statement: class_constant_declaration ';'  */
+#line 729 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5261 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 950 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[(2) - (3)].statementList)); }
+  case 159: /* class_statement: trait_use_statement  */
+#line 730 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5267 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 285:
+  case 160: /* $@6: %empty  */
+#line 732 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { observers.SetCurrentMemberName((yyvsp[-3].semanticValue)); }
+#line 5273 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 951 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].expression)); /* results of backtick operator is a string */ }
+  case 161: /* class_statement: method_modifiers function is_reference T_STRING '(' parameter_list ')' $@6 method_body  */
+#line 733 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.ClassMemberSymbolMakeMethod((yyvsp[-5].semanticValue), (yyvsp[-8].classMemberSymbol), (yyvsp[-6].isMethod), (yyvsp[-7].semanticValue), (yyvsp[-3].parametersList), (yyvsp[0].classMemberSymbol));
+															  observers.SetCurrentMemberName(NULL);
+															}
+#line 5281 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 286:
+  case 162: /* class_statement: error ';'  */
+#line 736 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListNil(); yyerrok; }
+#line 5287 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 952 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (2)].expression)); }
+  case 163: /* trait_use_statement: T_USE trait_list trait_adaptations  */
+#line 741 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.TraitUseMake((yyvsp[-1].traitUse), (yyvsp[0].statementList)); }
+#line 5293 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 287:
+  case 164: /* trait_list: fully_qualified_class_name  */
+#line 745 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.traitUse) = observers.TraitUseStart((yyvsp[0].qualifiedName)); }
+#line 5299 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 955 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 165: /* trait_list: trait_list ',' fully_qualified_class_name  */
+#line 747 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.traitUse) = observers.TraitUseAppend((yyvsp[-2].traitUse), (yyvsp[0].qualifiedName)); }
+#line 5305 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 288:
+  case 166: /* trait_adaptations: ';'  */
+#line 751 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.statementList) = observers.StatementListNil(); }
+#line 5311 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 956 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[(4) - (10)].parametersList), (yyvsp[(6) - (10)].statementList), (yyvsp[(9) - (10)].statementList), (yyvsp[(7) - (10)].semanticValue), (yyvsp[(10) - (10)].semanticValue)); 
-																	
-																	  // end after we create the closure so that closure gets the correct scope
-																	  // anonymous function count
-																	  observers.EndAnonymousFunction(); 
-																	}
+  case 167: /* trait_adaptations: '{' trait_adaptation_list '}'  */
+#line 754 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5317 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 289:
+  case 168: /* trait_adaptation_list: %empty  */
+#line 758 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5323 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 963 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 169: /* trait_adaptation_list: non_empty_trait_adaptation_list  */
+#line 759 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5329 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 290:
+  case 170: /* non_empty_trait_adaptation_list: trait_adaptation_statement  */
+#line 763 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5335 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 964 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[(5) - (11)].parametersList), (yyvsp[(7) - (11)].statementList), (yyvsp[(10) - (11)].statementList), (yyvsp[(8) - (11)].semanticValue), (yyvsp[(11) - (11)].semanticValue));  
-			
-																	  // end after we create the closure so that closure gets the correct scope
-																	  // anonymous function count
-																	  observers.EndAnonymousFunction(); 
-																	}
+  case 171: /* non_empty_trait_adaptation_list: non_empty_trait_adaptation_list trait_adaptation_statement  */
+#line 764 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 5341 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 292:
+  case 172: /* trait_adaptation_statement: trait_precedence ';'  */
+#line 768 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].traitInsteadOf)); }
+#line 5347 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 977 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 173: /* trait_adaptation_statement: trait_alias ';'  */
+#line 769 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[-1].traitAlias)); }
+#line 5353 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 293:
+  case 174: /* trait_precedence: trait_method_reference_fully_qualified T_INSTEADOF trait_reference_list  */
+#line 774 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.traitInsteadOf) =  observers.TraitInsteadOfMake((yyvsp[-2].traitAlias), (yyvsp[0].traitInsteadOf)); }
+#line 5359 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 978 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
+  case 175: /* trait_reference_list: fully_qualified_class_name  */
+#line 778 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.traitInsteadOf) = observers.TraitInsteadOfMakeReferenceList((yyvsp[0].qualifiedName)); }
+#line 5365 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 294:
+  case 176: /* trait_reference_list: trait_reference_list ',' fully_qualified_class_name  */
+#line 779 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.traitInsteadOf) = observers.TraitInsteadOfAppendReferenceList((yyvsp[-2].traitInsteadOf), (yyvsp[0].qualifiedName)); }
+#line 5371 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 982 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (3)].statementList), 
-														       observers.VariableStart((yyvsp[(3) - (3)].semanticValue))
-		                                                   ); 
-		                                            }
+  case 177: /* trait_method_reference: T_STRING  */
+#line 783 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.traitAlias) = observers.TraitAliasMakeMethodReferenceList((yyvsp[0].semanticValue)); }
+#line 5377 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 295:
+  case 178: /* trait_method_reference: trait_method_reference_fully_qualified  */
+#line 784 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.traitAlias) = (yyvsp[0].traitAlias); }
+#line 5383 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 986 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListAppend((yyvsp[(1) - (4)].statementList), 
-	                                                         observers.VariableStart((yyvsp[(4) - (4)].semanticValue), true)
-		                                                   ); 
-		                                            }
+  case 179: /* trait_method_reference_fully_qualified: fully_qualified_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 788 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.traitAlias) = observers.TraitAliasMakeMethodReferenceList((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 5389 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 296:
+  case 180: /* trait_alias: trait_method_reference T_AS trait_modifiers T_STRING  */
+#line 792 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.traitAlias) = observers.TraitAliasMake((yyvsp[-3].traitAlias), (yyvsp[-1].classMemberSymbol), (yyvsp[0].semanticValue)); }
+#line 5395 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 990 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[(1) - (1)].semanticValue))); }
+  case 181: /* trait_alias: trait_method_reference T_AS member_modifier  */
+#line 793 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.traitAlias) = observers.TraitAliasMake((yyvsp[-2].traitAlias), observers.ClassMemberSymbolMake((yyvsp[0].semanticValue))); }
+#line 5401 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 297:
+  case 182: /* trait_modifiers: %empty  */
+#line 797 "/root/repo/src/Php54FullParser.y"
+                                                                                                       { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
+#line 5407 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 991 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[(2) - (2)].semanticValue), true)); }
+  case 183: /* trait_modifiers: member_modifier  */
+#line 798 "/root/repo/src/Php54FullParser.y"
+                                                                                                  { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[0].semanticValue)); }
+#line 5413 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 298:
+  case 184: /* method_body: ';'  */
+#line 802 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody(observers.StatementListNil(), (yyvsp[0].semanticValue), (yyvsp[0].semanticValue)); }
+#line 5419 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 996 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCall((yyvsp[(1) - (4)].qualifiedName), (yyvsp[(3) - (4)].statementList), analyzer.GetLineNumber()); }
+  case 185: /* method_body: '{' inner_statement_list '}'  */
+#line 803 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classMemberSymbol) = observers.ClassMemberMakeBody((yyvsp[-1].statementList), (yyvsp[-2].semanticValue), (yyvsp[0].semanticValue)); }
+#line 5425 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 299:
+  case 186: /* variable_modifiers: non_empty_member_modifiers  */
+#line 807 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5431 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 999 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCallFromDeclaredNamespace((yyvsp[(3) - (6)].qualifiedName), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber()); }
+  case 187: /* variable_modifiers: T_VAR  */
+#line 808 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMakeAsPublicVariable((yyvsp[0].semanticValue)); }
+#line 5437 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 300:
+  case 188: /* method_modifiers: %empty  */
+#line 812 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake(NULL); }
+#line 5443 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1001 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeFunctionCallFromAbsoluteNamespace((yyvsp[(2) - (5)].qualifiedName), (yyvsp[(4) - (5)].statementList), analyzer.GetLineNumber()); }
+  case 189: /* method_modifiers: non_empty_member_modifiers  */
+#line 813 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5449 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 301:
+  case 190: /* non_empty_member_modifiers: member_modifier  */
+#line 817 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.classMemberSymbol) = observers.ClassMemberSymbolMake((yyvsp[0].semanticValue)); }
+#line 5455 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1003 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeStaticMethodCall((yyvsp[(1) - (6)].qualifiedName), (yyvsp[(3) - (6)].variable), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber()); }
+  case 191: /* non_empty_member_modifiers: non_empty_member_modifiers member_modifier  */
+#line 818 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.classMemberSymbol) = observers.ClassMemberSymbolSetModifier((yyvsp[-1].classMemberSymbol), (yyvsp[0].semanticValue)); }
+#line 5461 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 302:
+  case 198: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE  */
+#line 831 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[0].semanticValue), (yyvsp[0].semanticValue), false, analyzer.GetLineNumber())); }
+#line 5467 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1005 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 199: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE '=' static_scalar  */
+#line 832 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), false, analyzer.GetLineNumber()));  }
+#line 5473 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 303:
+  case 200: /* class_variable_declaration: T_VARIABLE  */
+#line 833 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[0].semanticValue), (yyvsp[0].semanticValue), false, analyzer.GetLineNumber()); }
+#line 5479 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1007 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 201: /* class_variable_declaration: T_VARIABLE '=' static_scalar  */
+#line 834 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), false, analyzer.GetLineNumber()); }
+#line 5485 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 304:
+  case 202: /* class_constant_declaration: class_constant_declaration ',' T_STRING '=' static_scalar  */
+#line 839 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-2].semanticValue), true, analyzer.GetLineNumber())); }
+#line 5491 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1009 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 203: /* class_constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 840 "/root/repo/src/Php54FullParser.y"
+                                                    { (yyval.statementList) = observers.ClassMemberSymbolMakeVariable((yyvsp[-2].semanticValue), (yyvsp[-3].semanticValue), true, analyzer.GetLineNumber()); }
+#line 5497 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 305:
+  case 204: /* echo_expr_list: echo_expr_list ',' expr  */
+#line 844 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5503 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1011 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 205: /* echo_expr_list: expr  */
+#line 845 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5509 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 306:
+  case 206: /* for_expr: %empty  */
+#line 849 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 5515 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1015 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 207: /* for_expr: non_empty_for_expr  */
+#line 850 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5521 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 307:
+  case 208: /* non_empty_for_expr: non_empty_for_expr ',' expr  */
+#line 854 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.statementList) =  observers.StatementListAppend((yyvsp[-2].statementList), (yyvsp[0].expression)); }
+#line 5527 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1016 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 209: /* non_empty_for_expr: expr  */
+#line 855 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].expression)); }
+#line 5533 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 308:
+  case 210: /* chaining_method_or_property: chaining_method_or_property variable_property  */
+#line 859 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 5539 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1017 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName)); }
+  case 211: /* chaining_method_or_property: variable_property  */
+#line 860 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 5545 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 309:
+  case 212: /* chaining_dereference: chaining_dereference '[' dim_offset ']'  */
+#line 864 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = (yyvsp[-3].variable); }
+#line 5551 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1018 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 213: /* chaining_dereference: '[' dim_offset ']'  */
+#line 865 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5557 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 310:
+  case 214: /* chaining_instance_call: chaining_dereference chaining_method_or_property  */
+#line 869 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 5563 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1022 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 215: /* chaining_instance_call: chaining_dereference  */
+#line 870 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 5569 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 311:
+  case 216: /* chaining_instance_call: chaining_method_or_property  */
+#line 871 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 5575 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1023 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName)); }
+  case 217: /* instance_call: %empty  */
+#line 875 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 5581 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 312:
+  case 218: /* instance_call: chaining_instance_call  */
+#line 876 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 5587 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1024 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName)); }
+  case 219: /* new_expr: T_NEW class_name_reference ctor_arguments  */
+#line 880 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeNewInstanceCall((yyvsp[-1].qualifiedName), (yyvsp[0].statementList));  }
+#line 5593 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 313:
+  case 220: /* expr_without_variable: T_LIST '(' assignment_list ')' '=' expr  */
+#line 884 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeAssignmentList((yyvsp[-3].statementList), (yyvsp[0].expression)); }
+#line 5599 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1028 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 221: /* expr_without_variable: variable '=' expr  */
+#line 885 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.AssignmentExpressionFromExpressionFound((yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5605 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 314:
+  case 222: /* expr_without_variable: variable '=' '&' variable  */
+#line 886 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.AssignmentExpressionFromVariableFound((yyvsp[-3].variable), (yyvsp[0].variable)); }
+#line 5611 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1029 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 223: /* expr_without_variable: variable '=' '&' T_NEW class_name_reference ctor_arguments  */
+#line 887 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.AssignmentExpressionFromNewFound((yyvsp[-5].variable), (yyvsp[-1].qualifiedName), (yyvsp[0].statementList)); }
+#line 5617 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 315:
+  case 224: /* expr_without_variable: T_CLONE expr  */
+#line 888 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 5623 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1034 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 225: /* expr_without_variable: variable T_PLUS_EQUAL expr  */
+#line 889 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5629 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 316:
+  case 226: /* expr_without_variable: variable T_MINUS_EQUAL expr  */
+#line 890 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5635 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1035 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+  case 227: /* expr_without_variable: variable T_MUL_EQUAL expr  */
+#line 891 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5641 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 317:
+  case 228: /* expr_without_variable: variable T_DIV_EQUAL expr  */
+#line 892 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5647 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1039 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = (yyvsp[(1) - (2)].semanticValue); }
+  case 229: /* expr_without_variable: variable T_CONCAT_EQUAL expr  */
+#line 893 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5653 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 318:
+  case 230: /* expr_without_variable: variable T_MOD_EQUAL expr  */
+#line 894 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5659 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1040 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 231: /* expr_without_variable: variable T_AND_EQUAL expr  */
+#line 895 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5665 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 320:
+  case 232: /* expr_without_variable: variable T_OR_EQUAL expr  */
+#line 896 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5671 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1048 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 233: /* expr_without_variable: variable T_XOR_EQUAL expr  */
+#line 897 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5677 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 321:
+  case 234: /* expr_without_variable: variable T_SL_EQUAL expr  */
+#line 898 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5683 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1049 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 235: /* expr_without_variable: variable T_SR_EQUAL expr  */
+#line 899 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionAssignmentCompoundOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].variable), (yyvsp[0].expression)); }
+#line 5689 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 322:
+  case 236: /* expr_without_variable: rw_variable T_INC  */
+#line 900 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[0].semanticValue)->Token, (yyvsp[-1].variable)); }
+#line 5695 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1050 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (3)].expression); }
+  case 237: /* expr_without_variable: T_INC rw_variable  */
+#line 901 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].variable)); }
+#line 5701 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 323:
+  case 238: /* expr_without_variable: rw_variable T_DEC  */
+#line 902 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[0].semanticValue)->Token, (yyvsp[-1].variable)); }
+#line 5707 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1054 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 239: /* expr_without_variable: T_DEC rw_variable  */
+#line 903 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryVariableOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].variable)); }
+#line 5713 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 324:
+  case 240: /* expr_without_variable: expr T_BOOLEAN_OR expr  */
+#line 904 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5719 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1055 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 241: /* expr_without_variable: expr T_BOOLEAN_AND expr  */
+#line 905 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5725 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 325:
+  case 242: /* expr_without_variable: expr T_LOGICAL_OR expr  */
+#line 906 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5731 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1056 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 243: /* expr_without_variable: expr T_LOGICAL_AND expr  */
+#line 907 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5737 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 326:
+  case 244: /* expr_without_variable: expr T_LOGICAL_XOR expr  */
+#line 908 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5743 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1060 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListNil(); }
+  case 245: /* expr_without_variable: expr '|' expr  */
+#line 909 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5749 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 327:
+  case 246: /* expr_without_variable: expr '&' expr  */
+#line 910 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5755 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1061 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 247: /* expr_without_variable: expr '^' expr  */
+#line 911 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5761 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 328:
+  case 248: /* expr_without_variable: expr '.' expr  */
+#line 912 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5767 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1065 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 249: /* expr_without_variable: expr '+' expr  */
+#line 913 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5773 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 329:
+  case 250: /* expr_without_variable: expr '-' expr  */
+#line 914 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5779 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1066 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 251: /* expr_without_variable: expr '*' expr  */
+#line 915 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5785 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 330:
+  case 252: /* expr_without_variable: expr '/' expr  */
+#line 916 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5791 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1067 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 253: /* expr_without_variable: expr '%' expr  */
+#line 917 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5797 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 331:
+  case 254: /* expr_without_variable: expr T_SL expr  */
+#line 918 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5803 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1068 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 255: /* expr_without_variable: expr T_SR expr  */
+#line 919 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5809 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 332:
+  case 256: /* expr_without_variable: '+' expr  */
+#line 920 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5815 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1069 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 257: /* expr_without_variable: '-' expr  */
+#line 921 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5821 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 333:
+  case 258: /* expr_without_variable: '!' expr  */
+#line 922 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5827 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1070 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 259: /* expr_without_variable: '~' expr  */
+#line 923 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5833 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 334:
+  case 260: /* expr_without_variable: expr T_IS_IDENTICAL expr  */
+#line 924 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5839 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1071 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 261: /* expr_without_variable: expr T_IS_NOT_IDENTICAL expr  */
+#line 925 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5845 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 335:
+  case 262: /* expr_without_variable: expr T_IS_EQUAL expr  */
+#line 926 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5851 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1072 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 263: /* expr_without_variable: expr T_IS_NOT_EQUAL expr  */
+#line 927 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5857 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 336:
+  case 264: /* expr_without_variable: expr '<' expr  */
+#line 928 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5863 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1073 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 265: /* expr_without_variable: expr T_IS_SMALLER_OR_EQUAL expr  */
+#line 929 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5869 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 337:
+  case 266: /* expr_without_variable: expr '>' expr  */
+#line 930 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5875 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1074 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 267: /* expr_without_variable: expr T_IS_GREATER_OR_EQUAL expr  */
+#line 931 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionBinaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5881 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 338:
+  case 268: /* expr_without_variable: expr T_INSTANCEOF class_name_reference  */
+#line 932 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionInstanceOfOperation((yyvsp[-2].expression), (yyvsp[0].qualifiedName)); }
+#line 5887 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1075 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].semanticValue)); }
+  case 269: /* expr_without_variable: '(' expr ')'  */
+#line 933 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = (yyvsp[-1].expression); }
+#line 5893 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 339:
+  case 270: /* expr_without_variable: new_expr  */
+#line 934 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 5899 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1076 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (2)].semanticValue)); }
+  case 271: /* expr_without_variable: '(' new_expr ')' instance_call  */
+#line 935 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.NewInstanceAppendToChain((yyvsp[-2].expression), (yyvsp[0].variable)); }
+#line 5905 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 340:
+  case 272: /* expr_without_variable: expr '?' expr ':' expr  */
+#line 938 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[-4].expression), (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 5911 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1080 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 273: /* expr_without_variable: expr '?' ':' expr  */
+#line 940 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionTernaryOperation((yyvsp[-3].expression), (yyvsp[0].expression), NULL); }
+#line 5917 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 341:
+  case 274: /* expr_without_variable: internal_functions_in_yacc  */
+#line 941 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 5923 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1081 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 275: /* expr_without_variable: T_INT_CAST expr  */
+#line 942 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5929 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 342:
+  case 276: /* expr_without_variable: T_DOUBLE_CAST expr  */
+#line 943 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5935 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1082 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 277: /* expr_without_variable: T_STRING_CAST expr  */
+#line 944 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5941 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 343:
+  case 278: /* expr_without_variable: T_ARRAY_CAST expr  */
+#line 945 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionMakeArray(observers.StatementListMakeAndAppend((yyvsp[0].expression))); }
+#line 5947 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1083 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 279: /* expr_without_variable: T_OBJECT_CAST expr  */
+#line 946 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5953 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 344:
+  case 280: /* expr_without_variable: T_BOOL_CAST expr  */
+#line 947 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5959 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1084 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 281: /* expr_without_variable: T_UNSET_CAST expr  */
+#line 948 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5965 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 345:
+  case 282: /* expr_without_variable: T_EXIT exit_expr  */
+#line 949 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5971 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1085 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 283: /* expr_without_variable: '@' expr  */
+#line 950 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionUnaryOperation((yyvsp[-1].semanticValue)->Token, (yyvsp[0].expression)); }
+#line 5977 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 346:
+  case 284: /* expr_without_variable: scalar  */
+#line 951 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = (yyvsp[0].expression);}
+#line 5983 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1086 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(3) - (4)].semanticValue)); }
+  case 285: /* expr_without_variable: T_ARRAY '(' array_pair_list ')'  */
+#line 952 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[-1].statementList)); }
+#line 5989 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 347:
+  case 286: /* expr_without_variable: '[' array_pair_list ']'  */
+#line 953 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeArray((yyvsp[-1].statementList)); }
+#line 5995 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1087 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].semanticValue)); }
+  case 287: /* expr_without_variable: '`' backticks_expr '`'  */
+#line 954 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].expression)); /* results of backtick operator is a string */ }
+#line 6001 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 348:
+  case 288: /* expr_without_variable: T_PRINT expr  */
+#line 955 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].expression)); }
+#line 6007 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1088 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 289: /* $@7: %empty  */
+#line 958 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 6013 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 349:
+  case 290: /* expr_without_variable: function is_reference '(' parameter_list ')' lexical_vars '{' $@7 inner_statement_list '}'  */
+#line 959 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[-6].parametersList), (yyvsp[-4].statementList), (yyvsp[-1].statementList), (yyvsp[-3].semanticValue), (yyvsp[0].semanticValue)); 
+																	
+																	  // end after we create the closure so that closure gets the correct scope
+																	  // anonymous function count
+																	  observers.EndAnonymousFunction(); 
+																	}
+#line 6024 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1089 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 291: /* $@8: %empty  */
+#line 966 "/root/repo/src/Php54FullParser.y"
+                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 6030 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 350:
+  case 292: /* expr_without_variable: T_STATIC function is_reference '(' parameter_list ')' lexical_vars '{' $@8 inner_statement_list '}'  */
+#line 967 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeClosure((yyvsp[-6].parametersList), (yyvsp[-4].statementList), (yyvsp[-1].statementList), (yyvsp[-3].semanticValue), (yyvsp[0].semanticValue));  
+			
+																	  // end after we create the closure so that closure gets the correct scope
+																	  // anonymous function count
+																	  observers.EndAnonymousFunction(); 
+																	}
+#line 6041 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1093 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 294: /* lexical_vars: %empty  */
+#line 980 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 6047 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 351:
+  case 295: /* lexical_vars: T_USE '(' lexical_var_list ')'  */
+#line 981 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6053 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1097 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 296: /* lexical_var_list: lexical_var_list ',' T_VARIABLE  */
+#line 985 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-2].statementList), 
+														       observers.VariableStart((yyvsp[0].semanticValue))
+		                                                   ); 
+		                                            }
+#line 6062 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 352:
+  case 297: /* lexical_var_list: lexical_var_list ',' '&' T_VARIABLE  */
+#line 989 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListAppend((yyvsp[-3].statementList), 
+	                                                         observers.VariableStart((yyvsp[0].semanticValue), true)
+		                                                   ); 
+		                                            }
+#line 6071 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1098 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 298: /* lexical_var_list: T_VARIABLE  */
+#line 993 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[0].semanticValue))); }
+#line 6077 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 353:
+  case 299: /* lexical_var_list: '&' T_VARIABLE  */
+#line 994 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend(observers.VariableStart((yyvsp[0].semanticValue), true)); }
+#line 6083 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1099 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant((yyvsp[(1) - (1)].qualifiedName)); }
+  case 300: /* function_call: namespace_name '(' function_call_parameter_list ')'  */
+#line 999 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCall((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 6089 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 354:
+  case 301: /* function_call: T_NAMESPACE T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 1002 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCallFromDeclaredNamespace((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 6095 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1100 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[(3) - (3)].qualifiedName))); }
+  case 302: /* function_call: T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 1004 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeFunctionCallFromAbsoluteNamespace((yyvsp[-3].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 6101 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 355:
+  case 303: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_name '(' function_call_parameter_list ')'  */
+#line 1006 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableMakeStaticMethodCall((yyvsp[-5].qualifiedName), (yyvsp[-3].variable), (yyvsp[-1].statementList), analyzer.GetLineNumber()); }
+#line 6107 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1101 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeAbsolute((yyvsp[(2) - (2)].qualifiedName))); }
+  case 304: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1008 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6113 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 357:
+  case 305: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_name '(' function_call_parameter_list ')'  */
+#line 1010 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6119 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1103 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(2) - (3)].expression)); }
+  case 306: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1012 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6125 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 358:
+  case 307: /* function_call: variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1014 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6131 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1104 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (3)].semanticValue)); }
+  case 308: /* class_name: T_STATIC  */
+#line 1018 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 6137 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 359:
+  case 309: /* class_name: namespace_name  */
+#line 1019 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6143 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1105 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[(1) - (1)].semanticValue)); }
+  case 310: /* class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1020 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName)); }
+#line 6149 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 360:
+  case 311: /* class_name: T_NS_SEPARATOR namespace_name  */
+#line 1021 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName)); }
+#line 6155 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1109 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 312: /* fully_qualified_class_name: namespace_name  */
+#line 1025 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6161 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 362:
+  case 313: /* fully_qualified_class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1026 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName)); }
+#line 6167 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1114 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.isComma) = false; }
+  case 314: /* fully_qualified_class_name: T_NS_SEPARATOR namespace_name  */
+#line 1027 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName)); }
+#line 6173 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 363:
+  case 315: /* class_name_reference: class_name  */
+#line 1031 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6179 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1115 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.isComma) = true; }
+  case 316: /* class_name_reference: dynamic_class_name_reference  */
+#line 1032 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6185 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 364:
+  case 317: /* dynamic_class_name_reference: base_variable T_OBJECT_OPERATOR object_property dynamic_class_name_variable_properties  */
+#line 1037 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 6191 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1119 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 318: /* dynamic_class_name_reference: base_variable  */
+#line 1038 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.qualifiedName) = observers.QualifiedNameNil(); }
+#line 6197 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 365:
+  case 319: /* dynamic_class_name_variable_properties: dynamic_class_name_variable_properties dynamic_class_name_variable_property  */
+#line 1042 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.semanticValue) = (yyvsp[-1].semanticValue); }
+#line 6203 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1120 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 320: /* dynamic_class_name_variable_properties: %empty  */
+#line 1043 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6209 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 366:
+  case 322: /* exit_expr: %empty  */
+#line 1051 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6215 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1121 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 323: /* exit_expr: '(' ')'  */
+#line 1052 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6221 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 367:
+  case 324: /* exit_expr: '(' expr ')'  */
+#line 1053 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6227 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1122 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 325: /* backticks_expr: %empty  */
+#line 1057 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6233 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 368:
+  case 326: /* backticks_expr: T_ENCAPSED_AND_WHITESPACE  */
+#line 1058 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6239 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1126 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].variable); }
+  case 327: /* backticks_expr: encaps_list  */
+#line 1059 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6245 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 373:
+  case 328: /* ctor_arguments: %empty  */
+#line 1063 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListNil(); }
+#line 6251 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1146 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMake((yyvsp[(1) - (5)].variable), (yyvsp[(3) - (5)].variable), (yyvsp[(4) - (5)].variable), (yyvsp[(5) - (5)].variable)); }
+  case 329: /* ctor_arguments: '(' function_call_parameter_list ')'  */
+#line 1064 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6257 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 374:
+  case 330: /* common_scalar: T_LNUMBER  */
+#line 1068 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6263 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1147 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMake((yyvsp[(1) - (1)].variable), NULL, NULL, NULL); }
+  case 331: /* common_scalar: T_DNUMBER  */
+#line 1069 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6269 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 375:
+  case 332: /* common_scalar: T_CONSTANT_ENCAPSED_STRING  */
+#line 1070 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6275 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1151 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(1) - (2)].variable), (yyvsp[(2) - (2)].variable)); }
+  case 333: /* common_scalar: T_LINE  */
+#line 1071 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6281 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 376:
+  case 334: /* common_scalar: T_FILE  */
+#line 1072 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6287 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1152 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 335: /* common_scalar: T_DIR  */
+#line 1073 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6293 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 377:
+  case 336: /* common_scalar: T_TRAIT_C  */
+#line 1074 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6299 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1157 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendToChain((yyvsp[(2) - (3)].variable), (yyvsp[(3) - (3)].variable), (yyvsp[(1) - (3)].semanticValue));  }
+  case 337: /* common_scalar: T_METHOD_C  */
+#line 1075 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6305 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 378:
+  case 338: /* common_scalar: T_FUNC_C  */
+#line 1076 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6311 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1161 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression));}
+  case 339: /* common_scalar: T_NS_C  */
+#line 1077 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6317 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 379:
+  case 340: /* common_scalar: T_START_HEREDOC T_ENCAPSED_AND_WHITESPACE T_END_HEREDOC  */
+#line 1078 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 6323 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1162 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 341: /* common_scalar: T_START_HEREDOC T_END_HEREDOC  */
+#line 1079 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 6329 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 380:
+  case 342: /* static_scalar: common_scalar  */
+#line 1083 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6335 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1166 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeAndAppendFunctionCall((yyvsp[(2) - (3)].statementList), true); }
+  case 343: /* static_scalar: namespace_name  */
+#line 1084 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6341 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 381:
+  case 344: /* static_scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1085 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6347 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1170 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 345: /* static_scalar: T_NS_SEPARATOR namespace_name  */
+#line 1086 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6353 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 382:
+  case 346: /* static_scalar: '+' static_scalar  */
+#line 1087 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6359 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1171 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 347: /* static_scalar: '-' static_scalar  */
+#line 1088 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6365 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 383:
+  case 348: /* static_scalar: T_ARRAY '(' static_array_pair_list ')'  */
+#line 1089 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 6371 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1172 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 349: /* static_scalar: '[' static_array_pair_list ']'  */
+#line 1090 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].semanticValue)); }
+#line 6377 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 385:
+  case 350: /* static_scalar: static_class_constant  */
+#line 1091 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6383 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1177 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[(2) - (2)].variable)); }
+  case 351: /* static_scalar: T_CLASS_C  */
+#line 1092 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6389 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 386:
+  case 352: /* static_class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1096 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 6395 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1181 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableStartStaticMember((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].variable)); }
+  case 353: /* scalar: T_STRING_VARNAME  */
+#line 1100 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6401 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 387:
+  case 354: /* scalar: class_constant  */
+#line 1101 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6407 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1182 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 355: /* scalar: namespace_name  */
+#line 1102 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalarFromConstant((yyvsp[0].qualifiedName)); }
+#line 6413 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 388:
+  case 356: /* scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1103 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeFromDeclaredNamespace((yyvsp[0].qualifiedName))); }
+#line 6419 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1186 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.semanticValue) = observers.SemanticValueNil(); }
+  case 357: /* scalar: T_NS_SEPARATOR namespace_name  */
+#line 1104 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionMakeScalarFromConstant(observers.QualifiedNameMakeAbsolute((yyvsp[0].qualifiedName))); }
+#line 6425 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 389:
+  case 359: /* scalar: '"' encaps_list '"'  */
+#line 1106 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-1].expression)); }
+#line 6431 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1190 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 360: /* scalar: T_START_HEREDOC encaps_list T_END_HEREDOC  */
+#line 1107 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[-2].semanticValue)); }
+#line 6437 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 390:
+  case 361: /* scalar: T_CLASS_C  */
+#line 1108 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionMakeScalar((yyvsp[0].semanticValue)); }
+#line 6443 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1191 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 362: /* static_array_pair_list: %empty  */
+#line 1112 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6449 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 392:
+  case 364: /* possible_comma: %empty  */
+#line 1117 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.isComma) = false; }
+#line 6455 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1196 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 365: /* possible_comma: ','  */
+#line 1118 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.isComma) = true; }
+#line 6461 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 393:
+  case 366: /* non_empty_static_array_pair_list: non_empty_static_array_pair_list ',' static_scalar T_DOUBLE_ARROW static_scalar  */
+#line 1122 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6467 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1197 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 367: /* non_empty_static_array_pair_list: non_empty_static_array_pair_list ',' static_scalar  */
+#line 1123 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6473 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 395:
+  case 368: /* non_empty_static_array_pair_list: static_scalar T_DOUBLE_ARROW static_scalar  */
+#line 1124 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6479 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1202 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[(2) - (2)].variable)); }
+  case 369: /* non_empty_static_array_pair_list: static_scalar  */
+#line 1125 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                                                { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6485 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 397:
+  case 370: /* expr: r_variable  */
+#line 1129 "/root/repo/src/Php54FullParser.y"
+                                                                         { (yyval.expression) = (yyvsp[0].variable); }
+#line 6491 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1207 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 375: /* variable: base_variable_with_function_calls T_OBJECT_OPERATOR object_property method_or_not variable_properties  */
+#line 1149 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.variable) = observers.VariableMake((yyvsp[-4].variable), (yyvsp[-2].variable), (yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 6497 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 398:
+  case 376: /* variable: base_variable_with_function_calls  */
+#line 1150 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = observers.VariableMake((yyvsp[0].variable), NULL, NULL, NULL); }
+#line 6503 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1208 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 377: /* variable_properties: variable_properties variable_property  */
+#line 1154 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable)); }
+#line 6509 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 400:
+  case 378: /* variable_properties: %empty  */
+#line 1155 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.variable) = observers.VariableNil(); }
+#line 6515 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1213 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableStart((yyvsp[(1) - (1)].semanticValue)); }
+  case 379: /* variable_property: T_OBJECT_OPERATOR object_property method_or_not  */
+#line 1160 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = observers.VariableAppendToChain((yyvsp[-1].variable), (yyvsp[0].variable), (yyvsp[-2].semanticValue));  }
+#line 6521 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 401:
+  case 380: /* array_method_dereference: array_method_dereference '[' dim_offset ']'  */
+#line 1164 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression));}
+#line 6527 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1214 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 381: /* array_method_dereference: method '[' dim_offset ']'  */
+#line 1165 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6533 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 402:
+  case 382: /* method: '(' function_call_parameter_list ')'  */
+#line 1169 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = observers.VariableMakeAndAppendFunctionCall((yyvsp[-1].statementList), true); }
+#line 6539 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1218 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 383: /* method_or_not: method  */
+#line 1173 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6545 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 403:
+  case 384: /* method_or_not: array_method_dereference  */
+#line 1174 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6551 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1219 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 385: /* method_or_not: %empty  */
+#line 1175 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6557 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 404:
+  case 387: /* variable_without_objects: simple_indirect_reference reference_variable  */
+#line 1180 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[0].variable)); }
+#line 6563 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1223 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 388: /* static_member: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1184 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.variable) = observers.VariableStartStaticMember((yyvsp[-2].qualifiedName), (yyvsp[0].variable)); }
+#line 6569 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 405:
+  case 389: /* static_member: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1185 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6575 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1224 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 390: /* variable_class_name: reference_variable  */
+#line 1189 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.semanticValue) = observers.SemanticValueNil(); }
+#line 6581 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 406:
+  case 391: /* array_function_dereference: array_function_dereference '[' dim_offset ']'  */
+#line 1193 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6587 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1228 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[(1) - (4)].variable), (yyvsp[(3) - (4)].expression)); }
+  case 392: /* array_function_dereference: function_call '[' dim_offset ']'  */
+#line 1194 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6593 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 407:
+  case 394: /* base_variable_with_function_calls: array_function_dereference  */
+#line 1199 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 6599 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1229 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 395: /* base_variable_with_function_calls: function_call  */
+#line 1200 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6605 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 408:
+  case 397: /* base_variable: simple_indirect_reference reference_variable  */
+#line 1205 "/root/repo/src/Php54FullParser.y"
+                                                             { (yyval.variable) = observers.VariableMakeIndirect((yyvsp[0].variable)); }
+#line 6611 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1230 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = (yyvsp[(1) - (1)].variable); }
+  case 399: /* reference_variable: reference_variable '[' dim_offset ']'  */
+#line 1210 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6617 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 409:
+  case 400: /* reference_variable: reference_variable '{' expr '}'  */
+#line 1211 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6623 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1234 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    {  (yyval.variable) = observers.VariableStart((yyvsp[(1) - (1)].semanticValue)); }
+  case 402: /* compound_variable: T_VARIABLE  */
+#line 1216 "/root/repo/src/Php54FullParser.y"
+                                                { (yyval.variable) = observers.VariableStart((yyvsp[0].semanticValue)); }
+#line 6629 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 410:
+  case 403: /* compound_variable: '$' '{' expr '}'  */
+#line 1217 "/root/repo/src/Php54FullParser.y"
+                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6635 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1235 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.variable) = observers.VariableNil(); }
+  case 404: /* dim_offset: %empty  */
+#line 1221 "/root/repo/src/Php54FullParser.y"
+                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6641 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 413:
+  case 405: /* dim_offset: expr  */
+#line 1222 "/root/repo/src/Php54FullParser.y"
+                                        { (yyval.expression) = (yyvsp[0].expression); }
+#line 6647 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1244 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), (yyvsp[(3) - (3)].statementList)); }
+  case 406: /* object_property: object_dim_list  */
+#line 1226 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.variable) = (yyvsp[0].variable); }
+#line 6653 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 414:
+  case 407: /* object_property: variable_without_objects  */
+#line 1227 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 6659 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1245 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 408: /* object_dim_list: object_dim_list '[' dim_offset ']'  */
+#line 1231 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableAppendArrayOffset((yyvsp[-3].variable), (yyvsp[-1].expression)); }
+#line 6665 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 415:
+  case 409: /* object_dim_list: object_dim_list '{' expr '}'  */
+#line 1232 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6671 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1249 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[(1) - (1)].variable)); }
+  case 410: /* object_dim_list: variable_name  */
+#line 1233 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.variable) = (yyvsp[0].variable); }
+#line 6677 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 416:
+  case 411: /* variable_name: T_STRING  */
+#line 1237 "/root/repo/src/Php54FullParser.y"
+                                                                {  (yyval.variable) = observers.VariableStart((yyvsp[0].semanticValue)); }
+#line 6683 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1250 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
+  case 412: /* variable_name: '{' expr '}'  */
+#line 1238 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.variable) = observers.VariableNil(); }
+#line 6689 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 417:
+  case 415: /* assignment_list: assignment_list ',' assignment_list_element  */
+#line 1247 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), (yyvsp[0].statementList)); }
+#line 6695 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1251 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 416: /* assignment_list: assignment_list_element  */
+#line 1248 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 6701 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 418:
+  case 417: /* assignment_list_element: variable  */
+#line 1252 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMakeAndAppend((yyvsp[0].variable)); }
+#line 6707 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1255 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMake(); }
+  case 418: /* assignment_list_element: T_LIST '(' assignment_list ')'  */
+#line 1253 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6713 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 419:
+  case 419: /* assignment_list_element: %empty  */
+#line 1254 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 6719 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1256 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 420: /* array_pair_list: %empty  */
+#line 1258 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMake(); }
+#line 6725 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 420:
+  case 421: /* array_pair_list: non_empty_array_pair_list possible_comma  */
+#line 1259 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 6731 "/root/repo/src/Php54FullParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1260 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (5)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair((yyvsp[(3) - (5)].expression), (yyvsp[(5) - (5)].expression))
+  case 422: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW expr  */
+#line 1263 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.statementList) = observers.StatementListMerge((yyvsp[-4].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair((yyvsp[-2].expression), (yyvsp[0].expression))
                                                                                        ); 
                                                                                 }
+#line 6740 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 421:
-
-/* Line 1806 of yacc.c  */
-#line 1264 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (3)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[(3) - (3)].expression))
+  case 423: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr  */
+#line 1267 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-2].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].expression))
                                                                                        ); 
                                                                                 }
+#line 6749 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 422:
-
-/* Line 1806 of yacc.c  */
-#line 1268 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)); }
+  case 424: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW expr  */
+#line 1271 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 6755 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 423:
-
-/* Line 1806 of yacc.c  */
-#line 1269 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[(1) - (1)].expression)); }
+  case 425: /* non_empty_array_pair_list: expr  */
+#line 1272 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                        { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].expression)); }
+#line 6761 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 424:
-
-/* Line 1806 of yacc.c  */
-#line 1270 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (6)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair((yyvsp[(3) - (6)].expression), (yyvsp[(6) - (6)].variable))
+  case 426: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1273 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-5].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair((yyvsp[-3].expression), (yyvsp[0].variable))
                                                                                        ); 
                                                                                 }
+#line 6770 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 425:
-
-/* Line 1806 of yacc.c  */
-#line 1274 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.StatementListMerge((yyvsp[(1) - (4)].statementList), 
-                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[(4) - (4)].variable))
+  case 427: /* non_empty_array_pair_list: non_empty_array_pair_list ',' '&' w_variable  */
+#line 1277 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.statementList) = observers.StatementListMerge((yyvsp[-3].statementList), 
+                                                                                         observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].variable))
                                                                                        ); 
                                                                                 }
+#line 6779 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 426:
-
-/* Line 1806 of yacc.c  */
-#line 1278 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[(1) - (4)].expression), (yyvsp[(4) - (4)].variable)); }
+  case 428: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1281 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                { (yyval.statementList) = observers.ExpressionMakeArrayPair((yyvsp[-3].expression), (yyvsp[0].variable)); }
+#line 6785 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 427:
-
-/* Line 1806 of yacc.c  */
-#line 1279 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[(2) - (2)].variable)); }
+  case 429: /* non_empty_array_pair_list: '&' w_variable  */
+#line 1282 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                                { (yyval.statementList) = observers.ExpressionMakeArrayPair(NULL, (yyvsp[0].variable)); }
+#line 6791 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 428:
-
-/* Line 1806 of yacc.c  */
-#line 1283 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (2)].expression); }
+  case 430: /* encaps_list: encaps_list encaps_var  */
+#line 1286 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6797 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 429:
-
-/* Line 1806 of yacc.c  */
-#line 1284 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (2)].expression); }
+  case 431: /* encaps_list: encaps_list T_ENCAPSED_AND_WHITESPACE  */
+#line 1287 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6803 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 430:
-
-/* Line 1806 of yacc.c  */
-#line 1285 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 432: /* encaps_list: encaps_var  */
+#line 1288 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6809 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 431:
-
-/* Line 1806 of yacc.c  */
-#line 1286 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(2) - (2)].expression); }
+  case 433: /* encaps_list: T_ENCAPSED_AND_WHITESPACE encaps_var  */
+#line 1289 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 6815 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 432:
-
-/* Line 1806 of yacc.c  */
-#line 1290 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 434: /* encaps_var: T_VARIABLE  */
+#line 1293 "/root/repo/src/Php54FullParser.y"
+                                                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6821 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 433:
-
-/* Line 1806 of yacc.c  */
-#line 1291 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 435: /* encaps_var: T_VARIABLE '[' encaps_var_offset ']'  */
+#line 1294 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6827 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 434:
-
-/* Line 1806 of yacc.c  */
-#line 1292 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 436: /* encaps_var: T_VARIABLE T_OBJECT_OPERATOR T_STRING  */
+#line 1295 "/root/repo/src/Php54FullParser.y"
+                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6833 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 435:
-
-/* Line 1806 of yacc.c  */
-#line 1293 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 437: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES expr '}'  */
+#line 1296 "/root/repo/src/Php54FullParser.y"
+                                                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6839 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 436:
-
-/* Line 1806 of yacc.c  */
-#line 1294 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 438: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES T_STRING_VARNAME '[' expr ']' '}'  */
+#line 1297 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6845 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 437:
-
-/* Line 1806 of yacc.c  */
-#line 1295 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 439: /* encaps_var: T_CURLY_OPEN variable '}'  */
+#line 1298 "/root/repo/src/Php54FullParser.y"
+                                                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6851 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 438:
-
-/* Line 1806 of yacc.c  */
-#line 1299 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 440: /* encaps_var_offset: T_STRING  */
+#line 1302 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6857 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 439:
-
-/* Line 1806 of yacc.c  */
-#line 1300 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 441: /* encaps_var_offset: T_NUM_STRING  */
+#line 1303 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6863 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 440:
-
-/* Line 1806 of yacc.c  */
-#line 1301 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 442: /* encaps_var_offset: T_VARIABLE  */
+#line 1304 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.expression) = observers.ExpressionNil(); }
+#line 6869 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 441:
-
-/* Line 1806 of yacc.c  */
-#line 1305 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = (yyvsp[(3) - (4)].expression); }
+  case 443: /* internal_functions_in_yacc: T_ISSET '(' isset_variables ')'  */
+#line 1308 "/root/repo/src/Php54FullParser.y"
+                                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 6875 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 442:
-
-/* Line 1806 of yacc.c  */
-#line 1306 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 444: /* internal_functions_in_yacc: T_EMPTY '(' variable ')'  */
+#line 1309 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6881 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 443:
-
-/* Line 1806 of yacc.c  */
-#line 1307 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 445: /* internal_functions_in_yacc: T_INCLUDE expr  */
+#line 1310 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6887 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 444:
-
-/* Line 1806 of yacc.c  */
-#line 1308 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 446: /* internal_functions_in_yacc: T_INCLUDE_ONCE expr  */
+#line 1311 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6893 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 445:
-
-/* Line 1806 of yacc.c  */
-#line 1309 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionEval((yyvsp[(3) - (4)].expression)); }
+  case 447: /* internal_functions_in_yacc: T_EVAL '(' expr ')'  */
+#line 1312 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.ExpressionEval((yyvsp[-1].expression)); }
+#line 6899 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 446:
-
-/* Line 1806 of yacc.c  */
-#line 1310 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 448: /* internal_functions_in_yacc: T_REQUIRE expr  */
+#line 1313 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6905 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 447:
-
-/* Line 1806 of yacc.c  */
-#line 1311 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.IncludeFound((yyvsp[(2) - (2)].expression), analyzer.GetLineNumber()); }
+  case 449: /* internal_functions_in_yacc: T_REQUIRE_ONCE expr  */
+#line 1314 "/root/repo/src/Php54FullParser.y"
+                                                                        { (yyval.expression) = observers.IncludeFound((yyvsp[0].expression), analyzer.GetLineNumber()); }
+#line 6911 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 448:
-
-/* Line 1806 of yacc.c  */
-#line 1315 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionIsset((yyvsp[(1) - (1)].variable)); }
+  case 450: /* isset_variables: variable  */
+#line 1318 "/root/repo/src/Php54FullParser.y"
+                                                                                { (yyval.expression) = observers.ExpressionIsset((yyvsp[0].variable)); }
+#line 6917 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 449:
-
-/* Line 1806 of yacc.c  */
-#line 1316 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionIssetMerge((pelet::IssetExpressionClass*)(yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].variable)); }
+  case 451: /* isset_variables: isset_variables ',' variable  */
+#line 1319 "/root/repo/src/Php54FullParser.y"
+                                                        { (yyval.expression) = observers.ExpressionIssetMerge((pelet::IssetExpressionClass*)(yyvsp[-2].expression), (yyvsp[0].variable)); }
+#line 6923 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 450:
-
-/* Line 1806 of yacc.c  */
-#line 1320 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].semanticValue)); }
+  case 452: /* class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1323 "/root/repo/src/Php54FullParser.y"
+                                                                                                { (yyval.expression) = observers.ExpressionMakeClassConstant((yyvsp[-2].qualifiedName), (yyvsp[0].semanticValue)); }
+#line 6929 "/root/repo/src/Php54FullParser.cpp"
     break;
 
-  case 451:
-
-/* Line 1806 of yacc.c  */
-#line 1321 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-    { (yyval.expression) = observers.ExpressionNil(); }
+  case 453: /* class_constant: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1324 "/root/repo/src/Php54FullParser.y"
+                                                                                        { (yyval.expression) = observers.ExpressionNil(); }
+#line 6935 "/root/repo/src/Php54FullParser.cpp"
     break;
 
 
+#line 6939 "/root/repo/src/Php54FullParser.cpp"
 
-/* Line 1806 of yacc.c  */
-#line 6855 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6865,96 +6950,88 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == PHP54EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (analyzer, observers, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyps, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (analyzer, observers, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= T_END)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == T_END)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, analyzer, observers);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, analyzer, observers);
+          yychar = PHP54EMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -6966,14 +7043,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -6986,39 +7062,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -7029,27 +7108,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (analyzer, observers, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEMPTY)
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != PHP54EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -7057,30 +7140,36 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, analyzer, observers);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  return yyresult;
 }
-
-
-
-/* Line 2067 of yacc.c  */
-#line 1324 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54FullParser.y"
-
+#undef php54nerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 1327 "/root/repo/src/Php54FullParser.y"
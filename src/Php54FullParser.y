@@ -8,7 +8,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ParserType
+#define PHP54STYPE pelet::ParserType
 
 // so that both bison parses call the same lex function
 #define php54lex pelet::FullLex
@@ -24,9 +24,10 @@
 %lex-param { pelet::FullParserObserverClass& observers }
 
 %define api.pure
+%define api.push-pull both
 %expect 3
-%error-verbose
-%name-prefix "php54"
+%define parse.error verbose
+%define api.prefix {php54}
 %debug
 
 %left T_INCLUDE T_INCLUDE_ONCE T_EVAL T_REQUIRE T_REQUIRE_ONCE
@@ -334,7 +335,7 @@
 %% /* Rules */
 
 start:
-	top_statement_list						{ observers.MakeAst($1); }
+	top_statement_list						{ if (analyzer.WasCancelled()) { YYABORT; } observers.MakeAst($1); }
 ;
 
 top_statement_list:
@@ -394,6 +395,7 @@ inner_statement:
 statement:
 		unticked_statement
 	|	T_STRING ':'				{ $$ = observers.StatementListNil(); }
+	|	error ';'					{ $$ = observers.StatementListNil(); yyerrok; }
 ;
 
 unticked_statement:
@@ -731,6 +733,7 @@ class_statement:
 		method_body											{ $$ = observers.ClassMemberSymbolMakeMethod($4, $1, $3, $2, $6, $9);
 															  observers.SetCurrentMemberName(NULL);
 															}
+	|	error ';'											{ $$ = observers.StatementListNil(); yyerrok; }
 ;
 
 trait_use_statement:
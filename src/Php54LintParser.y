@@ -32,7 +32,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE int
+#define PHP54_LINT_STYPE int
 
 // so that both bison parses call the same lex function
 #define php54_lint_lex pelet::LintLex
@@ -47,8 +47,8 @@
 
 %define api.pure
 %expect 3
-%error-verbose
-%name-prefix "php54_lint_"
+%define parse.error verbose
+%define api.prefix {php54_lint_}
 %debug
 
 %left T_INCLUDE T_INCLUDE_ONCE T_EVAL T_REQUIRE T_REQUIRE_ONCE
@@ -284,6 +284,7 @@ inner_statement:
 statement:
 		unticked_statement
 	|	T_STRING ':'				
+	|	error ';'					{ yyerrok; }
 ;
 
 unticked_statement:
@@ -558,6 +559,7 @@ class_statement:
 	|	method_modifiers function is_reference T_STRING
 		'('	parameter_list  ')'								
 		method_body											
+	|	error ';'											{ yyerrok; }
 ;
 
 trait_use_statement:
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -53,28 +58,28 @@
 #define YYPURE 1
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
+/* Substitute the type names.  */
+#define YYSTYPE         PHP54_RESOURCE_STYPE
 /* Substitute the variable and function names.  */
 #define yyparse         php54_resource_parse
+#define yypush_parse    php54_resource_push_parse
+#define yypull_parse    php54_resource_pull_parse
+#define yypstate_new    php54_resource_pstate_new
+#define yypstate_clear  php54_resource_pstate_clear
+#define yypstate_delete php54_resource_pstate_delete
+#define yypstate        php54_resource_pstate
 #define yylex           php54_resource_lex
 #define yyerror         php54_resource_error
-#define yylval          php54_resource_lval
-#define yychar          php54_resource_char
 #define yydebug         php54_resource_debug
 #define yynerrs         php54_resource_nerrs
 
-
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
-#line 1 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
+/* First part of user prologue.  */
+#line 1 "/root/repo/src/Php54ResourceParser.y"
 
 
 /**
@@ -110,7 +115,7 @@
     #pragma warning(disable:4065) // Bison generates a switch statement without a case
  #endif
  
-#define YYSTYPE pelet::ResourceParserTypeClass
+#define PHP54_RESOURCE_STYPE pelet::ResourceParserTypeClass
 
 // so that both bison parses call the same lex function
 #define php54_resource_lex pelet::ResourceLex
@@ -119,210 +124,610 @@
 #define php54_resource_error pelet::ResourceGrammarError
 
 
+#line 128 "/root/repo/src/Php54ResourceParser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Line 268 of yacc.c  */
-#line 125 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.cpp"
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
+/* Debug traces.  */
+#ifndef PHP54_RESOURCE_DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define PHP54_RESOURCE_DEBUG 1
+#  else
+#   define PHP54_RESOURCE_DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define PHP54_RESOURCE_DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined PHP54_RESOURCE_DEBUG */
+#if PHP54_RESOURCE_DEBUG
+extern int php54_resource_debug;
 #endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
+/* Token kinds.  */
+#ifndef PHP54_RESOURCE_TOKENTYPE
+# define PHP54_RESOURCE_TOKENTYPE
+  enum php54_resource_tokentype
+  {
+    PHP54_RESOURCE_EMPTY = -2,
+    T_END = 0,                     /* T_END  */
+    PHP54_RESOURCE_error = 256,    /* error  */
+    PHP54_RESOURCE_UNDEF = 629,    /* "invalid token"  */
+    T_ABSTRACT = 502,              /* T_ABSTRACT  */
+    T_AND_EQUAL = 503,             /* T_AND_EQUAL  */
+    T_ARRAY = 504,                 /* T_ARRAY  */
+    T_ARRAY_CAST = 505,            /* T_ARRAY_CAST  */
+    T_AS = 506,                    /* T_AS  */
+    T_BAD_CHARACTER = 507,         /* T_BAD_CHARACTER  */
+    T_BOOL_CAST = 508,             /* T_BOOL_CAST  */
+    T_BOOLEAN_AND = 509,           /* T_BOOLEAN_AND  */
+    T_BOOLEAN_OR = 510,            /* T_BOOLEAN_OR  */
+    T_BREAK = 511,                 /* T_BREAK  */
+    T_CALLABLE = 512,              /* T_CALLABLE  */
+    T_CASE = 513,                  /* T_CASE  */
+    T_CATCH = 514,                 /* T_CATCH  */
+    T_CHARACTER = 515,             /* T_CHARACTER  */
+    T_CLASS = 516,                 /* T_CLASS  */
+    T_CLASS_C = 517,               /* T_CLASS_C  */
+    T_CLONE = 518,                 /* T_CLONE  */
+    T_CLOSE_TAG = 519,             /* T_CLOSE_TAG  */
+    T_COMMENT = 520,               /* T_COMMENT  */
+    T_CONCAT_EQUAL = 521,          /* T_CONCAT_EQUAL  */
+    T_CONST = 522,                 /* T_CONST  */
+    T_CONSTANT_ENCAPSED_STRING = 523, /* T_CONSTANT_ENCAPSED_STRING  */
+    T_CONTINUE = 524,              /* T_CONTINUE  */
+    T_CURLY_OPEN = 525,            /* T_CURLY_OPEN  */
+    T_DEC = 526,                   /* T_DEC  */
+    T_DECLARE = 527,               /* T_DECLARE  */
+    T_DEFAULT = 528,               /* T_DEFAULT  */
+    T_DIR = 529,                   /* T_DIR  */
+    T_DIV_EQUAL = 530,             /* T_DIV_EQUAL  */
+    T_DNUMBER = 531,               /* T_DNUMBER  */
+    T_DO = 532,                    /* T_DO  */
+    T_DOC_COMMENT = 533,           /* T_DOC_COMMENT  */
+    T_DOLLAR_OPEN_CURLY_BRACES = 534, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+    T_DOUBLE_ARROW = 535,          /* T_DOUBLE_ARROW  */
+    T_DOUBLE_CAST = 536,           /* T_DOUBLE_CAST  */
+    T_ECHO = 537,                  /* T_ECHO  */
+    T_ELSE = 538,                  /* T_ELSE  */
+    T_ELSEIF = 539,                /* T_ELSEIF  */
+    T_EMPTY = 540,                 /* T_EMPTY  */
+    T_ENCAPSED_AND_WHITESPACE = 541, /* T_ENCAPSED_AND_WHITESPACE  */
+    T_ENDDECLARE = 542,            /* T_ENDDECLARE  */
+    T_ENDFOR = 543,                /* T_ENDFOR  */
+    T_ENDFOREACH = 544,            /* T_ENDFOREACH  */
+    T_END_HEREDOC = 545,           /* T_END_HEREDOC  */
+    T_ENDIF = 546,                 /* T_ENDIF  */
+    T_ENDSWITCH = 547,             /* T_ENDSWITCH  */
+    T_ENDWHILE = 548,              /* T_ENDWHILE  */
+    T_EVAL = 549,                  /* T_EVAL  */
+    T_EXIT = 550,                  /* T_EXIT  */
+    T_EXTENDS = 551,               /* T_EXTENDS  */
+    T_FILE = 552,                  /* T_FILE  */
+    T_FINAL = 553,                 /* T_FINAL  */
+    T_FOR = 554,                   /* T_FOR  */
+    T_FOREACH = 555,               /* T_FOREACH  */
+    T_FUNC_C = 556,                /* T_FUNC_C  */
+    T_FUNCTION = 557,              /* T_FUNCTION  */
+    T_GLOBAL = 558,                /* T_GLOBAL  */
+    T_GOTO = 559,                  /* T_GOTO  */
+    T_HALT_COMPILER = 560,         /* T_HALT_COMPILER  */
+    T_IF = 561,                    /* T_IF  */
+    T_IMPLEMENTS = 562,            /* T_IMPLEMENTS  */
+    T_INC = 563,                   /* T_INC  */
+    T_INCLUDE = 564,               /* T_INCLUDE  */
+    T_INCLUDE_ONCE = 565,          /* T_INCLUDE_ONCE  */
+    T_INLINE_HTML = 566,           /* T_INLINE_HTML  */
+    T_INSTANCEOF = 567,            /* T_INSTANCEOF  */
+    T_INSTEADOF = 568,             /* T_INSTEADOF  */
+    T_INT_CAST = 569,              /* T_INT_CAST  */
+    T_INTERFACE = 570,             /* T_INTERFACE  */
+    T_IS_EQUAL = 571,              /* T_IS_EQUAL  */
+    T_IS_GREATER_OR_EQUAL = 572,   /* T_IS_GREATER_OR_EQUAL  */
+    T_IS_IDENTICAL = 573,          /* T_IS_IDENTICAL  */
+    T_IS_NOT_EQUAL = 574,          /* T_IS_NOT_EQUAL  */
+    T_IS_NOT_IDENTICAL = 575,      /* T_IS_NOT_IDENTICAL  */
+    T_ISSET = 576,                 /* T_ISSET  */
+    T_IS_SMALLER_OR_EQUAL = 577,   /* T_IS_SMALLER_OR_EQUAL  */
+    T_LINE = 578,                  /* T_LINE  */
+    T_LIST = 579,                  /* T_LIST  */
+    T_LNUMBER = 580,               /* T_LNUMBER  */
+    T_LOGICAL_AND = 581,           /* T_LOGICAL_AND  */
+    T_LOGICAL_OR = 582,            /* T_LOGICAL_OR  */
+    T_LOGICAL_XOR = 583,           /* T_LOGICAL_XOR  */
+    T_METHOD_C = 584,              /* T_METHOD_C  */
+    T_MINUS_EQUAL = 585,           /* T_MINUS_EQUAL  */
+    T_MOD_EQUAL = 586,             /* T_MOD_EQUAL  */
+    T_MUL_EQUAL = 587,             /* T_MUL_EQUAL  */
+    T_NAMESPACE = 588,             /* T_NAMESPACE  */
+    T_NEW = 589,                   /* T_NEW  */
+    T_NS_C = 590,                  /* T_NS_C  */
+    T_NS_SEPARATOR = 591,          /* T_NS_SEPARATOR  */
+    T_NUM_STRING = 592,            /* T_NUM_STRING  */
+    T_OBJECT_CAST = 593,           /* T_OBJECT_CAST  */
+    T_OBJECT_OPERATOR = 594,       /* T_OBJECT_OPERATOR  */
+    T_OPEN_TAG = 595,              /* T_OPEN_TAG  */
+    T_OPEN_TAG_WITH_ECHO = 596,    /* T_OPEN_TAG_WITH_ECHO  */
+    T_OR_EQUAL = 597,              /* T_OR_EQUAL  */
+    T_PAAMAYIM_NEKUDOTAYIM = 598,  /* T_PAAMAYIM_NEKUDOTAYIM  */
+    T_PLUS_EQUAL = 599,            /* T_PLUS_EQUAL  */
+    T_PRINT = 600,                 /* T_PRINT  */
+    T_PRIVATE = 601,               /* T_PRIVATE  */
+    T_PROTECTED = 602,             /* T_PROTECTED  */
+    T_PUBLIC = 603,                /* T_PUBLIC  */
+    T_REQUIRE = 604,               /* T_REQUIRE  */
+    T_REQUIRE_ONCE = 605,          /* T_REQUIRE_ONCE  */
+    T_RETURN = 606,                /* T_RETURN  */
+    T_SL = 607,                    /* T_SL  */
+    T_SL_EQUAL = 608,              /* T_SL_EQUAL  */
+    T_SR = 609,                    /* T_SR  */
+    T_SR_EQUAL = 610,              /* T_SR_EQUAL  */
+    T_START_HEREDOC = 611,         /* T_START_HEREDOC  */
+    T_STATIC = 612,                /* T_STATIC  */
+    T_STRING = 613,                /* T_STRING  */
+    T_STRING_CAST = 614,           /* T_STRING_CAST  */
+    T_STRING_VARNAME = 615,        /* T_STRING_VARNAME  */
+    T_SWITCH = 616,                /* T_SWITCH  */
+    T_THROW = 617,                 /* T_THROW  */
+    T_TRAIT = 618,                 /* T_TRAIT  */
+    T_TRAIT_C = 619,               /* T_TRAIT_C  */
+    T_TRY = 620,                   /* T_TRY  */
+    T_UNSET = 621,                 /* T_UNSET  */
+    T_UNSET_CAST = 622,            /* T_UNSET_CAST  */
+    T_USE = 623,                   /* T_USE  */
+    T_VAR = 624,                   /* T_VAR  */
+    T_VARIABLE = 625,              /* T_VARIABLE  */
+    T_WHILE = 626,                 /* T_WHILE  */
+    T_WHITESPACE = 627,            /* T_WHITESPACE  */
+    T_XOR_EQUAL = 628              /* T_XOR_EQUAL  */
+  };
+  typedef enum php54_resource_tokentype php54_resource_token_kind_t;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+/* Value type.  */
 
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_END = 0,
-     T_REQUIRE_ONCE = 605,
-     T_REQUIRE = 604,
-     T_EVAL = 549,
-     T_INCLUDE_ONCE = 565,
-     T_INCLUDE = 564,
-     T_LOGICAL_OR = 582,
-     T_LOGICAL_XOR = 583,
-     T_LOGICAL_AND = 581,
-     T_PRINT = 600,
-     T_SR_EQUAL = 610,
-     T_SL_EQUAL = 608,
-     T_XOR_EQUAL = 628,
-     T_OR_EQUAL = 597,
-     T_AND_EQUAL = 503,
-     T_MOD_EQUAL = 586,
-     T_CONCAT_EQUAL = 521,
-     T_DIV_EQUAL = 530,
-     T_MUL_EQUAL = 587,
-     T_MINUS_EQUAL = 585,
-     T_PLUS_EQUAL = 599,
-     T_BOOLEAN_OR = 510,
-     T_BOOLEAN_AND = 509,
-     T_IS_NOT_IDENTICAL = 575,
-     T_IS_IDENTICAL = 573,
-     T_IS_NOT_EQUAL = 574,
-     T_IS_EQUAL = 571,
-     T_IS_GREATER_OR_EQUAL = 572,
-     T_IS_SMALLER_OR_EQUAL = 577,
-     T_SR = 609,
-     T_SL = 607,
-     T_INSTANCEOF = 567,
-     T_UNSET_CAST = 622,
-     T_BOOL_CAST = 508,
-     T_OBJECT_CAST = 593,
-     T_ARRAY_CAST = 505,
-     T_STRING_CAST = 614,
-     T_DOUBLE_CAST = 536,
-     T_INT_CAST = 569,
-     T_DEC = 526,
-     T_INC = 563,
-     T_CLONE = 518,
-     T_NEW = 589,
-     T_ELSEIF = 539,
-     T_ELSE = 538,
-     T_ENDIF = 546,
-     T_PUBLIC = 603,
-     T_PROTECTED = 602,
-     T_PRIVATE = 601,
-     T_FINAL = 553,
-     T_ABSTRACT = 502,
-     T_STATIC = 612,
-     T_ARRAY = 504,
-     T_AS = 506,
-     T_BAD_CHARACTER = 507,
-     T_BREAK = 511,
-     T_CALLABLE = 512,
-     T_CASE = 513,
-     T_CATCH = 514,
-     T_CHARACTER = 515,
-     T_CLASS = 516,
-     T_CLASS_C = 517,
-     T_CLOSE_TAG = 519,
-     T_COMMENT = 520,
-     T_CONST = 522,
-     T_CONSTANT_ENCAPSED_STRING = 523,
-     T_CONTINUE = 524,
-     T_CURLY_OPEN = 525,
-     T_DECLARE = 527,
-     T_DEFAULT = 528,
-     T_DIR = 529,
-     T_DNUMBER = 531,
-     T_DO = 532,
-     T_DOC_COMMENT = 533,
-     T_DOLLAR_OPEN_CURLY_BRACES = 534,
-     T_DOUBLE_ARROW = 535,
-     T_ECHO = 537,
-     T_EMPTY = 540,
-     T_ENCAPSED_AND_WHITESPACE = 541,
-     T_ENDDECLARE = 542,
-     T_ENDFOR = 543,
-     T_ENDFOREACH = 544,
-     T_END_HEREDOC = 545,
-     T_ENDSWITCH = 547,
-     T_ENDWHILE = 548,
-     T_EXIT = 550,
-     T_EXTENDS = 551,
-     T_FILE = 552,
-     T_FOR = 554,
-     T_FOREACH = 555,
-     T_FUNC_C = 556,
-     T_FUNCTION = 557,
-     T_GLOBAL = 558,
-     T_GOTO = 559,
-     T_HALT_COMPILER = 560,
-     T_IF = 561,
-     T_IMPLEMENTS = 562,
-     T_INLINE_HTML = 566,
-     T_INSTEADOF = 568,
-     T_INTERFACE = 570,
-     T_ISSET = 576,
-     T_LINE = 578,
-     T_LIST = 579,
-     T_LNUMBER = 580,
-     T_METHOD_C = 584,
-     T_NAMESPACE = 588,
-     T_NS_C = 590,
-     T_NS_SEPARATOR = 591,
-     T_NUM_STRING = 592,
-     T_OBJECT_OPERATOR = 594,
-     T_OPEN_TAG = 595,
-     T_OPEN_TAG_WITH_ECHO = 596,
-     T_PAAMAYIM_NEKUDOTAYIM = 598,
-     T_RETURN = 606,
-     T_START_HEREDOC = 611,
-     T_STRING = 613,
-     T_STRING_VARNAME = 615,
-     T_SWITCH = 616,
-     T_THROW = 617,
-     T_TRAIT = 618,
-     T_TRAIT_C = 619,
-     T_TRY = 620,
-     T_UNSET = 621,
-     T_USE = 623,
-     T_VAR = 624,
-     T_VARIABLE = 625,
-     T_WHILE = 626,
-     T_WHITESPACE = 627
-   };
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
 #endif
 
+typedef struct php54_resource_pstate php54_resource_pstate;
 
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+int php54_resource_parse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+int php54_resource_push_parse (php54_resource_pstate *ps,
+                  int pushed_char, PHP54_RESOURCE_STYPE const *pushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+int php54_resource_pull_parse (php54_resource_pstate *ps, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
+php54_resource_pstate *php54_resource_pstate_new (void);
+void php54_resource_pstate_delete (php54_resource_pstate *ps);
+
 
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* T_END  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ','  */
+  YYSYMBOL_4_ = 4,                         /* '='  */
+  YYSYMBOL_5_ = 5,                         /* '?'  */
+  YYSYMBOL_6_ = 6,                         /* ':'  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_12_ = 12,                       /* '+'  */
+  YYSYMBOL_13_ = 13,                       /* '-'  */
+  YYSYMBOL_14_ = 14,                       /* '.'  */
+  YYSYMBOL_15_ = 15,                       /* '*'  */
+  YYSYMBOL_16_ = 16,                       /* '/'  */
+  YYSYMBOL_17_ = 17,                       /* '%'  */
+  YYSYMBOL_18_ = 18,                       /* '!'  */
+  YYSYMBOL_19_ = 19,                       /* '~'  */
+  YYSYMBOL_20_ = 20,                       /* '@'  */
+  YYSYMBOL_21_ = 21,                       /* '['  */
+  YYSYMBOL_T_ABSTRACT = 22,                /* T_ABSTRACT  */
+  YYSYMBOL_T_AND_EQUAL = 23,               /* T_AND_EQUAL  */
+  YYSYMBOL_T_ARRAY = 24,                   /* T_ARRAY  */
+  YYSYMBOL_T_ARRAY_CAST = 25,              /* T_ARRAY_CAST  */
+  YYSYMBOL_T_AS = 26,                      /* T_AS  */
+  YYSYMBOL_T_BAD_CHARACTER = 27,           /* T_BAD_CHARACTER  */
+  YYSYMBOL_T_BOOL_CAST = 28,               /* T_BOOL_CAST  */
+  YYSYMBOL_T_BOOLEAN_AND = 29,             /* T_BOOLEAN_AND  */
+  YYSYMBOL_T_BOOLEAN_OR = 30,              /* T_BOOLEAN_OR  */
+  YYSYMBOL_T_BREAK = 31,                   /* T_BREAK  */
+  YYSYMBOL_T_CALLABLE = 32,                /* T_CALLABLE  */
+  YYSYMBOL_T_CASE = 33,                    /* T_CASE  */
+  YYSYMBOL_T_CATCH = 34,                   /* T_CATCH  */
+  YYSYMBOL_T_CHARACTER = 35,               /* T_CHARACTER  */
+  YYSYMBOL_T_CLASS = 36,                   /* T_CLASS  */
+  YYSYMBOL_T_CLASS_C = 37,                 /* T_CLASS_C  */
+  YYSYMBOL_T_CLONE = 38,                   /* T_CLONE  */
+  YYSYMBOL_T_CLOSE_TAG = 39,               /* T_CLOSE_TAG  */
+  YYSYMBOL_T_COMMENT = 40,                 /* T_COMMENT  */
+  YYSYMBOL_T_CONCAT_EQUAL = 41,            /* T_CONCAT_EQUAL  */
+  YYSYMBOL_T_CONST = 42,                   /* T_CONST  */
+  YYSYMBOL_T_CONSTANT_ENCAPSED_STRING = 43, /* T_CONSTANT_ENCAPSED_STRING  */
+  YYSYMBOL_T_CONTINUE = 44,                /* T_CONTINUE  */
+  YYSYMBOL_T_CURLY_OPEN = 45,              /* T_CURLY_OPEN  */
+  YYSYMBOL_T_DEC = 46,                     /* T_DEC  */
+  YYSYMBOL_T_DECLARE = 47,                 /* T_DECLARE  */
+  YYSYMBOL_T_DEFAULT = 48,                 /* T_DEFAULT  */
+  YYSYMBOL_T_DIR = 49,                     /* T_DIR  */
+  YYSYMBOL_T_DIV_EQUAL = 50,               /* T_DIV_EQUAL  */
+  YYSYMBOL_T_DNUMBER = 51,                 /* T_DNUMBER  */
+  YYSYMBOL_T_DO = 52,                      /* T_DO  */
+  YYSYMBOL_T_DOC_COMMENT = 53,             /* T_DOC_COMMENT  */
+  YYSYMBOL_T_DOLLAR_OPEN_CURLY_BRACES = 54, /* T_DOLLAR_OPEN_CURLY_BRACES  */
+  YYSYMBOL_T_DOUBLE_ARROW = 55,            /* T_DOUBLE_ARROW  */
+  YYSYMBOL_T_DOUBLE_CAST = 56,             /* T_DOUBLE_CAST  */
+  YYSYMBOL_T_ECHO = 57,                    /* T_ECHO  */
+  YYSYMBOL_T_ELSE = 58,                    /* T_ELSE  */
+  YYSYMBOL_T_ELSEIF = 59,                  /* T_ELSEIF  */
+  YYSYMBOL_T_EMPTY = 60,                   /* T_EMPTY  */
+  YYSYMBOL_T_ENCAPSED_AND_WHITESPACE = 61, /* T_ENCAPSED_AND_WHITESPACE  */
+  YYSYMBOL_T_ENDDECLARE = 62,              /* T_ENDDECLARE  */
+  YYSYMBOL_T_ENDFOR = 63,                  /* T_ENDFOR  */
+  YYSYMBOL_T_ENDFOREACH = 64,              /* T_ENDFOREACH  */
+  YYSYMBOL_T_END_HEREDOC = 65,             /* T_END_HEREDOC  */
+  YYSYMBOL_T_ENDIF = 66,                   /* T_ENDIF  */
+  YYSYMBOL_T_ENDSWITCH = 67,               /* T_ENDSWITCH  */
+  YYSYMBOL_T_ENDWHILE = 68,                /* T_ENDWHILE  */
+  YYSYMBOL_T_EVAL = 69,                    /* T_EVAL  */
+  YYSYMBOL_T_EXIT = 70,                    /* T_EXIT  */
+  YYSYMBOL_T_EXTENDS = 71,                 /* T_EXTENDS  */
+  YYSYMBOL_T_FILE = 72,                    /* T_FILE  */
+  YYSYMBOL_T_FINAL = 73,                   /* T_FINAL  */
+  YYSYMBOL_T_FOR = 74,                     /* T_FOR  */
+  YYSYMBOL_T_FOREACH = 75,                 /* T_FOREACH  */
+  YYSYMBOL_T_FUNC_C = 76,                  /* T_FUNC_C  */
+  YYSYMBOL_T_FUNCTION = 77,                /* T_FUNCTION  */
+  YYSYMBOL_T_GLOBAL = 78,                  /* T_GLOBAL  */
+  YYSYMBOL_T_GOTO = 79,                    /* T_GOTO  */
+  YYSYMBOL_T_HALT_COMPILER = 80,           /* T_HALT_COMPILER  */
+  YYSYMBOL_T_IF = 81,                      /* T_IF  */
+  YYSYMBOL_T_IMPLEMENTS = 82,              /* T_IMPLEMENTS  */
+  YYSYMBOL_T_INC = 83,                     /* T_INC  */
+  YYSYMBOL_T_INCLUDE = 84,                 /* T_INCLUDE  */
+  YYSYMBOL_T_INCLUDE_ONCE = 85,            /* T_INCLUDE_ONCE  */
+  YYSYMBOL_T_INLINE_HTML = 86,             /* T_INLINE_HTML  */
+  YYSYMBOL_T_INSTANCEOF = 87,              /* T_INSTANCEOF  */
+  YYSYMBOL_T_INSTEADOF = 88,               /* T_INSTEADOF  */
+  YYSYMBOL_T_INT_CAST = 89,                /* T_INT_CAST  */
+  YYSYMBOL_T_INTERFACE = 90,               /* T_INTERFACE  */
+  YYSYMBOL_T_IS_EQUAL = 91,                /* T_IS_EQUAL  */
+  YYSYMBOL_T_IS_GREATER_OR_EQUAL = 92,     /* T_IS_GREATER_OR_EQUAL  */
+  YYSYMBOL_T_IS_IDENTICAL = 93,            /* T_IS_IDENTICAL  */
+  YYSYMBOL_T_IS_NOT_EQUAL = 94,            /* T_IS_NOT_EQUAL  */
+  YYSYMBOL_T_IS_NOT_IDENTICAL = 95,        /* T_IS_NOT_IDENTICAL  */
+  YYSYMBOL_T_ISSET = 96,                   /* T_ISSET  */
+  YYSYMBOL_T_IS_SMALLER_OR_EQUAL = 97,     /* T_IS_SMALLER_OR_EQUAL  */
+  YYSYMBOL_T_LINE = 98,                    /* T_LINE  */
+  YYSYMBOL_T_LIST = 99,                    /* T_LIST  */
+  YYSYMBOL_T_LNUMBER = 100,                /* T_LNUMBER  */
+  YYSYMBOL_T_LOGICAL_AND = 101,            /* T_LOGICAL_AND  */
+  YYSYMBOL_T_LOGICAL_OR = 102,             /* T_LOGICAL_OR  */
+  YYSYMBOL_T_LOGICAL_XOR = 103,            /* T_LOGICAL_XOR  */
+  YYSYMBOL_T_METHOD_C = 104,               /* T_METHOD_C  */
+  YYSYMBOL_T_MINUS_EQUAL = 105,            /* T_MINUS_EQUAL  */
+  YYSYMBOL_T_MOD_EQUAL = 106,              /* T_MOD_EQUAL  */
+  YYSYMBOL_T_MUL_EQUAL = 107,              /* T_MUL_EQUAL  */
+  YYSYMBOL_T_NAMESPACE = 108,              /* T_NAMESPACE  */
+  YYSYMBOL_T_NEW = 109,                    /* T_NEW  */
+  YYSYMBOL_T_NS_C = 110,                   /* T_NS_C  */
+  YYSYMBOL_T_NS_SEPARATOR = 111,           /* T_NS_SEPARATOR  */
+  YYSYMBOL_T_NUM_STRING = 112,             /* T_NUM_STRING  */
+  YYSYMBOL_T_OBJECT_CAST = 113,            /* T_OBJECT_CAST  */
+  YYSYMBOL_T_OBJECT_OPERATOR = 114,        /* T_OBJECT_OPERATOR  */
+  YYSYMBOL_T_OPEN_TAG = 115,               /* T_OPEN_TAG  */
+  YYSYMBOL_T_OPEN_TAG_WITH_ECHO = 116,     /* T_OPEN_TAG_WITH_ECHO  */
+  YYSYMBOL_T_OR_EQUAL = 117,               /* T_OR_EQUAL  */
+  YYSYMBOL_T_PAAMAYIM_NEKUDOTAYIM = 118,   /* T_PAAMAYIM_NEKUDOTAYIM  */
+  YYSYMBOL_T_PLUS_EQUAL = 119,             /* T_PLUS_EQUAL  */
+  YYSYMBOL_T_PRINT = 120,                  /* T_PRINT  */
+  YYSYMBOL_T_PRIVATE = 121,                /* T_PRIVATE  */
+  YYSYMBOL_T_PROTECTED = 122,              /* T_PROTECTED  */
+  YYSYMBOL_T_PUBLIC = 123,                 /* T_PUBLIC  */
+  YYSYMBOL_T_REQUIRE = 124,                /* T_REQUIRE  */
+  YYSYMBOL_T_REQUIRE_ONCE = 125,           /* T_REQUIRE_ONCE  */
+  YYSYMBOL_T_RETURN = 126,                 /* T_RETURN  */
+  YYSYMBOL_T_SL = 127,                     /* T_SL  */
+  YYSYMBOL_T_SL_EQUAL = 128,               /* T_SL_EQUAL  */
+  YYSYMBOL_T_SR = 129,                     /* T_SR  */
+  YYSYMBOL_T_SR_EQUAL = 130,               /* T_SR_EQUAL  */
+  YYSYMBOL_T_START_HEREDOC = 131,          /* T_START_HEREDOC  */
+  YYSYMBOL_T_STATIC = 132,                 /* T_STATIC  */
+  YYSYMBOL_T_STRING = 133,                 /* T_STRING  */
+  YYSYMBOL_T_STRING_CAST = 134,            /* T_STRING_CAST  */
+  YYSYMBOL_T_STRING_VARNAME = 135,         /* T_STRING_VARNAME  */
+  YYSYMBOL_T_SWITCH = 136,                 /* T_SWITCH  */
+  YYSYMBOL_T_THROW = 137,                  /* T_THROW  */
+  YYSYMBOL_T_TRAIT = 138,                  /* T_TRAIT  */
+  YYSYMBOL_T_TRAIT_C = 139,                /* T_TRAIT_C  */
+  YYSYMBOL_T_TRY = 140,                    /* T_TRY  */
+  YYSYMBOL_T_UNSET = 141,                  /* T_UNSET  */
+  YYSYMBOL_T_UNSET_CAST = 142,             /* T_UNSET_CAST  */
+  YYSYMBOL_T_USE = 143,                    /* T_USE  */
+  YYSYMBOL_T_VAR = 144,                    /* T_VAR  */
+  YYSYMBOL_T_VARIABLE = 145,               /* T_VARIABLE  */
+  YYSYMBOL_T_WHILE = 146,                  /* T_WHILE  */
+  YYSYMBOL_T_WHITESPACE = 147,             /* T_WHITESPACE  */
+  YYSYMBOL_T_XOR_EQUAL = 148,              /* T_XOR_EQUAL  */
+  YYSYMBOL_149_ = 149,                     /* '{'  */
+  YYSYMBOL_150_ = 150,                     /* '}'  */
+  YYSYMBOL_151_ = 151,                     /* '('  */
+  YYSYMBOL_152_ = 152,                     /* ')'  */
+  YYSYMBOL_153_ = 153,                     /* ';'  */
+  YYSYMBOL_154_ = 154,                     /* '`'  */
+  YYSYMBOL_155_ = 155,                     /* '$'  */
+  YYSYMBOL_156_ = 156,                     /* '"'  */
+  YYSYMBOL_157_ = 157,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 158,                 /* $accept  */
+  YYSYMBOL_start = 159,                    /* start  */
+  YYSYMBOL_top_statement_list = 160,       /* top_statement_list  */
+  YYSYMBOL_namespace_name = 161,           /* namespace_name  */
+  YYSYMBOL_top_statement = 162,            /* top_statement  */
+  YYSYMBOL_163_1 = 163,                    /* $@1  */
+  YYSYMBOL_164_2 = 164,                    /* $@2  */
+  YYSYMBOL_use_declarations = 165,         /* use_declarations  */
+  YYSYMBOL_use_declaration = 166,          /* use_declaration  */
+  YYSYMBOL_constant_declaration = 167,     /* constant_declaration  */
+  YYSYMBOL_inner_statement_list = 168,     /* inner_statement_list  */
+  YYSYMBOL_inner_statement = 169,          /* inner_statement  */
+  YYSYMBOL_statement = 170,                /* statement  */
+  YYSYMBOL_unticked_statement = 171,       /* unticked_statement  */
+  YYSYMBOL_additional_catches = 172,       /* additional_catches  */
+  YYSYMBOL_non_empty_additional_catches = 173, /* non_empty_additional_catches  */
+  YYSYMBOL_additional_catch = 174,         /* additional_catch  */
+  YYSYMBOL_unset_variables = 175,          /* unset_variables  */
+  YYSYMBOL_unset_variable = 176,           /* unset_variable  */
+  YYSYMBOL_function_declaration_statement = 177, /* function_declaration_statement  */
+  YYSYMBOL_class_declaration_statement = 178, /* class_declaration_statement  */
+  YYSYMBOL_is_reference = 179,             /* is_reference  */
+  YYSYMBOL_unticked_function_declaration_statement = 180, /* unticked_function_declaration_statement  */
+  YYSYMBOL_181_3 = 181,                    /* $@3  */
+  YYSYMBOL_unticked_class_declaration_statement = 182, /* unticked_class_declaration_statement  */
+  YYSYMBOL_183_4 = 183,                    /* $@4  */
+  YYSYMBOL_184_5 = 184,                    /* $@5  */
+  YYSYMBOL_class_entry_type = 185,         /* class_entry_type  */
+  YYSYMBOL_extends_from = 186,             /* extends_from  */
+  YYSYMBOL_interface_entry = 187,          /* interface_entry  */
+  YYSYMBOL_interface_extends_list = 188,   /* interface_extends_list  */
+  YYSYMBOL_implements_list = 189,          /* implements_list  */
+  YYSYMBOL_interface_list = 190,           /* interface_list  */
+  YYSYMBOL_foreach_optional_arg = 191,     /* foreach_optional_arg  */
+  YYSYMBOL_foreach_variable = 192,         /* foreach_variable  */
+  YYSYMBOL_for_statement = 193,            /* for_statement  */
+  YYSYMBOL_foreach_statement = 194,        /* foreach_statement  */
+  YYSYMBOL_declare_statement = 195,        /* declare_statement  */
+  YYSYMBOL_declare_list = 196,             /* declare_list  */
+  YYSYMBOL_switch_case_list = 197,         /* switch_case_list  */
+  YYSYMBOL_case_list = 198,                /* case_list  */
+  YYSYMBOL_case_separator = 199,           /* case_separator  */
+  YYSYMBOL_while_statement = 200,          /* while_statement  */
+  YYSYMBOL_elseif_list = 201,              /* elseif_list  */
+  YYSYMBOL_new_elseif_list = 202,          /* new_elseif_list  */
+  YYSYMBOL_else_single = 203,              /* else_single  */
+  YYSYMBOL_new_else_single = 204,          /* new_else_single  */
+  YYSYMBOL_parameter_list = 205,           /* parameter_list  */
+  YYSYMBOL_non_empty_parameter_list = 206, /* non_empty_parameter_list  */
+  YYSYMBOL_optional_class_type = 207,      /* optional_class_type  */
+  YYSYMBOL_function_call_parameter_list = 208, /* function_call_parameter_list  */
+  YYSYMBOL_non_empty_function_call_parameter_list = 209, /* non_empty_function_call_parameter_list  */
+  YYSYMBOL_global_var_list = 210,          /* global_var_list  */
+  YYSYMBOL_global_var = 211,               /* global_var  */
+  YYSYMBOL_static_var_list = 212,          /* static_var_list  */
+  YYSYMBOL_class_statement_list = 213,     /* class_statement_list  */
+  YYSYMBOL_class_statement = 214,          /* class_statement  */
+  YYSYMBOL_215_6 = 215,                    /* $@6  */
+  YYSYMBOL_trait_use_statement = 216,      /* trait_use_statement  */
+  YYSYMBOL_trait_list = 217,               /* trait_list  */
+  YYSYMBOL_trait_adaptations = 218,        /* trait_adaptations  */
+  YYSYMBOL_trait_adaptation_list = 219,    /* trait_adaptation_list  */
+  YYSYMBOL_non_empty_trait_adaptation_list = 220, /* non_empty_trait_adaptation_list  */
+  YYSYMBOL_trait_adaptation_statement = 221, /* trait_adaptation_statement  */
+  YYSYMBOL_trait_precedence = 222,         /* trait_precedence  */
+  YYSYMBOL_trait_reference_list = 223,     /* trait_reference_list  */
+  YYSYMBOL_trait_method_reference = 224,   /* trait_method_reference  */
+  YYSYMBOL_trait_method_reference_fully_qualified = 225, /* trait_method_reference_fully_qualified  */
+  YYSYMBOL_trait_alias = 226,              /* trait_alias  */
+  YYSYMBOL_trait_modifiers = 227,          /* trait_modifiers  */
+  YYSYMBOL_method_body = 228,              /* method_body  */
+  YYSYMBOL_variable_modifiers = 229,       /* variable_modifiers  */
+  YYSYMBOL_method_modifiers = 230,         /* method_modifiers  */
+  YYSYMBOL_non_empty_member_modifiers = 231, /* non_empty_member_modifiers  */
+  YYSYMBOL_member_modifier = 232,          /* member_modifier  */
+  YYSYMBOL_class_variable_declaration = 233, /* class_variable_declaration  */
+  YYSYMBOL_class_constant_declaration = 234, /* class_constant_declaration  */
+  YYSYMBOL_echo_expr_list = 235,           /* echo_expr_list  */
+  YYSYMBOL_for_expr = 236,                 /* for_expr  */
+  YYSYMBOL_non_empty_for_expr = 237,       /* non_empty_for_expr  */
+  YYSYMBOL_chaining_method_or_property = 238, /* chaining_method_or_property  */
+  YYSYMBOL_chaining_dereference = 239,     /* chaining_dereference  */
+  YYSYMBOL_chaining_instance_call = 240,   /* chaining_instance_call  */
+  YYSYMBOL_instance_call = 241,            /* instance_call  */
+  YYSYMBOL_new_expr = 242,                 /* new_expr  */
+  YYSYMBOL_expr_without_variable = 243,    /* expr_without_variable  */
+  YYSYMBOL_244_7 = 244,                    /* $@7  */
+  YYSYMBOL_245_8 = 245,                    /* $@8  */
+  YYSYMBOL_function = 246,                 /* function  */
+  YYSYMBOL_lexical_vars = 247,             /* lexical_vars  */
+  YYSYMBOL_lexical_var_list = 248,         /* lexical_var_list  */
+  YYSYMBOL_function_call = 249,            /* function_call  */
+  YYSYMBOL_250_9 = 250,                    /* $@9  */
+  YYSYMBOL_251_10 = 251,                   /* $@10  */
+  YYSYMBOL_class_name = 252,               /* class_name  */
+  YYSYMBOL_fully_qualified_class_name = 253, /* fully_qualified_class_name  */
+  YYSYMBOL_class_name_reference = 254,     /* class_name_reference  */
+  YYSYMBOL_dynamic_class_name_reference = 255, /* dynamic_class_name_reference  */
+  YYSYMBOL_dynamic_class_name_variable_properties = 256, /* dynamic_class_name_variable_properties  */
+  YYSYMBOL_dynamic_class_name_variable_property = 257, /* dynamic_class_name_variable_property  */
+  YYSYMBOL_exit_expr = 258,                /* exit_expr  */
+  YYSYMBOL_backticks_expr = 259,           /* backticks_expr  */
+  YYSYMBOL_ctor_arguments = 260,           /* ctor_arguments  */
+  YYSYMBOL_common_scalar = 261,            /* common_scalar  */
+  YYSYMBOL_static_scalar = 262,            /* static_scalar  */
+  YYSYMBOL_static_class_constant = 263,    /* static_class_constant  */
+  YYSYMBOL_scalar = 264,                   /* scalar  */
+  YYSYMBOL_static_array_pair_list = 265,   /* static_array_pair_list  */
+  YYSYMBOL_possible_comma = 266,           /* possible_comma  */
+  YYSYMBOL_non_empty_static_array_pair_list = 267, /* non_empty_static_array_pair_list  */
+  YYSYMBOL_expr = 268,                     /* expr  */
+  YYSYMBOL_r_variable = 269,               /* r_variable  */
+  YYSYMBOL_w_variable = 270,               /* w_variable  */
+  YYSYMBOL_rw_variable = 271,              /* rw_variable  */
+  YYSYMBOL_variable = 272,                 /* variable  */
+  YYSYMBOL_273_11 = 273,                   /* $@11  */
+  YYSYMBOL_274_12 = 274,                   /* $@12  */
+  YYSYMBOL_variable_properties = 275,      /* variable_properties  */
+  YYSYMBOL_variable_property = 276,        /* variable_property  */
+  YYSYMBOL_array_method_dereference = 277, /* array_method_dereference  */
+  YYSYMBOL_method = 278,                   /* method  */
+  YYSYMBOL_method_or_not = 279,            /* method_or_not  */
+  YYSYMBOL_variable_without_objects = 280, /* variable_without_objects  */
+  YYSYMBOL_static_member = 281,            /* static_member  */
+  YYSYMBOL_variable_class_name = 282,      /* variable_class_name  */
+  YYSYMBOL_array_function_dereference = 283, /* array_function_dereference  */
+  YYSYMBOL_base_variable_with_function_calls = 284, /* base_variable_with_function_calls  */
+  YYSYMBOL_base_variable = 285,            /* base_variable  */
+  YYSYMBOL_reference_variable = 286,       /* reference_variable  */
+  YYSYMBOL_compound_variable = 287,        /* compound_variable  */
+  YYSYMBOL_dim_offset = 288,               /* dim_offset  */
+  YYSYMBOL_object_property = 289,          /* object_property  */
+  YYSYMBOL_object_dim_list = 290,          /* object_dim_list  */
+  YYSYMBOL_variable_name = 291,            /* variable_name  */
+  YYSYMBOL_simple_indirect_reference = 292, /* simple_indirect_reference  */
+  YYSYMBOL_assignment_list = 293,          /* assignment_list  */
+  YYSYMBOL_assignment_list_element = 294,  /* assignment_list_element  */
+  YYSYMBOL_array_pair_list = 295,          /* array_pair_list  */
+  YYSYMBOL_non_empty_array_pair_list = 296, /* non_empty_array_pair_list  */
+  YYSYMBOL_encaps_list = 297,              /* encaps_list  */
+  YYSYMBOL_encaps_var = 298,               /* encaps_var  */
+  YYSYMBOL_encaps_var_offset = 299,        /* encaps_var_offset  */
+  YYSYMBOL_internal_functions_in_yacc = 300, /* internal_functions_in_yacc  */
+  YYSYMBOL_301_13 = 301,                   /* $@13  */
+  YYSYMBOL_302_14 = 302,                   /* $@14  */
+  YYSYMBOL_303_15 = 303,                   /* $@15  */
+  YYSYMBOL_304_16 = 304,                   /* $@16  */
+  YYSYMBOL_isset_variables = 305,          /* isset_variables  */
+  YYSYMBOL_class_constant = 306            /* class_constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 343 of yacc.c  */
-#line 296 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.cpp"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -330,85 +735,112 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -424,7 +856,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -432,40 +864,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined PHP54_RESOURCE_STYPE_IS_TRIVIAL && PHP54_RESOURCE_STYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -475,35 +904,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -511,7 +940,7 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   7862
+#define YYLAST   8869
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  158
@@ -519,32 +948,37 @@ union yyalloc
 #define YYNNTS  149
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  459
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  926
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   629
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    48,   156,     2,   155,    47,    31,     2,
-     151,   152,    45,    42,     8,    43,    44,    46,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    26,   153,
-      36,    13,    37,    25,    60,     2,     2,     2,     2,     2,
+       2,     2,     2,    18,   156,     2,   155,    17,     9,     2,
+     151,   152,    15,    12,     3,    13,    14,    16,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     6,   153,
+      10,     4,    11,     5,    20,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    61,     2,   157,    30,     2,   154,     2,     2,     2,
+       2,    21,     2,   157,     8,     2,   154,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   149,    29,   150,    50,     2,     2,     2,
+       2,     2,     2,   149,     7,   150,    19,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -582,323 +1016,118 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    71,    18,    73,    54,    74,    75,    52,    28,
-      27,    76,    77,    78,    79,    80,    81,    82,    62,    83,
-      84,    20,    85,    86,    87,    88,    58,    89,    90,    91,
-      21,    92,    93,    94,    95,    96,    56,    97,    65,    64,
-      98,    99,   100,   101,   102,   103,    66,   104,   105,     5,
-     106,   107,   108,    70,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,    59,     7,     6,   118,    49,   119,    57,
-     120,    35,    38,    33,    34,    32,   121,    39,   122,   123,
-     124,    11,     9,    10,   125,    23,    19,    22,   126,    63,
-     127,   128,   129,    53,   130,   131,   132,    17,   133,    24,
-      12,    69,    68,    67,     4,     3,   134,    41,    15,    40,
-      14,   135,    72,   136,    55,   137,   138,   139,   140,   141,
-     142,   143,    51,   144,   145,   146,   147,   148,    16,     2
+       2,     2,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,     2
 };
 
-#if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+#if PHP54_RESOURCE_DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,     9,    11,    15,    17,    19,
-      21,    26,    30,    31,    38,    39,    45,    49,    52,    56,
-      58,    60,    64,    67,    72,    78,    83,    86,    87,    89,
-      91,    93,    98,   100,   103,   107,   115,   126,   132,   140,
-     150,   156,   159,   163,   166,   170,   173,   177,   181,   185,
-     189,   193,   195,   198,   204,   213,   222,   228,   230,   244,
-     248,   252,   254,   255,   257,   260,   269,   271,   275,   277,
-     279,   281,   282,   284,   285,   296,   297,   306,   307,   315,
-     317,   320,   322,   325,   326,   329,   331,   332,   335,   336,
-     339,   341,   345,   346,   349,   351,   354,   356,   361,   363,
-     368,   370,   375,   379,   385,   389,   394,   399,   405,   406,
-     412,   417,   419,   421,   423,   428,   429,   436,   437,   445,
-     446,   449,   450,   454,   456,   457,   460,   464,   470,   475,
-     480,   486,   494,   501,   502,   504,   506,   508,   510,   511,
-     513,   515,   518,   522,   526,   531,   535,   537,   539,   542,
-     547,   551,   557,   559,   563,   566,   567,   571,   574,   576,
-     577,   587,   591,   593,   597,   599,   603,   604,   606,   608,
-     611,   614,   617,   621,   623,   627,   629,   631,   635,   640,
-     644,   645,   647,   649,   653,   655,   657,   658,   660,   662,
-     665,   667,   669,   671,   673,   675,   677,   681,   687,   689,
-     693,   699,   704,   708,   710,   711,   713,   717,   719,   722,
-     724,   729,   733,   736,   738,   740,   741,   743,   747,   754,
-     758,   763,   770,   773,   777,   781,   785,   789,   793,   797,
-     801,   805,   809,   813,   817,   820,   823,   826,   829,   833,
-     837,   841,   845,   849,   853,   857,   861,   865,   869,   873,
-     877,   881,   885,   889,   893,   896,   899,   902,   905,   909,
-     913,   917,   921,   925,   929,   933,   937,   941,   945,   947,
-     952,   958,   963,   965,   968,   971,   974,   977,   980,   983,
-     986,   989,   992,   994,   999,  1003,  1007,  1010,  1011,  1022,
-    1023,  1035,  1037,  1038,  1043,  1047,  1052,  1054,  1057,  1058,
-    1064,  1071,  1072,  1079,  1086,  1093,  1100,  1107,  1112,  1114,
-    1116,  1120,  1123,  1125,  1129,  1132,  1134,  1136,  1141,  1143,
-    1146,  1147,  1150,  1151,  1154,  1158,  1159,  1161,  1163,  1164,
-    1168,  1170,  1172,  1174,  1176,  1178,  1180,  1182,  1184,  1186,
-    1188,  1192,  1195,  1197,  1199,  1203,  1206,  1209,  1212,  1217,
-    1219,  1223,  1225,  1229,  1231,  1233,  1235,  1239,  1242,  1244,
-    1248,  1252,  1254,  1255,  1258,  1259,  1261,  1267,  1271,  1275,
-    1277,  1279,  1281,  1283,  1285,  1287,  1288,  1289,  1297,  1299,
-    1302,  1303,  1307,  1312,  1317,  1321,  1323,  1325,  1326,  1328,
-    1331,  1335,  1339,  1341,  1346,  1351,  1353,  1355,  1357,  1359,
-    1362,  1364,  1369,  1374,  1376,  1378,  1383,  1384,  1386,  1388,
-    1390,  1395,  1400,  1402,  1404,  1408,  1410,  1413,  1417,  1419,
-    1421,  1426,  1427,  1428,  1431,  1437,  1441,  1445,  1447,  1454,
-    1459,  1464,  1467,  1470,  1473,  1475,  1478,  1480,  1485,  1489,
-    1493,  1500,  1504,  1506,  1508,  1510,  1515,  1520,  1521,  1525,
-    1526,  1530,  1535,  1536,  1540,  1541,  1545,  1547,  1551,  1555
+       0,   361,   361,   365,   367,   371,   372,   376,   377,   378,
+     379,   380,   385,   385,   390,   390,   396,   397,   401,   403,
+     407,   410,   413,   416,   422,   428,   437,   438,   442,   443,
+     444,   445,   449,   450,   454,   455,   459,   463,   464,   465,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
+     484,   485,   486,   487,   488,   491,   494,   495,   496,   502,
+     503,   507,   508,   512,   513,   517,   522,   523,   527,   531,
+     535,   539,   540,   545,   544,   562,   561,   581,   580,   591,
+     592,   593,   594,   598,   599,   606,   610,   611,   616,   617,
+     622,   625,   629,   630,   634,   635,   639,   640,   644,   645,
+     649,   650,   654,   655,   659,   660,   661,   662,   666,   667,
+     668,   672,   673,   677,   678,   682,   683,   689,   690,   696,
+     697,   701,   702,   706,   707,   711,   712,   713,   714,   715,
+     716,   717,   718,   722,   723,   724,   725,   729,   730,   734,
+     741,   748,   755,   756,   757,   761,   762,   766,   767,   768,
+     772,   773,   774,   775,   779,   780,   784,   785,   786,   788,
+     787,   804,   809,   810,   815,   816,   820,   821,   825,   826,
+     830,   831,   835,   840,   841,   845,   848,   852,   858,   859,
+     863,   864,   868,   869,   873,   874,   880,   881,   885,   886,
+     890,   891,   892,   893,   894,   895,   899,   905,   911,   917,
+     926,   933,   942,   943,   947,   948,   952,   953,   957,   958,
+     962,   963,   967,   968,   969,   973,   974,   978,   982,   983,
+     996,  1001,  1006,  1007,  1008,  1009,  1010,  1011,  1012,  1013,
+    1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,
+    1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1032,  1033,
+    1034,  1035,  1036,  1037,  1038,  1039,  1040,  1041,  1042,  1043,
+    1044,  1045,  1046,  1047,  1048,  1049,  1050,  1051,  1052,  1053,
+    1054,  1057,  1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,
+    1067,  1068,  1069,  1070,  1071,  1072,  1073,  1075,  1074,  1080,
+    1079,  1087,  1091,  1092,  1096,  1097,  1098,  1099,  1103,  1103,
+    1126,  1129,  1129,  1152,  1154,  1156,  1158,  1160,  1165,  1166,
+    1167,  1168,  1172,  1173,  1174,  1178,  1179,  1183,  1185,  1189,
+    1190,  1194,  1198,  1199,  1200,  1204,  1205,  1206,  1210,  1211,
+    1215,  1224,  1233,  1242,  1243,  1244,  1245,  1246,  1247,  1248,
+    1249,  1250,  1254,  1255,  1256,  1257,  1258,  1259,  1260,  1261,
+    1262,  1263,  1267,  1271,  1272,  1273,  1274,  1275,  1276,  1277,
+    1278,  1279,  1283,  1284,  1288,  1289,  1293,  1294,  1295,  1296,
+    1300,  1301,  1305,  1309,  1313,  1317,  1322,  1317,  1335,  1339,
+    1340,  1344,  1348,  1349,  1353,  1357,  1358,  1359,  1363,  1364,
+    1368,  1369,  1373,  1377,  1378,  1382,  1392,  1393,  1398,  1399,
+    1400,  1404,  1405,  1406,  1410,  1411,  1415,  1416,  1420,  1421,
+    1425,  1426,  1427,  1431,  1432,  1436,  1437,  1441,  1442,  1446,
+    1447,  1448,  1452,  1453,  1457,  1458,  1459,  1460,  1461,  1462,
+    1463,  1464,  1468,  1469,  1470,  1471,  1475,  1476,  1477,  1478,
+    1479,  1480,  1484,  1485,  1486,  1490,  1491,  1492,  1492,  1498,
+    1498,  1504,  1505,  1505,  1511,  1511,  1519,  1520,  1524,  1525
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     159,     0,    -1,   160,    -1,   160,   162,    -1,    -1,   136,
-      -1,   161,   128,   136,    -1,   170,    -1,   177,    -1,   178,
-      -1,   115,   151,   152,   153,    -1,   126,   161,   153,    -1,
-      -1,   126,   161,   149,   163,   160,   150,    -1,    -1,   126,
-     149,   164,   160,   150,    -1,   144,   165,   153,    -1,   167,
-     153,    -1,   165,     8,   166,    -1,   166,    -1,   161,    -1,
-     161,    74,   136,    -1,   128,   161,    -1,   128,   161,    74,
-     136,    -1,   167,     8,   136,    13,   262,    -1,    85,   136,
-      13,   262,    -1,   168,   169,    -1,    -1,   170,    -1,   177,
-      -1,   178,    -1,   115,   151,   152,   153,    -1,   171,    -1,
-     136,    26,    -1,   149,   168,   150,    -1,   116,   151,   268,
-     152,   170,   201,   203,    -1,   116,   151,   268,   152,    26,
-     168,   202,   204,    66,   153,    -1,   147,   151,   268,   152,
-     200,    -1,    93,   170,   147,   151,   268,   152,   153,    -1,
-     109,   151,   236,   153,   236,   153,   236,   152,   193,    -1,
-     138,   151,   268,   152,   197,    -1,    76,   153,    -1,    76,
-     268,   153,    -1,    87,   153,    -1,    87,   268,   153,    -1,
-     134,   153,    -1,   134,   243,   153,    -1,   134,   272,   153,
-      -1,   113,   210,   153,    -1,    72,   212,   153,    -1,    97,
-     235,   153,    -1,   118,    -1,   268,   153,    -1,   143,   151,
-     175,   152,   153,    -1,   110,   151,   272,    74,   192,   191,
-     152,   194,    -1,   110,   151,   243,    74,   272,   191,   152,
-     194,    -1,    89,   151,   196,   152,   195,    -1,   153,    -1,
-     142,   149,   168,   150,    79,   151,   253,   146,   152,   149,
-     168,   150,   172,    -1,   139,   268,   153,    -1,   114,   136,
-     153,    -1,   173,    -1,    -1,   174,    -1,   173,   174,    -1,
-      79,   151,   253,   146,   152,   149,   168,   150,    -1,   176,
-      -1,   175,     8,   176,    -1,   272,    -1,   180,    -1,   182,
-      -1,    -1,    31,    -1,    -1,   246,   179,   136,   151,   205,
-     152,   181,   149,   168,   150,    -1,    -1,   185,   136,   186,
-     189,   183,   149,   213,   150,    -1,    -1,   187,   136,   188,
-     184,   149,   213,   150,    -1,    81,    -1,    71,    81,    -1,
-     140,    -1,    70,    81,    -1,    -1,   107,   253,    -1,   120,
-      -1,    -1,   107,   190,    -1,    -1,   117,   190,    -1,   253,
-      -1,   190,     8,   253,    -1,    -1,    96,   192,    -1,   272,
-      -1,    31,   272,    -1,   170,    -1,    26,   168,   101,   153,
-      -1,   170,    -1,    26,   168,   102,   153,    -1,   170,    -1,
-      26,   168,   100,   153,    -1,   136,    13,   262,    -1,   196,
-       8,   136,    13,   262,    -1,   149,   198,   150,    -1,   149,
-     153,   198,   150,    -1,    26,   198,   104,   153,    -1,    26,
-     153,   198,   104,   153,    -1,    -1,   198,    78,   268,   199,
-     168,    -1,   198,    90,   199,   168,    -1,    26,    -1,   153,
-      -1,   170,    -1,    26,   168,   105,   153,    -1,    -1,   201,
-      64,   151,   268,   152,   170,    -1,    -1,   202,    64,   151,
-     268,   152,    26,   168,    -1,    -1,    65,   170,    -1,    -1,
-      65,    26,   168,    -1,   206,    -1,    -1,   207,   146,    -1,
-     207,    31,   146,    -1,   207,    31,   146,    13,   262,    -1,
-     207,   146,    13,   262,    -1,   206,     8,   207,   146,    -1,
-     206,     8,   207,    31,   146,    -1,   206,     8,   207,    31,
-     146,    13,   262,    -1,   206,     8,   207,   146,    13,   262,
-      -1,    -1,   253,    -1,    73,    -1,    77,    -1,   209,    -1,
-      -1,   243,    -1,   272,    -1,    31,   270,    -1,   209,     8,
-     243,    -1,   209,     8,   272,    -1,   209,     8,    31,   270,
-      -1,   210,     8,   211,    -1,   211,    -1,   146,    -1,   155,
-     269,    -1,   155,   149,   268,   150,    -1,   212,     8,   146,
-      -1,   212,     8,   146,    13,   262,    -1,   146,    -1,   146,
-      13,   262,    -1,   213,   214,    -1,    -1,   229,   233,   153,
-      -1,   234,   153,    -1,   216,    -1,    -1,   230,   246,   179,
-     136,   151,   205,   152,   215,   228,    -1,   144,   217,   218,
-      -1,   253,    -1,   217,     8,   253,    -1,   153,    -1,   149,
-     219,   150,    -1,    -1,   220,    -1,   221,    -1,   220,   221,
-      -1,   222,   153,    -1,   226,   153,    -1,   225,   119,   223,
-      -1,   253,    -1,   223,     8,   253,    -1,   136,    -1,   225,
-      -1,   253,   133,   136,    -1,   224,    74,   227,   136,    -1,
-     224,    74,   232,    -1,    -1,   232,    -1,   153,    -1,   149,
-     168,   150,    -1,   231,    -1,   145,    -1,    -1,   231,    -1,
-     232,    -1,   231,   232,    -1,    67,    -1,    68,    -1,    69,
-      -1,    72,    -1,    71,    -1,    70,    -1,   233,     8,   146,
-      -1,   233,     8,   146,    13,   262,    -1,   146,    -1,   146,
-      13,   262,    -1,   234,     8,   136,    13,   262,    -1,    85,
-     136,    13,   262,    -1,   235,     8,   268,    -1,   268,    -1,
-      -1,   237,    -1,   237,     8,   268,    -1,   268,    -1,   238,
-     276,    -1,   276,    -1,   239,    61,   288,   157,    -1,    61,
-     288,   157,    -1,   239,   238,    -1,   239,    -1,   238,    -1,
-      -1,   240,    -1,    63,   254,   260,    -1,   123,   151,   293,
-     152,    13,   268,    -1,   272,    13,   268,    -1,   272,    13,
-      31,   272,    -1,   272,    13,    31,    63,   254,   260,    -1,
-      62,   268,    -1,   272,    24,   268,    -1,   272,    23,   268,
-      -1,   272,    22,   268,    -1,   272,    21,   268,    -1,   272,
-      20,   268,    -1,   272,    19,   268,    -1,   272,    18,   268,
-      -1,   272,    17,   268,    -1,   272,    16,   268,    -1,   272,
-      15,   268,    -1,   272,    14,   268,    -1,   271,    59,    -1,
-      59,   271,    -1,   271,    58,    -1,    58,   271,    -1,   268,
-      27,   268,    -1,   268,    28,   268,    -1,   268,     9,   268,
-      -1,   268,    11,   268,    -1,   268,    10,   268,    -1,   268,
-      29,   268,    -1,   268,    31,   268,    -1,   268,    30,   268,
-      -1,   268,    44,   268,    -1,   268,    42,   268,    -1,   268,
-      43,   268,    -1,   268,    45,   268,    -1,   268,    46,   268,
-      -1,   268,    47,   268,    -1,   268,    41,   268,    -1,   268,
-      40,   268,    -1,    42,   268,    -1,    43,   268,    -1,    48,
-     268,    -1,    50,   268,    -1,   268,    33,   268,    -1,   268,
-      32,   268,    -1,   268,    35,   268,    -1,   268,    34,   268,
-      -1,   268,    36,   268,    -1,   268,    39,   268,    -1,   268,
-      37,   268,    -1,   268,    38,   268,    -1,   268,    49,   254,
-      -1,   151,   268,   152,    -1,   242,    -1,   151,   242,   152,
-     241,    -1,   268,    25,   268,    26,   268,    -1,   268,    25,
-      26,   268,    -1,   300,    -1,    57,   268,    -1,    56,   268,
-      -1,    55,   268,    -1,    54,   268,    -1,    53,   268,    -1,
-      52,   268,    -1,    51,   268,    -1,   106,   258,    -1,    60,
-     268,    -1,   264,    -1,    73,   151,   295,   152,    -1,    61,
-     295,   157,    -1,   154,   259,   154,    -1,    12,   268,    -1,
-      -1,   246,   179,   151,   205,   152,   247,   149,   244,   168,
-     150,    -1,    -1,    72,   246,   179,   151,   205,   152,   247,
-     149,   245,   168,   150,    -1,   112,    -1,    -1,   144,   151,
-     248,   152,    -1,   248,     8,   146,    -1,   248,     8,    31,
-     146,    -1,   146,    -1,    31,   146,    -1,    -1,   161,   151,
-     250,   208,   152,    -1,   126,   128,   161,   151,   208,   152,
-      -1,    -1,   128,   161,   151,   251,   208,   152,    -1,   252,
-     133,   291,   151,   208,   152,    -1,   252,   133,   280,   151,
-     208,   152,    -1,   282,   133,   291,   151,   208,   152,    -1,
-     282,   133,   280,   151,   208,   152,    -1,   280,   151,   208,
-     152,    -1,    72,    -1,   161,    -1,   126,   128,   161,    -1,
-     128,   161,    -1,   161,    -1,   126,   128,   161,    -1,   128,
-     161,    -1,   252,    -1,   255,    -1,   285,   130,   289,   256,
-      -1,   285,    -1,   256,   257,    -1,    -1,   130,   289,    -1,
-      -1,   151,   152,    -1,   151,   268,   152,    -1,    -1,    99,
-      -1,   297,    -1,    -1,   151,   208,   152,    -1,   124,    -1,
-      92,    -1,    86,    -1,   122,    -1,   108,    -1,    91,    -1,
-     141,    -1,   125,    -1,   111,    -1,   127,    -1,   135,    99,
-     103,    -1,   135,   103,    -1,   261,    -1,   161,    -1,   126,
-     128,   161,    -1,   128,   161,    -1,    42,   262,    -1,    43,
-     262,    -1,    73,   151,   265,   152,    -1,   263,    -1,    61,
-     265,   157,    -1,    82,    -1,   252,   133,   136,    -1,   137,
-      -1,   306,    -1,   161,    -1,   126,   128,   161,    -1,   128,
-     161,    -1,   261,    -1,   156,   297,   156,    -1,   135,   297,
-     103,    -1,    82,    -1,    -1,   267,   266,    -1,    -1,     8,
-      -1,   267,     8,   262,    96,   262,    -1,   267,     8,   262,
-      -1,   262,    96,   262,    -1,   262,    -1,   269,    -1,   243,
-      -1,   272,    -1,   272,    -1,   272,    -1,    -1,    -1,   284,
-     273,   130,   289,   279,   274,   275,    -1,   284,    -1,   275,
-     276,    -1,    -1,   130,   289,   279,    -1,   277,    61,   288,
-     157,    -1,   278,    61,   288,   157,    -1,   151,   208,   152,
-      -1,   278,    -1,   277,    -1,    -1,   286,    -1,   292,   286,
-      -1,   252,   133,   280,    -1,   282,   133,   280,    -1,   286,
-      -1,   283,    61,   288,   157,    -1,   249,    61,   288,   157,
-      -1,   285,    -1,   283,    -1,   249,    -1,   286,    -1,   292,
-     286,    -1,   281,    -1,   286,    61,   288,   157,    -1,   286,
-     149,   268,   150,    -1,   287,    -1,   146,    -1,   155,   149,
-     268,   150,    -1,    -1,   268,    -1,   290,    -1,   280,    -1,
-     290,    61,   288,   157,    -1,   290,   149,   268,   150,    -1,
-     291,    -1,   136,    -1,   149,   268,   150,    -1,   155,    -1,
-     292,   155,    -1,   293,     8,   294,    -1,   294,    -1,   272,
-      -1,   123,   151,   293,   152,    -1,    -1,    -1,   296,   266,
-      -1,   296,     8,   268,    96,   268,    -1,   296,     8,   268,
-      -1,   268,    96,   268,    -1,   268,    -1,   296,     8,   268,
-      96,    31,   270,    -1,   296,     8,    31,   270,    -1,   268,
-      96,    31,   270,    -1,    31,   270,    -1,   297,   298,    -1,
-     297,    99,    -1,   298,    -1,    99,   298,    -1,   146,    -1,
-     146,    61,   299,   157,    -1,   146,   130,   136,    -1,    95,
-     268,   150,    -1,    95,   137,    61,   268,   157,   150,    -1,
-      88,   272,   150,    -1,   136,    -1,   129,    -1,   146,    -1,
-     121,   151,   305,   152,    -1,    98,   151,   272,   152,    -1,
-      -1,     7,   301,   268,    -1,    -1,     6,   302,   268,    -1,
-       5,   151,   268,   152,    -1,    -1,     4,   303,   268,    -1,
-      -1,     3,   304,   268,    -1,   272,    -1,   305,     8,   272,
-      -1,   252,   133,   136,    -1,   282,   133,   136,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   360,   360,   364,   365,   369,   370,   374,   375,   376,
-     377,   378,   383,   383,   388,   388,   394,   395,   399,   401,
-     405,   408,   411,   414,   420,   426,   435,   436,   440,   441,
-     442,   443,   447,   448,   452,   453,   457,   461,   462,   463,
-     472,   473,   474,   475,   476,   477,   478,   479,   480,   481,
-     482,   483,   484,   485,   486,   489,   492,   493,   494,   500,
-     501,   505,   506,   510,   511,   515,   520,   521,   525,   529,
-     533,   537,   538,   543,   542,   560,   559,   579,   578,   589,
-     590,   591,   592,   596,   597,   604,   608,   609,   614,   615,
-     620,   623,   627,   628,   632,   633,   637,   638,   642,   643,
-     647,   648,   652,   653,   657,   658,   659,   660,   664,   665,
-     666,   670,   671,   675,   676,   680,   681,   687,   688,   694,
-     695,   699,   700,   704,   705,   709,   710,   711,   712,   713,
-     714,   715,   716,   720,   721,   722,   723,   727,   728,   732,
-     739,   746,   753,   754,   755,   759,   760,   764,   765,   766,
-     770,   771,   772,   773,   777,   778,   782,   783,   784,   786,
-     785,   802,   807,   808,   813,   814,   818,   819,   823,   824,
-     828,   829,   833,   838,   839,   843,   846,   850,   856,   857,
-     861,   862,   866,   867,   871,   872,   878,   879,   883,   884,
-     888,   889,   890,   891,   892,   893,   897,   903,   909,   915,
-     924,   931,   940,   941,   945,   946,   950,   951,   955,   956,
-     960,   961,   965,   966,   967,   971,   972,   976,   980,   981,
-     994,   999,  1004,  1005,  1006,  1007,  1008,  1009,  1010,  1011,
-    1012,  1013,  1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,
-    1022,  1023,  1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,
-    1032,  1033,  1034,  1035,  1036,  1037,  1038,  1039,  1040,  1041,
-    1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,  1050,  1051,
-    1052,  1055,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,
-    1065,  1066,  1067,  1068,  1069,  1070,  1071,  1073,  1072,  1078,
-    1077,  1085,  1089,  1090,  1094,  1095,  1096,  1097,  1101,  1101,
-    1124,  1127,  1127,  1150,  1152,  1154,  1156,  1158,  1163,  1164,
-    1165,  1166,  1170,  1171,  1172,  1176,  1177,  1181,  1183,  1187,
-    1188,  1192,  1196,  1197,  1198,  1202,  1203,  1204,  1208,  1209,
-    1213,  1222,  1231,  1240,  1241,  1242,  1243,  1244,  1245,  1246,
-    1247,  1248,  1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,
-    1260,  1261,  1265,  1269,  1270,  1271,  1272,  1273,  1274,  1275,
-    1276,  1277,  1281,  1282,  1286,  1287,  1291,  1292,  1293,  1294,
-    1298,  1299,  1303,  1307,  1311,  1315,  1320,  1315,  1333,  1337,
-    1338,  1342,  1346,  1347,  1351,  1355,  1356,  1357,  1361,  1362,
-    1366,  1367,  1371,  1375,  1376,  1380,  1390,  1391,  1396,  1397,
-    1398,  1402,  1403,  1404,  1408,  1409,  1413,  1414,  1418,  1419,
-    1423,  1424,  1425,  1429,  1430,  1434,  1435,  1439,  1440,  1444,
-    1445,  1446,  1450,  1451,  1455,  1456,  1457,  1458,  1459,  1460,
-    1461,  1462,  1466,  1467,  1468,  1469,  1473,  1474,  1475,  1476,
-    1477,  1478,  1482,  1483,  1484,  1488,  1489,  1490,  1490,  1496,
-    1496,  1502,  1503,  1503,  1509,  1509,  1517,  1518,  1522,  1523
-};
-#endif
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "T_END", "error", "$undefined", "T_REQUIRE_ONCE", "T_REQUIRE", "T_EVAL",
-  "T_INCLUDE_ONCE", "T_INCLUDE", "','", "T_LOGICAL_OR", "T_LOGICAL_XOR",
-  "T_LOGICAL_AND", "T_PRINT", "'='", "T_SR_EQUAL", "T_SL_EQUAL",
-  "T_XOR_EQUAL", "T_OR_EQUAL", "T_AND_EQUAL", "T_MOD_EQUAL",
-  "T_CONCAT_EQUAL", "T_DIV_EQUAL", "T_MUL_EQUAL", "T_MINUS_EQUAL",
-  "T_PLUS_EQUAL", "'?'", "':'", "T_BOOLEAN_OR", "T_BOOLEAN_AND", "'|'",
-  "'^'", "'&'", "T_IS_NOT_IDENTICAL", "T_IS_IDENTICAL", "T_IS_NOT_EQUAL",
-  "T_IS_EQUAL", "'<'", "'>'", "T_IS_GREATER_OR_EQUAL",
-  "T_IS_SMALLER_OR_EQUAL", "T_SR", "T_SL", "'+'", "'-'", "'.'", "'*'",
-  "'/'", "'%'", "'!'", "T_INSTANCEOF", "'~'", "T_UNSET_CAST",
-  "T_BOOL_CAST", "T_OBJECT_CAST", "T_ARRAY_CAST", "T_STRING_CAST",
-  "T_DOUBLE_CAST", "T_INT_CAST", "T_DEC", "T_INC", "'@'", "'['", "T_CLONE",
-  "T_NEW", "T_ELSEIF", "T_ELSE", "T_ENDIF", "T_PUBLIC", "T_PROTECTED",
-  "T_PRIVATE", "T_FINAL", "T_ABSTRACT", "T_STATIC", "T_ARRAY", "T_AS",
-  "T_BAD_CHARACTER", "T_BREAK", "T_CALLABLE", "T_CASE", "T_CATCH",
-  "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLOSE_TAG", "T_COMMENT",
-  "T_CONST", "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN",
-  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DNUMBER", "T_DO", "T_DOC_COMMENT",
-  "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW", "T_ECHO", "T_EMPTY",
+  "T_END", "error", "\"invalid token\"", "','", "'='", "'?'", "':'",
+  "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'", "'.'", "'*'", "'/'",
+  "'%'", "'!'", "'~'", "'@'", "'['", "T_ABSTRACT", "T_AND_EQUAL",
+  "T_ARRAY", "T_ARRAY_CAST", "T_AS", "T_BAD_CHARACTER", "T_BOOL_CAST",
+  "T_BOOLEAN_AND", "T_BOOLEAN_OR", "T_BREAK", "T_CALLABLE", "T_CASE",
+  "T_CATCH", "T_CHARACTER", "T_CLASS", "T_CLASS_C", "T_CLONE",
+  "T_CLOSE_TAG", "T_COMMENT", "T_CONCAT_EQUAL", "T_CONST",
+  "T_CONSTANT_ENCAPSED_STRING", "T_CONTINUE", "T_CURLY_OPEN", "T_DEC",
+  "T_DECLARE", "T_DEFAULT", "T_DIR", "T_DIV_EQUAL", "T_DNUMBER", "T_DO",
+  "T_DOC_COMMENT", "T_DOLLAR_OPEN_CURLY_BRACES", "T_DOUBLE_ARROW",
+  "T_DOUBLE_CAST", "T_ECHO", "T_ELSE", "T_ELSEIF", "T_EMPTY",
   "T_ENCAPSED_AND_WHITESPACE", "T_ENDDECLARE", "T_ENDFOR", "T_ENDFOREACH",
-  "T_END_HEREDOC", "T_ENDSWITCH", "T_ENDWHILE", "T_EXIT", "T_EXTENDS",
-  "T_FILE", "T_FOR", "T_FOREACH", "T_FUNC_C", "T_FUNCTION", "T_GLOBAL",
-  "T_GOTO", "T_HALT_COMPILER", "T_IF", "T_IMPLEMENTS", "T_INLINE_HTML",
-  "T_INSTEADOF", "T_INTERFACE", "T_ISSET", "T_LINE", "T_LIST", "T_LNUMBER",
-  "T_METHOD_C", "T_NAMESPACE", "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING",
-  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO",
-  "T_PAAMAYIM_NEKUDOTAYIM", "T_RETURN", "T_START_HEREDOC", "T_STRING",
-  "T_STRING_VARNAME", "T_SWITCH", "T_THROW", "T_TRAIT", "T_TRAIT_C",
-  "T_TRY", "T_UNSET", "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE",
-  "T_WHITESPACE", "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'",
-  "']'", "$accept", "start", "top_statement_list", "namespace_name",
+  "T_END_HEREDOC", "T_ENDIF", "T_ENDSWITCH", "T_ENDWHILE", "T_EVAL",
+  "T_EXIT", "T_EXTENDS", "T_FILE", "T_FINAL", "T_FOR", "T_FOREACH",
+  "T_FUNC_C", "T_FUNCTION", "T_GLOBAL", "T_GOTO", "T_HALT_COMPILER",
+  "T_IF", "T_IMPLEMENTS", "T_INC", "T_INCLUDE", "T_INCLUDE_ONCE",
+  "T_INLINE_HTML", "T_INSTANCEOF", "T_INSTEADOF", "T_INT_CAST",
+  "T_INTERFACE", "T_IS_EQUAL", "T_IS_GREATER_OR_EQUAL", "T_IS_IDENTICAL",
+  "T_IS_NOT_EQUAL", "T_IS_NOT_IDENTICAL", "T_ISSET",
+  "T_IS_SMALLER_OR_EQUAL", "T_LINE", "T_LIST", "T_LNUMBER",
+  "T_LOGICAL_AND", "T_LOGICAL_OR", "T_LOGICAL_XOR", "T_METHOD_C",
+  "T_MINUS_EQUAL", "T_MOD_EQUAL", "T_MUL_EQUAL", "T_NAMESPACE", "T_NEW",
+  "T_NS_C", "T_NS_SEPARATOR", "T_NUM_STRING", "T_OBJECT_CAST",
+  "T_OBJECT_OPERATOR", "T_OPEN_TAG", "T_OPEN_TAG_WITH_ECHO", "T_OR_EQUAL",
+  "T_PAAMAYIM_NEKUDOTAYIM", "T_PLUS_EQUAL", "T_PRINT", "T_PRIVATE",
+  "T_PROTECTED", "T_PUBLIC", "T_REQUIRE", "T_REQUIRE_ONCE", "T_RETURN",
+  "T_SL", "T_SL_EQUAL", "T_SR", "T_SR_EQUAL", "T_START_HEREDOC",
+  "T_STATIC", "T_STRING", "T_STRING_CAST", "T_STRING_VARNAME", "T_SWITCH",
+  "T_THROW", "T_TRAIT", "T_TRAIT_C", "T_TRY", "T_UNSET", "T_UNSET_CAST",
+  "T_USE", "T_VAR", "T_VARIABLE", "T_WHILE", "T_WHITESPACE", "T_XOR_EQUAL",
+  "'{'", "'}'", "'('", "')'", "';'", "'`'", "'$'", "'\"'", "']'",
+  "$accept", "start", "top_statement_list", "namespace_name",
   "top_statement", "$@1", "$@2", "use_declarations", "use_declaration",
   "constant_declaration", "inner_statement_list", "inner_statement",
   "statement", "unticked_statement", "additional_catches",
@@ -946,162 +1175,151 @@ static const char *const yytname[] =
   "assignment_list_element", "array_pair_list",
   "non_empty_array_pair_list", "encaps_list", "encaps_var",
   "encaps_var_offset", "internal_functions_in_yacc", "$@13", "$@14",
-  "$@15", "$@16", "isset_variables", "class_constant", 0
+  "$@15", "$@16", "isset_variables", "class_constant", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   629,   605,   604,   549,   565,   564,    44,   582,
-     583,   581,   600,    61,   610,   608,   628,   597,   503,   586,
-     521,   530,   587,   585,   599,    63,    58,   510,   509,   124,
-      94,    38,   575,   573,   574,   571,    60,    62,   572,   577,
-     609,   607,    43,    45,    46,    42,    47,    37,    33,   567,
-     126,   622,   508,   593,   505,   614,   536,   569,   526,   563,
-      64,    91,   518,   589,   539,   538,   546,   603,   602,   601,
-     553,   502,   612,   504,   506,   507,   511,   512,   513,   514,
-     515,   516,   517,   519,   520,   522,   523,   524,   525,   527,
-     528,   529,   531,   532,   533,   534,   535,   537,   540,   541,
-     542,   543,   544,   545,   547,   548,   550,   551,   552,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   566,   568,
-     570,   576,   578,   579,   580,   584,   588,   590,   591,   592,
-     594,   595,   596,   598,   606,   611,   613,   615,   616,   617,
-     618,   619,   620,   621,   623,   624,   625,   626,   627,   123,
-     125,    40,    41,    59,    96,    36,    34,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
-     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
-     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
-     169,   169,   170,   170,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   172,   172,   173,   173,   174,   175,   175,   176,   177,
-     178,   179,   179,   181,   180,   183,   182,   184,   182,   185,
-     185,   185,   185,   186,   186,   187,   188,   188,   189,   189,
-     190,   190,   191,   191,   192,   192,   193,   193,   194,   194,
-     195,   195,   196,   196,   197,   197,   197,   197,   198,   198,
-     198,   199,   199,   200,   200,   201,   201,   202,   202,   203,
-     203,   204,   204,   205,   205,   206,   206,   206,   206,   206,
-     206,   206,   206,   207,   207,   207,   207,   208,   208,   209,
-     209,   209,   209,   209,   209,   210,   210,   211,   211,   211,
-     212,   212,   212,   212,   213,   213,   214,   214,   214,   215,
-     214,   216,   217,   217,   218,   218,   219,   219,   220,   220,
-     221,   221,   222,   223,   223,   224,   224,   225,   226,   226,
-     227,   227,   228,   228,   229,   229,   230,   230,   231,   231,
-     232,   232,   232,   232,   232,   232,   233,   233,   233,   233,
-     234,   234,   235,   235,   236,   236,   237,   237,   238,   238,
-     239,   239,   240,   240,   240,   241,   241,   242,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   244,   243,   245,
-     243,   246,   247,   247,   248,   248,   248,   248,   250,   249,
-     249,   251,   249,   249,   249,   249,   249,   249,   252,   252,
-     252,   252,   253,   253,   253,   254,   254,   255,   255,   256,
-     256,   257,   258,   258,   258,   259,   259,   259,   260,   260,
-     261,   261,   261,   261,   261,   261,   261,   261,   261,   261,
-     261,   261,   262,   262,   262,   262,   262,   262,   262,   262,
-     262,   262,   263,   264,   264,   264,   264,   264,   264,   264,
-     264,   264,   265,   265,   266,   266,   267,   267,   267,   267,
-     268,   268,   269,   270,   271,   273,   274,   272,   272,   275,
-     275,   276,   277,   277,   278,   279,   279,   279,   280,   280,
-     281,   281,   282,   283,   283,   284,   284,   284,   285,   285,
-     285,   286,   286,   286,   287,   287,   288,   288,   289,   289,
-     290,   290,   290,   291,   291,   292,   292,   293,   293,   294,
-     294,   294,   295,   295,   296,   296,   296,   296,   296,   296,
-     296,   296,   297,   297,   297,   297,   298,   298,   298,   298,
-     298,   298,   299,   299,   299,   300,   300,   301,   300,   302,
-     300,   300,   303,   300,   304,   300,   305,   305,   306,   306
-};
+#define YYPACT_NINF (-733)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-414)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
-       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
-       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
-       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
-       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
-       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
-       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
-       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
-       2,     1,     2,     0,     2,     1,     0,     2,     0,     2,
-       1,     3,     0,     2,     1,     2,     1,     4,     1,     4,
-       1,     4,     3,     5,     3,     4,     4,     5,     0,     5,
-       4,     1,     1,     1,     4,     0,     6,     0,     7,     0,
-       2,     0,     3,     1,     0,     2,     3,     5,     4,     4,
-       5,     7,     6,     0,     1,     1,     1,     1,     0,     1,
-       1,     2,     3,     3,     4,     3,     1,     1,     2,     4,
-       3,     5,     1,     3,     2,     0,     3,     2,     1,     0,
-       9,     3,     1,     3,     1,     3,     0,     1,     1,     2,
-       2,     2,     3,     1,     3,     1,     1,     3,     4,     3,
-       0,     1,     1,     3,     1,     1,     0,     1,     1,     2,
-       1,     1,     1,     1,     1,     1,     3,     5,     1,     3,
-       5,     4,     3,     1,     0,     1,     3,     1,     2,     1,
-       4,     3,     2,     1,     1,     0,     1,     3,     6,     3,
-       4,     6,     2,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     1,     4,
-       5,     4,     1,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     1,     4,     3,     3,     2,     0,    10,     0,
-      11,     1,     0,     4,     3,     4,     1,     2,     0,     5,
-       6,     0,     6,     6,     6,     6,     6,     4,     1,     1,
-       3,     2,     1,     3,     2,     1,     1,     4,     1,     2,
-       0,     2,     0,     2,     3,     0,     1,     1,     0,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     2,     1,     1,     3,     2,     2,     2,     4,     1,
-       3,     1,     3,     1,     1,     1,     3,     2,     1,     3,
-       3,     1,     0,     2,     0,     1,     5,     3,     3,     1,
-       1,     1,     1,     1,     1,     0,     0,     7,     1,     2,
-       0,     3,     4,     4,     3,     1,     1,     0,     1,     2,
-       3,     3,     1,     4,     4,     1,     1,     1,     1,     2,
-       1,     4,     4,     1,     1,     4,     0,     1,     1,     1,
-       4,     4,     1,     1,     3,     1,     2,     3,     1,     1,
-       4,     0,     0,     2,     5,     3,     3,     1,     6,     4,
-       4,     2,     2,     2,     1,     2,     1,     4,     3,     3,
-       6,     3,     1,     1,     1,     4,     4,     0,     3,     0,
-       3,     4,     0,     3,     0,     3,     1,     3,     3,     3
+    -733,    75,  5183,  -733,  7938,  7938,  7938,  7938,  7938,  2966,
+      54,  -111,  7938,  7938,  7358,  -733,  -733,  7938,    -5,  -733,
+    7503,   225,   -16,  -733,  -733,  7213,  7938,  7938,    -8,    13,
+      27,  -733,   184,    83,    88,  -733,  -733,   -63,   110,   113,
+     167,   225,  -733,  -733,  -733,  7938,  -733,   168,  -733,   197,
+    -733,  -733,   -30,   545,  -733,   221,  7938,  7938,  -733,  -733,
+    7648,    80,   -33,   343,  7938,  -733,   236,  7938,  -733,  -733,
+     247,   246,  7938,   -47,  -733,   260,  -733,  7938,  -733,     7,
+     271,   290,   196,  -733,    19,  -733,  -733,  -733,  -733,  -733,
+    -733,   291,   292,  -733,  -733,   413,   417,   316,  -733,  -733,
+    2674,  -733,   217,  1242,   297,  -733,   322,   432,   328,  -733,
+      89,  -733,   -23,  -733,  -733,   350,   386,  -733,   413,  -733,
+    -733,   379,  -733,  -733,   225,  8230,   310,   466,  -733,  2966,
+    -733,  -733,  -733,  2775,  -733,   468,  -733,  2804,   369,   221,
+    -733,   -56,   364,  -733,  -733,   365,   358,   346,  -733,    20,
+    8391,   225,  7938,  7793,  -733,  -733,  7938,  7938,  -733,   421,
+      23,  -733,   347,   353,  7938,  -733,  7938,  7938,  -733,   225,
+     -34,   221,  -733,   -53,   410,   221,   411,   384,   385,  -733,
+     397,   424,    12,   -23,   254,  -733,  8546,  7938,  7938,  -733,
+     387,  8391,   921,   225,  8078,   208,  -733,    42,   106,  -733,
+     526,    28,   413,  -733,  -733,  7938,  2905,  -733,   225,  -733,
+     221,    36,    29,  -733,  7938,  5328,   389,  3958,   105,   388,
+     301,  7938,   105,   104,   406,  -733,   415,  -733,   475,   478,
+    -733,   -28,  7938,   332,  2493,  7938,  7938,  7938,  7938,  7938,
+    7938,  7938,  7938,  7938,  7938,  7938,  7938,  7938,   545,  7938,
+    7938,  7938,  7938,  7938,  7938,  7938,  7938,  7938,  7938,  7938,
+    -733,  -733,  -733,  3106,  7938,  7938,  7938,  7938,  7938,  7938,
+    7938,  7938,  7938,  7938,  7938,  3246,   414,  7938,   437,  7938,
+    7938,   271,    73,   407,  -733,  -733,  3386,  -733,  3526,  -733,
+     409,  -733,  1386,  -733,   221,   -27,   435,   435,   563,    38,
+     422,  7938,  -733,   420,  3987,  -733,  4088,   425,   576,  8391,
+     555,   984,  7938,  -733,  -733,   -63,  -733,  -733,   429,  4117,
+    8391,  8391,  -733,    39,   436,  -733,    40,  -733,   268,  -733,
+    -733,  -733,   221,   411,   156,  3246,  -733,   156,   435,    30,
+    -733,  8391,  8391,  -733,  -733,   433,   567,  4507,  -733,  -733,
+     180,   458,  -733,  -733,  -733,  1386,   450,  -733,   445,  4218,
+    -733,  5473,    44,  -733,  -733,   107,   464,   -47,  -733,  4247,
+     447,  -733,  -733,  -733,  -733,  -733,    48,  -733,  -733,  4608,
+    -733,  -733,  3246,   597,   273,   520,   273,  -733,   459,   212,
+    8391,   460,   467,  7938,   470,    30,   477,   -23,  7938,  8259,
+    8692,  8701,  1436,   416,   274,   287,   287,   287,   379,   379,
+     379,  8637,  8594,  -733,  8740,   274,  8740,  8740,  8740,   274,
+    8546,  8418,  8445,   377,   377,   528,  8546,  8546,  8546,  8546,
+    8546,  8546,  8546,  8546,  8546,  8546,  8546,  8546,   225,   463,
+     616,    45,   293,   467,   479,   480,   469,   435,   472,  4637,
+     225,  8391,   225,  8290,  -733,  1386,  1386,  1386,   482,  -733,
+     524,   221,    79,   210,   523,  -733,  -733,  -733,   -24,  -733,
+    1386,   509,  1763,  7938,  8391,  -733,  -733,  -733,  7938,  7938,
+     225,    97,  4668,  -733,  -733,  1909,   225,  -733,   -34,   -34,
+     639,  3246,  4893,  -733,   411,  -733,   492,  -733,  -733,  -733,
+      35,  -733,  3246,  -733,  7938,  -733,  -733,  -733,  -733,   497,
+    -733,  -733,   645,   212,    31,   623,   225,   505,   531,  -733,
+    -733,  2055,   507,  7938,   435,   552,    81,  -733,  -733,  -733,
+    -733,   515,  1386,   557,   221,   411,  -733,   273,  -733,   667,
+    -733,   522,   212,  -733,  -733,   527,   672,    67,  -733,  -733,
+    4769,  3246,  3246,    30,  8570,  7938,   545,  -733,  -733,  -733,
+    3666,  3246,  3246,  -733,   529,  -733,  -733,  -733,  -733,  3806,
+    -733,  -733,   627,   530,   683,  1386,   221,   249,   626,   559,
+    -733,   689,  -733,  -733,  -733,  4348,   541,  8391,   640,   225,
+     640,  -733,  -733,  -733,  -733,  -733,    46,  -733,  7938,   544,
+    -733,  5038,  -733,   583,  7938,  7938,   546,  1629,  -733,  1386,
+     547,   548,   549,  -733,   553,  -733,  -733,  -733,  -733,  -733,
+    -733,   550,   551,   529,  -733,  7938,   552,  -733,  -733,   221,
+     411,   667,   556,   273,  -733,   554,   566,   351,   568,   708,
+    -733,   562,   564,  8570,   385,   225,    47,   786,   565,   572,
+    3246,   694,   698,  -733,   225,  8391,  1386,  -733,  1386,  -733,
+     573,   405,  -733,  1386,  5618,   574,  7938,    97,   580,  -733,
+     581,  7068,   216,  -733,  8546,  -733,  -733,   435,  -733,   569,
+    4798,  -733,   570,  -733,   566,  -733,   289,  -733,    24,   273,
+    5763,  -733,  -733,  -733,   577,   411,  -733,  -733,   133,  -733,
+     585,   589,    69,   735,  1386,  -733,  -733,  -733,  -733,  -733,
+    -733,   592,  7938,  7938,  -733,  -733,  -733,   690,  -733,  -733,
+     593,  -733,   595,  -733,  2201,  2201,   220,  7213,   598,  -733,
+    -733,  -733,  -733,  -733,   599,   404,  7938,    15,   600,    98,
+    -733,   605,   601,  -733,   502,  -733,   618,  -733,  -733,  -733,
+    -733,  -733,   273,  -733,  -733,  -733,  -733,   607,   386,    16,
+    -733,    32,   608,    70,  -733,   613,   755,  1386,  -733,  -733,
+     603,   604,   552,  1386,  -733,  2347,  -733,  -733,  -733,  -733,
+     756,   612,   701,  -733,  7938,  -733,   611,  2645,  -733,  -733,
+    -733,  -733,  -733,   617,  -733,  -733,   764,    17,  -733,   768,
+      33,   413,  -733,   642,  -733,  -733,   631,  -733,    50,  -733,
+     773,  1386,  -733,  -733,  -733,  -733,  -733,  -733,  -733,  -733,
+    5908,  -733,  7938,   625,  4377,  -733,  -733,  -733,  7068,   632,
+    1386,   273,   306,  -733,  -733,  1386,   635,  -733,   649,   779,
+    6053,  -733,    71,  -733,  6198,  1386,  -733,  6343,   633,  7068,
+    4478,  -733,  7213,  6488,  7068,  -733,  -733,  -733,   758,   637,
+     306,  -733,   641,   762,   704,   643,   675,  -733,   791,   646,
+    1386,  -733,   653,  -733,  -733,  -733,   647,  -733,   793,  -733,
+    -733,  6633,  -733,  -733,  -733,   209,   273,  -733,   669,  1386,
+     212,  -733,  -733,  -733,  -733,   769,   671,   673,   802,  -733,
+    -733,  -733,   655,  7068,   657,  -733,   769,  -733,  -733,   273,
+    -733,   273,  -733,  -733,   -40,   665,  -733,  -733,  -733,   659,
+    6778,   663,  -733,  -733,  6923,  -733
 };
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+static const yytype_int16 yydefact[] =
 {
-       4,     0,     2,     1,   454,   452,     0,   449,   447,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   422,     0,     0,     0,     0,   308,
-       0,     0,    79,   361,     0,   332,     0,     0,   335,   331,
-       0,     0,     0,   322,   334,     0,     0,   338,   291,     0,
-       0,     0,     0,    51,    85,     0,   333,     0,   330,   337,
-       0,   339,     0,     0,     0,     5,   353,     0,     0,    81,
-     336,     0,     0,     0,   404,     0,    27,     0,    57,   325,
+       4,     0,     2,     1,     0,     0,     0,     0,     0,   422,
+       0,     0,     0,     0,     0,    79,   361,     0,     0,   332,
+       0,     0,     0,   335,   331,     0,     0,     0,     0,     0,
+     322,   334,     0,     0,     0,   338,   291,     0,     0,     0,
+       0,     0,   447,   449,    51,     0,    85,     0,   333,     0,
+     330,   337,     0,     0,   339,     0,     0,     0,   452,   454,
+       0,     0,   308,     5,     0,   353,     0,     0,    81,   336,
+       0,     0,     0,     0,   404,     0,    27,     0,    57,   325,
      415,     0,   355,     3,     0,     7,    32,     8,     9,    69,
       70,     0,     0,   268,   371,    71,   397,     0,   358,   282,
        0,   370,     0,   372,     0,   400,     0,   396,   378,   395,
-     398,   403,     0,   272,   354,     0,     0,     0,     0,     0,
-     308,     0,     5,    71,   286,   254,   255,   256,   257,   279,
-     278,   277,   276,   275,   274,   273,   308,     0,     0,   309,
-       0,   237,   374,     0,   235,   281,     0,   427,     0,   364,
-     222,     0,     0,   309,   315,   328,   316,     0,   318,   398,
-       0,    82,    80,   152,     0,    71,   422,    41,     0,     0,
-      43,     0,     0,     0,     0,   203,     0,     0,   280,   204,
-       0,   147,     0,     0,   146,     0,     0,     0,     0,   421,
-       0,    14,     0,   357,    45,   371,     0,   372,     0,     0,
-       0,   341,   436,     0,   434,    33,     0,     0,    27,     0,
+     398,   403,     0,   272,   354,     0,   308,     5,    71,   254,
+     255,   256,   257,   281,     0,   427,     0,   364,    80,   422,
+     276,   278,    41,     0,   222,     0,    43,     0,     0,     0,
+     308,   309,     0,   237,   374,     0,     0,     0,   274,     0,
+     203,     0,     0,     0,   280,    82,   204,     0,   147,     0,
+       0,   146,     0,     0,     0,   235,     0,     0,   273,     0,
+     421,     0,    14,     0,     0,     0,   309,   315,   328,   316,
+       0,   318,   398,     0,   357,   277,   286,     0,     0,    45,
+     371,     0,   372,     0,     0,     0,   341,   436,     0,   434,
+     152,     0,    71,    33,   275,     0,     0,    27,     0,   279,
        0,    20,     0,    19,     0,     0,   268,     0,   326,     0,
      327,     0,     0,     0,     0,   298,     0,    17,    83,    86,
       72,     0,   406,     0,     0,     0,     0,     0,     0,     0,
@@ -1109,2081 +1327,2197 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       52,   236,   234,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,   138,     0,   406,     0,   406,
-       0,   416,   399,   455,   453,     0,   450,   448,     0,     0,
-     311,     0,     0,   431,   373,     0,   284,   365,   423,     0,
-     311,     0,   138,   217,     0,     0,   399,     0,     0,    49,
-       0,     0,    42,     0,    44,     0,     0,     0,     0,    50,
-       0,   323,     0,     0,   205,   207,   371,   372,     0,   148,
-     372,     0,    48,    60,     0,     0,   456,     0,     0,   419,
-       0,   418,   356,     4,    12,    11,   301,    46,    47,     0,
-     353,     0,   340,   435,     0,     0,   433,   360,   432,     0,
+       0,   416,   399,     0,   431,   373,     0,   284,   365,   423,
+       0,    42,     0,    44,     0,   311,     0,     0,     0,     0,
+       0,     0,    50,     0,     0,   323,     0,     0,   205,   207,
+     371,   372,     0,   148,   372,     0,    48,    60,     0,     0,
+     448,   450,   456,     0,     0,   419,     0,   418,   356,     4,
+      12,    11,     0,   311,     0,   138,   217,     0,     0,   399,
+     301,   453,   455,    46,    47,     0,   353,     0,   340,   435,
+       0,     0,   433,   360,   432,     0,     0,    49,     0,     0,
       59,     0,     0,    66,    68,    22,     0,     0,    16,     0,
        0,    34,    26,    28,    29,    30,   215,   267,   285,     0,
      359,     6,   138,     0,     0,    88,     0,    77,     0,   133,
-     407,     0,   458,     0,   390,   388,     0,     0,   240,   242,
-     241,     0,     0,   238,   239,   243,   245,   244,   259,   258,
-     261,   260,   262,   264,   265,   263,   253,   252,   247,   248,
-     246,   249,   250,   251,   266,     0,   219,   233,   232,   231,
-     230,   229,   228,   227,   226,   225,   224,   223,     0,     0,
+     407,     0,   458,     0,   390,   388,     0,     0,     0,     0,
+     243,   245,   244,   262,   264,   247,   248,   246,   249,   250,
+     251,   239,   238,   266,   260,   265,   258,   261,   259,   263,
+     241,   240,   242,   252,   253,     0,   219,   229,   227,   226,
+     224,   228,   225,   230,   223,   232,   233,   231,     0,     0,
      137,   371,   372,   459,   391,     0,     0,     0,     0,     0,
-     451,   310,   413,     0,   426,     0,   425,   310,   390,     0,
-     391,   409,   320,   408,   412,     0,     0,   362,     0,   351,
-       0,     0,     0,   343,     0,   342,   153,   349,   150,   133,
-     283,    25,     0,     0,     0,     0,   202,   446,   324,   204,
-       0,     0,     0,     0,   145,    10,     0,     0,   445,   421,
-     421,     0,   138,     0,     4,   138,   441,     0,   439,   443,
-     442,   444,     0,   438,     0,     0,     0,     0,     0,    21,
+       0,   426,     0,   425,   283,     0,     0,   362,     0,   351,
+       0,     0,     0,   343,     0,   342,    25,   349,   310,   413,
+       0,     0,     0,     0,   202,   446,   451,   324,   204,     0,
+       0,     0,     0,   145,    10,     0,     0,   445,   421,   421,
+       0,   138,     0,     4,   310,   390,     0,   391,   409,   320,
+     408,   412,   138,   441,     0,   439,   443,   442,   444,     0,
+     438,   153,   150,   133,     0,     0,     0,     0,     0,    21,
       18,     0,     0,   406,     0,   214,   213,   216,   269,   209,
      405,     0,     0,     0,     0,   312,    84,     0,    75,    87,
       90,     0,   133,   135,   136,     0,   123,     0,   134,   394,
        0,   138,   138,   389,   271,     0,     0,   220,   141,   307,
        0,   138,   138,   393,   387,   401,   402,   430,   429,     0,
-     329,   317,   406,     0,   346,   347,   369,     0,   364,   362,
-       0,   345,     0,     0,     0,     0,   102,     0,    27,   100,
-      56,     0,     0,   206,    92,     0,    92,    94,   149,    27,
-     115,   457,     0,   417,     0,     0,    15,     0,     0,     0,
-     437,   108,   108,    40,     0,    67,    53,    23,    27,   113,
+     346,   347,   369,     0,   364,   362,     0,   345,     0,     0,
+     102,     0,    27,   100,    56,     0,     0,   206,    92,     0,
+      92,    94,   149,    27,   115,   457,     0,   417,     0,     0,
+      15,     0,   329,   317,   406,     0,     0,     0,   437,     0,
+       0,   108,   108,    40,     0,    67,    53,    23,    27,   113,
       37,     0,     0,   387,   208,   406,   212,   299,    24,     0,
      314,    89,     0,     0,   155,     0,   292,   133,     0,   125,
      414,     0,     0,   270,   328,     0,   371,   372,     0,     0,
-     138,   386,   385,   376,     0,   424,     0,   319,     0,     0,
-       0,   350,   365,   363,     0,   344,   352,   151,   292,     0,
-       0,     0,   204,     0,     0,    95,     0,   117,   119,   420,
-     218,   300,    13,   302,     0,   108,     0,   108,     0,     0,
+     138,   386,   385,   376,     0,   424,     0,   350,   365,   363,
+       0,   344,   352,     0,     0,     0,   204,     0,     0,    95,
+       0,   117,   119,   420,   218,   300,    13,     0,   319,     0,
+       0,   302,     0,   151,   292,   108,     0,   108,     0,     0,
        0,    31,   211,   381,     0,   313,   155,    91,   186,    73,
        0,     0,     0,   126,     0,   304,   303,   221,   144,   306,
-     305,     0,   406,   406,   380,   428,   321,   410,   411,   368,
-     367,   348,     0,   103,     0,    38,     0,    93,     0,     0,
-     121,     0,     0,    35,   440,     0,     0,     0,     0,     0,
-     104,     0,     0,   210,   186,   190,   191,   192,   195,   194,
-     193,     0,     0,   185,    78,   154,   158,     0,     0,   184,
+     305,     0,   406,   406,   380,   428,   368,   367,   348,   103,
+       0,    38,     0,    93,     0,     0,   121,     0,     0,    35,
+     321,   410,   411,   440,     0,     0,     0,     0,     0,     0,
+     104,     0,     0,   210,   186,   194,     0,   195,   192,   191,
+     190,   193,     0,   185,    78,   154,   158,     0,     0,   184,
      188,     0,     0,     0,   287,     0,   129,     0,   128,   384,
-       0,     0,   377,     0,   289,   101,     0,    27,    98,    55,
-      54,     0,     0,     0,     0,   120,     0,     0,   111,   112,
+       0,     0,   377,     0,   101,     0,    27,    98,    55,    54,
+       0,     0,     0,   120,     0,   289,     0,     0,   111,   112,
       27,   106,   105,     0,   114,    76,     0,     0,   162,   198,
        0,    71,   189,     0,   157,    27,     0,   296,     0,    27,
-     130,     0,   127,   382,   383,   379,   366,    27,    27,    96,
-      39,     0,     0,    27,     0,     0,   107,    27,   110,     0,
+     130,     0,   127,   382,   383,   379,   366,    27,    96,    39,
+       0,    27,     0,     0,     0,    27,   107,    27,   110,     0,
        0,     0,   166,   164,   161,     0,     0,   156,     0,     0,
-       0,   297,     0,   293,     0,     0,   132,     0,     0,     0,
-       0,   122,    36,     0,   109,    27,   201,   163,     5,     0,
+       0,   297,     0,   293,     0,     0,   132,     0,     0,   122,
+       0,    36,     0,     0,   109,    27,   201,   163,     5,     0,
      167,   168,     0,     0,   176,     0,     0,   199,   196,     0,
-       0,    74,     0,   294,   288,   131,   290,     0,    99,     0,
-     116,     0,   165,   169,   170,   180,     0,   171,     0,     0,
+       0,    74,     0,   294,   288,   131,     0,    99,     0,   116,
+     290,     0,   165,   169,   170,   180,     0,   171,     0,     0,
      133,   200,   295,    97,    27,    62,     0,   179,   172,   173,
      177,   197,     0,   118,     0,    58,    61,    63,   178,     0,
      159,     0,    64,   174,     0,     0,    27,   182,   160,     0,
        0,     0,   183,    27,     0,    65
 };
 
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -733,  -733,  -310,    18,  -733,  -733,  -733,  -733,   446,  -733,
+    -205,  -733,     4,  -733,  -733,  -733,   -92,  -733,   299,     2,
+       5,  -117,  -733,  -733,  -733,  -733,  -733,  -733,  -733,  -733,
+    -733,  -733,   279,   229,   153,  -733,    96,  -733,  -733,  -733,
+    -567,    37,  -733,  -733,  -733,  -733,  -733,  -508,  -733,   185,
+    -281,  -733,  -733,   508,  -733,   129,  -733,  -733,  -733,  -733,
+    -733,  -733,  -733,   -32,  -733,  -733,  -733,  -733,  -733,  -733,
+    -733,  -733,  -733,  -733,  -732,  -733,  -733,  -733,  -465,  -733,
+     304,  -733,  -733,  -733,   754,   -42,  -733,  -733,    -2,   149,
+    -733,  -733,  -733,  -733,   285,  -374,  -239,  -733,  -733,  -733,
+    -733,  -733,   190,   884,   591,  -733,  -733,   262,   261,  -733,
+     952,   680,  -422,    95,  1110,  -733,  -733,  -733,  -500,  -733,
+    -733,   223,  -230,  -733,    76,  -733,  -733,   -45,   -29,  -733,
+    -262,  -436,  -733,   119,   -39,   352,   354,   715,  -733,   248,
+     391,  -733,  -733,  -733,  -733,  -733,  -733,  -733,  -733
+};
+
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,     2,    82,    83,   504,   343,   212,   213,    84,
+       0,     1,     2,    82,    83,   493,   329,   212,   213,    84,
      215,   372,   373,    86,   905,   906,   907,   362,   363,   374,
      375,   231,    89,   762,    90,   632,   541,    91,   385,    92,
-     387,   538,   539,   674,   596,   820,   779,   590,   316,   613,
-     686,   790,   620,   678,   730,   733,   783,   545,   546,   547,
-     439,   440,   183,   184,   164,   698,   755,   914,   756,   797,
+     387,   538,   539,   668,   590,   819,   778,   584,   299,   613,
+     686,   790,   620,   672,   726,   729,   782,   545,   546,   547,
+     439,   440,   160,   161,   201,   698,   755,   914,   756,   797,
      834,   859,   860,   861,   862,   898,   863,   864,   865,   896,
-     918,   757,   758,   759,   760,   800,   761,   174,   323,   324,
-     525,   526,   527,   528,    93,    94,   809,   817,   123,   701,
-     808,    96,   382,   505,    97,   548,   155,   156,   571,   657,
-     178,   219,   303,    98,   576,   477,    99,   577,   298,   578,
-     100,   101,   293,   102,   103,   278,   714,   772,   529,   651,
+     918,   757,   758,   759,   760,   800,   761,   149,   307,   308,
+     525,   526,   527,   528,    93,    94,   809,   825,   118,   701,
+     808,    96,   382,   502,    97,   548,   178,   179,   603,   678,
+     154,   219,   336,    98,   572,   467,    99,   573,   289,   574,
+     100,   101,   284,   102,   103,   278,   714,   772,   529,   651,
      652,   653,   104,   105,   106,   107,   108,   109,   110,   111,
-     391,   462,   463,   464,   112,   340,   341,   148,   149,   203,
-     204,   512,   113,   119,   118,   116,   115,   337,   114
-};
-
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -736
-static const yytype_int16 yypact[] =
-{
-    -736,   109,  1961,  -736,  -736,  -736,    -6,  -736,  -736,  6554,
-    6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
-    6554,   528,   528,  6554,  5041,  6554,   544,    74,   122,   -31,
-      58,  5167,  -736,  -736,   118,  -736,  5293,   135,  -736,  -736,
-    4887,  6554,   174,   183,  -736,   198,   200,  -736,  -736,   -38,
-     137,   205,   210,  -736,  -736,   215,  -736,   217,  -736,  -736,
-     -29,  -736,   227,  5419,   195,   349,  -736,   229,  6554,  -736,
-    -736,   239,   254,   -46,  -736,   255,  -736,  6554,  -736,   157,
-     241,   354,   -50,  -736,    13,  -736,  -736,  -736,  -736,  -736,
-    -736,   273,   274,  -736,  -736,   391,   362,   292,  -736,  -736,
-    6813,  -736,   285,  1563,   281,  -736,   301,   382,   310,  -736,
-       9,  -736,    47,  -736,  -736,  6554,  6554,  6554,  6554,  6554,
-     339,   326,  -736,   391,  1793,  -736,  -736,   406,  -736,  -736,
-    -736,  -736,  -736,  -736,  -736,  -736,  -736,   329,   227,    76,
-     325,  -736,  -736,   327,  -736,  -736,   528,  7611,   304,   451,
-    -736,   338,   227,   348,   334,   331,  -736,   344,   350,    51,
-      47,  -736,  -736,   472,    14,   391,  5041,  -736,  6854,   476,
-    -736,  6895,   355,   351,    15,  7736,   528,  5545,  -736,  6554,
-    6554,  -736,   142,    17,  -736,   343,   345,  6554,   528,   358,
-     227,  -736,    90,   -37,  -736,   361,  7736,   744,   528,  6680,
-     353,  -736,    19,   316,  -736,  -736,  6554,  6940,  -736,   528,
-     227,   -43,    18,  -736,  6554,  2115,   364,  6981,   218,   363,
-     380,  6554,   218,   149,   385,  -736,   388,  -736,   428,   429,
-    -736,    61,  6554,   272,  6554,  6554,  6554,  5672,  6554,  6554,
-    6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,
-    6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,  6554,   544,
-    -736,  -736,  -736,  5798,  6554,  6554,  6554,  6554,  6554,  6554,
-    6554,  6554,  6554,  6554,  6554,  5924,   374,  6554,   408,  6554,
-    6554,   241,    45,  7736,  7736,  7022,  7736,  7736,   394,   227,
-      80,   379,   379,  -736,  -736,  6050,  -736,  6176,  -736,   227,
-     348,    87,  5924,  -736,    87,   379,    10,  1385,   396,  -736,
-     397,   398,  -736,  1385,  -736,   536,    24,   403,  6554,  -736,
-     401,  -736,  7067,   410,   547,  7736,   493,  1256,  6554,  -736,
-    -736,   -38,  -736,  -736,   415,  7109,  -736,    25,   419,  -736,
-      27,  -736,   -35,  -736,  -736,  -736,  -736,  -736,  -736,   421,
-     512,  7361,  -736,  -736,   -57,   439,  -736,  -736,  -736,  7150,
-    -736,  2269,    29,  -736,  -736,    70,   440,   -46,  -736,  7193,
-     427,  -736,  -736,  -736,  -736,  -736,    93,  -736,  -736,  7402,
-    -736,  -736,  5924,   567,   192,   466,   192,  -736,   434,   133,
-    7736,   430,   443,  6554,   444,    10,   447,    47,  7776,  7813,
-    1793,  6554,  7695,  2100,  2253,  2406,  2559,  1645,  2712,  2712,
-    2712,  2712,  1360,  1255,  1255,  1255,   585,   585,   367,   367,
-     367,   406,   406,   406,  -736,   212,  1793,  1793,  1793,  1793,
-    1793,  1793,  1793,  1793,  1793,  1793,  1793,  1793,   528,   438,
-     591,    30,    36,   443,   450,   453,   454,   379,   457,  7445,
-    -736,   112,  -736,   528,  7736,   528,  7652,   348,  -736,   458,
-    -736,  -736,  -736,    23,  -736,  1385,  1385,  1385,   464,  -736,
-     505,   227,   213,   113,   488,  -736,  -736,  -736,   623,   133,
-    -736,  -736,  1385,   502,  4117,  6554,  7736,  -736,  -736,  6554,
-    6554,   528,    79,  7487,  -736,  -736,  4271,   528,  -736,   358,
-     358,   626,  5924,  1653,  -736,  5924,  -736,  6554,  -736,  -736,
-    -736,  -736,   483,  -736,    42,   564,   528,   492,   510,  -736,
-    -736,  4425,   495,  6554,   379,   518,   102,  -736,  -736,  -736,
-    -736,   499,  1385,   529,   227,   348,  -736,   192,  -736,   652,
-    -736,   516,   133,  -736,  -736,   514,   659,    11,  -736,  -736,
-    7528,  5924,  5924,    10,  1947,  6554,   544,  -736,  -736,  -736,
-    6302,  5924,  5924,  -736,   520,  -736,  -736,  -736,  -736,  6428,
-    -736,   546,  6554,  6554,  -736,  -736,   582,   524,   676,  1385,
-     227,   125,   583,   553,  1385,   539,  -736,   679,  -736,  -736,
-    -736,  7235,   540,  7736,   599,   528,   599,  -736,  -736,  -736,
-    -736,  -736,    31,  -736,  6554,   549,  -736,  1807,   551,    94,
-    -736,   543,   545,  -736,   555,  -736,  -736,  -736,  -736,  -736,
-    -736,   554,   563,   520,  -736,  6554,   518,  -736,  -736,   227,
-     348,   652,   559,   192,  -736,   552,   568,   253,   565,   709,
-    -736,   571,   572,  1947,   331,   528,    33,   378,   573,   575,
-    5924,   667,   669,  -736,   528,  7736,   379,  -736,   574,  7569,
-    1385,  -736,  1385,  -736,   580,   154,  -736,  -736,   568,  1385,
-    2423,   584,  6554,    79,   581,  -736,   587,  3963,   290,  -736,
-    1793,  -736,  -736,  -736,   586,  -736,   232,  -736,    -4,   192,
-    2577,  -736,  -736,  -736,   588,   348,  -736,  -736,   302,  -736,
-     589,   592,    16,   729,  1385,  -736,  -736,  -736,  -736,  -736,
-    -736,   594,  6554,  6554,  -736,  -736,  -736,  -736,  -736,  -736,
-     651,  -736,   600,  -736,   590,  -736,   598,  -736,  4579,  4579,
-     318,   601,  4887,  -736,  -736,   233,  6554,     3,   616,   121,
-    -736,   607,   617,  -736,   402,  -736,  -736,  -736,  -736,  -736,
-    -736,   618,   192,  -736,  -736,  -736,  -736,   627,   339,   490,
-    -736,    20,   625,    34,  -736,   629,   759,  1385,  -736,  -736,
-     619,   620,   518,  1385,  -736,  -736,  4733,  -736,  -736,  -736,
-    -736,   628,   752,   715,  6554,  -736,   630,  1019,  -736,  -736,
-    -736,  -736,  -736,   632,  -736,  -736,   772,    12,  -736,   774,
-      22,   391,  -736,   653,  -736,  -736,   644,  -736,    37,  -736,
-     778,  1385,  -736,  -736,  -736,  -736,  -736,  -736,  -736,  -736,
-    -736,  2731,  6554,  -736,   640,  7276,  -736,  -736,  3963,   645,
-    1385,   192,   224,  -736,  -736,  1385,   650,  -736,   661,   787,
-    2885,  -736,    44,  -736,  3039,  1385,  -736,  3193,  3347,   648,
-    7319,  3963,  -736,  4887,  3963,  -736,  -736,  -736,   724,   654,
-     224,  -736,   655,   731,   687,   656,   677,  -736,   798,   663,
-    1385,  -736,   666,  -736,  -736,  -736,  -736,   662,  -736,   790,
-    -736,  3501,  -736,  -736,  -736,   647,   192,  -736,   681,  1385,
-     133,  -736,  -736,  -736,  -736,   739,   684,   685,   814,  -736,
-    -736,  -736,   671,  3963,   673,  -736,   739,  -736,  -736,   192,
-    -736,   192,  -736,  -736,   178,   682,  -736,  -736,  -736,   675,
-    3655,   680,  -736,  -736,  3809,  -736
-};
-
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
-{
-    -736,  -736,  -330,    40,  -736,  -736,  -736,  -736,   465,  -736,
-    -168,  -736,     6,  -736,  -736,  -736,   -81,  -736,   315,     0,
-       5,  -122,  -736,  -736,  -736,  -736,  -736,  -736,  -736,  -736,
-    -736,  -736,   296,   238,   162,  -736,   107,  -736,  -736,  -736,
-    -425,    50,  -736,  -736,  -736,  -736,  -736,  -473,  -736,   202,
-    -285,  -736,  -736,   509,  -736,   145,  -736,  -736,  -736,  -736,
-    -736,  -736,  -736,   -17,  -736,  -736,  -736,  -736,  -736,  -736,
-    -736,  -736,  -736,  -736,  -735,  -736,  -736,  -736,  -477,  -736,
-     321,  -736,  -736,  -736,   767,   101,  -736,  -736,    -2,   180,
-    -736,  -736,  -736,  -736,   126,  -368,  -255,  -736,  -736,  -736,
-    -736,  -736,   206,   781,   785,  -736,  -736,   275,   277,  -736,
-     963,   674,  -419,    66,   921,  -736,  -736,  -736,  -515,  -736,
-    -736,   230,  -228,  -736,   895,  -736,  -736,   -23,    41,  -736,
-    -268,  -432,  -736,    86,   -12,   359,   357,   694,  -736,   228,
-     366,  -736,  -736,  -736,  -736,  -736,  -736,  -736,  -736
+     391,   499,   500,   501,   112,   326,   327,   126,   127,   198,
+     199,   509,   113,   166,   167,   187,   188,   323,   114
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -414
 static const yytype_int16 yytable[] =
 {
-      95,   288,    87,   158,   424,   394,   585,    88,    85,   446,
-     624,   448,   592,   503,   160,   564,   536,   459,   540,   558,
-     831,   226,   308,   318,   802,   331,   367,   165,   803,   788,
-     836,   366,   483,   497,   567,   500,   568,   516,  -139,   500,
-     361,  -142,   638,   310,  -140,   842,   173,   765,   444,   263,
-     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   139,   139,   394,   444,   806,   153,   159,   611,   635,
-     279,   279,   509,   458,   736,   872,   460,   461,   224,   510,
-     354,    48,   210,  -309,   572,   224,   737,   141,   144,   511,
-     122,   224,   623,   224,  -374,  -374,  -311,   531,  -310,   190,
-     192,   225,   193,   234,   235,   236,   279,   122,   181,     3,
-     595,   624,   279,   211,   346,   163,   502,   182,   165,   237,
-     191,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,  -392,   259,   518,   117,   740,   140,   140,   355,
-     897,   136,   154,   282,   523,   161,   789,   639,   280,   280,
-    -388,   832,   766,   625,   195,   833,   227,   309,   319,   540,
-     332,   368,   573,   804,   607,   837,   484,   498,   290,   501,
-     807,   517,  -139,   679,  -392,  -142,   139,   688,  -140,   843,
-     873,   612,   300,    74,   280,   726,  -389,   388,   224,   736,
-     280,   306,   281,   162,   224,   137,   543,   138,   224,   166,
-     544,   737,   389,    95,   136,   122,   139,   605,   224,   461,
-     608,   397,   139,   524,   716,    74,   708,   225,   139,   139,
-     342,   346,   524,    74,    80,   715,   158,   198,   139,   344,
-     224,   224,    80,   345,   199,   198,  -309,   160,   356,   139,
-     365,   684,   199,   224,   169,   622,   218,   815,  -311,   533,
-     735,   534,   739,   502,   397,   697,   641,   642,   137,   122,
-     138,   792,   140,   185,   395,   556,   648,   649,   122,   397,
-     397,   326,   224,   198,   136,  -124,   172,  -310,    74,   397,
-     199,   328,   397,   397,   200,   202,   461,    80,   201,   153,
-     159,   644,   140,   202,   658,   380,   198,   220,   140,   223,
-     736,   736,   582,   199,   140,   140,   201,   395,   533,   396,
-     534,   741,   737,   737,   140,   176,   543,   916,   122,   451,
-     544,   917,   395,   395,   177,   140,   738,   786,   137,   457,
-     138,   202,   395,   261,   262,   395,   395,   473,   122,   179,
-     533,   180,   534,   473,   731,   732,   186,   694,    74,    95,
-     858,   187,   445,   122,   202,   711,   188,    80,   189,   745,
-     746,   747,   748,   749,   750,   205,   441,   396,   445,   533,
-     206,   534,   781,   782,   798,   154,  -143,   751,   208,   122,
-     221,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   441,   198,   209,   214,   211,   392,   228,
-     229,   199,   256,   257,   258,   356,   259,   902,    74,   357,
-     670,   393,   230,   232,   535,   233,   535,    80,   461,   535,
-     136,   677,   275,   474,   276,   397,  -374,  -374,   553,   474,
-    -375,   198,   198,   277,   770,   771,   752,   753,   199,   199,
-     690,    48,   754,   222,   190,   259,   352,   289,   291,   297,
-     292,   296,   202,   857,   866,   139,   299,   301,   198,   745,
-     746,   747,   748,   749,   750,   199,   224,   304,   139,   356,
-     305,   338,   302,   441,   137,   307,   138,   751,   395,   313,
-     589,   315,   866,   139,   122,   139,   333,   334,   317,   202,
-     202,    95,   600,    87,    74,   473,   473,   473,    88,    85,
-     443,   581,   397,    80,   347,   452,   376,   378,   899,   535,
-      74,   381,   473,   393,   383,    74,   202,   619,   393,    80,
-    -143,   139,   139,   158,    80,   384,   386,   139,   447,   139,
-     139,   913,   478,   915,   160,   389,   752,   753,   479,   482,
-     480,   140,   795,   487,   485,   490,   139,   745,   746,   747,
-     748,   749,   750,   489,   140,   395,   353,   491,   495,   358,
-     499,   506,   473,   507,   630,   513,   519,   535,   522,   140,
-     532,   140,   535,   537,   353,   542,   358,   549,   353,   358,
-     559,   474,   474,   474,  -413,   551,   153,   159,   552,   560,
-     136,   561,  -187,   441,   562,    95,   441,    87,   474,   821,
-     570,   563,    88,    85,   565,   579,   136,   140,   140,   473,
-     665,   583,   828,   140,   473,   140,   140,   253,   254,   255,
-     256,   257,   258,   580,   259,   139,   584,   840,   587,   604,
-     610,   844,   140,   614,   397,   616,   617,   621,   524,   847,
-     848,   627,   441,   441,   137,   851,   138,   629,   474,   854,
-     633,   646,   441,   441,   122,   634,   636,   637,    95,   695,
-     151,   650,   152,   535,    74,    95,   656,   535,   660,   838,
-     122,   661,   154,    80,   662,   139,   352,   881,    95,   666,
-      74,   668,   669,   672,   139,   673,   685,   395,   687,    80,
-     473,   681,   473,   683,   699,   474,   689,   691,   696,   473,
-     474,   703,   700,   139,   745,   746,   747,   748,   749,   750,
-     692,   140,   704,   705,   706,   709,   903,   710,   712,   535,
-     713,   717,   721,   728,   778,   778,   734,   725,   785,   729,
-     763,   764,   767,   775,   473,   743,   769,   773,   920,   774,
-     776,   441,   784,   793,   796,   924,   801,   263,   264,   265,
-     266,   267,   268,   269,   270,   271,   272,   273,   274,   791,
-     794,   140,   811,   799,   805,   810,   813,   814,   823,   822,
-     140,   824,   819,   826,   829,   830,   474,   835,   474,   839,
-     841,   845,   535,   852,   855,   474,   868,   869,  -175,   140,
-     870,   878,  -374,  -374,   882,   885,   886,   473,   884,   887,
-     888,   889,   892,   473,   890,   893,   894,   900,   904,    95,
-     908,  -181,   909,   910,   911,   912,    95,   921,   919,   923,
-     474,   615,   520,   631,   676,   727,   780,   827,    95,   702,
-     494,   744,    95,   883,   216,    95,    95,   626,   722,    95,
-     707,   473,    95,   693,   664,   663,   329,   603,   602,   880,
-     311,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     473,   535,   535,     0,     0,   473,     0,     0,     0,    95,
-       0,     0,     0,     0,     0,   473,     0,     0,     0,     0,
-       0,     0,     0,   474,     0,     0,     0,   348,     0,   474,
-     535,    95,     0,     0,     0,     0,     0,     0,     0,     0,
-     473,     0,     0,     0,     0,     0,   143,   143,    95,     0,
-       0,   157,    95,     0,     0,     0,   535,     0,     0,   473,
-     535,     0,     0,     0,     0,     0,     0,   474,     0,     0,
-       0,     0,   142,   142,     0,     0,     0,     0,     0,   535,
-       0,   535,     0,     0,     0,     0,   474,     0,     0,     0,
-       0,   474,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   474,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,   197,     0,   145,   147,   150,     0,
-       0,     0,     0,     0,   168,     0,   474,     0,     0,   171,
-       0,     0,     0,     0,   175,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   474,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   196,     0,   234,   235,
-     236,   207,     0,     0,     0,     0,     0,     0,     0,     0,
-     217,   143,     0,     0,   237,   788,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   294,   259,     0,
-       0,   143,     0,     0,     0,     0,     0,   143,   283,   284,
-     285,   286,   287,   143,   143,     0,     0,     0,   475,     0,
-       0,     0,   476,   143,   475,     0,     0,   320,   481,     0,
-       0,   327,     0,   330,   143,     0,     0,     0,     0,   336,
-     339,     0,     0,     0,     0,     0,     0,     0,     0,   349,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   147,
-     364,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     322,     0,   325,   196,     0,     0,     0,     0,     0,     0,
-     335,     0,     0,     0,   157,     0,     0,     0,     0,     0,
-       0,     0,   351,     0,     0,     0,     0,     0,     0,   359,
-       0,     0,   789,     0,     0,     0,     0,   369,     0,     0,
-       0,     0,     0,     0,   379,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   390,   442,   398,   399,   400,
-     402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
-     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
-     422,   423,     0,   442,     0,     0,   426,   427,   428,   429,
-     430,   431,   432,   433,   434,   435,   436,   437,   196,     0,
-     390,     0,   390,   449,     0,     0,   475,   475,   475,     0,
-     574,   575,     0,     0,     0,     0,     0,     0,   454,     0,
-     456,     0,     0,   475,     0,   196,     0,   586,     0,   263,
-     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   486,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   493,  -414,  -414,  -414,   251,   252,   253,   254,   255,
-     256,   257,   258,   442,   259,     0,     0,     0,     0,     0,
-       0,     0,     0,   475,  -374,  -374,     0,   628,     0,     0,
-     143,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     492,     0,     0,   143,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   196,   557,     0,   143,     0,
-     143,     0,     0,     0,     0,     0,   550,     0,     0,   294,
-     475,     0,     0,     0,   554,   475,     0,     0,     0,   667,
-       0,     0,     0,     0,   294,     0,   294,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   143,   143,     0,     0,
-       0,     0,   143,     0,   143,   143,  -414,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,   143,   594,   597,     0,     0,     0,     0,   601,     0,
-     339,   339,     0,   442,     0,     0,   442,   465,   466,     0,
-       0,     0,     0,     0,     0,     0,     0,   364,     0,     0,
-       0,   475,     0,   475,     0,   719,   467,   720,   591,     0,
-     475,   157,   325,   593,   723,     0,     0,   136,   468,     0,
-       0,     0,     0,     0,     0,   196,     0,   469,   196,     0,
-     609,    35,   442,   442,     0,     0,    38,    39,     0,     0,
-       0,   647,   442,   442,     0,   475,   390,     0,     0,   768,
-     143,     0,     0,    44,     0,     0,    47,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    56,     0,    58,
-      59,   470,    61,   471,   196,   196,   675,     0,   643,     0,
-     472,   122,     0,   196,   196,   196,    70,     0,     0,     0,
-       0,     0,   655,     0,     0,   390,   659,     0,     0,     0,
-     143,     0,     0,     0,     0,     0,     0,     0,   475,   143,
-       0,     0,   812,     0,   475,     0,     0,     0,   816,     0,
-       0,     0,     0,     0,     0,     0,   294,   680,   143,     0,
-       0,   442,     0,     0,     0,   294,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   390,     0,
-       0,     0,   475,     0,   597,     0,   846,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   475,     0,   196,     0,   856,   475,     0,     0,     0,
-     867,  -374,  -374,     0,     0,     0,   475,     0,     0,     0,
-     875,     0,     0,     0,     0,   325,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   475,     0,     0,     0,   891,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-     475,     0,     0,     0,   901,   390,   390,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,    10,    11,     0,     0,   787,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,    34,    35,
-      36,     0,    37,     0,    38,    39,    40,   825,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,     0,     0,     0,   850,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,     0,    74,
-      75,     0,    76,   606,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,   237,     9,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,    34,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,     0,    74,    75,     0,    76,   682,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,    34,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,     0,    74,    75,     0,
-      76,     0,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     370,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   121,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   371,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   370,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   121,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,   515,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,   724,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,   370,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,   121,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,   742,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,   370,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,   121,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,  -414,  -414,  -414,  -414,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,   849,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,   370,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,   121,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,     0,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     370,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   121,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   871,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   370,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   121,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,   874,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,   370,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,   121,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,   876,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,    27,    28,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,    32,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,   877,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,   370,    52,     0,    53,     0,    54,    55,    56,
-      57,    58,    59,   121,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,    27,    28,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,    32,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,   370,    52,     0,    53,
-       0,    54,    55,    56,    57,    58,    59,   121,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,   895,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+      95,   283,   361,   394,    87,   610,    85,    88,   181,   413,
+     536,   564,   540,   586,   183,   446,   558,   448,   190,   492,
+     831,   788,   226,   301,   182,   624,   315,   802,   567,   147,
+     568,   356,   367,   279,   635,   803,   836,   611,   745,   141,
+     129,   471,   486,   489,    36,   688,   444,   516,  -139,   489,
+    -142,   279,   193,   842,   496,   224,   604,   736,   224,   141,
+     202,   194,   366,   350,   210,   324,   394,   444,   218,   523,
+     173,   176,   737,   184,   138,     3,   638,   139,   765,   806,
+     872,   171,   158,   282,   224,   358,   117,   224,   623,   747,
+     128,   211,   159,  -187,   279,   225,   330,   145,   140,   117,
+     331,   531,   625,   117,   495,   388,   589,   497,   498,   916,
+     279,    74,   200,   917,   202,   310,   143,   145,   735,   172,
+     739,    80,    74,   389,   340,   193,   624,   491,   135,   180,
+    -392,   736,   281,   518,   194,   146,   165,   748,   749,   750,
+     578,   195,   141,   151,   196,   196,   737,   224,   751,   193,
+     193,   193,   197,   897,   339,   745,   351,   295,   194,   194,
+     194,   280,   524,   540,   152,   352,   832,   352,   789,   141,
+     833,   353,   227,   302,   740,   746,   316,   141,   153,   280,
+     612,   357,   368,   601,   605,   804,   837,   141,   141,   328,
+     472,   487,   490,   333,   397,   524,   517,  -139,   673,  -142,
+     145,   722,   843,   181,   395,   138,   747,  -392,   139,   183,
+     599,   141,   639,    95,   766,   807,   873,   498,   224,   182,
+     155,   606,   280,   708,  -389,   197,   141,   145,   365,   140,
+     117,   745,   715,   441,   156,   145,   543,   397,   280,   157,
+    -388,   730,    74,   162,   544,   145,   145,   395,   792,   197,
+     197,   197,    80,   193,   748,   749,   750,   397,   397,   697,
+     380,   622,   194,   261,   163,   751,   176,   395,   395,   145,
+     641,   642,   815,   348,   727,   728,   752,   753,   780,   781,
+     648,   649,   747,   754,   145,  -414,   240,   241,   242,   243,
+     244,   245,   506,   441,   498,   397,  -140,   263,   397,   397,
+     262,    74,   243,   244,   245,   395,   142,   224,   395,   395,
+     463,    80,   468,   507,  -309,   741,   264,   644,   164,   169,
+     533,   224,   736,   534,   180,   508,   142,   220,  -309,   223,
+     748,   749,   750,   138,   265,   193,   139,   737,   177,  -374,
+     441,   751,   679,   266,   194,   117,   193,   225,   170,   203,
+     494,   222,   396,   197,   117,   194,   738,   140,   117,    95,
+     224,   248,   352,   694,  -124,   224,  -414,  -311,   553,   711,
+      74,  -414,  -311,   463,   248,   543,  -374,   664,   798,   224,
+      80,   533,   902,   544,   534,   211,  -310,   205,   671,   240,
+     241,   242,   243,   244,   245,   445,   207,   208,   267,   268,
+     269,   258,   535,   259,   535,   340,   117,   535,   397,   142,
+     270,   214,   271,   690,   533,   396,   445,   534,   395,   491,
+     221,   272,   230,   273,   228,   229,  -414,   239,   240,   241,
+     242,   243,   244,   245,   233,   197,   142,   736,   232,   858,
+     276,   274,  -375,   141,   142,  -140,   197,   498,   275,   441,
+     770,   771,   737,   277,   142,   142,   141,   857,   866,   533,
+     441,   171,   534,    36,   248,   392,   248,   287,   141,   288,
+     141,   786,   292,   463,   463,   463,   583,    74,   142,   577,
+     294,   393,   296,   297,   117,   397,   866,    80,   463,   594,
+      95,   298,   300,   142,    87,   395,    85,    88,   141,   141,
+     317,   145,   334,   248,   141,   318,   141,   141,   250,   441,
+     441,   181,   899,   254,   145,   337,   224,   183,   646,   441,
+     441,   332,   224,  -310,   745,   619,   145,   182,   145,   138,
+     355,   535,   139,   177,   141,   913,   335,   915,   338,   381,
+     343,   376,   378,   258,   746,   259,   384,   443,   383,   386,
+     463,   447,   630,   140,   117,   535,   145,   145,   389,    74,
+     535,   454,   145,   393,   145,   145,    74,   470,   469,    80,
+     312,   820,   475,   473,   176,   747,    80,   464,   478,   479,
+      74,   480,   484,   503,   393,   828,   349,   488,   504,   354,
+      80,   510,   145,   463,   661,   512,   513,   519,   522,    95,
+     840,   532,   537,    87,   844,    85,    88,   141,   441,   349,
+     542,   354,   847,   349,   354,   559,   849,   549,  -413,   560,
+     853,   551,   854,   748,   749,   750,   563,   463,   552,   565,
+     561,   562,   180,   575,   751,   576,   138,   556,   397,   139,
+     464,   579,   581,   598,   602,   752,   753,   695,   395,   609,
+     881,   535,   795,   174,   608,   535,   175,   614,   616,   621,
+     140,   117,    95,   141,   617,   145,   524,   627,   629,    95,
+     633,   634,   141,    74,   463,   637,   463,   140,   117,   636,
+     650,   463,   656,    80,   838,   141,   658,   657,    95,   903,
+      74,   348,   662,   663,   666,   667,   675,   677,   681,   684,
+      80,   685,   687,   691,   689,   696,   699,   535,   692,   700,
+     142,   920,   704,   703,   705,   712,   706,   709,   924,   713,
+     733,   145,   463,   142,   710,   718,   731,   721,   777,   777,
+     145,   783,   724,   725,   743,   142,   763,   142,   764,   767,
+     464,   464,   464,   145,   769,   773,   774,   775,   785,   784,
+     793,   796,   799,   791,   794,   464,   801,   805,   810,   811,
+     813,   814,   821,   822,   826,   142,   142,   823,   830,   829,
+     535,   142,   835,   142,   142,   839,   841,   845,   851,   818,
+     868,   855,   869,   870,  -175,   463,   877,   882,   885,  -143,
+     263,   463,   886,   888,   884,   889,   887,   890,   892,   894,
+     893,   142,   900,   904,   908,   909,  -181,   910,   911,   264,
+     919,   921,   923,   520,   912,   615,   631,   464,    95,   670,
+     723,   779,   702,   483,   827,   744,    95,   265,   883,   463,
+     626,   216,  -374,   734,   707,   659,   266,   660,    95,   313,
+     596,   177,    95,   597,   290,    95,   693,    95,   463,   535,
+     535,    95,    95,   463,     0,     0,   879,     0,     0,     0,
+     464,     0,     0,   463,     0,     0,     0,     0,     0,  -374,
+       0,     0,     0,     0,   142,     0,     0,     0,   535,    95,
+       0,     0,     0,   466,     0,     0,     0,     0,   463,     0,
+       0,   267,   268,   269,   464,     0,     0,     0,     0,     0,
+       0,    95,     0,   270,   535,   271,     0,   463,   535,     0,
+       0,     0,     0,     0,   272,     0,   273,     0,    95,     0,
+       0,     0,    95,     0,     0,   263,     0,   535,     0,   535,
+     142,     0,     0,     0,   274,     0,     0,     0,  -143,   142,
+       0,   464,     0,   464,   264,     0,   511,     0,   464,     0,
+       0,     0,   142,     0,     0,     0,   119,   120,   121,   122,
+     123,   125,   265,     0,   130,   131,   133,  -374,     0,   134,
+       0,   266,   137,     0,     0,     0,     0,     0,   148,   150,
+       0,     0,     0,     0,     0,     0,     0,     0,   263,   464,
+       0,     0,     0,     0,     0,     0,     0,   168,     0,     0,
+       0,     0,     0,     0,  -374,     0,     0,   264,   185,   186,
+     481,     0,   191,     0,     0,     0,   204,     0,     0,   206,
+       0,     0,     0,     0,   209,   265,   267,   268,   269,   217,
+    -374,     0,     0,     0,   266,     0,     0,     0,   270,     0,
+     271,     0,     0,     0,     0,     0,   570,   571,     0,   272,
+       0,   273,   464,     0,     0,     0,     0,     0,   464,     0,
+       0,   580,     0,     0,     0,     0,     0,  -374,     0,   274,
+       0,     0,     0,     0,   344,     0,     0,     0,     0,     0,
+       0,   125,     0,     0,     0,     0,     0,     0,     0,   267,
+     268,   269,     0,     0,     0,     0,   464,     0,     0,     0,
+       0,   270,     0,   271,   304,   306,     0,     0,   309,   191,
+       0,     0,   272,     0,   273,   464,   319,     0,   320,   321,
+     464,     0,     0,   628,     0,     0,     0,     0,     0,     0,
+     464,   144,   274,     0,     0,     0,     0,     0,     0,   341,
+     342,     0,     0,     0,     0,     0,   347,     0,     0,     0,
+       0,   144,     0,     0,     0,   464,     0,   359,     0,     0,
+       0,     0,     0,     0,     0,     0,   369,     0,     0,     0,
+     192,     0,     0,   379,   464,     0,   465,     0,     0,     0,
+       0,     0,     0,     0,   390,     0,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     683,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,     0,     0,     0,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   191,     0,   390,
+       0,   390,   449,     0,   285,     0,     0,     0,   451,   465,
+     453,     0,     0,     0,     0,     0,   263,   716,     0,   717,
+       0,     0,     0,   474,   719,     0,     0,     0,     0,     0,
+       0,   303,     0,     0,   482,   264,     0,   311,     0,   314,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   322,
+     325,     0,     0,   265,     0,     0,     0,   191,  -374,     0,
+       0,     0,   266,     0,     0,   768,     0,     0,     0,     0,
+       0,     0,     0,   345,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   364,     0,
+       0,     0,     0,     0,     0,  -374,     0,     0,     0,     0,
+       0,     0,     0,     0,   191,     0,     0,     0,     0,   465,
+     465,   465,     0,     0,     0,   550,     0,   267,   268,   269,
+     554,     0,     0,     0,   465,     0,     0,     0,   812,   270,
+       0,   271,     0,     0,   816,     0,     0,     0,     0,     0,
+     272,     0,   273,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   442,     0,     0,     0,     0,
+     274,     0,     0,     0,     0,     0,     0,     0,   455,   456,
+       0,     0,   846,     0,     0,     0,     0,   457,     0,     0,
+     458,     0,     0,     0,     0,     0,   465,     0,     0,     0,
+       0,   856,     0,   459,     0,   585,   867,     0,     0,    19,
+     309,   587,     0,     0,     0,    23,   875,    24,     0,     0,
+       0,     0,     0,   191,     0,   442,   238,   239,   240,   241,
+     242,   243,   244,   245,   191,     0,   607,     0,    31,   465,
+       0,   891,    35,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   390,     0,     0,     0,     0,
+     901,     0,     0,     0,    48,     0,    50,     0,     0,     0,
+      51,     0,   442,   465,   460,     0,    54,   461,     0,     0,
+       0,     0,     0,   191,   191,     0,     0,   643,     0,     0,
+       0,     0,   191,   191,   191,     0,     0,   462,   140,   117,
+       0,   655,     0,   248,     0,    69,     0,   249,   250,   251,
+     252,   253,     0,   254,     0,   557,     0,     0,     0,     0,
+     465,     0,   465,     0,     0,     0,     0,   465,   285,     0,
+     674,     0,     0,     0,     0,     0,   390,   680,     0,     0,
+     285,     0,   285,   258,     0,   259,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   390,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   465,     0,
+     588,   591,     0,     0,     0,     0,   595,     0,   325,   325,
+       0,   442,   191,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   442,     0,     0,     0,     0,     0,   309,     0,
+       0,     0,     0,     0,     0,     0,   364,     0,     0,     0,
+       0,     0,     0,     0,   234,     0,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,     0,     0,     0,
+       0,   465,     0,     0,     0,     0,     0,   465,   246,   247,
+       0,   442,   442,     0,   390,   390,     0,     0,     0,     0,
+     647,   442,   442,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   787,     0,
+       0,     0,     0,     0,     0,   465,     0,     0,     0,   669,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   465,     0,   248,     0,     0,   465,
+     249,   250,   251,   252,   253,     0,   254,     0,     0,   465,
+     255,   256,   257,     0,     0,     0,   824,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,    32,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-     370,    52,     0,    53,     0,    54,    55,    56,    57,    58,
-      59,   121,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,   922,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   465,   285,   258,     0,   259,     0,
+     442,     0,     0,     0,   285,     0,     0,     0,     0,   582,
+       0,     0,     0,   465,   850,     4,     5,   591,     0,     0,
+       0,     6,     7,     8,     9,     0,   682,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,    33,    34,    35,
+      36,    37,    38,     0,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,     0,    77,   593,    78,    79,    80,    81,
+       0,     4,     5,     0,     0,     0,     0,     6,     7,     8,
+       9,     0,     0,    11,    12,     0,     0,    13,     0,     0,
+      14,     0,     0,     0,     0,     0,    16,    17,     0,     0,
+       0,     0,    19,    20,     0,    21,    22,     0,    23,     0,
+      24,    25,     0,     0,     0,    26,    27,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,    29,    30,
+       0,    31,     0,    33,    34,    35,    36,    37,    38,     0,
+      40,     0,    41,    42,    43,    44,     0,     0,    45,     0,
+       0,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,     0,    51,     0,     0,     0,   115,    53,    54,
+      55,     0,    56,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,    58,    59,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,    65,    66,    67,     0,    69,    70,
+      71,    72,     0,     0,    74,    75,     0,     0,    76,     0,
+      77,   618,    78,    79,    80,    81,     0,     4,     5,     0,
+       0,     0,     0,     6,     7,     8,     9,     0,     0,    11,
+      12,     0,     0,    13,     0,     0,    14,     0,     0,     0,
+       0,     0,    16,    17,     0,     0,     0,     0,    19,    20,
+       0,    21,    22,     0,    23,     0,    24,    25,     0,     0,
+       0,    26,    27,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,    29,    30,     0,    31,     0,    33,
+      34,    35,    36,    37,    38,     0,    40,     0,    41,    42,
+      43,    44,     0,     0,    45,     0,     0,     0,     0,     0,
+       0,    47,     0,    48,    49,    50,     0,     0,     0,    51,
+       0,     0,     0,   115,    53,    54,    55,     0,    56,     0,
+       0,     0,     0,     0,     0,    57,     0,     0,     0,    58,
+      59,    60,     0,     0,     0,     0,    61,    62,    63,    64,
+      65,    66,    67,     0,    69,    70,    71,    72,     0,     0,
+      74,    75,     0,     0,    76,     0,    77,   776,    78,    79,
+      80,    81,     0,     4,     5,     0,     0,     0,     0,     6,
+       7,     8,     9,     0,     0,    11,    12,     0,     0,    13,
+       0,     0,    14,     0,     0,     0,     0,     0,    16,    17,
+       0,     0,     0,     0,    19,    20,     0,    21,    22,     0,
+      23,     0,    24,    25,     0,     0,     0,    26,    27,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,     0,     0,
+      29,    30,     0,    31,     0,    33,    34,    35,    36,    37,
+      38,     0,    40,     0,    41,    42,    43,    44,     0,     0,
+      45,     0,     0,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,     0,     0,     0,    51,     0,     0,     0,   115,
+      53,    54,    55,     0,    56,     0,     0,     0,     0,     0,
+       0,    57,     0,     0,     0,    58,    59,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,    65,    66,    67,     0,
+      69,    70,    71,    72,     0,     0,    74,    75,     0,     0,
+      76,     0,    77,   817,    78,    79,    80,    81,     0,     4,
+       5,     0,     0,     0,     0,     6,     7,     8,     9,     0,
+       0,    11,    12,     0,     0,    13,     0,     0,    14,     0,
+       0,     0,     0,     0,    16,    17,     0,     0,     0,     0,
+      19,    20,     0,    21,    22,     0,    23,     0,    24,    25,
+       0,     0,     0,    26,    27,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,    30,     0,    31,
+       0,    33,    34,    35,    36,    37,    38,     0,    40,     0,
+      41,    42,    43,    44,     0,     0,    45,     0,     0,     0,
+       0,     0,     0,    47,     0,    48,    49,    50,     0,     0,
+       0,    51,     0,     0,     0,   115,    53,    54,    55,     0,
+      56,     0,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,    65,    66,    67,     0,    69,    70,    71,    72,
+       0,     0,    74,    75,     0,     0,    76,     0,    77,   398,
+      78,    79,    80,    81,     0,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   116,   117,    64,    65,     0,
+       0,     0,    69,     0,     0,    72,     0,     0,    74,     0,
+       0,     0,     0,     0,    77,     0,     0,    79,    80,    81,
+     234,   788,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   246,   247,     0,     0,     0,   234,
+       0,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   246,   247,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,    27,
-      28,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-      32,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,   370,    52,     0,    53,     0,    54,
-      55,    56,    57,    58,    59,   121,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,   925,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
+       0,     0,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,     0,   254,     0,     0,     0,   255,   256,   257,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+       0,   254,   258,     0,   259,   255,   256,   257,     0,     0,
+     234,     0,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,     0,     0,     0,     0,     0,   789,     0,
+       0,   258,     0,   259,   246,   247,     0,     0,     0,   234,
+       0,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,     0,     0,     0,     0,     0,   260,     0,     0,
+       0,     0,     0,   246,   247,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,    27,    28,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,    32,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,   370,    52,
-       0,    53,     0,    54,    55,    56,    57,    58,    59,   121,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   588,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,     0,    52,     0,    53,     0,     0,    55,    56,
-      57,    58,    59,   121,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,     0,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   599,     0,     0,
+       0,     0,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,     0,   254,     0,     0,     0,   255,   256,   257,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,     0,     0,    29,    30,     0,     0,    31,     0,     0,
-       0,     0,     0,    33,     0,     0,     0,    35,    36,     0,
-      37,     0,    38,    39,    40,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-      45,    46,    47,    48,    49,    50,     0,    52,     0,    53,
-       0,     0,    55,    56,    57,    58,    59,   121,    61,    62,
-       0,     0,     0,     0,     0,    63,    64,    65,    66,    67,
-      68,     0,    70,    71,    72,     0,     0,    74,    75,     0,
-      76,     0,    77,     0,    78,    79,    80,    81,     4,     5,
-       6,     7,     8,     0,     0,     0,     0,     9,     0,     0,
+       0,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+       0,   254,   258,     0,   259,   255,   256,   257,     0,     0,
+     234,     0,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,     0,     0,     0,     0,     0,   291,     0,
+       0,   258,     0,   259,   246,   247,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   618,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
-       0,    31,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,    36,     0,    37,     0,    38,    39,    40,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,    45,    46,    47,    48,    49,    50,
-       0,    52,     0,    53,     0,     0,    55,    56,    57,    58,
-      59,   121,    61,    62,     0,     0,     0,     0,     0,    63,
-      64,    65,    66,    67,    68,     0,    70,    71,    72,     0,
-       0,    74,    75,     0,    76,     0,    77,     0,    78,    79,
-      80,    81,     4,     5,     6,     7,     8,     0,     0,     0,
-       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   777,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   293,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,    29,    30,     0,     0,    31,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,    36,     0,    37,     0,
-      38,    39,    40,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,    45,    46,
-      47,    48,    49,    50,     0,    52,     0,    53,     0,     0,
-      55,    56,    57,    58,    59,   121,    61,    62,     0,     0,
-       0,     0,     0,    63,    64,    65,    66,    67,    68,     0,
-      70,    71,    72,     0,     0,    74,    75,     0,    76,     0,
-      77,     0,    78,    79,    80,    81,     4,     5,     6,     7,
-       8,     0,     0,     0,     0,     9,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   818,
+       0,     0,     0,     0,     0,   124,     0,     0,     4,     5,
+       0,     0,     0,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,   248,     0,    13,     0,   249,   250,   251,   252,
+     253,     0,   254,    16,    17,     0,   255,   256,   257,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,   258,     0,   259,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,   360,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   425,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   438,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   450,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   452,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   645,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,   654,     0,    77,     4,     5,
+      79,    80,    81,     0,     6,     7,     8,     9,     0,     0,
+      11,    12,     0,     0,    13,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,     0,     0,     0,     0,    19,
+       0,     0,    21,     0,     0,    23,     0,    24,     0,     0,
+       0,     0,    26,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,    30,     0,    31,     0,
+       0,     0,    35,    36,     0,     0,     0,     0,     0,    41,
+      42,    43,     0,     0,     0,    45,     0,     0,     0,     0,
+       0,     0,    47,     0,    48,    49,    50,     0,     0,     0,
+      51,     0,     0,     0,   115,    53,    54,    55,     0,    56,
+       0,     0,     0,     0,     0,     0,    57,     0,     0,     0,
+      58,    59,     0,     0,     0,     0,     0,    61,   116,   117,
+      64,    65,     0,     0,     0,    69,     0,     0,    72,     0,
+       0,    74,     0,     0,     0,     0,     0,    77,     0,     0,
+      79,    80,    81,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,    29,    30,     0,     0,    31,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-      36,     0,    37,     0,    38,    39,    40,     0,     0,     0,
-      41,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,    45,    46,    47,    48,    49,    50,     0,    52,
-       0,    53,     0,     0,    55,    56,    57,    58,    59,   121,
-      61,    62,     0,     0,     0,     0,     0,    63,    64,    65,
-      66,    67,    68,     0,    70,    71,    72,     0,     0,    74,
-      75,     0,    76,     0,    77,     0,    78,    79,    80,    81,
-       4,     5,     6,     7,     8,     0,     0,     0,     0,     9,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+     377,     0,     0,     0,   258,     0,   259,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,     0,     0,   476,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,    29,
-      30,     0,     0,    31,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,    36,     0,    37,     0,    38,    39,
-      40,     0,     0,     0,    41,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,    45,    46,    47,    48,
-      49,    50,     0,    52,     0,    53,     0,     0,    55,    56,
-      57,    58,    59,   121,    61,    62,     0,     0,     0,     0,
-       0,    63,    64,    65,    66,    67,    68,     0,    70,    71,
-      72,     0,     0,    74,    75,     0,    76,     0,    77,     0,
-      78,    79,    80,    81,     4,     5,     6,     7,     8,     0,
-       0,     0,     0,     9,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   146,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    10,    11,     0,     0,     0,     0,    12,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,     0,     0,     0,     0,     0,
-       0,     0,     0,   120,    30,     0,     0,     0,     0,     0,
-       0,     0,     0,    33,     0,     0,     0,    35,     0,     0,
-       0,     0,    38,    39,     0,     0,     0,     0,     0,    42,
-       0,     0,     0,     0,     0,     0,     0,    43,     0,    44,
-       0,     0,    47,    48,     0,     0,     0,     0,     0,     0,
-       0,     0,    55,    56,    57,    58,    59,   121,    61,    62,
-       4,     5,     6,     7,     8,     0,    64,   122,    66,     9,
-       0,     0,    70,     0,     0,     0,     0,    74,     0,     0,
-       0,     0,    77,     0,     0,    79,    80,    81,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-      11,     0,     0,     0,     0,    12,     0,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,     0,     0,     0,     0,     0,     0,     0,     0,   120,
-      30,     0,     0,     0,     0,     0,     0,     0,     0,    33,
-       0,     0,     0,    35,     0,     0,     0,     0,    38,    39,
-       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
-       0,     0,     0,    43,     0,    44,     0,     0,    47,    48,
-       0,     0,     0,     0,     0,     0,     0,     0,    55,    56,
-      57,    58,    59,   121,    61,    62,     4,     5,     6,     7,
-       8,     0,    64,   122,    66,     9,     0,     0,    70,     0,
-       0,     0,     0,    74,     0,     0,     0,     0,    77,     0,
-     167,    79,    80,    81,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    10,    11,     0,     0,     0,
-       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,     0,     0,     0,
-       0,     0,     0,     0,     0,   120,    30,     0,     0,     0,
-       0,     0,     0,     0,     0,    33,     0,     0,     0,    35,
-       0,     0,     0,     0,    38,    39,     0,     0,     0,     0,
-       0,    42,     0,     0,     0,     0,     0,     0,     0,    43,
-       0,    44,     0,     0,    47,    48,     0,     0,     0,     0,
-       0,     0,     0,     0,    55,    56,    57,    58,    59,   121,
-      61,    62,     4,     5,     6,     7,     8,     0,    64,   122,
-      66,     9,     0,     0,    70,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,    77,     0,   170,    79,    80,    81,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+     477,     0,     0,     0,   258,     0,   259,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,     0,     0,   485,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,    11,     0,     0,     0,     0,    12,     0,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
-       0,   120,    30,     0,     0,     0,     0,     0,     0,     0,
-       0,    33,     0,     0,     0,    35,     0,     0,     0,     0,
-      38,    39,     0,     0,     0,     0,     0,    42,     0,     0,
-       0,     0,     0,     0,     0,    43,     0,    44,     0,     0,
-      47,    48,     0,     0,     0,     0,     0,     0,     0,     0,
-      55,    56,    57,    58,    59,   121,    61,    62,     4,     5,
-       6,     7,     8,     0,    64,   122,    66,     9,     0,     0,
-      70,     0,     0,     0,     0,    74,     0,     0,     0,     0,
-      77,     0,   194,    79,    80,    81,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    10,    11,     0,
-       0,     0,     0,    12,     0,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
-       0,     0,     0,     0,     0,     0,     0,   120,    30,     0,
-       0,     0,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,    35,     0,     0,     0,     0,    38,    39,     0,     0,
-       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
-       0,    43,     0,    44,     0,     0,    47,    48,     0,     0,
-       0,     0,     0,     0,     0,     0,    55,    56,    57,    58,
-      59,   121,    61,    62,     0,     4,     5,     6,     7,     8,
-      64,   122,    66,     0,     9,     0,    70,     0,     0,     0,
-       0,    74,     0,     0,     0,     0,    77,   321,   401,    79,
-      80,    81,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,     0,     0,     0,     0,
-       0,     0,     0,     0,   120,    30,     0,     0,     0,     0,
-       0,     0,     0,     0,    33,     0,     0,     0,    35,     0,
-       0,     0,     0,    38,    39,     0,     0,     0,     0,     0,
-      42,     0,     0,     0,     0,     0,     0,     0,    43,     0,
-      44,     0,     0,    47,    48,     0,     0,     0,     0,     0,
-       0,     0,     0,    55,    56,    57,    58,    59,   121,    61,
-      62,     4,     5,     6,     7,     8,     0,    64,   122,    66,
-       9,     0,     0,    70,     0,     0,     0,     0,    74,     0,
-       0,     0,     0,    77,     0,     0,    79,    80,    81,   425,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,     0,     0,     0,     0,     0,     0,     0,     0,
-     120,    30,     0,     0,     0,     0,     0,     0,     0,     0,
-      33,     0,     0,     0,    35,     0,     0,     0,     0,    38,
-      39,     0,     0,     0,     0,     0,    42,     0,     0,     0,
-       0,     0,     0,     0,    43,     0,    44,     0,     0,    47,
-      48,     0,     0,     0,     0,     0,     0,     0,     0,    55,
-      56,    57,    58,    59,   121,    61,    62,     4,     5,     6,
-       7,     8,     0,    64,   122,    66,     9,     0,     0,    70,
-       0,     0,     0,     0,    74,     0,     0,     0,     0,    77,
-       0,     0,    79,    80,    81,   438,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-       0,     0,     0,     0,     0,     0,   120,    30,     0,     0,
-       0,     0,     0,     0,     0,     0,    33,     0,     0,     0,
-      35,     0,     0,     0,     0,    38,    39,     0,     0,     0,
-       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
-      43,     0,    44,     0,     0,    47,    48,     0,     0,     0,
-       0,     0,     0,     0,     0,    55,    56,    57,    58,    59,
-     121,    61,    62,     4,     5,     6,     7,     8,     0,    64,
-     122,    66,     9,     0,     0,    70,     0,     0,     0,     0,
-      74,     0,     0,     0,     0,    77,     0,     0,    79,    80,
-      81,   453,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,     0,     0,     0,     0,     0,     0,
-       0,     0,   120,    30,     0,     0,     0,     0,     0,     0,
-       0,     0,    33,     0,     0,     0,    35,     0,     0,     0,
-       0,    38,    39,     0,     0,     0,     0,     0,    42,     0,
-       0,     0,     0,     0,     0,     0,    43,     0,    44,     0,
-       0,    47,    48,     0,     0,     0,     0,     0,     0,     0,
-       0,    55,    56,    57,    58,    59,   121,    61,    62,     4,
-       5,     6,     7,     8,     0,    64,   122,    66,     9,     0,
-       0,    70,     0,     0,     0,     0,    74,     0,     0,     0,
-       0,    77,     0,     0,    79,    80,    81,   455,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    10,    11,
-       0,     0,     0,     0,    12,     0,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-       0,     0,     0,     0,     0,     0,     0,     0,   120,    30,
-       0,     0,     0,     0,     0,     0,     0,     0,    33,     0,
-       0,     0,    35,     0,     0,     0,     0,    38,    39,     0,
-       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
-       0,     0,    43,     0,    44,     0,     0,    47,    48,     0,
-       0,     0,     0,     0,     0,     0,     0,    55,    56,    57,
-      58,    59,   121,    61,    62,     4,     5,     6,     7,     8,
-       0,    64,   122,    66,     9,     0,     0,    70,     0,     0,
-       0,     0,    74,     0,     0,     0,     0,    77,     0,     0,
-      79,    80,    81,   645,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    10,    11,     0,     0,     0,     0,
-      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,     0,     0,     0,     0,
-       0,     0,     0,     0,   120,    30,     0,     0,     0,     0,
-       0,     0,     0,     0,    33,     0,     0,     0,    35,     0,
-       0,     0,     0,    38,    39,     0,     0,     0,     0,     0,
-      42,     0,     0,     0,     0,     0,     0,     0,    43,     0,
-      44,     0,     0,    47,    48,     0,     0,     0,     0,     0,
-       0,     0,     0,    55,    56,    57,    58,    59,   121,    61,
-      62,     4,     5,     6,     7,     8,     0,    64,   122,    66,
-       9,     0,     0,    70,     0,     0,     0,     0,    74,     0,
-       0,     0,     0,    77,     0,     0,    79,    80,    81,   654,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+     514,     0,     0,     0,   258,     0,   259,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,     0,     0,   521,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    11,     0,     0,     0,     0,    12,     0,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,     0,     0,     0,     0,     0,     0,     0,     0,
-     120,    30,     0,     0,     0,     0,     0,     0,     0,     0,
-      33,     0,     0,     0,    35,     0,     0,     0,     0,    38,
-      39,     0,     0,     0,     0,     0,    42,     0,     0,     0,
-       0,     0,     0,     0,    43,     0,    44,     0,     0,    47,
-      48,     0,     0,     0,     0,     0,     0,     0,     0,    55,
-      56,    57,    58,    59,   121,    61,    62,     4,     5,     6,
-       7,     8,     0,    64,   122,    66,     9,     0,     0,    70,
-       0,     0,     0,     0,    74,     0,     0,     0,     0,    77,
-       0,     0,    79,    80,    81,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    10,    11,     0,     0,
-       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,    25,    26,     0,     0,
-       0,     0,     0,     0,     0,     0,   120,    30,     0,     0,
-       0,     0,     0,     0,     0,     0,    33,     0,     0,     0,
-      35,     0,     0,     0,     0,    38,    39,     0,     0,     0,
-       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
-      43,     0,    44,     0,     0,    47,    48,     0,     0,     0,
-       0,     0,     0,     0,     0,    55,    56,    57,    58,    59,
-     121,    61,    62,     4,     5,     6,     7,     8,     0,    64,
-     122,    66,     9,     0,     0,    70,     0,     0,     0,     0,
-      74,     0,     0,     0,     0,    77,     0,     0,    79,    80,
-      81,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    10,    11,     0,     0,     0,     0,    12,     0,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,     0,     0,     0,     0,     0,     0,
-       0,     0,   120,    30,     0,     0,     0,     0,     0,     0,
-       0,     0,    33,     0,     0,     0,    35,     0,     0,     0,
-       0,    38,    39,     0,     0,     0,     0,     0,    42,     0,
-       0,     0,     0,     0,     0,     0,    43,     0,    44,     0,
-       0,    47,    48,     0,     0,     0,     0,     0,     0,     0,
-       0,    55,    56,    57,    58,    59,   121,    61,    62,     0,
-       0,     0,     0,     0,     0,    64,   122,   350,     0,     0,
-       0,    70,   234,   235,   236,     0,    74,     0,     0,     0,
-       0,    77,     0,     0,    79,    80,    81,     0,   237,     0,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,   234,   235,   236,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   237,
-       0,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,     0,   259,   234,   235,   236,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     237,     0,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,     0,     0,     0,     0,   234,
-     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   237,   260,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-     234,   235,   236,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   237,   312,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,     0,
-     259,   234,   235,   236,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   237,   314,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,     0,     0,     0,   234,   235,   236,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+     665,     0,     0,     0,   258,     0,   259,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,     0,     0,   852,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   237,   360,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,     0,   234,   235,
-     236,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   377,   237,     0,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,   234,
-     235,   236,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   450,   237,     0,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,     0,   259,
-       0,     0,   234,   235,   236,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   237,   488,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259,     0,   234,   235,   236,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     237,   496,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,   234,   235,   236,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+     878,     0,     0,     0,   258,     0,   259,   246,   247,     0,
+       0,     0,   234,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,   505,     0,     0,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
+       0,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,   246,   247,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,     0,   255,
+     256,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,   258,     0,   259,   255,   256,
+     257,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,   530,   249,
+     250,   251,   252,   253,   258,   254,   259,     0,     0,   255,
+     256,   257,     0,     0,   234,     0,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   566,     0,     0,
+       0,     0,     0,     0,     0,   258,     0,   259,   246,   247,
+       0,     0,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,   592,     0,
+       0,     0,     0,     0,     0,     0,     0,   246,   247,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,   514,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,     0,     0,   234,   235,
-     236,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   237,   521,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,     0,
-     234,   235,   236,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   237,   671,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,     0,
-     259,   234,   235,   236,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   237,   853,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,     0,   234,   235,   236,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     237,   879,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,     0,   234,   235,   236,     0,
+       0,     0,     0,     0,     0,     0,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,     0,   254,     0,     0,     0,
+     255,   256,   257,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,   258,     0,   259,   255,
+     256,   257,     0,     0,     0,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,   640,
+       0,    13,     0,     0,    14,   258,     0,   259,     0,    15,
+      16,    17,     0,     0,     0,    18,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,   732,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,    52,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,     0,    74,    75,
+       0,     0,    76,   600,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+      18,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,    52,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,     0,    74,    75,     0,     0,    76,   676,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,    18,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,    52,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,     0,    74,    75,
+       0,     0,    76,     0,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,   371,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,   515,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+     720,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,     0,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,   742,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,     0,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,   848,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,     0,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,   871,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,   874,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,   876,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,     0,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,   880,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,   895,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,   922,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,    10,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,    15,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,    32,    33,    34,    35,
+      36,    37,    38,   370,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,    46,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,   925,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+      10,     0,    11,    12,     0,     0,    13,     0,     0,    14,
+       0,     0,     0,     0,    15,    16,    17,     0,     0,     0,
+       0,    19,    20,     0,    21,    22,     0,    23,     0,    24,
+      25,     0,     0,     0,    26,    27,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,    32,    33,    34,    35,    36,    37,    38,   370,    40,
+       0,    41,    42,    43,    44,     0,     0,    45,    46,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,    60,     0,     0,     0,     0,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,     0,     0,    74,    75,     0,     0,    76,     0,    77,
+       0,    78,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,    14,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,    20,     0,    21,
+      22,     0,    23,     0,    24,    25,     0,     0,     0,    26,
+      27,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,    33,    34,    35,
+      36,    37,    38,     0,    40,     0,    41,    42,    43,    44,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,    60,
+       0,     0,     0,     0,    61,    62,    63,    64,    65,    66,
+      67,     0,    69,    70,    71,    72,     0,     0,    74,    75,
+       0,     0,    76,     0,    77,     0,    78,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,    17,     0,     0,     0,
+       0,    19,     0,     0,    21,     0,     0,    23,     0,    24,
+       0,     0,     0,     0,    26,     0,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,     0,     0,     0,    35,    36,     0,     0,     0,     0,
+       0,    41,    42,    43,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     116,   117,    64,    65,     0,     0,     0,    69,     0,     0,
+      72,     0,     0,    74,     0,     0,     0,     0,     0,    77,
+       0,   132,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   116,   117,    64,    65,     0,
+       0,     0,    69,     0,     0,    72,     0,     0,    74,     0,
+       0,     0,     0,     0,    77,     0,   136,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,    17,     0,     0,     0,
+       0,    19,     0,     0,    21,     0,     0,    23,     0,    24,
+       0,     0,     0,     0,    26,     0,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,     0,     0,     0,    35,    36,     0,     0,     0,     0,
+       0,    41,    42,    43,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     116,   117,    64,    65,     0,     0,     0,    69,     0,     0,
+      72,     0,     0,    74,     0,     0,     0,     0,     0,    77,
+       0,   189,    79,    80,    81,     4,     5,     0,     0,     0,
+       0,     6,     7,     8,     9,     0,     0,    11,    12,     0,
+       0,    13,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,    17,     0,     0,     0,     0,    19,     0,     0,    21,
+       0,     0,    23,     0,    24,     0,     0,     0,     0,    26,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,    29,    30,     0,    31,     0,     0,     0,    35,
+      36,     0,     0,     0,     0,     0,    41,    42,    43,     0,
+       0,     0,    45,     0,     0,     0,     0,     0,     0,    47,
+       0,    48,    49,    50,     0,     0,     0,    51,     0,     0,
+       0,   115,    53,    54,    55,     0,    56,     0,     0,     0,
+       0,     0,     0,    57,     0,     0,     0,    58,    59,     0,
+       0,     0,     0,     0,    61,   116,   117,    64,    65,     0,
+       0,     0,    69,     0,     0,    72,     0,     0,    74,     0,
+       0,     0,     0,     0,    77,   305,     0,    79,    80,    81,
+       4,     5,     0,     0,     0,     0,     6,     7,     8,     9,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,    17,     0,     0,     0,
+       0,    19,     0,     0,    21,     0,     0,    23,     0,    24,
+       0,     0,     0,     0,    26,     0,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,     0,     0,     0,    35,    36,     0,     0,     0,     0,
+       0,    41,    42,    43,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     116,   117,    64,    65,     0,     0,     0,    69,     0,     0,
+      72,     0,     0,    74,     0,     0,     0,     0,     0,    77,
+       4,     5,    79,    80,    81,     0,     6,     7,     8,     9,
+       0,     0,    11,    12,     0,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,    17,     0,     0,     0,
+       0,    19,     0,     0,    21,     0,     0,    23,     0,    24,
+       0,     0,     0,     0,    26,     0,     0,     0,    28,     0,
+       0,     0,     0,     0,     0,     0,     0,    29,    30,     0,
+      31,     0,     0,     0,    35,    36,     0,     0,     0,     0,
+       0,    41,    42,    43,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,     0,    47,     0,    48,    49,    50,     0,
+       0,     0,    51,     0,     0,     0,   115,    53,    54,    55,
+       0,    56,     0,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    58,    59,     0,     0,     0,     0,     0,    61,
+     116,   117,    64,   346,     0,     0,     0,    69,     0,     0,
+      72,     0,     0,    74,     0,     0,     0,     0,     0,    77,
+       0,     0,    79,    80,    81,   234,     0,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   246,
+     247,     0,     0,     0,   234,   555,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,     0,     0,     0,
+       0,     0,     0,     0,     0,   286,     0,     0,   246,   247,
+       0,     0,     0,     0,     0,   234,     0,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   248,     0,   246,
+     247,   249,   250,   251,   252,   253,     0,   254,     0,     0,
+       0,   255,   256,   257,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   569,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,     0,   254,   258,     0,   259,
+     255,   256,   257,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   248,     0,     0,
+       0,   249,   250,   251,   252,   253,   258,   254,   259,     0,
+       0,   255,   256,   257,     0,     0,   234,     0,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
+       0,     0,     0,     0,     0,     0,     0,   258,     0,   259,
+     246,   247,     0,   234,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   246,   247,     0,
+     234,     0,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   246,   247,     0,     0,   248,     0,
+       0,     0,   249,   250,   251,   252,   253,     0,   254,     0,
+       0,     0,   255,   256,   257,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,     0,   254,     0,     0,   258,   255,
+     259,   257,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,     0,   254,     0,     0,   258,   255,   259,     0,     0,
+       0,   234,     0,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,     0,     0,     0,     0,     0,     0,
+       0,     0,   258,     0,   259,   246,   247,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   246,
+     247,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   246,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   248,     0,     0,     0,   249,   250,   251,
+     252,   253,     0,   254,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,     0,     0,   248,     0,     0,
+       0,   249,   250,   251,   252,   253,     0,   254,     0,     0,
+       0,     0,     0,   258,     0,   259,     0,     0,     0,     0,
+       0,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+       0,   254,     0,     0,     0,     0,     0,   258,     0,   259,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,     0,
+       0,   258,     0,   259,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,     0,   254,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   508,   237,     0,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,     0,   259,   234,   235,   236,
+     238,   239,   240,   241,   242,   243,   244,   245,     0,     0,
+       0,     0,     0,     0,   258,     0,   259,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   248,
+       0,     0,     0,   249,   250,   251,   252,   253,   248,   254,
+       0,     0,   249,   250,   251,   252,   253,     0,   254,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   530,   237,     0,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,     0,   259,   234,   235,
-     236,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   237,   566,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,     0,   259,     0,
-     234,   235,   236,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   237,   598,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,     0,
-     259,   234,   235,   236,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   237,   640,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-       0,   259,     0,     0,   234,   235,   236,   295,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   718,
-     237,   555,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,     0,   259,   234,   235,   236,   569,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   258,
+       0,   259,     0,     0,     0,     0,     0,   248,   258,     0,
+     259,  -414,   250,  -414,  -414,  -414,     0,   254,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,     0,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,     0,   259,   235,   236,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   237,     0,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   236,   259,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   237,     0,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,     0,   259
+       0,     0,     0,     0,     0,     0,     0,   258,     0,   259
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-736))
-
-#define yytable_value_is_error(yytable_value) \
-  ((yytable_value) == (-414))
-
 static const yytype_int16 yycheck[] =
 {
-       2,   123,     2,    26,   259,   233,   479,     2,     2,   277,
-     525,   279,   489,   343,    26,   447,   384,   302,   386,   438,
-       8,     8,     8,     8,   759,     8,     8,    29,     8,    26,
-       8,    74,     8,     8,   453,     8,   455,     8,     8,     8,
-     208,     8,    31,   165,     8,     8,    40,    31,   276,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    21,    22,   291,   292,    31,    26,    26,    26,   542,
-      61,    61,   129,   301,    78,    31,   304,   305,   128,   136,
-      61,   112,   128,   133,    61,   128,    90,    21,    22,   146,
-     136,   128,   524,   128,    58,    59,   133,   382,   133,   128,
-      60,   151,    62,     9,    10,    11,    61,   136,   146,     0,
-      31,   626,    61,    73,   151,   146,   151,   155,   120,    25,
-     149,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,   133,    49,    74,   151,   150,    21,    22,   130,
-     885,    72,    26,   112,    61,    81,   153,   146,   149,   149,
-     151,   149,   146,    61,    63,   153,   153,   153,   153,   537,
-     153,   153,   149,   153,   504,   153,   152,   152,   138,   152,
-     146,   152,   152,   152,   133,   152,   146,   612,   152,   152,
-     146,   149,   152,   146,   149,   672,   151,   136,   128,    78,
-     149,   160,   155,    81,   128,   126,    73,   128,   128,   151,
-      77,    90,   151,   215,    72,   136,   176,   502,   128,   447,
-     505,   233,   182,   130,   656,   146,   645,   151,   188,   189,
-     190,   151,   130,   146,   155,   654,   259,    88,   198,   149,
-     128,   128,   155,   153,    95,    88,   133,   259,    99,   209,
-     210,   157,    95,   128,   136,   523,    99,   772,   133,   126,
-     685,   128,   687,   151,   276,   633,   551,   552,   126,   136,
-     128,   150,   146,   136,   233,    63,   561,   562,   136,   291,
-     292,   180,   128,    88,    72,   152,   151,   133,   146,   301,
-      95,   149,   304,   305,    99,   146,   524,   155,   103,   259,
-     259,   556,   176,   146,   572,   156,    88,    79,   182,    81,
-      78,    78,    99,    95,   188,   189,   103,   276,   126,   233,
-     128,   689,    90,    90,   198,   151,    73,   149,   136,   289,
-      77,   153,   291,   292,   151,   209,   104,   104,   126,   299,
-     128,   146,   301,    58,    59,   304,   305,   307,   136,   151,
-     126,   151,   128,   313,    64,    65,   151,   625,   146,   361,
-     136,   151,   276,   136,   146,   650,   151,   155,   151,    67,
-      68,    69,    70,    71,    72,    26,   275,   291,   292,   126,
-     151,   128,    64,    65,   752,   259,     8,    85,   149,   136,
-     149,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,   302,    88,   151,   151,   367,   136,   136,
-     136,    95,    45,    46,    47,    99,    49,   890,   146,   103,
-     588,   149,    31,    61,   384,   133,   386,   155,   656,   389,
-      72,   599,   151,   307,   133,   447,    58,    59,   397,   313,
-     130,    88,    88,    61,   712,   713,   144,   145,    95,    95,
-     618,   112,   150,    99,   128,    49,   103,   128,   133,     8,
-     133,   157,   146,   831,   832,   425,   128,   133,    88,    67,
-      68,    69,    70,    71,    72,    95,   128,   133,   438,    99,
-     130,   123,   151,   382,   126,    13,   128,    85,   447,    13,
-     484,   136,   860,   453,   136,   455,   153,   152,   147,   146,
-     146,   503,   496,   503,   146,   465,   466,   467,   503,   503,
-     136,   471,   524,   155,   153,   136,   152,   154,   886,   479,
-     146,   136,   482,   149,   136,   146,   146,   521,   149,   155,
-     152,   491,   492,   556,   155,   107,   107,   497,   130,   499,
-     500,   909,   146,   911,   556,   151,   144,   145,   151,    13,
-     152,   425,   150,   152,   151,     8,   516,    67,    68,    69,
-      70,    71,    72,   153,   438,   524,   200,    74,   153,   203,
-     151,   150,   532,    61,   534,   136,   136,   537,   151,   453,
-      13,   455,   542,   117,   218,   151,   220,   157,   222,   223,
-     152,   465,   466,   467,   151,   151,   556,   556,   151,     8,
-      72,   151,   112,   502,   151,   607,   505,   607,   482,   777,
-     152,   157,   607,   607,   157,   151,    72,   491,   492,   579,
-     580,   133,   790,   497,   584,   499,   500,    42,    43,    44,
-      45,    46,    47,   128,    49,   595,    13,   805,   136,    13,
-     157,   809,   516,    79,   656,   153,   136,   152,   130,   817,
-     818,   152,   551,   552,   126,   823,   128,   128,   532,   827,
-       8,   560,   561,   562,   136,   149,   152,     8,   670,   629,
-     126,   151,   128,   633,   146,   677,   130,   637,    96,   801,
-     136,   157,   556,   155,     8,   645,   103,   855,   690,   136,
-     146,   152,    13,   153,   654,    96,   153,   656,   153,   155,
-     660,   152,   662,   152,   152,   579,   151,   153,   149,   669,
-     584,   146,   144,   673,    67,    68,    69,    70,    71,    72,
-     157,   595,    13,   152,   152,   152,   894,   152,    61,   689,
-      61,   157,   152,   152,   728,   729,   150,   153,   732,   152,
-     151,   149,    13,   153,   704,   157,   152,    96,   916,   149,
-     152,   650,   151,   146,   136,   923,   758,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,   153,
-     153,   645,    13,   146,   149,   146,   157,   157,    26,   151,
-     654,    66,   776,   153,   152,    13,   660,    13,   662,   136,
-     146,    13,   752,   153,   149,   669,   146,   136,    74,   673,
-      13,   153,    58,    59,   150,    74,   119,   767,   153,   153,
-     133,    13,   146,   773,   151,   153,    26,   136,    79,   821,
-     136,   136,     8,   152,   151,   906,   828,   152,   146,   149,
-     704,   516,   367,   537,   596,   673,   729,   787,   840,   637,
-     331,   696,   844,   860,    77,   847,   848,   526,   668,   851,
-     644,   811,   854,   623,   579,   578,   182,   500,   499,   853,
-     166,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     830,   831,   832,    -1,    -1,   835,    -1,    -1,    -1,   881,
-      -1,    -1,    -1,    -1,    -1,   845,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   767,    -1,    -1,    -1,   153,    -1,   773,
-     860,   903,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     870,    -1,    -1,    -1,    -1,    -1,    21,    22,   920,    -1,
-      -1,    26,   924,    -1,    -1,    -1,   886,    -1,    -1,   889,
-     890,    -1,    -1,    -1,    -1,    -1,    -1,   811,    -1,    -1,
-      -1,    -1,    21,    22,    -1,    -1,    -1,    -1,    -1,   909,
-      -1,   911,    -1,    -1,    -1,    -1,   830,    -1,    -1,    -1,
-      -1,   835,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   845,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    63,    -1,    23,    24,    25,    -1,
-      -1,    -1,    -1,    -1,    31,    -1,   870,    -1,    -1,    36,
-      -1,    -1,    -1,    -1,    41,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   889,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,     9,    10,
-      11,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      77,   146,    -1,    -1,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,   146,    49,    -1,
-      -1,   176,    -1,    -1,    -1,    -1,    -1,   182,   115,   116,
-     117,   118,   119,   188,   189,    -1,    -1,    -1,   307,    -1,
-      -1,    -1,   307,   198,   313,    -1,    -1,   176,   313,    -1,
-      -1,   180,    -1,   182,   209,    -1,    -1,    -1,    -1,   188,
-     189,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   198,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   166,
-     209,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     177,    -1,   179,   180,    -1,    -1,    -1,    -1,    -1,    -1,
-     187,    -1,    -1,    -1,   259,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   199,    -1,    -1,    -1,    -1,    -1,    -1,   206,
-      -1,    -1,   153,    -1,    -1,    -1,    -1,   214,    -1,    -1,
-      -1,    -1,    -1,    -1,   221,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   232,   275,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,    -1,   302,    -1,    -1,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,    -1,
-     277,    -1,   279,   280,    -1,    -1,   465,   466,   467,    -1,
-     465,   466,    -1,    -1,    -1,    -1,    -1,    -1,   295,    -1,
-     297,    -1,    -1,   482,    -1,   302,    -1,   482,    -1,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,   318,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   328,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,   382,    49,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   532,    58,    59,    -1,   532,    -1,    -1,
-     425,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      74,    -1,    -1,   438,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   382,   425,    -1,   453,    -1,
-     455,    -1,    -1,    -1,    -1,    -1,   393,    -1,    -1,   438,
-     579,    -1,    -1,    -1,   401,   584,    -1,    -1,    -1,   584,
-      -1,    -1,    -1,    -1,   453,    -1,   455,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   491,   492,    -1,    -1,
-      -1,    -1,   497,    -1,   499,   500,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,   516,   491,   492,    -1,    -1,    -1,    -1,   497,    -1,
-     499,   500,    -1,   502,    -1,    -1,   505,    42,    43,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   516,    -1,    -1,
-      -1,   660,    -1,   662,    -1,   660,    61,   662,   485,    -1,
-     669,   556,   489,   490,   669,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,   502,    -1,    82,   505,    -1,
-     507,    86,   551,   552,    -1,    -1,    91,    92,    -1,    -1,
-      -1,   560,   561,   562,    -1,   704,   523,    -1,    -1,   704,
-     595,    -1,    -1,   108,    -1,    -1,   111,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   122,    -1,   124,
-     125,   126,   127,   128,   551,   552,   595,    -1,   555,    -1,
-     135,   136,    -1,   560,   561,   562,   141,    -1,    -1,    -1,
-      -1,    -1,   569,    -1,    -1,   572,   573,    -1,    -1,    -1,
-     645,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   767,   654,
-      -1,    -1,   767,    -1,   773,    -1,    -1,    -1,   773,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   645,   604,   673,    -1,
-      -1,   650,    -1,    -1,    -1,   654,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,   625,    -1,
-      -1,    -1,   811,    -1,   673,    -1,   811,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   830,    -1,   650,    -1,   830,   835,    -1,    -1,    -1,
-     835,    58,    59,    -1,    -1,    -1,   845,    -1,    -1,    -1,
-     845,    -1,    -1,    -1,    -1,   672,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   870,    -1,    -1,    -1,   870,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-     889,    -1,    -1,    -1,   889,   712,   713,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    42,    43,    -1,    -1,   736,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    85,    86,
-      87,    -1,    89,    -1,    91,    92,    93,   784,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,   822,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,    -1,   146,
-     147,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    25,    12,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    85,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,    -1,   146,   147,    -1,   149,   150,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    85,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,   100,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,   105,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,   102,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       2,   118,   207,   233,     2,   513,     2,     2,    53,   248,
+     384,   447,   386,   478,    53,   277,   438,   279,    60,   329,
+       3,     6,     3,     3,    53,   525,     3,   759,   450,    25,
+     452,     3,     3,    21,   542,     3,     3,     6,    22,    21,
+     151,     3,     3,     3,    77,   612,   276,     3,     3,     3,
+       3,    21,    45,     3,   335,   111,    21,    33,   111,    41,
+      62,    54,    26,    21,   111,    99,   296,   297,    61,    21,
+      52,    53,    48,    55,   108,     0,     9,   111,     9,     9,
+       9,   111,   145,   112,   111,   202,   133,   111,   524,    73,
+      36,    73,   155,    77,    21,   151,   149,    21,   132,   133,
+     153,   382,    21,   133,   334,   133,     9,   337,   338,   149,
+      21,   145,   145,   153,   116,   157,    21,    41,   685,   149,
+     687,   155,   145,   151,   151,    45,   626,   151,   133,    53,
+     118,    33,   155,    26,    54,   151,    41,   121,   122,   123,
+      61,    61,   124,   151,    65,    65,    48,   111,   132,    45,
+      45,    45,   145,   885,   183,    22,   114,   139,    54,    54,
+      54,   149,   114,   537,   151,    61,   149,    61,   153,   151,
+     153,    65,   153,   153,   150,    42,   153,   159,   151,   149,
+     149,   153,   153,   493,   149,   153,   153,   169,   170,   171,
+     152,   152,   152,   175,   233,   114,   152,   152,   152,   152,
+     124,   666,   152,   248,   233,   108,    73,   118,   111,   248,
+     491,   193,   145,   215,   145,   145,   145,   447,   111,   248,
+      36,   502,   149,   645,   151,   145,   208,   151,   210,   132,
+     133,    22,   654,   275,   151,   159,    24,   276,   149,   151,
+     151,   677,   145,   133,    32,   169,   170,   276,   150,   145,
+     145,   145,   155,    45,   121,   122,   123,   296,   297,   633,
+     156,   523,    54,    46,   151,   132,   248,   296,   297,   193,
+     551,   552,   772,    65,    58,    59,   143,   144,    58,    59,
+     561,   562,    73,   150,   208,    11,    12,    13,    14,    15,
+      16,    17,   112,   335,   524,   334,     3,     4,   337,   338,
+      83,   145,    15,    16,    17,   334,    21,   111,   337,   338,
+     292,   155,   294,   133,   118,   689,    23,   556,   151,   151,
+     108,   111,    33,   111,   248,   145,    41,    79,   118,    81,
+     121,   122,   123,   108,    41,    45,   111,    48,    53,    46,
+     382,   132,   604,    50,    54,   133,    45,   151,   151,     6,
+     332,    61,   233,   145,   133,    54,    67,   132,   133,   361,
+     111,    87,    61,   625,   152,   111,    92,   118,   397,   650,
+     145,    97,   118,   355,    87,    24,    83,   582,   752,   111,
+     155,   108,   890,    32,   111,   367,   118,   151,   593,    12,
+      13,    14,    15,    16,    17,   276,   149,   151,   105,   106,
+     107,   127,   384,   129,   386,   151,   133,   389,   447,   124,
+     117,   151,   119,   618,   108,   296,   297,   111,   447,   151,
+     149,   128,     9,   130,   133,   133,    10,    11,    12,    13,
+      14,    15,    16,    17,   118,   145,   151,    33,    21,   133,
+     118,   148,   114,   425,   159,   152,   145,   677,   151,   491,
+     712,   713,    48,    21,   169,   170,   438,   831,   832,   108,
+     502,   111,   111,    77,    87,   133,    87,   157,   450,     3,
+     452,    67,     4,   455,   456,   457,   472,   145,   193,   461,
+     111,   149,   118,   118,   133,   524,   860,   155,   470,   485,
+     492,   133,   146,   208,   492,   524,   492,   492,   480,   481,
+     153,   425,   118,    87,   486,   152,   488,   489,    92,   551,
+     552,   556,   886,    97,   438,   118,   111,   556,   560,   561,
+     562,   111,   111,   118,    22,   521,   450,   556,   452,   108,
+       4,   513,   111,   248,   516,   909,   151,   911,   114,   133,
+     153,   152,   154,   127,    42,   129,    71,   133,   133,    71,
+     532,   114,   534,   132,   133,   537,   480,   481,   151,   145,
+     542,   152,   486,   149,   488,   489,   145,     4,   133,   155,
+     149,   776,   152,   151,   556,    73,   155,   292,   153,     3,
+     145,    26,   153,   150,   149,   790,   195,   151,    21,   198,
+     155,   133,   516,   575,   576,   145,   151,   133,   151,   601,
+     805,     4,    82,   601,   809,   601,   601,   589,   650,   218,
+     151,   220,   817,   222,   223,   152,   821,   157,   151,     3,
+     825,   151,   827,   121,   122,   123,   157,   609,   151,   157,
+     151,   151,   556,   151,   132,   111,   108,   109,   677,   111,
+     355,   118,   133,     4,   152,   143,   144,   629,   677,     4,
+     855,   633,   150,   108,   157,   637,   111,    34,   153,   152,
+     132,   133,   664,   645,   133,   589,   114,   152,   111,   671,
+       3,   149,   654,   145,   656,     3,   658,   132,   133,   152,
+     151,   663,    55,   155,   801,   667,     3,   157,   690,   894,
+     145,    65,   133,     4,   153,    55,   152,   114,   152,   152,
+     155,   153,   153,   153,   151,   149,   152,   689,   157,   143,
+     425,   916,     4,   145,   152,    21,   152,   152,   923,    21,
+     150,   645,   704,   438,   152,   152,   157,   153,   724,   725,
+     654,   727,   152,   152,   157,   450,   151,   452,   149,     4,
+     455,   456,   457,   667,   152,    55,   153,   152,   149,   151,
+     145,   133,   145,   153,   153,   470,   758,   149,   145,     4,
+     157,   157,     6,   151,   153,   480,   481,    66,     4,   152,
+     752,   486,     4,   488,   489,   133,   145,     4,   153,   775,
+     145,   149,   133,     4,    26,   767,   153,   150,    26,     3,
+       4,   773,    88,   118,   153,     4,   153,   151,   145,     6,
+     153,   516,   133,    34,   133,     3,   133,   152,   151,    23,
+     145,   152,   149,   367,   906,   516,   537,   532,   820,   590,
+     667,   725,   637,   315,   787,   696,   828,    41,   860,   811,
+     526,    77,    46,   684,   644,   574,    50,   575,   840,   159,
+     488,   556,   844,   489,   129,   847,   623,   849,   830,   831,
+     832,   853,   854,   835,    -1,    -1,   852,    -1,    -1,    -1,
+     575,    -1,    -1,   845,    -1,    -1,    -1,    -1,    -1,    83,
+      -1,    -1,    -1,    -1,   589,    -1,    -1,    -1,   860,   881,
+      -1,    -1,    -1,   292,    -1,    -1,    -1,    -1,   870,    -1,
+      -1,   105,   106,   107,   609,    -1,    -1,    -1,    -1,    -1,
+      -1,   903,    -1,   117,   886,   119,    -1,   889,   890,    -1,
+      -1,    -1,    -1,    -1,   128,    -1,   130,    -1,   920,    -1,
+      -1,    -1,   924,    -1,    -1,     4,    -1,   909,    -1,   911,
+     645,    -1,    -1,    -1,   148,    -1,    -1,    -1,   152,   654,
+      -1,   656,    -1,   658,    23,    -1,   355,    -1,   663,    -1,
+      -1,    -1,   667,    -1,    -1,    -1,     4,     5,     6,     7,
+       8,     9,    41,    -1,    12,    13,    14,    46,    -1,    17,
+      -1,    50,    20,    -1,    -1,    -1,    -1,    -1,    26,    27,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,   704,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    -1,    -1,    23,    56,    57,
+      26,    -1,    60,    -1,    -1,    -1,    64,    -1,    -1,    67,
+      -1,    -1,    -1,    -1,    72,    41,   105,   106,   107,    77,
+      46,    -1,    -1,    -1,    50,    -1,    -1,    -1,   117,    -1,
+     119,    -1,    -1,    -1,    -1,    -1,   455,   456,    -1,   128,
+      -1,   130,   767,    -1,    -1,    -1,    -1,    -1,   773,    -1,
+      -1,   470,    -1,    -1,    -1,    -1,    -1,    83,    -1,   148,
+      -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,    -1,
+      -1,   129,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   105,
+     106,   107,    -1,    -1,    -1,    -1,   811,    -1,    -1,    -1,
+      -1,   117,    -1,   119,   152,   153,    -1,    -1,   156,   157,
+      -1,    -1,   128,    -1,   130,   830,   164,    -1,   166,   167,
+     835,    -1,    -1,   532,    -1,    -1,    -1,    -1,    -1,    -1,
+     845,    21,   148,    -1,    -1,    -1,    -1,    -1,    -1,   187,
+     188,    -1,    -1,    -1,    -1,    -1,   194,    -1,    -1,    -1,
+      -1,    41,    -1,    -1,    -1,   870,    -1,   205,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   214,    -1,    -1,    -1,
+      60,    -1,    -1,   221,   889,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   232,    -1,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     609,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,    -1,    -1,    -1,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,    -1,   277,
+      -1,   279,   280,    -1,   124,    -1,    -1,    -1,   286,   355,
+     288,    -1,    -1,    -1,    -1,    -1,     4,   656,    -1,   658,
+      -1,    -1,    -1,   301,   663,    -1,    -1,    -1,    -1,    -1,
+      -1,   151,    -1,    -1,   312,    23,    -1,   157,    -1,   159,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   169,
+     170,    -1,    -1,    41,    -1,    -1,    -1,   335,    46,    -1,
+      -1,    -1,    50,    -1,    -1,   704,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   208,    -1,
+      -1,    -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   382,    -1,    -1,    -1,    -1,   455,
+     456,   457,    -1,    -1,    -1,   393,    -1,   105,   106,   107,
+     398,    -1,    -1,    -1,   470,    -1,    -1,    -1,   767,   117,
+      -1,   119,    -1,    -1,   773,    -1,    -1,    -1,    -1,    -1,
+     128,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   275,    -1,    -1,    -1,    -1,
+     148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    13,
+      -1,    -1,   811,    -1,    -1,    -1,    -1,    21,    -1,    -1,
+      24,    -1,    -1,    -1,    -1,    -1,   532,    -1,    -1,    -1,
+      -1,   830,    -1,    37,    -1,   473,   835,    -1,    -1,    43,
+     478,   479,    -1,    -1,    -1,    49,   845,    51,    -1,    -1,
+      -1,    -1,    -1,   491,    -1,   335,    10,    11,    12,    13,
+      14,    15,    16,    17,   502,    -1,   504,    -1,    72,   575,
+      -1,   870,    76,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   523,    -1,    -1,    -1,    -1,
+     889,    -1,    -1,    -1,    98,    -1,   100,    -1,    -1,    -1,
+     104,    -1,   382,   609,   108,    -1,   110,   111,    -1,    -1,
+      -1,    -1,    -1,   551,   552,    -1,    -1,   555,    -1,    -1,
+      -1,    -1,   560,   561,   562,    -1,    -1,   131,   132,   133,
+      -1,   569,    -1,    87,    -1,   139,    -1,    91,    92,    93,
+      94,    95,    -1,    97,    -1,   425,    -1,    -1,    -1,    -1,
+     656,    -1,   658,    -1,    -1,    -1,    -1,   663,   438,    -1,
+     598,    -1,    -1,    -1,    -1,    -1,   604,   605,    -1,    -1,
+     450,    -1,   452,   127,    -1,   129,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   625,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   704,    -1,
+     480,   481,    -1,    -1,    -1,    -1,   486,    -1,   488,   489,
+      -1,   491,   650,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   502,    -1,    -1,    -1,    -1,    -1,   666,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   516,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,   767,    -1,    -1,    -1,    -1,    -1,   773,    29,    30,
+      -1,   551,   552,    -1,   712,   713,    -1,    -1,    -1,    -1,
+     560,   561,   562,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   736,    -1,
+      -1,    -1,    -1,    -1,    -1,   811,    -1,    -1,    -1,   589,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   830,    -1,    87,    -1,    -1,   835,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,   845,
+     101,   102,   103,    -1,    -1,    -1,   784,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   870,   645,   127,    -1,   129,    -1,
+     650,    -1,    -1,    -1,   654,    -1,    -1,    -1,    -1,     6,
+      -1,    -1,    -1,   889,   822,    12,    13,   667,    -1,    -1,
+      -1,    18,    19,    20,    21,    -1,   157,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    -1,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,     6,   153,   154,   155,   156,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,
+      21,    -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,
+      51,    52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,
+      -1,    72,    -1,    74,    75,    76,    77,    78,    79,    -1,
+      81,    -1,    83,    84,    85,    86,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,
+      -1,    -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,
+     131,   132,   133,   134,   135,   136,   137,    -1,   139,   140,
+     141,   142,    -1,    -1,   145,   146,    -1,    -1,   149,    -1,
+     151,     6,   153,   154,   155,   156,    -1,    12,    13,    -1,
+      -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,    24,
+      25,    -1,    -1,    28,    -1,    -1,    31,    -1,    -1,    -1,
+      -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    49,    -1,    51,    52,    -1,    -1,
+      -1,    56,    57,    -1,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,    74,
+      75,    76,    77,    78,    79,    -1,    81,    -1,    83,    84,
+      85,    86,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,   104,
+      -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,   124,
+     125,   126,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,   136,   137,    -1,   139,   140,   141,   142,    -1,    -1,
+     145,   146,    -1,    -1,   149,    -1,   151,     6,   153,   154,
+     155,   156,    -1,    12,    13,    -1,    -1,    -1,    -1,    18,
+      19,    20,    21,    -1,    -1,    24,    25,    -1,    -1,    28,
+      -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    37,    38,
+      -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      49,    -1,    51,    52,    -1,    -1,    -1,    56,    57,    -1,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    -1,    72,    -1,    74,    75,    76,    77,    78,
+      79,    -1,    81,    -1,    83,    84,    85,    86,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    96,    -1,    98,
+      99,   100,    -1,    -1,    -1,   104,    -1,    -1,    -1,   108,
+     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,   124,   125,   126,    -1,    -1,
+      -1,    -1,   131,   132,   133,   134,   135,   136,   137,    -1,
+     139,   140,   141,   142,    -1,    -1,   145,   146,    -1,    -1,
+     149,    -1,   151,     6,   153,   154,   155,   156,    -1,    12,
+      13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,    -1,
+      -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,    -1,
+      -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    49,    -1,    51,    52,
+      -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,
+      -1,    74,    75,    76,    77,    78,    79,    -1,    81,    -1,
+      83,    84,    85,    86,    -1,    -1,    89,    -1,    -1,    -1,
+      -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,
+      -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,
+      -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,   136,   137,    -1,   139,   140,   141,   142,
+      -1,    -1,   145,   146,    -1,    -1,   149,    -1,   151,     6,
+     153,   154,   155,   156,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,   139,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,   153,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,     5,
+      -1,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    81,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,   101,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,    -1,   118,    -1,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,    -1,   101,   102,   103,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    70,    71,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    81,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,    -1,   118,
-      -1,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,   150,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,   127,    -1,   129,   101,   102,   103,    -1,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,   153,    -1,
+      -1,   127,    -1,   129,    29,    30,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,    -1,   118,    -1,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,   150,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    -1,    -1,    12,    13,
+      -1,    -1,    -1,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    87,    -1,    28,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    37,    38,    -1,   101,   102,   103,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,   127,    -1,   129,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,   153,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,     9,    -1,   151,    12,    13,
+     154,   155,   156,    -1,    18,    19,    20,    21,    -1,    -1,
+      24,    25,    -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    -1,    -1,    -1,    -1,    43,
+      -1,    -1,    46,    -1,    -1,    49,    -1,    51,    -1,    -1,
+      -1,    -1,    56,    -1,    -1,    -1,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    69,    70,    -1,    72,    -1,
+      -1,    -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    96,    -1,    98,    99,   100,    -1,    -1,    -1,
+     104,    -1,    -1,    -1,   108,   109,   110,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
+     124,   125,    -1,    -1,    -1,    -1,    -1,   131,   132,   133,
+     134,   135,    -1,    -1,    -1,   139,    -1,    -1,   142,    -1,
+      -1,   145,    -1,    -1,    -1,    -1,    -1,   151,    -1,    -1,
+     154,   155,   156,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,
-      71,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      81,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,    -1,   118,    -1,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,   150,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    70,    71,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-      -1,   118,    -1,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    76,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    87,    -1,
-      89,    -1,    91,    92,    93,    -1,    -1,    -1,    97,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,   111,   112,   113,   114,    -1,   116,    -1,   118,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-      -1,    -1,    -1,    -1,    -1,   134,   135,   136,   137,   138,
-     139,    -1,   141,   142,   143,    -1,    -1,   146,   147,    -1,
-     149,    -1,   151,    -1,   153,   154,   155,   156,     3,     4,
-       5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    26,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    76,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    87,    -1,    89,    -1,    91,    92,    93,    -1,
-      -1,    -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,   111,   112,   113,   114,
-      -1,   116,    -1,   118,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,   136,   137,   138,   139,    -1,   141,   142,   143,    -1,
-      -1,   146,   147,    -1,   149,    -1,   151,    -1,   153,   154,
-     155,   156,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    26,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    76,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    87,    -1,    89,    -1,
-      91,    92,    93,    -1,    -1,    -1,    97,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-     111,   112,   113,   114,    -1,   116,    -1,   118,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,    -1,    -1,
-      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,    -1,
-     141,   142,   143,    -1,    -1,   146,   147,    -1,   149,    -1,
-     151,    -1,   153,   154,   155,   156,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,   152,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    76,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      87,    -1,    89,    -1,    91,    92,    93,    -1,    -1,    -1,
-      97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,   111,   112,   113,   114,    -1,   116,
-      -1,   118,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
-     137,   138,   139,    -1,   141,   142,   143,    -1,    -1,   146,
-     147,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
-       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,   127,    -1,   129,    29,    30,    -1,
+      -1,    -1,     5,    -1,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,    -1,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    29,    30,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,   101,
+     102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,   127,    -1,   129,   101,   102,
+     103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,   150,    91,
+      92,    93,    94,    95,   127,    97,   129,    -1,    -1,   101,
+     102,   103,    -1,    -1,     5,    -1,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   127,    -1,   129,    29,    30,
+      -1,    -1,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    76,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    87,    -1,    89,    -1,    91,    92,
-      93,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,   111,   112,
-     113,   114,    -1,   116,    -1,   118,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,   136,   137,   138,   139,    -1,   141,   142,
-     143,    -1,    -1,   146,   147,    -1,   149,    -1,   151,    -1,
-     153,   154,   155,   156,     3,     4,     5,     6,     7,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,
-      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,
-      -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,
-      -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   121,   122,   123,   124,   125,   126,   127,   128,
-       3,     4,     5,     6,     7,    -1,   135,   136,   137,    12,
-      -1,    -1,   141,    -1,    -1,    -1,    -1,   146,    -1,    -1,
-      -1,    -1,   151,    -1,    -1,   154,   155,   156,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,
-      43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,
-      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
-      -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,
-      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,
-     123,   124,   125,   126,   127,   128,     3,     4,     5,     6,
-       7,    -1,   135,   136,   137,    12,    -1,    -1,   141,    -1,
-      -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,
-     153,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,
-      -1,    48,    -1,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,
-      -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,
-      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,
-      -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,   126,
-     127,   128,     3,     4,     5,     6,     7,    -1,   135,   136,
-     137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,    -1,    -1,    -1,
+     101,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,   127,    -1,   129,   101,
+     102,   103,    -1,    -1,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,   150,
+      -1,    28,    -1,    -1,    31,   127,    -1,   129,    -1,    36,
+      37,    38,    -1,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,   150,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,    -1,   145,   146,
+      -1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,    -1,   145,   146,    -1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      62,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,    -1,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    64,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,    -1,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,   150,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    22,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    36,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    90,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,   150,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    31,
+      -1,    -1,    -1,    -1,    36,    37,    38,    -1,    -1,    -1,
+      -1,    43,    44,    -1,    46,    47,    -1,    49,    -1,    51,
+      52,    -1,    -1,    -1,    56,    57,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    83,    84,    85,    86,    -1,    -1,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,   126,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,   145,   146,    -1,    -1,   149,    -1,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    31,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    49,    -1,    51,    52,    -1,    -1,    -1,    56,
+      57,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    -1,    81,    -1,    83,    84,    85,    86,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,   126,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,   136,
+     137,    -1,   139,   140,   141,   142,    -1,    -1,   145,   146,
+      -1,    -1,   149,    -1,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    -1,    -1,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,    -1,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,    -1,    -1,    -1,   139,    -1,    -1,
+     142,    -1,    -1,   145,    -1,    -1,    -1,    -1,    -1,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,   139,    -1,    -1,   142,    -1,    -1,   145,    -1,
       -1,    -1,    -1,    -1,   151,    -1,   153,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    -1,    -1,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,    -1,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,    -1,    -1,    -1,   139,    -1,    -1,
+     142,    -1,    -1,   145,    -1,    -1,    -1,    -1,    -1,   151,
+      -1,   153,   154,   155,   156,    12,    13,    -1,    -1,    -1,
+      -1,    18,    19,    20,    21,    -1,    -1,    24,    25,    -1,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    46,
+      -1,    -1,    49,    -1,    51,    -1,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    -1,    72,    -1,    -1,    -1,    76,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,    -1,   104,    -1,    -1,
+      -1,   108,   109,   110,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,    -1,    -1,    -1,   124,   125,    -1,
+      -1,    -1,    -1,    -1,   131,   132,   133,   134,   135,    -1,
+      -1,    -1,   139,    -1,    -1,   142,    -1,    -1,   145,    -1,
+      -1,    -1,    -1,    -1,   151,   152,    -1,   154,   155,   156,
+      12,    13,    -1,    -1,    -1,    -1,    18,    19,    20,    21,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    -1,    -1,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,    -1,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,    -1,    -1,    -1,   139,    -1,    -1,
+     142,    -1,    -1,   145,    -1,    -1,    -1,    -1,    -1,   151,
+      12,    13,   154,   155,   156,    -1,    18,    19,    20,    21,
+      -1,    -1,    24,    25,    -1,    -1,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    -1,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    49,    -1,    51,
+      -1,    -1,    -1,    -1,    56,    -1,    -1,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      72,    -1,    -1,    -1,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,   108,   109,   110,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,    -1,
+      -1,    -1,   124,   125,    -1,    -1,    -1,    -1,    -1,   131,
+     132,   133,   134,   135,    -1,    -1,    -1,   139,    -1,    -1,
+     142,    -1,    -1,   145,    -1,    -1,    -1,    -1,    -1,   151,
+      -1,    -1,   154,   155,   156,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    -1,    -1,    -1,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    -1,    -1,    29,    30,
+      -1,    -1,    -1,    -1,    -1,     5,    -1,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    29,
+      30,    91,    92,    93,    94,    95,    -1,    97,    -1,    -1,
+      -1,   101,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    87,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    -1,    97,   127,    -1,   129,
+     101,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,
+      -1,    91,    92,    93,    94,    95,   127,    97,   129,    -1,
+      -1,   101,   102,   103,    -1,    -1,     5,    -1,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,
+      29,    30,    -1,     5,    -1,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    -1,
+       5,    -1,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    -1,    -1,    87,    -1,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
+      -1,    -1,   101,   102,   103,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    91,
+      92,    93,    94,    95,    -1,    97,    -1,    -1,   127,   101,
+     129,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,
+      95,    -1,    97,    -1,    -1,   127,   101,   129,    -1,    -1,
+      -1,     5,    -1,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   127,    -1,   129,    29,    30,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    -1,    97,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    -1,    -1,    87,    -1,    -1,
+      -1,    91,    92,    93,    94,    95,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,   127,    -1,   129,    -1,    -1,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      -1,    97,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    -1,
+      -1,   127,    -1,   129,    87,    -1,    -1,    -1,    91,    92,
+      93,    94,    95,    -1,    97,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-      91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,
-     111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,   123,   124,   125,   126,   127,   128,     3,     4,
-       5,     6,     7,    -1,   135,   136,   137,    12,    -1,    -1,
-     141,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,
-     151,    -1,   153,   154,   155,   156,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,
-      -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,
-      -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,
-      -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,
-     125,   126,   127,   128,    -1,     3,     4,     5,     6,     7,
-     135,   136,   137,    -1,    12,    -1,   141,    -1,    -1,    -1,
-      -1,   146,    -1,    -1,    -1,    -1,   151,   152,    26,   154,
-     155,   156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,    31,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,   141,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    31,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
-     156,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,     3,
-       4,     5,     6,     7,    -1,   135,   136,   137,    12,    -1,
-      -1,   141,    -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    31,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,
-      -1,    -1,    -1,    -1,    48,    -1,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,
-      -1,    -1,    86,    -1,    -1,    -1,    -1,    91,    92,    -1,
-      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,   108,    -1,    -1,   111,   112,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,   122,   123,
-     124,   125,   126,   127,   128,     3,     4,     5,     6,     7,
-      -1,   135,   136,   137,    12,    -1,    -1,   141,    -1,    -1,
-      -1,    -1,   146,    -1,    -1,    -1,    -1,   151,    -1,    -1,
-     154,   155,   156,    31,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    42,    43,    -1,    -1,    -1,    -1,
-      48,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,    86,    -1,
-      -1,    -1,    -1,    91,    92,    -1,    -1,    -1,    -1,    -1,
-      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,
-     108,    -1,    -1,   111,   112,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   121,   122,   123,   124,   125,   126,   127,
-     128,     3,     4,     5,     6,     7,    -1,   135,   136,   137,
-      12,    -1,    -1,   141,    -1,    -1,    -1,    -1,   146,    -1,
-      -1,    -1,    -1,   151,    -1,    -1,   154,   155,   156,    31,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      42,    43,    -1,    -1,    -1,    -1,    48,    -1,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-      92,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   106,    -1,   108,    -1,    -1,   111,
-     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,
-     122,   123,   124,   125,   126,   127,   128,     3,     4,     5,
-       6,     7,    -1,   135,   136,   137,    12,    -1,    -1,   141,
-      -1,    -1,    -1,    -1,   146,    -1,    -1,    -1,    -1,   151,
-      -1,    -1,   154,   155,   156,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    -1,    -1,
-      -1,    -1,    48,    -1,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    82,    -1,    -1,    -1,
-      86,    -1,    -1,    -1,    -1,    91,    92,    -1,    -1,    -1,
-      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     106,    -1,   108,    -1,    -1,   111,   112,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   121,   122,   123,   124,   125,
-     126,   127,   128,     3,     4,     5,     6,     7,    -1,   135,
-     136,   137,    12,    -1,    -1,   141,    -1,    -1,    -1,    -1,
-     146,    -1,    -1,    -1,    -1,   151,    -1,    -1,   154,   155,
-     156,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    42,    43,    -1,    -1,    -1,    -1,    48,    -1,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,
-      -1,    91,    92,    -1,    -1,    -1,    -1,    -1,    98,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   106,    -1,   108,    -1,
-      -1,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   121,   122,   123,   124,   125,   126,   127,   128,    -1,
-      -1,    -1,    -1,    -1,    -1,   135,   136,   137,    -1,    -1,
-      -1,   141,     9,    10,    11,    -1,   146,    -1,    -1,    -1,
-      -1,   151,    -1,    -1,   154,   155,   156,    -1,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
-      -1,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    -1,    49,     9,    10,    11,    -1,    -1,    -1,
+      10,    11,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,   129,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    91,    92,    93,    94,    95,    87,    97,
+      -1,    -1,    91,    92,    93,    94,    95,    -1,    97,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    25,   153,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   153,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   153,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,
+      -1,   129,    -1,    -1,    -1,    -1,    -1,    87,   127,    -1,
+     129,    91,    92,    93,    94,    95,    -1,    97,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    25,   153,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,    -1,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   152,    25,    -1,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,     9,
-      10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   152,    25,    -1,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
-      -1,    -1,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   152,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49,    -1,     9,    10,    11,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   152,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,     9,    10,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,   152,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    -1,    -1,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   152,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   152,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,   152,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,    -1,     9,    10,    11,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   150,    25,    -1,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    -1,    49,     9,    10,    11,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   150,    25,    -1,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    -1,    49,     9,    10,
-      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    25,   150,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
-       9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    25,   150,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
-      49,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   150,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      -1,    49,    -1,    -1,     9,    10,    11,    96,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    -1,    49,     9,    10,    11,    96,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,    -1,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    -1,    49,    10,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,    -1,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    11,    49,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    -1,    49
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,    -1,   129
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   159,   160,     0,     3,     4,     5,     6,     7,    12,
-      42,    43,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    70,    71,    72,
-      73,    76,    81,    82,    85,    86,    87,    89,    91,    92,
-      93,    97,    98,   106,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   118,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   146,   147,   149,   151,   153,   154,
+       0,   159,   160,     0,    12,    13,    18,    19,    20,    21,
+      22,    24,    25,    28,    31,    36,    37,    38,    42,    43,
+      44,    46,    47,    49,    51,    52,    56,    57,    60,    69,
+      70,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    83,    84,    85,    86,    89,    90,    96,    98,    99,
+     100,   104,   108,   109,   110,   111,   113,   120,   124,   125,
+     126,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   145,   146,   149,   151,   153,   154,
      155,   156,   161,   162,   167,   170,   171,   177,   178,   180,
      182,   185,   187,   242,   243,   246,   249,   252,   261,   264,
      268,   269,   271,   272,   280,   281,   282,   283,   284,   285,
-     286,   287,   292,   300,   306,   304,   303,   151,   302,   301,
-      72,   126,   136,   246,   268,   268,   268,   268,   268,   268,
-     268,   268,   268,   268,   268,   268,    72,   126,   128,   161,
-     252,   271,   272,   282,   271,   268,    31,   268,   295,   296,
-     268,   126,   128,   161,   252,   254,   255,   282,   285,   286,
-     292,    81,    81,   146,   212,   246,   151,   153,   268,   136,
-     153,   268,   151,   170,   235,   268,   151,   151,   258,   151,
-     151,   146,   155,   210,   211,   136,   151,   151,   151,   151,
-     128,   149,   161,   161,   153,   243,   268,   272,    88,    95,
-      99,   103,   146,   297,   298,    26,   151,   268,   149,   151,
-     128,   161,   165,   166,   151,   168,   242,   268,    99,   259,
-     297,   149,    99,   297,   128,   151,     8,   153,   136,   136,
-      31,   179,    61,   133,     9,    10,    11,    25,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    49,
-     153,    58,    59,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,   151,   133,    61,   273,    61,
-     149,   155,   286,   268,   268,   268,   268,   268,   179,   128,
-     161,   133,   133,   270,   272,    96,   157,     8,   266,   128,
-     161,   133,   151,   260,   133,   130,   286,    13,     8,   153,
-     179,   295,   153,    13,   153,   136,   196,   147,     8,   153,
-     272,   152,   268,   236,   237,   268,   243,   272,   149,   269,
-     272,     8,   153,   153,   152,   268,   272,   305,   123,   272,
-     293,   294,   161,   164,   149,   153,   151,   153,   153,   272,
-     137,   268,   103,   298,    61,   130,    99,   103,   298,   268,
-     153,   168,   175,   176,   272,   161,    74,     8,   153,   268,
-     115,   150,   169,   170,   177,   178,   152,   152,   154,   268,
-     156,   136,   250,   136,   107,   186,   107,   188,   136,   151,
-     268,   288,   136,   149,   280,   286,   291,   292,   268,   268,
-     268,    26,   268,   268,   268,   268,   268,   268,   268,   268,
+     286,   287,   292,   300,   306,   108,   132,   133,   246,   268,
+     268,   268,   268,   268,     9,   268,   295,   296,    36,   151,
+     268,   268,   153,   268,   268,   133,   153,   268,   108,   111,
+     132,   161,   252,   271,   272,   282,   151,   170,   268,   235,
+     268,   151,   151,   151,   258,    36,   151,   151,   145,   155,
+     210,   211,   133,   151,   151,   271,   301,   302,   268,   151,
+     151,   111,   149,   161,   108,   111,   161,   252,   254,   255,
+     282,   285,   286,   292,   161,   268,   268,   303,   304,   153,
+     243,   268,   272,    45,    54,    61,    65,   145,   297,   298,
+     145,   212,   246,     6,   268,   151,   268,   149,   151,   268,
+     111,   161,   165,   166,   151,   168,   242,   268,    61,   259,
+     297,   149,    61,   297,   111,   151,     3,   153,   133,   133,
+       9,   179,    21,   118,     5,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    29,    30,    87,    91,
+      92,    93,    94,    95,    97,   101,   102,   103,   127,   129,
+     153,    46,    83,     4,    23,    41,    50,   105,   106,   107,
+     117,   119,   128,   130,   148,   151,   118,    21,   273,    21,
+     149,   155,   286,   179,   270,   272,    55,   157,     3,   266,
+     295,   153,     4,   153,   111,   161,   118,   118,   133,   196,
+     146,     3,   153,   272,   268,   152,   268,   236,   237,   268,
+     243,   272,   149,   269,   272,     3,   153,   153,   152,   268,
+     268,   268,   272,   305,    99,   272,   293,   294,   161,   164,
+     149,   153,   111,   161,   118,   151,   260,   118,   114,   286,
+     151,   268,   268,   153,   153,   272,   135,   268,    65,   298,
+      21,   114,    61,    65,   298,     4,     3,   153,   179,   268,
+     153,   168,   175,   176,   272,   161,    26,     3,   153,   268,
+      80,   150,   169,   170,   177,   178,   152,   152,   154,   268,
+     156,   133,   250,   133,    71,   186,    71,   188,   133,   151,
+     268,   288,   133,   149,   280,   286,   291,   292,     6,   268,
      268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
-     268,   268,   268,   268,   254,    31,   268,   268,   268,   268,
-     268,   268,   268,   268,   268,   268,   268,   268,    31,   208,
-     209,   243,   272,   136,   280,   291,   288,   130,   288,   268,
-     152,   161,   136,    31,   268,    31,   268,   161,   280,   208,
-     280,   280,   289,   290,   291,    42,    43,    61,    73,    82,
-     126,   128,   135,   161,   252,   261,   262,   263,   146,   151,
-     152,   262,    13,     8,   152,   151,   268,   152,   152,   153,
-       8,    74,    74,   268,   211,   153,   152,     8,   152,   151,
-       8,   152,   151,   160,   163,   251,   150,    61,   150,   129,
-     136,   146,   299,   136,   152,   150,     8,   152,    74,   136,
-     166,   152,   151,    61,   130,   238,   239,   240,   241,   276,
-     150,   208,    13,   126,   128,   161,   253,   117,   189,   190,
-     253,   184,   151,    73,    77,   205,   206,   207,   253,   157,
-     268,   151,   151,   286,   268,    26,    63,   272,   270,   152,
-       8,   151,   151,   157,   289,   157,   150,   270,   270,    96,
-     152,   256,    61,   149,   262,   262,   262,   265,   267,   151,
-     128,   161,    99,   133,    13,   205,   262,   136,    26,   170,
-     195,   268,   236,   268,   272,    31,   192,   272,   150,    26,
-     170,   272,   293,   294,    13,   208,   150,   160,   208,   268,
-     157,    26,   149,   197,    79,   176,   153,   136,    26,   170,
-     200,   152,   288,   289,   276,    61,   238,   152,   262,   128,
-     161,   190,   183,     8,   149,   205,   152,     8,    31,   146,
-     150,   208,   208,   268,   254,    31,   243,   272,   208,   208,
-     151,   277,   278,   279,    31,   268,   130,   257,   288,   268,
-      96,   157,     8,   266,   265,   161,   136,   262,   152,    13,
-     168,   152,   153,    96,   191,   272,   191,   168,   201,   152,
-     268,   152,   150,   152,   157,   153,   198,   153,   198,   151,
+     268,   268,   268,   254,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,     9,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,     9,   208,
+     209,   243,   272,   133,   280,   291,   288,   114,   288,   268,
+       9,   268,     9,   268,   152,    12,    13,    21,    24,    37,
+     108,   111,   131,   161,   252,   261,   262,   263,   161,   133,
+       4,     3,   152,   151,   268,   152,   152,   152,   153,     3,
+      26,    26,   268,   211,   153,   152,     3,   152,   151,     3,
+     152,   151,   160,   163,   161,   280,   208,   280,   280,   289,
+     290,   291,   251,   150,    21,   150,   112,   133,   145,   299,
+     133,   262,   145,   151,   152,   150,     3,   152,    26,   133,
+     166,   152,   151,    21,   114,   238,   239,   240,   241,   276,
+     150,   208,     4,   108,   111,   161,   253,    82,   189,   190,
+     253,   184,   151,    24,    32,   205,   206,   207,   253,   157,
+     268,   151,   151,   286,   268,     6,   109,   272,   270,   152,
+       3,   151,   151,   157,   289,   157,   150,   270,   270,    55,
+     262,   262,   262,   265,   267,   151,   111,   161,    61,   118,
+     262,   133,     6,   170,   195,   268,   236,   268,   272,     9,
+     192,   272,   150,     6,   170,   272,   293,   294,     4,   208,
+     150,   160,   152,   256,    21,   149,   208,   268,   157,     4,
+     205,     6,   149,   197,    34,   176,   153,   133,     6,   170,
+     200,   152,   288,   289,   276,    21,   238,   152,   262,   111,
+     161,   190,   183,     3,   149,   205,   152,     3,     9,   145,
+     150,   208,   208,   268,   254,     9,   243,   272,   208,   208,
+     151,   277,   278,   279,     9,   268,    55,   157,     3,   266,
+     265,   161,   133,     4,   168,   152,   153,    55,   191,   272,
+     191,   168,   201,   152,   268,   152,   150,   114,   257,   288,
+     268,   152,   157,   262,   152,   153,   198,   153,   198,   151,
      168,   153,   157,   279,   288,   161,   149,   253,   213,   152,
-     144,   247,   207,   146,    13,   152,   152,   260,   270,   152,
-     152,   208,    61,    61,   274,   270,   289,   157,   150,   262,
-     262,   152,   247,   262,   100,   153,   236,   192,   152,   152,
-     202,    64,    65,   203,   150,   198,    78,    90,   104,   198,
-     150,   253,   105,   157,   213,    67,    68,    69,    70,    71,
-      72,    85,   144,   145,   150,   214,   216,   229,   230,   231,
-     232,   234,   181,   151,   149,    31,   146,    13,   262,   152,
-     288,   288,   275,    96,   149,   153,   152,    26,   170,   194,
-     194,    64,    65,   204,   151,   170,   104,   268,    26,   153,
-     199,   153,   150,   146,   153,   150,   136,   217,   253,   146,
-     233,   246,   232,     8,   153,   149,    31,   146,   248,   244,
-     146,    13,   262,   157,   157,   276,   262,   245,    26,   170,
-     193,   168,   151,    26,    66,   268,   153,   199,   168,   152,
-      13,     8,   149,   153,   218,    13,     8,   153,   179,   136,
-     168,   146,     8,   152,   168,    13,   262,   168,   168,   102,
-     268,   168,   153,   152,   168,   149,   262,   253,   136,   219,
-     220,   221,   222,   224,   225,   226,   253,   262,   146,   136,
-      13,   150,    31,   146,   150,   262,   150,   101,   153,   152,
-     170,   168,   150,   221,   153,    74,   119,   153,   133,    13,
-     151,   262,   146,   153,    26,   150,   227,   232,   223,   253,
-     136,   262,   205,   168,    79,   172,   173,   174,   136,     8,
-     152,   151,   174,   253,   215,   253,   149,   153,   228,   146,
+     143,   247,   207,   145,     4,   152,   152,   260,   270,   152,
+     152,   208,    21,    21,   274,   270,   262,   262,   152,   262,
+      62,   153,   236,   192,   152,   152,   202,    58,    59,   203,
+     289,   157,   150,   150,   247,   198,    33,    48,    67,   198,
+     150,   253,    68,   157,   213,    22,    42,    73,   121,   122,
+     123,   132,   143,   144,   150,   214,   216,   229,   230,   231,
+     232,   234,   181,   151,   149,     9,   145,     4,   262,   152,
+     288,   288,   275,    55,   153,   152,     6,   170,   194,   194,
+      58,    59,   204,   170,   151,   149,    67,   268,     6,   153,
+     199,   153,   150,   145,   153,   150,   133,   217,   253,   145,
+     233,   246,   232,     3,   153,   149,     9,   145,   248,   244,
+     145,     4,   262,   157,   157,   276,   262,     6,   170,   193,
+     168,     6,   151,    66,   268,   245,   153,   199,   168,   152,
+       4,     3,   149,   153,   218,     4,     3,   153,   179,   133,
+     168,   145,     3,   152,   168,     4,   262,   168,    64,   168,
+     268,   153,   152,   168,   168,   149,   262,   253,   133,   219,
+     220,   221,   222,   224,   225,   226,   253,   262,   145,   133,
+       4,   150,     9,   145,   150,   262,    63,   153,   152,   170,
+     150,   168,   150,   221,   153,    26,    88,   153,   118,     4,
+     151,   262,   145,   153,     6,   150,   227,   232,   223,   253,
+     133,   262,   205,   168,    34,   172,   173,   174,   133,     3,
+     152,   151,   174,   253,   215,   253,   149,   153,   228,   145,
      168,   152,   150,   149,   168,   150
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
+     162,   162,   163,   162,   164,   162,   162,   162,   165,   165,
+     166,   166,   166,   166,   167,   167,   168,   168,   169,   169,
+     169,   169,   170,   170,   171,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
+     171,   172,   172,   173,   173,   174,   175,   175,   176,   177,
+     178,   179,   179,   181,   180,   183,   182,   184,   182,   185,
+     185,   185,   185,   186,   186,   187,   188,   188,   189,   189,
+     190,   190,   191,   191,   192,   192,   193,   193,   194,   194,
+     195,   195,   196,   196,   197,   197,   197,   197,   198,   198,
+     198,   199,   199,   200,   200,   201,   201,   202,   202,   203,
+     203,   204,   204,   205,   205,   206,   206,   206,   206,   206,
+     206,   206,   206,   207,   207,   207,   207,   208,   208,   209,
+     209,   209,   209,   209,   209,   210,   210,   211,   211,   211,
+     212,   212,   212,   212,   213,   213,   214,   214,   214,   215,
+     214,   216,   217,   217,   218,   218,   219,   219,   220,   220,
+     221,   221,   222,   223,   223,   224,   224,   225,   226,   226,
+     227,   227,   228,   228,   229,   229,   230,   230,   231,   231,
+     232,   232,   232,   232,   232,   232,   233,   233,   233,   233,
+     234,   234,   235,   235,   236,   236,   237,   237,   238,   238,
+     239,   239,   240,   240,   240,   241,   241,   242,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   244,   243,   245,
+     243,   246,   247,   247,   248,   248,   248,   248,   250,   249,
+     249,   251,   249,   249,   249,   249,   249,   249,   252,   252,
+     252,   252,   253,   253,   253,   254,   254,   255,   255,   256,
+     256,   257,   258,   258,   258,   259,   259,   259,   260,   260,
+     261,   261,   261,   261,   261,   261,   261,   261,   261,   261,
+     261,   261,   262,   262,   262,   262,   262,   262,   262,   262,
+     262,   262,   263,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   265,   265,   266,   266,   267,   267,   267,   267,
+     268,   268,   269,   270,   271,   273,   274,   272,   272,   275,
+     275,   276,   277,   277,   278,   279,   279,   279,   280,   280,
+     281,   281,   282,   283,   283,   284,   284,   284,   285,   285,
+     285,   286,   286,   286,   287,   287,   288,   288,   289,   289,
+     290,   290,   290,   291,   291,   292,   292,   293,   293,   294,
+     294,   294,   295,   295,   296,   296,   296,   296,   296,   296,
+     296,   296,   297,   297,   297,   297,   298,   298,   298,   298,
+     298,   298,   299,   299,   299,   300,   300,   301,   300,   302,
+     300,   300,   303,   300,   304,   300,   305,   305,   306,   306
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     1,     3,     1,     1,     1,
+       4,     3,     0,     6,     0,     5,     3,     2,     3,     1,
+       1,     3,     2,     4,     5,     4,     2,     0,     1,     1,
+       1,     4,     1,     2,     3,     7,    10,     5,     7,     9,
+       5,     2,     3,     2,     3,     2,     3,     3,     3,     3,
+       3,     1,     2,     5,     8,     8,     5,     1,    13,     3,
+       3,     1,     0,     1,     2,     8,     1,     3,     1,     1,
+       1,     0,     1,     0,    10,     0,     8,     0,     7,     1,
+       2,     1,     2,     0,     2,     1,     0,     2,     0,     2,
+       1,     3,     0,     2,     1,     2,     1,     4,     1,     4,
+       1,     4,     3,     5,     3,     4,     4,     5,     0,     5,
+       4,     1,     1,     1,     4,     0,     6,     0,     7,     0,
+       2,     0,     3,     1,     0,     2,     3,     5,     4,     4,
+       5,     7,     6,     0,     1,     1,     1,     1,     0,     1,
+       1,     2,     3,     3,     4,     3,     1,     1,     2,     4,
+       3,     5,     1,     3,     2,     0,     3,     2,     1,     0,
+       9,     3,     1,     3,     1,     3,     0,     1,     1,     2,
+       2,     2,     3,     1,     3,     1,     1,     3,     4,     3,
+       0,     1,     1,     3,     1,     1,     0,     1,     1,     2,
+       1,     1,     1,     1,     1,     1,     3,     5,     1,     3,
+       5,     4,     3,     1,     0,     1,     3,     1,     2,     1,
+       4,     3,     2,     1,     1,     0,     1,     3,     6,     3,
+       4,     6,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     2,     2,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     4,
+       5,     4,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     1,     4,     3,     3,     2,     0,    10,     0,
+      11,     1,     0,     4,     3,     4,     1,     2,     0,     5,
+       6,     0,     6,     6,     6,     6,     6,     4,     1,     1,
+       3,     2,     1,     3,     2,     1,     1,     4,     1,     2,
+       0,     2,     0,     2,     3,     0,     1,     1,     0,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     2,     1,     1,     3,     2,     2,     2,     4,     1,
+       3,     1,     3,     1,     1,     1,     3,     2,     1,     3,
+       3,     1,     0,     2,     0,     1,     5,     3,     3,     1,
+       1,     1,     1,     1,     1,     0,     0,     7,     1,     2,
+       0,     3,     4,     4,     3,     1,     1,     0,     1,     2,
+       3,     3,     1,     4,     4,     1,     1,     1,     1,     2,
+       1,     4,     4,     1,     1,     4,     0,     1,     1,     1,
+       4,     4,     1,     1,     3,     1,     2,     3,     1,     1,
+       4,     0,     0,     2,     5,     3,     3,     1,     6,     4,
+       4,     2,     2,     2,     1,     2,     1,     4,     3,     3,
+       6,     3,     1,     1,     1,     4,     4,     0,     3,     0,
+       3,     4,     0,     3,     0,     3,     1,     3,     3,     3
+};
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
 
+enum { YYENOMEM = -2 };
 
-/* This macro is provided for backward compatibility. */
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = PHP54_RESOURCE_EMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == PHP54_RESOURCE_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (analyzer, observers, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use PHP54_RESOURCE_error or PHP54_RESOURCE_UNDEF. */
+#define YYERRCODE PHP54_RESOURCE_UNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, analyzer, observers)
-#endif
 
 /* Enable debugging if requested.  */
-#if YYDEBUG
+#if PHP54_RESOURCE_DEBUG
 
 # ifndef YYFPRINTF
 #  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, analyzer, observers); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, analyzer, observers); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yyvaluep)
     return;
-  YYUSE (analyzer);
-  YYUSE (observers);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, analyzer, observers);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, analyzer, observers);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -3191,16 +3525,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, analyzer, observers)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -3211,65 +3537,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule, analyzer, observers)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , analyzer, observers);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], analyzer, observers);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, analyzer, observers); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, analyzer, observers); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+#else /* !PHP54_RESOURCE_DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
+#endif /* !PHP54_RESOURCE_DEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -3283,49 +3600,118 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
 
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-#if YYERROR_VERBOSE
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yypstate* yyps;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypstate_expected_tokens (yypstate *yyps,
+                          yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyps->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+/* Similar to the previous function.  */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  return yypstate_expected_tokens (yyctx->yyps, yyarg, yyargn);
+}
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static char *
 yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
 {
   char *yyd = yydest;
   const char *yys = yysrc;
@@ -3335,10 +3721,10 @@ yystpcpy (yydest, yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -3346,75 +3732,56 @@ yystpcpy (yydest, yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -3437,60 +3804,79 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
   if (*yymsg_alloc < yysize)
     {
@@ -3498,7 +3884,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -3510,144 +3896,161 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep, analyzer, observers)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
-  YYUSE (yyvaluep);
-  YYUSE (analyzer);
-  YYUSE (observers);
-
+  YY_USE (yyvaluep);
+  YY_USE (analyzer);
+  YY_USE (observers);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
-/*----------.
-| yyparse.  |
-`----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
-#else
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      yyerror (analyzer, observers, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, analyzer, observers);
+  yypstate_delete (yyps);
+  return yystatus;
+}
+
 int
-yyparse (analyzer, observers)
-    pelet::LexicalAnalyzerClass &analyzer;
-    pelet::ResourceParserObserverClass &observers;
-#endif
-#endif
+yypull_parse (yypstate *yyps, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
 {
-/* The lookahead symbol.  */
-int yychar;
+  YY_ASSERT (yyps);
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, analyzer, observers);
+    yystatus = yypush_parse (yyps, yychar, &yylval, analyzer, observers);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
+#define php54_resource_nerrs yyps->php54_resource_nerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-    /* Number of syntax errors so far.  */
-    int yynerrs;
+  yyssp = yyss;
+  yyvsp = yyvs;
 
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
 
-    YYSIZE_T yystacksize;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
+
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass &observers)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3655,111 +4058,121 @@ YYSTYPE yylval;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+    case 2:
+      yypstate_clear (yyps);
+      break;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+    default:
+      break;
+    }
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = PHP54_RESOURCE_EMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -3770,18 +4183,39 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == PHP54_RESOURCE_EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= T_END)
     {
-      yychar = yytoken = YYEOF;
+      yychar = T_END;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == PHP54_RESOURCE_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = PHP54_RESOURCE_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3809,13 +4243,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = PHP54_RESOURCE_EMPTY;
   goto yynewstate;
 
 
@@ -3830,14 +4264,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -3850,545 +4284,475 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-
-/* Line 1806 of yacc.c  */
-#line 360 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.MakeAst((yyvsp[(1) - (1)].statementList)); }
+  case 2: /* start: top_statement_list  */
+#line 361 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { if (analyzer.WasCancelled()) { YYABORT; } if (!observers.DoNotifyEachStatement) { observers.MakeAst((yyvsp[0].statementList)); } }
+#line 4291 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 3:
-
-/* Line 1806 of yacc.c  */
-#line 364 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList)->PushAll((yyvsp[(2) - (2)].statementList)); }
+  case 3: /* top_statement_list: top_statement_list top_statement  */
+#line 365 "/root/repo/src/Php54ResourceParser.y"
+                                                                { if (observers.DoNotifyEachStatement && observers.IsAtTopLevel()) { observers.MakeAst((yyvsp[0].statementList)); observers.ReleaseStatements((yyvsp[-1].statementList)); (yyval.statementList) = (yyvsp[-1].statementList); } 
+												  else { (yyval.statementList) = (yyvsp[-1].statementList)->PushAll((yyvsp[0].statementList)); } }
+#line 4298 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 4:
-
-/* Line 1806 of yacc.c  */
-#line 365 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 4: /* top_statement_list: %empty  */
+#line 367 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4304 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 5:
-
-/* Line 1806 of yacc.c  */
-#line 369 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, (yyvsp[(1) - (1)].lexeme)); }
+  case 5: /* namespace_name: T_STRING  */
+#line 371 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, (yyvsp[0].lexeme)); }
+#line 4310 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 6:
-
-/* Line 1806 of yacc.c  */
-#line 370 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (3)].qualifiedName)->AppendName((yyvsp[(3) - (3)].lexeme)); }
+  case 6: /* namespace_name: namespace_name T_NS_SEPARATOR T_STRING  */
+#line 372 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[-2].qualifiedName)->AppendName((yyvsp[0].lexeme)); }
+#line 4316 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 7:
-
-/* Line 1806 of yacc.c  */
-#line 374 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 7: /* top_statement: statement  */
+#line 376 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4322 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 8:
-
-/* Line 1806 of yacc.c  */
-#line 375 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 8: /* top_statement: function_declaration_statement  */
+#line 377 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4328 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 9:
-
-/* Line 1806 of yacc.c  */
-#line 376 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 9: /* top_statement: class_declaration_statement  */
+#line 378 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4334 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 10:
-
-/* Line 1806 of yacc.c  */
-#line 377 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 10: /* top_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 379 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = 0; }
+#line 4340 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 11:
-
-/* Line 1806 of yacc.c  */
-#line 378 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(2) - (3)].qualifiedName), (yyvsp[(1) - (3)].token));  
+  case 11: /* top_statement: T_NAMESPACE namespace_name ';'  */
+#line 380 "/root/repo/src/Php54ResourceParser.y"
+                                                                { pelet::NamespaceDeclarationClass* decl;
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-1].qualifiedName), (yyvsp[-2].token));  
 												  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, decl);
-												  observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); 
+												  observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); 
 												}
+#line 4350 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 12:
-
-/* Line 1806 of yacc.c  */
-#line 383 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetDeclaredNamespace((yyvsp[(2) - (3)].qualifiedName)); }
+  case 12: /* $@1: %empty  */
+#line 385 "/root/repo/src/Php54ResourceParser.y"
+                                                                { observers.SetDeclaredNamespace((yyvsp[-1].qualifiedName)); observers.BeginNamespaceBlock(); }
+#line 4356 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 384 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(2) - (6)].qualifiedName), (yyvsp[(1) - (6)].token));
-												  (yyval.statementList) = (yyvsp[(5) - (6)].statementList)->PushFront(decl);
+  case 13: /* top_statement: T_NAMESPACE namespace_name '{' $@1 top_statement_list '}'  */
+#line 386 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { pelet::NamespaceDeclarationClass* decl;
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-4].qualifiedName), (yyvsp[-5].token));
+												  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(decl); observers.EndNamespaceBlock();
 												}
+#line 4365 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 14:
-
-/* Line 1806 of yacc.c  */
-#line 388 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetDeclaredNamespace(NULL); }
+  case 14: /* $@2: %empty  */
+#line 390 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { observers.SetDeclaredNamespace(NULL); observers.BeginNamespaceBlock(); }
+#line 4371 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 15:
-
-/* Line 1806 of yacc.c  */
-#line 389 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { 
+  case 15: /* top_statement: T_NAMESPACE '{' $@2 top_statement_list '}'  */
+#line 391 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { 
 												  pelet::NamespaceDeclarationClass* decl;
-												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[(1) - (5)].token));
-												  (yyval.statementList) = (yyvsp[(4) - (5)].statementList)->PushFront(decl);
+												  AST_INIT_ARGS(decl, pelet::NamespaceDeclarationClass, (yyvsp[-4].token));
+												  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(decl); observers.EndNamespaceBlock();
 												}
+#line 4381 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 16:
-
-/* Line 1806 of yacc.c  */
-#line 394 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = pelet::NamespaceUseClass::SetStartingPos((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].token)); }
+  case 16: /* top_statement: T_USE use_declarations ';'  */
+#line 396 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = pelet::NamespaceUseClass::SetStartingPos((yyvsp[-1].statementList), (yyvsp[-2].token)); }
+#line 4387 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 17:
-
-/* Line 1806 of yacc.c  */
-#line 395 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (2)].statementList)); }
+  case 17: /* top_statement: constant_declaration ';'  */
+#line 397 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statementList)); }
+#line 4393 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 18:
-
-/* Line 1806 of yacc.c  */
-#line 400 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].namespaceUse)); }
+  case 18: /* use_declarations: use_declarations ',' use_declaration  */
+#line 402 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].namespaceUse)); }
+#line 4399 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 19:
-
-/* Line 1806 of yacc.c  */
-#line 401 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].namespaceUse)); }
+  case 19: /* use_declarations: use_declaration  */
+#line 403 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].namespaceUse)); }
+#line 4405 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 20:
-
-/* Line 1806 of yacc.c  */
-#line 405 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(1) - (1)].qualifiedName), NULL); 
+  case 20: /* use_declaration: namespace_name  */
+#line 407 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[0].qualifiedName), NULL); 
 																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4413 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 21:
-
-/* Line 1806 of yacc.c  */
-#line 408 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].lexeme)); 
+  case 21: /* use_declaration: namespace_name T_AS T_STRING  */
+#line 410 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme)); 
 																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4421 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 22:
-
-/* Line 1806 of yacc.c  */
-#line 411 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(2) - (2)].qualifiedName), NULL); 
+  case 22: /* use_declaration: T_NS_SEPARATOR namespace_name  */
+#line 413 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[0].qualifiedName), NULL); 
 																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4429 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 23:
-
-/* Line 1806 of yacc.c  */
-#line 414 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[(2) - (4)].qualifiedName), (yyvsp[(4) - (4)].lexeme)); 
+  case 23: /* use_declaration: T_NS_SEPARATOR namespace_name T_AS T_STRING  */
+#line 416 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { AST_INIT_ARGS((yyval.namespaceUse), pelet::NamespaceUseClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme)); 
 																  observers.NamespaceUseAddScope((yyval.namespaceUse));
 																}
+#line 4437 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 24:
-
-/* Line 1806 of yacc.c  */
-#line 420 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ConstantStatementClass* constStmt;
+  case 24: /* constant_declaration: constant_declaration ',' T_STRING '=' static_scalar  */
+#line 422 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { pelet::ConstantStatementClass* constStmt;
 																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
-																	(yyvsp[(3) - (5)].lexeme), analyzer.GetLineNumber(), 
+																	(yyvsp[-2].lexeme), analyzer.GetLineNumber(), 
 																	observers.GetDeclaredNamespace());
-																  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(constStmt);
+																  (yyval.statementList) = (yyvsp[-4].statementList)->Push(constStmt);
 																}
+#line 4448 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 25:
-
-/* Line 1806 of yacc.c  */
-#line 426 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ConstantStatementClass* constStmt;
+  case 25: /* constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 428 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { pelet::ConstantStatementClass* constStmt;
 																  AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, 
-																    (yyvsp[(2) - (4)].lexeme), analyzer.GetLineNumber(),
+																    (yyvsp[-2].lexeme), analyzer.GetLineNumber(),
 																    observers.GetDeclaredNamespace());
 																  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, constStmt);																	
 																}
+#line 4459 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 26:
-
-/* Line 1806 of yacc.c  */
-#line 435 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList)->PushAll((yyvsp[(2) - (2)].statementList)); }
+  case 26: /* inner_statement_list: inner_statement_list inner_statement  */
+#line 437 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[-1].statementList)->PushAll((yyvsp[0].statementList)); }
+#line 4465 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 27:
-
-/* Line 1806 of yacc.c  */
-#line 436 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 27: /* inner_statement_list: %empty  */
+#line 438 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4471 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 31:
-
-/* Line 1806 of yacc.c  */
-#line 443 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 31: /* inner_statement: T_HALT_COMPILER '(' ')' ';'  */
+#line 445 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 4477 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 32:
-
-/* Line 1806 of yacc.c  */
-#line 447 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 32: /* statement: unticked_statement  */
+#line 449 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4483 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 33:
-
-/* Line 1806 of yacc.c  */
-#line 448 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 33: /* statement: T_STRING ':'  */
+#line 450 "/root/repo/src/Php54ResourceParser.y"
+                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 4489 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 34:
-
-/* Line 1806 of yacc.c  */
-#line 452 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 34: /* unticked_statement: '{' inner_statement_list '}'  */
+#line 454 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4495 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 35:
-
-/* Line 1806 of yacc.c  */
-#line 453 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(5) - (7)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(6) - (7)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(7) - (7)].statementList));
+  case 35: /* unticked_statement: T_IF '(' expr ')' statement elseif_list else_single  */
+#line 455 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-2].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-1].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[0].statementList));
 																									}
+#line 4504 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 36:
-
-/* Line 1806 of yacc.c  */
-#line 457 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(6) - (10)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(7) - (10)].statementList));
-																									  (yyval.statementList)->PushAll((yyvsp[(8) - (10)].statementList));
+  case 36: /* unticked_statement: T_IF '(' expr ')' ':' inner_statement_list new_elseif_list new_else_single T_ENDIF ';'  */
+#line 459 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-4].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-3].statementList));
+																									  (yyval.statementList)->PushAll((yyvsp[-2].statementList));
 																									}
+#line 4513 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 37:
-
-/* Line 1806 of yacc.c  */
-#line 461 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
+  case 37: /* unticked_statement: T_WHILE '(' expr ')' while_statement  */
+#line 463 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4519 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 38:
-
-/* Line 1806 of yacc.c  */
-#line 462 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (7)].statementList); }
+  case 38: /* unticked_statement: T_DO statement T_WHILE '(' expr ')' ';'  */
+#line 464 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[-5].statementList); }
+#line 4525 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 39:
-
-/* Line 1806 of yacc.c  */
-#line 471 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(9) - (9)].statementList); }
+  case 39: /* unticked_statement: T_FOR '(' for_expr ';' for_expr ';' for_expr ')' for_statement  */
+#line 473 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4531 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 40:
-
-/* Line 1806 of yacc.c  */
-#line 472 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
+  case 40: /* unticked_statement: T_SWITCH '(' expr ')' switch_case_list  */
+#line 474 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4537 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 41:
-
-/* Line 1806 of yacc.c  */
-#line 473 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 42:
-
-/* Line 1806 of yacc.c  */
-#line 474 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 43:
-
-/* Line 1806 of yacc.c  */
-#line 475 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 44:
-
-/* Line 1806 of yacc.c  */
-#line 476 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 45:
-
-/* Line 1806 of yacc.c  */
-#line 477 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 46:
-
-/* Line 1806 of yacc.c  */
-#line 478 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 47:
-
-/* Line 1806 of yacc.c  */
-#line 479 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 48:
-
-/* Line 1806 of yacc.c  */
-#line 480 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 49:
-
-/* Line 1806 of yacc.c  */
-#line 481 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 50:
-
-/* Line 1806 of yacc.c  */
-#line 482 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
-    break;
-
-  case 51:
-
-/* Line 1806 of yacc.c  */
-#line 483 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 52:
-
-/* Line 1806 of yacc.c  */
-#line 484 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (2)].statement)); }
-    break;
-
-  case 53:
-
-/* Line 1806 of yacc.c  */
-#line 485 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 54:
-
-/* Line 1806 of yacc.c  */
-#line 488 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(8) - (8)].statementList); }
-    break;
-
-  case 55:
-
-/* Line 1806 of yacc.c  */
-#line 491 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(8) - (8)].statementList); }
-    break;
-
-  case 56:
-
-/* Line 1806 of yacc.c  */
-#line 492 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 41: /* unticked_statement: T_BREAK ';'  */
+#line 475 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4543 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 57:
+  case 42: /* unticked_statement: T_BREAK expr ';'  */
+#line 476 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4549 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 493 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 43: /* unticked_statement: T_CONTINUE ';'  */
+#line 477 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4555 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 58:
+  case 44: /* unticked_statement: T_CONTINUE expr ';'  */
+#line 478 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4561 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 497 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(3) - (13)].statementList), (yyvsp[(11) - (13)].statementList));
-																									  AST_PUSH_ALL_MERGE((yyval.statementList), (yyval.statementList), (yyvsp[(13) - (13)].statementList));
-																									}
+  case 45: /* unticked_statement: T_RETURN ';'  */
+#line 479 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4567 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 59:
+  case 46: /* unticked_statement: T_RETURN expr_without_variable ';'  */
+#line 480 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4573 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 500 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(2) - (3)].statement)); }
+  case 47: /* unticked_statement: T_RETURN variable ';'  */
+#line 481 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4579 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 60:
+  case 48: /* unticked_statement: T_GLOBAL global_var_list ';'  */
+#line 482 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4585 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 501 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 49: /* unticked_statement: T_STATIC static_var_list ';'  */
+#line 483 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4591 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 61:
+  case 50: /* unticked_statement: T_ECHO echo_expr_list ';'  */
+#line 484 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4597 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 505 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 51: /* unticked_statement: T_INLINE_HTML  */
+#line 485 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4603 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 62:
+  case 52: /* unticked_statement: expr ';'  */
+#line 486 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statement)); }
+#line 4609 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 506 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 53: /* unticked_statement: T_UNSET '(' unset_variables ')' ';'  */
+#line 487 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4615 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 63:
+  case 54: /* unticked_statement: T_FOREACH '(' variable T_AS foreach_variable foreach_optional_arg ')' foreach_statement  */
+#line 490 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4621 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 510 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 55: /* unticked_statement: T_FOREACH '(' expr_without_variable T_AS variable foreach_optional_arg ')' foreach_statement  */
+#line 493 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4627 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 64:
+  case 56: /* unticked_statement: T_DECLARE '(' declare_list ')' declare_statement  */
+#line 494 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4633 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 511 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 57: /* unticked_statement: ';'  */
+#line 495 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4639 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 65:
+  case 58: /* unticked_statement: T_TRY '{' inner_statement_list '}' T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}' additional_catches  */
+#line 499 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-10].statementList), (yyvsp[-2].statementList));
+																									  AST_PUSH_ALL_MERGE((yyval.statementList), (yyval.statementList), (yyvsp[0].statementList));
+																									}
+#line 4647 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 516 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) =  (yyvsp[(7) - (8)].statementList); }
+  case 59: /* unticked_statement: T_THROW expr ';'  */
+#line 502 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[-1].statement)); }
+#line 4653 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 66:
+  case 60: /* unticked_statement: T_GOTO T_STRING ';'  */
+#line 503 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 4659 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 520 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 61: /* additional_catches: non_empty_additional_catches  */
+#line 507 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4665 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 67:
+  case 62: /* additional_catches: %empty  */
+#line 508 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 4671 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 521 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 63: /* non_empty_additional_catches: additional_catch  */
+#line 512 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4677 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 68:
+  case 64: /* non_empty_additional_catches: non_empty_additional_catches additional_catch  */
+#line 513 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 4683 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 525 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 65: /* additional_catch: T_CATCH '(' fully_qualified_class_name T_VARIABLE ')' '{' inner_statement_list '}'  */
+#line 518 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statementList) =  (yyvsp[-1].statementList); }
+#line 4689 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 71:
+  case 66: /* unset_variables: unset_variable  */
+#line 522 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4695 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 537 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isReference) = false; }
+  case 67: /* unset_variables: unset_variables ',' unset_variable  */
+#line 523 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 4701 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 72:
+  case 68: /* unset_variable: variable  */
+#line 527 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 4707 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 538 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isReference) = true; }
+  case 71: /* is_reference: %empty  */
+#line 539 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.isReference) = false; }
+#line 4713 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 73:
+  case 72: /* is_reference: '&'  */
+#line 540 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.isReference) = true; }
+#line 4719 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 543 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetCurrentClassName(NULL); 
-											  observers.SetCurrentMemberName((yyvsp[(3) - (6)].lexeme)); 
+  case 73: /* $@3: %empty  */
+#line 545 "/root/repo/src/Php54ResourceParser.y"
+                                                                { observers.SetCurrentClassName(NULL); 
+											  observers.SetCurrentMemberName((yyvsp[-3].lexeme)); 
 											  observers.HasCallToFuncGetArg = false;  
 											}
+#line 4728 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 74:
-
-/* Line 1806 of yacc.c  */
-#line 547 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* member;
+  case 74: /* unticked_function_declaration_statement: function is_reference T_STRING '(' parameter_list ')' $@3 '{' inner_statement_list '}'  */
+#line 549 "/root/repo/src/Php54ResourceParser.y"
+                                                        { pelet::ClassMemberSymbolClass* member;
 											  AST_INIT(member, pelet::ClassMemberSymbolClass);
-											  member->MakeFunction((yyvsp[(3) - (10)].lexeme), (yyvsp[(2) - (10)].isReference), (yyvsp[(1) - (10)].lexeme), (yyvsp[(5) - (10)].parametersList), (yyvsp[(8) - (10)].token), (yyvsp[(10) - (10)].token),
+											  member->MakeFunction((yyvsp[-7].lexeme), (yyvsp[-8].isReference), (yyvsp[-9].lexeme), (yyvsp[-5].parametersList), (yyvsp[-2].token), (yyvsp[0].token),
 												observers.GetScope(), observers.GetDeclaredNamespace(),
 												observers.HasCallToFuncGetArg);
-											  (yyval.statementList) = (yyvsp[(9) - (10)].statementList);
+											  (yyval.statementList) = (yyvsp[-1].statementList);
 											  (yyval.statementList)->PushFront(member);
 											  observers.SetCurrentMemberName(NULL);
 											}
+#line 4742 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 75:
-
-/* Line 1806 of yacc.c  */
-#line 560 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (4)].lexeme)); }
+  case 75: /* $@4: %empty  */
+#line 562 "/root/repo/src/Php54ResourceParser.y"
+                                                        { observers.SetCurrentClassName((yyvsp[-2].lexeme)); }
+#line 4748 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 76:
-
-/* Line 1806 of yacc.c  */
-#line 561 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassSymbolClass* clazz;
+  case 76: /* unticked_class_declaration_statement: class_entry_type T_STRING extends_from implements_list $@4 '{' class_statement_list '}'  */
+#line 563 "/root/repo/src/Php54ResourceParser.y"
+                                                        { pelet::ClassSymbolClass* clazz;
 											  AST_INIT(clazz, pelet::ClassSymbolClass);
-											  clazz->SetAll((yyvsp[(2) - (8)].lexeme), (yyvsp[(1) - (8)].classSymbol), (yyvsp[(3) - (8)].classSymbol), (yyvsp[(4) - (8)].classSymbol), (yyvsp[(8) - (8)].token), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(7) - (8)].statementList)->PushFront(clazz);
+											  clazz->SetAll((yyvsp[-6].lexeme), (yyvsp[-7].classSymbol), (yyvsp[-5].classSymbol), (yyvsp[-4].classSymbol), (yyvsp[0].token), observers.GetDeclaredNamespace());
+											  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(clazz);
 											  
 											  /* at the end of a class, see if any assigned properties were not explicitly
 											   * defined and it so make them as defined
@@ -4402,1584 +4766,1375 @@ yyreduce:
 											  observers.CreateMagicMethodsAndProperties((yyval.statementList), clazz);
 											  observers.SetCurrentClassName(NULL);
 											}
+#line 4770 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 77:
-
-/* Line 1806 of yacc.c  */
-#line 579 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetCurrentClassName((yyvsp[(2) - (3)].lexeme)); }
+  case 77: /* $@5: %empty  */
+#line 581 "/root/repo/src/Php54ResourceParser.y"
+                                                                { observers.SetCurrentClassName((yyvsp[-1].lexeme)); }
+#line 4776 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 78:
-
-/* Line 1806 of yacc.c  */
-#line 580 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassSymbolClass* clazz;
+  case 78: /* unticked_class_declaration_statement: interface_entry T_STRING interface_extends_list $@5 '{' class_statement_list '}'  */
+#line 582 "/root/repo/src/Php54ResourceParser.y"
+                                                        { pelet::ClassSymbolClass* clazz;
 											  AST_INIT(clazz, pelet::ClassSymbolClass);
-											  clazz->SetAll((yyvsp[(2) - (7)].lexeme), (yyvsp[(1) - (7)].classSymbol), NULL, (yyvsp[(3) - (7)].classSymbol), (yyvsp[(7) - (7)].token), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(6) - (7)].statementList)->PushFront(clazz);
+											  clazz->SetAll((yyvsp[-5].lexeme), (yyvsp[-6].classSymbol), NULL, (yyvsp[-4].classSymbol), (yyvsp[0].token), observers.GetDeclaredNamespace());
+											  (yyval.statementList) = (yyvsp[-1].statementList)->PushFront(clazz);
 											  observers.SetCurrentClassName(NULL);
 											}
+#line 4787 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 79:
-
-/* Line 1806 of yacc.c  */
-#line 589 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (1)].lexeme), false, false, false, false); }
+  case 79: /* class_entry_type: T_CLASS  */
+#line 591 "/root/repo/src/Php54ResourceParser.y"
+                                                        { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[0].lexeme), false, false, false, false); }
+#line 4793 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 80:
-
-/* Line 1806 of yacc.c  */
-#line 590 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (2)].lexeme), true, false, false, false); }
+  case 80: /* class_entry_type: T_ABSTRACT T_CLASS  */
+#line 592 "/root/repo/src/Php54ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[-1].lexeme), true, false, false, false); }
+#line 4799 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 81:
-
-/* Line 1806 of yacc.c  */
-#line 591 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (1)].lexeme), false, false, false, true); }
+  case 81: /* class_entry_type: T_TRAIT  */
+#line 593 "/root/repo/src/Php54ResourceParser.y"
+                                                        { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[0].lexeme), false, false, false, true); }
+#line 4805 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 82:
-
-/* Line 1806 of yacc.c  */
-#line 592 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (2)].lexeme), false, true, false, false); }
+  case 82: /* class_entry_type: T_FINAL T_CLASS  */
+#line 594 "/root/repo/src/Php54ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[-1].lexeme), false, true, false, false); }
+#line 4811 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 83:
-
-/* Line 1806 of yacc.c  */
-#line 596 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classSymbol) = 0; }
+  case 83: /* extends_from: %empty  */
+#line 598 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.classSymbol) = 0; }
+#line 4817 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 84:
-
-/* Line 1806 of yacc.c  */
-#line 598 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass);
-										  (yyval.classSymbol)->SetExtends((yyvsp[(2) - (2)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
+  case 84: /* extends_from: T_EXTENDS fully_qualified_class_name  */
+#line 600 "/root/repo/src/Php54ResourceParser.y"
+                                                        { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass);
+										  (yyval.classSymbol)->SetExtends((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
 										}
+#line 4825 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 85:
-
-/* Line 1806 of yacc.c  */
-#line 604 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[(1) - (1)].lexeme), false, false, true, false); }
+  case 85: /* interface_entry: T_INTERFACE  */
+#line 606 "/root/repo/src/Php54ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags((yyvsp[0].lexeme), false, false, true, false); }
+#line 4831 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 86:
-
-/* Line 1806 of yacc.c  */
-#line 608 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classSymbol) = 0; }
+  case 86: /* interface_extends_list: %empty  */
+#line 610 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.classSymbol) = 0; }
+#line 4837 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 87:
-
-/* Line 1806 of yacc.c  */
-#line 610 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
+  case 87: /* interface_extends_list: T_EXTENDS interface_list  */
+#line 612 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4843 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 88:
-
-/* Line 1806 of yacc.c  */
-#line 614 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags(NULL, false, false, false, false); }
+  case 88: /* implements_list: %empty  */
+#line 616 "/root/repo/src/Php54ResourceParser.y"
+                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); (yyval.classSymbol)->SetFlags(NULL, false, false, false, false); }
+#line 4849 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 89:
-
-/* Line 1806 of yacc.c  */
-#line 616 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(2) - (2)].classSymbol); }
+  case 89: /* implements_list: T_IMPLEMENTS interface_list  */
+#line 618 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.classSymbol) = (yyvsp[0].classSymbol); }
+#line 4855 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 90:
-
-/* Line 1806 of yacc.c  */
-#line 620 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); 
-															  (yyval.classSymbol)->AddToImplements((yyvsp[(1) - (1)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
+  case 90: /* interface_list: fully_qualified_class_name  */
+#line 622 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT((yyval.classSymbol), pelet::ClassSymbolClass); 
+															  (yyval.classSymbol)->AddToImplements((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); 
 															}
+#line 4863 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 91:
-
-/* Line 1806 of yacc.c  */
-#line 623 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classSymbol) = (yyvsp[(1) - (3)].classSymbol)->AddToImplements((yyvsp[(3) - (3)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 91: /* interface_list: interface_list ',' fully_qualified_class_name  */
+#line 625 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.classSymbol) = (yyvsp[-2].classSymbol)->AddToImplements((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 4869 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 92:
-
-/* Line 1806 of yacc.c  */
-#line 627 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 92: /* foreach_optional_arg: %empty  */
+#line 629 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4875 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 93:
-
-/* Line 1806 of yacc.c  */
-#line 628 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 93: /* foreach_optional_arg: T_DOUBLE_ARROW foreach_variable  */
+#line 630 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 4881 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 94:
-
-/* Line 1806 of yacc.c  */
-#line 632 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 94: /* foreach_variable: variable  */
+#line 634 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 4887 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 95:
-
-/* Line 1806 of yacc.c  */
-#line 633 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (2)].statement); }
+  case 95: /* foreach_variable: '&' variable  */
+#line 635 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 4893 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 96:
-
-/* Line 1806 of yacc.c  */
-#line 637 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 96: /* for_statement: statement  */
+#line 639 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4899 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 97:
-
-/* Line 1806 of yacc.c  */
-#line 638 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 97: /* for_statement: ':' inner_statement_list T_ENDFOR ';'  */
+#line 640 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4905 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 98:
-
-/* Line 1806 of yacc.c  */
-#line 642 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 98: /* foreach_statement: statement  */
+#line 644 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4911 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 99:
-
-/* Line 1806 of yacc.c  */
-#line 643 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 99: /* foreach_statement: ':' inner_statement_list T_ENDFOREACH ';'  */
+#line 645 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4917 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 100:
-
-/* Line 1806 of yacc.c  */
-#line 647 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 100: /* declare_statement: statement  */
+#line 649 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4923 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 101:
-
-/* Line 1806 of yacc.c  */
-#line 648 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 101: /* declare_statement: ':' inner_statement_list T_ENDDECLARE ';'  */
+#line 650 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4929 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 102:
-
-/* Line 1806 of yacc.c  */
-#line 652 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 102: /* declare_list: T_STRING '=' static_scalar  */
+#line 654 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 4935 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 103:
-
-/* Line 1806 of yacc.c  */
-#line 653 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 103: /* declare_list: declare_list ',' T_STRING '=' static_scalar  */
+#line 655 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 4941 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 104:
-
-/* Line 1806 of yacc.c  */
-#line 657 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 104: /* switch_case_list: '{' case_list '}'  */
+#line 659 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4947 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 105:
-
-/* Line 1806 of yacc.c  */
-#line 658 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (4)].statementList); }
+  case 105: /* switch_case_list: '{' ';' case_list '}'  */
+#line 660 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 4953 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 106:
-
-/* Line 1806 of yacc.c  */
-#line 659 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 106: /* switch_case_list: ':' case_list T_ENDSWITCH ';'  */
+#line 661 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4959 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 107:
-
-/* Line 1806 of yacc.c  */
-#line 660 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (5)].statementList); }
+  case 107: /* switch_case_list: ':' ';' case_list T_ENDSWITCH ';'  */
+#line 662 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 4965 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 108:
-
-/* Line 1806 of yacc.c  */
-#line 664 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 108: /* case_list: %empty  */
+#line 666 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statementList) = 0; }
+#line 4971 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 109:
-
-/* Line 1806 of yacc.c  */
-#line 665 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(5) - (5)].statementList); }
+  case 109: /* case_list: case_list T_CASE expr case_separator inner_statement_list  */
+#line 667 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4977 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 110:
-
-/* Line 1806 of yacc.c  */
-#line 666 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(4) - (4)].statementList); }
+  case 110: /* case_list: case_list T_DEFAULT case_separator inner_statement_list  */
+#line 668 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 4983 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 111:
-
-/* Line 1806 of yacc.c  */
-#line 670 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 111: /* case_separator: ':'  */
+#line 672 "/root/repo/src/Php54ResourceParser.y"
+                                { (yyval.unused) = 0; }
+#line 4989 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 112:
-
-/* Line 1806 of yacc.c  */
-#line 671 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 112: /* case_separator: ';'  */
+#line 673 "/root/repo/src/Php54ResourceParser.y"
+                                { (yyval.unused) = 0; }
+#line 4995 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 113:
-
-/* Line 1806 of yacc.c  */
-#line 675 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 113: /* while_statement: statement  */
+#line 677 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5001 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 114:
-
-/* Line 1806 of yacc.c  */
-#line 676 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (4)].statementList); }
+  case 114: /* while_statement: ':' inner_statement_list T_ENDWHILE ';'  */
+#line 678 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[-2].statementList); }
+#line 5007 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 115:
-
-/* Line 1806 of yacc.c  */
-#line 680 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 115: /* elseif_list: %empty  */
+#line 682 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statementList) = 0; }
+#line 5013 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 116:
-
-/* Line 1806 of yacc.c  */
-#line 681 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass);
-															  (yyval.statementList)->PushAll((yyvsp[(1) - (6)].statementList))->Push((yyvsp[(4) - (6)].statement))->PushAll((yyvsp[(6) - (6)].statementList));
+  case 116: /* elseif_list: elseif_list T_ELSEIF '(' expr ')' statement  */
+#line 683 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass);
+															  (yyval.statementList)->PushAll((yyvsp[-5].statementList))->Push((yyvsp[-2].statement))->PushAll((yyvsp[0].statementList));
 															}
+#line 5021 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 117:
-
-/* Line 1806 of yacc.c  */
-#line 687 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 117: /* new_elseif_list: %empty  */
+#line 689 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 5027 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 118:
-
-/* Line 1806 of yacc.c  */
-#line 688 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass);
-																				  (yyval.statementList)->PushAll((yyvsp[(1) - (7)].statementList))->Push((yyvsp[(4) - (7)].statement))->PushAll((yyvsp[(7) - (7)].statementList));
+  case 118: /* new_elseif_list: new_elseif_list T_ELSEIF '(' expr ')' ':' inner_statement_list  */
+#line 690 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass);
+																				  (yyval.statementList)->PushAll((yyvsp[-6].statementList))->Push((yyvsp[-3].statement))->PushAll((yyvsp[0].statementList));
 																			  	}
+#line 5035 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 119:
-
-/* Line 1806 of yacc.c  */
-#line 694 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 119: /* else_single: %empty  */
+#line 696 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = 0; }
+#line 5041 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 120:
-
-/* Line 1806 of yacc.c  */
-#line 695 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (2)].statementList); }
+  case 120: /* else_single: T_ELSE statement  */
+#line 697 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5047 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 121:
-
-/* Line 1806 of yacc.c  */
-#line 699 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 121: /* new_else_single: %empty  */
+#line 701 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = 0; }
+#line 5053 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 122:
-
-/* Line 1806 of yacc.c  */
-#line 700 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (3)].statementList); }
+  case 122: /* new_else_single: T_ELSE ':' inner_statement_list  */
+#line 702 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5059 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 123:
-
-/* Line 1806 of yacc.c  */
-#line 704 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (1)].parametersList); }
+  case 123: /* parameter_list: non_empty_parameter_list  */
+#line 706 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.parametersList) = (yyvsp[0].parametersList); }
+#line 5065 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 124:
-
-/* Line 1806 of yacc.c  */
-#line 705 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = 0; }
+  case 124: /* parameter_list: %empty  */
+#line 707 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.parametersList) = 0; }
+#line 5071 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 125:
-
-/* Line 1806 of yacc.c  */
-#line 709 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (2)].qualifiedName), (yyvsp[(2) - (2)].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 125: /* non_empty_parameter_list: optional_class_type T_VARIABLE  */
+#line 711 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-1].qualifiedName), (yyvsp[0].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5077 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 126:
-
-/* Line 1806 of yacc.c  */
-#line 710 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (3)].qualifiedName), (yyvsp[(3) - (3)].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 126: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE  */
+#line 712 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-2].qualifiedName), (yyvsp[0].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5083 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 127:
-
-/* Line 1806 of yacc.c  */
-#line 711 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (5)].qualifiedName), (yyvsp[(3) - (5)].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 127: /* non_empty_parameter_list: optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 713 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-4].qualifiedName), (yyvsp[-2].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5089 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 128:
-
-/* Line 1806 of yacc.c  */
-#line 712 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[(1) - (4)].qualifiedName), (yyvsp[(2) - (4)].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 128: /* non_empty_parameter_list: optional_class_type T_VARIABLE '=' static_scalar  */
+#line 714 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { AST_INIT_ARGS((yyval.parametersList), pelet::ParametersListClass, (yyvsp[-3].qualifiedName), (yyvsp[-2].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5095 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 129:
-
-/* Line 1806 of yacc.c  */
-#line 713 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (4)].parametersList)->Append((yyvsp[(3) - (4)].qualifiedName), (yyvsp[(4) - (4)].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 129: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE  */
+#line 715 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.parametersList) = (yyvsp[-3].parametersList)->Append((yyvsp[-1].qualifiedName), (yyvsp[0].lexeme), false, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5101 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 130:
-
-/* Line 1806 of yacc.c  */
-#line 714 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (5)].parametersList)->Append((yyvsp[(3) - (5)].qualifiedName), (yyvsp[(5) - (5)].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 130: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE  */
+#line 716 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.parametersList) = (yyvsp[-4].parametersList)->Append((yyvsp[-2].qualifiedName), (yyvsp[0].lexeme), true, false, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5107 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 131:
-
-/* Line 1806 of yacc.c  */
-#line 715 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (7)].parametersList)->Append((yyvsp[(3) - (7)].qualifiedName), (yyvsp[(5) - (7)].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 131: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type '&' T_VARIABLE '=' static_scalar  */
+#line 717 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.parametersList) = (yyvsp[-6].parametersList)->Append((yyvsp[-4].qualifiedName), (yyvsp[-2].lexeme), true, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5113 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 132:
-
-/* Line 1806 of yacc.c  */
-#line 716 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.parametersList) = (yyvsp[(1) - (6)].parametersList)->Append((yyvsp[(3) - (6)].qualifiedName), (yyvsp[(4) - (6)].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 132: /* non_empty_parameter_list: non_empty_parameter_list ',' optional_class_type T_VARIABLE '=' static_scalar  */
+#line 718 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.parametersList) = (yyvsp[-5].parametersList)->Append((yyvsp[-3].qualifiedName), (yyvsp[-2].lexeme), false, true, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5119 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 133:
-
-/* Line 1806 of yacc.c  */
-#line 720 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 133: /* optional_class_type: %empty  */
+#line 722 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.qualifiedName) = 0; }
+#line 5125 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 134:
-
-/* Line 1806 of yacc.c  */
-#line 721 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 134: /* optional_class_type: fully_qualified_class_name  */
+#line 723 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 5131 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 135:
-
-/* Line 1806 of yacc.c  */
-#line 722 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("array"), 0, 0); }
+  case 135: /* optional_class_type: T_ARRAY  */
+#line 724 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("array"), 0, 0); }
+#line 5137 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 136:
-
-/* Line 1806 of yacc.c  */
-#line 723 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("callable"), 0, 0); }
+  case 136: /* optional_class_type: T_CALLABLE  */
+#line 725 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.qualifiedName), pelet::QualifiedNameClass, UNICODE_STRING_SIMPLE("callable"), 0, 0); }
+#line 5143 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 137:
-
-/* Line 1806 of yacc.c  */
-#line 727 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 137: /* function_call_parameter_list: non_empty_function_call_parameter_list  */
+#line 729 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5149 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 138:
-
-/* Line 1806 of yacc.c  */
-#line 728 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) =  0; }
+  case 138: /* function_call_parameter_list: %empty  */
+#line 730 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) =  0; }
+#line 5155 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 139:
-
-/* Line 1806 of yacc.c  */
-#line 732 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureCallArguments) {
-																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement));
+  case 139: /* non_empty_function_call_parameter_list: expr_without_variable  */
+#line 734 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { if (observers.DoCaptureCallArguments) {
+																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement));
 																			  }
 																			  else {
 																				(yyval.statementList) = 0;
 																			  }
 																			}
+#line 5167 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 140:
-
-/* Line 1806 of yacc.c  */
-#line 739 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureCallArguments) {
-																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement));
+  case 140: /* non_empty_function_call_parameter_list: variable  */
+#line 741 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { if (observers.DoCaptureCallArguments) {
+																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement));
 																			  }
 																			  else {
 																				(yyval.statementList) = 0;
 																			  } 
 																			}
+#line 5179 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 141:
-
-/* Line 1806 of yacc.c  */
-#line 746 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureCallArguments) {
-																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(2) - (2)].statement));
+  case 141: /* non_empty_function_call_parameter_list: '&' w_variable  */
+#line 748 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { if (observers.DoCaptureCallArguments) {
+																				AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement));
 																			  }
 																			  else {
 																				(yyval.statementList) = 0;
 																			  }
 																			}
+#line 5191 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 142:
-
-/* Line 1806 of yacc.c  */
-#line 753 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList) ? (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)) : 0; }
+  case 142: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' expr_without_variable  */
+#line 755 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList) ? (yyvsp[-2].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5197 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 143:
-
-/* Line 1806 of yacc.c  */
-#line 754 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList) ? (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)) : 0; }
+  case 143: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' variable  */
+#line 756 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[-2].statementList) ? (yyvsp[-2].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5203 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 144:
-
-/* Line 1806 of yacc.c  */
-#line 755 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (4)].statementList) ? (yyvsp[(1) - (4)].statementList)->Push((yyvsp[(4) - (4)].statement)) : 0; }
+  case 144: /* non_empty_function_call_parameter_list: non_empty_function_call_parameter_list ',' '&' w_variable  */
+#line 757 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = (yyvsp[-3].statementList) ? (yyvsp[-3].statementList)->Push((yyvsp[0].statement)) : 0; }
+#line 5209 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 147:
-
-/* Line 1806 of yacc.c  */
-#line 764 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 147: /* global_var: T_VARIABLE  */
+#line 766 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 5215 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 148:
-
-/* Line 1806 of yacc.c  */
-#line 765 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 148: /* global_var: '$' r_variable  */
+#line 767 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 5221 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 149:
-
-/* Line 1806 of yacc.c  */
-#line 766 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 149: /* global_var: '$' '{' expr '}'  */
+#line 768 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 5227 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 150:
-
-/* Line 1806 of yacc.c  */
-#line 770 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 150: /* static_var_list: static_var_list ',' T_VARIABLE  */
+#line 772 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 5233 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 151:
-
-/* Line 1806 of yacc.c  */
-#line 771 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 151: /* static_var_list: static_var_list ',' T_VARIABLE '=' static_scalar  */
+#line 773 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 5239 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 152:
-
-/* Line 1806 of yacc.c  */
-#line 772 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 152: /* static_var_list: T_VARIABLE  */
+#line 774 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 5245 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 153:
-
-/* Line 1806 of yacc.c  */
-#line 773 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 153: /* static_var_list: T_VARIABLE '=' static_scalar  */
+#line 775 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 5251 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 154:
-
-/* Line 1806 of yacc.c  */
-#line 777 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[(1) - (2)].statementList), (yyvsp[(2) - (2)].statementList)); }
+  case 154: /* class_statement_list: class_statement_list class_statement  */
+#line 779 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { AST_PUSH_ALL_MERGE((yyval.statementList), (yyvsp[-1].statementList), (yyvsp[0].statementList)); }
+#line 5257 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 155:
-
-/* Line 1806 of yacc.c  */
-#line 778 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 155: /* class_statement_list: %empty  */
+#line 780 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 5263 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 156:
-
-/* Line 1806 of yacc.c  */
-#line 782 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = pelet::ClassMemberSymbolClass::MakeVariables((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].classMemberSymbol), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 156: /* class_statement: variable_modifiers class_variable_declaration ';'  */
+#line 784 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = pelet::ClassMemberSymbolClass::MakeVariables((yyvsp[-1].statementList), (yyvsp[-2].classMemberSymbol), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5269 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 157:
-
-/* Line 1806 of yacc.c  */
-#line 783 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList); }
+  case 157: /* class_statement: class_constant_declaration ';'  */
+#line 785 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5275 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 158:
-
-/* Line 1806 of yacc.c  */
-#line 784 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 158: /* class_statement: trait_use_statement  */
+#line 786 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5281 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 159:
-
-/* Line 1806 of yacc.c  */
-#line 786 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.SetCurrentMemberName((yyvsp[(4) - (7)].lexeme)); 
+  case 159: /* $@6: %empty  */
+#line 788 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { observers.SetCurrentMemberName((yyvsp[-3].lexeme)); 
 															  observers.HasCallToFuncGetArg = false;
 															}
+#line 5289 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 160:
-
-/* Line 1806 of yacc.c  */
-#line 789 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 160: /* class_statement: method_modifiers function is_reference T_STRING '(' parameter_list ')' $@6 method_body  */
+#line 791 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
 															  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-															  memberSymbol->MakeMethod((yyvsp[(4) - (9)].lexeme), (yyvsp[(1) - (9)].classMemberSymbol), (yyvsp[(3) - (9)].isReference), (yyvsp[(2) - (9)].lexeme), (yyvsp[(6) - (9)].parametersList), (yyvsp[(9) - (9)].classMemberSymbol),
+															  memberSymbol->MakeMethod((yyvsp[-5].lexeme), (yyvsp[-8].classMemberSymbol), (yyvsp[-6].isReference), (yyvsp[-7].lexeme), (yyvsp[-3].parametersList), (yyvsp[0].classMemberSymbol),
 															    observers.GetScope(), observers.GetDeclaredNamespace(),
 																observers.HasCallToFuncGetArg); 
 															  AST_INIT((yyval.statementList), pelet::StatementListClass);
 															  (yyval.statementList)->PushFront(memberSymbol);
-															  (yyval.statementList)->PushAll(&((yyvsp[(9) - (9)].classMemberSymbol)->MethodStatements));
+															  (yyval.statementList)->PushAll(&((yyvsp[0].classMemberSymbol)->MethodStatements));
 															  observers.SetCurrentMemberName(NULL);
 															}
+#line 5304 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 161:
-
-/* Line 1806 of yacc.c  */
-#line 803 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(3) - (3)].statementList)->PushFront((yyvsp[(2) - (3)].traitUse)); }
+  case 161: /* trait_use_statement: T_USE trait_list trait_adaptations  */
+#line 805 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statementList) = (yyvsp[0].statementList)->PushFront((yyvsp[-1].traitUse)); }
+#line 5310 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 162:
-
-/* Line 1806 of yacc.c  */
-#line 807 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.traitUse), pelet::TraitUseClass, (yyvsp[(1) - (1)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 162: /* trait_list: fully_qualified_class_name  */
+#line 809 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { AST_INIT_ARGS((yyval.traitUse), pelet::TraitUseClass, (yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5316 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 163:
-
-/* Line 1806 of yacc.c  */
-#line 809 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitUse) = (yyvsp[(1) - (3)].traitUse)->AppendUse((yyvsp[(3) - (3)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 163: /* trait_list: trait_list ',' fully_qualified_class_name  */
+#line 811 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.traitUse) = (yyvsp[-2].traitUse)->AppendUse((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5322 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 164:
-
-/* Line 1806 of yacc.c  */
-#line 813 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 164: /* trait_adaptations: ';'  */
+#line 815 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 5328 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 165:
-
-/* Line 1806 of yacc.c  */
-#line 814 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(2) - (3)].statementList); }
+  case 165: /* trait_adaptations: '{' trait_adaptation_list '}'  */
+#line 816 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[-1].statementList); }
+#line 5334 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 166:
-
-/* Line 1806 of yacc.c  */
-#line 818 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+  case 166: /* trait_adaptation_list: %empty  */
+#line 820 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { AST_INIT((yyval.statementList), pelet::StatementListClass); }
+#line 5340 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 167:
-
-/* Line 1806 of yacc.c  */
-#line 819 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
+  case 167: /* trait_adaptation_list: non_empty_trait_adaptation_list  */
+#line 821 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5346 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 168:
-
-/* Line 1806 of yacc.c  */
-#line 823 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); }
+  case 168: /* non_empty_trait_adaptation_list: trait_adaptation_statement  */
+#line 825 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); }
+#line 5352 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 169:
-
-/* Line 1806 of yacc.c  */
-#line 824 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (2)].statementList)->Push((yyvsp[(2) - (2)].statement)); }
+  case 169: /* non_empty_trait_adaptation_list: non_empty_trait_adaptation_list trait_adaptation_statement  */
+#line 826 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statementList) = (yyvsp[-1].statementList)->Push((yyvsp[0].statement)); }
+#line 5358 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 170:
-
-/* Line 1806 of yacc.c  */
-#line 828 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (2)].traitInsteadOf); }
+  case 170: /* trait_adaptation_statement: trait_precedence ';'  */
+#line 830 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.statement) = (yyvsp[-1].traitInsteadOf); }
+#line 5364 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 171:
-
-/* Line 1806 of yacc.c  */
-#line 829 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (2)].traitAlias); }
+  case 171: /* trait_adaptation_statement: trait_alias ';'  */
+#line 831 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.statement) = (yyvsp[-1].traitAlias); }
+#line 5370 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 172:
-
-/* Line 1806 of yacc.c  */
-#line 834 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitInsteadOf) = (yyvsp[(3) - (3)].traitInsteadOf)->SetMethodReference((yyvsp[(1) - (3)].traitAlias)); }
+  case 172: /* trait_precedence: trait_method_reference_fully_qualified T_INSTEADOF trait_reference_list  */
+#line 836 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.traitInsteadOf) = (yyvsp[0].traitInsteadOf)->SetMethodReference((yyvsp[-2].traitAlias)); }
+#line 5376 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 173:
-
-/* Line 1806 of yacc.c  */
-#line 838 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.traitInsteadOf), pelet::TraitInsteadOfClass, (yyvsp[(1) - (1)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 173: /* trait_reference_list: fully_qualified_class_name  */
+#line 840 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { AST_INIT_ARGS((yyval.traitInsteadOf), pelet::TraitInsteadOfClass, (yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5382 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 174:
-
-/* Line 1806 of yacc.c  */
-#line 839 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitInsteadOf) = (yyvsp[(1) - (3)].traitInsteadOf)->AppendInsteadOf((yyvsp[(3) - (3)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 174: /* trait_reference_list: trait_reference_list ',' fully_qualified_class_name  */
+#line 841 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.traitInsteadOf) = (yyvsp[-2].traitInsteadOf)->AppendInsteadOf((yyvsp[0].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5388 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 175:
-
-/* Line 1806 of yacc.c  */
-#line 843 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.traitAlias), pelet::TraitAliasClass); 
-														  (yyval.traitAlias)->SetMethodReference((yyvsp[(1) - (1)].lexeme), NULL, observers.GetScope(), observers.GetDeclaredNamespace()); 
+  case 175: /* trait_method_reference: T_STRING  */
+#line 845 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { AST_INIT((yyval.traitAlias), pelet::TraitAliasClass); 
+														  (yyval.traitAlias)->SetMethodReference((yyvsp[0].lexeme), NULL, observers.GetScope(), observers.GetDeclaredNamespace()); 
 														}
+#line 5396 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 176:
-
-/* Line 1806 of yacc.c  */
-#line 846 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitAlias) = (yyvsp[(1) - (1)].traitAlias); }
+  case 176: /* trait_method_reference: trait_method_reference_fully_qualified  */
+#line 848 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.traitAlias) = (yyvsp[0].traitAlias); }
+#line 5402 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 177:
-
-/* Line 1806 of yacc.c  */
-#line 850 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.traitAlias), pelet::TraitAliasClass); 
-																	  (yyval.traitAlias)->SetMethodReference((yyvsp[(3) - (3)].lexeme), (yyvsp[(1) - (3)].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace());
+  case 177: /* trait_method_reference_fully_qualified: fully_qualified_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 852 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { AST_INIT((yyval.traitAlias), pelet::TraitAliasClass); 
+																	  (yyval.traitAlias)->SetMethodReference((yyvsp[0].lexeme), (yyvsp[-2].qualifiedName), observers.GetScope(), observers.GetDeclaredNamespace());
 																	}
+#line 5410 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 178:
-
-/* Line 1806 of yacc.c  */
-#line 856 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitAlias) = (yyvsp[(1) - (4)].traitAlias)->SetModifiers((yyvsp[(3) - (4)].lexeme))->SetAlias((yyvsp[(4) - (4)].lexeme))->SetScope(observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 178: /* trait_alias: trait_method_reference T_AS trait_modifiers T_STRING  */
+#line 858 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.traitAlias) = (yyvsp[-3].traitAlias)->SetModifiers((yyvsp[-1].lexeme))->SetAlias((yyvsp[0].lexeme))->SetScope(observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5416 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 179:
-
-/* Line 1806 of yacc.c  */
-#line 857 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.traitAlias) = (yyvsp[(1) - (3)].traitAlias)->SetModifiers((yyvsp[(3) - (3)].lexeme))->SetScope(observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 179: /* trait_alias: trait_method_reference T_AS member_modifier  */
+#line 859 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.traitAlias) = (yyvsp[-2].traitAlias)->SetModifiers((yyvsp[0].lexeme))->SetScope(observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5422 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 180:
-
-/* Line 1806 of yacc.c  */
-#line 861 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 180: /* trait_modifiers: %empty  */
+#line 863 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.lexeme) = 0; }
+#line 5428 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 181:
-
-/* Line 1806 of yacc.c  */
-#line 862 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 181: /* trait_modifiers: member_modifier  */
+#line 864 "/root/repo/src/Php54ResourceParser.y"
+                                { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 5434 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 182:
-
-/* Line 1806 of yacc.c  */
-#line 866 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody(0, (yyvsp[(1) - (1)].token), (yyvsp[(1) - (1)].token)); }
+  case 182: /* method_body: ';'  */
+#line 868 "/root/repo/src/Php54ResourceParser.y"
+                                                                { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody(0, (yyvsp[0].token), (yyvsp[0].token)); }
+#line 5440 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 183:
-
-/* Line 1806 of yacc.c  */
-#line 867 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody((yyvsp[(2) - (3)].statementList), (yyvsp[(1) - (3)].token), (yyvsp[(3) - (3)].token)); }
+  case 183: /* method_body: '{' inner_statement_list '}'  */
+#line 869 "/root/repo/src/Php54ResourceParser.y"
+                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->MakeBody((yyvsp[-1].statementList), (yyvsp[-2].token), (yyvsp[0].token)); }
+#line 5446 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 184:
-
-/* Line 1806 of yacc.c  */
-#line 871 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
+  case 184: /* variable_modifiers: non_empty_member_modifiers  */
+#line 873 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5452 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 185:
-
-/* Line 1806 of yacc.c  */
-#line 872 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass);
-										  (yyval.classMemberSymbol)->MakeAsPublicVariable((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); 
+  case 185: /* variable_modifiers: T_VAR  */
+#line 874 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass);
+										  (yyval.classMemberSymbol)->MakeAsPublicVariable((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); 
 										}
+#line 5460 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 186:
-
-/* Line 1806 of yacc.c  */
-#line 878 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make(NULL, observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 186: /* method_modifiers: %empty  */
+#line 880 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make(NULL, observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5466 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 187:
-
-/* Line 1806 of yacc.c  */
-#line 879 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (1)].classMemberSymbol); }
+  case 187: /* method_modifiers: non_empty_member_modifiers  */
+#line 881 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.classMemberSymbol) = (yyvsp[0].classMemberSymbol); }
+#line 5472 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 188:
-
-/* Line 1806 of yacc.c  */
-#line 883 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); }
+  case 188: /* non_empty_member_modifiers: member_modifier  */
+#line 885 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { AST_INIT((yyval.classMemberSymbol), pelet::ClassMemberSymbolClass); (yyval.classMemberSymbol)->Make((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace()); }
+#line 5478 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 189:
-
-/* Line 1806 of yacc.c  */
-#line 884 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.classMemberSymbol) = (yyvsp[(1) - (2)].classMemberSymbol)->SetModifier((yyvsp[(2) - (2)].lexeme)); }
+  case 189: /* non_empty_member_modifiers: non_empty_member_modifiers member_modifier  */
+#line 886 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.classMemberSymbol) = (yyvsp[-1].classMemberSymbol)->SetModifier((yyvsp[0].lexeme)); }
+#line 5484 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 196:
-
-/* Line 1806 of yacc.c  */
-#line 897 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 196: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE  */
+#line 899 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
 																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(3) - (3)].lexeme), (yyvsp[(3) - (3)].lexeme), false, analyzer.GetLineNumber(),
+																		  memberSymbol->MakeVariable((yyvsp[0].lexeme), (yyvsp[0].lexeme), false, analyzer.GetLineNumber(),
 																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push(memberSymbol);
+																		  (yyval.statementList) = (yyvsp[-2].statementList)->Push(memberSymbol);
 																		}
+#line 5495 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 197:
-
-/* Line 1806 of yacc.c  */
-#line 903 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 197: /* class_variable_declaration: class_variable_declaration ',' T_VARIABLE '=' static_scalar  */
+#line 905 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
 																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(3) - (5)].lexeme), (yyvsp[(3) - (5)].lexeme), false, analyzer.GetLineNumber(),
+																		  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), false, analyzer.GetLineNumber(),
 																			observers.GetScope(), observers.GetDeclaredNamespace());
-																		  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(memberSymbol);
+																		  (yyval.statementList) = (yyvsp[-4].statementList)->Push(memberSymbol);
 																		}
+#line 5506 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 198:
-
-/* Line 1806 of yacc.c  */
-#line 909 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 198: /* class_variable_declaration: T_VARIABLE  */
+#line 911 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { pelet::ClassMemberSymbolClass* memberSymbol;
 																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(1) - (1)].lexeme), (yyvsp[(1) - (1)].lexeme), false, analyzer.GetLineNumber(),
+																		  memberSymbol->MakeVariable((yyvsp[0].lexeme), (yyvsp[0].lexeme), false, analyzer.GetLineNumber(),
 																			observers.GetScope(), observers.GetDeclaredNamespace());
 																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
 																		}
+#line 5517 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 199:
-
-/* Line 1806 of yacc.c  */
-#line 915 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 199: /* class_variable_declaration: T_VARIABLE '=' static_scalar  */
+#line 917 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
 																		  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-																		  memberSymbol->MakeVariable((yyvsp[(1) - (3)].lexeme), (yyvsp[(1) - (3)].lexeme), false, analyzer.GetLineNumber(),
+																		  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), false, analyzer.GetLineNumber(),
 																			observers.GetScope(), observers.GetDeclaredNamespace());
 																		  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
 																		}
+#line 5528 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 200:
-
-/* Line 1806 of yacc.c  */
-#line 925 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 200: /* class_constant_declaration: class_constant_declaration ',' T_STRING '=' static_scalar  */
+#line 927 "/root/repo/src/Php54ResourceParser.y"
+                                                                { pelet::ClassMemberSymbolClass* memberSymbol;
 											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-											  memberSymbol->MakeVariable((yyvsp[(3) - (5)].lexeme), (yyvsp[(3) - (5)].lexeme), true, analyzer.GetLineNumber(),
+											  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-2].lexeme), true, analyzer.GetLineNumber(),
 												observers.GetScope(), observers.GetDeclaredNamespace());
-											  (yyval.statementList) = (yyvsp[(1) - (5)].statementList)->Push(memberSymbol);
+											  (yyval.statementList) = (yyvsp[-4].statementList)->Push(memberSymbol);
 											}
+#line 5539 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 201:
-
-/* Line 1806 of yacc.c  */
-#line 931 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::ClassMemberSymbolClass* memberSymbol;
+  case 201: /* class_constant_declaration: T_CONST T_STRING '=' static_scalar  */
+#line 933 "/root/repo/src/Php54ResourceParser.y"
+                                                    { pelet::ClassMemberSymbolClass* memberSymbol;
 											  AST_INIT(memberSymbol, pelet::ClassMemberSymbolClass);
-											  memberSymbol->MakeVariable((yyvsp[(2) - (4)].lexeme), (yyvsp[(1) - (4)].lexeme), true, analyzer.GetLineNumber(),
+											  memberSymbol->MakeVariable((yyvsp[-2].lexeme), (yyvsp[-3].lexeme), true, analyzer.GetLineNumber(),
 												observers.GetScope(), observers.GetDeclaredNamespace());
 											  AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, memberSymbol);
 											}
+#line 5550 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 202:
-
-/* Line 1806 of yacc.c  */
-#line 940 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)); }
-    break;
-
-  case 203:
-
-/* Line 1806 of yacc.c  */
-#line 941 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); }
-    break;
-
-  case 204:
-
-/* Line 1806 of yacc.c  */
-#line 945 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
-    break;
-
-  case 205:
-
-/* Line 1806 of yacc.c  */
-#line 946 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (1)].statementList); }
-    break;
-
-  case 206:
-
-/* Line 1806 of yacc.c  */
-#line 950 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = (yyvsp[(1) - (3)].statementList)->Push((yyvsp[(3) - (3)].statement)); }
-    break;
-
-  case 207:
-
-/* Line 1806 of yacc.c  */
-#line 951 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[(1) - (1)].statement)); }
-    break;
-
-  case 209:
-
-/* Line 1806 of yacc.c  */
-#line 956 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 211:
-
-/* Line 1806 of yacc.c  */
-#line 961 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 215:
-
-/* Line 1806 of yacc.c  */
-#line 971 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 216:
-
-/* Line 1806 of yacc.c  */
-#line 972 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 217:
-
-/* Line 1806 of yacc.c  */
-#line 976 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
-    break;
-
-  case 218:
-
-/* Line 1806 of yacc.c  */
-#line 980 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(6) - (6)].statement); }
-    break;
-
-  case 219:
-
-/* Line 1806 of yacc.c  */
-#line 981 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    {
-																			  /* 
-																			   * since this parser only looks for defines or property assignments
-																			   * and there could never be both in one expression we can return
-																			   * just one
-																			   */
-																			  if ((yyvsp[(1) - (3)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (3)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (3)].statement);
-																			  }
-																			  else {
-																				(yyval.statement) = (yyvsp[(3) - (3)].statement);
-																			  } 
-																			}
-    break;
-
-  case 220:
-
-/* Line 1806 of yacc.c  */
-#line 994 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; 
-																			  if ((yyvsp[(1) - (4)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (4)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (4)].statement);
-																			  }
-																			}
-    break;
-
-  case 221:
-
-/* Line 1806 of yacc.c  */
-#line 999 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; 
-																			  if ((yyvsp[(1) - (6)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (6)].statement)->Type) {
-																				(yyval.statement) = (yyvsp[(1) - (6)].statement);
-																			  }
-																			}
-    break;
-
-  case 222:
-
-/* Line 1806 of yacc.c  */
-#line 1004 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 223:
-
-/* Line 1806 of yacc.c  */
-#line 1005 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 224:
-
-/* Line 1806 of yacc.c  */
-#line 1006 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 225:
-
-/* Line 1806 of yacc.c  */
-#line 1007 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 226:
-
-/* Line 1806 of yacc.c  */
-#line 1008 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 227:
-
-/* Line 1806 of yacc.c  */
-#line 1009 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 228:
-
-/* Line 1806 of yacc.c  */
-#line 1010 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 229:
-
-/* Line 1806 of yacc.c  */
-#line 1011 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 230:
-
-/* Line 1806 of yacc.c  */
-#line 1012 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 231:
-
-/* Line 1806 of yacc.c  */
-#line 1013 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 232:
-
-/* Line 1806 of yacc.c  */
-#line 1014 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 233:
-
-/* Line 1806 of yacc.c  */
-#line 1015 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 234:
-
-/* Line 1806 of yacc.c  */
-#line 1016 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 235:
-
-/* Line 1806 of yacc.c  */
-#line 1017 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 236:
-
-/* Line 1806 of yacc.c  */
-#line 1018 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 237:
-
-/* Line 1806 of yacc.c  */
-#line 1019 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 238:
-
-/* Line 1806 of yacc.c  */
-#line 1020 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 239:
-
-/* Line 1806 of yacc.c  */
-#line 1021 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 240:
-
-/* Line 1806 of yacc.c  */
-#line 1022 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 241:
-
-/* Line 1806 of yacc.c  */
-#line 1023 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
-    break;
-
-  case 242:
-
-/* Line 1806 of yacc.c  */
-#line 1024 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 202: /* echo_expr_list: echo_expr_list ',' expr  */
+#line 942 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].statement)); }
+#line 5556 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 243:
-
-/* Line 1806 of yacc.c  */
-#line 1025 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 203: /* echo_expr_list: expr  */
+#line 943 "/root/repo/src/Php54ResourceParser.y"
+                                                                { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); }
+#line 5562 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 244:
-
-/* Line 1806 of yacc.c  */
-#line 1026 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 204: /* for_expr: %empty  */
+#line 947 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 5568 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 245:
-
-/* Line 1806 of yacc.c  */
-#line 1027 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 205: /* for_expr: non_empty_for_expr  */
+#line 948 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.statementList) = (yyvsp[0].statementList); }
+#line 5574 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 246:
-
-/* Line 1806 of yacc.c  */
-#line 1028 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 206: /* non_empty_for_expr: non_empty_for_expr ',' expr  */
+#line 952 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.statementList) = (yyvsp[-2].statementList)->Push((yyvsp[0].statement)); }
+#line 5580 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 247:
-
-/* Line 1806 of yacc.c  */
-#line 1029 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 207: /* non_empty_for_expr: expr  */
+#line 953 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { AST_INIT_ARGS((yyval.statementList), pelet::StatementListClass, (yyvsp[0].statement)); }
+#line 5586 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 248:
-
-/* Line 1806 of yacc.c  */
-#line 1030 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 209: /* chaining_method_or_property: variable_property  */
+#line 958 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 5592 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 249:
-
-/* Line 1806 of yacc.c  */
-#line 1031 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 211: /* chaining_dereference: '[' dim_offset ']'  */
+#line 963 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 5598 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 250:
-
-/* Line 1806 of yacc.c  */
-#line 1032 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 215: /* instance_call: %empty  */
+#line 973 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 5604 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 251:
-
-/* Line 1806 of yacc.c  */
-#line 1033 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 216: /* instance_call: chaining_instance_call  */
+#line 974 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 5610 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 252:
-
-/* Line 1806 of yacc.c  */
-#line 1034 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 217: /* new_expr: T_NEW class_name_reference ctor_arguments  */
+#line 978 "/root/repo/src/Php54ResourceParser.y"
+                                                                 { (yyval.unused) = 0; }
+#line 5616 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 253:
-
-/* Line 1806 of yacc.c  */
-#line 1035 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 218: /* expr_without_variable: T_LIST '(' assignment_list ')' '=' expr  */
+#line 982 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5622 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 254:
+  case 219: /* expr_without_variable: variable '=' expr  */
+#line 983 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        {
+																			  /* 
+																			   * since this parser only looks for defines or property assignments
+																			   * and there could never be both in one expression we can return
+																			   * just one
+																			   */
+																			  if ((yyvsp[-2].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-2].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-2].statement);
+																			  }
+																			  else {
+																				(yyval.statement) = (yyvsp[0].statement);
+																			  } 
+																			}
+#line 5640 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1036 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 220: /* expr_without_variable: variable '=' '&' variable  */
+#line 996 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; 
+																			  if ((yyvsp[-3].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-3].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-3].statement);
+																			  }
+																			}
+#line 5650 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 255:
+  case 221: /* expr_without_variable: variable '=' '&' T_NEW class_name_reference ctor_arguments  */
+#line 1001 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statement) = 0; 
+																			  if ((yyvsp[-5].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-5].statement)->Type) {
+																				(yyval.statement) = (yyvsp[-5].statement);
+																			  }
+																			}
+#line 5660 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1037 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 222: /* expr_without_variable: T_CLONE expr  */
+#line 1006 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5666 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 256:
+  case 223: /* expr_without_variable: variable T_PLUS_EQUAL expr  */
+#line 1007 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5672 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1038 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 224: /* expr_without_variable: variable T_MINUS_EQUAL expr  */
+#line 1008 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5678 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 257:
+  case 225: /* expr_without_variable: variable T_MUL_EQUAL expr  */
+#line 1009 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5684 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1039 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 226: /* expr_without_variable: variable T_DIV_EQUAL expr  */
+#line 1010 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5690 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 258:
+  case 227: /* expr_without_variable: variable T_CONCAT_EQUAL expr  */
+#line 1011 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5696 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1040 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 228: /* expr_without_variable: variable T_MOD_EQUAL expr  */
+#line 1012 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5702 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 259:
+  case 229: /* expr_without_variable: variable T_AND_EQUAL expr  */
+#line 1013 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5708 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1041 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 230: /* expr_without_variable: variable T_OR_EQUAL expr  */
+#line 1014 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5714 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 260:
+  case 231: /* expr_without_variable: variable T_XOR_EQUAL expr  */
+#line 1015 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5720 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1042 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 232: /* expr_without_variable: variable T_SL_EQUAL expr  */
+#line 1016 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5726 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 261:
+  case 233: /* expr_without_variable: variable T_SR_EQUAL expr  */
+#line 1017 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5732 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1043 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 234: /* expr_without_variable: rw_variable T_INC  */
+#line 1018 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5738 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 262:
+  case 235: /* expr_without_variable: T_INC rw_variable  */
+#line 1019 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5744 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1044 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 236: /* expr_without_variable: rw_variable T_DEC  */
+#line 1020 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5750 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 263:
+  case 237: /* expr_without_variable: T_DEC rw_variable  */
+#line 1021 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5756 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1045 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 238: /* expr_without_variable: expr T_BOOLEAN_OR expr  */
+#line 1022 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5762 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 264:
+  case 239: /* expr_without_variable: expr T_BOOLEAN_AND expr  */
+#line 1023 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5768 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1046 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 240: /* expr_without_variable: expr T_LOGICAL_OR expr  */
+#line 1024 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5774 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 265:
+  case 241: /* expr_without_variable: expr T_LOGICAL_AND expr  */
+#line 1025 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5780 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1047 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 242: /* expr_without_variable: expr T_LOGICAL_XOR expr  */
+#line 1026 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5786 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 266:
+  case 243: /* expr_without_variable: expr '|' expr  */
+#line 1027 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5792 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1048 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 244: /* expr_without_variable: expr '&' expr  */
+#line 1028 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5798 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 267:
+  case 245: /* expr_without_variable: expr '^' expr  */
+#line 1029 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5804 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1049 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (3)].statement); }
+  case 246: /* expr_without_variable: expr '.' expr  */
+#line 1030 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5810 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 268:
+  case 247: /* expr_without_variable: expr '+' expr  */
+#line 1031 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5816 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1050 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 248: /* expr_without_variable: expr '-' expr  */
+#line 1032 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5822 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 269:
+  case 249: /* expr_without_variable: expr '*' expr  */
+#line 1033 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5828 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1051 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 250: /* expr_without_variable: expr '/' expr  */
+#line 1034 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5834 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 270:
+  case 251: /* expr_without_variable: expr '%' expr  */
+#line 1035 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5840 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1054 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 252: /* expr_without_variable: expr T_SL expr  */
+#line 1036 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5846 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 271:
+  case 253: /* expr_without_variable: expr T_SR expr  */
+#line 1037 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5852 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1056 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 254: /* expr_without_variable: '+' expr  */
+#line 1038 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5858 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 272:
+  case 255: /* expr_without_variable: '-' expr  */
+#line 1039 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5864 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1057 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 256: /* expr_without_variable: '!' expr  */
+#line 1040 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5870 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 273:
+  case 257: /* expr_without_variable: '~' expr  */
+#line 1041 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5876 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1058 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 258: /* expr_without_variable: expr T_IS_IDENTICAL expr  */
+#line 1042 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5882 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 274:
+  case 259: /* expr_without_variable: expr T_IS_NOT_IDENTICAL expr  */
+#line 1043 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5888 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1059 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 260: /* expr_without_variable: expr T_IS_EQUAL expr  */
+#line 1044 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5894 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 275:
+  case 261: /* expr_without_variable: expr T_IS_NOT_EQUAL expr  */
+#line 1045 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 5900 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1060 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 262: /* expr_without_variable: expr '<' expr  */
+#line 1046 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5906 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 276:
+  case 263: /* expr_without_variable: expr T_IS_SMALLER_OR_EQUAL expr  */
+#line 1047 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5912 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1061 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 264: /* expr_without_variable: expr '>' expr  */
+#line 1048 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5918 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 277:
+  case 265: /* expr_without_variable: expr T_IS_GREATER_OR_EQUAL expr  */
+#line 1049 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5924 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1062 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 266: /* expr_without_variable: expr T_INSTANCEOF class_name_reference  */
+#line 1050 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statement) = 0; }
+#line 5930 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 278:
+  case 267: /* expr_without_variable: '(' expr ')'  */
+#line 1051 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = (yyvsp[-1].statement); }
+#line 5936 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1063 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 268: /* expr_without_variable: new_expr  */
+#line 1052 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5942 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 279:
+  case 269: /* expr_without_variable: '(' new_expr ')' instance_call  */
+#line 1053 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 5948 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1064 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 270: /* expr_without_variable: expr '?' expr ':' expr  */
+#line 1056 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5954 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 280:
+  case 271: /* expr_without_variable: expr '?' ':' expr  */
+#line 1058 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 5960 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1065 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 272: /* expr_without_variable: internal_functions_in_yacc  */
+#line 1059 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 5966 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 281:
+  case 273: /* expr_without_variable: T_INT_CAST expr  */
+#line 1060 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5972 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1066 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(2) - (2)].statement); }
+  case 274: /* expr_without_variable: T_DOUBLE_CAST expr  */
+#line 1061 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5978 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 282:
+  case 275: /* expr_without_variable: T_STRING_CAST expr  */
+#line 1062 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5984 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1067 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 276: /* expr_without_variable: T_ARRAY_CAST expr  */
+#line 1063 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5990 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 283:
+  case 277: /* expr_without_variable: T_OBJECT_CAST expr  */
+#line 1064 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 5996 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1068 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 278: /* expr_without_variable: T_BOOL_CAST expr  */
+#line 1065 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 6002 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 284:
+  case 279: /* expr_without_variable: T_UNSET_CAST expr  */
+#line 1066 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 6008 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1069 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 280: /* expr_without_variable: T_EXIT exit_expr  */
+#line 1067 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 6014 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 285:
+  case 281: /* expr_without_variable: '@' expr  */
+#line 1068 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6020 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1070 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 282: /* expr_without_variable: scalar  */
+#line 1069 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6026 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 286:
+  case 283: /* expr_without_variable: T_ARRAY '(' array_pair_list ')'  */
+#line 1070 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 6032 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1071 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 284: /* expr_without_variable: '[' array_pair_list ']'  */
+#line 1071 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 6038 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 287:
+  case 285: /* expr_without_variable: '`' backticks_expr '`'  */
+#line 1072 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statement) = 0; }
+#line 6044 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1073 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 286: /* expr_without_variable: T_PRINT expr  */
+#line 1073 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statement) = 0; }
+#line 6050 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 288:
+  case 287: /* $@7: %empty  */
+#line 1075 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 6056 "/root/repo/src/Php54ResourceParser.cpp"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1074 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.EndAnonymousFunction();
+  case 288: /* expr_without_variable: function is_reference '(' parameter_list ')' lexical_vars '{' $@7 inner_statement_list '}'  */
+#line 1076 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { observers.EndAnonymousFunction();
 																			  (yyval.statement) = 0; 
 																			}
+#line 6064 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 289:
-
-/* Line 1806 of yacc.c  */
-#line 1078 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.IncrementAnonymousFunctionCount(); }
+  case 289: /* $@8: %empty  */
+#line 1080 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { observers.IncrementAnonymousFunctionCount(); }
+#line 6070 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 290:
-
-/* Line 1806 of yacc.c  */
-#line 1079 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.EndAnonymousFunction(); 
+  case 290: /* expr_without_variable: T_STATIC function is_reference '(' parameter_list ')' lexical_vars '{' $@8 inner_statement_list '}'  */
+#line 1081 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { observers.EndAnonymousFunction(); 
 																			  (yyval.statement) = 0; 
 																			}
+#line 6078 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 292:
-
-/* Line 1806 of yacc.c  */
-#line 1089 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 292: /* lexical_vars: %empty  */
+#line 1091 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6084 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 293:
-
-/* Line 1806 of yacc.c  */
-#line 1090 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 293: /* lexical_vars: T_USE '(' lexical_var_list ')'  */
+#line 1092 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6090 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 294:
-
-/* Line 1806 of yacc.c  */
-#line 1094 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 294: /* lexical_var_list: lexical_var_list ',' T_VARIABLE  */
+#line 1096 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6096 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 295:
-
-/* Line 1806 of yacc.c  */
-#line 1095 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 295: /* lexical_var_list: lexical_var_list ',' '&' T_VARIABLE  */
+#line 1097 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6102 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 296:
-
-/* Line 1806 of yacc.c  */
-#line 1096 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 296: /* lexical_var_list: T_VARIABLE  */
+#line 1098 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6108 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 297:
-
-/* Line 1806 of yacc.c  */
-#line 1097 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 297: /* lexical_var_list: '&' T_VARIABLE  */
+#line 1099 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6114 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 298:
-
-/* Line 1806 of yacc.c  */
-#line 1101 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
+  case 298: /* $@9: %empty  */
+#line 1103 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                { if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
 																							observers.DoCaptureScalars = true;
 																							observers.DoCaptureCallArguments = true; 
 																						  }
-																						  if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) {
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) {
 																							observers.HasCallToFuncGetArg = true;
 																						  }
-																						  if ((yyvsp[(1) - (2)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) {
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) {
 																							observers.HasCallToFuncGetArg = true;
 																						  }
 																						}
+#line 6130 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 299:
-
-/* Line 1806 of yacc.c  */
-#line 1112 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { /* this parser is only interested in calls to the define function */
-																						  if ((yyvsp[(1) - (5)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
+  case 299: /* function_call: namespace_name '(' $@9 function_call_parameter_list ')'  */
+#line 1114 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { /* this parser is only interested in calls to the define function */
+																						  if ((yyvsp[-4].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
 																							pelet::ConstantStatementClass* constStmt;
-																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[(1) - (5)].qualifiedName), (yyvsp[(4) - (5)].statementList), analyzer.GetLineNumber());
+																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[-4].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber());
 																							(yyval.statement) = constStmt;
 																						  }
 																						  else {
@@ -5988,40 +6143,37 @@ yyreduce:
 																						  observers.DoCaptureScalars = false;	
 																						  observers.DoCaptureCallArguments = false; 
 																						}
+#line 6147 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 300:
-
-/* Line 1806 of yacc.c  */
-#line 1126 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 300: /* function_call: T_NAMESPACE T_NS_SEPARATOR namespace_name '(' function_call_parameter_list ')'  */
+#line 1128 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6153 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 301:
-
-/* Line 1806 of yacc.c  */
-#line 1127 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
+  case 301: /* $@10: %empty  */
+#line 1129 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) { 
 																							observers.DoCaptureScalars = true; 
 																							observers.DoCaptureCallArguments = true; 
 																						  }
-																						  if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) {
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_arg"), 0) == 0) {
 																							observers.HasCallToFuncGetArg = true;
 																						  }
-																						  if ((yyvsp[(2) - (3)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) {
+																						  if ((yyvsp[-1].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("func_get_args"), 0) == 0) {
 																							observers.HasCallToFuncGetArg = true;
 																						  }
 																						}
+#line 6169 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 302:
-
-/* Line 1806 of yacc.c  */
-#line 1138 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { /* this parser is only interested in calls to the define function */
-																						  if ((yyvsp[(2) - (6)].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
+  case 302: /* function_call: T_NS_SEPARATOR namespace_name '(' $@10 function_call_parameter_list ')'  */
+#line 1140 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { /* this parser is only interested in calls to the define function */
+																						  if ((yyvsp[-4].qualifiedName)->ToSignature().caseCompare(UNICODE_STRING_SIMPLE("define"), 0) == 0) {
 																							pelet::ConstantStatementClass* constStmt;
-																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[(2) - (6)].qualifiedName), (yyvsp[(5) - (6)].statementList), analyzer.GetLineNumber());
+																							AST_INIT_ARGS(constStmt, pelet::ConstantStatementClass, (yyvsp[-4].qualifiedName), (yyvsp[-1].statementList), analyzer.GetLineNumber());
 																							(yyval.statement) = constStmt;
 																						  }
 																						  else {
@@ -6030,1076 +6182,933 @@ yyreduce:
 																						  observers.DoCaptureScalars = false;
 																						  observers.DoCaptureCallArguments = false; 
 																						}
+#line 6186 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 303:
-
-/* Line 1806 of yacc.c  */
-#line 1151 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 303: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_name '(' function_call_parameter_list ')'  */
+#line 1153 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6192 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 304:
-
-/* Line 1806 of yacc.c  */
-#line 1153 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 304: /* function_call: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1155 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6198 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 305:
-
-/* Line 1806 of yacc.c  */
-#line 1155 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 305: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_name '(' function_call_parameter_list ')'  */
+#line 1157 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6204 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 306:
-
-/* Line 1806 of yacc.c  */
-#line 1157 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 306: /* function_call: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1159 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6210 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 307:
-
-/* Line 1806 of yacc.c  */
-#line 1159 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 307: /* function_call: variable_without_objects '(' function_call_parameter_list ')'  */
+#line 1161 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6216 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 308:
-
-/* Line 1806 of yacc.c  */
-#line 1163 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 308: /* class_name: T_STATIC  */
+#line 1165 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = 0; }
+#line 6222 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 309:
-
-/* Line 1806 of yacc.c  */
-#line 1164 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 309: /* class_name: namespace_name  */
+#line 1166 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6228 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 310:
-
-/* Line 1806 of yacc.c  */
-#line 1165 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(3) - (3)].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+  case 310: /* class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1167 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+#line 6234 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 311:
-
-/* Line 1806 of yacc.c  */
-#line 1166 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(2) - (2)].qualifiedName)->MakeAbsolute(); }
+  case 311: /* class_name: T_NS_SEPARATOR namespace_name  */
+#line 1168 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeAbsolute(); }
+#line 6240 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 312:
-
-/* Line 1806 of yacc.c  */
-#line 1170 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 312: /* fully_qualified_class_name: namespace_name  */
+#line 1172 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6246 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 313:
-
-/* Line 1806 of yacc.c  */
-#line 1171 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(3) - (3)].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+  case 313: /* fully_qualified_class_name: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1173 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeFromDeclaredNamespace(&observers.GetDeclaredNamespace()); }
+#line 6252 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 314:
-
-/* Line 1806 of yacc.c  */
-#line 1172 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(2) - (2)].qualifiedName)->MakeAbsolute(); }
+  case 314: /* fully_qualified_class_name: T_NS_SEPARATOR namespace_name  */
+#line 1174 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName)->MakeAbsolute(); }
+#line 6258 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 315:
-
-/* Line 1806 of yacc.c  */
-#line 1176 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 315: /* class_name_reference: class_name  */
+#line 1178 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6264 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 316:
-
-/* Line 1806 of yacc.c  */
-#line 1177 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = (yyvsp[(1) - (1)].qualifiedName); }
+  case 316: /* class_name_reference: dynamic_class_name_reference  */
+#line 1179 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.qualifiedName) = (yyvsp[0].qualifiedName); }
+#line 6270 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 317:
-
-/* Line 1806 of yacc.c  */
-#line 1182 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 317: /* dynamic_class_name_reference: base_variable T_OBJECT_OPERATOR object_property dynamic_class_name_variable_properties  */
+#line 1184 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.qualifiedName) = 0; }
+#line 6276 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 318:
-
-/* Line 1806 of yacc.c  */
-#line 1183 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.qualifiedName) = 0; }
+  case 318: /* dynamic_class_name_reference: base_variable  */
+#line 1185 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.qualifiedName) = 0; }
+#line 6282 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 319:
-
-/* Line 1806 of yacc.c  */
-#line 1187 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 319: /* dynamic_class_name_variable_properties: dynamic_class_name_variable_properties dynamic_class_name_variable_property  */
+#line 1189 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6288 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 320:
-
-/* Line 1806 of yacc.c  */
-#line 1188 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 320: /* dynamic_class_name_variable_properties: %empty  */
+#line 1190 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                                        { (yyval.unused) = 0; }
+#line 6294 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 321:
-
-/* Line 1806 of yacc.c  */
-#line 1192 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 321: /* dynamic_class_name_variable_property: T_OBJECT_OPERATOR object_property  */
+#line 1194 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6300 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 322:
-
-/* Line 1806 of yacc.c  */
-#line 1196 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 322: /* exit_expr: %empty  */
+#line 1198 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6306 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 323:
-
-/* Line 1806 of yacc.c  */
-#line 1197 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 323: /* exit_expr: '(' ')'  */
+#line 1199 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6312 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 324:
-
-/* Line 1806 of yacc.c  */
-#line 1198 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 324: /* exit_expr: '(' expr ')'  */
+#line 1200 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 6318 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 325:
-
-/* Line 1806 of yacc.c  */
-#line 1202 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 325: /* backticks_expr: %empty  */
+#line 1204 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6324 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 326:
-
-/* Line 1806 of yacc.c  */
-#line 1203 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 326: /* backticks_expr: T_ENCAPSED_AND_WHITESPACE  */
+#line 1205 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6330 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 327:
-
-/* Line 1806 of yacc.c  */
-#line 1204 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 327: /* backticks_expr: encaps_list  */
+#line 1206 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6336 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 328:
-
-/* Line 1806 of yacc.c  */
-#line 1208 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 328: /* ctor_arguments: %empty  */
+#line 1210 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6342 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 329:
-
-/* Line 1806 of yacc.c  */
-#line 1209 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 329: /* ctor_arguments: '(' function_call_parameter_list ')'  */
+#line 1211 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6348 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 330:
-
-/* Line 1806 of yacc.c  */
-#line 1213 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureScalars) {
+  case 330: /* common_scalar: T_LNUMBER  */
+#line 1215 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { if (observers.DoCaptureScalars) {
 																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
 																				(yyval.statement) = scalarExpr;
 																			  }
 																			  else { 
 																			    (yyval.statement) = 0; 
 																			  }
 																			}
+#line 6362 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 331:
-
-/* Line 1806 of yacc.c  */
-#line 1222 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureScalars) {
+  case 331: /* common_scalar: T_DNUMBER  */
+#line 1224 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { if (observers.DoCaptureScalars) {
 																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
 																				(yyval.statement) = scalarExpr;
 																			  }
 																			  else { 
 																			    (yyval.statement) = 0; 
 																			  }
 																			}
+#line 6376 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 332:
-
-/* Line 1806 of yacc.c  */
-#line 1231 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if (observers.DoCaptureScalars) {
+  case 332: /* common_scalar: T_CONSTANT_ENCAPSED_STRING  */
+#line 1233 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { if (observers.DoCaptureScalars) {
 																				pelet::ScalarExpressionClass* scalarExpr;
-																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[(1) - (1)].lexeme));
+																				AST_INIT_ARGS(scalarExpr, pelet::ScalarExpressionClass, (yyvsp[0].lexeme));
 																				(yyval.statement) = scalarExpr;
 																			  }
 																			  else { 
 																			    (yyval.statement) = 0; 
 																			  }
 																			}
+#line 6390 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 333:
-
-/* Line 1806 of yacc.c  */
-#line 1240 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 333: /* common_scalar: T_LINE  */
+#line 1242 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6396 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 334:
-
-/* Line 1806 of yacc.c  */
-#line 1241 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 334: /* common_scalar: T_FILE  */
+#line 1243 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6402 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 335:
-
-/* Line 1806 of yacc.c  */
-#line 1242 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 335: /* common_scalar: T_DIR  */
+#line 1244 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6408 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 336:
-
-/* Line 1806 of yacc.c  */
-#line 1243 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 336: /* common_scalar: T_TRAIT_C  */
+#line 1245 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6414 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 337:
-
-/* Line 1806 of yacc.c  */
-#line 1244 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 337: /* common_scalar: T_METHOD_C  */
+#line 1246 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6420 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 338:
-
-/* Line 1806 of yacc.c  */
-#line 1245 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 338: /* common_scalar: T_FUNC_C  */
+#line 1247 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6426 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 339:
-
-/* Line 1806 of yacc.c  */
-#line 1246 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 339: /* common_scalar: T_NS_C  */
+#line 1248 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statement) = 0; }
+#line 6432 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 340:
-
-/* Line 1806 of yacc.c  */
-#line 1247 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 340: /* common_scalar: T_START_HEREDOC T_ENCAPSED_AND_WHITESPACE T_END_HEREDOC  */
+#line 1249 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statement) = 0; }
+#line 6438 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 341:
-
-/* Line 1806 of yacc.c  */
-#line 1248 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 341: /* common_scalar: T_START_HEREDOC T_END_HEREDOC  */
+#line 1250 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.statement) = 0; }
+#line 6444 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 342:
-
-/* Line 1806 of yacc.c  */
-#line 1252 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 342: /* static_scalar: common_scalar  */
+#line 1254 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6450 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 343:
-
-/* Line 1806 of yacc.c  */
-#line 1253 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 343: /* static_scalar: namespace_name  */
+#line 1255 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6456 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 344:
-
-/* Line 1806 of yacc.c  */
-#line 1254 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 344: /* static_scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1256 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6462 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 345:
-
-/* Line 1806 of yacc.c  */
-#line 1255 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 345: /* static_scalar: T_NS_SEPARATOR namespace_name  */
+#line 1257 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6468 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 346:
-
-/* Line 1806 of yacc.c  */
-#line 1256 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 346: /* static_scalar: '+' static_scalar  */
+#line 1258 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6474 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 347:
-
-/* Line 1806 of yacc.c  */
-#line 1257 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 347: /* static_scalar: '-' static_scalar  */
+#line 1259 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6480 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 348:
-
-/* Line 1806 of yacc.c  */
-#line 1258 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 348: /* static_scalar: T_ARRAY '(' static_array_pair_list ')'  */
+#line 1260 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.unused) = 0; }
+#line 6486 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 349:
-
-/* Line 1806 of yacc.c  */
-#line 1259 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 349: /* static_scalar: static_class_constant  */
+#line 1261 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6492 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 350:
-
-/* Line 1806 of yacc.c  */
-#line 1260 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 350: /* static_scalar: '[' static_array_pair_list ']'  */
+#line 1262 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6498 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 351:
-
-/* Line 1806 of yacc.c  */
-#line 1261 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 351: /* static_scalar: T_CLASS_C  */
+#line 1263 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6504 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 352:
-
-/* Line 1806 of yacc.c  */
-#line 1265 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 352: /* static_class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1267 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6510 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 353:
-
-/* Line 1806 of yacc.c  */
-#line 1269 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 353: /* scalar: T_STRING_VARNAME  */
+#line 1271 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6516 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 354:
-
-/* Line 1806 of yacc.c  */
-#line 1270 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 354: /* scalar: class_constant  */
+#line 1272 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6522 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 355:
-
-/* Line 1806 of yacc.c  */
-#line 1271 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 355: /* scalar: namespace_name  */
+#line 1273 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statement) = 0; }
+#line 6528 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 356:
-
-/* Line 1806 of yacc.c  */
-#line 1272 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 356: /* scalar: T_NAMESPACE T_NS_SEPARATOR namespace_name  */
+#line 1274 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6534 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 357:
-
-/* Line 1806 of yacc.c  */
-#line 1273 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 357: /* scalar: T_NS_SEPARATOR namespace_name  */
+#line 1275 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 6540 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 358:
-
-/* Line 1806 of yacc.c  */
-#line 1274 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 358: /* scalar: common_scalar  */
+#line 1276 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 6546 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 359:
-
-/* Line 1806 of yacc.c  */
-#line 1275 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 359: /* scalar: '"' encaps_list '"'  */
+#line 1277 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.statement) = 0; }
+#line 6552 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 360:
-
-/* Line 1806 of yacc.c  */
-#line 1276 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 360: /* scalar: T_START_HEREDOC encaps_list T_END_HEREDOC  */
+#line 1278 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6558 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 361:
-
-/* Line 1806 of yacc.c  */
-#line 1277 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 361: /* scalar: T_CLASS_C  */
+#line 1279 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statement) = 0; }
+#line 6564 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 362:
-
-/* Line 1806 of yacc.c  */
-#line 1281 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 362: /* static_array_pair_list: %empty  */
+#line 1283 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 6570 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 363:
-
-/* Line 1806 of yacc.c  */
-#line 1282 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 363: /* static_array_pair_list: non_empty_static_array_pair_list possible_comma  */
+#line 1284 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6576 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 364:
-
-/* Line 1806 of yacc.c  */
-#line 1286 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isComma) = 0; }
+  case 364: /* possible_comma: %empty  */
+#line 1288 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.isComma) = 0; }
+#line 6582 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 365:
-
-/* Line 1806 of yacc.c  */
-#line 1287 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isComma) = 0; }
+  case 365: /* possible_comma: ','  */
+#line 1289 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.isComma) = 0; }
+#line 6588 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 370:
-
-/* Line 1806 of yacc.c  */
-#line 1298 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 370: /* expr: r_variable  */
+#line 1300 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6594 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 371:
-
-/* Line 1806 of yacc.c  */
-#line 1299 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 371: /* expr: expr_without_variable  */
+#line 1301 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6600 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 375:
-
-/* Line 1806 of yacc.c  */
-#line 1315 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if ((yyvsp[(1) - (1)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (1)].statement)->Type) {
+  case 375: /* $@11: %empty  */
+#line 1317 "/root/repo/src/Php54ResourceParser.y"
+                                                                { if ((yyvsp[0].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[0].statement)->Type) {
 													observers.DoCaptureProperties = true;	
 												  }
 												}
+#line 6609 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 376:
-
-/* Line 1806 of yacc.c  */
-#line 1320 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.DoCaptureProperties = false; }
+  case 376: /* $@12: %empty  */
+#line 1322 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { observers.DoCaptureProperties = false; }
+#line 6615 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 377:
-
-/* Line 1806 of yacc.c  */
-#line 1321 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { 
-													if ((yyvsp[(1) - (7)].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[(1) - (7)].statement)->Type && (yyvsp[(4) - (7)].lexeme) && !(yyvsp[(5) - (7)].isMethod)) {
+  case 377: /* variable: base_variable_with_function_calls $@11 T_OBJECT_OPERATOR object_property method_or_not $@12 variable_properties  */
+#line 1323 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { 
+													if ((yyvsp[-6].statement) && pelet::StatementClass::PROPERTY_DECLARATION == (yyvsp[-6].statement)->Type && (yyvsp[-3].lexeme) && !(yyvsp[-2].isMethod)) {
 														AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
 														
 														/* need to cast because we are returning a statement pointer from this rule */
-														(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeVariable((yyvsp[(4) - (7)].lexeme), (yyvsp[(4) - (7)].lexeme), false, (yyvsp[(4) - (7)].lexeme)->Pos, 
+														(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeVariable((yyvsp[-3].lexeme), (yyvsp[-3].lexeme), false, (yyvsp[-3].lexeme)->Pos, 
 														observers.GetScope(), observers.GetDeclaredNamespace());
 													}
 													else {
 														(yyval.statement) = 0; 
 													}													
 												}
+#line 6632 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 378:
-
-/* Line 1806 of yacc.c  */
-#line 1333 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 378: /* variable: base_variable_with_function_calls  */
+#line 1335 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 6638 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 379:
-
-/* Line 1806 of yacc.c  */
-#line 1337 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 379: /* variable_properties: variable_properties variable_property  */
+#line 1339 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6644 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 380:
-
-/* Line 1806 of yacc.c  */
-#line 1338 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 380: /* variable_properties: %empty  */
+#line 1340 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6650 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 381:
-
-/* Line 1806 of yacc.c  */
-#line 1342 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 381: /* variable_property: T_OBJECT_OPERATOR object_property method_or_not  */
+#line 1344 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6656 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 382:
-
-/* Line 1806 of yacc.c  */
-#line 1346 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (4)].statement); }
+  case 382: /* array_method_dereference: array_method_dereference '[' dim_offset ']'  */
+#line 1348 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statement) = (yyvsp[-3].statement); }
+#line 6662 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 383:
-
-/* Line 1806 of yacc.c  */
-#line 1347 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (4)].statement); }
+  case 383: /* array_method_dereference: method '[' dim_offset ']'  */
+#line 1349 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.statement) = (yyvsp[-3].statement); }
+#line 6668 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 384:
-
-/* Line 1806 of yacc.c  */
-#line 1351 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 384: /* method: '(' function_call_parameter_list ')'  */
+#line 1353 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 6674 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 385:
-
-/* Line 1806 of yacc.c  */
-#line 1355 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isMethod) = 1; }
+  case 385: /* method_or_not: method  */
+#line 1357 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.isMethod) = 1; }
+#line 6680 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 386:
-
-/* Line 1806 of yacc.c  */
-#line 1356 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isMethod) = 0; }
+  case 386: /* method_or_not: array_method_dereference  */
+#line 1358 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.isMethod) = 0; }
+#line 6686 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 387:
-
-/* Line 1806 of yacc.c  */
-#line 1357 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.isMethod) = 0; }
+  case 387: /* method_or_not: %empty  */
+#line 1359 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.isMethod) = 0; }
+#line 6692 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 389:
-
-/* Line 1806 of yacc.c  */
-#line 1362 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 389: /* variable_without_objects: simple_indirect_reference reference_variable  */
+#line 1364 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.lexeme) = 0; }
+#line 6698 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 390:
-
-/* Line 1806 of yacc.c  */
-#line 1366 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 390: /* static_member: class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1368 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6704 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 391:
-
-/* Line 1806 of yacc.c  */
-#line 1367 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 391: /* static_member: variable_class_name T_PAAMAYIM_NEKUDOTAYIM variable_without_objects  */
+#line 1369 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6710 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 392:
-
-/* Line 1806 of yacc.c  */
-#line 1371 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 392: /* variable_class_name: reference_variable  */
+#line 1373 "/root/repo/src/Php54ResourceParser.y"
+                                                         { (yyval.unused) = 0; }
+#line 6716 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 395:
-
-/* Line 1806 of yacc.c  */
-#line 1380 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { if ((yyvsp[(1) - (1)].lexeme) && (yyvsp[(1) - (1)].lexeme)->Lexeme.caseCompare(UNICODE_STRING_SIMPLE("$this"), 0) == 0) {
+  case 395: /* base_variable_with_function_calls: base_variable  */
+#line 1382 "/root/repo/src/Php54ResourceParser.y"
+                                                        { if ((yyvsp[0].lexeme) && (yyvsp[0].lexeme)->Lexeme.caseCompare(UNICODE_STRING_SIMPLE("$this"), 0) == 0) {
 										AST_INIT((yyval.statement), pelet::ClassMemberSymbolClass);
 										
 										/* need to cast because we are returning a statement pointer from this rule */
-										(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeAsPublicVariable((yyvsp[(1) - (1)].lexeme), observers.GetScope(), observers.GetDeclaredNamespace());
+										(( pelet::ClassMemberSymbolClass*)(yyval.statement))->MakeAsPublicVariable((yyvsp[0].lexeme), observers.GetScope(), observers.GetDeclaredNamespace());
 									  }
 									  else {
 										(yyval.statement) = 0; 
 									  }
 									}
+#line 6731 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 396:
-
-/* Line 1806 of yacc.c  */
-#line 1390 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 396: /* base_variable_with_function_calls: array_function_dereference  */
+#line 1392 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.statement) = 0; }
+#line 6737 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 397:
-
-/* Line 1806 of yacc.c  */
-#line 1391 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 397: /* base_variable_with_function_calls: function_call  */
+#line 1393 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 6743 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 398:
-
-/* Line 1806 of yacc.c  */
-#line 1396 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 398: /* base_variable: reference_variable  */
+#line 1398 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6749 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 399:
-
-/* Line 1806 of yacc.c  */
-#line 1397 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 399: /* base_variable: simple_indirect_reference reference_variable  */
+#line 1399 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.lexeme) = 0; }
+#line 6755 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 400:
-
-/* Line 1806 of yacc.c  */
-#line 1398 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 400: /* base_variable: static_member  */
+#line 1400 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.lexeme) = 0; }
+#line 6761 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 401:
-
-/* Line 1806 of yacc.c  */
-#line 1402 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 401: /* reference_variable: reference_variable '[' dim_offset ']'  */
+#line 1404 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6767 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 402:
-
-/* Line 1806 of yacc.c  */
-#line 1403 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 402: /* reference_variable: reference_variable '{' expr '}'  */
+#line 1405 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6773 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 403:
-
-/* Line 1806 of yacc.c  */
-#line 1404 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 403: /* reference_variable: compound_variable  */
+#line 1406 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6779 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 404:
-
-/* Line 1806 of yacc.c  */
-#line 1408 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme);	}
+  case 404: /* compound_variable: T_VARIABLE  */
+#line 1410 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.lexeme) = (yyvsp[0].lexeme);	}
+#line 6785 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 405:
-
-/* Line 1806 of yacc.c  */
-#line 1409 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 405: /* compound_variable: '$' '{' expr '}'  */
+#line 1411 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.lexeme) = 0; }
+#line 6791 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 406:
-
-/* Line 1806 of yacc.c  */
-#line 1413 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 406: /* dim_offset: %empty  */
+#line 1415 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6797 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 407:
-
-/* Line 1806 of yacc.c  */
-#line 1414 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 407: /* dim_offset: expr  */
+#line 1416 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6803 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 410:
-
-/* Line 1806 of yacc.c  */
-#line 1423 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 410: /* object_dim_list: object_dim_list '[' dim_offset ']'  */
+#line 1425 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6809 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 411:
-
-/* Line 1806 of yacc.c  */
-#line 1424 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (4)].lexeme); }
+  case 411: /* object_dim_list: object_dim_list '{' expr '}'  */
+#line 1426 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.lexeme) = (yyvsp[-3].lexeme); }
+#line 6815 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 412:
-
-/* Line 1806 of yacc.c  */
-#line 1425 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = (yyvsp[(1) - (1)].lexeme); }
+  case 412: /* object_dim_list: variable_name  */
+#line 1427 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.lexeme) = (yyvsp[0].lexeme); }
+#line 6821 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 413:
-
-/* Line 1806 of yacc.c  */
-#line 1429 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = observers.DoCaptureProperties ? ((yyvsp[(1) - (1)].lexeme)) : 0; }
+  case 413: /* variable_name: T_STRING  */
+#line 1431 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.lexeme) = observers.DoCaptureProperties ? ((yyvsp[0].lexeme)) : 0; }
+#line 6827 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 414:
-
-/* Line 1806 of yacc.c  */
-#line 1430 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.lexeme) = 0; }
+  case 414: /* variable_name: '{' expr '}'  */
+#line 1432 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.lexeme) = 0; }
+#line 6833 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 415:
-
-/* Line 1806 of yacc.c  */
-#line 1434 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 415: /* simple_indirect_reference: '$'  */
+#line 1436 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6839 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 416:
-
-/* Line 1806 of yacc.c  */
-#line 1435 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 416: /* simple_indirect_reference: simple_indirect_reference '$'  */
+#line 1437 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 6845 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 419:
-
-/* Line 1806 of yacc.c  */
-#line 1444 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 419: /* assignment_list_element: variable  */
+#line 1446 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6851 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 420:
-
-/* Line 1806 of yacc.c  */
-#line 1445 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 420: /* assignment_list_element: T_LIST '(' assignment_list ')'  */
+#line 1447 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.unused) = 0; }
+#line 6857 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 421:
-
-/* Line 1806 of yacc.c  */
-#line 1446 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 421: /* assignment_list_element: %empty  */
+#line 1448 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 6863 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 422:
-
-/* Line 1806 of yacc.c  */
-#line 1450 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 422: /* array_pair_list: %empty  */
+#line 1452 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 6869 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 423:
-
-/* Line 1806 of yacc.c  */
-#line 1451 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 423: /* array_pair_list: non_empty_array_pair_list possible_comma  */
+#line 1453 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statementList) = 0; }
+#line 6875 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 424:
-
-/* Line 1806 of yacc.c  */
-#line 1455 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 424: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW expr  */
+#line 1457 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.statementList) = 0; }
+#line 6881 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 425:
-
-/* Line 1806 of yacc.c  */
-#line 1456 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 425: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr  */
+#line 1458 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = 0; }
+#line 6887 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 426:
-
-/* Line 1806 of yacc.c  */
-#line 1457 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 426: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW expr  */
+#line 1459 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.statementList) = 0; }
+#line 6893 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 427:
-
-/* Line 1806 of yacc.c  */
-#line 1458 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 427: /* non_empty_array_pair_list: expr  */
+#line 1460 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                        { (yyval.statementList) = 0; }
+#line 6899 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 428:
-
-/* Line 1806 of yacc.c  */
-#line 1459 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 428: /* non_empty_array_pair_list: non_empty_array_pair_list ',' expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1461 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.statementList) = 0; }
+#line 6905 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 429:
-
-/* Line 1806 of yacc.c  */
-#line 1460 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 429: /* non_empty_array_pair_list: non_empty_array_pair_list ',' '&' w_variable  */
+#line 1462 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.statementList) = 0; }
+#line 6911 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 430:
-
-/* Line 1806 of yacc.c  */
-#line 1461 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 430: /* non_empty_array_pair_list: expr T_DOUBLE_ARROW '&' w_variable  */
+#line 1463 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                { (yyval.statementList) = 0; }
+#line 6917 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 431:
-
-/* Line 1806 of yacc.c  */
-#line 1462 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statementList) = 0; }
+  case 431: /* non_empty_array_pair_list: '&' w_variable  */
+#line 1464 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                                { (yyval.statementList) = 0; }
+#line 6923 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 432:
-
-/* Line 1806 of yacc.c  */
-#line 1466 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 432: /* encaps_list: encaps_list encaps_var  */
+#line 1468 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 6929 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 433:
-
-/* Line 1806 of yacc.c  */
-#line 1467 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 433: /* encaps_list: encaps_list T_ENCAPSED_AND_WHITESPACE  */
+#line 1469 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6935 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 434:
-
-/* Line 1806 of yacc.c  */
-#line 1468 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 434: /* encaps_list: encaps_var  */
+#line 1470 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 6941 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 435:
-
-/* Line 1806 of yacc.c  */
-#line 1469 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 435: /* encaps_list: T_ENCAPSED_AND_WHITESPACE encaps_var  */
+#line 1471 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6947 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 436:
-
-/* Line 1806 of yacc.c  */
-#line 1473 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 436: /* encaps_var: T_VARIABLE  */
+#line 1475 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                                        { (yyval.unused) = 0; }
+#line 6953 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 437:
-
-/* Line 1806 of yacc.c  */
-#line 1474 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 437: /* encaps_var: T_VARIABLE '[' encaps_var_offset ']'  */
+#line 1476 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6959 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 438:
-
-/* Line 1806 of yacc.c  */
-#line 1475 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 438: /* encaps_var: T_VARIABLE T_OBJECT_OPERATOR T_STRING  */
+#line 1477 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                        { (yyval.unused) = 0; }
+#line 6965 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 439:
-
-/* Line 1806 of yacc.c  */
-#line 1476 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 439: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES expr '}'  */
+#line 1478 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                { (yyval.unused) = 0; }
+#line 6971 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 440:
-
-/* Line 1806 of yacc.c  */
-#line 1477 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 440: /* encaps_var: T_DOLLAR_OPEN_CURLY_BRACES T_STRING_VARNAME '[' expr ']' '}'  */
+#line 1479 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 6977 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 441:
-
-/* Line 1806 of yacc.c  */
-#line 1478 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 441: /* encaps_var: T_CURLY_OPEN variable '}'  */
+#line 1480 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                                        { (yyval.unused) = 0; }
+#line 6983 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 442:
-
-/* Line 1806 of yacc.c  */
-#line 1482 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 442: /* encaps_var_offset: T_STRING  */
+#line 1484 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 6989 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 443:
-
-/* Line 1806 of yacc.c  */
-#line 1483 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 443: /* encaps_var_offset: T_NUM_STRING  */
+#line 1485 "/root/repo/src/Php54ResourceParser.y"
+                                        { (yyval.unused) = 0; }
+#line 6995 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 444:
-
-/* Line 1806 of yacc.c  */
-#line 1484 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 444: /* encaps_var_offset: T_VARIABLE  */
+#line 1486 "/root/repo/src/Php54ResourceParser.y"
+                                                { (yyval.unused) = 0; }
+#line 7001 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 445:
-
-/* Line 1806 of yacc.c  */
-#line 1488 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 445: /* internal_functions_in_yacc: T_ISSET '(' isset_variables ')'  */
+#line 1490 "/root/repo/src/Php54ResourceParser.y"
+                                                                { (yyval.statement) = 0; }
+#line 7007 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 446:
-
-/* Line 1806 of yacc.c  */
-#line 1489 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 446: /* internal_functions_in_yacc: T_EMPTY '(' variable ')'  */
+#line 1491 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 7013 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 447:
-
-/* Line 1806 of yacc.c  */
-#line 1490 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 447: /* $@13: %empty  */
+#line 1492 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { observers.DoCaptureScalars = true; }
+#line 7019 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 448:
-
-/* Line 1806 of yacc.c  */
-#line 1491 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
+  case 448: /* internal_functions_in_yacc: T_INCLUDE $@13 expr  */
+#line 1493 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
 												  (yyval.statement) = includeExpr;
 												  observers.DoCaptureScalars = false;  
 												}
+#line 7029 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 449:
-
-/* Line 1806 of yacc.c  */
-#line 1496 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 449: /* $@14: %empty  */
+#line 1498 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { observers.DoCaptureScalars = true; }
+#line 7035 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 450:
-
-/* Line 1806 of yacc.c  */
-#line 1497 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
+  case 450: /* internal_functions_in_yacc: T_INCLUDE_ONCE $@14 expr  */
+#line 1499 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
 												  (yyval.statement) = includeExpr;
 												  observers.DoCaptureScalars = false;  
 												}
+#line 7045 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 451:
-
-/* Line 1806 of yacc.c  */
-#line 1502 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.statement) = 0; }
+  case 451: /* internal_functions_in_yacc: T_EVAL '(' expr ')'  */
+#line 1504 "/root/repo/src/Php54ResourceParser.y"
+                                                                        { (yyval.statement) = 0; }
+#line 7051 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 452:
-
-/* Line 1806 of yacc.c  */
-#line 1503 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 452: /* $@15: %empty  */
+#line 1505 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { observers.DoCaptureScalars = true; }
+#line 7057 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 453:
-
-/* Line 1806 of yacc.c  */
-#line 1504 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
+  case 453: /* internal_functions_in_yacc: T_REQUIRE $@15 expr  */
+#line 1506 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
 												  (yyval.statement) = includeExpr;
 												  observers.DoCaptureScalars = false;  
 												}
+#line 7067 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 454:
-
-/* Line 1806 of yacc.c  */
-#line 1509 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { observers.DoCaptureScalars = true; }
+  case 454: /* $@16: %empty  */
+#line 1511 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { observers.DoCaptureScalars = true; }
+#line 7073 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 455:
-
-/* Line 1806 of yacc.c  */
-#line 1510 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { pelet::IncludeExpressionClass* includeExpr;
-												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[(3) - (3)].statement), analyzer.GetLineNumber());
+  case 455: /* internal_functions_in_yacc: T_REQUIRE_ONCE $@16 expr  */
+#line 1512 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { pelet::IncludeExpressionClass* includeExpr;
+												  AST_INIT_CARGS(includeExpr, pelet::IncludeExpressionClass, observers.GetScope(), (yyvsp[0].statement), analyzer.GetLineNumber());
 												  (yyval.statement) = includeExpr;
 												  observers.DoCaptureScalars = false;  
 												}
+#line 7083 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 456:
-
-/* Line 1806 of yacc.c  */
-#line 1517 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 456: /* isset_variables: variable  */
+#line 1519 "/root/repo/src/Php54ResourceParser.y"
+                                                                                { (yyval.unused) = 0; }
+#line 7089 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 457:
-
-/* Line 1806 of yacc.c  */
-#line 1518 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 457: /* isset_variables: isset_variables ',' variable  */
+#line 1520 "/root/repo/src/Php54ResourceParser.y"
+                                                        { (yyval.unused) = 0; }
+#line 7095 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 458:
-
-/* Line 1806 of yacc.c  */
-#line 1522 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 458: /* class_constant: class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1524 "/root/repo/src/Php54ResourceParser.y"
+                                                                                                { (yyval.unused) = 0; }
+#line 7101 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
-  case 459:
-
-/* Line 1806 of yacc.c  */
-#line 1523 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-    { (yyval.unused) = 0; }
+  case 459: /* class_constant: variable_class_name T_PAAMAYIM_NEKUDOTAYIM T_STRING  */
+#line 1525 "/root/repo/src/Php54ResourceParser.y"
+                                                                                        { (yyval.unused) = 0; }
+#line 7107 "/root/repo/src/Php54ResourceParser.cpp"
     break;
 
 
+#line 7111 "/root/repo/src/Php54ResourceParser.cpp"
 
-/* Line 1806 of yacc.c  */
-#line 7103 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -7113,96 +7122,88 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == PHP54_RESOURCE_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (analyzer, observers, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyps, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (analyzer, observers, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
-
-      if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+         error, discard it.  */
+
+      if (yychar <= T_END)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == T_END)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, analyzer, observers);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, analyzer, observers);
+          yychar = PHP54_RESOURCE_EMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -7214,14 +7215,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -7234,39 +7234,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -7277,27 +7280,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (analyzer, observers, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEMPTY)
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != PHP54_RESOURCE_EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -7305,30 +7312,36 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, analyzer, observers);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, analyzer, observers);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, analyzer, observers);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
+  return yyresult;
 }
-
-
-
-/* Line 2067 of yacc.c  */
-#line 1526 "/home/roberto/workspace/triumph4php/lib/pelet/src/Php54ResourceParser.y"
-
+#undef php54_resource_nerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 1528 "/root/repo/src/Php54ResourceParser.y"
@@ -0,0 +1,556 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/ProjectScannerClass.h>
+#include <pelet/ThreadClass.h>
+#include <pelet/SymbolRecorderClass.h>
+#include <algorithm>
+#include <deque>
+#include <ctype.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
+
+namespace pelet {
+
+/**
+ * The results of a single file, passed from a worker to the scanning thread
+ */
+class ScannedFileClass {
+
+public:
+
+	/**
+	 * position of the file in the scanner's file list
+	 */
+	size_t Index;
+
+	bool Parsed;
+
+	pelet::LintResultsClass Results;
+
+	/**
+	 * the class, class member, and function callbacks of the file
+	 */
+	SymbolRecorderClass Symbols;
+
+	ScannedFileClass(size_t index)
+		: Index(index)
+		, Parsed(false)
+		, Results()
+		, Symbols() {
+	}
+};
+
+class ScanWorkerClass;
+
+/**
+ * The state that is shared by the scanning thread and all of the workers
+ */
+class ScanContextClass {
+
+public:
+
+	const std::vector<std::string>& Files;
+
+	std::vector<ScanWorkerClass*> Workers;
+
+	ProjectScannerDeliveries Delivery;
+
+	/**
+	 * guards Finished
+	 */
+	MutexClass FinishedMutex;
+
+	/**
+	 * signaled when a file is added to Finished
+	 */
+	ConditionClass FinishedCondition;
+
+	/**
+	 * the files that the workers have parsed but that have not been replayed yet 
+	 * (the merge queue). The scanning thread owns these pointers once it 
+	 * takes them out of the queue.
+	 */
+	std::vector<ScannedFileClass*> Finished;
+
+	ScanContextClass(const std::vector<std::string>& files, ProjectScannerDeliveries delivery)
+		: Files(files)
+		, Workers()
+		, Delivery(delivery)
+		, FinishedMutex()
+		, FinishedCondition()
+		, Finished() {
+	}
+
+	/**
+	 * gets the next file for the given worker to parse
+	 *
+	 * @param worker the worker asking
+	 * @param index will be set to the position of the file to parse
+	 * @return bool FALSE when there are no more files to parse
+	 */
+	bool Next(size_t worker, size_t& index);
+
+	/**
+	 * give a parsed file to the scanning thread. 
+	 */
+	void Finish(ScannedFileClass* scanned) {
+		MutexLockerClass lock(FinishedMutex);
+		Finished.push_back(scanned);
+		FinishedCondition.Signal();
+	}
+};
+
+/**
+ * A worker thread. Each worker has its own parser and its own queue of files; the 
+ * queue is protected by a mutex since other workers may steal from it once 
+ * their own queue is empty. A worker takes files from the front of its own queue and
+ * steals from the back of the others.
+ */
+class ScanWorkerClass : public ThreadClass {
+
+public:
+
+	/**
+	 * the indexes of the files that this worker will parse
+	 */
+	std::deque<size_t> Queue;
+
+	MutexClass QueueMutex;
+
+	/**
+	 * TRUE if all of the files that this worker parsed were parsed successfully. Only
+	 * used in DELIVER_ON_WORKER_THREAD mode
+	 */
+	bool AllParsed;
+
+	ScanWorkerClass(ScanContextClass& context, size_t id)
+		: ThreadClass()
+		, Queue()
+		, QueueMutex()
+		, AllParsed(true)
+		, Context(context)
+		, Id(id)
+		, Parser()
+		, ProjectObserver(NULL)
+		, RecordClasses(false)
+		, RecordClassMembers(false)
+		, RecordFunctions(false) {
+	}
+
+	/**
+	 * set the observers and options of the parser
+	 */
+	void Init(Versions version, FileBufferTypes fileBufferType, ProjectScannerObserverClass* projectObserver,
+			ClassObserverClass* classObserver, ClassMemberObserverClass* classMemberObserver, 
+			FunctionObserverClass* functionObserver, VariableObserverClass* variableObserver, 
+			ExpressionObserverClass* expressionObserver) {
+		Parser.SetVersion(version);
+		Parser.SetFileBufferType(fileBufferType);
+		ProjectObserver = projectObserver;
+		if (DELIVER_ON_WORKER_THREAD == Context.Delivery) {
+			Parser.SetClassObserver(classObserver);
+			Parser.SetClassMemberObserver(classMemberObserver);
+			Parser.SetFunctionObserver(functionObserver);
+		}
+		else {
+			RecordClasses = classObserver != NULL;
+			RecordClassMembers = classMemberObserver != NULL;
+			RecordFunctions = functionObserver != NULL;
+		}
+		Parser.SetVariableObserver(variableObserver);
+		Parser.SetExpressionObserver(expressionObserver);
+	}
+
+	bool PopFront(size_t& index) {
+		MutexLockerClass lock(QueueMutex);
+		if (Queue.empty()) {
+			return false;
+		}
+		index = Queue.front();
+		Queue.pop_front();
+		return true;
+	}
+
+	bool PopBack(size_t& index) {
+		MutexLockerClass lock(QueueMutex);
+		if (Queue.empty()) {
+			return false;
+		}
+		index = Queue.back();
+		Queue.pop_back();
+		return true;
+	}
+
+	/**
+	 * parse files until there are no more files left in any queue
+	 */
+	void Work() {
+		size_t index = 0;
+		while (Context.Next(Id, index)) {
+			const std::string& file = Context.Files[index];
+			if (DELIVER_ON_WORKER_THREAD == Context.Delivery) {
+				pelet::LintResultsClass results;
+				if (ProjectObserver) {
+					ProjectObserver->FileStarted(file);
+				}
+				bool parsed = Parser.ScanFile(file, results);
+				AllParsed = AllParsed && parsed;
+				if (ProjectObserver) {
+					ProjectObserver->FileScanned(file, parsed, results);
+				}
+			}
+			else {
+				ScannedFileClass* scanned = new ScannedFileClass(index);
+				Parser.SetClassObserver(RecordClasses ? &scanned->Symbols : NULL);
+				Parser.SetClassMemberObserver(RecordClassMembers ? &scanned->Symbols : NULL);
+				Parser.SetFunctionObserver(RecordFunctions ? &scanned->Symbols : NULL);
+				scanned->Parsed = Parser.ScanFile(file, scanned->Results);
+				Context.Finish(scanned);
+			}
+		}
+	}
+
+protected:
+
+	void Run() {
+		Work();
+	}
+
+private:
+
+	ScanContextClass& Context;
+
+	size_t Id;
+
+	ParserClass Parser;
+
+	ProjectScannerObserverClass* ProjectObserver;
+
+	/**
+	 * TRUE if the callbacks of the corresponding observer need to be recorded 
+	 * for the scanning thread
+	 */
+	bool RecordClasses;
+
+	bool RecordClassMembers;
+
+	bool RecordFunctions;
+};
+
+}
+
+bool pelet::ScanContextClass::Next(size_t worker, size_t& index) {
+	if (Workers[worker]->PopFront(index)) {
+		return true;
+	}
+	for (size_t i = 1; i < Workers.size(); ++i) {
+		if (Workers[(worker + i) % Workers.size()]->PopBack(index)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * replays a file on the scanning thread, between the project observer's 
+ * FileStarted() and FileScanned() calls
+ *
+ * @return bool TRUE if the file was parsed successfully
+ */
+static bool Deliver(const pelet::ScannedFileClass& scanned, const std::vector<std::string>& files,
+		pelet::ProjectScannerObserverClass* projectObserver, pelet::ClassObserverClass* classObserver, 
+		pelet::ClassMemberObserverClass* memberObserver, pelet::FunctionObserverClass* functionObserver) {
+	const std::string& file = files[scanned.Index];
+	if (projectObserver) {
+		projectObserver->FileStarted(file);
+	}
+	scanned.Symbols.Replay(classObserver, memberObserver, functionObserver);
+	if (projectObserver) {
+		projectObserver->FileScanned(file, scanned.Parsed, scanned.Results);
+	}
+	return scanned.Parsed;
+}
+
+/**
+ * @return TRUE if fileName ends with "." + one of the extensions (ignoring case)
+ */
+static bool HasExtension(const std::string& fileName, const std::vector<std::string>& extensions) {
+	for (size_t i = 0; i < extensions.size(); ++i) {
+		const std::string& ext = extensions[i];
+		if (fileName.length() <= ext.length() || fileName[fileName.length() - ext.length() - 1] != '.') {
+			continue;
+		}
+		bool matches = true;
+		size_t start = fileName.length() - ext.length();
+		for (size_t j = 0; j < ext.length() && matches; ++j) {
+			matches = tolower((unsigned char)fileName[start + j]) == tolower((unsigned char)ext[j]);
+		}
+		if (matches) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * lists the entries in the given directory
+ *
+ * @param dir the directory to list
+ * @param files will be filled with the names (not the full paths) of the files
+ * @param dirs will be filled with the names of the sub-directories 
+ */
+static void ListDirectory(const std::string& dir, std::vector<std::string>& files, std::vector<std::string>& dirs) {
+#if defined(__WIN32__) || defined(_WIN32)
+	WIN32_FIND_DATAA data;
+	HANDLE handle = FindFirstFileA((dir + "\\*").c_str(), &data);
+	if (INVALID_HANDLE_VALUE == handle) {
+		return;
+	}
+	do {
+		std::string name = data.cFileName;
+		if (name == "." || name == "..") {
+			continue;
+		}
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			dirs.push_back(name);
+		}
+		else {
+			files.push_back(name);
+		}
+	} while (FindNextFileA(handle, &data));
+	FindClose(handle);
+#else
+	DIR* handle = opendir(dir.c_str());
+	if (!handle) {
+		return;
+	}
+	struct dirent* entry = NULL;
+	while ((entry = readdir(handle)) != NULL) {
+		std::string name = entry->d_name;
+		if (name == "." || name == "..") {
+			continue;
+		}
+		struct stat entryStat;
+		if (stat((dir + "/" + name).c_str(), &entryStat) != 0) {
+			continue;
+		}
+		if (S_ISDIR(entryStat.st_mode)) {
+			dirs.push_back(name);
+		}
+		else if (S_ISREG(entryStat.st_mode)) {
+			files.push_back(name);
+		}
+	}
+	closedir(handle);
+#endif
+}
+
+pelet::ProjectScannerClass::ProjectScannerClass()
+	: Files()
+	, ProjectObserver(NULL)
+	, ClassObserver(NULL)
+	, ClassMemberObserver(NULL)
+	, FunctionObserver(NULL)
+	, VariableObserver(NULL)
+	, ExpressionObserver(NULL)
+	, ThreadCount(0)
+	, Delivery(DELIVER_ON_WORKER_THREAD)
+	, Version(PHP_53)
+	, FileBufferType(STREAMING_FILE_BUFFER) {
+}
+
+void pelet::ProjectScannerClass::AddFile(const std::string& file) {
+	Files.push_back(file);
+}
+
+int pelet::ProjectScannerClass::AddDirectory(const std::string& rootDir, const std::vector<std::string>& extensions) {
+#if defined(__WIN32__) || defined(_WIN32)
+	const char separator = '\\';
+#else
+	const char separator = '/';
+#endif
+	std::string dir = rootDir;
+	if (!dir.empty() && (dir[dir.length() - 1] == '/' || dir[dir.length() - 1] == '\\')) {
+		dir.erase(dir.length() - 1);
+	}
+	std::vector<std::string> files;
+	std::vector<std::string> dirs;
+	ListDirectory(dir, files, dirs);
+	std::sort(files.begin(), files.end());
+	std::sort(dirs.begin(), dirs.end());
+	int added = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (HasExtension(files[i], extensions)) {
+			Files.push_back(dir + separator + files[i]);
+			added++;
+		}
+	}
+	for (size_t i = 0; i < dirs.size(); ++i) {
+		added += AddDirectory(dir + separator + dirs[i], extensions);
+	}
+	return added;
+}
+
+void pelet::ProjectScannerClass::ClearFiles() {
+	Files.clear();
+}
+
+const std::vector<std::string>& pelet::ProjectScannerClass::GetFiles() const {
+	return Files;
+}
+
+void pelet::ProjectScannerClass::SetThreadCount(int count) {
+	ThreadCount = count;
+}
+
+void pelet::ProjectScannerClass::SetDelivery(pelet::ProjectScannerDeliveries delivery) {
+	Delivery = delivery;
+}
+
+void pelet::ProjectScannerClass::SetVersion(pelet::Versions version) {
+	Version = version;
+}
+
+void pelet::ProjectScannerClass::SetFileBufferType(pelet::FileBufferTypes type) {
+	FileBufferType = type;
+}
+
+void pelet::ProjectScannerClass::SetProjectObserver(pelet::ProjectScannerObserverClass* observer) {
+	ProjectObserver = observer;
+}
+
+void pelet::ProjectScannerClass::SetClassObserver(pelet::ClassObserverClass* observer) {
+	ClassObserver = observer;
+}
+
+void pelet::ProjectScannerClass::SetClassMemberObserver(pelet::ClassMemberObserverClass* observer) {
+	ClassMemberObserver = observer;
+}
+
+void pelet::ProjectScannerClass::SetFunctionObserver(pelet::FunctionObserverClass* observer) {
+	FunctionObserver = observer;
+}
+
+void pelet::ProjectScannerClass::SetVariableObserver(pelet::VariableObserverClass* observer) {
+	VariableObserver = observer;
+}
+
+void pelet::ProjectScannerClass::SetExpressionObserver(pelet::ExpressionObserverClass* observer) {
+	ExpressionObserver = observer;
+}
+
+bool pelet::ProjectScannerClass::Scan() {
+	if (Files.empty()) {
+		return true;
+	}
+	size_t workerCount = ThreadCount > 0 ? (size_t)ThreadCount : (size_t)pelet::ThreadClass::ProcessorCount();
+	workerCount = std::min(workerCount, Files.size());
+	if (VariableObserver || ExpressionObserver) {
+		
+		// the parsers hand the statements of each file over to the expression observer
+		// (ExpressionObserverClass::StatementOwnership), an observer cannot be given
+		// to more than one parser at a time
+		workerCount = 1;
+	}
+
+	// files are dealt out round-robin so that every worker starts near the front
+	// of the list; this keeps the DELIVER_IN_ORDER backlog small
+	pelet::ScanContextClass context(Files, Delivery);
+	for (size_t i = 0; i < workerCount; ++i) {
+		pelet::ScanWorkerClass* worker = new pelet::ScanWorkerClass(context, i);
+		worker->Init(Version, FileBufferType, ProjectObserver, ClassObserver, ClassMemberObserver, 
+			FunctionObserver, VariableObserver, ExpressionObserver);
+		context.Workers.push_back(worker);
+	}
+	for (size_t i = 0; i < Files.size(); ++i) {
+		context.Workers[i % workerCount]->Queue.push_back(i);
+	}
+	size_t started = 0;
+	for (size_t i = 0; i < workerCount; ++i) {
+		if (context.Workers[i]->Start()) {
+			started++;
+		}
+	}
+	if (0 == started) {
+		
+		// could not create any threads; do all of the work in this thread
+		context.Workers[0]->Work();
+	}
+	bool allParsed = true;
+	if (DELIVER_ON_WORKER_THREAD != Delivery) {
+		
+		// the merge queue: take the parsed files from the workers and replay them
+		// here, one file at a time
+		std::vector<pelet::ScannedFileClass*> inOrder(Files.size(), (pelet::ScannedFileClass*)NULL);
+		size_t nextInOrder = 0;
+		size_t delivered = 0;
+		std::vector<pelet::ScannedFileClass*> ready;
+		while (delivered < Files.size()) {
+			{
+				pelet::MutexLockerClass lock(context.FinishedMutex);
+				while (context.Finished.empty()) {
+					context.FinishedCondition.Wait(context.FinishedMutex);
+				}
+				ready.swap(context.Finished);
+			}
+			if (DELIVER_IN_ORDER == Delivery) {
+				for (size_t i = 0; i < ready.size(); ++i) {
+					inOrder[ready[i]->Index] = ready[i];
+				}
+				while (nextInOrder < Files.size() && inOrder[nextInOrder]) {
+					allParsed = Deliver(*inOrder[nextInOrder], Files, ProjectObserver, ClassObserver, ClassMemberObserver, FunctionObserver) && allParsed;
+					delete inOrder[nextInOrder];
+					inOrder[nextInOrder] = NULL;
+					nextInOrder++;
+					delivered++;
+				}
+			}
+			else {
+				for (size_t i = 0; i < ready.size(); ++i) {
+					allParsed = Deliver(*ready[i], Files, ProjectObserver, ClassObserver, ClassMemberObserver, FunctionObserver) && allParsed;
+					delete ready[i];
+					delivered++;
+				}
+			}
+			ready.clear();
+		}
+	}
+	
+	// join all of the workers before deleting any, a worker may still be
+	// looking at the queue of another worker 
+	for (size_t i = 0; i < workerCount; ++i) {
+		context.Workers[i]->Join();
+		allParsed = allParsed && context.Workers[i]->AllParsed;
+	}
+	for (size_t i = 0; i < workerCount; ++i) {
+		delete context.Workers[i];
+	}
+	return allParsed;
+}
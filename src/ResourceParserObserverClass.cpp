@@ -29,7 +29,13 @@
 
 int pelet::ResourceLex(pelet::ResourceParserTypeClass* value, pelet::LexicalAnalyzerClass& analyzer, 
 						  pelet::ResourceParserObserverClass& observers) {
-	int ret = analyzer.NextToken();
+	int ret = 0;
+	if (observers.IsBodyStart()) {
+		ret = pelet::SkipBody(analyzer, observers.HasCallToFuncGetArg);
+	}
+	else {
+		ret = analyzer.NextToken();
+	}
 
 	// ignore these token; there are no parse rules for them
 	if (pelet::T_OPEN_TAG == ret || pelet::T_OPEN_TAG_WITH_ECHO == ret) {
@@ -61,13 +67,14 @@ int pelet::ResourceLex(pelet::ResourceParserTypeClass* value, pelet::LexicalAnal
 		pelet::T_TRAIT == ret ||
 		pelet::T_VAR == ret ||
 		pelet::T_VARIABLE == ret) {
-		value->lexeme = new pelet::SemanticValueClass;
-		observers.Adopt(value->lexeme);
+		pelet::AstArenaClass* arena = observers.GetArena();
+		value->lexeme = arena ? new (*arena) pelet::SemanticValueClass : new pelet::SemanticValueClass;
+		observers.AdoptToken(value->lexeme);
 
 		// advance past all comments (there can be more than one consecutive)
 		if (pelet::T_DOC_COMMENT == ret || pelet::T_COMMENT == ret) {
 			while (pelet::T_DOC_COMMENT == ret || pelet::T_COMMENT == ret) {
-				if (pelet::T_DOC_COMMENT == ret) {
+				if (pelet::T_DOC_COMMENT == ret && observers.DoCaptureComments) {
 					analyzer.GetLexeme(value->lexeme->Comment);
 				}
 				ret = analyzer.NextToken();
@@ -95,13 +102,18 @@ int pelet::ResourceLex(pelet::ResourceParserTypeClass* value, pelet::LexicalAnal
 		value->token.Pos = analyzer.GetCharacterPosition();
 		value->token.LineNumber = analyzer.GetLineNumber();
 	}
+	if (observers.DoSkipBodies) {
+		observers.WatchBodyToken(ret);
+	}
 	return ret;
 }
 
 void pelet::ResourceGrammarError(pelet::LexicalAnalyzerClass &analyzer, pelet::ResourceParserObserverClass& observers, std::string msg) {
 	int capacity = msg.length() + 1;
-	int written = u_sprintf(analyzer.ParserError.getBuffer(capacity), "%s", msg.c_str());
-	analyzer.ParserError.releaseBuffer(written);
+	UnicodeString error;
+	int written = u_sprintf(error.getBuffer(capacity), "%s", msg.c_str());
+	error.releaseBuffer(written);
+	analyzer.AddParserError(error);
 }
 
 pelet::ResourceParserObserverClass::ResourceParserObserverClass(pelet::ClassObserverClass* classObserver,
@@ -111,14 +123,34 @@ pelet::ResourceParserObserverClass::ResourceParserObserverClass(pelet::ClassObse
 	, DoCaptureCallArguments(false)
 	, DoCaptureProperties(false)
 	, HasCallToFuncGetArg(false)
+	, DoSkipBodies(false)
+	, DoNotifyEachStatement(false)
+	, DoCaptureComments(true)
 	, AllStatements() 
 	, Scope()
 	, DeclaredNamespace()
 	, Class(classObserver)
 	, Member(memberObserver)
 	, Function(functionObserver)
-	, AnonymousFunctionCount(-1) {
-
+	, ClassFields(0)
+	, MemberFields(0)
+	, FunctionFields(0)
+	, Arena(NULL)
+	, LastToken(NULL)
+	, NamespaceBlockDepth(0)
+	, AnonymousFunctionCount(-1)
+	, BodyWatcher() {
+	if (Class) {
+		ClassFields = Class->SymbolFields();
+	}
+	if (Member) {
+		MemberFields = Member->SymbolFields();
+	}
+	if (Function) {
+		FunctionFields = Function->SymbolFields();
+	}
+	int allFields = ClassFields | MemberFields | FunctionFields;
+	DoCaptureComments = (allFields & (pelet::SYMBOL_COMMENTS | pelet::SYMBOL_RETURN_TYPES)) != 0;
 }
 
 pelet::ResourceParserObserverClass::~ResourceParserObserverClass() {
@@ -129,7 +161,53 @@ pelet::ResourceParserObserverClass::~ResourceParserObserverClass() {
 }
 
 void pelet::ResourceParserObserverClass::Adopt(pelet::AstItemClass* astItem) {
-	AllStatements.push_back(astItem);
+	if (Arena) {
+		Arena->Adopt(astItem);
+	}
+	else {
+		AllStatements.push_back(astItem);
+	}
+}
+
+void pelet::ResourceParserObserverClass::AdoptToken(pelet::SemanticValueClass* value) {
+	Adopt(value);
+	LastToken = value;
+}
+
+void pelet::ResourceParserObserverClass::ReleaseStatements(pelet::StatementListClass* keep) {
+	if (keep) {
+		keep->Clear();
+	}
+	size_t kept = 0;
+	for (size_t i = 0; i < AllStatements.size(); ++i) {
+		if (AllStatements[i] == keep || AllStatements[i] == LastToken) {
+			AllStatements[kept++] = AllStatements[i];
+		}
+		else {
+			delete AllStatements[i];
+		}
+	}
+	AllStatements.resize(kept);
+}
+
+void pelet::ResourceParserObserverClass::BeginNamespaceBlock() {
+	NamespaceBlockDepth++;
+}
+
+void pelet::ResourceParserObserverClass::EndNamespaceBlock() {
+	NamespaceBlockDepth--;
+}
+
+bool pelet::ResourceParserObserverClass::IsAtTopLevel() const {
+	return NamespaceBlockDepth <= 0;
+}
+
+void pelet::ResourceParserObserverClass::SetArena(pelet::AstArenaClass* arena) {
+	Arena = arena;
+}
+
+pelet::AstArenaClass* pelet::ResourceParserObserverClass::GetArena() const {
+	return Arena;
 }
 
 void pelet::ResourceParserObserverClass::NamespaceUseAddScope(pelet::NamespaceUseClass* namespaceUse) {
@@ -177,6 +255,13 @@ void pelet::ResourceParserObserverClass::SetDeclaredNamespace(pelet::QualifiedNa
 	}
 }
 
+void pelet::ResourceParserObserverClass::SetStartingScope(const pelet::ScopeClass& scope, const pelet::QualifiedNameClass& declaredNamespace) {
+	Scope.Copy(scope);
+	Scope.ClassName.remove();
+	Scope.MethodName.remove();
+	DeclaredNamespace = declaredNamespace;
+}
+
 void pelet::ResourceParserObserverClass::DeclareAssignedProperties(pelet::StatementListClass* classStatements) {
 	if (NULL == classStatements || classStatements->Size() == 0) {
 		return;
@@ -212,6 +297,11 @@ void pelet::ResourceParserObserverClass::CreateMagicMethodsAndProperties(pelet::
 }
 
 void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* statements) {
+	if (!statements) {
+		
+		// __halt_compiler() has no statements
+		return;
+	}
 
 	// go through the list of statements and send the correct notifications
 	for (size_t i = 0; i < statements->Size(); ++i) {
@@ -221,6 +311,8 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 		pelet::ConstantStatementClass* constant;
 		pelet::ClassMemberSymbolClass* memberSymbol;
 		UnicodeString signature;
+		UnicodeString returnType;
+		UnicodeString implementsList;
 		UnicodeString comment;
 		pelet::TokenClass::TokenIds visibility;
 		pelet::NamespaceDeclarationClass* declaration;
@@ -232,11 +324,15 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 		case pelet::StatementClass::CLASS_DECLARATION:
 			if (Class) {
 				classSymbol = (pelet::ClassSymbolClass*) stmt;
+				if (ClassFields & pelet::SYMBOL_SIGNATURES) {
+					signature = classSymbol->ToSignature();
+					implementsList = classSymbol->ImplementsString();
+				}
 				Class->ClassFound(classSymbol->NamespaceName, 
 					classSymbol->ClassName, 
-					classSymbol->ToSignature(),
+					signature,
 					classSymbol->ExtendsFrom,
-					classSymbol->ImplementsString(),
+					implementsList,
 					classSymbol->Comment, classSymbol->StartingLineNumber);
 			}
 			if (Class) {
@@ -267,12 +363,18 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 				// method signature
 				// didnt feel like writing a whole other class for just for functions when functions and
 				// methods are almost identical
-				signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
-				signature.setTo(signature, signature.indexOf(UNICODE_STRING_SIMPLE("function")));
-
-
+				if (FunctionFields & pelet::SYMBOL_SIGNATURES) {
+					signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
+					signature.setTo(signature, signature.indexOf(UNICODE_STRING_SIMPLE("function")));
+				}
+				if (FunctionFields & pelet::SYMBOL_RETURN_TYPES) {
+					returnType = memberSymbol->GetReturnType();
+				}
+				if (FunctionFields & pelet::SYMBOL_COMMENTS) {
+					comment = memberSymbol->GetComment();
+				}
 				Function->FunctionFound(memberSymbol->NamespaceName, memberSymbol->MemberName, signature,
-										memberSymbol->GetReturnType(), memberSymbol->GetComment(), memberSymbol->StartingLineNumber,
+										returnType, comment, memberSymbol->StartingLineNumber,
 										memberSymbol->HasVariableArguments);
 				Function->FunctionScope(memberSymbol->NamespaceName, memberSymbol->MemberName,
 						memberSymbol->StartingPosition, memberSymbol->EndingPosition);
@@ -281,8 +383,15 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 		case pelet::StatementClass::METHOD_DECLARATION:
 			if (Member) {
 				memberSymbol = (pelet::ClassMemberSymbolClass*) stmt;
-				comment = memberSymbol->GetComment();
-				signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
+				if (MemberFields & pelet::SYMBOL_COMMENTS) {
+					comment = memberSymbol->GetComment();
+				}
+				if (MemberFields & pelet::SYMBOL_SIGNATURES) {
+					signature = memberSymbol->ToMethodSignature(memberSymbol->ParametersList.ToSignature());
+				}
+				if (MemberFields & pelet::SYMBOL_RETURN_TYPES) {
+					returnType = memberSymbol->GetReturnType();
+				}
 				visibility = pelet::TokenClass::PUBLIC;
 				if (memberSymbol->IsProtectedMember) {
 					visibility = pelet::TokenClass::PROTECTED;
@@ -290,7 +399,7 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 					visibility = pelet::TokenClass::PRIVATE;
 				}
 				Member->MethodFound(memberSymbol->NamespaceName, memberSymbol->ClassName, memberSymbol->MemberName, signature,
-									memberSymbol->GetReturnType(), comment, visibility, memberSymbol->IsStaticMember, memberSymbol->StartingLineNumber,
+									returnType, comment, visibility, memberSymbol->IsStaticMember, memberSymbol->StartingLineNumber,
 									memberSymbol->HasVariableArguments);
 				Member->MethodScope(memberSymbol->NamespaceName, memberSymbol->ClassName, memberSymbol->MemberName, 
 					memberSymbol->StartingPosition, memberSymbol->EndingPosition);
@@ -316,7 +425,12 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 		case pelet::StatementClass::PROPERTY_DECLARATION:
 			if (Member) {
 				memberSymbol = (pelet::ClassMemberSymbolClass*) stmt;
-				comment = memberSymbol->GetComment();
+				if (MemberFields & pelet::SYMBOL_COMMENTS) {
+					comment = memberSymbol->GetComment();
+				}
+				if (MemberFields & pelet::SYMBOL_RETURN_TYPES) {
+					returnType = memberSymbol->GetReturnType();
+				}
 				visibility = pelet::TokenClass::PUBLIC;
 				if (memberSymbol->IsProtectedMember) {
 					visibility = pelet::TokenClass::PROTECTED;
@@ -324,7 +438,7 @@ void pelet::ResourceParserObserverClass::MakeAst(pelet::StatementListClass* stat
 					visibility = pelet::TokenClass::PRIVATE;
 				}
 				Member->PropertyFound(memberSymbol->NamespaceName, memberSymbol->ClassName, memberSymbol->MemberName,
-									  memberSymbol->GetReturnType(), comment, visibility, memberSymbol->IsConstMember, memberSymbol->IsStaticMember, memberSymbol->StartingLineNumber);
+									  returnType, comment, visibility, memberSymbol->IsConstMember, memberSymbol->IsStaticMember, memberSymbol->StartingLineNumber);
 			}
 			break;
 		case pelet::StatementClass::TRAIT_ALIAS_DECLARATION:
@@ -364,4 +478,11 @@ const pelet::ScopeClass& pelet::ResourceParserObserverClass::GetScope() const {
 
 const pelet::QualifiedNameClass& pelet::ResourceParserObserverClass::GetDeclaredNamespace() const {
 	return DeclaredNamespace;
-}
\ No newline at end of file
+}
+void pelet::ResourceParserObserverClass::WatchBodyToken(int token) {
+	BodyWatcher.Watch(token);
+}
+
+bool pelet::ResourceParserObserverClass::IsBodyStart() const {
+	return BodyWatcher.IsBodyStart();
+}
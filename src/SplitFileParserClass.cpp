@@ -0,0 +1,546 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/SplitFileParserClass.h>
+#include <pelet/ResourceParserObserverClass.h>
+#include <pelet/SymbolRecorderClass.h>
+#include <pelet/ThreadClass.h>
+#include <pelet/TokenClass.h>
+#include <pelet/UCharMappedFileClass.h>
+#include <algorithm>
+#include <vector>
+
+/**
+ * the default smallest number of characters in a piece
+ */
+#define PELET_SPLIT_CHUNK_LENGTH (64 * 1024)
+
+/**
+ * the number of pieces to make for each thread, so that a thread that gets 
+ * small pieces does not sit idle while another parses a large one
+ */
+#define PELET_SPLIT_CHUNKS_PER_THREAD 4
+
+namespace pelet {
+
+/**
+ * A piece of the file, from one top-level declaration to just before another
+ */
+class SplitChunkClass {
+
+public:
+
+	/**
+	 * the start and end of the piece, and the namespace scope at its start
+	 */
+	BodyRangeClass Range;
+
+	/**
+	 * the character at Range.EndPos; it is replaced by a NULL while the 
+	 * pieces are parsed
+	 */
+	UChar EndChar;
+
+	bool Parsed;
+
+	LintResultsClass Results;
+
+	/**
+	 * the class, class member, and function callbacks of the piece
+	 */
+	SymbolRecorderClass Symbols;
+
+	SplitChunkClass()
+		: Range()
+		, EndChar(0)
+		, Parsed(false)
+		, Results()
+		, Symbols() {
+	}
+};
+
+/**
+ * The state that is shared by all of the workers
+ */
+class SplitContextClass {
+
+public:
+
+	const UChar* Code;
+
+	std::vector<SplitChunkClass*>& Chunks;
+
+	/**
+	 * TRUE if the callbacks of the corresponding observer need to be recorded 
+	 */
+	bool RecordClasses;
+
+	bool RecordClassMembers;
+
+	bool RecordFunctions;
+
+	Versions Version;
+
+	SplitContextClass(const UChar* code, std::vector<SplitChunkClass*>& chunks, Versions version)
+		: Code(code)
+		, Chunks(chunks)
+		, RecordClasses(false)
+		, RecordClassMembers(false)
+		, RecordFunctions(false)
+		, Version(version)
+		, NextMutex()
+		, NextChunk(0) {
+	}
+
+	/**
+	 * gets the next piece to parse
+	 *
+	 * @param index will be set to the position of the piece
+	 * @return bool FALSE when all of the pieces have been taken
+	 */
+	bool Next(size_t& index) {
+		MutexLockerClass lock(NextMutex);
+		if (NextChunk >= Chunks.size()) {
+			return false;
+		}
+		index = NextChunk;
+		NextChunk++;
+		return true;
+	}
+
+private:
+
+	/**
+	 * guards NextChunk
+	 */
+	MutexClass NextMutex;
+
+	size_t NextChunk;
+};
+
+/**
+ * A worker thread; it takes the pieces in order and parses each of them with its
+ * own parser.
+ */
+class SplitWorkerClass : public ThreadClass {
+
+public:
+
+	SplitWorkerClass(SplitContextClass& context)
+		: ThreadClass()
+		, Context(context)
+		, Parser() {
+		Parser.SetVersion(context.Version);
+	}
+
+	/**
+	 * parse pieces until there are no more pieces left
+	 */
+	void Work() {
+		size_t index = 0;
+		while (Context.Next(index)) {
+			SplitChunkClass* chunk = Context.Chunks[index];
+			Parser.SetClassObserver(Context.RecordClasses ? &chunk->Symbols : NULL);
+			Parser.SetClassMemberObserver(Context.RecordClassMembers ? &chunk->Symbols : NULL);
+			Parser.SetFunctionObserver(Context.RecordFunctions ? &chunk->Symbols : NULL);
+			chunk->Parsed = Parser.ScanRange(Context.Code, chunk->Range, chunk->Results);
+		}
+	}
+
+protected:
+
+	void Run() {
+		Work();
+	}
+
+private:
+
+	SplitContextClass& Context;
+
+	ParserClass Parser;
+};
+
+}
+
+/**
+ * @return TRUE if the given character can be replaced by a NULL without changing
+ *         the meaning of the code before it
+ */
+static bool IsSplitSpace(UChar c) {
+	return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+}
+
+/**
+ * @return TRUE if the given token starts a class, interface, trait, or function declaration
+ */
+static bool IsDeclarationStart(int token) {
+	return pelet::T_CLASS == token || pelet::T_ABSTRACT == token || pelet::T_FINAL == token 
+		|| pelet::T_INTERFACE == token || pelet::T_TRAIT == token || pelet::T_FUNCTION == token;
+}
+
+/**
+ * reads a namespace name (the names and separators) from the lexer
+ *
+ * @param lexer the lexer, positioned at the first token of the name
+ * @param token the current token; will be set to the token after the name
+ * @param name will be filled with the name
+ * @return bool TRUE if there was a name
+ */
+static bool ReadNamespaceName(pelet::LexicalAnalyzerClass& lexer, int& token, pelet::QualifiedNameClass& name) {
+	bool hasName = false;
+	while (pelet::T_STRING == token) {
+		pelet::SemanticValueClass value;
+		value.Token = token;
+		value.Pos = lexer.GetCharacterPosition();
+		value.LineNumber = lexer.GetLineNumber();
+		lexer.GetLexeme(value.Lexeme);
+		if (hasName) {
+			name.AppendName(&value);
+		}
+		else {
+			name.Init(&value);
+			hasName = true;
+		}
+		token = lexer.NextToken();
+		if (pelet::T_NS_SEPARATOR != token) {
+			break;
+		}
+		token = lexer.NextToken();
+	}
+	return hasName;
+}
+
+/**
+ * reads a top-level namespace declaration and sets it in the given observers, the
+ * same way that the resource parser does.
+ *
+ * @param lexer the lexer, positioned at the T_NAMESPACE token
+ * @param token will be set to the token after the name
+ * @param observers the observers that keep track of the namespace scope
+ * @return bool FALSE if the namespace uses the braced syntax
+ */
+static bool ReadNamespace(pelet::LexicalAnalyzerClass& lexer, int& token, pelet::ResourceParserObserverClass& observers) {
+	token = lexer.NextToken();
+	if (pelet::T_NS_SEPARATOR == token) {
+
+		// "namespace\func()", not a declaration
+		return true;
+	}
+	pelet::QualifiedNameClass name;
+	bool hasName = ReadNamespaceName(lexer, token, name);
+	if (';' != token || !hasName) {
+		return false;
+	}
+	observers.SetDeclaredNamespace(&name);
+	return true;
+}
+
+/**
+ * reads a top-level "use" statement and adds the aliases to the given observers, the
+ * same way that the resource parser does.
+ *
+ * @param lexer the lexer, positioned at the T_USE token
+ * @param token will be set to the token after the statement
+ * @param observers the observers that keep track of the namespace scope
+ */
+static void ReadUse(pelet::LexicalAnalyzerClass& lexer, int& token, pelet::ResourceParserObserverClass& observers) {
+	token = lexer.NextToken();
+	bool isList = true;
+	while (isList) {
+		if (pelet::T_NS_SEPARATOR == token) {
+			token = lexer.NextToken();
+		}
+		pelet::QualifiedNameClass name;
+		if (!ReadNamespaceName(lexer, token, name)) {
+
+			// the closure "use" list
+			return;
+		}
+		pelet::SemanticValueClass alias;
+		bool hasAlias = false;
+		if (pelet::T_AS == token) {
+			token = lexer.NextToken();
+			if (pelet::T_STRING == token) {
+				lexer.GetLexeme(alias.Lexeme);
+				hasAlias = true;
+				token = lexer.NextToken();
+			}
+		}
+		pelet::NamespaceUseClass namespaceUse;
+		namespaceUse.Init(&name, hasAlias ? &alias : NULL);
+		observers.NamespaceUseAddScope(&namespaceUse);
+		isList = ',' == token;
+		if (isList) {
+			token = lexer.NextToken();
+		}
+	}
+}
+
+/**
+ * lexes the code to find the places where it can be split. Every piece except 
+ * the first starts right after a whitespace character that follows a top-level 
+ * ';' or '}', and right before a declaration.
+ *
+ * @param code the code, code[length] must be NULL
+ * @param length the number of characters in code
+ * @param version the PHP version of the code
+ * @param chunkLength the smallest length of a piece
+ * @param chunks will be filled with the pieces, in order. This vector will own the 
+ *        pointers. There is always at least one piece.
+ */
+static void FindChunks(const UChar* code, int length, pelet::Versions version, int chunkLength, 
+		std::vector<pelet::SplitChunkClass*>& chunks) {
+	pelet::SplitChunkClass* chunk = new pelet::SplitChunkClass;
+	chunk->Range.StartPos = 0;
+	chunk->Range.EndPos = length;
+	chunk->Range.LineNumber = 1;
+	chunk->Range.Condition = pelet::yycINLINE_HTML;
+	chunks.push_back(chunk);
+
+	pelet::LexicalAnalyzerClass lexer;
+	lexer.SetVersion(version);
+	if (!lexer.OpenView(code, length, 0, 1, pelet::yycINLINE_HTML)) {
+		return;
+	}
+	pelet::ResourceParserObserverClass observers(NULL, NULL, NULL);
+	int depth = 0;
+
+	// the position right after the last top-level ';' or '}', -1 if the
+	// last token was not one of them
+	int boundary = -1;
+	int boundaryLine = 0;
+	bool isSplittable = true;
+	int token = lexer.NextToken();
+	while (isSplittable && !pelet::IsTerminatingToken(token) && pelet::T_HALT_COMPILER != token) {
+		if (pelet::T_COMMENT == token || pelet::T_DOC_COMMENT == token) {
+			token = lexer.NextToken();
+			continue;
+		}
+		if (boundary > 0 && IsDeclarationStart(token) && (boundary - chunk->Range.StartPos) >= chunkLength) {
+			chunk->Range.EndPos = boundary;
+			chunk = new pelet::SplitChunkClass;
+			chunk->Range.StartPos = boundary + 1;
+			chunk->Range.EndPos = length;
+
+			// the lexer of the next piece starts after the replaced character, the line 
+			// changes unless it is the CR of a CR LF
+			chunk->Range.LineNumber = boundaryLine;
+			if ('\n' == code[boundary] || ('\r' == code[boundary] && '\n' != code[boundary + 1])) {
+				chunk->Range.LineNumber++;
+			}
+			chunk->Range.Condition = pelet::yycSCRIPT;
+			chunk->Range.Scope.Copy(observers.GetScope());
+			chunk->Range.DeclaredNamespace = observers.GetDeclaredNamespace();
+			chunks.push_back(chunk);
+		}
+		boundary = -1;
+		if (0 == depth && pelet::T_NAMESPACE == token) {
+			isSplittable = ReadNamespace(lexer, token, observers);
+			continue;
+		}
+		if (0 == depth && pelet::T_USE == token) {
+			ReadUse(lexer, token, observers);
+			continue;
+		}
+		if ('{' == token || pelet::T_CURLY_OPEN == token || pelet::T_DOLLAR_OPEN_CURLY_BRACES == token) {
+			depth++;
+		}
+		else if ('}' == token && depth > 0) {
+			depth--;
+		}
+		if (0 == depth && (';' == token || '}' == token) && pelet::yycSCRIPT == lexer.GetCondition()) {
+			int pos = lexer.GetCharacterPosition() + 1;
+			if (pos < length && IsSplitSpace(code[pos])) {
+				boundary = pos;
+				boundaryLine = lexer.GetLineNumber();
+			}
+		}
+		token = lexer.NextToken();
+	}
+	lexer.Close();
+	if (!isSplittable) {
+		
+		// braced namespaces; the namespace of a piece would need to be 
+		// closed at the end of the piece
+		for (size_t i = 1; i < chunks.size(); ++i) {
+			delete chunks[i];
+		}
+		chunks.resize(1);
+		chunks[0]->Range.EndPos = length;
+	}
+}
+
+pelet::SplitFileParserClass::SplitFileParserClass()
+	: ClassObserver(NULL)
+	, ClassMemberObserver(NULL)
+	, FunctionObserver(NULL)
+	, ThreadCount(0)
+	, ChunkLength(PELET_SPLIT_CHUNK_LENGTH)
+	, Version(PHP_53)
+	, ChunkCount(0)
+	, IsFallback(false) {
+}
+
+void pelet::SplitFileParserClass::SetThreadCount(int count) {
+	ThreadCount = count;
+}
+
+void pelet::SplitFileParserClass::SetChunkLength(int length) {
+	ChunkLength = length;
+}
+
+void pelet::SplitFileParserClass::SetVersion(pelet::Versions version) {
+	Version = version;
+}
+
+void pelet::SplitFileParserClass::SetClassObserver(pelet::ClassObserverClass* observer) {
+	ClassObserver = observer;
+}
+
+void pelet::SplitFileParserClass::SetClassMemberObserver(pelet::ClassMemberObserverClass* observer) {
+	ClassMemberObserver = observer;
+}
+
+void pelet::SplitFileParserClass::SetFunctionObserver(pelet::FunctionObserverClass* observer) {
+	FunctionObserver = observer;
+}
+
+int pelet::SplitFileParserClass::GetChunkCount() const {
+	return ChunkCount;
+}
+
+bool pelet::SplitFileParserClass::WasFallback() const {
+	return IsFallback;
+}
+
+bool pelet::SplitFileParserClass::ScanFile(const std::string& file, pelet::LintResultsClass& results) {
+	pelet::UCharMappedFileClass mappedFile;
+	if (!mappedFile.OpenFile(file.c_str())) {
+		return false;
+	}
+	int length = mappedFile.GetLength();
+	std::vector<UChar> code(mappedFile.Current, mappedFile.Current + length);
+	code.push_back(0);
+	mappedFile.Close();
+	bool ret = Scan(&code[0], length, results);
+	results.File = file;
+	return ret;
+}
+
+bool pelet::SplitFileParserClass::ScanString(const UnicodeString& code, pelet::LintResultsClass& results) {
+	int length = code.length();
+	std::vector<UChar> chars(code.getBuffer(), code.getBuffer() + length);
+	chars.push_back(0);
+	return Scan(&chars[0], length, results);
+}
+
+bool pelet::SplitFileParserClass::Scan(UChar* code, int length, pelet::LintResultsClass& results) {
+	ChunkCount = 1;
+	IsFallback = false;
+	size_t threadCount = ThreadCount > 0 ? (size_t)ThreadCount : (size_t)pelet::ThreadClass::ProcessorCount();
+	std::vector<pelet::SplitChunkClass*> chunks;
+	if (threadCount > 1 && length >= 2 * ChunkLength) {
+		int chunkLength = std::max(ChunkLength, length / (int)(threadCount * PELET_SPLIT_CHUNKS_PER_THREAD));
+		FindChunks(code, length, Version, chunkLength, chunks);
+	}
+	pelet::ParserClass parser;
+	parser.SetVersion(Version);
+	if (chunks.size() <= 1) {
+		pelet::BodyRangeClass range;
+		range.StartPos = 0;
+		range.EndPos = length;
+		range.LineNumber = 1;
+		range.Condition = pelet::yycINLINE_HTML;
+		for (size_t i = 0; i < chunks.size(); ++i) {
+			delete chunks[i];
+		}
+		parser.SetClassObserver(ClassObserver);
+		parser.SetClassMemberObserver(ClassMemberObserver);
+		parser.SetFunctionObserver(FunctionObserver);
+		return parser.ScanRange(code, range, results);
+	}
+	ChunkCount = (int)chunks.size();
+	for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+		chunks[i]->EndChar = code[chunks[i]->Range.EndPos];
+		code[chunks[i]->Range.EndPos] = 0;
+	}
+	pelet::SplitContextClass context(code, chunks, Version);
+	context.RecordClasses = ClassObserver != NULL;
+	context.RecordClassMembers = ClassMemberObserver != NULL;
+	context.RecordFunctions = FunctionObserver != NULL;
+	size_t workerCount = std::min(threadCount, chunks.size());
+	std::vector<pelet::SplitWorkerClass*> workers;
+	size_t started = 0;
+	for (size_t i = 0; i < workerCount; ++i) {
+		pelet::SplitWorkerClass* worker = new pelet::SplitWorkerClass(context);
+		workers.push_back(worker);
+		if (worker->Start()) {
+			started++;
+		}
+	}
+	if (0 == started) {
+
+		// could not create any threads; do all of the work in this thread
+		workers[0]->Work();
+	}
+	for (size_t i = 0; i < workers.size(); ++i) {
+		workers[i]->Join();
+		delete workers[i];
+	}
+	for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+		code[chunks[i]->Range.EndPos] = chunks[i]->EndChar;
+	}
+	size_t parsed = 0;
+	while (parsed < chunks.size() && chunks[parsed]->Parsed) {
+		parsed++;
+	}
+	bool ret = true;
+	if (parsed < chunks.size()) {
+
+		// the rest of the file is parsed as one piece, starting at the 
+		// first piece that did not parse
+		IsFallback = true;
+		pelet::SplitChunkClass* rest = chunks[parsed];
+		rest->Range.EndPos = length;
+		rest->Symbols.Clear();
+		parser.SetClassObserver(context.RecordClasses ? &rest->Symbols : NULL);
+		parser.SetClassMemberObserver(context.RecordClassMembers ? &rest->Symbols : NULL);
+		parser.SetFunctionObserver(context.RecordFunctions ? &rest->Symbols : NULL);
+		ret = parser.ScanRange(code, rest->Range, rest->Results);
+		parsed++;
+	}
+
+	// the resource parser does not notify the observers when there is a 
+	// syntax error, neither does a split parse
+	if (ret) {
+		for (size_t i = 0; i < parsed; ++i) {
+			chunks[i]->Symbols.Replay(ClassObserver, ClassMemberObserver, FunctionObserver);
+		}
+	}
+	results.Copy(chunks[parsed - 1]->Results);
+	for (size_t i = 0; i < chunks.size(); ++i) {
+		delete chunks[i];
+	}
+	return ret;
+}
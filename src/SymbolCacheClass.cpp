@@ -0,0 +1,298 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/SymbolCacheClass.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+/**
+ * The cache file starts with a header
+ *   magic (8 bytes), format version, PHP version, number of files
+ * and then each file
+ *   path length, path (UTF-8), size (8 bytes), modification time (8 bytes), 
+ *   hash (8 bytes), callbacks length, callbacks
+ * all numbers are little endian; 4 bytes unless noted.
+ */
+#define PELET_SYMBOL_CACHE_MAGIC "PELETSYM"
+
+#define PELET_SYMBOL_CACHE_FORMAT 1
+
+static void WriteNumber(std::string& bytes, unsigned long long value, int size) {
+	for (int i = 0; i < size; ++i) {
+		bytes += (char)((value >> (8 * i)) & 0xFF);
+	}
+}
+
+/**
+ * reads a little endian number and advances the pointer
+ *
+ * @return bool FALSE if there are not enough bytes left
+ */
+static bool ReadNumber(const unsigned char*& bytes, const unsigned char* end, int size, unsigned long long& value) {
+	if (end - bytes < size) {
+		return false;
+	}
+	value = 0;
+	for (int i = 0; i < size; ++i) {
+		value |= ((unsigned long long)bytes[i]) << (8 * i);
+	}
+	bytes += size;
+	return true;
+}
+
+/**
+ * gets the size and modification time of a file
+ *
+ * @return bool FALSE if the file does not exist
+ */
+static bool StatFile(const std::string& file, long long& size, long long& modifiedTime) {
+#if defined(__WIN32__) || defined(_WIN32)
+	struct _stati64 info;
+	if (_stati64(file.c_str(), &info) != 0) {
+		return false;
+	}
+#else
+	struct stat info;
+	if (stat(file.c_str(), &info) != 0) {
+		return false;
+	}
+#endif
+	size = (long long)info.st_size;
+	modifiedTime = (long long)info.st_mtime;
+	return true;
+}
+
+/**
+ * hashes the contents of a file (64 bit FNV-1a)
+ *
+ * @return bool FALSE if the file could not be read
+ */
+static bool HashFile(const std::string& file, unsigned long long& hash) {
+	pelet::Utf8BufferClass contents;
+	if (!contents.OpenFile(file.c_str())) {
+		return false;
+	}
+	hash = 14695981039346656037ULL;
+	const unsigned char* end = contents.Current + contents.GetLength();
+	for (const unsigned char* c = contents.Current; c < end; ++c) {
+		hash ^= *c;
+		hash *= 1099511628211ULL;
+	}
+	return true;
+}
+
+pelet::SymbolCacheClass::EntryClass::EntryClass()
+	: Size(0)
+	, ModifiedTime(0)
+	, Hash(0)
+	, Data(NULL)
+	, Length(0)
+	, Owned() {
+}
+
+pelet::SymbolCacheClass::SymbolCacheClass()
+	: Entries()
+	, Mapping()
+	, Image()
+	, Parser()
+	, Recorder()
+	, ClassObserver(NULL)
+	, ClassMemberObserver(NULL)
+	, FunctionObserver(NULL)
+	, Version(PHP_53)
+	, HitCount(0)
+	, MissCount(0) {
+}
+
+void pelet::SymbolCacheClass::SetVersion(pelet::Versions version) {
+	Version = version;
+	Parser.SetVersion(version);
+}
+
+void pelet::SymbolCacheClass::SetClassObserver(pelet::ClassObserverClass* observer) {
+	ClassObserver = observer;
+}
+
+void pelet::SymbolCacheClass::SetClassMemberObserver(pelet::ClassMemberObserverClass* observer) {
+	ClassMemberObserver = observer;
+}
+
+void pelet::SymbolCacheClass::SetFunctionObserver(pelet::FunctionObserverClass* observer) {
+	FunctionObserver = observer;
+}
+
+void pelet::SymbolCacheClass::Clear() {
+	Entries.clear();
+	Mapping.Close();
+	Image.clear();
+}
+
+bool pelet::SymbolCacheClass::Load(const std::string& cacheFile) {
+	Clear();
+	if (!Mapping.OpenFile(cacheFile.c_str())) {
+		return false;
+	}
+	if (!Index((const char*)Mapping.Current, Mapping.GetLength())) {
+		Clear();
+		return false;
+	}
+	return true;
+}
+
+bool pelet::SymbolCacheClass::Index(const char* bytes, size_t length) {
+	Entries.clear();
+	size_t magicLength = strlen(PELET_SYMBOL_CACHE_MAGIC);
+	if (length < magicLength || memcmp(bytes, PELET_SYMBOL_CACHE_MAGIC, magicLength) != 0) {
+		return false;
+	}
+	const unsigned char* current = (const unsigned char*)bytes + magicLength;
+	const unsigned char* end = (const unsigned char*)bytes + length;
+	unsigned long long format = 0;
+	unsigned long long version = 0;
+	unsigned long long count = 0;
+	if (!ReadNumber(current, end, 4, format) || !ReadNumber(current, end, 4, version) || !ReadNumber(current, end, 4, count)
+			|| PELET_SYMBOL_CACHE_FORMAT != format || (unsigned long long)Version != version) {
+		return false;
+	}
+	for (unsigned long long i = 0; i < count; ++i) {
+		unsigned long long pathLength = 0;
+		if (!ReadNumber(current, end, 4, pathLength) || (unsigned long long)(end - current) < pathLength) {
+			return false;
+		}
+		std::string path((const char*)current, (size_t)pathLength);
+		current += pathLength;
+		EntryClass entry;
+		unsigned long long size = 0;
+		unsigned long long modifiedTime = 0;
+		unsigned long long dataLength = 0;
+		if (!ReadNumber(current, end, 8, size) || !ReadNumber(current, end, 8, modifiedTime) 
+				|| !ReadNumber(current, end, 8, entry.Hash) || !ReadNumber(current, end, 4, dataLength)
+				|| (unsigned long long)(end - current) < dataLength) {
+			return false;
+		}
+		entry.Size = (long long)size;
+		entry.ModifiedTime = (long long)modifiedTime;
+		entry.Data = (const char*)current;
+		entry.Length = (size_t)dataLength;
+		current += dataLength;
+		Entries[path] = entry;
+	}
+	return current == end;
+}
+
+bool pelet::SymbolCacheClass::Save(const std::string& cacheFile) {
+	std::string bytes = PELET_SYMBOL_CACHE_MAGIC;
+	WriteNumber(bytes, PELET_SYMBOL_CACHE_FORMAT, 4);
+	WriteNumber(bytes, Version, 4);
+	WriteNumber(bytes, Entries.size(), 4);
+	std::map<std::string, EntryClass>::const_iterator it;
+	for (it = Entries.begin(); it != Entries.end(); ++it) {
+		const EntryClass& entry = it->second;
+		WriteNumber(bytes, it->first.length(), 4);
+		bytes += it->first;
+		WriteNumber(bytes, (unsigned long long)entry.Size, 8);
+		WriteNumber(bytes, (unsigned long long)entry.ModifiedTime, 8);
+		WriteNumber(bytes, entry.Hash, 8);
+		WriteNumber(bytes, entry.Length, 4);
+		bytes.append(entry.Data, entry.Length);
+	}
+
+	// the entries now point to the new image, so the cache file can be
+	// unmapped and overwritten
+	Image.swap(bytes);
+	Index(Image.data(), Image.length());
+	Mapping.Close();
+
+	FILE* file = fopen(cacheFile.c_str(), "wb");
+	if (!file) {
+		return false;
+	}
+	bool ret = fwrite(Image.data(), 1, Image.length(), file) == Image.length();
+	ret = fclose(file) == 0 && ret;
+	return ret;
+}
+
+bool pelet::SymbolCacheClass::ScanFile(const std::string& file, pelet::LintResultsClass& results) {
+	results.Clear();
+	long long size = 0;
+	long long modifiedTime = 0;
+	unsigned long long hash = 0;
+	bool exists = StatFile(file, size, modifiedTime);
+	bool hashed = false;
+	std::map<std::string, EntryClass>::iterator it = Entries.find(file);
+	if (exists && it != Entries.end() && it->second.Size == size) {
+		bool same = it->second.ModifiedTime == modifiedTime;
+		if (!same) {
+			hashed = HashFile(file, hash);
+			same = hashed && hash == it->second.Hash;
+			if (same) {
+				it->second.ModifiedTime = modifiedTime;
+			}
+		}
+		if (same && Recorder.Read(it->second.Data, it->second.Length)) {
+			HitCount++;
+			Recorder.Replay(ClassObserver, ClassMemberObserver, FunctionObserver);
+			Recorder.Clear();
+			return true;
+		}
+	}
+
+	// the file is hashed before it is parsed; if it changes while being parsed
+	// it will be parsed again next time
+	MissCount++;
+	if (exists && !hashed) {
+		hashed = HashFile(file, hash);
+	}
+	Recorder.Clear();
+	Parser.SetClassObserver(&Recorder);
+	Parser.SetClassMemberObserver(&Recorder);
+	Parser.SetFunctionObserver(&Recorder);
+	bool parsed = Parser.ScanFile(file, results);
+	Recorder.Replay(ClassObserver, ClassMemberObserver, FunctionObserver);
+	if (parsed && hashed) {
+		EntryClass& entry = Entries[file];
+		entry.Size = size;
+		entry.ModifiedTime = modifiedTime;
+		entry.Hash = hash;
+		entry.Owned.clear();
+		Recorder.Write(entry.Owned);
+		entry.Data = entry.Owned.data();
+		entry.Length = entry.Owned.length();
+	}
+	else if (it != Entries.end()) {
+		Entries.erase(it);
+	}
+	Recorder.Clear();
+	return parsed;
+}
+
+int pelet::SymbolCacheClass::GetHitCount() const {
+	return HitCount;
+}
+
+int pelet::SymbolCacheClass::GetMissCount() const {
+	return MissCount;
+}
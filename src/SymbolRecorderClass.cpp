@@ -0,0 +1,396 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/SymbolRecorderClass.h>
+#include <unicode/stringpiece.h>
+
+/**
+ * @return the number of string arguments that the given event type has, not
+ *         counting the insteadof list of TRAIT_INSTEAD_OF_FOUND
+ */
+static size_t StringCount(pelet::SymbolEventClass::Types type) {
+	switch (type) {
+	case pelet::SymbolEventClass::CLASS_FOUND:
+	case pelet::SymbolEventClass::METHOD_FOUND:
+		return 6;
+	case pelet::SymbolEventClass::PROPERTY_FOUND:
+	case pelet::SymbolEventClass::TRAIT_ALIAS_FOUND:
+	case pelet::SymbolEventClass::FUNCTION_FOUND:
+		return 5;
+	case pelet::SymbolEventClass::DEFINE_DECLARATION_FOUND:
+	case pelet::SymbolEventClass::TRAIT_INSTEAD_OF_FOUND:
+		return 4;
+	case pelet::SymbolEventClass::METHOD_SCOPE:
+	case pelet::SymbolEventClass::TRAIT_USE_FOUND:
+		return 3;
+	case pelet::SymbolEventClass::CLASS_END:
+	case pelet::SymbolEventClass::NAMESPACE_USE_FOUND:
+	case pelet::SymbolEventClass::FUNCTION_SCOPE:
+		return 2;
+	case pelet::SymbolEventClass::INCLUDE_FOUND:
+	case pelet::SymbolEventClass::NAMESPACE_DECLARATION_FOUND:
+		return 1;
+	}
+	return 0;
+}
+
+static void WriteInt(std::string& bytes, int value) {
+	unsigned int u = (unsigned int)value;
+	bytes += (char)(u & 0xFF);
+	bytes += (char)((u >> 8) & 0xFF);
+	bytes += (char)((u >> 16) & 0xFF);
+	bytes += (char)((u >> 24) & 0xFF);
+}
+
+/**
+ * reads a little endian 32 bit number and advances the pointer
+ *
+ * @return bool FALSE if there are not enough bytes left
+ */
+static bool ReadInt(const unsigned char*& bytes, const unsigned char* end, int& value) {
+	if (end - bytes < 4) {
+		return false;
+	}
+	value = (int)((unsigned int)bytes[0] | ((unsigned int)bytes[1] << 8) 
+		| ((unsigned int)bytes[2] << 16) | ((unsigned int)bytes[3] << 24));
+	bytes += 4;
+	return true;
+}
+
+pelet::SymbolEventClass::SymbolEventClass(pelet::SymbolEventClass::Types type, size_t firstString)
+	: Type(type)
+	, FirstString(firstString)
+	, Visibility(pelet::TokenClass::PUBLIC) {
+	Ints[0] = 0;
+	Ints[1] = 0;
+	Flags[0] = false;
+	Flags[1] = false;
+}
+
+pelet::SymbolRecorderClass::SymbolRecorderClass()
+	: Events()
+	, Strings() {
+}
+
+void pelet::SymbolRecorderClass::Clear() {
+	Events.clear();
+	Strings.clear();
+}
+
+void pelet::SymbolRecorderClass::Replay(pelet::ClassObserverClass* classObserver, pelet::ClassMemberObserverClass* memberObserver, 
+		pelet::FunctionObserverClass* functionObserver) const {
+	std::vector<pelet::SymbolEventClass>::const_iterator ev;
+	for (ev = Events.begin(); ev != Events.end(); ++ev) {
+		const UnicodeString* s = &Strings[ev->FirstString];
+		switch (ev->Type) {
+		case pelet::SymbolEventClass::CLASS_FOUND:
+			if (classObserver) {
+				classObserver->ClassFound(s[0], s[1], s[2], s[3], s[4], s[5], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::CLASS_END:
+			if (classObserver) {
+				classObserver->ClassEnd(s[0], s[1], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::DEFINE_DECLARATION_FOUND:
+			if (classObserver) {
+				classObserver->DefineDeclarationFound(s[0], s[1], s[2], s[3], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::INCLUDE_FOUND:
+			if (classObserver) {
+				classObserver->IncludeFound(s[0], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::NAMESPACE_DECLARATION_FOUND:
+			if (classObserver) {
+				classObserver->NamespaceDeclarationFound(s[0], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::NAMESPACE_USE_FOUND:
+			if (classObserver) {
+				classObserver->NamespaceUseFound(s[0], s[1], ev->Ints[0], ev->Ints[1]);
+			}
+			break;
+		case pelet::SymbolEventClass::METHOD_FOUND:
+			if (memberObserver) {
+				memberObserver->MethodFound(s[0], s[1], s[2], s[3], s[4], s[5], ev->Visibility, ev->Flags[0], ev->Ints[0], ev->Flags[1]);
+			}
+			break;
+		case pelet::SymbolEventClass::PROPERTY_FOUND:
+			if (memberObserver) {
+				memberObserver->PropertyFound(s[0], s[1], s[2], s[3], s[4], ev->Visibility, ev->Flags[0], ev->Flags[1], ev->Ints[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::METHOD_SCOPE:
+			if (memberObserver) {
+				memberObserver->MethodScope(s[0], s[1], s[2], ev->Ints[0], ev->Ints[1]);
+			}
+			break;
+		case pelet::SymbolEventClass::TRAIT_USE_FOUND:
+			if (memberObserver) {
+				memberObserver->TraitUseFound(s[0], s[1], s[2]);
+			}
+			break;
+		case pelet::SymbolEventClass::TRAIT_ALIAS_FOUND:
+			if (memberObserver) {
+				memberObserver->TraitAliasFound(s[0], s[1], s[2], s[3], s[4], ev->Visibility);
+			}
+			break;
+		case pelet::SymbolEventClass::TRAIT_INSTEAD_OF_FOUND:
+			if (memberObserver) {
+				memberObserver->TraitInsteadOfFound(s[0], s[1], s[2], s[3], std::vector<UnicodeString>(s + 4, s + 4 + ev->Ints[0]));
+			}
+			break;
+		case pelet::SymbolEventClass::FUNCTION_FOUND:
+			if (functionObserver) {
+				functionObserver->FunctionFound(s[0], s[1], s[2], s[3], s[4], ev->Ints[0], ev->Flags[0]);
+			}
+			break;
+		case pelet::SymbolEventClass::FUNCTION_SCOPE:
+			if (functionObserver) {
+				functionObserver->FunctionScope(s[0], s[1], ev->Ints[0], ev->Ints[1]);
+			}
+			break;
+		}
+	}
+}
+
+void pelet::SymbolRecorderClass::Write(std::string& bytes) const {
+
+	// each event is followed by its strings
+	// type, flags, visibility, ints[2], string count, (string byte length, UTF-8 bytes)*
+	WriteInt(bytes, (int)Events.size());
+	for (size_t i = 0; i < Events.size(); ++i) {
+		const pelet::SymbolEventClass& ev = Events[i];
+		size_t end = i + 1 < Events.size() ? Events[i + 1].FirstString : Strings.size();
+		bytes += (char)ev.Type;
+		bytes += (char)((ev.Flags[0] ? 1 : 0) | (ev.Flags[1] ? 2 : 0));
+		WriteInt(bytes, ev.Visibility);
+		WriteInt(bytes, ev.Ints[0]);
+		WriteInt(bytes, ev.Ints[1]);
+		WriteInt(bytes, (int)(end - ev.FirstString));
+		for (size_t j = ev.FirstString; j < end; ++j) {
+			std::string utf8;
+			Strings[j].toUTF8String(utf8);
+			WriteInt(bytes, (int)utf8.length());
+			bytes += utf8;
+		}
+	}
+}
+
+bool pelet::SymbolRecorderClass::Read(const char* bytes, size_t length) {
+	Clear();
+	const unsigned char* current = (const unsigned char*)bytes;
+	const unsigned char* end = current + length;
+	int eventCount = 0;
+	bool ok = ReadInt(current, end, eventCount) && eventCount >= 0;
+	for (int i = 0; ok && i < eventCount; ++i) {
+		if (end - current < 2 || current[0] > pelet::SymbolEventClass::FUNCTION_SCOPE) {
+			ok = false;
+			break;
+		}
+		pelet::SymbolEventClass ev((pelet::SymbolEventClass::Types)current[0], Strings.size());
+		ev.Flags[0] = (current[1] & 1) != 0;
+		ev.Flags[1] = (current[1] & 2) != 0;
+		current += 2;
+		int visibility = 0;
+		int stringCount = 0;
+		ok = ReadInt(current, end, visibility) && ReadInt(current, end, ev.Ints[0]) 
+			&& ReadInt(current, end, ev.Ints[1]) && ReadInt(current, end, stringCount);
+		ev.Visibility = (pelet::TokenClass::TokenIds)visibility;
+
+		// the replay depends on the number of strings being right
+		size_t expected = StringCount(ev.Type);
+		if (pelet::SymbolEventClass::TRAIT_INSTEAD_OF_FOUND == ev.Type) {
+			expected += ev.Ints[0] >= 0 ? ev.Ints[0] : 0;
+			ok = ok && ev.Ints[0] >= 0;
+		}
+		ok = ok && stringCount >= 0 && (size_t)stringCount == expected;
+		for (int j = 0; ok && j < stringCount; ++j) {
+			int stringLength = 0;
+			ok = ReadInt(current, end, stringLength) && stringLength >= 0 && end - current >= stringLength;
+			if (ok) {
+				Strings.push_back(UnicodeString::fromUTF8(StringPiece((const char*)current, stringLength)));
+				current += stringLength;
+			}
+		}
+		if (ok) {
+			Events.push_back(ev);
+		}
+	}
+	ok = ok && current == end;
+	if (!ok) {
+		Clear();
+	}
+	return ok;
+}
+
+void pelet::SymbolRecorderClass::ClassFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& signature, const UnicodeString& baseClassName, 
+		const UnicodeString& implementInterfaceNames, const UnicodeString& comment, const int lineNumber) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::CLASS_FOUND);
+	ev.Ints[0] = lineNumber;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(signature);
+	Strings.push_back(baseClassName);
+	Strings.push_back(implementInterfaceNames);
+	Strings.push_back(comment);
+}
+
+void pelet::SymbolRecorderClass::ClassEnd(const UnicodeString& namespaceName, const UnicodeString& className, int pos) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::CLASS_END);
+	ev.Ints[0] = pos;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+}
+
+void pelet::SymbolRecorderClass::DefineDeclarationFound(const UnicodeString& namespaceName, const UnicodeString& variableName, 
+		const UnicodeString& variableValue, const UnicodeString& comment, const int lineNumber) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::DEFINE_DECLARATION_FOUND);
+	ev.Ints[0] = lineNumber;
+	Strings.push_back(namespaceName);
+	Strings.push_back(variableName);
+	Strings.push_back(variableValue);
+	Strings.push_back(comment);
+}
+
+void pelet::SymbolRecorderClass::IncludeFound(const UnicodeString& filename, const int lineNumber) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::INCLUDE_FOUND);
+	ev.Ints[0] = lineNumber;
+	Strings.push_back(filename);
+}
+
+void pelet::SymbolRecorderClass::NamespaceDeclarationFound(const UnicodeString& namespaceName, int startingPos) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::NAMESPACE_DECLARATION_FOUND);
+	ev.Ints[0] = startingPos;
+	Strings.push_back(namespaceName);
+}
+
+void pelet::SymbolRecorderClass::NamespaceUseFound(const UnicodeString& namespaceName, const UnicodeString& alias, int lineNumber, int startingPos) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::NAMESPACE_USE_FOUND);
+	ev.Ints[0] = lineNumber;
+	ev.Ints[1] = startingPos;
+	Strings.push_back(namespaceName);
+	Strings.push_back(alias);
+}
+
+void pelet::SymbolRecorderClass::MethodFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& methodName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, 
+		pelet::TokenClass::TokenIds visibility, bool isStatic, const int lineNumber, bool hasVariableArguments) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::METHOD_FOUND);
+	ev.Visibility = visibility;
+	ev.Flags[0] = isStatic;
+	ev.Flags[1] = hasVariableArguments;
+	ev.Ints[0] = lineNumber;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(methodName);
+	Strings.push_back(signature);
+	Strings.push_back(returnType);
+	Strings.push_back(comment);
+}
+
+void pelet::SymbolRecorderClass::PropertyFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& propertyName, 
+		const UnicodeString& propertyType, const UnicodeString& comment, 
+		pelet::TokenClass::TokenIds visibility, bool isConst, bool isStatic, const int lineNumber) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::PROPERTY_FOUND);
+	ev.Visibility = visibility;
+	ev.Flags[0] = isConst;
+	ev.Flags[1] = isStatic;
+	ev.Ints[0] = lineNumber;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(propertyName);
+	Strings.push_back(propertyType);
+	Strings.push_back(comment);
+}
+
+void pelet::SymbolRecorderClass::MethodScope(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& methodName, int startingPos, int endingPos) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::METHOD_SCOPE);
+	ev.Ints[0] = startingPos;
+	ev.Ints[1] = endingPos;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(methodName);
+}
+
+void pelet::SymbolRecorderClass::TraitUseFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+		const UnicodeString& fullyQualifiedTraitName) {
+	Add(pelet::SymbolEventClass::TRAIT_USE_FOUND);
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(fullyQualifiedTraitName);
+}
+
+void pelet::SymbolRecorderClass::TraitAliasFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, const UnicodeString& alias, pelet::TokenClass::TokenIds visibility) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::TRAIT_ALIAS_FOUND);
+	ev.Visibility = visibility;
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(traitUsedClassName);
+	Strings.push_back(traitMethodName);
+	Strings.push_back(alias);
+}
+
+void pelet::SymbolRecorderClass::TraitInsteadOfFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+		const UnicodeString& traitMethodName, const std::vector<UnicodeString>& insteadOfList) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::TRAIT_INSTEAD_OF_FOUND);
+	ev.Ints[0] = (int)insteadOfList.size();
+	Strings.push_back(namespaceName);
+	Strings.push_back(className);
+	Strings.push_back(traitUsedClassName);
+	Strings.push_back(traitMethodName);
+	Strings.insert(Strings.end(), insteadOfList.begin(), insteadOfList.end());
+}
+
+void pelet::SymbolRecorderClass::FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName, 
+		const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+		bool hasVariableArguments) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::FUNCTION_FOUND);
+	ev.Ints[0] = lineNumber;
+	ev.Flags[0] = hasVariableArguments;
+	Strings.push_back(namespaceName);
+	Strings.push_back(functionName);
+	Strings.push_back(signature);
+	Strings.push_back(returnType);
+	Strings.push_back(comment);
+}
+
+void pelet::SymbolRecorderClass::FunctionScope(const UnicodeString& namespaceName, const UnicodeString& functionName, int startingPos, int endingPos) {
+	pelet::SymbolEventClass& ev = Add(pelet::SymbolEventClass::FUNCTION_SCOPE);
+	ev.Ints[0] = startingPos;
+	ev.Ints[1] = endingPos;
+	Strings.push_back(namespaceName);
+	Strings.push_back(functionName);
+}
+
+pelet::SymbolEventClass& pelet::SymbolRecorderClass::Add(pelet::SymbolEventClass::Types type) {
+	Events.push_back(pelet::SymbolEventClass(type, Strings.size()));
+	return Events.back();
+}
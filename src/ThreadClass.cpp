@@ -0,0 +1,255 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/ThreadClass.h>
+#include <stddef.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#endif
+
+/**
+ * @return a time in milliseconds that only goes forward; only useful to
+ *         compare with another call
+ */
+static double MonotonicMilliseconds() {
+#if defined(__WIN32__) || defined(_WIN32)
+	return (double)GetTickCount64();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#endif
+}
+
+namespace pelet {
+
+/**
+ * Runs the thread; the native thread API needs a plain function.
+ */
+class ThreadEntryClass {
+
+public:
+
+#if defined(__WIN32__) || defined(_WIN32)
+	static unsigned __stdcall Entry(void* thread) {
+		((pelet::ThreadClass*)thread)->Run();
+		return 0;
+	}
+#else
+	static void* Entry(void* thread) {
+		((pelet::ThreadClass*)thread)->Run();
+		return NULL;
+	}
+#endif
+};
+
+}
+
+#if defined(__WIN32__) || defined(_WIN32)
+
+pelet::MutexClass::MutexClass()
+	: Handle(new CRITICAL_SECTION) {
+	InitializeCriticalSection((CRITICAL_SECTION*)Handle);
+}
+
+pelet::MutexClass::~MutexClass() {
+	DeleteCriticalSection((CRITICAL_SECTION*)Handle);
+	delete (CRITICAL_SECTION*)Handle;
+}
+
+void pelet::MutexClass::Lock() {
+	EnterCriticalSection((CRITICAL_SECTION*)Handle);
+}
+
+void pelet::MutexClass::Unlock() {
+	LeaveCriticalSection((CRITICAL_SECTION*)Handle);
+}
+
+pelet::ConditionClass::ConditionClass()
+	: Handle(new CONDITION_VARIABLE) {
+	InitializeConditionVariable((CONDITION_VARIABLE*)Handle);
+}
+
+pelet::ConditionClass::~ConditionClass() {
+	delete (CONDITION_VARIABLE*)Handle;
+}
+
+void pelet::ConditionClass::Wait(pelet::MutexClass& mutex) {
+	SleepConditionVariableCS((CONDITION_VARIABLE*)Handle, (CRITICAL_SECTION*)mutex.Handle, INFINITE);
+}
+
+void pelet::ConditionClass::Signal() {
+	WakeConditionVariable((CONDITION_VARIABLE*)Handle);
+}
+
+void pelet::ConditionClass::Broadcast() {
+	WakeAllConditionVariable((CONDITION_VARIABLE*)Handle);
+}
+
+bool pelet::ThreadClass::Start() {
+	Handle = (void*)_beginthreadex(NULL, 0, pelet::ThreadEntryClass::Entry, this, 0, NULL);
+	return Handle != NULL;
+}
+
+void pelet::ThreadClass::Join() {
+	if (Handle) {
+		WaitForSingleObject((HANDLE)Handle, INFINITE);
+		CloseHandle((HANDLE)Handle);
+		Handle = NULL;
+	}
+}
+
+int pelet::ThreadClass::ProcessorCount() {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+void pelet::ThreadClass::GiveUpTimeSlice() {
+	SwitchToThread();
+}
+
+#else
+
+pelet::MutexClass::MutexClass()
+	: Handle(new pthread_mutex_t) {
+	pthread_mutex_init((pthread_mutex_t*)Handle, NULL);
+}
+
+pelet::MutexClass::~MutexClass() {
+	pthread_mutex_destroy((pthread_mutex_t*)Handle);
+	delete (pthread_mutex_t*)Handle;
+}
+
+void pelet::MutexClass::Lock() {
+	pthread_mutex_lock((pthread_mutex_t*)Handle);
+}
+
+void pelet::MutexClass::Unlock() {
+	pthread_mutex_unlock((pthread_mutex_t*)Handle);
+}
+
+pelet::ConditionClass::ConditionClass()
+	: Handle(new pthread_cond_t) {
+	pthread_cond_init((pthread_cond_t*)Handle, NULL);
+}
+
+pelet::ConditionClass::~ConditionClass() {
+	pthread_cond_destroy((pthread_cond_t*)Handle);
+	delete (pthread_cond_t*)Handle;
+}
+
+void pelet::ConditionClass::Wait(pelet::MutexClass& mutex) {
+	pthread_cond_wait((pthread_cond_t*)Handle, (pthread_mutex_t*)mutex.Handle);
+}
+
+void pelet::ConditionClass::Signal() {
+	pthread_cond_signal((pthread_cond_t*)Handle);
+}
+
+void pelet::ConditionClass::Broadcast() {
+	pthread_cond_broadcast((pthread_cond_t*)Handle);
+}
+
+bool pelet::ThreadClass::Start() {
+	pthread_t* thread = new pthread_t;
+	if (pthread_create(thread, NULL, pelet::ThreadEntryClass::Entry, this) != 0) {
+		delete thread;
+		return false;
+	}
+	Handle = thread;
+	return true;
+}
+
+void pelet::ThreadClass::Join() {
+	if (Handle) {
+		pthread_join(*(pthread_t*)Handle, NULL);
+		delete (pthread_t*)Handle;
+		Handle = NULL;
+	}
+}
+
+int pelet::ThreadClass::ProcessorCount() {
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int)count : 1;
+}
+
+void pelet::ThreadClass::GiveUpTimeSlice() {
+	sched_yield();
+}
+
+#endif
+
+pelet::MutexLockerClass::MutexLockerClass(pelet::MutexClass& mutex)
+	: Mutex(mutex) {
+	Mutex.Lock();
+}
+
+pelet::MutexLockerClass::~MutexLockerClass() {
+	Mutex.Unlock();
+}
+
+pelet::CancelTokenClass::CancelTokenClass()
+	: Mutex()
+	, Deadline(0)
+	, Cancelled(false) {
+}
+
+void pelet::CancelTokenClass::Cancel() {
+	pelet::MutexLockerClass locker(Mutex);
+	Cancelled = true;
+}
+
+void pelet::CancelTokenClass::SetDeadline(int milliseconds) {
+	pelet::MutexLockerClass locker(Mutex);
+	Deadline = milliseconds > 0 ? MonotonicMilliseconds() + milliseconds : 0;
+}
+
+void pelet::CancelTokenClass::Reset() {
+	pelet::MutexLockerClass locker(Mutex);
+	Cancelled = false;
+	Deadline = 0;
+}
+
+bool pelet::CancelTokenClass::IsCancelled() {
+	pelet::MutexLockerClass locker(Mutex);
+	if (!Cancelled && Deadline > 0 && MonotonicMilliseconds() >= Deadline) {
+		Cancelled = true;
+	}
+	return Cancelled;
+}
+
+pelet::ThreadClass::ThreadClass()
+	: Handle(NULL) {
+}
+
+pelet::ThreadClass::~ThreadClass() {
+	Join();
+}
@@ -28,10 +28,33 @@ bool pelet::IsTerminatingToken(int token) {
 	return T_ERROR_UNTERMINATED_COMMENT == token ||
 		T_ERROR_UNTERMINATED_STRING == token ||
 		T_ERROR_UNTERMINATED_BACKTICK == token ||
+		T_ERROR_CANCELLED == token ||
 		T_END == token;
 }
 
-int pelet::SkipToIdentifier(BufferClass *buffer, UnicodeString identifier) {
+static UnicodeString ToUnicodeString(const UChar* start, int length) {
+	return UnicodeString(start, length);
+}
+
+/**
+ * each byte becomes one character; SkipToIdentifierImpl() compares the identifier
+ * against the bytes one at a time so a multi-byte identifier will still match
+ */
+static UnicodeString ToUnicodeString(const unsigned char* start, int length) {
+	UnicodeString str;
+	for (int i = 0; i < length; i++) {
+		str.append((UChar)start[i]);
+	}
+	return str;
+}
+
+/**
+ * The lexers are compiled for both UTF-16 (BufferClass) and UTF-8 (Utf8BufferClass) input; 
+ * the heredoc / nowdoc handling works the same on both since it only looks for 
+ * ASCII characters.
+ */
+template<typename BufferType>
+static int SkipToIdentifierImpl(BufferType *buffer, UnicodeString identifier) {
 	bool end = false;
 	
 	// add semicolon to make checks easier
@@ -59,7 +82,7 @@ int pelet::SkipToIdentifier(BufferClass *buffer, UnicodeString identifier) {
 		}
 		if (c == 0) {
 			end = true;
-			return T_ERROR_UNTERMINATED_STRING;
+			return pelet::T_ERROR_UNTERMINATED_STRING;
 		}
 		
 		// since we are eating up a  newline, otherwise line numbering in lint errors
@@ -89,7 +112,8 @@ int pelet::SkipToIdentifier(BufferClass *buffer, UnicodeString identifier) {
 	return 0;
 }
 
-int pelet::HandleHeredoc(BufferClass *buffer) {
+template<typename BufferType>
+static int HandleHeredocImpl(BufferType *buffer) {
 
 	/*
 	 * find out the stopping identifier. Since current is past the newline, the
@@ -101,7 +125,7 @@ int pelet::HandleHeredoc(BufferClass *buffer) {
 	 * does not have embedded variables; since we don't care about embedded variables 
 	 * we will always treat heredoc as singles quote strings
 	 */
-	UnicodeString identifier(buffer->TokenStart + 3, buffer->Current - buffer->TokenStart - 3 - 1);
+	UnicodeString identifier = ToUnicodeString(buffer->TokenStart + 3, buffer->Current - buffer->TokenStart - 3 - 1);
 	identifier.trim();
 	
 	// remove double quotes if they are there
@@ -114,14 +138,15 @@ int pelet::HandleHeredoc(BufferClass *buffer) {
 	if ((buffer->Limit - buffer->Current) < 2) {
 		buffer->AppendToLexeme(1);
 	}
-	int failed = pelet::SkipToIdentifier(buffer, identifier);
+	int failed = SkipToIdentifierImpl(buffer, identifier);
 	if (!failed) {
-		return T_CONSTANT_ENCAPSED_STRING;
+		return pelet::T_CONSTANT_ENCAPSED_STRING;
 	}
 	return failed;
 }
 
-int pelet::HandleNowdoc(BufferClass *buffer) {
+template<typename BufferType>
+static int HandleNowdocImpl(BufferType *buffer) {
 	
 	/*
 	 * find out the stopping identifier. Since current is past the newline, the
@@ -133,7 +158,7 @@ int pelet::HandleNowdoc(BufferClass *buffer) {
 	 * does not have embedded variables; since we don't care about embedded variables 
 	 * we will always treat nowdoc as singles quote strings
 	 */
-	UnicodeString identifier(buffer->TokenStart + 3, buffer->Current - buffer->TokenStart - 3 - 1);
+	UnicodeString identifier = ToUnicodeString(buffer->TokenStart + 3, buffer->Current - buffer->TokenStart - 3 - 1);
 	identifier.trim();
 	
 	// remove the single quotes
@@ -142,10 +167,29 @@ int pelet::HandleNowdoc(BufferClass *buffer) {
 	if ((buffer->Limit - buffer->Current) < 2) {
 		buffer->AppendToLexeme(1);
 	}
-	int failed = pelet::SkipToIdentifier(buffer, identifier);
+	int failed = SkipToIdentifierImpl(buffer, identifier);
 	if (!failed) {
-		return T_CONSTANT_ENCAPSED_STRING;
+		return pelet::T_CONSTANT_ENCAPSED_STRING;
 	}
 	return failed;
 }
- 
\ No newline at end of file
+ 
+int pelet::SkipToIdentifier(BufferClass *buffer, UnicodeString identifier) {
+	return SkipToIdentifierImpl(buffer, identifier);
+}
+
+int pelet::HandleHeredoc(BufferClass *buffer) {
+	return HandleHeredocImpl(buffer);
+}
+
+int pelet::HandleHeredoc(Utf8BufferClass *buffer) {
+	return HandleHeredocImpl(buffer);
+}
+
+int pelet::HandleNowdoc(BufferClass *buffer) {
+	return HandleNowdocImpl(buffer);
+}
+
+int pelet::HandleNowdoc(Utf8BufferClass *buffer) {
+	return HandleNowdocImpl(buffer);
+}
@@ -0,0 +1,206 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/TokenPipelineClass.h>
+#include <pelet/TokenClass.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#endif
+
+/**
+ * the number of tokens that the ring holds. The lexer thread can be at most
+ * this many tokens ahead of the parser.
+ */
+#define PELET_PIPELINE_CAPACITY 1024
+
+/**
+ * the number of times that a waiting thread looks at the other thread's counter 
+ * before it gives up its time slice
+ */
+#define PELET_PIPELINE_SPINS 64
+
+/**
+ * reads a counter that is written by the other thread; anything that the other
+ * thread wrote before it wrote the counter is seen by this thread after
+ * this call
+ */
+static long LoadAcquire(volatile long* counter) {
+#if defined(__WIN32__) || defined(_WIN32)
+	return InterlockedCompareExchange(counter, 0, 0);
+#else
+	return __sync_fetch_and_add(counter, 0);
+#endif
+}
+
+/**
+ * adds one to a counter that is read by the other thread; anything that this
+ * thread wrote before this call is seen by the other thread once it sees the
+ * new value
+ */
+static void Increment(volatile long* counter) {
+#if defined(__WIN32__) || defined(_WIN32)
+	InterlockedIncrement(counter);
+#else
+	__sync_add_and_fetch(counter, 1);
+#endif
+}
+
+pelet::TokenRecordClass::TokenRecordClass()
+	: Lexeme()
+	, Token(T_END)
+	, Pos(0)
+	, Length(0)
+	, LineNumber(1)
+	, Condition(yycINLINE_HTML)
+	, HasLexeme(false) {
+}
+
+pelet::TokenPipelineClass::TokenPipelineClass()
+	: ThreadClass()
+	, Records(PELET_PIPELINE_CAPACITY)
+	, Initial()
+	, Lexer()
+	, Written(0)
+	, Read(0)
+	, Stopping(0)
+	, SeenWritten(0)
+	, SeenRead(0)
+	, Released(0)
+	, CurrentRecord(&Initial)
+	, IsRunning(false) {
+}
+
+pelet::TokenPipelineClass::~TokenPipelineClass() {
+	Close();
+}
+
+bool pelet::TokenPipelineClass::OpenFile(const std::string& file, pelet::Versions version, pelet::FileBufferTypes type) {
+	Close();
+	Lexer.SetVersion(version);
+	Lexer.SetFileBufferType(type);
+	if (!Lexer.OpenFile(file)) {
+		Lexer.Close();
+		return false;
+	}
+	Initial.Condition = yycINLINE_HTML;
+	return StartLexing();
+}
+
+bool pelet::TokenPipelineClass::OpenString(const UnicodeString& code, pelet::Versions version) {
+	Close();
+	Lexer.SetVersion(version);
+	if (!Lexer.OpenString(code)) {
+		Lexer.Close();
+		return false;
+	}
+	Initial.Condition = yycSCRIPT;
+	return StartLexing();
+}
+
+bool pelet::TokenPipelineClass::StartLexing() {
+	Written = 0;
+	Read = 0;
+	Stopping = 0;
+	SeenWritten = 0;
+	SeenRead = 0;
+	Released = 0;
+	CurrentRecord = &Initial;
+	IsRunning = Start();
+	if (!IsRunning) {
+		Lexer.Close();
+	}
+	return IsRunning;
+}
+
+void pelet::TokenPipelineClass::Close() {
+	if (IsRunning) {
+		Increment(&Stopping);
+		Join();
+		IsRunning = false;
+	}
+	Lexer.Close();
+	CurrentRecord = &Initial;
+}
+
+void pelet::TokenPipelineClass::Run() {
+	Produce();
+}
+
+void pelet::TokenPipelineClass::Produce() {
+	long written = 0;
+	bool isDone = false;
+	while (!isDone) {
+		int spins = 0;
+		while ((written - SeenRead) >= PELET_PIPELINE_CAPACITY) {
+			if (LoadAcquire(&Stopping)) {
+				return;
+			}
+			SeenRead = LoadAcquire(&Read);
+			if (++spins > PELET_PIPELINE_SPINS) {
+				pelet::ThreadClass::GiveUpTimeSlice();
+				spins = 0;
+			}
+		}
+		pelet::TokenRecordClass& record = Records[written % PELET_PIPELINE_CAPACITY];
+		record.Token = Lexer.NextToken();
+		record.HasLexeme = Lexer.GetLexeme(record.Lexeme);
+		record.Pos = Lexer.GetCharacterPosition();
+		record.Length = Lexer.GetTokenLength();
+		record.LineNumber = Lexer.GetLineNumber();
+		record.Condition = Lexer.GetCondition();
+		isDone = pelet::IsTerminatingToken(record.Token);
+		written++;
+		Increment(&Written);
+	}
+}
+
+const pelet::TokenRecordClass& pelet::TokenPipelineClass::Next() {
+	if (!IsRunning) {
+		return *CurrentRecord;
+	}
+	if (CurrentRecord != &Initial) {
+		if (pelet::IsTerminatingToken(CurrentRecord->Token)) {
+			return *CurrentRecord;
+		}
+		Released++;
+		Increment(&Read);
+	}
+	int spins = 0;
+	while (Released >= SeenWritten) {
+		SeenWritten = LoadAcquire(&Written);
+		if (Released < SeenWritten) {
+			break;
+		}
+		if (++spins > PELET_PIPELINE_SPINS) {
+			pelet::ThreadClass::GiveUpTimeSlice();
+			spins = 0;
+		}
+	}
+	CurrentRecord = &Records[Released % PELET_PIPELINE_CAPACITY];
+	return *CurrentRecord;
+}
+
+const pelet::TokenRecordClass& pelet::TokenPipelineClass::Current() const {
+	return *CurrentRecord;
+}
@@ -26,6 +26,17 @@
 #include <pelet/UCharBufferedFileClass.h>
 #include <unicode/ustring.h>
 
+/**
+ * the initial size of the chunk buffer
+ */
+#define PELET_CHUNK_CAPACITY 4096
+
+/**
+ * the number of NULL characters kept after the code in the chunk buffer; this needs
+ * to be larger than the longest look ahead of the lexers
+ */
+#define PELET_CHUNK_PADDING 32
+
 /**
  * IMPLEMENTATION NOTE: This class internally uses ICU strings instead of wxStrings because of a couple of issues:
  * 
@@ -260,16 +271,18 @@ bool pelet::UCharBufferedFileClass::OpenFile(UFILE* ufile, int startingCapacity)
 		File = NULL;	
 	}
 	if (!Buffer) {
-		LineNumber = 1;
 		Buffer = new UChar[startingCapacity];
 		BufferCapacity = startingCapacity;
-		Current = Buffer;
-		TokenStart = Buffer;
-		Limit = Buffer;
-		Marker = Buffer;
-		HasReachedEof = false;
-		Eof = NULL;
 	}
+	
+	// a kept buffer still points to the previous file's contents
+	LineNumber = 1;
+	Current = Buffer;
+	TokenStart = Buffer;
+	Limit = Buffer;
+	Marker = Buffer;
+	HasReachedEof = false;
+	Eof = NULL;
 	bool opened = false;
 	File = ufile;
 	if (NULL != File) {
@@ -303,23 +316,29 @@ pelet::UCharBufferedFileClass::UCharBufferedFileClass()
 	, BufferCapacity(0) 
 	, CharacterPos(0)
 	, HasReachedEof(false)
+	, IsKeepingCapacity(false)
 	{
 }
 
 pelet::UCharBufferedFileClass::~UCharBufferedFileClass() {
+	IsKeepingCapacity = false;
 	Close();
 }
 
+void pelet::UCharBufferedFileClass::SetKeepCapacity(bool keep) {
+	IsKeepingCapacity = keep;
+}
+
 void pelet::UCharBufferedFileClass::Close() {
-	CleanupBuffer();
+	if (!IsKeepingCapacity) {
+		CleanupBuffer();
+	}
 	if (NULL != File) {
 		u_fclose(File);
 		File = NULL;
 	}
-	Buffer = NULL;
 	Eof = NULL;
 	File = NULL;
-	BufferCapacity = 0;
 	CharacterPos = 0;
 	HasReachedEof = false;
 	
@@ -335,38 +354,52 @@ int pelet::UCharBufferedFileClass::GetCharacterPosition() const {
 
 pelet::UCharBufferClass::UCharBufferClass() 
 	: BufferClass()
-	, Buffer(NULL) {
+	, Buffer(NULL)
+	, Capacity(0)
+	, IsKeepingCapacity(false) {
 		
 }
 
 pelet::UCharBufferClass::~UCharBufferClass() {
+	IsKeepingCapacity = false;
 	Close();
 }
 
-bool pelet::UCharBufferClass::OpenString(const UnicodeString& code) {
+void pelet::UCharBufferClass::SetKeepCapacity(bool keep) {
+	IsKeepingCapacity = keep;
+}
+
+bool pelet::UCharBufferClass::OpenString(const UnicodeString& code, int startPos, int lineNumber) {
 	Close();
 	int length = code.length();
+	if (startPos < 0 || startPos > length) {
+		return false;
+	}
 	if (length > 0) {
-		LineNumber = 1;
-		UChar* buf = new UChar[length + 1];
-		u_memmove(buf, code.getBuffer(), length);
-		buf[length] = '\0';
-		Buffer = buf;
+		LineNumber = lineNumber;
+		if (!Buffer || Capacity < length + 1) {
+			delete[] Buffer;
+			Buffer = new UChar[length + 1];
+			Capacity = length + 1;
+		}
+		u_memmove(Buffer, code.getBuffer(), length);
+		Buffer[length] = '\0';
 		//Buffer = code.getTerminatedBuffer();
-		Current = Buffer;
-		TokenStart = Buffer;
-		Marker = Buffer;
+		Current = Buffer + startPos;
+		TokenStart = Buffer + startPos;
+		Marker = Buffer + startPos;
 		Limit = Buffer + length + 1;
 	}
 	return length > 0;
 }
 
 void pelet::UCharBufferClass::Close() {
-	if (Buffer) {
+	if (Buffer && !IsKeepingCapacity) {
 		
 		// the original string still owns the data, according to getTerminatedBuffer()
 		delete[] Buffer;
 		Buffer = NULL;
+		Capacity = 0;
 	}
 	Current = NULL;
 	TokenStart = NULL;
@@ -388,3 +421,171 @@ bool pelet::UCharBufferClass::HasReachedEnd() const {
 int pelet::UCharBufferClass::GetCharacterPosition() const {
 	return TokenStart - Buffer;
 }
+
+pelet::UCharViewBufferClass::UCharViewBufferClass()
+	: BufferClass()
+	, Start(NULL) {
+}
+
+void pelet::UCharViewBufferClass::Open(const UChar* code, int length, int startPos, int lineNumber) {
+	Start = code;
+	Current = code + startPos;
+	TokenStart = Current;
+	Marker = Current;
+	Limit = code + length + 1;
+	LineNumber = lineNumber;
+}
+
+void pelet::UCharViewBufferClass::Close() {
+	Start = NULL;
+	Current = NULL;
+	TokenStart = NULL;
+	Marker = NULL;
+	Limit = NULL;
+}
+
+void pelet::UCharViewBufferClass::AppendToLexeme(int charsToFill) {
+}
+
+void pelet::UCharViewBufferClass::MarkTokenStart() {
+	TokenStart = Current;
+}
+
+bool pelet::UCharViewBufferClass::HasReachedEnd() const {
+	return Current >= Limit;
+}
+
+int pelet::UCharViewBufferClass::GetCharacterPosition() const {
+	return TokenStart - Start;
+}
+
+int pelet::UCharViewBufferClass::GetCurrentPosition() const {
+	return Current - Start;
+}
+
+pelet::UCharChunkBufferClass::UCharChunkBufferClass()
+	: BufferClass()
+	, Buffer(NULL)
+	, BufferCapacity(0)
+	, Length(0)
+	, CharacterPos(0)
+	, SavedCurrent(0)
+	, SavedTokenStart(0)
+	, SavedLineNumber(1)
+	, IsFinished(false)
+	, NeedsMore(false) {
+}
+
+pelet::UCharChunkBufferClass::~UCharChunkBufferClass() {
+	Close();
+}
+
+void pelet::UCharChunkBufferClass::Open() {
+	Close();
+	BufferCapacity = PELET_CHUNK_CAPACITY;
+	Buffer = new UChar[BufferCapacity];
+	u_memset(Buffer, '\0', BufferCapacity);
+	Length = 0;
+	CharacterPos = 0;
+	SavedCurrent = 0;
+	SavedTokenStart = 0;
+	SavedLineNumber = 1;
+	IsFinished = false;
+	NeedsMore = false;
+	LineNumber = 1;
+	Current = Buffer;
+	TokenStart = Buffer;
+	Marker = Buffer;
+	Limit = Buffer;
+}
+
+void pelet::UCharChunkBufferClass::Append(const UChar* chars, int length) {
+	if (!Buffer || IsFinished || length <= 0) {
+		return;
+	}
+
+	// throw away the characters that have already been lexed
+	int discard = TokenStart - Buffer;
+	int keep = Length - discard;
+	int currentOffset = Current - TokenStart;
+	int minCapacity = keep + length + PELET_CHUNK_PADDING;
+	if (minCapacity > BufferCapacity) {
+		int newCapacity = minCapacity < (2 * BufferCapacity) ? (2 * BufferCapacity) : minCapacity;
+		UChar* newBuffer = new UChar[newCapacity];
+		u_memcpy(newBuffer, Buffer + discard, keep);
+		delete[] Buffer;
+		Buffer = newBuffer;
+		BufferCapacity = newCapacity;
+	}
+	else if (discard > 0) {
+		u_memmove(Buffer, Buffer + discard, keep);
+	}
+	u_memcpy(Buffer + keep, chars, length);
+	Length = keep + length;
+	u_memset(Buffer + Length, '\0', PELET_CHUNK_PADDING);
+	CharacterPos += discard;
+	SavedCurrent -= discard;
+	SavedTokenStart -= discard;
+	TokenStart = Buffer;
+	Current = Buffer + currentOffset;
+	Marker = Current;
+	Limit = Buffer + Length;
+}
+
+void pelet::UCharChunkBufferClass::Finish() {
+	if (Buffer) {
+		IsFinished = true;
+
+		// same as UCharBufferClass, the NULL terminator is part of the input
+		Limit = Buffer + Length + 1;
+	}
+}
+
+void pelet::UCharChunkBufferClass::Close() {
+	if (Buffer) {
+		delete[] Buffer;
+		Buffer = NULL;
+	}
+	BufferCapacity = 0;
+	Length = 0;
+	Current = NULL;
+	TokenStart = NULL;
+	Marker = NULL;
+	Limit = NULL;
+}
+
+void pelet::UCharChunkBufferClass::AppendToLexeme(int charsToFill) {
+	if (!IsFinished) {
+		NeedsMore = true;
+	}
+}
+
+void pelet::UCharChunkBufferClass::MarkTokenStart() {
+	TokenStart = Current;
+}
+
+bool pelet::UCharChunkBufferClass::HasReachedEnd() const {
+	return IsFinished && Current >= Limit;
+}
+
+int pelet::UCharChunkBufferClass::GetCharacterPosition() const {
+	return CharacterPos + (TokenStart - Buffer);
+}
+
+void pelet::UCharChunkBufferClass::SavePosition() {
+	SavedCurrent = Current - Buffer;
+	SavedTokenStart = TokenStart - Buffer;
+	SavedLineNumber = LineNumber;
+	NeedsMore = false;
+}
+
+void pelet::UCharChunkBufferClass::RestorePosition() {
+	Current = Buffer + SavedCurrent;
+	TokenStart = Buffer + SavedTokenStart;
+	Marker = Current;
+	LineNumber = SavedLineNumber;
+}
+
+bool pelet::UCharChunkBufferClass::NeedsMoreInput() const {
+	return NeedsMore;
+}
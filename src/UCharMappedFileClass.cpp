@@ -0,0 +1,306 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/UCharMappedFileClass.h>
+#include <string.h>
+#include <vector>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+typedef unsigned __int64 peletword64;
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+typedef uint64_t peletword64;
+#endif
+
+/**
+ * Converts UTF-8 to UTF-16. Runs of ASCII are converted 8 bytes at a 
+ * time (we check the high bits of an entire word at once); most PHP code
+ * is ASCII so the multi-byte path is seldom taken.
+ * 
+ * @param src the UTF-8 bytes
+ * @param length the number of bytes in src
+ * @param dest the destination, must be able to hold length characters
+ * @return the number of UTF-16 characters written to dest
+ */
+static int Utf8ToUChars(const unsigned char* src, size_t length, UChar* dest) {
+	const peletword64 highBits = 0x8080808080808080ULL;
+	UChar* out = dest;
+	size_t i = 0;
+	while (i < length) {
+		while (i + 8 <= length) {
+			peletword64 word;
+			memcpy(&word, src + i, 8);
+			if (word & highBits) {
+				break;
+			}
+			out[0] = src[i];
+			out[1] = src[i + 1];
+			out[2] = src[i + 2];
+			out[3] = src[i + 3];
+			out[4] = src[i + 4];
+			out[5] = src[i + 5];
+			out[6] = src[i + 6];
+			out[7] = src[i + 7];
+			out += 8;
+			i += 8;
+		}
+		if (i >= length) {
+			break;
+		}
+		unsigned char c = src[i];
+		if (c < 0x80) {
+			*out++ = c;
+			i++;
+			continue;
+		}
+
+		// a multi-byte sequence. reject overlong forms, surrogates and
+		// anything past U+10FFFF
+		UChar32 codePoint = 0xFFFD;
+		size_t sequenceLength = 1;
+		if (c >= 0xC2 && c <= 0xDF && i + 1 < length && (src[i + 1] & 0xC0) == 0x80) {
+			codePoint = ((c & 0x1F) << 6) | (src[i + 1] & 0x3F);
+			sequenceLength = 2;
+		}
+		else if (c >= 0xE0 && c <= 0xEF && i + 2 < length 
+				&& (src[i + 1] & 0xC0) == 0x80 && (src[i + 2] & 0xC0) == 0x80) {
+			UChar32 decoded = ((c & 0x0F) << 12) | ((src[i + 1] & 0x3F) << 6) | (src[i + 2] & 0x3F);
+			if (decoded >= 0x800 && (decoded < 0xD800 || decoded > 0xDFFF)) {
+				codePoint = decoded;
+				sequenceLength = 3;
+			}
+		}
+		else if (c >= 0xF0 && c <= 0xF4 && i + 3 < length
+				&& (src[i + 1] & 0xC0) == 0x80 && (src[i + 2] & 0xC0) == 0x80 && (src[i + 3] & 0xC0) == 0x80) {
+			UChar32 decoded = ((c & 0x07) << 18) | ((src[i + 1] & 0x3F) << 12) 
+				| ((src[i + 2] & 0x3F) << 6) | (src[i + 3] & 0x3F);
+			if (decoded >= 0x10000 && decoded <= 0x10FFFF) {
+				codePoint = decoded;
+				sequenceLength = 4;
+			}
+		}
+		if (codePoint > 0xFFFF) {
+			codePoint -= 0x10000;
+			*out++ = (UChar)(0xD800 + (codePoint >> 10));
+			*out++ = (UChar)(0xDC00 + (codePoint & 0x3FF));
+		}
+		else {
+			*out++ = (UChar)codePoint;
+		}
+		i += sequenceLength;
+	}
+	return out - dest;
+}
+
+pelet::UCharMappedFileClass::UCharMappedFileClass()
+	: BufferClass()
+	, Buffer(NULL)
+	, Length(0)
+	, Capacity(0)
+	, IsKeepingCapacity(false) {
+}
+
+pelet::UCharMappedFileClass::~UCharMappedFileClass() {
+	IsKeepingCapacity = false;
+	Close();
+}
+
+void pelet::UCharMappedFileClass::SetKeepCapacity(bool keep) {
+	IsKeepingCapacity = keep;
+}
+
+void pelet::UCharMappedFileClass::Close() {
+	if (Buffer && !IsKeepingCapacity) {
+		delete[] Buffer;
+		Buffer = NULL;
+		Capacity = 0;
+	}
+	Length = 0;
+	Current = NULL;
+	TokenStart = NULL;
+	Marker = NULL;
+	Limit = NULL;
+}
+
+bool pelet::UCharMappedFileClass::OpenBytes(const char* bytes, size_t length) {
+	Close();
+	LineNumber = 1;
+
+	// UTF-8 never produces more UTF-16 code units than bytes
+	if (!Buffer || (size_t)Capacity < length + 1) {
+		delete[] Buffer;
+		Buffer = new UChar[length + 1];
+		Capacity = (int)(length + 1);
+	}
+	Length = Utf8ToUChars((const unsigned char*)bytes, length, Buffer);
+	Buffer[Length] = '\0';
+	Current = Buffer;
+	TokenStart = Buffer;
+	Marker = Buffer;
+	Limit = Buffer + Length + 1;
+	return true;
+}
+
+#if defined(__WIN32__) || defined(_WIN32)
+
+/**
+ * maps the file handle from the given offset and converts it
+ */
+static bool MapAndConvert(HANDLE handle, __int64 offset, pelet::UCharMappedFileClass& buffer) {
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size)) {
+		return false;
+	}
+	if (size.QuadPart <= offset) {
+		return buffer.OpenBytes("", 0);
+	}
+	HANDLE mapping = CreateFileMapping(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping) {
+		return false;
+	}
+	const char* view = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	bool ret = false;
+	if (view) {
+		ret = buffer.OpenBytes(view + offset, (size_t)(size.QuadPart - offset));
+		UnmapViewOfFile(view);
+	}
+	CloseHandle(mapping);
+	return ret;
+}
+
+bool pelet::UCharMappedFileClass::OpenFile(const char* newFile) {
+	Close();
+	HANDLE handle = CreateFileA(newFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, 
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (INVALID_HANDLE_VALUE == handle) {
+		return false;
+	}
+	bool ret = MapAndConvert(handle, 0, *this);
+	CloseHandle(handle);
+	return ret;
+}
+
+bool pelet::UCharMappedFileClass::OpenFile(FILE* file) {
+	Close();
+	if (!file) {
+		return false;
+	}
+	__int64 offset = _ftelli64(file);
+	HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+	if (INVALID_HANDLE_VALUE != handle && offset >= 0 && MapAndConvert(handle, offset, *this)) {
+		return true;
+	}
+
+	// not a mappable file; read it all
+	std::vector<char> contents;
+	char chunk[4096];
+	size_t read = 0;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+		contents.insert(contents.end(), chunk, chunk + read);
+	}
+	return OpenBytes(contents.empty() ? "" : &contents[0], contents.size());
+}
+
+#else
+
+/**
+ * maps the file descriptor from the given offset and converts it
+ */
+static bool MapAndConvert(int fd, off_t offset, pelet::UCharMappedFileClass& buffer) {
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+		return false;
+	}
+	if (fileStat.st_size <= offset) {
+		return buffer.OpenBytes("", 0);
+	}
+	void* view = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (MAP_FAILED == view) {
+		return false;
+	}
+#ifdef MADV_SEQUENTIAL
+	madvise(view, fileStat.st_size, MADV_SEQUENTIAL);
+#endif
+	bool ret = buffer.OpenBytes((const char*)view + offset, (size_t)(fileStat.st_size - offset));
+	munmap(view, fileStat.st_size);
+	return ret;
+}
+
+bool pelet::UCharMappedFileClass::OpenFile(const char* newFile) {
+	Close();
+	int fd = open(newFile, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	bool ret = MapAndConvert(fd, 0, *this);
+	close(fd);
+	return ret;
+}
+
+bool pelet::UCharMappedFileClass::OpenFile(FILE* file) {
+	Close();
+	if (!file) {
+		return false;
+	}
+	off_t offset = ftello(file);
+	if (offset >= 0 && MapAndConvert(fileno(file), offset, *this)) {
+		return true;
+	}
+
+	// not a mappable file (pipe, socket); read it all
+	std::vector<char> contents;
+	char chunk[4096];
+	size_t read = 0;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+		contents.insert(contents.end(), chunk, chunk + read);
+	}
+	return OpenBytes(contents.empty() ? "" : &contents[0], contents.size());
+}
+
+#endif
+
+void pelet::UCharMappedFileClass::AppendToLexeme(int charsToFill) {
+}
+
+void pelet::UCharMappedFileClass::MarkTokenStart() {
+	TokenStart = Current;
+}
+
+bool pelet::UCharMappedFileClass::HasReachedEnd() const {
+	return Current >= Limit;
+}
+
+int pelet::UCharMappedFileClass::GetCharacterPosition() const {
+	return TokenStart - Buffer;
+}
+
+int pelet::UCharMappedFileClass::GetLength() const {
+	return Length;
+}
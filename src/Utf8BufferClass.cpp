@@ -0,0 +1,285 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <pelet/Utf8BufferClass.h>
+#include <string.h>
+#include <vector>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+pelet::Utf8BufferClass::Utf8BufferClass()
+	: Current(NULL)
+	, TokenStart(NULL)
+	, Marker(NULL)
+	, Limit(NULL)
+	, Start(NULL)
+	, Copy(NULL)
+	, View(NULL)
+	, ViewLength(0)
+	, Length(0)
+	, LineNumber(1) {
+}
+
+pelet::Utf8BufferClass::~Utf8BufferClass() {
+	Close();
+}
+
+#if defined(__WIN32__) || defined(_WIN32)
+
+static void Unmap(void* view, size_t viewLength) {
+	UnmapViewOfFile(view);
+}
+
+/**
+ * maps the file handle from the given offset
+ */
+static bool MapFile(HANDLE handle, __int64 offset, void*& view, size_t& viewLength, bool& isTerminated) {
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size) || size.QuadPart <= offset) {
+		return false;
+	}
+	HANDLE mapping = CreateFileMapping(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping) {
+		return false;
+	}
+
+	// the view keeps the mapping alive
+	view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view) {
+		return false;
+	}
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	viewLength = (size_t)size.QuadPart;
+	isTerminated = (viewLength % info.dwPageSize) != 0;
+	return true;
+}
+
+bool pelet::Utf8BufferClass::OpenFile(const char* newFile) {
+	Close();
+	HANDLE handle = CreateFileA(newFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, 
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (INVALID_HANDLE_VALUE == handle) {
+		return false;
+	}
+	void* view = NULL;
+	size_t viewLength = 0;
+	bool isTerminated = false;
+	bool ret = false;
+	if (MapFile(handle, 0, view, viewLength, isTerminated)) {
+		ret = Attach(view, viewLength, 0, isTerminated);
+	}
+	else {
+		LARGE_INTEGER size;
+		ret = GetFileSizeEx(handle, &size) && 0 == size.QuadPart && OpenBytes("", 0);
+	}
+	CloseHandle(handle);
+	return ret;
+}
+
+bool pelet::Utf8BufferClass::OpenFile(FILE* file) {
+	Close();
+	if (!file) {
+		return false;
+	}
+	__int64 offset = _ftelli64(file);
+	HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+	void* view = NULL;
+	size_t viewLength = 0;
+	bool isTerminated = false;
+	if (INVALID_HANDLE_VALUE != handle && offset >= 0 && MapFile(handle, offset, view, viewLength, isTerminated)) {
+		return Attach(view, viewLength, (size_t)offset, isTerminated);
+	}
+
+	// not a mappable file (or an empty one); read it all
+	std::vector<char> contents;
+	char chunk[4096];
+	size_t read = 0;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+		contents.insert(contents.end(), chunk, chunk + read);
+	}
+	return OpenBytes(contents.empty() ? "" : &contents[0], contents.size());
+}
+
+#else
+
+static void Unmap(void* view, size_t viewLength) {
+	munmap(view, viewLength);
+}
+
+/**
+ * maps the file descriptor from the given offset
+ */
+static bool MapFile(int fd, off_t offset, void*& view, size_t& viewLength, bool& isTerminated) {
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size <= offset) {
+		return false;
+	}
+	view = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (MAP_FAILED == view) {
+		view = NULL;
+		return false;
+	}
+#ifdef MADV_SEQUENTIAL
+	madvise(view, fileStat.st_size, MADV_SEQUENTIAL);
+#endif
+	viewLength = (size_t)fileStat.st_size;
+
+	// the rest of the last page is filled with zeros, that is our null terminator 
+	isTerminated = (viewLength % sysconf(_SC_PAGESIZE)) != 0;
+	return true;
+}
+
+bool pelet::Utf8BufferClass::OpenFile(const char* newFile) {
+	Close();
+	int fd = open(newFile, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	void* view = NULL;
+	size_t viewLength = 0;
+	bool isTerminated = false;
+	bool ret = false;
+	if (MapFile(fd, 0, view, viewLength, isTerminated)) {
+		ret = Attach(view, viewLength, 0, isTerminated);
+	}
+	else {
+		struct stat fileStat;
+		ret = fstat(fd, &fileStat) == 0 && 0 == fileStat.st_size && OpenBytes("", 0);
+	}
+	close(fd);
+	return ret;
+}
+
+bool pelet::Utf8BufferClass::OpenFile(FILE* file) {
+	Close();
+	if (!file) {
+		return false;
+	}
+	off_t offset = ftello(file);
+	void* view = NULL;
+	size_t viewLength = 0;
+	bool isTerminated = false;
+	if (offset >= 0 && MapFile(fileno(file), offset, view, viewLength, isTerminated)) {
+		return Attach(view, viewLength, (size_t)offset, isTerminated);
+	}
+
+	// not a mappable file (pipe, socket or an empty file); read it all
+	std::vector<char> contents;
+	char chunk[4096];
+	size_t read = 0;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+		contents.insert(contents.end(), chunk, chunk + read);
+	}
+	return OpenBytes(contents.empty() ? "" : &contents[0], contents.size());
+}
+
+#endif
+
+bool pelet::Utf8BufferClass::Attach(void* view, size_t viewLength, size_t offset, bool isTerminated) {
+	if (!isTerminated) {
+		bool ret = OpenBytes((const char*)view + offset, viewLength - offset);
+		Unmap(view, viewLength);
+		return ret;
+	}
+	LineNumber = 1;
+	View = view;
+	ViewLength = viewLength;
+	Start = (const unsigned char*)view + offset;
+	Length = (int)(viewLength - offset);
+	Current = Start;
+	TokenStart = Start;
+	Marker = Start;
+	Limit = Start + Length + 1;
+	return true;
+}
+
+bool pelet::Utf8BufferClass::OpenBytes(const char* bytes, size_t length) {
+	Close();
+	LineNumber = 1;
+	Copy = new unsigned char[length + 1];
+	memcpy(Copy, bytes, length);
+	Copy[length] = '\0';
+	Start = Copy;
+	Length = (int)length;
+	Current = Start;
+	TokenStart = Start;
+	Marker = Start;
+	Limit = Start + Length + 1;
+	return true;
+}
+
+void pelet::Utf8BufferClass::Close() {
+	if (View) {
+		Unmap(View, ViewLength);
+		View = NULL;
+		ViewLength = 0;
+	}
+	if (Copy) {
+		delete[] Copy;
+		Copy = NULL;
+	}
+	Start = NULL;
+	Length = 0;
+	Current = NULL;
+	TokenStart = NULL;
+	Marker = NULL;
+	Limit = NULL;
+}
+
+void pelet::Utf8BufferClass::AppendToLexeme(int charsToFill) {
+}
+
+void pelet::Utf8BufferClass::MarkTokenStart() {
+	TokenStart = Current;
+}
+
+void pelet::Utf8BufferClass::IncrementLine() {
+	LineNumber++;
+}
+
+int pelet::Utf8BufferClass::GetLineNumber() const {
+	return LineNumber;
+}
+
+bool pelet::Utf8BufferClass::HasReachedEnd() const {
+	return Current >= Limit;
+}
+
+int pelet::Utf8BufferClass::GetCharacterPosition() const {
+	return TokenStart - Start;
+}
+
+int pelet::Utf8BufferClass::GetLength() const {
+	return Length;
+}
@@ -0,0 +1,145 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/AstArenaClass.h>
+#include <pelet/ParserClass.h>
+#include <TestObserverClass.h>
+#include <FileTestFixtureClass.h>
+#include <PeletChecks.h>
+#include <unicode/unistr.h>
+
+/**
+ * an item that lets us know when its destructor has been called
+ */
+class CountingAstItemClass : public pelet::AstItemClass {
+
+public:
+
+	CountingAstItemClass(int* destroyed) 
+		: AstItemClass()
+		, Destroyed(destroyed) {
+	}
+
+	~CountingAstItemClass() {
+		(*Destroyed)++;
+	}
+
+	int* Destroyed;
+};
+
+class AstArenaTestFixtureClass {
+
+public:
+
+	pelet::AstArenaClass Arena;
+	int Destroyed;
+
+	AstArenaTestFixtureClass()
+		: Arena(1024)
+		, Destroyed(0) {
+	}
+};
+
+SUITE(AstArenaTestClass) {
+
+TEST_FIXTURE(AstArenaTestFixtureClass, AllocateShouldBeContiguous) {
+	char* first = (char*)Arena.Allocate(16);
+	char* second = (char*)Arena.Allocate(16);
+	CHECK_EQUAL((void*)(first + 16), (void*)second);
+	CHECK(Arena.Contains(first));
+	CHECK(Arena.Contains(second));
+	CHECK_EQUAL((size_t)32, Arena.BytesUsed());
+	CHECK_EQUAL((size_t)1024, Arena.Capacity());
+}
+
+TEST_FIXTURE(AstArenaTestFixtureClass, AllocateShouldAlign) {
+	char* first = (char*)Arena.Allocate(3);
+	char* second = (char*)Arena.Allocate(3);
+	CHECK_EQUAL(0, (int)(((size_t)second - (size_t)first) % 16));
+}
+
+TEST_FIXTURE(AstArenaTestFixtureClass, AllocateLargerThanBlock) {
+	Arena.Allocate(100);
+	void* large = Arena.Allocate(4000);
+	CHECK(Arena.Contains(large));
+	CHECK_EQUAL((size_t)(1024 + 4000), Arena.Capacity());
+}
+
+TEST_FIXTURE(AstArenaTestFixtureClass, ResetShouldDestroyItemsAndReuseMemory) {
+	CountingAstItemClass* arenaItem = new (Arena) CountingAstItemClass(&Destroyed);
+	Arena.Adopt(arenaItem);
+	CountingAstItemClass* heapItem = new CountingAstItemClass(&Destroyed);
+	CHECK_EQUAL(false, Arena.Contains(heapItem));
+	Arena.Adopt(heapItem);
+	CHECK_EQUAL((size_t)2, Arena.ItemCount());
+
+	Arena.Reset();
+	CHECK_EQUAL(2, Destroyed);
+	CHECK_EQUAL((size_t)0, Arena.ItemCount());
+	CHECK_EQUAL((size_t)0, Arena.BytesUsed());
+	CHECK_EQUAL((size_t)1024, Arena.Capacity());
+
+	// the same memory should be handed out again
+	CountingAstItemClass* reused = new (Arena) CountingAstItemClass(&Destroyed);
+	Arena.Adopt(reused);
+	CHECK_EQUAL((void*)arenaItem, (void*)reused);
+	Arena.Release();
+	CHECK_EQUAL(3, Destroyed);
+	CHECK_EQUAL((size_t)0, Arena.Capacity());
+}
+
+TEST_FIXTURE(AstArenaTestFixtureClass, SwapShouldTransferItems) {
+	pelet::AstArenaClass other;
+	Arena.Adopt(new (Arena) CountingAstItemClass(&Destroyed));
+	Arena.Swap(other);
+	CHECK_EQUAL((size_t)0, Arena.ItemCount());
+	CHECK_EQUAL((size_t)1, other.ItemCount());
+	Arena.Reset();
+	CHECK_EQUAL(0, Destroyed);
+	other.Reset();
+	CHECK_EQUAL(1, Destroyed);
+}
+
+TEST_FIXTURE(AstArenaTestFixtureClass, ParserShouldReuseArenaAcrossScans) {
+	pelet::ParserClass parser;
+	pelet::LintResultsClass results;
+	TestObserverClass observer;
+	parser.SetVersion(pelet::PHP_54);
+	parser.SetClassObserver(&observer);
+	parser.SetVariableObserver(&observer);
+	parser.SetExpressionObserver(&observer);
+	UnicodeString code = _U(
+		"class MyClass { function work($a) { $b = $this->prop->call($a); } }"
+		"$c = new MyClass;"
+	);
+	CHECK(parser.ScanString(code, results));
+	CHECK(parser.ScanString(code, results));
+	CHECK_VECTOR_SIZE(2, observer.ClassName);
+	CHECK_UNISTR_EQUALS("MyClass", observer.ClassName[1]);
+	CHECK_VECTOR_SIZE(6, observer.VariableName);
+	CHECK_UNISTR_EQUALS("$c", observer.VariableName[5]);
+}
+
+}
@@ -0,0 +1,161 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/IncrementalLexerClass.h>
+#include <unicode/ustream.h> //get the << overloaded operator, needed by UnitTest++
+
+/**
+ * This fixture checks the tokens of the incremental lexer against the tokens
+ * of a lexer that tokenized the edited code from the start.
+ */
+class IncrementalLexerTestClass {
+
+public:
+
+	pelet::IncrementalLexerClass Lexer;
+
+	pelet::RelexResultsClass Results;
+
+	IncrementalLexerTestClass()
+		: Lexer()
+		, Results() {
+	}
+
+	/**
+	 * @return the index of the first token that is different from a 
+	 *         full tokenization of the current code, or -1 if all tokens are the same
+	 */
+	int FirstMismatch() {
+		pelet::IncrementalLexerClass full;
+		full.Open(Lexer.GetCode());
+		size_t count = full.GetTokenCount() < Lexer.GetTokenCount() ? full.GetTokenCount() : Lexer.GetTokenCount();
+		for (size_t i = 0; i < count; ++i) {
+			const pelet::LexedTokenClass& expected = full.GetToken(i);
+			const pelet::LexedTokenClass& actual = Lexer.GetToken(i);
+			if (expected.Token != actual.Token || expected.Start != actual.Start || expected.End != actual.End
+				|| expected.LineNumber != actual.LineNumber || expected.EndCondition != actual.EndCondition) {
+				return i;
+			}
+		}
+		if (full.GetTokenCount() != Lexer.GetTokenCount()) {
+			return count;
+		}
+		return -1;
+	}
+};
+
+SUITE(IncrementalLexerTestClass) {
+
+TEST_FIXTURE(IncrementalLexerTestClass, OpenShouldTokenizeAll) {
+	Lexer.Open(UNICODE_STRING_SIMPLE("<?php\n$a = 1;\n"));
+	CHECK_EQUAL((size_t)6, Lexer.GetTokenCount());
+	CHECK_EQUAL(pelet::T_OPEN_TAG, Lexer.GetToken(0).Token);
+	CHECK_EQUAL(pelet::T_VARIABLE, Lexer.GetToken(1).Token);
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("$a"), Lexer.GetLexeme(1));
+	CHECK_EQUAL(2, Lexer.GetToken(1).LineNumber);
+	CHECK_EQUAL(pelet::T_END, Lexer.GetToken(5).Token);
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, EditShouldOnlyRelexNearTheEdit) {
+	UnicodeString code = UNICODE_STRING_SIMPLE("<?php\n");
+	for (int i = 0; i < 500; ++i) {
+		code += UNICODE_STRING_SIMPLE("$abc = strlen('hello') + 1;\n");
+	}
+	Lexer.Open(code);
+	size_t count = Lexer.GetTokenCount();
+	int pos = code.indexOf(UNICODE_STRING_SIMPLE("abc"), 5000);
+	CHECK(Lexer.Edit(pos + 1, 0, UNICODE_STRING_SIMPLE("xyz"), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(count, Lexer.GetTokenCount());
+	CHECK(Results.CharactersLexed < 20);
+	CHECK_EQUAL(Results.TokensRemoved, Results.TokensAdded);
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("$axyzbc"), Lexer.GetLexeme(Results.FirstToken + Results.TokensAdded - 1));
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, EditShouldRelexUntilTheEndWhenConditionChanges) {
+	Lexer.Open(UNICODE_STRING_SIMPLE("<?php\n$a = 1;\n$b = 2;\n$c = 3;\n"));
+	CHECK(Lexer.Edit(6, 0, UNICODE_STRING_SIMPLE("/*"), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(pelet::T_ERROR_UNTERMINATED_COMMENT, Lexer.GetToken(Lexer.GetTokenCount() - 1).Token);
+	CHECK(Lexer.Edit(12, 0, UNICODE_STRING_SIMPLE("*/"), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(pelet::T_END, Lexer.GetToken(Lexer.GetTokenCount() - 1).Token);
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, EditShouldRelexCastLookahead) {
+	Lexer.Open(UNICODE_STRING_SIMPLE("<?php $a = ( int  $b);"));
+	CHECK(Lexer.Edit(18, 0, UNICODE_STRING_SIMPLE(")"), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(pelet::T_INT_CAST, Lexer.GetToken(3).Token);
+	CHECK(Lexer.Edit(18, 1, UNICODE_STRING_SIMPLE(""), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL('(', Lexer.GetToken(3).Token);
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, EditShouldMoveLinesAfterTheEdit) {
+	Lexer.Open(UNICODE_STRING_SIMPLE("<?php\n$a = 1;\n$b = 2;\n"));
+	CHECK(Lexer.Edit(8, 0, UNICODE_STRING_SIMPLE("\n\n"), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(5, Lexer.GetToken(Lexer.GetTokenCount() - 2).LineNumber);
+	CHECK(Lexer.Edit(0, 6, UNICODE_STRING_SIMPLE("<?php "), Results));
+	CHECK_EQUAL(-1, FirstMismatch());
+	CHECK_EQUAL(4, Lexer.GetToken(Lexer.GetTokenCount() - 2).LineNumber);
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, EditShouldRejectPositionsOutsideTheCode) {
+	Lexer.Open(UNICODE_STRING_SIMPLE("<?php $a;"));
+	CHECK_EQUAL(false, Lexer.Edit(8, 3, UNICODE_STRING_SIMPLE(""), Results));
+	CHECK_EQUAL(false, Lexer.Edit(-1, 0, UNICODE_STRING_SIMPLE("a"), Results));
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("<?php $a;"), Lexer.GetCode());
+}
+
+TEST_FIXTURE(IncrementalLexerTestClass, ManyEditsShouldBeSameAsFullLex) {
+	const char* snippets[] = { "'", "\"", "/*", "*/", "(", "int", ")", "\n", "<?php ", "?>", "$a", " ", 
+		"<<<EOF\n", "\nEOF;\n", "{$b}", "//", "#", "`", "->c", "\\" };
+	int snippetCount = sizeof(snippets) / sizeof(snippets[0]);
+	Lexer.Open(UNICODE_STRING_SIMPLE("<html><?php\nclass A {\n function b($c) { return (int) $c . \"d{$c}\"; }\n}\n?>\n</html>\n"));
+	unsigned int seed = 12345;
+	for (int i = 0; i < 400; ++i) {
+		seed = seed * 1103515245 + 12345;
+		int length = Lexer.GetCode().length();
+		int pos = (seed >> 8) % (length + 1);
+		int removed = 0;
+		if ((seed >> 4) % 3 == 0 && pos < length) {
+			removed = 1 + (seed >> 16) % 3;
+			if (pos + removed > length) {
+				removed = length - pos;
+			}
+		}
+		UnicodeString text = UnicodeString::fromUTF8(snippets[(seed >> 20) % snippetCount]);
+		CHECK(Lexer.Edit(pos, removed, text, Results));
+		int mismatch = FirstMismatch();
+		CHECK_EQUAL(-1, mismatch);
+		if (mismatch >= 0) {
+			break;
+		}
+	}
+}
+
+}
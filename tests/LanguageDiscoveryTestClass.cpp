@@ -140,4 +140,128 @@ TEST(MultipleHtmlBlocks) {
 	
 }
 
+TEST(DiscoverShouldNotSkipTheCharacterAfterADoubleQuotedString) {
+
+	// the end tag right after the closing quote must still end the PHP code
+	UnicodeString code = _U(
+		"<html><body>"
+		"<?php echo \"hello\"?>"
+		"<p>goodbye</p>"
+		"</body></html>"
+	);
+	pelet::LanguageDiscoveryClass discover;
+	CHECK(discover.Open(code));
+	int pos = code.indexOf(UNICODE_STRING_SIMPLE("hello"));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_PHP_DOUBLE_QUOTE_STRING, discover.at(pos));
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("goodbye"));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_HTML, discover.at(pos));
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("p>goodbye"));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_HTML_TAG, discover.at(pos));
+}
+
+/**
+ * checks that the indexed mode gives the same language as the scanning mode for
+ * every position of the given code
+ */
+static int FirstIndexedMismatch(const UnicodeString& code, pelet::LanguageDiscoveryClass& indexed) {
+	pelet::LanguageDiscoveryClass discover;
+	discover.Open(code);
+	for (int pos = 0; pos <= code.length() + 1; ++pos) {
+		if (discover.at(pos) != indexed.at(pos)) {
+			return pos;
+		}
+	}
+	return -1;
+}
+
+TEST(IndexedShouldBeSameAsScanning) {
+	UnicodeString code = _U(
+		"<html><body class='<?php echo \"?>\" . $theclass; ?>' id=\"thebody\">"
+		"<a href=<?= $link ?>>&amp; link</a><!-- comment <?php echo 1; ?> -->"
+		"<?php echo '?>hello';\n"
+		"echo \"goodbye ?> double\"'single';\n"
+		"echo <<<EOF\n"
+		"goodbye ?> heredoc\n"
+		"EOF;\n"
+		"echo <<<'EOF'\n"
+		"goodbye ?> nowdoc\n"
+		"EOF;\n"
+		"echo `goodbye ?> backtick`;\n"
+		"/** ?> multiline comment */\n"
+		" // singleline ?> \n"
+		"</body></html>"
+	);
+	pelet::LanguageDiscoveryClass indexed;
+	CHECK(indexed.OpenIndexed(code));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+	
+	// backwards too, once everything has been indexed
+	pelet::LanguageDiscoveryClass discover;
+	discover.Open(code);
+	for (int pos = code.length(); pos >= 0; --pos) {
+		CHECK_EQUAL(discover.at(pos), indexed.at(pos));
+	}
+}
+
+TEST(IndexedShouldHandleUnterminatedHeredoc) {
+	UnicodeString code = _U(
+		"<?php\n"
+		"echo <<<EOF\n"
+		"unterminated\n"
+	);
+	pelet::LanguageDiscoveryClass indexed;
+	CHECK(indexed.OpenIndexed(code));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_PHP_HEREDOC, indexed.at(code.length()));
+}
+
+TEST(UpdateShouldScanAgainAfterTheEdit) {
+	UnicodeString code = _U(
+		"<html><body><?ph echo 'hello'; ?>\n"
+		"<div class=  'a'>text</div>\n"
+		"<?php $a = \"b\"; ?></body></html>"
+	);
+	pelet::LanguageDiscoveryClass indexed;
+	CHECK(indexed.OpenIndexed(code));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+
+	// makes the start tag a '<?php' start tag; the old start tag was decided by looking
+	// at the characters after it
+	int pos = code.indexOf(UNICODE_STRING_SIMPLE("<?ph")) + 4;
+	code.insert(pos, UNICODE_STRING_SIMPLE("p"));
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+
+	// makes a tag into an HTML comment
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("<div")) + 1;
+	code.insert(pos, UNICODE_STRING_SIMPLE("!-"));
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+	code.insert(pos + 2, UNICODE_STRING_SIMPLE("-"));
+	CHECK(indexed.Update(code, pos + 2));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_HTML_COMMENT, indexed.at(pos + 4));
+	code.remove(pos, 3);
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+
+	// starts a comment, the rest of the code is a comment
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("$a"));
+	code.insert(pos, UNICODE_STRING_SIMPLE("/*"));
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+	CHECK_EQUAL(pelet::LanguageDiscoveryClass::SYNTAX_PHP_MULTI_LINE_COMMENT, indexed.at(code.length()));
+
+	// attribute value is no longer a value
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("=  '"));
+	code.remove(pos, 1);
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+
+	pos = code.indexOf(UNICODE_STRING_SIMPLE("class"));
+	code.remove(pos);
+	CHECK(indexed.Update(code, pos));
+	CHECK_EQUAL(-1, FirstIndexedMismatch(code, indexed));
+}
+
 }
\ No newline at end of file
@@ -137,6 +137,162 @@ TEST_FIXTURE(LexicalAnalyzerTestClass, NextTokenShouldFindWhenFileEndsWithIdenti
 	CHECK_TOKEN(pelet::T_END);
 }
 
+TEST_FIXTURE(LexicalAnalyzerTestClass, NextTokenShouldBeSameWithMappedFile) {
+	std::string file = "test.php";
+	std::string code = "<html><?php\n"
+		"class MyClass {\n"
+		"\t/** comment */\n"
+		"\tfunction work($a) { return \"caf\xC3\xA9 $a\" . <<<EOF\nheredoc\nEOF;\n }\n"
+		"}\n"
+		"?></html>";
+	CreateFixtureFile(file, code);
+	Lexer54.SetFileBufferType(pelet::MAPPED_UTF8_FILE_BUFFER);
+	CHECK(LexerOpen(TestProjectDir + file));
+	int token53 = 0;
+	int token54 = 0;
+	UnicodeString lexeme53;
+	do {
+		token53 = Lexer53.NextToken();
+		token54 = Lexer54.NextToken();
+		CHECK_EQUAL(token53, token54);
+		Lexer53.GetLexeme(lexeme53);
+		Lexer54.GetLexeme(ActualLexeme);
+		CHECK_EQUAL(lexeme53, ActualLexeme);
+		CHECK_EQUAL(Lexer53.GetLineNumber(), Lexer54.GetLineNumber());
+		CHECK_EQUAL(Lexer53.GetCharacterPosition(), Lexer54.GetCharacterPosition());
+	} while (!pelet::IsTerminatingToken(token53) && token53 == token54);
+	CHECK_EQUAL(pelet::T_END, token54);
+}
+
+TEST_FIXTURE(LexicalAnalyzerTestClass, NextTokenShouldBeSameWithUtf8File) {
+	std::string file = "test.php";
+	std::string code = "<html>\xC3\xA9<?php\n"
+		"class Caf\xC3\xA9 {\n"
+		"\t/** comment \xE2\x82\xAC */\n"
+		"\tfunction work($\xC3\xA9t\xC3\xA9) { return 'caf\\'\xC3\xA9' . \"caf\xC3\xA9 $a\" . <<<\xC3\x89OF\n"
+		"h\xC3\xA9redoc\n"
+		"\xC3\x89OF\n"
+		". <<<'EOF'\n"
+		"nowdoc\n"
+		"EOF;\n"
+		" }\n"
+		"}\n"
+		"?></html>";
+	CreateFixtureFile(file, code);
+	pelet::LexicalAnalyzerClass mapped53;
+	pelet::LexicalAnalyzerClass mapped54;
+	mapped54.SetVersion(pelet::PHP_54);
+	mapped53.SetFileBufferType(pelet::MAPPED_UTF8_FILE_BUFFER);
+	mapped54.SetFileBufferType(pelet::MAPPED_UTF8_FILE_BUFFER);
+	Lexer53.SetFileBufferType(pelet::UTF8_FILE_BUFFER);
+	Lexer54.SetFileBufferType(pelet::UTF8_FILE_BUFFER);
+	CHECK(LexerOpen(TestProjectDir + file));
+	CHECK(mapped53.OpenFile(TestProjectDir + file));
+	CHECK(mapped54.OpenFile(TestProjectDir + file));
+	int token53 = 0;
+	int token54 = 0;
+	UnicodeString expected53, expected54;
+	do {
+		token53 = Lexer53.NextToken();
+		token54 = Lexer54.NextToken();
+		CHECK_EQUAL(mapped53.NextToken(), token53);
+		CHECK_EQUAL(mapped54.NextToken(), token54);
+		mapped53.GetLexeme(expected53);
+		mapped54.GetLexeme(expected54);
+		Lexer53.GetLexeme(ActualLexeme);
+		CHECK_EQUAL(expected53, ActualLexeme);
+		Lexer54.GetLexeme(ActualLexeme);
+		CHECK_EQUAL(expected54, ActualLexeme);
+		CHECK_EQUAL(mapped53.GetLineNumber(), Lexer53.GetLineNumber());
+		CHECK_EQUAL(mapped54.GetLineNumber(), Lexer54.GetLineNumber());
+	} while (!pelet::IsTerminatingToken(token53) && !pelet::IsTerminatingToken(token54));
+	CHECK_EQUAL(pelet::T_END, token53);
+	CHECK_EQUAL(pelet::T_END, token54);
+}
+
+TEST_FIXTURE(LexicalAnalyzerTestClass, NextTokenShouldUseByteOffsetsWithUtf8File) {
+	std::string file = "test.php";
+	std::string code = "<?php $caf\xC3\xA9 = 1;";
+	CreateFixtureFile(file, code);
+	Lexer53.SetFileBufferType(pelet::UTF8_FILE_BUFFER);
+	Lexer54.SetFileBufferType(pelet::UTF8_FILE_BUFFER);
+	CHECK(LexerOpen(TestProjectDir + file));
+	CHECK_TOKEN(pelet::T_OPEN_TAG);
+	CHECK_TOKEN_LEXEME(pelet::T_VARIABLE, UNICODE_STRING_SIMPLE("$caf\u00e9").unescape());
+	CHECK_TOKEN_POSITION(6);
+	CHECK_TOKEN_LEXEME('=', UNICODE_STRING_SIMPLE("="));
+	CHECK_TOKEN_POSITION(13);
+}
+
+TEST_FIXTURE(LexicalAnalyzerTestClass, TokenizeAllShouldBeSameAsNextToken) {
+	UnicodeString code = _U(
+		"class Cafe {\n"
+		"\t/** comment \n */\n"
+		"\tfunction work($a) { return (int) 'cafe' . \"cafe $a\" . <<<EOF\n"
+		"heredoc\n"
+		"EOF\n"
+		"; }\n"
+		"}\n"
+	);
+	pelet::TokenTableClass table;
+	CHECK(Lexer54.TokenizeAll(code, table));
+	CHECK(Lexer53.OpenString(code));
+	size_t i = 0;
+	int token = 0;
+	do {
+		token = Lexer53.NextToken();
+		CHECK(i < table.GetCount());
+		if (i >= table.GetCount()) {
+			break;
+		}
+		CHECK_EQUAL(token, table.Tokens[i]);
+		CHECK_EQUAL(Lexer53.GetCharacterPosition(), table.Starts[i]);
+		i++;
+	} while (!pelet::IsTerminatingToken(token));
+	CHECK_EQUAL(i, table.GetCount());
+}
+
+TEST_FIXTURE(LexicalAnalyzerTestClass, TokenizeAllShouldGiveLexemesAndLines) {
+	UnicodeString code = _U(
+		"$s = 'hello';\n"
+		"/* a\r\n"
+		"comment */ $a\n"
+		"\n"
+		"= 1;"
+	);
+	pelet::TokenTableClass table;
+	CHECK(Lexer53.TokenizeAll(code, table));
+	CHECK_EQUAL((size_t)10, table.GetCount());
+	CHECK_EQUAL(pelet::T_VARIABLE, table.Tokens[0]);
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("$s"), table.GetLexeme(0));
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("'hello'"), table.GetLexeme(2));
+	CHECK_EQUAL(pelet::T_COMMENT, table.Tokens[4]);
+	CHECK_EQUAL(2, table.Lines[4]);
+	CHECK_EQUAL(pelet::T_VARIABLE, table.Tokens[5]);
+	CHECK_EQUAL(3, table.Lines[5]);
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("$a"), table.GetLexeme(5));
+	CHECK_EQUAL('=', table.Tokens[6]);
+	CHECK_EQUAL(5, table.Lines[6]);
+	CHECK_EQUAL(pelet::T_END, table.Tokens[9]);
+	CHECK_EQUAL(pelet::yycSCRIPT, table.GetEndCondition(8));
+}
+
+TEST_FIXTURE(LexicalAnalyzerTestClass, TokenizeFileShouldStartWithHtml) {
+	std::string file = "test.php";
+	std::string code = "<html>\n<?php $caf\xC3\xA9 = 1; ?>\n</html>";
+	CreateFixtureFile(file, code);
+	pelet::TokenTableClass table;
+	CHECK(Lexer53.TokenizeFile(TestProjectDir + file, table));
+	CHECK_EQUAL((size_t)7, table.GetCount());
+	CHECK_EQUAL(pelet::T_OPEN_TAG, table.Tokens[0]);
+	CHECK_EQUAL(2, table.Lines[0]);
+	CHECK_EQUAL(UNICODE_STRING_SIMPLE("$caf\u00e9").unescape(), table.GetLexeme(1));
+	CHECK_EQUAL(13, table.Starts[1]);
+	CHECK_EQUAL(pelet::T_CLOSE_TAG, table.Tokens[5]);
+	CHECK_EQUAL(pelet::yycINLINE_HTML, table.GetEndCondition(5));
+	CHECK_EQUAL(false, Lexer53.TokenizeFile(TestProjectDir + "nonexistent.php", table));
+}
+
 TEST_FIXTURE(LexicalAnalyzerTestClass, OpenStringShouldbeAnalyzed) {
 	UnicodeString code  = _U(
 		"$s = 'hello';\n"
@@ -24,13 +24,38 @@
  */
 #include <UnitTest++.h>
 #include <pelet/ParserClass.h>
+#include <pelet/SymbolRecorderClass.h>
 #include <FileTestFixtureClass.h>
 #include <TestObserverClass.h>
 #include <PeletChecks.h>
 #include <unicode/ustring.h>
 #include <vector>
+#include <string>
+#include <algorithm>
+#include <stdio.h>
 
 
+/**
+ * Defines a test of the resource parser notifications on the given fixture. The test
+ * body is run twice, once with the resource parser and once with the declaration
+ * scanner, so that both engines are held to the same results.
+ */
+#define RESOURCE_TEST_FIXTURE(Fixture, Name) \
+	class Fixture##Name##Class : public Fixture { \
+	public: \
+		void Run(); \
+	}; \
+	TEST(Name) { \
+		Fixture##Name##Class fixture; \
+		fixture.Run(); \
+	} \
+	TEST(Name##WithDeclarationScanner) { \
+		Fixture##Name##Class fixture; \
+		fixture.Parser.SetDeclarationScannerMode(true); \
+		fixture.Run(); \
+	} \
+	void Fixture##Name##Class::Run()
+
 class Parser54FeaturesTestClass {
 
 public:
@@ -65,7 +90,7 @@ public:
 
 SUITE (Parser54FeaturesTestClass) {
 
-TEST_FIXTURE(Parser54FeaturesTestClass, Traits) {
+RESOURCE_TEST_FIXTURE(Parser54FeaturesTestClass, Traits) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 
@@ -96,7 +121,7 @@ TEST_FIXTURE(Parser54FeaturesTestClass, Traits) {
 	CHECK_UNISTR_EQUALS("ezcReflectionReturnInfo", Observer.TraitUsed[1]);
 }
 
-TEST_FIXTURE(Parser54FeaturesTestClass, TraitsWithConflictsAndAlias) {
+RESOURCE_TEST_FIXTURE(Parser54FeaturesTestClass, TraitsWithConflictsAndAlias) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
@@ -201,7 +226,7 @@ TEST_FIXTURE(Parser54FeaturesTestClass, TraitsWithConflictsAndAlias) {
 	CHECK_EQUAL(pelet::TokenClass::PROTECTED, Observer.TraitAliasVisibility[2]);
 }
 
-TEST_FIXTURE(Parser54FeaturesTestClass, TraitsWithNamespaces) {
+RESOURCE_TEST_FIXTURE(Parser54FeaturesTestClass, TraitsWithNamespaces) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 
@@ -388,9 +413,39 @@ public:
 	TestObserverClass Observer;
 };
 
+/**
+ * an observer that only wants the names of the symbols
+ */
+class NamesOnlyObserverClass : public TestObserverClass {
+public:
+	int SymbolFields() const {
+		return 0;
+	}
+};
+
+/**
+ * an observer that only looks at variables
+ */
+class VariablesOnlyObserverClass : public TestObserverClass {
+public:
+	int ExpressionTypes() const {
+		return pelet::EXPRESSION_TYPE_VARIABLE;
+	}
+};
+
+/**
+ * an observer that only looks at assignments
+ */
+class AssignmentsOnlyObserverClass : public TestObserverClass {
+public:
+	int ExpressionTypes() const {
+		return pelet::EXPRESSION_TYPE_ASSIGNMENT;
+	}
+};
+
 SUITE(Parser54TestClass) {
 
-TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassObserver) {
+RESOURCE_TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassObserver) {
 		std::string file = TestProjectDir + "test.php";
 		Parser.SetClassObserver(&Observer);
 		CHECK(Parser.ScanFile(file, LintResults));
@@ -411,7 +466,7 @@ TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassObserver) {
 		CHECK_UNISTR_EQUALS("\\", Observer.DefinedNamespaceName[0]);
 }
 
-TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassMemberObserver) {
+RESOURCE_TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassMemberObserver) {
 	std::string file = TestProjectDir + "test.php";
 	Parser.SetClassMemberObserver(&Observer);
 	CHECK(Parser.ScanFile(file, LintResults));
@@ -479,7 +534,7 @@ TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyClassMemberObserver) {
 	CHECK_EQUAL(true, Observer.PropertyIsStatic[1]);	
 }
 
-TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyFunctionObserver) {
+RESOURCE_TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyFunctionObserver) {
 	std::string file = TestProjectDir + "test.php";
 	Parser.SetFunctionObserver(&Observer);
 	CHECK(Parser.ScanFile(file, LintResults));
@@ -543,7 +598,7 @@ TEST_FIXTURE(FullParser54TestClass, ScanFileShouldNotifyVariableObserver) {
 	CHECK_UNISTR_EQUALS("$user->getName()", Observer.VariableExpressionChainList[6]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassTypes) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassTypes) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"interface Runnable {}\n"
@@ -564,7 +619,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassTypes) {
 	CHECK_UNISTR_EQUALS("class TrueRunnable extends AbstractRunnable implements MyRunnable", Observer.ClassSignature[3]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithAllDefinesWithExpressions) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithAllDefinesWithExpressions) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"define ('MAX_TIME', 3 * 60);\n"
@@ -576,7 +631,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithAllDefinesWithExpressions) {
 	CHECK_UNISTR_EQUALS("\\", Observer.DefinedNamespaceName[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithMultipleNamespaces) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithMultipleNamespaces) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"namespace Second {\n"
@@ -603,7 +658,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithMultipleNamespaces) {
 	CHECK_UNISTR_EQUALS("Second", Observer.NamespaceAlias[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithNamespaces) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithNamespaces) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"namespace First;\n"
@@ -643,7 +698,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithClassesWithNamespaces) {
 	CHECK_UNISTR_EQUALS("MY_CONST", Observer.DefinedName[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassMemberTypes) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassMemberTypes) {
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
 		"interface Runnable { const MSG = 'const'; abstract function run();}\n"
@@ -712,7 +767,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithAllPossibleClassMemberTypes) {
 	CHECK(Observer.MethodHasVariableArguments[3]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithFunctions) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithFunctions) {
 	Parser.SetFunctionObserver(&Observer);
 	UnicodeString code = _U(
 		// test the reference return
@@ -792,7 +847,35 @@ TEST_FIXTURE(Parser54TestClass, ScanStringMethodVariableArgsWithExpressionObserv
 	CHECK(Observer.MethodHasVariableArguments[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithReturnAnnotationsNamespaces) {
+TEST_FIXTURE(Parser54TestClass, ScanStringVariableArgsWithUnwantedExpressions) {
+	
+	// the calls are inside of expressions that the observer does not want
+	AssignmentsOnlyObserverClass observer;
+	Parser.SetClassMemberObserver(&observer);
+	Parser.SetFunctionObserver(&observer);
+	Parser.SetExpressionObserver(&observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function first() {\n"
+		"     return 1 + func_get_arg(0); \n"
+		"  }\n"
+		"  function second($x) {\n"
+		"     return $x;\n"
+		"  }\n"
+		"}\n"
+		"function third($x) {\n"
+		"   return $x ? func_get_args() : null; \n"
+		"}\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(2, observer.MethodHasVariableArguments);
+	CHECK(observer.MethodHasVariableArguments[0]);
+	CHECK_EQUAL(false, observer.MethodHasVariableArguments[1]);
+	CHECK_VECTOR_SIZE(1, observer.FunctionHasVariableArguments);
+	CHECK(observer.FunctionHasVariableArguments[0]);
+}
+
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithReturnAnnotationsNamespaces) {
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
 		"namespace First;\n"
@@ -818,7 +901,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringWithReturnAnnotationsNamespaces) {
 	CHECK_UNISTR_EQUALS("public function stop()", Observer.MethodSignature[1]);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringWithUndeclaredClassMemberAssignments) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringWithUndeclaredClassMemberAssignments) {
 	Parser.SetClassMemberObserver(&Observer);
 
 	// even though there are two assignments we shoule get notified only once
@@ -1106,7 +1189,7 @@ TEST_FIXTURE(Parser54TestClass, ShouldUsePhpDocAnnotations) {
 	//CHECK_UNISTR_EQUALS("Integer", Observer.VariablePhpDocType[5]);
 }
 
-TEST_FIXTURE(Parser54TestClass, MethodScope) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, MethodScope) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 	Parser.SetFunctionObserver(&Observer);
@@ -1124,7 +1207,772 @@ TEST_FIXTURE(Parser54TestClass, MethodScope) {
 	CHECK_EQUAL((16 + 1 + 18 + 4), Observer.MethodEndingPos[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, IncludeWithStringConstant) {
+TEST_FIXTURE(Parser54TestClass, OutlineModeShouldFindSameDeclarations) {
+	UnicodeString code = _U(
+		"namespace First;\n"
+		"interface Runnable { function run($times = 1); }\n"
+		"abstract class MyClass implements Runnable {\n"
+		"  private $name = '{';\n"
+		"  abstract protected function check(array $list = array(1, array(2)));\n"
+		"  function run($times = 1) {\n"
+		"    $str = \"}{$this->name}\"; $x = '}';\n"
+		"    // } a comment with a brace\n"
+		"    /* } */ \n"
+		"    $doc = <<<EOF\n"
+		"}}}\n"
+		"EOF;\n"
+		"    $f = function($a) use ($times) { if ($a) { return array_map(function($b) { return $b; }, $a); } };\n"
+		"    return func_get_args();\n"
+		"  }\n"
+		"  public static function &make() { return new MyClass(); }\n"
+		"}\n"
+		"function helper($a, $b = array()) {\n"
+		"  while (true) { if ($a) { break; } }\n"
+		"}\n"
+		"$closure = function() { return '}'; };\n"
+		"class Last { function done() { } }\n"
+	);
+	TestObserverClass outlineObserver;
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.SetFunctionObserver(&Observer);
+	CHECK(Parser.ScanString(code, LintResults));
+
+	Parser.SetOutlineMode(true);
+	Parser.SetClassObserver(&outlineObserver);
+	Parser.SetClassMemberObserver(&outlineObserver);
+	Parser.SetFunctionObserver(&outlineObserver);
+	CHECK(Parser.ScanString(code, LintResults));
+	
+	CHECK_VECTOR_SIZE(3, outlineObserver.ClassName);
+	CHECK_VECTOR_SIZE(5, outlineObserver.MethodName);
+	CHECK_VECTOR_SIZE(1, outlineObserver.FunctionName);
+	CHECK(Observer.ClassName == outlineObserver.ClassName);
+	CHECK(Observer.MethodName == outlineObserver.MethodName);
+	CHECK(Observer.MethodSignature == outlineObserver.MethodSignature);
+	CHECK(Observer.MethodHasVariableArguments == outlineObserver.MethodHasVariableArguments);
+	CHECK(Observer.PropertyName == outlineObserver.PropertyName);
+	CHECK(Observer.FunctionSignature == outlineObserver.FunctionSignature);
+	CHECK(Observer.MethodStartingPos == outlineObserver.MethodStartingPos);
+	CHECK(Observer.MethodEndingPos == outlineObserver.MethodEndingPos);
+	CHECK(Observer.FunctionStartingPos == outlineObserver.FunctionStartingPos);
+	CHECK(Observer.FunctionEndingPos == outlineObserver.FunctionEndingPos);
+	CHECK_VECTOR_SIZE(5, outlineObserver.MethodHasVariableArguments);
+	CHECK(outlineObserver.MethodHasVariableArguments[2]);
+}
+
+TEST_FIXTURE(Parser54TestClass, OutlineModeShouldNotParseBodies) {
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function work() {\n"
+		"    $x = ;\n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	Parser.SetOutlineMode(true);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.MethodName);
+	CHECK_UNISTR_EQUALS("work", Observer.MethodName[0]);
+}
+
+TEST_FIXTURE(Parser54TestClass, OutlineModeShouldFailOnUnclosedBody) {
+	Parser.SetOutlineMode(true);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function work() {\n"
+		"    if (true) { \n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+}
+
+static std::string RecordDeclarations(pelet::ParserClass& parser, const UnicodeString& code, bool scanner, 
+		pelet::LintResultsClass& results) {
+	pelet::SymbolRecorderClass recorder;
+	parser.SetDeclarationScannerMode(scanner);
+	parser.SetClassObserver(&recorder);
+	parser.SetClassMemberObserver(&recorder);
+	parser.SetFunctionObserver(&recorder);
+	std::string bytes;
+	if (parser.ScanString(code, results)) {
+		recorder.Write(bytes);
+	}
+	return bytes;
+}
+
+TEST_FIXTURE(Parser54TestClass, DeclarationScannerShouldNotifySameAsResourceParser) {
+	UnicodeString code = _U(
+		"namespace First\\Child;\n"
+		"use Second\\Child as Other, \\Third;\n"
+		"const MAX = 10, MIN = -1;\n"
+		"define('ONE', 1);\n"
+		"require_once __DIR__ . '/lib.php';\n"
+		"/**\n"
+		" * @property string $magic\n"
+		" * @method int count()\n"
+		" */\n"
+		"abstract class MyClass extends \\Base implements Runnable, namespace\\Stoppable {\n"
+		"  use TraitOne, TraitTwo { TraitOne::run insteadof TraitTwo; TraitTwo::run as protected runTwo; }\n"
+		"  const START = 1, END = array(1, 2);\n"
+		"  /** the name */\n"
+		"  public static $name = 'x', $address;\n"
+		"  var $list = array(\n"
+		"    self::START\n"
+		"  );\n"
+		"  abstract protected function check(array $list = array(1), callable $c = NULL);\n"
+		"  public function &run(\\Foo\\Bar $b, &$times = MAX) {\n"
+		"    $this->total = 1;\n"
+		"    $this->parent->child = 2;\n"
+		"    $this->work()->done = 3;\n"
+		"    $copy = $this;\n"
+		"    echo $this->first, $this->second;\n"
+		"    list($a, $b) = $this->pair;\n"
+		"    if ($times): include 'a.php'; elseif (include 'b.php'): define('TWO', 2); endif;\n"
+		"    switch ($times) { case 1: define('CASE_ONE', 1); break; default: define('CASE_DEFAULT', 2); }\n"
+		"    $f = function($x) use (&$times) { $this->inClosure = 1; };\n"
+		"    return func_get_args();\n"
+		"  }\n"
+		"}\n"
+		"interface Runnable extends Countable { function run(); }\n"
+		"trait TraitOne { public $count; function run() { $this->ran = true; } }\n"
+		"function helper($a, $b = array()) {\n"
+		"  while (true) { if ($a) { break; } }\n"
+		"  function inner() { }\n"
+		"}\n"
+		"?>\n<html><?php echo $x; ?></html>\n"
+	);
+	pelet::LintResultsClass scannerResults;
+	std::string expected = RecordDeclarations(Parser, code, false, LintResults);
+	std::string actual = RecordDeclarations(Parser, code, true, scannerResults);
+	CHECK(!expected.empty());
+	CHECK(expected == actual);
+
+	Parser.SetOutlineMode(true);
+	expected = RecordDeclarations(Parser, code, false, LintResults);
+	actual = RecordDeclarations(Parser, code, true, scannerResults);
+	CHECK(!expected.empty());
+	CHECK(expected == actual);
+}
+
+TEST_FIXTURE(Parser54TestClass, DeclarationScannerShouldNotifyAssignedProperties) {
+	Parser.SetDeclarationScannerMode(true);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  private $name;\n"
+		"  function work() {\n"
+		"    $this->name = 'x';\n"
+		"    $this->address->city = 'y';\n"
+		"    $this->save();\n"
+		"    $this->phone = $this->fax;\n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(3, Observer.PropertyName);
+	CHECK_UNISTR_EQUALS("$name", Observer.PropertyName[0]);
+	CHECK_UNISTR_EQUALS("$address", Observer.PropertyName[1]);
+	CHECK_UNISTR_EQUALS("$phone", Observer.PropertyName[2]);
+}
+
+TEST_FIXTURE(Parser54TestClass, DeclarationScannerShouldFailOnSyntaxError) {
+	Parser.SetDeclarationScannerMode(true);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function work() {\n"
+		"    $x = ;\n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	CHECK_EQUAL(3, LintResults.LineNumber);
+	CHECK(LintResults.Error.length() > 0);
+	CHECK_VECTOR_SIZE(0, Observer.ClassName);
+	CHECK_VECTOR_SIZE(0, Observer.MethodName);
+	
+	// the body is not parsed in outline mode
+	Parser.SetOutlineMode(true);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.MethodName);
+}
+
+TEST_FIXTURE(Parser54TestClass, LazyBodyModeShouldRecordBodies) {
+	Parser.SetLazyBodyMode(true);
+	Parser.SetFunctionObserver(&Observer);
+	Parser.SetVariableObserver(&Observer);
+	UnicodeString code = _U(
+		"namespace First;\n"
+		"$global = 1;\n"
+		"function work($a) {\n"
+		"  $args = func_get_args();\n"
+		"  $s = \"}\";\n"
+		"}\n"
+		"class MyClass {\n"
+		"  abstract function stop();\n"
+		"  function run() { if (true) { $b = 2; } }\n"
+		"}\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(2, LintResults.Bodies);
+	CHECK_UNISTR_EQUALS("work", LintResults.Bodies[0].Scope.MethodName);
+	CHECK_UNISTR_EQUALS("\\First", LintResults.Bodies[0].Scope.NamespaceName);
+	CHECK_EQUAL(3, LintResults.Bodies[0].LineNumber);
+	CHECK_EQUAL(code.indexOf(UNICODE_STRING_SIMPLE("{")), LintResults.Bodies[0].StartPos);
+	CHECK_EQUAL(code.indexOf(UNICODE_STRING_SIMPLE("}\nclass")), LintResults.Bodies[0].EndPos);
+	CHECK_UNISTR_EQUALS("MyClass", LintResults.Bodies[1].Scope.ClassName);
+	CHECK_UNISTR_EQUALS("run", LintResults.Bodies[1].Scope.MethodName);
+	CHECK(LintResults.Bodies[1].Contains(code.indexOf(UNICODE_STRING_SIMPLE("$b"))));
+	CHECK_EQUAL(false, LintResults.Bodies[0].Contains(code.indexOf(UNICODE_STRING_SIMPLE("$b"))));
+	
+	// only the global and the parameter; body variables are not parsed
+	CHECK_VECTOR_SIZE(2, Observer.VariableName);
+	CHECK_UNISTR_EQUALS("$global", Observer.VariableName[0]);
+	CHECK_UNISTR_EQUALS("$a", Observer.VariableName[1]);
+	CHECK_VECTOR_SIZE(1, Observer.FunctionHasVariableArguments);
+	CHECK(Observer.FunctionHasVariableArguments[0]);
+}
+
+static std::vector<UnicodeString> SortedVariables(const TestObserverClass& observer) {
+	
+	// the order of the notifications is not the same when bodies are parsed
+	// one at a time
+	std::vector<UnicodeString> variables;
+	for (size_t i = 0; i < observer.VariableName.size(); ++i) {
+		variables.push_back(observer.VariableClassNamespace[i] + UNICODE_STRING_SIMPLE(" ") + 
+			observer.VariableClassName[i] + UNICODE_STRING_SIMPLE("::") + 
+			observer.VariableMethodName[i] + UNICODE_STRING_SIMPLE(" ") + observer.VariableName[i]);
+	}
+	std::sort(variables.begin(), variables.end());
+	return variables;
+}
+
+TEST_FIXTURE(Parser54TestClass, ScanBodyShouldNotifySameAsFullParse) {
+	Parser.SetVariableObserver(&Observer);
+	UnicodeString code = _U(
+		"namespace First;\n"
+		"use Second\\User as Person;\n"
+		"class MyClass {\n"
+		"  function run(Person $p) {\n"
+		"    $name = $p->name;\n"
+		"    $fn = function() { $inner = 1; };\n"
+		"    ?>text<?php\n"
+		"    $user = new Person;\n"
+		"  }\n"
+		"}\n"
+		"function work() { $count = 1; }\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	std::vector<UnicodeString> expected = SortedVariables(Observer);
+	CHECK(expected.size() >= 5);
+	
+	TestObserverClass lazyObserver;
+	Parser.SetVariableObserver(&lazyObserver);
+	Parser.SetLazyBodyMode(true);
+	CHECK(Parser.ScanString(code, LintResults));
+	pelet::LintResultsClass lazyResults;
+	lazyResults.Copy(LintResults);
+	CHECK_VECTOR_SIZE(2, lazyResults.Bodies);
+	for (size_t i = 0; i < lazyResults.Bodies.size(); ++i) {
+		CHECK(Parser.ScanBody(code, lazyResults.Bodies[i], LintResults));
+	}
+	std::vector<UnicodeString> actual = SortedVariables(lazyObserver);
+	CHECK_VECTOR_SIZE(expected.size(), actual);
+	for (size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+		CHECK_EQUAL(expected[i], actual[i]);
+	}
+	CHECK_EQUAL(pelet::yycSCRIPT, lazyResults.Bodies[0].Condition);
+}
+
+/**
+ * gives the code to the parser in pieces of the given length
+ */
+static bool FeedInPieces(pelet::ParserClass& parser, const UnicodeString& code, int pieceLength, pelet::LintResultsClass& results) {
+	bool ret = true;
+	for (int i = 0; i < code.length(); i += pieceLength) {
+		int length = (code.length() - i) < pieceLength ? (code.length() - i) : pieceLength;
+		ret = parser.Feed(code.getBuffer() + i, length) && ret;
+	}
+	return parser.Finish(results) && ret;
+}
+
+TEST_FIXTURE(Parser54TestClass, FeedShouldNotifySameAsScanString) {
+	TestObserverClass expected;
+	Parser.SetClassObserver(&expected);
+	Parser.SetClassMemberObserver(&expected);
+	Parser.SetFunctionObserver(&expected);
+	UnicodeString code = _U(
+		"namespace First;\n"
+		"/** the user */\n"
+		"class UserClass {\n"
+		"  /* the name */\n"
+		"  private $name = 'a \\' string';\n"
+		"  function getName() {\n"
+		"    $text = <<<EOF\n"
+		"a { long heredoc $name\n"
+		"EOF;\n"
+		"    return $this->name;\n"
+		"  }\n"
+		"}\n"
+		"// a comment\n"
+		"function work($count = 12.5) { return \"{$count}\"; }\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	int pieceLengths[] = { 1, 2, 7, 1000 };
+	for (size_t i = 0; i < sizeof(pieceLengths) / sizeof(int); ++i) {
+		TestObserverClass actual;
+		Parser.SetClassObserver(&actual);
+		Parser.SetClassMemberObserver(&actual);
+		Parser.SetFunctionObserver(&actual);
+		CHECK(FeedInPieces(Parser, UNICODE_STRING_SIMPLE("<?php ") + code, pieceLengths[i], LintResults));
+		CHECK(expected.ClassName == actual.ClassName);
+		CHECK(expected.ClassComment == actual.ClassComment);
+		CHECK(expected.PropertyName == actual.PropertyName);
+		CHECK(expected.PropertyComment == actual.PropertyComment);
+		CHECK(expected.MethodName == actual.MethodName);
+		CHECK(expected.MethodLineNumber == actual.MethodLineNumber);
+		CHECK(expected.FunctionName == actual.FunctionName);
+		CHECK(expected.FunctionSignature == actual.FunctionSignature);
+		CHECK(expected.FunctionLineNumber == actual.FunctionLineNumber);
+	}
+}
+
+TEST_FIXTURE(Parser54TestClass, FeedShouldNotifyBeforeFinish) {
+	Parser.SetClassObserver(&Observer);
+	UnicodeString code = _U("<?php\nclass UserClass {}\nfunction work() {}\nclass Admin");
+	CHECK(Parser.Feed(code.getBuffer(), code.length()));
+	CHECK_VECTOR_SIZE(1, Observer.ClassName);
+	code = _U("Class {}\n class 1; $a = 1; $b = 2; $c = 3;");
+	CHECK_EQUAL(false, Parser.Feed(code.getBuffer(), code.length()));
+	CHECK_VECTOR_SIZE(2, Observer.ClassName);
+	CHECK_UNISTR_EQUALS("AdminClass", Observer.ClassName[1]);
+	CHECK_EQUAL(false, Parser.Finish(LintResults));
+	CHECK_EQUAL(5, LintResults.LineNumber);
+	CHECK_EQUAL(71, LintResults.CharacterPosition);
+}
+
+TEST_FIXTURE(Parser54TestClass, FeedShouldNotifyVariablesSameAsScanString) {
+	Parser.SetVariableObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function run($p) {\n"
+		"    $name = $p->name;\n"
+		"    $fn = function() { $inner = 1; };\n"
+		"  }\n"
+		"}\n"
+		"function work() { $count = 1; }\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	std::vector<UnicodeString> expected = SortedVariables(Observer);
+	CHECK(expected.size() >= 4);
+
+	TestObserverClass pushObserver;
+	Parser.SetVariableObserver(&pushObserver);
+	CHECK(FeedInPieces(Parser, UNICODE_STRING_SIMPLE("<?php\n") + code, 3, LintResults));
+	std::vector<UnicodeString> actual = SortedVariables(pushObserver);
+	CHECK_VECTOR_SIZE(expected.size(), actual);
+	for (size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+		CHECK_EQUAL(expected[i], actual[i]);
+	}
+}
+
+TEST_FIXTURE(Parser54TestClass, AddObserverShouldNotifyAllObservers) {
+	TestObserverClass second;
+	Parser.SetClassObserver(&Observer);
+	Parser.AddClassObserver(&second);
+	Parser.AddClassMemberObserver(&second);
+	Parser.AddVariableObserver(&second);
+	Parser.AddExpressionObserver(&Observer);
+	Parser.AddExpressionObserver(&second);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function work() {\n"
+		"    $name = 'x';\n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.ClassName);
+	CHECK_VECTOR_SIZE(1, second.ClassName);
+	CHECK_VECTOR_SIZE(0, Observer.MethodName);
+	CHECK_VECTOR_SIZE(1, second.MethodName);
+	CHECK_VECTOR_SIZE(0, Observer.VariableName);
+	CHECK_VECTOR_SIZE(1, second.VariableName);
+	CHECK_VECTOR_SIZE(1, Observer.AssignmentExpressions);
+	CHECK_VECTOR_SIZE(1, second.AssignmentExpressions);
+	CHECK_UNISTR_EQUALS("$name", second.AssignmentExpressions[0]->Destination.ChainList[0].Name);
+
+	// set replaces all of the observers of its kind
+	TestObserverClass third;
+	Parser.SetClassObserver(&third);
+	Parser.SetClassMemberObserver(NULL);
+	Parser.SetVariableObserver(NULL);
+	Parser.SetExpressionObserver(NULL);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, third.ClassName);
+	CHECK_VECTOR_SIZE(1, Observer.ClassName);
+	CHECK_VECTOR_SIZE(1, second.ClassName);
+}
+
+TEST_FIXTURE(Parser54TestClass, SymbolFieldsShouldSkipUnwantedFields) {
+	NamesOnlyObserverClass namesOnly;
+	Parser.SetClassObserver(&namesOnly);
+	Parser.SetClassMemberObserver(&namesOnly);
+	Parser.SetFunctionObserver(&namesOnly);
+	UnicodeString code = _U(
+		"/** a user */\n"
+		"class UserClass implements Countable {\n"
+		"  /** @var string */\n"
+		"  private $name;\n"
+		"  /** @return string */\n"
+		"  function getName($prefix) { return $this->name; }\n"
+		"}\n"
+		"/** @return int */\n"
+		"function work($a, $b) { }\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, namesOnly.ClassName);
+	CHECK_UNISTR_EQUALS("UserClass", namesOnly.ClassName[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.ClassSignature[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.ClassComment[0]);
+	CHECK_VECTOR_SIZE(1, namesOnly.MethodName);
+	CHECK_UNISTR_EQUALS("getName", namesOnly.MethodName[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.MethodSignature[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.MethodReturnType[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.MethodComment[0]);
+	CHECK_VECTOR_SIZE(1, namesOnly.PropertyName);
+	CHECK_UNISTR_EQUALS("", namesOnly.PropertyType[0]);
+	CHECK_VECTOR_SIZE(1, namesOnly.FunctionName);
+	CHECK_UNISTR_EQUALS("work", namesOnly.FunctionName[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.FunctionSignature[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.FunctionReturnType[0]);
+
+	// the full parser is used when there is a variable observer; the fields are
+	// still skipped
+	NamesOnlyObserverClass fullNamesOnly;
+	Parser.SetClassObserver(&fullNamesOnly);
+	Parser.SetClassMemberObserver(&fullNamesOnly);
+	Parser.SetFunctionObserver(&fullNamesOnly);
+	Parser.SetVariableObserver(&Observer);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, fullNamesOnly.MethodName);
+	CHECK_UNISTR_EQUALS("", fullNamesOnly.MethodSignature[0]);
+	CHECK_UNISTR_EQUALS("", fullNamesOnly.MethodComment[0]);
+	CHECK_VECTOR_SIZE(1, fullNamesOnly.FunctionName);
+	CHECK_UNISTR_EQUALS("", fullNamesOnly.FunctionReturnType[0]);
+
+	// an observer that wants all fields still gets them
+	Parser.SetClassObserver(NULL);
+	Parser.SetFunctionObserver(NULL);
+	Parser.SetVariableObserver(NULL);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.AddClassMemberObserver(&namesOnly);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.MethodName);
+	CHECK_UNISTR_EQUALS("public function getName($prefix)", Observer.MethodSignature[0]);
+	CHECK_UNISTR_EQUALS("string", Observer.MethodReturnType[0]);
+}
+
+TEST_FIXTURE(Parser54TestClass, VariableSymbolFieldsShouldSkipComments) {
+	UnicodeString code = _U(
+		"function work() {\n"
+		"  /** @var string */\n"
+		"  $name = 'x';\n"
+		"}\n"
+	);
+	NamesOnlyObserverClass namesOnly;
+	Parser.SetVariableObserver(&namesOnly);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, namesOnly.VariableName);
+	CHECK_UNISTR_EQUALS("$name", namesOnly.VariableName[0]);
+	CHECK_UNISTR_EQUALS("", namesOnly.VariableComment[0]);
+	
+	// an observer that wants all fields still gets the comments
+	Parser.SetVariableObserver(&Observer);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.VariableName);
+	CHECK_UNISTR_EQUALS("/** @var string */", Observer.VariableComment[0]);
+}
+
+TEST_FIXTURE(Parser54TestClass, StreamingModeShouldNotifySameAsScanString) {
+	std::vector<UnicodeString> codes;
+	codes.push_back(_U(
+		"namespace First {\n"
+		"  use Other\\Thing as Alias;\n"
+		"  class UserClass { private $name; function getName($a) { return $this->name; } }\n"
+		"  function work() { if (true) { } }\n"
+		"}\n"
+		"namespace {\n"
+		"  include 'config.php';\n"
+		"  function rest($b, $c) { }\n"
+		"}\n"
+	));
+	codes.push_back(_U(
+		"namespace Second;\n"
+		"class AdminClass extends UserClass { const LEVEL = 1; }\n"
+		"if ($x) { function maybe() { } } else { }\n"
+		"define('LIMIT', 10);\n"
+		"__halt_compiler();\n"
+	));
+	for (size_t i = 0; i < codes.size(); ++i) {
+		for (int scanner = 0; scanner < 2; ++scanner) {
+			Parser.SetDeclarationScannerMode(scanner == 1);
+			TestObserverClass expected;
+			Parser.SetStreamingMode(false);
+			Parser.SetClassObserver(&expected);
+			Parser.SetClassMemberObserver(&expected);
+			Parser.SetFunctionObserver(&expected);
+			CHECK(Parser.ScanString(codes[i], LintResults));
+			
+			TestObserverClass actual;
+			Parser.SetStreamingMode(true);
+			Parser.SetClassObserver(&actual);
+			Parser.SetClassMemberObserver(&actual);
+			Parser.SetFunctionObserver(&actual);
+			CHECK(Parser.ScanString(codes[i], LintResults));
+			CHECK(expected.ClassName == actual.ClassName);
+			CHECK(expected.ClassNamespace == actual.ClassNamespace);
+			CHECK(expected.NamespaceName == actual.NamespaceName);
+			CHECK(expected.NamespaceUseName == actual.NamespaceUseName);
+			CHECK(expected.MethodName == actual.MethodName);
+			CHECK(expected.MethodSignature == actual.MethodSignature);
+			CHECK(expected.PropertyName == actual.PropertyName);
+			CHECK(expected.FunctionName == actual.FunctionName);
+			CHECK(expected.FunctionNamespace == actual.FunctionNamespace);
+			CHECK(expected.FunctionSignature == actual.FunctionSignature);
+			CHECK(expected.IncludeFile == actual.IncludeFile);
+			CHECK(expected.DefinedName == actual.DefinedName);
+			CHECK(!actual.ClassName.empty());
+			CHECK(!actual.FunctionName.empty());
+		}
+	}
+}
+
+TEST_FIXTURE(Parser54TestClass, ExpressionObserverShouldOnlyGetWantedTypes) {
+	VariablesOnlyObserverClass observer;
+	Parser.SetExpressionObserver(&observer);
+	UnicodeString code = _U(
+		"<?php\n"
+		"$a = 1 + 2;\n"
+		"$b = work(1, $c);\n"
+		"$x ? $y : $z;\n"
+		"isset($a, $b);\n"
+		"$d += 3;\n"
+		"$e->m(array(1, 2));\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_EQUAL((size_t)0, observer.BinaryOperations.size());
+	CHECK_EQUAL((size_t)0, observer.TernaryOperations.size());
+	CHECK_EQUAL((size_t)0, observer.IssetExpressions.size());
+	CHECK_EQUAL((size_t)0, observer.AssignmentCompoundExpressions.size());
+	CHECK_VECTOR_SIZE(2, observer.AssignmentExpressions);
+	CHECK_EQUAL(pelet::ExpressionClass::UNKNOWN, observer.AssignmentExpressions[0]->Expression->ExpressionType);
+	CHECK_EQUAL(pelet::ExpressionClass::VARIABLE, observer.AssignmentExpressions[1]->Expression->ExpressionType);
+	pelet::VariableClass* call = (pelet::VariableClass*)observer.AssignmentExpressions[1]->Expression;
+	CHECK_VECTOR_SIZE(1, call->ChainList);
+	CHECK_VECTOR_SIZE(2, call->ChainList[0].CallArguments);
+	CHECK_EQUAL(pelet::ExpressionClass::UNKNOWN, call->ChainList[0].CallArguments[0]->ExpressionType);
+	CHECK_EQUAL(pelet::ExpressionClass::VARIABLE, call->ChainList[0].CallArguments[1]->ExpressionType);
+	CHECK_VECTOR_SIZE(1, observer.VariableExpressions);
+	CHECK_VECTOR_SIZE(2, observer.VariableExpressions[0]->ChainList);
+	CHECK_EQUAL(pelet::ExpressionClass::UNKNOWN, observer.VariableExpressions[0]->ChainList[1].CallArguments[0]->ExpressionType);
+}
+
+TEST_FIXTURE(Parser54TestClass, ExpressionTypesShouldBeIgnoredWithVariableObserver) {
+	VariablesOnlyObserverClass observer;
+	Parser.SetExpressionObserver(&observer);
+	Parser.SetVariableObserver(&observer);
+	UnicodeString code = _U(
+		"<?php\n"
+		"$a = 1 + 2;\n"
+	);
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(1, observer.AssignmentExpressions);
+	CHECK_EQUAL(pelet::ExpressionClass::BINARY_OPERATION, observer.AssignmentExpressions[0]->Expression->ExpressionType);
+}
+
+TEST_FIXTURE(Parser54TestClass, SessionModeShouldNotifySameAsNewParser) {
+	std::vector<std::string> files;
+	files.push_back("long.php");
+	CreateFixtureFile(files.back(), 
+		"<?php\n"
+		"namespace First;\n"
+		"use Other\\Thing as Alias;\n"
+		"/** the users */\n"
+		"class UserClass { private $name; function getName($a) { return $this->name; } }\n"
+		"function work() { if (true) { } }\n"
+		"include 'config.php';\n"
+		"define('LIMIT', 10);\n"
+	);
+	files.push_back("short.php");
+	CreateFixtureFile(files.back(), 
+		"<?php\n"
+		"class AdminClass extends UserClass { const LEVEL = 1; }\n"
+	);
+	files.push_back("long.php");
+	pelet::FileBufferTypes bufferTypes[] = { pelet::STREAMING_FILE_BUFFER, pelet::MAPPED_UTF8_FILE_BUFFER, pelet::UTF8_FILE_BUFFER };
+	Parser.SetSessionMode(true);
+	for (int type = 0; type < 3; ++type) {
+		for (int scanner = 0; scanner < 2; ++scanner) {
+			Parser.SetFileBufferType(bufferTypes[type]);
+			Parser.SetDeclarationScannerMode(scanner == 1);
+			for (size_t i = 0; i < files.size(); ++i) {
+				std::string file = TestProjectDir + files[i];
+				TestObserverClass expected;
+				pelet::ParserClass newParser;
+				newParser.SetVersion(pelet::PHP_54);
+				newParser.SetFileBufferType(bufferTypes[type]);
+				newParser.SetDeclarationScannerMode(scanner == 1);
+				newParser.SetClassObserver(&expected);
+				newParser.SetClassMemberObserver(&expected);
+				newParser.SetFunctionObserver(&expected);
+				CHECK(newParser.ScanFile(file, LintResults));
+
+				TestObserverClass actual;
+				Parser.SetClassObserver(&actual);
+				Parser.SetClassMemberObserver(&actual);
+				Parser.SetFunctionObserver(&actual);
+				CHECK(Parser.ScanFile(file, LintResults));
+				CHECK(expected.ClassName == actual.ClassName);
+				CHECK(expected.ClassComment == actual.ClassComment);
+				CHECK(expected.NamespaceUseName == actual.NamespaceUseName);
+				CHECK(expected.MethodName == actual.MethodName);
+				CHECK(expected.MethodSignature == actual.MethodSignature);
+				CHECK(expected.PropertyName == actual.PropertyName);
+				CHECK(expected.FunctionName == actual.FunctionName);
+				CHECK(expected.IncludeFile == actual.IncludeFile);
+				CHECK(expected.DefinedName == actual.DefinedName);
+				CHECK(!actual.ClassName.empty());
+			}
+		}
+	}
+	Parser.SetSessionMode(false);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.SetFunctionObserver(&Observer);
+	CHECK(Parser.ScanFile(TestProjectDir + files[1], LintResults));
+	CHECK_VECTOR_SIZE(1, Observer.ClassName);
+}
+
+TEST_FIXTURE(Parser54TestClass, PipelineModeShouldNotifySameAsNormalMode) {
+	std::string code = 
+		"<?php\n"
+		"namespace First;\n"
+		"use Other\\Thing as Alias;\n";
+	for (int i = 0; i < 20; ++i) {
+		char item[768];
+		snprintf(item, sizeof(item),
+			"/** the class %d */\n"
+			"class UserClass%d extends Alias {\n"
+			"\t/** @var string */\n"
+			"\tprivate $name = 'it\\'s';\n"
+			"\tfunction getName(Alias $a) {\n"
+			"\t\t/** @var Alias $b */\n"
+			"\t\t$b = $a->thing(\"{$this->name}\\t\");\n"
+			"\t\t$c = <<<EOF\nline $b\nEOF;\n"
+			"\t\treturn $this->name;\n"
+			"\t}\n"
+			"}\n"
+			"function work%d() { $d = new UserClass%d(); $d->getName(null); }\n"
+			"define('LIMIT%d', %d);\n", i, i, i, i, i, i);
+		code += item;
+	}
+	CreateFixtureFile("pipeline.php", code);
+	std::string file = TestProjectDir + "pipeline.php";
+	pelet::FileBufferTypes bufferTypes[] = { pelet::STREAMING_FILE_BUFFER, pelet::MAPPED_UTF8_FILE_BUFFER, pelet::UTF8_FILE_BUFFER };
+	for (int type = 0; type < 3; ++type) {
+		pelet::SymbolRecorderClass expected;
+		pelet::ParserClass normalParser;
+		normalParser.SetVersion(pelet::PHP_54);
+		normalParser.SetFileBufferType(bufferTypes[type]);
+		normalParser.SetClassObserver(&expected);
+		normalParser.SetClassMemberObserver(&expected);
+		normalParser.SetFunctionObserver(&expected);
+		CHECK(normalParser.ScanFile(file, LintResults));
+
+		pelet::SymbolRecorderClass actual;
+		Parser.SetPipelineMode(true, 1);
+		Parser.SetFileBufferType(bufferTypes[type]);
+		Parser.SetClassObserver(&actual);
+		Parser.SetClassMemberObserver(&actual);
+		Parser.SetFunctionObserver(&actual);
+		CHECK(Parser.ScanFile(file, LintResults));
+		std::string expectedBytes, actualBytes;
+		expected.Write(expectedBytes);
+		actual.Write(actualBytes);
+		CHECK_EQUAL(expected.Events.size(), actual.Events.size());
+		CHECK(expectedBytes == actualBytes);
+	}
+
+	// the full parser, which also asks for the comments and positions of variables
+	TestObserverClass expected;
+	pelet::ParserClass normalParser;
+	normalParser.SetVersion(pelet::PHP_54);
+	normalParser.SetClassMemberObserver(&expected);
+	normalParser.SetFunctionObserver(&expected);
+	normalParser.SetVariableObserver(&expected);
+	CHECK(normalParser.ScanFile(file, LintResults));
+
+	TestObserverClass actual;
+	Parser.SetFileBufferType(pelet::STREAMING_FILE_BUFFER);
+	Parser.SetClassObserver(NULL);
+	Parser.SetClassMemberObserver(&actual);
+	Parser.SetFunctionObserver(&actual);
+	Parser.SetVariableObserver(&actual);
+	CHECK(Parser.ScanFile(file, LintResults));
+	CHECK_VECTOR_SIZE(80, actual.VariableName);
+	CHECK(expected.VariableName == actual.VariableName);
+	CHECK(expected.VariableComment == actual.VariableComment);
+	CHECK(expected.VariablePhpDocType == actual.VariablePhpDocType);
+	CHECK(expected.MethodComment == actual.MethodComment);
+	CHECK(expected.MethodStartingPos == actual.MethodStartingPos);
+	CHECK(expected.MethodEndingPos == actual.MethodEndingPos);
+	CHECK(expected.FunctionStartingPos == actual.FunctionStartingPos);
+	CHECK(expected.FunctionEndingPos == actual.FunctionEndingPos);
+	CHECK(expected.PropertyComment == actual.PropertyComment);
+}
+
+TEST_FIXTURE(Parser54TestClass, PipelineModeShouldReportSameError) {
+	UnicodeString code = _U(
+		"<?php\n"
+		"class UserClass {\n"
+		"\tfunction getName() {\n"
+		"\t\treturn $this->name;\n"
+		"\t}\n"
+		"}\n"
+		"function broken( {\n"
+		"}\n"
+	);
+	pelet::LintResultsClass expected;
+	pelet::ParserClass normalParser;
+	normalParser.SetVersion(pelet::PHP_54);
+	CHECK_EQUAL(false, normalParser.LintString(code, expected));
+
+	Parser.SetPipelineMode(true, 1);
+	CHECK_EQUAL(false, Parser.LintString(code, LintResults));
+	CHECK_EQUAL(7, LintResults.LineNumber);
+	CHECK_EQUAL(expected.LineNumber, LintResults.LineNumber);
+	CHECK_EQUAL(expected.CharacterPosition, LintResults.CharacterPosition);
+	CHECK(expected.Error == LintResults.Error);
+
+	// the same parser can be used again, with or without the pipeline
+	Parser.SetClassObserver(&Observer);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	CHECK_EQUAL(expected.LineNumber, LintResults.LineNumber);
+	Parser.SetPipelineMode(false);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	CHECK_EQUAL(expected.LineNumber, LintResults.LineNumber);
+}
+
+RESOURCE_TEST_FIXTURE(Parser54TestClass, IncludeWithStringConstant) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"require ('db_functions_0.php');\n"
@@ -1140,7 +1988,7 @@ TEST_FIXTURE(Parser54TestClass, IncludeWithStringConstant) {
 	CHECK_UNISTR_EQUALS("db_functions_3.php", Observer.IncludeFile[3]);
 }
 
-TEST_FIXTURE(Parser54TestClass, IncludeWithExpression) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, IncludeWithExpression) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"@include($file);\n"
@@ -1152,7 +2000,7 @@ TEST_FIXTURE(Parser54TestClass, IncludeWithExpression) {
 	CHECK_UNISTR_EQUALS("", Observer.IncludeFile[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, IncludeWithMagicConstant) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, IncludeWithMagicConstant) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"include (__DIR__ . '/file.php');\n"
@@ -1165,7 +2013,7 @@ TEST_FIXTURE(Parser54TestClass, IncludeWithMagicConstant) {
 
 }
 
-TEST_FIXTURE(Parser54TestClass, ClassLineNumber) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ClassLineNumber) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
@@ -1186,7 +2034,7 @@ TEST_FIXTURE(Parser54TestClass, ClassLineNumber) {
 	CHECK_EQUAL(4, Observer.ClassLineNumber[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, MethodLineNumber) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, MethodLineNumber) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
@@ -1204,7 +2052,7 @@ TEST_FIXTURE(Parser54TestClass, MethodLineNumber) {
 	CHECK_EQUAL(3, Observer.MethodLineNumber[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, PropertyLineNumber) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, PropertyLineNumber) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetClassMemberObserver(&Observer);
 	UnicodeString code = _U(
@@ -1220,7 +2068,7 @@ TEST_FIXTURE(Parser54TestClass, PropertyLineNumber) {
 	CHECK_EQUAL(2, Observer.PropertyLineNumber[0]);
 }
 
-TEST_FIXTURE(Parser54TestClass, IncludeLineNumber) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, IncludeLineNumber) {
 	Parser.SetClassObserver(&Observer);
 	UnicodeString code = _U(
 		"require 'db_functions_0.php';\n"             // line 1
@@ -1257,7 +2105,7 @@ TEST_FIXTURE(Parser54TestClass, IncludeWithExpressionObserver) {
 	CHECK_SCALAR("/db_functions_0.php", binary->RightOperand);
 }
 
-TEST_FIXTURE(Parser54TestClass, NamespaceAlias) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, NamespaceAlias) {
 	Parser.SetClassObserver(&Observer);
 	Parser.SetFunctionObserver(&Observer);
 	UnicodeString code = _U(
@@ -2062,7 +2910,144 @@ TEST_FIXTURE(Parser54TestClass, LintStringShouldReturnFalseOnBadCode) {
 	CHECK(LintResults.LineNumber > 0);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeBadAnonymousScope) {
+TEST_FIXTURE(Parser54TestClass, LintStringShouldReturnAllErrors) {
+	UnicodeString code = _U(
+		"$a = ;\n"
+		"$b = 1;\n"
+		"class MyClass {\n"
+		"  public $c = ;\n"
+		"  function work() {\n"
+		"    $d = $e +;\n"
+		"  }\n"
+		"}\n"
+	);
+	CHECK_EQUAL(false, Parser.LintString(code, LintResults));
+	CHECK_VECTOR_SIZE(3, LintResults.Errors);
+	CHECK_EQUAL(1, LintResults.Errors[0].LineNumber);
+	CHECK_EQUAL(4, LintResults.Errors[1].LineNumber);
+	CHECK_EQUAL(6, LintResults.Errors[2].LineNumber);
+	CHECK(LintResults.Errors[2].Error.length() > 0);
+	
+	// the single error properties are those of the first error
+	CHECK_EQUAL(LintResults.Errors[0].Error, LintResults.Error);
+	CHECK_EQUAL(1, LintResults.LineNumber);
+	CHECK_EQUAL(5, LintResults.CharacterPosition);
+}
+
+TEST_FIXTURE(Parser54TestClass, ScanStringShouldNotifySymbolsAfterErrors) {
+	Parser.SetClassObserver(&Observer);
+	Parser.SetClassMemberObserver(&Observer);
+	Parser.SetVariableObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  public $c = ;\n"
+		"  function work() {\n"
+		"    $d = ;\n"
+		"    $name = 'x';\n"
+		"  }\n"
+		"}\n"
+		"$x = ;\n"
+		"class Second {}\n"
+	);
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	CHECK_VECTOR_SIZE(3, LintResults.Errors);
+	CHECK_EQUAL(2, LintResults.LineNumber);
+	CHECK_UNISTR_EQUALS("MyClass", LintResults.Scope.ClassName);
+	CHECK_VECTOR_SIZE(2, Observer.ClassName);
+	CHECK_UNISTR_EQUALS("MyClass", Observer.ClassName[0]);
+	CHECK_UNISTR_EQUALS("Second", Observer.ClassName[1]);
+	CHECK_VECTOR_SIZE(1, Observer.MethodName);
+	CHECK_UNISTR_EQUALS("work", Observer.MethodName[0]);
+	CHECK_VECTOR_SIZE(1, Observer.VariableName);
+	CHECK_UNISTR_EQUALS("$name", Observer.VariableName[0]);
+}
+
+TEST_FIXTURE(Parser54TestClass, ScanStringShouldStopWhenCancelled) {
+	pelet::CancelTokenClass cancelToken;
+	Parser.SetCancelToken(&cancelToken);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetVariableObserver(&Observer);
+	UnicodeString code = _U(
+		"class MyClass {\n"
+		"  function work() {\n"
+		"    $name = 'x';\n"
+		"  }\n"
+		"}\n"
+	);
+	cancelToken.Cancel();
+	CHECK_EQUAL(false, Parser.ScanString(code, LintResults));
+	CHECK(LintResults.IsCancelled);
+	CHECK(LintResults.Error.isEmpty());
+	CHECK_VECTOR_SIZE(0, LintResults.Errors);
+	CHECK_VECTOR_SIZE(0, Observer.ClassName);
+	CHECK_VECTOR_SIZE(0, Observer.VariableName);
+	
+	// the parser can be used again
+	cancelToken.Reset();
+	CHECK(Parser.ScanString(code, LintResults));
+	CHECK_EQUAL(false, LintResults.IsCancelled);
+	CHECK_VECTOR_SIZE(1, Observer.ClassName);
+	CHECK_VECTOR_SIZE(1, Observer.VariableName);
+}
+
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanFileShouldNotAcceptCancelledCode) {
+	pelet::CancelTokenClass cancelToken;
+	Parser.SetCancelToken(&cancelToken);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetFunctionObserver(&Observer);
+	
+	// every statement is complete, so the lexer stops at the end of a statement.
+	// a file is used so that opening it does not use up the deadline
+	std::string code = "<?php class MyClass {}\n";
+	for (int i = 0; i < 1000000; ++i) {
+		code += ";\n";
+	}
+	code += "function work() {}\n";
+	CreateFixtureFile("cancelled.php", code);
+	cancelToken.SetDeadline(10);
+	CHECK_EQUAL(false, Parser.ScanFile(TestProjectDir + "cancelled.php", LintResults));
+	CHECK(LintResults.IsCancelled);
+	CHECK_VECTOR_SIZE(0, Observer.ClassName);
+	CHECK_VECTOR_SIZE(0, Observer.FunctionName);
+}
+
+TEST_FIXTURE(Parser54TestClass, FullScanFileShouldNotAcceptCancelledCode) {
+	pelet::CancelTokenClass cancelToken;
+	Parser.SetCancelToken(&cancelToken);
+	Parser.SetClassObserver(&Observer);
+	Parser.SetVariableObserver(&Observer);
+	std::string code = "<?php class MyClass {}\n";
+	for (int i = 0; i < 1000000; ++i) {
+		code += ";\n";
+	}
+	CreateFixtureFile("cancelled.php", code);
+	cancelToken.SetDeadline(10);
+	CHECK_EQUAL(false, Parser.ScanFile(TestProjectDir + "cancelled.php", LintResults));
+	CHECK(LintResults.IsCancelled);
+	CHECK_VECTOR_SIZE(0, Observer.ClassName);
+	CHECK_VECTOR_SIZE(0, Observer.VariableName);
+}
+
+TEST_FIXTURE(Parser54TestClass, LintStringShouldStopAtDeadline) {
+	pelet::CancelTokenClass cancelToken;
+	Parser.SetCancelToken(&cancelToken);
+	UnicodeString code;
+	for (int i = 0; i < 200000; ++i) {
+		code.append(UNICODE_STRING_SIMPLE("$a = $b + 1;\n"));
+	}
+	code.append(UNICODE_STRING_SIMPLE("$a = ;\n"));
+	cancelToken.SetDeadline(1);
+	CHECK_EQUAL(false, Parser.LintString(code, LintResults));
+	CHECK(LintResults.IsCancelled);
+	CHECK_VECTOR_SIZE(0, LintResults.Errors);
+	
+	cancelToken.Reset();
+	CHECK_EQUAL(false, Parser.LintString(code, LintResults));
+	CHECK_EQUAL(false, LintResults.IsCancelled);
+	CHECK_VECTOR_SIZE(1, LintResults.Errors);
+}
+
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeBadAnonymousScope) {
 	UnicodeString code = _U(
 		"<?php "
 		"class MyClass { "
@@ -2079,7 +3064,7 @@ TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeBadAnonymousScope) {
 	CHECK_EQUAL(0, LintResults.Scope.GetAnonymousFunctionCount());
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeMultipleBadAnonymousScope) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeMultipleBadAnonymousScope) {
 	UnicodeString code = _U(
 		"<?php "
 		"class MyClass { "
@@ -2142,7 +3127,7 @@ TEST_FIXTURE(Parser54TestClass, LintFileShouldReturnFalseOnBadCode) {
 	fclose(file);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnFalseOnBadCode) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnFalseOnBadCode) {
 	CreateFixtureFile("testpure.php", 
 		"<?php $'gag's = 'hello' \"again\" $not gaging;");
 	std::string filename = TestProjectDir + "testpure.php";
@@ -2167,7 +3152,7 @@ TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnFalseOnBadCode) {
 	CHECK_EQUAL(ufilename, LintResults.UnicodeFilename);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnScopeBadCode) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnScopeBadCode) {
 	CreateFixtureFile("testpure.php", 
 		"<?php "
 		"class MyClass { "
@@ -2199,7 +3184,7 @@ TEST_FIXTURE(Parser54TestClass, ScanFileShouldReturnScopeBadCode) {
 	CHECK_EQUAL(UNICODE_STRING_SIMPLE("myFunct"), LintResults.Scope.MethodName);
 }
 
-TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeBadCode) {
+RESOURCE_TEST_FIXTURE(Parser54TestClass, ScanStringShouldReturnScopeBadCode) {
 	UnicodeString code = _U(
 		"<?php "
 		"class MyClass { "
@@ -2344,4 +3329,41 @@ TEST_FIXTURE(Parser54ExpressionTestClass, ParseExpressionWithNamespaceEnd) {
 	CHECK_UNISTR_EQUALS("\\First\\", ParsedVar.ChainList[0].Name);
 }
 
+TEST_FIXTURE(Parser54ExpressionTestClass, ParseNewInstanceExpression) {
+	UnicodeString code = _U("(new \\First\\UserClass($a))->getName()->");
+	Parser.ParseExpression(code, ParsedVar);
+	CHECK_EQUAL(pelet::ExpressionClass::NEW_CALL, ParsedVar.ExpressionType);
+	CHECK_VECTOR_SIZE(3, ParsedVar.ChainList);
+	CHECK_UNISTR_EQUALS("\\First\\UserClass", ParsedVar.ChainList[0].Name);
+	CHECK_UNISTR_EQUALS("getName", ParsedVar.ChainList[1].Name);
+	CHECK(ParsedVar.ChainList[1].IsFunction);
+	CHECK_UNISTR_EQUALS("", ParsedVar.ChainList[2].Name);
+}
+
+TEST_FIXTURE(Parser54ExpressionTestClass, ExpressionChainModeShouldMatchGrammar) {
+	const char* expressions[] = {
+		"$a", "$a->b()->c", "A::b()->c::", "\\A\\B::c($d, 'e', 1)->", "new A()", "(new A)->b",
+		"func1($a)[0]->b", "$a['x']->b[1]", "$a->b->c[1]", "A::$b[0]", "$a->b($c + 1)",
+		"$a->b // comment", "$a = $b->c", "MyClass::PI", "\\First\\", NULL
+	};
+	pelet::ParserClass grammarParser;
+	grammarParser.SetVersion(pelet::PHP_54);
+	grammarParser.SetExpressionChainMode(false);
+	pelet::ScopeClass scope;
+	pelet::VariableClass grammarVar(scope);
+	for (int i = 0; expressions[i]; ++i) {
+		UnicodeString code = UnicodeString::fromUTF8(expressions[i]);
+		Parser.ParseExpression(code, ParsedVar);
+		grammarParser.ParseExpression(code, grammarVar);
+		CHECK_EQUAL(grammarVar.ExpressionType, ParsedVar.ExpressionType);
+		CHECK_VECTOR_SIZE(grammarVar.ChainList.size(), ParsedVar.ChainList);
+		for (size_t j = 0; j < grammarVar.ChainList.size() && j < ParsedVar.ChainList.size(); ++j) {
+			CHECK_EQUAL(grammarVar.ChainList[j].Name, ParsedVar.ChainList[j].Name);
+			CHECK_EQUAL(grammarVar.ChainList[j].IsFunction, ParsedVar.ChainList[j].IsFunction);
+			CHECK_EQUAL(grammarVar.ChainList[j].IsStatic, ParsedVar.ChainList[j].IsStatic);
+			CHECK_EQUAL(grammarVar.ChainList[j].IsArrayAccess, ParsedVar.ChainList[j].IsArrayAccess);
+		}
+	}
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/ProjectScannerClass.h>
+#include <pelet/ThreadClass.h>
+#include <FileTestFixtureClass.h>
+#include <unicode/unistr.h>
+#include <vector>
+#include <string>
+#include <stdio.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+/**
+ * records the calls it gets as strings, so that the order of the calls
+ * can be checked. Calls may come from many threads.
+ */
+class ProjectScannerObserverTestClass : public pelet::ProjectScannerObserverClass, public pelet::ClassObserverClass, 
+		public pelet::FunctionObserverClass {
+
+public:
+
+	std::vector<std::string> Calls;
+
+	std::vector<std::string> Failed;
+
+	pelet::MutexClass Mutex;
+
+	ProjectScannerObserverTestClass()
+		: Calls()
+		, Failed()
+		, Mutex() {
+	}
+
+	void FileStarted(const std::string& file) {
+		Add("start " + file);
+	}
+
+	void FileScanned(const std::string& file, bool parsed, const pelet::LintResultsClass& results) {
+		Add("end " + file);
+		if (!parsed) {
+			pelet::MutexLockerClass lock(Mutex);
+			Failed.push_back(file);
+		}
+	}
+
+	void ClassFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+			const UnicodeString& signature, const UnicodeString& baseClassName, 
+			const UnicodeString& implementInterfaceNames, const UnicodeString& comment, const int lineNumber) {
+		std::string name;
+		className.toUTF8String(name);
+		Add("class " + name);
+	}
+
+	void FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName, 
+			const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+			bool hasVariableArguments) {
+		std::string name;
+		functionName.toUTF8String(name);
+		Add("function " + name);
+	}
+
+private:
+
+	void Add(const std::string& call) {
+		pelet::MutexLockerClass lock(Mutex);
+		Calls.push_back(call);
+	}
+};
+
+/**
+ * counts the assignments it gets, and the number of times that it was called 
+ * by one thread while another thread was still inside of a callback
+ */
+class ProjectScannerExpressionObserverClass : public pelet::ExpressionObserverClass {
+
+public:
+
+	int Assignments;
+
+	int Overlaps;
+
+	ProjectScannerExpressionObserverClass()
+		: ExpressionObserverClass()
+		, Assignments(0)
+		, Overlaps(0)
+		, Active(0)
+		, Mutex() {
+	}
+
+	void ExpressionAssignmentFound(pelet::AssignmentExpressionClass* expression) {
+		{
+			pelet::MutexLockerClass lock(Mutex);
+			Active++;
+			Assignments++;
+		}
+		
+		// give the other workers a chance to run while this callback is active
+		pelet::ThreadClass::GiveUpTimeSlice();
+		pelet::MutexLockerClass lock(Mutex);
+		if (Active > 1) {
+			Overlaps++;
+		}
+		Active--;
+	}
+
+private:
+
+	int Active;
+
+	pelet::MutexClass Mutex;
+};
+
+class ProjectScannerFixtureClass : public FileTestFixtureClass {
+
+public:
+
+	pelet::ProjectScannerClass Scanner;
+
+	ProjectScannerObserverTestClass Observer;
+
+	ProjectScannerFixtureClass()
+		: FileTestFixtureClass()
+		, Scanner()
+		, Observer() {
+		Scanner.SetProjectObserver(&Observer);
+		Scanner.SetClassObserver(&Observer);
+		Scanner.SetFunctionObserver(&Observer);
+	}
+
+	/**
+	 * create many small files, each with one class and one function
+	 */
+	void CreateFiles(int count) {
+		for (int i = 0; i < count; ++i) {
+			char name[64];
+			snprintf(name, sizeof(name), "project_scanner_%d.php", i);
+			char code[256];
+			snprintf(code, sizeof(code), "<?php\nclass Class%d {\n function work() { }\n}\nfunction func%d() { }\n", i, i);
+			CreateFixtureFile(TestProjectDir + name, code);
+			Scanner.AddFile(TestProjectDir + name);
+		}
+	}
+};
+
+SUITE(ProjectScannerTestClass) {
+
+TEST_FIXTURE(ProjectScannerFixtureClass, InOrderShouldBeSameAsSingleThread) {
+	CreateFiles(40);
+	Scanner.SetDelivery(pelet::DELIVER_IN_ORDER);
+	Scanner.SetThreadCount(1);
+	CHECK(Scanner.Scan());
+	std::vector<std::string> expected = Observer.Calls;
+	CHECK_EQUAL((size_t)(40 * 4), expected.size());
+	CHECK_EQUAL("start project_scanner_0.php", expected[0]);
+	CHECK_EQUAL("class Class0", expected[1]);
+	CHECK_EQUAL("function func0", expected[2]);
+	CHECK_EQUAL("end project_scanner_0.php", expected[3]);
+
+	Observer.Calls.clear();
+	Scanner.SetThreadCount(4);
+	CHECK(Scanner.Scan());
+	CHECK(expected == Observer.Calls);
+}
+
+TEST_FIXTURE(ProjectScannerFixtureClass, SerializedShouldKeepFileCallbacksTogether) {
+	CreateFiles(40);
+	Scanner.SetDelivery(pelet::DELIVER_SERIALIZED);
+	Scanner.SetThreadCount(4);
+	CHECK(Scanner.Scan());
+	CHECK_EQUAL((size_t)(40 * 4), Observer.Calls.size());
+	for (size_t i = 0; i + 3 < Observer.Calls.size(); i += 4) {
+		std::string file = Observer.Calls[i].substr(6);
+		size_t number = file.find_first_of("0123456789");
+		std::string suffix = file.substr(number, file.find('.') - number);
+		CHECK_EQUAL("start " + file, Observer.Calls[i]);
+		CHECK_EQUAL("class Class" + suffix, Observer.Calls[i + 1]);
+		CHECK_EQUAL("function func" + suffix, Observer.Calls[i + 2]);
+		CHECK_EQUAL("end " + file, Observer.Calls[i + 3]);
+	}
+}
+
+TEST_FIXTURE(ProjectScannerFixtureClass, OnWorkerThreadShouldCallAllObservers) {
+	CreateFiles(40);
+	Scanner.SetDelivery(pelet::DELIVER_ON_WORKER_THREAD);
+	Scanner.SetThreadCount(4);
+	CHECK(Scanner.Scan());
+	CHECK_EQUAL((size_t)(40 * 4), Observer.Calls.size());
+	int classes = 0;
+	for (size_t i = 0; i < Observer.Calls.size(); ++i) {
+		if (Observer.Calls[i].find("class ") == 0) {
+			classes++;
+		}
+	}
+	CHECK_EQUAL(40, classes);
+}
+
+TEST_FIXTURE(ProjectScannerFixtureClass, ExpressionObserverShouldBeCalledFromOneThread) {
+	for (int i = 0; i < 40; ++i) {
+		char name[64];
+		snprintf(name, sizeof(name), "project_scanner_expr_%d.php", i);
+		CreateFixtureFile(TestProjectDir + name, 
+			"<?php\nclass Expr {\n function work() { $a = 1; $b = $a; }\n}\nfunction expr() { $c = 2; }\n");
+		Scanner.AddFile(TestProjectDir + name);
+	}
+	ProjectScannerExpressionObserverClass expressionObserver;
+	Scanner.SetExpressionObserver(&expressionObserver);
+	Scanner.SetDelivery(pelet::DELIVER_IN_ORDER);
+	Scanner.SetThreadCount(8);
+	CHECK(Scanner.Scan());
+	CHECK_EQUAL(40 * 3, expressionObserver.Assignments);
+	CHECK_EQUAL(0, expressionObserver.Overlaps);
+	CHECK_EQUAL((size_t)(40 * 4), Observer.Calls.size());
+}
+
+TEST_FIXTURE(ProjectScannerFixtureClass, ScanShouldReportFailedFiles) {
+	CreateFiles(3);
+	CreateFixtureFile(TestProjectDir + "project_scanner_error.php", "<?php\nclass {\n");
+	Scanner.AddFile(TestProjectDir + "project_scanner_error.php");
+	Scanner.SetDelivery(pelet::DELIVER_IN_ORDER);
+	Scanner.SetThreadCount(2);
+	CHECK_EQUAL(false, Scanner.Scan());
+	CHECK_EQUAL((size_t)1, Observer.Failed.size());
+	CHECK_EQUAL(TestProjectDir + "project_scanner_error.php", Observer.Failed[0]);
+}
+
+TEST_FIXTURE(ProjectScannerFixtureClass, AddDirectoryShouldFindFilesRecursively) {
+	std::string root = TestProjectDir + "project_scanner_dir";
+#if defined(__WIN32__) || defined(_WIN32)
+	_mkdir(root.c_str());
+	_mkdir((root + "\\sub").c_str());
+	std::string sep = "\\";
+#else
+	mkdir(root.c_str(), 0755);
+	mkdir((root + "/sub").c_str(), 0755);
+	std::string sep = "/";
+#endif
+	CreateFixtureFile(root + sep + "b.php", "<?php\n");
+	CreateFixtureFile(root + sep + "a.PHP", "<?php\n");
+	CreateFixtureFile(root + sep + "notes.txt", "");
+	CreateFixtureFile(root + sep + "sub" + sep + "c.php", "<?php\n");
+	std::vector<std::string> extensions;
+	extensions.push_back("php");
+	CHECK_EQUAL(3, Scanner.AddDirectory(root, extensions));
+	CHECK_EQUAL((size_t)3, Scanner.GetFiles().size());
+	if (Scanner.GetFiles().size() == 3) {
+		CHECK_EQUAL(root + sep + "a.PHP", Scanner.GetFiles()[0]);
+		CHECK_EQUAL(root + sep + "b.php", Scanner.GetFiles()[1]);
+		CHECK_EQUAL(root + sep + "sub" + sep + "c.php", Scanner.GetFiles()[2]);
+	}
+}
+
+}
@@ -0,0 +1,69 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/ParserTypeClass.h>
+#include <FileTestFixtureClass.h>
+#include <PeletChecks.h>
+#include <unicode/unistr.h>
+
+SUITE(ScopeTestClass) {
+
+TEST(CopyShouldResolveSameAliases) {
+	pelet::ScopeClass scope;
+	scope.AddNamespaceAlias(_U("First\\Child"), _U("Child"));
+	pelet::ScopeClass copy(scope);
+	CHECK_UNISTR_EQUALS("\\First\\Child", copy.ResolveAlias(_U("Child")));
+	pelet::ScopeClass assigned;
+	assigned = copy;
+	CHECK_UNISTR_EQUALS("\\First\\Child", assigned.ResolveAlias(_U("Child")));
+}
+
+TEST(AddAliasShouldNotModifyCopies) {
+	pelet::ScopeClass scope;
+	scope.AddNamespaceAlias(_U("First\\Child"), _U("Child"));
+	pelet::ScopeClass copy(scope);
+	scope.AddNamespaceAlias(_U("Second\\Other"), _U("Other"));
+	copy.AddNamespaceAlias(_U("Third\\Another"), _U("Another"));
+
+	CHECK_UNISTR_EQUALS("\\Second\\Other", scope.ResolveAlias(_U("Other")));
+	CHECK_UNISTR_EQUALS("", scope.ResolveAlias(_U("Another")));
+	CHECK_UNISTR_EQUALS("", copy.ResolveAlias(_U("Other")));
+	CHECK_UNISTR_EQUALS("\\Third\\Another", copy.ResolveAlias(_U("Another")));
+	CHECK_EQUAL((size_t)2, scope.GetNamespaceAliases().size());
+	CHECK_EQUAL((size_t)2, copy.GetNamespaceAliases().size());
+}
+
+TEST(ClearAliasesShouldNotModifyCopies) {
+	pelet::ScopeClass scope;
+	scope.AddNamespaceAlias(_U("First\\Child"), _U("Child"));
+	pelet::ScopeClass copy(scope);
+	scope.ClearAliases();
+	CHECK_UNISTR_EQUALS("", scope.ResolveAlias(_U("Child")));
+	CHECK_UNISTR_EQUALS("\\First\\Child", copy.ResolveAlias(_U("Child")));
+	copy.Clear();
+	CHECK_EQUAL((size_t)0, copy.GetNamespaceAliases().size());
+}
+
+}
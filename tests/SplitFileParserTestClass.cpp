@@ -0,0 +1,178 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/SplitFileParserClass.h>
+#include <pelet/SymbolRecorderClass.h>
+#include <FileTestFixtureClass.h>
+#include <string>
+#include <stdio.h>
+
+class SplitFileParserFixtureClass : public FileTestFixtureClass {
+
+public:
+
+	pelet::SplitFileParserClass Parser;
+
+	/**
+	 * the callbacks of the split parse
+	 */
+	pelet::SymbolRecorderClass Split;
+
+	/**
+	 * the callbacks of a sequential parse of the same file
+	 */
+	pelet::SymbolRecorderClass Sequential;
+
+	pelet::LintResultsClass SplitResults;
+
+	pelet::LintResultsClass SequentialResults;
+
+	SplitFileParserFixtureClass()
+		: FileTestFixtureClass()
+		, Parser()
+		, Split()
+		, Sequential()
+		, SplitResults()
+		, SequentialResults() {
+		Parser.SetThreadCount(4);
+		Parser.SetChunkLength(200);
+		Parser.SetVersion(pelet::PHP_54);
+		Parser.SetClassObserver(&Split);
+		Parser.SetClassMemberObserver(&Split);
+		Parser.SetFunctionObserver(&Split);
+	}
+
+	/**
+	 * parses the code with the split parser and with a sequential parser
+	 *
+	 * @return bool TRUE if both parsers return the same value
+	 */
+	bool ScanBoth(const std::string& code, bool& parsed) {
+		std::string file = TestProjectDir + "split_file.php";
+		CreateFixtureFile(file, code);
+		pelet::ParserClass parser;
+		parser.SetVersion(pelet::PHP_54);
+		parser.SetClassObserver(&Sequential);
+		parser.SetClassMemberObserver(&Sequential);
+		parser.SetFunctionObserver(&Sequential);
+		bool sequentialParsed = parser.ScanFile(file, SequentialResults);
+		parsed = Parser.ScanFile(file, SplitResults);
+		return parsed == sequentialParsed;
+	}
+
+	/**
+	 * @return the recorded callbacks, as bytes so that they can be compared
+	 */
+	std::string Bytes(const pelet::SymbolRecorderClass& recorder) {
+		std::string bytes;
+		recorder.Write(bytes);
+		return bytes;
+	}
+
+	/**
+	 * @return a file with many top-level classes and functions, in two namespaces
+	 */
+	std::string LargeFile() {
+		std::string code = "<?php\nnamespace First\\Child;\nuse \\Other\\Base as OtherBase, Second\\Model;\n";
+		for (int i = 0; i < 30; ++i) {
+			char item[512];
+			snprintf(item, sizeof(item),
+				"/** the class %d */\n"
+				"class Class%d extends OtherBase implements Model {\n"
+				"\tpublic $name = '}';\n"
+				"\tfunction work(Model $m) { $s = \"{$m->name}\"; return function() use ($s) { return $s; }; }\n"
+				"}\n"
+				"function func%d(OtherBase $b) { }\n"
+				"$closure%d = function() { };\n", i, i, i, i);
+			code += item;
+			if (15 == i) {
+				code += "namespace Second;\nuse First\\Child\\Class1;\n";
+			}
+		}
+		return code;
+	}
+};
+
+SUITE(SplitFileParserTestClass) {
+
+TEST_FIXTURE(SplitFileParserFixtureClass, SplitShouldBeSameAsSequential) {
+	bool parsed = false;
+	CHECK(ScanBoth(LargeFile(), parsed));
+	CHECK(parsed);
+	CHECK(Parser.GetChunkCount() > 1);
+	CHECK_EQUAL(false, Parser.WasFallback());
+	CHECK_EQUAL(Sequential.Events.size(), Split.Events.size());
+	CHECK(Bytes(Sequential) == Bytes(Split));
+	CHECK_EQUAL(SequentialResults.Scope.NamespaceName, SplitResults.Scope.NamespaceName);
+}
+
+TEST_FIXTURE(SplitFileParserFixtureClass, BadSplitShouldFallBackToSequential) {
+
+	// the functions are at brace depth zero, but inside of the if
+	std::string code = LargeFile();
+	code += "if (true) :\n\t$a = 1;\n";
+	for (int i = 0; i < 10; ++i) {
+		char item[256];
+		snprintf(item, sizeof(item), "function inIf%d() { $a = 'long enough to make another piece of the file'; }\n$b = %d;\n", i, i);
+		code += item;
+	}
+	code += "endif;\nclass Last { }\n";
+	bool parsed = false;
+	CHECK(ScanBoth(code, parsed));
+	CHECK(parsed);
+	CHECK(Parser.GetChunkCount() > 1);
+	CHECK(Parser.WasFallback());
+	CHECK(Bytes(Sequential) == Bytes(Split));
+}
+
+TEST_FIXTURE(SplitFileParserFixtureClass, SyntaxErrorShouldBeReported) {
+	std::string code = LargeFile();
+	code += "function broken( { }\n";
+	bool parsed = true;
+	CHECK(ScanBoth(code, parsed));
+	CHECK_EQUAL(false, parsed);
+	CHECK(Parser.WasFallback());
+	CHECK_EQUAL(SequentialResults.LineNumber, SplitResults.LineNumber);
+	CHECK_EQUAL(SequentialResults.CharacterPosition, SplitResults.CharacterPosition);
+	CHECK_EQUAL(Sequential.Events.size(), Split.Events.size());
+	CHECK(Bytes(Sequential) == Bytes(Split));
+}
+
+TEST_FIXTURE(SplitFileParserFixtureClass, BracedNamespacesShouldNotBeSplit) {
+	std::string code = "<?php\nnamespace First {\n";
+	code += LargeFile().substr(6);
+	code += "\n}\n";
+	size_t pos = code.find("namespace First\\Child;");
+	code.erase(pos, 22);
+	pos = code.find("namespace Second;");
+	code.erase(pos, 17);
+	bool parsed = false;
+	CHECK(ScanBoth(code, parsed));
+	CHECK(parsed);
+	CHECK_EQUAL(1, Parser.GetChunkCount());
+	CHECK(Bytes(Sequential) == Bytes(Split));
+}
+
+}
@@ -0,0 +1,230 @@
+/**
+ * This software is released under the terms of the MIT License
+ * 
+ * Permission is hereby granted free of charge to any person obtaining a copy
+ * of this software and associated documentation files (the "Software") to deal
+ * in the Software without restriction including without limitation the rights
+ * to use copy modify merge publish distribute sublicense and/or sell
+ * copies of the Software and to permit persons to whom the Software is
+ * furnished to do so subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND EXPRESS OR
+ * IMPLIED INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM DAMAGES OR OTHER
+ * LIABILITY WHETHER IN AN ACTION OF CONTRACT TORT OR OTHERWISE ARISING FROM
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright  2009-2012 Roberto Perpuly
+ * @license    http://www.opensource.org/licenses/mit-license.php The MIT License
+ */
+#include <UnitTest++.h>
+#include <pelet/SymbolCacheClass.h>
+#include <FileTestFixtureClass.h>
+#include <unicode/unistr.h>
+#include <vector>
+#include <string>
+#include <sys/types.h>
+#if defined(__WIN32__) || defined(_WIN32)
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+/**
+ * records the calls it gets as strings, so that the calls from a parse 
+ * and the calls from a cache can be compared
+ */
+class SymbolCacheObserverTestClass : public pelet::ClassObserverClass, public pelet::ClassMemberObserverClass, 
+		public pelet::FunctionObserverClass {
+
+public:
+
+	std::vector<std::string> Calls;
+
+	SymbolCacheObserverTestClass()
+		: Calls() {
+	}
+
+	void ClassFound(const UnicodeString& namespaceName, const UnicodeString& className, 
+			const UnicodeString& signature, const UnicodeString& baseClassName, 
+			const UnicodeString& implementInterfaceNames, const UnicodeString& comment, const int lineNumber) {
+		Add(UNICODE_STRING_SIMPLE("class ") + namespaceName + UNICODE_STRING_SIMPLE(" ") + className 
+			+ UNICODE_STRING_SIMPLE(" ") + signature + UNICODE_STRING_SIMPLE(" ") + comment, lineNumber);
+	}
+
+	void DefineDeclarationFound(const UnicodeString& namespaceName, const UnicodeString& variableName, 
+			const UnicodeString& variableValue, const UnicodeString& comment, const int lineNumber) {
+		Add(UNICODE_STRING_SIMPLE("define ") + variableName + UNICODE_STRING_SIMPLE(" ") + variableValue, lineNumber);
+	}
+
+	void NamespaceUseFound(const UnicodeString& namespaceName, const UnicodeString& alias, int lineNumber, int startingPos) {
+		Add(UNICODE_STRING_SIMPLE("use ") + namespaceName + UNICODE_STRING_SIMPLE(" ") + alias, startingPos);
+	}
+
+	void MethodFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& methodName, 
+			const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, 
+			pelet::TokenClass::TokenIds visibility, bool isStatic, const int lineNumber, bool hasVariableArguments) {
+		Add(UNICODE_STRING_SIMPLE("method ") + className + UNICODE_STRING_SIMPLE("::") + methodName + UNICODE_STRING_SIMPLE(" ") + signature
+			+ (isStatic ? UNICODE_STRING_SIMPLE(" static") : UNICODE_STRING_SIMPLE("")), visibility);
+	}
+
+	void PropertyFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& propertyName, 
+			const UnicodeString& propertyType, const UnicodeString& comment, 
+			pelet::TokenClass::TokenIds visibility, bool isConst, bool isStatic, const int lineNumber) {
+		Add(UNICODE_STRING_SIMPLE("property ") + className + UNICODE_STRING_SIMPLE("::") + propertyName 
+			+ (isConst ? UNICODE_STRING_SIMPLE(" const") : UNICODE_STRING_SIMPLE("")), lineNumber);
+	}
+
+	void TraitInsteadOfFound(const UnicodeString& namespaceName, const UnicodeString& className, const UnicodeString& traitUsedClassName,
+			const UnicodeString& traitMethodName, const std::vector<UnicodeString>& insteadOfList) {
+		UnicodeString call = UNICODE_STRING_SIMPLE("insteadof ") + traitUsedClassName + UNICODE_STRING_SIMPLE("::") + traitMethodName;
+		for (size_t i = 0; i < insteadOfList.size(); ++i) {
+			call += UNICODE_STRING_SIMPLE(" ") + insteadOfList[i];
+		}
+		Add(call, (int)insteadOfList.size());
+	}
+
+	void FunctionFound(const UnicodeString& namespaceName, const UnicodeString& functionName, 
+			const UnicodeString& signature, const UnicodeString& returnType, const UnicodeString& comment, const int lineNumber,
+			bool hasVariableArguments) {
+		Add(UNICODE_STRING_SIMPLE("function ") + functionName + UNICODE_STRING_SIMPLE(" ") + signature, lineNumber);
+	}
+
+private:
+
+	void Add(const UnicodeString& call, int number) {
+		std::string str;
+		call.toUTF8String(str);
+		char buf[32];
+		snprintf(buf, sizeof(buf), " %d", number);
+		Calls.push_back(str + buf);
+	}
+};
+
+class SymbolCacheFixtureClass : public FileTestFixtureClass {
+
+public:
+
+	SymbolCacheObserverTestClass Observer;
+
+	std::string File;
+
+	std::string CacheFile;
+
+	SymbolCacheFixtureClass()
+		: FileTestFixtureClass()
+		, Observer()
+		, File(TestProjectDir + "symbol_cache.php")
+		, CacheFile(TestProjectDir + "symbol_cache.cache") {
+		CreateFixtureFile(File, 
+			"<?php\n"
+			"namespace First\\Child;\n"
+			"use Second\\Other as Alias;\n"
+			"define('MAX', 10);\n"
+			"/** the caf\xC3\xA9 */\n"
+			"class UserClass {\n"
+			"  use TraitA, TraitB { TraitA::work insteadof TraitB, TraitC; }\n"
+			"  const MIN = 1;\n"
+			"  private $name;\n"
+			"  public static function work($a, $b = 2) { }\n"
+			"}\n"
+			"function helper($x) { }\n"
+		);
+		remove(CacheFile.c_str());
+	}
+
+	void Init(pelet::SymbolCacheClass& cache) {
+		cache.SetVersion(pelet::PHP_54);
+		cache.SetClassObserver(&Observer);
+		cache.SetClassMemberObserver(&Observer);
+		cache.SetFunctionObserver(&Observer);
+	}
+};
+
+SUITE(SymbolCacheTestClass) {
+
+TEST_FIXTURE(SymbolCacheFixtureClass, ScanFileShouldReplayFromCache) {
+	pelet::LintResultsClass results;
+	pelet::SymbolCacheClass cache;
+	Init(cache);
+	CHECK_EQUAL(false, cache.Load(CacheFile));
+	CHECK(cache.ScanFile(File, results));
+	CHECK_EQUAL(1, cache.GetMissCount());
+	std::vector<std::string> expected = Observer.Calls;
+	CHECK(expected.size() >= 7);
+	CHECK(cache.Save(CacheFile));
+
+	Observer.Calls.clear();
+	pelet::SymbolCacheClass warm;
+	Init(warm);
+	CHECK(warm.Load(CacheFile));
+	CHECK(warm.ScanFile(File, results));
+	CHECK_EQUAL(1, warm.GetHitCount());
+	CHECK_EQUAL(0, warm.GetMissCount());
+	CHECK(expected == Observer.Calls);
+
+	// saving over the loaded cache file keeps the files
+	CHECK(warm.Save(CacheFile));
+	Observer.Calls.clear();
+	CHECK(warm.ScanFile(File, results));
+	CHECK_EQUAL(2, warm.GetHitCount());
+	CHECK(expected == Observer.Calls);
+}
+
+TEST_FIXTURE(SymbolCacheFixtureClass, ScanFileShouldParseChangedFiles) {
+	pelet::LintResultsClass results;
+	pelet::SymbolCacheClass cache;
+	Init(cache);
+	CHECK(cache.ScanFile(File, results));
+	CHECK(cache.Save(CacheFile));
+
+	// same contents, different time: the hash is checked
+	struct utimbuf times;
+	times.actime = 1000000;
+	times.modtime = 1000000;
+	CHECK_EQUAL(0, utime(File.c_str(), &times));
+	pelet::SymbolCacheClass warm;
+	Init(warm);
+	CHECK(warm.Load(CacheFile));
+	CHECK(warm.ScanFile(File, results));
+	CHECK_EQUAL(1, warm.GetHitCount());
+
+	// different contents
+	CreateFixtureFile(File, "<?php\nfunction changed() { }\n");
+	Observer.Calls.clear();
+	CHECK(warm.ScanFile(File, results));
+	CHECK_EQUAL(1, warm.GetMissCount());
+	CHECK_EQUAL((size_t)1, Observer.Calls.size());
+	CHECK_EQUAL("function changed function changed() 2", Observer.Calls[0]);
+
+	// a file with errors is not cached 
+	CreateFixtureFile(File, "<?php\nclass {\n");
+	CHECK_EQUAL(false, warm.ScanFile(File, results));
+	CHECK_EQUAL(false, warm.ScanFile(File, results));
+	CHECK_EQUAL(3, warm.GetMissCount());
+}
+
+TEST_FIXTURE(SymbolCacheFixtureClass, LoadShouldRejectOtherVersionsAndBadFiles) {
+	pelet::LintResultsClass results;
+	pelet::SymbolCacheClass cache;
+	Init(cache);
+	CHECK(cache.ScanFile(File, results));
+	CHECK(cache.Save(CacheFile));
+
+	pelet::SymbolCacheClass other;
+	CHECK_EQUAL(false, other.Load(CacheFile));
+
+	CreateFixtureFile(CacheFile, "PELETSYM\x01");
+	pelet::SymbolCacheClass bad;
+	Init(bad);
+	CHECK_EQUAL(false, bad.Load(CacheFile));
+	CHECK(bad.ScanFile(File, results));
+	CHECK_EQUAL(1, bad.GetMissCount());
+}
+
+}
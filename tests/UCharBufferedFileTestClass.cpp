@@ -25,6 +25,8 @@
 #include <UnitTest++.h>
 #include <FileTestFixtureClass.h>
 #include <pelet/UCharBufferedFileClass.h>
+#include <pelet/UCharMappedFileClass.h>
+#include <pelet/Utf8BufferClass.h>
 #include <unicode/unistr.h>
 
 class UCharBufferedFileTestFixtureClass : public FileTestFixtureClass {
@@ -35,15 +37,21 @@ public:
 		: FileTestFixtureClass() {
 		MemBuffer = new pelet::UCharBufferClass();
 		FileBuffer = new pelet::UCharBufferedFileClass();
+		MappedBuffer = new pelet::UCharMappedFileClass();
+		Utf8Buffer = new pelet::Utf8BufferClass();
 	}
 	
 	~UCharBufferedFileTestFixtureClass() {
 		delete MemBuffer;
 		delete FileBuffer;
+		delete MappedBuffer;
+		delete Utf8Buffer;
 	}
 	
 	pelet::UCharBufferClass* MemBuffer;
 	pelet::UCharBufferedFileClass* FileBuffer;
+	pelet::UCharMappedFileClass* MappedBuffer;
+	pelet::Utf8BufferClass* Utf8Buffer;
 	
 };
 
@@ -353,4 +361,149 @@ TEST_FIXTURE(UCharBufferedFileTestFixtureClass, FileBufferShouldFillBufferWhenIt
 	 * */
 }
 
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, MappedBufferHasEnded) {
+	std::string fileName = "test_buffer.txt";
+	std::string test = "function";
+	CreateFixtureFile(fileName, test);
+	std::string filePath = TestProjectDir + fileName;
+
+	CHECK(MappedBuffer->OpenFile(filePath.c_str()));
+	CHECK_EQUAL(8, MappedBuffer->GetLength());
+	CHECK_EQUAL(false, MappedBuffer->HasReachedEnd());
+	CHECK_EQUAL('f', *MappedBuffer->Current++);
+	CHECK_EQUAL('u', *MappedBuffer->Current++);
+	CHECK_EQUAL('n', *MappedBuffer->Current++);
+	CHECK_EQUAL('c', *MappedBuffer->Current++);
+	CHECK_EQUAL('t', *MappedBuffer->Current++);
+	CHECK_EQUAL('i', *MappedBuffer->Current++);
+	CHECK_EQUAL('o', *MappedBuffer->Current++);
+	CHECK_EQUAL(false, MappedBuffer->HasReachedEnd());
+	CHECK_EQUAL('n', *MappedBuffer->Current++);
+	CHECK_EQUAL(0, *MappedBuffer->Current++);
+	CHECK(MappedBuffer->HasReachedEnd());
+}
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, MappedBufferWithEmptyFile) {
+	std::string fileName = "test_buffer.txt";
+	CreateFixtureFile(fileName, "");
+	std::string filePath = TestProjectDir + fileName;
+	CHECK(MappedBuffer->OpenFile(filePath.c_str()));
+	CHECK_EQUAL(0, MappedBuffer->GetLength());
+	CHECK_EQUAL(0, *MappedBuffer->Current++);
+	CHECK(MappedBuffer->HasReachedEnd());
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, MappedBufferWithMissingFile) {
+	std::string filePath = TestProjectDir + "this_file_does_not_exist.txt";
+	CHECK_EQUAL(false, MappedBuffer->OpenFile(filePath.c_str()));
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, MappedBufferShouldConvertUtf8) {
+
+	// "$a = 'n\u00e9 \u20ac \U0001F600';" long enough to go through the ASCII fast path
+	std::string test = "$abcdefghij = 'n\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80';";
+	CHECK(MappedBuffer->OpenBytes(test.c_str(), test.length()));
+	UnicodeString expected = UNICODE_STRING_SIMPLE("$abcdefghij = 'n\u00e9 \u20ac \U0001F600';").unescape();
+	UnicodeString actual(MappedBuffer->Current, MappedBuffer->GetLength());
+	CHECK_EQUAL(expected, actual);
+	CHECK_EQUAL(0, MappedBuffer->Current[MappedBuffer->GetLength()]);
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, MappedBufferShouldReplaceInvalidUtf8) {
+	
+	// a lone continuation byte, a truncated sequence, an overlong slash and an encoded surrogate
+	std::string test = "a\x80" "b\xE2\x82" "c\xC0\xAF" "d\xED\xA0\x80";
+	CHECK(MappedBuffer->OpenBytes(test.c_str(), test.length()));
+	UnicodeString actual(MappedBuffer->Current, MappedBuffer->GetLength());
+	UnicodeString expected = UNICODE_STRING_SIMPLE("a\uFFFDb\uFFFD\uFFFDc\uFFFD\uFFFDd\uFFFD\uFFFD\uFFFD").unescape();
+	CHECK_EQUAL(expected, actual);
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, Utf8BufferHasEnded) {
+	std::string fileName = "test_buffer.txt";
+	std::string test = "caf\xC3\xA9";
+	CreateFixtureFile(fileName, test);
+	std::string filePath = TestProjectDir + fileName;
+
+	CHECK(Utf8Buffer->OpenFile(filePath.c_str()));
+	CHECK_EQUAL(5, Utf8Buffer->GetLength());
+	CHECK_EQUAL(false, Utf8Buffer->HasReachedEnd());
+	CHECK_EQUAL('c', *Utf8Buffer->Current++);
+	CHECK_EQUAL('a', *Utf8Buffer->Current++);
+	CHECK_EQUAL('f', *Utf8Buffer->Current++);
+	CHECK_EQUAL(0xC3, *Utf8Buffer->Current++);
+	CHECK_EQUAL(false, Utf8Buffer->HasReachedEnd());
+	CHECK_EQUAL(0xA9, *Utf8Buffer->Current++);
+	CHECK_EQUAL(0, *Utf8Buffer->Current++);
+	CHECK(Utf8Buffer->HasReachedEnd());
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, Utf8BufferWithEmptyFile) {
+	std::string fileName = "test_buffer.txt";
+	CreateFixtureFile(fileName, "");
+	std::string filePath = TestProjectDir + fileName;
+	CHECK(Utf8Buffer->OpenFile(filePath.c_str()));
+	CHECK_EQUAL(0, Utf8Buffer->GetLength());
+	CHECK_EQUAL(0, *Utf8Buffer->Current++);
+	CHECK(Utf8Buffer->HasReachedEnd());
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, Utf8BufferWithPageSizedFile) {
+
+	// when the file fills its last page completely there is no null
+	// after the mapped contents; the buffer must still be null terminated
+	std::string fileName = "test_buffer.txt";
+	std::string test(65536, 'a');
+	CreateFixtureFile(fileName, test);
+	std::string filePath = TestProjectDir + fileName;
+	CHECK(Utf8Buffer->OpenFile(filePath.c_str()));
+	CHECK_EQUAL(65536, Utf8Buffer->GetLength());
+	CHECK_EQUAL('a', Utf8Buffer->Current[65535]);
+	CHECK_EQUAL(0, Utf8Buffer->Current[65536]);
+}
+
+TEST_FIXTURE(UCharBufferedFileTestFixtureClass, KeptBuffersShouldStartAtTheNextFile) {
+	std::string longName = "test_long.txt";
+	std::string shortName = "test_short.txt";
+	CreateFixtureFile(longName, "function longer");
+	CreateFixtureFile(shortName, "if");
+	std::string longPath = TestProjectDir + longName;
+	std::string shortPath = TestProjectDir + shortName;
+	FileBuffer->SetKeepCapacity(true);
+	MappedBuffer->SetKeepCapacity(true);
+	MemBuffer->SetKeepCapacity(true);
+
+	CHECK(FileBuffer->OpenFile(longPath.c_str(), 4));
+	while (!FileBuffer->HasReachedEnd()) {
+		FileBuffer->AppendToLexeme(1);
+		FileBuffer->Current++;
+	}
+	FileBuffer->Close();
+	CHECK(FileBuffer->OpenFile(shortPath.c_str()));
+	CHECK_EQUAL(1, FileBuffer->GetLineNumber());
+	CHECK_EQUAL(0, FileBuffer->GetCharacterPosition());
+	CHECK_EQUAL('i', *FileBuffer->Current++);
+	FileBuffer->AppendToLexeme(1);
+	CHECK_EQUAL('f', *FileBuffer->Current++);
+	FileBuffer->AppendToLexeme(1);
+	CHECK(FileBuffer->HasReachedEnd());
+	CHECK_EQUAL(0, *FileBuffer->Current);
+
+	CHECK(MappedBuffer->OpenFile(longPath.c_str()));
+	MappedBuffer->Close();
+	CHECK(MappedBuffer->OpenFile(shortPath.c_str()));
+	CHECK_EQUAL(2, MappedBuffer->GetLength());
+	CHECK_EQUAL('i', *MappedBuffer->Current++);
+	CHECK_EQUAL('f', *MappedBuffer->Current++);
+	CHECK_EQUAL(0, *MappedBuffer->Current++);
+	CHECK(MappedBuffer->HasReachedEnd());
+
+	CHECK(MemBuffer->OpenString(UNICODE_STRING_SIMPLE("function longer")));
+	MemBuffer->Close();
+	CHECK(MemBuffer->OpenString(UNICODE_STRING_SIMPLE("if")));
+	CHECK_EQUAL('i', *MemBuffer->Current++);
+	CHECK_EQUAL('f', *MemBuffer->Current++);
+	CHECK_EQUAL(0, *MemBuffer->Current++);
+	CHECK(MemBuffer->HasReachedEnd());
+}
+
 }
\ No newline at end of file